@@ -29,6 +29,7 @@
 
 #include "Action.h"
 #include "SymbolTable.h"
+#include "Symbol.h"
 
 #include "State.h"
 #include "Rule.h"
@@ -37,7 +38,7 @@
 
 
 Action::Action( Type t )
-		: myType( t ), myState( 0 ), myRule( 0 )
+		: myType( t ), myLookAhead( 0 ), myState( 0 ), myRule( 0 )
 {
 }
 
@@ -45,7 +46,7 @@ Action::Action( Type t )
 ////////////////////////////////////////
 
 
-Action::Action( Type t, const std::string &la, State *stp, Rule *rlp )
+Action::Action( Type t, size_t la, State *stp, Rule *rlp )
 		: myType( t ), myLookAhead( la ), myState( stp ), myRule( rlp )
 {
 }
@@ -161,7 +162,7 @@ Action::isIgnoreType( void ) const
 
 
 void
-Action::setLookAhead( const std::string &la )
+Action::setLookAhead( size_t la )
 {
 	myLookAhead = la;
 }
@@ -170,7 +171,7 @@ Action::setLookAhead( const std::string &la )
 ////////////////////////////////////////
 
 
-const std::string &
+size_t
 Action::getLookAhead( void ) const
 {
 	return myLookAhead;
@@ -183,7 +184,17 @@ Action::getLookAhead( void ) const
 Symbol *
 Action::getLookAheadSymbol( void ) const
 {
-	return SymbolTable::get()->find( myLookAhead );
+	return SymbolTable::get()->getNthSymbol( myLookAhead );
+}
+
+
+////////////////////////////////////////
+
+
+const std::string &
+Action::getLookAheadName( void ) const
+{
+	return getLookAheadSymbol()->getName();
 }
 
 
@@ -238,28 +249,28 @@ Action::print( std::ostream &out ) const
 	switch ( myType )
 	{
 		case SHIFT:
-			out << std::setw(25) << myLookAhead << std::setw(0);
+			out << std::setw(25) << getLookAheadName() << std::setw(0);
 			out << " SHIFT  " << myState->getStateIndex();
 			break;
 			
 		case REDUCE:
-			out << std::setw(25) << myLookAhead << std::setw(0);
+			out << std::setw(25) << getLookAheadName() << std::setw(0);
 			out << " REDUCE " << myRule->getLHS() << " ("
 				<< myRule->getRuleIndex() << ")";
 			break;
 			
 		case ACCEPT:
-			out << std::setw(25) << myLookAhead << std::setw(0);
+			out << std::setw(25) << getLookAheadName() << std::setw(0);
 			out << " ACCEPT";
 			break;
 			
 		case ERROR:
-			out << std::setw(25) << myLookAhead << std::setw(0);
+			out << std::setw(25) << getLookAheadName() << std::setw(0);
 			out << " ERROR";
 			break;
 			
 		case CONFLICT:
-			out << std::setw(25) << myLookAhead << std::setw(0);
+			out << std::setw(25) << getLookAheadName() << std::setw(0);
 			out << " REDUCE " << myRule->getLHS() << " ("
 				<< myRule->getRuleIndex() << ") ** PARSING CONFLICT **";
 			break;
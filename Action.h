@@ -28,6 +28,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <cstddef>
 
 class Symbol;
 class Rule;
@@ -53,7 +54,7 @@ public:
 	};
 	
 	Action( Type t );
-	Action( Type t, const std::string &la, State *stp, Rule *rlp );
+	Action( Type t, size_t la, State *stp, Rule *rlp );
 	Action( const Action &other );
 	~Action( void );
 	
@@ -65,10 +66,11 @@ public:
 	/// Is it a type to ignore during code gen...
 	bool isIgnoreType( void ) const;
 	
-	/// Set the look-ahead symbol
-	void setLookAhead( const std::string &la );
-	const std::string &getLookAhead( void ) const;
+	/// Set the look-ahead symbol (by symbol index)
+	void setLookAhead( size_t la );
+	size_t getLookAhead( void ) const;
 	Symbol *getLookAheadSymbol( void ) const;
+	const std::string &getLookAheadName( void ) const;
 	
 	/// New state, if a shift
 	void setState( State *stp );
@@ -84,7 +86,7 @@ public:
 private:
 	Type myType;
 	
-	std::string myLookAhead;
+	size_t myLookAhead;
 	State *myState; // only if a shift
 	Rule *myRule; // only if a reduce
 };
@@ -24,11 +24,13 @@
 //
 
 #include <algorithm>
+#include <utility>
 
 #include "ActionList.h"
 #include "Action.h"
 #include "SymbolTable.h"
 #include "Symbol.h"
+#include "Rule.h"
 
 
 ////////////////////////////////////////
@@ -52,7 +54,7 @@ ActionList::~ActionList( void )
 
 void
 ActionList::addAction( Action::Type			 type,
-					   const std::string	&lookAhead,
+					   size_t				 lookAhead,
 					   State				*state,
 					   Rule					*rule )
 {
@@ -102,54 +104,75 @@ void ActionList::sort( void )
 ////////////////////////////////////////
 
 
-void ActionList::compress( void )
+void ActionList::compress( size_t startIdx )
 {
+	typedef std::vector< std::pair< Rule *, int > > RuleCounts;
+
+	RuleCounts counts;
+	RuleCounts::iterator ri, re;
 	ListIter i, e;
 	
-	i = myActions.begin();
 	e = myActions.end();
 	
-	// Find the first REDUCE action
-	for ( ; i != e; ++i )
+	// Count the lookaheads each rule is reduced on
+	for ( i = myActions.begin(); i != e; ++i )
 	{
-		if ( (*i).getType() == Action::REDUCE )
-			break;
+		if ( (*i).getType() != Action::REDUCE ||
+			 (*i).getRule()->getLHSIndex() == startIdx )
+			continue;
+		
+		for ( ri = counts.begin(), re = counts.end(); ri != re; ++ri )
+		{
+			if ( (*ri).first == (*i).getRule() )
+				break;
+		}
+		
+		if ( ri == re )
+			counts.push_back( std::make_pair( (*i).getRule(), 1 ) );
+		else
+			++(*ri).second;
 	}
 	
-	if ( i != e )
+	// The rule reduced on the most lookaheads becomes the default, the
+	// reductions by other rules stay as exceptions to it
+	Rule *rule = 0;
+	int best = 0;
+	for ( ri = counts.begin(), re = counts.end(); ri != re; ++ri )
 	{
-		ListIter firstReduce = i;
-		// Stash off the rule
-		Rule *rule = (*i).getRule();
-
-		// See if all other REDUCE actions use the same rule
-		int cnt = 1;
-		
-		for ( ++i; i != e; ++i )
+		if ( (*ri).second > best )
 		{
-			if ( (*i).getType() == Action::REDUCE )
-			{
-				if ( (*i).getRule() != rule )
-					break;
-				++cnt;
-			}
+			rule = (*ri).first;
+			best = (*ri).second;
 		}
-		
-		if ( i == e && cnt > 1 )
+	}
+	
+	if ( ! rule )
+	{
+		// Without a default reduction a missing entry is an error
+		// already, explicit errors (from %nonassoc) add nothing
+		for ( i = myActions.begin(); i != e; ++i )
 		{
-			// Combine all REDUCE actions into a single default
-			Symbol *sym = SymbolTable::get()->findOrCreate(
-				std::string( "{default}" ) );
-			
-			(*firstReduce).setLookAhead( sym->getName() );
-			
-			for ( i = firstReduce + 1; i != e; ++i )
-			{
-				if ( (*i).getType() == Action::REDUCE )
-					(*i).setType( Action::NOT_USED );
-			}
-			
-			sort();
+			if ( (*i).getType() == Action::ERROR )
+				(*i).setType( Action::NOT_USED );
 		}
+		return;
+	}
+	
+	// Combine the REDUCE actions of the rule into a single default
+	Symbol *sym = SymbolTable::get()->getDefault();
+	bool first = true;
+	
+	for ( i = myActions.begin(); i != e; ++i )
+	{
+		if ( (*i).getType() != Action::REDUCE || (*i).getRule() != rule )
+			continue;
+		
+		if ( first )
+			(*i).setLookAhead( sym->getIndex() );
+		else
+			(*i).setType( Action::NOT_USED );
+		first = false;
 	}
+	
+	sort();
 }
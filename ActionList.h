@@ -42,7 +42,7 @@ public:
 	~ActionList( void );
 	
 	void addAction( Action::Type		 type,
-					const std::string	&lookAhead,
+					size_t				 lookAhead,
 					State				*state,
 					Rule				*rule );
 	
@@ -51,7 +51,10 @@ public:
 	const Action &getNthAction( size_t i ) const;
 	
 	void sort( void );
-	void compress( void );
+	/// Makes the rule reduced on the most lookaheads the default, except
+	/// for a rule of the start symbol startIdx (whose reduction may
+	/// accept, that needs the end of input)
+	void compress( size_t startIdx );
 	
 private:
 	typedef std::vector<Action>		List;
@@ -0,0 +1,192 @@
+/// @file Arena.h
+/// @brief Bump allocator handing out objects by 32 bit index.
+///
+///
+
+//
+// 
+// Copyright  2003-2013 Kimball Thurston
+// 
+// This program is free software; you can redisribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+// 
+//
+
+#ifndef _Arena_h_
+#define _Arena_h_
+
+#include <atomic>
+#include <new>
+#include <utility>
+#include <stdexcept>
+#include <cstddef>
+#include <stdint.h>
+
+
+////////////////////////////////////////
+
+
+/// Allocates objects of one type from large blocks and refers to them
+/// by a 32 bit index.  Objects never move, are never freed one at a
+/// time and the whole arena goes away in one sweep.  Allocation may
+/// happen from several threads at once.
+template <typename T>
+class Arena
+{
+public:
+	typedef uint32_t Index;
+	
+	static const Index NONE = Index( -1 );
+	
+	Arena( void );
+	~Arena( void );
+	
+	/// Constructs a new object in place and returns its index
+	template <typename... Args>
+	Index create( Args&&... args );
+	
+	T &operator[]( Index i );
+	const T &operator[]( Index i ) const;
+	
+	size_t size( void ) const;
+	
+private:
+	Arena( const Arena & );
+	Arena &operator=( const Arena & );
+	
+	enum
+	{
+		BLOCK_BITS = 16,
+		BLOCK_SIZE = 1 << BLOCK_BITS,
+		BLOCK_MASK = BLOCK_SIZE - 1,
+		MAX_BLOCKS = 1 << ( 32 - BLOCK_BITS )
+	};
+	
+	T *getBlock( size_t b );
+	
+	std::atomic< size_t >	myCount;
+	
+	// Only written (atomically) when a block is first needed, by then
+	// no other thread can hold an index into it yet
+	T						*myBlocks[MAX_BLOCKS];
+};
+
+
+////////////////////////////////////////
+
+
+template <typename T>
+Arena<T>::Arena( void )
+		: myCount( 0 )
+{
+	for ( size_t b = 0; b < MAX_BLOCKS; ++b )
+		myBlocks[b] = 0;
+}
+
+
+////////////////////////////////////////
+
+
+template <typename T>
+Arena<T>::~Arena( void )
+{
+	size_t i, N = myCount;
+	
+	for ( i = 0; i < N; ++i )
+		(*this)[Index( i )].~T();
+	
+	for ( i = 0; i < MAX_BLOCKS && myBlocks[i]; ++i )
+		::operator delete( myBlocks[i] );
+}
+
+
+////////////////////////////////////////
+
+
+template <typename T>
+template <typename... Args>
+typename Arena<T>::Index
+Arena<T>::create( Args&&... args )
+{
+	size_t i = myCount++;
+	
+	if ( i >= size_t( NONE ) )
+		throw std::length_error( "Arena is full" );
+	
+	T *block = getBlock( i >> BLOCK_BITS );
+	new ( block + ( i & BLOCK_MASK ) ) T( std::forward<Args>( args )... );
+	
+	return Index( i );
+}
+
+
+////////////////////////////////////////
+
+
+/// Returns block b, allocating it if this is the first object in it.
+/// Whichever thread loses the race to install the block frees its copy.
+template <typename T>
+T *
+Arena<T>::getBlock( size_t b )
+{
+	T *block = __atomic_load_n( &myBlocks[b], __ATOMIC_ACQUIRE );
+	
+	if ( ! block )
+	{
+		T *fresh = static_cast<T *>( ::operator new( sizeof(T) * BLOCK_SIZE ) );
+		
+		if ( __atomic_compare_exchange_n( &myBlocks[b], &block, fresh, false,
+										  __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ) )
+			block = fresh;
+		else
+			::operator delete( fresh );
+	}
+	
+	return block;
+}
+
+
+////////////////////////////////////////
+
+
+template <typename T>
+T &
+Arena<T>::operator[]( Index i )
+{
+	return myBlocks[i >> BLOCK_BITS][i & BLOCK_MASK];
+}
+
+
+////////////////////////////////////////
+
+
+template <typename T>
+const T &
+Arena<T>::operator[]( Index i ) const
+{
+	return myBlocks[i >> BLOCK_BITS][i & BLOCK_MASK];
+}
+
+
+////////////////////////////////////////
+
+
+template <typename T>
+size_t
+Arena<T>::size( void ) const
+{
+	return myCount;
+}
+
+#endif /* _Arena_h_ */
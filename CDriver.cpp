@@ -23,11 +23,11 @@
 // 
 //
 
-#include <fstream>
 #include "CDriver.h"
 #include "Version.h"
 #include "Symbol.h"
 #include "SymbolTable.h"
+#include "Util.h"
 
 
 ////////////////////////////////////////
@@ -57,7 +57,7 @@ CDriver::writeHeader( void )
 	const std::string &extraArg = getValue( "extra_argument" ).first;
 	const std::string &prefix = getValue( "token_prefix" ).first;
 	std::string fileName;
-	std::ofstream out;
+	Util::OutputFile out;
 	bool isOk = false;
 	
 	getFileName( fileName, ".h" );
@@ -71,12 +71,12 @@ CDriver::writeHeader( void )
 	
 		out << "/*\n * This file auto-generated from " << getParserName()
 			<< ".lem by " << VersionInfo::appName() << " version "
-			<< VersionInfo::appVersion() << std::endl;
+			<< VersionInfo::appVersion() << "\n";
 		out << " * Editing of this file strongly discouraged.\n */"
-			  << std::endl;
+			  << "\n";
 		
-		out << "\n#ifndef " << poundDef << std::endl;
-		out << "#define " << poundDef << std::endl;
+		out << "\n#ifndef " << poundDef << "\n";
+		out << "#define " << poundDef << "\n";
 	
 		out << "\n\nvoid " << getParserName()
 			  << "( void *parser, int tok, ";
@@ -109,17 +109,15 @@ CDriver::writeHeader( void )
 			if ( Symbol::TERMINAL == sp->getType() )
 			{
 				out << "#define " << prefix << sp->getName()
-					<< " " << idx << std::endl;
+					<< " " << idx << "\n";
 				++idx;
 			}
 		}
 		
-		out << "\n#endif" << std::endl;
-		isOk = true;
+		out << "\n#endif" << "\n";
+		isOk = out.close();
 	}
 	
-	out.close();
-	
 	return isOk;
 }
 
@@ -25,7 +25,6 @@
 
 #include <algorithm>
 #include <functional>
-#include <fstream>
 #include <sstream>
 #include <iostream>
 #include <ctype.h>
@@ -43,7 +42,7 @@ std::ostream &
 operator<<( std::ostream &os, CPPDriverOutHelp out )
 {
 	out.myOut->incOutLine();
-	return std::flush( os.put( os.widen( '\n' ) ) );
+	return os.put( os.widen( '\n' ) );
 }
 	
 	
@@ -108,7 +107,7 @@ CPPDriver::writeHeader( void )
 	const std::string &tokenType = getValue( "token_type" ).first;
 	const std::string &prefix = getValue( "token_prefix" ).first;
 	std::string fileName = getOutputDir();
-	std::ofstream out;
+	Util::OutputFile out;
 	bool isOk = false;
 	
 	getFileName( fileName, ".h" );
@@ -118,6 +117,7 @@ CPPDriver::writeHeader( void )
 	{
 		size_t i, nSym;
 		
+		myFileName = fileName;
 		myCurLineNum = 1;
 		myPimplName = "priv";
 		myPimplName.append( getParserName() );
@@ -173,8 +173,8 @@ CPPDriver::writeHeader( void )
 		out << "class " << getParserName() << endl() << "{" << endl()
 			<< "public:" << endl();
 		
-		// Generate the terminal tokens that the lexer will feed us
-		int idx = 1;
+		// Generate the terminal tokens that the lexer will feed us;
+		// their values are the action table columns directly.
 		
 		nSym = SymbolTable::get()->getNumSymbols();
 		out << endl() << "    enum Terminal" << endl() << "    {" << endl();
@@ -186,8 +186,8 @@ CPPDriver::writeHeader( void )
 			if ( Symbol::TERMINAL == sp->getType() )
 			{
 				out << "," << endl();
-				out << "        " << prefix << sp->getName() << " = " << idx;
-				++idx;
+				out << "        " << prefix << sp->getName() << " = "
+					<< sp->getIndex();
 			}
 		}
 		out << endl() << "    };";
@@ -219,8 +219,7 @@ CPPDriver::writeHeader( void )
 		myCurLineNum += std::count_if( nsEnd.begin(), nsEnd.end(),
 									   std::bind2nd( std::equal_to<char>(), '\n' ) );
 		out << "#endif /* " << poundDef << " */ " << endl();
-		out.close();
-		isOk = true;
+		isOk = out.close();
 	}
 	
 	return isOk;
@@ -233,44 +232,27 @@ CPPDriver::writeHeader( void )
 bool
 CPPDriver::writeSource( void )
 {
-	std::ofstream out;
+	Util::OutputFile out;
 	bool isOk = false;
 
+	myPimplName = "priv";
+	myPimplName.append( getParserName() );
+	myPimplName.append( "Impl" );
+	
+	if ( getNumShards() > 1 )
+		return writeShardedSource();
+	
+	myShardStart.clear();
+	myFileName.clear();
 	getFileName( myFileName, ".cpp" );
 	out.open( myFileName.c_str() );
 	
 	if ( out.is_open() )
 	{
 		myCurLineNum = 1;
-		myPimplName = "priv";
-		myPimplName.append( getParserName() );
-		myPimplName.append( "Impl" );
-		
-		out << "// This file auto-generated from " << getParserName()
-			<< ".lem by " << VersionInfo::appName() << " version "
-			<< VersionInfo::appVersion() << endl();
-		out << "// Editing of this file strongly discouraged." << endl();
-		
-		emitValue( getValue( "include" ), out );
-		
-		out << endl() << "#include <utility>" << endl();
-		out << "#include <stack>" << endl();
-		out << "#include <map>" << endl();
-		out << "#include <vector>" << endl();
-		out << "#include <iostream>" << endl();
-		
-		std::string incName;
-		Util::getFileName( incName, std::string(), getSourceFile(), ".h" );
-		out << endl() << endl() << "#include \"" << incName << "\"" << endl();
 		
-		if ( ! myNameSpace.empty() )
-		{
-			emitFuncBreak( out );
-			out << "using " << myNameSpace;
-			if ( *(myNameSpace.end()-1) != ':' )
-				out << "::";
-			out << getParserName() << ";" << endl();
-		}
+		writeFileComment( out );
+		writeSourcePreamble( out );
 		writeImplClassDecl( out );
 		writeParserCtorDtor( out );
 		writeMainParserFunc( out );
@@ -280,10 +262,11 @@ CPPDriver::writeSource( void )
 		writeAcceptFunc( out );
 		writeDestructorHandler( out );
 		writeParserUtil( out );
+		writeTables( out );
 		writeErrorRoutines( out );
 		emitValue( getValue( "code" ), out );
 
-		isOk = true;
+		isOk = out.close();
 	}
 	
 	return isOk;
@@ -293,6 +276,145 @@ CPPDriver::writeSource( void )
 ////////////////////////////////////////
 
 
+/// Writes the parser as several translation units that can be compiled
+/// in parallel: file_impl.h declares the implementation class,
+/// file_rules<n>.cpp hold the rule actions, file_tables.cpp the parse
+/// tables and file.cpp everything else.
+bool
+CPPDriver::writeShardedSource( void )
+{
+	size_t i, nShard = getNumShards();
+	bool isOk = true;
+	
+	assignRuleShards();
+	
+	// The other files include the header by its base name only
+	myImplHeader.clear();
+	Util::getFileName( myImplHeader, std::string(), getSourceFile(), "_impl.h" );
+	std::string poundDef = "_";
+	poundDef.append( getParserName() );
+	poundDef.append( "_impl_h_" );
+	
+	Util::OutputFile hdr;
+	myFileName.clear();
+	getFileName( myFileName, "_impl.h" );
+	hdr.open( myFileName.c_str() );
+	if ( ! hdr.is_open() )
+		return false;
+	
+	myCurLineNum = 1;
+	writeFileComment( hdr );
+	hdr << endl() << "#ifndef " << poundDef << endl();
+	hdr << "#define " << poundDef << endl();
+	writeSourcePreamble( hdr );
+	writeImplClassDecl( hdr );
+	hdr << endl() << "#endif /* " << poundDef << " */" << endl();
+	isOk = hdr.close() && isOk;
+	
+	Util::OutputFile out;
+	myFileName.clear();
+	getFileName( myFileName, ".cpp" );
+	out.open( myFileName.c_str() );
+	if ( ! out.is_open() )
+		return false;
+	
+	myCurLineNum = 1;
+	writeFileComment( out );
+	out << endl() << "#include \"" << myImplHeader << "\"" << endl();
+	writeParserCtorDtor( out );
+	writeMainParserFunc( out );
+	writeImplClassCtorDtor( out );
+	writeShiftFunc( out );
+	writeReduceFunc( out );
+	writeAcceptFunc( out );
+	writeDestructorHandler( out );
+	writeParserUtil( out );
+	writeErrorRoutines( out );
+	emitValue( getValue( "code" ), out );
+	isOk = out.close() && isOk;
+	
+	Util::OutputFile tables;
+	myFileName.clear();
+	getFileName( myFileName, "_tables.cpp" );
+	tables.open( myFileName.c_str() );
+	if ( ! tables.is_open() )
+		return false;
+	
+	myCurLineNum = 1;
+	writeFileComment( tables );
+	tables << endl() << "#include \"" << myImplHeader << "\"" << endl();
+	writeTables( tables );
+	isOk = tables.close() && isOk;
+	
+	for ( i = 0; i < nShard; ++i )
+	{
+		std::ostringstream ext;
+		ext << "_rules" << i << ".cpp";
+		
+		Util::OutputFile rules;
+		myFileName.clear();
+		getFileName( myFileName, ext.str().c_str() );
+		rules.open( myFileName.c_str() );
+		if ( ! rules.is_open() )
+			return false;
+		
+		myCurLineNum = 1;
+		writeFileComment( rules );
+		rules << endl() << "#include \"" << myImplHeader << "\"" << endl();
+		writeReduceShard( rules, i );
+		isOk = rules.close() && isOk;
+	}
+	
+	return isOk;
+}
+
+
+////////////////////////////////////////
+
+
+void
+CPPDriver::writeFileComment( std::ostream &out )
+{
+	out << "// This file auto-generated from " << getParserName()
+		<< ".lem by " << VersionInfo::appName() << " version "
+		<< VersionInfo::appVersion() << endl();
+	out << "// Editing of this file strongly discouraged." << endl();
+}
+
+
+////////////////////////////////////////
+
+
+void
+CPPDriver::writeSourcePreamble( std::ostream &out )
+{
+	emitValue( getValue( "include" ), out );
+	
+	out << endl() << "#include <algorithm>" << endl();
+	out << "#include <utility>" << endl();
+	out << "#include <stack>" << endl();
+	out << "#include <map>" << endl();
+	out << "#include <vector>" << endl();
+	out << "#include <iostream>" << endl();
+	
+	std::string incName;
+	Util::getFileName( incName, std::string(), getSourceFile(), ".h" );
+	out << endl() << endl() << "#include \"" << incName << "\"" << endl();
+	
+	if ( ! myNameSpace.empty() )
+	{
+		emitFuncBreak( out );
+		out << "using " << myNameSpace;
+		if ( *(myNameSpace.end()-1) != ':' )
+			out << "::";
+		out << getParserName() << ";" << endl();
+	}
+}
+
+
+////////////////////////////////////////
+
+
 void
 CPPDriver::writeParserCtorDtor( std::ostream &out )
 {
@@ -460,12 +582,13 @@ CPPDriver::writeStateTableDecl( std::ostream &out )
 {
 	out << endl() << endl();
 	out << "    typedef std::pair<ParserAct,int> ActionEntry;" << endl();
-	out << "    typedef std::map<int,ActionEntry> ActionMap;" << endl();
-	out << "    typedef std::vector<ActionMap> StateList;" << endl();
-	out << "    typedef std::vector<ActionEntry> StateDefaultList;" << endl();
+	out << "    typedef std::vector<ActionEntry> ActionTable;" << endl();
 	out << endl();
-	out << "    StateList myStates;" << endl();
-	out << "    StateDefaultList myStateDefaultActions;" << endl();
+	out << "    // One dense row of "
+		<< SymbolTable::get()->getNumTerminals()
+		<< " terminal actions per state; the gotos live in their own table"
+		<< endl();
+	out << "    ActionTable myActions;" << endl();
 }
 
 
@@ -476,38 +599,48 @@ void
 CPPDriver::buildStateTable( std::ostream &out )
 {
 	size_t i, j, nState, nAct, nTotal;
+	size_t defIdx = SymbolTable::get()->getDefault()->getIndex();
+	size_t nTerm = SymbolTable::get()->getNumTerminals();
 	
-	nState = StateTable::get()->getNumStates();
+	nState = StateTable::get()->getNumTableStates();
 
 	// Count all actions
 	nTotal = 0;
 	for ( i = 0; i < nState; ++i )
 	{
-		State		*stp = StateTable::get()->getNthState(i);
+		State		*stp = StateTable::get()->getNthTableState(i);
 		ActionList	&ap = stp->getActions();
 
 		nAct = ap.getNumActions();
 		for ( j = 0; j < nAct; ++j )
 		{
 			Action &act = ap.getNthAction( j );
-			if ( ! act.isIgnoreType() )
-				nTotal++;
-			if ( act.getLookAhead() == SymbolTable::get()->getDefaultName() )
+			if ( ( ! act.isIgnoreType() && act.getLookAhead() < nTerm ) ||
+				 act.getLookAhead() == defIdx )
 				nTotal++;
 		}
 	}
 
 	
-	out << "    myStates.assign( " << nState << ", ActionMap() );" << endl();
-	out << "    myStateDefaultActions.assign( " << nState
+	out << "    myActions.assign( " << nState * nTerm
 		<< ", ActionEntry(PA_ERROR,-2) );" << endl();
-	
+	out << endl();
+	out << "    // Spread the default actions over their rows first, then"
+		<< endl();
+	out << "    // overwrite the explicit entries" << endl();
 	out << "    for ( int i = 0; i < " << nTotal << "; ++i )" << endl();
 	out << "    {" << endl();
 	out << "        if ( theStateTable[i][1] == -1 )" << endl();
-	out << "            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);" << endl();
-	out << "        else" << endl();
-	out << "            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);" << endl();
+	out << "            std::fill_n( myActions.begin() + theStateTable[i][0] * "
+		<< nTerm << ", " << nTerm << "," << endl();
+	out << "                         ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]) );" << endl();
+	out << "    }" << endl();
+	out << "    for ( int i = 0; i < " << nTotal << "; ++i )" << endl();
+	out << "    {" << endl();
+	out << "        if ( theStateTable[i][1] != -1 )" << endl();
+	out << "            myActions[theStateTable[i][0] * " << nTerm
+		<< " + theStateTable[i][1]] =" << endl();
+	out << "                ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);" << endl();
 	out << "    }" << endl();
 }
 
@@ -519,23 +652,24 @@ void
 CPPDriver::writeStateTable( std::ostream &out )
 {
 	size_t i, j, nState, nAct, nTotal;
+	size_t defIdx = SymbolTable::get()->getDefault()->getIndex();
+	size_t nTerm = SymbolTable::get()->getNumTerminals();
 	
-	nState = StateTable::get()->getNumStates();
+	nState = StateTable::get()->getNumTableStates();
 	
 	// Count all actions
 	nTotal = 0;
 	for ( i = 0; i < nState; ++i )
 	{
-		State		*stp = StateTable::get()->getNthState(i);
+		State		*stp = StateTable::get()->getNthTableState(i);
 		ActionList	&ap = stp->getActions();
 
 		nAct = ap.getNumActions();
 		for ( j = 0; j < nAct; ++j )
 		{
 			Action &act = ap.getNthAction( j );
-			if ( ! act.isIgnoreType() )
-				nTotal++;
-			if ( act.getLookAhead() == SymbolTable::get()->getDefaultName() )
+			if ( ( ! act.isIgnoreType() && act.getLookAhead() < nTerm ) ||
+				 act.getLookAhead() == defIdx )
 				nTotal++;
 		}
 	}
@@ -545,7 +679,7 @@ CPPDriver::writeStateTable( std::ostream &out )
 
 	for ( i = 0; i < nState; ++i )
 	{
-		State		*stp = StateTable::get()->getNthState(i);
+		State		*stp = StateTable::get()->getNthTableState(i);
 		ActionList	&ap = stp->getActions();
 
 		nAct = ap.getNumActions();
@@ -553,15 +687,15 @@ CPPDriver::writeStateTable( std::ostream &out )
 		{
 			Action &act = ap.getNthAction( j );
 			
-			if ( ! act.isIgnoreType() )
+			if ( ! act.isIgnoreType() && act.getLookAhead() < nTerm )
 			{
 				out << "    // State " << i << endl();
-				out << "    { " << i << ", " << act.getLookAheadSymbol()->getIndex() << ", ";
+				out << "    { " << i << ", " << act.getLookAhead() << ", ";
 				emitAction( act, out );
 				out << " }," << endl();
 			}
 
-			if ( act.getLookAhead() == SymbolTable::get()->getDefaultName() )
+			if ( act.getLookAhead() == defIdx )
 			{
 				out << "    // State " << i << " default action" << endl();
 				out << "    { " << i << ", " << -1 << ", ";
@@ -609,8 +743,8 @@ CPPDriver::writeRuleTable( std::ostream &out )
 		out << "    // ";
 		rp->print( out );
 		out << endl();
-		out << "    { " << rp->getLHSSymbol()->getIndex()
-			<< ", " << rp->getRHS().size() << " }, " << endl();
+		out << "    { " << rp->getLHSIndex()
+			<< ", " << rp->getRHSSize() << " }, " << endl();
 	}
 
 	out << "};" << endl();
@@ -639,6 +773,79 @@ CPPDriver::buildRuleTable( std::ostream &out )
 ////////////////////////////////////////
 
 
+void
+CPPDriver::writeGotoTable( std::ostream &out )
+{
+	std::vector< int > defaults;
+	std::vector< GotoList > exceptions;
+	size_t i, j, nCol, nExc;
+	size_t nTerm = SymbolTable::get()->getNumTerminals();
+	
+	getGotoTable( defaults, exceptions );
+	nCol = defaults.size();
+	
+	out << endl() << endl();
+	out << "// Goto table, one row per nonterminal: the state most predecessors"
+		<< endl();
+	out << "// go to (-1 for none) and the range of theGotoExceptions that"
+		<< endl();
+	out << "// overrides it, sorted by state" << endl();
+	out << "static const int theGotoColumns[" << nCol << "][3] =" << endl();
+	out << "{" << endl();
+	for ( i = 0, nExc = 0; i < nCol; ++i )
+	{
+		Symbol *sp = SymbolTable::get()->getNthSymbol( i + nTerm );
+		
+		out << "    // " << sp->getName() << endl();
+		out << "    { " << defaults[i] << ", " << nExc << ", "
+			<< nExc + exceptions[i].size() << " }," << endl();
+		nExc += exceptions[i].size();
+	}
+	out << "};" << endl();
+	
+	out << endl();
+	out << "static const int theGotoExceptions[" << ( nExc ? nExc : 1 )
+		<< "][2] =" << endl();
+	out << "{" << endl();
+	if ( nExc == 0 )
+		out << "    { -1, -1 }," << endl();
+	for ( i = 0; i < nCol; ++i )
+	{
+		for ( j = 0; j < exceptions[i].size(); ++j )
+		{
+			out << "    { " << exceptions[i][j].first << ", "
+				<< exceptions[i][j].second << " }," << endl();
+		}
+	}
+	out << "};" << endl();
+	
+	emitFuncBreak( out );
+	out << "int " << myPimplName << "::findGoto( int sym, int stateNum )"
+		<< endl();
+	out << "{" << endl();
+	out << "    const int *col = theGotoColumns[sym - " << nTerm << "];" << endl();
+	out << "    int lo = col[1], hi = col[2];" << endl();
+	out << endl();
+	out << "    while ( lo < hi )" << endl();
+	out << "    {" << endl();
+	out << "        int mid = ( lo + hi ) / 2;" << endl();
+	out << "        if ( theGotoExceptions[mid][0] < stateNum )" << endl();
+	out << "            lo = mid + 1;" << endl();
+	out << "        else" << endl();
+	out << "            hi = mid;" << endl();
+	out << "    }" << endl();
+	out << endl();
+	out << "    if ( lo < col[2] && theGotoExceptions[lo][0] == stateNum )"
+		<< endl();
+	out << "        return theGotoExceptions[lo][1];" << endl();
+	out << "    return col[0];" << endl();
+	out << "}" << endl();
+}
+
+
+////////////////////////////////////////
+
+
 void
 CPPDriver::writeMainParserFunc( std::ostream &out )
 {
@@ -756,6 +963,12 @@ void
 CPPDriver::writeReduceFuncDecl( std::ostream &out )
 {
 	out << "    void reduce( int ruleNum" << myExtraArg << " );" << endl();
+	
+	for ( size_t i = 0; i + 1 < myShardStart.size(); ++i )
+	{
+		out << "    void reduceRules" << i << "( int ruleNum, Value &data, "
+			<< "std::vector<Value> &rhsData" << myExtraArg << " );" << endl();
+	}
 }
 
 
@@ -777,7 +990,6 @@ CPPDriver::writeReduceFunc( std::ostream &out )
 		out << "    std::cout << \"REDUCE rule \" << ruleNum << std::endl;"
 			<< endl();
 	out << "    int newVal;" << endl();
-	out << "    ParserAct next;" << endl();
 	out << "    " << myPimplName << "::Value data = { 0 };" << endl();
 	out << "    std::vector<" << myPimplName << "::Value> rhsData;"
 		<< endl();
@@ -795,13 +1007,73 @@ CPPDriver::writeReduceFunc( std::ostream &out )
 	out << "    }" << endl();
 	
 	out << endl();
-    out << "    next = findParserAction( newVal, myRules[ruleNum].first );"
+	out << "    newVal = findGoto( myRules[ruleNum].first," << endl();
+	out << "                       myStack.empty() ? 0 : myStack.top().first.first );"
 		<< endl();
 	
 	out << endl();
-	out << "    switch ( ruleNum )" << endl();
-	out << "    {" << endl();
-	for ( i = 0; i < nRule; ++i )
+	if ( myShardStart.empty() )
+	{
+		out << "    switch ( ruleNum )" << endl();
+		out << "    {" << endl();
+		writeReduceCases( out, 0, nRule );
+		out << "        default:" << endl();
+		out << "            throw \"Unknown Rule Number\";" << endl();
+		out << "            break;" << endl();
+		out << "    }" << endl();
+	}
+	else
+	{
+		// The rule actions live in the file_rules<n>.cpp files
+		out << "    typedef void (" << myPimplName << "::*ReduceFunc)( "
+			<< "int ruleNum, Value &data, std::vector<Value> &rhsData"
+			<< myExtraArg << " );" << endl();
+		out << "    static const ReduceFunc theReduceFuncs[" << nRule
+			<< "] =" << endl();
+		out << "    {" << endl();
+		for ( i = 0; i + 1 < myShardStart.size(); ++i )
+		{
+			for ( size_t r = myShardStart[i]; r < myShardStart[i + 1]; ++r )
+			{
+				out << "        &" << myPimplName << "::reduceRules" << i
+					<< "," << endl();
+			}
+		}
+		out << "    };" << endl();
+		out << endl();
+		out << "    if ( ruleNum < 0 || ruleNum >= " << nRule << " )" << endl();
+		out << "        throw \"Unknown Rule Number\";" << endl();
+		out << "    (this->*theReduceFuncs[ruleNum])( ruleNum, data, rhsData";
+		if ( ! myExtraArgCall.empty() )
+			out << ", " << myExtraArgCall;
+		out << " );" << endl();
+	}
+	
+	out << endl();
+	out << "    if ( newVal >= 0 )" << endl();
+	out << "        shift( newVal, myRules[ruleNum].first, data );" << endl();
+	if ( isValueSet( "parse_accept" ) )
+	{
+		out << "    else" << endl();
+		if ( !myExtraArgCall.empty() )
+			out << "        accept( " << myExtraArgCall << " );" << endl();
+		else
+			out << "        accept();" << endl();
+	}
+	
+	out << "}" << endl();
+}
+
+
+////////////////////////////////////////
+
+
+void
+CPPDriver::writeReduceCases( std::ostream &out, size_t first, size_t last )
+{
+	size_t i;
+	
+	for ( i = first; i < last; ++i )
 	{
 		Rule *rp = RuleTable::get()->getNthRule( i );
 		
@@ -816,25 +1088,66 @@ CPPDriver::writeReduceFunc( std::ostream &out )
 		out << "            break;" << endl();
 		out << "        }" << endl() << endl();
 	}
-	
+}
+
+
+////////////////////////////////////////
+
+
+void
+CPPDriver::writeReduceShard( std::ostream &out, size_t shard )
+{
+	emitFuncBreak( out );
+	out << "void " << myPimplName << "::reduceRules" << shard
+		<< "( int ruleNum, " << myPimplName << "::Value &data, "
+		<< "std::vector<" << myPimplName << "::Value> &rhsData"
+		<< myExtraArg << " )" << endl();
+	out << "{" << endl();
+	out << "    switch ( ruleNum )" << endl();
+	out << "    {" << endl();
+	writeReduceCases( out, myShardStart[shard], myShardStart[shard + 1] );
 	out << "        default:" << endl();
 	out << "            throw \"Unknown Rule Number\";" << endl();
 	out << "            break;" << endl();
 	out << "    }" << endl();
+	out << "}" << endl();
+}
+
+
+////////////////////////////////////////
+
+
+/// Splits the rules into contiguous runs with about the same amount of
+/// action code each, so the shards take about as long to compile.
+void
+CPPDriver::assignRuleShards( void )
+{
+	size_t i, nRule, nShard, total, sum;
+	std::vector< size_t > weights;
 	
-	out << endl();
-	out << "    if ( PA_SHIFT == next )" << endl();
-	out << "        shift( newVal, myRules[ruleNum].first, data );" << endl();
-	if ( isValueSet( "parse_accept" ) )
+	nRule = RuleTable::get()->getNumRules();
+	nShard = getNumShards();
+	
+	// Every case costs something to compile even without any code
+	total = 0;
+	weights.reserve( nRule );
+	for ( i = 0; i < nRule; ++i )
 	{
-		out << "    else" << endl();
-		if ( !myExtraArgCall.empty() )
-			out << "        accept( " << myExtraArgCall << " );" << endl();
-		else
-			out << "        accept();" << endl();
+		Rule *rp = RuleTable::get()->getNthRule( i );
+		weights.push_back( rp->getCode().size() + 64 );
+		total += weights.back();
 	}
 	
-	out << "}" << endl();
+	myShardStart.assign( 1, 0 );
+	sum = 0;
+	for ( i = 0; i < nRule && myShardStart.size() < nShard; ++i )
+	{
+		sum += weights[i];
+		if ( sum * nShard >= total * myShardStart.size() )
+			myShardStart.push_back( i + 1 );
+	}
+	while ( myShardStart.size() <= nShard )
+		myShardStart.push_back( nRule );
 }
 
 
@@ -964,6 +1277,7 @@ CPPDriver::writeParserUtilDecl( std::ostream &out )
 	out << "    void popStack( void );" << endl();
 	out << "    ParserAct findParserAction( int &newVal, int tok );"
 		<< endl();
+	out << "    int findGoto( int sym, int stateNum );" << endl();
 	out << "    void initTables( void );" << endl();
 }
 
@@ -974,6 +1288,9 @@ CPPDriver::writeParserUtilDecl( std::ostream &out )
 void
 CPPDriver::writeParserUtil( std::ostream &out )
 {
+	size_t nTerm = SymbolTable::get()->getNumTerminals();
+	size_t nNonTerm = SymbolTable::get()->getNumNonTerminals();
+
 	emitFuncBreak( out );
 	out << "void " << myPimplName << "::popStack( void )" << endl();
 	out << "{" << endl();
@@ -986,44 +1303,43 @@ CPPDriver::writeParserUtil( std::ostream &out )
 	out << "ParserAct " << myPimplName
 		<< "::findParserAction( int &newVal, int tok )" << endl();
 	out << "{" << endl();
+	out << "    const ActionEntry *entry;" << endl();
 	out << "    int stateNum;" << endl();
-	out << "    ParserAct retval = PA_NOP;" << endl();
-	out << "    bool found = false;" << endl();
 	out << endl();
 	out << "    stateNum = myStack.empty() ? 0 : myStack.top().first.first;"
 		<< endl();
-	out << "    ActionMap::iterator i = myStates[stateNum].find( tok );"
+	out << "    if ( tok >= 0 && tok < " << nTerm << " )" << endl();
+	out << "        entry = &myActions[stateNum * " << nTerm << " + tok];"
 		<< endl();
-	out << "    if ( tok >= 0 && tok <= "
-		<< SymbolTable::get()->getNumSymbols() << " )" << endl();
+	out << "    else if ( tok >= " << nTerm << " && tok < "
+		<< nTerm + nNonTerm << " )" << endl();
 	out << "    {" << endl();
-	out << "        if ( i != myStates[stateNum].end() )" << endl();
-	out << "        {" << endl();
-	out << "            retval = (*i).second.first;" << endl();
-	out << "            newVal = (*i).second.second;" << endl();
-	out << "            found = true;" << endl();
-	out << "        }" << endl();
+	out << "        newVal = findGoto( tok, stateNum );" << endl();
+	out << "        return newVal >= 0 ? PA_SHIFT : PA_ERROR;" << endl();
 	out << "    }" << endl();
-	out << "    else if ( ! myStates[stateNum].empty() )" << endl();
+	out << "    else" << endl();
 	out << "    {" << endl();
-	out << "        retval = PA_NOP;" << endl();
 	out << "        newVal = 0;" << endl();
-	out << "        found = true;" << endl();
+	out << "        return PA_NOP;" << endl();
 	out << "    }" << endl();
 	out << endl();
-	out << "    if ( ! found )" << endl();
-	out << "    {" << endl();
-	out << "        retval = myStateDefaultActions[stateNum].first;" << endl();
-	out << "        newVal = myStateDefaultActions[stateNum].second;" << endl();
-	out << "    }" << endl();
-	
-	out << "    return retval;" << endl();
+	out << "    newVal = entry->second;" << endl();
+	out << "    return entry->first;" << endl();
 	out << "}" << endl();
-	
+}
+
+
+////////////////////////////////////////
+
+
+void
+CPPDriver::writeTables( std::ostream &out )
+{
 	emitFuncBreak( out );
 
 	writeStateTable( out );
 	writeRuleTable( out );
+	writeGotoTable( out );
 
 	emitFuncBreak( out );
 
@@ -1146,7 +1462,7 @@ CPPDriver::emitErrorHandling( std::ostream &out )
 	out << indent << "}" << endl();
 	
 	Symbol *errsp = SymbolTable::get()->find( "error" );
-	out << indent << "if ( myStack.top().first.first == " << errsp->getIndex()
+	out << indent << "if ( myStack.top().first.second == " << errsp->getIndex()
 		<< " || errHit )" << endl();
 	out << indent << "{" << endl();
 	out << indent << "    callDtor( static_cast<int>(tok), data );" << endl();
@@ -1155,7 +1471,7 @@ CPPDriver::emitErrorHandling( std::ostream &out )
 	out << indent << "else" << endl();
 	out << indent << "{" << endl();
 	out << indent << "    while ( ! myStack.empty() &&" << endl();
-	out << indent << "            myStack.top().first.first != "
+	out << indent << "            myStack.top().first.second != "
 		<< errsp->getIndex() << " )" << endl();
 	out << indent << "    {" << endl();
 	out << indent << "        action = findParserAction( actVal, "
@@ -1175,7 +1491,7 @@ CPPDriver::emitErrorHandling( std::ostream &out )
 	out << ");" << endl();
 	out << indent << "        done = true;" << endl();
 	out << indent << "    }" << endl();
-	out << indent << "    else if ( myStack.top().first.first != "
+	out << indent << "    else if ( myStack.top().first.second != "
 		<< errsp->getIndex() << " )" << endl();
 	out << indent << "    {" << endl();
 	out << indent << "        data." << errsp->getName() << "Type = 0;"
@@ -1255,7 +1571,7 @@ CPPDriver::emitAction( const Action &act, std::ostream &out )
 	{
 		case Action::SHIFT:
 			out << "PA_SHIFT, "
-				<< act.getState()->getStateIndex();
+				<< StateTable::get()->getTableIndex( act.getState() );
 			break;
 						
 		case Action::REDUCE:
@@ -1284,41 +1600,20 @@ CPPDriver::emitAction( const Action &act, std::ostream &out )
 void
 CPPDriver::emitRule( const Rule *rp, std::ostream &out )
 {
-	std::string rpCode = rp->getCode();
-	std::string::size_type curPos;
+	std::string rpCode;
 	int codeLine = rp->getCodeLine();
+	size_t nLines = indentCode( rp->getCode(), codeLine, rpCode );
 
-	while ( rpCode[0] == ' ' || rpCode[0] == '\t' || rpCode[0] == '\n' )
-	{
-		if ( rpCode[0] == '\n' )
-			++codeLine;
-		rpCode.erase( rpCode.begin() );
-	}
-	
 	emitLineInfo( getSourceFile(), codeLine, out );
 	
 	const Rule::RHSList &rhs = rp->getRHS();
+	const Rule::SymbolList &rhsSyms = rp->getRHSSymbols();
 	Rule::RHSListConstIter ri, re;
 
 	if ( ! rpCode.empty() )
 	{
-		curPos = 0;
-		rpCode.insert( curPos, "            " );
-		while ( curPos != std::string::npos )
-		{
-			curPos = rpCode.find( '\n', curPos );
-			if ( curPos != std::string::npos )
-			{
-				incOutLine();
-				++curPos;
-				rpCode.insert( curPos, "        " );
-			}
-		}
-	
-		while ( rpCode[rpCode.size() - 1] == ' ' ||
-				rpCode[rpCode.size() - 1] == '\t' )
-			rpCode.erase( rpCode.end() - 1 );
-		
+		myCurLineNum += nLines;
+
 		std::string replStr = "data.";
 		replStr.append( rp->getLHS() );
 		replStr.append( "Type" );
@@ -1326,7 +1621,8 @@ CPPDriver::emitRule( const Rule *rp, std::ostream &out )
 		
 		for ( ri = rhs.begin(), re = rhs.end(); ri != re; ++ri )
 		{
-			Symbol *sp = SymbolTable::get()->find( (*ri).first );
+			Symbol *sp = SymbolTable::get()->getNthSymbol(
+				rhsSyms[ri - rhs.begin()] );
 			const std::string &dataType = sp->getDataType();
 			std::ostringstream tmpOut;
 			
@@ -1349,12 +1645,16 @@ CPPDriver::emitRule( const Rule *rp, std::ostream &out )
 	
 	emitLineInfo( myFileName, getOutLine(), out );
 
+	// A unit rule without code hands the value of its symbol on, the
+	// same as when its reduction is bypassed
+	if ( rp->isUnitCopy() && rpCode.empty() )
+		out << "            data = rhsData[0];" << endl();
+
 	for ( ri = rhs.begin(), re = rhs.end(); ri != re; ++ri )
 	{
-		Symbol *sp = SymbolTable::get()->find( (*ri).first );
 		if ( (*ri).second.empty() )
 		{
-			out << "            callDtor( " << sp->getIndex()
+			out << "            callDtor( " << rhsSyms[ri - rhs.begin()]
 				<< ", rhsData[" << ( ri - rhs.begin() )
 				<< "] );" << endl();
 		}
@@ -1373,6 +1673,10 @@ CPPDriver::substCode( std::string		&codeStr,
 	if ( var.empty() )
 		return;
 	
+	// Build the result in one pass rather than replacing in place,
+	// which shifts the rest of the code on every match
+	std::string result;
+	std::string::size_type prevPos = 0;
 	std::string::size_type curPos = codeStr.find( var );
 	while ( curPos != std::string::npos )
 	{
@@ -1384,13 +1688,23 @@ CPPDriver::substCode( std::string		&codeStr,
 			
 			ep = curPos + var.size();
 			if ( ! ( isalnum( codeStr[ep] ) || '_' == codeStr[ep] ) )
-				codeStr.replace( curPos, var.size(), replName );
+			{
+				result.append( codeStr, prevPos, curPos - prevPos );
+				result.append( replName );
+				prevPos = ep;
+			}
 
 			curPos = codeStr.find( var, ep );
 		}
 		else
 			curPos = codeStr.find( var, curPos + 1 );
 	}
+
+	if ( prevPos == 0 )
+		return;
+
+	result.append( codeStr, prevPos, std::string::npos );
+	codeStr.swap( result );
 }
 
 
@@ -27,6 +27,7 @@
 #define _CPPDriver_h_
 
 #include <iosfwd>
+#include <vector>
 #include "LanguageDriver.h"
 
 class Action;
@@ -52,6 +53,9 @@ public:
 	virtual bool writeSource( void );
 	
 private:
+	bool writeShardedSource( void );
+	void writeSourcePreamble( std::ostream &out );
+	void writeFileComment( std::ostream &out );
 	void writeParserCtorDtor( std::ostream &out );
 	void writeImplClassDecl( std::ostream &out );
 	void writeImplClassCtorDtor( std::ostream &out );
@@ -61,17 +65,22 @@ private:
 	void writeRuleTableDecl( std::ostream &out );
 	void writeRuleTable( std::ostream &out );
 	void buildRuleTable( std::ostream &out );
+	void writeGotoTable( std::ostream &out );
 	void writeMainParserFunc( std::ostream &out );
 	void writeShiftFuncDecl( std::ostream &out );
 	void writeShiftFunc( std::ostream &out );
 	void writeReduceFuncDecl( std::ostream &out );
 	void writeReduceFunc( std::ostream &out );
+	void writeReduceCases( std::ostream &out, size_t first, size_t last );
+	void writeReduceShard( std::ostream &out, size_t shard );
+	void assignRuleShards( void );
 	void writeAcceptFuncDecl( std::ostream &out );
 	void writeAcceptFunc( std::ostream &out );
 	void writeDestructorHandlerDecl( std::ostream &out );
 	void writeDestructorHandler( std::ostream &out );
 	void writeParserUtilDecl( std::ostream &out );
 	void writeParserUtil( std::ostream &out );
+	void writeTables( std::ostream &out );
 	void writeErrorRoutinesDecl( std::ostream &out );
 	void writeErrorRoutines( std::ostream &out );
 	
@@ -103,6 +112,11 @@ private:
 	std::string myExtraArgCall;
 	std::string myNameSpace;
 	std::string myPimplName;
+	std::string myImplHeader;
+	
+	/// First rule of each shard, with the number of rules at the end;
+	/// empty when the source is written as a single file
+	std::vector< size_t > myShardStart;
 	
 	size_t myCurLineNum = 0;
 };
@@ -33,9 +33,15 @@
 ////////////////////////////////////////
 
 
+Arena< Config > Config::theArena;
+
+
+////////////////////////////////////////
+
+
 Config::Config( Rule *rp, int dot )
-		: myRule( rp ), myDot( dot ), myNext( 0 ),
-		  myNextBasis( 0 ), myStatus( INCOMPLETE ), myState( 0 )
+		: myRule( rp ), myDot( dot ), myIndex( NONE ), myNext( NONE ),
+		  myNextBasis( NONE ), myStatus( INCOMPLETE ), myState( -1 )
 {
 }
 
@@ -45,8 +51,79 @@ Config::Config( Rule *rp, int dot )
 
 Config::~Config( void )
 {
-	delete myNext;
-	myNextBasis = 0;
+}
+
+
+////////////////////////////////////////
+
+
+Config *
+Config::create( Rule *rp, int dot )
+{
+	Index i = theArena.create( rp, dot );
+	Config *retval = &theArena[i];
+	
+	retval->myIndex = i;
+	
+	return retval;
+}
+
+
+////////////////////////////////////////
+
+
+Config *
+Config::get( Index i )
+{
+	return i == NONE ? 0 : &theArena[i];
+}
+
+
+////////////////////////////////////////
+
+
+Config *
+Config::getNext( void ) const
+{
+	return get( myNext );
+}
+
+
+////////////////////////////////////////
+
+
+Config *
+Config::getNextBasis( void ) const
+{
+	return get( myNextBasis );
+}
+
+
+////////////////////////////////////////
+
+
+void
+Config::reset( Rule *rp, int dot )
+{
+	myRule = rp;
+	myDot = dot;
+	myNext = NONE;
+	myNextBasis = NONE;
+	myFollowSet.clear();
+	myForwardProps.clear();
+	myBackwardProps.clear();
+	myStatus = INCOMPLETE;
+	myState = -1;
+}
+
+
+////////////////////////////////////////
+
+
+void
+Config::setState( State *st )
+{
+	myState = st ? st->getStateIndex() : -1;
 }
 
 
@@ -54,9 +131,9 @@ Config::~Config( void )
 
 
 bool
-Config::addFollowSet( const std::string &fsItem )
+Config::addFollowSet( size_t symIdx )
 {
-	return myFollowSet.add( fsItem );
+	return myFollowSet.add( symIdx );
 }
 
 
@@ -77,7 +154,7 @@ void
 Config::addForwardPropLink( Config *fpl )
 {
 //	myForwardProps.push_back( fpl );
-	myForwardProps.insert( myForwardProps.begin(), fpl );
+	myForwardProps.insert( myForwardProps.begin(), fpl->myIndex );
 }
 
 
@@ -88,7 +165,7 @@ void
 Config::addBackwardPropLink( Config *bpl )
 {
 //	myBackwardProps.push_back( bpl );
-	myBackwardProps.insert( myBackwardProps.begin(), bpl );
+	myBackwardProps.insert( myBackwardProps.begin(), bpl->myIndex );
 }
 
 
@@ -156,8 +233,8 @@ Config::print( std::ostream &out ) const
 			out << std::endl;
 		}
 		
-		out << "     To:   " << (*pi)->getRule()->getLHS() << " (" <<
-			(*pi)->myState->getStateIndex() << ")";
+		out << "     To:   " << get( *pi )->getRule()->getLHS() << " (" <<
+			get( *pi )->myState << ")";
 //			(*pi)->getDot() << ")";
 		
 		if ( (pi + 1) == pe )
@@ -175,8 +252,8 @@ Config::print( std::ostream &out ) const
 			out << std::endl;
 		}
 		
-		out << "     From: " << (*pi)->getRule()->getLHS() << " (" <<
-			(*pi)->myState->getStateIndex() << ")";
+		out << "     From: " << get( *pi )->getRule()->getLHS() << " (" <<
+			get( *pi )->myState << ")";
 //			(*pi)->getDot() << ")";
 		
 		if ( (pi + 1) == pe )
@@ -28,8 +28,10 @@
 
 #include <iosfwd>
 #include <vector>
+#include <stdint.h>
 
 #include "FollowSet.h"
+#include "Arena.h"
 
 class Rule;
 class State;
@@ -43,13 +45,18 @@ class State;
 /// Configurations also contain a follow-set which is a list of terminal
 /// symbols which are allowed to immediately follow the end of the rule.
 /// Every configuration is recorded as an instance of the following.
+/// Configurations live in a single arena and refer to each other by
+/// index, they are never deleted one by one.
 class Config
 {
 public:
-	typedef std::vector< Config * > PropList;
+	typedef Arena< Config >::Index	Index;
+	typedef std::vector< Index >	PropList;
 	typedef PropList::iterator		PropListIter;
 	typedef PropList::const_iterator PropListConstIter;
 	
+	static const Index NONE = Arena< Config >::NONE;
+	
 	enum Status
 	{
 		COMPLETE,
@@ -59,6 +66,14 @@ public:
 	Config( Rule *rp, int pp );
 	~Config( void );
 	
+	/// Allocates a new config from the arena
+	static Config *create( Rule *rp, int dot );
+	static Config *get( Index i );
+	inline Index getIndex( void ) const;
+	
+	/// Turns a discarded config into a fresh one for a different item
+	void reset( Rule *rp, int dot );
+	
 	inline void setStatus( Status st );
 	inline Status getStatus( void ) const;
 		
@@ -67,16 +82,16 @@ public:
 	
 	// For chaining configs together.
 	inline void setNext( Config *next );
-	inline Config *getNext( void ) const;
+	Config *getNext( void ) const;
 	
 	inline void setNextBasis( Config *next );
-	inline Config *getNextBasis( void ) const;
+	Config *getNextBasis( void ) const;
 	
 	// for debugging mostly
-	inline void setState( State *st );
+	void setState( State *st );
 	
 	// returns true if anythings changes
-	bool addFollowSet( const std::string &fsItem );
+	bool addFollowSet( size_t symIdx );
 	// returns true if anythings changes
 	bool combineFollowSet( const FollowSet &other );
 	inline const FollowSet &getFollowSet( void ) const;
@@ -96,8 +111,9 @@ private:
 	Rule	*myRule; // Rule which this config is based on
 	int		 myDot; // parse point in rule
 	
-	Config	*myNext;
-	Config	*myNextBasis;
+	Index	 myIndex;
+	Index	 myNext;
+	Index	 myNextBasis;
 	
 	FollowSet myFollowSet; // follow set for this config only
 	
@@ -106,18 +122,18 @@ private:
 	
 	Status	 myStatus; // status used during followset and shift computations
 	
-	State *myState;
+	int		 myState; // index of the owning state
+	
+	static Arena< Config > theArena;
 };
 
 inline void Config::setStatus( Config::Status st ) { myStatus = st; }
 inline Config::Status Config::getStatus( void ) const { return myStatus; }
 inline Rule *Config::getRule( void ) const { return myRule; }
 inline int Config::getDot( void ) const { return myDot; }
-inline void Config::setNext( Config *next ) { myNext = next; }
-inline Config *Config::getNext( void ) const { return myNext; }
-inline void Config::setNextBasis( Config *next ) { myNextBasis = next; }
-inline Config *Config::getNextBasis( void ) const { return myNextBasis; }
-inline void Config::setState( State *st ) { myState = st; }
+inline Config::Index Config::getIndex( void ) const { return myIndex; }
+inline void Config::setNext( Config *next ) { myNext = next ? next->myIndex : NONE; }
+inline void Config::setNextBasis( Config *next ) { myNextBasis = next ? next->myIndex : NONE; }
 
 inline const FollowSet &Config::getFollowSet( void ) const
 {
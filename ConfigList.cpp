@@ -43,7 +43,8 @@
 
 
 ConfigList::ConfigList( void )
-		: myFront( 0 ), myLast( 0 ), myFrontBasis( 0 ), myLastBasis( 0 )
+		: myFront( 0 ), myLast( 0 ), myFrontBasis( 0 ), myLastBasis( 0 ),
+		  myPropagate( true ), myDeferErrors( false )
 {
 }
 
@@ -69,7 +70,7 @@ ConfigList::add( Rule *rp, int dot )
 	
 	if ( ! retval )
 	{
-		retval = new Config( rp, dot );
+		retval = newConfig( rp, dot );
 		
 		if ( ! myFront )
 		{
@@ -82,7 +83,7 @@ ConfigList::add( Rule *rp, int dot )
 			myLast = retval;
 		}
 		
-		myConfigs.push_back( retval );
+		remember( retval );
 	}
 	
 	return retval;
@@ -99,7 +100,7 @@ ConfigList::addWithBasis( Rule *rp, int dot )
 	
 	if ( ! retval )
 	{
-		retval = new Config( rp, dot );
+		retval = newConfig( rp, dot );
 		
 		if ( ! myFront )
 		{
@@ -123,7 +124,7 @@ ConfigList::addWithBasis( Rule *rp, int dot )
 			myLastBasis = retval;
 		}
 		
-		myConfigs.push_back( retval );
+		remember( retval );
 	}
 	
 	return retval;
@@ -133,6 +134,43 @@ ConfigList::addWithBasis( Rule *rp, int dot )
 ////////////////////////////////////////
 
 
+Config *
+ConfigList::addBasis( Config *cfp )
+{
+	cfp->setNext( 0 );
+	cfp->setNextBasis( 0 );
+	
+	if ( ! myFront )
+	{
+		myFront = cfp;
+		myLast = cfp;
+	}
+	else
+	{
+		myLast->setNext( cfp );
+		myLast = cfp;
+	}
+	
+	if ( ! myFrontBasis )
+	{
+		myFrontBasis = cfp;
+		myLastBasis = cfp;
+	}
+	else
+	{
+		myLastBasis->setNextBasis( cfp );
+		myLastBasis = cfp;
+	}
+	
+	remember( cfp );
+	
+	return cfp;
+}
+
+
+////////////////////////////////////////
+
+
 Config *
 ConfigList::getConfig( void )
 {
@@ -244,74 +282,107 @@ ConfigList::sortBasis( void )
 void
 ConfigList::computeClosure( void )
 {
-	for ( Config *cfp = myFront; cfp; cfp = cfp->getNext() )
+	SymbolTable *symTable = SymbolTable::get();
+	RuleTable *ruleTable = RuleTable::get();
+	Config *cfp;
+	
+	// Every nonterminal reachable as a left corner from the basis gets
+	// all of its rules added with the dot at the start
+	myClosure.clear();
+	for ( cfp = myFront; cfp; cfp = cfp->getNext() )
+	{
+		const Rule::SymbolList &rhs = cfp->getRule()->getRHSSymbols();
+		size_t dot = size_t( cfp->getDot() );
+		
+		if ( dot < rhs.size() &&
+			 symTable->getNthSymbol( rhs[dot] )->getType() == Symbol::NONTERMINAL )
+			myClosure.combine( ruleTable->getLeftCorners( rhs[dot] ) );
+	}
+	
+	for ( size_t s = myClosure.first(); s != FollowSet::END; s = myClosure.next( s ) )
+	{
+		RuleTable::RuleSpanIter ri, re;
+		for ( ruleTable->getRules( s, ri, re ); ri != re; ++ri )
+			add( *ri, 0 );
+	}
+	
+	// Then each item seeds the follow sets of the items it pulled in,
+	// and links to them if the rest of its RHS can vanish
+	for ( cfp = myFront; cfp; cfp = cfp->getNext() )
 	{
 		Rule *rp = cfp->getRule();
-		int dot = cfp->getDot();
+		size_t dot = size_t( cfp->getDot() );
 		
-		const Rule::RHSList &rhs = rp->getRHS();
+		const Rule::SymbolList &rhs = rp->getRHSSymbols();
 		
-		if ( dot >= int( rhs.size() ) )
+		if ( dot >= rhs.size() )
 			continue;
 		
-		Symbol *sp = SymbolTable::get()->find( rhs[dot].first );
+		Symbol *sp = symTable->getNthSymbol( rhs[dot] );
 		
-		if ( Symbol::NONTERMINAL == sp->getType() )
+		if ( Symbol::NONTERMINAL != sp->getType() )
+			continue;
+		
+		RuleTable::RuleSpanIter ri, re;
+		ruleTable->getRules( rhs[dot], ri, re );
+		
+		if ( ri == re && sp->getName() != "error" )
 		{
-			Rule *tmpRp = RuleTable::get()->findFirstRule( rhs[dot].first );
-			
-			if ( ! tmpRp && rhs[dot].first != "error" )
+			if ( myDeferErrors )
+			{
+				myErrors.push_back( std::make_pair( rp->getRuleLine(),
+													sp->getName() ) );
+			}
+			else
 			{
 				Error::get()->add( rp->getRuleLine(),
 								   "Nonterminal \"%s\" has no rules.",
-								   rhs[dot].first.c_str() );
+								   sp->getName().c_str() );
 			}
+		}
+		
+		if ( ! myPropagate )
+			continue;
+		
+		const FollowSet &first = rp->getFirstFrom( dot + 1 );
+		bool vanishes = rp->isLambdaFrom( dot + 1 );
+		
+		for ( ; ri != re; ++ri )
+		{
+			Config *newcfp = find( (*ri)->getRuleIndex(), 0 );
 			
-			for ( ; tmpRp; tmpRp = RuleTable::get()->getNextRule( tmpRp ) )
-			{
-				Config *newcfp = add( tmpRp, 0 );
-				
-//				std::ostringstream out1;
-//				newcfp->getFollowSet().print( out1 );
-//				std::cout << tmpRp->getLHS() << " initial( " << out1.str() << " )\n";
-				
-				int i;
-				int N = int( rhs.size() );
-				for ( i = dot + 1; i < N; ++i )
-				{
-					Symbol *xsp = SymbolTable::get()->find( rhs[i].first );
-					
-					if ( Symbol::TERMINAL == xsp->getType() )
-					{
-//						std::cout << " add( " << rhs[i].first << " )\n";
-						newcfp->addFollowSet( xsp->getName() );
-						break;
-					}
-					else
-					{
-//						std::ostringstream out2;
-//						xsp->getFirstSet().print( out2 );
-//						std::cout << " combine( " << out2.str() << " )\n";
-						
-						newcfp->combineFollowSet( xsp->getFirstSet() );
-						if ( ! xsp->isLambda() )
-							break;
-					}
-				}
-				
-				if( i == N )
-					cfp->addForwardPropLink( newcfp );
-			}
+			newcfp->combineFollowSet( first );
+			if ( vanishes )
+				cfp->addForwardPropLink( newcfp );
 		}
 	}
+}
+
+
+////////////////////////////////////////
+
+
+void
+ConfigList::takeErrors( ErrorList &errs )
+{
+	errs.swap( myErrors );
+	myErrors.clear();
+}
+
+
+////////////////////////////////////////
+
+
+void
+ConfigList::reportErrors( const ErrorList &errs )
+{
+	ErrorList::const_iterator i, e;
 	
-//	std::ostringstream tmpOut;
-//	for ( Config *cfp = myFront; cfp; cfp = cfp->getNext() )
-//	{
-//		cfp->getRule()->print( tmpOut );
-//		tmpOut << std::endl;
-//	}
-//	std::cout << "ConfigList elements:\n" << tmpOut.str() << std::endl;
+	for ( i = errs.begin(), e = errs.end(); i != e; ++i )
+	{
+		Error::get()->add( (*i).first, "Nonterminal \"%s\" has no rules.",
+						   (*i).second.c_str() );
+	}
 }
 
 
@@ -321,7 +392,7 @@ ConfigList::computeClosure( void )
 void
 ConfigList::deleteConfigs( void )
 {
-	delete myFront;
+	recycle( myFront );
 	reset();
 }
 
@@ -329,6 +400,34 @@ ConfigList::deleteConfigs( void )
 ////////////////////////////////////////
 
 
+void
+ConfigList::recycle( Config *front )
+{
+	for ( Config *cfp = front; cfp; cfp = cfp->getNext() )
+		myFree.push_back( cfp );
+}
+
+
+////////////////////////////////////////
+
+
+Config *
+ConfigList::newConfig( Rule *rp, int dot )
+{
+	if ( myFree.empty() )
+		return Config::create( rp, dot );
+	
+	Config *retval = myFree.back();
+	myFree.pop_back();
+	retval->reset( rp, dot );
+	
+	return retval;
+}
+
+
+////////////////////////////////////////
+
+
 void
 ConfigList::resetPointers( void )
 {
@@ -344,7 +443,11 @@ ConfigList::reset( void )
 {
 	resetPointers();
 	myFrontBasis = myLastBasis = NULL;
-	myConfigs.clear();
+	
+	SlotListIter i, e;
+	for ( i = myTouched.begin(), e = myTouched.end(); i != e; ++i )
+		myItems[*i] = 0;
+	myTouched.clear();
 }
 
 
@@ -354,21 +457,47 @@ ConfigList::reset( void )
 Config *
 ConfigList::find( size_t ruleidx, int dot )
 {
-	ListIter i, e;
-	Config *retval = 0;
+	return myItems[ getItemSlot( ruleidx, dot ) ];
+}
+
+
+////////////////////////////////////////
+
+
+void
+ConfigList::remember( Config *cfg )
+{
+	size_t slot = getItemSlot( cfg->getRule()->getRuleIndex(),
+							   cfg->getDot() );
 	
-	e = myConfigs.end();
-	for ( i = myConfigs.begin(); i != e; ++i )
+	myItems[slot] = cfg;
+	myTouched.push_back( slot );
+}
+
+
+////////////////////////////////////////
+
+
+size_t
+ConfigList::getItemSlot( size_t ruleidx, int dot )
+{
+	// The rule table is complete once parsing is done, so the offsets
+	// only need (re)building the first time through
+	if ( ruleidx >= myRuleOffsets.size() )
 	{
-		if ( (*i)->getRule()->getRuleIndex() == ruleidx &&
-			 (*i)->getDot() == dot )
+		RuleTable *rt = RuleTable::get();
+		size_t i, nRule, total = 0;
+		
+		nRule = rt->getNumRules();
+		myRuleOffsets.resize( nRule );
+		for ( i = 0; i < nRule; ++i )
 		{
-			retval = (*i);
-			break;
+			myRuleOffsets[i] = total;
+			total += rt->getNthRule( i )->getRHSSize() + 1;
 		}
+		myItems.assign( total, 0 );
+		myTouched.clear();
 	}
 	
-	return retval;
+	return myRuleOffsets[ruleidx] + size_t( dot );
 }
-
-		
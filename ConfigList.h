@@ -27,6 +27,10 @@
 #define _ConfigList_h_
 
 #include <vector>
+#include <string>
+#include <utility>
+
+#include "FollowSet.h"
 
 class Rule;
 class Config;
@@ -43,6 +47,10 @@ public:
 	
 	Config *add( Rule *rp, int dot );
 	Config *addWithBasis( Rule *rp, int dot );
+	/// Appends an already constructed config to the basis, so the
+	/// closure can be computed by a different list than the one the
+	/// basis was built in.
+	Config *addBasis( Config *cfp );
 	
 	Config *getConfig( void );
 	Config *getBasis( void );
@@ -51,16 +59,37 @@ public:
 	void	sortBasis( void );
 	
 	void	computeClosure( void );
+	
+	/// When off, the closure does not seed follow sets or record
+	/// propagation links (the lookaheads are computed some other way)
+	inline void setPropagateFollowSets( bool on_off );
+	inline bool isPropagateFollowSets( void ) const;
+	
+	/// Errors found computing the closure can be held back, to be
+	/// reported later in a fixed order (line, nonterminal name).
+	typedef std::vector< std::pair< int, std::string > > ErrorList;
+	
+	inline void setDeferErrors( bool on_off );
+	void takeErrors( ErrorList &errs );
+	static void reportErrors( const ErrorList &errs );
 
+	/// Hands the configs of the list back for reuse (they are never
+	/// really deleted, see Config)
 	void	deleteConfigs( void );
+	void	recycle( Config *front );
 	
 	void	resetPointers( void );
 	void	reset( void );
 private:
 	Config *find( size_t ruleidx, int dot );
+	Config *newConfig( Rule *rp, int dot );
+	void	remember( Config *cfg );
+	size_t	getItemSlot( size_t ruleidx, int dot );
 	
 	typedef std::vector< Config * >	List;
 	typedef List::iterator			ListIter;
+	typedef std::vector< size_t >	SlotList;
+	typedef SlotList::iterator		SlotListIter;
 
 	Config *myFront;
 	Config *myLast;
@@ -68,8 +97,30 @@ private:
 	Config *myFrontBasis;
 	Config *myLastBasis;
 	
-	List	myConfigs;
+	// Dense (rule, dot) -> config lookup.  Each rule owns a run of
+	// (RHS size + 1) slots starting at its offset.  Only the slots
+	// touched while building a state are cleared on reset.
+	SlotList	myRuleOffsets;
+	List		myItems;
+	SlotList	myTouched;
+	
+	List		myFree;
+	
+	// Scratch set of the nonterminals being closed over
+	FollowSet	myClosure;
+	
+	bool		myPropagate;
+	bool		myDeferErrors;
+	ErrorList	myErrors;
 };
 
+
+////////////////////////////////////////
+
+
+inline void ConfigList::setPropagateFollowSets( bool on_off ) { myPropagate = on_off; }
+inline bool ConfigList::isPropagateFollowSets( void ) const { return myPropagate; }
+inline void ConfigList::setDeferErrors( bool on_off ) { myDeferErrors = on_off; }
+
 #endif /* _ConfigList_h_ */
 
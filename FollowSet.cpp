@@ -26,6 +26,14 @@
 #include <ostream>
 
 #include "FollowSet.h"
+#include "SymbolTable.h"
+#include "Symbol.h"
+
+
+////////////////////////////////////////
+
+
+static const size_t kWordBits = sizeof( FollowSet::Word ) * 8;
 
 
 ////////////////////////////////////////
@@ -40,7 +48,7 @@ FollowSet::FollowSet( void )
 
 
 FollowSet::FollowSet( const FollowSet &other )
-		: mySet( other.mySet )
+		: myBits( other.myBits )
 {
 }
 
@@ -60,7 +68,7 @@ FollowSet &
 FollowSet::operator=( const FollowSet &other )
 {
 	if ( this != &other )
-		mySet = other.mySet;
+		myBits = other.myBits;
 	return *this;
 }
 	
@@ -69,17 +77,19 @@ FollowSet::operator=( const FollowSet &other )
 
 
 bool
-FollowSet::add( const std::string &fs )
+FollowSet::add( size_t id )
 {
-	bool retval = false;
+	size_t w = id / kWordBits;
+	Word mask = Word( 1 ) << ( id % kWordBits );
 	
-	if ( mySet.find( fs ) == mySet.end() )
-	{
-		mySet[fs] = 1;
-		retval = true;
-	}
+	if ( w >= myBits.size() )
+		myBits.resize( w + 1, Word( 0 ) );
 	
-	return retval;
+	if ( myBits[w] & mask )
+		return false;
+	
+	myBits[w] |= mask;
+	return true;
 }
 
 
@@ -89,21 +99,48 @@ FollowSet::add( const std::string &fs )
 bool
 FollowSet::combine( const FollowSet &other )
 {
-	SetMapConstIter i, e;
-	bool			retval = false;
+	size_t N = other.myBits.size();
+	
+	if ( N > myBits.size() )
+		myBits.resize( N, Word( 0 ) );
 	
-	i = other.mySet.begin();
-	e = other.mySet.end();
-	for ( ; i != e; ++i )
+	// Keep the loop free of branches so the compiler can vectorize it
+	Word *dst = N > 0 ? &myBits[0] : 0;
+	const Word *src = N > 0 ? &other.myBits[0] : 0;
+	Word changed = 0;
+	
+	for ( size_t i = 0; i < N; ++i )
 	{
-		if ( mySet.find( (*i).first ) == mySet.end() )
-		{
-			mySet[(*i).first] = 1;
-			retval = true;
-		}
+		changed |= src[i] & ~dst[i];
+		dst[i] |= src[i];
 	}
 	
-	return retval;
+	return changed != 0;
+}
+
+
+////////////////////////////////////////
+
+
+void
+FollowSet::clear( void )
+{
+	myBits.assign( myBits.size(), Word( 0 ) );
+}
+
+
+////////////////////////////////////////
+
+
+bool
+FollowSet::isSet( size_t id ) const
+{
+	size_t w = id / kWordBits;
+	
+	if ( w >= myBits.size() )
+		return false;
+	
+	return ( myBits[w] >> ( id % kWordBits ) ) & Word( 1 );
 }
 
 
@@ -111,9 +148,29 @@ FollowSet::combine( const FollowSet &other )
 
 
 bool
-FollowSet::isSet( const std::string &fs ) const
+FollowSet::isEmpty( void ) const
+{
+	return first() == END;
+}
+
+
+////////////////////////////////////////
+
+
+size_t
+FollowSet::first( void ) const
 {
-	return mySet.find( fs ) != mySet.end();
+	return findFrom( 0 );
+}
+
+
+////////////////////////////////////////
+
+
+size_t
+FollowSet::next( size_t id ) const
+{
+	return findFrom( id + 1 );
 }
 
 
@@ -123,14 +180,37 @@ FollowSet::isSet( const std::string &fs ) const
 void
 FollowSet::print( std::ostream &out ) const
 {
-	SetMapConstIter i, e;
+	SymbolTable *symTable = SymbolTable::get();
 	
 	out << "[";
 	
-	e = mySet.end();
-	for ( i = mySet.begin(); i != e; ++i )
-		out << " " << (*i).first;
+	for ( size_t i = first(); i != END; i = next( i ) )
+		out << " " << symTable->getNthSymbol( i )->getName();
 	
 	out << " ]";
 }
 
+
+////////////////////////////////////////
+
+
+size_t
+FollowSet::findFrom( size_t id ) const
+{
+	size_t w = id / kWordBits;
+	size_t N = myBits.size();
+	
+	if ( w >= N )
+		return END;
+	
+	Word cur = myBits[w] & ( ~Word( 0 ) << ( id % kWordBits ) );
+	
+	while ( cur == 0 )
+	{
+		if ( ++w == N )
+			return END;
+		cur = myBits[w];
+	}
+	
+	return w * kWordBits + size_t( __builtin_ctzll( cur ) );
+}
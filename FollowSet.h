@@ -27,19 +27,24 @@
 #define _FollowSet_h_
 
 #include <iosfwd>
-#include <string>
-#include <map>
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
 
 
 ////////////////////////////////////////
 
 
+/// A set of terminal symbols, stored as a dense bitset indexed by the
+/// symbol index.  Terminals are numbered first in the symbol table, so
+/// the bitset stays small and combining two sets is a simple word-wise OR.
 class FollowSet
 {
 public:
-	typedef std::map< std::string, int >	SetMap;
-	typedef SetMap::iterator				SetMapIter;
-	typedef SetMap::const_iterator			SetMapConstIter;
+	typedef uint64_t				Word;
+	typedef std::vector< Word >		WordList;
+	
+	static const size_t END = size_t( -1 );
 	
 	FollowSet( void );
 	FollowSet( const FollowSet &other );
@@ -49,17 +54,27 @@ public:
 	FollowSet &operator=( const FollowSet &other );
 	
 	// Returns true if actually changes
-	bool add( const std::string &fs );
+	bool add( size_t id );
 	// Returns true if actually changes
 	bool combine( const FollowSet &other );
 	
-	bool isSet( const std::string &fs ) const;
+	// Empties the set, keeping its storage
+	void clear( void );
+	
+	bool isSet( size_t id ) const;
+	bool isEmpty( void ) const;
+	
+	/// Walks the set bits in increasing index order:
+	///   for ( i = fs.first(); i != FollowSet::END; i = fs.next( i ) )
+	size_t first( void ) const;
+	size_t next( size_t id ) const;
 	
 	void print( std::ostream &out ) const;
 	
 private:
-	SetMap mySet;
+	size_t findFrom( size_t id ) const;
+	
+	WordList myBits;
 };
 
 #endif /* _FollowSet_h_ */
-
@@ -23,13 +23,17 @@
 // 
 //
 
-#include <fstream>
 #include <sstream>
 #include <iostream>
 #include <stdexcept>
 #include <iosfwd>
+#include <deque>
+#include <thread>
+#include <cctype>
 
 #include "Grammar.h"
+#include "LookAheadGraph.h"
+#include "StateBuilder.h"
 #include "Error.h"
 #include "Rule.h"
 #include "RuleTable.h"
@@ -38,6 +42,8 @@
 #include "Config.h"
 #include "State.h"
 #include "StateTable.h"
+#include "TableCache.h"
+#include "Profile.h"
 #include "Util.h"
 #include "Version.h"
 
@@ -48,7 +54,14 @@
 Grammar::Grammar( void )
 		: myBasisOnly( false ), myCompressActions( true ), myNoActions( false ),
 		  myDebugOutput( false ), myQuiet( true ), myStats( false ),
-		  myLanguage( LanguageDriver::CPP ), myNumConflicts( 0 )
+		  myUseCache( true ), myTablesCached( false ),
+		  myLanguage( LanguageDriver::CPP ),
+		  myLookAheadMethod( PROPAGATION_LINKS ), myNumJobs( 1 ),
+		  myNumShards( 1 ), myNumConflicts( 0 ),
+		  myNumFollowVisits( 0 ), myNumFollowPropagations( 0 ),
+		  myNumTransitions( 0 ), myNumReads( 0 ), myNumIncludes( 0 ),
+		  myNumClosureItems( 0 ), myNumPropLinks( 0 ), myNumSavedEntries( 0 ),
+		  myNumBypassed( 0 )
 {
 	SymbolTable::get()->findOrCreate("$");
 	SymbolTable::get()->addDefault("{default}");
@@ -103,14 +116,9 @@ Grammar::setValue( const std::string &name,
 				   const std::string &value,
 				   int				  line )
 {
-	bool retval = true;
-
-	if ( mySettings.find( name ) == mySettings.end() )
-		mySettings[ name ] = ValueSetting( value, line );
-	else
-		retval = false;
-
-	return retval;
+	// Only the first value given for a name is kept
+	return mySettings.insert(
+		ValueMap::value_type( name, ValueSetting( value, line ) ) ).second;
 }
 
 
@@ -120,35 +128,123 @@ Grammar::setValue( const std::string &name,
 void
 Grammar::process( void )
 {
+	Profile *prof = Profile::get();
+
+	// The symbol table is complete now, switch the rules over to
+	// symbol indices
+	prof->beginPhase( "intern" );
+	RuleTable::get()->intern();
+
+	prof->beginPhase( "findPrecedences" );
 	RuleTable::get()->findPrecedences();
+	findUnitCopies();
+
+	// If the grammar structure is the same as last time, the tables
+	// can be had from the cache.  The report lists the configurations
+	// of every state, those are not cached.
+	std::string cacheName;
+	Util::getFileName( cacheName, myOutputDir, mySourceFile, ".tables" );
+
+	TableCache cache( cacheName );
+	if ( isUseCache() )
+	{
+		ValueMapConstIter si = mySettings.find( std::string( "start_symbol" ) );
+
+		cache.computeKey( si != mySettings.end() ? (*si).second.first :
+						  RuleTable::get()->getNthRule( 0 )->getLHS(),
+						  isCompressActions() );
+
+		if ( isQuiet() )
+		{
+			prof->beginPhase( "loadTables" );
+			myTablesCached = cache.load();
+		}
+
+		if ( myTablesCached )
+		{
+			prof->beginPhase( "bypassUnitRules" );
+			bypassUnitRules();
+
+			prof->beginPhase( "mergeStates" );
+			mergeStates();
+
+			prof->beginPhase( "outputFiles" );
+			outputFiles();
+			prof->endPhase();
+			profileCounts();
+			return;
+		}
+	}
 
 	/// Compute the lambda-nonterminals and the first-sets for every
     /// nonterminal
+	prof->beginPhase( "findFirstSets" );
 	findFirstSets();
 
 	// Compute all LR(0) states.  Also record follow-set propagation
 	// links so that the follow-set can be computed later
+	prof->beginPhase( "findStates" );
 	findStates();
 
-	// Tie up loose ends on the propagation links
-	findLinks();
+	if ( myLookAheadMethod == DEREMER_PENNELLO )
+	{
+		// Compute the lookaheads of the reducible configurations
+		// straight from the LR(0) automaton
+		prof->beginPhase( "findLookAheads" );
+		findLookAheads();
+	}
+	else
+	{
+		// Tie up loose ends on the propagation links
+		prof->beginPhase( "findLinks" );
+		findLinks();
 
-	// Compute the follow set of every reducible configuration
-	findFollowSets();
+		// Compute the follow set of every reducible configuration
+		prof->beginPhase( "findFollowSets" );
+		findFollowSets();
+	}
 
 	// Compute the action tables
+	prof->beginPhase( "findActions" );
 	findActions();
 
 	// Compress the action tables
 	if ( isCompressActions() )
+	{
+		prof->beginPhase( "compressTables" );
 		compressTables();
+	}
+
+	// Only clean tables are worth keeping, a cache hit would skip the
+	// conflict and error reports
+	if ( isUseCache() && 0 == myNumConflicts && 0 == Error::get()->getCount() )
+	{
+		prof->beginPhase( "saveTables" );
+		if ( ! cache.save() )
+			Error::get()->add( "Unable to write the table cache file." );
+	}
 
 	// Generate a report of the parser generated.  (the "y.output" file) */
 	if ( ! isQuiet() )
+	{
+		prof->beginPhase( "reportOutput" );
 		reportOutput();
+	}
+
+	// Skip the reductions of unit rules that only pass a value on, then
+	// share the table rows between equivalent states
+	prof->beginPhase( "bypassUnitRules" );
+	bypassUnitRules();
+
+	prof->beginPhase( "mergeStates" );
+	mergeStates();
 
 	// Generate the source code for the parser
+	prof->beginPhase( "outputFiles" );
 	outputFiles();
+	prof->endPhase();
+
+	profileCounts();
 }
 
 
@@ -221,8 +317,176 @@ Grammar::printStats( void ) const
 			  << RuleTable::get()->getNumRules() << " rules" << std::endl;
 
 	std::cout << "                    " << StateTable::get()->getNumStates()
-			  << " states, " << 0 << " parser table entries, "
+			  << " states, " << countTableEntries() << " parser table entries, "
 			  << myNumConflicts << " conflicts" << std::endl;
+
+	if ( myNumBypassed > 0 )
+	{
+		std::cout << "                    " << myNumBypassed
+				  << " shifts bypass a unit rule reduction" << std::endl;
+	}
+
+	size_t nRow = StateTable::get()->getNumTableStates();
+	if ( nRow < StateTable::get()->getNumStates() )
+	{
+		std::cout << "                    " << nRow << " table rows after "
+				  << StateTable::get()->getNumStates() - nRow
+				  << " states merged or unused, " << myNumSavedEntries
+				  << " entries saved" << std::endl;
+	}
+
+	if ( myTablesCached )
+	{
+		std::cout << "                    tables reused from the cache"
+				  << std::endl;
+	}
+	else if ( myLookAheadMethod == DEREMER_PENNELLO )
+	{
+		std::cout << "                    " << myNumTransitions
+				  << " nonterminal transitions, " << myNumReads
+				  << " reads, " << myNumIncludes << " includes"
+				  << std::endl;
+	}
+	else
+	{
+		std::cout << "                    " << myNumFollowVisits
+				  << " follow set visits, " << myNumFollowPropagations
+				  << " propagations" << std::endl;
+	}
+
+	if ( Profile::get()->isEnabled() )
+	{
+		if ( ! myTablesCached )
+		{
+			std::cout << "                    " << myNumClosureItems
+					  << " closure items, " << myNumPropLinks
+					  << " propagation links" << std::endl;
+		}
+
+		Profile::get()->print( std::cout );
+	}
+}
+
+
+////////////////////////////////////////
+
+
+size_t
+Grammar::countTableEntries( void ) const
+{
+	size_t i, nState, nTotal;
+	std::vector< size_t > rows, key;
+
+	// Same as the drivers: one row for each state in the tables
+	nTotal = 0;
+	nState = StateTable::get()->getNumTableStates();
+	for ( i = 0; i < nState; ++i )
+	{
+		key.clear();
+		nTotal += getTableEntries( StateTable::get()->getNthTableState( i ),
+								   rows, key );
+	}
+
+	return nTotal;
+}
+
+
+////////////////////////////////////////
+
+
+size_t
+Grammar::getTableEntries( const State *stp,
+						  const std::vector< size_t > &rows,
+						  std::vector< size_t > &key )
+{
+	size_t j, nAct, nEntry, target;
+	size_t defIdx = SymbolTable::get()->getDefault()->getIndex();
+
+	// Every action that is not ignored, the default action in its own
+	// slot only (no lookahead is ever "{default}")
+	const ActionList &ap = stp->getActions();
+
+	nEntry = 0;
+	nAct = ap.getNumActions();
+	for ( j = 0; j < nAct; ++j )
+	{
+		const Action &act = ap.getNthAction( j );
+
+		if ( act.getType() == Action::SHIFT )
+		{
+			target = size_t( act.getState()->getStateIndex() );
+			if ( target < rows.size() )
+				target = rows[target];
+		}
+		else if ( act.getType() == Action::REDUCE )
+			target = act.getRule()->getRuleIndex();
+		else
+			target = 0;
+
+		if ( ! act.isIgnoreType() && act.getLookAhead() != defIdx )
+		{
+			key.push_back( act.getLookAhead() );
+			key.push_back( size_t( act.getType() ) );
+			key.push_back( target );
+			nEntry++;
+		}
+		if ( act.getLookAhead() == defIdx )
+		{
+			key.push_back( size_t( -1 ) );
+			key.push_back( size_t( act.getType() ) );
+			key.push_back( target );
+			nEntry++;
+		}
+	}
+
+	return nEntry;
+}
+
+
+////////////////////////////////////////
+
+
+void
+Grammar::profileCounts( void )
+{
+	Profile *prof = Profile::get();
+	size_t i, nState;
+
+	if ( ! prof->isEnabled() )
+		return;
+
+	myNumClosureItems = 0;
+	myNumPropLinks = 0;
+	nState = StateTable::get()->getNumStates();
+	for ( i = 0; i < nState; ++i )
+	{
+		Config *cfp = StateTable::get()->getNthState( i )->getConfig();
+
+		for ( ; cfp; cfp = cfp->getNext() )
+		{
+			++myNumClosureItems;
+			myNumPropLinks += cfp->getForwardPropLinks().size();
+		}
+	}
+
+	size_t nt = SymbolTable::get()->getNumTerminals();
+
+	prof->setCount( "terminals", nt );
+	prof->setCount( "nonterminals", SymbolTable::get()->getNumSymbols() - nt );
+	prof->setCount( "rules", RuleTable::get()->getNumRules() );
+	prof->setCount( "states", nState );
+	prof->setCount( "closure items", myNumClosureItems );
+	prof->setCount( "propagation links", myNumPropLinks );
+	prof->setCount( "follow set visits", myNumFollowVisits );
+	prof->setCount( "follow set propagations", myNumFollowPropagations );
+	prof->setCount( "nonterminal transitions", myNumTransitions );
+	prof->setCount( "reads", myNumReads );
+	prof->setCount( "includes", myNumIncludes );
+	prof->setCount( "bypassed unit reductions", myNumBypassed );
+	prof->setCount( "table rows", StateTable::get()->getNumTableStates() );
+	prof->setCount( "table entries", countTableEntries() );
+	prof->setCount( "entries saved by merging", myNumSavedEntries );
+	prof->setCount( "conflicts", size_t( myNumConflicts ) );
 }
 
 
@@ -241,6 +505,9 @@ Grammar::findFirstSets( void )
 
 	// Now compute the first sets
 	RuleTable::get()->computeFirstSets();
+
+	// And what closing the states will need from them
+	RuleTable::get()->computeClosureSets();
 }
 
 
@@ -258,7 +525,7 @@ Grammar::findStates( void )
 		return;
 	}
 
-	if ( RuleTable::get()->isOnRightSide( startSym->getName() ) )
+	if ( RuleTable::get()->isOnRightSide( startSym->getIndex() ) )
 	{
 		Error::get()->add( "The start symbol \"%s\" occurs on the "
 						   "right-hand side of a rule. This will result "
@@ -267,20 +534,33 @@ Grammar::findStates( void )
 	}
 
 	myCurConfigList.reset();
+	myCurConfigList.setPropagateFollowSets(
+		myLookAheadMethod == PROPAGATION_LINKS );
 
-	Rule	*startRule = RuleTable::get()->findFirstRule( startSym->getName() );
-	while ( startRule )
+	RuleTable::RuleSpanIter ri, re;
+	RuleTable::get()->getRules( startSym->getIndex(), ri, re );
+	for ( ; ri != re; ++ri )
 	{
-		Config *tmpCfg = myCurConfigList.addWithBasis( startRule, 0 );
+		Config *tmpCfg = myCurConfigList.addWithBasis( *ri, 0 );
 
 		// All start rules have the start symbol as their left hand side
 //		tmpCfg->addFollowSet( startSym->getName() );
-		tmpCfg->addFollowSet( SymbolTable::get()->getNthSymbol( 0 )->getName() );
-
-		startRule = RuleTable::get()->getNextRule( startRule );
+		// Symbol 0 is always the end of input marker "$"
+		if ( myCurConfigList.isPropagateFollowSets() )
+			tmpCfg->addFollowSet( 0 );
 	}
 
-	getNextState();
+	if ( myNumJobs > 1 )
+	{
+		StateBuilder builder( myNumJobs,
+							  myCurConfigList.isPropagateFollowSets() );
+
+		myCurConfigList.sortBasis();
+		builder.build( myCurConfigList.getBasis() );
+		myCurConfigList.reset();
+	}
+	else
+		getNextState();
 }
 
 
@@ -308,7 +588,7 @@ Grammar::findLinks( void )
 
 			pe = bp.end();
 			for ( pi = bp.begin(); pi != pe; ++pi )
-				(*pi)->addForwardPropLink( cfp );
+				Config::get( *pi )->addForwardPropLink( cfp );
 		}
 	}
 }
@@ -317,9 +597,13 @@ Grammar::findLinks( void )
 ////////////////////////////////////////
 
 
+/// Propagates follow sets along the forward links using a worklist.
+/// A config is only revisited when one of its follow sets has grown
+/// since it was last propagated.
 void
 Grammar::findFollowSets( void )
 {
+	std::deque< Config::Index > work;
 	size_t i, N;
 
 	N = StateTable::get()->getNumStates();
@@ -327,40 +611,58 @@ Grammar::findFollowSets( void )
 	{
 		State *stp = StateTable::get()->getNthState( i );
 		for ( Config *cfp = stp->getConfig(); cfp; cfp = cfp->getNext() )
+		{
 			cfp->setStatus( Config::INCOMPLETE );
+			work.push_back( cfp->getIndex() );
+		}
 	}
 
-	bool progress = false;
+	myNumFollowVisits = 0;
+	myNumFollowPropagations = 0;
 
-	do
+	while ( ! work.empty() )
 	{
-		progress = false;
+		Config *cfp = Config::get( work.front() );
+		work.pop_front();
 
-		for ( i = 0; i < N; ++i )
-		{
-			State *stp = StateTable::get()->getNthState( i );
-			for ( Config *cfp = stp->getConfig(); cfp; cfp = cfp->getNext() )
-			{
-				if ( cfp->getStatus() == Config::COMPLETE )
-					continue;
+		// INCOMPLETE means the config is queued
+		cfp->setStatus( Config::COMPLETE );
+		++myNumFollowVisits;
 
-				const Config::PropList &plp = cfp->getForwardPropLinks();
-				Config::PropListConstIter pi, pe;
+		const Config::PropList &plp = cfp->getForwardPropLinks();
+		Config::PropListConstIter pi, pe;
 
-				pe = plp.end();
-				for ( pi = plp.begin(); pi != pe; ++pi )
-				{
-					if ( (*pi)->combineFollowSet( cfp->getFollowSet() ) )
-					{
-						(*pi)->setStatus( Config::INCOMPLETE );
-						progress = true;
-					}
-				}
+		pe = plp.end();
+		for ( pi = plp.begin(); pi != pe; ++pi )
+		{
+			Config *dst = Config::get( *pi );
 
-				cfp->setStatus( Config::COMPLETE );
+			++myNumFollowPropagations;
+			if ( dst->combineFollowSet( cfp->getFollowSet() ) &&
+				 dst->getStatus() == Config::COMPLETE )
+			{
+				dst->setStatus( Config::INCOMPLETE );
+				work.push_back( *pi );
 			}
 		}
-	} while ( progress );
+	}
+}
+
+
+////////////////////////////////////////
+
+
+void
+Grammar::findLookAheads( void )
+{
+	Symbol *startSym = getStartSymbol();
+	LookAheadGraph graph;
+
+	graph.compute( startSym->getIndex() );
+
+	myNumTransitions = graph.getNumTransitions();
+	myNumReads = graph.getNumReads();
+	myNumIncludes = graph.getNumIncludes();
 }
 
 
@@ -370,11 +672,10 @@ Grammar::findFollowSets( void )
 void
 Grammar::findActions( void )
 {
-	size_t i, j, nState, nSym, nRule;
+	size_t i, j, nState, nRule;
 	State	*stp;
 
 	nState = StateTable::get()->getNumStates();
-	nSym = SymbolTable::get()->getNumSymbols();
 
 	// Find all reduce actions...
 	for ( i = 0; i < nState; ++i )
@@ -383,20 +684,12 @@ Grammar::findActions( void )
 		for ( Config *cfp = stp->getConfig(); cfp; cfp = cfp->getNext() )
 		{
 			// Check if dot at extreme right
-			if ( size_t( cfp->getDot() ) == cfp->getRule()->getRHS().size() )
+			if ( size_t( cfp->getDot() ) == cfp->getRule()->getRHSSize() )
 			{
-				for ( j = 0; j < nSym; ++j )
-				{
-					Symbol *sp = SymbolTable::get()->getNthSymbol( j );
-
-					if ( ( Symbol::TERMINAL == sp->getType() ||
-						   sp->getName() == "$" ) &&
-						 cfp->getFollowSet().isSet( sp->getName() ) )
-					{
-						stp->addAction( Action::REDUCE, sp->getName(),
-										0, cfp->getRule() );
-					}
-				}
+				// Follow sets only ever hold terminals (and "$")
+				const FollowSet &fs = cfp->getFollowSet();
+				for ( j = fs.first(); j != FollowSet::END; j = fs.next( j ) )
+					stp->addAction( Action::REDUCE, j, 0, cfp->getRule() );
 			}
 		}
 	}
@@ -408,57 +701,39 @@ Grammar::findActions( void )
 	// starting state of the finite state machine as an action to accept
 	// if the lookahead is the start nonterminal.
 	if ( startSym && stp )
-		stp->addAction( Action::ACCEPT, startSym->getName(), 0, 0 );
+		stp->addAction( Action::ACCEPT, startSym->getIndex(), 0, 0 );
 
 	// Resolve conflicts
 	for ( i = 0; i < nState; ++i )
 	{
 		stp = StateTable::get()->getNthState( i );
 
-		// Check for SHIFT-SHIFT conflicts first (nothing we can do to resolve)
-		for ( Config *cfp = stp->getConfig(); cfp; cfp = cfp->getNext() )
-		{
-			if ( ! cfp->getForwardPropLinks().empty() )
-				continue;
-
-			Rule *curRule = cfp->getRule();
-
-			if ( size_t( cfp->getDot() ) == curRule->getRHS().size() )
-				continue;
-
-			for ( Config *next = stp->getConfig(); next; next = next->getNext() )
-			{
-				if ( next == cfp )
-					continue;
-
-				Rule *nextRule = next->getRule();
-
-				if ( size_t( next->getDot() ) == nextRule->getRHS().size() )
-					continue;
-
-				if ( curRule->getRHS()[cfp->getDot()].first ==
-					 nextRule->getRHS()[next->getDot()].first )
-				{
-					std::cout << "Unresolved SHIFT-SHIFT conflict between:\n"
-							  << std::endl;
-					curRule->print( std::cout );
-					std::cout << std::endl << "\nand\n" << std::endl;
-					nextRule->print( std::cout );
-					std::cout << std::endl << std::endl;
-					++myNumConflicts;
-				}
-			}
-		}
+		// There is no SHIFT-SHIFT check: every config with the same
+		// symbol after the dot was shifted into the same successor
+		// state by buildShifts, so two shifts can never share a
+		// lookahead.
 
 		stp->sortActions();
 		ActionList &ap = stp->getActions();
 		size_t nAct = ap.getNumActions();
-		if ( nAct > 0 )
+
+		// Only actions on the same lookahead can conflict, and the
+		// sort leaves those next to each other, so compare pairs
+		// within each run of equal lookaheads only.
+		size_t runEnd;
+		for ( j = 0; j < nAct; j = runEnd )
 		{
-			for ( j = 0; j < (nAct - 1); ++j )
+			size_t la = ap.getNthAction( j ).getLookAhead();
+			for ( runEnd = j + 1; runEnd < nAct; ++runEnd )
 			{
-				Action &act = ap.getNthAction( j );
-				for ( size_t k = j + 1; k < nAct; ++k )
+				if ( ap.getNthAction( runEnd ).getLookAhead() != la )
+					break;
+			}
+
+			for ( size_t a = j; a + 1 < runEnd; ++a )
+			{
+				Action &act = ap.getNthAction( a );
+				for ( size_t k = a + 1; k < runEnd; ++k )
 				{
 					Action &nact = ap.getNthAction( k );
 					int numCs = resolveConflict( act, nact );
@@ -515,12 +790,261 @@ void
 Grammar::compressTables( void )
 {
 	size_t i, nState;
+	Symbol *startSym = getStartSymbol();
+	size_t startIdx = startSym ? startSym->getIndex() : Rule::NO_SYMBOL;
 
 	nState = StateTable::get()->getNumStates();
 
 	// Find all reduce actions...
 	for ( i = 0; i < nState; ++i )
-		StateTable::get()->getNthState(i)->compress();
+		StateTable::get()->getNthState(i)->compress( startIdx );
+}
+
+
+////////////////////////////////////////
+
+
+/// Finds the states that act the same on every lookahead, their shifts
+/// and gotos going to states that again are the same.  Starting with all
+/// states in one group, a group is split up until all its states have
+/// the same table entries, with the shift targets given by their groups.
+/// Those states can share one table row.  States no shift leads to any
+/// more (see bypassUnitRules) get no row at all.  The trace of a debug
+/// parser prints the state numbers of the report, so it keeps every state.
+void
+Grammar::mergeStates( void )
+{
+	typedef std::map< std::vector< size_t >, size_t > RowMap;
+
+	const size_t kNoRow = size_t( -1 );
+	size_t i, j, nState, nRow, nPrev;
+
+	myNumSavedEntries = 0;
+	if ( isDebugOutput() )
+		return;
+
+	nState = StateTable::get()->getNumStates();
+	if ( nState == 0 )
+		return;
+
+	std::vector< size_t > rows( nState, kNoRow ), nextRows( nState, kNoRow );
+	std::vector< size_t > nEntries( nState ), key, work;
+	RowMap rowMap;
+
+	// Only the states reached from the start state get a row
+	rows[0] = 0;
+	work.push_back( 0 );
+	while ( ! work.empty() )
+	{
+		const ActionList &ap = StateTable::get()->getNthState( work.back() )->getActions();
+
+		work.pop_back();
+		for ( j = 0; j < ap.getNumActions(); ++j )
+		{
+			const Action &act = ap.getNthAction( j );
+
+			if ( act.getType() != Action::SHIFT )
+				continue;
+
+			i = size_t( act.getState()->getStateIndex() );
+			if ( rows[i] == kNoRow )
+			{
+				rows[i] = 0;
+				work.push_back( i );
+			}
+		}
+	}
+
+	nRow = 1;
+	do
+	{
+		// The rows are numbered by their first state, so state 0 stays
+		// the start state
+		nPrev = nRow;
+		rowMap.clear();
+		for ( i = 0; i < nState; ++i )
+		{
+			key.clear();
+			key.push_back( rows[i] );
+			nEntries[i] = getTableEntries( StateTable::get()->getNthState( i ),
+										   rows, key );
+			if ( rows[i] == kNoRow )
+				continue;
+
+			RowMap::value_type row( key, rowMap.size() );
+			nextRows[i] = (*rowMap.insert( row ).first).second;
+		}
+		rows.swap( nextRows );
+		nRow = rowMap.size();
+	} while ( nRow != nPrev );
+
+	if ( nRow == nState )
+		return;
+
+	StateTable::get()->setTableIndex( rows );
+
+	for ( i = 0; i < nState; ++i )
+	{
+		if ( rows[i] == kNoRow ||
+			 StateTable::get()->getNthTableState( rows[i] ) !=
+			 StateTable::get()->getNthState( i ) )
+			myNumSavedEntries += nEntries[i];
+	}
+}
+
+
+////////////////////////////////////////
+
+
+/// A unit rule can be skipped when its left hand side ends up with the
+/// very value its symbol had: the same type, no code or only the copy,
+/// and nothing to destroy on either side.  The error symbol keeps its
+/// reduction, error recovery looks for it on the stack.
+void
+Grammar::findUnitCopies( void )
+{
+	ValueMapConstIter ti = mySettings.find( std::string( "token_type" ) );
+	ValueMapConstIter di = mySettings.find( std::string( "token_destructor" ) );
+	std::string tokenType, copy, code;
+	size_t i, nRule;
+
+	if ( ti != mySettings.end() )
+		tokenType = (*ti).second.first;
+	bool tokenDtor = ( di != mySettings.end() && ! (*di).second.first.empty() );
+
+	nRule = RuleTable::get()->getNumRules();
+	for ( i = 0; i < nRule; ++i )
+	{
+		Rule *rp = RuleTable::get()->getNthRule( i );
+		
+		rp->setUnitCopy( false );
+		if ( rp->getRHSSize() != 1 ||
+			 rp->getRHSSymbols()[0] == myErrSym->getIndex() )
+			continue;
+
+		Symbol *lhs = rp->getLHSSymbol();
+		Symbol *rhs = SymbolTable::get()->getNthSymbol( rp->getRHSSymbols()[0] );
+		bool rhsTerm = ( Symbol::TERMINAL == rhs->getType() );
+
+		const std::string &rhsType = ( rhsTerm || rhs->getDataType().empty() ) ?
+			tokenType : rhs->getDataType();
+		const std::string &lhsType = lhs->getDataType().empty() ?
+			tokenType : lhs->getDataType();
+
+		if ( lhsType != rhsType || ! lhs->getDestructor().empty() ||
+			 ( rhsTerm ? tokenDtor : ! rhs->getDestructor().empty() ) )
+			continue;
+
+		code.clear();
+		for ( std::string::const_iterator c = rp->getCode().begin();
+			  c != rp->getCode().end(); ++c )
+		{
+			if ( ! isspace( static_cast< unsigned char >( *c ) ) )
+				code.push_back( *c );
+		}
+
+		const std::string &lhsAlias = rp->getLHSAlias();
+		const std::string &rhsAlias = rp->getRHS()[0].second;
+		copy = lhsAlias + "=" + rhsAlias;
+
+		if ( code.empty() )
+			rp->setUnitCopy( lhsAlias.empty() && rhsAlias.empty() );
+		else if ( ! lhsAlias.empty() && ! rhsAlias.empty() )
+			rp->setUnitCopy( code == copy || code == copy + ";" );
+	}
+}
+
+
+////////////////////////////////////////
+
+
+/// A state whose only action is to reduce a unit copy A ::= B is left
+/// right away, to the state the state below it goes to on A.  So every
+/// shift (or goto) on B into such a state can go there directly,
+/// following a chain of them.  The B on the stack then stands for the
+/// A, which has the same value.
+void
+Grammar::bypassUnitRules( void )
+{
+	size_t i, j, k, n, nState;
+
+	myNumBypassed = 0;
+	if ( isDebugOutput() )
+		return;
+
+	nState = StateTable::get()->getNumStates();
+
+	std::vector< Rule * > unitRule( nState );
+	for ( i = 0; i < nState; ++i )
+	{
+		const ActionList &ap = StateTable::get()->getNthState( i )->getActions();
+		Rule *rp = 0;
+
+		for ( j = 0; j < ap.getNumActions(); ++j )
+		{
+			const Action &act = ap.getNthAction( j );
+
+			if ( act.isIgnoreType() )
+				continue;
+			if ( act.getType() != Action::REDUCE ||
+				 ! act.getRule()->isUnitCopy() ||
+				 ( rp && rp != act.getRule() ) )
+			{
+				rp = 0;
+				break;
+			}
+			rp = act.getRule();
+		}
+		unitRule[i] = rp;
+	}
+
+	for ( i = 0; i < nState; ++i )
+	{
+		ActionList &ap = StateTable::get()->getNthState( i )->getActions();
+
+		for ( j = 0; j < ap.getNumActions(); ++j )
+		{
+			Action &act = ap.getNthAction( j );
+			if ( act.getType() != Action::SHIFT )
+				continue;
+
+			State *stp = act.getState();
+			for ( n = 0; n < nState; ++n )
+			{
+				Rule *rp = unitRule[stp->getStateIndex()];
+				if ( ! rp )
+					break;
+
+				// The goto of this state on the left hand side, unless it
+				// accepts there (the start symbol used in a rule)
+				State *gotoState = 0;
+				for ( k = 0; k < ap.getNumActions(); ++k )
+				{
+					const Action &gotoAct = ap.getNthAction( k );
+					if ( gotoAct.getLookAhead() != rp->getLHSIndex() ||
+						 gotoAct.isIgnoreType() )
+						continue;
+
+					if ( gotoAct.getType() != Action::SHIFT || gotoState )
+					{
+						gotoState = 0;
+						break;
+					}
+					gotoState = gotoAct.getState();
+				}
+				if ( ! gotoState )
+					break;
+
+				stp = gotoState;
+			}
+
+			if ( stp != act.getState() )
+			{
+				act.setState( stp );
+				++myNumBypassed;
+			}
+		}
+	}
 }
 
 
@@ -533,7 +1057,7 @@ Grammar::reportOutput( void )
 	std::string outputName;
 	Util::getFileName( outputName, myOutputDir, mySourceFile, ".out" );
 
-	std::ofstream out;
+	Util::OutputFile out;
 	out.open( outputName.c_str() );
 
 	StateTable::get()->print( out, myBasisOnly );
@@ -545,6 +1069,16 @@ Grammar::reportOutput( void )
 ////////////////////////////////////////
 
 
+static void
+writeHeaderOn( Producer *producer, bool *isOk )
+{
+	*isOk = producer->writeHeader();
+}
+
+
+////////////////////////////////////////
+
+
 void
 Grammar::outputFiles( void )
 {
@@ -559,7 +1093,33 @@ Grammar::outputFiles( void )
 		std::string arg, prefix;
 
 		producer->setDebugOutput( isDebugOutput() );
-		if ( producer->writeSource() )
+		producer->setNumShards( myNumShards );
+		if ( myNumJobs > 1 )
+		{
+			// The header gets a producer of its own so the two share no
+			// output state and can be written side by side
+			Producer *hdrProducer = LanguageDriver::getProducer( myLanguage,
+																 mySettings,
+																 myOutputDir,
+																 getName(),
+																 mySourceFile );
+			bool hdrOk = false;
+
+			hdrProducer->setDebugOutput( isDebugOutput() );
+			hdrProducer->setNumShards( myNumShards );
+
+			std::thread hdrWriter( writeHeaderOn, hdrProducer, &hdrOk );
+			bool srcOk = producer->writeSource();
+			hdrWriter.join();
+
+			if ( ! srcOk )
+				Error::get()->add( "Unable to write the output source file." );
+			else if ( ! hdrOk )
+				Error::get()->add( "Unable to write the output header file." );
+
+			delete hdrProducer;
+		}
+		else if ( producer->writeSource() )
 		{
 			if ( ! producer->writeHeader() )
 				Error::get()->add( "Unable to write the output header file." );
@@ -601,12 +1161,10 @@ Grammar::getNextState( void )
 		myCurConfigList.computeClosure();
 		myCurConfigList.sort();
 
-		state = new State( bp, myCurConfigList.getConfig() );
+		state = StateTable::get()->add( bp, myCurConfigList.getConfig() );
 
 		myCurConfigList.resetPointers();
 
-		StateTable::get()->add( state );
-
 		// Cause things to recurse around (if necessary)
 		buildShifts( state );
 	}
@@ -634,7 +1192,7 @@ Grammar::buildShifts( State *state )
 		if ( cfp->getStatus() == Config::COMPLETE )
 			continue;
 
-		const Rule::RHSList &rhs = cfp->getRule()->getRHS();
+		const Rule::SymbolList &rhs = cfp->getRule()->getRHSSymbols();
 
 		if ( cfp->getDot() >= int( rhs.size() ) )
 			continue;
@@ -650,11 +1208,11 @@ Grammar::buildShifts( State *state )
 			if ( bcfp->getStatus() == Config::COMPLETE )
 				continue;
 
-			const Rule::RHSList &brhs = bcfp->getRule()->getRHS();
+			const Rule::SymbolList &brhs = bcfp->getRule()->getRHSSymbols();
 			if ( bcfp->getDot() >= int( brhs.size() ) )
 				continue;
 
-			if ( rhs[cfp->getDot()].first != brhs[bcfp->getDot()].first )
+			if ( rhs[cfp->getDot()] != brhs[bcfp->getDot()] )
 				continue;
 
 			bcfp->setStatus( Config::COMPLETE );
@@ -662,13 +1220,14 @@ Grammar::buildShifts( State *state )
 			Config *cfg = myCurConfigList.addWithBasis( bcfp->getRule(),
 														bcfp->getDot() + 1 );
 
-			cfg->addBackwardPropLink( bcfp );
+			if ( myCurConfigList.isPropagateFollowSets() )
+				cfg->addBackwardPropLink( bcfp );
 		}
 
 		State *newstp = getNextState();
 
 		// Add shift action to reach state newstp from state on symbol...
-		state->addAction( Action::SHIFT, rhs[cfp->getDot()].first, newstp, 0 );
+		state->addAction( Action::SHIFT, rhs[cfp->getDot()], newstp, 0 );
 	}
 }
 
@@ -726,8 +1285,8 @@ Grammar::resolveConflict( Action &act, Action &nextAct )
 		if ( retval != 0 )
 		{
 			std::cout << "Unresolved SHIFT-REDUCE conflict between '"
-					  << act.getLookAhead() << "' and '"
-					  << nextAct.getLookAhead() << "'"
+					  << act.getLookAheadName() << "' and '"
+					  << nextAct.getLookAheadName() << "'"
 					  << std::endl;
 		}
 	}
@@ -752,8 +1311,8 @@ Grammar::resolveConflict( Action &act, Action &nextAct )
 		if ( retval != 0 )
 		{
 			std::cout << "Unresolved REDUCE-REDUCE conflict between '"
-					  << act.getLookAhead() << "' and '"
-					  << nextAct.getLookAhead() << "'"
+					  << act.getLookAheadName() << "' and '"
+					  << nextAct.getLookAheadName() << "'"
 					  << std::endl;
 		}
 	}
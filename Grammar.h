@@ -44,6 +44,13 @@ class Action;
 class Grammar
 {
 public:
+	/// How the LALR(1) lookaheads are computed
+	enum LookAheadMethod
+	{
+		PROPAGATION_LINKS,	// lemon style links between configs
+		DEREMER_PENNELLO	// reads / includes relations
+	};
+	
 	Grammar( void );
 	~Grammar( void );
 
@@ -59,6 +66,10 @@ public:
 	inline void setQuiet( bool on_off );
 	inline bool isStats( void ) const;
 	inline void setStats( bool on_off );
+	/// Reuse the parser tables of the previous run when only code
+	/// changed in the grammar
+	inline bool isUseCache( void ) const;
+	inline void setUseCache( bool on_off );
 	
 	void setSourceFile( const char *sourceFile );
 	inline const std::string &getSourceFile( void ) const;
@@ -68,6 +79,17 @@ public:
 	void setLanguage( LanguageDriver::Language lang );
 	inline LanguageDriver::Language getLanguage( void ) const;
 	
+	inline void setLookAheadMethod( LookAheadMethod method );
+	inline LookAheadMethod getLookAheadMethod( void ) const;
+	
+	/// Number of threads used to build the LR(0) states
+	inline void setNumJobs( size_t numJobs );
+	inline size_t getNumJobs( void ) const;
+	
+	/// Number of source files the rule actions are spread over
+	inline void setNumShards( size_t numShards );
+	inline size_t getNumShards( void ) const;
+	
 	/// Returns true if ok, false if value already specified
 	bool setValue( const std::string &name,
 				   const std::string &value,
@@ -85,11 +107,30 @@ private:
 	void findStates( void );
 	void findLinks( void );
 	void findFollowSets( void );
+	void findLookAheads( void );
 	void findActions( void );
 	void compressTables( void );
+	/// Marks the unit rules that hand their value on unchanged
+	void findUnitCopies( void );
+	/// Points the shifts into states that only reduce such a unit rule
+	/// straight at the state the reduction would go to
+	void bypassUnitRules( void );
+	/// Lets equivalent states share one row of the generated tables
+	void mergeStates( void );
 	void reportOutput( void );
 	void outputFiles( void );
 	
+	/// Number of entries the drivers put in the parser tables
+	size_t countTableEntries( void ) const;
+	/// Appends the table entries of a state to key, shift targets by
+	/// the row in rows, returns the number of entries
+	static size_t getTableEntries( const State *stp,
+								   const std::vector< size_t > &rows,
+								   std::vector< size_t > &key );
+	/// Counts the closure items and propagation links and hands every
+	/// count over to the Profile
+	void profileCounts( void );
+	
 	State *getNextState( void );
 	void buildShifts( State *state );
 	
@@ -104,11 +145,16 @@ private:
 	bool myDebugOutput;
 	bool myQuiet;
 	bool myStats;
+	bool myUseCache;
+	bool myTablesCached;
 	
 	std::string mySourceFile;
 	std::string myOutputDir;
 	
 	LanguageDriver::Language myLanguage;
+	LookAheadMethod myLookAheadMethod;
+	size_t myNumJobs;
+	size_t myNumShards;
 	
 	typedef std::pair< std::string, int >			ValueSetting;
 	typedef std::map< std::string, ValueSetting >	ValueMap;
@@ -119,6 +165,15 @@ private:
 	
 	ConfigList	myCurConfigList;
 	int			myNumConflicts;
+	size_t		myNumFollowVisits;
+	size_t		myNumFollowPropagations;
+	size_t		myNumTransitions;
+	size_t		myNumReads;
+	size_t		myNumIncludes;
+	size_t		myNumClosureItems;
+	size_t		myNumPropLinks;
+	size_t		myNumSavedEntries;
+	size_t		myNumBypassed;
 	
 	Symbol *myErrSym;
 };
@@ -145,6 +200,9 @@ inline void Grammar::setQuiet( bool on_off ) { myQuiet = on_off; }
 inline bool Grammar::isStats( void ) const { return myStats; }
 inline void Grammar::setStats( bool on_off ) { myStats = on_off; }
 
+inline bool Grammar::isUseCache( void ) const { return myUseCache; }
+inline void Grammar::setUseCache( bool on_off ) { myUseCache = on_off; }
+
 
 ////////////////////////////////////////
 
@@ -158,5 +216,23 @@ Grammar::getOutputDirectory( void ) const { return myOutputDir; }
 inline LanguageDriver::Language
 Grammar::getLanguage( void ) const { return myLanguage; }
 
+inline void
+Grammar::setLookAheadMethod( LookAheadMethod method ) { myLookAheadMethod = method; }
+
+inline Grammar::LookAheadMethod
+Grammar::getLookAheadMethod( void ) const { return myLookAheadMethod; }
+
+inline void
+Grammar::setNumJobs( size_t numJobs ) { myNumJobs = numJobs; }
+
+inline size_t
+Grammar::getNumJobs( void ) const { return myNumJobs; }
+
+inline void
+Grammar::setNumShards( size_t numShards ) { myNumShards = numShards; }
+
+inline size_t
+Grammar::getNumShards( void ) const { return myNumShards; }
+
 #endif /* _Grammar_h_ */
 
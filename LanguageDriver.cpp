@@ -28,13 +28,19 @@
 #include "CPPDriver.h"
 #include "ZDriver.h"
 #include "Util.h"
+#include "Action.h"
+#include "ActionList.h"
+#include "State.h"
+#include "StateTable.h"
+#include "Symbol.h"
+#include "SymbolTable.h"
 
 
 ////////////////////////////////////////
 
 
 Producer::Producer( const Producer::ValueMap &valMap )
-		: myDebugOutput( false ), myValues( valMap )
+		: myDebugOutput( false ), myNumShards( 1 ), myValues( valMap )
 {
 }
 
@@ -122,6 +128,137 @@ Producer::getFileName( std::string &fileName, const char *ext )
 ////////////////////////////////////////
 
 
+/// Copies a rule's code block into result, indented to sit inside the
+/// generated reduce switch.  Leading blank lines are skipped (codeLine
+/// is advanced past them so the #line directive stays accurate) and
+/// trailing blanks are dropped.  Returns the number of newlines in
+/// result.
+size_t
+Producer::indentCode( const std::string	&code,
+					  int				&codeLine,
+					  std::string		&result )
+{
+	std::string::size_type pos = 0, end = code.size(), nl;
+	size_t nLines = 0;
+
+	result.clear();
+
+	while ( pos < end &&
+			( code[pos] == ' ' || code[pos] == '\t' || code[pos] == '\n' ) )
+	{
+		if ( code[pos] == '\n' )
+			++codeLine;
+		++pos;
+	}
+
+	while ( end > pos && ( code[end - 1] == ' ' || code[end - 1] == '\t' ) )
+		--end;
+
+	if ( pos == end )
+		return 0;
+
+	result.reserve( end - pos + 64 );
+	result.append( "            " );
+	while ( pos < end )
+	{
+		nl = code.find( '\n', pos );
+		if ( nl == std::string::npos || nl >= end )
+		{
+			result.append( code, pos, end - pos );
+			break;
+		}
+
+		++nl;
+		result.append( code, pos, nl - pos );
+		++nLines;
+		pos = nl;
+		if ( pos < end )
+			result.append( "        " );
+	}
+
+	return nLines;
+}
+
+
+////////////////////////////////////////
+
+
+/// Builds the goto table of the generated parsers, one column per
+/// nonterminal (counted from the first nonterminal).  A column's
+/// default is the state most of its predecessors go to; the states
+/// that go elsewhere, or explicitly nowhere (the accept on the start
+/// symbol), are its exceptions, in state order.  The error column has
+/// no default so error recovery can still tell which states shift it.
+void
+Producer::getGotoTable( std::vector< int >		&defaults,
+						std::vector< GotoList >	&exceptions )
+{
+	SymbolTable *symTab = SymbolTable::get();
+	StateTable *stateTab = StateTable::get();
+	size_t nTerm = symTab->getNumTerminals();
+	size_t nNonTerm = symTab->getNumNonTerminals();
+	size_t errCol = symTab->find( "error" )->getIndex() - nTerm;
+	size_t i, j, nState, nAct;
+	std::vector< GotoList > columns( nNonTerm );
+	
+	nState = stateTab->getNumTableStates();
+	for ( i = 0; i < nState; ++i )
+	{
+		ActionList &ap = stateTab->getNthTableState( i )->getActions();
+		
+		nAct = ap.getNumActions();
+		for ( j = 0; j < nAct; ++j )
+		{
+			Action &act = ap.getNthAction( j );
+			size_t la = act.getLookAhead();
+			int target = -1;
+			
+			if ( act.isIgnoreType() || la < nTerm || la >= nTerm + nNonTerm )
+				continue;
+			
+			if ( Action::SHIFT == act.getType() )
+				target = int( stateTab->getTableIndex( act.getState() ) );
+			columns[la - nTerm].push_back( GotoEntry( int( i ), target ) );
+		}
+	}
+	
+	defaults.assign( nNonTerm, -1 );
+	exceptions.assign( nNonTerm, GotoList() );
+	for ( i = 0; i < nNonTerm; ++i )
+	{
+		const GotoList &col = columns[i];
+		
+		if ( i != errCol )
+		{
+			std::map< int, size_t > counts;
+			size_t best = 0;
+			
+			for ( j = 0; j < col.size(); ++j )
+			{
+				if ( col[j].second < 0 )
+					continue;
+				
+				size_t n = ++counts[col[j].second];
+				if ( n > best )
+				{
+					best = n;
+					defaults[i] = col[j].second;
+				}
+			}
+		}
+		
+		for ( j = 0; j < col.size(); ++j )
+		{
+			if ( col[j].second != defaults[i] )
+				exceptions[i].push_back( col[j] );
+		}
+	}
+}
+
+
+////////////////////////////////////////
+
+
 Producer *
 LanguageDriver::getProducer( LanguageDriver::Language	 lang,
 							 const Producer::ValueMap	&valMap,
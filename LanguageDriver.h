@@ -28,6 +28,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 
 ////////////////////////////////////////
@@ -56,6 +57,11 @@ public:
 	inline void setDebugOutput( bool on_off );
 	inline bool isDebugOutput( void ) const;
 	
+	/// Number of source files to spread the rule actions over, for
+	/// drivers that support it
+	inline void setNumShards( size_t numShards );
+	inline size_t getNumShards( void ) const;
+	
 	const ValueSetting &getValue( const std::string &name ) const;
 	bool isValueSet( const std::string &name ) const;
 	
@@ -63,7 +69,17 @@ public:
 	virtual bool writeSource( void ) = 0;
 	
 protected:
+	/// A goto table exception: the state and the state it goes to,
+	/// or -1 for none
+	typedef std::pair< int, int >	GotoEntry;
+	typedef std::vector< GotoEntry >	GotoList;
+	
 	void getFileName( std::string &fileName, const char *ext );
+	static void getGotoTable( std::vector< int >		&defaults,
+							  std::vector< GotoList >	&exceptions );
+	static size_t indentCode( const std::string	&code,
+							  int				&codeLine,
+							  std::string		&result );
 	
 private:
 	std::string myOutputDir;
@@ -71,6 +87,7 @@ private:
 	std::string mySourceFile;
 	
 	bool myDebugOutput;
+	size_t myNumShards;
 	
 	ValueMap myValues;
 };
@@ -106,6 +123,10 @@ inline void
 Producer::setDebugOutput( bool on_off ) { myDebugOutput = on_off; }
 inline bool
 Producer::isDebugOutput( void ) const { return myDebugOutput; }
+inline void
+Producer::setNumShards( size_t numShards ) { myNumShards = numShards; }
+inline size_t
+Producer::getNumShards( void ) const { return myNumShards; }
 
 #endif /* _LanguageDriver_h_ */
 
@@ -0,0 +1,421 @@
+/// @file LookAheadGraph.cpp
+/// @brief Implements the DeRemer-Pennello LALR(1) lookahead engine.
+///
+///
+
+//
+// 
+// Copyright  2003-2013 Kimball Thurston
+// 
+// This program is free software; you can redisribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+// 
+//
+
+#include <algorithm>
+
+#include "LookAheadGraph.h"
+#include "StateTable.h"
+#include "State.h"
+#include "Config.h"
+#include "Rule.h"
+#include "RuleTable.h"
+#include "Symbol.h"
+#include "SymbolTable.h"
+
+
+////////////////////////////////////////
+
+
+static const size_t NONE = size_t( -1 );
+
+
+////////////////////////////////////////
+
+
+class edgeSymComp
+{
+public:
+	template <typename T>
+	bool operator()( const T &a, const T &b ) const
+	{
+		return a.sym < b.sym;
+	}
+};
+
+
+////////////////////////////////////////
+
+
+class lookBackComp
+{
+public:
+	template <typename T>
+	bool operator()( const T &a, const T &b ) const
+	{
+		if ( a.state != b.state )
+			return a.state < b.state;
+		return a.rule < b.rule;
+	}
+};
+
+
+////////////////////////////////////////
+
+
+LookAheadGraph::LookAheadGraph( void )
+		: myNumReads( 0 ), myNumIncludes( 0 )
+{
+}
+
+
+////////////////////////////////////////
+
+
+LookAheadGraph::~LookAheadGraph( void )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void
+LookAheadGraph::compute( size_t startSymIdx )
+{
+	buildGotos();
+	buildTransitions( startSymIdx );
+	buildRelations();
+	
+	// Read(p,A) = DR(p,A) + U{ Read(r,C) | (p,A) reads (r,C) }
+	digraph( myReads, myFollows );
+	myReads.clear();
+	
+	// Follow(p,A) = Read(p,A) + U{ Follow(p',B) | (p,A) includes (p',B) }
+	digraph( myIncludes, myFollows );
+	myIncludes.clear();
+	
+	applyLookBacks();
+}
+
+
+////////////////////////////////////////
+
+
+void
+LookAheadGraph::buildGotos( void )
+{
+	StateTable *stateTable = StateTable::get();
+	size_t i, j, N;
+	
+	N = stateTable->getNumStates();
+	myGotos.clear();
+	myGotoStart.assign( N + 1, 0 );
+	
+	for ( i = 0; i < N; ++i )
+	{
+		const ActionList &ap = stateTable->getNthState( i )->getActions();
+		size_t nAct = ap.getNumActions();
+		
+		myGotoStart[i] = myGotos.size();
+		for ( j = 0; j < nAct; ++j )
+		{
+			const Action &act = ap.getNthAction( j );
+			if ( act.getType() != Action::SHIFT )
+				continue;
+			
+			Edge e;
+			e.sym = act.getLookAhead();
+			e.target = size_t( act.getState()->getStateIndex() );
+			myGotos.push_back( e );
+		}
+		
+		std::sort( myGotos.begin() + long( myGotoStart[i] ), myGotos.end(),
+				   edgeSymComp() );
+	}
+	myGotoStart[N] = myGotos.size();
+}
+
+
+////////////////////////////////////////
+
+
+size_t
+LookAheadGraph::findGoto( size_t state, size_t sym ) const
+{
+	Edge key;
+	key.sym = sym;
+	key.target = 0;
+	
+	EdgeList::const_iterator b = myGotos.begin() + long( myGotoStart[state] );
+	EdgeList::const_iterator e = myGotos.begin() + long( myGotoStart[state + 1] );
+	EdgeList::const_iterator i = std::lower_bound( b, e, key, edgeSymComp() );
+	
+	if ( i != e && (*i).sym == sym )
+		return size_t( i - myGotos.begin() );
+	
+	return NONE;
+}
+
+
+////////////////////////////////////////
+
+
+size_t
+LookAheadGraph::findTransition( size_t state, size_t sym ) const
+{
+	size_t g = findGoto( state, sym );
+	
+	return ( g == NONE ) ? NONE : myGotoTrans[g];
+}
+
+
+////////////////////////////////////////
+
+
+void
+LookAheadGraph::buildTransitions( size_t startSymIdx )
+{
+	SymbolTable *symTable = SymbolTable::get();
+	size_t i, j, N;
+	
+	myTransFrom.clear();
+	myTransSym.clear();
+	myGotoTrans.assign( myGotos.size(), NONE );
+	
+	N = myGotoStart.size() - 1;
+	for ( i = 0; i < N; ++i )
+	{
+		for ( j = myGotoStart[i]; j < myGotoStart[i + 1]; ++j )
+		{
+			if ( Symbol::TERMINAL == symTable->getNthSymbol( myGotos[j].sym )->getType() )
+				continue;
+			
+			myGotoTrans[j] = myTransFrom.size();
+			myTransFrom.push_back( i );
+			myTransSym.push_back( myGotos[j].sym );
+		}
+	}
+	
+	// The start rules are only reduced on the end of input.  That is
+	// the (0, start) transition of the augmented grammar, which has no
+	// goto edge unless the start symbol also shows up on a right hand side.
+	size_t startTrans = findTransition( 0, startSymIdx );
+	if ( startTrans == NONE )
+	{
+		startTrans = myTransFrom.size();
+		myTransFrom.push_back( 0 );
+		myTransSym.push_back( startSymIdx );
+	}
+	
+	N = myTransFrom.size();
+	myFollows.assign( N, FollowSet() );
+	myReads.assign( N, IndexList() );
+	myIncludes.assign( N, IndexList() );
+	myNumReads = 0;
+	myNumIncludes = 0;
+	
+	// Symbol 0 is always the end of input marker "$"
+	myFollows[startTrans].add( 0 );
+}
+
+
+////////////////////////////////////////
+
+
+void
+LookAheadGraph::buildRelations( void )
+{
+	SymbolTable *symTable = SymbolTable::get();
+	RuleTable *ruleTable = RuleTable::get();
+	std::vector< bool > nullSuffix;
+	size_t t, j, N;
+	
+	myLookBacks.clear();
+	
+	N = myTransFrom.size();
+	for ( t = 0; t < N; ++t )
+	{
+		size_t g = findGoto( myTransFrom[t], myTransSym[t] );
+		
+		// DR(p,A) are the terminals shifted after the goto on A, and
+		// (p,A) reads (r,C) for every nullable C that can follow
+		if ( g != NONE )
+		{
+			size_t r = myGotos[g].target;
+			for ( j = myGotoStart[r]; j < myGotoStart[r + 1]; ++j )
+			{
+				Symbol *sp = symTable->getNthSymbol( myGotos[j].sym );
+				
+				if ( Symbol::TERMINAL == sp->getType() )
+					myFollows[t].add( myGotos[j].sym );
+				else if ( sp->isLambda() )
+				{
+					myReads[t].push_back( myGotoTrans[j] );
+					++myNumReads;
+				}
+			}
+		}
+		
+		// Walk every rule B ::= X1..Xn of the transition (p',B).  For
+		// each nonterminal Xi followed by a nullable tail, (p_i,Xi)
+		// includes (p',B).  The state reached at the end looks back
+		// on (p',B).
+		RuleTable::RuleSpanIter ri, re;
+		ruleTable->getRules( myTransSym[t], ri, re );
+		
+		for ( ; ri != re; ++ri )
+		{
+			Rule *rp = *ri;
+			const Rule::SymbolList &rhs = rp->getRHSSymbols();
+			size_t i, nRHS = rhs.size();
+			
+			nullSuffix.assign( nRHS + 1, true );
+			for ( i = nRHS; i > 0; --i )
+			{
+				nullSuffix[i - 1] = nullSuffix[i] &&
+					symTable->getNthSymbol( rhs[i - 1] )->isLambda();
+			}
+			
+			size_t state = myTransFrom[t];
+			for ( i = 0; i < nRHS && state != NONE; ++i )
+			{
+				Symbol *sp = symTable->getNthSymbol( rhs[i] );
+				
+				if ( Symbol::TERMINAL != sp->getType() && nullSuffix[i + 1] )
+				{
+					size_t from = findTransition( state, rhs[i] );
+					if ( from != NONE )
+					{
+						myIncludes[from].push_back( t );
+						++myNumIncludes;
+					}
+				}
+				
+				g = findGoto( state, rhs[i] );
+				state = ( g == NONE ) ? NONE : myGotos[g].target;
+			}
+			
+			if ( state != NONE )
+			{
+				LookBack lb;
+				lb.state = state;
+				lb.rule = rp->getRuleIndex();
+				lb.trans = t;
+				myLookBacks.push_back( lb );
+			}
+		}
+	}
+}
+
+
+////////////////////////////////////////
+
+
+void
+LookAheadGraph::applyLookBacks( void )
+{
+	StateTable *stateTable = StateTable::get();
+	LookBackList::const_iterator b, e, i;
+	
+	std::sort( myLookBacks.begin(), myLookBacks.end(), lookBackComp() );
+	
+	b = myLookBacks.begin();
+	e = myLookBacks.end();
+	while ( b != e )
+	{
+		State *stp = stateTable->getNthState( (*b).state );
+		
+		// Lookbacks of a state are contiguous, pair them up with the
+		// reducible configs of the state
+		for ( i = b; i != e && (*i).state == (*b).state; ++i )
+		{
+			for ( Config *cfp = stp->getConfig(); cfp; cfp = cfp->getNext() )
+			{
+				Rule *rp = cfp->getRule();
+				
+				if ( rp->getRuleIndex() == (*i).rule &&
+					 size_t( cfp->getDot() ) == rp->getRHSSize() )
+				{
+					cfp->combineFollowSet( myFollows[(*i).trans] );
+					break;
+				}
+			}
+		}
+		
+		b = i;
+	}
+}
+
+
+////////////////////////////////////////
+
+
+void
+LookAheadGraph::digraph( const Relation &rel, SetList &sets )
+{
+	size_t x, N;
+	
+	N = sets.size();
+	myDepth.assign( N, 0 );
+	myStack.clear();
+	
+	for ( x = 0; x < N; ++x )
+	{
+		if ( myDepth[x] == 0 )
+			traverse( x, rel, sets );
+	}
+}
+
+
+////////////////////////////////////////
+
+
+/// Tarjan style traversal, every member of a strongly connected
+/// component ends up with the same set.
+void
+LookAheadGraph::traverse( size_t x, const Relation &rel, SetList &sets )
+{
+	myStack.push_back( x );
+	size_t d = myStack.size();
+	myDepth[x] = d;
+	
+	const IndexList &edges = rel[x];
+	IndexList::const_iterator i, e;
+	
+	for ( i = edges.begin(), e = edges.end(); i != e; ++i )
+	{
+		size_t y = *i;
+		
+		if ( myDepth[y] == 0 )
+			traverse( y, rel, sets );
+		
+		myDepth[x] = std::min( myDepth[x], myDepth[y] );
+		sets[x].combine( sets[y] );
+	}
+	
+	if ( myDepth[x] == d )
+	{
+		size_t top;
+		
+		do
+		{
+			top = myStack.back();
+			myStack.pop_back();
+			myDepth[top] = NONE;
+			if ( top != x )
+				sets[top] = sets[x];
+		} while ( top != x );
+	}
+}
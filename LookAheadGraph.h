@@ -0,0 +1,124 @@
+/// @file LookAheadGraph.h
+/// @brief Header file for the DeRemer-Pennello LALR(1) lookahead engine.
+///
+///
+
+//
+// 
+// Copyright  2003-2013 Kimball Thurston
+// 
+// This program is free software; you can redisribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+// 
+//
+
+#ifndef _LookAheadGraph_h_
+#define _LookAheadGraph_h_
+
+#include <vector>
+#include <cstddef>
+
+#include "FollowSet.h"
+
+class State;
+
+
+////////////////////////////////////////
+
+
+/// Computes the LALR(1) lookaheads of the reduce configurations from
+/// the LR(0) automaton using the DeRemer-Pennello relations (reads,
+/// includes and lookback) over the nonterminal transitions.  Unlike
+/// the propagation links, follow sets only end up on the configs with
+/// the dot at the extreme right.
+class LookAheadGraph
+{
+public:
+	LookAheadGraph( void );
+	~LookAheadGraph( void );
+	
+	/// Fills in the follow sets of every reducible config.  Expects the
+	/// LR(0) states to be built with only their SHIFT actions added.
+	void compute( size_t startSymIdx );
+	
+	inline size_t getNumTransitions( void ) const;
+	inline size_t getNumReads( void ) const;
+	inline size_t getNumIncludes( void ) const;
+	inline size_t getNumLookBacks( void ) const;
+	
+private:
+	typedef std::vector< size_t >	IndexList;
+	typedef std::vector< IndexList >	Relation;
+	typedef std::vector< FollowSet >	SetList;
+	
+	struct Edge
+	{
+		size_t sym;
+		size_t target;
+	};
+	typedef std::vector< Edge >	EdgeList;
+	
+	struct LookBack
+	{
+		size_t state;
+		size_t rule;
+		size_t trans;
+	};
+	typedef std::vector< LookBack >	LookBackList;
+	
+	void buildGotos( void );
+	size_t findGoto( size_t state, size_t sym ) const;
+	size_t findTransition( size_t state, size_t sym ) const;
+	
+	void buildTransitions( size_t startSymIdx );
+	void buildRelations( void );
+	void applyLookBacks( void );
+	
+	void digraph( const Relation &rel, SetList &sets );
+	void traverse( size_t x, const Relation &rel, SetList &sets );
+	
+	// SHIFT edges of every state, sorted by symbol, state i owns
+	// [myGotoStart[i], myGotoStart[i+1])
+	EdgeList	myGotos;
+	IndexList	myGotoStart;
+	
+	// Nonterminal transitions (from, sym), with the transition index
+	// of each goto edge stored in parallel to myGotos
+	IndexList	myTransFrom;
+	IndexList	myTransSym;
+	IndexList	myGotoTrans;
+	
+	Relation	myReads;
+	Relation	myIncludes;
+	LookBackList myLookBacks;
+	SetList		myFollows;
+	
+	// digraph() scratch
+	IndexList	myDepth;
+	IndexList	myStack;
+	
+	size_t		myNumReads;
+	size_t		myNumIncludes;
+};
+
+
+////////////////////////////////////////
+
+
+inline size_t LookAheadGraph::getNumTransitions( void ) const { return myTransFrom.size(); }
+inline size_t LookAheadGraph::getNumReads( void ) const { return myNumReads; }
+inline size_t LookAheadGraph::getNumIncludes( void ) const { return myNumIncludes; }
+inline size_t LookAheadGraph::getNumLookBacks( void ) const { return myLookBacks.size(); }
+
+#endif /* _LookAheadGraph_h_ */
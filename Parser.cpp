@@ -36,8 +36,60 @@
 ////////////////////////////////////////
 
 
+const Parser::DirectiveInfo Parser::theDirectives[DIR_UNKNOWN] =
+{
+	{ "name", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "namespace", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "header_include", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "include", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "code", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "token_destructor", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "token_prefix", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "syntax_error", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "parse_accept", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "parse_failure", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "stack_overflow", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "extra_argument", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "token_type", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "stack_size", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "start_symbol", WAITING_FOR_DECL_ARG, Symbol::UNKNOWN, true },
+	{ "left", WAITING_FOR_PRECEDENCE_SYMBOL, Symbol::LEFT, false },
+	{ "right", WAITING_FOR_PRECEDENCE_SYMBOL, Symbol::RIGHT, false },
+	{ "nonassoc", WAITING_FOR_PRECEDENCE_SYMBOL, Symbol::NONE, false },
+	{ "destructor", WAITING_FOR_DESTRUCTOR_SYMBOL, Symbol::UNKNOWN, true },
+	{ "type", WAITING_FOR_DATATYPE_SYMBOL, Symbol::UNKNOWN, true }
+};
+
+// Perfect hash of the directive names: slot
+// ( length + 2 * first char + last char ) % 64 holds the only
+// directive that can match.  Regenerate it when adding a directive.
+const Parser::Directive Parser::theDirectiveSlots[64] =
+{
+	DIR_UNKNOWN, DIR_UNKNOWN, DIR_UNKNOWN, DIR_HEADER_INCLUDE,
+	DIR_DESTRUCTOR, DIR_NAME, DIR_UNKNOWN, DIR_NONASSOC,
+	DIR_UNKNOWN, DIR_UNKNOWN, DIR_NAMESPACE, DIR_UNKNOWN,
+	DIR_EXTRA_ARGUMENT, DIR_UNKNOWN, DIR_UNKNOWN, DIR_UNKNOWN,
+	DIR_LEFT, DIR_TYPE, DIR_PARSE_FAILURE, DIR_UNKNOWN,
+	DIR_UNKNOWN, DIR_STACK_SIZE, DIR_UNKNOWN, DIR_TOKEN_TYPE,
+	DIR_UNKNOWN, DIR_UNKNOWN, DIR_UNKNOWN, DIR_UNKNOWN,
+	DIR_UNKNOWN, DIR_RIGHT, DIR_START_SYMBOL, DIR_UNKNOWN,
+	DIR_PARSE_ACCEPT, DIR_UNKNOWN, DIR_UNKNOWN, DIR_UNKNOWN,
+	DIR_SYNTAX_ERROR, DIR_UNKNOWN, DIR_UNKNOWN, DIR_UNKNOWN,
+	DIR_UNKNOWN, DIR_UNKNOWN, DIR_TOKEN_DESTRUCTOR, DIR_STACK_OVERFLOW,
+	DIR_TOKEN_PREFIX, DIR_UNKNOWN, DIR_UNKNOWN, DIR_CODE,
+	DIR_UNKNOWN, DIR_UNKNOWN, DIR_UNKNOWN, DIR_UNKNOWN,
+	DIR_UNKNOWN, DIR_UNKNOWN, DIR_UNKNOWN, DIR_UNKNOWN,
+	DIR_UNKNOWN, DIR_UNKNOWN, DIR_UNKNOWN, DIR_UNKNOWN,
+	DIR_UNKNOWN, DIR_UNKNOWN, DIR_INCLUDE, DIR_UNKNOWN
+};
+
+
+////////////////////////////////////////
+
+
 Parser::Parser( void )
-		: myErrCount( 0 ), myPrevRule( 0 ), myCurGrammar( 0 )
+		: myErrCount( 0 ), myCurDirective( DIR_UNKNOWN ), myPrevRule( 0 ),
+		  myCurGrammar( 0 )
 {
 }
 
@@ -63,10 +115,31 @@ Parser::setSourceFile( const std::string &sourceFile )
 ////////////////////////////////////////
 
 
+Parser::Directive
+Parser::findDirective( const Util::StringRef &token )
+{
+	if ( token.empty() )
+		return DIR_UNKNOWN;
+	
+	size_t h = token.size() +
+		2 * size_t( static_cast< unsigned char >( token[0] ) ) +
+		size_t( static_cast< unsigned char >( token[token.size() - 1] ) );
+	Directive dir = theDirectiveSlots[h % 64];
+	
+	if ( dir != DIR_UNKNOWN && token != theDirectives[dir].name )
+		dir = DIR_UNKNOWN;
+	
+	return dir;
+}
+
+
+////////////////////////////////////////
+
+
 // Skip C++ comments to end of line
 static void
-skipCPPComment( std::string::iterator &curP,
-				std::string::iterator  endP )
+skipCPPComment( const char	*&curP,
+				const char	 *endP )
 {
 	curP += 2;
 	while ( curP != endP && *curP != '\n' )
@@ -78,9 +151,9 @@ skipCPPComment( std::string::iterator &curP,
 
 
 static void
-skipCComment( std::string::iterator &curP,
-			  int					&curLine,
-			  std::string::iterator	 endP )
+skipCComment( const char	*&curP,
+			  int			 &curLine,
+			  const char	 *endP )
 {
 	// Skip C comment. Little tricker than C++... :/
 	int curNest = 1;
@@ -108,6 +181,8 @@ skipCComment( std::string::iterator &curP,
 				++curNest;
 				curP += 2;
 			}
+			else
+				++curP;
 		}
 		else
 		{
@@ -126,10 +201,10 @@ skipCComment( std::string::iterator &curP,
 
 
 static void
-skipStringLiteral( std::string::iterator	&curP,
-				   int						&curLine,
-				   std::string::iterator	 endP,
-				   char						 startChar = '\"' )
+skipStringLiteral( const char	*&curP,
+				   int			 &curLine,
+				   const char	 *endP,
+				   char			  startChar = '\"' )
 {
 	++curP;
 	while ( curP != endP )
@@ -165,9 +240,9 @@ Parser::parse( Grammar *grammar )
 	if ( slurpFile() )
 	{
 		int						 curLine = 1;
-		std::string::iterator	 curP = mySourceData.begin();
-		std::string::iterator	 endP = mySourceData.end();
-		std::string				 curToken;
+		const char				*curP = mySource.begin();
+		const char				*endP = mySource.end();
+		Util::StringRef			 curToken;
 		int						 tsLine = 0;
 		
 		myCurState = INITIALIZE;
@@ -202,13 +277,13 @@ Parser::parse( Grammar *grammar )
 				}
 			}
 			
-			curToken.clear();
+			curToken = Util::StringRef();
 			tsLine = curLine;
 			
 			// String literal
 			if ( *curP == '\"' )
 			{
-				std::string::iterator	 strStart = curP;
+				const char				*strStart = curP;
 				
 				skipStringLiteral( curP, curLine, endP );
 				
@@ -218,14 +293,12 @@ Parser::parse( Grammar *grammar )
 									   "String literal not terminated." );
 				}
 				else
-					curToken = mySourceData.substr(
-						strStart - mySourceData.begin(),
-						curP - strStart );
+					curToken = Util::StringRef( strStart, curP );
 			}
 			else if ( *curP == '{' ) // chunk of code
 			{
 				int						 nestLevel = 1;
-				std::string::iterator	 codeStart = curP;
+				const char				*codeStart = curP;
 				
 				++curP;
 				while ( curP != endP )
@@ -276,27 +349,24 @@ Parser::parse( Grammar *grammar )
 									   "Code block starting here is not terminated" );
 				}
 				else
-					curToken = mySourceData.substr(
-						codeStart - mySourceData.begin(),
-						curP - codeStart );
+					curToken = Util::StringRef( codeStart, curP );
 			}
 			else if ( isalnum( *curP ) )
 			{
-				curToken.push_back( *curP );
+				const char *idStart = curP;
+				
 				++curP;
 				while ( curP != endP &&
 						( isalnum( *curP ) || *curP == '_' || *curP == ':' ) )
-				{
-					curToken.push_back( *curP );
 					++curP;
-				}
+				curToken = Util::StringRef( idStart, curP );
 			}
 			else if ( curP < ( endP - 2 ) &&
 					  *curP == ':' &&
 					  *(curP + 1) == ':' &&
 					  *(curP + 2) == '=' ) // operator ::=
 			{
-				curToken = "::=";
+				curToken = Util::StringRef( curP, curP + 3 );
 				curP += 3;
 			}
 			else if ( curP < ( endP - 2 ) &&
@@ -304,18 +374,17 @@ Parser::parse( Grammar *grammar )
 					  *(curP + 1) == ':' &&
 					  isalpha( *(curP + 2) ) ) // global namespace tag
 			{
-				curToken.push_back( *curP );
+				const char *idStart = curP;
+				
 				++curP;
 				while ( curP != endP &&
 						( isalnum( *curP ) || *curP == '_' || *curP == ':' ) )
-				{
-					curToken.push_back( *curP );
 					++curP;
-				}
+				curToken = Util::StringRef( idStart, curP );
 			}
 			else // remaining single char tokens
 			{
-				curToken.push_back( *curP );
+				curToken = Util::StringRef( curP, curP + 1 );
 				++curP;
 			}
 			
@@ -332,10 +401,10 @@ Parser::parse( Grammar *grammar )
 
 
 void
-Parser::handleNextToken( int tsLine, const std::string &token )
+Parser::handleNextToken( int tsLine, const Util::StringRef &token )
 {
 //	std::printf( "Token line %d: '%s' curState: %d\n",
-//				 tsLine, token.c_str(), int( myCurState ) );
+//				 tsLine, token.str().c_str(), int( myCurState ) );
 	
 	switch ( myCurState )
 	{
@@ -352,8 +421,8 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			}
 			else if ( islower( token[0] ) )
 			{
-				SymbolTable::get()->findOrCreate( token );
-				myCurLHS = token;
+				myCurLHS = token.str();
+				SymbolTable::get()->findOrCreate( myCurLHS );
 				myCurLHSAlias.clear();
 				myCurRHS.clear();
 				
@@ -365,9 +434,9 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 				{
 					if ( myPrevRule->getCode().empty() )
 					{
-						std::string tmpVal = token;
-						chompString( tmpVal );
-						myPrevRule->setCode( tsLine, tmpVal );
+						Util::StringRef code = token;
+						chompString( code );
+						myPrevRule->setCode( tsLine, code );
 					}
 					else
 						Error::get()->add( tsLine,
@@ -385,7 +454,7 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			{
 				Error::get()->add( tsLine,
 								   "Token '%s' should be either \"%%\" or a nonterminal name.",
-								   token.c_str() );
+								   token.str().c_str() );
 			}
 			break;
 			
@@ -399,8 +468,9 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			{
 				if ( myPrevRule->getPrecedence().empty() )
 				{
-					SymbolTable::get()->findOrCreate( token );
-					myPrevRule->setPrecedence( token );
+					std::string precName = token.str();
+					SymbolTable::get()->findOrCreate( precName );
+					myPrevRule->setPrecedence( precName );
 				}
 				else
 					Error::get()->add( tsLine,
@@ -410,7 +480,7 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			else
 				Error::get()->add( tsLine,
 								   "There is no prior rule to assign precedence '[%s]'.",
-								   token.c_str() );
+								   token.str().c_str() );
 			
 			myCurState = PRECEDENCE_MARK_2;
 			break;
@@ -439,14 +509,14 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 		case LHS_ALIAS_1:
 			if ( isalpha( token[0] ) )
 			{
-				myCurLHSAlias = token;
+				myCurLHSAlias = token.str();
 				myCurState = LHS_ALIAS_2;
 			}
 			else
 			{
 				Error::get()->add( tsLine,
 								   "'%s' is not a valid alias for the LHS '%s'.",
-								   token.c_str(), myCurLHS.c_str() );
+								   token.str().c_str(), myCurLHS.c_str() );
 				myCurState = RESYNC_AFTER_RULE_ERROR;
 			}
 			break;
@@ -499,8 +569,9 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			}
 			else if ( isalpha( token[0] ) )
 			{
-				SymbolTable::get()->findOrCreate( token );
-				myCurRHS.push_back( Rule::RHSEntry( token, std::string() ) );
+				std::string name = token.str();
+				SymbolTable::get()->findOrCreate( name );
+				myCurRHS.push_back( Rule::RHSEntry( name, std::string() ) );
 			}
 			else if ( token[0] == '(' && ! myCurRHS.empty() )
 				myCurState = RHS_ALIAS_1;
@@ -508,7 +579,7 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			{
 				Error::get()->add( tsLine,
 								   "Illegal identifier in RHS of rule: '%s'.",
-								   token.c_str() );
+								   token.str().c_str() );
 				myCurState = RESYNC_AFTER_RULE_ERROR;
 			}
 			break;
@@ -516,14 +587,14 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 		case RHS_ALIAS_1:
 			if ( isalpha( token[0] ) )
 			{
-				myCurRHS.back().second = token;
+				myCurRHS.back().second = token.str();
 				myCurState = RHS_ALIAS_2;
 			}
 			else
 			{
 				Error::get()->add( tsLine,
 								   "'%s' is not a valid alias for RHS symbol '%s'.",
-								   token.c_str(),
+								   token.str().c_str(),
 								   myCurRHS.back().first.c_str() );
 				myCurState = RESYNC_AFTER_RULE_ERROR;
 			}
@@ -544,63 +615,33 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 		case WAITING_FOR_DECL_KEYWORD:
 			if ( isalpha( token[0] ) )
 			{
-				if ( token == "name" ||
-					 token == "namespace" ||
-					 token == "header_include" ||
-					 token == "include" ||
-					 token == "code" ||
-					 token == "token_destructor" ||
-					 token == "token_prefix" ||
-					 token == "syntax_error" ||
-					 token == "parse_accept" ||
-					 token == "parse_failure" ||
-					 token == "stack_overflow" ||
-					 token == "extra_argument" ||
-					 token == "token_type" ||
-					 token == "stack_size" ||
-					 token == "start_symbol" )
+				myCurDirective = findDirective( token );
+				if ( myCurDirective != DIR_UNKNOWN )
 				{
-					myCurDeclKey = token;
-					myCurState = WAITING_FOR_DECL_ARG;
-				}
-				else if ( token == "left" )
-				{
-					++myCurPrecCounter;
-					myCurDeclAssoc = Symbol::LEFT;
-					myCurState = WAITING_FOR_PRECEDENCE_SYMBOL;
-				}
-				else if ( token == "right" )
-				{
-					++myCurPrecCounter;
-					myCurDeclAssoc = Symbol::RIGHT;
-					myCurState = WAITING_FOR_PRECEDENCE_SYMBOL;
-				}
-				else if ( token == "nonassoc" )
-				{
-					++myCurPrecCounter;
-					myCurDeclAssoc = Symbol::NONE;
-					myCurState = WAITING_FOR_PRECEDENCE_SYMBOL;
-				}
-				else if ( token == "destructor" )
-				{
-					myCurState = WAITING_FOR_DESTRUCTOR_SYMBOL;
-				}
-				else if ( token == "type" )
-				{
-					myCurState = WAITING_FOR_DATATYPE_SYMBOL;
+					const DirectiveInfo &info = theDirectives[myCurDirective];
+					
+					if ( info.assoc != Symbol::UNKNOWN )
+					{
+						++myCurPrecCounter;
+						myCurDeclAssoc = info.assoc;
+					}
+					else if ( info.argState == WAITING_FOR_DECL_ARG )
+						myCurDeclKey = info.name;
+					
+					myCurState = info.argState;
 				}
 				else
 				{
 					Error::get()->add( tsLine,
 									   "Unknown declaration name '%s'.",
-									   token.c_str() );
+									   token.str().c_str() );
 					myCurState = RESYNC_AFTER_DECL_ERROR;
 				}
 			}
 			else
 			{
 				Error::get()->add( tsLine, "Invalid declaration symbol '%s'.",
-								   token.c_str() );
+								   token.str().c_str() );
 				myCurState = RESYNC_AFTER_DECL_ERROR;
 			}
 			break;
@@ -608,8 +649,8 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 		case WAITING_FOR_DESTRUCTOR_SYMBOL:
 			if ( isalpha( token[0] ) )
 			{
-				SymbolTable::get()->findOrCreate( token );
-				myCurDeclKey = token;
+				myCurDeclKey = token.str();
+				SymbolTable::get()->findOrCreate( myCurDeclKey );
 				myCurState = WAITING_FOR_DESTRUCTOR_DECL;
 			}
 			else
@@ -625,12 +666,13 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			{
 				Symbol *destSym = SymbolTable::get()->findOrCreate( myCurDeclKey );
 				
-				if ( destSym->getDestructor().empty() )
+				if ( destSym->getDestructor().empty() ||
+					 ! theDirectives[myCurDirective].once )
 				{
-					std::string tmpVal = token;
+					Util::StringRef tmpVal = token;
 					chompString( tmpVal, true );
 					
-					destSym->setDestructor( tmpVal );
+					destSym->setDestructor( tmpVal.str() );
 					destSym->setDestructorLine( tsLine );
 					myCurState = WAITING_FOR_DECL_OR_RULE;
 				}
@@ -646,7 +688,7 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			{
 				Error::get()->add( tsLine,
 								   "Illegal argument to destructor declaration for '%s': '%s'.",
-								   myCurDeclKey.c_str(), token.c_str() );
+								   myCurDeclKey.c_str(), token.str().c_str() );
 				myCurState = RESYNC_AFTER_DECL_ERROR;
 			}
 			break;
@@ -654,8 +696,8 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 		case WAITING_FOR_DATATYPE_SYMBOL:
 			if ( isalpha( token[0] ) )
 			{
-				SymbolTable::get()->findOrCreate( token );
-				myCurDeclKey = token;
+				myCurDeclKey = token.str();
+				SymbolTable::get()->findOrCreate( myCurDeclKey );
 				myCurState = WAITING_FOR_DATATYPE_DECL;
 			}
 			else
@@ -671,12 +713,13 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			{
 				Symbol *destSym = SymbolTable::get()->findOrCreate( myCurDeclKey );
 				
-				if ( destSym->getDataType().empty() )
+				if ( destSym->getDataType().empty() ||
+					 ! theDirectives[myCurDirective].once )
 				{
-					std::string tmpVal = token;
+					Util::StringRef tmpVal = token;
 					chompString( tmpVal, true );
 					
-					destSym->setDataType( tmpVal );
+					destSym->setDataType( tmpVal.str() );
 
 					myCurState = WAITING_FOR_DECL_OR_RULE;
 				}
@@ -692,7 +735,7 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			{
 				Error::get()->add( tsLine,
 								   "Illegal argument to data type declaration for '%s': '%s'.",
-								   myCurDeclKey.c_str(), token.c_str() );
+								   myCurDeclKey.c_str(), token.str().c_str() );
 				myCurState = RESYNC_AFTER_DECL_ERROR;
 			}
 			break;
@@ -704,7 +747,7 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			}
 			else if ( isupper( token[0] ) )
 			{
-				Symbol *precSym = SymbolTable::get()->findOrCreate( token );
+				Symbol *precSym = SymbolTable::get()->findOrCreate( token.str() );
 				
 				if ( precSym->getPrecedence() == -1 )
 				{
@@ -720,16 +763,17 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			}
 			else
 				Error::get()->add( tsLine, "Unable to assign a precedence to '%s'.",
-								   token.c_str() );
+								   token.str().c_str() );
 			break;
 			
 		case WAITING_FOR_DECL_ARG:
 			if ( token[0] == '{' || token[0] == '\"' || isalnum( token[0] ) )
 			{
-				std::string tmpVal = token;
+				Util::StringRef tmpVal = token;
 				chompString( tmpVal, true );
-				if ( myCurGrammar->setValue( myCurDeclKey, tmpVal,
-											 tsLine ) )
+				if ( myCurGrammar->setValue( myCurDeclKey, tmpVal.str(),
+											 tsLine ) ||
+					 ! theDirectives[myCurDirective].once )
 				{
 					myCurState = WAITING_FOR_DECL_OR_RULE;
 				}
@@ -744,7 +788,7 @@ Parser::handleNextToken( int tsLine, const std::string &token )
 			{
 				Error::get()->add( tsLine,
 								   "Illegal argument to value setting for '%s': '%s'.",
-								   myCurDeclKey.c_str(), token.c_str() );
+								   myCurDeclKey.c_str(), token.str().c_str() );
 				myCurState = RESYNC_AFTER_DECL_ERROR;
 			}
 			break;
@@ -773,35 +817,10 @@ Parser::slurpFile( void )
 {
 	bool retval = false;
 	
-	FILE *input = std::fopen( mySourceFile.c_str(), "rb" );
-	
-	if ( input )
+	if ( mySource.open( mySourceFile ) )
 	{
-		size_t fileSize = 0;
-		
-		if ( 0 == std::fseek( input, 0, SEEK_END ) )
-		{
-			fileSize = std::ftell( input );
-			rewind( input );
-		}
-		
-		if ( fileSize > 0 )
-		{
-			char *fileData = new char[ fileSize + 1 ];
-			
-			if ( fileSize == std::fread( fileData, 1,
-										 fileSize, input ) )
-			{
-				fileData[fileSize] = '\0';
-				mySourceData = fileData;
-				retval = true;
-			}
-			else
-				Error::get()->add( "Unable to read %ld bytes from file",
-								   fileSize );
-			
-			delete [] fileData;
-		}
+		if ( mySource.size() > 0 )
+			retval = true;
 		else
 			Error::get()->add( "File is empty" );
 	}
@@ -816,40 +835,32 @@ Parser::slurpFile( void )
 
 
 void
-Parser::chompString( std::string &str, bool innerWhite )
+Parser::chompString( Util::StringRef &str, bool innerWhite )
 {
-	while ( str[0] == ' ' || str[0] == '\t' )
-		str.erase( str.begin() );
-	if ( str[0] == '{' )
+	while ( ! str.empty() && ( str[0] == ' ' || str[0] == '\t' ) )
+		str.dropFront( 1 );
+	if ( ! str.empty() && ( str[0] == '{' || str[0] == '"' ) )
 	{
-		str.erase( str.begin() );
-		
-		while ( str[str.size() - 1] == ' ' ||
-				str[str.size() - 1] == '\t' )
-			str.erase( str.end() - 1 );
+		char closeChar = str[0] == '{' ? '}' : '"';
 		
-		if ( str[str.size() - 1] == '}' )
-			str.erase( str.end() - 1 );
-	}
-	else if ( str[0] == '"' )
-	{
-		str.erase( str.begin() );
+		str.dropFront( 1 );
 		
-		while ( str[str.size() - 1] == ' ' ||
-				str[str.size() - 1] == '\t' )
-			str.erase( str.end() - 1 );
+		while ( ! str.empty() &&
+				( str[str.size() - 1] == ' ' ||
+				  str[str.size() - 1] == '\t' ) )
+			str.dropBack( 1 );
 		
-		if ( str[str.size() - 1] == '"' )
-			str.erase( str.end() - 1 );
+		if ( ! str.empty() && str[str.size() - 1] == closeChar )
+			str.dropBack( 1 );
 	}
 	
 	if ( innerWhite )
 	{
-		while ( str[0] == ' ' || str[0] == '\t' )
-			str.erase( str.begin() );
-		while ( str[str.size() - 1] == ' ' ||
-				str[str.size() - 1] == '\t' )
-			str.erase( str.end() - 1 );
+		while ( ! str.empty() && ( str[0] == ' ' || str[0] == '\t' ) )
+			str.dropFront( 1 );
+		while ( ! str.empty() &&
+				( str[str.size() - 1] == ' ' ||
+				  str[str.size() - 1] == '\t' ) )
+			str.dropBack( 1 );
 	}
 }
-
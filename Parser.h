@@ -29,6 +29,7 @@
 #include <string>
 #include "Symbol.h"
 #include "Rule.h"
+#include "Util.h"
 
 ////////////////////////////////////////
 
@@ -73,13 +74,57 @@ private:
 		WAITING_FOR_DATATYPE_DECL
 	};
 	
-	void handleNextToken( int tokenStartLine, const std::string &token );
+	/// The %directives, in the order of theDirectives
+	enum Directive
+	{
+		DIR_NAME,
+		DIR_NAMESPACE,
+		DIR_HEADER_INCLUDE,
+		DIR_INCLUDE,
+		DIR_CODE,
+		DIR_TOKEN_DESTRUCTOR,
+		DIR_TOKEN_PREFIX,
+		DIR_SYNTAX_ERROR,
+		DIR_PARSE_ACCEPT,
+		DIR_PARSE_FAILURE,
+		DIR_STACK_OVERFLOW,
+		DIR_EXTRA_ARGUMENT,
+		DIR_TOKEN_TYPE,
+		DIR_STACK_SIZE,
+		DIR_START_SYMBOL,
+		DIR_LEFT,
+		DIR_RIGHT,
+		DIR_NONASSOC,
+		DIR_DESTRUCTOR,
+		DIR_TYPE,
+		DIR_UNKNOWN
+	};
+	
+	struct DirectiveInfo
+	{
+		const char		*name;
+		/// State that reads the directive's argument
+		ParseState		 argState;
+		/// Associativity for the precedence directives, UNKNOWN otherwise
+		Symbol::Assoc	 assoc;
+		/// Whether giving the directive (for the same symbol) twice is
+		/// an error
+		bool			 once;
+	};
+	
+	static const DirectiveInfo theDirectives[DIR_UNKNOWN];
+	static const Directive theDirectiveSlots[64];
+	
+	static Directive findDirective( const Util::StringRef &token );
+	
+	/// Tokens point into mySource, which stays mapped while parsing
+	void handleNextToken( int tokenStartLine, const Util::StringRef &token );
 	bool slurpFile( void );
 	
-	void chompString( std::string &str, bool innerWhite = false );
+	void chompString( Util::StringRef &str, bool innerWhite = false );
 	
 	std::string mySourceFile;
-	std::string mySourceData;
+	Util::MappedFile mySource;
 	
 	std::string myAppName;
 	
@@ -93,6 +138,7 @@ private:
 	std::string myCurRuleCode;
 	
 	std::string myCurDeclKey;
+	Directive	myCurDirective;
 	
 	int				myCurPrecCounter;
 	Symbol::Assoc	myCurDeclAssoc;
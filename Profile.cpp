@@ -0,0 +1,351 @@
+/// @file Profile.cpp
+/// @brief Implementation of timing the phases of a run.
+///
+///
+
+//
+// 
+// Copyright  2003-2013 Kimball Thurston
+// 
+// This program is free software; you can redisribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+// 
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <ostream>
+#include <iomanip>
+#include <malloc.h>
+
+#include "Profile.h"
+#include "Util.h"
+#include "Version.h"
+
+
+////////////////////////////////////////
+
+
+// Heap accounting.  Every allocation goes through the replacements
+// of the global new / delete below; while tracking, the usable size
+// of each block is added to / taken off the bytes in use.  The state
+// builder allocates from several threads, hence the atomics.
+static std::atomic< int64_t >	theHeapInUse( 0 );
+static std::atomic< int64_t >	theHeapPeak( 0 );
+static std::atomic< bool >		theHeapTracking( false );
+
+
+////////////////////////////////////////
+
+
+static void
+noteAlloc( void *p )
+{
+	int64_t n = int64_t( malloc_usable_size( p ) );
+	int64_t inUse = theHeapInUse.fetch_add( n, std::memory_order_relaxed ) + n;
+	int64_t peak = theHeapPeak.load( std::memory_order_relaxed );
+	
+	while ( inUse > peak &&
+			! theHeapPeak.compare_exchange_weak( peak, inUse,
+												 std::memory_order_relaxed ) )
+	{
+	}
+}
+
+
+////////////////////////////////////////
+
+
+void *
+operator new( size_t n )
+{
+	void *p = std::malloc( n ? n : 1 );
+	
+	if ( ! p )
+		throw std::bad_alloc();
+	
+	if ( theHeapTracking.load( std::memory_order_relaxed ) )
+		noteAlloc( p );
+	
+	return p;
+}
+
+
+////////////////////////////////////////
+
+
+void
+operator delete( void *p ) noexcept
+{
+	if ( p && theHeapTracking.load( std::memory_order_relaxed ) )
+	{
+		theHeapInUse.fetch_sub( int64_t( malloc_usable_size( p ) ),
+								std::memory_order_relaxed );
+	}
+	
+	std::free( p );
+}
+
+
+////////////////////////////////////////
+
+
+static Profile *theProfile = 0;
+
+
+////////////////////////////////////////
+
+
+Profile::Profile( void )
+		: myEnabled( false ), myInPhase( false ), myOrigin( 0 )
+{
+	myOrigin = now();
+}
+
+
+////////////////////////////////////////
+
+
+Profile::~Profile( void )
+{
+}
+
+
+////////////////////////////////////////
+
+
+uint64_t
+Profile::now( void ) const
+{
+	using namespace std::chrono;
+	
+	return uint64_t( duration_cast< microseconds >(
+						 steady_clock::now().time_since_epoch() ).count() ) - myOrigin;
+}
+
+
+////////////////////////////////////////
+
+
+void
+Profile::setEnabled( bool on_off )
+{
+	myEnabled = on_off;
+	theHeapTracking.store( on_off );
+}
+
+
+////////////////////////////////////////
+
+
+void
+Profile::beginPhase( const char *name )
+{
+	if ( ! myEnabled )
+		return;
+	
+	endPhase();
+	
+	Phase p;
+	p.name = name;
+	p.start = now();
+	p.duration = 0;
+	p.peakBytes = 0;
+	myPhases.push_back( p );
+	
+	// The high-water mark restarts from what is in use right now
+	theHeapPeak.store( theHeapInUse.load() );
+	myInPhase = true;
+}
+
+
+////////////////////////////////////////
+
+
+void
+Profile::endPhase( void )
+{
+	if ( ! myInPhase )
+		return;
+	
+	Phase &p = myPhases.back();
+	p.duration = now() - p.start;
+	p.peakBytes = theHeapPeak.load();
+	myInPhase = false;
+}
+
+
+////////////////////////////////////////
+
+
+void
+Profile::setCount( const char *name, size_t value )
+{
+	if ( ! myEnabled )
+		return;
+	
+	CountList::iterator i, e;
+	for ( i = myCounts.begin(), e = myCounts.end(); i != e; ++i )
+	{
+		if ( std::string( (*i).first ) == name )
+		{
+			(*i).second = value;
+			return;
+		}
+	}
+	
+	myCounts.push_back( std::make_pair( name, value ) );
+}
+
+
+////////////////////////////////////////
+
+
+void
+Profile::addFile( Format fmt, const std::string &fileName )
+{
+	myFiles.push_back( std::make_pair( fmt, fileName ) );
+}
+
+
+////////////////////////////////////////
+
+
+bool
+Profile::writeFiles( void ) const
+{
+	FileList::const_iterator i, e;
+	bool retval = true;
+	
+	for ( i = myFiles.begin(), e = myFiles.end(); i != e; ++i )
+	{
+		Util::OutputFile out;
+		
+		out.open( (*i).second.c_str() );
+		if ( (*i).first == TRACE )
+			writeTrace( out );
+		else
+			writeJSON( out );
+		
+		if ( ! out.close() )
+			retval = false;
+	}
+	
+	return retval;
+}
+
+
+////////////////////////////////////////
+
+
+void
+Profile::print( std::ostream &out ) const
+{
+	PhaseList::const_iterator i, e;
+	const char *lead = "Phase timings:      ";
+	
+	for ( i = myPhases.begin(), e = myPhases.end(); i != e; ++i )
+	{
+		out << lead << std::left << std::setw( 16 ) << (*i).name << std::right
+			<< std::fixed << std::setprecision( 3 ) << std::setw( 10 )
+			<< double( (*i).duration ) / 1000.0 << " ms, peak "
+			<< ( (*i).peakBytes + 1023 ) / 1024 << " KB" << std::endl;
+		lead = "                    ";
+	}
+}
+
+
+////////////////////////////////////////
+
+
+void
+Profile::writeJSON( std::ostream &out ) const
+{
+	PhaseList::const_iterator pi, pe;
+	CountList::const_iterator ci, ce;
+	
+	out << "{\n  \"version\": \"" << VersionInfo::appVersion() << "\",\n"
+		<< "  \"phases\": [";
+	
+	for ( pi = myPhases.begin(), pe = myPhases.end(); pi != pe; ++pi )
+	{
+		out << ( pi == myPhases.begin() ? "\n" : ",\n" )
+			<< "    { \"name\": \"" << (*pi).name << "\""
+			<< ", \"start_us\": " << (*pi).start
+			<< ", \"wall_us\": " << (*pi).duration
+			<< ", \"peak_bytes\": " << (*pi).peakBytes << " }";
+	}
+	
+	out << "\n  ],\n  \"counts\": {";
+	
+	for ( ci = myCounts.begin(), ce = myCounts.end(); ci != ce; ++ci )
+	{
+		out << ( ci == myCounts.begin() ? "\n" : ",\n" )
+			<< "    \"" << (*ci).first << "\": " << (*ci).second;
+	}
+	
+	out << "\n  }\n}" << std::endl;
+}
+
+
+////////////////////////////////////////
+
+
+void
+Profile::writeTrace( std::ostream &out ) const
+{
+	PhaseList::const_iterator pi, pe;
+	CountList::const_iterator ci, ce;
+	uint64_t end = 0;
+	
+	out << "{ \"traceEvents\": [\n"
+		<< "  { \"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1,"
+		<< " \"args\": { \"name\": \"" << VersionInfo::appName() << "\" } }";
+	
+	// Phases are complete ("X") events on a single thread
+	for ( pi = myPhases.begin(), pe = myPhases.end(); pi != pe; ++pi )
+	{
+		out << ",\n  { \"name\": \"" << (*pi).name << "\", \"ph\": \"X\""
+			<< ", \"pid\": 1, \"tid\": 1"
+			<< ", \"ts\": " << (*pi).start
+			<< ", \"dur\": " << (*pi).duration
+			<< ", \"args\": { \"peak_bytes\": " << (*pi).peakBytes << " } }";
+		end = (*pi).start + (*pi).duration;
+	}
+	
+	// and the counts one counter ("C") event at the end of the run
+	for ( ci = myCounts.begin(), ce = myCounts.end(); ci != ce; ++ci )
+	{
+		out << ",\n  { \"name\": \"" << (*ci).first << "\", \"ph\": \"C\""
+			<< ", \"pid\": 1, \"ts\": " << end
+			<< ", \"args\": { \"value\": " << (*ci).second << " } }";
+	}
+	
+	out << "\n], \"displayTimeUnit\": \"ms\" }" << std::endl;
+}
+
+
+////////////////////////////////////////
+
+
+Profile *
+Profile::get( void )
+{
+	if ( ! theProfile )
+		theProfile = new Profile;
+	
+	return theProfile;
+}
@@ -0,0 +1,107 @@
+/// @file Profile.h
+/// @brief Header file for timing the phases of a run.
+///
+///
+
+//
+// 
+// Copyright  2003-2013 Kimball Thurston
+// 
+// This program is free software; you can redisribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+// 
+//
+
+#ifndef _Profile_h_
+#define _Profile_h_
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <stdint.h>
+
+
+////////////////////////////////////////
+
+
+/// Records the wall time and the heap high-water mark of every phase
+/// of a run, along with a few counts, for --stats and the --profile /
+/// --trace files.  Nothing is recorded unless it is enabled.
+class Profile
+{
+public:
+	enum Format
+	{
+		JSON,	// one object with the phases and the counts
+		TRACE	// Chrome trace events (chrome://tracing, Perfetto)
+	};
+	
+	Profile( void );
+	~Profile( void );
+	
+	/// Also starts tracking the heap
+	void setEnabled( bool on_off );
+	inline bool isEnabled( void ) const;
+	
+	/// Starts timing the named phase, ending the current one (phases
+	/// do not nest)
+	void beginPhase( const char *name );
+	void endPhase( void );
+	
+	void setCount( const char *name, size_t value );
+	
+	/// Asks for the profile to be written to fileName on writeFiles
+	void addFile( Format fmt, const std::string &fileName );
+	/// Returns false if one of the files could not be written
+	bool writeFiles( void ) const;
+	
+	/// One line per phase, in the layout of Grammar::printStats
+	void print( std::ostream &out ) const;
+	void writeJSON( std::ostream &out ) const;
+	void writeTrace( std::ostream &out ) const;
+	
+	static Profile *get( void );
+	
+private:
+	struct Phase
+	{
+		const char	*name;
+		uint64_t	 start;		// microseconds since the profile began
+		uint64_t	 duration;	// microseconds
+		int64_t		 peakBytes;	// most heap in use during the phase
+	};
+	
+	typedef std::vector< Phase >							PhaseList;
+	typedef std::vector< std::pair< const char *, size_t > >	CountList;
+	typedef std::vector< std::pair< Format, std::string > >	FileList;
+	
+	uint64_t now( void ) const;
+	
+	bool		myEnabled;
+	bool		myInPhase;
+	uint64_t	myOrigin;
+	PhaseList	myPhases;
+	CountList	myCounts;
+	FileList	myFiles;
+};
+
+
+////////////////////////////////////////
+
+
+inline bool Profile::isEnabled( void ) const { return myEnabled; }
+
+#endif /* _Profile_h_ */
@@ -35,8 +35,9 @@
 
 
 Rule::Rule( const std::string &lhs, size_t ruleIndex )
-		: myRuleIndex( ruleIndex ), myLHS( lhs ), myRuleLine( 0 ),
-		  myCodeLine( 0 ), myCanReduce( false )
+		: myRuleIndex( ruleIndex ), myLHS( lhs ), myLHSIndex( NO_SYMBOL ),
+		  myRuleLine( 0 ), myCodeLine( 0 ), myPrecedenceIndex( NO_SYMBOL ),
+		  myCanReduce( false ), myUnitCopy( false )
 {
 }
 
@@ -55,7 +56,7 @@ Rule::~Rule( void )
 Symbol *
 Rule::getLHSSymbol( void ) const
 {
-	return SymbolTable::get()->find( myLHS );
+	return SymbolTable::get()->getNthSymbol( myLHSIndex );
 }
 
 
@@ -103,6 +104,17 @@ Rule::setCode( int codeline, const std::string &code )
 ////////////////////////////////////////
 
 
+void
+Rule::setCode( int codeline, const Util::StringRef &code )
+{
+	myCodeLine = codeline;
+	myCode.assign( code.begin(), code.end() );
+}
+
+
+////////////////////////////////////////
+
+
 void
 Rule::setPrecedence( const std::string &precSym )
 {
@@ -113,10 +125,77 @@ Rule::setPrecedence( const std::string &precSym )
 ////////////////////////////////////////
 
 
+void
+Rule::setPrecedence( size_t precSymIdx )
+{
+	myPrecedenceIndex = precSymIdx;
+	myPrecedence = SymbolTable::get()->getNthSymbol( precSymIdx )->getName();
+}
+
+
+////////////////////////////////////////
+
+
 Symbol *
 Rule::getPrecedenceSymbol( void ) const
 {
-	return myPrecedence.empty() ? 0 : SymbolTable::get()->find( myPrecedence );
+	if ( myPrecedenceIndex == NO_SYMBOL )
+		return 0;
+	return SymbolTable::get()->getNthSymbol( myPrecedenceIndex );
+}
+
+
+////////////////////////////////////////
+
+
+void
+Rule::intern( void )
+{
+	SymbolTable *symTable = SymbolTable::get();
+	RHSListConstIter ri, re;
+	
+	myLHSIndex = symTable->find( myLHS )->getIndex();
+	
+	myRHSSymbols.clear();
+	myRHSSymbols.reserve( myRHSList.size() );
+	for ( ri = myRHSList.begin(), re = myRHSList.end(); ri != re; ++ri )
+		myRHSSymbols.push_back( symTable->find( (*ri).first )->getIndex() );
+	
+	if ( ! myPrecedence.empty() )
+		myPrecedenceIndex = symTable->find( myPrecedence )->getIndex();
+}
+
+
+////////////////////////////////////////
+
+
+void
+Rule::computeSuffixFirstSets( void )
+{
+	SymbolTable *symTable = SymbolTable::get();
+	size_t i = myRHSSymbols.size();
+	
+	mySuffixFirst.assign( i + 1, FollowSet() );
+	mySuffixLambda.assign( i + 1, true );
+	
+	while ( i-- > 0 )
+	{
+		Symbol *sp = symTable->getNthSymbol( myRHSSymbols[i] );
+		
+		if ( Symbol::TERMINAL == sp->getType() )
+		{
+			mySuffixFirst[i].add( myRHSSymbols[i] );
+			mySuffixLambda[i] = false;
+		}
+		else
+		{
+			mySuffixFirst[i] = sp->getFirstSet();
+			if ( sp->isLambda() )
+				mySuffixFirst[i].combine( mySuffixFirst[i + 1] );
+			else
+				mySuffixLambda[i] = false;
+		}
+	}
 }
 
 
@@ -133,6 +212,16 @@ Rule::setCanReduce( bool on_off )
 ////////////////////////////////////////
 
 
+void
+Rule::setUnitCopy( bool on_off )
+{
+	myUnitCopy = on_off;
+}
+
+
+////////////////////////////////////////
+
+
 void
 Rule::print( std::ostream &out ) const
 {
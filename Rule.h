@@ -30,6 +30,9 @@
 #include <vector>
 #include <string>
 
+#include "FollowSet.h"
+#include "Util.h"
+
 
 ////////////////////////////////////////
 
@@ -43,12 +46,16 @@ public:
 	typedef std::vector< RHSEntry > RHSList;
 	typedef RHSList::iterator RHSListIter;
 	typedef RHSList::const_iterator RHSListConstIter;
+	typedef std::vector< size_t > SymbolList;
+	
+	static const size_t NO_SYMBOL = size_t( -1 );
 
 	Rule( const std::string &lhs, size_t ruleIndex );
 	~Rule( void );
 	
 	/// The left hand side for the rule
 	inline const std::string &getLHS( void ) const { return myLHS; }
+	inline size_t getLHSIndex( void ) const { return myLHSIndex; }
 	Symbol *getLHSSymbol( void ) const;
 	
 	/// Rule index for use during rule production analysis.
@@ -65,21 +72,45 @@ public:
 	/// The RHS symbols.
 	void setRHS( const RHSList &rhs );
 	inline const RHSList &getRHS( void ) const { return myRHSList; }
+	/// The RHS as symbol indices (valid after intern)
+	inline const SymbolList &getRHSSymbols( void ) const { return myRHSSymbols; }
+	inline size_t getRHSSize( void ) const { return myRHSSymbols.size(); }
 	
 	/// The code to run when the rule is reduced.
 	void setCode( int codeline, const std::string &code );
+	void setCode( int codeline, const Util::StringRef &code );
 	inline int getCodeLine( void ) const { return myCodeLine; }
 	inline const std::string &getCode( void ) const { return myCode; }
 	
 	// The precedence symbol for this rule
 	void setPrecedence( const std::string &precSym );
+	void setPrecedence( size_t precSymIdx );
 	inline const std::string &getPrecedence( void ) const { return myPrecedence;}
+	inline size_t getPrecedenceIndex( void ) const { return myPrecedenceIndex; }
 	Symbol *getPrecedenceSymbol( void ) const;
 	
+	/// Resolves the symbol names used by this rule into symbol indices.
+	/// Called once the grammar is read and the symbol table is final,
+	/// the analysis only works with the indices from then on.
+	void intern( void );
+	
+	/// The first set of the RHS from position pos on, and whether that
+	/// part of the RHS can derive the empty string.  Valid once
+	/// computeSuffixFirstSets has run (after the symbol first sets).
+	inline const FollowSet &getFirstFrom( size_t pos ) const { return mySuffixFirst[pos]; }
+	inline bool isLambdaFrom( size_t pos ) const { return mySuffixLambda[pos]; }
+	void computeSuffixFirstSets( void );
+	
 	
 	void setCanReduce( bool on_off );
 	inline bool canReduce( void ) const { return myCanReduce; }
 	
+	/// A unit rule whose left hand side takes over the value of its
+	/// one symbol unchanged: no code at all or just the copy.  The
+	/// parser may skip its reduction.
+	void setUnitCopy( bool on_off );
+	inline bool isUnitCopy( void ) const { return myUnitCopy; }
+	
 	void print( std::ostream &out ) const;
 	
 private:
@@ -88,15 +119,22 @@ private:
 	
 	size_t		 myRuleIndex;
 	std::string	 myLHS;
+	size_t		 myLHSIndex;
 	std::string	 myLHSAlias;
 	int			 myRuleLine;
 	RHSList		 myRHSList;
+	SymbolList	 myRHSSymbols;
+	
+	std::vector< FollowSet > mySuffixFirst;
+	std::vector< bool >		 mySuffixLambda;
 	int			 myCodeLine;
 	std::string	 myCode;
 	
 	std::string	 myPrecedence;
+	size_t		 myPrecedenceIndex;
 	
 	bool		 myCanReduce;
+	bool		 myUnitCopy;
 };
 
 #endif /* _Rule_h_ */
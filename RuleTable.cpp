@@ -23,8 +23,9 @@
 // 
 //
 
-#include <map>
 #include <ostream>
+#include <algorithm>
+#include <utility>
 
 #include "RuleTable.h"
 #include "Rule.h"
@@ -44,7 +45,7 @@ RuleTable::RuleTable( void )
 
 RuleTable::~RuleTable( void )
 {
-	myRules.clear();
+	myRulesByLHS.clear();
 	while ( ! myRuleList.empty() )
 	{
 		delete myRuleList.back();
@@ -59,15 +60,8 @@ RuleTable::~RuleTable( void )
 Rule *
 RuleTable::createNewRule( const std::string &lhs )
 {
-	RuleMapIter i;
 	Rule *retval = new Rule( lhs, myRuleList.size() );
 	
-	i = myRules.find( lhs );
-	if ( i == myRules.end() )
-		myRules[lhs].insert( myRules[lhs].begin(), retval );
-	else
-		(*i).second.insert( (*i).second.begin(), retval );
-	
 	myRuleList.push_back( retval );
 	
 	return retval;
@@ -97,56 +91,51 @@ RuleTable::getNthRule( size_t i )
 ////////////////////////////////////////
 
 
-Rule *
-RuleTable::findFirstRule( const std::string &lhs )
+void
+RuleTable::getRules( size_t lhsIdx,
+					 RuleSpanIter &first, RuleSpanIter &last ) const
 {
-	RuleMapIter	 i;
-	Rule		*retval = 0;
-	
-	i = myRules.find( lhs );
-	if ( i != myRules.end() )
+	if ( lhsIdx + 1 < myLHSStart.size() )
 	{
-		retval = (*i).second.front();
+		first = myRulesByLHS.begin() + long( myLHSStart[lhsIdx] );
+		last = myRulesByLHS.begin() + long( myLHSStart[lhsIdx + 1] );
 	}
-	
-	return retval;
+	else
+		first = last = myRulesByLHS.end();
 }
 
 
 ////////////////////////////////////////
 
 
-Rule *
-RuleTable::getNextRule( const Rule *rule )
+void
+RuleTable::intern( void )
 {
-	RuleMapIter	 i;
-	Rule		*retval = 0;
+	RuleListIter	i, e;
+	size_t			s, nSym;
 	
-	if ( ! rule )
-		return retval;
+	for ( i = myRuleList.begin(), e = myRuleList.end(); i != e; ++i )
+		(*i)->intern();
 	
-	i = myRules.find( rule->getLHS() );
-	if ( i != myRules.end() )
-	{
-		RuleListIter ri, re;
-		
-		ri = (*i).second.begin();
-		re = (*i).second.end();
-		
-		for ( ; ri != re; ++ri )
-		{
-			if ( (*ri) == rule )
-			{
-				++ri;
-				break;
-			}
-		}
-		
-		if ( ri != re )
-			retval = (*ri);
-	}
+	// Counting sort on the left hand side.  Within a nonterminal the
+	// latest rule comes first, the order the alternatives have always
+	// been visited in.
+	nSym = SymbolTable::get()->getNumSymbols();
+	myLHSStart.assign( nSym + 2, 0 );
 	
-	return retval;
+	for ( i = myRuleList.begin(), e = myRuleList.end(); i != e; ++i )
+		++myLHSStart[(*i)->getLHSIndex() + 2];
+	
+	for ( s = 2; s < myLHSStart.size(); ++s )
+		myLHSStart[s] += myLHSStart[s - 1];
+	
+	myRulesByLHS.assign( myRuleList.size(), 0 );
+	
+	RuleList::reverse_iterator ri, re;
+	for ( ri = myRuleList.rbegin(), re = myRuleList.rend(); ri != re; ++ri )
+		myRulesByLHS[ myLHSStart[(*ri)->getLHSIndex() + 1]++ ] = (*ri);
+	
+	myLHSStart.pop_back();
 }
 
 
@@ -156,25 +145,25 @@ RuleTable::getNextRule( const Rule *rule )
 void
 RuleTable::findPrecedences( void )
 {
-	RuleListIter	i, e;
+	SymbolTable		*symTable = SymbolTable::get();
+	RuleListIter	 i, e;
 	
 	i = myRuleList.begin();
 	e = myRuleList.end();
 	
 	for ( ; i != e; ++i )
 	{
-		if ( (*i)->getPrecedence().empty() )
+		if ( (*i)->getPrecedenceIndex() == Rule::NO_SYMBOL )
 		{
-			Rule::RHSListConstIter ri, re;
-			ri = (*i)->getRHS().begin();
-			re = (*i)->getRHS().end();
+			Rule::SymbolList::const_iterator ri, re;
+			ri = (*i)->getRHSSymbols().begin();
+			re = (*i)->getRHSSymbols().end();
 			
 			for ( ; ri != re; ++ri )
 			{
-				Symbol *tmpSym = SymbolTable::get()->findOrCreate( (*ri).first );
-				if ( tmpSym->getPrecedence() >= 0 )
+				if ( symTable->getNthSymbol( *ri )->getPrecedence() >= 0 )
 				{
-					(*i)->setPrecedence( (*ri).first );
+					(*i)->setPrecedence( *ri );
 					break;
 				}
 			}
@@ -186,43 +175,160 @@ RuleTable::findPrecedences( void )
 ////////////////////////////////////////
 
 
+/// Tarjan's algorithm without recursion, so long chains of
+/// nonterminals can't run out of stack.  Components come out in
+/// reverse topological order: a component only depends on those
+/// listed before it.
 void
-RuleTable::computeLambdas( void )
+RuleTable::findComponents( const Graph &g, Graph &components )
 {
-	RuleListIter	i, e;
-	bool			progress;
+	const size_t NONE = size_t( -1 );
+	size_t		 N = g.size();
+	size_t		 counter = 0;
+	OffsetList	 order( N, NONE );
+	OffsetList	 low( N, 0 );
+	OffsetList	 stack;
+	std::vector< bool > onStack( N, false );
 	
-	do
+	// (node, next edge to look at)
+	std::vector< std::pair< size_t, size_t > > path;
+	
+	components.clear();
+	
+	for ( size_t root = 0; root < N; ++root )
 	{
-		progress = false;
+		if ( order[root] != NONE )
+			continue;
+		
+		path.push_back( std::make_pair( root, size_t( 0 ) ) );
+		order[root] = low[root] = counter++;
+		stack.push_back( root );
+		onStack[root] = true;
 		
-		i = myRuleList.begin();
-		e = myRuleList.end();
-		for ( ; i != e; ++i )
+		while ( ! path.empty() )
 		{
-			Symbol *lhsSym = (*i)->getLHSSymbol();
+			size_t v = path.back().first;
+			size_t &edge = path.back().second;
 			
-			if ( lhsSym->isLambda() )
+			if ( edge < g[v].size() )
+			{
+				size_t w = g[v][edge++];
+				
+				if ( order[w] == NONE )
+				{
+					order[w] = low[w] = counter++;
+					stack.push_back( w );
+					onStack[w] = true;
+					path.push_back( std::make_pair( w, size_t( 0 ) ) );
+				}
+				else if ( onStack[w] )
+					low[v] = std::min( low[v], order[w] );
+				
 				continue;
+			}
 			
-			Rule::RHSListConstIter ri, re;
-			ri = (*i)->getRHS().begin();
-			re = (*i)->getRHS().end();
+			if ( low[v] == order[v] )
+			{
+				components.push_back( OffsetList() );
+				
+				size_t w;
+				do
+				{
+					w = stack.back();
+					stack.pop_back();
+					onStack[w] = false;
+					components.back().push_back( w );
+				} while ( w != v );
+			}
 			
-			for ( ; ri != re; ++ri )
+			path.pop_back();
+			if ( ! path.empty() )
 			{
-				Symbol *tmpSym = SymbolTable::get()->findOrCreate( (*ri).first );
-				if ( ! tmpSym->isLambda() )
+				size_t u = path.back().first;
+				low[u] = std::min( low[u], low[v] );
+			}
+		}
+	}
+}
+
+
+////////////////////////////////////////
+
+
+void
+RuleTable::computeLambdas( void )
+{
+	SymbolTable		*symTable = SymbolTable::get();
+	size_t			 s, nSym;
+	Graph			 deps, components;
+	
+	// Only rules made up entirely of nonterminals can make their left
+	// hand side nullable
+	nSym = myLHSStart.size() - 1;
+	deps.resize( nSym );
+	for ( s = 0; s < nSym; ++s )
+	{
+		RuleSpanIter i, e;
+		for ( getRules( s, i, e ); i != e; ++i )
+		{
+			const Rule::SymbolList &rhs = (*i)->getRHSSymbols();
+			Rule::SymbolList::const_iterator ri, re;
+			
+			for ( ri = rhs.begin(), re = rhs.end(); ri != re; ++ri )
+			{
+				if ( symTable->getNthSymbol( *ri )->getType() == Symbol::TERMINAL )
 					break;
 			}
 			
 			if ( ri == re )
+				deps[s].insert( deps[s].end(), rhs.begin(), rhs.end() );
+		}
+	}
+	
+	findComponents( deps, components );
+	
+	Graph::const_iterator ci, ce;
+	for ( ci = components.begin(), ce = components.end(); ci != ce; ++ci )
+	{
+		bool progress;
+		
+		// Everything outside the component is final already, this
+		// only loops for nonterminals that depend on each other
+		do
+		{
+			progress = false;
+			
+			OffsetList::const_iterator mi, me;
+			for ( mi = (*ci).begin(), me = (*ci).end(); mi != me; ++mi )
 			{
-				lhsSym->setLambda( true );
-				progress = true;
+				Symbol *lhsSym = symTable->getNthSymbol( *mi );
+				
+				if ( lhsSym->isLambda() )
+					continue;
+				
+				RuleSpanIter i, e;
+				for ( getRules( *mi, i, e ); i != e; ++i )
+				{
+					Rule::SymbolList::const_iterator ri, re;
+					ri = (*i)->getRHSSymbols().begin();
+					re = (*i)->getRHSSymbols().end();
+					
+					for ( ; ri != re; ++ri )
+					{
+						if ( ! symTable->getNthSymbol( *ri )->isLambda() )
+							break;
+					}
+					
+					if ( ri == re )
+					{
+						lhsSym->setLambda( true );
+						progress = true;
+						break;
+					}
+				}
 			}
-		}
-	} while ( progress );
+		} while ( progress && (*ci).size() > 1 );
+	}
 }
 
 
@@ -232,49 +338,152 @@ RuleTable::computeLambdas( void )
 void
 RuleTable::computeFirstSets( void )
 {
-	RuleListIter	i, e;
-	bool			progress;
+	SymbolTable		*symTable = SymbolTable::get();
+	size_t			 s, nSym;
+	Graph			 deps, components;
 	
-	do
+	// A depends on every nonterminal that can start one of its rules
+	nSym = myLHSStart.size() - 1;
+	deps.resize( nSym );
+	for ( s = 0; s < nSym; ++s )
 	{
-		progress = false;
-		
-		i = myRuleList.begin();
-		e = myRuleList.end();
-		for ( ; i != e; ++i )
+		RuleSpanIter i, e;
+		for ( getRules( s, i, e ); i != e; ++i )
 		{
-			Symbol *lhsSym = (*i)->getLHSSymbol();
-			
-			Rule::RHSListConstIter ri, re;
-			ri = (*i)->getRHS().begin();
-			re = (*i)->getRHS().end();
+			Rule::SymbolList::const_iterator ri, re;
+			ri = (*i)->getRHSSymbols().begin();
+			re = (*i)->getRHSSymbols().end();
 			
 			for ( ; ri != re; ++ri )
 			{
-				Symbol *tmpSym = SymbolTable::get()->findOrCreate( (*ri).first );
+				Symbol *tmpSym = symTable->getNthSymbol( *ri );
 				
 				if ( tmpSym->getType() == Symbol::TERMINAL )
-				{
-					if ( lhsSym->setFirstSet( tmpSym->getName() ) )
-						progress = true;
 					break;
-				}
-				else if ( lhsSym == tmpSym )
+				
+				if ( *ri != s )
+					deps[s].push_back( *ri );
+				
+				if ( ! tmpSym->isLambda() )
+					break;
+			}
+		}
+	}
+	
+	findComponents( deps, components );
+	
+	// Every nonterminal of a component has the same first set, the
+	// terminals its members start with plus the (final) first sets of
+	// the components below it.
+	OffsetList compOf( nSym, 0 );
+	Graph::const_iterator ci, ce;
+	
+	for ( s = 0, ci = components.begin(), ce = components.end(); ci != ce; ++ci, ++s )
+	{
+		OffsetList::const_iterator mi, me;
+		for ( mi = (*ci).begin(), me = (*ci).end(); mi != me; ++mi )
+			compOf[*mi] = s;
+	}
+	
+	for ( s = 0, ci = components.begin(), ce = components.end(); ci != ce; ++ci, ++s )
+	{
+		FollowSet first;
+		OffsetList::const_iterator mi, me;
+		
+		for ( mi = (*ci).begin(), me = (*ci).end(); mi != me; ++mi )
+		{
+			RuleSpanIter i, e;
+			for ( getRules( *mi, i, e ); i != e; ++i )
+			{
+				Rule::SymbolList::const_iterator ri, re;
+				ri = (*i)->getRHSSymbols().begin();
+				re = (*i)->getRHSSymbols().end();
+				
+				for ( ; ri != re; ++ri )
 				{
-					if ( ! lhsSym->isLambda() )
+					Symbol *tmpSym = symTable->getNthSymbol( *ri );
+					
+					if ( tmpSym->getType() == Symbol::TERMINAL )
+					{
+						first.add( *ri );
 						break;
-				}
-				else
-				{
-					if ( lhsSym->unionFirstSet( *tmpSym ) )
-						progress = true;
+					}
+					
+					if ( compOf[*ri] != s )
+						first.combine( tmpSym->getFirstSet() );
 					
 					if ( ! tmpSym->isLambda() )
 						break;
 				}
 			}
 		}
-	} while ( progress );
+		
+		for ( mi = (*ci).begin(), me = (*ci).end(); mi != me; ++mi )
+			symTable->getNthSymbol( *mi )->unionFirstSet( first );
+	}
+}
+
+
+////////////////////////////////////////
+
+
+/// Closing a state used to rediscover, state after state, the rules
+/// of each nonterminal after a dot, then those of their leading
+/// nonterminals and so on.  That walk only depends on the grammar, so
+/// it is done here once (a Warshall pass over bitset rows) along with
+/// the first sets of every rule suffix used to seed the follow sets.
+void
+RuleTable::computeClosureSets( void )
+{
+	SymbolTable	*symTable = SymbolTable::get();
+	size_t		 i, k, nSym;
+	
+	nSym = myLHSStart.size() - 1;
+	myLeftCorners.assign( nSym, FollowSet() );
+	
+	for ( i = 0; i < nSym; ++i )
+	{
+		if ( symTable->getNthSymbol( i )->getType() != Symbol::NONTERMINAL )
+			continue;
+		
+		myLeftCorners[i].add( i );
+		
+		RuleSpanIter ri, re;
+		for ( getRules( i, ri, re ); ri != re; ++ri )
+		{
+			const Rule::SymbolList &rhs = (*ri)->getRHSSymbols();
+			
+			if ( ! rhs.empty() &&
+				 symTable->getNthSymbol( rhs[0] )->getType() == Symbol::NONTERMINAL )
+				myLeftCorners[i].add( rhs[0] );
+		}
+	}
+	
+	for ( k = 0; k < nSym; ++k )
+	{
+		if ( myLeftCorners[k].isEmpty() )
+			continue;
+		
+		for ( i = 0; i < nSym; ++i )
+		{
+			if ( i != k && myLeftCorners[i].isSet( k ) )
+				myLeftCorners[i].combine( myLeftCorners[k] );
+		}
+	}
+	
+	RuleListIter ri, re;
+	for ( ri = myRuleList.begin(), re = myRuleList.end(); ri != re; ++ri )
+		(*ri)->computeSuffixFirstSets();
+}
+
+
+////////////////////////////////////////
+
+
+const FollowSet &
+RuleTable::getLeftCorners( size_t symIdx ) const
+{
+	return myLeftCorners[symIdx];
 }
 
 
@@ -282,30 +491,21 @@ RuleTable::computeFirstSets( void )
 
 
 bool
-RuleTable::isOnRightSide( const std::string &lhs )
+RuleTable::isOnRightSide( size_t symIdx )
 {
 	RuleListIter	i, e;
-	bool			retval = false;
 	
 	i = myRuleList.begin();
 	e = myRuleList.end();
 	for ( ; i != e; ++i )
 	{
-		Rule::RHSListConstIter ri, re;
-		ri = (*i)->getRHS().begin();
-		re = (*i)->getRHS().end();
-			
-		for ( ; ri != re; ++ri )
-		{
-			if ( (*ri).first == lhs )
-			{
-				retval = true;
-				break;
-			}
-		}
+		const Rule::SymbolList &rhs = (*i)->getRHSSymbols();
+		
+		if ( std::find( rhs.begin(), rhs.end(), symIdx ) != rhs.end() )
+			return true;
 	}
 	
-	return retval;
+	return false;
 }
 
 
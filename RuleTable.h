@@ -26,11 +26,12 @@
 #ifndef _RuleTable_h_
 #define _RuleTable_h_
 
-#include <map>
 #include <vector>
 #include <string>
 #include <iosfwd>
 
+#include "FollowSet.h"
+
 
 ////////////////////////////////////////
 
@@ -39,45 +40,70 @@ class Rule;
 
 class RuleTable
 {
+	typedef std::vector< Rule * >		RuleList;
+	
 public:
+	typedef RuleList::const_iterator	RuleSpanIter;
+	
 	RuleTable( void );
 	~RuleTable( void );
 	
-	/// Creates a new, empty rule. Will auto match it with other
-	/// existing rules with the same lhs and add them into a chain.
+	/// Creates a new, empty rule.
 	Rule *createNewRule( const std::string &lhs );
 	
 	/// Get a rule based on it's index
 	size_t getNumRules( void );
 	Rule *getNthRule( size_t i );
 	
-	Rule *findFirstRule( const std::string &lhs );
-	/// Retrieves the next rule with the same lhs. (might be null)
-	Rule *getNextRule( const Rule *rule );
+	/// Retrieves the rules of a nonterminal (by symbol index) as the
+	/// contiguous span [first, last), latest rule first.  Only valid
+	/// once the rules are interned.
+	void getRules( size_t lhsIdx,
+				   RuleSpanIter &first, RuleSpanIter &last ) const;
 	
 	// Manipulators to intermesh the rule table
 	
+	/// Convert the symbol names of every rule into symbol indices and
+	/// group the rules by their left hand side
+	void intern( void );
 	/// Find the precedence for every production rule (that has one)
 	void findPrecedences( void );
+	/// Both walk the nonterminal dependency graph one strongly
+	/// connected component at a time, dependencies first.
 	void computeLambdas( void );
 	void computeFirstSets( void );
-	bool isOnRightSide( const std::string &lhs );
+	/// Precomputes what closing a state needs, once first sets are
+	/// known: the left corners of every nonterminal and the first set
+	/// of every rule suffix.
+	void computeClosureSets( void );
+	/// The nonterminals (itself included) whose rules are pulled into
+	/// a closure by an item with the dot in front of symIdx.
+	const FollowSet &getLeftCorners( size_t symIdx ) const;
+	bool isOnRightSide( size_t symIdx );
 	
 	void print( std::ostream &out ) const;
 	
 	static RuleTable *get( void );
 	
 private:
-	typedef std::vector< Rule * >		RuleList;
 	typedef RuleList::iterator			RuleListIter;
 	typedef RuleList::const_iterator	RuleListConstIter;
 	
-	typedef std::map< const std::string, RuleList >	RuleMap;
-	typedef RuleMap::iterator						RuleMapIter;
-	typedef RuleMap::const_iterator					RuleMapConstIter;
+	typedef std::vector< size_t >		OffsetList;
+	typedef std::vector< OffsetList >	Graph;
+	
+	static void findComponents( const Graph &g, Graph &components );
 
 	RuleList	myRuleList;
-	RuleMap		myRules;
+	
+	// Rules grouped by left hand side, the rules of symbol i are
+	// [myLHSStart[i], myLHSStart[i+1]) in myRulesByLHS.
+	RuleList	myRulesByLHS;
+	OffsetList	myLHSStart;
+	
+	// Reflexive, transitive closure of the "rule of A starts with B"
+	// relation, one row per symbol (empty for terminals)
+	std::vector< FollowSet >	myLeftCorners;
 };
 
 #endif /* _RuleTable_h_ */
@@ -34,12 +34,11 @@
 ////////////////////////////////////////
 
 
-State::State( Config *basis, Config *config )
-		: myBasis( basis ), myConfig( config )
+State::State( int idx, Config *basis, Config *config )
+		: myBasis( basis ? basis->getIndex() : Config::NONE ),
+		  myConfig( config ? config->getIndex() : Config::NONE ),
+		  myStateIndex( idx )
 {
-	static int nextStateIDX = 0;
-	
-	myStateIndex = nextStateIDX++;
 }
 
 
@@ -57,7 +56,7 @@ State::~State( void )
 Config *
 State::getBasis( void ) const
 {
-	return myBasis;
+	return Config::get( myBasis );
 }
 
 
@@ -67,7 +66,7 @@ State::getBasis( void ) const
 Config *
 State::getConfig( void ) const
 {
-	return myConfig;
+	return Config::get( myConfig );
 }
 
 
@@ -86,7 +85,7 @@ State::getStateIndex( void ) const
 
 void
 State::addAction( Action::Type		 t,
-				  const std::string	&lookAhead,
+				  size_t			 lookAhead,
 				  State				*stp,
 				  Rule				*rule )
 {
@@ -128,9 +127,9 @@ State::getActions( void ) const
 
 
 void
-State::compress( void )
+State::compress( size_t startIdx )
 {
-	myActions.compress();
+	myActions.compress( startIdx );
 }
 
 
@@ -27,6 +27,7 @@
 #define _State_h_
 
 #include <iosfwd>
+#include <stdint.h>
 #include "ActionList.h"
 
 class Config;
@@ -38,7 +39,8 @@ class Config;
 class State
 {
 public:
-	State( Config *basis, Config *config );
+	/// States are created through StateTable::add
+	State( int idx, Config *basis, Config *config );
 	~State( void );
 	
 	Config *getBasis( void ) const;
@@ -48,20 +50,20 @@ public:
 	int getStateIndex( void ) const;
 	
 	void addAction( Action::Type		 type,
-					const std::string	&lookAhead,
+					size_t				 lookAhead,
 					State				*state,
 					Rule				*rule );
 	void sortActions( void );
 	ActionList &getActions( void );
 	const ActionList &getActions( void ) const;
 	
-	void compress( void );
+	void compress( size_t startIdx );
 	
 	void print( std::ostream &out, bool basisOnly ) const;
 	
 private:
-	Config		*myBasis;		// Basis Configurations for this state
-	Config		*myConfig;		// All Configurations for this set
+	uint32_t	 myBasis;		// Basis Configurations for this state
+	uint32_t	 myConfig;		// All Configurations for this set
 	int			 myStateIndex;	// Sequential number for this state (auto)
 	ActionList	 myActions;		// Array of actions for this state
 	//int tabstart;            /* First index of the action table */
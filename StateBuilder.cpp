@@ -0,0 +1,385 @@
+/// @file StateBuilder.cpp
+/// @brief Builds the LR(0) states on several threads.
+///
+///
+
+//
+// 
+// Copyright  2003-2013 Kimball Thurston
+// 
+// This program is free software; you can redisribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+// 
+//
+
+#include <algorithm>
+#include <thread>
+
+#include "StateBuilder.h"
+#include "StateTable.h"
+#include "State.h"
+#include "Config.h"
+#include "Rule.h"
+
+
+////////////////////////////////////////
+
+
+static const size_t NONE = size_t( -1 );
+
+
+////////////////////////////////////////
+
+
+/// Orders (new config, source config) pairs the same way
+/// ConfigList::sortBasis orders the new configs.
+class madeComp
+{
+public:
+	bool operator()( const std::pair< Config *, Config * > &a,
+					 const std::pair< Config *, Config * > &b ) const
+	{
+		size_t ar = a.first->getRule()->getRuleIndex();
+		size_t br = b.first->getRule()->getRuleIndex();
+		
+		return ( ar == br ) ? a.first->getDot() < b.first->getDot() : ar < br;
+	}
+};
+
+
+////////////////////////////////////////
+
+
+StateBuilder::Edge::Edge( void )
+		: sym( 0 ), front( 0 ), basis( 0 ), target( NONE )
+{
+}
+
+
+////////////////////////////////////////
+
+
+StateBuilder::Edge::Edge( const Edge &other )
+		: sym( other.sym ), front( other.front ), basis( other.basis ),
+		  sources( other.sources ), target( other.target )
+{
+}
+
+
+////////////////////////////////////////
+
+
+StateBuilder::Edge::~Edge( void )
+{
+}
+
+
+////////////////////////////////////////
+
+
+StateBuilder::Pending::Pending( void )
+		: basis( 0 ), config( 0 ), state( 0 )
+{
+}
+
+
+////////////////////////////////////////
+
+
+StateBuilder::Pending::~Pending( void )
+{
+}
+
+
+////////////////////////////////////////
+
+
+StateBuilder::StateBuilder( size_t numJobs, bool propagate )
+		: myNumJobs( numJobs > 0 ? numJobs : 1 ), myPropagate( propagate ),
+		  myLists( myNumJobs ), myNextPending( 0 ), myLevelEnd( 0 )
+{
+	std::vector< ConfigList >::iterator i, e;
+	
+	for ( i = myLists.begin(), e = myLists.end(); i != e; ++i )
+	{
+		(*i).setPropagateFollowSets( myPropagate );
+		(*i).setDeferErrors( true );
+	}
+}
+
+
+////////////////////////////////////////
+
+
+StateBuilder::~StateBuilder( void )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void
+StateBuilder::build( Config *startBasis )
+{
+	size_t begin, end;
+	
+	addPending( startBasis );
+	
+	for ( begin = 0, end = 1; begin < end; begin = end, end = myPending.size() )
+	{
+		expandLevel( begin, end );
+		matchLevel( begin, end );
+	}
+	
+	createState( 0 );
+	
+	myPending.clear();
+	myIndex.clear();
+}
+
+
+////////////////////////////////////////
+
+
+size_t
+StateBuilder::addPending( Config *basis )
+{
+	size_t idx = myPending.size();
+	
+	myPending.emplace_back();
+	myPending.back().basis = basis;
+	myIndex[ StateTable::hashBasis( basis ) ].push_back( idx );
+	
+	return idx;
+}
+
+
+////////////////////////////////////////
+
+
+size_t
+StateBuilder::findPending( const Config *basis ) const
+{
+	BasisIndex::const_iterator bucket;
+	
+	bucket = myIndex.find( StateTable::hashBasis( basis ) );
+	if ( bucket == myIndex.end() )
+		return NONE;
+	
+	IndexList::const_iterator i, e;
+	
+	e = (*bucket).second.end();
+	for ( i = (*bucket).second.begin(); i != e; ++i )
+	{
+		if ( StateTable::sameBasis( myPending[*i].basis, basis ) )
+			return (*i);
+	}
+	
+	return NONE;
+}
+
+
+////////////////////////////////////////
+
+
+void
+StateBuilder::expandLevel( size_t begin, size_t end )
+{
+	std::vector< std::thread > workers;
+	size_t i, nJobs;
+	
+	myNextPending = begin;
+	myLevelEnd = end;
+	
+	nJobs = std::min( myNumJobs, end - begin );
+	for ( i = 1; i < nJobs; ++i )
+		workers.push_back( std::thread( &StateBuilder::work, this, i ) );
+	
+	work( 0 );
+	
+	for ( i = 0; i < workers.size(); ++i )
+		workers[i].join();
+}
+
+
+////////////////////////////////////////
+
+
+void
+StateBuilder::work( size_t job )
+{
+	ConfigList &list = myLists[job];
+	size_t i;
+	
+	while ( ( i = myNextPending++ ) < myLevelEnd )
+		expand( myPending[i], list );
+}
+
+
+////////////////////////////////////////
+
+
+/// Computes the closure of a state and the basis of each of its
+/// successors, following Grammar::getNextState and Grammar::buildShifts.
+void
+StateBuilder::expand( Pending &p, ConfigList &list )
+{
+	ConfigVec basis;
+	ConfigVec::iterator bi, be;
+	Config *cfp;
+	
+	for ( cfp = p.basis; cfp; cfp = cfp->getNextBasis() )
+		basis.push_back( cfp );
+	
+	list.reset();
+	for ( bi = basis.begin(), be = basis.end(); bi != be; ++bi )
+		list.addBasis( *bi );
+	
+	list.computeClosure();
+	list.sort();
+	
+	p.config = list.getConfig();
+	list.takeErrors( p.errors );
+	list.resetPointers();
+	
+	for ( cfp = p.config; cfp; cfp = cfp->getNext() )
+		cfp->setStatus( Config::INCOMPLETE );
+	
+	std::vector< std::pair< Config *, Config * > > made;
+	
+	for ( cfp = p.config; cfp; cfp = cfp->getNext() )
+	{
+		if ( cfp->getStatus() == Config::COMPLETE )
+			continue;
+		
+		const Rule::SymbolList &rhs = cfp->getRule()->getRHSSymbols();
+		
+		if ( cfp->getDot() >= int( rhs.size() ) )
+			continue;
+		
+		list.reset();
+		made.clear();
+		
+		for ( Config *bcfp = cfp; bcfp; bcfp = bcfp->getNext() )
+		{
+			if ( bcfp->getStatus() == Config::COMPLETE )
+				continue;
+			
+			const Rule::SymbolList &brhs = bcfp->getRule()->getRHSSymbols();
+			if ( bcfp->getDot() >= int( brhs.size() ) )
+				continue;
+			
+			if ( rhs[cfp->getDot()] != brhs[bcfp->getDot()] )
+				continue;
+			
+			bcfp->setStatus( Config::COMPLETE );
+			
+			Config *cfg = list.addWithBasis( bcfp->getRule(),
+											 bcfp->getDot() + 1 );
+			made.push_back( std::make_pair( cfg, bcfp ) );
+		}
+		
+		list.sortBasis();
+		
+		p.edges.emplace_back();
+		
+		Edge &e = p.edges.back();
+		e.sym = rhs[cfp->getDot()];
+		e.front = list.getConfig();
+		e.basis = list.getBasis();
+		
+		// The backward links are only added once the states are
+		// numbered, keep the source of each basis config in basis order
+		if ( myPropagate )
+		{
+			std::sort( made.begin(), made.end(), madeComp() );
+			e.sources.reserve( made.size() );
+			for ( size_t i = 0; i < made.size(); ++i )
+				e.sources.push_back( made[i].second );
+		}
+		
+		list.resetPointers();
+	}
+	
+	list.reset();
+}
+
+
+////////////////////////////////////////
+
+
+/// Matches the successor bases of a frontier against the known states.
+/// Done in frontier order so the same basis copies always win.
+void
+StateBuilder::matchLevel( size_t begin, size_t end )
+{
+	size_t i, j;
+	
+	for ( i = begin; i < end; ++i )
+	{
+		for ( j = 0; j < myPending[i].edges.size(); ++j )
+		{
+			Edge &e = myPending[i].edges[j];
+			
+			e.target = findPending( e.basis );
+			if ( e.target == NONE )
+				e.target = addPending( e.basis );
+			else
+				myLists[i % myNumJobs].recycle( e.front );
+			
+			e.front = 0;
+			e.basis = 0;
+		}
+	}
+}
+
+
+////////////////////////////////////////
+
+
+/// Creates the states depth first, in the order Grammar::getNextState
+/// would have, so the numbering, links and errors come out the same.
+void
+StateBuilder::createState( size_t idx )
+{
+	Pending &p = myPending[idx];
+	
+	ConfigList::reportErrors( p.errors );
+	
+	p.state = StateTable::get()->add( p.basis, p.config );
+	
+	EdgeList::iterator i, e;
+	
+	for ( i = p.edges.begin(), e = p.edges.end(); i != e; ++i )
+	{
+		Pending &q = myPending[(*i).target];
+		
+		if ( myPropagate )
+		{
+			Config *bcfp = q.basis;
+			for ( size_t k = 0; k < (*i).sources.size() && bcfp; ++k )
+			{
+				bcfp->addBackwardPropLink( (*i).sources[k] );
+				bcfp = bcfp->getNextBasis();
+			}
+		}
+		
+		if ( ! q.state )
+			createState( (*i).target );
+		
+		// Add shift action to reach state q from state p on symbol...
+		p.state->addAction( Action::SHIFT, (*i).sym, q.state, 0 );
+	}
+}
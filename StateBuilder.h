@@ -0,0 +1,113 @@
+/// @file StateBuilder.h
+/// @brief Header file for building the LR(0) states on several threads.
+///
+///
+
+//
+// 
+// Copyright  2003-2013 Kimball Thurston
+// 
+// This program is free software; you can redisribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+// 
+//
+
+#ifndef _StateBuilder_h_
+#define _StateBuilder_h_
+
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <atomic>
+#include <cstddef>
+
+#include "ConfigList.h"
+
+class Config;
+class State;
+
+
+////////////////////////////////////////
+
+
+/// Builds the LR(0) automaton a frontier at a time.  Worker threads
+/// compute the closure and the successor bases of every state in the
+/// frontier, then the new bases are matched up against the known
+/// states.  Once everything is found, the states are created by a
+/// depth first walk that numbers and links them exactly like the
+/// serial construction in Grammar::getNextState.
+class StateBuilder
+{
+public:
+	StateBuilder( size_t numJobs, bool propagate );
+	~StateBuilder( void );
+	
+	/// Builds every state reachable from the sorted start basis and
+	/// adds them to the StateTable.
+	void build( Config *startBasis );
+	
+private:
+	typedef std::vector< Config * >	ConfigVec;
+	
+	struct Edge
+	{
+		Edge( void );
+		Edge( const Edge &other );
+		~Edge( void );
+		
+		size_t		 sym;
+		Config		*front;		// owns the basis copy until matched
+		Config		*basis;
+		ConfigVec	 sources;	// backward link of each basis config
+		size_t		 target;
+	};
+	typedef std::vector< Edge >	EdgeList;
+	
+	struct Pending
+	{
+		Pending( void );
+		~Pending( void );
+		
+		Config				*basis;
+		Config				*config;
+		EdgeList			 edges;
+		ConfigList::ErrorList errors;
+		State				*state;
+	};
+	typedef std::deque< Pending >	PendingList;
+	
+	typedef std::vector< size_t >	IndexList;
+	typedef std::unordered_map< size_t, IndexList >	BasisIndex;
+	
+	size_t addPending( Config *basis );
+	size_t findPending( const Config *basis ) const;
+	
+	void expandLevel( size_t begin, size_t end );
+	void work( size_t job );
+	void expand( Pending &p, ConfigList &list );
+	void matchLevel( size_t begin, size_t end );
+	void createState( size_t idx );
+	
+	size_t		myNumJobs;
+	bool		myPropagate;
+	
+	PendingList	myPending;
+	BasisIndex	myIndex;
+	
+	std::vector< ConfigList >	myLists;
+	std::atomic< size_t >		myNextPending;
+	size_t						myLevelEnd;
+};
+
+#endif /* _StateBuilder_h_ */
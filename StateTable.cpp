@@ -23,7 +23,7 @@
 // 
 //
 
-#include <map>
+#include <unordered_map>
 #include <vector>
 #include <ostream>
 
@@ -32,16 +32,27 @@
 #include "State.h"
 #include "Config.h"
 #include "Rule.h"
+#include "Arena.h"
 
 
 ////////////////////////////////////////
 
 
-typedef std::vector< State * >		StateList;
+typedef Arena< State >::Index		StateRef;
+typedef std::vector< StateRef >		StateList;
 typedef StateList::iterator			StateListIter;
 typedef StateList::const_iterator	StateListConstIter;
 
-static StateList theStateList;
+// States bucketed by the hash of their (sorted) basis
+typedef std::unordered_map< size_t, StateList >	StateIndex;
+typedef StateIndex::const_iterator				StateIndexConstIter;
+
+static Arena< State > theStates;
+static StateIndex theStateIndex;
+
+// Table row of every state, and the state standing for every row
+static std::vector< size_t > theTableIndex;
+static StateList theTableStates;
 
 static StateTable *theStateTable = 0;
 
@@ -49,6 +60,48 @@ static StateTable *theStateTable = 0;
 ////////////////////////////////////////
 
 
+/// Hash of the (rule index, dot) sequence of a basis chain.
+size_t
+StateTable::hashBasis( const Config *bp )
+{
+	size_t h = 14695981039346656037ULL;
+	
+	for ( ; bp; bp = bp->getNextBasis() )
+	{
+		h = ( h ^ bp->getRule()->getRuleIndex() ) * 1099511628211ULL;
+		h = ( h ^ size_t( bp->getDot() ) ) * 1099511628211ULL;
+	}
+	
+	return h;
+}
+
+
+////////////////////////////////////////
+
+
+bool
+StateTable::sameBasis( const Config *a, const Config *b )
+{
+	while ( a && b )
+	{
+		if ( ( a->getRule()->getRuleIndex() !=
+			   b->getRule()->getRuleIndex() ) ||
+			 ( a->getDot() != b->getDot() ) )
+		{
+			return false;
+		}
+		
+		a = a->getNextBasis();
+		b = b->getNextBasis();
+	}
+	
+	return a == b;
+}
+
+
+////////////////////////////////////////
+
+
 StateTable::StateTable( void )
 {
 }
@@ -68,65 +121,50 @@ StateTable::~StateTable( void )
 State *
 StateTable::find( const Config *bp ) const
 {
-	StateListConstIter i, e;
-	State	*retval = 0;
-
 	if ( bp == NULL )
 		return NULL;
 
-	e = theStateList.end();
-	for ( i = theStateList.begin(); ! retval && i != e; ++i )
-	{
-		const Config *sbp = (*i)->getBasis();
-		const Config *tbp = bp;
-		
-		bool same = true;
-		
-		while ( tbp && sbp )
-		{
-			if ( ( tbp->getRule()->getRuleIndex() !=
-				   sbp->getRule()->getRuleIndex() ) ||
-				 ( tbp->getDot() != sbp->getDot() ) )
-			{
-				same = false;
-				break;
-			}
-			
-			tbp = tbp->getNextBasis();
-			sbp = sbp->getNextBasis();
-		}
+	StateIndexConstIter bucket = theStateIndex.find( hashBasis( bp ) );
+	if ( bucket == theStateIndex.end() )
+		return NULL;
 
-		if ( ( tbp && ! sbp ) || ( ! tbp && sbp ) )
-			same = false;
+	StateListConstIter i, e;
 
-		if ( same )
-		{
-			retval = (*i);
-			break;
-		}
+	e = (*bucket).second.end();
+	for ( i = (*bucket).second.begin(); i != e; ++i )
+	{
+		if ( sameBasis( theStates[*i].getBasis(), bp ) )
+			return &theStates[*i];
 	}
-	
-	return retval;
+
+	return NULL;
 }
 
 
 ////////////////////////////////////////
 
 
-bool
-StateTable::add( State *newState )
+State *
+StateTable::add( Config *basis, Config *config )
 {
-	if ( ! newState )
-		return false;
+	if ( find( basis ) )
+		return NULL;
+
+	StateRef i = theStates.create( int( theStates.size() ), basis, config );
+	theStateIndex[ hashBasis( basis ) ].push_back( i );
+	return &theStates[i];
+}
+
+
+////////////////////////////////////////
 
-	if ( find( newState->getBasis() ) )
-		return false;
 
-	theStateList.push_back( newState );
-//	privStateKey key = privStateKey( newState->getBasis() );
-//	
-//	theStateMap[key] = newState;
-	return true;
+State *
+StateTable::append( void )
+{
+	Config *none = 0;
+	
+	return &theStates[theStates.create( int( theStates.size() ), none, none )];
 }
 
 
@@ -136,7 +174,7 @@ StateTable::add( State *newState )
 size_t
 StateTable::getNumStates( void ) const
 {
-	return theStateList.size();
+	return theStates.size();
 }
 
 
@@ -146,7 +184,62 @@ StateTable::getNumStates( void ) const
 State *
 StateTable::getNthState( size_t i ) const
 {
-	return i < theStateList.size() ? theStateList[i] : 0;
+	return i < theStates.size() ? &theStates[StateRef( i )] : 0;
+}
+
+
+////////////////////////////////////////
+
+
+void
+StateTable::setTableIndex( const std::vector< size_t > &rows )
+{
+	size_t i, N;
+
+	theTableIndex = rows;
+	theTableStates.clear();
+
+	N = rows.size();
+	for ( i = 0; i < N; ++i )
+	{
+		if ( rows[i] == theTableStates.size() )
+			theTableStates.push_back( StateRef( i ) );
+	}
+}
+
+
+////////////////////////////////////////
+
+
+size_t
+StateTable::getNumTableStates( void ) const
+{
+	return theTableIndex.empty() ? theStates.size() : theTableStates.size();
+}
+
+
+////////////////////////////////////////
+
+
+State *
+StateTable::getNthTableState( size_t i ) const
+{
+	if ( theTableIndex.empty() )
+		return getNthState( i );
+
+	return i < theTableStates.size() ? &theStates[theTableStates[i]] : 0;
+}
+
+
+////////////////////////////////////////
+
+
+size_t
+StateTable::getTableIndex( const State *stp ) const
+{
+	size_t i = size_t( stp->getStateIndex() );
+
+	return i < theTableIndex.size() ? theTableIndex[i] : i;
 }
 
 
@@ -156,12 +249,12 @@ StateTable::getNthState( size_t i ) const
 void
 StateTable::print( std::ostream &out, bool basisOnly ) const
 {
-	StateListConstIter i, e;
+	size_t i, N;
 	
-	e = theStateList.end();
-	for ( i = theStateList.begin(); i != e; ++i )
+	N = theStates.size();
+	for ( i = 0; i < N; ++i )
 	{
-		(*i)->print( out, basisOnly );
+		theStates[StateRef( i )].print( out, basisOnly );
 		out << std::endl;
 	}
 }
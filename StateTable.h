@@ -27,6 +27,8 @@
 #define _StateTable_h_
 
 #include <iosfwd>
+#include <cstddef>
+#include <vector>
 
 class Config;
 class State;
@@ -42,13 +44,33 @@ public:
 	~StateTable( void );
 	
 	State *find( const Config *b ) const;
-	bool add( State *newState );
+	/// Creates the next state, returns NULL if a state with the same
+	/// basis already exists.
+	State *add( Config *basis, Config *config );
+	/// Creates the next state without any configurations, for tables
+	/// restored from a cache (such a state can not be found).
+	State *append( void );
 	
 	size_t getNumStates( void ) const;
 	State *getNthState( size_t i ) const;
 	
+	/// Numbers every state by the row it gets in the generated tables,
+	/// states with the same row number are equivalent and share the
+	/// row of the lowest numbered one.  Without a call, every state
+	/// has a row of its own.
+	void setTableIndex( const std::vector< size_t > &rows );
+	size_t getNumTableStates( void ) const;
+	/// The state whose actions make up table row i
+	State *getNthTableState( size_t i ) const;
+	size_t getTableIndex( const State *stp ) const;
+	
 	void print( std::ostream &out, bool basisOnly ) const;
 	
+	/// Hash and comparison of (sorted) basis chains, as used to look
+	/// up the states.
+	static size_t hashBasis( const Config *bp );
+	static bool sameBasis( const Config *a, const Config *b );
+	
 	static StateTable *get( void );
 };
 
@@ -117,9 +117,9 @@ Symbol::setAssoc( Symbol::Assoc newtype )
 
 
 bool
-Symbol::setFirstSet( const std::string &fs )
+Symbol::setFirstSet( size_t symIdx )
 {
-	return myFirstSet.add( fs );
+	return myFirstSet.add( symIdx );
 }
 
 
@@ -136,6 +136,16 @@ Symbol::unionFirstSet( const Symbol &other )
 ////////////////////////////////////////
 
 
+bool
+Symbol::unionFirstSet( const FollowSet &set )
+{
+	return myFirstSet.combine( set );
+}
+
+
+////////////////////////////////////////
+
+
 void
 Symbol::setLambda( bool on_off )
 {
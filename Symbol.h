@@ -75,9 +75,10 @@ public:
 	inline Assoc getAssoc( void ) const;
 	
 	// Returns true if actually changes
-	bool setFirstSet( const std::string &fs );
+	bool setFirstSet( size_t symIdx );
 	// Returns true if actually changes
 	bool unionFirstSet( const Symbol &other );
+	bool unionFirstSet( const FollowSet &set );
 	inline const FollowSet &getFirstSet( void ) const;
 	
 	// true if NT and can generate an empty string
@@ -24,6 +24,7 @@
 //
 
 #include <stdexcept>
+#include <algorithm>
 
 #include "SymbolTable.h"
 #include "Symbol.h"
@@ -33,7 +34,7 @@
 
 
 SymbolTable::SymbolTable( void )
-		: myNumTerminals( 1 ), myDefaultAdded( false )
+		: myNumTerminals( 1 ), myFrozen( false ), myDefaultAdded( false )
 {
 }
 
@@ -58,11 +59,12 @@ SymbolTable::findOrCreate( const std::string &name )
 	i = mySymbols.find( name );
 	if ( i == mySymbols.end() )
 	{
+		if ( myFrozen )
+			throw std::logic_error( "Symbol created after the symbol table was frozen" );
+		
 		retval = new Symbol( name );
 		mySymbols[ name ] = retval;
 		
-		reindex();
-		
 		if ( Symbol::TERMINAL == retval->getType() )
 			++myNumTerminals;
 	}
@@ -107,8 +109,6 @@ SymbolTable::addDefault( const std::string &name )
 		Symbol *tmp = new Symbol( name );
 		myDefaultSymbol = name;
 		mySymbols[ name ] = tmp;
-		
-		reindex();
 	}
 	else
 		throw std::logic_error( "Default Symbol collides with existing symbol" );
@@ -140,6 +140,61 @@ SymbolTable::getDefault( void ) const
 ////////////////////////////////////////
 
 
+class symFreezeComp
+{
+public:
+	symFreezeComp( const std::string &defName ) : myDefName( defName ) {}
+	
+	bool operator()( const Symbol *a, const Symbol *b ) const
+	{
+		int ga = group( a );
+		int gb = group( b );
+		
+		return ( ga == gb ) ? a->getName() < b->getName() : ga < gb;
+	}
+	
+private:
+	int group( const Symbol *sp ) const
+	{
+		if ( sp->getName() == "$" )
+			return 0;
+		if ( sp->getName() == myDefName )
+			return 3;
+		return Symbol::TERMINAL == sp->getType() ? 1 : 2;
+	}
+	
+	const std::string &myDefName;
+};
+
+
+////////////////////////////////////////
+
+
+void
+SymbolTable::freeze( void )
+{
+	SymbolMapIter mi, me;
+	size_t i, N;
+	
+	myIndexedSymbols.clear();
+	myIndexedSymbols.reserve( mySymbols.size() );
+	for ( mi = mySymbols.begin(), me = mySymbols.end(); mi != me; ++mi )
+		myIndexedSymbols.push_back( (*mi).second );
+	
+	std::sort( myIndexedSymbols.begin(), myIndexedSymbols.end(),
+			   symFreezeComp( myDefaultSymbol ) );
+	
+	N = myIndexedSymbols.size();
+	for ( i = 0; i < N; ++i )
+		myIndexedSymbols[i]->setIndex( i );
+	
+	myFrozen = true;
+}
+
+
+////////////////////////////////////////
+
+
 size_t
 SymbolTable::getNumSymbols( void )
 {
@@ -154,21 +209,7 @@ SymbolTable::getNumSymbols( void )
 Symbol *
 SymbolTable::getNthSymbol( size_t i )
 {
-	Symbol *retval = 0;
-	
-	if ( i < mySymbols.size() )
-	{
-		SymbolMapIter mi = mySymbols.begin();
-		while ( i > 0 )
-		{
-			++mi;
-			--i;
-		}
-		
-		retval = (*mi).second;
-	}
-	
-	return retval;
+	return i < myIndexedSymbols.size() ? myIndexedSymbols[i] : 0;
 }
 	 
 
@@ -185,30 +226,23 @@ SymbolTable::getNumTerminals( void )
 ////////////////////////////////////////
 
 
-static SymbolTable *theSymTable = 0;
-
-SymbolTable *
-SymbolTable::get( void )
+size_t
+SymbolTable::getNumNonTerminals( void )
 {
-	if ( ! theSymTable )
-		theSymTable = new SymbolTable;
-	
-	return theSymTable;
+	return getNumSymbols() - myNumTerminals;
 }
 
 
 ////////////////////////////////////////
 
 
-void
-SymbolTable::reindex( void )
+static SymbolTable *theSymTable = 0;
+
+SymbolTable *
+SymbolTable::get( void )
 {
-	SymbolMapIter mi = mySymbols.begin();
-	SymbolMapIter me = mySymbols.end();
-	size_t curidx = 0;
+	if ( ! theSymTable )
+		theSymTable = new SymbolTable;
 	
-	for ( ; mi != me; ++mi )
-		(*mi).second->setIndex( curidx++ );
+	return theSymTable;
 }
-
-
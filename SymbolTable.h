@@ -26,7 +26,8 @@
 #ifndef _SymbolTable_h_
 #define _SymbolTable_h_
 
-#include <map>
+#include <unordered_map>
+#include <vector>
 #include <string>
 
 class Symbol;
@@ -35,6 +36,9 @@ class Symbol;
 ////////////////////////////////////////
 
 
+/// Symbols are collected in a hash table while the grammar is read.
+/// Once reading is done the table is frozen, which assigns every symbol
+/// its final index and lays the symbols out in a flat array.
 class SymbolTable
 {
 public:
@@ -42,6 +46,7 @@ public:
 	~SymbolTable( void );
 	
 	/// Looks up a symbol name, creating one if it doesn't exist yet.
+	/// New symbols can not be created once the table is frozen.
 	Symbol	*findOrCreate( const std::string &name );
 	// Looks up symbol, returns NULL if it doesn't exist.
 	Symbol	*find( const std::string &name ) const;
@@ -50,27 +55,42 @@ public:
 	const std::string &getDefaultName( void ) const;
 	Symbol *getDefault( void ) const;
 	
-	/// Access the symbols directly
+	/// Assigns the final symbol indices: "$" first, then the
+	/// terminals, then the nonterminals (each by name) and the
+	/// default symbol last.
+	void freeze( void );
+	inline bool isFrozen( void ) const;
+	
+	/// Access the symbols directly (once frozen)
 	size_t getNumSymbols( void );
 	Symbol *getNthSymbol( size_t i );
 	
-	/// Convenience routines
+	/// Convenience routines; the terminal count includes "$" and
+	/// the nonterminal count includes error but not the default.
 	size_t getNumTerminals( void );
+	size_t getNumNonTerminals( void );
 	
 	static SymbolTable *get( void );
 	
 private:
-	void reindex( void );
+	typedef std::unordered_map< std::string, Symbol * >	SymbolMap;
+	typedef SymbolMap::iterator							SymbolMapIter;
+	typedef SymbolMap::const_iterator					SymbolMapConstIter;
 	
-	typedef std::map< std::string, Symbol *>	SymbolMap;
-	typedef SymbolMap::iterator					SymbolMapIter;
-	typedef SymbolMap::const_iterator			SymbolMapConstIter;
+	typedef std::vector< Symbol * >		SymbolList;
 	
 	SymbolMap	mySymbols;
+	SymbolList	myIndexedSymbols;
 	size_t		myNumTerminals;
+	bool		myFrozen;
 	bool		myDefaultAdded;
 	std::string myDefaultSymbol;
 };
 
-#endif /* _SymbolTable_h_ */
 
+////////////////////////////////////////
+
+
+inline bool SymbolTable::isFrozen( void ) const { return myFrozen; }
+
+#endif /* _SymbolTable_h_ */
@@ -0,0 +1,266 @@
+/// @file TableCache.cpp
+/// @brief Implementation of caching the parser tables between runs.
+///
+///
+
+//
+// 
+// Copyright  2003-2013 Kimball Thurston
+// 
+// This program is free software; you can redisribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+// 
+//
+
+#include <sstream>
+#include <fstream>
+#include <vector>
+
+#include "TableCache.h"
+
+#include "Action.h"
+#include "ActionList.h"
+#include "Rule.h"
+#include "RuleTable.h"
+#include "State.h"
+#include "StateTable.h"
+#include "Symbol.h"
+#include "SymbolTable.h"
+#include "Util.h"
+#include "Version.h"
+
+
+////////////////////////////////////////
+
+
+// Bump whenever the layout below or the table construction changes
+static const char *kMagic = "lime-tables";
+static const int kFormat = 2;
+
+static const uint64_t kNoIndex = uint64_t( -1 );
+
+
+////////////////////////////////////////
+
+
+/// A cached action, with states and rules by index
+struct CachedAction
+{
+	int			type;
+	uint64_t	lookAhead;
+	uint64_t	state;
+	uint64_t	rule;
+};
+
+
+////////////////////////////////////////
+
+
+TableCache::TableCache( const std::string &fileName )
+		: myFileName( fileName ), myKey( 14695981039346656037ULL )
+{
+}
+
+
+////////////////////////////////////////
+
+
+TableCache::~TableCache( void )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void
+TableCache::hash( const std::string &s )
+{
+	std::string::const_iterator i, e;
+	
+	for ( i = s.begin(), e = s.end(); i != e; ++i )
+		myKey = ( myKey ^ uint64_t( (unsigned char)(*i) ) ) * 1099511628211ULL;
+	
+	// Terminate the string, so "ab","c" and "a","bc" differ
+	myKey = ( myKey ^ 0xffULL ) * 1099511628211ULL;
+}
+
+
+////////////////////////////////////////
+
+
+void
+TableCache::hash( uint64_t v )
+{
+	for ( int i = 0; i < 8; ++i, v >>= 8 )
+		myKey = ( myKey ^ ( v & 0xffULL ) ) * 1099511628211ULL;
+}
+
+
+////////////////////////////////////////
+
+
+void
+TableCache::computeKey( const std::string &startSymbol, bool compress )
+{
+	SymbolTable	*symTable = SymbolTable::get();
+	RuleTable	*ruleTable = RuleTable::get();
+	size_t		 i, n;
+	
+	hash( kMagic );
+	hash( uint64_t( kFormat ) );
+	hash( VersionInfo::appVersion() );
+	hash( uint64_t( compress ) );
+	hash( startSymbol );
+	
+	n = symTable->getNumSymbols();
+	hash( uint64_t( n ) );
+	for ( i = 0; i < n; ++i )
+	{
+		Symbol *sp = symTable->getNthSymbol( i );
+		
+		hash( sp->getName() );
+		hash( uint64_t( sp->getType() ) );
+		hash( uint64_t( int64_t( sp->getPrecedence() ) ) );
+		hash( uint64_t( sp->getAssoc() ) );
+	}
+	
+	n = ruleTable->getNumRules();
+	hash( uint64_t( n ) );
+	for ( i = 0; i < n; ++i )
+	{
+		Rule *rp = ruleTable->getNthRule( i );
+		const Rule::SymbolList &rhs = rp->getRHSSymbols();
+		Rule::SymbolList::const_iterator ri, re;
+		
+		hash( uint64_t( rp->getLHSIndex() ) );
+		hash( uint64_t( rhs.size() ) );
+		for ( ri = rhs.begin(), re = rhs.end(); ri != re; ++ri )
+			hash( uint64_t( *ri ) );
+		hash( uint64_t( rp->getPrecedenceIndex() ) );
+	}
+}
+
+
+////////////////////////////////////////
+
+
+bool
+TableCache::load( void )
+{
+	std::ifstream in( myFileName.c_str() );
+	std::string magic;
+	int format = 0;
+	uint64_t key = 0, nState = 0;
+	
+	if ( ! in.is_open() || StateTable::get()->getNumStates() != 0 )
+		return false;
+	
+	in >> magic >> format >> std::hex >> key >> std::dec >> nState;
+	if ( ! in || magic != kMagic || format != kFormat || key != myKey )
+		return false;
+	
+	// The default actions look ahead at "{default}", past the end
+	size_t nSym = SymbolTable::get()->getNumSymbols() + 1;
+	size_t nRule = RuleTable::get()->getNumRules();
+	
+	// Read everything before touching the state table, a truncated or
+	// damaged file is just a cache miss
+	std::vector< std::vector< CachedAction > > states( nState );
+	std::vector< std::vector< CachedAction > >::iterator si, se;
+	
+	for ( si = states.begin(), se = states.end(); si != se; ++si )
+	{
+		uint64_t nAct = 0;
+		
+		in >> nAct;
+		if ( ! in )
+			return false;
+		
+		for ( uint64_t a = 0; a < nAct; ++a )
+		{
+			CachedAction ca;
+			
+			in >> ca.type >> ca.lookAhead >> ca.state >> ca.rule;
+			if ( ! in || ca.type < 0 || ca.type > int( Action::NOT_USED ) ||
+				 ( ca.lookAhead >= nSym && ca.lookAhead != kNoIndex ) ||
+				 ( ca.state >= nState && ca.state != kNoIndex ) ||
+				 ( ca.rule >= nRule && ca.rule != kNoIndex ) )
+				return false;
+			
+			(*si).push_back( ca );
+		}
+	}
+	
+	for ( si = states.begin(), se = states.end(); si != se; ++si )
+		StateTable::get()->append();
+	
+	size_t i;
+	for ( i = 0, si = states.begin(), se = states.end(); si != se; ++si, ++i )
+	{
+		State *stp = StateTable::get()->getNthState( i );
+		std::vector< CachedAction >::const_iterator ai, ae;
+		
+		for ( ai = (*si).begin(), ae = (*si).end(); ai != ae; ++ai )
+		{
+			const CachedAction &ca = *ai;
+			
+			stp->addAction( Action::Type( ca.type ), size_t( ca.lookAhead ),
+							ca.state == kNoIndex ? 0 :
+							StateTable::get()->getNthState( size_t( ca.state ) ),
+							ca.rule == kNoIndex ? 0 :
+							RuleTable::get()->getNthRule( size_t( ca.rule ) ) );
+		}
+	}
+	
+	return true;
+}
+
+
+////////////////////////////////////////
+
+
+bool
+TableCache::save( void ) const
+{
+	std::ostringstream out;
+	size_t i, j, nState;
+	
+	nState = StateTable::get()->getNumStates();
+	
+	out << kMagic << " " << kFormat << " " << std::hex << myKey << std::dec
+		<< "\n" << nState << "\n";
+	
+	for ( i = 0; i < nState; ++i )
+	{
+		const ActionList &ap = StateTable::get()->getNthState( i )->getActions();
+		size_t nAct = ap.getNumActions();
+		
+		out << nAct;
+		for ( j = 0; j < nAct; ++j )
+		{
+			const Action &act = ap.getNthAction( j );
+			
+			out << " " << int( act.getType() )
+				<< " " << uint64_t( act.getLookAhead() )
+				<< " " << ( act.getState() ?
+							uint64_t( act.getState()->getStateIndex() ) : kNoIndex )
+				<< " " << ( act.getRule() ?
+							uint64_t( act.getRule()->getRuleIndex() ) : kNoIndex );
+		}
+		out << "\n";
+	}
+	
+	return Util::updateFile( myFileName, out.str() );
+}
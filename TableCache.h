@@ -0,0 +1,74 @@
+/// @file TableCache.h
+/// @brief Header file for caching the parser tables between runs.
+///
+///
+
+//
+// 
+// Copyright  2003-2013 Kimball Thurston
+// 
+// This program is free software; you can redisribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+// 
+//
+
+#ifndef _TableCache_h_
+#define _TableCache_h_
+
+#include <string>
+#include <stdint.h>
+
+
+////////////////////////////////////////
+
+
+/// Keeps the states and actions of the last run in a file next to the
+/// output, keyed by a hash of what the tables are built from: the
+/// symbols, their precedences, the rules and the start symbol.  The
+/// rule actions and the %include / %code bodies are not part of the
+/// key, so editing them only reruns the language driver.
+class TableCache
+{
+public:
+	TableCache( const std::string &fileName );
+	~TableCache( void );
+	
+	/// Hashes the (interned) grammar structure
+	void computeKey( const std::string &startSymbol, bool compress );
+	
+	/// Recreates the states and their actions if the cache file was
+	/// written for the same key.  Returns false, having changed
+	/// nothing, otherwise.
+	bool load( void );
+	/// Writes the actions of every state out under the current key
+	bool save( void ) const;
+	
+	inline const std::string &getFileName( void ) const;
+	
+private:
+	void hash( const std::string &s );
+	void hash( uint64_t v );
+	
+	std::string	myFileName;
+	uint64_t	myKey;
+};
+
+
+////////////////////////////////////////
+
+
+inline const std::string &
+TableCache::getFileName( void ) const { return myFileName; }
+
+#endif /* _TableCache_h_ */
@@ -24,6 +24,13 @@
 //
 
 #include <string>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "Util.h"
 
 
@@ -56,3 +63,205 @@ Util::getFileName( std::string			&fileName,
 	fileName.append( baseName );
 	fileName.append( ext );
 }
+
+
+////////////////////////////////////////
+
+
+bool
+Util::updateFile( const std::string &fileName,
+				  const std::string &contents )
+{
+	std::ifstream in( fileName.c_str(), std::ios::in | std::ios::binary );
+	
+	if ( in.is_open() )
+	{
+		std::ostringstream old;
+		old << in.rdbuf();
+		if ( in.good() && old.str() == contents )
+			return true;
+		in.close();
+	}
+	
+	std::ofstream out( fileName.c_str(), std::ios::out | std::ios::binary );
+	if ( ! out.is_open() )
+		return false;
+	
+	out << contents;
+	out.close();
+	
+	return ! out.fail();
+}
+
+
+////////////////////////////////////////
+
+
+Util::OutputFile::OutputFile( void )
+		: myOpen( false )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Util::OutputFile::~OutputFile( void )
+{
+	if ( myOpen )
+		close();
+}
+
+
+////////////////////////////////////////
+
+
+void
+Util::OutputFile::open( const char *fileName )
+{
+	myFileName = fileName;
+	myOpen = true;
+	str( std::string() );
+}
+
+
+////////////////////////////////////////
+
+
+bool
+Util::OutputFile::is_open( void ) const
+{
+	return myOpen;
+}
+
+
+////////////////////////////////////////
+
+
+bool
+Util::OutputFile::close( void )
+{
+	if ( ! myOpen )
+		return false;
+	
+	myOpen = false;
+	return updateFile( myFileName, str() );
+}
+
+
+////////////////////////////////////////
+
+
+bool
+Util::StringRef::operator==( const char *s ) const
+{
+	size_t n = std::strlen( s );
+	
+	return n == size() && 0 == std::memcmp( myBegin, s, n );
+}
+
+
+////////////////////////////////////////
+
+
+std::string
+Util::StringRef::str( void ) const
+{
+	return std::string( myBegin, myEnd );
+}
+
+
+////////////////////////////////////////
+
+
+Util::MappedFile::MappedFile( void )
+		: myData( 0 ), mySize( 0 ), myMapped( false )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Util::MappedFile::~MappedFile( void )
+{
+	close();
+}
+
+
+////////////////////////////////////////
+
+
+bool
+Util::MappedFile::open( const std::string &fileName )
+{
+	struct stat st;
+	bool retval = false;
+	
+	close();
+	
+	int fd = ::open( fileName.c_str(), O_RDONLY );
+	if ( fd < 0 )
+		return false;
+	
+	if ( 0 == fstat( fd, &st ) )
+	{
+		mySize = size_t( st.st_size );
+		if ( mySize == 0 )
+		{
+			myData = myCopy.data();
+			retval = true;
+		}
+		else
+		{
+			void *addr = mmap( 0, mySize, PROT_READ, MAP_PRIVATE, fd, 0 );
+			
+			if ( addr != MAP_FAILED )
+			{
+				myData = static_cast< const char * >( addr );
+				myMapped = true;
+				retval = true;
+			}
+			else
+			{
+				// Some files can not be mapped, read those in instead
+				size_t got = 0;
+				
+				myCopy.resize( mySize );
+				while ( got < mySize )
+				{
+					ssize_t n = ::read( fd, &myCopy[got], mySize - got );
+					if ( n <= 0 )
+						break;
+					got += size_t( n );
+				}
+				
+				myData = myCopy.data();
+				retval = ( got == mySize );
+			}
+		}
+	}
+	
+	::close( fd );
+	
+	if ( ! retval )
+		close();
+	
+	return retval;
+}
+
+
+////////////////////////////////////////
+
+
+void
+Util::MappedFile::close( void )
+{
+	if ( myMapped )
+		munmap( const_cast< char * >( myData ), mySize );
+	
+	myData = 0;
+	mySize = 0;
+	myMapped = false;
+	myCopy.clear();
+}
@@ -26,6 +26,9 @@
 #ifndef _Util_h_
 #define _Util_h_
 
+#include <string>
+#include <sstream>
+
 
 ////////////////////////////////////////
 
@@ -36,7 +39,107 @@ namespace Util
 					  const std::string	&outputDir,
 					  const std::string	&srcFile,
 					  const char		*ext );
+	
+	/// Writes contents to fileName, unless the file already holds
+	/// exactly that (so its time stamp only moves when it changes and
+	/// make does not rebuild what depends on it).  Returns false if
+	/// the file could not be written.
+	bool updateFile( const std::string &fileName,
+					 const std::string &contents );
+	
+	/// Stands in for std::ofstream when generating files: the output
+	/// is kept in memory and handed to updateFile on close.
+	class OutputFile : public std::ostringstream
+	{
+	public:
+		OutputFile( void );
+		~OutputFile( void );
+		
+		void open( const char *fileName );
+		bool is_open( void ) const;
+		/// Returns false if the file could not be written
+		bool close( void );
+		
+	private:
+		std::string myFileName;
+		bool		myOpen;
+	};
+	
+	/// A span of characters in a buffer owned by someone else, such as
+	/// a MappedFile (std::string_view, for C++11).  Nothing is copied
+	/// until str() is called.
+	class StringRef
+	{
+	public:
+		inline StringRef( void );
+		inline StringRef( const char *begin, const char *end );
+		
+		inline const char *begin( void ) const;
+		inline const char *end( void ) const;
+		inline size_t size( void ) const;
+		inline bool empty( void ) const;
+		inline char operator[]( size_t i ) const;
+		
+		inline void dropFront( size_t n );
+		inline void dropBack( size_t n );
+		
+		bool operator==( const char *s ) const;
+		inline bool operator!=( const char *s ) const;
+		
+		std::string str( void ) const;
+		
+	private:
+		const char *myBegin;
+		const char *myEnd;
+	};
+	
+	/// Read-only view of a whole file, mapped into memory when
+	/// possible and read in otherwise.
+	class MappedFile
+	{
+	public:
+		MappedFile( void );
+		~MappedFile( void );
+		
+		/// Returns false if the file could not be opened or read
+		bool open( const std::string &fileName );
+		void close( void );
+		
+		inline const char *begin( void ) const;
+		inline const char *end( void ) const;
+		inline size_t size( void ) const;
+		
+	private:
+		MappedFile( const MappedFile & );
+		MappedFile &operator=( const MappedFile & );
+		
+		const char	*myData;
+		size_t		 mySize;
+		bool		 myMapped;
+		std::string	 myCopy;
+	};
 }
 
+
+////////////////////////////////////////
+
+
+inline Util::StringRef::StringRef( void ) : myBegin( 0 ), myEnd( 0 ) {}
+inline Util::StringRef::StringRef( const char *begin, const char *end )
+		: myBegin( begin ), myEnd( end ) {}
+inline const char *Util::StringRef::begin( void ) const { return myBegin; }
+inline const char *Util::StringRef::end( void ) const { return myEnd; }
+inline size_t Util::StringRef::size( void ) const { return size_t( myEnd - myBegin ); }
+inline bool Util::StringRef::empty( void ) const { return myBegin == myEnd; }
+inline char Util::StringRef::operator[]( size_t i ) const { return myBegin[i]; }
+inline void Util::StringRef::dropFront( size_t n ) { myBegin += n; }
+inline void Util::StringRef::dropBack( size_t n ) { myEnd -= n; }
+inline bool
+Util::StringRef::operator!=( const char *s ) const { return ! ( *this == s ); }
+
+inline const char *Util::MappedFile::begin( void ) const { return myData; }
+inline const char *Util::MappedFile::end( void ) const { return myData + mySize; }
+inline size_t Util::MappedFile::size( void ) const { return mySize; }
+
 #endif /* _Util_h_ */
 
@@ -25,7 +25,6 @@
 
 #include <algorithm>
 #include <functional>
-#include <fstream>
 #include <sstream>
 #include <iostream>
 #include <ctype.h>
@@ -43,7 +42,7 @@ std::ostream &
 operator<<( std::ostream &os, ZDriverOutHelp out )
 {
 	out.myOut->incOutLine();
-	return std::flush( os.put( os.widen( '\n' ) ) );
+	return os.put( os.widen( '\n' ) );
 }
 
 
@@ -108,7 +107,7 @@ ZDriver::writeHeader( void )
 	const std::string &tokenType = getValue( "token_type" ).first;
 	const std::string &prefix = getValue( "token_prefix" ).first;
 	std::string fileName = getOutputDir();
-	std::ofstream out;
+	Util::OutputFile out;
 	bool isOk = false;
 
 	getFileName( fileName, ".h" );
@@ -173,8 +172,8 @@ ZDriver::writeHeader( void )
 		out << "class " << getParserName() << endl() << "{" << endl()
 			<< "public:" << endl();
 
-		// Generate the terminal tokens that the lexer will feed us
-		int idx = 1;
+		// Generate the terminal tokens that the lexer will feed us;
+		// their values are the action table columns directly.
 
 		nSym = SymbolTable::get()->getNumSymbols();
 		out << endl() << "    enum Terminal" << endl() << "    {" << endl();
@@ -186,8 +185,8 @@ ZDriver::writeHeader( void )
 			if ( Symbol::TERMINAL == sp->getType() )
 			{
 				out << "," << endl();
-				out << "        " << prefix << sp->getName() << " = " << idx;
-				++idx;
+				out << "        " << prefix << sp->getName() << " = "
+					<< sp->getIndex();
 			}
 		}
 		out << endl() << "    };";
@@ -224,8 +223,7 @@ ZDriver::writeHeader( void )
 		myCurLineNum += std::count_if( nsEnd.begin(), nsEnd.end(),
 									   std::bind2nd( std::equal_to<char>(), '\n' ) );
 		out << "#endif /* " << poundDef << " */ " << endl();
-		out.close();
-		isOk = true;
+		isOk = out.close();
 	}
 
 	return isOk;
@@ -238,7 +236,7 @@ ZDriver::writeHeader( void )
 bool
 ZDriver::writeSource( void )
 {
-	std::ofstream out;
+	Util::OutputFile out;
 	bool isOk = false;
 
 	getFileName( myFileName, ".cpp" );
@@ -264,7 +262,8 @@ ZDriver::writeSource( void )
 		Util::getFileName( incName, std::string(), getSourceFile(), ".h" );
 		out << endl() << "#include \"" << incName << "\"" << endl();
 
-		out << endl() << "#include <utility>" << endl();
+		out << endl() << "#include <algorithm>" << endl();
+		out << "#include <utility>" << endl();
 		out << "#include <stack>" << endl();
 		out << "#include <map>" << endl();
 		out << "#include <vector>" << endl();
@@ -291,7 +290,7 @@ ZDriver::writeSource( void )
 		writeErrorRoutines( out );
 		emitValue( getValue( "code" ), out );
 
-		isOk = true;
+		isOk = out.close();
 	}
 
 	return isOk;
@@ -436,12 +435,13 @@ ZDriver::writeStateTableDecl( std::ostream &out )
 {
 	out << endl() << endl();
 	out << "    typedef std::pair<ParserAct,int> ActionEntry;" << endl();
-	out << "    typedef std::map<int,ActionEntry> ActionMap;" << endl();
-	out << "    typedef std::vector<ActionMap> StateList;" << endl();
-	out << "    typedef std::vector<ActionEntry> StateDefaultList;" << endl();
+	out << "    typedef std::vector<ActionEntry> ActionTable;" << endl();
 	out << endl();
-	out << "    StateList myStates;" << endl();
-	out << "    StateDefaultList myStateDefaultActions;" << endl();
+	out << "    // One dense row of "
+		<< SymbolTable::get()->getNumTerminals()
+		<< " terminal actions per state; the gotos live in their own table"
+		<< endl();
+	out << "    ActionTable myActions;" << endl();
 }
 
 
@@ -452,38 +452,48 @@ void
 ZDriver::buildStateTable( std::ostream &out )
 {
 	size_t i, j, nState, nAct, nTotal;
+	size_t defIdx = SymbolTable::get()->getDefault()->getIndex();
+	size_t nTerm = SymbolTable::get()->getNumTerminals();
 
-	nState = StateTable::get()->getNumStates();
+	nState = StateTable::get()->getNumTableStates();
 
 	// Count all actions
 	nTotal = 0;
 	for ( i = 0; i < nState; ++i )
 	{
-		State		*stp = StateTable::get()->getNthState(i);
+		State		*stp = StateTable::get()->getNthTableState(i);
 		ActionList	&ap = stp->getActions();
 
 		nAct = ap.getNumActions();
 		for ( j = 0; j < nAct; ++j )
 		{
 			Action &act = ap.getNthAction( j );
-			if ( ! act.isIgnoreType() )
-				nTotal++;
-			if ( act.getLookAhead() == SymbolTable::get()->getDefaultName() )
+			if ( ( ! act.isIgnoreType() && act.getLookAhead() < nTerm ) ||
+				 act.getLookAhead() == defIdx )
 				nTotal++;
 		}
 	}
 
 
-	out << "    myStates.assign( " << nState << ", ActionMap() );" << endl();
-	out << "    myStateDefaultActions.assign( " << nState
+	out << "    myActions.assign( " << nState * nTerm
 		<< ", ActionEntry(PA_ERROR,-2) );" << endl();
-
+	out << endl();
+	out << "    // Spread the default actions over their rows first, then"
+		<< endl();
+	out << "    // overwrite the explicit entries" << endl();
 	out << "    for ( int i = 0; i < " << nTotal << "; ++i )" << endl();
 	out << "    {" << endl();
 	out << "        if ( theStateTable[i][1] == -1 )" << endl();
-	out << "            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);" << endl();
-	out << "        else" << endl();
-	out << "            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);" << endl();
+	out << "            std::fill_n( myActions.begin() + theStateTable[i][0] * "
+		<< nTerm << ", " << nTerm << "," << endl();
+	out << "                         ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]) );" << endl();
+	out << "    }" << endl();
+	out << "    for ( int i = 0; i < " << nTotal << "; ++i )" << endl();
+	out << "    {" << endl();
+	out << "        if ( theStateTable[i][1] != -1 )" << endl();
+	out << "            myActions[theStateTable[i][0] * " << nTerm
+		<< " + theStateTable[i][1]] =" << endl();
+	out << "                ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);" << endl();
 	out << "    }" << endl();
 }
 
@@ -495,23 +505,24 @@ void
 ZDriver::writeStateTable( std::ostream &out )
 {
 	size_t i, j, nState, nAct, nTotal;
+	size_t defIdx = SymbolTable::get()->getDefault()->getIndex();
+	size_t nTerm = SymbolTable::get()->getNumTerminals();
 
-	nState = StateTable::get()->getNumStates();
+	nState = StateTable::get()->getNumTableStates();
 
 	// Count all actions
 	nTotal = 0;
 	for ( i = 0; i < nState; ++i )
 	{
-		State		*stp = StateTable::get()->getNthState(i);
+		State		*stp = StateTable::get()->getNthTableState(i);
 		ActionList	&ap = stp->getActions();
 
 		nAct = ap.getNumActions();
 		for ( j = 0; j < nAct; ++j )
 		{
 			Action &act = ap.getNthAction( j );
-			if ( ! act.isIgnoreType() )
-				nTotal++;
-			if ( act.getLookAhead() == SymbolTable::get()->getDefaultName() )
+			if ( ( ! act.isIgnoreType() && act.getLookAhead() < nTerm ) ||
+				 act.getLookAhead() == defIdx )
 				nTotal++;
 		}
 	}
@@ -521,7 +532,7 @@ ZDriver::writeStateTable( std::ostream &out )
 
 	for ( i = 0; i < nState; ++i )
 	{
-		State		*stp = StateTable::get()->getNthState(i);
+		State		*stp = StateTable::get()->getNthTableState(i);
 		ActionList	&ap = stp->getActions();
 
 		nAct = ap.getNumActions();
@@ -529,15 +540,15 @@ ZDriver::writeStateTable( std::ostream &out )
 		{
 			Action &act = ap.getNthAction( j );
 
-			if ( ! act.isIgnoreType() )
+			if ( ! act.isIgnoreType() && act.getLookAhead() < nTerm )
 			{
 				out << "    // State " << i << endl();
-				out << "    { " << i << ", " << act.getLookAheadSymbol()->getIndex() << ", ";
+				out << "    { " << i << ", " << act.getLookAhead() << ", ";
 				emitAction( act, out );
 				out << " }," << endl();
 			}
 
-			if ( act.getLookAhead() == SymbolTable::get()->getDefaultName() )
+			if ( act.getLookAhead() == defIdx )
 			{
 				out << "    // State " << i << " default action" << endl();
 				out << "    { " << i << ", " << -1 << ", ";
@@ -585,8 +596,8 @@ ZDriver::writeRuleTable( std::ostream &out )
 		out << "    // ";
 		rp->print( out );
 		out << endl();
-		out << "    { " << rp->getLHSSymbol()->getIndex()
-			<< ", " << rp->getRHS().size() << " }, " << endl();
+		out << "    { " << rp->getLHSIndex()
+			<< ", " << rp->getRHSSize() << " }, " << endl();
 	}
 
 	out << "};" << endl();
@@ -615,6 +626,79 @@ ZDriver::buildRuleTable( std::ostream &out )
 ////////////////////////////////////////
 
 
+void
+ZDriver::writeGotoTable( std::ostream &out )
+{
+	std::vector< int > defaults;
+	std::vector< GotoList > exceptions;
+	size_t i, j, nCol, nExc;
+	size_t nTerm = SymbolTable::get()->getNumTerminals();
+	
+	getGotoTable( defaults, exceptions );
+	nCol = defaults.size();
+	
+	out << endl() << endl();
+	out << "// Goto table, one row per nonterminal: the state most predecessors"
+		<< endl();
+	out << "// go to (-1 for none) and the range of theGotoExceptions that"
+		<< endl();
+	out << "// overrides it, sorted by state" << endl();
+	out << "static const int theGotoColumns[" << nCol << "][3] =" << endl();
+	out << "{" << endl();
+	for ( i = 0, nExc = 0; i < nCol; ++i )
+	{
+		Symbol *sp = SymbolTable::get()->getNthSymbol( i + nTerm );
+		
+		out << "    // " << sp->getName() << endl();
+		out << "    { " << defaults[i] << ", " << nExc << ", "
+			<< nExc + exceptions[i].size() << " }," << endl();
+		nExc += exceptions[i].size();
+	}
+	out << "};" << endl();
+	
+	out << endl();
+	out << "static const int theGotoExceptions[" << ( nExc ? nExc : 1 )
+		<< "][2] =" << endl();
+	out << "{" << endl();
+	if ( nExc == 0 )
+		out << "    { -1, -1 }," << endl();
+	for ( i = 0; i < nCol; ++i )
+	{
+		for ( j = 0; j < exceptions[i].size(); ++j )
+		{
+			out << "    { " << exceptions[i][j].first << ", "
+				<< exceptions[i][j].second << " }," << endl();
+		}
+	}
+	out << "};" << endl();
+	
+	emitFuncBreak( out );
+	out << "int " << myPimplName << "::findGoto( int sym, int stateNum )"
+		<< endl();
+	out << "{" << endl();
+	out << "    const int *col = theGotoColumns[sym - " << nTerm << "];" << endl();
+	out << "    int lo = col[1], hi = col[2];" << endl();
+	out << endl();
+	out << "    while ( lo < hi )" << endl();
+	out << "    {" << endl();
+	out << "        int mid = ( lo + hi ) / 2;" << endl();
+	out << "        if ( theGotoExceptions[mid][0] < stateNum )" << endl();
+	out << "            lo = mid + 1;" << endl();
+	out << "        else" << endl();
+	out << "            hi = mid;" << endl();
+	out << "    }" << endl();
+	out << endl();
+	out << "    if ( lo < col[2] && theGotoExceptions[lo][0] == stateNum )"
+		<< endl();
+	out << "        return theGotoExceptions[lo][1];" << endl();
+	out << "    return col[0];" << endl();
+	out << "}" << endl();
+}
+
+
+////////////////////////////////////////
+
+
 void
 ZDriver::writeMainParserFunc( std::ostream &out )
 {
@@ -754,7 +838,6 @@ ZDriver::writeReduceFunc( std::ostream &out )
 		out << "    std::cout << \"REDUCE rule \" << ruleNum << std::endl;"
 			<< endl();
 	out << "    int newVal;" << endl();
-	out << "    ParserAct next;" << endl();
 	out << "    Util::Any data;" << endl();
 	out << "    std::vector< Util::Any > rhsData;" << endl() << endl();
 	out << "    rhsData.reserve( myRules[ruleNum].second );" << endl();
@@ -772,7 +855,8 @@ ZDriver::writeReduceFunc( std::ostream &out )
 	out << "    }" << endl();
 
 	out << endl();
-    out << "    next = findParserAction( newVal, myRules[ruleNum].first );"
+	out << "    newVal = findGoto( myRules[ruleNum].first," << endl();
+	out << "                       myStack.empty() ? 0 : myStack.top().first.first );"
 		<< endl();
 
 	out << endl();
@@ -800,7 +884,7 @@ ZDriver::writeReduceFunc( std::ostream &out )
 	out << "    }" << endl();
 
 	out << endl();
-	out << "    if ( PA_SHIFT == next )" << endl();
+	out << "    if ( newVal >= 0 )" << endl();
 	out << "        shift( newVal, myRules[ruleNum].first, data );" << endl();
 	if ( isValueSet( "parse_accept" ) )
 	{
@@ -936,6 +1020,7 @@ ZDriver::writeParserUtilDecl( std::ostream &out )
 	out << "    void popStack( void );" << endl();
 	out << "    ParserAct findParserAction( int &newVal, int tok );"
 		<< endl();
+	out << "    int findGoto( int sym, int stateNum );" << endl();
 	out << "    void initTables( void );" << endl();
 }
 
@@ -946,6 +1031,9 @@ ZDriver::writeParserUtilDecl( std::ostream &out )
 void
 ZDriver::writeParserUtil( std::ostream &out )
 {
+	size_t nTerm = SymbolTable::get()->getNumTerminals();
+	size_t nNonTerm = SymbolTable::get()->getNumNonTerminals();
+
 	emitFuncBreak( out );
 	out << "void " << myPimplName << "::popStack( void )" << endl();
 	out << "{" << endl();
@@ -958,44 +1046,35 @@ ZDriver::writeParserUtil( std::ostream &out )
 	out << "ParserAct " << myPimplName
 		<< "::findParserAction( int &newVal, int tok )" << endl();
 	out << "{" << endl();
+	out << "    const ActionEntry *entry;" << endl();
 	out << "    int stateNum;" << endl();
-	out << "    ParserAct retval = PA_NOP;" << endl();
-	out << "    bool found = false;" << endl();
 	out << endl();
 	out << "    stateNum = myStack.empty() ? 0 : myStack.top().first.first;"
 		<< endl();
-	out << "    ActionMap::iterator i = myStates[stateNum].find( tok );"
+	out << "    if ( tok >= 0 && tok < " << nTerm << " )" << endl();
+	out << "        entry = &myActions[stateNum * " << nTerm << " + tok];"
 		<< endl();
-	out << "    if ( tok >= 0 && tok <= "
-		<< SymbolTable::get()->getNumSymbols() << " )" << endl();
+	out << "    else if ( tok >= " << nTerm << " && tok < "
+		<< nTerm + nNonTerm << " )" << endl();
 	out << "    {" << endl();
-	out << "        if ( i != myStates[stateNum].end() )" << endl();
-	out << "        {" << endl();
-	out << "            retval = (*i).second.first;" << endl();
-	out << "            newVal = (*i).second.second;" << endl();
-	out << "            found = true;" << endl();
-	out << "        }" << endl();
+	out << "        newVal = findGoto( tok, stateNum );" << endl();
+	out << "        return newVal >= 0 ? PA_SHIFT : PA_ERROR;" << endl();
 	out << "    }" << endl();
-	out << "    else if ( ! myStates[stateNum].empty() )" << endl();
+	out << "    else" << endl();
 	out << "    {" << endl();
-	out << "        retval = PA_NOP;" << endl();
 	out << "        newVal = 0;" << endl();
-	out << "        found = true;" << endl();
+	out << "        return PA_NOP;" << endl();
 	out << "    }" << endl();
 	out << endl();
-	out << "    if ( ! found )" << endl();
-	out << "    {" << endl();
-	out << "        retval = myStateDefaultActions[stateNum].first;" << endl();
-	out << "        newVal = myStateDefaultActions[stateNum].second;" << endl();
-	out << "    }" << endl();
-
-	out << "    return retval;" << endl();
+	out << "    newVal = entry->second;" << endl();
+	out << "    return entry->first;" << endl();
 	out << "}" << endl();
 
 	emitFuncBreak( out );
 
 	writeStateTable( out );
 	writeRuleTable( out );
+	writeGotoTable( out );
 
 	emitFuncBreak( out );
 
@@ -1125,7 +1204,7 @@ ZDriver::emitErrorHandling( std::ostream &out )
 	out << indent << "}" << endl();
 
 	Symbol *errsp = SymbolTable::get()->find( "error" );
-	out << indent << "if ( myStack.top().first.first == " << errsp->getIndex()
+	out << indent << "if ( myStack.top().first.second == " << errsp->getIndex()
 		<< " || errHit )" << endl();
 	out << indent << "{" << endl();
 	out << indent << "    callDtor( static_cast<int>(tok), data );" << endl();
@@ -1134,7 +1213,7 @@ ZDriver::emitErrorHandling( std::ostream &out )
 	out << indent << "else" << endl();
 	out << indent << "{" << endl();
 	out << indent << "    while ( ! myStack.empty() &&" << endl();
-	out << indent << "            myStack.top().first.first != "
+	out << indent << "            myStack.top().first.second != "
 		<< errsp->getIndex() << " )" << endl();
 	out << indent << "    {" << endl();
 	out << indent << "        action = findParserAction( actVal, "
@@ -1154,7 +1233,7 @@ ZDriver::emitErrorHandling( std::ostream &out )
 	out << ");" << endl();
 	out << indent << "        done = true;" << endl();
 	out << indent << "    }" << endl();
-	out << indent << "    else if ( myStack.top().first.first != "
+	out << indent << "    else if ( myStack.top().first.second != "
 		<< errsp->getIndex() << " )" << endl();
 	out << indent << "    {" << endl();
 	out << indent << "        data = static_cast<void *>(0);"
@@ -1234,7 +1313,7 @@ ZDriver::emitAction( const Action &act, std::ostream &out )
 	{
 		case Action::SHIFT:
 			out << "PA_SHIFT, "
-				<< act.getState()->getStateIndex();
+				<< StateTable::get()->getTableIndex( act.getState() );
 			break;
 
 		case Action::REDUCE:
@@ -1263,43 +1342,22 @@ ZDriver::emitAction( const Action &act, std::ostream &out )
 void
 ZDriver::emitRule( const Rule *rp, std::ostream &out )
 {
-	std::string rpCode = rp->getCode();
-	std::string::size_type curPos;
+	std::string rpCode;
 	int codeLine = rp->getCodeLine();
-
-	while ( rpCode[0] == ' ' || rpCode[0] == '\t' || rpCode[0] == '\n' )
-	{
-		if ( rpCode[0] == '\n' )
-			++codeLine;
-		rpCode.erase( rpCode.begin() );
-	}
+	size_t nLines = indentCode( rp->getCode(), codeLine, rpCode );
 
 	emitLineInfo( getSourceFile(), codeLine, out );
 
 	const Rule::RHSList &rhs = rp->getRHS();
+	const Rule::SymbolList &rhsSyms = rp->getRHSSymbols();
 	Rule::RHSListConstIter ri, re;
 
 	if ( ! rpCode.empty() )
 	{
-		curPos = 0;
-		rpCode.insert( curPos, "            " );
-		while ( curPos != std::string::npos )
-		{
-			curPos = rpCode.find( '\n', curPos );
-			if ( curPos != std::string::npos )
-			{
-				incOutLine();
-				++curPos;
-				rpCode.insert( curPos, "        " );
-			}
-		}
-
-		while ( rpCode[rpCode.size() - 1] == ' ' ||
-				rpCode[rpCode.size() - 1] == '\t' )
-			rpCode.erase( rpCode.end() - 1 );
+		myCurLineNum += nLines;
 
 		std::string replStr = "Util::any_cast< ";
-		Symbol *lhsSym = SymbolTable::get()->find( rp->getLHS() );
+		Symbol *lhsSym = rp->getLHSSymbol();
 		replStr.append( lhsSym->getDataType() );
 		replStr.append( " >( data )" );
 		substCode( rpCode, rp->getLHSAlias(), replStr, true,
@@ -1309,7 +1367,8 @@ ZDriver::emitRule( const Rule *rp, std::ostream &out )
 		
 		for ( ri = rhs.begin(), re = rhs.end(); ri != re; ++ri )
 		{
-			Symbol *sp = SymbolTable::get()->find( (*ri).first );
+			Symbol *sp = SymbolTable::get()->getNthSymbol(
+				rhsSyms[ri - rhs.begin()] );
 			const std::string &dataType = sp->getDataType();
 			std::ostringstream tmpOut;
 			
@@ -1331,12 +1390,16 @@ ZDriver::emitRule( const Rule *rp, std::ostream &out )
 
 	emitLineInfo( myFileName, getOutLine(), out );
 
+	// A unit rule without code hands the value of its symbol on, the
+	// same as when its reduction is bypassed
+	if ( rp->isUnitCopy() && rpCode.empty() )
+		out << "            data = rhsData[0];" << endl();
+
 	for ( ri = rhs.begin(), re = rhs.end(); ri != re; ++ri )
 	{
-		Symbol *sp = SymbolTable::get()->find( (*ri).first );
 		if ( (*ri).second.empty() )
 		{
-			out << "            callDtor( " << sp->getIndex()
+			out << "            callDtor( " << rhsSyms[ri - rhs.begin()]
 				<< ", rhsData[" << ( ri - rhs.begin() )
 				<< "] );" << endl();
 		}
@@ -1357,6 +1420,10 @@ ZDriver::substCode( std::string			&codeStr,
 	if ( var.empty() )
 		return;
 
+	// Build the result in one pass rather than replacing in place,
+	// which shifts the rest of the code on every match
+	std::string result;
+	std::string::size_type prevPos = 0;
 	std::string::size_type curPos = codeStr.find( var );
 	while ( curPos != std::string::npos )
 	{
@@ -1369,6 +1436,9 @@ ZDriver::substCode( std::string			&codeStr,
 			ep = curPos + var.size();
 			if ( ! ( isalnum( codeStr[ep] ) || '_' == codeStr[ep] ) )
 			{
+				result.append( codeStr, prevPos, curPos - prevPos );
+				prevPos = ep;
+
 				if ( lhs )
 				{
 					std::string::size_type cp = ep;
@@ -1376,18 +1446,16 @@ ZDriver::substCode( std::string			&codeStr,
 						++cp;
 					if ( codeStr[cp] == '=' && codeStr[cp + 1] != '=' )
 					{
-						std::string::size_type replSize =
-							var.size() + ( cp - ep ) + 1;
-						std::string realRepl = "data = (";
-						realRepl.append( lhsType );
-						realRepl.push_back( ')' );
-						codeStr.replace( curPos, replSize, realRepl );
+						result.append( "data = (" );
+						result.append( lhsType );
+						result.push_back( ')' );
+						prevPos = ep = cp + 1;
 					}
 					else
-						codeStr.replace( curPos, var.size(), replName );
+						result.append( replName );
 				}
 				else
-					codeStr.replace( curPos, var.size(), replName );
+					result.append( replName );
 			}
 
 			curPos = codeStr.find( var, ep );
@@ -1395,6 +1463,12 @@ ZDriver::substCode( std::string			&codeStr,
 		else
 			curPos = codeStr.find( var, curPos + 1 );
 	}
+
+	if ( prevPos == 0 )
+		return;
+
+	result.append( codeStr, prevPos, std::string::npos );
+	codeStr.swap( result );
 }
 
 
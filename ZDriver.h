@@ -61,6 +61,7 @@ private:
 	void writeRuleTableDecl( std::ostream &out );
 	void writeRuleTable( std::ostream &out );
 	void buildRuleTable( std::ostream &out );
+	void writeGotoTable( std::ostream &out );
 	void writeMainParserFunc( std::ostream &out );
 	void writeShiftFuncDecl( std::ostream &out );
 	void writeShiftFunc( std::ostream &out );
@@ -0,0 +1,702 @@
+/// @file Bench.cpp
+/// @brief Synthetic grammar generator and scaling benchmark for lime.
+///
+///
+
+//
+// 
+// Copyright  2003-2013 Kimball Thurston
+// 
+// This program is free software; you can redisribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+// 
+//
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <getopt.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <sys/stat.h>
+
+
+////////////////////////////////////////
+
+
+/// Writes a grammar of (roughly) the given number of rules
+typedef void (*Generator)( std::ostream &out, size_t rules );
+
+struct Shape
+{
+	const char	*name;
+	Generator	 gen;
+	size_t		 maxRules;	// the larger sizes are skipped
+};
+
+/// One lime run
+struct Result
+{
+	Result( void );
+	Result( const Result &other );
+	~Result( void );
+	Result &operator=( const Result &other );
+	
+	std::string	shape;
+	size_t		rules;
+	double		wallMs;
+	long		rssKB;
+	size_t		states;
+	size_t		entries;
+	
+	typedef std::vector< std::pair< std::string, double > > PhaseList;
+	PhaseList	phases;
+};
+
+typedef std::vector< Result >	ResultList;
+
+static const size_t kSizes[] = { 10, 100, 1000, 10000 };
+
+
+////////////////////////////////////////
+
+
+Result::Result( void )
+		: rules( 0 ), wallMs( 0 ), rssKB( 0 ), states( 0 ), entries( 0 )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Result::Result( const Result &other )
+		: shape( other.shape ), rules( other.rules ), wallMs( other.wallMs ),
+		  rssKB( other.rssKB ), states( other.states ), entries( other.entries ),
+		  phases( other.phases )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Result::~Result( void )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Result &
+Result::operator=( const Result &other )
+{
+	shape = other.shape;
+	rules = other.rules;
+	wallMs = other.wallMs;
+	rssKB = other.rssKB;
+	states = other.states;
+	entries = other.entries;
+	phases = other.phases;
+	
+	return *this;
+}
+
+
+////////////////////////////////////////
+
+
+static void
+header( std::ostream &out, const char *shape, size_t rules )
+{
+	out << "// " << shape << ", " << rules << " rules, generated by lime-bench\n"
+		<< "%name Bench\n"
+		<< "%token_type { int }\n"
+		<< "%syntax_error { }\n"
+		<< "%parse_failure { }\n\n";
+}
+
+
+////////////////////////////////////////
+
+
+/// A deep precedence hierarchy, one nonterminal per level:
+///   e_i ::= e_i OP_i e_i+1.   e_i ::= e_i+1.
+static void
+genExpr( std::ostream &out, size_t rules )
+{
+	size_t i, levels = rules > 5 ? ( rules - 3 ) / 2 : 1;
+	
+	header( out, "expr", rules );
+	out << "prog ::= e0.\n";
+	for ( i = 0; i < levels; ++i )
+	{
+		out << "e" << i << " ::= e" << i << " OP" << i << " e" << i + 1 << ".\n"
+			<< "e" << i << " ::= e" << i + 1 << ".\n";
+	}
+	out << "e" << levels << " ::= NUM.\n"
+		<< "e" << levels << " ::= LP e0 RP.\n";
+}
+
+
+////////////////////////////////////////
+
+
+/// A statement list with one alternative per keyword, over a small
+/// shared expression language
+static void
+genWide( std::ostream &out, size_t rules )
+{
+	size_t i, n = rules > 12 ? rules - 8 : 4;
+	
+	header( out, "wide", rules );
+	out << "prog ::= stmts.\n"
+		<< "stmts ::= .\n"
+		<< "stmts ::= stmts stmt SEMI.\n"
+		<< "expr ::= expr PLUS term.\n"
+		<< "expr ::= term.\n"
+		<< "term ::= ID.\n"
+		<< "term ::= NUM.\n"
+		<< "term ::= LP expr RP.\n";
+	for ( i = 0; i < n; ++i )
+		out << "stmt ::= KW" << i << " expr.\n";
+}
+
+
+////////////////////////////////////////
+
+
+/// Long right hand sides: every item is a run of terminals, the first
+/// three spell out the item number so the runs share their prefixes
+/// (and the lookaheads stay few)
+static void
+genSeq( std::ostream &out, size_t rules )
+{
+	const size_t len = 12;
+	size_t i, j, n = rules > 4 ? rules - 3 : 1;
+	
+	header( out, "seq", rules );
+	out << "prog ::= items.\n"
+		<< "items ::= items item.\n"
+		<< "items ::= item.\n";
+	for ( i = 0; i < n; ++i )
+	{
+		out << "item ::= K" << i % 32 << " T" << ( i / 32 ) % 64
+			<< " T" << ( i / 2048 ) % 64;
+		for ( j = 3; j < len; ++j )
+			out << " T" << ( i + j ) % 64;
+		out << ".\n";
+	}
+}
+
+
+////////////////////////////////////////
+
+
+/// Blocks of optional items: every item can vanish, so most of the
+/// lookaheads come through nullable symbols
+static void
+genNullable( std::ostream &out, size_t rules )
+{
+	const size_t width = 8;
+	size_t g, k, blocks = rules > 2 * width + 3 ? ( rules - 2 ) / ( 2 * width + 1 ) : 1;
+	
+	header( out, "nullable", rules );
+	out << "prog ::= blocks.\n"
+		<< "blocks ::= .\n"
+		<< "blocks ::= blocks block.\n";
+	for ( g = 0; g < blocks; ++g )
+	{
+		out << "block ::= B" << g;
+		for ( k = 0; k < width; ++k )
+			out << " o" << g << "_" << k;
+		out << " END.\n";
+		
+		for ( k = 0; k < width; ++k )
+		{
+			out << "o" << g << "_" << k << " ::= .\n"
+				<< "o" << g << "_" << k << " ::= A" << k << ".\n";
+		}
+	}
+}
+
+
+////////////////////////////////////////
+
+
+/// Lists nested inside lists, each level with its own brackets
+static void
+genLists( std::ostream &out, size_t rules )
+{
+	size_t i, depth = rules > 8 ? ( rules - 1 ) / 4 : 2;
+	
+	header( out, "lists", rules );
+	out << "prog ::= list0.\n";
+	for ( i = 0; i < depth; ++i )
+	{
+		out << "list" << i << " ::= list" << i << " COMMA elem" << i << ".\n"
+			<< "list" << i << " ::= elem" << i << ".\n"
+			<< "elem" << i << " ::= ATOM" << i << ".\n";
+		if ( i + 1 < depth )
+			out << "elem" << i << " ::= LP" << i << " list" << i + 1 << " RP" << i << ".\n";
+		else
+			out << "elem" << i << " ::= LP" << i << " RP" << i << ".\n";
+	}
+}
+
+
+////////////////////////////////////////
+
+
+// Every level of the expression hierarchy closes over all the levels
+// below it, so its closure items grow with the square of the depth
+// and the 10000 rule run would dominate the suite.
+static const Shape kShapes[] =
+{
+	{ "expr", genExpr, 1000 },
+	{ "wide", genWide, 10000 },
+	{ "seq", genSeq, 10000 },
+	{ "nullable", genNullable, 10000 },
+	{ "lists", genLists, 10000 },
+};
+
+
+////////////////////////////////////////
+
+
+/// Returns the number following "key": in the JSON written by
+/// lime --profile, starting the search at pos
+static bool
+findNumber( const std::string &json, const std::string &key,
+			size_t &pos, double &value )
+{
+	std::string pat = "\"" + key + "\": ";
+	size_t p = json.find( pat, pos );
+	
+	if ( p == std::string::npos )
+		return false;
+	
+	p += pat.size();
+	value = std::strtod( json.c_str() + p, 0 );
+	pos = p;
+	return true;
+}
+
+
+////////////////////////////////////////
+
+
+static bool
+readProfile( const std::string &fileName, Result &r )
+{
+	std::ifstream in( fileName.c_str() );
+	std::ostringstream buf;
+	double v = 0;
+	size_t pos;
+	
+	if ( ! in.is_open() )
+		return false;
+	
+	buf << in.rdbuf();
+	const std::string &json = buf.str();
+	
+	pos = 0;
+	if ( ! findNumber( json, "states", pos, v ) )
+		return false;
+	r.states = size_t( v );
+	
+	pos = 0;
+	if ( ! findNumber( json, "table entries", pos, v ) )
+		return false;
+	r.entries = size_t( v );
+	
+	// Phases: { "name": "x", "start_us": 0, "wall_us": 0, ... }
+	std::string nameKey = "\"name\": \"";
+	pos = json.find( nameKey );
+	while ( pos != std::string::npos )
+	{
+		size_t s = pos + nameKey.size();
+		size_t e = json.find( '"', s );
+		
+		pos = e;
+		if ( e == std::string::npos || ! findNumber( json, "wall_us", pos, v ) )
+			break;
+		
+		r.phases.push_back( std::make_pair( json.substr( s, e - s ), v / 1000.0 ) );
+		pos = json.find( nameKey, pos );
+	}
+	
+	return true;
+}
+
+
+////////////////////////////////////////
+
+
+/// Runs lime on the grammar, with its output thrown away, and fills in
+/// the wall time and peak RSS of the run along with what lime reports
+static bool
+runLime( const std::string &lime, const std::string &grammar,
+		 const std::string &workDir, Result &r )
+{
+	std::string profile = workDir + "/profile.json";
+	std::string profArg = "--profile=" + profile;
+	
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	pid_t pid = fork();
+	
+	if ( pid < 0 )
+		return false;
+	
+	if ( pid == 0 )
+	{
+		int devNull = open( "/dev/null", O_WRONLY );
+		if ( devNull >= 0 )
+		{
+			dup2( devNull, 1 );
+			dup2( devNull, 2 );
+		}
+		
+		execl( lime.c_str(), lime.c_str(), "--no-cache", profArg.c_str(),
+			   grammar.c_str(), workDir.c_str(), (char *)0 );
+		_exit( 127 );
+	}
+	
+	int status = 0;
+	struct rusage usage;
+	
+	if ( wait4( pid, &status, 0, &usage ) != pid )
+		return false;
+	
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	
+	// lime exits with the number of conflicts, the grammars have none
+	if ( ! WIFEXITED( status ) || WEXITSTATUS( status ) != 0 )
+		return false;
+	
+	r.wallMs = double( std::chrono::duration_cast< std::chrono::microseconds >(
+						   end - start ).count() ) / 1000.0;
+	r.rssKB = usage.ru_maxrss;
+	
+	return readProfile( profile, r );
+}
+
+
+////////////////////////////////////////
+
+
+static void
+writeResults( std::ostream &out, const ResultList &results )
+{
+	ResultList::const_iterator i, e;
+	
+	out << "# shape rules wall_ms rss_kb states table_entries\n";
+	for ( i = results.begin(), e = results.end(); i != e; ++i )
+	{
+		out << (*i).shape << " " << (*i).rules << " "
+			<< std::fixed << std::setprecision( 2 ) << (*i).wallMs << " "
+			<< (*i).rssKB << " " << (*i).states << " " << (*i).entries << "\n";
+	}
+}
+
+
+////////////////////////////////////////
+
+
+static bool
+readResults( const std::string &fileName, ResultList &results )
+{
+	std::ifstream in( fileName.c_str() );
+	std::string line;
+	
+	if ( ! in.is_open() )
+		return false;
+	
+	while ( std::getline( in, line ) )
+	{
+		if ( line.empty() || line[0] == '#' )
+			continue;
+		
+		std::istringstream fields( line );
+		Result r;
+		
+		fields >> r.shape >> r.rules >> r.wallMs >> r.rssKB >> r.states >> r.entries;
+		if ( fields )
+			results.push_back( r );
+	}
+	
+	return true;
+}
+
+
+////////////////////////////////////////
+
+
+/// Compares every run against the baseline run of the same shape and
+/// size.  Time and RSS may grow by the tolerance (and by a small
+/// absolute amount, for the runs that are all noise), the table may
+/// not grow at all.
+static int
+compareResults( const ResultList &results, const ResultList &baseline,
+				double tolerance )
+{
+	ResultList::const_iterator i, e, b, be;
+	int regressions = 0;
+	
+	for ( i = results.begin(), e = results.end(); i != e; ++i )
+	{
+		for ( b = baseline.begin(), be = baseline.end(); b != be; ++b )
+		{
+			if ( (*b).shape == (*i).shape && (*b).rules == (*i).rules )
+				break;
+		}
+		
+		if ( b == be )
+			continue;
+		
+		std::ostringstream why;
+		
+		if ( (*i).wallMs > (*b).wallMs * ( 1.0 + tolerance ) &&
+			 (*i).wallMs - (*b).wallMs > 20.0 )
+			why << " time " << (*b).wallMs << " -> " << (*i).wallMs << " ms";
+		
+		if ( double( (*i).rssKB ) > double( (*b).rssKB ) * ( 1.0 + tolerance ) &&
+			 (*i).rssKB - (*b).rssKB > 2048 )
+			why << " rss " << (*b).rssKB << " -> " << (*i).rssKB << " KB";
+		
+		if ( (*i).entries > (*b).entries )
+			why << " table " << (*b).entries << " -> " << (*i).entries << " entries";
+		
+		if ( ! why.str().empty() )
+		{
+			std::cout << "REGRESSION " << (*i).shape << " " << (*i).rules
+					  << ":" << why.str() << std::endl;
+			++regressions;
+		}
+	}
+	
+	return regressions;
+}
+
+
+////////////////////////////////////////
+
+
+static void
+usageAndExit( const char *appName, int exitVal )
+{
+	std::cout << "Usage:\n" << appName <<
+		" [--lime path] [--work dir] [--runs n] [--max-rules n]\n"
+		"  [--shape name] [--baseline file] [--record file] [--tolerance pct]\n"
+		"  [--emit shape:rules]\n\n"
+		" --lime=<path>             lime binary to time (default ./lime).\n"
+		" --work=<dir>              Where the grammars and outputs go\n"
+		"                           (default bench/work).\n"
+		" --runs=<n>                Runs per grammar, the fastest counts (3).\n"
+		" --max-rules=<n>           Skip the grammars larger than this.\n"
+		" --shape=<name>            Only run one shape: expr, wide, seq,\n"
+		"                           nullable or lists.\n"
+		" --baseline=<file>         Fail if a run regresses past this file.\n"
+		" --record=<file>           Save the results as the new baseline.\n"
+		" --tolerance=<pct>         Allowed growth in time and RSS (25).\n"
+		" --emit=<shape>:<rules>    Print a grammar to standard out and exit.\n"
+			  << std::endl;
+	std::exit( exitVal );
+}
+
+
+////////////////////////////////////////
+
+
+int
+main( int argc, char *argv[] )
+{
+	static struct option long_options[] =
+		{
+			{ "lime", 1, 0, 'l' },
+			{ "work", 1, 0, 'w' },
+			{ "runs", 1, 0, 'r' },
+			{ "max-rules", 1, 0, 'm' },
+			{ "shape", 1, 0, 's' },
+			{ "baseline", 1, 0, 'b' },
+			{ "record", 1, 0, 'R' },
+			{ "tolerance", 1, 0, 't' },
+			{ "emit", 1, 0, 'e' },
+			{ "help", 0, 0, 'h' },
+			{ 0, 0, 0, 0 }
+		};
+	
+	std::string lime = "./lime", workDir = "bench/work";
+	std::string onlyShape, baselineFile, recordFile, emit;
+	size_t runs = 3, maxRules = size_t( -1 );
+	double tolerance = 0.25;
+	size_t nShapes = sizeof( kShapes ) / sizeof( kShapes[0] );
+	size_t nSizes = sizeof( kSizes ) / sizeof( kSizes[0] );
+	size_t s, z;
+	
+	while ( 1 )
+	{
+		int c = getopt_long( argc, argv, "l:w:r:m:s:b:R:t:e:h", long_options, 0 );
+		
+		if ( c == -1 )
+			break;
+		
+		switch ( c )
+		{
+			case 'l': lime = optarg; break;
+			case 'w': workDir = optarg; break;
+			case 'r': runs = size_t( std::strtoul( optarg, 0, 10 ) ); break;
+			case 'm': maxRules = size_t( std::strtoul( optarg, 0, 10 ) ); break;
+			case 's': onlyShape = optarg; break;
+			case 'b': baselineFile = optarg; break;
+			case 'R': recordFile = optarg; break;
+			case 't': tolerance = std::strtod( optarg, 0 ) / 100.0; break;
+			case 'e': emit = optarg; break;
+			case 'h': usageAndExit( argv[0], 0 ); break;
+			default: usageAndExit( argv[0], 1 ); break;
+		}
+	}
+	
+	if ( optind != argc || runs == 0 )
+		usageAndExit( argv[0], 1 );
+	
+	if ( ! emit.empty() )
+	{
+		std::string::size_type colon = emit.find( ':' );
+		std::string name = emit.substr( 0, colon );
+		
+		for ( s = 0; s < nShapes; ++s )
+		{
+			if ( name == kShapes[s].name && colon != std::string::npos )
+			{
+				kShapes[s].gen( std::cout,
+								size_t( std::strtoul( emit.c_str() + colon + 1, 0, 10 ) ) );
+				return 0;
+			}
+		}
+		usageAndExit( argv[0], 1 );
+	}
+	
+	mkdir( workDir.c_str(), 0777 );
+	
+	ResultList results;
+	int failures = 0;
+	
+	std::cout << std::left << std::setw( 10 ) << "shape" << std::right
+			  << std::setw( 7 ) << "rules" << std::setw( 12 ) << "wall ms"
+			  << std::setw( 10 ) << "rss KB" << std::setw( 9 ) << "states"
+			  << std::setw( 10 ) << "entries" << "  slowest phase" << std::endl;
+	
+	for ( s = 0; s < nShapes; ++s )
+	{
+		const Shape &shape = kShapes[s];
+		
+		if ( ! onlyShape.empty() && onlyShape != shape.name )
+			continue;
+		
+		for ( z = 0; z < nSizes; ++z )
+		{
+			size_t rules = kSizes[z];
+			
+			if ( rules > shape.maxRules || rules > maxRules )
+				continue;
+			
+			std::ostringstream name;
+			name << workDir << "/" << shape.name << "_" << rules << ".lem";
+			
+			std::ofstream out( name.str().c_str() );
+			shape.gen( out, rules );
+			out.close();
+			
+			Result best;
+			bool ok = false;
+			
+			for ( size_t run = 0; run < runs; ++run )
+			{
+				Result r;
+				r.shape = shape.name;
+				r.rules = rules;
+				
+				if ( ! runLime( lime, name.str(), workDir, r ) )
+				{
+					ok = false;
+					break;
+				}
+				
+				if ( ! ok || r.wallMs < best.wallMs )
+					best = r;
+				ok = true;
+			}
+			
+			if ( ! ok )
+			{
+				std::cout << "FAILED " << shape.name << " " << rules << std::endl;
+				++failures;
+				continue;
+			}
+			
+			Result::PhaseList::const_iterator pi, pe, slow;
+			slow = best.phases.end();
+			for ( pi = best.phases.begin(), pe = best.phases.end(); pi != pe; ++pi )
+			{
+				if ( slow == pe || (*pi).second > (*slow).second )
+					slow = pi;
+			}
+			
+			std::cout << std::left << std::setw( 10 ) << best.shape << std::right
+					  << std::setw( 7 ) << best.rules
+					  << std::setw( 12 ) << std::fixed << std::setprecision( 2 )
+					  << best.wallMs << std::setw( 10 ) << best.rssKB
+					  << std::setw( 9 ) << best.states
+					  << std::setw( 10 ) << best.entries;
+			if ( slow != best.phases.end() )
+				std::cout << "  " << (*slow).first << " " << (*slow).second << " ms";
+			std::cout << std::endl;
+			
+			results.push_back( best );
+		}
+	}
+	
+	if ( ! recordFile.empty() )
+	{
+		std::ofstream out( recordFile.c_str() );
+		writeResults( out, results );
+		std::cout << "Baseline saved to " << recordFile << std::endl;
+	}
+	
+	if ( ! baselineFile.empty() )
+	{
+		ResultList baseline;
+		
+		if ( readResults( baselineFile, baseline ) )
+			failures += compareResults( results, baseline, tolerance );
+		else
+			std::cout << "No baseline in " << baselineFile
+					  << ", record one with make bench-baseline" << std::endl;
+	}
+	
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,40 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        LP = 1,
+        NUM = 2,
+        OP0 = 3,
+        OP1 = 4,
+        OP2 = 5,
+        RP = 6
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
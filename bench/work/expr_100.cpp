@@ -0,0 +1,4943 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#include <utility>
+#include <stack>
+#include <map>
+#include <vector>
+#include <iostream>
+
+
+#include "expr_100.h"
+
+enum ParserAct
+{
+    PA_SHIFT,
+    PA_REDUCE,
+    PA_ERROR,
+    PA_ACCEPT,
+    PA_NOP
+};
+
+class privBenchImpl
+{
+public:
+
+    privBenchImpl( void );
+    ~privBenchImpl( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    struct Value
+    {
+        union
+        {
+            int tokenType;
+            int errorType;
+        };
+    };
+    // first is stack num, second is the symbol index
+    typedef std::pair<int,int> StackID;
+    typedef std::pair<StackID,Value> StackEntry;
+    typedef std::stack<StackEntry> ParseStack;
+
+    void shift( int newState, int symIdx, Value &data );
+    void reduce( int ruleNum );
+    void callDtor( int symIdx, Value &data );
+    void popStack( void );
+    ParserAct findParserAction( int &newVal, int tok );
+    void initTables( void );
+    void syntaxError( Bench::Terminal tok, Value &data );
+    void parseFailed( void );
+
+    ParseStack myStack;
+    int myErrCount;
+
+
+    typedef std::pair<ParserAct,int> ActionEntry;
+    typedef std::map<int,ActionEntry> ActionMap;
+    typedef std::vector<ActionMap> StateList;
+    typedef std::vector<ActionEntry> StateDefaultList;
+
+    StateList myStates;
+    StateDefaultList myStateDefaultActions;
+
+
+    // first is LHS, second is number of RHS
+    typedef std::pair<int,int> RuleInfo;
+    typedef std::vector<RuleInfo> RuleList;
+
+    RuleList myRules;
+};
+
+
+////////////////////////////////////////
+
+
+Bench::Bench( void )
+    : myImplementation( new privBenchImpl )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Bench::~Bench( void )
+{
+    delete myImplementation;
+}
+
+
+////////////////////////////////////////
+
+
+void Bench::parse( Bench::Terminal tok, int value )
+{
+    myImplementation->parse( tok, value );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parse( Bench::Terminal tok, int value )
+{
+    int actVal;
+    ParserAct action;
+    bool errHit = false;
+    bool eoInput = (tok == Bench::EOF );
+    bool done = false;
+
+    if ( myStack.empty() )
+    {
+        if ( eoInput )
+            return;
+
+        myErrCount = -1;
+    }
+
+    privBenchImpl::Value data;
+    data.tokenType = value;
+
+    do
+    {
+        action = findParserAction( actVal, tok );
+        if ( PA_SHIFT == action )
+        {
+            shift( actVal, tok, data );
+            --myErrCount;
+            if ( eoInput && ! myStack.empty() )
+                tok = Bench::EOF;
+            else
+                done = true;
+        }
+        else if ( PA_REDUCE == action )
+        {
+            reduce( actVal );
+        }
+        else if ( PA_ERROR == action )
+        {
+            // Syntax error handling:
+            // 1. Call the %syntax_error function.
+            // 2. Pop stack until a state where we can shift the err symbol.
+            // 3. Shift the error symbol.
+            // 4. Set error count to three.
+            // 5. Begin accepting and shifting new tokens.
+            // 6. No new error processing will begin until 3 tokens are successful.
+            if ( myErrCount < 0 )
+            {
+                syntaxError( tok, data );
+            }
+            if ( myStack.top().first.first == 101 || errHit )
+            {
+                callDtor( static_cast<int>(tok), data );
+                done = true;
+            }
+            else
+            {
+                while ( ! myStack.empty() &&
+                        myStack.top().first.first != 101 )
+                {
+                    action = findParserAction( actVal, 101 );
+                    if ( action == PA_SHIFT )
+                        break;
+                    popStack();
+                }
+                if ( myStack.empty() || tok == Bench::EOF )
+                {
+                    callDtor( static_cast<int>(tok), data );
+                    parseFailed();
+                    done = true;
+                }
+                else if ( myStack.top().first.first != 101 )
+                {
+                    data.errorType = 0;
+                    shift( actVal, 101, data );
+                }
+            }
+            myErrCount = 3;
+            errHit = true;
+        }
+        else // ACCEPT == action || NOP == action
+        {
+            done = true;
+        }
+    } while ( ! done && ! myStack.empty() );
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::privBenchImpl( void )
+    : myErrCount( -1 )
+{
+    initTables();
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::~privBenchImpl( void )
+{
+    while ( ! myStack.empty() )
+        popStack();
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::shift( int newState, int symIdx, privBenchImpl::Value &data )
+{
+    StackEntry newItem = StackEntry( StackID( newState, symIdx ), data );
+    myStack.push( newItem );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::reduce( int ruleNum )
+{
+    int newVal;
+    ParserAct next;
+    privBenchImpl::Value data = { 0 };
+    std::vector<privBenchImpl::Value> rhsData;
+    for ( int i = 0, N = myRules[ruleNum].second; i != N; ++i )
+    {
+        if ( myStack.empty() )
+            rhsData.insert( rhsData.begin(), data );
+        else
+        {
+            rhsData.insert( rhsData.begin(), myStack.top().second );
+            myStack.pop();
+        }
+    }
+
+    next = findParserAction( newVal, myRules[ruleNum].first );
+
+    switch ( ruleNum )
+    {
+        case 0:
+        {
+            // prog ::= e0
+#line 0 "bench/work/expr_100.lem"
+#line 250 "bench/work/expr_100.cpp"
+            callDtor( 52, rhsData[0] );
+            break;
+        }
+
+        case 1:
+        {
+            // e0 ::= e0 OP0 e1
+#line 0 "bench/work/expr_100.lem"
+#line 259 "bench/work/expr_100.cpp"
+            callDtor( 52, rhsData[0] );
+            callDtor( 3, rhsData[1] );
+            callDtor( 53, rhsData[2] );
+            break;
+        }
+
+        case 2:
+        {
+            // e0 ::= e1
+#line 0 "bench/work/expr_100.lem"
+#line 270 "bench/work/expr_100.cpp"
+            callDtor( 53, rhsData[0] );
+            break;
+        }
+
+        case 3:
+        {
+            // e1 ::= e1 OP1 e2
+#line 0 "bench/work/expr_100.lem"
+#line 279 "bench/work/expr_100.cpp"
+            callDtor( 53, rhsData[0] );
+            callDtor( 4, rhsData[1] );
+            callDtor( 64, rhsData[2] );
+            break;
+        }
+
+        case 4:
+        {
+            // e1 ::= e2
+#line 0 "bench/work/expr_100.lem"
+#line 290 "bench/work/expr_100.cpp"
+            callDtor( 64, rhsData[0] );
+            break;
+        }
+
+        case 5:
+        {
+            // e2 ::= e2 OP2 e3
+#line 0 "bench/work/expr_100.lem"
+#line 299 "bench/work/expr_100.cpp"
+            callDtor( 64, rhsData[0] );
+            callDtor( 15, rhsData[1] );
+            callDtor( 75, rhsData[2] );
+            break;
+        }
+
+        case 6:
+        {
+            // e2 ::= e3
+#line 0 "bench/work/expr_100.lem"
+#line 310 "bench/work/expr_100.cpp"
+            callDtor( 75, rhsData[0] );
+            break;
+        }
+
+        case 7:
+        {
+            // e3 ::= e3 OP3 e4
+#line 0 "bench/work/expr_100.lem"
+#line 319 "bench/work/expr_100.cpp"
+            callDtor( 75, rhsData[0] );
+            callDtor( 26, rhsData[1] );
+            callDtor( 86, rhsData[2] );
+            break;
+        }
+
+        case 8:
+        {
+            // e3 ::= e4
+#line 0 "bench/work/expr_100.lem"
+#line 330 "bench/work/expr_100.cpp"
+            callDtor( 86, rhsData[0] );
+            break;
+        }
+
+        case 9:
+        {
+            // e4 ::= e4 OP4 e5
+#line 0 "bench/work/expr_100.lem"
+#line 339 "bench/work/expr_100.cpp"
+            callDtor( 86, rhsData[0] );
+            callDtor( 37, rhsData[1] );
+            callDtor( 96, rhsData[2] );
+            break;
+        }
+
+        case 10:
+        {
+            // e4 ::= e5
+#line 0 "bench/work/expr_100.lem"
+#line 350 "bench/work/expr_100.cpp"
+            callDtor( 96, rhsData[0] );
+            break;
+        }
+
+        case 11:
+        {
+            // e5 ::= e5 OP5 e6
+#line 0 "bench/work/expr_100.lem"
+#line 359 "bench/work/expr_100.cpp"
+            callDtor( 96, rhsData[0] );
+            callDtor( 46, rhsData[1] );
+            callDtor( 97, rhsData[2] );
+            break;
+        }
+
+        case 12:
+        {
+            // e5 ::= e6
+#line 0 "bench/work/expr_100.lem"
+#line 370 "bench/work/expr_100.cpp"
+            callDtor( 97, rhsData[0] );
+            break;
+        }
+
+        case 13:
+        {
+            // e6 ::= e6 OP6 e7
+#line 0 "bench/work/expr_100.lem"
+#line 379 "bench/work/expr_100.cpp"
+            callDtor( 97, rhsData[0] );
+            callDtor( 47, rhsData[1] );
+            callDtor( 98, rhsData[2] );
+            break;
+        }
+
+        case 14:
+        {
+            // e6 ::= e7
+#line 0 "bench/work/expr_100.lem"
+#line 390 "bench/work/expr_100.cpp"
+            callDtor( 98, rhsData[0] );
+            break;
+        }
+
+        case 15:
+        {
+            // e7 ::= e7 OP7 e8
+#line 0 "bench/work/expr_100.lem"
+#line 399 "bench/work/expr_100.cpp"
+            callDtor( 98, rhsData[0] );
+            callDtor( 48, rhsData[1] );
+            callDtor( 99, rhsData[2] );
+            break;
+        }
+
+        case 16:
+        {
+            // e7 ::= e8
+#line 0 "bench/work/expr_100.lem"
+#line 410 "bench/work/expr_100.cpp"
+            callDtor( 99, rhsData[0] );
+            break;
+        }
+
+        case 17:
+        {
+            // e8 ::= e8 OP8 e9
+#line 0 "bench/work/expr_100.lem"
+#line 419 "bench/work/expr_100.cpp"
+            callDtor( 99, rhsData[0] );
+            callDtor( 49, rhsData[1] );
+            callDtor( 100, rhsData[2] );
+            break;
+        }
+
+        case 18:
+        {
+            // e8 ::= e9
+#line 0 "bench/work/expr_100.lem"
+#line 430 "bench/work/expr_100.cpp"
+            callDtor( 100, rhsData[0] );
+            break;
+        }
+
+        case 19:
+        {
+            // e9 ::= e9 OP9 e10
+#line 0 "bench/work/expr_100.lem"
+#line 439 "bench/work/expr_100.cpp"
+            callDtor( 100, rhsData[0] );
+            callDtor( 50, rhsData[1] );
+            callDtor( 54, rhsData[2] );
+            break;
+        }
+
+        case 20:
+        {
+            // e9 ::= e10
+#line 0 "bench/work/expr_100.lem"
+#line 450 "bench/work/expr_100.cpp"
+            callDtor( 54, rhsData[0] );
+            break;
+        }
+
+        case 21:
+        {
+            // e10 ::= e10 OP10 e11
+#line 0 "bench/work/expr_100.lem"
+#line 459 "bench/work/expr_100.cpp"
+            callDtor( 54, rhsData[0] );
+            callDtor( 5, rhsData[1] );
+            callDtor( 55, rhsData[2] );
+            break;
+        }
+
+        case 22:
+        {
+            // e10 ::= e11
+#line 0 "bench/work/expr_100.lem"
+#line 470 "bench/work/expr_100.cpp"
+            callDtor( 55, rhsData[0] );
+            break;
+        }
+
+        case 23:
+        {
+            // e11 ::= e11 OP11 e12
+#line 0 "bench/work/expr_100.lem"
+#line 479 "bench/work/expr_100.cpp"
+            callDtor( 55, rhsData[0] );
+            callDtor( 6, rhsData[1] );
+            callDtor( 56, rhsData[2] );
+            break;
+        }
+
+        case 24:
+        {
+            // e11 ::= e12
+#line 0 "bench/work/expr_100.lem"
+#line 490 "bench/work/expr_100.cpp"
+            callDtor( 56, rhsData[0] );
+            break;
+        }
+
+        case 25:
+        {
+            // e12 ::= e12 OP12 e13
+#line 0 "bench/work/expr_100.lem"
+#line 499 "bench/work/expr_100.cpp"
+            callDtor( 56, rhsData[0] );
+            callDtor( 7, rhsData[1] );
+            callDtor( 57, rhsData[2] );
+            break;
+        }
+
+        case 26:
+        {
+            // e12 ::= e13
+#line 0 "bench/work/expr_100.lem"
+#line 510 "bench/work/expr_100.cpp"
+            callDtor( 57, rhsData[0] );
+            break;
+        }
+
+        case 27:
+        {
+            // e13 ::= e13 OP13 e14
+#line 0 "bench/work/expr_100.lem"
+#line 519 "bench/work/expr_100.cpp"
+            callDtor( 57, rhsData[0] );
+            callDtor( 8, rhsData[1] );
+            callDtor( 58, rhsData[2] );
+            break;
+        }
+
+        case 28:
+        {
+            // e13 ::= e14
+#line 0 "bench/work/expr_100.lem"
+#line 530 "bench/work/expr_100.cpp"
+            callDtor( 58, rhsData[0] );
+            break;
+        }
+
+        case 29:
+        {
+            // e14 ::= e14 OP14 e15
+#line 0 "bench/work/expr_100.lem"
+#line 539 "bench/work/expr_100.cpp"
+            callDtor( 58, rhsData[0] );
+            callDtor( 9, rhsData[1] );
+            callDtor( 59, rhsData[2] );
+            break;
+        }
+
+        case 30:
+        {
+            // e14 ::= e15
+#line 0 "bench/work/expr_100.lem"
+#line 550 "bench/work/expr_100.cpp"
+            callDtor( 59, rhsData[0] );
+            break;
+        }
+
+        case 31:
+        {
+            // e15 ::= e15 OP15 e16
+#line 0 "bench/work/expr_100.lem"
+#line 559 "bench/work/expr_100.cpp"
+            callDtor( 59, rhsData[0] );
+            callDtor( 10, rhsData[1] );
+            callDtor( 60, rhsData[2] );
+            break;
+        }
+
+        case 32:
+        {
+            // e15 ::= e16
+#line 0 "bench/work/expr_100.lem"
+#line 570 "bench/work/expr_100.cpp"
+            callDtor( 60, rhsData[0] );
+            break;
+        }
+
+        case 33:
+        {
+            // e16 ::= e16 OP16 e17
+#line 0 "bench/work/expr_100.lem"
+#line 579 "bench/work/expr_100.cpp"
+            callDtor( 60, rhsData[0] );
+            callDtor( 11, rhsData[1] );
+            callDtor( 61, rhsData[2] );
+            break;
+        }
+
+        case 34:
+        {
+            // e16 ::= e17
+#line 0 "bench/work/expr_100.lem"
+#line 590 "bench/work/expr_100.cpp"
+            callDtor( 61, rhsData[0] );
+            break;
+        }
+
+        case 35:
+        {
+            // e17 ::= e17 OP17 e18
+#line 0 "bench/work/expr_100.lem"
+#line 599 "bench/work/expr_100.cpp"
+            callDtor( 61, rhsData[0] );
+            callDtor( 12, rhsData[1] );
+            callDtor( 62, rhsData[2] );
+            break;
+        }
+
+        case 36:
+        {
+            // e17 ::= e18
+#line 0 "bench/work/expr_100.lem"
+#line 610 "bench/work/expr_100.cpp"
+            callDtor( 62, rhsData[0] );
+            break;
+        }
+
+        case 37:
+        {
+            // e18 ::= e18 OP18 e19
+#line 0 "bench/work/expr_100.lem"
+#line 619 "bench/work/expr_100.cpp"
+            callDtor( 62, rhsData[0] );
+            callDtor( 13, rhsData[1] );
+            callDtor( 63, rhsData[2] );
+            break;
+        }
+
+        case 38:
+        {
+            // e18 ::= e19
+#line 0 "bench/work/expr_100.lem"
+#line 630 "bench/work/expr_100.cpp"
+            callDtor( 63, rhsData[0] );
+            break;
+        }
+
+        case 39:
+        {
+            // e19 ::= e19 OP19 e20
+#line 0 "bench/work/expr_100.lem"
+#line 639 "bench/work/expr_100.cpp"
+            callDtor( 63, rhsData[0] );
+            callDtor( 14, rhsData[1] );
+            callDtor( 65, rhsData[2] );
+            break;
+        }
+
+        case 40:
+        {
+            // e19 ::= e20
+#line 0 "bench/work/expr_100.lem"
+#line 650 "bench/work/expr_100.cpp"
+            callDtor( 65, rhsData[0] );
+            break;
+        }
+
+        case 41:
+        {
+            // e20 ::= e20 OP20 e21
+#line 0 "bench/work/expr_100.lem"
+#line 659 "bench/work/expr_100.cpp"
+            callDtor( 65, rhsData[0] );
+            callDtor( 16, rhsData[1] );
+            callDtor( 66, rhsData[2] );
+            break;
+        }
+
+        case 42:
+        {
+            // e20 ::= e21
+#line 0 "bench/work/expr_100.lem"
+#line 670 "bench/work/expr_100.cpp"
+            callDtor( 66, rhsData[0] );
+            break;
+        }
+
+        case 43:
+        {
+            // e21 ::= e21 OP21 e22
+#line 0 "bench/work/expr_100.lem"
+#line 679 "bench/work/expr_100.cpp"
+            callDtor( 66, rhsData[0] );
+            callDtor( 17, rhsData[1] );
+            callDtor( 67, rhsData[2] );
+            break;
+        }
+
+        case 44:
+        {
+            // e21 ::= e22
+#line 0 "bench/work/expr_100.lem"
+#line 690 "bench/work/expr_100.cpp"
+            callDtor( 67, rhsData[0] );
+            break;
+        }
+
+        case 45:
+        {
+            // e22 ::= e22 OP22 e23
+#line 0 "bench/work/expr_100.lem"
+#line 699 "bench/work/expr_100.cpp"
+            callDtor( 67, rhsData[0] );
+            callDtor( 18, rhsData[1] );
+            callDtor( 68, rhsData[2] );
+            break;
+        }
+
+        case 46:
+        {
+            // e22 ::= e23
+#line 0 "bench/work/expr_100.lem"
+#line 710 "bench/work/expr_100.cpp"
+            callDtor( 68, rhsData[0] );
+            break;
+        }
+
+        case 47:
+        {
+            // e23 ::= e23 OP23 e24
+#line 0 "bench/work/expr_100.lem"
+#line 719 "bench/work/expr_100.cpp"
+            callDtor( 68, rhsData[0] );
+            callDtor( 19, rhsData[1] );
+            callDtor( 69, rhsData[2] );
+            break;
+        }
+
+        case 48:
+        {
+            // e23 ::= e24
+#line 0 "bench/work/expr_100.lem"
+#line 730 "bench/work/expr_100.cpp"
+            callDtor( 69, rhsData[0] );
+            break;
+        }
+
+        case 49:
+        {
+            // e24 ::= e24 OP24 e25
+#line 0 "bench/work/expr_100.lem"
+#line 739 "bench/work/expr_100.cpp"
+            callDtor( 69, rhsData[0] );
+            callDtor( 20, rhsData[1] );
+            callDtor( 70, rhsData[2] );
+            break;
+        }
+
+        case 50:
+        {
+            // e24 ::= e25
+#line 0 "bench/work/expr_100.lem"
+#line 750 "bench/work/expr_100.cpp"
+            callDtor( 70, rhsData[0] );
+            break;
+        }
+
+        case 51:
+        {
+            // e25 ::= e25 OP25 e26
+#line 0 "bench/work/expr_100.lem"
+#line 759 "bench/work/expr_100.cpp"
+            callDtor( 70, rhsData[0] );
+            callDtor( 21, rhsData[1] );
+            callDtor( 71, rhsData[2] );
+            break;
+        }
+
+        case 52:
+        {
+            // e25 ::= e26
+#line 0 "bench/work/expr_100.lem"
+#line 770 "bench/work/expr_100.cpp"
+            callDtor( 71, rhsData[0] );
+            break;
+        }
+
+        case 53:
+        {
+            // e26 ::= e26 OP26 e27
+#line 0 "bench/work/expr_100.lem"
+#line 779 "bench/work/expr_100.cpp"
+            callDtor( 71, rhsData[0] );
+            callDtor( 22, rhsData[1] );
+            callDtor( 72, rhsData[2] );
+            break;
+        }
+
+        case 54:
+        {
+            // e26 ::= e27
+#line 0 "bench/work/expr_100.lem"
+#line 790 "bench/work/expr_100.cpp"
+            callDtor( 72, rhsData[0] );
+            break;
+        }
+
+        case 55:
+        {
+            // e27 ::= e27 OP27 e28
+#line 0 "bench/work/expr_100.lem"
+#line 799 "bench/work/expr_100.cpp"
+            callDtor( 72, rhsData[0] );
+            callDtor( 23, rhsData[1] );
+            callDtor( 73, rhsData[2] );
+            break;
+        }
+
+        case 56:
+        {
+            // e27 ::= e28
+#line 0 "bench/work/expr_100.lem"
+#line 810 "bench/work/expr_100.cpp"
+            callDtor( 73, rhsData[0] );
+            break;
+        }
+
+        case 57:
+        {
+            // e28 ::= e28 OP28 e29
+#line 0 "bench/work/expr_100.lem"
+#line 819 "bench/work/expr_100.cpp"
+            callDtor( 73, rhsData[0] );
+            callDtor( 24, rhsData[1] );
+            callDtor( 74, rhsData[2] );
+            break;
+        }
+
+        case 58:
+        {
+            // e28 ::= e29
+#line 0 "bench/work/expr_100.lem"
+#line 830 "bench/work/expr_100.cpp"
+            callDtor( 74, rhsData[0] );
+            break;
+        }
+
+        case 59:
+        {
+            // e29 ::= e29 OP29 e30
+#line 0 "bench/work/expr_100.lem"
+#line 839 "bench/work/expr_100.cpp"
+            callDtor( 74, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 76, rhsData[2] );
+            break;
+        }
+
+        case 60:
+        {
+            // e29 ::= e30
+#line 0 "bench/work/expr_100.lem"
+#line 850 "bench/work/expr_100.cpp"
+            callDtor( 76, rhsData[0] );
+            break;
+        }
+
+        case 61:
+        {
+            // e30 ::= e30 OP30 e31
+#line 0 "bench/work/expr_100.lem"
+#line 859 "bench/work/expr_100.cpp"
+            callDtor( 76, rhsData[0] );
+            callDtor( 27, rhsData[1] );
+            callDtor( 77, rhsData[2] );
+            break;
+        }
+
+        case 62:
+        {
+            // e30 ::= e31
+#line 0 "bench/work/expr_100.lem"
+#line 870 "bench/work/expr_100.cpp"
+            callDtor( 77, rhsData[0] );
+            break;
+        }
+
+        case 63:
+        {
+            // e31 ::= e31 OP31 e32
+#line 0 "bench/work/expr_100.lem"
+#line 879 "bench/work/expr_100.cpp"
+            callDtor( 77, rhsData[0] );
+            callDtor( 28, rhsData[1] );
+            callDtor( 78, rhsData[2] );
+            break;
+        }
+
+        case 64:
+        {
+            // e31 ::= e32
+#line 0 "bench/work/expr_100.lem"
+#line 890 "bench/work/expr_100.cpp"
+            callDtor( 78, rhsData[0] );
+            break;
+        }
+
+        case 65:
+        {
+            // e32 ::= e32 OP32 e33
+#line 0 "bench/work/expr_100.lem"
+#line 899 "bench/work/expr_100.cpp"
+            callDtor( 78, rhsData[0] );
+            callDtor( 29, rhsData[1] );
+            callDtor( 79, rhsData[2] );
+            break;
+        }
+
+        case 66:
+        {
+            // e32 ::= e33
+#line 0 "bench/work/expr_100.lem"
+#line 910 "bench/work/expr_100.cpp"
+            callDtor( 79, rhsData[0] );
+            break;
+        }
+
+        case 67:
+        {
+            // e33 ::= e33 OP33 e34
+#line 0 "bench/work/expr_100.lem"
+#line 919 "bench/work/expr_100.cpp"
+            callDtor( 79, rhsData[0] );
+            callDtor( 30, rhsData[1] );
+            callDtor( 80, rhsData[2] );
+            break;
+        }
+
+        case 68:
+        {
+            // e33 ::= e34
+#line 0 "bench/work/expr_100.lem"
+#line 930 "bench/work/expr_100.cpp"
+            callDtor( 80, rhsData[0] );
+            break;
+        }
+
+        case 69:
+        {
+            // e34 ::= e34 OP34 e35
+#line 0 "bench/work/expr_100.lem"
+#line 939 "bench/work/expr_100.cpp"
+            callDtor( 80, rhsData[0] );
+            callDtor( 31, rhsData[1] );
+            callDtor( 81, rhsData[2] );
+            break;
+        }
+
+        case 70:
+        {
+            // e34 ::= e35
+#line 0 "bench/work/expr_100.lem"
+#line 950 "bench/work/expr_100.cpp"
+            callDtor( 81, rhsData[0] );
+            break;
+        }
+
+        case 71:
+        {
+            // e35 ::= e35 OP35 e36
+#line 0 "bench/work/expr_100.lem"
+#line 959 "bench/work/expr_100.cpp"
+            callDtor( 81, rhsData[0] );
+            callDtor( 32, rhsData[1] );
+            callDtor( 82, rhsData[2] );
+            break;
+        }
+
+        case 72:
+        {
+            // e35 ::= e36
+#line 0 "bench/work/expr_100.lem"
+#line 970 "bench/work/expr_100.cpp"
+            callDtor( 82, rhsData[0] );
+            break;
+        }
+
+        case 73:
+        {
+            // e36 ::= e36 OP36 e37
+#line 0 "bench/work/expr_100.lem"
+#line 979 "bench/work/expr_100.cpp"
+            callDtor( 82, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 83, rhsData[2] );
+            break;
+        }
+
+        case 74:
+        {
+            // e36 ::= e37
+#line 0 "bench/work/expr_100.lem"
+#line 990 "bench/work/expr_100.cpp"
+            callDtor( 83, rhsData[0] );
+            break;
+        }
+
+        case 75:
+        {
+            // e37 ::= e37 OP37 e38
+#line 0 "bench/work/expr_100.lem"
+#line 999 "bench/work/expr_100.cpp"
+            callDtor( 83, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 84, rhsData[2] );
+            break;
+        }
+
+        case 76:
+        {
+            // e37 ::= e38
+#line 0 "bench/work/expr_100.lem"
+#line 1010 "bench/work/expr_100.cpp"
+            callDtor( 84, rhsData[0] );
+            break;
+        }
+
+        case 77:
+        {
+            // e38 ::= e38 OP38 e39
+#line 0 "bench/work/expr_100.lem"
+#line 1019 "bench/work/expr_100.cpp"
+            callDtor( 84, rhsData[0] );
+            callDtor( 35, rhsData[1] );
+            callDtor( 85, rhsData[2] );
+            break;
+        }
+
+        case 78:
+        {
+            // e38 ::= e39
+#line 0 "bench/work/expr_100.lem"
+#line 1030 "bench/work/expr_100.cpp"
+            callDtor( 85, rhsData[0] );
+            break;
+        }
+
+        case 79:
+        {
+            // e39 ::= e39 OP39 e40
+#line 0 "bench/work/expr_100.lem"
+#line 1039 "bench/work/expr_100.cpp"
+            callDtor( 85, rhsData[0] );
+            callDtor( 36, rhsData[1] );
+            callDtor( 87, rhsData[2] );
+            break;
+        }
+
+        case 80:
+        {
+            // e39 ::= e40
+#line 0 "bench/work/expr_100.lem"
+#line 1050 "bench/work/expr_100.cpp"
+            callDtor( 87, rhsData[0] );
+            break;
+        }
+
+        case 81:
+        {
+            // e40 ::= e40 OP40 e41
+#line 0 "bench/work/expr_100.lem"
+#line 1059 "bench/work/expr_100.cpp"
+            callDtor( 87, rhsData[0] );
+            callDtor( 38, rhsData[1] );
+            callDtor( 88, rhsData[2] );
+            break;
+        }
+
+        case 82:
+        {
+            // e40 ::= e41
+#line 0 "bench/work/expr_100.lem"
+#line 1070 "bench/work/expr_100.cpp"
+            callDtor( 88, rhsData[0] );
+            break;
+        }
+
+        case 83:
+        {
+            // e41 ::= e41 OP41 e42
+#line 0 "bench/work/expr_100.lem"
+#line 1079 "bench/work/expr_100.cpp"
+            callDtor( 88, rhsData[0] );
+            callDtor( 39, rhsData[1] );
+            callDtor( 89, rhsData[2] );
+            break;
+        }
+
+        case 84:
+        {
+            // e41 ::= e42
+#line 0 "bench/work/expr_100.lem"
+#line 1090 "bench/work/expr_100.cpp"
+            callDtor( 89, rhsData[0] );
+            break;
+        }
+
+        case 85:
+        {
+            // e42 ::= e42 OP42 e43
+#line 0 "bench/work/expr_100.lem"
+#line 1099 "bench/work/expr_100.cpp"
+            callDtor( 89, rhsData[0] );
+            callDtor( 40, rhsData[1] );
+            callDtor( 90, rhsData[2] );
+            break;
+        }
+
+        case 86:
+        {
+            // e42 ::= e43
+#line 0 "bench/work/expr_100.lem"
+#line 1110 "bench/work/expr_100.cpp"
+            callDtor( 90, rhsData[0] );
+            break;
+        }
+
+        case 87:
+        {
+            // e43 ::= e43 OP43 e44
+#line 0 "bench/work/expr_100.lem"
+#line 1119 "bench/work/expr_100.cpp"
+            callDtor( 90, rhsData[0] );
+            callDtor( 41, rhsData[1] );
+            callDtor( 91, rhsData[2] );
+            break;
+        }
+
+        case 88:
+        {
+            // e43 ::= e44
+#line 0 "bench/work/expr_100.lem"
+#line 1130 "bench/work/expr_100.cpp"
+            callDtor( 91, rhsData[0] );
+            break;
+        }
+
+        case 89:
+        {
+            // e44 ::= e44 OP44 e45
+#line 0 "bench/work/expr_100.lem"
+#line 1139 "bench/work/expr_100.cpp"
+            callDtor( 91, rhsData[0] );
+            callDtor( 42, rhsData[1] );
+            callDtor( 92, rhsData[2] );
+            break;
+        }
+
+        case 90:
+        {
+            // e44 ::= e45
+#line 0 "bench/work/expr_100.lem"
+#line 1150 "bench/work/expr_100.cpp"
+            callDtor( 92, rhsData[0] );
+            break;
+        }
+
+        case 91:
+        {
+            // e45 ::= e45 OP45 e46
+#line 0 "bench/work/expr_100.lem"
+#line 1159 "bench/work/expr_100.cpp"
+            callDtor( 92, rhsData[0] );
+            callDtor( 43, rhsData[1] );
+            callDtor( 93, rhsData[2] );
+            break;
+        }
+
+        case 92:
+        {
+            // e45 ::= e46
+#line 0 "bench/work/expr_100.lem"
+#line 1170 "bench/work/expr_100.cpp"
+            callDtor( 93, rhsData[0] );
+            break;
+        }
+
+        case 93:
+        {
+            // e46 ::= e46 OP46 e47
+#line 0 "bench/work/expr_100.lem"
+#line 1179 "bench/work/expr_100.cpp"
+            callDtor( 93, rhsData[0] );
+            callDtor( 44, rhsData[1] );
+            callDtor( 94, rhsData[2] );
+            break;
+        }
+
+        case 94:
+        {
+            // e46 ::= e47
+#line 0 "bench/work/expr_100.lem"
+#line 1190 "bench/work/expr_100.cpp"
+            callDtor( 94, rhsData[0] );
+            break;
+        }
+
+        case 95:
+        {
+            // e47 ::= e47 OP47 e48
+#line 0 "bench/work/expr_100.lem"
+#line 1199 "bench/work/expr_100.cpp"
+            callDtor( 94, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 95, rhsData[2] );
+            break;
+        }
+
+        case 96:
+        {
+            // e47 ::= e48
+#line 0 "bench/work/expr_100.lem"
+#line 1210 "bench/work/expr_100.cpp"
+            callDtor( 95, rhsData[0] );
+            break;
+        }
+
+        case 97:
+        {
+            // e48 ::= NUM
+#line 0 "bench/work/expr_100.lem"
+#line 1219 "bench/work/expr_100.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 98:
+        {
+            // e48 ::= LP e0 RP
+#line 0 "bench/work/expr_100.lem"
+#line 1228 "bench/work/expr_100.cpp"
+            callDtor( 1, rhsData[0] );
+            callDtor( 52, rhsData[1] );
+            callDtor( 51, rhsData[2] );
+            break;
+        }
+
+        default:
+            throw "Unknown Rule Number";
+            break;
+    }
+
+    if ( PA_SHIFT == next )
+        shift( newVal, myRules[ruleNum].first, data );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::callDtor( int symIdx, privBenchImpl::Value &data )
+{
+    switch ( symIdx )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+        case 12:
+        case 13:
+        case 14:
+        case 15:
+        case 16:
+        case 17:
+        case 18:
+        case 19:
+        case 20:
+        case 21:
+        case 22:
+        case 23:
+        case 24:
+        case 25:
+        case 26:
+        case 27:
+        case 28:
+        case 29:
+        case 30:
+        case 31:
+        case 32:
+        case 33:
+        case 34:
+        case 35:
+        case 36:
+        case 37:
+        case 38:
+        case 39:
+        case 40:
+        case 41:
+        case 42:
+        case 43:
+        case 44:
+        case 45:
+        case 46:
+        case 47:
+        case 48:
+        case 49:
+        case 50:
+        case 51:
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::popStack( void )
+{
+    callDtor( myStack.top().first.second, myStack.top().second );
+    myStack.pop();
+}
+
+
+////////////////////////////////////////
+
+
+ParserAct privBenchImpl::findParserAction( int &newVal, int tok )
+{
+    int stateNum;
+    ParserAct retval = PA_NOP;
+    bool found = false;
+
+    stateNum = myStack.empty() ? 0 : myStack.top().first.first;
+    ActionMap::iterator i = myStates[stateNum].find( tok );
+    if ( tok >= 0 && tok <= 103 )
+    {
+        if ( i != myStates[stateNum].end() )
+        {
+            retval = (*i).second.first;
+            newVal = (*i).second.second;
+            found = true;
+        }
+    }
+    else if ( ! myStates[stateNum].empty() )
+    {
+        retval = PA_NOP;
+        newVal = 0;
+        found = true;
+    }
+
+    if ( ! found )
+    {
+        retval = myStateDefaultActions[stateNum].first;
+        newVal = myStateDefaultActions[stateNum].second;
+    }
+    return retval;
+}
+
+
+////////////////////////////////////////
+
+
+static int theStateTable[1669][4] =
+{
+    // State 0
+    { 0, 1, PA_SHIFT, 99 },
+    // State 0
+    { 0, 2, PA_SHIFT, 98 },
+    // State 0
+    { 0, 52, PA_SHIFT, 1 },
+    // State 0
+    { 0, 53, PA_SHIFT, 102 },
+    // State 0
+    { 0, 54, PA_SHIFT, 111 },
+    // State 0
+    { 0, 55, PA_SHIFT, 112 },
+    // State 0
+    { 0, 56, PA_SHIFT, 113 },
+    // State 0
+    { 0, 57, PA_SHIFT, 114 },
+    // State 0
+    { 0, 58, PA_SHIFT, 115 },
+    // State 0
+    { 0, 59, PA_SHIFT, 116 },
+    // State 0
+    { 0, 60, PA_SHIFT, 117 },
+    // State 0
+    { 0, 61, PA_SHIFT, 118 },
+    // State 0
+    { 0, 62, PA_SHIFT, 119 },
+    // State 0
+    { 0, 63, PA_SHIFT, 120 },
+    // State 0
+    { 0, 64, PA_SHIFT, 103 },
+    // State 0
+    { 0, 65, PA_SHIFT, 121 },
+    // State 0
+    { 0, 66, PA_SHIFT, 122 },
+    // State 0
+    { 0, 67, PA_SHIFT, 123 },
+    // State 0
+    { 0, 68, PA_SHIFT, 124 },
+    // State 0
+    { 0, 69, PA_SHIFT, 125 },
+    // State 0
+    { 0, 70, PA_SHIFT, 126 },
+    // State 0
+    { 0, 71, PA_SHIFT, 127 },
+    // State 0
+    { 0, 72, PA_SHIFT, 128 },
+    // State 0
+    { 0, 73, PA_SHIFT, 129 },
+    // State 0
+    { 0, 74, PA_SHIFT, 130 },
+    // State 0
+    { 0, 75, PA_SHIFT, 104 },
+    // State 0
+    { 0, 76, PA_SHIFT, 131 },
+    // State 0
+    { 0, 77, PA_SHIFT, 132 },
+    // State 0
+    { 0, 78, PA_SHIFT, 133 },
+    // State 0
+    { 0, 79, PA_SHIFT, 134 },
+    // State 0
+    { 0, 80, PA_SHIFT, 135 },
+    // State 0
+    { 0, 81, PA_SHIFT, 136 },
+    // State 0
+    { 0, 82, PA_SHIFT, 137 },
+    // State 0
+    { 0, 83, PA_SHIFT, 138 },
+    // State 0
+    { 0, 84, PA_SHIFT, 139 },
+    // State 0
+    { 0, 85, PA_SHIFT, 140 },
+    // State 0
+    { 0, 86, PA_SHIFT, 105 },
+    // State 0
+    { 0, 87, PA_SHIFT, 141 },
+    // State 0
+    { 0, 88, PA_SHIFT, 142 },
+    // State 0
+    { 0, 89, PA_SHIFT, 143 },
+    // State 0
+    { 0, 90, PA_SHIFT, 144 },
+    // State 0
+    { 0, 91, PA_SHIFT, 145 },
+    // State 0
+    { 0, 92, PA_SHIFT, 146 },
+    // State 0
+    { 0, 93, PA_SHIFT, 147 },
+    // State 0
+    { 0, 94, PA_SHIFT, 148 },
+    // State 0
+    { 0, 95, PA_SHIFT, 149 },
+    // State 0
+    { 0, 96, PA_SHIFT, 106 },
+    // State 0
+    { 0, 97, PA_SHIFT, 107 },
+    // State 0
+    { 0, 98, PA_SHIFT, 108 },
+    // State 0
+    { 0, 99, PA_SHIFT, 109 },
+    // State 0
+    { 0, 100, PA_SHIFT, 110 },
+    // State 0
+    { 0, 102, PA_ACCEPT, 0 },
+    // State 1
+    { 1, 0, PA_REDUCE, 0 },
+    // State 1
+    { 1, 3, PA_SHIFT, 2 },
+    // State 2
+    { 2, 1, PA_SHIFT, 99 },
+    // State 2
+    { 2, 2, PA_SHIFT, 98 },
+    // State 2
+    { 2, 53, PA_SHIFT, 3 },
+    // State 2
+    { 2, 54, PA_SHIFT, 111 },
+    // State 2
+    { 2, 55, PA_SHIFT, 112 },
+    // State 2
+    { 2, 56, PA_SHIFT, 113 },
+    // State 2
+    { 2, 57, PA_SHIFT, 114 },
+    // State 2
+    { 2, 58, PA_SHIFT, 115 },
+    // State 2
+    { 2, 59, PA_SHIFT, 116 },
+    // State 2
+    { 2, 60, PA_SHIFT, 117 },
+    // State 2
+    { 2, 61, PA_SHIFT, 118 },
+    // State 2
+    { 2, 62, PA_SHIFT, 119 },
+    // State 2
+    { 2, 63, PA_SHIFT, 120 },
+    // State 2
+    { 2, 64, PA_SHIFT, 103 },
+    // State 2
+    { 2, 65, PA_SHIFT, 121 },
+    // State 2
+    { 2, 66, PA_SHIFT, 122 },
+    // State 2
+    { 2, 67, PA_SHIFT, 123 },
+    // State 2
+    { 2, 68, PA_SHIFT, 124 },
+    // State 2
+    { 2, 69, PA_SHIFT, 125 },
+    // State 2
+    { 2, 70, PA_SHIFT, 126 },
+    // State 2
+    { 2, 71, PA_SHIFT, 127 },
+    // State 2
+    { 2, 72, PA_SHIFT, 128 },
+    // State 2
+    { 2, 73, PA_SHIFT, 129 },
+    // State 2
+    { 2, 74, PA_SHIFT, 130 },
+    // State 2
+    { 2, 75, PA_SHIFT, 104 },
+    // State 2
+    { 2, 76, PA_SHIFT, 131 },
+    // State 2
+    { 2, 77, PA_SHIFT, 132 },
+    // State 2
+    { 2, 78, PA_SHIFT, 133 },
+    // State 2
+    { 2, 79, PA_SHIFT, 134 },
+    // State 2
+    { 2, 80, PA_SHIFT, 135 },
+    // State 2
+    { 2, 81, PA_SHIFT, 136 },
+    // State 2
+    { 2, 82, PA_SHIFT, 137 },
+    // State 2
+    { 2, 83, PA_SHIFT, 138 },
+    // State 2
+    { 2, 84, PA_SHIFT, 139 },
+    // State 2
+    { 2, 85, PA_SHIFT, 140 },
+    // State 2
+    { 2, 86, PA_SHIFT, 105 },
+    // State 2
+    { 2, 87, PA_SHIFT, 141 },
+    // State 2
+    { 2, 88, PA_SHIFT, 142 },
+    // State 2
+    { 2, 89, PA_SHIFT, 143 },
+    // State 2
+    { 2, 90, PA_SHIFT, 144 },
+    // State 2
+    { 2, 91, PA_SHIFT, 145 },
+    // State 2
+    { 2, 92, PA_SHIFT, 146 },
+    // State 2
+    { 2, 93, PA_SHIFT, 147 },
+    // State 2
+    { 2, 94, PA_SHIFT, 148 },
+    // State 2
+    { 2, 95, PA_SHIFT, 149 },
+    // State 2
+    { 2, 96, PA_SHIFT, 106 },
+    // State 2
+    { 2, 97, PA_SHIFT, 107 },
+    // State 2
+    { 2, 98, PA_SHIFT, 108 },
+    // State 2
+    { 2, 99, PA_SHIFT, 109 },
+    // State 2
+    { 2, 100, PA_SHIFT, 110 },
+    // State 3
+    { 3, 4, PA_SHIFT, 4 },
+    // State 3
+    { 3, 103, PA_REDUCE, 1 },
+    // State 3 default action
+    { 3, -1, PA_REDUCE, 1 },
+    // State 4
+    { 4, 1, PA_SHIFT, 99 },
+    // State 4
+    { 4, 2, PA_SHIFT, 98 },
+    // State 4
+    { 4, 54, PA_SHIFT, 111 },
+    // State 4
+    { 4, 55, PA_SHIFT, 112 },
+    // State 4
+    { 4, 56, PA_SHIFT, 113 },
+    // State 4
+    { 4, 57, PA_SHIFT, 114 },
+    // State 4
+    { 4, 58, PA_SHIFT, 115 },
+    // State 4
+    { 4, 59, PA_SHIFT, 116 },
+    // State 4
+    { 4, 60, PA_SHIFT, 117 },
+    // State 4
+    { 4, 61, PA_SHIFT, 118 },
+    // State 4
+    { 4, 62, PA_SHIFT, 119 },
+    // State 4
+    { 4, 63, PA_SHIFT, 120 },
+    // State 4
+    { 4, 64, PA_SHIFT, 5 },
+    // State 4
+    { 4, 65, PA_SHIFT, 121 },
+    // State 4
+    { 4, 66, PA_SHIFT, 122 },
+    // State 4
+    { 4, 67, PA_SHIFT, 123 },
+    // State 4
+    { 4, 68, PA_SHIFT, 124 },
+    // State 4
+    { 4, 69, PA_SHIFT, 125 },
+    // State 4
+    { 4, 70, PA_SHIFT, 126 },
+    // State 4
+    { 4, 71, PA_SHIFT, 127 },
+    // State 4
+    { 4, 72, PA_SHIFT, 128 },
+    // State 4
+    { 4, 73, PA_SHIFT, 129 },
+    // State 4
+    { 4, 74, PA_SHIFT, 130 },
+    // State 4
+    { 4, 75, PA_SHIFT, 104 },
+    // State 4
+    { 4, 76, PA_SHIFT, 131 },
+    // State 4
+    { 4, 77, PA_SHIFT, 132 },
+    // State 4
+    { 4, 78, PA_SHIFT, 133 },
+    // State 4
+    { 4, 79, PA_SHIFT, 134 },
+    // State 4
+    { 4, 80, PA_SHIFT, 135 },
+    // State 4
+    { 4, 81, PA_SHIFT, 136 },
+    // State 4
+    { 4, 82, PA_SHIFT, 137 },
+    // State 4
+    { 4, 83, PA_SHIFT, 138 },
+    // State 4
+    { 4, 84, PA_SHIFT, 139 },
+    // State 4
+    { 4, 85, PA_SHIFT, 140 },
+    // State 4
+    { 4, 86, PA_SHIFT, 105 },
+    // State 4
+    { 4, 87, PA_SHIFT, 141 },
+    // State 4
+    { 4, 88, PA_SHIFT, 142 },
+    // State 4
+    { 4, 89, PA_SHIFT, 143 },
+    // State 4
+    { 4, 90, PA_SHIFT, 144 },
+    // State 4
+    { 4, 91, PA_SHIFT, 145 },
+    // State 4
+    { 4, 92, PA_SHIFT, 146 },
+    // State 4
+    { 4, 93, PA_SHIFT, 147 },
+    // State 4
+    { 4, 94, PA_SHIFT, 148 },
+    // State 4
+    { 4, 95, PA_SHIFT, 149 },
+    // State 4
+    { 4, 96, PA_SHIFT, 106 },
+    // State 4
+    { 4, 97, PA_SHIFT, 107 },
+    // State 4
+    { 4, 98, PA_SHIFT, 108 },
+    // State 4
+    { 4, 99, PA_SHIFT, 109 },
+    // State 4
+    { 4, 100, PA_SHIFT, 110 },
+    // State 5
+    { 5, 15, PA_SHIFT, 6 },
+    // State 5
+    { 5, 103, PA_REDUCE, 3 },
+    // State 5 default action
+    { 5, -1, PA_REDUCE, 3 },
+    // State 6
+    { 6, 1, PA_SHIFT, 99 },
+    // State 6
+    { 6, 2, PA_SHIFT, 98 },
+    // State 6
+    { 6, 54, PA_SHIFT, 111 },
+    // State 6
+    { 6, 55, PA_SHIFT, 112 },
+    // State 6
+    { 6, 56, PA_SHIFT, 113 },
+    // State 6
+    { 6, 57, PA_SHIFT, 114 },
+    // State 6
+    { 6, 58, PA_SHIFT, 115 },
+    // State 6
+    { 6, 59, PA_SHIFT, 116 },
+    // State 6
+    { 6, 60, PA_SHIFT, 117 },
+    // State 6
+    { 6, 61, PA_SHIFT, 118 },
+    // State 6
+    { 6, 62, PA_SHIFT, 119 },
+    // State 6
+    { 6, 63, PA_SHIFT, 120 },
+    // State 6
+    { 6, 65, PA_SHIFT, 121 },
+    // State 6
+    { 6, 66, PA_SHIFT, 122 },
+    // State 6
+    { 6, 67, PA_SHIFT, 123 },
+    // State 6
+    { 6, 68, PA_SHIFT, 124 },
+    // State 6
+    { 6, 69, PA_SHIFT, 125 },
+    // State 6
+    { 6, 70, PA_SHIFT, 126 },
+    // State 6
+    { 6, 71, PA_SHIFT, 127 },
+    // State 6
+    { 6, 72, PA_SHIFT, 128 },
+    // State 6
+    { 6, 73, PA_SHIFT, 129 },
+    // State 6
+    { 6, 74, PA_SHIFT, 130 },
+    // State 6
+    { 6, 75, PA_SHIFT, 7 },
+    // State 6
+    { 6, 76, PA_SHIFT, 131 },
+    // State 6
+    { 6, 77, PA_SHIFT, 132 },
+    // State 6
+    { 6, 78, PA_SHIFT, 133 },
+    // State 6
+    { 6, 79, PA_SHIFT, 134 },
+    // State 6
+    { 6, 80, PA_SHIFT, 135 },
+    // State 6
+    { 6, 81, PA_SHIFT, 136 },
+    // State 6
+    { 6, 82, PA_SHIFT, 137 },
+    // State 6
+    { 6, 83, PA_SHIFT, 138 },
+    // State 6
+    { 6, 84, PA_SHIFT, 139 },
+    // State 6
+    { 6, 85, PA_SHIFT, 140 },
+    // State 6
+    { 6, 86, PA_SHIFT, 105 },
+    // State 6
+    { 6, 87, PA_SHIFT, 141 },
+    // State 6
+    { 6, 88, PA_SHIFT, 142 },
+    // State 6
+    { 6, 89, PA_SHIFT, 143 },
+    // State 6
+    { 6, 90, PA_SHIFT, 144 },
+    // State 6
+    { 6, 91, PA_SHIFT, 145 },
+    // State 6
+    { 6, 92, PA_SHIFT, 146 },
+    // State 6
+    { 6, 93, PA_SHIFT, 147 },
+    // State 6
+    { 6, 94, PA_SHIFT, 148 },
+    // State 6
+    { 6, 95, PA_SHIFT, 149 },
+    // State 6
+    { 6, 96, PA_SHIFT, 106 },
+    // State 6
+    { 6, 97, PA_SHIFT, 107 },
+    // State 6
+    { 6, 98, PA_SHIFT, 108 },
+    // State 6
+    { 6, 99, PA_SHIFT, 109 },
+    // State 6
+    { 6, 100, PA_SHIFT, 110 },
+    // State 7
+    { 7, 26, PA_SHIFT, 8 },
+    // State 7
+    { 7, 103, PA_REDUCE, 5 },
+    // State 7 default action
+    { 7, -1, PA_REDUCE, 5 },
+    // State 8
+    { 8, 1, PA_SHIFT, 99 },
+    // State 8
+    { 8, 2, PA_SHIFT, 98 },
+    // State 8
+    { 8, 54, PA_SHIFT, 111 },
+    // State 8
+    { 8, 55, PA_SHIFT, 112 },
+    // State 8
+    { 8, 56, PA_SHIFT, 113 },
+    // State 8
+    { 8, 57, PA_SHIFT, 114 },
+    // State 8
+    { 8, 58, PA_SHIFT, 115 },
+    // State 8
+    { 8, 59, PA_SHIFT, 116 },
+    // State 8
+    { 8, 60, PA_SHIFT, 117 },
+    // State 8
+    { 8, 61, PA_SHIFT, 118 },
+    // State 8
+    { 8, 62, PA_SHIFT, 119 },
+    // State 8
+    { 8, 63, PA_SHIFT, 120 },
+    // State 8
+    { 8, 65, PA_SHIFT, 121 },
+    // State 8
+    { 8, 66, PA_SHIFT, 122 },
+    // State 8
+    { 8, 67, PA_SHIFT, 123 },
+    // State 8
+    { 8, 68, PA_SHIFT, 124 },
+    // State 8
+    { 8, 69, PA_SHIFT, 125 },
+    // State 8
+    { 8, 70, PA_SHIFT, 126 },
+    // State 8
+    { 8, 71, PA_SHIFT, 127 },
+    // State 8
+    { 8, 72, PA_SHIFT, 128 },
+    // State 8
+    { 8, 73, PA_SHIFT, 129 },
+    // State 8
+    { 8, 74, PA_SHIFT, 130 },
+    // State 8
+    { 8, 76, PA_SHIFT, 131 },
+    // State 8
+    { 8, 77, PA_SHIFT, 132 },
+    // State 8
+    { 8, 78, PA_SHIFT, 133 },
+    // State 8
+    { 8, 79, PA_SHIFT, 134 },
+    // State 8
+    { 8, 80, PA_SHIFT, 135 },
+    // State 8
+    { 8, 81, PA_SHIFT, 136 },
+    // State 8
+    { 8, 82, PA_SHIFT, 137 },
+    // State 8
+    { 8, 83, PA_SHIFT, 138 },
+    // State 8
+    { 8, 84, PA_SHIFT, 139 },
+    // State 8
+    { 8, 85, PA_SHIFT, 140 },
+    // State 8
+    { 8, 86, PA_SHIFT, 9 },
+    // State 8
+    { 8, 87, PA_SHIFT, 141 },
+    // State 8
+    { 8, 88, PA_SHIFT, 142 },
+    // State 8
+    { 8, 89, PA_SHIFT, 143 },
+    // State 8
+    { 8, 90, PA_SHIFT, 144 },
+    // State 8
+    { 8, 91, PA_SHIFT, 145 },
+    // State 8
+    { 8, 92, PA_SHIFT, 146 },
+    // State 8
+    { 8, 93, PA_SHIFT, 147 },
+    // State 8
+    { 8, 94, PA_SHIFT, 148 },
+    // State 8
+    { 8, 95, PA_SHIFT, 149 },
+    // State 8
+    { 8, 96, PA_SHIFT, 106 },
+    // State 8
+    { 8, 97, PA_SHIFT, 107 },
+    // State 8
+    { 8, 98, PA_SHIFT, 108 },
+    // State 8
+    { 8, 99, PA_SHIFT, 109 },
+    // State 8
+    { 8, 100, PA_SHIFT, 110 },
+    // State 9
+    { 9, 37, PA_SHIFT, 10 },
+    // State 9
+    { 9, 103, PA_REDUCE, 7 },
+    // State 9 default action
+    { 9, -1, PA_REDUCE, 7 },
+    // State 10
+    { 10, 1, PA_SHIFT, 99 },
+    // State 10
+    { 10, 2, PA_SHIFT, 98 },
+    // State 10
+    { 10, 54, PA_SHIFT, 111 },
+    // State 10
+    { 10, 55, PA_SHIFT, 112 },
+    // State 10
+    { 10, 56, PA_SHIFT, 113 },
+    // State 10
+    { 10, 57, PA_SHIFT, 114 },
+    // State 10
+    { 10, 58, PA_SHIFT, 115 },
+    // State 10
+    { 10, 59, PA_SHIFT, 116 },
+    // State 10
+    { 10, 60, PA_SHIFT, 117 },
+    // State 10
+    { 10, 61, PA_SHIFT, 118 },
+    // State 10
+    { 10, 62, PA_SHIFT, 119 },
+    // State 10
+    { 10, 63, PA_SHIFT, 120 },
+    // State 10
+    { 10, 65, PA_SHIFT, 121 },
+    // State 10
+    { 10, 66, PA_SHIFT, 122 },
+    // State 10
+    { 10, 67, PA_SHIFT, 123 },
+    // State 10
+    { 10, 68, PA_SHIFT, 124 },
+    // State 10
+    { 10, 69, PA_SHIFT, 125 },
+    // State 10
+    { 10, 70, PA_SHIFT, 126 },
+    // State 10
+    { 10, 71, PA_SHIFT, 127 },
+    // State 10
+    { 10, 72, PA_SHIFT, 128 },
+    // State 10
+    { 10, 73, PA_SHIFT, 129 },
+    // State 10
+    { 10, 74, PA_SHIFT, 130 },
+    // State 10
+    { 10, 76, PA_SHIFT, 131 },
+    // State 10
+    { 10, 77, PA_SHIFT, 132 },
+    // State 10
+    { 10, 78, PA_SHIFT, 133 },
+    // State 10
+    { 10, 79, PA_SHIFT, 134 },
+    // State 10
+    { 10, 80, PA_SHIFT, 135 },
+    // State 10
+    { 10, 81, PA_SHIFT, 136 },
+    // State 10
+    { 10, 82, PA_SHIFT, 137 },
+    // State 10
+    { 10, 83, PA_SHIFT, 138 },
+    // State 10
+    { 10, 84, PA_SHIFT, 139 },
+    // State 10
+    { 10, 85, PA_SHIFT, 140 },
+    // State 10
+    { 10, 87, PA_SHIFT, 141 },
+    // State 10
+    { 10, 88, PA_SHIFT, 142 },
+    // State 10
+    { 10, 89, PA_SHIFT, 143 },
+    // State 10
+    { 10, 90, PA_SHIFT, 144 },
+    // State 10
+    { 10, 91, PA_SHIFT, 145 },
+    // State 10
+    { 10, 92, PA_SHIFT, 146 },
+    // State 10
+    { 10, 93, PA_SHIFT, 147 },
+    // State 10
+    { 10, 94, PA_SHIFT, 148 },
+    // State 10
+    { 10, 95, PA_SHIFT, 149 },
+    // State 10
+    { 10, 96, PA_SHIFT, 11 },
+    // State 10
+    { 10, 97, PA_SHIFT, 107 },
+    // State 10
+    { 10, 98, PA_SHIFT, 108 },
+    // State 10
+    { 10, 99, PA_SHIFT, 109 },
+    // State 10
+    { 10, 100, PA_SHIFT, 110 },
+    // State 11
+    { 11, 46, PA_SHIFT, 12 },
+    // State 11
+    { 11, 103, PA_REDUCE, 9 },
+    // State 11 default action
+    { 11, -1, PA_REDUCE, 9 },
+    // State 12
+    { 12, 1, PA_SHIFT, 99 },
+    // State 12
+    { 12, 2, PA_SHIFT, 98 },
+    // State 12
+    { 12, 54, PA_SHIFT, 111 },
+    // State 12
+    { 12, 55, PA_SHIFT, 112 },
+    // State 12
+    { 12, 56, PA_SHIFT, 113 },
+    // State 12
+    { 12, 57, PA_SHIFT, 114 },
+    // State 12
+    { 12, 58, PA_SHIFT, 115 },
+    // State 12
+    { 12, 59, PA_SHIFT, 116 },
+    // State 12
+    { 12, 60, PA_SHIFT, 117 },
+    // State 12
+    { 12, 61, PA_SHIFT, 118 },
+    // State 12
+    { 12, 62, PA_SHIFT, 119 },
+    // State 12
+    { 12, 63, PA_SHIFT, 120 },
+    // State 12
+    { 12, 65, PA_SHIFT, 121 },
+    // State 12
+    { 12, 66, PA_SHIFT, 122 },
+    // State 12
+    { 12, 67, PA_SHIFT, 123 },
+    // State 12
+    { 12, 68, PA_SHIFT, 124 },
+    // State 12
+    { 12, 69, PA_SHIFT, 125 },
+    // State 12
+    { 12, 70, PA_SHIFT, 126 },
+    // State 12
+    { 12, 71, PA_SHIFT, 127 },
+    // State 12
+    { 12, 72, PA_SHIFT, 128 },
+    // State 12
+    { 12, 73, PA_SHIFT, 129 },
+    // State 12
+    { 12, 74, PA_SHIFT, 130 },
+    // State 12
+    { 12, 76, PA_SHIFT, 131 },
+    // State 12
+    { 12, 77, PA_SHIFT, 132 },
+    // State 12
+    { 12, 78, PA_SHIFT, 133 },
+    // State 12
+    { 12, 79, PA_SHIFT, 134 },
+    // State 12
+    { 12, 80, PA_SHIFT, 135 },
+    // State 12
+    { 12, 81, PA_SHIFT, 136 },
+    // State 12
+    { 12, 82, PA_SHIFT, 137 },
+    // State 12
+    { 12, 83, PA_SHIFT, 138 },
+    // State 12
+    { 12, 84, PA_SHIFT, 139 },
+    // State 12
+    { 12, 85, PA_SHIFT, 140 },
+    // State 12
+    { 12, 87, PA_SHIFT, 141 },
+    // State 12
+    { 12, 88, PA_SHIFT, 142 },
+    // State 12
+    { 12, 89, PA_SHIFT, 143 },
+    // State 12
+    { 12, 90, PA_SHIFT, 144 },
+    // State 12
+    { 12, 91, PA_SHIFT, 145 },
+    // State 12
+    { 12, 92, PA_SHIFT, 146 },
+    // State 12
+    { 12, 93, PA_SHIFT, 147 },
+    // State 12
+    { 12, 94, PA_SHIFT, 148 },
+    // State 12
+    { 12, 95, PA_SHIFT, 149 },
+    // State 12
+    { 12, 97, PA_SHIFT, 13 },
+    // State 12
+    { 12, 98, PA_SHIFT, 108 },
+    // State 12
+    { 12, 99, PA_SHIFT, 109 },
+    // State 12
+    { 12, 100, PA_SHIFT, 110 },
+    // State 13
+    { 13, 47, PA_SHIFT, 14 },
+    // State 13
+    { 13, 103, PA_REDUCE, 11 },
+    // State 13 default action
+    { 13, -1, PA_REDUCE, 11 },
+    // State 14
+    { 14, 1, PA_SHIFT, 99 },
+    // State 14
+    { 14, 2, PA_SHIFT, 98 },
+    // State 14
+    { 14, 54, PA_SHIFT, 111 },
+    // State 14
+    { 14, 55, PA_SHIFT, 112 },
+    // State 14
+    { 14, 56, PA_SHIFT, 113 },
+    // State 14
+    { 14, 57, PA_SHIFT, 114 },
+    // State 14
+    { 14, 58, PA_SHIFT, 115 },
+    // State 14
+    { 14, 59, PA_SHIFT, 116 },
+    // State 14
+    { 14, 60, PA_SHIFT, 117 },
+    // State 14
+    { 14, 61, PA_SHIFT, 118 },
+    // State 14
+    { 14, 62, PA_SHIFT, 119 },
+    // State 14
+    { 14, 63, PA_SHIFT, 120 },
+    // State 14
+    { 14, 65, PA_SHIFT, 121 },
+    // State 14
+    { 14, 66, PA_SHIFT, 122 },
+    // State 14
+    { 14, 67, PA_SHIFT, 123 },
+    // State 14
+    { 14, 68, PA_SHIFT, 124 },
+    // State 14
+    { 14, 69, PA_SHIFT, 125 },
+    // State 14
+    { 14, 70, PA_SHIFT, 126 },
+    // State 14
+    { 14, 71, PA_SHIFT, 127 },
+    // State 14
+    { 14, 72, PA_SHIFT, 128 },
+    // State 14
+    { 14, 73, PA_SHIFT, 129 },
+    // State 14
+    { 14, 74, PA_SHIFT, 130 },
+    // State 14
+    { 14, 76, PA_SHIFT, 131 },
+    // State 14
+    { 14, 77, PA_SHIFT, 132 },
+    // State 14
+    { 14, 78, PA_SHIFT, 133 },
+    // State 14
+    { 14, 79, PA_SHIFT, 134 },
+    // State 14
+    { 14, 80, PA_SHIFT, 135 },
+    // State 14
+    { 14, 81, PA_SHIFT, 136 },
+    // State 14
+    { 14, 82, PA_SHIFT, 137 },
+    // State 14
+    { 14, 83, PA_SHIFT, 138 },
+    // State 14
+    { 14, 84, PA_SHIFT, 139 },
+    // State 14
+    { 14, 85, PA_SHIFT, 140 },
+    // State 14
+    { 14, 87, PA_SHIFT, 141 },
+    // State 14
+    { 14, 88, PA_SHIFT, 142 },
+    // State 14
+    { 14, 89, PA_SHIFT, 143 },
+    // State 14
+    { 14, 90, PA_SHIFT, 144 },
+    // State 14
+    { 14, 91, PA_SHIFT, 145 },
+    // State 14
+    { 14, 92, PA_SHIFT, 146 },
+    // State 14
+    { 14, 93, PA_SHIFT, 147 },
+    // State 14
+    { 14, 94, PA_SHIFT, 148 },
+    // State 14
+    { 14, 95, PA_SHIFT, 149 },
+    // State 14
+    { 14, 98, PA_SHIFT, 15 },
+    // State 14
+    { 14, 99, PA_SHIFT, 109 },
+    // State 14
+    { 14, 100, PA_SHIFT, 110 },
+    // State 15
+    { 15, 48, PA_SHIFT, 16 },
+    // State 15
+    { 15, 103, PA_REDUCE, 13 },
+    // State 15 default action
+    { 15, -1, PA_REDUCE, 13 },
+    // State 16
+    { 16, 1, PA_SHIFT, 99 },
+    // State 16
+    { 16, 2, PA_SHIFT, 98 },
+    // State 16
+    { 16, 54, PA_SHIFT, 111 },
+    // State 16
+    { 16, 55, PA_SHIFT, 112 },
+    // State 16
+    { 16, 56, PA_SHIFT, 113 },
+    // State 16
+    { 16, 57, PA_SHIFT, 114 },
+    // State 16
+    { 16, 58, PA_SHIFT, 115 },
+    // State 16
+    { 16, 59, PA_SHIFT, 116 },
+    // State 16
+    { 16, 60, PA_SHIFT, 117 },
+    // State 16
+    { 16, 61, PA_SHIFT, 118 },
+    // State 16
+    { 16, 62, PA_SHIFT, 119 },
+    // State 16
+    { 16, 63, PA_SHIFT, 120 },
+    // State 16
+    { 16, 65, PA_SHIFT, 121 },
+    // State 16
+    { 16, 66, PA_SHIFT, 122 },
+    // State 16
+    { 16, 67, PA_SHIFT, 123 },
+    // State 16
+    { 16, 68, PA_SHIFT, 124 },
+    // State 16
+    { 16, 69, PA_SHIFT, 125 },
+    // State 16
+    { 16, 70, PA_SHIFT, 126 },
+    // State 16
+    { 16, 71, PA_SHIFT, 127 },
+    // State 16
+    { 16, 72, PA_SHIFT, 128 },
+    // State 16
+    { 16, 73, PA_SHIFT, 129 },
+    // State 16
+    { 16, 74, PA_SHIFT, 130 },
+    // State 16
+    { 16, 76, PA_SHIFT, 131 },
+    // State 16
+    { 16, 77, PA_SHIFT, 132 },
+    // State 16
+    { 16, 78, PA_SHIFT, 133 },
+    // State 16
+    { 16, 79, PA_SHIFT, 134 },
+    // State 16
+    { 16, 80, PA_SHIFT, 135 },
+    // State 16
+    { 16, 81, PA_SHIFT, 136 },
+    // State 16
+    { 16, 82, PA_SHIFT, 137 },
+    // State 16
+    { 16, 83, PA_SHIFT, 138 },
+    // State 16
+    { 16, 84, PA_SHIFT, 139 },
+    // State 16
+    { 16, 85, PA_SHIFT, 140 },
+    // State 16
+    { 16, 87, PA_SHIFT, 141 },
+    // State 16
+    { 16, 88, PA_SHIFT, 142 },
+    // State 16
+    { 16, 89, PA_SHIFT, 143 },
+    // State 16
+    { 16, 90, PA_SHIFT, 144 },
+    // State 16
+    { 16, 91, PA_SHIFT, 145 },
+    // State 16
+    { 16, 92, PA_SHIFT, 146 },
+    // State 16
+    { 16, 93, PA_SHIFT, 147 },
+    // State 16
+    { 16, 94, PA_SHIFT, 148 },
+    // State 16
+    { 16, 95, PA_SHIFT, 149 },
+    // State 16
+    { 16, 99, PA_SHIFT, 17 },
+    // State 16
+    { 16, 100, PA_SHIFT, 110 },
+    // State 17
+    { 17, 49, PA_SHIFT, 18 },
+    // State 17
+    { 17, 103, PA_REDUCE, 15 },
+    // State 17 default action
+    { 17, -1, PA_REDUCE, 15 },
+    // State 18
+    { 18, 1, PA_SHIFT, 99 },
+    // State 18
+    { 18, 2, PA_SHIFT, 98 },
+    // State 18
+    { 18, 54, PA_SHIFT, 111 },
+    // State 18
+    { 18, 55, PA_SHIFT, 112 },
+    // State 18
+    { 18, 56, PA_SHIFT, 113 },
+    // State 18
+    { 18, 57, PA_SHIFT, 114 },
+    // State 18
+    { 18, 58, PA_SHIFT, 115 },
+    // State 18
+    { 18, 59, PA_SHIFT, 116 },
+    // State 18
+    { 18, 60, PA_SHIFT, 117 },
+    // State 18
+    { 18, 61, PA_SHIFT, 118 },
+    // State 18
+    { 18, 62, PA_SHIFT, 119 },
+    // State 18
+    { 18, 63, PA_SHIFT, 120 },
+    // State 18
+    { 18, 65, PA_SHIFT, 121 },
+    // State 18
+    { 18, 66, PA_SHIFT, 122 },
+    // State 18
+    { 18, 67, PA_SHIFT, 123 },
+    // State 18
+    { 18, 68, PA_SHIFT, 124 },
+    // State 18
+    { 18, 69, PA_SHIFT, 125 },
+    // State 18
+    { 18, 70, PA_SHIFT, 126 },
+    // State 18
+    { 18, 71, PA_SHIFT, 127 },
+    // State 18
+    { 18, 72, PA_SHIFT, 128 },
+    // State 18
+    { 18, 73, PA_SHIFT, 129 },
+    // State 18
+    { 18, 74, PA_SHIFT, 130 },
+    // State 18
+    { 18, 76, PA_SHIFT, 131 },
+    // State 18
+    { 18, 77, PA_SHIFT, 132 },
+    // State 18
+    { 18, 78, PA_SHIFT, 133 },
+    // State 18
+    { 18, 79, PA_SHIFT, 134 },
+    // State 18
+    { 18, 80, PA_SHIFT, 135 },
+    // State 18
+    { 18, 81, PA_SHIFT, 136 },
+    // State 18
+    { 18, 82, PA_SHIFT, 137 },
+    // State 18
+    { 18, 83, PA_SHIFT, 138 },
+    // State 18
+    { 18, 84, PA_SHIFT, 139 },
+    // State 18
+    { 18, 85, PA_SHIFT, 140 },
+    // State 18
+    { 18, 87, PA_SHIFT, 141 },
+    // State 18
+    { 18, 88, PA_SHIFT, 142 },
+    // State 18
+    { 18, 89, PA_SHIFT, 143 },
+    // State 18
+    { 18, 90, PA_SHIFT, 144 },
+    // State 18
+    { 18, 91, PA_SHIFT, 145 },
+    // State 18
+    { 18, 92, PA_SHIFT, 146 },
+    // State 18
+    { 18, 93, PA_SHIFT, 147 },
+    // State 18
+    { 18, 94, PA_SHIFT, 148 },
+    // State 18
+    { 18, 95, PA_SHIFT, 149 },
+    // State 18
+    { 18, 100, PA_SHIFT, 19 },
+    // State 19
+    { 19, 50, PA_SHIFT, 20 },
+    // State 19
+    { 19, 103, PA_REDUCE, 17 },
+    // State 19 default action
+    { 19, -1, PA_REDUCE, 17 },
+    // State 20
+    { 20, 1, PA_SHIFT, 99 },
+    // State 20
+    { 20, 2, PA_SHIFT, 98 },
+    // State 20
+    { 20, 54, PA_SHIFT, 21 },
+    // State 20
+    { 20, 55, PA_SHIFT, 112 },
+    // State 20
+    { 20, 56, PA_SHIFT, 113 },
+    // State 20
+    { 20, 57, PA_SHIFT, 114 },
+    // State 20
+    { 20, 58, PA_SHIFT, 115 },
+    // State 20
+    { 20, 59, PA_SHIFT, 116 },
+    // State 20
+    { 20, 60, PA_SHIFT, 117 },
+    // State 20
+    { 20, 61, PA_SHIFT, 118 },
+    // State 20
+    { 20, 62, PA_SHIFT, 119 },
+    // State 20
+    { 20, 63, PA_SHIFT, 120 },
+    // State 20
+    { 20, 65, PA_SHIFT, 121 },
+    // State 20
+    { 20, 66, PA_SHIFT, 122 },
+    // State 20
+    { 20, 67, PA_SHIFT, 123 },
+    // State 20
+    { 20, 68, PA_SHIFT, 124 },
+    // State 20
+    { 20, 69, PA_SHIFT, 125 },
+    // State 20
+    { 20, 70, PA_SHIFT, 126 },
+    // State 20
+    { 20, 71, PA_SHIFT, 127 },
+    // State 20
+    { 20, 72, PA_SHIFT, 128 },
+    // State 20
+    { 20, 73, PA_SHIFT, 129 },
+    // State 20
+    { 20, 74, PA_SHIFT, 130 },
+    // State 20
+    { 20, 76, PA_SHIFT, 131 },
+    // State 20
+    { 20, 77, PA_SHIFT, 132 },
+    // State 20
+    { 20, 78, PA_SHIFT, 133 },
+    // State 20
+    { 20, 79, PA_SHIFT, 134 },
+    // State 20
+    { 20, 80, PA_SHIFT, 135 },
+    // State 20
+    { 20, 81, PA_SHIFT, 136 },
+    // State 20
+    { 20, 82, PA_SHIFT, 137 },
+    // State 20
+    { 20, 83, PA_SHIFT, 138 },
+    // State 20
+    { 20, 84, PA_SHIFT, 139 },
+    // State 20
+    { 20, 85, PA_SHIFT, 140 },
+    // State 20
+    { 20, 87, PA_SHIFT, 141 },
+    // State 20
+    { 20, 88, PA_SHIFT, 142 },
+    // State 20
+    { 20, 89, PA_SHIFT, 143 },
+    // State 20
+    { 20, 90, PA_SHIFT, 144 },
+    // State 20
+    { 20, 91, PA_SHIFT, 145 },
+    // State 20
+    { 20, 92, PA_SHIFT, 146 },
+    // State 20
+    { 20, 93, PA_SHIFT, 147 },
+    // State 20
+    { 20, 94, PA_SHIFT, 148 },
+    // State 20
+    { 20, 95, PA_SHIFT, 149 },
+    // State 21
+    { 21, 5, PA_SHIFT, 22 },
+    // State 21
+    { 21, 103, PA_REDUCE, 19 },
+    // State 21 default action
+    { 21, -1, PA_REDUCE, 19 },
+    // State 22
+    { 22, 1, PA_SHIFT, 99 },
+    // State 22
+    { 22, 2, PA_SHIFT, 98 },
+    // State 22
+    { 22, 55, PA_SHIFT, 23 },
+    // State 22
+    { 22, 56, PA_SHIFT, 113 },
+    // State 22
+    { 22, 57, PA_SHIFT, 114 },
+    // State 22
+    { 22, 58, PA_SHIFT, 115 },
+    // State 22
+    { 22, 59, PA_SHIFT, 116 },
+    // State 22
+    { 22, 60, PA_SHIFT, 117 },
+    // State 22
+    { 22, 61, PA_SHIFT, 118 },
+    // State 22
+    { 22, 62, PA_SHIFT, 119 },
+    // State 22
+    { 22, 63, PA_SHIFT, 120 },
+    // State 22
+    { 22, 65, PA_SHIFT, 121 },
+    // State 22
+    { 22, 66, PA_SHIFT, 122 },
+    // State 22
+    { 22, 67, PA_SHIFT, 123 },
+    // State 22
+    { 22, 68, PA_SHIFT, 124 },
+    // State 22
+    { 22, 69, PA_SHIFT, 125 },
+    // State 22
+    { 22, 70, PA_SHIFT, 126 },
+    // State 22
+    { 22, 71, PA_SHIFT, 127 },
+    // State 22
+    { 22, 72, PA_SHIFT, 128 },
+    // State 22
+    { 22, 73, PA_SHIFT, 129 },
+    // State 22
+    { 22, 74, PA_SHIFT, 130 },
+    // State 22
+    { 22, 76, PA_SHIFT, 131 },
+    // State 22
+    { 22, 77, PA_SHIFT, 132 },
+    // State 22
+    { 22, 78, PA_SHIFT, 133 },
+    // State 22
+    { 22, 79, PA_SHIFT, 134 },
+    // State 22
+    { 22, 80, PA_SHIFT, 135 },
+    // State 22
+    { 22, 81, PA_SHIFT, 136 },
+    // State 22
+    { 22, 82, PA_SHIFT, 137 },
+    // State 22
+    { 22, 83, PA_SHIFT, 138 },
+    // State 22
+    { 22, 84, PA_SHIFT, 139 },
+    // State 22
+    { 22, 85, PA_SHIFT, 140 },
+    // State 22
+    { 22, 87, PA_SHIFT, 141 },
+    // State 22
+    { 22, 88, PA_SHIFT, 142 },
+    // State 22
+    { 22, 89, PA_SHIFT, 143 },
+    // State 22
+    { 22, 90, PA_SHIFT, 144 },
+    // State 22
+    { 22, 91, PA_SHIFT, 145 },
+    // State 22
+    { 22, 92, PA_SHIFT, 146 },
+    // State 22
+    { 22, 93, PA_SHIFT, 147 },
+    // State 22
+    { 22, 94, PA_SHIFT, 148 },
+    // State 22
+    { 22, 95, PA_SHIFT, 149 },
+    // State 23
+    { 23, 6, PA_SHIFT, 24 },
+    // State 23
+    { 23, 103, PA_REDUCE, 21 },
+    // State 23 default action
+    { 23, -1, PA_REDUCE, 21 },
+    // State 24
+    { 24, 1, PA_SHIFT, 99 },
+    // State 24
+    { 24, 2, PA_SHIFT, 98 },
+    // State 24
+    { 24, 56, PA_SHIFT, 25 },
+    // State 24
+    { 24, 57, PA_SHIFT, 114 },
+    // State 24
+    { 24, 58, PA_SHIFT, 115 },
+    // State 24
+    { 24, 59, PA_SHIFT, 116 },
+    // State 24
+    { 24, 60, PA_SHIFT, 117 },
+    // State 24
+    { 24, 61, PA_SHIFT, 118 },
+    // State 24
+    { 24, 62, PA_SHIFT, 119 },
+    // State 24
+    { 24, 63, PA_SHIFT, 120 },
+    // State 24
+    { 24, 65, PA_SHIFT, 121 },
+    // State 24
+    { 24, 66, PA_SHIFT, 122 },
+    // State 24
+    { 24, 67, PA_SHIFT, 123 },
+    // State 24
+    { 24, 68, PA_SHIFT, 124 },
+    // State 24
+    { 24, 69, PA_SHIFT, 125 },
+    // State 24
+    { 24, 70, PA_SHIFT, 126 },
+    // State 24
+    { 24, 71, PA_SHIFT, 127 },
+    // State 24
+    { 24, 72, PA_SHIFT, 128 },
+    // State 24
+    { 24, 73, PA_SHIFT, 129 },
+    // State 24
+    { 24, 74, PA_SHIFT, 130 },
+    // State 24
+    { 24, 76, PA_SHIFT, 131 },
+    // State 24
+    { 24, 77, PA_SHIFT, 132 },
+    // State 24
+    { 24, 78, PA_SHIFT, 133 },
+    // State 24
+    { 24, 79, PA_SHIFT, 134 },
+    // State 24
+    { 24, 80, PA_SHIFT, 135 },
+    // State 24
+    { 24, 81, PA_SHIFT, 136 },
+    // State 24
+    { 24, 82, PA_SHIFT, 137 },
+    // State 24
+    { 24, 83, PA_SHIFT, 138 },
+    // State 24
+    { 24, 84, PA_SHIFT, 139 },
+    // State 24
+    { 24, 85, PA_SHIFT, 140 },
+    // State 24
+    { 24, 87, PA_SHIFT, 141 },
+    // State 24
+    { 24, 88, PA_SHIFT, 142 },
+    // State 24
+    { 24, 89, PA_SHIFT, 143 },
+    // State 24
+    { 24, 90, PA_SHIFT, 144 },
+    // State 24
+    { 24, 91, PA_SHIFT, 145 },
+    // State 24
+    { 24, 92, PA_SHIFT, 146 },
+    // State 24
+    { 24, 93, PA_SHIFT, 147 },
+    // State 24
+    { 24, 94, PA_SHIFT, 148 },
+    // State 24
+    { 24, 95, PA_SHIFT, 149 },
+    // State 25
+    { 25, 7, PA_SHIFT, 26 },
+    // State 25
+    { 25, 103, PA_REDUCE, 23 },
+    // State 25 default action
+    { 25, -1, PA_REDUCE, 23 },
+    // State 26
+    { 26, 1, PA_SHIFT, 99 },
+    // State 26
+    { 26, 2, PA_SHIFT, 98 },
+    // State 26
+    { 26, 57, PA_SHIFT, 27 },
+    // State 26
+    { 26, 58, PA_SHIFT, 115 },
+    // State 26
+    { 26, 59, PA_SHIFT, 116 },
+    // State 26
+    { 26, 60, PA_SHIFT, 117 },
+    // State 26
+    { 26, 61, PA_SHIFT, 118 },
+    // State 26
+    { 26, 62, PA_SHIFT, 119 },
+    // State 26
+    { 26, 63, PA_SHIFT, 120 },
+    // State 26
+    { 26, 65, PA_SHIFT, 121 },
+    // State 26
+    { 26, 66, PA_SHIFT, 122 },
+    // State 26
+    { 26, 67, PA_SHIFT, 123 },
+    // State 26
+    { 26, 68, PA_SHIFT, 124 },
+    // State 26
+    { 26, 69, PA_SHIFT, 125 },
+    // State 26
+    { 26, 70, PA_SHIFT, 126 },
+    // State 26
+    { 26, 71, PA_SHIFT, 127 },
+    // State 26
+    { 26, 72, PA_SHIFT, 128 },
+    // State 26
+    { 26, 73, PA_SHIFT, 129 },
+    // State 26
+    { 26, 74, PA_SHIFT, 130 },
+    // State 26
+    { 26, 76, PA_SHIFT, 131 },
+    // State 26
+    { 26, 77, PA_SHIFT, 132 },
+    // State 26
+    { 26, 78, PA_SHIFT, 133 },
+    // State 26
+    { 26, 79, PA_SHIFT, 134 },
+    // State 26
+    { 26, 80, PA_SHIFT, 135 },
+    // State 26
+    { 26, 81, PA_SHIFT, 136 },
+    // State 26
+    { 26, 82, PA_SHIFT, 137 },
+    // State 26
+    { 26, 83, PA_SHIFT, 138 },
+    // State 26
+    { 26, 84, PA_SHIFT, 139 },
+    // State 26
+    { 26, 85, PA_SHIFT, 140 },
+    // State 26
+    { 26, 87, PA_SHIFT, 141 },
+    // State 26
+    { 26, 88, PA_SHIFT, 142 },
+    // State 26
+    { 26, 89, PA_SHIFT, 143 },
+    // State 26
+    { 26, 90, PA_SHIFT, 144 },
+    // State 26
+    { 26, 91, PA_SHIFT, 145 },
+    // State 26
+    { 26, 92, PA_SHIFT, 146 },
+    // State 26
+    { 26, 93, PA_SHIFT, 147 },
+    // State 26
+    { 26, 94, PA_SHIFT, 148 },
+    // State 26
+    { 26, 95, PA_SHIFT, 149 },
+    // State 27
+    { 27, 8, PA_SHIFT, 28 },
+    // State 27
+    { 27, 103, PA_REDUCE, 25 },
+    // State 27 default action
+    { 27, -1, PA_REDUCE, 25 },
+    // State 28
+    { 28, 1, PA_SHIFT, 99 },
+    // State 28
+    { 28, 2, PA_SHIFT, 98 },
+    // State 28
+    { 28, 58, PA_SHIFT, 29 },
+    // State 28
+    { 28, 59, PA_SHIFT, 116 },
+    // State 28
+    { 28, 60, PA_SHIFT, 117 },
+    // State 28
+    { 28, 61, PA_SHIFT, 118 },
+    // State 28
+    { 28, 62, PA_SHIFT, 119 },
+    // State 28
+    { 28, 63, PA_SHIFT, 120 },
+    // State 28
+    { 28, 65, PA_SHIFT, 121 },
+    // State 28
+    { 28, 66, PA_SHIFT, 122 },
+    // State 28
+    { 28, 67, PA_SHIFT, 123 },
+    // State 28
+    { 28, 68, PA_SHIFT, 124 },
+    // State 28
+    { 28, 69, PA_SHIFT, 125 },
+    // State 28
+    { 28, 70, PA_SHIFT, 126 },
+    // State 28
+    { 28, 71, PA_SHIFT, 127 },
+    // State 28
+    { 28, 72, PA_SHIFT, 128 },
+    // State 28
+    { 28, 73, PA_SHIFT, 129 },
+    // State 28
+    { 28, 74, PA_SHIFT, 130 },
+    // State 28
+    { 28, 76, PA_SHIFT, 131 },
+    // State 28
+    { 28, 77, PA_SHIFT, 132 },
+    // State 28
+    { 28, 78, PA_SHIFT, 133 },
+    // State 28
+    { 28, 79, PA_SHIFT, 134 },
+    // State 28
+    { 28, 80, PA_SHIFT, 135 },
+    // State 28
+    { 28, 81, PA_SHIFT, 136 },
+    // State 28
+    { 28, 82, PA_SHIFT, 137 },
+    // State 28
+    { 28, 83, PA_SHIFT, 138 },
+    // State 28
+    { 28, 84, PA_SHIFT, 139 },
+    // State 28
+    { 28, 85, PA_SHIFT, 140 },
+    // State 28
+    { 28, 87, PA_SHIFT, 141 },
+    // State 28
+    { 28, 88, PA_SHIFT, 142 },
+    // State 28
+    { 28, 89, PA_SHIFT, 143 },
+    // State 28
+    { 28, 90, PA_SHIFT, 144 },
+    // State 28
+    { 28, 91, PA_SHIFT, 145 },
+    // State 28
+    { 28, 92, PA_SHIFT, 146 },
+    // State 28
+    { 28, 93, PA_SHIFT, 147 },
+    // State 28
+    { 28, 94, PA_SHIFT, 148 },
+    // State 28
+    { 28, 95, PA_SHIFT, 149 },
+    // State 29
+    { 29, 9, PA_SHIFT, 30 },
+    // State 29
+    { 29, 103, PA_REDUCE, 27 },
+    // State 29 default action
+    { 29, -1, PA_REDUCE, 27 },
+    // State 30
+    { 30, 1, PA_SHIFT, 99 },
+    // State 30
+    { 30, 2, PA_SHIFT, 98 },
+    // State 30
+    { 30, 59, PA_SHIFT, 31 },
+    // State 30
+    { 30, 60, PA_SHIFT, 117 },
+    // State 30
+    { 30, 61, PA_SHIFT, 118 },
+    // State 30
+    { 30, 62, PA_SHIFT, 119 },
+    // State 30
+    { 30, 63, PA_SHIFT, 120 },
+    // State 30
+    { 30, 65, PA_SHIFT, 121 },
+    // State 30
+    { 30, 66, PA_SHIFT, 122 },
+    // State 30
+    { 30, 67, PA_SHIFT, 123 },
+    // State 30
+    { 30, 68, PA_SHIFT, 124 },
+    // State 30
+    { 30, 69, PA_SHIFT, 125 },
+    // State 30
+    { 30, 70, PA_SHIFT, 126 },
+    // State 30
+    { 30, 71, PA_SHIFT, 127 },
+    // State 30
+    { 30, 72, PA_SHIFT, 128 },
+    // State 30
+    { 30, 73, PA_SHIFT, 129 },
+    // State 30
+    { 30, 74, PA_SHIFT, 130 },
+    // State 30
+    { 30, 76, PA_SHIFT, 131 },
+    // State 30
+    { 30, 77, PA_SHIFT, 132 },
+    // State 30
+    { 30, 78, PA_SHIFT, 133 },
+    // State 30
+    { 30, 79, PA_SHIFT, 134 },
+    // State 30
+    { 30, 80, PA_SHIFT, 135 },
+    // State 30
+    { 30, 81, PA_SHIFT, 136 },
+    // State 30
+    { 30, 82, PA_SHIFT, 137 },
+    // State 30
+    { 30, 83, PA_SHIFT, 138 },
+    // State 30
+    { 30, 84, PA_SHIFT, 139 },
+    // State 30
+    { 30, 85, PA_SHIFT, 140 },
+    // State 30
+    { 30, 87, PA_SHIFT, 141 },
+    // State 30
+    { 30, 88, PA_SHIFT, 142 },
+    // State 30
+    { 30, 89, PA_SHIFT, 143 },
+    // State 30
+    { 30, 90, PA_SHIFT, 144 },
+    // State 30
+    { 30, 91, PA_SHIFT, 145 },
+    // State 30
+    { 30, 92, PA_SHIFT, 146 },
+    // State 30
+    { 30, 93, PA_SHIFT, 147 },
+    // State 30
+    { 30, 94, PA_SHIFT, 148 },
+    // State 30
+    { 30, 95, PA_SHIFT, 149 },
+    // State 31
+    { 31, 10, PA_SHIFT, 32 },
+    // State 31
+    { 31, 103, PA_REDUCE, 29 },
+    // State 31 default action
+    { 31, -1, PA_REDUCE, 29 },
+    // State 32
+    { 32, 1, PA_SHIFT, 99 },
+    // State 32
+    { 32, 2, PA_SHIFT, 98 },
+    // State 32
+    { 32, 60, PA_SHIFT, 33 },
+    // State 32
+    { 32, 61, PA_SHIFT, 118 },
+    // State 32
+    { 32, 62, PA_SHIFT, 119 },
+    // State 32
+    { 32, 63, PA_SHIFT, 120 },
+    // State 32
+    { 32, 65, PA_SHIFT, 121 },
+    // State 32
+    { 32, 66, PA_SHIFT, 122 },
+    // State 32
+    { 32, 67, PA_SHIFT, 123 },
+    // State 32
+    { 32, 68, PA_SHIFT, 124 },
+    // State 32
+    { 32, 69, PA_SHIFT, 125 },
+    // State 32
+    { 32, 70, PA_SHIFT, 126 },
+    // State 32
+    { 32, 71, PA_SHIFT, 127 },
+    // State 32
+    { 32, 72, PA_SHIFT, 128 },
+    // State 32
+    { 32, 73, PA_SHIFT, 129 },
+    // State 32
+    { 32, 74, PA_SHIFT, 130 },
+    // State 32
+    { 32, 76, PA_SHIFT, 131 },
+    // State 32
+    { 32, 77, PA_SHIFT, 132 },
+    // State 32
+    { 32, 78, PA_SHIFT, 133 },
+    // State 32
+    { 32, 79, PA_SHIFT, 134 },
+    // State 32
+    { 32, 80, PA_SHIFT, 135 },
+    // State 32
+    { 32, 81, PA_SHIFT, 136 },
+    // State 32
+    { 32, 82, PA_SHIFT, 137 },
+    // State 32
+    { 32, 83, PA_SHIFT, 138 },
+    // State 32
+    { 32, 84, PA_SHIFT, 139 },
+    // State 32
+    { 32, 85, PA_SHIFT, 140 },
+    // State 32
+    { 32, 87, PA_SHIFT, 141 },
+    // State 32
+    { 32, 88, PA_SHIFT, 142 },
+    // State 32
+    { 32, 89, PA_SHIFT, 143 },
+    // State 32
+    { 32, 90, PA_SHIFT, 144 },
+    // State 32
+    { 32, 91, PA_SHIFT, 145 },
+    // State 32
+    { 32, 92, PA_SHIFT, 146 },
+    // State 32
+    { 32, 93, PA_SHIFT, 147 },
+    // State 32
+    { 32, 94, PA_SHIFT, 148 },
+    // State 32
+    { 32, 95, PA_SHIFT, 149 },
+    // State 33
+    { 33, 11, PA_SHIFT, 34 },
+    // State 33
+    { 33, 103, PA_REDUCE, 31 },
+    // State 33 default action
+    { 33, -1, PA_REDUCE, 31 },
+    // State 34
+    { 34, 1, PA_SHIFT, 99 },
+    // State 34
+    { 34, 2, PA_SHIFT, 98 },
+    // State 34
+    { 34, 61, PA_SHIFT, 35 },
+    // State 34
+    { 34, 62, PA_SHIFT, 119 },
+    // State 34
+    { 34, 63, PA_SHIFT, 120 },
+    // State 34
+    { 34, 65, PA_SHIFT, 121 },
+    // State 34
+    { 34, 66, PA_SHIFT, 122 },
+    // State 34
+    { 34, 67, PA_SHIFT, 123 },
+    // State 34
+    { 34, 68, PA_SHIFT, 124 },
+    // State 34
+    { 34, 69, PA_SHIFT, 125 },
+    // State 34
+    { 34, 70, PA_SHIFT, 126 },
+    // State 34
+    { 34, 71, PA_SHIFT, 127 },
+    // State 34
+    { 34, 72, PA_SHIFT, 128 },
+    // State 34
+    { 34, 73, PA_SHIFT, 129 },
+    // State 34
+    { 34, 74, PA_SHIFT, 130 },
+    // State 34
+    { 34, 76, PA_SHIFT, 131 },
+    // State 34
+    { 34, 77, PA_SHIFT, 132 },
+    // State 34
+    { 34, 78, PA_SHIFT, 133 },
+    // State 34
+    { 34, 79, PA_SHIFT, 134 },
+    // State 34
+    { 34, 80, PA_SHIFT, 135 },
+    // State 34
+    { 34, 81, PA_SHIFT, 136 },
+    // State 34
+    { 34, 82, PA_SHIFT, 137 },
+    // State 34
+    { 34, 83, PA_SHIFT, 138 },
+    // State 34
+    { 34, 84, PA_SHIFT, 139 },
+    // State 34
+    { 34, 85, PA_SHIFT, 140 },
+    // State 34
+    { 34, 87, PA_SHIFT, 141 },
+    // State 34
+    { 34, 88, PA_SHIFT, 142 },
+    // State 34
+    { 34, 89, PA_SHIFT, 143 },
+    // State 34
+    { 34, 90, PA_SHIFT, 144 },
+    // State 34
+    { 34, 91, PA_SHIFT, 145 },
+    // State 34
+    { 34, 92, PA_SHIFT, 146 },
+    // State 34
+    { 34, 93, PA_SHIFT, 147 },
+    // State 34
+    { 34, 94, PA_SHIFT, 148 },
+    // State 34
+    { 34, 95, PA_SHIFT, 149 },
+    // State 35
+    { 35, 12, PA_SHIFT, 36 },
+    // State 35
+    { 35, 103, PA_REDUCE, 33 },
+    // State 35 default action
+    { 35, -1, PA_REDUCE, 33 },
+    // State 36
+    { 36, 1, PA_SHIFT, 99 },
+    // State 36
+    { 36, 2, PA_SHIFT, 98 },
+    // State 36
+    { 36, 62, PA_SHIFT, 37 },
+    // State 36
+    { 36, 63, PA_SHIFT, 120 },
+    // State 36
+    { 36, 65, PA_SHIFT, 121 },
+    // State 36
+    { 36, 66, PA_SHIFT, 122 },
+    // State 36
+    { 36, 67, PA_SHIFT, 123 },
+    // State 36
+    { 36, 68, PA_SHIFT, 124 },
+    // State 36
+    { 36, 69, PA_SHIFT, 125 },
+    // State 36
+    { 36, 70, PA_SHIFT, 126 },
+    // State 36
+    { 36, 71, PA_SHIFT, 127 },
+    // State 36
+    { 36, 72, PA_SHIFT, 128 },
+    // State 36
+    { 36, 73, PA_SHIFT, 129 },
+    // State 36
+    { 36, 74, PA_SHIFT, 130 },
+    // State 36
+    { 36, 76, PA_SHIFT, 131 },
+    // State 36
+    { 36, 77, PA_SHIFT, 132 },
+    // State 36
+    { 36, 78, PA_SHIFT, 133 },
+    // State 36
+    { 36, 79, PA_SHIFT, 134 },
+    // State 36
+    { 36, 80, PA_SHIFT, 135 },
+    // State 36
+    { 36, 81, PA_SHIFT, 136 },
+    // State 36
+    { 36, 82, PA_SHIFT, 137 },
+    // State 36
+    { 36, 83, PA_SHIFT, 138 },
+    // State 36
+    { 36, 84, PA_SHIFT, 139 },
+    // State 36
+    { 36, 85, PA_SHIFT, 140 },
+    // State 36
+    { 36, 87, PA_SHIFT, 141 },
+    // State 36
+    { 36, 88, PA_SHIFT, 142 },
+    // State 36
+    { 36, 89, PA_SHIFT, 143 },
+    // State 36
+    { 36, 90, PA_SHIFT, 144 },
+    // State 36
+    { 36, 91, PA_SHIFT, 145 },
+    // State 36
+    { 36, 92, PA_SHIFT, 146 },
+    // State 36
+    { 36, 93, PA_SHIFT, 147 },
+    // State 36
+    { 36, 94, PA_SHIFT, 148 },
+    // State 36
+    { 36, 95, PA_SHIFT, 149 },
+    // State 37
+    { 37, 13, PA_SHIFT, 38 },
+    // State 37
+    { 37, 103, PA_REDUCE, 35 },
+    // State 37 default action
+    { 37, -1, PA_REDUCE, 35 },
+    // State 38
+    { 38, 1, PA_SHIFT, 99 },
+    // State 38
+    { 38, 2, PA_SHIFT, 98 },
+    // State 38
+    { 38, 63, PA_SHIFT, 39 },
+    // State 38
+    { 38, 65, PA_SHIFT, 121 },
+    // State 38
+    { 38, 66, PA_SHIFT, 122 },
+    // State 38
+    { 38, 67, PA_SHIFT, 123 },
+    // State 38
+    { 38, 68, PA_SHIFT, 124 },
+    // State 38
+    { 38, 69, PA_SHIFT, 125 },
+    // State 38
+    { 38, 70, PA_SHIFT, 126 },
+    // State 38
+    { 38, 71, PA_SHIFT, 127 },
+    // State 38
+    { 38, 72, PA_SHIFT, 128 },
+    // State 38
+    { 38, 73, PA_SHIFT, 129 },
+    // State 38
+    { 38, 74, PA_SHIFT, 130 },
+    // State 38
+    { 38, 76, PA_SHIFT, 131 },
+    // State 38
+    { 38, 77, PA_SHIFT, 132 },
+    // State 38
+    { 38, 78, PA_SHIFT, 133 },
+    // State 38
+    { 38, 79, PA_SHIFT, 134 },
+    // State 38
+    { 38, 80, PA_SHIFT, 135 },
+    // State 38
+    { 38, 81, PA_SHIFT, 136 },
+    // State 38
+    { 38, 82, PA_SHIFT, 137 },
+    // State 38
+    { 38, 83, PA_SHIFT, 138 },
+    // State 38
+    { 38, 84, PA_SHIFT, 139 },
+    // State 38
+    { 38, 85, PA_SHIFT, 140 },
+    // State 38
+    { 38, 87, PA_SHIFT, 141 },
+    // State 38
+    { 38, 88, PA_SHIFT, 142 },
+    // State 38
+    { 38, 89, PA_SHIFT, 143 },
+    // State 38
+    { 38, 90, PA_SHIFT, 144 },
+    // State 38
+    { 38, 91, PA_SHIFT, 145 },
+    // State 38
+    { 38, 92, PA_SHIFT, 146 },
+    // State 38
+    { 38, 93, PA_SHIFT, 147 },
+    // State 38
+    { 38, 94, PA_SHIFT, 148 },
+    // State 38
+    { 38, 95, PA_SHIFT, 149 },
+    // State 39
+    { 39, 14, PA_SHIFT, 40 },
+    // State 39
+    { 39, 103, PA_REDUCE, 37 },
+    // State 39 default action
+    { 39, -1, PA_REDUCE, 37 },
+    // State 40
+    { 40, 1, PA_SHIFT, 99 },
+    // State 40
+    { 40, 2, PA_SHIFT, 98 },
+    // State 40
+    { 40, 65, PA_SHIFT, 41 },
+    // State 40
+    { 40, 66, PA_SHIFT, 122 },
+    // State 40
+    { 40, 67, PA_SHIFT, 123 },
+    // State 40
+    { 40, 68, PA_SHIFT, 124 },
+    // State 40
+    { 40, 69, PA_SHIFT, 125 },
+    // State 40
+    { 40, 70, PA_SHIFT, 126 },
+    // State 40
+    { 40, 71, PA_SHIFT, 127 },
+    // State 40
+    { 40, 72, PA_SHIFT, 128 },
+    // State 40
+    { 40, 73, PA_SHIFT, 129 },
+    // State 40
+    { 40, 74, PA_SHIFT, 130 },
+    // State 40
+    { 40, 76, PA_SHIFT, 131 },
+    // State 40
+    { 40, 77, PA_SHIFT, 132 },
+    // State 40
+    { 40, 78, PA_SHIFT, 133 },
+    // State 40
+    { 40, 79, PA_SHIFT, 134 },
+    // State 40
+    { 40, 80, PA_SHIFT, 135 },
+    // State 40
+    { 40, 81, PA_SHIFT, 136 },
+    // State 40
+    { 40, 82, PA_SHIFT, 137 },
+    // State 40
+    { 40, 83, PA_SHIFT, 138 },
+    // State 40
+    { 40, 84, PA_SHIFT, 139 },
+    // State 40
+    { 40, 85, PA_SHIFT, 140 },
+    // State 40
+    { 40, 87, PA_SHIFT, 141 },
+    // State 40
+    { 40, 88, PA_SHIFT, 142 },
+    // State 40
+    { 40, 89, PA_SHIFT, 143 },
+    // State 40
+    { 40, 90, PA_SHIFT, 144 },
+    // State 40
+    { 40, 91, PA_SHIFT, 145 },
+    // State 40
+    { 40, 92, PA_SHIFT, 146 },
+    // State 40
+    { 40, 93, PA_SHIFT, 147 },
+    // State 40
+    { 40, 94, PA_SHIFT, 148 },
+    // State 40
+    { 40, 95, PA_SHIFT, 149 },
+    // State 41
+    { 41, 16, PA_SHIFT, 42 },
+    // State 41
+    { 41, 103, PA_REDUCE, 39 },
+    // State 41 default action
+    { 41, -1, PA_REDUCE, 39 },
+    // State 42
+    { 42, 1, PA_SHIFT, 99 },
+    // State 42
+    { 42, 2, PA_SHIFT, 98 },
+    // State 42
+    { 42, 66, PA_SHIFT, 43 },
+    // State 42
+    { 42, 67, PA_SHIFT, 123 },
+    // State 42
+    { 42, 68, PA_SHIFT, 124 },
+    // State 42
+    { 42, 69, PA_SHIFT, 125 },
+    // State 42
+    { 42, 70, PA_SHIFT, 126 },
+    // State 42
+    { 42, 71, PA_SHIFT, 127 },
+    // State 42
+    { 42, 72, PA_SHIFT, 128 },
+    // State 42
+    { 42, 73, PA_SHIFT, 129 },
+    // State 42
+    { 42, 74, PA_SHIFT, 130 },
+    // State 42
+    { 42, 76, PA_SHIFT, 131 },
+    // State 42
+    { 42, 77, PA_SHIFT, 132 },
+    // State 42
+    { 42, 78, PA_SHIFT, 133 },
+    // State 42
+    { 42, 79, PA_SHIFT, 134 },
+    // State 42
+    { 42, 80, PA_SHIFT, 135 },
+    // State 42
+    { 42, 81, PA_SHIFT, 136 },
+    // State 42
+    { 42, 82, PA_SHIFT, 137 },
+    // State 42
+    { 42, 83, PA_SHIFT, 138 },
+    // State 42
+    { 42, 84, PA_SHIFT, 139 },
+    // State 42
+    { 42, 85, PA_SHIFT, 140 },
+    // State 42
+    { 42, 87, PA_SHIFT, 141 },
+    // State 42
+    { 42, 88, PA_SHIFT, 142 },
+    // State 42
+    { 42, 89, PA_SHIFT, 143 },
+    // State 42
+    { 42, 90, PA_SHIFT, 144 },
+    // State 42
+    { 42, 91, PA_SHIFT, 145 },
+    // State 42
+    { 42, 92, PA_SHIFT, 146 },
+    // State 42
+    { 42, 93, PA_SHIFT, 147 },
+    // State 42
+    { 42, 94, PA_SHIFT, 148 },
+    // State 42
+    { 42, 95, PA_SHIFT, 149 },
+    // State 43
+    { 43, 17, PA_SHIFT, 44 },
+    // State 43
+    { 43, 103, PA_REDUCE, 41 },
+    // State 43 default action
+    { 43, -1, PA_REDUCE, 41 },
+    // State 44
+    { 44, 1, PA_SHIFT, 99 },
+    // State 44
+    { 44, 2, PA_SHIFT, 98 },
+    // State 44
+    { 44, 67, PA_SHIFT, 45 },
+    // State 44
+    { 44, 68, PA_SHIFT, 124 },
+    // State 44
+    { 44, 69, PA_SHIFT, 125 },
+    // State 44
+    { 44, 70, PA_SHIFT, 126 },
+    // State 44
+    { 44, 71, PA_SHIFT, 127 },
+    // State 44
+    { 44, 72, PA_SHIFT, 128 },
+    // State 44
+    { 44, 73, PA_SHIFT, 129 },
+    // State 44
+    { 44, 74, PA_SHIFT, 130 },
+    // State 44
+    { 44, 76, PA_SHIFT, 131 },
+    // State 44
+    { 44, 77, PA_SHIFT, 132 },
+    // State 44
+    { 44, 78, PA_SHIFT, 133 },
+    // State 44
+    { 44, 79, PA_SHIFT, 134 },
+    // State 44
+    { 44, 80, PA_SHIFT, 135 },
+    // State 44
+    { 44, 81, PA_SHIFT, 136 },
+    // State 44
+    { 44, 82, PA_SHIFT, 137 },
+    // State 44
+    { 44, 83, PA_SHIFT, 138 },
+    // State 44
+    { 44, 84, PA_SHIFT, 139 },
+    // State 44
+    { 44, 85, PA_SHIFT, 140 },
+    // State 44
+    { 44, 87, PA_SHIFT, 141 },
+    // State 44
+    { 44, 88, PA_SHIFT, 142 },
+    // State 44
+    { 44, 89, PA_SHIFT, 143 },
+    // State 44
+    { 44, 90, PA_SHIFT, 144 },
+    // State 44
+    { 44, 91, PA_SHIFT, 145 },
+    // State 44
+    { 44, 92, PA_SHIFT, 146 },
+    // State 44
+    { 44, 93, PA_SHIFT, 147 },
+    // State 44
+    { 44, 94, PA_SHIFT, 148 },
+    // State 44
+    { 44, 95, PA_SHIFT, 149 },
+    // State 45
+    { 45, 18, PA_SHIFT, 46 },
+    // State 45
+    { 45, 103, PA_REDUCE, 43 },
+    // State 45 default action
+    { 45, -1, PA_REDUCE, 43 },
+    // State 46
+    { 46, 1, PA_SHIFT, 99 },
+    // State 46
+    { 46, 2, PA_SHIFT, 98 },
+    // State 46
+    { 46, 68, PA_SHIFT, 47 },
+    // State 46
+    { 46, 69, PA_SHIFT, 125 },
+    // State 46
+    { 46, 70, PA_SHIFT, 126 },
+    // State 46
+    { 46, 71, PA_SHIFT, 127 },
+    // State 46
+    { 46, 72, PA_SHIFT, 128 },
+    // State 46
+    { 46, 73, PA_SHIFT, 129 },
+    // State 46
+    { 46, 74, PA_SHIFT, 130 },
+    // State 46
+    { 46, 76, PA_SHIFT, 131 },
+    // State 46
+    { 46, 77, PA_SHIFT, 132 },
+    // State 46
+    { 46, 78, PA_SHIFT, 133 },
+    // State 46
+    { 46, 79, PA_SHIFT, 134 },
+    // State 46
+    { 46, 80, PA_SHIFT, 135 },
+    // State 46
+    { 46, 81, PA_SHIFT, 136 },
+    // State 46
+    { 46, 82, PA_SHIFT, 137 },
+    // State 46
+    { 46, 83, PA_SHIFT, 138 },
+    // State 46
+    { 46, 84, PA_SHIFT, 139 },
+    // State 46
+    { 46, 85, PA_SHIFT, 140 },
+    // State 46
+    { 46, 87, PA_SHIFT, 141 },
+    // State 46
+    { 46, 88, PA_SHIFT, 142 },
+    // State 46
+    { 46, 89, PA_SHIFT, 143 },
+    // State 46
+    { 46, 90, PA_SHIFT, 144 },
+    // State 46
+    { 46, 91, PA_SHIFT, 145 },
+    // State 46
+    { 46, 92, PA_SHIFT, 146 },
+    // State 46
+    { 46, 93, PA_SHIFT, 147 },
+    // State 46
+    { 46, 94, PA_SHIFT, 148 },
+    // State 46
+    { 46, 95, PA_SHIFT, 149 },
+    // State 47
+    { 47, 19, PA_SHIFT, 48 },
+    // State 47
+    { 47, 103, PA_REDUCE, 45 },
+    // State 47 default action
+    { 47, -1, PA_REDUCE, 45 },
+    // State 48
+    { 48, 1, PA_SHIFT, 99 },
+    // State 48
+    { 48, 2, PA_SHIFT, 98 },
+    // State 48
+    { 48, 69, PA_SHIFT, 49 },
+    // State 48
+    { 48, 70, PA_SHIFT, 126 },
+    // State 48
+    { 48, 71, PA_SHIFT, 127 },
+    // State 48
+    { 48, 72, PA_SHIFT, 128 },
+    // State 48
+    { 48, 73, PA_SHIFT, 129 },
+    // State 48
+    { 48, 74, PA_SHIFT, 130 },
+    // State 48
+    { 48, 76, PA_SHIFT, 131 },
+    // State 48
+    { 48, 77, PA_SHIFT, 132 },
+    // State 48
+    { 48, 78, PA_SHIFT, 133 },
+    // State 48
+    { 48, 79, PA_SHIFT, 134 },
+    // State 48
+    { 48, 80, PA_SHIFT, 135 },
+    // State 48
+    { 48, 81, PA_SHIFT, 136 },
+    // State 48
+    { 48, 82, PA_SHIFT, 137 },
+    // State 48
+    { 48, 83, PA_SHIFT, 138 },
+    // State 48
+    { 48, 84, PA_SHIFT, 139 },
+    // State 48
+    { 48, 85, PA_SHIFT, 140 },
+    // State 48
+    { 48, 87, PA_SHIFT, 141 },
+    // State 48
+    { 48, 88, PA_SHIFT, 142 },
+    // State 48
+    { 48, 89, PA_SHIFT, 143 },
+    // State 48
+    { 48, 90, PA_SHIFT, 144 },
+    // State 48
+    { 48, 91, PA_SHIFT, 145 },
+    // State 48
+    { 48, 92, PA_SHIFT, 146 },
+    // State 48
+    { 48, 93, PA_SHIFT, 147 },
+    // State 48
+    { 48, 94, PA_SHIFT, 148 },
+    // State 48
+    { 48, 95, PA_SHIFT, 149 },
+    // State 49
+    { 49, 20, PA_SHIFT, 50 },
+    // State 49
+    { 49, 103, PA_REDUCE, 47 },
+    // State 49 default action
+    { 49, -1, PA_REDUCE, 47 },
+    // State 50
+    { 50, 1, PA_SHIFT, 99 },
+    // State 50
+    { 50, 2, PA_SHIFT, 98 },
+    // State 50
+    { 50, 70, PA_SHIFT, 51 },
+    // State 50
+    { 50, 71, PA_SHIFT, 127 },
+    // State 50
+    { 50, 72, PA_SHIFT, 128 },
+    // State 50
+    { 50, 73, PA_SHIFT, 129 },
+    // State 50
+    { 50, 74, PA_SHIFT, 130 },
+    // State 50
+    { 50, 76, PA_SHIFT, 131 },
+    // State 50
+    { 50, 77, PA_SHIFT, 132 },
+    // State 50
+    { 50, 78, PA_SHIFT, 133 },
+    // State 50
+    { 50, 79, PA_SHIFT, 134 },
+    // State 50
+    { 50, 80, PA_SHIFT, 135 },
+    // State 50
+    { 50, 81, PA_SHIFT, 136 },
+    // State 50
+    { 50, 82, PA_SHIFT, 137 },
+    // State 50
+    { 50, 83, PA_SHIFT, 138 },
+    // State 50
+    { 50, 84, PA_SHIFT, 139 },
+    // State 50
+    { 50, 85, PA_SHIFT, 140 },
+    // State 50
+    { 50, 87, PA_SHIFT, 141 },
+    // State 50
+    { 50, 88, PA_SHIFT, 142 },
+    // State 50
+    { 50, 89, PA_SHIFT, 143 },
+    // State 50
+    { 50, 90, PA_SHIFT, 144 },
+    // State 50
+    { 50, 91, PA_SHIFT, 145 },
+    // State 50
+    { 50, 92, PA_SHIFT, 146 },
+    // State 50
+    { 50, 93, PA_SHIFT, 147 },
+    // State 50
+    { 50, 94, PA_SHIFT, 148 },
+    // State 50
+    { 50, 95, PA_SHIFT, 149 },
+    // State 51
+    { 51, 21, PA_SHIFT, 52 },
+    // State 51
+    { 51, 103, PA_REDUCE, 49 },
+    // State 51 default action
+    { 51, -1, PA_REDUCE, 49 },
+    // State 52
+    { 52, 1, PA_SHIFT, 99 },
+    // State 52
+    { 52, 2, PA_SHIFT, 98 },
+    // State 52
+    { 52, 71, PA_SHIFT, 53 },
+    // State 52
+    { 52, 72, PA_SHIFT, 128 },
+    // State 52
+    { 52, 73, PA_SHIFT, 129 },
+    // State 52
+    { 52, 74, PA_SHIFT, 130 },
+    // State 52
+    { 52, 76, PA_SHIFT, 131 },
+    // State 52
+    { 52, 77, PA_SHIFT, 132 },
+    // State 52
+    { 52, 78, PA_SHIFT, 133 },
+    // State 52
+    { 52, 79, PA_SHIFT, 134 },
+    // State 52
+    { 52, 80, PA_SHIFT, 135 },
+    // State 52
+    { 52, 81, PA_SHIFT, 136 },
+    // State 52
+    { 52, 82, PA_SHIFT, 137 },
+    // State 52
+    { 52, 83, PA_SHIFT, 138 },
+    // State 52
+    { 52, 84, PA_SHIFT, 139 },
+    // State 52
+    { 52, 85, PA_SHIFT, 140 },
+    // State 52
+    { 52, 87, PA_SHIFT, 141 },
+    // State 52
+    { 52, 88, PA_SHIFT, 142 },
+    // State 52
+    { 52, 89, PA_SHIFT, 143 },
+    // State 52
+    { 52, 90, PA_SHIFT, 144 },
+    // State 52
+    { 52, 91, PA_SHIFT, 145 },
+    // State 52
+    { 52, 92, PA_SHIFT, 146 },
+    // State 52
+    { 52, 93, PA_SHIFT, 147 },
+    // State 52
+    { 52, 94, PA_SHIFT, 148 },
+    // State 52
+    { 52, 95, PA_SHIFT, 149 },
+    // State 53
+    { 53, 22, PA_SHIFT, 54 },
+    // State 53
+    { 53, 103, PA_REDUCE, 51 },
+    // State 53 default action
+    { 53, -1, PA_REDUCE, 51 },
+    // State 54
+    { 54, 1, PA_SHIFT, 99 },
+    // State 54
+    { 54, 2, PA_SHIFT, 98 },
+    // State 54
+    { 54, 72, PA_SHIFT, 55 },
+    // State 54
+    { 54, 73, PA_SHIFT, 129 },
+    // State 54
+    { 54, 74, PA_SHIFT, 130 },
+    // State 54
+    { 54, 76, PA_SHIFT, 131 },
+    // State 54
+    { 54, 77, PA_SHIFT, 132 },
+    // State 54
+    { 54, 78, PA_SHIFT, 133 },
+    // State 54
+    { 54, 79, PA_SHIFT, 134 },
+    // State 54
+    { 54, 80, PA_SHIFT, 135 },
+    // State 54
+    { 54, 81, PA_SHIFT, 136 },
+    // State 54
+    { 54, 82, PA_SHIFT, 137 },
+    // State 54
+    { 54, 83, PA_SHIFT, 138 },
+    // State 54
+    { 54, 84, PA_SHIFT, 139 },
+    // State 54
+    { 54, 85, PA_SHIFT, 140 },
+    // State 54
+    { 54, 87, PA_SHIFT, 141 },
+    // State 54
+    { 54, 88, PA_SHIFT, 142 },
+    // State 54
+    { 54, 89, PA_SHIFT, 143 },
+    // State 54
+    { 54, 90, PA_SHIFT, 144 },
+    // State 54
+    { 54, 91, PA_SHIFT, 145 },
+    // State 54
+    { 54, 92, PA_SHIFT, 146 },
+    // State 54
+    { 54, 93, PA_SHIFT, 147 },
+    // State 54
+    { 54, 94, PA_SHIFT, 148 },
+    // State 54
+    { 54, 95, PA_SHIFT, 149 },
+    // State 55
+    { 55, 23, PA_SHIFT, 56 },
+    // State 55
+    { 55, 103, PA_REDUCE, 53 },
+    // State 55 default action
+    { 55, -1, PA_REDUCE, 53 },
+    // State 56
+    { 56, 1, PA_SHIFT, 99 },
+    // State 56
+    { 56, 2, PA_SHIFT, 98 },
+    // State 56
+    { 56, 73, PA_SHIFT, 57 },
+    // State 56
+    { 56, 74, PA_SHIFT, 130 },
+    // State 56
+    { 56, 76, PA_SHIFT, 131 },
+    // State 56
+    { 56, 77, PA_SHIFT, 132 },
+    // State 56
+    { 56, 78, PA_SHIFT, 133 },
+    // State 56
+    { 56, 79, PA_SHIFT, 134 },
+    // State 56
+    { 56, 80, PA_SHIFT, 135 },
+    // State 56
+    { 56, 81, PA_SHIFT, 136 },
+    // State 56
+    { 56, 82, PA_SHIFT, 137 },
+    // State 56
+    { 56, 83, PA_SHIFT, 138 },
+    // State 56
+    { 56, 84, PA_SHIFT, 139 },
+    // State 56
+    { 56, 85, PA_SHIFT, 140 },
+    // State 56
+    { 56, 87, PA_SHIFT, 141 },
+    // State 56
+    { 56, 88, PA_SHIFT, 142 },
+    // State 56
+    { 56, 89, PA_SHIFT, 143 },
+    // State 56
+    { 56, 90, PA_SHIFT, 144 },
+    // State 56
+    { 56, 91, PA_SHIFT, 145 },
+    // State 56
+    { 56, 92, PA_SHIFT, 146 },
+    // State 56
+    { 56, 93, PA_SHIFT, 147 },
+    // State 56
+    { 56, 94, PA_SHIFT, 148 },
+    // State 56
+    { 56, 95, PA_SHIFT, 149 },
+    // State 57
+    { 57, 24, PA_SHIFT, 58 },
+    // State 57
+    { 57, 103, PA_REDUCE, 55 },
+    // State 57 default action
+    { 57, -1, PA_REDUCE, 55 },
+    // State 58
+    { 58, 1, PA_SHIFT, 99 },
+    // State 58
+    { 58, 2, PA_SHIFT, 98 },
+    // State 58
+    { 58, 74, PA_SHIFT, 59 },
+    // State 58
+    { 58, 76, PA_SHIFT, 131 },
+    // State 58
+    { 58, 77, PA_SHIFT, 132 },
+    // State 58
+    { 58, 78, PA_SHIFT, 133 },
+    // State 58
+    { 58, 79, PA_SHIFT, 134 },
+    // State 58
+    { 58, 80, PA_SHIFT, 135 },
+    // State 58
+    { 58, 81, PA_SHIFT, 136 },
+    // State 58
+    { 58, 82, PA_SHIFT, 137 },
+    // State 58
+    { 58, 83, PA_SHIFT, 138 },
+    // State 58
+    { 58, 84, PA_SHIFT, 139 },
+    // State 58
+    { 58, 85, PA_SHIFT, 140 },
+    // State 58
+    { 58, 87, PA_SHIFT, 141 },
+    // State 58
+    { 58, 88, PA_SHIFT, 142 },
+    // State 58
+    { 58, 89, PA_SHIFT, 143 },
+    // State 58
+    { 58, 90, PA_SHIFT, 144 },
+    // State 58
+    { 58, 91, PA_SHIFT, 145 },
+    // State 58
+    { 58, 92, PA_SHIFT, 146 },
+    // State 58
+    { 58, 93, PA_SHIFT, 147 },
+    // State 58
+    { 58, 94, PA_SHIFT, 148 },
+    // State 58
+    { 58, 95, PA_SHIFT, 149 },
+    // State 59
+    { 59, 25, PA_SHIFT, 60 },
+    // State 59
+    { 59, 103, PA_REDUCE, 57 },
+    // State 59 default action
+    { 59, -1, PA_REDUCE, 57 },
+    // State 60
+    { 60, 1, PA_SHIFT, 99 },
+    // State 60
+    { 60, 2, PA_SHIFT, 98 },
+    // State 60
+    { 60, 76, PA_SHIFT, 61 },
+    // State 60
+    { 60, 77, PA_SHIFT, 132 },
+    // State 60
+    { 60, 78, PA_SHIFT, 133 },
+    // State 60
+    { 60, 79, PA_SHIFT, 134 },
+    // State 60
+    { 60, 80, PA_SHIFT, 135 },
+    // State 60
+    { 60, 81, PA_SHIFT, 136 },
+    // State 60
+    { 60, 82, PA_SHIFT, 137 },
+    // State 60
+    { 60, 83, PA_SHIFT, 138 },
+    // State 60
+    { 60, 84, PA_SHIFT, 139 },
+    // State 60
+    { 60, 85, PA_SHIFT, 140 },
+    // State 60
+    { 60, 87, PA_SHIFT, 141 },
+    // State 60
+    { 60, 88, PA_SHIFT, 142 },
+    // State 60
+    { 60, 89, PA_SHIFT, 143 },
+    // State 60
+    { 60, 90, PA_SHIFT, 144 },
+    // State 60
+    { 60, 91, PA_SHIFT, 145 },
+    // State 60
+    { 60, 92, PA_SHIFT, 146 },
+    // State 60
+    { 60, 93, PA_SHIFT, 147 },
+    // State 60
+    { 60, 94, PA_SHIFT, 148 },
+    // State 60
+    { 60, 95, PA_SHIFT, 149 },
+    // State 61
+    { 61, 27, PA_SHIFT, 62 },
+    // State 61
+    { 61, 103, PA_REDUCE, 59 },
+    // State 61 default action
+    { 61, -1, PA_REDUCE, 59 },
+    // State 62
+    { 62, 1, PA_SHIFT, 99 },
+    // State 62
+    { 62, 2, PA_SHIFT, 98 },
+    // State 62
+    { 62, 77, PA_SHIFT, 63 },
+    // State 62
+    { 62, 78, PA_SHIFT, 133 },
+    // State 62
+    { 62, 79, PA_SHIFT, 134 },
+    // State 62
+    { 62, 80, PA_SHIFT, 135 },
+    // State 62
+    { 62, 81, PA_SHIFT, 136 },
+    // State 62
+    { 62, 82, PA_SHIFT, 137 },
+    // State 62
+    { 62, 83, PA_SHIFT, 138 },
+    // State 62
+    { 62, 84, PA_SHIFT, 139 },
+    // State 62
+    { 62, 85, PA_SHIFT, 140 },
+    // State 62
+    { 62, 87, PA_SHIFT, 141 },
+    // State 62
+    { 62, 88, PA_SHIFT, 142 },
+    // State 62
+    { 62, 89, PA_SHIFT, 143 },
+    // State 62
+    { 62, 90, PA_SHIFT, 144 },
+    // State 62
+    { 62, 91, PA_SHIFT, 145 },
+    // State 62
+    { 62, 92, PA_SHIFT, 146 },
+    // State 62
+    { 62, 93, PA_SHIFT, 147 },
+    // State 62
+    { 62, 94, PA_SHIFT, 148 },
+    // State 62
+    { 62, 95, PA_SHIFT, 149 },
+    // State 63
+    { 63, 28, PA_SHIFT, 64 },
+    // State 63
+    { 63, 103, PA_REDUCE, 61 },
+    // State 63 default action
+    { 63, -1, PA_REDUCE, 61 },
+    // State 64
+    { 64, 1, PA_SHIFT, 99 },
+    // State 64
+    { 64, 2, PA_SHIFT, 98 },
+    // State 64
+    { 64, 78, PA_SHIFT, 65 },
+    // State 64
+    { 64, 79, PA_SHIFT, 134 },
+    // State 64
+    { 64, 80, PA_SHIFT, 135 },
+    // State 64
+    { 64, 81, PA_SHIFT, 136 },
+    // State 64
+    { 64, 82, PA_SHIFT, 137 },
+    // State 64
+    { 64, 83, PA_SHIFT, 138 },
+    // State 64
+    { 64, 84, PA_SHIFT, 139 },
+    // State 64
+    { 64, 85, PA_SHIFT, 140 },
+    // State 64
+    { 64, 87, PA_SHIFT, 141 },
+    // State 64
+    { 64, 88, PA_SHIFT, 142 },
+    // State 64
+    { 64, 89, PA_SHIFT, 143 },
+    // State 64
+    { 64, 90, PA_SHIFT, 144 },
+    // State 64
+    { 64, 91, PA_SHIFT, 145 },
+    // State 64
+    { 64, 92, PA_SHIFT, 146 },
+    // State 64
+    { 64, 93, PA_SHIFT, 147 },
+    // State 64
+    { 64, 94, PA_SHIFT, 148 },
+    // State 64
+    { 64, 95, PA_SHIFT, 149 },
+    // State 65
+    { 65, 29, PA_SHIFT, 66 },
+    // State 65
+    { 65, 103, PA_REDUCE, 63 },
+    // State 65 default action
+    { 65, -1, PA_REDUCE, 63 },
+    // State 66
+    { 66, 1, PA_SHIFT, 99 },
+    // State 66
+    { 66, 2, PA_SHIFT, 98 },
+    // State 66
+    { 66, 79, PA_SHIFT, 67 },
+    // State 66
+    { 66, 80, PA_SHIFT, 135 },
+    // State 66
+    { 66, 81, PA_SHIFT, 136 },
+    // State 66
+    { 66, 82, PA_SHIFT, 137 },
+    // State 66
+    { 66, 83, PA_SHIFT, 138 },
+    // State 66
+    { 66, 84, PA_SHIFT, 139 },
+    // State 66
+    { 66, 85, PA_SHIFT, 140 },
+    // State 66
+    { 66, 87, PA_SHIFT, 141 },
+    // State 66
+    { 66, 88, PA_SHIFT, 142 },
+    // State 66
+    { 66, 89, PA_SHIFT, 143 },
+    // State 66
+    { 66, 90, PA_SHIFT, 144 },
+    // State 66
+    { 66, 91, PA_SHIFT, 145 },
+    // State 66
+    { 66, 92, PA_SHIFT, 146 },
+    // State 66
+    { 66, 93, PA_SHIFT, 147 },
+    // State 66
+    { 66, 94, PA_SHIFT, 148 },
+    // State 66
+    { 66, 95, PA_SHIFT, 149 },
+    // State 67
+    { 67, 30, PA_SHIFT, 68 },
+    // State 67
+    { 67, 103, PA_REDUCE, 65 },
+    // State 67 default action
+    { 67, -1, PA_REDUCE, 65 },
+    // State 68
+    { 68, 1, PA_SHIFT, 99 },
+    // State 68
+    { 68, 2, PA_SHIFT, 98 },
+    // State 68
+    { 68, 80, PA_SHIFT, 69 },
+    // State 68
+    { 68, 81, PA_SHIFT, 136 },
+    // State 68
+    { 68, 82, PA_SHIFT, 137 },
+    // State 68
+    { 68, 83, PA_SHIFT, 138 },
+    // State 68
+    { 68, 84, PA_SHIFT, 139 },
+    // State 68
+    { 68, 85, PA_SHIFT, 140 },
+    // State 68
+    { 68, 87, PA_SHIFT, 141 },
+    // State 68
+    { 68, 88, PA_SHIFT, 142 },
+    // State 68
+    { 68, 89, PA_SHIFT, 143 },
+    // State 68
+    { 68, 90, PA_SHIFT, 144 },
+    // State 68
+    { 68, 91, PA_SHIFT, 145 },
+    // State 68
+    { 68, 92, PA_SHIFT, 146 },
+    // State 68
+    { 68, 93, PA_SHIFT, 147 },
+    // State 68
+    { 68, 94, PA_SHIFT, 148 },
+    // State 68
+    { 68, 95, PA_SHIFT, 149 },
+    // State 69
+    { 69, 31, PA_SHIFT, 70 },
+    // State 69
+    { 69, 103, PA_REDUCE, 67 },
+    // State 69 default action
+    { 69, -1, PA_REDUCE, 67 },
+    // State 70
+    { 70, 1, PA_SHIFT, 99 },
+    // State 70
+    { 70, 2, PA_SHIFT, 98 },
+    // State 70
+    { 70, 81, PA_SHIFT, 71 },
+    // State 70
+    { 70, 82, PA_SHIFT, 137 },
+    // State 70
+    { 70, 83, PA_SHIFT, 138 },
+    // State 70
+    { 70, 84, PA_SHIFT, 139 },
+    // State 70
+    { 70, 85, PA_SHIFT, 140 },
+    // State 70
+    { 70, 87, PA_SHIFT, 141 },
+    // State 70
+    { 70, 88, PA_SHIFT, 142 },
+    // State 70
+    { 70, 89, PA_SHIFT, 143 },
+    // State 70
+    { 70, 90, PA_SHIFT, 144 },
+    // State 70
+    { 70, 91, PA_SHIFT, 145 },
+    // State 70
+    { 70, 92, PA_SHIFT, 146 },
+    // State 70
+    { 70, 93, PA_SHIFT, 147 },
+    // State 70
+    { 70, 94, PA_SHIFT, 148 },
+    // State 70
+    { 70, 95, PA_SHIFT, 149 },
+    // State 71
+    { 71, 32, PA_SHIFT, 72 },
+    // State 71
+    { 71, 103, PA_REDUCE, 69 },
+    // State 71 default action
+    { 71, -1, PA_REDUCE, 69 },
+    // State 72
+    { 72, 1, PA_SHIFT, 99 },
+    // State 72
+    { 72, 2, PA_SHIFT, 98 },
+    // State 72
+    { 72, 82, PA_SHIFT, 73 },
+    // State 72
+    { 72, 83, PA_SHIFT, 138 },
+    // State 72
+    { 72, 84, PA_SHIFT, 139 },
+    // State 72
+    { 72, 85, PA_SHIFT, 140 },
+    // State 72
+    { 72, 87, PA_SHIFT, 141 },
+    // State 72
+    { 72, 88, PA_SHIFT, 142 },
+    // State 72
+    { 72, 89, PA_SHIFT, 143 },
+    // State 72
+    { 72, 90, PA_SHIFT, 144 },
+    // State 72
+    { 72, 91, PA_SHIFT, 145 },
+    // State 72
+    { 72, 92, PA_SHIFT, 146 },
+    // State 72
+    { 72, 93, PA_SHIFT, 147 },
+    // State 72
+    { 72, 94, PA_SHIFT, 148 },
+    // State 72
+    { 72, 95, PA_SHIFT, 149 },
+    // State 73
+    { 73, 33, PA_SHIFT, 74 },
+    // State 73
+    { 73, 103, PA_REDUCE, 71 },
+    // State 73 default action
+    { 73, -1, PA_REDUCE, 71 },
+    // State 74
+    { 74, 1, PA_SHIFT, 99 },
+    // State 74
+    { 74, 2, PA_SHIFT, 98 },
+    // State 74
+    { 74, 83, PA_SHIFT, 75 },
+    // State 74
+    { 74, 84, PA_SHIFT, 139 },
+    // State 74
+    { 74, 85, PA_SHIFT, 140 },
+    // State 74
+    { 74, 87, PA_SHIFT, 141 },
+    // State 74
+    { 74, 88, PA_SHIFT, 142 },
+    // State 74
+    { 74, 89, PA_SHIFT, 143 },
+    // State 74
+    { 74, 90, PA_SHIFT, 144 },
+    // State 74
+    { 74, 91, PA_SHIFT, 145 },
+    // State 74
+    { 74, 92, PA_SHIFT, 146 },
+    // State 74
+    { 74, 93, PA_SHIFT, 147 },
+    // State 74
+    { 74, 94, PA_SHIFT, 148 },
+    // State 74
+    { 74, 95, PA_SHIFT, 149 },
+    // State 75
+    { 75, 34, PA_SHIFT, 76 },
+    // State 75
+    { 75, 103, PA_REDUCE, 73 },
+    // State 75 default action
+    { 75, -1, PA_REDUCE, 73 },
+    // State 76
+    { 76, 1, PA_SHIFT, 99 },
+    // State 76
+    { 76, 2, PA_SHIFT, 98 },
+    // State 76
+    { 76, 84, PA_SHIFT, 77 },
+    // State 76
+    { 76, 85, PA_SHIFT, 140 },
+    // State 76
+    { 76, 87, PA_SHIFT, 141 },
+    // State 76
+    { 76, 88, PA_SHIFT, 142 },
+    // State 76
+    { 76, 89, PA_SHIFT, 143 },
+    // State 76
+    { 76, 90, PA_SHIFT, 144 },
+    // State 76
+    { 76, 91, PA_SHIFT, 145 },
+    // State 76
+    { 76, 92, PA_SHIFT, 146 },
+    // State 76
+    { 76, 93, PA_SHIFT, 147 },
+    // State 76
+    { 76, 94, PA_SHIFT, 148 },
+    // State 76
+    { 76, 95, PA_SHIFT, 149 },
+    // State 77
+    { 77, 35, PA_SHIFT, 78 },
+    // State 77
+    { 77, 103, PA_REDUCE, 75 },
+    // State 77 default action
+    { 77, -1, PA_REDUCE, 75 },
+    // State 78
+    { 78, 1, PA_SHIFT, 99 },
+    // State 78
+    { 78, 2, PA_SHIFT, 98 },
+    // State 78
+    { 78, 85, PA_SHIFT, 79 },
+    // State 78
+    { 78, 87, PA_SHIFT, 141 },
+    // State 78
+    { 78, 88, PA_SHIFT, 142 },
+    // State 78
+    { 78, 89, PA_SHIFT, 143 },
+    // State 78
+    { 78, 90, PA_SHIFT, 144 },
+    // State 78
+    { 78, 91, PA_SHIFT, 145 },
+    // State 78
+    { 78, 92, PA_SHIFT, 146 },
+    // State 78
+    { 78, 93, PA_SHIFT, 147 },
+    // State 78
+    { 78, 94, PA_SHIFT, 148 },
+    // State 78
+    { 78, 95, PA_SHIFT, 149 },
+    // State 79
+    { 79, 36, PA_SHIFT, 80 },
+    // State 79
+    { 79, 103, PA_REDUCE, 77 },
+    // State 79 default action
+    { 79, -1, PA_REDUCE, 77 },
+    // State 80
+    { 80, 1, PA_SHIFT, 99 },
+    // State 80
+    { 80, 2, PA_SHIFT, 98 },
+    // State 80
+    { 80, 87, PA_SHIFT, 81 },
+    // State 80
+    { 80, 88, PA_SHIFT, 142 },
+    // State 80
+    { 80, 89, PA_SHIFT, 143 },
+    // State 80
+    { 80, 90, PA_SHIFT, 144 },
+    // State 80
+    { 80, 91, PA_SHIFT, 145 },
+    // State 80
+    { 80, 92, PA_SHIFT, 146 },
+    // State 80
+    { 80, 93, PA_SHIFT, 147 },
+    // State 80
+    { 80, 94, PA_SHIFT, 148 },
+    // State 80
+    { 80, 95, PA_SHIFT, 149 },
+    // State 81
+    { 81, 38, PA_SHIFT, 82 },
+    // State 81
+    { 81, 103, PA_REDUCE, 79 },
+    // State 81 default action
+    { 81, -1, PA_REDUCE, 79 },
+    // State 82
+    { 82, 1, PA_SHIFT, 99 },
+    // State 82
+    { 82, 2, PA_SHIFT, 98 },
+    // State 82
+    { 82, 88, PA_SHIFT, 83 },
+    // State 82
+    { 82, 89, PA_SHIFT, 143 },
+    // State 82
+    { 82, 90, PA_SHIFT, 144 },
+    // State 82
+    { 82, 91, PA_SHIFT, 145 },
+    // State 82
+    { 82, 92, PA_SHIFT, 146 },
+    // State 82
+    { 82, 93, PA_SHIFT, 147 },
+    // State 82
+    { 82, 94, PA_SHIFT, 148 },
+    // State 82
+    { 82, 95, PA_SHIFT, 149 },
+    // State 83
+    { 83, 39, PA_SHIFT, 84 },
+    // State 83
+    { 83, 103, PA_REDUCE, 81 },
+    // State 83 default action
+    { 83, -1, PA_REDUCE, 81 },
+    // State 84
+    { 84, 1, PA_SHIFT, 99 },
+    // State 84
+    { 84, 2, PA_SHIFT, 98 },
+    // State 84
+    { 84, 89, PA_SHIFT, 85 },
+    // State 84
+    { 84, 90, PA_SHIFT, 144 },
+    // State 84
+    { 84, 91, PA_SHIFT, 145 },
+    // State 84
+    { 84, 92, PA_SHIFT, 146 },
+    // State 84
+    { 84, 93, PA_SHIFT, 147 },
+    // State 84
+    { 84, 94, PA_SHIFT, 148 },
+    // State 84
+    { 84, 95, PA_SHIFT, 149 },
+    // State 85
+    { 85, 40, PA_SHIFT, 86 },
+    // State 85
+    { 85, 103, PA_REDUCE, 83 },
+    // State 85 default action
+    { 85, -1, PA_REDUCE, 83 },
+    // State 86
+    { 86, 1, PA_SHIFT, 99 },
+    // State 86
+    { 86, 2, PA_SHIFT, 98 },
+    // State 86
+    { 86, 90, PA_SHIFT, 87 },
+    // State 86
+    { 86, 91, PA_SHIFT, 145 },
+    // State 86
+    { 86, 92, PA_SHIFT, 146 },
+    // State 86
+    { 86, 93, PA_SHIFT, 147 },
+    // State 86
+    { 86, 94, PA_SHIFT, 148 },
+    // State 86
+    { 86, 95, PA_SHIFT, 149 },
+    // State 87
+    { 87, 41, PA_SHIFT, 88 },
+    // State 87
+    { 87, 103, PA_REDUCE, 85 },
+    // State 87 default action
+    { 87, -1, PA_REDUCE, 85 },
+    // State 88
+    { 88, 1, PA_SHIFT, 99 },
+    // State 88
+    { 88, 2, PA_SHIFT, 98 },
+    // State 88
+    { 88, 91, PA_SHIFT, 89 },
+    // State 88
+    { 88, 92, PA_SHIFT, 146 },
+    // State 88
+    { 88, 93, PA_SHIFT, 147 },
+    // State 88
+    { 88, 94, PA_SHIFT, 148 },
+    // State 88
+    { 88, 95, PA_SHIFT, 149 },
+    // State 89
+    { 89, 42, PA_SHIFT, 90 },
+    // State 89
+    { 89, 103, PA_REDUCE, 87 },
+    // State 89 default action
+    { 89, -1, PA_REDUCE, 87 },
+    // State 90
+    { 90, 1, PA_SHIFT, 99 },
+    // State 90
+    { 90, 2, PA_SHIFT, 98 },
+    // State 90
+    { 90, 92, PA_SHIFT, 91 },
+    // State 90
+    { 90, 93, PA_SHIFT, 147 },
+    // State 90
+    { 90, 94, PA_SHIFT, 148 },
+    // State 90
+    { 90, 95, PA_SHIFT, 149 },
+    // State 91
+    { 91, 43, PA_SHIFT, 92 },
+    // State 91
+    { 91, 103, PA_REDUCE, 89 },
+    // State 91 default action
+    { 91, -1, PA_REDUCE, 89 },
+    // State 92
+    { 92, 1, PA_SHIFT, 99 },
+    // State 92
+    { 92, 2, PA_SHIFT, 98 },
+    // State 92
+    { 92, 93, PA_SHIFT, 93 },
+    // State 92
+    { 92, 94, PA_SHIFT, 148 },
+    // State 92
+    { 92, 95, PA_SHIFT, 149 },
+    // State 93
+    { 93, 44, PA_SHIFT, 94 },
+    // State 93
+    { 93, 103, PA_REDUCE, 91 },
+    // State 93 default action
+    { 93, -1, PA_REDUCE, 91 },
+    // State 94
+    { 94, 1, PA_SHIFT, 99 },
+    // State 94
+    { 94, 2, PA_SHIFT, 98 },
+    // State 94
+    { 94, 94, PA_SHIFT, 95 },
+    // State 94
+    { 94, 95, PA_SHIFT, 149 },
+    // State 95
+    { 95, 45, PA_SHIFT, 96 },
+    // State 95
+    { 95, 103, PA_REDUCE, 93 },
+    // State 95 default action
+    { 95, -1, PA_REDUCE, 93 },
+    // State 96
+    { 96, 1, PA_SHIFT, 99 },
+    // State 96
+    { 96, 2, PA_SHIFT, 98 },
+    // State 96
+    { 96, 95, PA_SHIFT, 97 },
+    // State 97
+    { 97, 103, PA_REDUCE, 95 },
+    // State 97 default action
+    { 97, -1, PA_REDUCE, 95 },
+    // State 98
+    { 98, 103, PA_REDUCE, 97 },
+    // State 98 default action
+    { 98, -1, PA_REDUCE, 97 },
+    // State 99
+    { 99, 1, PA_SHIFT, 99 },
+    // State 99
+    { 99, 2, PA_SHIFT, 98 },
+    // State 99
+    { 99, 52, PA_SHIFT, 100 },
+    // State 99
+    { 99, 53, PA_SHIFT, 102 },
+    // State 99
+    { 99, 54, PA_SHIFT, 111 },
+    // State 99
+    { 99, 55, PA_SHIFT, 112 },
+    // State 99
+    { 99, 56, PA_SHIFT, 113 },
+    // State 99
+    { 99, 57, PA_SHIFT, 114 },
+    // State 99
+    { 99, 58, PA_SHIFT, 115 },
+    // State 99
+    { 99, 59, PA_SHIFT, 116 },
+    // State 99
+    { 99, 60, PA_SHIFT, 117 },
+    // State 99
+    { 99, 61, PA_SHIFT, 118 },
+    // State 99
+    { 99, 62, PA_SHIFT, 119 },
+    // State 99
+    { 99, 63, PA_SHIFT, 120 },
+    // State 99
+    { 99, 64, PA_SHIFT, 103 },
+    // State 99
+    { 99, 65, PA_SHIFT, 121 },
+    // State 99
+    { 99, 66, PA_SHIFT, 122 },
+    // State 99
+    { 99, 67, PA_SHIFT, 123 },
+    // State 99
+    { 99, 68, PA_SHIFT, 124 },
+    // State 99
+    { 99, 69, PA_SHIFT, 125 },
+    // State 99
+    { 99, 70, PA_SHIFT, 126 },
+    // State 99
+    { 99, 71, PA_SHIFT, 127 },
+    // State 99
+    { 99, 72, PA_SHIFT, 128 },
+    // State 99
+    { 99, 73, PA_SHIFT, 129 },
+    // State 99
+    { 99, 74, PA_SHIFT, 130 },
+    // State 99
+    { 99, 75, PA_SHIFT, 104 },
+    // State 99
+    { 99, 76, PA_SHIFT, 131 },
+    // State 99
+    { 99, 77, PA_SHIFT, 132 },
+    // State 99
+    { 99, 78, PA_SHIFT, 133 },
+    // State 99
+    { 99, 79, PA_SHIFT, 134 },
+    // State 99
+    { 99, 80, PA_SHIFT, 135 },
+    // State 99
+    { 99, 81, PA_SHIFT, 136 },
+    // State 99
+    { 99, 82, PA_SHIFT, 137 },
+    // State 99
+    { 99, 83, PA_SHIFT, 138 },
+    // State 99
+    { 99, 84, PA_SHIFT, 139 },
+    // State 99
+    { 99, 85, PA_SHIFT, 140 },
+    // State 99
+    { 99, 86, PA_SHIFT, 105 },
+    // State 99
+    { 99, 87, PA_SHIFT, 141 },
+    // State 99
+    { 99, 88, PA_SHIFT, 142 },
+    // State 99
+    { 99, 89, PA_SHIFT, 143 },
+    // State 99
+    { 99, 90, PA_SHIFT, 144 },
+    // State 99
+    { 99, 91, PA_SHIFT, 145 },
+    // State 99
+    { 99, 92, PA_SHIFT, 146 },
+    // State 99
+    { 99, 93, PA_SHIFT, 147 },
+    // State 99
+    { 99, 94, PA_SHIFT, 148 },
+    // State 99
+    { 99, 95, PA_SHIFT, 149 },
+    // State 99
+    { 99, 96, PA_SHIFT, 106 },
+    // State 99
+    { 99, 97, PA_SHIFT, 107 },
+    // State 99
+    { 99, 98, PA_SHIFT, 108 },
+    // State 99
+    { 99, 99, PA_SHIFT, 109 },
+    // State 99
+    { 99, 100, PA_SHIFT, 110 },
+    // State 100
+    { 100, 3, PA_SHIFT, 2 },
+    // State 100
+    { 100, 51, PA_SHIFT, 101 },
+    // State 101
+    { 101, 103, PA_REDUCE, 98 },
+    // State 101 default action
+    { 101, -1, PA_REDUCE, 98 },
+    // State 102
+    { 102, 4, PA_SHIFT, 4 },
+    // State 102
+    { 102, 103, PA_REDUCE, 2 },
+    // State 102 default action
+    { 102, -1, PA_REDUCE, 2 },
+    // State 103
+    { 103, 15, PA_SHIFT, 6 },
+    // State 103
+    { 103, 103, PA_REDUCE, 4 },
+    // State 103 default action
+    { 103, -1, PA_REDUCE, 4 },
+    // State 104
+    { 104, 26, PA_SHIFT, 8 },
+    // State 104
+    { 104, 103, PA_REDUCE, 6 },
+    // State 104 default action
+    { 104, -1, PA_REDUCE, 6 },
+    // State 105
+    { 105, 37, PA_SHIFT, 10 },
+    // State 105
+    { 105, 103, PA_REDUCE, 8 },
+    // State 105 default action
+    { 105, -1, PA_REDUCE, 8 },
+    // State 106
+    { 106, 46, PA_SHIFT, 12 },
+    // State 106
+    { 106, 103, PA_REDUCE, 10 },
+    // State 106 default action
+    { 106, -1, PA_REDUCE, 10 },
+    // State 107
+    { 107, 47, PA_SHIFT, 14 },
+    // State 107
+    { 107, 103, PA_REDUCE, 12 },
+    // State 107 default action
+    { 107, -1, PA_REDUCE, 12 },
+    // State 108
+    { 108, 48, PA_SHIFT, 16 },
+    // State 108
+    { 108, 103, PA_REDUCE, 14 },
+    // State 108 default action
+    { 108, -1, PA_REDUCE, 14 },
+    // State 109
+    { 109, 49, PA_SHIFT, 18 },
+    // State 109
+    { 109, 103, PA_REDUCE, 16 },
+    // State 109 default action
+    { 109, -1, PA_REDUCE, 16 },
+    // State 110
+    { 110, 50, PA_SHIFT, 20 },
+    // State 110
+    { 110, 103, PA_REDUCE, 18 },
+    // State 110 default action
+    { 110, -1, PA_REDUCE, 18 },
+    // State 111
+    { 111, 5, PA_SHIFT, 22 },
+    // State 111
+    { 111, 103, PA_REDUCE, 20 },
+    // State 111 default action
+    { 111, -1, PA_REDUCE, 20 },
+    // State 112
+    { 112, 6, PA_SHIFT, 24 },
+    // State 112
+    { 112, 103, PA_REDUCE, 22 },
+    // State 112 default action
+    { 112, -1, PA_REDUCE, 22 },
+    // State 113
+    { 113, 7, PA_SHIFT, 26 },
+    // State 113
+    { 113, 103, PA_REDUCE, 24 },
+    // State 113 default action
+    { 113, -1, PA_REDUCE, 24 },
+    // State 114
+    { 114, 8, PA_SHIFT, 28 },
+    // State 114
+    { 114, 103, PA_REDUCE, 26 },
+    // State 114 default action
+    { 114, -1, PA_REDUCE, 26 },
+    // State 115
+    { 115, 9, PA_SHIFT, 30 },
+    // State 115
+    { 115, 103, PA_REDUCE, 28 },
+    // State 115 default action
+    { 115, -1, PA_REDUCE, 28 },
+    // State 116
+    { 116, 10, PA_SHIFT, 32 },
+    // State 116
+    { 116, 103, PA_REDUCE, 30 },
+    // State 116 default action
+    { 116, -1, PA_REDUCE, 30 },
+    // State 117
+    { 117, 11, PA_SHIFT, 34 },
+    // State 117
+    { 117, 103, PA_REDUCE, 32 },
+    // State 117 default action
+    { 117, -1, PA_REDUCE, 32 },
+    // State 118
+    { 118, 12, PA_SHIFT, 36 },
+    // State 118
+    { 118, 103, PA_REDUCE, 34 },
+    // State 118 default action
+    { 118, -1, PA_REDUCE, 34 },
+    // State 119
+    { 119, 13, PA_SHIFT, 38 },
+    // State 119
+    { 119, 103, PA_REDUCE, 36 },
+    // State 119 default action
+    { 119, -1, PA_REDUCE, 36 },
+    // State 120
+    { 120, 14, PA_SHIFT, 40 },
+    // State 120
+    { 120, 103, PA_REDUCE, 38 },
+    // State 120 default action
+    { 120, -1, PA_REDUCE, 38 },
+    // State 121
+    { 121, 16, PA_SHIFT, 42 },
+    // State 121
+    { 121, 103, PA_REDUCE, 40 },
+    // State 121 default action
+    { 121, -1, PA_REDUCE, 40 },
+    // State 122
+    { 122, 17, PA_SHIFT, 44 },
+    // State 122
+    { 122, 103, PA_REDUCE, 42 },
+    // State 122 default action
+    { 122, -1, PA_REDUCE, 42 },
+    // State 123
+    { 123, 18, PA_SHIFT, 46 },
+    // State 123
+    { 123, 103, PA_REDUCE, 44 },
+    // State 123 default action
+    { 123, -1, PA_REDUCE, 44 },
+    // State 124
+    { 124, 19, PA_SHIFT, 48 },
+    // State 124
+    { 124, 103, PA_REDUCE, 46 },
+    // State 124 default action
+    { 124, -1, PA_REDUCE, 46 },
+    // State 125
+    { 125, 20, PA_SHIFT, 50 },
+    // State 125
+    { 125, 103, PA_REDUCE, 48 },
+    // State 125 default action
+    { 125, -1, PA_REDUCE, 48 },
+    // State 126
+    { 126, 21, PA_SHIFT, 52 },
+    // State 126
+    { 126, 103, PA_REDUCE, 50 },
+    // State 126 default action
+    { 126, -1, PA_REDUCE, 50 },
+    // State 127
+    { 127, 22, PA_SHIFT, 54 },
+    // State 127
+    { 127, 103, PA_REDUCE, 52 },
+    // State 127 default action
+    { 127, -1, PA_REDUCE, 52 },
+    // State 128
+    { 128, 23, PA_SHIFT, 56 },
+    // State 128
+    { 128, 103, PA_REDUCE, 54 },
+    // State 128 default action
+    { 128, -1, PA_REDUCE, 54 },
+    // State 129
+    { 129, 24, PA_SHIFT, 58 },
+    // State 129
+    { 129, 103, PA_REDUCE, 56 },
+    // State 129 default action
+    { 129, -1, PA_REDUCE, 56 },
+    // State 130
+    { 130, 25, PA_SHIFT, 60 },
+    // State 130
+    { 130, 103, PA_REDUCE, 58 },
+    // State 130 default action
+    { 130, -1, PA_REDUCE, 58 },
+    // State 131
+    { 131, 27, PA_SHIFT, 62 },
+    // State 131
+    { 131, 103, PA_REDUCE, 60 },
+    // State 131 default action
+    { 131, -1, PA_REDUCE, 60 },
+    // State 132
+    { 132, 28, PA_SHIFT, 64 },
+    // State 132
+    { 132, 103, PA_REDUCE, 62 },
+    // State 132 default action
+    { 132, -1, PA_REDUCE, 62 },
+    // State 133
+    { 133, 29, PA_SHIFT, 66 },
+    // State 133
+    { 133, 103, PA_REDUCE, 64 },
+    // State 133 default action
+    { 133, -1, PA_REDUCE, 64 },
+    // State 134
+    { 134, 30, PA_SHIFT, 68 },
+    // State 134
+    { 134, 103, PA_REDUCE, 66 },
+    // State 134 default action
+    { 134, -1, PA_REDUCE, 66 },
+    // State 135
+    { 135, 31, PA_SHIFT, 70 },
+    // State 135
+    { 135, 103, PA_REDUCE, 68 },
+    // State 135 default action
+    { 135, -1, PA_REDUCE, 68 },
+    // State 136
+    { 136, 32, PA_SHIFT, 72 },
+    // State 136
+    { 136, 103, PA_REDUCE, 70 },
+    // State 136 default action
+    { 136, -1, PA_REDUCE, 70 },
+    // State 137
+    { 137, 33, PA_SHIFT, 74 },
+    // State 137
+    { 137, 103, PA_REDUCE, 72 },
+    // State 137 default action
+    { 137, -1, PA_REDUCE, 72 },
+    // State 138
+    { 138, 34, PA_SHIFT, 76 },
+    // State 138
+    { 138, 103, PA_REDUCE, 74 },
+    // State 138 default action
+    { 138, -1, PA_REDUCE, 74 },
+    // State 139
+    { 139, 35, PA_SHIFT, 78 },
+    // State 139
+    { 139, 103, PA_REDUCE, 76 },
+    // State 139 default action
+    { 139, -1, PA_REDUCE, 76 },
+    // State 140
+    { 140, 36, PA_SHIFT, 80 },
+    // State 140
+    { 140, 103, PA_REDUCE, 78 },
+    // State 140 default action
+    { 140, -1, PA_REDUCE, 78 },
+    // State 141
+    { 141, 38, PA_SHIFT, 82 },
+    // State 141
+    { 141, 103, PA_REDUCE, 80 },
+    // State 141 default action
+    { 141, -1, PA_REDUCE, 80 },
+    // State 142
+    { 142, 39, PA_SHIFT, 84 },
+    // State 142
+    { 142, 103, PA_REDUCE, 82 },
+    // State 142 default action
+    { 142, -1, PA_REDUCE, 82 },
+    // State 143
+    { 143, 40, PA_SHIFT, 86 },
+    // State 143
+    { 143, 103, PA_REDUCE, 84 },
+    // State 143 default action
+    { 143, -1, PA_REDUCE, 84 },
+    // State 144
+    { 144, 41, PA_SHIFT, 88 },
+    // State 144
+    { 144, 103, PA_REDUCE, 86 },
+    // State 144 default action
+    { 144, -1, PA_REDUCE, 86 },
+    // State 145
+    { 145, 42, PA_SHIFT, 90 },
+    // State 145
+    { 145, 103, PA_REDUCE, 88 },
+    // State 145 default action
+    { 145, -1, PA_REDUCE, 88 },
+    // State 146
+    { 146, 43, PA_SHIFT, 92 },
+    // State 146
+    { 146, 103, PA_REDUCE, 90 },
+    // State 146 default action
+    { 146, -1, PA_REDUCE, 90 },
+    // State 147
+    { 147, 44, PA_SHIFT, 94 },
+    // State 147
+    { 147, 103, PA_REDUCE, 92 },
+    // State 147 default action
+    { 147, -1, PA_REDUCE, 92 },
+    // State 148
+    { 148, 45, PA_SHIFT, 96 },
+    // State 148
+    { 148, 103, PA_REDUCE, 94 },
+    // State 148 default action
+    { 148, -1, PA_REDUCE, 94 },
+    // State 149
+    { 149, 103, PA_REDUCE, 96 },
+    // State 149 default action
+    { 149, -1, PA_REDUCE, 96 },
+};
+
+
+static int theRuleTable[99][2] =
+{
+    // prog ::= e0
+    { 102, 1 }, 
+    // e0 ::= e0 OP0 e1
+    { 52, 3 }, 
+    // e0 ::= e1
+    { 52, 1 }, 
+    // e1 ::= e1 OP1 e2
+    { 53, 3 }, 
+    // e1 ::= e2
+    { 53, 1 }, 
+    // e2 ::= e2 OP2 e3
+    { 64, 3 }, 
+    // e2 ::= e3
+    { 64, 1 }, 
+    // e3 ::= e3 OP3 e4
+    { 75, 3 }, 
+    // e3 ::= e4
+    { 75, 1 }, 
+    // e4 ::= e4 OP4 e5
+    { 86, 3 }, 
+    // e4 ::= e5
+    { 86, 1 }, 
+    // e5 ::= e5 OP5 e6
+    { 96, 3 }, 
+    // e5 ::= e6
+    { 96, 1 }, 
+    // e6 ::= e6 OP6 e7
+    { 97, 3 }, 
+    // e6 ::= e7
+    { 97, 1 }, 
+    // e7 ::= e7 OP7 e8
+    { 98, 3 }, 
+    // e7 ::= e8
+    { 98, 1 }, 
+    // e8 ::= e8 OP8 e9
+    { 99, 3 }, 
+    // e8 ::= e9
+    { 99, 1 }, 
+    // e9 ::= e9 OP9 e10
+    { 100, 3 }, 
+    // e9 ::= e10
+    { 100, 1 }, 
+    // e10 ::= e10 OP10 e11
+    { 54, 3 }, 
+    // e10 ::= e11
+    { 54, 1 }, 
+    // e11 ::= e11 OP11 e12
+    { 55, 3 }, 
+    // e11 ::= e12
+    { 55, 1 }, 
+    // e12 ::= e12 OP12 e13
+    { 56, 3 }, 
+    // e12 ::= e13
+    { 56, 1 }, 
+    // e13 ::= e13 OP13 e14
+    { 57, 3 }, 
+    // e13 ::= e14
+    { 57, 1 }, 
+    // e14 ::= e14 OP14 e15
+    { 58, 3 }, 
+    // e14 ::= e15
+    { 58, 1 }, 
+    // e15 ::= e15 OP15 e16
+    { 59, 3 }, 
+    // e15 ::= e16
+    { 59, 1 }, 
+    // e16 ::= e16 OP16 e17
+    { 60, 3 }, 
+    // e16 ::= e17
+    { 60, 1 }, 
+    // e17 ::= e17 OP17 e18
+    { 61, 3 }, 
+    // e17 ::= e18
+    { 61, 1 }, 
+    // e18 ::= e18 OP18 e19
+    { 62, 3 }, 
+    // e18 ::= e19
+    { 62, 1 }, 
+    // e19 ::= e19 OP19 e20
+    { 63, 3 }, 
+    // e19 ::= e20
+    { 63, 1 }, 
+    // e20 ::= e20 OP20 e21
+    { 65, 3 }, 
+    // e20 ::= e21
+    { 65, 1 }, 
+    // e21 ::= e21 OP21 e22
+    { 66, 3 }, 
+    // e21 ::= e22
+    { 66, 1 }, 
+    // e22 ::= e22 OP22 e23
+    { 67, 3 }, 
+    // e22 ::= e23
+    { 67, 1 }, 
+    // e23 ::= e23 OP23 e24
+    { 68, 3 }, 
+    // e23 ::= e24
+    { 68, 1 }, 
+    // e24 ::= e24 OP24 e25
+    { 69, 3 }, 
+    // e24 ::= e25
+    { 69, 1 }, 
+    // e25 ::= e25 OP25 e26
+    { 70, 3 }, 
+    // e25 ::= e26
+    { 70, 1 }, 
+    // e26 ::= e26 OP26 e27
+    { 71, 3 }, 
+    // e26 ::= e27
+    { 71, 1 }, 
+    // e27 ::= e27 OP27 e28
+    { 72, 3 }, 
+    // e27 ::= e28
+    { 72, 1 }, 
+    // e28 ::= e28 OP28 e29
+    { 73, 3 }, 
+    // e28 ::= e29
+    { 73, 1 }, 
+    // e29 ::= e29 OP29 e30
+    { 74, 3 }, 
+    // e29 ::= e30
+    { 74, 1 }, 
+    // e30 ::= e30 OP30 e31
+    { 76, 3 }, 
+    // e30 ::= e31
+    { 76, 1 }, 
+    // e31 ::= e31 OP31 e32
+    { 77, 3 }, 
+    // e31 ::= e32
+    { 77, 1 }, 
+    // e32 ::= e32 OP32 e33
+    { 78, 3 }, 
+    // e32 ::= e33
+    { 78, 1 }, 
+    // e33 ::= e33 OP33 e34
+    { 79, 3 }, 
+    // e33 ::= e34
+    { 79, 1 }, 
+    // e34 ::= e34 OP34 e35
+    { 80, 3 }, 
+    // e34 ::= e35
+    { 80, 1 }, 
+    // e35 ::= e35 OP35 e36
+    { 81, 3 }, 
+    // e35 ::= e36
+    { 81, 1 }, 
+    // e36 ::= e36 OP36 e37
+    { 82, 3 }, 
+    // e36 ::= e37
+    { 82, 1 }, 
+    // e37 ::= e37 OP37 e38
+    { 83, 3 }, 
+    // e37 ::= e38
+    { 83, 1 }, 
+    // e38 ::= e38 OP38 e39
+    { 84, 3 }, 
+    // e38 ::= e39
+    { 84, 1 }, 
+    // e39 ::= e39 OP39 e40
+    { 85, 3 }, 
+    // e39 ::= e40
+    { 85, 1 }, 
+    // e40 ::= e40 OP40 e41
+    { 87, 3 }, 
+    // e40 ::= e41
+    { 87, 1 }, 
+    // e41 ::= e41 OP41 e42
+    { 88, 3 }, 
+    // e41 ::= e42
+    { 88, 1 }, 
+    // e42 ::= e42 OP42 e43
+    { 89, 3 }, 
+    // e42 ::= e43
+    { 89, 1 }, 
+    // e43 ::= e43 OP43 e44
+    { 90, 3 }, 
+    // e43 ::= e44
+    { 90, 1 }, 
+    // e44 ::= e44 OP44 e45
+    { 91, 3 }, 
+    // e44 ::= e45
+    { 91, 1 }, 
+    // e45 ::= e45 OP45 e46
+    { 92, 3 }, 
+    // e45 ::= e46
+    { 92, 1 }, 
+    // e46 ::= e46 OP46 e47
+    { 93, 3 }, 
+    // e46 ::= e47
+    { 93, 1 }, 
+    // e47 ::= e47 OP47 e48
+    { 94, 3 }, 
+    // e47 ::= e48
+    { 94, 1 }, 
+    // e48 ::= NUM
+    { 95, 1 }, 
+    // e48 ::= LP e0 RP
+    { 95, 3 }, 
+};
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::initTables( void )
+{
+    myStates.assign( 150, ActionMap() );
+    myStateDefaultActions.assign( 150, ActionEntry(PA_ERROR,-2) );
+    for ( int i = 0; i < 1669; ++i )
+    {
+        if ( theStateTable[i][1] == -1 )
+            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+        else
+            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+    }
+
+
+    // Rule Table
+
+    myRules.reserve( 99 );
+    for ( int i = 0; i < 99; ++i )
+        myRules.push_back( RuleInfo( theRuleTable[i][0], theRuleTable[i][1] ) );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::syntaxError( Bench::Terminal tok, privBenchImpl::Value &data )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parseFailed( void )
+{
+}
@@ -0,0 +1,85 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        LP = 1,
+        NUM = 2,
+        OP0 = 3,
+        OP1 = 4,
+        OP10 = 5,
+        OP11 = 6,
+        OP12 = 7,
+        OP13 = 8,
+        OP14 = 9,
+        OP15 = 10,
+        OP16 = 11,
+        OP17 = 12,
+        OP18 = 13,
+        OP19 = 14,
+        OP2 = 15,
+        OP20 = 16,
+        OP21 = 17,
+        OP22 = 18,
+        OP23 = 19,
+        OP24 = 20,
+        OP25 = 21,
+        OP26 = 22,
+        OP27 = 23,
+        OP28 = 24,
+        OP29 = 25,
+        OP3 = 26,
+        OP30 = 27,
+        OP31 = 28,
+        OP32 = 29,
+        OP33 = 30,
+        OP34 = 31,
+        OP35 = 32,
+        OP36 = 33,
+        OP37 = 34,
+        OP38 = 35,
+        OP39 = 36,
+        OP4 = 37,
+        OP40 = 38,
+        OP41 = 39,
+        OP42 = 40,
+        OP43 = 41,
+        OP44 = 42,
+        OP45 = 43,
+        OP46 = 44,
+        OP47 = 45,
+        OP5 = 46,
+        OP6 = 47,
+        OP7 = 48,
+        OP8 = 49,
+        OP9 = 50,
+        RP = 51
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
@@ -0,0 +1,535 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        LP = 1,
+        NUM = 2,
+        OP0 = 3,
+        OP1 = 4,
+        OP10 = 5,
+        OP100 = 6,
+        OP101 = 7,
+        OP102 = 8,
+        OP103 = 9,
+        OP104 = 10,
+        OP105 = 11,
+        OP106 = 12,
+        OP107 = 13,
+        OP108 = 14,
+        OP109 = 15,
+        OP11 = 16,
+        OP110 = 17,
+        OP111 = 18,
+        OP112 = 19,
+        OP113 = 20,
+        OP114 = 21,
+        OP115 = 22,
+        OP116 = 23,
+        OP117 = 24,
+        OP118 = 25,
+        OP119 = 26,
+        OP12 = 27,
+        OP120 = 28,
+        OP121 = 29,
+        OP122 = 30,
+        OP123 = 31,
+        OP124 = 32,
+        OP125 = 33,
+        OP126 = 34,
+        OP127 = 35,
+        OP128 = 36,
+        OP129 = 37,
+        OP13 = 38,
+        OP130 = 39,
+        OP131 = 40,
+        OP132 = 41,
+        OP133 = 42,
+        OP134 = 43,
+        OP135 = 44,
+        OP136 = 45,
+        OP137 = 46,
+        OP138 = 47,
+        OP139 = 48,
+        OP14 = 49,
+        OP140 = 50,
+        OP141 = 51,
+        OP142 = 52,
+        OP143 = 53,
+        OP144 = 54,
+        OP145 = 55,
+        OP146 = 56,
+        OP147 = 57,
+        OP148 = 58,
+        OP149 = 59,
+        OP15 = 60,
+        OP150 = 61,
+        OP151 = 62,
+        OP152 = 63,
+        OP153 = 64,
+        OP154 = 65,
+        OP155 = 66,
+        OP156 = 67,
+        OP157 = 68,
+        OP158 = 69,
+        OP159 = 70,
+        OP16 = 71,
+        OP160 = 72,
+        OP161 = 73,
+        OP162 = 74,
+        OP163 = 75,
+        OP164 = 76,
+        OP165 = 77,
+        OP166 = 78,
+        OP167 = 79,
+        OP168 = 80,
+        OP169 = 81,
+        OP17 = 82,
+        OP170 = 83,
+        OP171 = 84,
+        OP172 = 85,
+        OP173 = 86,
+        OP174 = 87,
+        OP175 = 88,
+        OP176 = 89,
+        OP177 = 90,
+        OP178 = 91,
+        OP179 = 92,
+        OP18 = 93,
+        OP180 = 94,
+        OP181 = 95,
+        OP182 = 96,
+        OP183 = 97,
+        OP184 = 98,
+        OP185 = 99,
+        OP186 = 100,
+        OP187 = 101,
+        OP188 = 102,
+        OP189 = 103,
+        OP19 = 104,
+        OP190 = 105,
+        OP191 = 106,
+        OP192 = 107,
+        OP193 = 108,
+        OP194 = 109,
+        OP195 = 110,
+        OP196 = 111,
+        OP197 = 112,
+        OP198 = 113,
+        OP199 = 114,
+        OP2 = 115,
+        OP20 = 116,
+        OP200 = 117,
+        OP201 = 118,
+        OP202 = 119,
+        OP203 = 120,
+        OP204 = 121,
+        OP205 = 122,
+        OP206 = 123,
+        OP207 = 124,
+        OP208 = 125,
+        OP209 = 126,
+        OP21 = 127,
+        OP210 = 128,
+        OP211 = 129,
+        OP212 = 130,
+        OP213 = 131,
+        OP214 = 132,
+        OP215 = 133,
+        OP216 = 134,
+        OP217 = 135,
+        OP218 = 136,
+        OP219 = 137,
+        OP22 = 138,
+        OP220 = 139,
+        OP221 = 140,
+        OP222 = 141,
+        OP223 = 142,
+        OP224 = 143,
+        OP225 = 144,
+        OP226 = 145,
+        OP227 = 146,
+        OP228 = 147,
+        OP229 = 148,
+        OP23 = 149,
+        OP230 = 150,
+        OP231 = 151,
+        OP232 = 152,
+        OP233 = 153,
+        OP234 = 154,
+        OP235 = 155,
+        OP236 = 156,
+        OP237 = 157,
+        OP238 = 158,
+        OP239 = 159,
+        OP24 = 160,
+        OP240 = 161,
+        OP241 = 162,
+        OP242 = 163,
+        OP243 = 164,
+        OP244 = 165,
+        OP245 = 166,
+        OP246 = 167,
+        OP247 = 168,
+        OP248 = 169,
+        OP249 = 170,
+        OP25 = 171,
+        OP250 = 172,
+        OP251 = 173,
+        OP252 = 174,
+        OP253 = 175,
+        OP254 = 176,
+        OP255 = 177,
+        OP256 = 178,
+        OP257 = 179,
+        OP258 = 180,
+        OP259 = 181,
+        OP26 = 182,
+        OP260 = 183,
+        OP261 = 184,
+        OP262 = 185,
+        OP263 = 186,
+        OP264 = 187,
+        OP265 = 188,
+        OP266 = 189,
+        OP267 = 190,
+        OP268 = 191,
+        OP269 = 192,
+        OP27 = 193,
+        OP270 = 194,
+        OP271 = 195,
+        OP272 = 196,
+        OP273 = 197,
+        OP274 = 198,
+        OP275 = 199,
+        OP276 = 200,
+        OP277 = 201,
+        OP278 = 202,
+        OP279 = 203,
+        OP28 = 204,
+        OP280 = 205,
+        OP281 = 206,
+        OP282 = 207,
+        OP283 = 208,
+        OP284 = 209,
+        OP285 = 210,
+        OP286 = 211,
+        OP287 = 212,
+        OP288 = 213,
+        OP289 = 214,
+        OP29 = 215,
+        OP290 = 216,
+        OP291 = 217,
+        OP292 = 218,
+        OP293 = 219,
+        OP294 = 220,
+        OP295 = 221,
+        OP296 = 222,
+        OP297 = 223,
+        OP298 = 224,
+        OP299 = 225,
+        OP3 = 226,
+        OP30 = 227,
+        OP300 = 228,
+        OP301 = 229,
+        OP302 = 230,
+        OP303 = 231,
+        OP304 = 232,
+        OP305 = 233,
+        OP306 = 234,
+        OP307 = 235,
+        OP308 = 236,
+        OP309 = 237,
+        OP31 = 238,
+        OP310 = 239,
+        OP311 = 240,
+        OP312 = 241,
+        OP313 = 242,
+        OP314 = 243,
+        OP315 = 244,
+        OP316 = 245,
+        OP317 = 246,
+        OP318 = 247,
+        OP319 = 248,
+        OP32 = 249,
+        OP320 = 250,
+        OP321 = 251,
+        OP322 = 252,
+        OP323 = 253,
+        OP324 = 254,
+        OP325 = 255,
+        OP326 = 256,
+        OP327 = 257,
+        OP328 = 258,
+        OP329 = 259,
+        OP33 = 260,
+        OP330 = 261,
+        OP331 = 262,
+        OP332 = 263,
+        OP333 = 264,
+        OP334 = 265,
+        OP335 = 266,
+        OP336 = 267,
+        OP337 = 268,
+        OP338 = 269,
+        OP339 = 270,
+        OP34 = 271,
+        OP340 = 272,
+        OP341 = 273,
+        OP342 = 274,
+        OP343 = 275,
+        OP344 = 276,
+        OP345 = 277,
+        OP346 = 278,
+        OP347 = 279,
+        OP348 = 280,
+        OP349 = 281,
+        OP35 = 282,
+        OP350 = 283,
+        OP351 = 284,
+        OP352 = 285,
+        OP353 = 286,
+        OP354 = 287,
+        OP355 = 288,
+        OP356 = 289,
+        OP357 = 290,
+        OP358 = 291,
+        OP359 = 292,
+        OP36 = 293,
+        OP360 = 294,
+        OP361 = 295,
+        OP362 = 296,
+        OP363 = 297,
+        OP364 = 298,
+        OP365 = 299,
+        OP366 = 300,
+        OP367 = 301,
+        OP368 = 302,
+        OP369 = 303,
+        OP37 = 304,
+        OP370 = 305,
+        OP371 = 306,
+        OP372 = 307,
+        OP373 = 308,
+        OP374 = 309,
+        OP375 = 310,
+        OP376 = 311,
+        OP377 = 312,
+        OP378 = 313,
+        OP379 = 314,
+        OP38 = 315,
+        OP380 = 316,
+        OP381 = 317,
+        OP382 = 318,
+        OP383 = 319,
+        OP384 = 320,
+        OP385 = 321,
+        OP386 = 322,
+        OP387 = 323,
+        OP388 = 324,
+        OP389 = 325,
+        OP39 = 326,
+        OP390 = 327,
+        OP391 = 328,
+        OP392 = 329,
+        OP393 = 330,
+        OP394 = 331,
+        OP395 = 332,
+        OP396 = 333,
+        OP397 = 334,
+        OP398 = 335,
+        OP399 = 336,
+        OP4 = 337,
+        OP40 = 338,
+        OP400 = 339,
+        OP401 = 340,
+        OP402 = 341,
+        OP403 = 342,
+        OP404 = 343,
+        OP405 = 344,
+        OP406 = 345,
+        OP407 = 346,
+        OP408 = 347,
+        OP409 = 348,
+        OP41 = 349,
+        OP410 = 350,
+        OP411 = 351,
+        OP412 = 352,
+        OP413 = 353,
+        OP414 = 354,
+        OP415 = 355,
+        OP416 = 356,
+        OP417 = 357,
+        OP418 = 358,
+        OP419 = 359,
+        OP42 = 360,
+        OP420 = 361,
+        OP421 = 362,
+        OP422 = 363,
+        OP423 = 364,
+        OP424 = 365,
+        OP425 = 366,
+        OP426 = 367,
+        OP427 = 368,
+        OP428 = 369,
+        OP429 = 370,
+        OP43 = 371,
+        OP430 = 372,
+        OP431 = 373,
+        OP432 = 374,
+        OP433 = 375,
+        OP434 = 376,
+        OP435 = 377,
+        OP436 = 378,
+        OP437 = 379,
+        OP438 = 380,
+        OP439 = 381,
+        OP44 = 382,
+        OP440 = 383,
+        OP441 = 384,
+        OP442 = 385,
+        OP443 = 386,
+        OP444 = 387,
+        OP445 = 388,
+        OP446 = 389,
+        OP447 = 390,
+        OP448 = 391,
+        OP449 = 392,
+        OP45 = 393,
+        OP450 = 394,
+        OP451 = 395,
+        OP452 = 396,
+        OP453 = 397,
+        OP454 = 398,
+        OP455 = 399,
+        OP456 = 400,
+        OP457 = 401,
+        OP458 = 402,
+        OP459 = 403,
+        OP46 = 404,
+        OP460 = 405,
+        OP461 = 406,
+        OP462 = 407,
+        OP463 = 408,
+        OP464 = 409,
+        OP465 = 410,
+        OP466 = 411,
+        OP467 = 412,
+        OP468 = 413,
+        OP469 = 414,
+        OP47 = 415,
+        OP470 = 416,
+        OP471 = 417,
+        OP472 = 418,
+        OP473 = 419,
+        OP474 = 420,
+        OP475 = 421,
+        OP476 = 422,
+        OP477 = 423,
+        OP478 = 424,
+        OP479 = 425,
+        OP48 = 426,
+        OP480 = 427,
+        OP481 = 428,
+        OP482 = 429,
+        OP483 = 430,
+        OP484 = 431,
+        OP485 = 432,
+        OP486 = 433,
+        OP487 = 434,
+        OP488 = 435,
+        OP489 = 436,
+        OP49 = 437,
+        OP490 = 438,
+        OP491 = 439,
+        OP492 = 440,
+        OP493 = 441,
+        OP494 = 442,
+        OP495 = 443,
+        OP496 = 444,
+        OP497 = 445,
+        OP5 = 446,
+        OP50 = 447,
+        OP51 = 448,
+        OP52 = 449,
+        OP53 = 450,
+        OP54 = 451,
+        OP55 = 452,
+        OP56 = 453,
+        OP57 = 454,
+        OP58 = 455,
+        OP59 = 456,
+        OP6 = 457,
+        OP60 = 458,
+        OP61 = 459,
+        OP62 = 460,
+        OP63 = 461,
+        OP64 = 462,
+        OP65 = 463,
+        OP66 = 464,
+        OP67 = 465,
+        OP68 = 466,
+        OP69 = 467,
+        OP7 = 468,
+        OP70 = 469,
+        OP71 = 470,
+        OP72 = 471,
+        OP73 = 472,
+        OP74 = 473,
+        OP75 = 474,
+        OP76 = 475,
+        OP77 = 476,
+        OP78 = 477,
+        OP79 = 478,
+        OP8 = 479,
+        OP80 = 480,
+        OP81 = 481,
+        OP82 = 482,
+        OP83 = 483,
+        OP84 = 484,
+        OP85 = 485,
+        OP86 = 486,
+        OP87 = 487,
+        OP88 = 488,
+        OP89 = 489,
+        OP9 = 490,
+        OP90 = 491,
+        OP91 = 492,
+        OP92 = 493,
+        OP93 = 494,
+        OP94 = 495,
+        OP95 = 496,
+        OP96 = 497,
+        OP97 = 498,
+        OP98 = 499,
+        OP99 = 500,
+        RP = 501
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
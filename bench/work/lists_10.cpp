@@ -0,0 +1,552 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#include <utility>
+#include <stack>
+#include <map>
+#include <vector>
+#include <iostream>
+
+
+#include "lists_10.h"
+
+enum ParserAct
+{
+    PA_SHIFT,
+    PA_REDUCE,
+    PA_ERROR,
+    PA_ACCEPT,
+    PA_NOP
+};
+
+class privBenchImpl
+{
+public:
+
+    privBenchImpl( void );
+    ~privBenchImpl( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    struct Value
+    {
+        union
+        {
+            int tokenType;
+            int errorType;
+        };
+    };
+    // first is stack num, second is the symbol index
+    typedef std::pair<int,int> StackID;
+    typedef std::pair<StackID,Value> StackEntry;
+    typedef std::stack<StackEntry> ParseStack;
+
+    void shift( int newState, int symIdx, Value &data );
+    void reduce( int ruleNum );
+    void callDtor( int symIdx, Value &data );
+    void popStack( void );
+    ParserAct findParserAction( int &newVal, int tok );
+    void initTables( void );
+    void syntaxError( Bench::Terminal tok, Value &data );
+    void parseFailed( void );
+
+    ParseStack myStack;
+    int myErrCount;
+
+
+    typedef std::pair<ParserAct,int> ActionEntry;
+    typedef std::map<int,ActionEntry> ActionMap;
+    typedef std::vector<ActionMap> StateList;
+    typedef std::vector<ActionEntry> StateDefaultList;
+
+    StateList myStates;
+    StateDefaultList myStateDefaultActions;
+
+
+    // first is LHS, second is number of RHS
+    typedef std::pair<int,int> RuleInfo;
+    typedef std::vector<RuleInfo> RuleList;
+
+    RuleList myRules;
+};
+
+
+////////////////////////////////////////
+
+
+Bench::Bench( void )
+    : myImplementation( new privBenchImpl )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Bench::~Bench( void )
+{
+    delete myImplementation;
+}
+
+
+////////////////////////////////////////
+
+
+void Bench::parse( Bench::Terminal tok, int value )
+{
+    myImplementation->parse( tok, value );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parse( Bench::Terminal tok, int value )
+{
+    int actVal;
+    ParserAct action;
+    bool errHit = false;
+    bool eoInput = (tok == Bench::EOF );
+    bool done = false;
+
+    if ( myStack.empty() )
+    {
+        if ( eoInput )
+            return;
+
+        myErrCount = -1;
+    }
+
+    privBenchImpl::Value data;
+    data.tokenType = value;
+
+    do
+    {
+        action = findParserAction( actVal, tok );
+        if ( PA_SHIFT == action )
+        {
+            shift( actVal, tok, data );
+            --myErrCount;
+            if ( eoInput && ! myStack.empty() )
+                tok = Bench::EOF;
+            else
+                done = true;
+        }
+        else if ( PA_REDUCE == action )
+        {
+            reduce( actVal );
+        }
+        else if ( PA_ERROR == action )
+        {
+            // Syntax error handling:
+            // 1. Call the %syntax_error function.
+            // 2. Pop stack until a state where we can shift the err symbol.
+            // 3. Shift the error symbol.
+            // 4. Set error count to three.
+            // 5. Begin accepting and shifting new tokens.
+            // 6. No new error processing will begin until 3 tokens are successful.
+            if ( myErrCount < 0 )
+            {
+                syntaxError( tok, data );
+            }
+            if ( myStack.top().first.first == 10 || errHit )
+            {
+                callDtor( static_cast<int>(tok), data );
+                done = true;
+            }
+            else
+            {
+                while ( ! myStack.empty() &&
+                        myStack.top().first.first != 10 )
+                {
+                    action = findParserAction( actVal, 10 );
+                    if ( action == PA_SHIFT )
+                        break;
+                    popStack();
+                }
+                if ( myStack.empty() || tok == Bench::EOF )
+                {
+                    callDtor( static_cast<int>(tok), data );
+                    parseFailed();
+                    done = true;
+                }
+                else if ( myStack.top().first.first != 10 )
+                {
+                    data.errorType = 0;
+                    shift( actVal, 10, data );
+                }
+            }
+            myErrCount = 3;
+            errHit = true;
+        }
+        else // ACCEPT == action || NOP == action
+        {
+            done = true;
+        }
+    } while ( ! done && ! myStack.empty() );
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::privBenchImpl( void )
+    : myErrCount( -1 )
+{
+    initTables();
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::~privBenchImpl( void )
+{
+    while ( ! myStack.empty() )
+        popStack();
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::shift( int newState, int symIdx, privBenchImpl::Value &data )
+{
+    StackEntry newItem = StackEntry( StackID( newState, symIdx ), data );
+    myStack.push( newItem );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::reduce( int ruleNum )
+{
+    int newVal;
+    ParserAct next;
+    privBenchImpl::Value data = { 0 };
+    std::vector<privBenchImpl::Value> rhsData;
+    for ( int i = 0, N = myRules[ruleNum].second; i != N; ++i )
+    {
+        if ( myStack.empty() )
+            rhsData.insert( rhsData.begin(), data );
+        else
+        {
+            rhsData.insert( rhsData.begin(), myStack.top().second );
+            myStack.pop();
+        }
+    }
+
+    next = findParserAction( newVal, myRules[ruleNum].first );
+
+    switch ( ruleNum )
+    {
+        case 0:
+        {
+            // prog ::= list0
+#line 0 "bench/work/lists_10.lem"
+#line 250 "bench/work/lists_10.cpp"
+            callDtor( 11, rhsData[0] );
+            break;
+        }
+
+        case 1:
+        {
+            // list0 ::= list0 COMMA elem0
+#line 0 "bench/work/lists_10.lem"
+#line 259 "bench/work/lists_10.cpp"
+            callDtor( 11, rhsData[0] );
+            callDtor( 3, rhsData[1] );
+            callDtor( 8, rhsData[2] );
+            break;
+        }
+
+        case 2:
+        {
+            // list0 ::= elem0
+#line 0 "bench/work/lists_10.lem"
+#line 270 "bench/work/lists_10.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 3:
+        {
+            // elem0 ::= ATOM0
+#line 0 "bench/work/lists_10.lem"
+#line 279 "bench/work/lists_10.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 4:
+        {
+            // elem0 ::= LP0 list1 RP0
+#line 0 "bench/work/lists_10.lem"
+#line 288 "bench/work/lists_10.cpp"
+            callDtor( 4, rhsData[0] );
+            callDtor( 12, rhsData[1] );
+            callDtor( 6, rhsData[2] );
+            break;
+        }
+
+        case 5:
+        {
+            // list1 ::= list1 COMMA elem1
+#line 0 "bench/work/lists_10.lem"
+#line 299 "bench/work/lists_10.cpp"
+            callDtor( 12, rhsData[0] );
+            callDtor( 3, rhsData[1] );
+            callDtor( 9, rhsData[2] );
+            break;
+        }
+
+        case 6:
+        {
+            // list1 ::= elem1
+#line 0 "bench/work/lists_10.lem"
+#line 310 "bench/work/lists_10.cpp"
+            callDtor( 9, rhsData[0] );
+            break;
+        }
+
+        case 7:
+        {
+            // elem1 ::= ATOM1
+#line 0 "bench/work/lists_10.lem"
+#line 319 "bench/work/lists_10.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 8:
+        {
+            // elem1 ::= LP1 RP1
+#line 0 "bench/work/lists_10.lem"
+#line 328 "bench/work/lists_10.cpp"
+            callDtor( 5, rhsData[0] );
+            callDtor( 7, rhsData[1] );
+            break;
+        }
+
+        default:
+            throw "Unknown Rule Number";
+            break;
+    }
+
+    if ( PA_SHIFT == next )
+        shift( newVal, myRules[ruleNum].first, data );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::callDtor( int symIdx, privBenchImpl::Value &data )
+{
+    switch ( symIdx )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::popStack( void )
+{
+    callDtor( myStack.top().first.second, myStack.top().second );
+    myStack.pop();
+}
+
+
+////////////////////////////////////////
+
+
+ParserAct privBenchImpl::findParserAction( int &newVal, int tok )
+{
+    int stateNum;
+    ParserAct retval = PA_NOP;
+    bool found = false;
+
+    stateNum = myStack.empty() ? 0 : myStack.top().first.first;
+    ActionMap::iterator i = myStates[stateNum].find( tok );
+    if ( tok >= 0 && tok <= 14 )
+    {
+        if ( i != myStates[stateNum].end() )
+        {
+            retval = (*i).second.first;
+            newVal = (*i).second.second;
+            found = true;
+        }
+    }
+    else if ( ! myStates[stateNum].empty() )
+    {
+        retval = PA_NOP;
+        newVal = 0;
+        found = true;
+    }
+
+    if ( ! found )
+    {
+        retval = myStateDefaultActions[stateNum].first;
+        newVal = myStateDefaultActions[stateNum].second;
+    }
+    return retval;
+}
+
+
+////////////////////////////////////////
+
+
+static int theStateTable[36][4] =
+{
+    // State 0
+    { 0, 1, PA_SHIFT, 4 },
+    // State 0
+    { 0, 4, PA_SHIFT, 5 },
+    // State 0
+    { 0, 8, PA_SHIFT, 14 },
+    // State 0
+    { 0, 11, PA_SHIFT, 1 },
+    // State 0
+    { 0, 13, PA_ACCEPT, 0 },
+    // State 1
+    { 1, 0, PA_REDUCE, 0 },
+    // State 1
+    { 1, 3, PA_SHIFT, 2 },
+    // State 2
+    { 2, 1, PA_SHIFT, 4 },
+    // State 2
+    { 2, 4, PA_SHIFT, 5 },
+    // State 2
+    { 2, 8, PA_SHIFT, 3 },
+    // State 3
+    { 3, 14, PA_REDUCE, 1 },
+    // State 3 default action
+    { 3, -1, PA_REDUCE, 1 },
+    // State 4
+    { 4, 14, PA_REDUCE, 3 },
+    // State 4 default action
+    { 4, -1, PA_REDUCE, 3 },
+    // State 5
+    { 5, 2, PA_SHIFT, 10 },
+    // State 5
+    { 5, 5, PA_SHIFT, 11 },
+    // State 5
+    { 5, 9, PA_SHIFT, 13 },
+    // State 5
+    { 5, 12, PA_SHIFT, 6 },
+    // State 6
+    { 6, 3, PA_SHIFT, 8 },
+    // State 6
+    { 6, 6, PA_SHIFT, 7 },
+    // State 7
+    { 7, 14, PA_REDUCE, 4 },
+    // State 7 default action
+    { 7, -1, PA_REDUCE, 4 },
+    // State 8
+    { 8, 2, PA_SHIFT, 10 },
+    // State 8
+    { 8, 5, PA_SHIFT, 11 },
+    // State 8
+    { 8, 9, PA_SHIFT, 9 },
+    // State 9
+    { 9, 14, PA_REDUCE, 5 },
+    // State 9 default action
+    { 9, -1, PA_REDUCE, 5 },
+    // State 10
+    { 10, 14, PA_REDUCE, 7 },
+    // State 10 default action
+    { 10, -1, PA_REDUCE, 7 },
+    // State 11
+    { 11, 7, PA_SHIFT, 12 },
+    // State 12
+    { 12, 14, PA_REDUCE, 8 },
+    // State 12 default action
+    { 12, -1, PA_REDUCE, 8 },
+    // State 13
+    { 13, 14, PA_REDUCE, 6 },
+    // State 13 default action
+    { 13, -1, PA_REDUCE, 6 },
+    // State 14
+    { 14, 14, PA_REDUCE, 2 },
+    // State 14 default action
+    { 14, -1, PA_REDUCE, 2 },
+};
+
+
+static int theRuleTable[9][2] =
+{
+    // prog ::= list0
+    { 13, 1 }, 
+    // list0 ::= list0 COMMA elem0
+    { 11, 3 }, 
+    // list0 ::= elem0
+    { 11, 1 }, 
+    // elem0 ::= ATOM0
+    { 8, 1 }, 
+    // elem0 ::= LP0 list1 RP0
+    { 8, 3 }, 
+    // list1 ::= list1 COMMA elem1
+    { 12, 3 }, 
+    // list1 ::= elem1
+    { 12, 1 }, 
+    // elem1 ::= ATOM1
+    { 9, 1 }, 
+    // elem1 ::= LP1 RP1
+    { 9, 2 }, 
+};
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::initTables( void )
+{
+    myStates.assign( 15, ActionMap() );
+    myStateDefaultActions.assign( 15, ActionEntry(PA_ERROR,-2) );
+    for ( int i = 0; i < 36; ++i )
+    {
+        if ( theStateTable[i][1] == -1 )
+            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+        else
+            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+    }
+
+
+    // Rule Table
+
+    myRules.reserve( 9 );
+    for ( int i = 0; i < 9; ++i )
+        myRules.push_back( RuleInfo( theRuleTable[i][0], theRuleTable[i][1] ) );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::syntaxError( Bench::Terminal tok, privBenchImpl::Value &data )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parseFailed( void )
+{
+}
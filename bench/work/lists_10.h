@@ -0,0 +1,41 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        ATOM0 = 1,
+        ATOM1 = 2,
+        COMMA = 3,
+        LP0 = 4,
+        LP1 = 5,
+        RP0 = 6,
+        RP1 = 7
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
@@ -0,0 +1,2422 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#include <utility>
+#include <stack>
+#include <map>
+#include <vector>
+#include <iostream>
+
+
+#include "lists_100.h"
+
+enum ParserAct
+{
+    PA_SHIFT,
+    PA_REDUCE,
+    PA_ERROR,
+    PA_ACCEPT,
+    PA_NOP
+};
+
+class privBenchImpl
+{
+public:
+
+    privBenchImpl( void );
+    ~privBenchImpl( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    struct Value
+    {
+        union
+        {
+            int tokenType;
+            int errorType;
+        };
+    };
+    // first is stack num, second is the symbol index
+    typedef std::pair<int,int> StackID;
+    typedef std::pair<StackID,Value> StackEntry;
+    typedef std::stack<StackEntry> ParseStack;
+
+    void shift( int newState, int symIdx, Value &data );
+    void reduce( int ruleNum );
+    void callDtor( int symIdx, Value &data );
+    void popStack( void );
+    ParserAct findParserAction( int &newVal, int tok );
+    void initTables( void );
+    void syntaxError( Bench::Terminal tok, Value &data );
+    void parseFailed( void );
+
+    ParseStack myStack;
+    int myErrCount;
+
+
+    typedef std::pair<ParserAct,int> ActionEntry;
+    typedef std::map<int,ActionEntry> ActionMap;
+    typedef std::vector<ActionMap> StateList;
+    typedef std::vector<ActionEntry> StateDefaultList;
+
+    StateList myStates;
+    StateDefaultList myStateDefaultActions;
+
+
+    // first is LHS, second is number of RHS
+    typedef std::pair<int,int> RuleInfo;
+    typedef std::vector<RuleInfo> RuleList;
+
+    RuleList myRules;
+};
+
+
+////////////////////////////////////////
+
+
+Bench::Bench( void )
+    : myImplementation( new privBenchImpl )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Bench::~Bench( void )
+{
+    delete myImplementation;
+}
+
+
+////////////////////////////////////////
+
+
+void Bench::parse( Bench::Terminal tok, int value )
+{
+    myImplementation->parse( tok, value );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parse( Bench::Terminal tok, int value )
+{
+    int actVal;
+    ParserAct action;
+    bool errHit = false;
+    bool eoInput = (tok == Bench::EOF );
+    bool done = false;
+
+    if ( myStack.empty() )
+    {
+        if ( eoInput )
+            return;
+
+        myErrCount = -1;
+    }
+
+    privBenchImpl::Value data;
+    data.tokenType = value;
+
+    do
+    {
+        action = findParserAction( actVal, tok );
+        if ( PA_SHIFT == action )
+        {
+            shift( actVal, tok, data );
+            --myErrCount;
+            if ( eoInput && ! myStack.empty() )
+                tok = Bench::EOF;
+            else
+                done = true;
+        }
+        else if ( PA_REDUCE == action )
+        {
+            reduce( actVal );
+        }
+        else if ( PA_ERROR == action )
+        {
+            // Syntax error handling:
+            // 1. Call the %syntax_error function.
+            // 2. Pop stack until a state where we can shift the err symbol.
+            // 3. Shift the error symbol.
+            // 4. Set error count to three.
+            // 5. Begin accepting and shifting new tokens.
+            // 6. No new error processing will begin until 3 tokens are successful.
+            if ( myErrCount < 0 )
+            {
+                syntaxError( tok, data );
+            }
+            if ( myStack.top().first.first == 98 || errHit )
+            {
+                callDtor( static_cast<int>(tok), data );
+                done = true;
+            }
+            else
+            {
+                while ( ! myStack.empty() &&
+                        myStack.top().first.first != 98 )
+                {
+                    action = findParserAction( actVal, 98 );
+                    if ( action == PA_SHIFT )
+                        break;
+                    popStack();
+                }
+                if ( myStack.empty() || tok == Bench::EOF )
+                {
+                    callDtor( static_cast<int>(tok), data );
+                    parseFailed();
+                    done = true;
+                }
+                else if ( myStack.top().first.first != 98 )
+                {
+                    data.errorType = 0;
+                    shift( actVal, 98, data );
+                }
+            }
+            myErrCount = 3;
+            errHit = true;
+        }
+        else // ACCEPT == action || NOP == action
+        {
+            done = true;
+        }
+    } while ( ! done && ! myStack.empty() );
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::privBenchImpl( void )
+    : myErrCount( -1 )
+{
+    initTables();
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::~privBenchImpl( void )
+{
+    while ( ! myStack.empty() )
+        popStack();
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::shift( int newState, int symIdx, privBenchImpl::Value &data )
+{
+    StackEntry newItem = StackEntry( StackID( newState, symIdx ), data );
+    myStack.push( newItem );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::reduce( int ruleNum )
+{
+    int newVal;
+    ParserAct next;
+    privBenchImpl::Value data = { 0 };
+    std::vector<privBenchImpl::Value> rhsData;
+    for ( int i = 0, N = myRules[ruleNum].second; i != N; ++i )
+    {
+        if ( myStack.empty() )
+            rhsData.insert( rhsData.begin(), data );
+        else
+        {
+            rhsData.insert( rhsData.begin(), myStack.top().second );
+            myStack.pop();
+        }
+    }
+
+    next = findParserAction( newVal, myRules[ruleNum].first );
+
+    switch ( ruleNum )
+    {
+        case 0:
+        {
+            // prog ::= list0
+#line 0 "bench/work/lists_100.lem"
+#line 250 "bench/work/lists_100.cpp"
+            callDtor( 99, rhsData[0] );
+            break;
+        }
+
+        case 1:
+        {
+            // list0 ::= list0 COMMA elem0
+#line 0 "bench/work/lists_100.lem"
+#line 259 "bench/work/lists_100.cpp"
+            callDtor( 99, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 74, rhsData[2] );
+            break;
+        }
+
+        case 2:
+        {
+            // list0 ::= elem0
+#line 0 "bench/work/lists_100.lem"
+#line 270 "bench/work/lists_100.cpp"
+            callDtor( 74, rhsData[0] );
+            break;
+        }
+
+        case 3:
+        {
+            // elem0 ::= ATOM0
+#line 0 "bench/work/lists_100.lem"
+#line 279 "bench/work/lists_100.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 4:
+        {
+            // elem0 ::= LP0 list1 RP0
+#line 0 "bench/work/lists_100.lem"
+#line 288 "bench/work/lists_100.cpp"
+            callDtor( 26, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            callDtor( 50, rhsData[2] );
+            break;
+        }
+
+        case 5:
+        {
+            // list1 ::= list1 COMMA elem1
+#line 0 "bench/work/lists_100.lem"
+#line 299 "bench/work/lists_100.cpp"
+            callDtor( 100, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 75, rhsData[2] );
+            break;
+        }
+
+        case 6:
+        {
+            // list1 ::= elem1
+#line 0 "bench/work/lists_100.lem"
+#line 310 "bench/work/lists_100.cpp"
+            callDtor( 75, rhsData[0] );
+            break;
+        }
+
+        case 7:
+        {
+            // elem1 ::= ATOM1
+#line 0 "bench/work/lists_100.lem"
+#line 319 "bench/work/lists_100.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 8:
+        {
+            // elem1 ::= LP1 list2 RP1
+#line 0 "bench/work/lists_100.lem"
+#line 328 "bench/work/lists_100.cpp"
+            callDtor( 27, rhsData[0] );
+            callDtor( 111, rhsData[1] );
+            callDtor( 51, rhsData[2] );
+            break;
+        }
+
+        case 9:
+        {
+            // list2 ::= list2 COMMA elem2
+#line 0 "bench/work/lists_100.lem"
+#line 339 "bench/work/lists_100.cpp"
+            callDtor( 111, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 86, rhsData[2] );
+            break;
+        }
+
+        case 10:
+        {
+            // list2 ::= elem2
+#line 0 "bench/work/lists_100.lem"
+#line 350 "bench/work/lists_100.cpp"
+            callDtor( 86, rhsData[0] );
+            break;
+        }
+
+        case 11:
+        {
+            // elem2 ::= ATOM2
+#line 0 "bench/work/lists_100.lem"
+#line 359 "bench/work/lists_100.cpp"
+            callDtor( 13, rhsData[0] );
+            break;
+        }
+
+        case 12:
+        {
+            // elem2 ::= LP2 list3 RP2
+#line 0 "bench/work/lists_100.lem"
+#line 368 "bench/work/lists_100.cpp"
+            callDtor( 38, rhsData[0] );
+            callDtor( 116, rhsData[1] );
+            callDtor( 62, rhsData[2] );
+            break;
+        }
+
+        case 13:
+        {
+            // list3 ::= list3 COMMA elem3
+#line 0 "bench/work/lists_100.lem"
+#line 379 "bench/work/lists_100.cpp"
+            callDtor( 116, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 91, rhsData[2] );
+            break;
+        }
+
+        case 14:
+        {
+            // list3 ::= elem3
+#line 0 "bench/work/lists_100.lem"
+#line 390 "bench/work/lists_100.cpp"
+            callDtor( 91, rhsData[0] );
+            break;
+        }
+
+        case 15:
+        {
+            // elem3 ::= ATOM3
+#line 0 "bench/work/lists_100.lem"
+#line 399 "bench/work/lists_100.cpp"
+            callDtor( 18, rhsData[0] );
+            break;
+        }
+
+        case 16:
+        {
+            // elem3 ::= LP3 list4 RP3
+#line 0 "bench/work/lists_100.lem"
+#line 408 "bench/work/lists_100.cpp"
+            callDtor( 43, rhsData[0] );
+            callDtor( 117, rhsData[1] );
+            callDtor( 67, rhsData[2] );
+            break;
+        }
+
+        case 17:
+        {
+            // list4 ::= list4 COMMA elem4
+#line 0 "bench/work/lists_100.lem"
+#line 419 "bench/work/lists_100.cpp"
+            callDtor( 117, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 92, rhsData[2] );
+            break;
+        }
+
+        case 18:
+        {
+            // list4 ::= elem4
+#line 0 "bench/work/lists_100.lem"
+#line 430 "bench/work/lists_100.cpp"
+            callDtor( 92, rhsData[0] );
+            break;
+        }
+
+        case 19:
+        {
+            // elem4 ::= ATOM4
+#line 0 "bench/work/lists_100.lem"
+#line 439 "bench/work/lists_100.cpp"
+            callDtor( 19, rhsData[0] );
+            break;
+        }
+
+        case 20:
+        {
+            // elem4 ::= LP4 list5 RP4
+#line 0 "bench/work/lists_100.lem"
+#line 448 "bench/work/lists_100.cpp"
+            callDtor( 44, rhsData[0] );
+            callDtor( 118, rhsData[1] );
+            callDtor( 68, rhsData[2] );
+            break;
+        }
+
+        case 21:
+        {
+            // list5 ::= list5 COMMA elem5
+#line 0 "bench/work/lists_100.lem"
+#line 459 "bench/work/lists_100.cpp"
+            callDtor( 118, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 93, rhsData[2] );
+            break;
+        }
+
+        case 22:
+        {
+            // list5 ::= elem5
+#line 0 "bench/work/lists_100.lem"
+#line 470 "bench/work/lists_100.cpp"
+            callDtor( 93, rhsData[0] );
+            break;
+        }
+
+        case 23:
+        {
+            // elem5 ::= ATOM5
+#line 0 "bench/work/lists_100.lem"
+#line 479 "bench/work/lists_100.cpp"
+            callDtor( 20, rhsData[0] );
+            break;
+        }
+
+        case 24:
+        {
+            // elem5 ::= LP5 list6 RP5
+#line 0 "bench/work/lists_100.lem"
+#line 488 "bench/work/lists_100.cpp"
+            callDtor( 45, rhsData[0] );
+            callDtor( 119, rhsData[1] );
+            callDtor( 69, rhsData[2] );
+            break;
+        }
+
+        case 25:
+        {
+            // list6 ::= list6 COMMA elem6
+#line 0 "bench/work/lists_100.lem"
+#line 499 "bench/work/lists_100.cpp"
+            callDtor( 119, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 94, rhsData[2] );
+            break;
+        }
+
+        case 26:
+        {
+            // list6 ::= elem6
+#line 0 "bench/work/lists_100.lem"
+#line 510 "bench/work/lists_100.cpp"
+            callDtor( 94, rhsData[0] );
+            break;
+        }
+
+        case 27:
+        {
+            // elem6 ::= ATOM6
+#line 0 "bench/work/lists_100.lem"
+#line 519 "bench/work/lists_100.cpp"
+            callDtor( 21, rhsData[0] );
+            break;
+        }
+
+        case 28:
+        {
+            // elem6 ::= LP6 list7 RP6
+#line 0 "bench/work/lists_100.lem"
+#line 528 "bench/work/lists_100.cpp"
+            callDtor( 46, rhsData[0] );
+            callDtor( 120, rhsData[1] );
+            callDtor( 70, rhsData[2] );
+            break;
+        }
+
+        case 29:
+        {
+            // list7 ::= list7 COMMA elem7
+#line 0 "bench/work/lists_100.lem"
+#line 539 "bench/work/lists_100.cpp"
+            callDtor( 120, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 95, rhsData[2] );
+            break;
+        }
+
+        case 30:
+        {
+            // list7 ::= elem7
+#line 0 "bench/work/lists_100.lem"
+#line 550 "bench/work/lists_100.cpp"
+            callDtor( 95, rhsData[0] );
+            break;
+        }
+
+        case 31:
+        {
+            // elem7 ::= ATOM7
+#line 0 "bench/work/lists_100.lem"
+#line 559 "bench/work/lists_100.cpp"
+            callDtor( 22, rhsData[0] );
+            break;
+        }
+
+        case 32:
+        {
+            // elem7 ::= LP7 list8 RP7
+#line 0 "bench/work/lists_100.lem"
+#line 568 "bench/work/lists_100.cpp"
+            callDtor( 47, rhsData[0] );
+            callDtor( 121, rhsData[1] );
+            callDtor( 71, rhsData[2] );
+            break;
+        }
+
+        case 33:
+        {
+            // list8 ::= list8 COMMA elem8
+#line 0 "bench/work/lists_100.lem"
+#line 579 "bench/work/lists_100.cpp"
+            callDtor( 121, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 96, rhsData[2] );
+            break;
+        }
+
+        case 34:
+        {
+            // list8 ::= elem8
+#line 0 "bench/work/lists_100.lem"
+#line 590 "bench/work/lists_100.cpp"
+            callDtor( 96, rhsData[0] );
+            break;
+        }
+
+        case 35:
+        {
+            // elem8 ::= ATOM8
+#line 0 "bench/work/lists_100.lem"
+#line 599 "bench/work/lists_100.cpp"
+            callDtor( 23, rhsData[0] );
+            break;
+        }
+
+        case 36:
+        {
+            // elem8 ::= LP8 list9 RP8
+#line 0 "bench/work/lists_100.lem"
+#line 608 "bench/work/lists_100.cpp"
+            callDtor( 48, rhsData[0] );
+            callDtor( 122, rhsData[1] );
+            callDtor( 72, rhsData[2] );
+            break;
+        }
+
+        case 37:
+        {
+            // list9 ::= list9 COMMA elem9
+#line 0 "bench/work/lists_100.lem"
+#line 619 "bench/work/lists_100.cpp"
+            callDtor( 122, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 97, rhsData[2] );
+            break;
+        }
+
+        case 38:
+        {
+            // list9 ::= elem9
+#line 0 "bench/work/lists_100.lem"
+#line 630 "bench/work/lists_100.cpp"
+            callDtor( 97, rhsData[0] );
+            break;
+        }
+
+        case 39:
+        {
+            // elem9 ::= ATOM9
+#line 0 "bench/work/lists_100.lem"
+#line 639 "bench/work/lists_100.cpp"
+            callDtor( 24, rhsData[0] );
+            break;
+        }
+
+        case 40:
+        {
+            // elem9 ::= LP9 list10 RP9
+#line 0 "bench/work/lists_100.lem"
+#line 648 "bench/work/lists_100.cpp"
+            callDtor( 49, rhsData[0] );
+            callDtor( 101, rhsData[1] );
+            callDtor( 73, rhsData[2] );
+            break;
+        }
+
+        case 41:
+        {
+            // list10 ::= list10 COMMA elem10
+#line 0 "bench/work/lists_100.lem"
+#line 659 "bench/work/lists_100.cpp"
+            callDtor( 101, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 76, rhsData[2] );
+            break;
+        }
+
+        case 42:
+        {
+            // list10 ::= elem10
+#line 0 "bench/work/lists_100.lem"
+#line 670 "bench/work/lists_100.cpp"
+            callDtor( 76, rhsData[0] );
+            break;
+        }
+
+        case 43:
+        {
+            // elem10 ::= ATOM10
+#line 0 "bench/work/lists_100.lem"
+#line 679 "bench/work/lists_100.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 44:
+        {
+            // elem10 ::= LP10 list11 RP10
+#line 0 "bench/work/lists_100.lem"
+#line 688 "bench/work/lists_100.cpp"
+            callDtor( 28, rhsData[0] );
+            callDtor( 102, rhsData[1] );
+            callDtor( 52, rhsData[2] );
+            break;
+        }
+
+        case 45:
+        {
+            // list11 ::= list11 COMMA elem11
+#line 0 "bench/work/lists_100.lem"
+#line 699 "bench/work/lists_100.cpp"
+            callDtor( 102, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 77, rhsData[2] );
+            break;
+        }
+
+        case 46:
+        {
+            // list11 ::= elem11
+#line 0 "bench/work/lists_100.lem"
+#line 710 "bench/work/lists_100.cpp"
+            callDtor( 77, rhsData[0] );
+            break;
+        }
+
+        case 47:
+        {
+            // elem11 ::= ATOM11
+#line 0 "bench/work/lists_100.lem"
+#line 719 "bench/work/lists_100.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 48:
+        {
+            // elem11 ::= LP11 list12 RP11
+#line 0 "bench/work/lists_100.lem"
+#line 728 "bench/work/lists_100.cpp"
+            callDtor( 29, rhsData[0] );
+            callDtor( 103, rhsData[1] );
+            callDtor( 53, rhsData[2] );
+            break;
+        }
+
+        case 49:
+        {
+            // list12 ::= list12 COMMA elem12
+#line 0 "bench/work/lists_100.lem"
+#line 739 "bench/work/lists_100.cpp"
+            callDtor( 103, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 78, rhsData[2] );
+            break;
+        }
+
+        case 50:
+        {
+            // list12 ::= elem12
+#line 0 "bench/work/lists_100.lem"
+#line 750 "bench/work/lists_100.cpp"
+            callDtor( 78, rhsData[0] );
+            break;
+        }
+
+        case 51:
+        {
+            // elem12 ::= ATOM12
+#line 0 "bench/work/lists_100.lem"
+#line 759 "bench/work/lists_100.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 52:
+        {
+            // elem12 ::= LP12 list13 RP12
+#line 0 "bench/work/lists_100.lem"
+#line 768 "bench/work/lists_100.cpp"
+            callDtor( 30, rhsData[0] );
+            callDtor( 104, rhsData[1] );
+            callDtor( 54, rhsData[2] );
+            break;
+        }
+
+        case 53:
+        {
+            // list13 ::= list13 COMMA elem13
+#line 0 "bench/work/lists_100.lem"
+#line 779 "bench/work/lists_100.cpp"
+            callDtor( 104, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 79, rhsData[2] );
+            break;
+        }
+
+        case 54:
+        {
+            // list13 ::= elem13
+#line 0 "bench/work/lists_100.lem"
+#line 790 "bench/work/lists_100.cpp"
+            callDtor( 79, rhsData[0] );
+            break;
+        }
+
+        case 55:
+        {
+            // elem13 ::= ATOM13
+#line 0 "bench/work/lists_100.lem"
+#line 799 "bench/work/lists_100.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 56:
+        {
+            // elem13 ::= LP13 list14 RP13
+#line 0 "bench/work/lists_100.lem"
+#line 808 "bench/work/lists_100.cpp"
+            callDtor( 31, rhsData[0] );
+            callDtor( 105, rhsData[1] );
+            callDtor( 55, rhsData[2] );
+            break;
+        }
+
+        case 57:
+        {
+            // list14 ::= list14 COMMA elem14
+#line 0 "bench/work/lists_100.lem"
+#line 819 "bench/work/lists_100.cpp"
+            callDtor( 105, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 80, rhsData[2] );
+            break;
+        }
+
+        case 58:
+        {
+            // list14 ::= elem14
+#line 0 "bench/work/lists_100.lem"
+#line 830 "bench/work/lists_100.cpp"
+            callDtor( 80, rhsData[0] );
+            break;
+        }
+
+        case 59:
+        {
+            // elem14 ::= ATOM14
+#line 0 "bench/work/lists_100.lem"
+#line 839 "bench/work/lists_100.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 60:
+        {
+            // elem14 ::= LP14 list15 RP14
+#line 0 "bench/work/lists_100.lem"
+#line 848 "bench/work/lists_100.cpp"
+            callDtor( 32, rhsData[0] );
+            callDtor( 106, rhsData[1] );
+            callDtor( 56, rhsData[2] );
+            break;
+        }
+
+        case 61:
+        {
+            // list15 ::= list15 COMMA elem15
+#line 0 "bench/work/lists_100.lem"
+#line 859 "bench/work/lists_100.cpp"
+            callDtor( 106, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 81, rhsData[2] );
+            break;
+        }
+
+        case 62:
+        {
+            // list15 ::= elem15
+#line 0 "bench/work/lists_100.lem"
+#line 870 "bench/work/lists_100.cpp"
+            callDtor( 81, rhsData[0] );
+            break;
+        }
+
+        case 63:
+        {
+            // elem15 ::= ATOM15
+#line 0 "bench/work/lists_100.lem"
+#line 879 "bench/work/lists_100.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 64:
+        {
+            // elem15 ::= LP15 list16 RP15
+#line 0 "bench/work/lists_100.lem"
+#line 888 "bench/work/lists_100.cpp"
+            callDtor( 33, rhsData[0] );
+            callDtor( 107, rhsData[1] );
+            callDtor( 57, rhsData[2] );
+            break;
+        }
+
+        case 65:
+        {
+            // list16 ::= list16 COMMA elem16
+#line 0 "bench/work/lists_100.lem"
+#line 899 "bench/work/lists_100.cpp"
+            callDtor( 107, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 82, rhsData[2] );
+            break;
+        }
+
+        case 66:
+        {
+            // list16 ::= elem16
+#line 0 "bench/work/lists_100.lem"
+#line 910 "bench/work/lists_100.cpp"
+            callDtor( 82, rhsData[0] );
+            break;
+        }
+
+        case 67:
+        {
+            // elem16 ::= ATOM16
+#line 0 "bench/work/lists_100.lem"
+#line 919 "bench/work/lists_100.cpp"
+            callDtor( 9, rhsData[0] );
+            break;
+        }
+
+        case 68:
+        {
+            // elem16 ::= LP16 list17 RP16
+#line 0 "bench/work/lists_100.lem"
+#line 928 "bench/work/lists_100.cpp"
+            callDtor( 34, rhsData[0] );
+            callDtor( 108, rhsData[1] );
+            callDtor( 58, rhsData[2] );
+            break;
+        }
+
+        case 69:
+        {
+            // list17 ::= list17 COMMA elem17
+#line 0 "bench/work/lists_100.lem"
+#line 939 "bench/work/lists_100.cpp"
+            callDtor( 108, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 83, rhsData[2] );
+            break;
+        }
+
+        case 70:
+        {
+            // list17 ::= elem17
+#line 0 "bench/work/lists_100.lem"
+#line 950 "bench/work/lists_100.cpp"
+            callDtor( 83, rhsData[0] );
+            break;
+        }
+
+        case 71:
+        {
+            // elem17 ::= ATOM17
+#line 0 "bench/work/lists_100.lem"
+#line 959 "bench/work/lists_100.cpp"
+            callDtor( 10, rhsData[0] );
+            break;
+        }
+
+        case 72:
+        {
+            // elem17 ::= LP17 list18 RP17
+#line 0 "bench/work/lists_100.lem"
+#line 968 "bench/work/lists_100.cpp"
+            callDtor( 35, rhsData[0] );
+            callDtor( 109, rhsData[1] );
+            callDtor( 59, rhsData[2] );
+            break;
+        }
+
+        case 73:
+        {
+            // list18 ::= list18 COMMA elem18
+#line 0 "bench/work/lists_100.lem"
+#line 979 "bench/work/lists_100.cpp"
+            callDtor( 109, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 84, rhsData[2] );
+            break;
+        }
+
+        case 74:
+        {
+            // list18 ::= elem18
+#line 0 "bench/work/lists_100.lem"
+#line 990 "bench/work/lists_100.cpp"
+            callDtor( 84, rhsData[0] );
+            break;
+        }
+
+        case 75:
+        {
+            // elem18 ::= ATOM18
+#line 0 "bench/work/lists_100.lem"
+#line 999 "bench/work/lists_100.cpp"
+            callDtor( 11, rhsData[0] );
+            break;
+        }
+
+        case 76:
+        {
+            // elem18 ::= LP18 list19 RP18
+#line 0 "bench/work/lists_100.lem"
+#line 1008 "bench/work/lists_100.cpp"
+            callDtor( 36, rhsData[0] );
+            callDtor( 110, rhsData[1] );
+            callDtor( 60, rhsData[2] );
+            break;
+        }
+
+        case 77:
+        {
+            // list19 ::= list19 COMMA elem19
+#line 0 "bench/work/lists_100.lem"
+#line 1019 "bench/work/lists_100.cpp"
+            callDtor( 110, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 85, rhsData[2] );
+            break;
+        }
+
+        case 78:
+        {
+            // list19 ::= elem19
+#line 0 "bench/work/lists_100.lem"
+#line 1030 "bench/work/lists_100.cpp"
+            callDtor( 85, rhsData[0] );
+            break;
+        }
+
+        case 79:
+        {
+            // elem19 ::= ATOM19
+#line 0 "bench/work/lists_100.lem"
+#line 1039 "bench/work/lists_100.cpp"
+            callDtor( 12, rhsData[0] );
+            break;
+        }
+
+        case 80:
+        {
+            // elem19 ::= LP19 list20 RP19
+#line 0 "bench/work/lists_100.lem"
+#line 1048 "bench/work/lists_100.cpp"
+            callDtor( 37, rhsData[0] );
+            callDtor( 112, rhsData[1] );
+            callDtor( 61, rhsData[2] );
+            break;
+        }
+
+        case 81:
+        {
+            // list20 ::= list20 COMMA elem20
+#line 0 "bench/work/lists_100.lem"
+#line 1059 "bench/work/lists_100.cpp"
+            callDtor( 112, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 87, rhsData[2] );
+            break;
+        }
+
+        case 82:
+        {
+            // list20 ::= elem20
+#line 0 "bench/work/lists_100.lem"
+#line 1070 "bench/work/lists_100.cpp"
+            callDtor( 87, rhsData[0] );
+            break;
+        }
+
+        case 83:
+        {
+            // elem20 ::= ATOM20
+#line 0 "bench/work/lists_100.lem"
+#line 1079 "bench/work/lists_100.cpp"
+            callDtor( 14, rhsData[0] );
+            break;
+        }
+
+        case 84:
+        {
+            // elem20 ::= LP20 list21 RP20
+#line 0 "bench/work/lists_100.lem"
+#line 1088 "bench/work/lists_100.cpp"
+            callDtor( 39, rhsData[0] );
+            callDtor( 113, rhsData[1] );
+            callDtor( 63, rhsData[2] );
+            break;
+        }
+
+        case 85:
+        {
+            // list21 ::= list21 COMMA elem21
+#line 0 "bench/work/lists_100.lem"
+#line 1099 "bench/work/lists_100.cpp"
+            callDtor( 113, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 88, rhsData[2] );
+            break;
+        }
+
+        case 86:
+        {
+            // list21 ::= elem21
+#line 0 "bench/work/lists_100.lem"
+#line 1110 "bench/work/lists_100.cpp"
+            callDtor( 88, rhsData[0] );
+            break;
+        }
+
+        case 87:
+        {
+            // elem21 ::= ATOM21
+#line 0 "bench/work/lists_100.lem"
+#line 1119 "bench/work/lists_100.cpp"
+            callDtor( 15, rhsData[0] );
+            break;
+        }
+
+        case 88:
+        {
+            // elem21 ::= LP21 list22 RP21
+#line 0 "bench/work/lists_100.lem"
+#line 1128 "bench/work/lists_100.cpp"
+            callDtor( 40, rhsData[0] );
+            callDtor( 114, rhsData[1] );
+            callDtor( 64, rhsData[2] );
+            break;
+        }
+
+        case 89:
+        {
+            // list22 ::= list22 COMMA elem22
+#line 0 "bench/work/lists_100.lem"
+#line 1139 "bench/work/lists_100.cpp"
+            callDtor( 114, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 89, rhsData[2] );
+            break;
+        }
+
+        case 90:
+        {
+            // list22 ::= elem22
+#line 0 "bench/work/lists_100.lem"
+#line 1150 "bench/work/lists_100.cpp"
+            callDtor( 89, rhsData[0] );
+            break;
+        }
+
+        case 91:
+        {
+            // elem22 ::= ATOM22
+#line 0 "bench/work/lists_100.lem"
+#line 1159 "bench/work/lists_100.cpp"
+            callDtor( 16, rhsData[0] );
+            break;
+        }
+
+        case 92:
+        {
+            // elem22 ::= LP22 list23 RP22
+#line 0 "bench/work/lists_100.lem"
+#line 1168 "bench/work/lists_100.cpp"
+            callDtor( 41, rhsData[0] );
+            callDtor( 115, rhsData[1] );
+            callDtor( 65, rhsData[2] );
+            break;
+        }
+
+        case 93:
+        {
+            // list23 ::= list23 COMMA elem23
+#line 0 "bench/work/lists_100.lem"
+#line 1179 "bench/work/lists_100.cpp"
+            callDtor( 115, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            callDtor( 90, rhsData[2] );
+            break;
+        }
+
+        case 94:
+        {
+            // list23 ::= elem23
+#line 0 "bench/work/lists_100.lem"
+#line 1190 "bench/work/lists_100.cpp"
+            callDtor( 90, rhsData[0] );
+            break;
+        }
+
+        case 95:
+        {
+            // elem23 ::= ATOM23
+#line 0 "bench/work/lists_100.lem"
+#line 1199 "bench/work/lists_100.cpp"
+            callDtor( 17, rhsData[0] );
+            break;
+        }
+
+        case 96:
+        {
+            // elem23 ::= LP23 RP23
+#line 0 "bench/work/lists_100.lem"
+#line 1208 "bench/work/lists_100.cpp"
+            callDtor( 42, rhsData[0] );
+            callDtor( 66, rhsData[1] );
+            break;
+        }
+
+        default:
+            throw "Unknown Rule Number";
+            break;
+    }
+
+    if ( PA_SHIFT == next )
+        shift( newVal, myRules[ruleNum].first, data );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::callDtor( int symIdx, privBenchImpl::Value &data )
+{
+    switch ( symIdx )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+        case 12:
+        case 13:
+        case 14:
+        case 15:
+        case 16:
+        case 17:
+        case 18:
+        case 19:
+        case 20:
+        case 21:
+        case 22:
+        case 23:
+        case 24:
+        case 25:
+        case 26:
+        case 27:
+        case 28:
+        case 29:
+        case 30:
+        case 31:
+        case 32:
+        case 33:
+        case 34:
+        case 35:
+        case 36:
+        case 37:
+        case 38:
+        case 39:
+        case 40:
+        case 41:
+        case 42:
+        case 43:
+        case 44:
+        case 45:
+        case 46:
+        case 47:
+        case 48:
+        case 49:
+        case 50:
+        case 51:
+        case 52:
+        case 53:
+        case 54:
+        case 55:
+        case 56:
+        case 57:
+        case 58:
+        case 59:
+        case 60:
+        case 61:
+        case 62:
+        case 63:
+        case 64:
+        case 65:
+        case 66:
+        case 67:
+        case 68:
+        case 69:
+        case 70:
+        case 71:
+        case 72:
+        case 73:
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::popStack( void )
+{
+    callDtor( myStack.top().first.second, myStack.top().second );
+    myStack.pop();
+}
+
+
+////////////////////////////////////////
+
+
+ParserAct privBenchImpl::findParserAction( int &newVal, int tok )
+{
+    int stateNum;
+    ParserAct retval = PA_NOP;
+    bool found = false;
+
+    stateNum = myStack.empty() ? 0 : myStack.top().first.first;
+    ActionMap::iterator i = myStates[stateNum].find( tok );
+    if ( tok >= 0 && tok <= 124 )
+    {
+        if ( i != myStates[stateNum].end() )
+        {
+            retval = (*i).second.first;
+            newVal = (*i).second.second;
+            found = true;
+        }
+    }
+    else if ( ! myStates[stateNum].empty() )
+    {
+        retval = PA_NOP;
+        newVal = 0;
+        found = true;
+    }
+
+    if ( ! found )
+    {
+        retval = myStateDefaultActions[stateNum].first;
+        newVal = myStateDefaultActions[stateNum].second;
+    }
+    return retval;
+}
+
+
+////////////////////////////////////////
+
+
+static int theStateTable[410][4] =
+{
+    // State 0
+    { 0, 1, PA_SHIFT, 4 },
+    // State 0
+    { 0, 26, PA_SHIFT, 5 },
+    // State 0
+    { 0, 74, PA_SHIFT, 168 },
+    // State 0
+    { 0, 99, PA_SHIFT, 1 },
+    // State 0
+    { 0, 123, PA_ACCEPT, 0 },
+    // State 1
+    { 1, 0, PA_REDUCE, 0 },
+    // State 1
+    { 1, 25, PA_SHIFT, 2 },
+    // State 2
+    { 2, 1, PA_SHIFT, 4 },
+    // State 2
+    { 2, 26, PA_SHIFT, 5 },
+    // State 2
+    { 2, 74, PA_SHIFT, 3 },
+    // State 3
+    { 3, 124, PA_REDUCE, 1 },
+    // State 3 default action
+    { 3, -1, PA_REDUCE, 1 },
+    // State 4
+    { 4, 124, PA_REDUCE, 3 },
+    // State 4 default action
+    { 4, -1, PA_REDUCE, 3 },
+    // State 5
+    { 5, 2, PA_SHIFT, 10 },
+    // State 5
+    { 5, 27, PA_SHIFT, 11 },
+    // State 5
+    { 5, 75, PA_SHIFT, 167 },
+    // State 5
+    { 5, 100, PA_SHIFT, 6 },
+    // State 6
+    { 6, 25, PA_SHIFT, 8 },
+    // State 6
+    { 6, 50, PA_SHIFT, 7 },
+    // State 7
+    { 7, 124, PA_REDUCE, 4 },
+    // State 7 default action
+    { 7, -1, PA_REDUCE, 4 },
+    // State 8
+    { 8, 2, PA_SHIFT, 10 },
+    // State 8
+    { 8, 27, PA_SHIFT, 11 },
+    // State 8
+    { 8, 75, PA_SHIFT, 9 },
+    // State 9
+    { 9, 124, PA_REDUCE, 5 },
+    // State 9 default action
+    { 9, -1, PA_REDUCE, 5 },
+    // State 10
+    { 10, 124, PA_REDUCE, 7 },
+    // State 10 default action
+    { 10, -1, PA_REDUCE, 7 },
+    // State 11
+    { 11, 13, PA_SHIFT, 16 },
+    // State 11
+    { 11, 38, PA_SHIFT, 17 },
+    // State 11
+    { 11, 86, PA_SHIFT, 166 },
+    // State 11
+    { 11, 111, PA_SHIFT, 12 },
+    // State 12
+    { 12, 25, PA_SHIFT, 14 },
+    // State 12
+    { 12, 51, PA_SHIFT, 13 },
+    // State 13
+    { 13, 124, PA_REDUCE, 8 },
+    // State 13 default action
+    { 13, -1, PA_REDUCE, 8 },
+    // State 14
+    { 14, 13, PA_SHIFT, 16 },
+    // State 14
+    { 14, 38, PA_SHIFT, 17 },
+    // State 14
+    { 14, 86, PA_SHIFT, 15 },
+    // State 15
+    { 15, 124, PA_REDUCE, 9 },
+    // State 15 default action
+    { 15, -1, PA_REDUCE, 9 },
+    // State 16
+    { 16, 124, PA_REDUCE, 11 },
+    // State 16 default action
+    { 16, -1, PA_REDUCE, 11 },
+    // State 17
+    { 17, 18, PA_SHIFT, 22 },
+    // State 17
+    { 17, 43, PA_SHIFT, 23 },
+    // State 17
+    { 17, 91, PA_SHIFT, 165 },
+    // State 17
+    { 17, 116, PA_SHIFT, 18 },
+    // State 18
+    { 18, 25, PA_SHIFT, 20 },
+    // State 18
+    { 18, 62, PA_SHIFT, 19 },
+    // State 19
+    { 19, 124, PA_REDUCE, 12 },
+    // State 19 default action
+    { 19, -1, PA_REDUCE, 12 },
+    // State 20
+    { 20, 18, PA_SHIFT, 22 },
+    // State 20
+    { 20, 43, PA_SHIFT, 23 },
+    // State 20
+    { 20, 91, PA_SHIFT, 21 },
+    // State 21
+    { 21, 124, PA_REDUCE, 13 },
+    // State 21 default action
+    { 21, -1, PA_REDUCE, 13 },
+    // State 22
+    { 22, 124, PA_REDUCE, 15 },
+    // State 22 default action
+    { 22, -1, PA_REDUCE, 15 },
+    // State 23
+    { 23, 19, PA_SHIFT, 28 },
+    // State 23
+    { 23, 44, PA_SHIFT, 29 },
+    // State 23
+    { 23, 92, PA_SHIFT, 164 },
+    // State 23
+    { 23, 117, PA_SHIFT, 24 },
+    // State 24
+    { 24, 25, PA_SHIFT, 26 },
+    // State 24
+    { 24, 67, PA_SHIFT, 25 },
+    // State 25
+    { 25, 124, PA_REDUCE, 16 },
+    // State 25 default action
+    { 25, -1, PA_REDUCE, 16 },
+    // State 26
+    { 26, 19, PA_SHIFT, 28 },
+    // State 26
+    { 26, 44, PA_SHIFT, 29 },
+    // State 26
+    { 26, 92, PA_SHIFT, 27 },
+    // State 27
+    { 27, 124, PA_REDUCE, 17 },
+    // State 27 default action
+    { 27, -1, PA_REDUCE, 17 },
+    // State 28
+    { 28, 124, PA_REDUCE, 19 },
+    // State 28 default action
+    { 28, -1, PA_REDUCE, 19 },
+    // State 29
+    { 29, 20, PA_SHIFT, 34 },
+    // State 29
+    { 29, 45, PA_SHIFT, 35 },
+    // State 29
+    { 29, 93, PA_SHIFT, 163 },
+    // State 29
+    { 29, 118, PA_SHIFT, 30 },
+    // State 30
+    { 30, 25, PA_SHIFT, 32 },
+    // State 30
+    { 30, 68, PA_SHIFT, 31 },
+    // State 31
+    { 31, 124, PA_REDUCE, 20 },
+    // State 31 default action
+    { 31, -1, PA_REDUCE, 20 },
+    // State 32
+    { 32, 20, PA_SHIFT, 34 },
+    // State 32
+    { 32, 45, PA_SHIFT, 35 },
+    // State 32
+    { 32, 93, PA_SHIFT, 33 },
+    // State 33
+    { 33, 124, PA_REDUCE, 21 },
+    // State 33 default action
+    { 33, -1, PA_REDUCE, 21 },
+    // State 34
+    { 34, 124, PA_REDUCE, 23 },
+    // State 34 default action
+    { 34, -1, PA_REDUCE, 23 },
+    // State 35
+    { 35, 21, PA_SHIFT, 40 },
+    // State 35
+    { 35, 46, PA_SHIFT, 41 },
+    // State 35
+    { 35, 94, PA_SHIFT, 162 },
+    // State 35
+    { 35, 119, PA_SHIFT, 36 },
+    // State 36
+    { 36, 25, PA_SHIFT, 38 },
+    // State 36
+    { 36, 69, PA_SHIFT, 37 },
+    // State 37
+    { 37, 124, PA_REDUCE, 24 },
+    // State 37 default action
+    { 37, -1, PA_REDUCE, 24 },
+    // State 38
+    { 38, 21, PA_SHIFT, 40 },
+    // State 38
+    { 38, 46, PA_SHIFT, 41 },
+    // State 38
+    { 38, 94, PA_SHIFT, 39 },
+    // State 39
+    { 39, 124, PA_REDUCE, 25 },
+    // State 39 default action
+    { 39, -1, PA_REDUCE, 25 },
+    // State 40
+    { 40, 124, PA_REDUCE, 27 },
+    // State 40 default action
+    { 40, -1, PA_REDUCE, 27 },
+    // State 41
+    { 41, 22, PA_SHIFT, 46 },
+    // State 41
+    { 41, 47, PA_SHIFT, 47 },
+    // State 41
+    { 41, 95, PA_SHIFT, 161 },
+    // State 41
+    { 41, 120, PA_SHIFT, 42 },
+    // State 42
+    { 42, 25, PA_SHIFT, 44 },
+    // State 42
+    { 42, 70, PA_SHIFT, 43 },
+    // State 43
+    { 43, 124, PA_REDUCE, 28 },
+    // State 43 default action
+    { 43, -1, PA_REDUCE, 28 },
+    // State 44
+    { 44, 22, PA_SHIFT, 46 },
+    // State 44
+    { 44, 47, PA_SHIFT, 47 },
+    // State 44
+    { 44, 95, PA_SHIFT, 45 },
+    // State 45
+    { 45, 124, PA_REDUCE, 29 },
+    // State 45 default action
+    { 45, -1, PA_REDUCE, 29 },
+    // State 46
+    { 46, 124, PA_REDUCE, 31 },
+    // State 46 default action
+    { 46, -1, PA_REDUCE, 31 },
+    // State 47
+    { 47, 23, PA_SHIFT, 52 },
+    // State 47
+    { 47, 48, PA_SHIFT, 53 },
+    // State 47
+    { 47, 96, PA_SHIFT, 160 },
+    // State 47
+    { 47, 121, PA_SHIFT, 48 },
+    // State 48
+    { 48, 25, PA_SHIFT, 50 },
+    // State 48
+    { 48, 71, PA_SHIFT, 49 },
+    // State 49
+    { 49, 124, PA_REDUCE, 32 },
+    // State 49 default action
+    { 49, -1, PA_REDUCE, 32 },
+    // State 50
+    { 50, 23, PA_SHIFT, 52 },
+    // State 50
+    { 50, 48, PA_SHIFT, 53 },
+    // State 50
+    { 50, 96, PA_SHIFT, 51 },
+    // State 51
+    { 51, 124, PA_REDUCE, 33 },
+    // State 51 default action
+    { 51, -1, PA_REDUCE, 33 },
+    // State 52
+    { 52, 124, PA_REDUCE, 35 },
+    // State 52 default action
+    { 52, -1, PA_REDUCE, 35 },
+    // State 53
+    { 53, 24, PA_SHIFT, 58 },
+    // State 53
+    { 53, 49, PA_SHIFT, 59 },
+    // State 53
+    { 53, 97, PA_SHIFT, 159 },
+    // State 53
+    { 53, 122, PA_SHIFT, 54 },
+    // State 54
+    { 54, 25, PA_SHIFT, 56 },
+    // State 54
+    { 54, 72, PA_SHIFT, 55 },
+    // State 55
+    { 55, 124, PA_REDUCE, 36 },
+    // State 55 default action
+    { 55, -1, PA_REDUCE, 36 },
+    // State 56
+    { 56, 24, PA_SHIFT, 58 },
+    // State 56
+    { 56, 49, PA_SHIFT, 59 },
+    // State 56
+    { 56, 97, PA_SHIFT, 57 },
+    // State 57
+    { 57, 124, PA_REDUCE, 37 },
+    // State 57 default action
+    { 57, -1, PA_REDUCE, 37 },
+    // State 58
+    { 58, 124, PA_REDUCE, 39 },
+    // State 58 default action
+    { 58, -1, PA_REDUCE, 39 },
+    // State 59
+    { 59, 3, PA_SHIFT, 64 },
+    // State 59
+    { 59, 28, PA_SHIFT, 65 },
+    // State 59
+    { 59, 76, PA_SHIFT, 158 },
+    // State 59
+    { 59, 101, PA_SHIFT, 60 },
+    // State 60
+    { 60, 25, PA_SHIFT, 62 },
+    // State 60
+    { 60, 73, PA_SHIFT, 61 },
+    // State 61
+    { 61, 124, PA_REDUCE, 40 },
+    // State 61 default action
+    { 61, -1, PA_REDUCE, 40 },
+    // State 62
+    { 62, 3, PA_SHIFT, 64 },
+    // State 62
+    { 62, 28, PA_SHIFT, 65 },
+    // State 62
+    { 62, 76, PA_SHIFT, 63 },
+    // State 63
+    { 63, 124, PA_REDUCE, 41 },
+    // State 63 default action
+    { 63, -1, PA_REDUCE, 41 },
+    // State 64
+    { 64, 124, PA_REDUCE, 43 },
+    // State 64 default action
+    { 64, -1, PA_REDUCE, 43 },
+    // State 65
+    { 65, 4, PA_SHIFT, 70 },
+    // State 65
+    { 65, 29, PA_SHIFT, 71 },
+    // State 65
+    { 65, 77, PA_SHIFT, 157 },
+    // State 65
+    { 65, 102, PA_SHIFT, 66 },
+    // State 66
+    { 66, 25, PA_SHIFT, 68 },
+    // State 66
+    { 66, 52, PA_SHIFT, 67 },
+    // State 67
+    { 67, 124, PA_REDUCE, 44 },
+    // State 67 default action
+    { 67, -1, PA_REDUCE, 44 },
+    // State 68
+    { 68, 4, PA_SHIFT, 70 },
+    // State 68
+    { 68, 29, PA_SHIFT, 71 },
+    // State 68
+    { 68, 77, PA_SHIFT, 69 },
+    // State 69
+    { 69, 124, PA_REDUCE, 45 },
+    // State 69 default action
+    { 69, -1, PA_REDUCE, 45 },
+    // State 70
+    { 70, 124, PA_REDUCE, 47 },
+    // State 70 default action
+    { 70, -1, PA_REDUCE, 47 },
+    // State 71
+    { 71, 5, PA_SHIFT, 76 },
+    // State 71
+    { 71, 30, PA_SHIFT, 77 },
+    // State 71
+    { 71, 78, PA_SHIFT, 156 },
+    // State 71
+    { 71, 103, PA_SHIFT, 72 },
+    // State 72
+    { 72, 25, PA_SHIFT, 74 },
+    // State 72
+    { 72, 53, PA_SHIFT, 73 },
+    // State 73
+    { 73, 124, PA_REDUCE, 48 },
+    // State 73 default action
+    { 73, -1, PA_REDUCE, 48 },
+    // State 74
+    { 74, 5, PA_SHIFT, 76 },
+    // State 74
+    { 74, 30, PA_SHIFT, 77 },
+    // State 74
+    { 74, 78, PA_SHIFT, 75 },
+    // State 75
+    { 75, 124, PA_REDUCE, 49 },
+    // State 75 default action
+    { 75, -1, PA_REDUCE, 49 },
+    // State 76
+    { 76, 124, PA_REDUCE, 51 },
+    // State 76 default action
+    { 76, -1, PA_REDUCE, 51 },
+    // State 77
+    { 77, 6, PA_SHIFT, 82 },
+    // State 77
+    { 77, 31, PA_SHIFT, 83 },
+    // State 77
+    { 77, 79, PA_SHIFT, 155 },
+    // State 77
+    { 77, 104, PA_SHIFT, 78 },
+    // State 78
+    { 78, 25, PA_SHIFT, 80 },
+    // State 78
+    { 78, 54, PA_SHIFT, 79 },
+    // State 79
+    { 79, 124, PA_REDUCE, 52 },
+    // State 79 default action
+    { 79, -1, PA_REDUCE, 52 },
+    // State 80
+    { 80, 6, PA_SHIFT, 82 },
+    // State 80
+    { 80, 31, PA_SHIFT, 83 },
+    // State 80
+    { 80, 79, PA_SHIFT, 81 },
+    // State 81
+    { 81, 124, PA_REDUCE, 53 },
+    // State 81 default action
+    { 81, -1, PA_REDUCE, 53 },
+    // State 82
+    { 82, 124, PA_REDUCE, 55 },
+    // State 82 default action
+    { 82, -1, PA_REDUCE, 55 },
+    // State 83
+    { 83, 7, PA_SHIFT, 88 },
+    // State 83
+    { 83, 32, PA_SHIFT, 89 },
+    // State 83
+    { 83, 80, PA_SHIFT, 154 },
+    // State 83
+    { 83, 105, PA_SHIFT, 84 },
+    // State 84
+    { 84, 25, PA_SHIFT, 86 },
+    // State 84
+    { 84, 55, PA_SHIFT, 85 },
+    // State 85
+    { 85, 124, PA_REDUCE, 56 },
+    // State 85 default action
+    { 85, -1, PA_REDUCE, 56 },
+    // State 86
+    { 86, 7, PA_SHIFT, 88 },
+    // State 86
+    { 86, 32, PA_SHIFT, 89 },
+    // State 86
+    { 86, 80, PA_SHIFT, 87 },
+    // State 87
+    { 87, 124, PA_REDUCE, 57 },
+    // State 87 default action
+    { 87, -1, PA_REDUCE, 57 },
+    // State 88
+    { 88, 124, PA_REDUCE, 59 },
+    // State 88 default action
+    { 88, -1, PA_REDUCE, 59 },
+    // State 89
+    { 89, 8, PA_SHIFT, 94 },
+    // State 89
+    { 89, 33, PA_SHIFT, 95 },
+    // State 89
+    { 89, 81, PA_SHIFT, 153 },
+    // State 89
+    { 89, 106, PA_SHIFT, 90 },
+    // State 90
+    { 90, 25, PA_SHIFT, 92 },
+    // State 90
+    { 90, 56, PA_SHIFT, 91 },
+    // State 91
+    { 91, 124, PA_REDUCE, 60 },
+    // State 91 default action
+    { 91, -1, PA_REDUCE, 60 },
+    // State 92
+    { 92, 8, PA_SHIFT, 94 },
+    // State 92
+    { 92, 33, PA_SHIFT, 95 },
+    // State 92
+    { 92, 81, PA_SHIFT, 93 },
+    // State 93
+    { 93, 124, PA_REDUCE, 61 },
+    // State 93 default action
+    { 93, -1, PA_REDUCE, 61 },
+    // State 94
+    { 94, 124, PA_REDUCE, 63 },
+    // State 94 default action
+    { 94, -1, PA_REDUCE, 63 },
+    // State 95
+    { 95, 9, PA_SHIFT, 100 },
+    // State 95
+    { 95, 34, PA_SHIFT, 101 },
+    // State 95
+    { 95, 82, PA_SHIFT, 152 },
+    // State 95
+    { 95, 107, PA_SHIFT, 96 },
+    // State 96
+    { 96, 25, PA_SHIFT, 98 },
+    // State 96
+    { 96, 57, PA_SHIFT, 97 },
+    // State 97
+    { 97, 124, PA_REDUCE, 64 },
+    // State 97 default action
+    { 97, -1, PA_REDUCE, 64 },
+    // State 98
+    { 98, 9, PA_SHIFT, 100 },
+    // State 98
+    { 98, 34, PA_SHIFT, 101 },
+    // State 98
+    { 98, 82, PA_SHIFT, 99 },
+    // State 99
+    { 99, 124, PA_REDUCE, 65 },
+    // State 99 default action
+    { 99, -1, PA_REDUCE, 65 },
+    // State 100
+    { 100, 124, PA_REDUCE, 67 },
+    // State 100 default action
+    { 100, -1, PA_REDUCE, 67 },
+    // State 101
+    { 101, 10, PA_SHIFT, 106 },
+    // State 101
+    { 101, 35, PA_SHIFT, 107 },
+    // State 101
+    { 101, 83, PA_SHIFT, 151 },
+    // State 101
+    { 101, 108, PA_SHIFT, 102 },
+    // State 102
+    { 102, 25, PA_SHIFT, 104 },
+    // State 102
+    { 102, 58, PA_SHIFT, 103 },
+    // State 103
+    { 103, 124, PA_REDUCE, 68 },
+    // State 103 default action
+    { 103, -1, PA_REDUCE, 68 },
+    // State 104
+    { 104, 10, PA_SHIFT, 106 },
+    // State 104
+    { 104, 35, PA_SHIFT, 107 },
+    // State 104
+    { 104, 83, PA_SHIFT, 105 },
+    // State 105
+    { 105, 124, PA_REDUCE, 69 },
+    // State 105 default action
+    { 105, -1, PA_REDUCE, 69 },
+    // State 106
+    { 106, 124, PA_REDUCE, 71 },
+    // State 106 default action
+    { 106, -1, PA_REDUCE, 71 },
+    // State 107
+    { 107, 11, PA_SHIFT, 112 },
+    // State 107
+    { 107, 36, PA_SHIFT, 113 },
+    // State 107
+    { 107, 84, PA_SHIFT, 150 },
+    // State 107
+    { 107, 109, PA_SHIFT, 108 },
+    // State 108
+    { 108, 25, PA_SHIFT, 110 },
+    // State 108
+    { 108, 59, PA_SHIFT, 109 },
+    // State 109
+    { 109, 124, PA_REDUCE, 72 },
+    // State 109 default action
+    { 109, -1, PA_REDUCE, 72 },
+    // State 110
+    { 110, 11, PA_SHIFT, 112 },
+    // State 110
+    { 110, 36, PA_SHIFT, 113 },
+    // State 110
+    { 110, 84, PA_SHIFT, 111 },
+    // State 111
+    { 111, 124, PA_REDUCE, 73 },
+    // State 111 default action
+    { 111, -1, PA_REDUCE, 73 },
+    // State 112
+    { 112, 124, PA_REDUCE, 75 },
+    // State 112 default action
+    { 112, -1, PA_REDUCE, 75 },
+    // State 113
+    { 113, 12, PA_SHIFT, 118 },
+    // State 113
+    { 113, 37, PA_SHIFT, 119 },
+    // State 113
+    { 113, 85, PA_SHIFT, 149 },
+    // State 113
+    { 113, 110, PA_SHIFT, 114 },
+    // State 114
+    { 114, 25, PA_SHIFT, 116 },
+    // State 114
+    { 114, 60, PA_SHIFT, 115 },
+    // State 115
+    { 115, 124, PA_REDUCE, 76 },
+    // State 115 default action
+    { 115, -1, PA_REDUCE, 76 },
+    // State 116
+    { 116, 12, PA_SHIFT, 118 },
+    // State 116
+    { 116, 37, PA_SHIFT, 119 },
+    // State 116
+    { 116, 85, PA_SHIFT, 117 },
+    // State 117
+    { 117, 124, PA_REDUCE, 77 },
+    // State 117 default action
+    { 117, -1, PA_REDUCE, 77 },
+    // State 118
+    { 118, 124, PA_REDUCE, 79 },
+    // State 118 default action
+    { 118, -1, PA_REDUCE, 79 },
+    // State 119
+    { 119, 14, PA_SHIFT, 124 },
+    // State 119
+    { 119, 39, PA_SHIFT, 125 },
+    // State 119
+    { 119, 87, PA_SHIFT, 148 },
+    // State 119
+    { 119, 112, PA_SHIFT, 120 },
+    // State 120
+    { 120, 25, PA_SHIFT, 122 },
+    // State 120
+    { 120, 61, PA_SHIFT, 121 },
+    // State 121
+    { 121, 124, PA_REDUCE, 80 },
+    // State 121 default action
+    { 121, -1, PA_REDUCE, 80 },
+    // State 122
+    { 122, 14, PA_SHIFT, 124 },
+    // State 122
+    { 122, 39, PA_SHIFT, 125 },
+    // State 122
+    { 122, 87, PA_SHIFT, 123 },
+    // State 123
+    { 123, 124, PA_REDUCE, 81 },
+    // State 123 default action
+    { 123, -1, PA_REDUCE, 81 },
+    // State 124
+    { 124, 124, PA_REDUCE, 83 },
+    // State 124 default action
+    { 124, -1, PA_REDUCE, 83 },
+    // State 125
+    { 125, 15, PA_SHIFT, 130 },
+    // State 125
+    { 125, 40, PA_SHIFT, 131 },
+    // State 125
+    { 125, 88, PA_SHIFT, 147 },
+    // State 125
+    { 125, 113, PA_SHIFT, 126 },
+    // State 126
+    { 126, 25, PA_SHIFT, 128 },
+    // State 126
+    { 126, 63, PA_SHIFT, 127 },
+    // State 127
+    { 127, 124, PA_REDUCE, 84 },
+    // State 127 default action
+    { 127, -1, PA_REDUCE, 84 },
+    // State 128
+    { 128, 15, PA_SHIFT, 130 },
+    // State 128
+    { 128, 40, PA_SHIFT, 131 },
+    // State 128
+    { 128, 88, PA_SHIFT, 129 },
+    // State 129
+    { 129, 124, PA_REDUCE, 85 },
+    // State 129 default action
+    { 129, -1, PA_REDUCE, 85 },
+    // State 130
+    { 130, 124, PA_REDUCE, 87 },
+    // State 130 default action
+    { 130, -1, PA_REDUCE, 87 },
+    // State 131
+    { 131, 16, PA_SHIFT, 136 },
+    // State 131
+    { 131, 41, PA_SHIFT, 137 },
+    // State 131
+    { 131, 89, PA_SHIFT, 146 },
+    // State 131
+    { 131, 114, PA_SHIFT, 132 },
+    // State 132
+    { 132, 25, PA_SHIFT, 134 },
+    // State 132
+    { 132, 64, PA_SHIFT, 133 },
+    // State 133
+    { 133, 124, PA_REDUCE, 88 },
+    // State 133 default action
+    { 133, -1, PA_REDUCE, 88 },
+    // State 134
+    { 134, 16, PA_SHIFT, 136 },
+    // State 134
+    { 134, 41, PA_SHIFT, 137 },
+    // State 134
+    { 134, 89, PA_SHIFT, 135 },
+    // State 135
+    { 135, 124, PA_REDUCE, 89 },
+    // State 135 default action
+    { 135, -1, PA_REDUCE, 89 },
+    // State 136
+    { 136, 124, PA_REDUCE, 91 },
+    // State 136 default action
+    { 136, -1, PA_REDUCE, 91 },
+    // State 137
+    { 137, 17, PA_SHIFT, 142 },
+    // State 137
+    { 137, 42, PA_SHIFT, 143 },
+    // State 137
+    { 137, 90, PA_SHIFT, 145 },
+    // State 137
+    { 137, 115, PA_SHIFT, 138 },
+    // State 138
+    { 138, 25, PA_SHIFT, 140 },
+    // State 138
+    { 138, 65, PA_SHIFT, 139 },
+    // State 139
+    { 139, 124, PA_REDUCE, 92 },
+    // State 139 default action
+    { 139, -1, PA_REDUCE, 92 },
+    // State 140
+    { 140, 17, PA_SHIFT, 142 },
+    // State 140
+    { 140, 42, PA_SHIFT, 143 },
+    // State 140
+    { 140, 90, PA_SHIFT, 141 },
+    // State 141
+    { 141, 124, PA_REDUCE, 93 },
+    // State 141 default action
+    { 141, -1, PA_REDUCE, 93 },
+    // State 142
+    { 142, 124, PA_REDUCE, 95 },
+    // State 142 default action
+    { 142, -1, PA_REDUCE, 95 },
+    // State 143
+    { 143, 66, PA_SHIFT, 144 },
+    // State 144
+    { 144, 124, PA_REDUCE, 96 },
+    // State 144 default action
+    { 144, -1, PA_REDUCE, 96 },
+    // State 145
+    { 145, 124, PA_REDUCE, 94 },
+    // State 145 default action
+    { 145, -1, PA_REDUCE, 94 },
+    // State 146
+    { 146, 124, PA_REDUCE, 90 },
+    // State 146 default action
+    { 146, -1, PA_REDUCE, 90 },
+    // State 147
+    { 147, 124, PA_REDUCE, 86 },
+    // State 147 default action
+    { 147, -1, PA_REDUCE, 86 },
+    // State 148
+    { 148, 124, PA_REDUCE, 82 },
+    // State 148 default action
+    { 148, -1, PA_REDUCE, 82 },
+    // State 149
+    { 149, 124, PA_REDUCE, 78 },
+    // State 149 default action
+    { 149, -1, PA_REDUCE, 78 },
+    // State 150
+    { 150, 124, PA_REDUCE, 74 },
+    // State 150 default action
+    { 150, -1, PA_REDUCE, 74 },
+    // State 151
+    { 151, 124, PA_REDUCE, 70 },
+    // State 151 default action
+    { 151, -1, PA_REDUCE, 70 },
+    // State 152
+    { 152, 124, PA_REDUCE, 66 },
+    // State 152 default action
+    { 152, -1, PA_REDUCE, 66 },
+    // State 153
+    { 153, 124, PA_REDUCE, 62 },
+    // State 153 default action
+    { 153, -1, PA_REDUCE, 62 },
+    // State 154
+    { 154, 124, PA_REDUCE, 58 },
+    // State 154 default action
+    { 154, -1, PA_REDUCE, 58 },
+    // State 155
+    { 155, 124, PA_REDUCE, 54 },
+    // State 155 default action
+    { 155, -1, PA_REDUCE, 54 },
+    // State 156
+    { 156, 124, PA_REDUCE, 50 },
+    // State 156 default action
+    { 156, -1, PA_REDUCE, 50 },
+    // State 157
+    { 157, 124, PA_REDUCE, 46 },
+    // State 157 default action
+    { 157, -1, PA_REDUCE, 46 },
+    // State 158
+    { 158, 124, PA_REDUCE, 42 },
+    // State 158 default action
+    { 158, -1, PA_REDUCE, 42 },
+    // State 159
+    { 159, 124, PA_REDUCE, 38 },
+    // State 159 default action
+    { 159, -1, PA_REDUCE, 38 },
+    // State 160
+    { 160, 124, PA_REDUCE, 34 },
+    // State 160 default action
+    { 160, -1, PA_REDUCE, 34 },
+    // State 161
+    { 161, 124, PA_REDUCE, 30 },
+    // State 161 default action
+    { 161, -1, PA_REDUCE, 30 },
+    // State 162
+    { 162, 124, PA_REDUCE, 26 },
+    // State 162 default action
+    { 162, -1, PA_REDUCE, 26 },
+    // State 163
+    { 163, 124, PA_REDUCE, 22 },
+    // State 163 default action
+    { 163, -1, PA_REDUCE, 22 },
+    // State 164
+    { 164, 124, PA_REDUCE, 18 },
+    // State 164 default action
+    { 164, -1, PA_REDUCE, 18 },
+    // State 165
+    { 165, 124, PA_REDUCE, 14 },
+    // State 165 default action
+    { 165, -1, PA_REDUCE, 14 },
+    // State 166
+    { 166, 124, PA_REDUCE, 10 },
+    // State 166 default action
+    { 166, -1, PA_REDUCE, 10 },
+    // State 167
+    { 167, 124, PA_REDUCE, 6 },
+    // State 167 default action
+    { 167, -1, PA_REDUCE, 6 },
+    // State 168
+    { 168, 124, PA_REDUCE, 2 },
+    // State 168 default action
+    { 168, -1, PA_REDUCE, 2 },
+};
+
+
+static int theRuleTable[97][2] =
+{
+    // prog ::= list0
+    { 123, 1 }, 
+    // list0 ::= list0 COMMA elem0
+    { 99, 3 }, 
+    // list0 ::= elem0
+    { 99, 1 }, 
+    // elem0 ::= ATOM0
+    { 74, 1 }, 
+    // elem0 ::= LP0 list1 RP0
+    { 74, 3 }, 
+    // list1 ::= list1 COMMA elem1
+    { 100, 3 }, 
+    // list1 ::= elem1
+    { 100, 1 }, 
+    // elem1 ::= ATOM1
+    { 75, 1 }, 
+    // elem1 ::= LP1 list2 RP1
+    { 75, 3 }, 
+    // list2 ::= list2 COMMA elem2
+    { 111, 3 }, 
+    // list2 ::= elem2
+    { 111, 1 }, 
+    // elem2 ::= ATOM2
+    { 86, 1 }, 
+    // elem2 ::= LP2 list3 RP2
+    { 86, 3 }, 
+    // list3 ::= list3 COMMA elem3
+    { 116, 3 }, 
+    // list3 ::= elem3
+    { 116, 1 }, 
+    // elem3 ::= ATOM3
+    { 91, 1 }, 
+    // elem3 ::= LP3 list4 RP3
+    { 91, 3 }, 
+    // list4 ::= list4 COMMA elem4
+    { 117, 3 }, 
+    // list4 ::= elem4
+    { 117, 1 }, 
+    // elem4 ::= ATOM4
+    { 92, 1 }, 
+    // elem4 ::= LP4 list5 RP4
+    { 92, 3 }, 
+    // list5 ::= list5 COMMA elem5
+    { 118, 3 }, 
+    // list5 ::= elem5
+    { 118, 1 }, 
+    // elem5 ::= ATOM5
+    { 93, 1 }, 
+    // elem5 ::= LP5 list6 RP5
+    { 93, 3 }, 
+    // list6 ::= list6 COMMA elem6
+    { 119, 3 }, 
+    // list6 ::= elem6
+    { 119, 1 }, 
+    // elem6 ::= ATOM6
+    { 94, 1 }, 
+    // elem6 ::= LP6 list7 RP6
+    { 94, 3 }, 
+    // list7 ::= list7 COMMA elem7
+    { 120, 3 }, 
+    // list7 ::= elem7
+    { 120, 1 }, 
+    // elem7 ::= ATOM7
+    { 95, 1 }, 
+    // elem7 ::= LP7 list8 RP7
+    { 95, 3 }, 
+    // list8 ::= list8 COMMA elem8
+    { 121, 3 }, 
+    // list8 ::= elem8
+    { 121, 1 }, 
+    // elem8 ::= ATOM8
+    { 96, 1 }, 
+    // elem8 ::= LP8 list9 RP8
+    { 96, 3 }, 
+    // list9 ::= list9 COMMA elem9
+    { 122, 3 }, 
+    // list9 ::= elem9
+    { 122, 1 }, 
+    // elem9 ::= ATOM9
+    { 97, 1 }, 
+    // elem9 ::= LP9 list10 RP9
+    { 97, 3 }, 
+    // list10 ::= list10 COMMA elem10
+    { 101, 3 }, 
+    // list10 ::= elem10
+    { 101, 1 }, 
+    // elem10 ::= ATOM10
+    { 76, 1 }, 
+    // elem10 ::= LP10 list11 RP10
+    { 76, 3 }, 
+    // list11 ::= list11 COMMA elem11
+    { 102, 3 }, 
+    // list11 ::= elem11
+    { 102, 1 }, 
+    // elem11 ::= ATOM11
+    { 77, 1 }, 
+    // elem11 ::= LP11 list12 RP11
+    { 77, 3 }, 
+    // list12 ::= list12 COMMA elem12
+    { 103, 3 }, 
+    // list12 ::= elem12
+    { 103, 1 }, 
+    // elem12 ::= ATOM12
+    { 78, 1 }, 
+    // elem12 ::= LP12 list13 RP12
+    { 78, 3 }, 
+    // list13 ::= list13 COMMA elem13
+    { 104, 3 }, 
+    // list13 ::= elem13
+    { 104, 1 }, 
+    // elem13 ::= ATOM13
+    { 79, 1 }, 
+    // elem13 ::= LP13 list14 RP13
+    { 79, 3 }, 
+    // list14 ::= list14 COMMA elem14
+    { 105, 3 }, 
+    // list14 ::= elem14
+    { 105, 1 }, 
+    // elem14 ::= ATOM14
+    { 80, 1 }, 
+    // elem14 ::= LP14 list15 RP14
+    { 80, 3 }, 
+    // list15 ::= list15 COMMA elem15
+    { 106, 3 }, 
+    // list15 ::= elem15
+    { 106, 1 }, 
+    // elem15 ::= ATOM15
+    { 81, 1 }, 
+    // elem15 ::= LP15 list16 RP15
+    { 81, 3 }, 
+    // list16 ::= list16 COMMA elem16
+    { 107, 3 }, 
+    // list16 ::= elem16
+    { 107, 1 }, 
+    // elem16 ::= ATOM16
+    { 82, 1 }, 
+    // elem16 ::= LP16 list17 RP16
+    { 82, 3 }, 
+    // list17 ::= list17 COMMA elem17
+    { 108, 3 }, 
+    // list17 ::= elem17
+    { 108, 1 }, 
+    // elem17 ::= ATOM17
+    { 83, 1 }, 
+    // elem17 ::= LP17 list18 RP17
+    { 83, 3 }, 
+    // list18 ::= list18 COMMA elem18
+    { 109, 3 }, 
+    // list18 ::= elem18
+    { 109, 1 }, 
+    // elem18 ::= ATOM18
+    { 84, 1 }, 
+    // elem18 ::= LP18 list19 RP18
+    { 84, 3 }, 
+    // list19 ::= list19 COMMA elem19
+    { 110, 3 }, 
+    // list19 ::= elem19
+    { 110, 1 }, 
+    // elem19 ::= ATOM19
+    { 85, 1 }, 
+    // elem19 ::= LP19 list20 RP19
+    { 85, 3 }, 
+    // list20 ::= list20 COMMA elem20
+    { 112, 3 }, 
+    // list20 ::= elem20
+    { 112, 1 }, 
+    // elem20 ::= ATOM20
+    { 87, 1 }, 
+    // elem20 ::= LP20 list21 RP20
+    { 87, 3 }, 
+    // list21 ::= list21 COMMA elem21
+    { 113, 3 }, 
+    // list21 ::= elem21
+    { 113, 1 }, 
+    // elem21 ::= ATOM21
+    { 88, 1 }, 
+    // elem21 ::= LP21 list22 RP21
+    { 88, 3 }, 
+    // list22 ::= list22 COMMA elem22
+    { 114, 3 }, 
+    // list22 ::= elem22
+    { 114, 1 }, 
+    // elem22 ::= ATOM22
+    { 89, 1 }, 
+    // elem22 ::= LP22 list23 RP22
+    { 89, 3 }, 
+    // list23 ::= list23 COMMA elem23
+    { 115, 3 }, 
+    // list23 ::= elem23
+    { 115, 1 }, 
+    // elem23 ::= ATOM23
+    { 90, 1 }, 
+    // elem23 ::= LP23 RP23
+    { 90, 2 }, 
+};
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::initTables( void )
+{
+    myStates.assign( 169, ActionMap() );
+    myStateDefaultActions.assign( 169, ActionEntry(PA_ERROR,-2) );
+    for ( int i = 0; i < 410; ++i )
+    {
+        if ( theStateTable[i][1] == -1 )
+            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+        else
+            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+    }
+
+
+    // Rule Table
+
+    myRules.reserve( 97 );
+    for ( int i = 0; i < 97; ++i )
+        myRules.push_back( RuleInfo( theRuleTable[i][0], theRuleTable[i][1] ) );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::syntaxError( Bench::Terminal tok, privBenchImpl::Value &data )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parseFailed( void )
+{
+}
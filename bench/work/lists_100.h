@@ -0,0 +1,107 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        ATOM0 = 1,
+        ATOM1 = 2,
+        ATOM10 = 3,
+        ATOM11 = 4,
+        ATOM12 = 5,
+        ATOM13 = 6,
+        ATOM14 = 7,
+        ATOM15 = 8,
+        ATOM16 = 9,
+        ATOM17 = 10,
+        ATOM18 = 11,
+        ATOM19 = 12,
+        ATOM2 = 13,
+        ATOM20 = 14,
+        ATOM21 = 15,
+        ATOM22 = 16,
+        ATOM23 = 17,
+        ATOM3 = 18,
+        ATOM4 = 19,
+        ATOM5 = 20,
+        ATOM6 = 21,
+        ATOM7 = 22,
+        ATOM8 = 23,
+        ATOM9 = 24,
+        COMMA = 25,
+        LP0 = 26,
+        LP1 = 27,
+        LP10 = 28,
+        LP11 = 29,
+        LP12 = 30,
+        LP13 = 31,
+        LP14 = 32,
+        LP15 = 33,
+        LP16 = 34,
+        LP17 = 35,
+        LP18 = 36,
+        LP19 = 37,
+        LP2 = 38,
+        LP20 = 39,
+        LP21 = 40,
+        LP22 = 41,
+        LP23 = 42,
+        LP3 = 43,
+        LP4 = 44,
+        LP5 = 45,
+        LP6 = 46,
+        LP7 = 47,
+        LP8 = 48,
+        LP9 = 49,
+        RP0 = 50,
+        RP1 = 51,
+        RP10 = 52,
+        RP11 = 53,
+        RP12 = 54,
+        RP13 = 55,
+        RP14 = 56,
+        RP15 = 57,
+        RP16 = 58,
+        RP17 = 59,
+        RP18 = 60,
+        RP19 = 61,
+        RP2 = 62,
+        RP20 = 63,
+        RP21 = 64,
+        RP22 = 65,
+        RP23 = 66,
+        RP3 = 67,
+        RP4 = 68,
+        RP5 = 69,
+        RP6 = 70,
+        RP7 = 71,
+        RP8 = 72,
+        RP9 = 73
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
@@ -0,0 +1,21547 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#include <utility>
+#include <stack>
+#include <map>
+#include <vector>
+#include <iostream>
+
+
+#include "lists_1000.h"
+
+enum ParserAct
+{
+    PA_SHIFT,
+    PA_REDUCE,
+    PA_ERROR,
+    PA_ACCEPT,
+    PA_NOP
+};
+
+class privBenchImpl
+{
+public:
+
+    privBenchImpl( void );
+    ~privBenchImpl( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    struct Value
+    {
+        union
+        {
+            int tokenType;
+            int errorType;
+        };
+    };
+    // first is stack num, second is the symbol index
+    typedef std::pair<int,int> StackID;
+    typedef std::pair<StackID,Value> StackEntry;
+    typedef std::stack<StackEntry> ParseStack;
+
+    void shift( int newState, int symIdx, Value &data );
+    void reduce( int ruleNum );
+    void callDtor( int symIdx, Value &data );
+    void popStack( void );
+    ParserAct findParserAction( int &newVal, int tok );
+    void initTables( void );
+    void syntaxError( Bench::Terminal tok, Value &data );
+    void parseFailed( void );
+
+    ParseStack myStack;
+    int myErrCount;
+
+
+    typedef std::pair<ParserAct,int> ActionEntry;
+    typedef std::map<int,ActionEntry> ActionMap;
+    typedef std::vector<ActionMap> StateList;
+    typedef std::vector<ActionEntry> StateDefaultList;
+
+    StateList myStates;
+    StateDefaultList myStateDefaultActions;
+
+
+    // first is LHS, second is number of RHS
+    typedef std::pair<int,int> RuleInfo;
+    typedef std::vector<RuleInfo> RuleList;
+
+    RuleList myRules;
+};
+
+
+////////////////////////////////////////
+
+
+Bench::Bench( void )
+    : myImplementation( new privBenchImpl )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Bench::~Bench( void )
+{
+    delete myImplementation;
+}
+
+
+////////////////////////////////////////
+
+
+void Bench::parse( Bench::Terminal tok, int value )
+{
+    myImplementation->parse( tok, value );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parse( Bench::Terminal tok, int value )
+{
+    int actVal;
+    ParserAct action;
+    bool errHit = false;
+    bool eoInput = (tok == Bench::EOF );
+    bool done = false;
+
+    if ( myStack.empty() )
+    {
+        if ( eoInput )
+            return;
+
+        myErrCount = -1;
+    }
+
+    privBenchImpl::Value data;
+    data.tokenType = value;
+
+    do
+    {
+        action = findParserAction( actVal, tok );
+        if ( PA_SHIFT == action )
+        {
+            shift( actVal, tok, data );
+            --myErrCount;
+            if ( eoInput && ! myStack.empty() )
+                tok = Bench::EOF;
+            else
+                done = true;
+        }
+        else if ( PA_REDUCE == action )
+        {
+            reduce( actVal );
+        }
+        else if ( PA_ERROR == action )
+        {
+            // Syntax error handling:
+            // 1. Call the %syntax_error function.
+            // 2. Pop stack until a state where we can shift the err symbol.
+            // 3. Shift the error symbol.
+            // 4. Set error count to three.
+            // 5. Begin accepting and shifting new tokens.
+            // 6. No new error processing will begin until 3 tokens are successful.
+            if ( myErrCount < 0 )
+            {
+                syntaxError( tok, data );
+            }
+            if ( myStack.top().first.first == 998 || errHit )
+            {
+                callDtor( static_cast<int>(tok), data );
+                done = true;
+            }
+            else
+            {
+                while ( ! myStack.empty() &&
+                        myStack.top().first.first != 998 )
+                {
+                    action = findParserAction( actVal, 998 );
+                    if ( action == PA_SHIFT )
+                        break;
+                    popStack();
+                }
+                if ( myStack.empty() || tok == Bench::EOF )
+                {
+                    callDtor( static_cast<int>(tok), data );
+                    parseFailed();
+                    done = true;
+                }
+                else if ( myStack.top().first.first != 998 )
+                {
+                    data.errorType = 0;
+                    shift( actVal, 998, data );
+                }
+            }
+            myErrCount = 3;
+            errHit = true;
+        }
+        else // ACCEPT == action || NOP == action
+        {
+            done = true;
+        }
+    } while ( ! done && ! myStack.empty() );
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::privBenchImpl( void )
+    : myErrCount( -1 )
+{
+    initTables();
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::~privBenchImpl( void )
+{
+    while ( ! myStack.empty() )
+        popStack();
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::shift( int newState, int symIdx, privBenchImpl::Value &data )
+{
+    StackEntry newItem = StackEntry( StackID( newState, symIdx ), data );
+    myStack.push( newItem );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::reduce( int ruleNum )
+{
+    int newVal;
+    ParserAct next;
+    privBenchImpl::Value data = { 0 };
+    std::vector<privBenchImpl::Value> rhsData;
+    for ( int i = 0, N = myRules[ruleNum].second; i != N; ++i )
+    {
+        if ( myStack.empty() )
+            rhsData.insert( rhsData.begin(), data );
+        else
+        {
+            rhsData.insert( rhsData.begin(), myStack.top().second );
+            myStack.pop();
+        }
+    }
+
+    next = findParserAction( newVal, myRules[ruleNum].first );
+
+    switch ( ruleNum )
+    {
+        case 0:
+        {
+            // prog ::= list0
+#line 0 "bench/work/lists_1000.lem"
+#line 250 "bench/work/lists_1000.cpp"
+            callDtor( 999, rhsData[0] );
+            break;
+        }
+
+        case 1:
+        {
+            // list0 ::= list0 COMMA elem0
+#line 0 "bench/work/lists_1000.lem"
+#line 259 "bench/work/lists_1000.cpp"
+            callDtor( 999, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 749, rhsData[2] );
+            break;
+        }
+
+        case 2:
+        {
+            // list0 ::= elem0
+#line 0 "bench/work/lists_1000.lem"
+#line 270 "bench/work/lists_1000.cpp"
+            callDtor( 749, rhsData[0] );
+            break;
+        }
+
+        case 3:
+        {
+            // elem0 ::= ATOM0
+#line 0 "bench/work/lists_1000.lem"
+#line 279 "bench/work/lists_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 4:
+        {
+            // elem0 ::= LP0 list1 RP0
+#line 0 "bench/work/lists_1000.lem"
+#line 288 "bench/work/lists_1000.cpp"
+            callDtor( 251, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            callDtor( 500, rhsData[2] );
+            break;
+        }
+
+        case 5:
+        {
+            // list1 ::= list1 COMMA elem1
+#line 0 "bench/work/lists_1000.lem"
+#line 299 "bench/work/lists_1000.cpp"
+            callDtor( 1000, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 750, rhsData[2] );
+            break;
+        }
+
+        case 6:
+        {
+            // list1 ::= elem1
+#line 0 "bench/work/lists_1000.lem"
+#line 310 "bench/work/lists_1000.cpp"
+            callDtor( 750, rhsData[0] );
+            break;
+        }
+
+        case 7:
+        {
+            // elem1 ::= ATOM1
+#line 0 "bench/work/lists_1000.lem"
+#line 319 "bench/work/lists_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 8:
+        {
+            // elem1 ::= LP1 list2 RP1
+#line 0 "bench/work/lists_1000.lem"
+#line 328 "bench/work/lists_1000.cpp"
+            callDtor( 252, rhsData[0] );
+            callDtor( 1111, rhsData[1] );
+            callDtor( 501, rhsData[2] );
+            break;
+        }
+
+        case 9:
+        {
+            // list2 ::= list2 COMMA elem2
+#line 0 "bench/work/lists_1000.lem"
+#line 339 "bench/work/lists_1000.cpp"
+            callDtor( 1111, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 861, rhsData[2] );
+            break;
+        }
+
+        case 10:
+        {
+            // list2 ::= elem2
+#line 0 "bench/work/lists_1000.lem"
+#line 350 "bench/work/lists_1000.cpp"
+            callDtor( 861, rhsData[0] );
+            break;
+        }
+
+        case 11:
+        {
+            // elem2 ::= ATOM2
+#line 0 "bench/work/lists_1000.lem"
+#line 359 "bench/work/lists_1000.cpp"
+            callDtor( 113, rhsData[0] );
+            break;
+        }
+
+        case 12:
+        {
+            // elem2 ::= LP2 list3 RP2
+#line 0 "bench/work/lists_1000.lem"
+#line 368 "bench/work/lists_1000.cpp"
+            callDtor( 363, rhsData[0] );
+            callDtor( 1171, rhsData[1] );
+            callDtor( 612, rhsData[2] );
+            break;
+        }
+
+        case 13:
+        {
+            // list3 ::= list3 COMMA elem3
+#line 0 "bench/work/lists_1000.lem"
+#line 379 "bench/work/lists_1000.cpp"
+            callDtor( 1171, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 921, rhsData[2] );
+            break;
+        }
+
+        case 14:
+        {
+            // list3 ::= elem3
+#line 0 "bench/work/lists_1000.lem"
+#line 390 "bench/work/lists_1000.cpp"
+            callDtor( 921, rhsData[0] );
+            break;
+        }
+
+        case 15:
+        {
+            // elem3 ::= ATOM3
+#line 0 "bench/work/lists_1000.lem"
+#line 399 "bench/work/lists_1000.cpp"
+            callDtor( 173, rhsData[0] );
+            break;
+        }
+
+        case 16:
+        {
+            // elem3 ::= LP3 list4 RP3
+#line 0 "bench/work/lists_1000.lem"
+#line 408 "bench/work/lists_1000.cpp"
+            callDtor( 423, rhsData[0] );
+            callDtor( 1182, rhsData[1] );
+            callDtor( 672, rhsData[2] );
+            break;
+        }
+
+        case 17:
+        {
+            // list4 ::= list4 COMMA elem4
+#line 0 "bench/work/lists_1000.lem"
+#line 419 "bench/work/lists_1000.cpp"
+            callDtor( 1182, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 932, rhsData[2] );
+            break;
+        }
+
+        case 18:
+        {
+            // list4 ::= elem4
+#line 0 "bench/work/lists_1000.lem"
+#line 430 "bench/work/lists_1000.cpp"
+            callDtor( 932, rhsData[0] );
+            break;
+        }
+
+        case 19:
+        {
+            // elem4 ::= ATOM4
+#line 0 "bench/work/lists_1000.lem"
+#line 439 "bench/work/lists_1000.cpp"
+            callDtor( 184, rhsData[0] );
+            break;
+        }
+
+        case 20:
+        {
+            // elem4 ::= LP4 list5 RP4
+#line 0 "bench/work/lists_1000.lem"
+#line 448 "bench/work/lists_1000.cpp"
+            callDtor( 434, rhsData[0] );
+            callDtor( 1193, rhsData[1] );
+            callDtor( 683, rhsData[2] );
+            break;
+        }
+
+        case 21:
+        {
+            // list5 ::= list5 COMMA elem5
+#line 0 "bench/work/lists_1000.lem"
+#line 459 "bench/work/lists_1000.cpp"
+            callDtor( 1193, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 943, rhsData[2] );
+            break;
+        }
+
+        case 22:
+        {
+            // list5 ::= elem5
+#line 0 "bench/work/lists_1000.lem"
+#line 470 "bench/work/lists_1000.cpp"
+            callDtor( 943, rhsData[0] );
+            break;
+        }
+
+        case 23:
+        {
+            // elem5 ::= ATOM5
+#line 0 "bench/work/lists_1000.lem"
+#line 479 "bench/work/lists_1000.cpp"
+            callDtor( 195, rhsData[0] );
+            break;
+        }
+
+        case 24:
+        {
+            // elem5 ::= LP5 list6 RP5
+#line 0 "bench/work/lists_1000.lem"
+#line 488 "bench/work/lists_1000.cpp"
+            callDtor( 445, rhsData[0] );
+            callDtor( 1204, rhsData[1] );
+            callDtor( 694, rhsData[2] );
+            break;
+        }
+
+        case 25:
+        {
+            // list6 ::= list6 COMMA elem6
+#line 0 "bench/work/lists_1000.lem"
+#line 499 "bench/work/lists_1000.cpp"
+            callDtor( 1204, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 954, rhsData[2] );
+            break;
+        }
+
+        case 26:
+        {
+            // list6 ::= elem6
+#line 0 "bench/work/lists_1000.lem"
+#line 510 "bench/work/lists_1000.cpp"
+            callDtor( 954, rhsData[0] );
+            break;
+        }
+
+        case 27:
+        {
+            // elem6 ::= ATOM6
+#line 0 "bench/work/lists_1000.lem"
+#line 519 "bench/work/lists_1000.cpp"
+            callDtor( 206, rhsData[0] );
+            break;
+        }
+
+        case 28:
+        {
+            // elem6 ::= LP6 list7 RP6
+#line 0 "bench/work/lists_1000.lem"
+#line 528 "bench/work/lists_1000.cpp"
+            callDtor( 456, rhsData[0] );
+            callDtor( 1215, rhsData[1] );
+            callDtor( 705, rhsData[2] );
+            break;
+        }
+
+        case 29:
+        {
+            // list7 ::= list7 COMMA elem7
+#line 0 "bench/work/lists_1000.lem"
+#line 539 "bench/work/lists_1000.cpp"
+            callDtor( 1215, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 965, rhsData[2] );
+            break;
+        }
+
+        case 30:
+        {
+            // list7 ::= elem7
+#line 0 "bench/work/lists_1000.lem"
+#line 550 "bench/work/lists_1000.cpp"
+            callDtor( 965, rhsData[0] );
+            break;
+        }
+
+        case 31:
+        {
+            // elem7 ::= ATOM7
+#line 0 "bench/work/lists_1000.lem"
+#line 559 "bench/work/lists_1000.cpp"
+            callDtor( 217, rhsData[0] );
+            break;
+        }
+
+        case 32:
+        {
+            // elem7 ::= LP7 list8 RP7
+#line 0 "bench/work/lists_1000.lem"
+#line 568 "bench/work/lists_1000.cpp"
+            callDtor( 467, rhsData[0] );
+            callDtor( 1226, rhsData[1] );
+            callDtor( 716, rhsData[2] );
+            break;
+        }
+
+        case 33:
+        {
+            // list8 ::= list8 COMMA elem8
+#line 0 "bench/work/lists_1000.lem"
+#line 579 "bench/work/lists_1000.cpp"
+            callDtor( 1226, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 976, rhsData[2] );
+            break;
+        }
+
+        case 34:
+        {
+            // list8 ::= elem8
+#line 0 "bench/work/lists_1000.lem"
+#line 590 "bench/work/lists_1000.cpp"
+            callDtor( 976, rhsData[0] );
+            break;
+        }
+
+        case 35:
+        {
+            // elem8 ::= ATOM8
+#line 0 "bench/work/lists_1000.lem"
+#line 599 "bench/work/lists_1000.cpp"
+            callDtor( 228, rhsData[0] );
+            break;
+        }
+
+        case 36:
+        {
+            // elem8 ::= LP8 list9 RP8
+#line 0 "bench/work/lists_1000.lem"
+#line 608 "bench/work/lists_1000.cpp"
+            callDtor( 478, rhsData[0] );
+            callDtor( 1237, rhsData[1] );
+            callDtor( 727, rhsData[2] );
+            break;
+        }
+
+        case 37:
+        {
+            // list9 ::= list9 COMMA elem9
+#line 0 "bench/work/lists_1000.lem"
+#line 619 "bench/work/lists_1000.cpp"
+            callDtor( 1237, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 987, rhsData[2] );
+            break;
+        }
+
+        case 38:
+        {
+            // list9 ::= elem9
+#line 0 "bench/work/lists_1000.lem"
+#line 630 "bench/work/lists_1000.cpp"
+            callDtor( 987, rhsData[0] );
+            break;
+        }
+
+        case 39:
+        {
+            // elem9 ::= ATOM9
+#line 0 "bench/work/lists_1000.lem"
+#line 639 "bench/work/lists_1000.cpp"
+            callDtor( 239, rhsData[0] );
+            break;
+        }
+
+        case 40:
+        {
+            // elem9 ::= LP9 list10 RP9
+#line 0 "bench/work/lists_1000.lem"
+#line 648 "bench/work/lists_1000.cpp"
+            callDtor( 489, rhsData[0] );
+            callDtor( 1001, rhsData[1] );
+            callDtor( 738, rhsData[2] );
+            break;
+        }
+
+        case 41:
+        {
+            // list10 ::= list10 COMMA elem10
+#line 0 "bench/work/lists_1000.lem"
+#line 659 "bench/work/lists_1000.cpp"
+            callDtor( 1001, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 751, rhsData[2] );
+            break;
+        }
+
+        case 42:
+        {
+            // list10 ::= elem10
+#line 0 "bench/work/lists_1000.lem"
+#line 670 "bench/work/lists_1000.cpp"
+            callDtor( 751, rhsData[0] );
+            break;
+        }
+
+        case 43:
+        {
+            // elem10 ::= ATOM10
+#line 0 "bench/work/lists_1000.lem"
+#line 679 "bench/work/lists_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 44:
+        {
+            // elem10 ::= LP10 list11 RP10
+#line 0 "bench/work/lists_1000.lem"
+#line 688 "bench/work/lists_1000.cpp"
+            callDtor( 253, rhsData[0] );
+            callDtor( 1012, rhsData[1] );
+            callDtor( 502, rhsData[2] );
+            break;
+        }
+
+        case 45:
+        {
+            // list11 ::= list11 COMMA elem11
+#line 0 "bench/work/lists_1000.lem"
+#line 699 "bench/work/lists_1000.cpp"
+            callDtor( 1012, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 762, rhsData[2] );
+            break;
+        }
+
+        case 46:
+        {
+            // list11 ::= elem11
+#line 0 "bench/work/lists_1000.lem"
+#line 710 "bench/work/lists_1000.cpp"
+            callDtor( 762, rhsData[0] );
+            break;
+        }
+
+        case 47:
+        {
+            // elem11 ::= ATOM11
+#line 0 "bench/work/lists_1000.lem"
+#line 719 "bench/work/lists_1000.cpp"
+            callDtor( 14, rhsData[0] );
+            break;
+        }
+
+        case 48:
+        {
+            // elem11 ::= LP11 list12 RP11
+#line 0 "bench/work/lists_1000.lem"
+#line 728 "bench/work/lists_1000.cpp"
+            callDtor( 264, rhsData[0] );
+            callDtor( 1023, rhsData[1] );
+            callDtor( 513, rhsData[2] );
+            break;
+        }
+
+        case 49:
+        {
+            // list12 ::= list12 COMMA elem12
+#line 0 "bench/work/lists_1000.lem"
+#line 739 "bench/work/lists_1000.cpp"
+            callDtor( 1023, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 773, rhsData[2] );
+            break;
+        }
+
+        case 50:
+        {
+            // list12 ::= elem12
+#line 0 "bench/work/lists_1000.lem"
+#line 750 "bench/work/lists_1000.cpp"
+            callDtor( 773, rhsData[0] );
+            break;
+        }
+
+        case 51:
+        {
+            // elem12 ::= ATOM12
+#line 0 "bench/work/lists_1000.lem"
+#line 759 "bench/work/lists_1000.cpp"
+            callDtor( 25, rhsData[0] );
+            break;
+        }
+
+        case 52:
+        {
+            // elem12 ::= LP12 list13 RP12
+#line 0 "bench/work/lists_1000.lem"
+#line 768 "bench/work/lists_1000.cpp"
+            callDtor( 275, rhsData[0] );
+            callDtor( 1034, rhsData[1] );
+            callDtor( 524, rhsData[2] );
+            break;
+        }
+
+        case 53:
+        {
+            // list13 ::= list13 COMMA elem13
+#line 0 "bench/work/lists_1000.lem"
+#line 779 "bench/work/lists_1000.cpp"
+            callDtor( 1034, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 784, rhsData[2] );
+            break;
+        }
+
+        case 54:
+        {
+            // list13 ::= elem13
+#line 0 "bench/work/lists_1000.lem"
+#line 790 "bench/work/lists_1000.cpp"
+            callDtor( 784, rhsData[0] );
+            break;
+        }
+
+        case 55:
+        {
+            // elem13 ::= ATOM13
+#line 0 "bench/work/lists_1000.lem"
+#line 799 "bench/work/lists_1000.cpp"
+            callDtor( 36, rhsData[0] );
+            break;
+        }
+
+        case 56:
+        {
+            // elem13 ::= LP13 list14 RP13
+#line 0 "bench/work/lists_1000.lem"
+#line 808 "bench/work/lists_1000.cpp"
+            callDtor( 286, rhsData[0] );
+            callDtor( 1045, rhsData[1] );
+            callDtor( 535, rhsData[2] );
+            break;
+        }
+
+        case 57:
+        {
+            // list14 ::= list14 COMMA elem14
+#line 0 "bench/work/lists_1000.lem"
+#line 819 "bench/work/lists_1000.cpp"
+            callDtor( 1045, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 795, rhsData[2] );
+            break;
+        }
+
+        case 58:
+        {
+            // list14 ::= elem14
+#line 0 "bench/work/lists_1000.lem"
+#line 830 "bench/work/lists_1000.cpp"
+            callDtor( 795, rhsData[0] );
+            break;
+        }
+
+        case 59:
+        {
+            // elem14 ::= ATOM14
+#line 0 "bench/work/lists_1000.lem"
+#line 839 "bench/work/lists_1000.cpp"
+            callDtor( 47, rhsData[0] );
+            break;
+        }
+
+        case 60:
+        {
+            // elem14 ::= LP14 list15 RP14
+#line 0 "bench/work/lists_1000.lem"
+#line 848 "bench/work/lists_1000.cpp"
+            callDtor( 297, rhsData[0] );
+            callDtor( 1056, rhsData[1] );
+            callDtor( 546, rhsData[2] );
+            break;
+        }
+
+        case 61:
+        {
+            // list15 ::= list15 COMMA elem15
+#line 0 "bench/work/lists_1000.lem"
+#line 859 "bench/work/lists_1000.cpp"
+            callDtor( 1056, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 806, rhsData[2] );
+            break;
+        }
+
+        case 62:
+        {
+            // list15 ::= elem15
+#line 0 "bench/work/lists_1000.lem"
+#line 870 "bench/work/lists_1000.cpp"
+            callDtor( 806, rhsData[0] );
+            break;
+        }
+
+        case 63:
+        {
+            // elem15 ::= ATOM15
+#line 0 "bench/work/lists_1000.lem"
+#line 879 "bench/work/lists_1000.cpp"
+            callDtor( 58, rhsData[0] );
+            break;
+        }
+
+        case 64:
+        {
+            // elem15 ::= LP15 list16 RP15
+#line 0 "bench/work/lists_1000.lem"
+#line 888 "bench/work/lists_1000.cpp"
+            callDtor( 308, rhsData[0] );
+            callDtor( 1067, rhsData[1] );
+            callDtor( 557, rhsData[2] );
+            break;
+        }
+
+        case 65:
+        {
+            // list16 ::= list16 COMMA elem16
+#line 0 "bench/work/lists_1000.lem"
+#line 899 "bench/work/lists_1000.cpp"
+            callDtor( 1067, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 817, rhsData[2] );
+            break;
+        }
+
+        case 66:
+        {
+            // list16 ::= elem16
+#line 0 "bench/work/lists_1000.lem"
+#line 910 "bench/work/lists_1000.cpp"
+            callDtor( 817, rhsData[0] );
+            break;
+        }
+
+        case 67:
+        {
+            // elem16 ::= ATOM16
+#line 0 "bench/work/lists_1000.lem"
+#line 919 "bench/work/lists_1000.cpp"
+            callDtor( 69, rhsData[0] );
+            break;
+        }
+
+        case 68:
+        {
+            // elem16 ::= LP16 list17 RP16
+#line 0 "bench/work/lists_1000.lem"
+#line 928 "bench/work/lists_1000.cpp"
+            callDtor( 319, rhsData[0] );
+            callDtor( 1078, rhsData[1] );
+            callDtor( 568, rhsData[2] );
+            break;
+        }
+
+        case 69:
+        {
+            // list17 ::= list17 COMMA elem17
+#line 0 "bench/work/lists_1000.lem"
+#line 939 "bench/work/lists_1000.cpp"
+            callDtor( 1078, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 828, rhsData[2] );
+            break;
+        }
+
+        case 70:
+        {
+            // list17 ::= elem17
+#line 0 "bench/work/lists_1000.lem"
+#line 950 "bench/work/lists_1000.cpp"
+            callDtor( 828, rhsData[0] );
+            break;
+        }
+
+        case 71:
+        {
+            // elem17 ::= ATOM17
+#line 0 "bench/work/lists_1000.lem"
+#line 959 "bench/work/lists_1000.cpp"
+            callDtor( 80, rhsData[0] );
+            break;
+        }
+
+        case 72:
+        {
+            // elem17 ::= LP17 list18 RP17
+#line 0 "bench/work/lists_1000.lem"
+#line 968 "bench/work/lists_1000.cpp"
+            callDtor( 330, rhsData[0] );
+            callDtor( 1089, rhsData[1] );
+            callDtor( 579, rhsData[2] );
+            break;
+        }
+
+        case 73:
+        {
+            // list18 ::= list18 COMMA elem18
+#line 0 "bench/work/lists_1000.lem"
+#line 979 "bench/work/lists_1000.cpp"
+            callDtor( 1089, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 839, rhsData[2] );
+            break;
+        }
+
+        case 74:
+        {
+            // list18 ::= elem18
+#line 0 "bench/work/lists_1000.lem"
+#line 990 "bench/work/lists_1000.cpp"
+            callDtor( 839, rhsData[0] );
+            break;
+        }
+
+        case 75:
+        {
+            // elem18 ::= ATOM18
+#line 0 "bench/work/lists_1000.lem"
+#line 999 "bench/work/lists_1000.cpp"
+            callDtor( 91, rhsData[0] );
+            break;
+        }
+
+        case 76:
+        {
+            // elem18 ::= LP18 list19 RP18
+#line 0 "bench/work/lists_1000.lem"
+#line 1008 "bench/work/lists_1000.cpp"
+            callDtor( 341, rhsData[0] );
+            callDtor( 1100, rhsData[1] );
+            callDtor( 590, rhsData[2] );
+            break;
+        }
+
+        case 77:
+        {
+            // list19 ::= list19 COMMA elem19
+#line 0 "bench/work/lists_1000.lem"
+#line 1019 "bench/work/lists_1000.cpp"
+            callDtor( 1100, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 850, rhsData[2] );
+            break;
+        }
+
+        case 78:
+        {
+            // list19 ::= elem19
+#line 0 "bench/work/lists_1000.lem"
+#line 1030 "bench/work/lists_1000.cpp"
+            callDtor( 850, rhsData[0] );
+            break;
+        }
+
+        case 79:
+        {
+            // elem19 ::= ATOM19
+#line 0 "bench/work/lists_1000.lem"
+#line 1039 "bench/work/lists_1000.cpp"
+            callDtor( 102, rhsData[0] );
+            break;
+        }
+
+        case 80:
+        {
+            // elem19 ::= LP19 list20 RP19
+#line 0 "bench/work/lists_1000.lem"
+#line 1048 "bench/work/lists_1000.cpp"
+            callDtor( 352, rhsData[0] );
+            callDtor( 1112, rhsData[1] );
+            callDtor( 601, rhsData[2] );
+            break;
+        }
+
+        case 81:
+        {
+            // list20 ::= list20 COMMA elem20
+#line 0 "bench/work/lists_1000.lem"
+#line 1059 "bench/work/lists_1000.cpp"
+            callDtor( 1112, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 862, rhsData[2] );
+            break;
+        }
+
+        case 82:
+        {
+            // list20 ::= elem20
+#line 0 "bench/work/lists_1000.lem"
+#line 1070 "bench/work/lists_1000.cpp"
+            callDtor( 862, rhsData[0] );
+            break;
+        }
+
+        case 83:
+        {
+            // elem20 ::= ATOM20
+#line 0 "bench/work/lists_1000.lem"
+#line 1079 "bench/work/lists_1000.cpp"
+            callDtor( 114, rhsData[0] );
+            break;
+        }
+
+        case 84:
+        {
+            // elem20 ::= LP20 list21 RP20
+#line 0 "bench/work/lists_1000.lem"
+#line 1088 "bench/work/lists_1000.cpp"
+            callDtor( 364, rhsData[0] );
+            callDtor( 1123, rhsData[1] );
+            callDtor( 613, rhsData[2] );
+            break;
+        }
+
+        case 85:
+        {
+            // list21 ::= list21 COMMA elem21
+#line 0 "bench/work/lists_1000.lem"
+#line 1099 "bench/work/lists_1000.cpp"
+            callDtor( 1123, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 873, rhsData[2] );
+            break;
+        }
+
+        case 86:
+        {
+            // list21 ::= elem21
+#line 0 "bench/work/lists_1000.lem"
+#line 1110 "bench/work/lists_1000.cpp"
+            callDtor( 873, rhsData[0] );
+            break;
+        }
+
+        case 87:
+        {
+            // elem21 ::= ATOM21
+#line 0 "bench/work/lists_1000.lem"
+#line 1119 "bench/work/lists_1000.cpp"
+            callDtor( 125, rhsData[0] );
+            break;
+        }
+
+        case 88:
+        {
+            // elem21 ::= LP21 list22 RP21
+#line 0 "bench/work/lists_1000.lem"
+#line 1128 "bench/work/lists_1000.cpp"
+            callDtor( 375, rhsData[0] );
+            callDtor( 1134, rhsData[1] );
+            callDtor( 624, rhsData[2] );
+            break;
+        }
+
+        case 89:
+        {
+            // list22 ::= list22 COMMA elem22
+#line 0 "bench/work/lists_1000.lem"
+#line 1139 "bench/work/lists_1000.cpp"
+            callDtor( 1134, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 884, rhsData[2] );
+            break;
+        }
+
+        case 90:
+        {
+            // list22 ::= elem22
+#line 0 "bench/work/lists_1000.lem"
+#line 1150 "bench/work/lists_1000.cpp"
+            callDtor( 884, rhsData[0] );
+            break;
+        }
+
+        case 91:
+        {
+            // elem22 ::= ATOM22
+#line 0 "bench/work/lists_1000.lem"
+#line 1159 "bench/work/lists_1000.cpp"
+            callDtor( 136, rhsData[0] );
+            break;
+        }
+
+        case 92:
+        {
+            // elem22 ::= LP22 list23 RP22
+#line 0 "bench/work/lists_1000.lem"
+#line 1168 "bench/work/lists_1000.cpp"
+            callDtor( 386, rhsData[0] );
+            callDtor( 1145, rhsData[1] );
+            callDtor( 635, rhsData[2] );
+            break;
+        }
+
+        case 93:
+        {
+            // list23 ::= list23 COMMA elem23
+#line 0 "bench/work/lists_1000.lem"
+#line 1179 "bench/work/lists_1000.cpp"
+            callDtor( 1145, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 895, rhsData[2] );
+            break;
+        }
+
+        case 94:
+        {
+            // list23 ::= elem23
+#line 0 "bench/work/lists_1000.lem"
+#line 1190 "bench/work/lists_1000.cpp"
+            callDtor( 895, rhsData[0] );
+            break;
+        }
+
+        case 95:
+        {
+            // elem23 ::= ATOM23
+#line 0 "bench/work/lists_1000.lem"
+#line 1199 "bench/work/lists_1000.cpp"
+            callDtor( 147, rhsData[0] );
+            break;
+        }
+
+        case 96:
+        {
+            // elem23 ::= LP23 list24 RP23
+#line 0 "bench/work/lists_1000.lem"
+#line 1208 "bench/work/lists_1000.cpp"
+            callDtor( 397, rhsData[0] );
+            callDtor( 1156, rhsData[1] );
+            callDtor( 646, rhsData[2] );
+            break;
+        }
+
+        case 97:
+        {
+            // list24 ::= list24 COMMA elem24
+#line 0 "bench/work/lists_1000.lem"
+#line 1219 "bench/work/lists_1000.cpp"
+            callDtor( 1156, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 906, rhsData[2] );
+            break;
+        }
+
+        case 98:
+        {
+            // list24 ::= elem24
+#line 0 "bench/work/lists_1000.lem"
+#line 1230 "bench/work/lists_1000.cpp"
+            callDtor( 906, rhsData[0] );
+            break;
+        }
+
+        case 99:
+        {
+            // elem24 ::= ATOM24
+#line 0 "bench/work/lists_1000.lem"
+#line 1239 "bench/work/lists_1000.cpp"
+            callDtor( 158, rhsData[0] );
+            break;
+        }
+
+        case 100:
+        {
+            // elem24 ::= LP24 list25 RP24
+#line 0 "bench/work/lists_1000.lem"
+#line 1248 "bench/work/lists_1000.cpp"
+            callDtor( 408, rhsData[0] );
+            callDtor( 1166, rhsData[1] );
+            callDtor( 657, rhsData[2] );
+            break;
+        }
+
+        case 101:
+        {
+            // list25 ::= list25 COMMA elem25
+#line 0 "bench/work/lists_1000.lem"
+#line 1259 "bench/work/lists_1000.cpp"
+            callDtor( 1166, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 916, rhsData[2] );
+            break;
+        }
+
+        case 102:
+        {
+            // list25 ::= elem25
+#line 0 "bench/work/lists_1000.lem"
+#line 1270 "bench/work/lists_1000.cpp"
+            callDtor( 916, rhsData[0] );
+            break;
+        }
+
+        case 103:
+        {
+            // elem25 ::= ATOM25
+#line 0 "bench/work/lists_1000.lem"
+#line 1279 "bench/work/lists_1000.cpp"
+            callDtor( 168, rhsData[0] );
+            break;
+        }
+
+        case 104:
+        {
+            // elem25 ::= LP25 list26 RP25
+#line 0 "bench/work/lists_1000.lem"
+#line 1288 "bench/work/lists_1000.cpp"
+            callDtor( 418, rhsData[0] );
+            callDtor( 1167, rhsData[1] );
+            callDtor( 667, rhsData[2] );
+            break;
+        }
+
+        case 105:
+        {
+            // list26 ::= list26 COMMA elem26
+#line 0 "bench/work/lists_1000.lem"
+#line 1299 "bench/work/lists_1000.cpp"
+            callDtor( 1167, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 917, rhsData[2] );
+            break;
+        }
+
+        case 106:
+        {
+            // list26 ::= elem26
+#line 0 "bench/work/lists_1000.lem"
+#line 1310 "bench/work/lists_1000.cpp"
+            callDtor( 917, rhsData[0] );
+            break;
+        }
+
+        case 107:
+        {
+            // elem26 ::= ATOM26
+#line 0 "bench/work/lists_1000.lem"
+#line 1319 "bench/work/lists_1000.cpp"
+            callDtor( 169, rhsData[0] );
+            break;
+        }
+
+        case 108:
+        {
+            // elem26 ::= LP26 list27 RP26
+#line 0 "bench/work/lists_1000.lem"
+#line 1328 "bench/work/lists_1000.cpp"
+            callDtor( 419, rhsData[0] );
+            callDtor( 1168, rhsData[1] );
+            callDtor( 668, rhsData[2] );
+            break;
+        }
+
+        case 109:
+        {
+            // list27 ::= list27 COMMA elem27
+#line 0 "bench/work/lists_1000.lem"
+#line 1339 "bench/work/lists_1000.cpp"
+            callDtor( 1168, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 918, rhsData[2] );
+            break;
+        }
+
+        case 110:
+        {
+            // list27 ::= elem27
+#line 0 "bench/work/lists_1000.lem"
+#line 1350 "bench/work/lists_1000.cpp"
+            callDtor( 918, rhsData[0] );
+            break;
+        }
+
+        case 111:
+        {
+            // elem27 ::= ATOM27
+#line 0 "bench/work/lists_1000.lem"
+#line 1359 "bench/work/lists_1000.cpp"
+            callDtor( 170, rhsData[0] );
+            break;
+        }
+
+        case 112:
+        {
+            // elem27 ::= LP27 list28 RP27
+#line 0 "bench/work/lists_1000.lem"
+#line 1368 "bench/work/lists_1000.cpp"
+            callDtor( 420, rhsData[0] );
+            callDtor( 1169, rhsData[1] );
+            callDtor( 669, rhsData[2] );
+            break;
+        }
+
+        case 113:
+        {
+            // list28 ::= list28 COMMA elem28
+#line 0 "bench/work/lists_1000.lem"
+#line 1379 "bench/work/lists_1000.cpp"
+            callDtor( 1169, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 919, rhsData[2] );
+            break;
+        }
+
+        case 114:
+        {
+            // list28 ::= elem28
+#line 0 "bench/work/lists_1000.lem"
+#line 1390 "bench/work/lists_1000.cpp"
+            callDtor( 919, rhsData[0] );
+            break;
+        }
+
+        case 115:
+        {
+            // elem28 ::= ATOM28
+#line 0 "bench/work/lists_1000.lem"
+#line 1399 "bench/work/lists_1000.cpp"
+            callDtor( 171, rhsData[0] );
+            break;
+        }
+
+        case 116:
+        {
+            // elem28 ::= LP28 list29 RP28
+#line 0 "bench/work/lists_1000.lem"
+#line 1408 "bench/work/lists_1000.cpp"
+            callDtor( 421, rhsData[0] );
+            callDtor( 1170, rhsData[1] );
+            callDtor( 670, rhsData[2] );
+            break;
+        }
+
+        case 117:
+        {
+            // list29 ::= list29 COMMA elem29
+#line 0 "bench/work/lists_1000.lem"
+#line 1419 "bench/work/lists_1000.cpp"
+            callDtor( 1170, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 920, rhsData[2] );
+            break;
+        }
+
+        case 118:
+        {
+            // list29 ::= elem29
+#line 0 "bench/work/lists_1000.lem"
+#line 1430 "bench/work/lists_1000.cpp"
+            callDtor( 920, rhsData[0] );
+            break;
+        }
+
+        case 119:
+        {
+            // elem29 ::= ATOM29
+#line 0 "bench/work/lists_1000.lem"
+#line 1439 "bench/work/lists_1000.cpp"
+            callDtor( 172, rhsData[0] );
+            break;
+        }
+
+        case 120:
+        {
+            // elem29 ::= LP29 list30 RP29
+#line 0 "bench/work/lists_1000.lem"
+#line 1448 "bench/work/lists_1000.cpp"
+            callDtor( 422, rhsData[0] );
+            callDtor( 1172, rhsData[1] );
+            callDtor( 671, rhsData[2] );
+            break;
+        }
+
+        case 121:
+        {
+            // list30 ::= list30 COMMA elem30
+#line 0 "bench/work/lists_1000.lem"
+#line 1459 "bench/work/lists_1000.cpp"
+            callDtor( 1172, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 922, rhsData[2] );
+            break;
+        }
+
+        case 122:
+        {
+            // list30 ::= elem30
+#line 0 "bench/work/lists_1000.lem"
+#line 1470 "bench/work/lists_1000.cpp"
+            callDtor( 922, rhsData[0] );
+            break;
+        }
+
+        case 123:
+        {
+            // elem30 ::= ATOM30
+#line 0 "bench/work/lists_1000.lem"
+#line 1479 "bench/work/lists_1000.cpp"
+            callDtor( 174, rhsData[0] );
+            break;
+        }
+
+        case 124:
+        {
+            // elem30 ::= LP30 list31 RP30
+#line 0 "bench/work/lists_1000.lem"
+#line 1488 "bench/work/lists_1000.cpp"
+            callDtor( 424, rhsData[0] );
+            callDtor( 1173, rhsData[1] );
+            callDtor( 673, rhsData[2] );
+            break;
+        }
+
+        case 125:
+        {
+            // list31 ::= list31 COMMA elem31
+#line 0 "bench/work/lists_1000.lem"
+#line 1499 "bench/work/lists_1000.cpp"
+            callDtor( 1173, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 923, rhsData[2] );
+            break;
+        }
+
+        case 126:
+        {
+            // list31 ::= elem31
+#line 0 "bench/work/lists_1000.lem"
+#line 1510 "bench/work/lists_1000.cpp"
+            callDtor( 923, rhsData[0] );
+            break;
+        }
+
+        case 127:
+        {
+            // elem31 ::= ATOM31
+#line 0 "bench/work/lists_1000.lem"
+#line 1519 "bench/work/lists_1000.cpp"
+            callDtor( 175, rhsData[0] );
+            break;
+        }
+
+        case 128:
+        {
+            // elem31 ::= LP31 list32 RP31
+#line 0 "bench/work/lists_1000.lem"
+#line 1528 "bench/work/lists_1000.cpp"
+            callDtor( 425, rhsData[0] );
+            callDtor( 1174, rhsData[1] );
+            callDtor( 674, rhsData[2] );
+            break;
+        }
+
+        case 129:
+        {
+            // list32 ::= list32 COMMA elem32
+#line 0 "bench/work/lists_1000.lem"
+#line 1539 "bench/work/lists_1000.cpp"
+            callDtor( 1174, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 924, rhsData[2] );
+            break;
+        }
+
+        case 130:
+        {
+            // list32 ::= elem32
+#line 0 "bench/work/lists_1000.lem"
+#line 1550 "bench/work/lists_1000.cpp"
+            callDtor( 924, rhsData[0] );
+            break;
+        }
+
+        case 131:
+        {
+            // elem32 ::= ATOM32
+#line 0 "bench/work/lists_1000.lem"
+#line 1559 "bench/work/lists_1000.cpp"
+            callDtor( 176, rhsData[0] );
+            break;
+        }
+
+        case 132:
+        {
+            // elem32 ::= LP32 list33 RP32
+#line 0 "bench/work/lists_1000.lem"
+#line 1568 "bench/work/lists_1000.cpp"
+            callDtor( 426, rhsData[0] );
+            callDtor( 1175, rhsData[1] );
+            callDtor( 675, rhsData[2] );
+            break;
+        }
+
+        case 133:
+        {
+            // list33 ::= list33 COMMA elem33
+#line 0 "bench/work/lists_1000.lem"
+#line 1579 "bench/work/lists_1000.cpp"
+            callDtor( 1175, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 925, rhsData[2] );
+            break;
+        }
+
+        case 134:
+        {
+            // list33 ::= elem33
+#line 0 "bench/work/lists_1000.lem"
+#line 1590 "bench/work/lists_1000.cpp"
+            callDtor( 925, rhsData[0] );
+            break;
+        }
+
+        case 135:
+        {
+            // elem33 ::= ATOM33
+#line 0 "bench/work/lists_1000.lem"
+#line 1599 "bench/work/lists_1000.cpp"
+            callDtor( 177, rhsData[0] );
+            break;
+        }
+
+        case 136:
+        {
+            // elem33 ::= LP33 list34 RP33
+#line 0 "bench/work/lists_1000.lem"
+#line 1608 "bench/work/lists_1000.cpp"
+            callDtor( 427, rhsData[0] );
+            callDtor( 1176, rhsData[1] );
+            callDtor( 676, rhsData[2] );
+            break;
+        }
+
+        case 137:
+        {
+            // list34 ::= list34 COMMA elem34
+#line 0 "bench/work/lists_1000.lem"
+#line 1619 "bench/work/lists_1000.cpp"
+            callDtor( 1176, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 926, rhsData[2] );
+            break;
+        }
+
+        case 138:
+        {
+            // list34 ::= elem34
+#line 0 "bench/work/lists_1000.lem"
+#line 1630 "bench/work/lists_1000.cpp"
+            callDtor( 926, rhsData[0] );
+            break;
+        }
+
+        case 139:
+        {
+            // elem34 ::= ATOM34
+#line 0 "bench/work/lists_1000.lem"
+#line 1639 "bench/work/lists_1000.cpp"
+            callDtor( 178, rhsData[0] );
+            break;
+        }
+
+        case 140:
+        {
+            // elem34 ::= LP34 list35 RP34
+#line 0 "bench/work/lists_1000.lem"
+#line 1648 "bench/work/lists_1000.cpp"
+            callDtor( 428, rhsData[0] );
+            callDtor( 1177, rhsData[1] );
+            callDtor( 677, rhsData[2] );
+            break;
+        }
+
+        case 141:
+        {
+            // list35 ::= list35 COMMA elem35
+#line 0 "bench/work/lists_1000.lem"
+#line 1659 "bench/work/lists_1000.cpp"
+            callDtor( 1177, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 927, rhsData[2] );
+            break;
+        }
+
+        case 142:
+        {
+            // list35 ::= elem35
+#line 0 "bench/work/lists_1000.lem"
+#line 1670 "bench/work/lists_1000.cpp"
+            callDtor( 927, rhsData[0] );
+            break;
+        }
+
+        case 143:
+        {
+            // elem35 ::= ATOM35
+#line 0 "bench/work/lists_1000.lem"
+#line 1679 "bench/work/lists_1000.cpp"
+            callDtor( 179, rhsData[0] );
+            break;
+        }
+
+        case 144:
+        {
+            // elem35 ::= LP35 list36 RP35
+#line 0 "bench/work/lists_1000.lem"
+#line 1688 "bench/work/lists_1000.cpp"
+            callDtor( 429, rhsData[0] );
+            callDtor( 1178, rhsData[1] );
+            callDtor( 678, rhsData[2] );
+            break;
+        }
+
+        case 145:
+        {
+            // list36 ::= list36 COMMA elem36
+#line 0 "bench/work/lists_1000.lem"
+#line 1699 "bench/work/lists_1000.cpp"
+            callDtor( 1178, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 928, rhsData[2] );
+            break;
+        }
+
+        case 146:
+        {
+            // list36 ::= elem36
+#line 0 "bench/work/lists_1000.lem"
+#line 1710 "bench/work/lists_1000.cpp"
+            callDtor( 928, rhsData[0] );
+            break;
+        }
+
+        case 147:
+        {
+            // elem36 ::= ATOM36
+#line 0 "bench/work/lists_1000.lem"
+#line 1719 "bench/work/lists_1000.cpp"
+            callDtor( 180, rhsData[0] );
+            break;
+        }
+
+        case 148:
+        {
+            // elem36 ::= LP36 list37 RP36
+#line 0 "bench/work/lists_1000.lem"
+#line 1728 "bench/work/lists_1000.cpp"
+            callDtor( 430, rhsData[0] );
+            callDtor( 1179, rhsData[1] );
+            callDtor( 679, rhsData[2] );
+            break;
+        }
+
+        case 149:
+        {
+            // list37 ::= list37 COMMA elem37
+#line 0 "bench/work/lists_1000.lem"
+#line 1739 "bench/work/lists_1000.cpp"
+            callDtor( 1179, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 929, rhsData[2] );
+            break;
+        }
+
+        case 150:
+        {
+            // list37 ::= elem37
+#line 0 "bench/work/lists_1000.lem"
+#line 1750 "bench/work/lists_1000.cpp"
+            callDtor( 929, rhsData[0] );
+            break;
+        }
+
+        case 151:
+        {
+            // elem37 ::= ATOM37
+#line 0 "bench/work/lists_1000.lem"
+#line 1759 "bench/work/lists_1000.cpp"
+            callDtor( 181, rhsData[0] );
+            break;
+        }
+
+        case 152:
+        {
+            // elem37 ::= LP37 list38 RP37
+#line 0 "bench/work/lists_1000.lem"
+#line 1768 "bench/work/lists_1000.cpp"
+            callDtor( 431, rhsData[0] );
+            callDtor( 1180, rhsData[1] );
+            callDtor( 680, rhsData[2] );
+            break;
+        }
+
+        case 153:
+        {
+            // list38 ::= list38 COMMA elem38
+#line 0 "bench/work/lists_1000.lem"
+#line 1779 "bench/work/lists_1000.cpp"
+            callDtor( 1180, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 930, rhsData[2] );
+            break;
+        }
+
+        case 154:
+        {
+            // list38 ::= elem38
+#line 0 "bench/work/lists_1000.lem"
+#line 1790 "bench/work/lists_1000.cpp"
+            callDtor( 930, rhsData[0] );
+            break;
+        }
+
+        case 155:
+        {
+            // elem38 ::= ATOM38
+#line 0 "bench/work/lists_1000.lem"
+#line 1799 "bench/work/lists_1000.cpp"
+            callDtor( 182, rhsData[0] );
+            break;
+        }
+
+        case 156:
+        {
+            // elem38 ::= LP38 list39 RP38
+#line 0 "bench/work/lists_1000.lem"
+#line 1808 "bench/work/lists_1000.cpp"
+            callDtor( 432, rhsData[0] );
+            callDtor( 1181, rhsData[1] );
+            callDtor( 681, rhsData[2] );
+            break;
+        }
+
+        case 157:
+        {
+            // list39 ::= list39 COMMA elem39
+#line 0 "bench/work/lists_1000.lem"
+#line 1819 "bench/work/lists_1000.cpp"
+            callDtor( 1181, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 931, rhsData[2] );
+            break;
+        }
+
+        case 158:
+        {
+            // list39 ::= elem39
+#line 0 "bench/work/lists_1000.lem"
+#line 1830 "bench/work/lists_1000.cpp"
+            callDtor( 931, rhsData[0] );
+            break;
+        }
+
+        case 159:
+        {
+            // elem39 ::= ATOM39
+#line 0 "bench/work/lists_1000.lem"
+#line 1839 "bench/work/lists_1000.cpp"
+            callDtor( 183, rhsData[0] );
+            break;
+        }
+
+        case 160:
+        {
+            // elem39 ::= LP39 list40 RP39
+#line 0 "bench/work/lists_1000.lem"
+#line 1848 "bench/work/lists_1000.cpp"
+            callDtor( 433, rhsData[0] );
+            callDtor( 1183, rhsData[1] );
+            callDtor( 682, rhsData[2] );
+            break;
+        }
+
+        case 161:
+        {
+            // list40 ::= list40 COMMA elem40
+#line 0 "bench/work/lists_1000.lem"
+#line 1859 "bench/work/lists_1000.cpp"
+            callDtor( 1183, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 933, rhsData[2] );
+            break;
+        }
+
+        case 162:
+        {
+            // list40 ::= elem40
+#line 0 "bench/work/lists_1000.lem"
+#line 1870 "bench/work/lists_1000.cpp"
+            callDtor( 933, rhsData[0] );
+            break;
+        }
+
+        case 163:
+        {
+            // elem40 ::= ATOM40
+#line 0 "bench/work/lists_1000.lem"
+#line 1879 "bench/work/lists_1000.cpp"
+            callDtor( 185, rhsData[0] );
+            break;
+        }
+
+        case 164:
+        {
+            // elem40 ::= LP40 list41 RP40
+#line 0 "bench/work/lists_1000.lem"
+#line 1888 "bench/work/lists_1000.cpp"
+            callDtor( 435, rhsData[0] );
+            callDtor( 1184, rhsData[1] );
+            callDtor( 684, rhsData[2] );
+            break;
+        }
+
+        case 165:
+        {
+            // list41 ::= list41 COMMA elem41
+#line 0 "bench/work/lists_1000.lem"
+#line 1899 "bench/work/lists_1000.cpp"
+            callDtor( 1184, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 934, rhsData[2] );
+            break;
+        }
+
+        case 166:
+        {
+            // list41 ::= elem41
+#line 0 "bench/work/lists_1000.lem"
+#line 1910 "bench/work/lists_1000.cpp"
+            callDtor( 934, rhsData[0] );
+            break;
+        }
+
+        case 167:
+        {
+            // elem41 ::= ATOM41
+#line 0 "bench/work/lists_1000.lem"
+#line 1919 "bench/work/lists_1000.cpp"
+            callDtor( 186, rhsData[0] );
+            break;
+        }
+
+        case 168:
+        {
+            // elem41 ::= LP41 list42 RP41
+#line 0 "bench/work/lists_1000.lem"
+#line 1928 "bench/work/lists_1000.cpp"
+            callDtor( 436, rhsData[0] );
+            callDtor( 1185, rhsData[1] );
+            callDtor( 685, rhsData[2] );
+            break;
+        }
+
+        case 169:
+        {
+            // list42 ::= list42 COMMA elem42
+#line 0 "bench/work/lists_1000.lem"
+#line 1939 "bench/work/lists_1000.cpp"
+            callDtor( 1185, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 935, rhsData[2] );
+            break;
+        }
+
+        case 170:
+        {
+            // list42 ::= elem42
+#line 0 "bench/work/lists_1000.lem"
+#line 1950 "bench/work/lists_1000.cpp"
+            callDtor( 935, rhsData[0] );
+            break;
+        }
+
+        case 171:
+        {
+            // elem42 ::= ATOM42
+#line 0 "bench/work/lists_1000.lem"
+#line 1959 "bench/work/lists_1000.cpp"
+            callDtor( 187, rhsData[0] );
+            break;
+        }
+
+        case 172:
+        {
+            // elem42 ::= LP42 list43 RP42
+#line 0 "bench/work/lists_1000.lem"
+#line 1968 "bench/work/lists_1000.cpp"
+            callDtor( 437, rhsData[0] );
+            callDtor( 1186, rhsData[1] );
+            callDtor( 686, rhsData[2] );
+            break;
+        }
+
+        case 173:
+        {
+            // list43 ::= list43 COMMA elem43
+#line 0 "bench/work/lists_1000.lem"
+#line 1979 "bench/work/lists_1000.cpp"
+            callDtor( 1186, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 936, rhsData[2] );
+            break;
+        }
+
+        case 174:
+        {
+            // list43 ::= elem43
+#line 0 "bench/work/lists_1000.lem"
+#line 1990 "bench/work/lists_1000.cpp"
+            callDtor( 936, rhsData[0] );
+            break;
+        }
+
+        case 175:
+        {
+            // elem43 ::= ATOM43
+#line 0 "bench/work/lists_1000.lem"
+#line 1999 "bench/work/lists_1000.cpp"
+            callDtor( 188, rhsData[0] );
+            break;
+        }
+
+        case 176:
+        {
+            // elem43 ::= LP43 list44 RP43
+#line 0 "bench/work/lists_1000.lem"
+#line 2008 "bench/work/lists_1000.cpp"
+            callDtor( 438, rhsData[0] );
+            callDtor( 1187, rhsData[1] );
+            callDtor( 687, rhsData[2] );
+            break;
+        }
+
+        case 177:
+        {
+            // list44 ::= list44 COMMA elem44
+#line 0 "bench/work/lists_1000.lem"
+#line 2019 "bench/work/lists_1000.cpp"
+            callDtor( 1187, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 937, rhsData[2] );
+            break;
+        }
+
+        case 178:
+        {
+            // list44 ::= elem44
+#line 0 "bench/work/lists_1000.lem"
+#line 2030 "bench/work/lists_1000.cpp"
+            callDtor( 937, rhsData[0] );
+            break;
+        }
+
+        case 179:
+        {
+            // elem44 ::= ATOM44
+#line 0 "bench/work/lists_1000.lem"
+#line 2039 "bench/work/lists_1000.cpp"
+            callDtor( 189, rhsData[0] );
+            break;
+        }
+
+        case 180:
+        {
+            // elem44 ::= LP44 list45 RP44
+#line 0 "bench/work/lists_1000.lem"
+#line 2048 "bench/work/lists_1000.cpp"
+            callDtor( 439, rhsData[0] );
+            callDtor( 1188, rhsData[1] );
+            callDtor( 688, rhsData[2] );
+            break;
+        }
+
+        case 181:
+        {
+            // list45 ::= list45 COMMA elem45
+#line 0 "bench/work/lists_1000.lem"
+#line 2059 "bench/work/lists_1000.cpp"
+            callDtor( 1188, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 938, rhsData[2] );
+            break;
+        }
+
+        case 182:
+        {
+            // list45 ::= elem45
+#line 0 "bench/work/lists_1000.lem"
+#line 2070 "bench/work/lists_1000.cpp"
+            callDtor( 938, rhsData[0] );
+            break;
+        }
+
+        case 183:
+        {
+            // elem45 ::= ATOM45
+#line 0 "bench/work/lists_1000.lem"
+#line 2079 "bench/work/lists_1000.cpp"
+            callDtor( 190, rhsData[0] );
+            break;
+        }
+
+        case 184:
+        {
+            // elem45 ::= LP45 list46 RP45
+#line 0 "bench/work/lists_1000.lem"
+#line 2088 "bench/work/lists_1000.cpp"
+            callDtor( 440, rhsData[0] );
+            callDtor( 1189, rhsData[1] );
+            callDtor( 689, rhsData[2] );
+            break;
+        }
+
+        case 185:
+        {
+            // list46 ::= list46 COMMA elem46
+#line 0 "bench/work/lists_1000.lem"
+#line 2099 "bench/work/lists_1000.cpp"
+            callDtor( 1189, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 939, rhsData[2] );
+            break;
+        }
+
+        case 186:
+        {
+            // list46 ::= elem46
+#line 0 "bench/work/lists_1000.lem"
+#line 2110 "bench/work/lists_1000.cpp"
+            callDtor( 939, rhsData[0] );
+            break;
+        }
+
+        case 187:
+        {
+            // elem46 ::= ATOM46
+#line 0 "bench/work/lists_1000.lem"
+#line 2119 "bench/work/lists_1000.cpp"
+            callDtor( 191, rhsData[0] );
+            break;
+        }
+
+        case 188:
+        {
+            // elem46 ::= LP46 list47 RP46
+#line 0 "bench/work/lists_1000.lem"
+#line 2128 "bench/work/lists_1000.cpp"
+            callDtor( 441, rhsData[0] );
+            callDtor( 1190, rhsData[1] );
+            callDtor( 690, rhsData[2] );
+            break;
+        }
+
+        case 189:
+        {
+            // list47 ::= list47 COMMA elem47
+#line 0 "bench/work/lists_1000.lem"
+#line 2139 "bench/work/lists_1000.cpp"
+            callDtor( 1190, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 940, rhsData[2] );
+            break;
+        }
+
+        case 190:
+        {
+            // list47 ::= elem47
+#line 0 "bench/work/lists_1000.lem"
+#line 2150 "bench/work/lists_1000.cpp"
+            callDtor( 940, rhsData[0] );
+            break;
+        }
+
+        case 191:
+        {
+            // elem47 ::= ATOM47
+#line 0 "bench/work/lists_1000.lem"
+#line 2159 "bench/work/lists_1000.cpp"
+            callDtor( 192, rhsData[0] );
+            break;
+        }
+
+        case 192:
+        {
+            // elem47 ::= LP47 list48 RP47
+#line 0 "bench/work/lists_1000.lem"
+#line 2168 "bench/work/lists_1000.cpp"
+            callDtor( 442, rhsData[0] );
+            callDtor( 1191, rhsData[1] );
+            callDtor( 691, rhsData[2] );
+            break;
+        }
+
+        case 193:
+        {
+            // list48 ::= list48 COMMA elem48
+#line 0 "bench/work/lists_1000.lem"
+#line 2179 "bench/work/lists_1000.cpp"
+            callDtor( 1191, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 941, rhsData[2] );
+            break;
+        }
+
+        case 194:
+        {
+            // list48 ::= elem48
+#line 0 "bench/work/lists_1000.lem"
+#line 2190 "bench/work/lists_1000.cpp"
+            callDtor( 941, rhsData[0] );
+            break;
+        }
+
+        case 195:
+        {
+            // elem48 ::= ATOM48
+#line 0 "bench/work/lists_1000.lem"
+#line 2199 "bench/work/lists_1000.cpp"
+            callDtor( 193, rhsData[0] );
+            break;
+        }
+
+        case 196:
+        {
+            // elem48 ::= LP48 list49 RP48
+#line 0 "bench/work/lists_1000.lem"
+#line 2208 "bench/work/lists_1000.cpp"
+            callDtor( 443, rhsData[0] );
+            callDtor( 1192, rhsData[1] );
+            callDtor( 692, rhsData[2] );
+            break;
+        }
+
+        case 197:
+        {
+            // list49 ::= list49 COMMA elem49
+#line 0 "bench/work/lists_1000.lem"
+#line 2219 "bench/work/lists_1000.cpp"
+            callDtor( 1192, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 942, rhsData[2] );
+            break;
+        }
+
+        case 198:
+        {
+            // list49 ::= elem49
+#line 0 "bench/work/lists_1000.lem"
+#line 2230 "bench/work/lists_1000.cpp"
+            callDtor( 942, rhsData[0] );
+            break;
+        }
+
+        case 199:
+        {
+            // elem49 ::= ATOM49
+#line 0 "bench/work/lists_1000.lem"
+#line 2239 "bench/work/lists_1000.cpp"
+            callDtor( 194, rhsData[0] );
+            break;
+        }
+
+        case 200:
+        {
+            // elem49 ::= LP49 list50 RP49
+#line 0 "bench/work/lists_1000.lem"
+#line 2248 "bench/work/lists_1000.cpp"
+            callDtor( 444, rhsData[0] );
+            callDtor( 1194, rhsData[1] );
+            callDtor( 693, rhsData[2] );
+            break;
+        }
+
+        case 201:
+        {
+            // list50 ::= list50 COMMA elem50
+#line 0 "bench/work/lists_1000.lem"
+#line 2259 "bench/work/lists_1000.cpp"
+            callDtor( 1194, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 944, rhsData[2] );
+            break;
+        }
+
+        case 202:
+        {
+            // list50 ::= elem50
+#line 0 "bench/work/lists_1000.lem"
+#line 2270 "bench/work/lists_1000.cpp"
+            callDtor( 944, rhsData[0] );
+            break;
+        }
+
+        case 203:
+        {
+            // elem50 ::= ATOM50
+#line 0 "bench/work/lists_1000.lem"
+#line 2279 "bench/work/lists_1000.cpp"
+            callDtor( 196, rhsData[0] );
+            break;
+        }
+
+        case 204:
+        {
+            // elem50 ::= LP50 list51 RP50
+#line 0 "bench/work/lists_1000.lem"
+#line 2288 "bench/work/lists_1000.cpp"
+            callDtor( 446, rhsData[0] );
+            callDtor( 1195, rhsData[1] );
+            callDtor( 695, rhsData[2] );
+            break;
+        }
+
+        case 205:
+        {
+            // list51 ::= list51 COMMA elem51
+#line 0 "bench/work/lists_1000.lem"
+#line 2299 "bench/work/lists_1000.cpp"
+            callDtor( 1195, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 945, rhsData[2] );
+            break;
+        }
+
+        case 206:
+        {
+            // list51 ::= elem51
+#line 0 "bench/work/lists_1000.lem"
+#line 2310 "bench/work/lists_1000.cpp"
+            callDtor( 945, rhsData[0] );
+            break;
+        }
+
+        case 207:
+        {
+            // elem51 ::= ATOM51
+#line 0 "bench/work/lists_1000.lem"
+#line 2319 "bench/work/lists_1000.cpp"
+            callDtor( 197, rhsData[0] );
+            break;
+        }
+
+        case 208:
+        {
+            // elem51 ::= LP51 list52 RP51
+#line 0 "bench/work/lists_1000.lem"
+#line 2328 "bench/work/lists_1000.cpp"
+            callDtor( 447, rhsData[0] );
+            callDtor( 1196, rhsData[1] );
+            callDtor( 696, rhsData[2] );
+            break;
+        }
+
+        case 209:
+        {
+            // list52 ::= list52 COMMA elem52
+#line 0 "bench/work/lists_1000.lem"
+#line 2339 "bench/work/lists_1000.cpp"
+            callDtor( 1196, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 946, rhsData[2] );
+            break;
+        }
+
+        case 210:
+        {
+            // list52 ::= elem52
+#line 0 "bench/work/lists_1000.lem"
+#line 2350 "bench/work/lists_1000.cpp"
+            callDtor( 946, rhsData[0] );
+            break;
+        }
+
+        case 211:
+        {
+            // elem52 ::= ATOM52
+#line 0 "bench/work/lists_1000.lem"
+#line 2359 "bench/work/lists_1000.cpp"
+            callDtor( 198, rhsData[0] );
+            break;
+        }
+
+        case 212:
+        {
+            // elem52 ::= LP52 list53 RP52
+#line 0 "bench/work/lists_1000.lem"
+#line 2368 "bench/work/lists_1000.cpp"
+            callDtor( 448, rhsData[0] );
+            callDtor( 1197, rhsData[1] );
+            callDtor( 697, rhsData[2] );
+            break;
+        }
+
+        case 213:
+        {
+            // list53 ::= list53 COMMA elem53
+#line 0 "bench/work/lists_1000.lem"
+#line 2379 "bench/work/lists_1000.cpp"
+            callDtor( 1197, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 947, rhsData[2] );
+            break;
+        }
+
+        case 214:
+        {
+            // list53 ::= elem53
+#line 0 "bench/work/lists_1000.lem"
+#line 2390 "bench/work/lists_1000.cpp"
+            callDtor( 947, rhsData[0] );
+            break;
+        }
+
+        case 215:
+        {
+            // elem53 ::= ATOM53
+#line 0 "bench/work/lists_1000.lem"
+#line 2399 "bench/work/lists_1000.cpp"
+            callDtor( 199, rhsData[0] );
+            break;
+        }
+
+        case 216:
+        {
+            // elem53 ::= LP53 list54 RP53
+#line 0 "bench/work/lists_1000.lem"
+#line 2408 "bench/work/lists_1000.cpp"
+            callDtor( 449, rhsData[0] );
+            callDtor( 1198, rhsData[1] );
+            callDtor( 698, rhsData[2] );
+            break;
+        }
+
+        case 217:
+        {
+            // list54 ::= list54 COMMA elem54
+#line 0 "bench/work/lists_1000.lem"
+#line 2419 "bench/work/lists_1000.cpp"
+            callDtor( 1198, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 948, rhsData[2] );
+            break;
+        }
+
+        case 218:
+        {
+            // list54 ::= elem54
+#line 0 "bench/work/lists_1000.lem"
+#line 2430 "bench/work/lists_1000.cpp"
+            callDtor( 948, rhsData[0] );
+            break;
+        }
+
+        case 219:
+        {
+            // elem54 ::= ATOM54
+#line 0 "bench/work/lists_1000.lem"
+#line 2439 "bench/work/lists_1000.cpp"
+            callDtor( 200, rhsData[0] );
+            break;
+        }
+
+        case 220:
+        {
+            // elem54 ::= LP54 list55 RP54
+#line 0 "bench/work/lists_1000.lem"
+#line 2448 "bench/work/lists_1000.cpp"
+            callDtor( 450, rhsData[0] );
+            callDtor( 1199, rhsData[1] );
+            callDtor( 699, rhsData[2] );
+            break;
+        }
+
+        case 221:
+        {
+            // list55 ::= list55 COMMA elem55
+#line 0 "bench/work/lists_1000.lem"
+#line 2459 "bench/work/lists_1000.cpp"
+            callDtor( 1199, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 949, rhsData[2] );
+            break;
+        }
+
+        case 222:
+        {
+            // list55 ::= elem55
+#line 0 "bench/work/lists_1000.lem"
+#line 2470 "bench/work/lists_1000.cpp"
+            callDtor( 949, rhsData[0] );
+            break;
+        }
+
+        case 223:
+        {
+            // elem55 ::= ATOM55
+#line 0 "bench/work/lists_1000.lem"
+#line 2479 "bench/work/lists_1000.cpp"
+            callDtor( 201, rhsData[0] );
+            break;
+        }
+
+        case 224:
+        {
+            // elem55 ::= LP55 list56 RP55
+#line 0 "bench/work/lists_1000.lem"
+#line 2488 "bench/work/lists_1000.cpp"
+            callDtor( 451, rhsData[0] );
+            callDtor( 1200, rhsData[1] );
+            callDtor( 700, rhsData[2] );
+            break;
+        }
+
+        case 225:
+        {
+            // list56 ::= list56 COMMA elem56
+#line 0 "bench/work/lists_1000.lem"
+#line 2499 "bench/work/lists_1000.cpp"
+            callDtor( 1200, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 950, rhsData[2] );
+            break;
+        }
+
+        case 226:
+        {
+            // list56 ::= elem56
+#line 0 "bench/work/lists_1000.lem"
+#line 2510 "bench/work/lists_1000.cpp"
+            callDtor( 950, rhsData[0] );
+            break;
+        }
+
+        case 227:
+        {
+            // elem56 ::= ATOM56
+#line 0 "bench/work/lists_1000.lem"
+#line 2519 "bench/work/lists_1000.cpp"
+            callDtor( 202, rhsData[0] );
+            break;
+        }
+
+        case 228:
+        {
+            // elem56 ::= LP56 list57 RP56
+#line 0 "bench/work/lists_1000.lem"
+#line 2528 "bench/work/lists_1000.cpp"
+            callDtor( 452, rhsData[0] );
+            callDtor( 1201, rhsData[1] );
+            callDtor( 701, rhsData[2] );
+            break;
+        }
+
+        case 229:
+        {
+            // list57 ::= list57 COMMA elem57
+#line 0 "bench/work/lists_1000.lem"
+#line 2539 "bench/work/lists_1000.cpp"
+            callDtor( 1201, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 951, rhsData[2] );
+            break;
+        }
+
+        case 230:
+        {
+            // list57 ::= elem57
+#line 0 "bench/work/lists_1000.lem"
+#line 2550 "bench/work/lists_1000.cpp"
+            callDtor( 951, rhsData[0] );
+            break;
+        }
+
+        case 231:
+        {
+            // elem57 ::= ATOM57
+#line 0 "bench/work/lists_1000.lem"
+#line 2559 "bench/work/lists_1000.cpp"
+            callDtor( 203, rhsData[0] );
+            break;
+        }
+
+        case 232:
+        {
+            // elem57 ::= LP57 list58 RP57
+#line 0 "bench/work/lists_1000.lem"
+#line 2568 "bench/work/lists_1000.cpp"
+            callDtor( 453, rhsData[0] );
+            callDtor( 1202, rhsData[1] );
+            callDtor( 702, rhsData[2] );
+            break;
+        }
+
+        case 233:
+        {
+            // list58 ::= list58 COMMA elem58
+#line 0 "bench/work/lists_1000.lem"
+#line 2579 "bench/work/lists_1000.cpp"
+            callDtor( 1202, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 952, rhsData[2] );
+            break;
+        }
+
+        case 234:
+        {
+            // list58 ::= elem58
+#line 0 "bench/work/lists_1000.lem"
+#line 2590 "bench/work/lists_1000.cpp"
+            callDtor( 952, rhsData[0] );
+            break;
+        }
+
+        case 235:
+        {
+            // elem58 ::= ATOM58
+#line 0 "bench/work/lists_1000.lem"
+#line 2599 "bench/work/lists_1000.cpp"
+            callDtor( 204, rhsData[0] );
+            break;
+        }
+
+        case 236:
+        {
+            // elem58 ::= LP58 list59 RP58
+#line 0 "bench/work/lists_1000.lem"
+#line 2608 "bench/work/lists_1000.cpp"
+            callDtor( 454, rhsData[0] );
+            callDtor( 1203, rhsData[1] );
+            callDtor( 703, rhsData[2] );
+            break;
+        }
+
+        case 237:
+        {
+            // list59 ::= list59 COMMA elem59
+#line 0 "bench/work/lists_1000.lem"
+#line 2619 "bench/work/lists_1000.cpp"
+            callDtor( 1203, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 953, rhsData[2] );
+            break;
+        }
+
+        case 238:
+        {
+            // list59 ::= elem59
+#line 0 "bench/work/lists_1000.lem"
+#line 2630 "bench/work/lists_1000.cpp"
+            callDtor( 953, rhsData[0] );
+            break;
+        }
+
+        case 239:
+        {
+            // elem59 ::= ATOM59
+#line 0 "bench/work/lists_1000.lem"
+#line 2639 "bench/work/lists_1000.cpp"
+            callDtor( 205, rhsData[0] );
+            break;
+        }
+
+        case 240:
+        {
+            // elem59 ::= LP59 list60 RP59
+#line 0 "bench/work/lists_1000.lem"
+#line 2648 "bench/work/lists_1000.cpp"
+            callDtor( 455, rhsData[0] );
+            callDtor( 1205, rhsData[1] );
+            callDtor( 704, rhsData[2] );
+            break;
+        }
+
+        case 241:
+        {
+            // list60 ::= list60 COMMA elem60
+#line 0 "bench/work/lists_1000.lem"
+#line 2659 "bench/work/lists_1000.cpp"
+            callDtor( 1205, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 955, rhsData[2] );
+            break;
+        }
+
+        case 242:
+        {
+            // list60 ::= elem60
+#line 0 "bench/work/lists_1000.lem"
+#line 2670 "bench/work/lists_1000.cpp"
+            callDtor( 955, rhsData[0] );
+            break;
+        }
+
+        case 243:
+        {
+            // elem60 ::= ATOM60
+#line 0 "bench/work/lists_1000.lem"
+#line 2679 "bench/work/lists_1000.cpp"
+            callDtor( 207, rhsData[0] );
+            break;
+        }
+
+        case 244:
+        {
+            // elem60 ::= LP60 list61 RP60
+#line 0 "bench/work/lists_1000.lem"
+#line 2688 "bench/work/lists_1000.cpp"
+            callDtor( 457, rhsData[0] );
+            callDtor( 1206, rhsData[1] );
+            callDtor( 706, rhsData[2] );
+            break;
+        }
+
+        case 245:
+        {
+            // list61 ::= list61 COMMA elem61
+#line 0 "bench/work/lists_1000.lem"
+#line 2699 "bench/work/lists_1000.cpp"
+            callDtor( 1206, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 956, rhsData[2] );
+            break;
+        }
+
+        case 246:
+        {
+            // list61 ::= elem61
+#line 0 "bench/work/lists_1000.lem"
+#line 2710 "bench/work/lists_1000.cpp"
+            callDtor( 956, rhsData[0] );
+            break;
+        }
+
+        case 247:
+        {
+            // elem61 ::= ATOM61
+#line 0 "bench/work/lists_1000.lem"
+#line 2719 "bench/work/lists_1000.cpp"
+            callDtor( 208, rhsData[0] );
+            break;
+        }
+
+        case 248:
+        {
+            // elem61 ::= LP61 list62 RP61
+#line 0 "bench/work/lists_1000.lem"
+#line 2728 "bench/work/lists_1000.cpp"
+            callDtor( 458, rhsData[0] );
+            callDtor( 1207, rhsData[1] );
+            callDtor( 707, rhsData[2] );
+            break;
+        }
+
+        case 249:
+        {
+            // list62 ::= list62 COMMA elem62
+#line 0 "bench/work/lists_1000.lem"
+#line 2739 "bench/work/lists_1000.cpp"
+            callDtor( 1207, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 957, rhsData[2] );
+            break;
+        }
+
+        case 250:
+        {
+            // list62 ::= elem62
+#line 0 "bench/work/lists_1000.lem"
+#line 2750 "bench/work/lists_1000.cpp"
+            callDtor( 957, rhsData[0] );
+            break;
+        }
+
+        case 251:
+        {
+            // elem62 ::= ATOM62
+#line 0 "bench/work/lists_1000.lem"
+#line 2759 "bench/work/lists_1000.cpp"
+            callDtor( 209, rhsData[0] );
+            break;
+        }
+
+        case 252:
+        {
+            // elem62 ::= LP62 list63 RP62
+#line 0 "bench/work/lists_1000.lem"
+#line 2768 "bench/work/lists_1000.cpp"
+            callDtor( 459, rhsData[0] );
+            callDtor( 1208, rhsData[1] );
+            callDtor( 708, rhsData[2] );
+            break;
+        }
+
+        case 253:
+        {
+            // list63 ::= list63 COMMA elem63
+#line 0 "bench/work/lists_1000.lem"
+#line 2779 "bench/work/lists_1000.cpp"
+            callDtor( 1208, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 958, rhsData[2] );
+            break;
+        }
+
+        case 254:
+        {
+            // list63 ::= elem63
+#line 0 "bench/work/lists_1000.lem"
+#line 2790 "bench/work/lists_1000.cpp"
+            callDtor( 958, rhsData[0] );
+            break;
+        }
+
+        case 255:
+        {
+            // elem63 ::= ATOM63
+#line 0 "bench/work/lists_1000.lem"
+#line 2799 "bench/work/lists_1000.cpp"
+            callDtor( 210, rhsData[0] );
+            break;
+        }
+
+        case 256:
+        {
+            // elem63 ::= LP63 list64 RP63
+#line 0 "bench/work/lists_1000.lem"
+#line 2808 "bench/work/lists_1000.cpp"
+            callDtor( 460, rhsData[0] );
+            callDtor( 1209, rhsData[1] );
+            callDtor( 709, rhsData[2] );
+            break;
+        }
+
+        case 257:
+        {
+            // list64 ::= list64 COMMA elem64
+#line 0 "bench/work/lists_1000.lem"
+#line 2819 "bench/work/lists_1000.cpp"
+            callDtor( 1209, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 959, rhsData[2] );
+            break;
+        }
+
+        case 258:
+        {
+            // list64 ::= elem64
+#line 0 "bench/work/lists_1000.lem"
+#line 2830 "bench/work/lists_1000.cpp"
+            callDtor( 959, rhsData[0] );
+            break;
+        }
+
+        case 259:
+        {
+            // elem64 ::= ATOM64
+#line 0 "bench/work/lists_1000.lem"
+#line 2839 "bench/work/lists_1000.cpp"
+            callDtor( 211, rhsData[0] );
+            break;
+        }
+
+        case 260:
+        {
+            // elem64 ::= LP64 list65 RP64
+#line 0 "bench/work/lists_1000.lem"
+#line 2848 "bench/work/lists_1000.cpp"
+            callDtor( 461, rhsData[0] );
+            callDtor( 1210, rhsData[1] );
+            callDtor( 710, rhsData[2] );
+            break;
+        }
+
+        case 261:
+        {
+            // list65 ::= list65 COMMA elem65
+#line 0 "bench/work/lists_1000.lem"
+#line 2859 "bench/work/lists_1000.cpp"
+            callDtor( 1210, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 960, rhsData[2] );
+            break;
+        }
+
+        case 262:
+        {
+            // list65 ::= elem65
+#line 0 "bench/work/lists_1000.lem"
+#line 2870 "bench/work/lists_1000.cpp"
+            callDtor( 960, rhsData[0] );
+            break;
+        }
+
+        case 263:
+        {
+            // elem65 ::= ATOM65
+#line 0 "bench/work/lists_1000.lem"
+#line 2879 "bench/work/lists_1000.cpp"
+            callDtor( 212, rhsData[0] );
+            break;
+        }
+
+        case 264:
+        {
+            // elem65 ::= LP65 list66 RP65
+#line 0 "bench/work/lists_1000.lem"
+#line 2888 "bench/work/lists_1000.cpp"
+            callDtor( 462, rhsData[0] );
+            callDtor( 1211, rhsData[1] );
+            callDtor( 711, rhsData[2] );
+            break;
+        }
+
+        case 265:
+        {
+            // list66 ::= list66 COMMA elem66
+#line 0 "bench/work/lists_1000.lem"
+#line 2899 "bench/work/lists_1000.cpp"
+            callDtor( 1211, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 961, rhsData[2] );
+            break;
+        }
+
+        case 266:
+        {
+            // list66 ::= elem66
+#line 0 "bench/work/lists_1000.lem"
+#line 2910 "bench/work/lists_1000.cpp"
+            callDtor( 961, rhsData[0] );
+            break;
+        }
+
+        case 267:
+        {
+            // elem66 ::= ATOM66
+#line 0 "bench/work/lists_1000.lem"
+#line 2919 "bench/work/lists_1000.cpp"
+            callDtor( 213, rhsData[0] );
+            break;
+        }
+
+        case 268:
+        {
+            // elem66 ::= LP66 list67 RP66
+#line 0 "bench/work/lists_1000.lem"
+#line 2928 "bench/work/lists_1000.cpp"
+            callDtor( 463, rhsData[0] );
+            callDtor( 1212, rhsData[1] );
+            callDtor( 712, rhsData[2] );
+            break;
+        }
+
+        case 269:
+        {
+            // list67 ::= list67 COMMA elem67
+#line 0 "bench/work/lists_1000.lem"
+#line 2939 "bench/work/lists_1000.cpp"
+            callDtor( 1212, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 962, rhsData[2] );
+            break;
+        }
+
+        case 270:
+        {
+            // list67 ::= elem67
+#line 0 "bench/work/lists_1000.lem"
+#line 2950 "bench/work/lists_1000.cpp"
+            callDtor( 962, rhsData[0] );
+            break;
+        }
+
+        case 271:
+        {
+            // elem67 ::= ATOM67
+#line 0 "bench/work/lists_1000.lem"
+#line 2959 "bench/work/lists_1000.cpp"
+            callDtor( 214, rhsData[0] );
+            break;
+        }
+
+        case 272:
+        {
+            // elem67 ::= LP67 list68 RP67
+#line 0 "bench/work/lists_1000.lem"
+#line 2968 "bench/work/lists_1000.cpp"
+            callDtor( 464, rhsData[0] );
+            callDtor( 1213, rhsData[1] );
+            callDtor( 713, rhsData[2] );
+            break;
+        }
+
+        case 273:
+        {
+            // list68 ::= list68 COMMA elem68
+#line 0 "bench/work/lists_1000.lem"
+#line 2979 "bench/work/lists_1000.cpp"
+            callDtor( 1213, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 963, rhsData[2] );
+            break;
+        }
+
+        case 274:
+        {
+            // list68 ::= elem68
+#line 0 "bench/work/lists_1000.lem"
+#line 2990 "bench/work/lists_1000.cpp"
+            callDtor( 963, rhsData[0] );
+            break;
+        }
+
+        case 275:
+        {
+            // elem68 ::= ATOM68
+#line 0 "bench/work/lists_1000.lem"
+#line 2999 "bench/work/lists_1000.cpp"
+            callDtor( 215, rhsData[0] );
+            break;
+        }
+
+        case 276:
+        {
+            // elem68 ::= LP68 list69 RP68
+#line 0 "bench/work/lists_1000.lem"
+#line 3008 "bench/work/lists_1000.cpp"
+            callDtor( 465, rhsData[0] );
+            callDtor( 1214, rhsData[1] );
+            callDtor( 714, rhsData[2] );
+            break;
+        }
+
+        case 277:
+        {
+            // list69 ::= list69 COMMA elem69
+#line 0 "bench/work/lists_1000.lem"
+#line 3019 "bench/work/lists_1000.cpp"
+            callDtor( 1214, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 964, rhsData[2] );
+            break;
+        }
+
+        case 278:
+        {
+            // list69 ::= elem69
+#line 0 "bench/work/lists_1000.lem"
+#line 3030 "bench/work/lists_1000.cpp"
+            callDtor( 964, rhsData[0] );
+            break;
+        }
+
+        case 279:
+        {
+            // elem69 ::= ATOM69
+#line 0 "bench/work/lists_1000.lem"
+#line 3039 "bench/work/lists_1000.cpp"
+            callDtor( 216, rhsData[0] );
+            break;
+        }
+
+        case 280:
+        {
+            // elem69 ::= LP69 list70 RP69
+#line 0 "bench/work/lists_1000.lem"
+#line 3048 "bench/work/lists_1000.cpp"
+            callDtor( 466, rhsData[0] );
+            callDtor( 1216, rhsData[1] );
+            callDtor( 715, rhsData[2] );
+            break;
+        }
+
+        case 281:
+        {
+            // list70 ::= list70 COMMA elem70
+#line 0 "bench/work/lists_1000.lem"
+#line 3059 "bench/work/lists_1000.cpp"
+            callDtor( 1216, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 966, rhsData[2] );
+            break;
+        }
+
+        case 282:
+        {
+            // list70 ::= elem70
+#line 0 "bench/work/lists_1000.lem"
+#line 3070 "bench/work/lists_1000.cpp"
+            callDtor( 966, rhsData[0] );
+            break;
+        }
+
+        case 283:
+        {
+            // elem70 ::= ATOM70
+#line 0 "bench/work/lists_1000.lem"
+#line 3079 "bench/work/lists_1000.cpp"
+            callDtor( 218, rhsData[0] );
+            break;
+        }
+
+        case 284:
+        {
+            // elem70 ::= LP70 list71 RP70
+#line 0 "bench/work/lists_1000.lem"
+#line 3088 "bench/work/lists_1000.cpp"
+            callDtor( 468, rhsData[0] );
+            callDtor( 1217, rhsData[1] );
+            callDtor( 717, rhsData[2] );
+            break;
+        }
+
+        case 285:
+        {
+            // list71 ::= list71 COMMA elem71
+#line 0 "bench/work/lists_1000.lem"
+#line 3099 "bench/work/lists_1000.cpp"
+            callDtor( 1217, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 967, rhsData[2] );
+            break;
+        }
+
+        case 286:
+        {
+            // list71 ::= elem71
+#line 0 "bench/work/lists_1000.lem"
+#line 3110 "bench/work/lists_1000.cpp"
+            callDtor( 967, rhsData[0] );
+            break;
+        }
+
+        case 287:
+        {
+            // elem71 ::= ATOM71
+#line 0 "bench/work/lists_1000.lem"
+#line 3119 "bench/work/lists_1000.cpp"
+            callDtor( 219, rhsData[0] );
+            break;
+        }
+
+        case 288:
+        {
+            // elem71 ::= LP71 list72 RP71
+#line 0 "bench/work/lists_1000.lem"
+#line 3128 "bench/work/lists_1000.cpp"
+            callDtor( 469, rhsData[0] );
+            callDtor( 1218, rhsData[1] );
+            callDtor( 718, rhsData[2] );
+            break;
+        }
+
+        case 289:
+        {
+            // list72 ::= list72 COMMA elem72
+#line 0 "bench/work/lists_1000.lem"
+#line 3139 "bench/work/lists_1000.cpp"
+            callDtor( 1218, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 968, rhsData[2] );
+            break;
+        }
+
+        case 290:
+        {
+            // list72 ::= elem72
+#line 0 "bench/work/lists_1000.lem"
+#line 3150 "bench/work/lists_1000.cpp"
+            callDtor( 968, rhsData[0] );
+            break;
+        }
+
+        case 291:
+        {
+            // elem72 ::= ATOM72
+#line 0 "bench/work/lists_1000.lem"
+#line 3159 "bench/work/lists_1000.cpp"
+            callDtor( 220, rhsData[0] );
+            break;
+        }
+
+        case 292:
+        {
+            // elem72 ::= LP72 list73 RP72
+#line 0 "bench/work/lists_1000.lem"
+#line 3168 "bench/work/lists_1000.cpp"
+            callDtor( 470, rhsData[0] );
+            callDtor( 1219, rhsData[1] );
+            callDtor( 719, rhsData[2] );
+            break;
+        }
+
+        case 293:
+        {
+            // list73 ::= list73 COMMA elem73
+#line 0 "bench/work/lists_1000.lem"
+#line 3179 "bench/work/lists_1000.cpp"
+            callDtor( 1219, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 969, rhsData[2] );
+            break;
+        }
+
+        case 294:
+        {
+            // list73 ::= elem73
+#line 0 "bench/work/lists_1000.lem"
+#line 3190 "bench/work/lists_1000.cpp"
+            callDtor( 969, rhsData[0] );
+            break;
+        }
+
+        case 295:
+        {
+            // elem73 ::= ATOM73
+#line 0 "bench/work/lists_1000.lem"
+#line 3199 "bench/work/lists_1000.cpp"
+            callDtor( 221, rhsData[0] );
+            break;
+        }
+
+        case 296:
+        {
+            // elem73 ::= LP73 list74 RP73
+#line 0 "bench/work/lists_1000.lem"
+#line 3208 "bench/work/lists_1000.cpp"
+            callDtor( 471, rhsData[0] );
+            callDtor( 1220, rhsData[1] );
+            callDtor( 720, rhsData[2] );
+            break;
+        }
+
+        case 297:
+        {
+            // list74 ::= list74 COMMA elem74
+#line 0 "bench/work/lists_1000.lem"
+#line 3219 "bench/work/lists_1000.cpp"
+            callDtor( 1220, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 970, rhsData[2] );
+            break;
+        }
+
+        case 298:
+        {
+            // list74 ::= elem74
+#line 0 "bench/work/lists_1000.lem"
+#line 3230 "bench/work/lists_1000.cpp"
+            callDtor( 970, rhsData[0] );
+            break;
+        }
+
+        case 299:
+        {
+            // elem74 ::= ATOM74
+#line 0 "bench/work/lists_1000.lem"
+#line 3239 "bench/work/lists_1000.cpp"
+            callDtor( 222, rhsData[0] );
+            break;
+        }
+
+        case 300:
+        {
+            // elem74 ::= LP74 list75 RP74
+#line 0 "bench/work/lists_1000.lem"
+#line 3248 "bench/work/lists_1000.cpp"
+            callDtor( 472, rhsData[0] );
+            callDtor( 1221, rhsData[1] );
+            callDtor( 721, rhsData[2] );
+            break;
+        }
+
+        case 301:
+        {
+            // list75 ::= list75 COMMA elem75
+#line 0 "bench/work/lists_1000.lem"
+#line 3259 "bench/work/lists_1000.cpp"
+            callDtor( 1221, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 971, rhsData[2] );
+            break;
+        }
+
+        case 302:
+        {
+            // list75 ::= elem75
+#line 0 "bench/work/lists_1000.lem"
+#line 3270 "bench/work/lists_1000.cpp"
+            callDtor( 971, rhsData[0] );
+            break;
+        }
+
+        case 303:
+        {
+            // elem75 ::= ATOM75
+#line 0 "bench/work/lists_1000.lem"
+#line 3279 "bench/work/lists_1000.cpp"
+            callDtor( 223, rhsData[0] );
+            break;
+        }
+
+        case 304:
+        {
+            // elem75 ::= LP75 list76 RP75
+#line 0 "bench/work/lists_1000.lem"
+#line 3288 "bench/work/lists_1000.cpp"
+            callDtor( 473, rhsData[0] );
+            callDtor( 1222, rhsData[1] );
+            callDtor( 722, rhsData[2] );
+            break;
+        }
+
+        case 305:
+        {
+            // list76 ::= list76 COMMA elem76
+#line 0 "bench/work/lists_1000.lem"
+#line 3299 "bench/work/lists_1000.cpp"
+            callDtor( 1222, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 972, rhsData[2] );
+            break;
+        }
+
+        case 306:
+        {
+            // list76 ::= elem76
+#line 0 "bench/work/lists_1000.lem"
+#line 3310 "bench/work/lists_1000.cpp"
+            callDtor( 972, rhsData[0] );
+            break;
+        }
+
+        case 307:
+        {
+            // elem76 ::= ATOM76
+#line 0 "bench/work/lists_1000.lem"
+#line 3319 "bench/work/lists_1000.cpp"
+            callDtor( 224, rhsData[0] );
+            break;
+        }
+
+        case 308:
+        {
+            // elem76 ::= LP76 list77 RP76
+#line 0 "bench/work/lists_1000.lem"
+#line 3328 "bench/work/lists_1000.cpp"
+            callDtor( 474, rhsData[0] );
+            callDtor( 1223, rhsData[1] );
+            callDtor( 723, rhsData[2] );
+            break;
+        }
+
+        case 309:
+        {
+            // list77 ::= list77 COMMA elem77
+#line 0 "bench/work/lists_1000.lem"
+#line 3339 "bench/work/lists_1000.cpp"
+            callDtor( 1223, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 973, rhsData[2] );
+            break;
+        }
+
+        case 310:
+        {
+            // list77 ::= elem77
+#line 0 "bench/work/lists_1000.lem"
+#line 3350 "bench/work/lists_1000.cpp"
+            callDtor( 973, rhsData[0] );
+            break;
+        }
+
+        case 311:
+        {
+            // elem77 ::= ATOM77
+#line 0 "bench/work/lists_1000.lem"
+#line 3359 "bench/work/lists_1000.cpp"
+            callDtor( 225, rhsData[0] );
+            break;
+        }
+
+        case 312:
+        {
+            // elem77 ::= LP77 list78 RP77
+#line 0 "bench/work/lists_1000.lem"
+#line 3368 "bench/work/lists_1000.cpp"
+            callDtor( 475, rhsData[0] );
+            callDtor( 1224, rhsData[1] );
+            callDtor( 724, rhsData[2] );
+            break;
+        }
+
+        case 313:
+        {
+            // list78 ::= list78 COMMA elem78
+#line 0 "bench/work/lists_1000.lem"
+#line 3379 "bench/work/lists_1000.cpp"
+            callDtor( 1224, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 974, rhsData[2] );
+            break;
+        }
+
+        case 314:
+        {
+            // list78 ::= elem78
+#line 0 "bench/work/lists_1000.lem"
+#line 3390 "bench/work/lists_1000.cpp"
+            callDtor( 974, rhsData[0] );
+            break;
+        }
+
+        case 315:
+        {
+            // elem78 ::= ATOM78
+#line 0 "bench/work/lists_1000.lem"
+#line 3399 "bench/work/lists_1000.cpp"
+            callDtor( 226, rhsData[0] );
+            break;
+        }
+
+        case 316:
+        {
+            // elem78 ::= LP78 list79 RP78
+#line 0 "bench/work/lists_1000.lem"
+#line 3408 "bench/work/lists_1000.cpp"
+            callDtor( 476, rhsData[0] );
+            callDtor( 1225, rhsData[1] );
+            callDtor( 725, rhsData[2] );
+            break;
+        }
+
+        case 317:
+        {
+            // list79 ::= list79 COMMA elem79
+#line 0 "bench/work/lists_1000.lem"
+#line 3419 "bench/work/lists_1000.cpp"
+            callDtor( 1225, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 975, rhsData[2] );
+            break;
+        }
+
+        case 318:
+        {
+            // list79 ::= elem79
+#line 0 "bench/work/lists_1000.lem"
+#line 3430 "bench/work/lists_1000.cpp"
+            callDtor( 975, rhsData[0] );
+            break;
+        }
+
+        case 319:
+        {
+            // elem79 ::= ATOM79
+#line 0 "bench/work/lists_1000.lem"
+#line 3439 "bench/work/lists_1000.cpp"
+            callDtor( 227, rhsData[0] );
+            break;
+        }
+
+        case 320:
+        {
+            // elem79 ::= LP79 list80 RP79
+#line 0 "bench/work/lists_1000.lem"
+#line 3448 "bench/work/lists_1000.cpp"
+            callDtor( 477, rhsData[0] );
+            callDtor( 1227, rhsData[1] );
+            callDtor( 726, rhsData[2] );
+            break;
+        }
+
+        case 321:
+        {
+            // list80 ::= list80 COMMA elem80
+#line 0 "bench/work/lists_1000.lem"
+#line 3459 "bench/work/lists_1000.cpp"
+            callDtor( 1227, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 977, rhsData[2] );
+            break;
+        }
+
+        case 322:
+        {
+            // list80 ::= elem80
+#line 0 "bench/work/lists_1000.lem"
+#line 3470 "bench/work/lists_1000.cpp"
+            callDtor( 977, rhsData[0] );
+            break;
+        }
+
+        case 323:
+        {
+            // elem80 ::= ATOM80
+#line 0 "bench/work/lists_1000.lem"
+#line 3479 "bench/work/lists_1000.cpp"
+            callDtor( 229, rhsData[0] );
+            break;
+        }
+
+        case 324:
+        {
+            // elem80 ::= LP80 list81 RP80
+#line 0 "bench/work/lists_1000.lem"
+#line 3488 "bench/work/lists_1000.cpp"
+            callDtor( 479, rhsData[0] );
+            callDtor( 1228, rhsData[1] );
+            callDtor( 728, rhsData[2] );
+            break;
+        }
+
+        case 325:
+        {
+            // list81 ::= list81 COMMA elem81
+#line 0 "bench/work/lists_1000.lem"
+#line 3499 "bench/work/lists_1000.cpp"
+            callDtor( 1228, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 978, rhsData[2] );
+            break;
+        }
+
+        case 326:
+        {
+            // list81 ::= elem81
+#line 0 "bench/work/lists_1000.lem"
+#line 3510 "bench/work/lists_1000.cpp"
+            callDtor( 978, rhsData[0] );
+            break;
+        }
+
+        case 327:
+        {
+            // elem81 ::= ATOM81
+#line 0 "bench/work/lists_1000.lem"
+#line 3519 "bench/work/lists_1000.cpp"
+            callDtor( 230, rhsData[0] );
+            break;
+        }
+
+        case 328:
+        {
+            // elem81 ::= LP81 list82 RP81
+#line 0 "bench/work/lists_1000.lem"
+#line 3528 "bench/work/lists_1000.cpp"
+            callDtor( 480, rhsData[0] );
+            callDtor( 1229, rhsData[1] );
+            callDtor( 729, rhsData[2] );
+            break;
+        }
+
+        case 329:
+        {
+            // list82 ::= list82 COMMA elem82
+#line 0 "bench/work/lists_1000.lem"
+#line 3539 "bench/work/lists_1000.cpp"
+            callDtor( 1229, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 979, rhsData[2] );
+            break;
+        }
+
+        case 330:
+        {
+            // list82 ::= elem82
+#line 0 "bench/work/lists_1000.lem"
+#line 3550 "bench/work/lists_1000.cpp"
+            callDtor( 979, rhsData[0] );
+            break;
+        }
+
+        case 331:
+        {
+            // elem82 ::= ATOM82
+#line 0 "bench/work/lists_1000.lem"
+#line 3559 "bench/work/lists_1000.cpp"
+            callDtor( 231, rhsData[0] );
+            break;
+        }
+
+        case 332:
+        {
+            // elem82 ::= LP82 list83 RP82
+#line 0 "bench/work/lists_1000.lem"
+#line 3568 "bench/work/lists_1000.cpp"
+            callDtor( 481, rhsData[0] );
+            callDtor( 1230, rhsData[1] );
+            callDtor( 730, rhsData[2] );
+            break;
+        }
+
+        case 333:
+        {
+            // list83 ::= list83 COMMA elem83
+#line 0 "bench/work/lists_1000.lem"
+#line 3579 "bench/work/lists_1000.cpp"
+            callDtor( 1230, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 980, rhsData[2] );
+            break;
+        }
+
+        case 334:
+        {
+            // list83 ::= elem83
+#line 0 "bench/work/lists_1000.lem"
+#line 3590 "bench/work/lists_1000.cpp"
+            callDtor( 980, rhsData[0] );
+            break;
+        }
+
+        case 335:
+        {
+            // elem83 ::= ATOM83
+#line 0 "bench/work/lists_1000.lem"
+#line 3599 "bench/work/lists_1000.cpp"
+            callDtor( 232, rhsData[0] );
+            break;
+        }
+
+        case 336:
+        {
+            // elem83 ::= LP83 list84 RP83
+#line 0 "bench/work/lists_1000.lem"
+#line 3608 "bench/work/lists_1000.cpp"
+            callDtor( 482, rhsData[0] );
+            callDtor( 1231, rhsData[1] );
+            callDtor( 731, rhsData[2] );
+            break;
+        }
+
+        case 337:
+        {
+            // list84 ::= list84 COMMA elem84
+#line 0 "bench/work/lists_1000.lem"
+#line 3619 "bench/work/lists_1000.cpp"
+            callDtor( 1231, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 981, rhsData[2] );
+            break;
+        }
+
+        case 338:
+        {
+            // list84 ::= elem84
+#line 0 "bench/work/lists_1000.lem"
+#line 3630 "bench/work/lists_1000.cpp"
+            callDtor( 981, rhsData[0] );
+            break;
+        }
+
+        case 339:
+        {
+            // elem84 ::= ATOM84
+#line 0 "bench/work/lists_1000.lem"
+#line 3639 "bench/work/lists_1000.cpp"
+            callDtor( 233, rhsData[0] );
+            break;
+        }
+
+        case 340:
+        {
+            // elem84 ::= LP84 list85 RP84
+#line 0 "bench/work/lists_1000.lem"
+#line 3648 "bench/work/lists_1000.cpp"
+            callDtor( 483, rhsData[0] );
+            callDtor( 1232, rhsData[1] );
+            callDtor( 732, rhsData[2] );
+            break;
+        }
+
+        case 341:
+        {
+            // list85 ::= list85 COMMA elem85
+#line 0 "bench/work/lists_1000.lem"
+#line 3659 "bench/work/lists_1000.cpp"
+            callDtor( 1232, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 982, rhsData[2] );
+            break;
+        }
+
+        case 342:
+        {
+            // list85 ::= elem85
+#line 0 "bench/work/lists_1000.lem"
+#line 3670 "bench/work/lists_1000.cpp"
+            callDtor( 982, rhsData[0] );
+            break;
+        }
+
+        case 343:
+        {
+            // elem85 ::= ATOM85
+#line 0 "bench/work/lists_1000.lem"
+#line 3679 "bench/work/lists_1000.cpp"
+            callDtor( 234, rhsData[0] );
+            break;
+        }
+
+        case 344:
+        {
+            // elem85 ::= LP85 list86 RP85
+#line 0 "bench/work/lists_1000.lem"
+#line 3688 "bench/work/lists_1000.cpp"
+            callDtor( 484, rhsData[0] );
+            callDtor( 1233, rhsData[1] );
+            callDtor( 733, rhsData[2] );
+            break;
+        }
+
+        case 345:
+        {
+            // list86 ::= list86 COMMA elem86
+#line 0 "bench/work/lists_1000.lem"
+#line 3699 "bench/work/lists_1000.cpp"
+            callDtor( 1233, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 983, rhsData[2] );
+            break;
+        }
+
+        case 346:
+        {
+            // list86 ::= elem86
+#line 0 "bench/work/lists_1000.lem"
+#line 3710 "bench/work/lists_1000.cpp"
+            callDtor( 983, rhsData[0] );
+            break;
+        }
+
+        case 347:
+        {
+            // elem86 ::= ATOM86
+#line 0 "bench/work/lists_1000.lem"
+#line 3719 "bench/work/lists_1000.cpp"
+            callDtor( 235, rhsData[0] );
+            break;
+        }
+
+        case 348:
+        {
+            // elem86 ::= LP86 list87 RP86
+#line 0 "bench/work/lists_1000.lem"
+#line 3728 "bench/work/lists_1000.cpp"
+            callDtor( 485, rhsData[0] );
+            callDtor( 1234, rhsData[1] );
+            callDtor( 734, rhsData[2] );
+            break;
+        }
+
+        case 349:
+        {
+            // list87 ::= list87 COMMA elem87
+#line 0 "bench/work/lists_1000.lem"
+#line 3739 "bench/work/lists_1000.cpp"
+            callDtor( 1234, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 984, rhsData[2] );
+            break;
+        }
+
+        case 350:
+        {
+            // list87 ::= elem87
+#line 0 "bench/work/lists_1000.lem"
+#line 3750 "bench/work/lists_1000.cpp"
+            callDtor( 984, rhsData[0] );
+            break;
+        }
+
+        case 351:
+        {
+            // elem87 ::= ATOM87
+#line 0 "bench/work/lists_1000.lem"
+#line 3759 "bench/work/lists_1000.cpp"
+            callDtor( 236, rhsData[0] );
+            break;
+        }
+
+        case 352:
+        {
+            // elem87 ::= LP87 list88 RP87
+#line 0 "bench/work/lists_1000.lem"
+#line 3768 "bench/work/lists_1000.cpp"
+            callDtor( 486, rhsData[0] );
+            callDtor( 1235, rhsData[1] );
+            callDtor( 735, rhsData[2] );
+            break;
+        }
+
+        case 353:
+        {
+            // list88 ::= list88 COMMA elem88
+#line 0 "bench/work/lists_1000.lem"
+#line 3779 "bench/work/lists_1000.cpp"
+            callDtor( 1235, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 985, rhsData[2] );
+            break;
+        }
+
+        case 354:
+        {
+            // list88 ::= elem88
+#line 0 "bench/work/lists_1000.lem"
+#line 3790 "bench/work/lists_1000.cpp"
+            callDtor( 985, rhsData[0] );
+            break;
+        }
+
+        case 355:
+        {
+            // elem88 ::= ATOM88
+#line 0 "bench/work/lists_1000.lem"
+#line 3799 "bench/work/lists_1000.cpp"
+            callDtor( 237, rhsData[0] );
+            break;
+        }
+
+        case 356:
+        {
+            // elem88 ::= LP88 list89 RP88
+#line 0 "bench/work/lists_1000.lem"
+#line 3808 "bench/work/lists_1000.cpp"
+            callDtor( 487, rhsData[0] );
+            callDtor( 1236, rhsData[1] );
+            callDtor( 736, rhsData[2] );
+            break;
+        }
+
+        case 357:
+        {
+            // list89 ::= list89 COMMA elem89
+#line 0 "bench/work/lists_1000.lem"
+#line 3819 "bench/work/lists_1000.cpp"
+            callDtor( 1236, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 986, rhsData[2] );
+            break;
+        }
+
+        case 358:
+        {
+            // list89 ::= elem89
+#line 0 "bench/work/lists_1000.lem"
+#line 3830 "bench/work/lists_1000.cpp"
+            callDtor( 986, rhsData[0] );
+            break;
+        }
+
+        case 359:
+        {
+            // elem89 ::= ATOM89
+#line 0 "bench/work/lists_1000.lem"
+#line 3839 "bench/work/lists_1000.cpp"
+            callDtor( 238, rhsData[0] );
+            break;
+        }
+
+        case 360:
+        {
+            // elem89 ::= LP89 list90 RP89
+#line 0 "bench/work/lists_1000.lem"
+#line 3848 "bench/work/lists_1000.cpp"
+            callDtor( 488, rhsData[0] );
+            callDtor( 1238, rhsData[1] );
+            callDtor( 737, rhsData[2] );
+            break;
+        }
+
+        case 361:
+        {
+            // list90 ::= list90 COMMA elem90
+#line 0 "bench/work/lists_1000.lem"
+#line 3859 "bench/work/lists_1000.cpp"
+            callDtor( 1238, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 988, rhsData[2] );
+            break;
+        }
+
+        case 362:
+        {
+            // list90 ::= elem90
+#line 0 "bench/work/lists_1000.lem"
+#line 3870 "bench/work/lists_1000.cpp"
+            callDtor( 988, rhsData[0] );
+            break;
+        }
+
+        case 363:
+        {
+            // elem90 ::= ATOM90
+#line 0 "bench/work/lists_1000.lem"
+#line 3879 "bench/work/lists_1000.cpp"
+            callDtor( 240, rhsData[0] );
+            break;
+        }
+
+        case 364:
+        {
+            // elem90 ::= LP90 list91 RP90
+#line 0 "bench/work/lists_1000.lem"
+#line 3888 "bench/work/lists_1000.cpp"
+            callDtor( 490, rhsData[0] );
+            callDtor( 1239, rhsData[1] );
+            callDtor( 739, rhsData[2] );
+            break;
+        }
+
+        case 365:
+        {
+            // list91 ::= list91 COMMA elem91
+#line 0 "bench/work/lists_1000.lem"
+#line 3899 "bench/work/lists_1000.cpp"
+            callDtor( 1239, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 989, rhsData[2] );
+            break;
+        }
+
+        case 366:
+        {
+            // list91 ::= elem91
+#line 0 "bench/work/lists_1000.lem"
+#line 3910 "bench/work/lists_1000.cpp"
+            callDtor( 989, rhsData[0] );
+            break;
+        }
+
+        case 367:
+        {
+            // elem91 ::= ATOM91
+#line 0 "bench/work/lists_1000.lem"
+#line 3919 "bench/work/lists_1000.cpp"
+            callDtor( 241, rhsData[0] );
+            break;
+        }
+
+        case 368:
+        {
+            // elem91 ::= LP91 list92 RP91
+#line 0 "bench/work/lists_1000.lem"
+#line 3928 "bench/work/lists_1000.cpp"
+            callDtor( 491, rhsData[0] );
+            callDtor( 1240, rhsData[1] );
+            callDtor( 740, rhsData[2] );
+            break;
+        }
+
+        case 369:
+        {
+            // list92 ::= list92 COMMA elem92
+#line 0 "bench/work/lists_1000.lem"
+#line 3939 "bench/work/lists_1000.cpp"
+            callDtor( 1240, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 990, rhsData[2] );
+            break;
+        }
+
+        case 370:
+        {
+            // list92 ::= elem92
+#line 0 "bench/work/lists_1000.lem"
+#line 3950 "bench/work/lists_1000.cpp"
+            callDtor( 990, rhsData[0] );
+            break;
+        }
+
+        case 371:
+        {
+            // elem92 ::= ATOM92
+#line 0 "bench/work/lists_1000.lem"
+#line 3959 "bench/work/lists_1000.cpp"
+            callDtor( 242, rhsData[0] );
+            break;
+        }
+
+        case 372:
+        {
+            // elem92 ::= LP92 list93 RP92
+#line 0 "bench/work/lists_1000.lem"
+#line 3968 "bench/work/lists_1000.cpp"
+            callDtor( 492, rhsData[0] );
+            callDtor( 1241, rhsData[1] );
+            callDtor( 741, rhsData[2] );
+            break;
+        }
+
+        case 373:
+        {
+            // list93 ::= list93 COMMA elem93
+#line 0 "bench/work/lists_1000.lem"
+#line 3979 "bench/work/lists_1000.cpp"
+            callDtor( 1241, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 991, rhsData[2] );
+            break;
+        }
+
+        case 374:
+        {
+            // list93 ::= elem93
+#line 0 "bench/work/lists_1000.lem"
+#line 3990 "bench/work/lists_1000.cpp"
+            callDtor( 991, rhsData[0] );
+            break;
+        }
+
+        case 375:
+        {
+            // elem93 ::= ATOM93
+#line 0 "bench/work/lists_1000.lem"
+#line 3999 "bench/work/lists_1000.cpp"
+            callDtor( 243, rhsData[0] );
+            break;
+        }
+
+        case 376:
+        {
+            // elem93 ::= LP93 list94 RP93
+#line 0 "bench/work/lists_1000.lem"
+#line 4008 "bench/work/lists_1000.cpp"
+            callDtor( 493, rhsData[0] );
+            callDtor( 1242, rhsData[1] );
+            callDtor( 742, rhsData[2] );
+            break;
+        }
+
+        case 377:
+        {
+            // list94 ::= list94 COMMA elem94
+#line 0 "bench/work/lists_1000.lem"
+#line 4019 "bench/work/lists_1000.cpp"
+            callDtor( 1242, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 992, rhsData[2] );
+            break;
+        }
+
+        case 378:
+        {
+            // list94 ::= elem94
+#line 0 "bench/work/lists_1000.lem"
+#line 4030 "bench/work/lists_1000.cpp"
+            callDtor( 992, rhsData[0] );
+            break;
+        }
+
+        case 379:
+        {
+            // elem94 ::= ATOM94
+#line 0 "bench/work/lists_1000.lem"
+#line 4039 "bench/work/lists_1000.cpp"
+            callDtor( 244, rhsData[0] );
+            break;
+        }
+
+        case 380:
+        {
+            // elem94 ::= LP94 list95 RP94
+#line 0 "bench/work/lists_1000.lem"
+#line 4048 "bench/work/lists_1000.cpp"
+            callDtor( 494, rhsData[0] );
+            callDtor( 1243, rhsData[1] );
+            callDtor( 743, rhsData[2] );
+            break;
+        }
+
+        case 381:
+        {
+            // list95 ::= list95 COMMA elem95
+#line 0 "bench/work/lists_1000.lem"
+#line 4059 "bench/work/lists_1000.cpp"
+            callDtor( 1243, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 993, rhsData[2] );
+            break;
+        }
+
+        case 382:
+        {
+            // list95 ::= elem95
+#line 0 "bench/work/lists_1000.lem"
+#line 4070 "bench/work/lists_1000.cpp"
+            callDtor( 993, rhsData[0] );
+            break;
+        }
+
+        case 383:
+        {
+            // elem95 ::= ATOM95
+#line 0 "bench/work/lists_1000.lem"
+#line 4079 "bench/work/lists_1000.cpp"
+            callDtor( 245, rhsData[0] );
+            break;
+        }
+
+        case 384:
+        {
+            // elem95 ::= LP95 list96 RP95
+#line 0 "bench/work/lists_1000.lem"
+#line 4088 "bench/work/lists_1000.cpp"
+            callDtor( 495, rhsData[0] );
+            callDtor( 1244, rhsData[1] );
+            callDtor( 744, rhsData[2] );
+            break;
+        }
+
+        case 385:
+        {
+            // list96 ::= list96 COMMA elem96
+#line 0 "bench/work/lists_1000.lem"
+#line 4099 "bench/work/lists_1000.cpp"
+            callDtor( 1244, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 994, rhsData[2] );
+            break;
+        }
+
+        case 386:
+        {
+            // list96 ::= elem96
+#line 0 "bench/work/lists_1000.lem"
+#line 4110 "bench/work/lists_1000.cpp"
+            callDtor( 994, rhsData[0] );
+            break;
+        }
+
+        case 387:
+        {
+            // elem96 ::= ATOM96
+#line 0 "bench/work/lists_1000.lem"
+#line 4119 "bench/work/lists_1000.cpp"
+            callDtor( 246, rhsData[0] );
+            break;
+        }
+
+        case 388:
+        {
+            // elem96 ::= LP96 list97 RP96
+#line 0 "bench/work/lists_1000.lem"
+#line 4128 "bench/work/lists_1000.cpp"
+            callDtor( 496, rhsData[0] );
+            callDtor( 1245, rhsData[1] );
+            callDtor( 745, rhsData[2] );
+            break;
+        }
+
+        case 389:
+        {
+            // list97 ::= list97 COMMA elem97
+#line 0 "bench/work/lists_1000.lem"
+#line 4139 "bench/work/lists_1000.cpp"
+            callDtor( 1245, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 995, rhsData[2] );
+            break;
+        }
+
+        case 390:
+        {
+            // list97 ::= elem97
+#line 0 "bench/work/lists_1000.lem"
+#line 4150 "bench/work/lists_1000.cpp"
+            callDtor( 995, rhsData[0] );
+            break;
+        }
+
+        case 391:
+        {
+            // elem97 ::= ATOM97
+#line 0 "bench/work/lists_1000.lem"
+#line 4159 "bench/work/lists_1000.cpp"
+            callDtor( 247, rhsData[0] );
+            break;
+        }
+
+        case 392:
+        {
+            // elem97 ::= LP97 list98 RP97
+#line 0 "bench/work/lists_1000.lem"
+#line 4168 "bench/work/lists_1000.cpp"
+            callDtor( 497, rhsData[0] );
+            callDtor( 1246, rhsData[1] );
+            callDtor( 746, rhsData[2] );
+            break;
+        }
+
+        case 393:
+        {
+            // list98 ::= list98 COMMA elem98
+#line 0 "bench/work/lists_1000.lem"
+#line 4179 "bench/work/lists_1000.cpp"
+            callDtor( 1246, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 996, rhsData[2] );
+            break;
+        }
+
+        case 394:
+        {
+            // list98 ::= elem98
+#line 0 "bench/work/lists_1000.lem"
+#line 4190 "bench/work/lists_1000.cpp"
+            callDtor( 996, rhsData[0] );
+            break;
+        }
+
+        case 395:
+        {
+            // elem98 ::= ATOM98
+#line 0 "bench/work/lists_1000.lem"
+#line 4199 "bench/work/lists_1000.cpp"
+            callDtor( 248, rhsData[0] );
+            break;
+        }
+
+        case 396:
+        {
+            // elem98 ::= LP98 list99 RP98
+#line 0 "bench/work/lists_1000.lem"
+#line 4208 "bench/work/lists_1000.cpp"
+            callDtor( 498, rhsData[0] );
+            callDtor( 1247, rhsData[1] );
+            callDtor( 747, rhsData[2] );
+            break;
+        }
+
+        case 397:
+        {
+            // list99 ::= list99 COMMA elem99
+#line 0 "bench/work/lists_1000.lem"
+#line 4219 "bench/work/lists_1000.cpp"
+            callDtor( 1247, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 997, rhsData[2] );
+            break;
+        }
+
+        case 398:
+        {
+            // list99 ::= elem99
+#line 0 "bench/work/lists_1000.lem"
+#line 4230 "bench/work/lists_1000.cpp"
+            callDtor( 997, rhsData[0] );
+            break;
+        }
+
+        case 399:
+        {
+            // elem99 ::= ATOM99
+#line 0 "bench/work/lists_1000.lem"
+#line 4239 "bench/work/lists_1000.cpp"
+            callDtor( 249, rhsData[0] );
+            break;
+        }
+
+        case 400:
+        {
+            // elem99 ::= LP99 list100 RP99
+#line 0 "bench/work/lists_1000.lem"
+#line 4248 "bench/work/lists_1000.cpp"
+            callDtor( 499, rhsData[0] );
+            callDtor( 1002, rhsData[1] );
+            callDtor( 748, rhsData[2] );
+            break;
+        }
+
+        case 401:
+        {
+            // list100 ::= list100 COMMA elem100
+#line 0 "bench/work/lists_1000.lem"
+#line 4259 "bench/work/lists_1000.cpp"
+            callDtor( 1002, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 752, rhsData[2] );
+            break;
+        }
+
+        case 402:
+        {
+            // list100 ::= elem100
+#line 0 "bench/work/lists_1000.lem"
+#line 4270 "bench/work/lists_1000.cpp"
+            callDtor( 752, rhsData[0] );
+            break;
+        }
+
+        case 403:
+        {
+            // elem100 ::= ATOM100
+#line 0 "bench/work/lists_1000.lem"
+#line 4279 "bench/work/lists_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 404:
+        {
+            // elem100 ::= LP100 list101 RP100
+#line 0 "bench/work/lists_1000.lem"
+#line 4288 "bench/work/lists_1000.cpp"
+            callDtor( 254, rhsData[0] );
+            callDtor( 1003, rhsData[1] );
+            callDtor( 503, rhsData[2] );
+            break;
+        }
+
+        case 405:
+        {
+            // list101 ::= list101 COMMA elem101
+#line 0 "bench/work/lists_1000.lem"
+#line 4299 "bench/work/lists_1000.cpp"
+            callDtor( 1003, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 753, rhsData[2] );
+            break;
+        }
+
+        case 406:
+        {
+            // list101 ::= elem101
+#line 0 "bench/work/lists_1000.lem"
+#line 4310 "bench/work/lists_1000.cpp"
+            callDtor( 753, rhsData[0] );
+            break;
+        }
+
+        case 407:
+        {
+            // elem101 ::= ATOM101
+#line 0 "bench/work/lists_1000.lem"
+#line 4319 "bench/work/lists_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 408:
+        {
+            // elem101 ::= LP101 list102 RP101
+#line 0 "bench/work/lists_1000.lem"
+#line 4328 "bench/work/lists_1000.cpp"
+            callDtor( 255, rhsData[0] );
+            callDtor( 1004, rhsData[1] );
+            callDtor( 504, rhsData[2] );
+            break;
+        }
+
+        case 409:
+        {
+            // list102 ::= list102 COMMA elem102
+#line 0 "bench/work/lists_1000.lem"
+#line 4339 "bench/work/lists_1000.cpp"
+            callDtor( 1004, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 754, rhsData[2] );
+            break;
+        }
+
+        case 410:
+        {
+            // list102 ::= elem102
+#line 0 "bench/work/lists_1000.lem"
+#line 4350 "bench/work/lists_1000.cpp"
+            callDtor( 754, rhsData[0] );
+            break;
+        }
+
+        case 411:
+        {
+            // elem102 ::= ATOM102
+#line 0 "bench/work/lists_1000.lem"
+#line 4359 "bench/work/lists_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 412:
+        {
+            // elem102 ::= LP102 list103 RP102
+#line 0 "bench/work/lists_1000.lem"
+#line 4368 "bench/work/lists_1000.cpp"
+            callDtor( 256, rhsData[0] );
+            callDtor( 1005, rhsData[1] );
+            callDtor( 505, rhsData[2] );
+            break;
+        }
+
+        case 413:
+        {
+            // list103 ::= list103 COMMA elem103
+#line 0 "bench/work/lists_1000.lem"
+#line 4379 "bench/work/lists_1000.cpp"
+            callDtor( 1005, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 755, rhsData[2] );
+            break;
+        }
+
+        case 414:
+        {
+            // list103 ::= elem103
+#line 0 "bench/work/lists_1000.lem"
+#line 4390 "bench/work/lists_1000.cpp"
+            callDtor( 755, rhsData[0] );
+            break;
+        }
+
+        case 415:
+        {
+            // elem103 ::= ATOM103
+#line 0 "bench/work/lists_1000.lem"
+#line 4399 "bench/work/lists_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 416:
+        {
+            // elem103 ::= LP103 list104 RP103
+#line 0 "bench/work/lists_1000.lem"
+#line 4408 "bench/work/lists_1000.cpp"
+            callDtor( 257, rhsData[0] );
+            callDtor( 1006, rhsData[1] );
+            callDtor( 506, rhsData[2] );
+            break;
+        }
+
+        case 417:
+        {
+            // list104 ::= list104 COMMA elem104
+#line 0 "bench/work/lists_1000.lem"
+#line 4419 "bench/work/lists_1000.cpp"
+            callDtor( 1006, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 756, rhsData[2] );
+            break;
+        }
+
+        case 418:
+        {
+            // list104 ::= elem104
+#line 0 "bench/work/lists_1000.lem"
+#line 4430 "bench/work/lists_1000.cpp"
+            callDtor( 756, rhsData[0] );
+            break;
+        }
+
+        case 419:
+        {
+            // elem104 ::= ATOM104
+#line 0 "bench/work/lists_1000.lem"
+#line 4439 "bench/work/lists_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 420:
+        {
+            // elem104 ::= LP104 list105 RP104
+#line 0 "bench/work/lists_1000.lem"
+#line 4448 "bench/work/lists_1000.cpp"
+            callDtor( 258, rhsData[0] );
+            callDtor( 1007, rhsData[1] );
+            callDtor( 507, rhsData[2] );
+            break;
+        }
+
+        case 421:
+        {
+            // list105 ::= list105 COMMA elem105
+#line 0 "bench/work/lists_1000.lem"
+#line 4459 "bench/work/lists_1000.cpp"
+            callDtor( 1007, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 757, rhsData[2] );
+            break;
+        }
+
+        case 422:
+        {
+            // list105 ::= elem105
+#line 0 "bench/work/lists_1000.lem"
+#line 4470 "bench/work/lists_1000.cpp"
+            callDtor( 757, rhsData[0] );
+            break;
+        }
+
+        case 423:
+        {
+            // elem105 ::= ATOM105
+#line 0 "bench/work/lists_1000.lem"
+#line 4479 "bench/work/lists_1000.cpp"
+            callDtor( 9, rhsData[0] );
+            break;
+        }
+
+        case 424:
+        {
+            // elem105 ::= LP105 list106 RP105
+#line 0 "bench/work/lists_1000.lem"
+#line 4488 "bench/work/lists_1000.cpp"
+            callDtor( 259, rhsData[0] );
+            callDtor( 1008, rhsData[1] );
+            callDtor( 508, rhsData[2] );
+            break;
+        }
+
+        case 425:
+        {
+            // list106 ::= list106 COMMA elem106
+#line 0 "bench/work/lists_1000.lem"
+#line 4499 "bench/work/lists_1000.cpp"
+            callDtor( 1008, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 758, rhsData[2] );
+            break;
+        }
+
+        case 426:
+        {
+            // list106 ::= elem106
+#line 0 "bench/work/lists_1000.lem"
+#line 4510 "bench/work/lists_1000.cpp"
+            callDtor( 758, rhsData[0] );
+            break;
+        }
+
+        case 427:
+        {
+            // elem106 ::= ATOM106
+#line 0 "bench/work/lists_1000.lem"
+#line 4519 "bench/work/lists_1000.cpp"
+            callDtor( 10, rhsData[0] );
+            break;
+        }
+
+        case 428:
+        {
+            // elem106 ::= LP106 list107 RP106
+#line 0 "bench/work/lists_1000.lem"
+#line 4528 "bench/work/lists_1000.cpp"
+            callDtor( 260, rhsData[0] );
+            callDtor( 1009, rhsData[1] );
+            callDtor( 509, rhsData[2] );
+            break;
+        }
+
+        case 429:
+        {
+            // list107 ::= list107 COMMA elem107
+#line 0 "bench/work/lists_1000.lem"
+#line 4539 "bench/work/lists_1000.cpp"
+            callDtor( 1009, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 759, rhsData[2] );
+            break;
+        }
+
+        case 430:
+        {
+            // list107 ::= elem107
+#line 0 "bench/work/lists_1000.lem"
+#line 4550 "bench/work/lists_1000.cpp"
+            callDtor( 759, rhsData[0] );
+            break;
+        }
+
+        case 431:
+        {
+            // elem107 ::= ATOM107
+#line 0 "bench/work/lists_1000.lem"
+#line 4559 "bench/work/lists_1000.cpp"
+            callDtor( 11, rhsData[0] );
+            break;
+        }
+
+        case 432:
+        {
+            // elem107 ::= LP107 list108 RP107
+#line 0 "bench/work/lists_1000.lem"
+#line 4568 "bench/work/lists_1000.cpp"
+            callDtor( 261, rhsData[0] );
+            callDtor( 1010, rhsData[1] );
+            callDtor( 510, rhsData[2] );
+            break;
+        }
+
+        case 433:
+        {
+            // list108 ::= list108 COMMA elem108
+#line 0 "bench/work/lists_1000.lem"
+#line 4579 "bench/work/lists_1000.cpp"
+            callDtor( 1010, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 760, rhsData[2] );
+            break;
+        }
+
+        case 434:
+        {
+            // list108 ::= elem108
+#line 0 "bench/work/lists_1000.lem"
+#line 4590 "bench/work/lists_1000.cpp"
+            callDtor( 760, rhsData[0] );
+            break;
+        }
+
+        case 435:
+        {
+            // elem108 ::= ATOM108
+#line 0 "bench/work/lists_1000.lem"
+#line 4599 "bench/work/lists_1000.cpp"
+            callDtor( 12, rhsData[0] );
+            break;
+        }
+
+        case 436:
+        {
+            // elem108 ::= LP108 list109 RP108
+#line 0 "bench/work/lists_1000.lem"
+#line 4608 "bench/work/lists_1000.cpp"
+            callDtor( 262, rhsData[0] );
+            callDtor( 1011, rhsData[1] );
+            callDtor( 511, rhsData[2] );
+            break;
+        }
+
+        case 437:
+        {
+            // list109 ::= list109 COMMA elem109
+#line 0 "bench/work/lists_1000.lem"
+#line 4619 "bench/work/lists_1000.cpp"
+            callDtor( 1011, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 761, rhsData[2] );
+            break;
+        }
+
+        case 438:
+        {
+            // list109 ::= elem109
+#line 0 "bench/work/lists_1000.lem"
+#line 4630 "bench/work/lists_1000.cpp"
+            callDtor( 761, rhsData[0] );
+            break;
+        }
+
+        case 439:
+        {
+            // elem109 ::= ATOM109
+#line 0 "bench/work/lists_1000.lem"
+#line 4639 "bench/work/lists_1000.cpp"
+            callDtor( 13, rhsData[0] );
+            break;
+        }
+
+        case 440:
+        {
+            // elem109 ::= LP109 list110 RP109
+#line 0 "bench/work/lists_1000.lem"
+#line 4648 "bench/work/lists_1000.cpp"
+            callDtor( 263, rhsData[0] );
+            callDtor( 1013, rhsData[1] );
+            callDtor( 512, rhsData[2] );
+            break;
+        }
+
+        case 441:
+        {
+            // list110 ::= list110 COMMA elem110
+#line 0 "bench/work/lists_1000.lem"
+#line 4659 "bench/work/lists_1000.cpp"
+            callDtor( 1013, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 763, rhsData[2] );
+            break;
+        }
+
+        case 442:
+        {
+            // list110 ::= elem110
+#line 0 "bench/work/lists_1000.lem"
+#line 4670 "bench/work/lists_1000.cpp"
+            callDtor( 763, rhsData[0] );
+            break;
+        }
+
+        case 443:
+        {
+            // elem110 ::= ATOM110
+#line 0 "bench/work/lists_1000.lem"
+#line 4679 "bench/work/lists_1000.cpp"
+            callDtor( 15, rhsData[0] );
+            break;
+        }
+
+        case 444:
+        {
+            // elem110 ::= LP110 list111 RP110
+#line 0 "bench/work/lists_1000.lem"
+#line 4688 "bench/work/lists_1000.cpp"
+            callDtor( 265, rhsData[0] );
+            callDtor( 1014, rhsData[1] );
+            callDtor( 514, rhsData[2] );
+            break;
+        }
+
+        case 445:
+        {
+            // list111 ::= list111 COMMA elem111
+#line 0 "bench/work/lists_1000.lem"
+#line 4699 "bench/work/lists_1000.cpp"
+            callDtor( 1014, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 764, rhsData[2] );
+            break;
+        }
+
+        case 446:
+        {
+            // list111 ::= elem111
+#line 0 "bench/work/lists_1000.lem"
+#line 4710 "bench/work/lists_1000.cpp"
+            callDtor( 764, rhsData[0] );
+            break;
+        }
+
+        case 447:
+        {
+            // elem111 ::= ATOM111
+#line 0 "bench/work/lists_1000.lem"
+#line 4719 "bench/work/lists_1000.cpp"
+            callDtor( 16, rhsData[0] );
+            break;
+        }
+
+        case 448:
+        {
+            // elem111 ::= LP111 list112 RP111
+#line 0 "bench/work/lists_1000.lem"
+#line 4728 "bench/work/lists_1000.cpp"
+            callDtor( 266, rhsData[0] );
+            callDtor( 1015, rhsData[1] );
+            callDtor( 515, rhsData[2] );
+            break;
+        }
+
+        case 449:
+        {
+            // list112 ::= list112 COMMA elem112
+#line 0 "bench/work/lists_1000.lem"
+#line 4739 "bench/work/lists_1000.cpp"
+            callDtor( 1015, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 765, rhsData[2] );
+            break;
+        }
+
+        case 450:
+        {
+            // list112 ::= elem112
+#line 0 "bench/work/lists_1000.lem"
+#line 4750 "bench/work/lists_1000.cpp"
+            callDtor( 765, rhsData[0] );
+            break;
+        }
+
+        case 451:
+        {
+            // elem112 ::= ATOM112
+#line 0 "bench/work/lists_1000.lem"
+#line 4759 "bench/work/lists_1000.cpp"
+            callDtor( 17, rhsData[0] );
+            break;
+        }
+
+        case 452:
+        {
+            // elem112 ::= LP112 list113 RP112
+#line 0 "bench/work/lists_1000.lem"
+#line 4768 "bench/work/lists_1000.cpp"
+            callDtor( 267, rhsData[0] );
+            callDtor( 1016, rhsData[1] );
+            callDtor( 516, rhsData[2] );
+            break;
+        }
+
+        case 453:
+        {
+            // list113 ::= list113 COMMA elem113
+#line 0 "bench/work/lists_1000.lem"
+#line 4779 "bench/work/lists_1000.cpp"
+            callDtor( 1016, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 766, rhsData[2] );
+            break;
+        }
+
+        case 454:
+        {
+            // list113 ::= elem113
+#line 0 "bench/work/lists_1000.lem"
+#line 4790 "bench/work/lists_1000.cpp"
+            callDtor( 766, rhsData[0] );
+            break;
+        }
+
+        case 455:
+        {
+            // elem113 ::= ATOM113
+#line 0 "bench/work/lists_1000.lem"
+#line 4799 "bench/work/lists_1000.cpp"
+            callDtor( 18, rhsData[0] );
+            break;
+        }
+
+        case 456:
+        {
+            // elem113 ::= LP113 list114 RP113
+#line 0 "bench/work/lists_1000.lem"
+#line 4808 "bench/work/lists_1000.cpp"
+            callDtor( 268, rhsData[0] );
+            callDtor( 1017, rhsData[1] );
+            callDtor( 517, rhsData[2] );
+            break;
+        }
+
+        case 457:
+        {
+            // list114 ::= list114 COMMA elem114
+#line 0 "bench/work/lists_1000.lem"
+#line 4819 "bench/work/lists_1000.cpp"
+            callDtor( 1017, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 767, rhsData[2] );
+            break;
+        }
+
+        case 458:
+        {
+            // list114 ::= elem114
+#line 0 "bench/work/lists_1000.lem"
+#line 4830 "bench/work/lists_1000.cpp"
+            callDtor( 767, rhsData[0] );
+            break;
+        }
+
+        case 459:
+        {
+            // elem114 ::= ATOM114
+#line 0 "bench/work/lists_1000.lem"
+#line 4839 "bench/work/lists_1000.cpp"
+            callDtor( 19, rhsData[0] );
+            break;
+        }
+
+        case 460:
+        {
+            // elem114 ::= LP114 list115 RP114
+#line 0 "bench/work/lists_1000.lem"
+#line 4848 "bench/work/lists_1000.cpp"
+            callDtor( 269, rhsData[0] );
+            callDtor( 1018, rhsData[1] );
+            callDtor( 518, rhsData[2] );
+            break;
+        }
+
+        case 461:
+        {
+            // list115 ::= list115 COMMA elem115
+#line 0 "bench/work/lists_1000.lem"
+#line 4859 "bench/work/lists_1000.cpp"
+            callDtor( 1018, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 768, rhsData[2] );
+            break;
+        }
+
+        case 462:
+        {
+            // list115 ::= elem115
+#line 0 "bench/work/lists_1000.lem"
+#line 4870 "bench/work/lists_1000.cpp"
+            callDtor( 768, rhsData[0] );
+            break;
+        }
+
+        case 463:
+        {
+            // elem115 ::= ATOM115
+#line 0 "bench/work/lists_1000.lem"
+#line 4879 "bench/work/lists_1000.cpp"
+            callDtor( 20, rhsData[0] );
+            break;
+        }
+
+        case 464:
+        {
+            // elem115 ::= LP115 list116 RP115
+#line 0 "bench/work/lists_1000.lem"
+#line 4888 "bench/work/lists_1000.cpp"
+            callDtor( 270, rhsData[0] );
+            callDtor( 1019, rhsData[1] );
+            callDtor( 519, rhsData[2] );
+            break;
+        }
+
+        case 465:
+        {
+            // list116 ::= list116 COMMA elem116
+#line 0 "bench/work/lists_1000.lem"
+#line 4899 "bench/work/lists_1000.cpp"
+            callDtor( 1019, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 769, rhsData[2] );
+            break;
+        }
+
+        case 466:
+        {
+            // list116 ::= elem116
+#line 0 "bench/work/lists_1000.lem"
+#line 4910 "bench/work/lists_1000.cpp"
+            callDtor( 769, rhsData[0] );
+            break;
+        }
+
+        case 467:
+        {
+            // elem116 ::= ATOM116
+#line 0 "bench/work/lists_1000.lem"
+#line 4919 "bench/work/lists_1000.cpp"
+            callDtor( 21, rhsData[0] );
+            break;
+        }
+
+        case 468:
+        {
+            // elem116 ::= LP116 list117 RP116
+#line 0 "bench/work/lists_1000.lem"
+#line 4928 "bench/work/lists_1000.cpp"
+            callDtor( 271, rhsData[0] );
+            callDtor( 1020, rhsData[1] );
+            callDtor( 520, rhsData[2] );
+            break;
+        }
+
+        case 469:
+        {
+            // list117 ::= list117 COMMA elem117
+#line 0 "bench/work/lists_1000.lem"
+#line 4939 "bench/work/lists_1000.cpp"
+            callDtor( 1020, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 770, rhsData[2] );
+            break;
+        }
+
+        case 470:
+        {
+            // list117 ::= elem117
+#line 0 "bench/work/lists_1000.lem"
+#line 4950 "bench/work/lists_1000.cpp"
+            callDtor( 770, rhsData[0] );
+            break;
+        }
+
+        case 471:
+        {
+            // elem117 ::= ATOM117
+#line 0 "bench/work/lists_1000.lem"
+#line 4959 "bench/work/lists_1000.cpp"
+            callDtor( 22, rhsData[0] );
+            break;
+        }
+
+        case 472:
+        {
+            // elem117 ::= LP117 list118 RP117
+#line 0 "bench/work/lists_1000.lem"
+#line 4968 "bench/work/lists_1000.cpp"
+            callDtor( 272, rhsData[0] );
+            callDtor( 1021, rhsData[1] );
+            callDtor( 521, rhsData[2] );
+            break;
+        }
+
+        case 473:
+        {
+            // list118 ::= list118 COMMA elem118
+#line 0 "bench/work/lists_1000.lem"
+#line 4979 "bench/work/lists_1000.cpp"
+            callDtor( 1021, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 771, rhsData[2] );
+            break;
+        }
+
+        case 474:
+        {
+            // list118 ::= elem118
+#line 0 "bench/work/lists_1000.lem"
+#line 4990 "bench/work/lists_1000.cpp"
+            callDtor( 771, rhsData[0] );
+            break;
+        }
+
+        case 475:
+        {
+            // elem118 ::= ATOM118
+#line 0 "bench/work/lists_1000.lem"
+#line 4999 "bench/work/lists_1000.cpp"
+            callDtor( 23, rhsData[0] );
+            break;
+        }
+
+        case 476:
+        {
+            // elem118 ::= LP118 list119 RP118
+#line 0 "bench/work/lists_1000.lem"
+#line 5008 "bench/work/lists_1000.cpp"
+            callDtor( 273, rhsData[0] );
+            callDtor( 1022, rhsData[1] );
+            callDtor( 522, rhsData[2] );
+            break;
+        }
+
+        case 477:
+        {
+            // list119 ::= list119 COMMA elem119
+#line 0 "bench/work/lists_1000.lem"
+#line 5019 "bench/work/lists_1000.cpp"
+            callDtor( 1022, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 772, rhsData[2] );
+            break;
+        }
+
+        case 478:
+        {
+            // list119 ::= elem119
+#line 0 "bench/work/lists_1000.lem"
+#line 5030 "bench/work/lists_1000.cpp"
+            callDtor( 772, rhsData[0] );
+            break;
+        }
+
+        case 479:
+        {
+            // elem119 ::= ATOM119
+#line 0 "bench/work/lists_1000.lem"
+#line 5039 "bench/work/lists_1000.cpp"
+            callDtor( 24, rhsData[0] );
+            break;
+        }
+
+        case 480:
+        {
+            // elem119 ::= LP119 list120 RP119
+#line 0 "bench/work/lists_1000.lem"
+#line 5048 "bench/work/lists_1000.cpp"
+            callDtor( 274, rhsData[0] );
+            callDtor( 1024, rhsData[1] );
+            callDtor( 523, rhsData[2] );
+            break;
+        }
+
+        case 481:
+        {
+            // list120 ::= list120 COMMA elem120
+#line 0 "bench/work/lists_1000.lem"
+#line 5059 "bench/work/lists_1000.cpp"
+            callDtor( 1024, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 774, rhsData[2] );
+            break;
+        }
+
+        case 482:
+        {
+            // list120 ::= elem120
+#line 0 "bench/work/lists_1000.lem"
+#line 5070 "bench/work/lists_1000.cpp"
+            callDtor( 774, rhsData[0] );
+            break;
+        }
+
+        case 483:
+        {
+            // elem120 ::= ATOM120
+#line 0 "bench/work/lists_1000.lem"
+#line 5079 "bench/work/lists_1000.cpp"
+            callDtor( 26, rhsData[0] );
+            break;
+        }
+
+        case 484:
+        {
+            // elem120 ::= LP120 list121 RP120
+#line 0 "bench/work/lists_1000.lem"
+#line 5088 "bench/work/lists_1000.cpp"
+            callDtor( 276, rhsData[0] );
+            callDtor( 1025, rhsData[1] );
+            callDtor( 525, rhsData[2] );
+            break;
+        }
+
+        case 485:
+        {
+            // list121 ::= list121 COMMA elem121
+#line 0 "bench/work/lists_1000.lem"
+#line 5099 "bench/work/lists_1000.cpp"
+            callDtor( 1025, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 775, rhsData[2] );
+            break;
+        }
+
+        case 486:
+        {
+            // list121 ::= elem121
+#line 0 "bench/work/lists_1000.lem"
+#line 5110 "bench/work/lists_1000.cpp"
+            callDtor( 775, rhsData[0] );
+            break;
+        }
+
+        case 487:
+        {
+            // elem121 ::= ATOM121
+#line 0 "bench/work/lists_1000.lem"
+#line 5119 "bench/work/lists_1000.cpp"
+            callDtor( 27, rhsData[0] );
+            break;
+        }
+
+        case 488:
+        {
+            // elem121 ::= LP121 list122 RP121
+#line 0 "bench/work/lists_1000.lem"
+#line 5128 "bench/work/lists_1000.cpp"
+            callDtor( 277, rhsData[0] );
+            callDtor( 1026, rhsData[1] );
+            callDtor( 526, rhsData[2] );
+            break;
+        }
+
+        case 489:
+        {
+            // list122 ::= list122 COMMA elem122
+#line 0 "bench/work/lists_1000.lem"
+#line 5139 "bench/work/lists_1000.cpp"
+            callDtor( 1026, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 776, rhsData[2] );
+            break;
+        }
+
+        case 490:
+        {
+            // list122 ::= elem122
+#line 0 "bench/work/lists_1000.lem"
+#line 5150 "bench/work/lists_1000.cpp"
+            callDtor( 776, rhsData[0] );
+            break;
+        }
+
+        case 491:
+        {
+            // elem122 ::= ATOM122
+#line 0 "bench/work/lists_1000.lem"
+#line 5159 "bench/work/lists_1000.cpp"
+            callDtor( 28, rhsData[0] );
+            break;
+        }
+
+        case 492:
+        {
+            // elem122 ::= LP122 list123 RP122
+#line 0 "bench/work/lists_1000.lem"
+#line 5168 "bench/work/lists_1000.cpp"
+            callDtor( 278, rhsData[0] );
+            callDtor( 1027, rhsData[1] );
+            callDtor( 527, rhsData[2] );
+            break;
+        }
+
+        case 493:
+        {
+            // list123 ::= list123 COMMA elem123
+#line 0 "bench/work/lists_1000.lem"
+#line 5179 "bench/work/lists_1000.cpp"
+            callDtor( 1027, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 777, rhsData[2] );
+            break;
+        }
+
+        case 494:
+        {
+            // list123 ::= elem123
+#line 0 "bench/work/lists_1000.lem"
+#line 5190 "bench/work/lists_1000.cpp"
+            callDtor( 777, rhsData[0] );
+            break;
+        }
+
+        case 495:
+        {
+            // elem123 ::= ATOM123
+#line 0 "bench/work/lists_1000.lem"
+#line 5199 "bench/work/lists_1000.cpp"
+            callDtor( 29, rhsData[0] );
+            break;
+        }
+
+        case 496:
+        {
+            // elem123 ::= LP123 list124 RP123
+#line 0 "bench/work/lists_1000.lem"
+#line 5208 "bench/work/lists_1000.cpp"
+            callDtor( 279, rhsData[0] );
+            callDtor( 1028, rhsData[1] );
+            callDtor( 528, rhsData[2] );
+            break;
+        }
+
+        case 497:
+        {
+            // list124 ::= list124 COMMA elem124
+#line 0 "bench/work/lists_1000.lem"
+#line 5219 "bench/work/lists_1000.cpp"
+            callDtor( 1028, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 778, rhsData[2] );
+            break;
+        }
+
+        case 498:
+        {
+            // list124 ::= elem124
+#line 0 "bench/work/lists_1000.lem"
+#line 5230 "bench/work/lists_1000.cpp"
+            callDtor( 778, rhsData[0] );
+            break;
+        }
+
+        case 499:
+        {
+            // elem124 ::= ATOM124
+#line 0 "bench/work/lists_1000.lem"
+#line 5239 "bench/work/lists_1000.cpp"
+            callDtor( 30, rhsData[0] );
+            break;
+        }
+
+        case 500:
+        {
+            // elem124 ::= LP124 list125 RP124
+#line 0 "bench/work/lists_1000.lem"
+#line 5248 "bench/work/lists_1000.cpp"
+            callDtor( 280, rhsData[0] );
+            callDtor( 1029, rhsData[1] );
+            callDtor( 529, rhsData[2] );
+            break;
+        }
+
+        case 501:
+        {
+            // list125 ::= list125 COMMA elem125
+#line 0 "bench/work/lists_1000.lem"
+#line 5259 "bench/work/lists_1000.cpp"
+            callDtor( 1029, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 779, rhsData[2] );
+            break;
+        }
+
+        case 502:
+        {
+            // list125 ::= elem125
+#line 0 "bench/work/lists_1000.lem"
+#line 5270 "bench/work/lists_1000.cpp"
+            callDtor( 779, rhsData[0] );
+            break;
+        }
+
+        case 503:
+        {
+            // elem125 ::= ATOM125
+#line 0 "bench/work/lists_1000.lem"
+#line 5279 "bench/work/lists_1000.cpp"
+            callDtor( 31, rhsData[0] );
+            break;
+        }
+
+        case 504:
+        {
+            // elem125 ::= LP125 list126 RP125
+#line 0 "bench/work/lists_1000.lem"
+#line 5288 "bench/work/lists_1000.cpp"
+            callDtor( 281, rhsData[0] );
+            callDtor( 1030, rhsData[1] );
+            callDtor( 530, rhsData[2] );
+            break;
+        }
+
+        case 505:
+        {
+            // list126 ::= list126 COMMA elem126
+#line 0 "bench/work/lists_1000.lem"
+#line 5299 "bench/work/lists_1000.cpp"
+            callDtor( 1030, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 780, rhsData[2] );
+            break;
+        }
+
+        case 506:
+        {
+            // list126 ::= elem126
+#line 0 "bench/work/lists_1000.lem"
+#line 5310 "bench/work/lists_1000.cpp"
+            callDtor( 780, rhsData[0] );
+            break;
+        }
+
+        case 507:
+        {
+            // elem126 ::= ATOM126
+#line 0 "bench/work/lists_1000.lem"
+#line 5319 "bench/work/lists_1000.cpp"
+            callDtor( 32, rhsData[0] );
+            break;
+        }
+
+        case 508:
+        {
+            // elem126 ::= LP126 list127 RP126
+#line 0 "bench/work/lists_1000.lem"
+#line 5328 "bench/work/lists_1000.cpp"
+            callDtor( 282, rhsData[0] );
+            callDtor( 1031, rhsData[1] );
+            callDtor( 531, rhsData[2] );
+            break;
+        }
+
+        case 509:
+        {
+            // list127 ::= list127 COMMA elem127
+#line 0 "bench/work/lists_1000.lem"
+#line 5339 "bench/work/lists_1000.cpp"
+            callDtor( 1031, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 781, rhsData[2] );
+            break;
+        }
+
+        case 510:
+        {
+            // list127 ::= elem127
+#line 0 "bench/work/lists_1000.lem"
+#line 5350 "bench/work/lists_1000.cpp"
+            callDtor( 781, rhsData[0] );
+            break;
+        }
+
+        case 511:
+        {
+            // elem127 ::= ATOM127
+#line 0 "bench/work/lists_1000.lem"
+#line 5359 "bench/work/lists_1000.cpp"
+            callDtor( 33, rhsData[0] );
+            break;
+        }
+
+        case 512:
+        {
+            // elem127 ::= LP127 list128 RP127
+#line 0 "bench/work/lists_1000.lem"
+#line 5368 "bench/work/lists_1000.cpp"
+            callDtor( 283, rhsData[0] );
+            callDtor( 1032, rhsData[1] );
+            callDtor( 532, rhsData[2] );
+            break;
+        }
+
+        case 513:
+        {
+            // list128 ::= list128 COMMA elem128
+#line 0 "bench/work/lists_1000.lem"
+#line 5379 "bench/work/lists_1000.cpp"
+            callDtor( 1032, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 782, rhsData[2] );
+            break;
+        }
+
+        case 514:
+        {
+            // list128 ::= elem128
+#line 0 "bench/work/lists_1000.lem"
+#line 5390 "bench/work/lists_1000.cpp"
+            callDtor( 782, rhsData[0] );
+            break;
+        }
+
+        case 515:
+        {
+            // elem128 ::= ATOM128
+#line 0 "bench/work/lists_1000.lem"
+#line 5399 "bench/work/lists_1000.cpp"
+            callDtor( 34, rhsData[0] );
+            break;
+        }
+
+        case 516:
+        {
+            // elem128 ::= LP128 list129 RP128
+#line 0 "bench/work/lists_1000.lem"
+#line 5408 "bench/work/lists_1000.cpp"
+            callDtor( 284, rhsData[0] );
+            callDtor( 1033, rhsData[1] );
+            callDtor( 533, rhsData[2] );
+            break;
+        }
+
+        case 517:
+        {
+            // list129 ::= list129 COMMA elem129
+#line 0 "bench/work/lists_1000.lem"
+#line 5419 "bench/work/lists_1000.cpp"
+            callDtor( 1033, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 783, rhsData[2] );
+            break;
+        }
+
+        case 518:
+        {
+            // list129 ::= elem129
+#line 0 "bench/work/lists_1000.lem"
+#line 5430 "bench/work/lists_1000.cpp"
+            callDtor( 783, rhsData[0] );
+            break;
+        }
+
+        case 519:
+        {
+            // elem129 ::= ATOM129
+#line 0 "bench/work/lists_1000.lem"
+#line 5439 "bench/work/lists_1000.cpp"
+            callDtor( 35, rhsData[0] );
+            break;
+        }
+
+        case 520:
+        {
+            // elem129 ::= LP129 list130 RP129
+#line 0 "bench/work/lists_1000.lem"
+#line 5448 "bench/work/lists_1000.cpp"
+            callDtor( 285, rhsData[0] );
+            callDtor( 1035, rhsData[1] );
+            callDtor( 534, rhsData[2] );
+            break;
+        }
+
+        case 521:
+        {
+            // list130 ::= list130 COMMA elem130
+#line 0 "bench/work/lists_1000.lem"
+#line 5459 "bench/work/lists_1000.cpp"
+            callDtor( 1035, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 785, rhsData[2] );
+            break;
+        }
+
+        case 522:
+        {
+            // list130 ::= elem130
+#line 0 "bench/work/lists_1000.lem"
+#line 5470 "bench/work/lists_1000.cpp"
+            callDtor( 785, rhsData[0] );
+            break;
+        }
+
+        case 523:
+        {
+            // elem130 ::= ATOM130
+#line 0 "bench/work/lists_1000.lem"
+#line 5479 "bench/work/lists_1000.cpp"
+            callDtor( 37, rhsData[0] );
+            break;
+        }
+
+        case 524:
+        {
+            // elem130 ::= LP130 list131 RP130
+#line 0 "bench/work/lists_1000.lem"
+#line 5488 "bench/work/lists_1000.cpp"
+            callDtor( 287, rhsData[0] );
+            callDtor( 1036, rhsData[1] );
+            callDtor( 536, rhsData[2] );
+            break;
+        }
+
+        case 525:
+        {
+            // list131 ::= list131 COMMA elem131
+#line 0 "bench/work/lists_1000.lem"
+#line 5499 "bench/work/lists_1000.cpp"
+            callDtor( 1036, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 786, rhsData[2] );
+            break;
+        }
+
+        case 526:
+        {
+            // list131 ::= elem131
+#line 0 "bench/work/lists_1000.lem"
+#line 5510 "bench/work/lists_1000.cpp"
+            callDtor( 786, rhsData[0] );
+            break;
+        }
+
+        case 527:
+        {
+            // elem131 ::= ATOM131
+#line 0 "bench/work/lists_1000.lem"
+#line 5519 "bench/work/lists_1000.cpp"
+            callDtor( 38, rhsData[0] );
+            break;
+        }
+
+        case 528:
+        {
+            // elem131 ::= LP131 list132 RP131
+#line 0 "bench/work/lists_1000.lem"
+#line 5528 "bench/work/lists_1000.cpp"
+            callDtor( 288, rhsData[0] );
+            callDtor( 1037, rhsData[1] );
+            callDtor( 537, rhsData[2] );
+            break;
+        }
+
+        case 529:
+        {
+            // list132 ::= list132 COMMA elem132
+#line 0 "bench/work/lists_1000.lem"
+#line 5539 "bench/work/lists_1000.cpp"
+            callDtor( 1037, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 787, rhsData[2] );
+            break;
+        }
+
+        case 530:
+        {
+            // list132 ::= elem132
+#line 0 "bench/work/lists_1000.lem"
+#line 5550 "bench/work/lists_1000.cpp"
+            callDtor( 787, rhsData[0] );
+            break;
+        }
+
+        case 531:
+        {
+            // elem132 ::= ATOM132
+#line 0 "bench/work/lists_1000.lem"
+#line 5559 "bench/work/lists_1000.cpp"
+            callDtor( 39, rhsData[0] );
+            break;
+        }
+
+        case 532:
+        {
+            // elem132 ::= LP132 list133 RP132
+#line 0 "bench/work/lists_1000.lem"
+#line 5568 "bench/work/lists_1000.cpp"
+            callDtor( 289, rhsData[0] );
+            callDtor( 1038, rhsData[1] );
+            callDtor( 538, rhsData[2] );
+            break;
+        }
+
+        case 533:
+        {
+            // list133 ::= list133 COMMA elem133
+#line 0 "bench/work/lists_1000.lem"
+#line 5579 "bench/work/lists_1000.cpp"
+            callDtor( 1038, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 788, rhsData[2] );
+            break;
+        }
+
+        case 534:
+        {
+            // list133 ::= elem133
+#line 0 "bench/work/lists_1000.lem"
+#line 5590 "bench/work/lists_1000.cpp"
+            callDtor( 788, rhsData[0] );
+            break;
+        }
+
+        case 535:
+        {
+            // elem133 ::= ATOM133
+#line 0 "bench/work/lists_1000.lem"
+#line 5599 "bench/work/lists_1000.cpp"
+            callDtor( 40, rhsData[0] );
+            break;
+        }
+
+        case 536:
+        {
+            // elem133 ::= LP133 list134 RP133
+#line 0 "bench/work/lists_1000.lem"
+#line 5608 "bench/work/lists_1000.cpp"
+            callDtor( 290, rhsData[0] );
+            callDtor( 1039, rhsData[1] );
+            callDtor( 539, rhsData[2] );
+            break;
+        }
+
+        case 537:
+        {
+            // list134 ::= list134 COMMA elem134
+#line 0 "bench/work/lists_1000.lem"
+#line 5619 "bench/work/lists_1000.cpp"
+            callDtor( 1039, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 789, rhsData[2] );
+            break;
+        }
+
+        case 538:
+        {
+            // list134 ::= elem134
+#line 0 "bench/work/lists_1000.lem"
+#line 5630 "bench/work/lists_1000.cpp"
+            callDtor( 789, rhsData[0] );
+            break;
+        }
+
+        case 539:
+        {
+            // elem134 ::= ATOM134
+#line 0 "bench/work/lists_1000.lem"
+#line 5639 "bench/work/lists_1000.cpp"
+            callDtor( 41, rhsData[0] );
+            break;
+        }
+
+        case 540:
+        {
+            // elem134 ::= LP134 list135 RP134
+#line 0 "bench/work/lists_1000.lem"
+#line 5648 "bench/work/lists_1000.cpp"
+            callDtor( 291, rhsData[0] );
+            callDtor( 1040, rhsData[1] );
+            callDtor( 540, rhsData[2] );
+            break;
+        }
+
+        case 541:
+        {
+            // list135 ::= list135 COMMA elem135
+#line 0 "bench/work/lists_1000.lem"
+#line 5659 "bench/work/lists_1000.cpp"
+            callDtor( 1040, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 790, rhsData[2] );
+            break;
+        }
+
+        case 542:
+        {
+            // list135 ::= elem135
+#line 0 "bench/work/lists_1000.lem"
+#line 5670 "bench/work/lists_1000.cpp"
+            callDtor( 790, rhsData[0] );
+            break;
+        }
+
+        case 543:
+        {
+            // elem135 ::= ATOM135
+#line 0 "bench/work/lists_1000.lem"
+#line 5679 "bench/work/lists_1000.cpp"
+            callDtor( 42, rhsData[0] );
+            break;
+        }
+
+        case 544:
+        {
+            // elem135 ::= LP135 list136 RP135
+#line 0 "bench/work/lists_1000.lem"
+#line 5688 "bench/work/lists_1000.cpp"
+            callDtor( 292, rhsData[0] );
+            callDtor( 1041, rhsData[1] );
+            callDtor( 541, rhsData[2] );
+            break;
+        }
+
+        case 545:
+        {
+            // list136 ::= list136 COMMA elem136
+#line 0 "bench/work/lists_1000.lem"
+#line 5699 "bench/work/lists_1000.cpp"
+            callDtor( 1041, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 791, rhsData[2] );
+            break;
+        }
+
+        case 546:
+        {
+            // list136 ::= elem136
+#line 0 "bench/work/lists_1000.lem"
+#line 5710 "bench/work/lists_1000.cpp"
+            callDtor( 791, rhsData[0] );
+            break;
+        }
+
+        case 547:
+        {
+            // elem136 ::= ATOM136
+#line 0 "bench/work/lists_1000.lem"
+#line 5719 "bench/work/lists_1000.cpp"
+            callDtor( 43, rhsData[0] );
+            break;
+        }
+
+        case 548:
+        {
+            // elem136 ::= LP136 list137 RP136
+#line 0 "bench/work/lists_1000.lem"
+#line 5728 "bench/work/lists_1000.cpp"
+            callDtor( 293, rhsData[0] );
+            callDtor( 1042, rhsData[1] );
+            callDtor( 542, rhsData[2] );
+            break;
+        }
+
+        case 549:
+        {
+            // list137 ::= list137 COMMA elem137
+#line 0 "bench/work/lists_1000.lem"
+#line 5739 "bench/work/lists_1000.cpp"
+            callDtor( 1042, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 792, rhsData[2] );
+            break;
+        }
+
+        case 550:
+        {
+            // list137 ::= elem137
+#line 0 "bench/work/lists_1000.lem"
+#line 5750 "bench/work/lists_1000.cpp"
+            callDtor( 792, rhsData[0] );
+            break;
+        }
+
+        case 551:
+        {
+            // elem137 ::= ATOM137
+#line 0 "bench/work/lists_1000.lem"
+#line 5759 "bench/work/lists_1000.cpp"
+            callDtor( 44, rhsData[0] );
+            break;
+        }
+
+        case 552:
+        {
+            // elem137 ::= LP137 list138 RP137
+#line 0 "bench/work/lists_1000.lem"
+#line 5768 "bench/work/lists_1000.cpp"
+            callDtor( 294, rhsData[0] );
+            callDtor( 1043, rhsData[1] );
+            callDtor( 543, rhsData[2] );
+            break;
+        }
+
+        case 553:
+        {
+            // list138 ::= list138 COMMA elem138
+#line 0 "bench/work/lists_1000.lem"
+#line 5779 "bench/work/lists_1000.cpp"
+            callDtor( 1043, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 793, rhsData[2] );
+            break;
+        }
+
+        case 554:
+        {
+            // list138 ::= elem138
+#line 0 "bench/work/lists_1000.lem"
+#line 5790 "bench/work/lists_1000.cpp"
+            callDtor( 793, rhsData[0] );
+            break;
+        }
+
+        case 555:
+        {
+            // elem138 ::= ATOM138
+#line 0 "bench/work/lists_1000.lem"
+#line 5799 "bench/work/lists_1000.cpp"
+            callDtor( 45, rhsData[0] );
+            break;
+        }
+
+        case 556:
+        {
+            // elem138 ::= LP138 list139 RP138
+#line 0 "bench/work/lists_1000.lem"
+#line 5808 "bench/work/lists_1000.cpp"
+            callDtor( 295, rhsData[0] );
+            callDtor( 1044, rhsData[1] );
+            callDtor( 544, rhsData[2] );
+            break;
+        }
+
+        case 557:
+        {
+            // list139 ::= list139 COMMA elem139
+#line 0 "bench/work/lists_1000.lem"
+#line 5819 "bench/work/lists_1000.cpp"
+            callDtor( 1044, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 794, rhsData[2] );
+            break;
+        }
+
+        case 558:
+        {
+            // list139 ::= elem139
+#line 0 "bench/work/lists_1000.lem"
+#line 5830 "bench/work/lists_1000.cpp"
+            callDtor( 794, rhsData[0] );
+            break;
+        }
+
+        case 559:
+        {
+            // elem139 ::= ATOM139
+#line 0 "bench/work/lists_1000.lem"
+#line 5839 "bench/work/lists_1000.cpp"
+            callDtor( 46, rhsData[0] );
+            break;
+        }
+
+        case 560:
+        {
+            // elem139 ::= LP139 list140 RP139
+#line 0 "bench/work/lists_1000.lem"
+#line 5848 "bench/work/lists_1000.cpp"
+            callDtor( 296, rhsData[0] );
+            callDtor( 1046, rhsData[1] );
+            callDtor( 545, rhsData[2] );
+            break;
+        }
+
+        case 561:
+        {
+            // list140 ::= list140 COMMA elem140
+#line 0 "bench/work/lists_1000.lem"
+#line 5859 "bench/work/lists_1000.cpp"
+            callDtor( 1046, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 796, rhsData[2] );
+            break;
+        }
+
+        case 562:
+        {
+            // list140 ::= elem140
+#line 0 "bench/work/lists_1000.lem"
+#line 5870 "bench/work/lists_1000.cpp"
+            callDtor( 796, rhsData[0] );
+            break;
+        }
+
+        case 563:
+        {
+            // elem140 ::= ATOM140
+#line 0 "bench/work/lists_1000.lem"
+#line 5879 "bench/work/lists_1000.cpp"
+            callDtor( 48, rhsData[0] );
+            break;
+        }
+
+        case 564:
+        {
+            // elem140 ::= LP140 list141 RP140
+#line 0 "bench/work/lists_1000.lem"
+#line 5888 "bench/work/lists_1000.cpp"
+            callDtor( 298, rhsData[0] );
+            callDtor( 1047, rhsData[1] );
+            callDtor( 547, rhsData[2] );
+            break;
+        }
+
+        case 565:
+        {
+            // list141 ::= list141 COMMA elem141
+#line 0 "bench/work/lists_1000.lem"
+#line 5899 "bench/work/lists_1000.cpp"
+            callDtor( 1047, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 797, rhsData[2] );
+            break;
+        }
+
+        case 566:
+        {
+            // list141 ::= elem141
+#line 0 "bench/work/lists_1000.lem"
+#line 5910 "bench/work/lists_1000.cpp"
+            callDtor( 797, rhsData[0] );
+            break;
+        }
+
+        case 567:
+        {
+            // elem141 ::= ATOM141
+#line 0 "bench/work/lists_1000.lem"
+#line 5919 "bench/work/lists_1000.cpp"
+            callDtor( 49, rhsData[0] );
+            break;
+        }
+
+        case 568:
+        {
+            // elem141 ::= LP141 list142 RP141
+#line 0 "bench/work/lists_1000.lem"
+#line 5928 "bench/work/lists_1000.cpp"
+            callDtor( 299, rhsData[0] );
+            callDtor( 1048, rhsData[1] );
+            callDtor( 548, rhsData[2] );
+            break;
+        }
+
+        case 569:
+        {
+            // list142 ::= list142 COMMA elem142
+#line 0 "bench/work/lists_1000.lem"
+#line 5939 "bench/work/lists_1000.cpp"
+            callDtor( 1048, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 798, rhsData[2] );
+            break;
+        }
+
+        case 570:
+        {
+            // list142 ::= elem142
+#line 0 "bench/work/lists_1000.lem"
+#line 5950 "bench/work/lists_1000.cpp"
+            callDtor( 798, rhsData[0] );
+            break;
+        }
+
+        case 571:
+        {
+            // elem142 ::= ATOM142
+#line 0 "bench/work/lists_1000.lem"
+#line 5959 "bench/work/lists_1000.cpp"
+            callDtor( 50, rhsData[0] );
+            break;
+        }
+
+        case 572:
+        {
+            // elem142 ::= LP142 list143 RP142
+#line 0 "bench/work/lists_1000.lem"
+#line 5968 "bench/work/lists_1000.cpp"
+            callDtor( 300, rhsData[0] );
+            callDtor( 1049, rhsData[1] );
+            callDtor( 549, rhsData[2] );
+            break;
+        }
+
+        case 573:
+        {
+            // list143 ::= list143 COMMA elem143
+#line 0 "bench/work/lists_1000.lem"
+#line 5979 "bench/work/lists_1000.cpp"
+            callDtor( 1049, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 799, rhsData[2] );
+            break;
+        }
+
+        case 574:
+        {
+            // list143 ::= elem143
+#line 0 "bench/work/lists_1000.lem"
+#line 5990 "bench/work/lists_1000.cpp"
+            callDtor( 799, rhsData[0] );
+            break;
+        }
+
+        case 575:
+        {
+            // elem143 ::= ATOM143
+#line 0 "bench/work/lists_1000.lem"
+#line 5999 "bench/work/lists_1000.cpp"
+            callDtor( 51, rhsData[0] );
+            break;
+        }
+
+        case 576:
+        {
+            // elem143 ::= LP143 list144 RP143
+#line 0 "bench/work/lists_1000.lem"
+#line 6008 "bench/work/lists_1000.cpp"
+            callDtor( 301, rhsData[0] );
+            callDtor( 1050, rhsData[1] );
+            callDtor( 550, rhsData[2] );
+            break;
+        }
+
+        case 577:
+        {
+            // list144 ::= list144 COMMA elem144
+#line 0 "bench/work/lists_1000.lem"
+#line 6019 "bench/work/lists_1000.cpp"
+            callDtor( 1050, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 800, rhsData[2] );
+            break;
+        }
+
+        case 578:
+        {
+            // list144 ::= elem144
+#line 0 "bench/work/lists_1000.lem"
+#line 6030 "bench/work/lists_1000.cpp"
+            callDtor( 800, rhsData[0] );
+            break;
+        }
+
+        case 579:
+        {
+            // elem144 ::= ATOM144
+#line 0 "bench/work/lists_1000.lem"
+#line 6039 "bench/work/lists_1000.cpp"
+            callDtor( 52, rhsData[0] );
+            break;
+        }
+
+        case 580:
+        {
+            // elem144 ::= LP144 list145 RP144
+#line 0 "bench/work/lists_1000.lem"
+#line 6048 "bench/work/lists_1000.cpp"
+            callDtor( 302, rhsData[0] );
+            callDtor( 1051, rhsData[1] );
+            callDtor( 551, rhsData[2] );
+            break;
+        }
+
+        case 581:
+        {
+            // list145 ::= list145 COMMA elem145
+#line 0 "bench/work/lists_1000.lem"
+#line 6059 "bench/work/lists_1000.cpp"
+            callDtor( 1051, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 801, rhsData[2] );
+            break;
+        }
+
+        case 582:
+        {
+            // list145 ::= elem145
+#line 0 "bench/work/lists_1000.lem"
+#line 6070 "bench/work/lists_1000.cpp"
+            callDtor( 801, rhsData[0] );
+            break;
+        }
+
+        case 583:
+        {
+            // elem145 ::= ATOM145
+#line 0 "bench/work/lists_1000.lem"
+#line 6079 "bench/work/lists_1000.cpp"
+            callDtor( 53, rhsData[0] );
+            break;
+        }
+
+        case 584:
+        {
+            // elem145 ::= LP145 list146 RP145
+#line 0 "bench/work/lists_1000.lem"
+#line 6088 "bench/work/lists_1000.cpp"
+            callDtor( 303, rhsData[0] );
+            callDtor( 1052, rhsData[1] );
+            callDtor( 552, rhsData[2] );
+            break;
+        }
+
+        case 585:
+        {
+            // list146 ::= list146 COMMA elem146
+#line 0 "bench/work/lists_1000.lem"
+#line 6099 "bench/work/lists_1000.cpp"
+            callDtor( 1052, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 802, rhsData[2] );
+            break;
+        }
+
+        case 586:
+        {
+            // list146 ::= elem146
+#line 0 "bench/work/lists_1000.lem"
+#line 6110 "bench/work/lists_1000.cpp"
+            callDtor( 802, rhsData[0] );
+            break;
+        }
+
+        case 587:
+        {
+            // elem146 ::= ATOM146
+#line 0 "bench/work/lists_1000.lem"
+#line 6119 "bench/work/lists_1000.cpp"
+            callDtor( 54, rhsData[0] );
+            break;
+        }
+
+        case 588:
+        {
+            // elem146 ::= LP146 list147 RP146
+#line 0 "bench/work/lists_1000.lem"
+#line 6128 "bench/work/lists_1000.cpp"
+            callDtor( 304, rhsData[0] );
+            callDtor( 1053, rhsData[1] );
+            callDtor( 553, rhsData[2] );
+            break;
+        }
+
+        case 589:
+        {
+            // list147 ::= list147 COMMA elem147
+#line 0 "bench/work/lists_1000.lem"
+#line 6139 "bench/work/lists_1000.cpp"
+            callDtor( 1053, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 803, rhsData[2] );
+            break;
+        }
+
+        case 590:
+        {
+            // list147 ::= elem147
+#line 0 "bench/work/lists_1000.lem"
+#line 6150 "bench/work/lists_1000.cpp"
+            callDtor( 803, rhsData[0] );
+            break;
+        }
+
+        case 591:
+        {
+            // elem147 ::= ATOM147
+#line 0 "bench/work/lists_1000.lem"
+#line 6159 "bench/work/lists_1000.cpp"
+            callDtor( 55, rhsData[0] );
+            break;
+        }
+
+        case 592:
+        {
+            // elem147 ::= LP147 list148 RP147
+#line 0 "bench/work/lists_1000.lem"
+#line 6168 "bench/work/lists_1000.cpp"
+            callDtor( 305, rhsData[0] );
+            callDtor( 1054, rhsData[1] );
+            callDtor( 554, rhsData[2] );
+            break;
+        }
+
+        case 593:
+        {
+            // list148 ::= list148 COMMA elem148
+#line 0 "bench/work/lists_1000.lem"
+#line 6179 "bench/work/lists_1000.cpp"
+            callDtor( 1054, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 804, rhsData[2] );
+            break;
+        }
+
+        case 594:
+        {
+            // list148 ::= elem148
+#line 0 "bench/work/lists_1000.lem"
+#line 6190 "bench/work/lists_1000.cpp"
+            callDtor( 804, rhsData[0] );
+            break;
+        }
+
+        case 595:
+        {
+            // elem148 ::= ATOM148
+#line 0 "bench/work/lists_1000.lem"
+#line 6199 "bench/work/lists_1000.cpp"
+            callDtor( 56, rhsData[0] );
+            break;
+        }
+
+        case 596:
+        {
+            // elem148 ::= LP148 list149 RP148
+#line 0 "bench/work/lists_1000.lem"
+#line 6208 "bench/work/lists_1000.cpp"
+            callDtor( 306, rhsData[0] );
+            callDtor( 1055, rhsData[1] );
+            callDtor( 555, rhsData[2] );
+            break;
+        }
+
+        case 597:
+        {
+            // list149 ::= list149 COMMA elem149
+#line 0 "bench/work/lists_1000.lem"
+#line 6219 "bench/work/lists_1000.cpp"
+            callDtor( 1055, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 805, rhsData[2] );
+            break;
+        }
+
+        case 598:
+        {
+            // list149 ::= elem149
+#line 0 "bench/work/lists_1000.lem"
+#line 6230 "bench/work/lists_1000.cpp"
+            callDtor( 805, rhsData[0] );
+            break;
+        }
+
+        case 599:
+        {
+            // elem149 ::= ATOM149
+#line 0 "bench/work/lists_1000.lem"
+#line 6239 "bench/work/lists_1000.cpp"
+            callDtor( 57, rhsData[0] );
+            break;
+        }
+
+        case 600:
+        {
+            // elem149 ::= LP149 list150 RP149
+#line 0 "bench/work/lists_1000.lem"
+#line 6248 "bench/work/lists_1000.cpp"
+            callDtor( 307, rhsData[0] );
+            callDtor( 1057, rhsData[1] );
+            callDtor( 556, rhsData[2] );
+            break;
+        }
+
+        case 601:
+        {
+            // list150 ::= list150 COMMA elem150
+#line 0 "bench/work/lists_1000.lem"
+#line 6259 "bench/work/lists_1000.cpp"
+            callDtor( 1057, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 807, rhsData[2] );
+            break;
+        }
+
+        case 602:
+        {
+            // list150 ::= elem150
+#line 0 "bench/work/lists_1000.lem"
+#line 6270 "bench/work/lists_1000.cpp"
+            callDtor( 807, rhsData[0] );
+            break;
+        }
+
+        case 603:
+        {
+            // elem150 ::= ATOM150
+#line 0 "bench/work/lists_1000.lem"
+#line 6279 "bench/work/lists_1000.cpp"
+            callDtor( 59, rhsData[0] );
+            break;
+        }
+
+        case 604:
+        {
+            // elem150 ::= LP150 list151 RP150
+#line 0 "bench/work/lists_1000.lem"
+#line 6288 "bench/work/lists_1000.cpp"
+            callDtor( 309, rhsData[0] );
+            callDtor( 1058, rhsData[1] );
+            callDtor( 558, rhsData[2] );
+            break;
+        }
+
+        case 605:
+        {
+            // list151 ::= list151 COMMA elem151
+#line 0 "bench/work/lists_1000.lem"
+#line 6299 "bench/work/lists_1000.cpp"
+            callDtor( 1058, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 808, rhsData[2] );
+            break;
+        }
+
+        case 606:
+        {
+            // list151 ::= elem151
+#line 0 "bench/work/lists_1000.lem"
+#line 6310 "bench/work/lists_1000.cpp"
+            callDtor( 808, rhsData[0] );
+            break;
+        }
+
+        case 607:
+        {
+            // elem151 ::= ATOM151
+#line 0 "bench/work/lists_1000.lem"
+#line 6319 "bench/work/lists_1000.cpp"
+            callDtor( 60, rhsData[0] );
+            break;
+        }
+
+        case 608:
+        {
+            // elem151 ::= LP151 list152 RP151
+#line 0 "bench/work/lists_1000.lem"
+#line 6328 "bench/work/lists_1000.cpp"
+            callDtor( 310, rhsData[0] );
+            callDtor( 1059, rhsData[1] );
+            callDtor( 559, rhsData[2] );
+            break;
+        }
+
+        case 609:
+        {
+            // list152 ::= list152 COMMA elem152
+#line 0 "bench/work/lists_1000.lem"
+#line 6339 "bench/work/lists_1000.cpp"
+            callDtor( 1059, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 809, rhsData[2] );
+            break;
+        }
+
+        case 610:
+        {
+            // list152 ::= elem152
+#line 0 "bench/work/lists_1000.lem"
+#line 6350 "bench/work/lists_1000.cpp"
+            callDtor( 809, rhsData[0] );
+            break;
+        }
+
+        case 611:
+        {
+            // elem152 ::= ATOM152
+#line 0 "bench/work/lists_1000.lem"
+#line 6359 "bench/work/lists_1000.cpp"
+            callDtor( 61, rhsData[0] );
+            break;
+        }
+
+        case 612:
+        {
+            // elem152 ::= LP152 list153 RP152
+#line 0 "bench/work/lists_1000.lem"
+#line 6368 "bench/work/lists_1000.cpp"
+            callDtor( 311, rhsData[0] );
+            callDtor( 1060, rhsData[1] );
+            callDtor( 560, rhsData[2] );
+            break;
+        }
+
+        case 613:
+        {
+            // list153 ::= list153 COMMA elem153
+#line 0 "bench/work/lists_1000.lem"
+#line 6379 "bench/work/lists_1000.cpp"
+            callDtor( 1060, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 810, rhsData[2] );
+            break;
+        }
+
+        case 614:
+        {
+            // list153 ::= elem153
+#line 0 "bench/work/lists_1000.lem"
+#line 6390 "bench/work/lists_1000.cpp"
+            callDtor( 810, rhsData[0] );
+            break;
+        }
+
+        case 615:
+        {
+            // elem153 ::= ATOM153
+#line 0 "bench/work/lists_1000.lem"
+#line 6399 "bench/work/lists_1000.cpp"
+            callDtor( 62, rhsData[0] );
+            break;
+        }
+
+        case 616:
+        {
+            // elem153 ::= LP153 list154 RP153
+#line 0 "bench/work/lists_1000.lem"
+#line 6408 "bench/work/lists_1000.cpp"
+            callDtor( 312, rhsData[0] );
+            callDtor( 1061, rhsData[1] );
+            callDtor( 561, rhsData[2] );
+            break;
+        }
+
+        case 617:
+        {
+            // list154 ::= list154 COMMA elem154
+#line 0 "bench/work/lists_1000.lem"
+#line 6419 "bench/work/lists_1000.cpp"
+            callDtor( 1061, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 811, rhsData[2] );
+            break;
+        }
+
+        case 618:
+        {
+            // list154 ::= elem154
+#line 0 "bench/work/lists_1000.lem"
+#line 6430 "bench/work/lists_1000.cpp"
+            callDtor( 811, rhsData[0] );
+            break;
+        }
+
+        case 619:
+        {
+            // elem154 ::= ATOM154
+#line 0 "bench/work/lists_1000.lem"
+#line 6439 "bench/work/lists_1000.cpp"
+            callDtor( 63, rhsData[0] );
+            break;
+        }
+
+        case 620:
+        {
+            // elem154 ::= LP154 list155 RP154
+#line 0 "bench/work/lists_1000.lem"
+#line 6448 "bench/work/lists_1000.cpp"
+            callDtor( 313, rhsData[0] );
+            callDtor( 1062, rhsData[1] );
+            callDtor( 562, rhsData[2] );
+            break;
+        }
+
+        case 621:
+        {
+            // list155 ::= list155 COMMA elem155
+#line 0 "bench/work/lists_1000.lem"
+#line 6459 "bench/work/lists_1000.cpp"
+            callDtor( 1062, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 812, rhsData[2] );
+            break;
+        }
+
+        case 622:
+        {
+            // list155 ::= elem155
+#line 0 "bench/work/lists_1000.lem"
+#line 6470 "bench/work/lists_1000.cpp"
+            callDtor( 812, rhsData[0] );
+            break;
+        }
+
+        case 623:
+        {
+            // elem155 ::= ATOM155
+#line 0 "bench/work/lists_1000.lem"
+#line 6479 "bench/work/lists_1000.cpp"
+            callDtor( 64, rhsData[0] );
+            break;
+        }
+
+        case 624:
+        {
+            // elem155 ::= LP155 list156 RP155
+#line 0 "bench/work/lists_1000.lem"
+#line 6488 "bench/work/lists_1000.cpp"
+            callDtor( 314, rhsData[0] );
+            callDtor( 1063, rhsData[1] );
+            callDtor( 563, rhsData[2] );
+            break;
+        }
+
+        case 625:
+        {
+            // list156 ::= list156 COMMA elem156
+#line 0 "bench/work/lists_1000.lem"
+#line 6499 "bench/work/lists_1000.cpp"
+            callDtor( 1063, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 813, rhsData[2] );
+            break;
+        }
+
+        case 626:
+        {
+            // list156 ::= elem156
+#line 0 "bench/work/lists_1000.lem"
+#line 6510 "bench/work/lists_1000.cpp"
+            callDtor( 813, rhsData[0] );
+            break;
+        }
+
+        case 627:
+        {
+            // elem156 ::= ATOM156
+#line 0 "bench/work/lists_1000.lem"
+#line 6519 "bench/work/lists_1000.cpp"
+            callDtor( 65, rhsData[0] );
+            break;
+        }
+
+        case 628:
+        {
+            // elem156 ::= LP156 list157 RP156
+#line 0 "bench/work/lists_1000.lem"
+#line 6528 "bench/work/lists_1000.cpp"
+            callDtor( 315, rhsData[0] );
+            callDtor( 1064, rhsData[1] );
+            callDtor( 564, rhsData[2] );
+            break;
+        }
+
+        case 629:
+        {
+            // list157 ::= list157 COMMA elem157
+#line 0 "bench/work/lists_1000.lem"
+#line 6539 "bench/work/lists_1000.cpp"
+            callDtor( 1064, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 814, rhsData[2] );
+            break;
+        }
+
+        case 630:
+        {
+            // list157 ::= elem157
+#line 0 "bench/work/lists_1000.lem"
+#line 6550 "bench/work/lists_1000.cpp"
+            callDtor( 814, rhsData[0] );
+            break;
+        }
+
+        case 631:
+        {
+            // elem157 ::= ATOM157
+#line 0 "bench/work/lists_1000.lem"
+#line 6559 "bench/work/lists_1000.cpp"
+            callDtor( 66, rhsData[0] );
+            break;
+        }
+
+        case 632:
+        {
+            // elem157 ::= LP157 list158 RP157
+#line 0 "bench/work/lists_1000.lem"
+#line 6568 "bench/work/lists_1000.cpp"
+            callDtor( 316, rhsData[0] );
+            callDtor( 1065, rhsData[1] );
+            callDtor( 565, rhsData[2] );
+            break;
+        }
+
+        case 633:
+        {
+            // list158 ::= list158 COMMA elem158
+#line 0 "bench/work/lists_1000.lem"
+#line 6579 "bench/work/lists_1000.cpp"
+            callDtor( 1065, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 815, rhsData[2] );
+            break;
+        }
+
+        case 634:
+        {
+            // list158 ::= elem158
+#line 0 "bench/work/lists_1000.lem"
+#line 6590 "bench/work/lists_1000.cpp"
+            callDtor( 815, rhsData[0] );
+            break;
+        }
+
+        case 635:
+        {
+            // elem158 ::= ATOM158
+#line 0 "bench/work/lists_1000.lem"
+#line 6599 "bench/work/lists_1000.cpp"
+            callDtor( 67, rhsData[0] );
+            break;
+        }
+
+        case 636:
+        {
+            // elem158 ::= LP158 list159 RP158
+#line 0 "bench/work/lists_1000.lem"
+#line 6608 "bench/work/lists_1000.cpp"
+            callDtor( 317, rhsData[0] );
+            callDtor( 1066, rhsData[1] );
+            callDtor( 566, rhsData[2] );
+            break;
+        }
+
+        case 637:
+        {
+            // list159 ::= list159 COMMA elem159
+#line 0 "bench/work/lists_1000.lem"
+#line 6619 "bench/work/lists_1000.cpp"
+            callDtor( 1066, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 816, rhsData[2] );
+            break;
+        }
+
+        case 638:
+        {
+            // list159 ::= elem159
+#line 0 "bench/work/lists_1000.lem"
+#line 6630 "bench/work/lists_1000.cpp"
+            callDtor( 816, rhsData[0] );
+            break;
+        }
+
+        case 639:
+        {
+            // elem159 ::= ATOM159
+#line 0 "bench/work/lists_1000.lem"
+#line 6639 "bench/work/lists_1000.cpp"
+            callDtor( 68, rhsData[0] );
+            break;
+        }
+
+        case 640:
+        {
+            // elem159 ::= LP159 list160 RP159
+#line 0 "bench/work/lists_1000.lem"
+#line 6648 "bench/work/lists_1000.cpp"
+            callDtor( 318, rhsData[0] );
+            callDtor( 1068, rhsData[1] );
+            callDtor( 567, rhsData[2] );
+            break;
+        }
+
+        case 641:
+        {
+            // list160 ::= list160 COMMA elem160
+#line 0 "bench/work/lists_1000.lem"
+#line 6659 "bench/work/lists_1000.cpp"
+            callDtor( 1068, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 818, rhsData[2] );
+            break;
+        }
+
+        case 642:
+        {
+            // list160 ::= elem160
+#line 0 "bench/work/lists_1000.lem"
+#line 6670 "bench/work/lists_1000.cpp"
+            callDtor( 818, rhsData[0] );
+            break;
+        }
+
+        case 643:
+        {
+            // elem160 ::= ATOM160
+#line 0 "bench/work/lists_1000.lem"
+#line 6679 "bench/work/lists_1000.cpp"
+            callDtor( 70, rhsData[0] );
+            break;
+        }
+
+        case 644:
+        {
+            // elem160 ::= LP160 list161 RP160
+#line 0 "bench/work/lists_1000.lem"
+#line 6688 "bench/work/lists_1000.cpp"
+            callDtor( 320, rhsData[0] );
+            callDtor( 1069, rhsData[1] );
+            callDtor( 569, rhsData[2] );
+            break;
+        }
+
+        case 645:
+        {
+            // list161 ::= list161 COMMA elem161
+#line 0 "bench/work/lists_1000.lem"
+#line 6699 "bench/work/lists_1000.cpp"
+            callDtor( 1069, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 819, rhsData[2] );
+            break;
+        }
+
+        case 646:
+        {
+            // list161 ::= elem161
+#line 0 "bench/work/lists_1000.lem"
+#line 6710 "bench/work/lists_1000.cpp"
+            callDtor( 819, rhsData[0] );
+            break;
+        }
+
+        case 647:
+        {
+            // elem161 ::= ATOM161
+#line 0 "bench/work/lists_1000.lem"
+#line 6719 "bench/work/lists_1000.cpp"
+            callDtor( 71, rhsData[0] );
+            break;
+        }
+
+        case 648:
+        {
+            // elem161 ::= LP161 list162 RP161
+#line 0 "bench/work/lists_1000.lem"
+#line 6728 "bench/work/lists_1000.cpp"
+            callDtor( 321, rhsData[0] );
+            callDtor( 1070, rhsData[1] );
+            callDtor( 570, rhsData[2] );
+            break;
+        }
+
+        case 649:
+        {
+            // list162 ::= list162 COMMA elem162
+#line 0 "bench/work/lists_1000.lem"
+#line 6739 "bench/work/lists_1000.cpp"
+            callDtor( 1070, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 820, rhsData[2] );
+            break;
+        }
+
+        case 650:
+        {
+            // list162 ::= elem162
+#line 0 "bench/work/lists_1000.lem"
+#line 6750 "bench/work/lists_1000.cpp"
+            callDtor( 820, rhsData[0] );
+            break;
+        }
+
+        case 651:
+        {
+            // elem162 ::= ATOM162
+#line 0 "bench/work/lists_1000.lem"
+#line 6759 "bench/work/lists_1000.cpp"
+            callDtor( 72, rhsData[0] );
+            break;
+        }
+
+        case 652:
+        {
+            // elem162 ::= LP162 list163 RP162
+#line 0 "bench/work/lists_1000.lem"
+#line 6768 "bench/work/lists_1000.cpp"
+            callDtor( 322, rhsData[0] );
+            callDtor( 1071, rhsData[1] );
+            callDtor( 571, rhsData[2] );
+            break;
+        }
+
+        case 653:
+        {
+            // list163 ::= list163 COMMA elem163
+#line 0 "bench/work/lists_1000.lem"
+#line 6779 "bench/work/lists_1000.cpp"
+            callDtor( 1071, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 821, rhsData[2] );
+            break;
+        }
+
+        case 654:
+        {
+            // list163 ::= elem163
+#line 0 "bench/work/lists_1000.lem"
+#line 6790 "bench/work/lists_1000.cpp"
+            callDtor( 821, rhsData[0] );
+            break;
+        }
+
+        case 655:
+        {
+            // elem163 ::= ATOM163
+#line 0 "bench/work/lists_1000.lem"
+#line 6799 "bench/work/lists_1000.cpp"
+            callDtor( 73, rhsData[0] );
+            break;
+        }
+
+        case 656:
+        {
+            // elem163 ::= LP163 list164 RP163
+#line 0 "bench/work/lists_1000.lem"
+#line 6808 "bench/work/lists_1000.cpp"
+            callDtor( 323, rhsData[0] );
+            callDtor( 1072, rhsData[1] );
+            callDtor( 572, rhsData[2] );
+            break;
+        }
+
+        case 657:
+        {
+            // list164 ::= list164 COMMA elem164
+#line 0 "bench/work/lists_1000.lem"
+#line 6819 "bench/work/lists_1000.cpp"
+            callDtor( 1072, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 822, rhsData[2] );
+            break;
+        }
+
+        case 658:
+        {
+            // list164 ::= elem164
+#line 0 "bench/work/lists_1000.lem"
+#line 6830 "bench/work/lists_1000.cpp"
+            callDtor( 822, rhsData[0] );
+            break;
+        }
+
+        case 659:
+        {
+            // elem164 ::= ATOM164
+#line 0 "bench/work/lists_1000.lem"
+#line 6839 "bench/work/lists_1000.cpp"
+            callDtor( 74, rhsData[0] );
+            break;
+        }
+
+        case 660:
+        {
+            // elem164 ::= LP164 list165 RP164
+#line 0 "bench/work/lists_1000.lem"
+#line 6848 "bench/work/lists_1000.cpp"
+            callDtor( 324, rhsData[0] );
+            callDtor( 1073, rhsData[1] );
+            callDtor( 573, rhsData[2] );
+            break;
+        }
+
+        case 661:
+        {
+            // list165 ::= list165 COMMA elem165
+#line 0 "bench/work/lists_1000.lem"
+#line 6859 "bench/work/lists_1000.cpp"
+            callDtor( 1073, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 823, rhsData[2] );
+            break;
+        }
+
+        case 662:
+        {
+            // list165 ::= elem165
+#line 0 "bench/work/lists_1000.lem"
+#line 6870 "bench/work/lists_1000.cpp"
+            callDtor( 823, rhsData[0] );
+            break;
+        }
+
+        case 663:
+        {
+            // elem165 ::= ATOM165
+#line 0 "bench/work/lists_1000.lem"
+#line 6879 "bench/work/lists_1000.cpp"
+            callDtor( 75, rhsData[0] );
+            break;
+        }
+
+        case 664:
+        {
+            // elem165 ::= LP165 list166 RP165
+#line 0 "bench/work/lists_1000.lem"
+#line 6888 "bench/work/lists_1000.cpp"
+            callDtor( 325, rhsData[0] );
+            callDtor( 1074, rhsData[1] );
+            callDtor( 574, rhsData[2] );
+            break;
+        }
+
+        case 665:
+        {
+            // list166 ::= list166 COMMA elem166
+#line 0 "bench/work/lists_1000.lem"
+#line 6899 "bench/work/lists_1000.cpp"
+            callDtor( 1074, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 824, rhsData[2] );
+            break;
+        }
+
+        case 666:
+        {
+            // list166 ::= elem166
+#line 0 "bench/work/lists_1000.lem"
+#line 6910 "bench/work/lists_1000.cpp"
+            callDtor( 824, rhsData[0] );
+            break;
+        }
+
+        case 667:
+        {
+            // elem166 ::= ATOM166
+#line 0 "bench/work/lists_1000.lem"
+#line 6919 "bench/work/lists_1000.cpp"
+            callDtor( 76, rhsData[0] );
+            break;
+        }
+
+        case 668:
+        {
+            // elem166 ::= LP166 list167 RP166
+#line 0 "bench/work/lists_1000.lem"
+#line 6928 "bench/work/lists_1000.cpp"
+            callDtor( 326, rhsData[0] );
+            callDtor( 1075, rhsData[1] );
+            callDtor( 575, rhsData[2] );
+            break;
+        }
+
+        case 669:
+        {
+            // list167 ::= list167 COMMA elem167
+#line 0 "bench/work/lists_1000.lem"
+#line 6939 "bench/work/lists_1000.cpp"
+            callDtor( 1075, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 825, rhsData[2] );
+            break;
+        }
+
+        case 670:
+        {
+            // list167 ::= elem167
+#line 0 "bench/work/lists_1000.lem"
+#line 6950 "bench/work/lists_1000.cpp"
+            callDtor( 825, rhsData[0] );
+            break;
+        }
+
+        case 671:
+        {
+            // elem167 ::= ATOM167
+#line 0 "bench/work/lists_1000.lem"
+#line 6959 "bench/work/lists_1000.cpp"
+            callDtor( 77, rhsData[0] );
+            break;
+        }
+
+        case 672:
+        {
+            // elem167 ::= LP167 list168 RP167
+#line 0 "bench/work/lists_1000.lem"
+#line 6968 "bench/work/lists_1000.cpp"
+            callDtor( 327, rhsData[0] );
+            callDtor( 1076, rhsData[1] );
+            callDtor( 576, rhsData[2] );
+            break;
+        }
+
+        case 673:
+        {
+            // list168 ::= list168 COMMA elem168
+#line 0 "bench/work/lists_1000.lem"
+#line 6979 "bench/work/lists_1000.cpp"
+            callDtor( 1076, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 826, rhsData[2] );
+            break;
+        }
+
+        case 674:
+        {
+            // list168 ::= elem168
+#line 0 "bench/work/lists_1000.lem"
+#line 6990 "bench/work/lists_1000.cpp"
+            callDtor( 826, rhsData[0] );
+            break;
+        }
+
+        case 675:
+        {
+            // elem168 ::= ATOM168
+#line 0 "bench/work/lists_1000.lem"
+#line 6999 "bench/work/lists_1000.cpp"
+            callDtor( 78, rhsData[0] );
+            break;
+        }
+
+        case 676:
+        {
+            // elem168 ::= LP168 list169 RP168
+#line 0 "bench/work/lists_1000.lem"
+#line 7008 "bench/work/lists_1000.cpp"
+            callDtor( 328, rhsData[0] );
+            callDtor( 1077, rhsData[1] );
+            callDtor( 577, rhsData[2] );
+            break;
+        }
+
+        case 677:
+        {
+            // list169 ::= list169 COMMA elem169
+#line 0 "bench/work/lists_1000.lem"
+#line 7019 "bench/work/lists_1000.cpp"
+            callDtor( 1077, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 827, rhsData[2] );
+            break;
+        }
+
+        case 678:
+        {
+            // list169 ::= elem169
+#line 0 "bench/work/lists_1000.lem"
+#line 7030 "bench/work/lists_1000.cpp"
+            callDtor( 827, rhsData[0] );
+            break;
+        }
+
+        case 679:
+        {
+            // elem169 ::= ATOM169
+#line 0 "bench/work/lists_1000.lem"
+#line 7039 "bench/work/lists_1000.cpp"
+            callDtor( 79, rhsData[0] );
+            break;
+        }
+
+        case 680:
+        {
+            // elem169 ::= LP169 list170 RP169
+#line 0 "bench/work/lists_1000.lem"
+#line 7048 "bench/work/lists_1000.cpp"
+            callDtor( 329, rhsData[0] );
+            callDtor( 1079, rhsData[1] );
+            callDtor( 578, rhsData[2] );
+            break;
+        }
+
+        case 681:
+        {
+            // list170 ::= list170 COMMA elem170
+#line 0 "bench/work/lists_1000.lem"
+#line 7059 "bench/work/lists_1000.cpp"
+            callDtor( 1079, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 829, rhsData[2] );
+            break;
+        }
+
+        case 682:
+        {
+            // list170 ::= elem170
+#line 0 "bench/work/lists_1000.lem"
+#line 7070 "bench/work/lists_1000.cpp"
+            callDtor( 829, rhsData[0] );
+            break;
+        }
+
+        case 683:
+        {
+            // elem170 ::= ATOM170
+#line 0 "bench/work/lists_1000.lem"
+#line 7079 "bench/work/lists_1000.cpp"
+            callDtor( 81, rhsData[0] );
+            break;
+        }
+
+        case 684:
+        {
+            // elem170 ::= LP170 list171 RP170
+#line 0 "bench/work/lists_1000.lem"
+#line 7088 "bench/work/lists_1000.cpp"
+            callDtor( 331, rhsData[0] );
+            callDtor( 1080, rhsData[1] );
+            callDtor( 580, rhsData[2] );
+            break;
+        }
+
+        case 685:
+        {
+            // list171 ::= list171 COMMA elem171
+#line 0 "bench/work/lists_1000.lem"
+#line 7099 "bench/work/lists_1000.cpp"
+            callDtor( 1080, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 830, rhsData[2] );
+            break;
+        }
+
+        case 686:
+        {
+            // list171 ::= elem171
+#line 0 "bench/work/lists_1000.lem"
+#line 7110 "bench/work/lists_1000.cpp"
+            callDtor( 830, rhsData[0] );
+            break;
+        }
+
+        case 687:
+        {
+            // elem171 ::= ATOM171
+#line 0 "bench/work/lists_1000.lem"
+#line 7119 "bench/work/lists_1000.cpp"
+            callDtor( 82, rhsData[0] );
+            break;
+        }
+
+        case 688:
+        {
+            // elem171 ::= LP171 list172 RP171
+#line 0 "bench/work/lists_1000.lem"
+#line 7128 "bench/work/lists_1000.cpp"
+            callDtor( 332, rhsData[0] );
+            callDtor( 1081, rhsData[1] );
+            callDtor( 581, rhsData[2] );
+            break;
+        }
+
+        case 689:
+        {
+            // list172 ::= list172 COMMA elem172
+#line 0 "bench/work/lists_1000.lem"
+#line 7139 "bench/work/lists_1000.cpp"
+            callDtor( 1081, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 831, rhsData[2] );
+            break;
+        }
+
+        case 690:
+        {
+            // list172 ::= elem172
+#line 0 "bench/work/lists_1000.lem"
+#line 7150 "bench/work/lists_1000.cpp"
+            callDtor( 831, rhsData[0] );
+            break;
+        }
+
+        case 691:
+        {
+            // elem172 ::= ATOM172
+#line 0 "bench/work/lists_1000.lem"
+#line 7159 "bench/work/lists_1000.cpp"
+            callDtor( 83, rhsData[0] );
+            break;
+        }
+
+        case 692:
+        {
+            // elem172 ::= LP172 list173 RP172
+#line 0 "bench/work/lists_1000.lem"
+#line 7168 "bench/work/lists_1000.cpp"
+            callDtor( 333, rhsData[0] );
+            callDtor( 1082, rhsData[1] );
+            callDtor( 582, rhsData[2] );
+            break;
+        }
+
+        case 693:
+        {
+            // list173 ::= list173 COMMA elem173
+#line 0 "bench/work/lists_1000.lem"
+#line 7179 "bench/work/lists_1000.cpp"
+            callDtor( 1082, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 832, rhsData[2] );
+            break;
+        }
+
+        case 694:
+        {
+            // list173 ::= elem173
+#line 0 "bench/work/lists_1000.lem"
+#line 7190 "bench/work/lists_1000.cpp"
+            callDtor( 832, rhsData[0] );
+            break;
+        }
+
+        case 695:
+        {
+            // elem173 ::= ATOM173
+#line 0 "bench/work/lists_1000.lem"
+#line 7199 "bench/work/lists_1000.cpp"
+            callDtor( 84, rhsData[0] );
+            break;
+        }
+
+        case 696:
+        {
+            // elem173 ::= LP173 list174 RP173
+#line 0 "bench/work/lists_1000.lem"
+#line 7208 "bench/work/lists_1000.cpp"
+            callDtor( 334, rhsData[0] );
+            callDtor( 1083, rhsData[1] );
+            callDtor( 583, rhsData[2] );
+            break;
+        }
+
+        case 697:
+        {
+            // list174 ::= list174 COMMA elem174
+#line 0 "bench/work/lists_1000.lem"
+#line 7219 "bench/work/lists_1000.cpp"
+            callDtor( 1083, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 833, rhsData[2] );
+            break;
+        }
+
+        case 698:
+        {
+            // list174 ::= elem174
+#line 0 "bench/work/lists_1000.lem"
+#line 7230 "bench/work/lists_1000.cpp"
+            callDtor( 833, rhsData[0] );
+            break;
+        }
+
+        case 699:
+        {
+            // elem174 ::= ATOM174
+#line 0 "bench/work/lists_1000.lem"
+#line 7239 "bench/work/lists_1000.cpp"
+            callDtor( 85, rhsData[0] );
+            break;
+        }
+
+        case 700:
+        {
+            // elem174 ::= LP174 list175 RP174
+#line 0 "bench/work/lists_1000.lem"
+#line 7248 "bench/work/lists_1000.cpp"
+            callDtor( 335, rhsData[0] );
+            callDtor( 1084, rhsData[1] );
+            callDtor( 584, rhsData[2] );
+            break;
+        }
+
+        case 701:
+        {
+            // list175 ::= list175 COMMA elem175
+#line 0 "bench/work/lists_1000.lem"
+#line 7259 "bench/work/lists_1000.cpp"
+            callDtor( 1084, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 834, rhsData[2] );
+            break;
+        }
+
+        case 702:
+        {
+            // list175 ::= elem175
+#line 0 "bench/work/lists_1000.lem"
+#line 7270 "bench/work/lists_1000.cpp"
+            callDtor( 834, rhsData[0] );
+            break;
+        }
+
+        case 703:
+        {
+            // elem175 ::= ATOM175
+#line 0 "bench/work/lists_1000.lem"
+#line 7279 "bench/work/lists_1000.cpp"
+            callDtor( 86, rhsData[0] );
+            break;
+        }
+
+        case 704:
+        {
+            // elem175 ::= LP175 list176 RP175
+#line 0 "bench/work/lists_1000.lem"
+#line 7288 "bench/work/lists_1000.cpp"
+            callDtor( 336, rhsData[0] );
+            callDtor( 1085, rhsData[1] );
+            callDtor( 585, rhsData[2] );
+            break;
+        }
+
+        case 705:
+        {
+            // list176 ::= list176 COMMA elem176
+#line 0 "bench/work/lists_1000.lem"
+#line 7299 "bench/work/lists_1000.cpp"
+            callDtor( 1085, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 835, rhsData[2] );
+            break;
+        }
+
+        case 706:
+        {
+            // list176 ::= elem176
+#line 0 "bench/work/lists_1000.lem"
+#line 7310 "bench/work/lists_1000.cpp"
+            callDtor( 835, rhsData[0] );
+            break;
+        }
+
+        case 707:
+        {
+            // elem176 ::= ATOM176
+#line 0 "bench/work/lists_1000.lem"
+#line 7319 "bench/work/lists_1000.cpp"
+            callDtor( 87, rhsData[0] );
+            break;
+        }
+
+        case 708:
+        {
+            // elem176 ::= LP176 list177 RP176
+#line 0 "bench/work/lists_1000.lem"
+#line 7328 "bench/work/lists_1000.cpp"
+            callDtor( 337, rhsData[0] );
+            callDtor( 1086, rhsData[1] );
+            callDtor( 586, rhsData[2] );
+            break;
+        }
+
+        case 709:
+        {
+            // list177 ::= list177 COMMA elem177
+#line 0 "bench/work/lists_1000.lem"
+#line 7339 "bench/work/lists_1000.cpp"
+            callDtor( 1086, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 836, rhsData[2] );
+            break;
+        }
+
+        case 710:
+        {
+            // list177 ::= elem177
+#line 0 "bench/work/lists_1000.lem"
+#line 7350 "bench/work/lists_1000.cpp"
+            callDtor( 836, rhsData[0] );
+            break;
+        }
+
+        case 711:
+        {
+            // elem177 ::= ATOM177
+#line 0 "bench/work/lists_1000.lem"
+#line 7359 "bench/work/lists_1000.cpp"
+            callDtor( 88, rhsData[0] );
+            break;
+        }
+
+        case 712:
+        {
+            // elem177 ::= LP177 list178 RP177
+#line 0 "bench/work/lists_1000.lem"
+#line 7368 "bench/work/lists_1000.cpp"
+            callDtor( 338, rhsData[0] );
+            callDtor( 1087, rhsData[1] );
+            callDtor( 587, rhsData[2] );
+            break;
+        }
+
+        case 713:
+        {
+            // list178 ::= list178 COMMA elem178
+#line 0 "bench/work/lists_1000.lem"
+#line 7379 "bench/work/lists_1000.cpp"
+            callDtor( 1087, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 837, rhsData[2] );
+            break;
+        }
+
+        case 714:
+        {
+            // list178 ::= elem178
+#line 0 "bench/work/lists_1000.lem"
+#line 7390 "bench/work/lists_1000.cpp"
+            callDtor( 837, rhsData[0] );
+            break;
+        }
+
+        case 715:
+        {
+            // elem178 ::= ATOM178
+#line 0 "bench/work/lists_1000.lem"
+#line 7399 "bench/work/lists_1000.cpp"
+            callDtor( 89, rhsData[0] );
+            break;
+        }
+
+        case 716:
+        {
+            // elem178 ::= LP178 list179 RP178
+#line 0 "bench/work/lists_1000.lem"
+#line 7408 "bench/work/lists_1000.cpp"
+            callDtor( 339, rhsData[0] );
+            callDtor( 1088, rhsData[1] );
+            callDtor( 588, rhsData[2] );
+            break;
+        }
+
+        case 717:
+        {
+            // list179 ::= list179 COMMA elem179
+#line 0 "bench/work/lists_1000.lem"
+#line 7419 "bench/work/lists_1000.cpp"
+            callDtor( 1088, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 838, rhsData[2] );
+            break;
+        }
+
+        case 718:
+        {
+            // list179 ::= elem179
+#line 0 "bench/work/lists_1000.lem"
+#line 7430 "bench/work/lists_1000.cpp"
+            callDtor( 838, rhsData[0] );
+            break;
+        }
+
+        case 719:
+        {
+            // elem179 ::= ATOM179
+#line 0 "bench/work/lists_1000.lem"
+#line 7439 "bench/work/lists_1000.cpp"
+            callDtor( 90, rhsData[0] );
+            break;
+        }
+
+        case 720:
+        {
+            // elem179 ::= LP179 list180 RP179
+#line 0 "bench/work/lists_1000.lem"
+#line 7448 "bench/work/lists_1000.cpp"
+            callDtor( 340, rhsData[0] );
+            callDtor( 1090, rhsData[1] );
+            callDtor( 589, rhsData[2] );
+            break;
+        }
+
+        case 721:
+        {
+            // list180 ::= list180 COMMA elem180
+#line 0 "bench/work/lists_1000.lem"
+#line 7459 "bench/work/lists_1000.cpp"
+            callDtor( 1090, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 840, rhsData[2] );
+            break;
+        }
+
+        case 722:
+        {
+            // list180 ::= elem180
+#line 0 "bench/work/lists_1000.lem"
+#line 7470 "bench/work/lists_1000.cpp"
+            callDtor( 840, rhsData[0] );
+            break;
+        }
+
+        case 723:
+        {
+            // elem180 ::= ATOM180
+#line 0 "bench/work/lists_1000.lem"
+#line 7479 "bench/work/lists_1000.cpp"
+            callDtor( 92, rhsData[0] );
+            break;
+        }
+
+        case 724:
+        {
+            // elem180 ::= LP180 list181 RP180
+#line 0 "bench/work/lists_1000.lem"
+#line 7488 "bench/work/lists_1000.cpp"
+            callDtor( 342, rhsData[0] );
+            callDtor( 1091, rhsData[1] );
+            callDtor( 591, rhsData[2] );
+            break;
+        }
+
+        case 725:
+        {
+            // list181 ::= list181 COMMA elem181
+#line 0 "bench/work/lists_1000.lem"
+#line 7499 "bench/work/lists_1000.cpp"
+            callDtor( 1091, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 841, rhsData[2] );
+            break;
+        }
+
+        case 726:
+        {
+            // list181 ::= elem181
+#line 0 "bench/work/lists_1000.lem"
+#line 7510 "bench/work/lists_1000.cpp"
+            callDtor( 841, rhsData[0] );
+            break;
+        }
+
+        case 727:
+        {
+            // elem181 ::= ATOM181
+#line 0 "bench/work/lists_1000.lem"
+#line 7519 "bench/work/lists_1000.cpp"
+            callDtor( 93, rhsData[0] );
+            break;
+        }
+
+        case 728:
+        {
+            // elem181 ::= LP181 list182 RP181
+#line 0 "bench/work/lists_1000.lem"
+#line 7528 "bench/work/lists_1000.cpp"
+            callDtor( 343, rhsData[0] );
+            callDtor( 1092, rhsData[1] );
+            callDtor( 592, rhsData[2] );
+            break;
+        }
+
+        case 729:
+        {
+            // list182 ::= list182 COMMA elem182
+#line 0 "bench/work/lists_1000.lem"
+#line 7539 "bench/work/lists_1000.cpp"
+            callDtor( 1092, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 842, rhsData[2] );
+            break;
+        }
+
+        case 730:
+        {
+            // list182 ::= elem182
+#line 0 "bench/work/lists_1000.lem"
+#line 7550 "bench/work/lists_1000.cpp"
+            callDtor( 842, rhsData[0] );
+            break;
+        }
+
+        case 731:
+        {
+            // elem182 ::= ATOM182
+#line 0 "bench/work/lists_1000.lem"
+#line 7559 "bench/work/lists_1000.cpp"
+            callDtor( 94, rhsData[0] );
+            break;
+        }
+
+        case 732:
+        {
+            // elem182 ::= LP182 list183 RP182
+#line 0 "bench/work/lists_1000.lem"
+#line 7568 "bench/work/lists_1000.cpp"
+            callDtor( 344, rhsData[0] );
+            callDtor( 1093, rhsData[1] );
+            callDtor( 593, rhsData[2] );
+            break;
+        }
+
+        case 733:
+        {
+            // list183 ::= list183 COMMA elem183
+#line 0 "bench/work/lists_1000.lem"
+#line 7579 "bench/work/lists_1000.cpp"
+            callDtor( 1093, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 843, rhsData[2] );
+            break;
+        }
+
+        case 734:
+        {
+            // list183 ::= elem183
+#line 0 "bench/work/lists_1000.lem"
+#line 7590 "bench/work/lists_1000.cpp"
+            callDtor( 843, rhsData[0] );
+            break;
+        }
+
+        case 735:
+        {
+            // elem183 ::= ATOM183
+#line 0 "bench/work/lists_1000.lem"
+#line 7599 "bench/work/lists_1000.cpp"
+            callDtor( 95, rhsData[0] );
+            break;
+        }
+
+        case 736:
+        {
+            // elem183 ::= LP183 list184 RP183
+#line 0 "bench/work/lists_1000.lem"
+#line 7608 "bench/work/lists_1000.cpp"
+            callDtor( 345, rhsData[0] );
+            callDtor( 1094, rhsData[1] );
+            callDtor( 594, rhsData[2] );
+            break;
+        }
+
+        case 737:
+        {
+            // list184 ::= list184 COMMA elem184
+#line 0 "bench/work/lists_1000.lem"
+#line 7619 "bench/work/lists_1000.cpp"
+            callDtor( 1094, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 844, rhsData[2] );
+            break;
+        }
+
+        case 738:
+        {
+            // list184 ::= elem184
+#line 0 "bench/work/lists_1000.lem"
+#line 7630 "bench/work/lists_1000.cpp"
+            callDtor( 844, rhsData[0] );
+            break;
+        }
+
+        case 739:
+        {
+            // elem184 ::= ATOM184
+#line 0 "bench/work/lists_1000.lem"
+#line 7639 "bench/work/lists_1000.cpp"
+            callDtor( 96, rhsData[0] );
+            break;
+        }
+
+        case 740:
+        {
+            // elem184 ::= LP184 list185 RP184
+#line 0 "bench/work/lists_1000.lem"
+#line 7648 "bench/work/lists_1000.cpp"
+            callDtor( 346, rhsData[0] );
+            callDtor( 1095, rhsData[1] );
+            callDtor( 595, rhsData[2] );
+            break;
+        }
+
+        case 741:
+        {
+            // list185 ::= list185 COMMA elem185
+#line 0 "bench/work/lists_1000.lem"
+#line 7659 "bench/work/lists_1000.cpp"
+            callDtor( 1095, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 845, rhsData[2] );
+            break;
+        }
+
+        case 742:
+        {
+            // list185 ::= elem185
+#line 0 "bench/work/lists_1000.lem"
+#line 7670 "bench/work/lists_1000.cpp"
+            callDtor( 845, rhsData[0] );
+            break;
+        }
+
+        case 743:
+        {
+            // elem185 ::= ATOM185
+#line 0 "bench/work/lists_1000.lem"
+#line 7679 "bench/work/lists_1000.cpp"
+            callDtor( 97, rhsData[0] );
+            break;
+        }
+
+        case 744:
+        {
+            // elem185 ::= LP185 list186 RP185
+#line 0 "bench/work/lists_1000.lem"
+#line 7688 "bench/work/lists_1000.cpp"
+            callDtor( 347, rhsData[0] );
+            callDtor( 1096, rhsData[1] );
+            callDtor( 596, rhsData[2] );
+            break;
+        }
+
+        case 745:
+        {
+            // list186 ::= list186 COMMA elem186
+#line 0 "bench/work/lists_1000.lem"
+#line 7699 "bench/work/lists_1000.cpp"
+            callDtor( 1096, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 846, rhsData[2] );
+            break;
+        }
+
+        case 746:
+        {
+            // list186 ::= elem186
+#line 0 "bench/work/lists_1000.lem"
+#line 7710 "bench/work/lists_1000.cpp"
+            callDtor( 846, rhsData[0] );
+            break;
+        }
+
+        case 747:
+        {
+            // elem186 ::= ATOM186
+#line 0 "bench/work/lists_1000.lem"
+#line 7719 "bench/work/lists_1000.cpp"
+            callDtor( 98, rhsData[0] );
+            break;
+        }
+
+        case 748:
+        {
+            // elem186 ::= LP186 list187 RP186
+#line 0 "bench/work/lists_1000.lem"
+#line 7728 "bench/work/lists_1000.cpp"
+            callDtor( 348, rhsData[0] );
+            callDtor( 1097, rhsData[1] );
+            callDtor( 597, rhsData[2] );
+            break;
+        }
+
+        case 749:
+        {
+            // list187 ::= list187 COMMA elem187
+#line 0 "bench/work/lists_1000.lem"
+#line 7739 "bench/work/lists_1000.cpp"
+            callDtor( 1097, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 847, rhsData[2] );
+            break;
+        }
+
+        case 750:
+        {
+            // list187 ::= elem187
+#line 0 "bench/work/lists_1000.lem"
+#line 7750 "bench/work/lists_1000.cpp"
+            callDtor( 847, rhsData[0] );
+            break;
+        }
+
+        case 751:
+        {
+            // elem187 ::= ATOM187
+#line 0 "bench/work/lists_1000.lem"
+#line 7759 "bench/work/lists_1000.cpp"
+            callDtor( 99, rhsData[0] );
+            break;
+        }
+
+        case 752:
+        {
+            // elem187 ::= LP187 list188 RP187
+#line 0 "bench/work/lists_1000.lem"
+#line 7768 "bench/work/lists_1000.cpp"
+            callDtor( 349, rhsData[0] );
+            callDtor( 1098, rhsData[1] );
+            callDtor( 598, rhsData[2] );
+            break;
+        }
+
+        case 753:
+        {
+            // list188 ::= list188 COMMA elem188
+#line 0 "bench/work/lists_1000.lem"
+#line 7779 "bench/work/lists_1000.cpp"
+            callDtor( 1098, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 848, rhsData[2] );
+            break;
+        }
+
+        case 754:
+        {
+            // list188 ::= elem188
+#line 0 "bench/work/lists_1000.lem"
+#line 7790 "bench/work/lists_1000.cpp"
+            callDtor( 848, rhsData[0] );
+            break;
+        }
+
+        case 755:
+        {
+            // elem188 ::= ATOM188
+#line 0 "bench/work/lists_1000.lem"
+#line 7799 "bench/work/lists_1000.cpp"
+            callDtor( 100, rhsData[0] );
+            break;
+        }
+
+        case 756:
+        {
+            // elem188 ::= LP188 list189 RP188
+#line 0 "bench/work/lists_1000.lem"
+#line 7808 "bench/work/lists_1000.cpp"
+            callDtor( 350, rhsData[0] );
+            callDtor( 1099, rhsData[1] );
+            callDtor( 599, rhsData[2] );
+            break;
+        }
+
+        case 757:
+        {
+            // list189 ::= list189 COMMA elem189
+#line 0 "bench/work/lists_1000.lem"
+#line 7819 "bench/work/lists_1000.cpp"
+            callDtor( 1099, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 849, rhsData[2] );
+            break;
+        }
+
+        case 758:
+        {
+            // list189 ::= elem189
+#line 0 "bench/work/lists_1000.lem"
+#line 7830 "bench/work/lists_1000.cpp"
+            callDtor( 849, rhsData[0] );
+            break;
+        }
+
+        case 759:
+        {
+            // elem189 ::= ATOM189
+#line 0 "bench/work/lists_1000.lem"
+#line 7839 "bench/work/lists_1000.cpp"
+            callDtor( 101, rhsData[0] );
+            break;
+        }
+
+        case 760:
+        {
+            // elem189 ::= LP189 list190 RP189
+#line 0 "bench/work/lists_1000.lem"
+#line 7848 "bench/work/lists_1000.cpp"
+            callDtor( 351, rhsData[0] );
+            callDtor( 1101, rhsData[1] );
+            callDtor( 600, rhsData[2] );
+            break;
+        }
+
+        case 761:
+        {
+            // list190 ::= list190 COMMA elem190
+#line 0 "bench/work/lists_1000.lem"
+#line 7859 "bench/work/lists_1000.cpp"
+            callDtor( 1101, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 851, rhsData[2] );
+            break;
+        }
+
+        case 762:
+        {
+            // list190 ::= elem190
+#line 0 "bench/work/lists_1000.lem"
+#line 7870 "bench/work/lists_1000.cpp"
+            callDtor( 851, rhsData[0] );
+            break;
+        }
+
+        case 763:
+        {
+            // elem190 ::= ATOM190
+#line 0 "bench/work/lists_1000.lem"
+#line 7879 "bench/work/lists_1000.cpp"
+            callDtor( 103, rhsData[0] );
+            break;
+        }
+
+        case 764:
+        {
+            // elem190 ::= LP190 list191 RP190
+#line 0 "bench/work/lists_1000.lem"
+#line 7888 "bench/work/lists_1000.cpp"
+            callDtor( 353, rhsData[0] );
+            callDtor( 1102, rhsData[1] );
+            callDtor( 602, rhsData[2] );
+            break;
+        }
+
+        case 765:
+        {
+            // list191 ::= list191 COMMA elem191
+#line 0 "bench/work/lists_1000.lem"
+#line 7899 "bench/work/lists_1000.cpp"
+            callDtor( 1102, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 852, rhsData[2] );
+            break;
+        }
+
+        case 766:
+        {
+            // list191 ::= elem191
+#line 0 "bench/work/lists_1000.lem"
+#line 7910 "bench/work/lists_1000.cpp"
+            callDtor( 852, rhsData[0] );
+            break;
+        }
+
+        case 767:
+        {
+            // elem191 ::= ATOM191
+#line 0 "bench/work/lists_1000.lem"
+#line 7919 "bench/work/lists_1000.cpp"
+            callDtor( 104, rhsData[0] );
+            break;
+        }
+
+        case 768:
+        {
+            // elem191 ::= LP191 list192 RP191
+#line 0 "bench/work/lists_1000.lem"
+#line 7928 "bench/work/lists_1000.cpp"
+            callDtor( 354, rhsData[0] );
+            callDtor( 1103, rhsData[1] );
+            callDtor( 603, rhsData[2] );
+            break;
+        }
+
+        case 769:
+        {
+            // list192 ::= list192 COMMA elem192
+#line 0 "bench/work/lists_1000.lem"
+#line 7939 "bench/work/lists_1000.cpp"
+            callDtor( 1103, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 853, rhsData[2] );
+            break;
+        }
+
+        case 770:
+        {
+            // list192 ::= elem192
+#line 0 "bench/work/lists_1000.lem"
+#line 7950 "bench/work/lists_1000.cpp"
+            callDtor( 853, rhsData[0] );
+            break;
+        }
+
+        case 771:
+        {
+            // elem192 ::= ATOM192
+#line 0 "bench/work/lists_1000.lem"
+#line 7959 "bench/work/lists_1000.cpp"
+            callDtor( 105, rhsData[0] );
+            break;
+        }
+
+        case 772:
+        {
+            // elem192 ::= LP192 list193 RP192
+#line 0 "bench/work/lists_1000.lem"
+#line 7968 "bench/work/lists_1000.cpp"
+            callDtor( 355, rhsData[0] );
+            callDtor( 1104, rhsData[1] );
+            callDtor( 604, rhsData[2] );
+            break;
+        }
+
+        case 773:
+        {
+            // list193 ::= list193 COMMA elem193
+#line 0 "bench/work/lists_1000.lem"
+#line 7979 "bench/work/lists_1000.cpp"
+            callDtor( 1104, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 854, rhsData[2] );
+            break;
+        }
+
+        case 774:
+        {
+            // list193 ::= elem193
+#line 0 "bench/work/lists_1000.lem"
+#line 7990 "bench/work/lists_1000.cpp"
+            callDtor( 854, rhsData[0] );
+            break;
+        }
+
+        case 775:
+        {
+            // elem193 ::= ATOM193
+#line 0 "bench/work/lists_1000.lem"
+#line 7999 "bench/work/lists_1000.cpp"
+            callDtor( 106, rhsData[0] );
+            break;
+        }
+
+        case 776:
+        {
+            // elem193 ::= LP193 list194 RP193
+#line 0 "bench/work/lists_1000.lem"
+#line 8008 "bench/work/lists_1000.cpp"
+            callDtor( 356, rhsData[0] );
+            callDtor( 1105, rhsData[1] );
+            callDtor( 605, rhsData[2] );
+            break;
+        }
+
+        case 777:
+        {
+            // list194 ::= list194 COMMA elem194
+#line 0 "bench/work/lists_1000.lem"
+#line 8019 "bench/work/lists_1000.cpp"
+            callDtor( 1105, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 855, rhsData[2] );
+            break;
+        }
+
+        case 778:
+        {
+            // list194 ::= elem194
+#line 0 "bench/work/lists_1000.lem"
+#line 8030 "bench/work/lists_1000.cpp"
+            callDtor( 855, rhsData[0] );
+            break;
+        }
+
+        case 779:
+        {
+            // elem194 ::= ATOM194
+#line 0 "bench/work/lists_1000.lem"
+#line 8039 "bench/work/lists_1000.cpp"
+            callDtor( 107, rhsData[0] );
+            break;
+        }
+
+        case 780:
+        {
+            // elem194 ::= LP194 list195 RP194
+#line 0 "bench/work/lists_1000.lem"
+#line 8048 "bench/work/lists_1000.cpp"
+            callDtor( 357, rhsData[0] );
+            callDtor( 1106, rhsData[1] );
+            callDtor( 606, rhsData[2] );
+            break;
+        }
+
+        case 781:
+        {
+            // list195 ::= list195 COMMA elem195
+#line 0 "bench/work/lists_1000.lem"
+#line 8059 "bench/work/lists_1000.cpp"
+            callDtor( 1106, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 856, rhsData[2] );
+            break;
+        }
+
+        case 782:
+        {
+            // list195 ::= elem195
+#line 0 "bench/work/lists_1000.lem"
+#line 8070 "bench/work/lists_1000.cpp"
+            callDtor( 856, rhsData[0] );
+            break;
+        }
+
+        case 783:
+        {
+            // elem195 ::= ATOM195
+#line 0 "bench/work/lists_1000.lem"
+#line 8079 "bench/work/lists_1000.cpp"
+            callDtor( 108, rhsData[0] );
+            break;
+        }
+
+        case 784:
+        {
+            // elem195 ::= LP195 list196 RP195
+#line 0 "bench/work/lists_1000.lem"
+#line 8088 "bench/work/lists_1000.cpp"
+            callDtor( 358, rhsData[0] );
+            callDtor( 1107, rhsData[1] );
+            callDtor( 607, rhsData[2] );
+            break;
+        }
+
+        case 785:
+        {
+            // list196 ::= list196 COMMA elem196
+#line 0 "bench/work/lists_1000.lem"
+#line 8099 "bench/work/lists_1000.cpp"
+            callDtor( 1107, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 857, rhsData[2] );
+            break;
+        }
+
+        case 786:
+        {
+            // list196 ::= elem196
+#line 0 "bench/work/lists_1000.lem"
+#line 8110 "bench/work/lists_1000.cpp"
+            callDtor( 857, rhsData[0] );
+            break;
+        }
+
+        case 787:
+        {
+            // elem196 ::= ATOM196
+#line 0 "bench/work/lists_1000.lem"
+#line 8119 "bench/work/lists_1000.cpp"
+            callDtor( 109, rhsData[0] );
+            break;
+        }
+
+        case 788:
+        {
+            // elem196 ::= LP196 list197 RP196
+#line 0 "bench/work/lists_1000.lem"
+#line 8128 "bench/work/lists_1000.cpp"
+            callDtor( 359, rhsData[0] );
+            callDtor( 1108, rhsData[1] );
+            callDtor( 608, rhsData[2] );
+            break;
+        }
+
+        case 789:
+        {
+            // list197 ::= list197 COMMA elem197
+#line 0 "bench/work/lists_1000.lem"
+#line 8139 "bench/work/lists_1000.cpp"
+            callDtor( 1108, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 858, rhsData[2] );
+            break;
+        }
+
+        case 790:
+        {
+            // list197 ::= elem197
+#line 0 "bench/work/lists_1000.lem"
+#line 8150 "bench/work/lists_1000.cpp"
+            callDtor( 858, rhsData[0] );
+            break;
+        }
+
+        case 791:
+        {
+            // elem197 ::= ATOM197
+#line 0 "bench/work/lists_1000.lem"
+#line 8159 "bench/work/lists_1000.cpp"
+            callDtor( 110, rhsData[0] );
+            break;
+        }
+
+        case 792:
+        {
+            // elem197 ::= LP197 list198 RP197
+#line 0 "bench/work/lists_1000.lem"
+#line 8168 "bench/work/lists_1000.cpp"
+            callDtor( 360, rhsData[0] );
+            callDtor( 1109, rhsData[1] );
+            callDtor( 609, rhsData[2] );
+            break;
+        }
+
+        case 793:
+        {
+            // list198 ::= list198 COMMA elem198
+#line 0 "bench/work/lists_1000.lem"
+#line 8179 "bench/work/lists_1000.cpp"
+            callDtor( 1109, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 859, rhsData[2] );
+            break;
+        }
+
+        case 794:
+        {
+            // list198 ::= elem198
+#line 0 "bench/work/lists_1000.lem"
+#line 8190 "bench/work/lists_1000.cpp"
+            callDtor( 859, rhsData[0] );
+            break;
+        }
+
+        case 795:
+        {
+            // elem198 ::= ATOM198
+#line 0 "bench/work/lists_1000.lem"
+#line 8199 "bench/work/lists_1000.cpp"
+            callDtor( 111, rhsData[0] );
+            break;
+        }
+
+        case 796:
+        {
+            // elem198 ::= LP198 list199 RP198
+#line 0 "bench/work/lists_1000.lem"
+#line 8208 "bench/work/lists_1000.cpp"
+            callDtor( 361, rhsData[0] );
+            callDtor( 1110, rhsData[1] );
+            callDtor( 610, rhsData[2] );
+            break;
+        }
+
+        case 797:
+        {
+            // list199 ::= list199 COMMA elem199
+#line 0 "bench/work/lists_1000.lem"
+#line 8219 "bench/work/lists_1000.cpp"
+            callDtor( 1110, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 860, rhsData[2] );
+            break;
+        }
+
+        case 798:
+        {
+            // list199 ::= elem199
+#line 0 "bench/work/lists_1000.lem"
+#line 8230 "bench/work/lists_1000.cpp"
+            callDtor( 860, rhsData[0] );
+            break;
+        }
+
+        case 799:
+        {
+            // elem199 ::= ATOM199
+#line 0 "bench/work/lists_1000.lem"
+#line 8239 "bench/work/lists_1000.cpp"
+            callDtor( 112, rhsData[0] );
+            break;
+        }
+
+        case 800:
+        {
+            // elem199 ::= LP199 list200 RP199
+#line 0 "bench/work/lists_1000.lem"
+#line 8248 "bench/work/lists_1000.cpp"
+            callDtor( 362, rhsData[0] );
+            callDtor( 1113, rhsData[1] );
+            callDtor( 611, rhsData[2] );
+            break;
+        }
+
+        case 801:
+        {
+            // list200 ::= list200 COMMA elem200
+#line 0 "bench/work/lists_1000.lem"
+#line 8259 "bench/work/lists_1000.cpp"
+            callDtor( 1113, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 863, rhsData[2] );
+            break;
+        }
+
+        case 802:
+        {
+            // list200 ::= elem200
+#line 0 "bench/work/lists_1000.lem"
+#line 8270 "bench/work/lists_1000.cpp"
+            callDtor( 863, rhsData[0] );
+            break;
+        }
+
+        case 803:
+        {
+            // elem200 ::= ATOM200
+#line 0 "bench/work/lists_1000.lem"
+#line 8279 "bench/work/lists_1000.cpp"
+            callDtor( 115, rhsData[0] );
+            break;
+        }
+
+        case 804:
+        {
+            // elem200 ::= LP200 list201 RP200
+#line 0 "bench/work/lists_1000.lem"
+#line 8288 "bench/work/lists_1000.cpp"
+            callDtor( 365, rhsData[0] );
+            callDtor( 1114, rhsData[1] );
+            callDtor( 614, rhsData[2] );
+            break;
+        }
+
+        case 805:
+        {
+            // list201 ::= list201 COMMA elem201
+#line 0 "bench/work/lists_1000.lem"
+#line 8299 "bench/work/lists_1000.cpp"
+            callDtor( 1114, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 864, rhsData[2] );
+            break;
+        }
+
+        case 806:
+        {
+            // list201 ::= elem201
+#line 0 "bench/work/lists_1000.lem"
+#line 8310 "bench/work/lists_1000.cpp"
+            callDtor( 864, rhsData[0] );
+            break;
+        }
+
+        case 807:
+        {
+            // elem201 ::= ATOM201
+#line 0 "bench/work/lists_1000.lem"
+#line 8319 "bench/work/lists_1000.cpp"
+            callDtor( 116, rhsData[0] );
+            break;
+        }
+
+        case 808:
+        {
+            // elem201 ::= LP201 list202 RP201
+#line 0 "bench/work/lists_1000.lem"
+#line 8328 "bench/work/lists_1000.cpp"
+            callDtor( 366, rhsData[0] );
+            callDtor( 1115, rhsData[1] );
+            callDtor( 615, rhsData[2] );
+            break;
+        }
+
+        case 809:
+        {
+            // list202 ::= list202 COMMA elem202
+#line 0 "bench/work/lists_1000.lem"
+#line 8339 "bench/work/lists_1000.cpp"
+            callDtor( 1115, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 865, rhsData[2] );
+            break;
+        }
+
+        case 810:
+        {
+            // list202 ::= elem202
+#line 0 "bench/work/lists_1000.lem"
+#line 8350 "bench/work/lists_1000.cpp"
+            callDtor( 865, rhsData[0] );
+            break;
+        }
+
+        case 811:
+        {
+            // elem202 ::= ATOM202
+#line 0 "bench/work/lists_1000.lem"
+#line 8359 "bench/work/lists_1000.cpp"
+            callDtor( 117, rhsData[0] );
+            break;
+        }
+
+        case 812:
+        {
+            // elem202 ::= LP202 list203 RP202
+#line 0 "bench/work/lists_1000.lem"
+#line 8368 "bench/work/lists_1000.cpp"
+            callDtor( 367, rhsData[0] );
+            callDtor( 1116, rhsData[1] );
+            callDtor( 616, rhsData[2] );
+            break;
+        }
+
+        case 813:
+        {
+            // list203 ::= list203 COMMA elem203
+#line 0 "bench/work/lists_1000.lem"
+#line 8379 "bench/work/lists_1000.cpp"
+            callDtor( 1116, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 866, rhsData[2] );
+            break;
+        }
+
+        case 814:
+        {
+            // list203 ::= elem203
+#line 0 "bench/work/lists_1000.lem"
+#line 8390 "bench/work/lists_1000.cpp"
+            callDtor( 866, rhsData[0] );
+            break;
+        }
+
+        case 815:
+        {
+            // elem203 ::= ATOM203
+#line 0 "bench/work/lists_1000.lem"
+#line 8399 "bench/work/lists_1000.cpp"
+            callDtor( 118, rhsData[0] );
+            break;
+        }
+
+        case 816:
+        {
+            // elem203 ::= LP203 list204 RP203
+#line 0 "bench/work/lists_1000.lem"
+#line 8408 "bench/work/lists_1000.cpp"
+            callDtor( 368, rhsData[0] );
+            callDtor( 1117, rhsData[1] );
+            callDtor( 617, rhsData[2] );
+            break;
+        }
+
+        case 817:
+        {
+            // list204 ::= list204 COMMA elem204
+#line 0 "bench/work/lists_1000.lem"
+#line 8419 "bench/work/lists_1000.cpp"
+            callDtor( 1117, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 867, rhsData[2] );
+            break;
+        }
+
+        case 818:
+        {
+            // list204 ::= elem204
+#line 0 "bench/work/lists_1000.lem"
+#line 8430 "bench/work/lists_1000.cpp"
+            callDtor( 867, rhsData[0] );
+            break;
+        }
+
+        case 819:
+        {
+            // elem204 ::= ATOM204
+#line 0 "bench/work/lists_1000.lem"
+#line 8439 "bench/work/lists_1000.cpp"
+            callDtor( 119, rhsData[0] );
+            break;
+        }
+
+        case 820:
+        {
+            // elem204 ::= LP204 list205 RP204
+#line 0 "bench/work/lists_1000.lem"
+#line 8448 "bench/work/lists_1000.cpp"
+            callDtor( 369, rhsData[0] );
+            callDtor( 1118, rhsData[1] );
+            callDtor( 618, rhsData[2] );
+            break;
+        }
+
+        case 821:
+        {
+            // list205 ::= list205 COMMA elem205
+#line 0 "bench/work/lists_1000.lem"
+#line 8459 "bench/work/lists_1000.cpp"
+            callDtor( 1118, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 868, rhsData[2] );
+            break;
+        }
+
+        case 822:
+        {
+            // list205 ::= elem205
+#line 0 "bench/work/lists_1000.lem"
+#line 8470 "bench/work/lists_1000.cpp"
+            callDtor( 868, rhsData[0] );
+            break;
+        }
+
+        case 823:
+        {
+            // elem205 ::= ATOM205
+#line 0 "bench/work/lists_1000.lem"
+#line 8479 "bench/work/lists_1000.cpp"
+            callDtor( 120, rhsData[0] );
+            break;
+        }
+
+        case 824:
+        {
+            // elem205 ::= LP205 list206 RP205
+#line 0 "bench/work/lists_1000.lem"
+#line 8488 "bench/work/lists_1000.cpp"
+            callDtor( 370, rhsData[0] );
+            callDtor( 1119, rhsData[1] );
+            callDtor( 619, rhsData[2] );
+            break;
+        }
+
+        case 825:
+        {
+            // list206 ::= list206 COMMA elem206
+#line 0 "bench/work/lists_1000.lem"
+#line 8499 "bench/work/lists_1000.cpp"
+            callDtor( 1119, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 869, rhsData[2] );
+            break;
+        }
+
+        case 826:
+        {
+            // list206 ::= elem206
+#line 0 "bench/work/lists_1000.lem"
+#line 8510 "bench/work/lists_1000.cpp"
+            callDtor( 869, rhsData[0] );
+            break;
+        }
+
+        case 827:
+        {
+            // elem206 ::= ATOM206
+#line 0 "bench/work/lists_1000.lem"
+#line 8519 "bench/work/lists_1000.cpp"
+            callDtor( 121, rhsData[0] );
+            break;
+        }
+
+        case 828:
+        {
+            // elem206 ::= LP206 list207 RP206
+#line 0 "bench/work/lists_1000.lem"
+#line 8528 "bench/work/lists_1000.cpp"
+            callDtor( 371, rhsData[0] );
+            callDtor( 1120, rhsData[1] );
+            callDtor( 620, rhsData[2] );
+            break;
+        }
+
+        case 829:
+        {
+            // list207 ::= list207 COMMA elem207
+#line 0 "bench/work/lists_1000.lem"
+#line 8539 "bench/work/lists_1000.cpp"
+            callDtor( 1120, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 870, rhsData[2] );
+            break;
+        }
+
+        case 830:
+        {
+            // list207 ::= elem207
+#line 0 "bench/work/lists_1000.lem"
+#line 8550 "bench/work/lists_1000.cpp"
+            callDtor( 870, rhsData[0] );
+            break;
+        }
+
+        case 831:
+        {
+            // elem207 ::= ATOM207
+#line 0 "bench/work/lists_1000.lem"
+#line 8559 "bench/work/lists_1000.cpp"
+            callDtor( 122, rhsData[0] );
+            break;
+        }
+
+        case 832:
+        {
+            // elem207 ::= LP207 list208 RP207
+#line 0 "bench/work/lists_1000.lem"
+#line 8568 "bench/work/lists_1000.cpp"
+            callDtor( 372, rhsData[0] );
+            callDtor( 1121, rhsData[1] );
+            callDtor( 621, rhsData[2] );
+            break;
+        }
+
+        case 833:
+        {
+            // list208 ::= list208 COMMA elem208
+#line 0 "bench/work/lists_1000.lem"
+#line 8579 "bench/work/lists_1000.cpp"
+            callDtor( 1121, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 871, rhsData[2] );
+            break;
+        }
+
+        case 834:
+        {
+            // list208 ::= elem208
+#line 0 "bench/work/lists_1000.lem"
+#line 8590 "bench/work/lists_1000.cpp"
+            callDtor( 871, rhsData[0] );
+            break;
+        }
+
+        case 835:
+        {
+            // elem208 ::= ATOM208
+#line 0 "bench/work/lists_1000.lem"
+#line 8599 "bench/work/lists_1000.cpp"
+            callDtor( 123, rhsData[0] );
+            break;
+        }
+
+        case 836:
+        {
+            // elem208 ::= LP208 list209 RP208
+#line 0 "bench/work/lists_1000.lem"
+#line 8608 "bench/work/lists_1000.cpp"
+            callDtor( 373, rhsData[0] );
+            callDtor( 1122, rhsData[1] );
+            callDtor( 622, rhsData[2] );
+            break;
+        }
+
+        case 837:
+        {
+            // list209 ::= list209 COMMA elem209
+#line 0 "bench/work/lists_1000.lem"
+#line 8619 "bench/work/lists_1000.cpp"
+            callDtor( 1122, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 872, rhsData[2] );
+            break;
+        }
+
+        case 838:
+        {
+            // list209 ::= elem209
+#line 0 "bench/work/lists_1000.lem"
+#line 8630 "bench/work/lists_1000.cpp"
+            callDtor( 872, rhsData[0] );
+            break;
+        }
+
+        case 839:
+        {
+            // elem209 ::= ATOM209
+#line 0 "bench/work/lists_1000.lem"
+#line 8639 "bench/work/lists_1000.cpp"
+            callDtor( 124, rhsData[0] );
+            break;
+        }
+
+        case 840:
+        {
+            // elem209 ::= LP209 list210 RP209
+#line 0 "bench/work/lists_1000.lem"
+#line 8648 "bench/work/lists_1000.cpp"
+            callDtor( 374, rhsData[0] );
+            callDtor( 1124, rhsData[1] );
+            callDtor( 623, rhsData[2] );
+            break;
+        }
+
+        case 841:
+        {
+            // list210 ::= list210 COMMA elem210
+#line 0 "bench/work/lists_1000.lem"
+#line 8659 "bench/work/lists_1000.cpp"
+            callDtor( 1124, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 874, rhsData[2] );
+            break;
+        }
+
+        case 842:
+        {
+            // list210 ::= elem210
+#line 0 "bench/work/lists_1000.lem"
+#line 8670 "bench/work/lists_1000.cpp"
+            callDtor( 874, rhsData[0] );
+            break;
+        }
+
+        case 843:
+        {
+            // elem210 ::= ATOM210
+#line 0 "bench/work/lists_1000.lem"
+#line 8679 "bench/work/lists_1000.cpp"
+            callDtor( 126, rhsData[0] );
+            break;
+        }
+
+        case 844:
+        {
+            // elem210 ::= LP210 list211 RP210
+#line 0 "bench/work/lists_1000.lem"
+#line 8688 "bench/work/lists_1000.cpp"
+            callDtor( 376, rhsData[0] );
+            callDtor( 1125, rhsData[1] );
+            callDtor( 625, rhsData[2] );
+            break;
+        }
+
+        case 845:
+        {
+            // list211 ::= list211 COMMA elem211
+#line 0 "bench/work/lists_1000.lem"
+#line 8699 "bench/work/lists_1000.cpp"
+            callDtor( 1125, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 875, rhsData[2] );
+            break;
+        }
+
+        case 846:
+        {
+            // list211 ::= elem211
+#line 0 "bench/work/lists_1000.lem"
+#line 8710 "bench/work/lists_1000.cpp"
+            callDtor( 875, rhsData[0] );
+            break;
+        }
+
+        case 847:
+        {
+            // elem211 ::= ATOM211
+#line 0 "bench/work/lists_1000.lem"
+#line 8719 "bench/work/lists_1000.cpp"
+            callDtor( 127, rhsData[0] );
+            break;
+        }
+
+        case 848:
+        {
+            // elem211 ::= LP211 list212 RP211
+#line 0 "bench/work/lists_1000.lem"
+#line 8728 "bench/work/lists_1000.cpp"
+            callDtor( 377, rhsData[0] );
+            callDtor( 1126, rhsData[1] );
+            callDtor( 626, rhsData[2] );
+            break;
+        }
+
+        case 849:
+        {
+            // list212 ::= list212 COMMA elem212
+#line 0 "bench/work/lists_1000.lem"
+#line 8739 "bench/work/lists_1000.cpp"
+            callDtor( 1126, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 876, rhsData[2] );
+            break;
+        }
+
+        case 850:
+        {
+            // list212 ::= elem212
+#line 0 "bench/work/lists_1000.lem"
+#line 8750 "bench/work/lists_1000.cpp"
+            callDtor( 876, rhsData[0] );
+            break;
+        }
+
+        case 851:
+        {
+            // elem212 ::= ATOM212
+#line 0 "bench/work/lists_1000.lem"
+#line 8759 "bench/work/lists_1000.cpp"
+            callDtor( 128, rhsData[0] );
+            break;
+        }
+
+        case 852:
+        {
+            // elem212 ::= LP212 list213 RP212
+#line 0 "bench/work/lists_1000.lem"
+#line 8768 "bench/work/lists_1000.cpp"
+            callDtor( 378, rhsData[0] );
+            callDtor( 1127, rhsData[1] );
+            callDtor( 627, rhsData[2] );
+            break;
+        }
+
+        case 853:
+        {
+            // list213 ::= list213 COMMA elem213
+#line 0 "bench/work/lists_1000.lem"
+#line 8779 "bench/work/lists_1000.cpp"
+            callDtor( 1127, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 877, rhsData[2] );
+            break;
+        }
+
+        case 854:
+        {
+            // list213 ::= elem213
+#line 0 "bench/work/lists_1000.lem"
+#line 8790 "bench/work/lists_1000.cpp"
+            callDtor( 877, rhsData[0] );
+            break;
+        }
+
+        case 855:
+        {
+            // elem213 ::= ATOM213
+#line 0 "bench/work/lists_1000.lem"
+#line 8799 "bench/work/lists_1000.cpp"
+            callDtor( 129, rhsData[0] );
+            break;
+        }
+
+        case 856:
+        {
+            // elem213 ::= LP213 list214 RP213
+#line 0 "bench/work/lists_1000.lem"
+#line 8808 "bench/work/lists_1000.cpp"
+            callDtor( 379, rhsData[0] );
+            callDtor( 1128, rhsData[1] );
+            callDtor( 628, rhsData[2] );
+            break;
+        }
+
+        case 857:
+        {
+            // list214 ::= list214 COMMA elem214
+#line 0 "bench/work/lists_1000.lem"
+#line 8819 "bench/work/lists_1000.cpp"
+            callDtor( 1128, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 878, rhsData[2] );
+            break;
+        }
+
+        case 858:
+        {
+            // list214 ::= elem214
+#line 0 "bench/work/lists_1000.lem"
+#line 8830 "bench/work/lists_1000.cpp"
+            callDtor( 878, rhsData[0] );
+            break;
+        }
+
+        case 859:
+        {
+            // elem214 ::= ATOM214
+#line 0 "bench/work/lists_1000.lem"
+#line 8839 "bench/work/lists_1000.cpp"
+            callDtor( 130, rhsData[0] );
+            break;
+        }
+
+        case 860:
+        {
+            // elem214 ::= LP214 list215 RP214
+#line 0 "bench/work/lists_1000.lem"
+#line 8848 "bench/work/lists_1000.cpp"
+            callDtor( 380, rhsData[0] );
+            callDtor( 1129, rhsData[1] );
+            callDtor( 629, rhsData[2] );
+            break;
+        }
+
+        case 861:
+        {
+            // list215 ::= list215 COMMA elem215
+#line 0 "bench/work/lists_1000.lem"
+#line 8859 "bench/work/lists_1000.cpp"
+            callDtor( 1129, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 879, rhsData[2] );
+            break;
+        }
+
+        case 862:
+        {
+            // list215 ::= elem215
+#line 0 "bench/work/lists_1000.lem"
+#line 8870 "bench/work/lists_1000.cpp"
+            callDtor( 879, rhsData[0] );
+            break;
+        }
+
+        case 863:
+        {
+            // elem215 ::= ATOM215
+#line 0 "bench/work/lists_1000.lem"
+#line 8879 "bench/work/lists_1000.cpp"
+            callDtor( 131, rhsData[0] );
+            break;
+        }
+
+        case 864:
+        {
+            // elem215 ::= LP215 list216 RP215
+#line 0 "bench/work/lists_1000.lem"
+#line 8888 "bench/work/lists_1000.cpp"
+            callDtor( 381, rhsData[0] );
+            callDtor( 1130, rhsData[1] );
+            callDtor( 630, rhsData[2] );
+            break;
+        }
+
+        case 865:
+        {
+            // list216 ::= list216 COMMA elem216
+#line 0 "bench/work/lists_1000.lem"
+#line 8899 "bench/work/lists_1000.cpp"
+            callDtor( 1130, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 880, rhsData[2] );
+            break;
+        }
+
+        case 866:
+        {
+            // list216 ::= elem216
+#line 0 "bench/work/lists_1000.lem"
+#line 8910 "bench/work/lists_1000.cpp"
+            callDtor( 880, rhsData[0] );
+            break;
+        }
+
+        case 867:
+        {
+            // elem216 ::= ATOM216
+#line 0 "bench/work/lists_1000.lem"
+#line 8919 "bench/work/lists_1000.cpp"
+            callDtor( 132, rhsData[0] );
+            break;
+        }
+
+        case 868:
+        {
+            // elem216 ::= LP216 list217 RP216
+#line 0 "bench/work/lists_1000.lem"
+#line 8928 "bench/work/lists_1000.cpp"
+            callDtor( 382, rhsData[0] );
+            callDtor( 1131, rhsData[1] );
+            callDtor( 631, rhsData[2] );
+            break;
+        }
+
+        case 869:
+        {
+            // list217 ::= list217 COMMA elem217
+#line 0 "bench/work/lists_1000.lem"
+#line 8939 "bench/work/lists_1000.cpp"
+            callDtor( 1131, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 881, rhsData[2] );
+            break;
+        }
+
+        case 870:
+        {
+            // list217 ::= elem217
+#line 0 "bench/work/lists_1000.lem"
+#line 8950 "bench/work/lists_1000.cpp"
+            callDtor( 881, rhsData[0] );
+            break;
+        }
+
+        case 871:
+        {
+            // elem217 ::= ATOM217
+#line 0 "bench/work/lists_1000.lem"
+#line 8959 "bench/work/lists_1000.cpp"
+            callDtor( 133, rhsData[0] );
+            break;
+        }
+
+        case 872:
+        {
+            // elem217 ::= LP217 list218 RP217
+#line 0 "bench/work/lists_1000.lem"
+#line 8968 "bench/work/lists_1000.cpp"
+            callDtor( 383, rhsData[0] );
+            callDtor( 1132, rhsData[1] );
+            callDtor( 632, rhsData[2] );
+            break;
+        }
+
+        case 873:
+        {
+            // list218 ::= list218 COMMA elem218
+#line 0 "bench/work/lists_1000.lem"
+#line 8979 "bench/work/lists_1000.cpp"
+            callDtor( 1132, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 882, rhsData[2] );
+            break;
+        }
+
+        case 874:
+        {
+            // list218 ::= elem218
+#line 0 "bench/work/lists_1000.lem"
+#line 8990 "bench/work/lists_1000.cpp"
+            callDtor( 882, rhsData[0] );
+            break;
+        }
+
+        case 875:
+        {
+            // elem218 ::= ATOM218
+#line 0 "bench/work/lists_1000.lem"
+#line 8999 "bench/work/lists_1000.cpp"
+            callDtor( 134, rhsData[0] );
+            break;
+        }
+
+        case 876:
+        {
+            // elem218 ::= LP218 list219 RP218
+#line 0 "bench/work/lists_1000.lem"
+#line 9008 "bench/work/lists_1000.cpp"
+            callDtor( 384, rhsData[0] );
+            callDtor( 1133, rhsData[1] );
+            callDtor( 633, rhsData[2] );
+            break;
+        }
+
+        case 877:
+        {
+            // list219 ::= list219 COMMA elem219
+#line 0 "bench/work/lists_1000.lem"
+#line 9019 "bench/work/lists_1000.cpp"
+            callDtor( 1133, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 883, rhsData[2] );
+            break;
+        }
+
+        case 878:
+        {
+            // list219 ::= elem219
+#line 0 "bench/work/lists_1000.lem"
+#line 9030 "bench/work/lists_1000.cpp"
+            callDtor( 883, rhsData[0] );
+            break;
+        }
+
+        case 879:
+        {
+            // elem219 ::= ATOM219
+#line 0 "bench/work/lists_1000.lem"
+#line 9039 "bench/work/lists_1000.cpp"
+            callDtor( 135, rhsData[0] );
+            break;
+        }
+
+        case 880:
+        {
+            // elem219 ::= LP219 list220 RP219
+#line 0 "bench/work/lists_1000.lem"
+#line 9048 "bench/work/lists_1000.cpp"
+            callDtor( 385, rhsData[0] );
+            callDtor( 1135, rhsData[1] );
+            callDtor( 634, rhsData[2] );
+            break;
+        }
+
+        case 881:
+        {
+            // list220 ::= list220 COMMA elem220
+#line 0 "bench/work/lists_1000.lem"
+#line 9059 "bench/work/lists_1000.cpp"
+            callDtor( 1135, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 885, rhsData[2] );
+            break;
+        }
+
+        case 882:
+        {
+            // list220 ::= elem220
+#line 0 "bench/work/lists_1000.lem"
+#line 9070 "bench/work/lists_1000.cpp"
+            callDtor( 885, rhsData[0] );
+            break;
+        }
+
+        case 883:
+        {
+            // elem220 ::= ATOM220
+#line 0 "bench/work/lists_1000.lem"
+#line 9079 "bench/work/lists_1000.cpp"
+            callDtor( 137, rhsData[0] );
+            break;
+        }
+
+        case 884:
+        {
+            // elem220 ::= LP220 list221 RP220
+#line 0 "bench/work/lists_1000.lem"
+#line 9088 "bench/work/lists_1000.cpp"
+            callDtor( 387, rhsData[0] );
+            callDtor( 1136, rhsData[1] );
+            callDtor( 636, rhsData[2] );
+            break;
+        }
+
+        case 885:
+        {
+            // list221 ::= list221 COMMA elem221
+#line 0 "bench/work/lists_1000.lem"
+#line 9099 "bench/work/lists_1000.cpp"
+            callDtor( 1136, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 886, rhsData[2] );
+            break;
+        }
+
+        case 886:
+        {
+            // list221 ::= elem221
+#line 0 "bench/work/lists_1000.lem"
+#line 9110 "bench/work/lists_1000.cpp"
+            callDtor( 886, rhsData[0] );
+            break;
+        }
+
+        case 887:
+        {
+            // elem221 ::= ATOM221
+#line 0 "bench/work/lists_1000.lem"
+#line 9119 "bench/work/lists_1000.cpp"
+            callDtor( 138, rhsData[0] );
+            break;
+        }
+
+        case 888:
+        {
+            // elem221 ::= LP221 list222 RP221
+#line 0 "bench/work/lists_1000.lem"
+#line 9128 "bench/work/lists_1000.cpp"
+            callDtor( 388, rhsData[0] );
+            callDtor( 1137, rhsData[1] );
+            callDtor( 637, rhsData[2] );
+            break;
+        }
+
+        case 889:
+        {
+            // list222 ::= list222 COMMA elem222
+#line 0 "bench/work/lists_1000.lem"
+#line 9139 "bench/work/lists_1000.cpp"
+            callDtor( 1137, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 887, rhsData[2] );
+            break;
+        }
+
+        case 890:
+        {
+            // list222 ::= elem222
+#line 0 "bench/work/lists_1000.lem"
+#line 9150 "bench/work/lists_1000.cpp"
+            callDtor( 887, rhsData[0] );
+            break;
+        }
+
+        case 891:
+        {
+            // elem222 ::= ATOM222
+#line 0 "bench/work/lists_1000.lem"
+#line 9159 "bench/work/lists_1000.cpp"
+            callDtor( 139, rhsData[0] );
+            break;
+        }
+
+        case 892:
+        {
+            // elem222 ::= LP222 list223 RP222
+#line 0 "bench/work/lists_1000.lem"
+#line 9168 "bench/work/lists_1000.cpp"
+            callDtor( 389, rhsData[0] );
+            callDtor( 1138, rhsData[1] );
+            callDtor( 638, rhsData[2] );
+            break;
+        }
+
+        case 893:
+        {
+            // list223 ::= list223 COMMA elem223
+#line 0 "bench/work/lists_1000.lem"
+#line 9179 "bench/work/lists_1000.cpp"
+            callDtor( 1138, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 888, rhsData[2] );
+            break;
+        }
+
+        case 894:
+        {
+            // list223 ::= elem223
+#line 0 "bench/work/lists_1000.lem"
+#line 9190 "bench/work/lists_1000.cpp"
+            callDtor( 888, rhsData[0] );
+            break;
+        }
+
+        case 895:
+        {
+            // elem223 ::= ATOM223
+#line 0 "bench/work/lists_1000.lem"
+#line 9199 "bench/work/lists_1000.cpp"
+            callDtor( 140, rhsData[0] );
+            break;
+        }
+
+        case 896:
+        {
+            // elem223 ::= LP223 list224 RP223
+#line 0 "bench/work/lists_1000.lem"
+#line 9208 "bench/work/lists_1000.cpp"
+            callDtor( 390, rhsData[0] );
+            callDtor( 1139, rhsData[1] );
+            callDtor( 639, rhsData[2] );
+            break;
+        }
+
+        case 897:
+        {
+            // list224 ::= list224 COMMA elem224
+#line 0 "bench/work/lists_1000.lem"
+#line 9219 "bench/work/lists_1000.cpp"
+            callDtor( 1139, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 889, rhsData[2] );
+            break;
+        }
+
+        case 898:
+        {
+            // list224 ::= elem224
+#line 0 "bench/work/lists_1000.lem"
+#line 9230 "bench/work/lists_1000.cpp"
+            callDtor( 889, rhsData[0] );
+            break;
+        }
+
+        case 899:
+        {
+            // elem224 ::= ATOM224
+#line 0 "bench/work/lists_1000.lem"
+#line 9239 "bench/work/lists_1000.cpp"
+            callDtor( 141, rhsData[0] );
+            break;
+        }
+
+        case 900:
+        {
+            // elem224 ::= LP224 list225 RP224
+#line 0 "bench/work/lists_1000.lem"
+#line 9248 "bench/work/lists_1000.cpp"
+            callDtor( 391, rhsData[0] );
+            callDtor( 1140, rhsData[1] );
+            callDtor( 640, rhsData[2] );
+            break;
+        }
+
+        case 901:
+        {
+            // list225 ::= list225 COMMA elem225
+#line 0 "bench/work/lists_1000.lem"
+#line 9259 "bench/work/lists_1000.cpp"
+            callDtor( 1140, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 890, rhsData[2] );
+            break;
+        }
+
+        case 902:
+        {
+            // list225 ::= elem225
+#line 0 "bench/work/lists_1000.lem"
+#line 9270 "bench/work/lists_1000.cpp"
+            callDtor( 890, rhsData[0] );
+            break;
+        }
+
+        case 903:
+        {
+            // elem225 ::= ATOM225
+#line 0 "bench/work/lists_1000.lem"
+#line 9279 "bench/work/lists_1000.cpp"
+            callDtor( 142, rhsData[0] );
+            break;
+        }
+
+        case 904:
+        {
+            // elem225 ::= LP225 list226 RP225
+#line 0 "bench/work/lists_1000.lem"
+#line 9288 "bench/work/lists_1000.cpp"
+            callDtor( 392, rhsData[0] );
+            callDtor( 1141, rhsData[1] );
+            callDtor( 641, rhsData[2] );
+            break;
+        }
+
+        case 905:
+        {
+            // list226 ::= list226 COMMA elem226
+#line 0 "bench/work/lists_1000.lem"
+#line 9299 "bench/work/lists_1000.cpp"
+            callDtor( 1141, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 891, rhsData[2] );
+            break;
+        }
+
+        case 906:
+        {
+            // list226 ::= elem226
+#line 0 "bench/work/lists_1000.lem"
+#line 9310 "bench/work/lists_1000.cpp"
+            callDtor( 891, rhsData[0] );
+            break;
+        }
+
+        case 907:
+        {
+            // elem226 ::= ATOM226
+#line 0 "bench/work/lists_1000.lem"
+#line 9319 "bench/work/lists_1000.cpp"
+            callDtor( 143, rhsData[0] );
+            break;
+        }
+
+        case 908:
+        {
+            // elem226 ::= LP226 list227 RP226
+#line 0 "bench/work/lists_1000.lem"
+#line 9328 "bench/work/lists_1000.cpp"
+            callDtor( 393, rhsData[0] );
+            callDtor( 1142, rhsData[1] );
+            callDtor( 642, rhsData[2] );
+            break;
+        }
+
+        case 909:
+        {
+            // list227 ::= list227 COMMA elem227
+#line 0 "bench/work/lists_1000.lem"
+#line 9339 "bench/work/lists_1000.cpp"
+            callDtor( 1142, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 892, rhsData[2] );
+            break;
+        }
+
+        case 910:
+        {
+            // list227 ::= elem227
+#line 0 "bench/work/lists_1000.lem"
+#line 9350 "bench/work/lists_1000.cpp"
+            callDtor( 892, rhsData[0] );
+            break;
+        }
+
+        case 911:
+        {
+            // elem227 ::= ATOM227
+#line 0 "bench/work/lists_1000.lem"
+#line 9359 "bench/work/lists_1000.cpp"
+            callDtor( 144, rhsData[0] );
+            break;
+        }
+
+        case 912:
+        {
+            // elem227 ::= LP227 list228 RP227
+#line 0 "bench/work/lists_1000.lem"
+#line 9368 "bench/work/lists_1000.cpp"
+            callDtor( 394, rhsData[0] );
+            callDtor( 1143, rhsData[1] );
+            callDtor( 643, rhsData[2] );
+            break;
+        }
+
+        case 913:
+        {
+            // list228 ::= list228 COMMA elem228
+#line 0 "bench/work/lists_1000.lem"
+#line 9379 "bench/work/lists_1000.cpp"
+            callDtor( 1143, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 893, rhsData[2] );
+            break;
+        }
+
+        case 914:
+        {
+            // list228 ::= elem228
+#line 0 "bench/work/lists_1000.lem"
+#line 9390 "bench/work/lists_1000.cpp"
+            callDtor( 893, rhsData[0] );
+            break;
+        }
+
+        case 915:
+        {
+            // elem228 ::= ATOM228
+#line 0 "bench/work/lists_1000.lem"
+#line 9399 "bench/work/lists_1000.cpp"
+            callDtor( 145, rhsData[0] );
+            break;
+        }
+
+        case 916:
+        {
+            // elem228 ::= LP228 list229 RP228
+#line 0 "bench/work/lists_1000.lem"
+#line 9408 "bench/work/lists_1000.cpp"
+            callDtor( 395, rhsData[0] );
+            callDtor( 1144, rhsData[1] );
+            callDtor( 644, rhsData[2] );
+            break;
+        }
+
+        case 917:
+        {
+            // list229 ::= list229 COMMA elem229
+#line 0 "bench/work/lists_1000.lem"
+#line 9419 "bench/work/lists_1000.cpp"
+            callDtor( 1144, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 894, rhsData[2] );
+            break;
+        }
+
+        case 918:
+        {
+            // list229 ::= elem229
+#line 0 "bench/work/lists_1000.lem"
+#line 9430 "bench/work/lists_1000.cpp"
+            callDtor( 894, rhsData[0] );
+            break;
+        }
+
+        case 919:
+        {
+            // elem229 ::= ATOM229
+#line 0 "bench/work/lists_1000.lem"
+#line 9439 "bench/work/lists_1000.cpp"
+            callDtor( 146, rhsData[0] );
+            break;
+        }
+
+        case 920:
+        {
+            // elem229 ::= LP229 list230 RP229
+#line 0 "bench/work/lists_1000.lem"
+#line 9448 "bench/work/lists_1000.cpp"
+            callDtor( 396, rhsData[0] );
+            callDtor( 1146, rhsData[1] );
+            callDtor( 645, rhsData[2] );
+            break;
+        }
+
+        case 921:
+        {
+            // list230 ::= list230 COMMA elem230
+#line 0 "bench/work/lists_1000.lem"
+#line 9459 "bench/work/lists_1000.cpp"
+            callDtor( 1146, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 896, rhsData[2] );
+            break;
+        }
+
+        case 922:
+        {
+            // list230 ::= elem230
+#line 0 "bench/work/lists_1000.lem"
+#line 9470 "bench/work/lists_1000.cpp"
+            callDtor( 896, rhsData[0] );
+            break;
+        }
+
+        case 923:
+        {
+            // elem230 ::= ATOM230
+#line 0 "bench/work/lists_1000.lem"
+#line 9479 "bench/work/lists_1000.cpp"
+            callDtor( 148, rhsData[0] );
+            break;
+        }
+
+        case 924:
+        {
+            // elem230 ::= LP230 list231 RP230
+#line 0 "bench/work/lists_1000.lem"
+#line 9488 "bench/work/lists_1000.cpp"
+            callDtor( 398, rhsData[0] );
+            callDtor( 1147, rhsData[1] );
+            callDtor( 647, rhsData[2] );
+            break;
+        }
+
+        case 925:
+        {
+            // list231 ::= list231 COMMA elem231
+#line 0 "bench/work/lists_1000.lem"
+#line 9499 "bench/work/lists_1000.cpp"
+            callDtor( 1147, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 897, rhsData[2] );
+            break;
+        }
+
+        case 926:
+        {
+            // list231 ::= elem231
+#line 0 "bench/work/lists_1000.lem"
+#line 9510 "bench/work/lists_1000.cpp"
+            callDtor( 897, rhsData[0] );
+            break;
+        }
+
+        case 927:
+        {
+            // elem231 ::= ATOM231
+#line 0 "bench/work/lists_1000.lem"
+#line 9519 "bench/work/lists_1000.cpp"
+            callDtor( 149, rhsData[0] );
+            break;
+        }
+
+        case 928:
+        {
+            // elem231 ::= LP231 list232 RP231
+#line 0 "bench/work/lists_1000.lem"
+#line 9528 "bench/work/lists_1000.cpp"
+            callDtor( 399, rhsData[0] );
+            callDtor( 1148, rhsData[1] );
+            callDtor( 648, rhsData[2] );
+            break;
+        }
+
+        case 929:
+        {
+            // list232 ::= list232 COMMA elem232
+#line 0 "bench/work/lists_1000.lem"
+#line 9539 "bench/work/lists_1000.cpp"
+            callDtor( 1148, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 898, rhsData[2] );
+            break;
+        }
+
+        case 930:
+        {
+            // list232 ::= elem232
+#line 0 "bench/work/lists_1000.lem"
+#line 9550 "bench/work/lists_1000.cpp"
+            callDtor( 898, rhsData[0] );
+            break;
+        }
+
+        case 931:
+        {
+            // elem232 ::= ATOM232
+#line 0 "bench/work/lists_1000.lem"
+#line 9559 "bench/work/lists_1000.cpp"
+            callDtor( 150, rhsData[0] );
+            break;
+        }
+
+        case 932:
+        {
+            // elem232 ::= LP232 list233 RP232
+#line 0 "bench/work/lists_1000.lem"
+#line 9568 "bench/work/lists_1000.cpp"
+            callDtor( 400, rhsData[0] );
+            callDtor( 1149, rhsData[1] );
+            callDtor( 649, rhsData[2] );
+            break;
+        }
+
+        case 933:
+        {
+            // list233 ::= list233 COMMA elem233
+#line 0 "bench/work/lists_1000.lem"
+#line 9579 "bench/work/lists_1000.cpp"
+            callDtor( 1149, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 899, rhsData[2] );
+            break;
+        }
+
+        case 934:
+        {
+            // list233 ::= elem233
+#line 0 "bench/work/lists_1000.lem"
+#line 9590 "bench/work/lists_1000.cpp"
+            callDtor( 899, rhsData[0] );
+            break;
+        }
+
+        case 935:
+        {
+            // elem233 ::= ATOM233
+#line 0 "bench/work/lists_1000.lem"
+#line 9599 "bench/work/lists_1000.cpp"
+            callDtor( 151, rhsData[0] );
+            break;
+        }
+
+        case 936:
+        {
+            // elem233 ::= LP233 list234 RP233
+#line 0 "bench/work/lists_1000.lem"
+#line 9608 "bench/work/lists_1000.cpp"
+            callDtor( 401, rhsData[0] );
+            callDtor( 1150, rhsData[1] );
+            callDtor( 650, rhsData[2] );
+            break;
+        }
+
+        case 937:
+        {
+            // list234 ::= list234 COMMA elem234
+#line 0 "bench/work/lists_1000.lem"
+#line 9619 "bench/work/lists_1000.cpp"
+            callDtor( 1150, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 900, rhsData[2] );
+            break;
+        }
+
+        case 938:
+        {
+            // list234 ::= elem234
+#line 0 "bench/work/lists_1000.lem"
+#line 9630 "bench/work/lists_1000.cpp"
+            callDtor( 900, rhsData[0] );
+            break;
+        }
+
+        case 939:
+        {
+            // elem234 ::= ATOM234
+#line 0 "bench/work/lists_1000.lem"
+#line 9639 "bench/work/lists_1000.cpp"
+            callDtor( 152, rhsData[0] );
+            break;
+        }
+
+        case 940:
+        {
+            // elem234 ::= LP234 list235 RP234
+#line 0 "bench/work/lists_1000.lem"
+#line 9648 "bench/work/lists_1000.cpp"
+            callDtor( 402, rhsData[0] );
+            callDtor( 1151, rhsData[1] );
+            callDtor( 651, rhsData[2] );
+            break;
+        }
+
+        case 941:
+        {
+            // list235 ::= list235 COMMA elem235
+#line 0 "bench/work/lists_1000.lem"
+#line 9659 "bench/work/lists_1000.cpp"
+            callDtor( 1151, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 901, rhsData[2] );
+            break;
+        }
+
+        case 942:
+        {
+            // list235 ::= elem235
+#line 0 "bench/work/lists_1000.lem"
+#line 9670 "bench/work/lists_1000.cpp"
+            callDtor( 901, rhsData[0] );
+            break;
+        }
+
+        case 943:
+        {
+            // elem235 ::= ATOM235
+#line 0 "bench/work/lists_1000.lem"
+#line 9679 "bench/work/lists_1000.cpp"
+            callDtor( 153, rhsData[0] );
+            break;
+        }
+
+        case 944:
+        {
+            // elem235 ::= LP235 list236 RP235
+#line 0 "bench/work/lists_1000.lem"
+#line 9688 "bench/work/lists_1000.cpp"
+            callDtor( 403, rhsData[0] );
+            callDtor( 1152, rhsData[1] );
+            callDtor( 652, rhsData[2] );
+            break;
+        }
+
+        case 945:
+        {
+            // list236 ::= list236 COMMA elem236
+#line 0 "bench/work/lists_1000.lem"
+#line 9699 "bench/work/lists_1000.cpp"
+            callDtor( 1152, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 902, rhsData[2] );
+            break;
+        }
+
+        case 946:
+        {
+            // list236 ::= elem236
+#line 0 "bench/work/lists_1000.lem"
+#line 9710 "bench/work/lists_1000.cpp"
+            callDtor( 902, rhsData[0] );
+            break;
+        }
+
+        case 947:
+        {
+            // elem236 ::= ATOM236
+#line 0 "bench/work/lists_1000.lem"
+#line 9719 "bench/work/lists_1000.cpp"
+            callDtor( 154, rhsData[0] );
+            break;
+        }
+
+        case 948:
+        {
+            // elem236 ::= LP236 list237 RP236
+#line 0 "bench/work/lists_1000.lem"
+#line 9728 "bench/work/lists_1000.cpp"
+            callDtor( 404, rhsData[0] );
+            callDtor( 1153, rhsData[1] );
+            callDtor( 653, rhsData[2] );
+            break;
+        }
+
+        case 949:
+        {
+            // list237 ::= list237 COMMA elem237
+#line 0 "bench/work/lists_1000.lem"
+#line 9739 "bench/work/lists_1000.cpp"
+            callDtor( 1153, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 903, rhsData[2] );
+            break;
+        }
+
+        case 950:
+        {
+            // list237 ::= elem237
+#line 0 "bench/work/lists_1000.lem"
+#line 9750 "bench/work/lists_1000.cpp"
+            callDtor( 903, rhsData[0] );
+            break;
+        }
+
+        case 951:
+        {
+            // elem237 ::= ATOM237
+#line 0 "bench/work/lists_1000.lem"
+#line 9759 "bench/work/lists_1000.cpp"
+            callDtor( 155, rhsData[0] );
+            break;
+        }
+
+        case 952:
+        {
+            // elem237 ::= LP237 list238 RP237
+#line 0 "bench/work/lists_1000.lem"
+#line 9768 "bench/work/lists_1000.cpp"
+            callDtor( 405, rhsData[0] );
+            callDtor( 1154, rhsData[1] );
+            callDtor( 654, rhsData[2] );
+            break;
+        }
+
+        case 953:
+        {
+            // list238 ::= list238 COMMA elem238
+#line 0 "bench/work/lists_1000.lem"
+#line 9779 "bench/work/lists_1000.cpp"
+            callDtor( 1154, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 904, rhsData[2] );
+            break;
+        }
+
+        case 954:
+        {
+            // list238 ::= elem238
+#line 0 "bench/work/lists_1000.lem"
+#line 9790 "bench/work/lists_1000.cpp"
+            callDtor( 904, rhsData[0] );
+            break;
+        }
+
+        case 955:
+        {
+            // elem238 ::= ATOM238
+#line 0 "bench/work/lists_1000.lem"
+#line 9799 "bench/work/lists_1000.cpp"
+            callDtor( 156, rhsData[0] );
+            break;
+        }
+
+        case 956:
+        {
+            // elem238 ::= LP238 list239 RP238
+#line 0 "bench/work/lists_1000.lem"
+#line 9808 "bench/work/lists_1000.cpp"
+            callDtor( 406, rhsData[0] );
+            callDtor( 1155, rhsData[1] );
+            callDtor( 655, rhsData[2] );
+            break;
+        }
+
+        case 957:
+        {
+            // list239 ::= list239 COMMA elem239
+#line 0 "bench/work/lists_1000.lem"
+#line 9819 "bench/work/lists_1000.cpp"
+            callDtor( 1155, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 905, rhsData[2] );
+            break;
+        }
+
+        case 958:
+        {
+            // list239 ::= elem239
+#line 0 "bench/work/lists_1000.lem"
+#line 9830 "bench/work/lists_1000.cpp"
+            callDtor( 905, rhsData[0] );
+            break;
+        }
+
+        case 959:
+        {
+            // elem239 ::= ATOM239
+#line 0 "bench/work/lists_1000.lem"
+#line 9839 "bench/work/lists_1000.cpp"
+            callDtor( 157, rhsData[0] );
+            break;
+        }
+
+        case 960:
+        {
+            // elem239 ::= LP239 list240 RP239
+#line 0 "bench/work/lists_1000.lem"
+#line 9848 "bench/work/lists_1000.cpp"
+            callDtor( 407, rhsData[0] );
+            callDtor( 1157, rhsData[1] );
+            callDtor( 656, rhsData[2] );
+            break;
+        }
+
+        case 961:
+        {
+            // list240 ::= list240 COMMA elem240
+#line 0 "bench/work/lists_1000.lem"
+#line 9859 "bench/work/lists_1000.cpp"
+            callDtor( 1157, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 907, rhsData[2] );
+            break;
+        }
+
+        case 962:
+        {
+            // list240 ::= elem240
+#line 0 "bench/work/lists_1000.lem"
+#line 9870 "bench/work/lists_1000.cpp"
+            callDtor( 907, rhsData[0] );
+            break;
+        }
+
+        case 963:
+        {
+            // elem240 ::= ATOM240
+#line 0 "bench/work/lists_1000.lem"
+#line 9879 "bench/work/lists_1000.cpp"
+            callDtor( 159, rhsData[0] );
+            break;
+        }
+
+        case 964:
+        {
+            // elem240 ::= LP240 list241 RP240
+#line 0 "bench/work/lists_1000.lem"
+#line 9888 "bench/work/lists_1000.cpp"
+            callDtor( 409, rhsData[0] );
+            callDtor( 1158, rhsData[1] );
+            callDtor( 658, rhsData[2] );
+            break;
+        }
+
+        case 965:
+        {
+            // list241 ::= list241 COMMA elem241
+#line 0 "bench/work/lists_1000.lem"
+#line 9899 "bench/work/lists_1000.cpp"
+            callDtor( 1158, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 908, rhsData[2] );
+            break;
+        }
+
+        case 966:
+        {
+            // list241 ::= elem241
+#line 0 "bench/work/lists_1000.lem"
+#line 9910 "bench/work/lists_1000.cpp"
+            callDtor( 908, rhsData[0] );
+            break;
+        }
+
+        case 967:
+        {
+            // elem241 ::= ATOM241
+#line 0 "bench/work/lists_1000.lem"
+#line 9919 "bench/work/lists_1000.cpp"
+            callDtor( 160, rhsData[0] );
+            break;
+        }
+
+        case 968:
+        {
+            // elem241 ::= LP241 list242 RP241
+#line 0 "bench/work/lists_1000.lem"
+#line 9928 "bench/work/lists_1000.cpp"
+            callDtor( 410, rhsData[0] );
+            callDtor( 1159, rhsData[1] );
+            callDtor( 659, rhsData[2] );
+            break;
+        }
+
+        case 969:
+        {
+            // list242 ::= list242 COMMA elem242
+#line 0 "bench/work/lists_1000.lem"
+#line 9939 "bench/work/lists_1000.cpp"
+            callDtor( 1159, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 909, rhsData[2] );
+            break;
+        }
+
+        case 970:
+        {
+            // list242 ::= elem242
+#line 0 "bench/work/lists_1000.lem"
+#line 9950 "bench/work/lists_1000.cpp"
+            callDtor( 909, rhsData[0] );
+            break;
+        }
+
+        case 971:
+        {
+            // elem242 ::= ATOM242
+#line 0 "bench/work/lists_1000.lem"
+#line 9959 "bench/work/lists_1000.cpp"
+            callDtor( 161, rhsData[0] );
+            break;
+        }
+
+        case 972:
+        {
+            // elem242 ::= LP242 list243 RP242
+#line 0 "bench/work/lists_1000.lem"
+#line 9968 "bench/work/lists_1000.cpp"
+            callDtor( 411, rhsData[0] );
+            callDtor( 1160, rhsData[1] );
+            callDtor( 660, rhsData[2] );
+            break;
+        }
+
+        case 973:
+        {
+            // list243 ::= list243 COMMA elem243
+#line 0 "bench/work/lists_1000.lem"
+#line 9979 "bench/work/lists_1000.cpp"
+            callDtor( 1160, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 910, rhsData[2] );
+            break;
+        }
+
+        case 974:
+        {
+            // list243 ::= elem243
+#line 0 "bench/work/lists_1000.lem"
+#line 9990 "bench/work/lists_1000.cpp"
+            callDtor( 910, rhsData[0] );
+            break;
+        }
+
+        case 975:
+        {
+            // elem243 ::= ATOM243
+#line 0 "bench/work/lists_1000.lem"
+#line 9999 "bench/work/lists_1000.cpp"
+            callDtor( 162, rhsData[0] );
+            break;
+        }
+
+        case 976:
+        {
+            // elem243 ::= LP243 list244 RP243
+#line 0 "bench/work/lists_1000.lem"
+#line 10008 "bench/work/lists_1000.cpp"
+            callDtor( 412, rhsData[0] );
+            callDtor( 1161, rhsData[1] );
+            callDtor( 661, rhsData[2] );
+            break;
+        }
+
+        case 977:
+        {
+            // list244 ::= list244 COMMA elem244
+#line 0 "bench/work/lists_1000.lem"
+#line 10019 "bench/work/lists_1000.cpp"
+            callDtor( 1161, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 911, rhsData[2] );
+            break;
+        }
+
+        case 978:
+        {
+            // list244 ::= elem244
+#line 0 "bench/work/lists_1000.lem"
+#line 10030 "bench/work/lists_1000.cpp"
+            callDtor( 911, rhsData[0] );
+            break;
+        }
+
+        case 979:
+        {
+            // elem244 ::= ATOM244
+#line 0 "bench/work/lists_1000.lem"
+#line 10039 "bench/work/lists_1000.cpp"
+            callDtor( 163, rhsData[0] );
+            break;
+        }
+
+        case 980:
+        {
+            // elem244 ::= LP244 list245 RP244
+#line 0 "bench/work/lists_1000.lem"
+#line 10048 "bench/work/lists_1000.cpp"
+            callDtor( 413, rhsData[0] );
+            callDtor( 1162, rhsData[1] );
+            callDtor( 662, rhsData[2] );
+            break;
+        }
+
+        case 981:
+        {
+            // list245 ::= list245 COMMA elem245
+#line 0 "bench/work/lists_1000.lem"
+#line 10059 "bench/work/lists_1000.cpp"
+            callDtor( 1162, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 912, rhsData[2] );
+            break;
+        }
+
+        case 982:
+        {
+            // list245 ::= elem245
+#line 0 "bench/work/lists_1000.lem"
+#line 10070 "bench/work/lists_1000.cpp"
+            callDtor( 912, rhsData[0] );
+            break;
+        }
+
+        case 983:
+        {
+            // elem245 ::= ATOM245
+#line 0 "bench/work/lists_1000.lem"
+#line 10079 "bench/work/lists_1000.cpp"
+            callDtor( 164, rhsData[0] );
+            break;
+        }
+
+        case 984:
+        {
+            // elem245 ::= LP245 list246 RP245
+#line 0 "bench/work/lists_1000.lem"
+#line 10088 "bench/work/lists_1000.cpp"
+            callDtor( 414, rhsData[0] );
+            callDtor( 1163, rhsData[1] );
+            callDtor( 663, rhsData[2] );
+            break;
+        }
+
+        case 985:
+        {
+            // list246 ::= list246 COMMA elem246
+#line 0 "bench/work/lists_1000.lem"
+#line 10099 "bench/work/lists_1000.cpp"
+            callDtor( 1163, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 913, rhsData[2] );
+            break;
+        }
+
+        case 986:
+        {
+            // list246 ::= elem246
+#line 0 "bench/work/lists_1000.lem"
+#line 10110 "bench/work/lists_1000.cpp"
+            callDtor( 913, rhsData[0] );
+            break;
+        }
+
+        case 987:
+        {
+            // elem246 ::= ATOM246
+#line 0 "bench/work/lists_1000.lem"
+#line 10119 "bench/work/lists_1000.cpp"
+            callDtor( 165, rhsData[0] );
+            break;
+        }
+
+        case 988:
+        {
+            // elem246 ::= LP246 list247 RP246
+#line 0 "bench/work/lists_1000.lem"
+#line 10128 "bench/work/lists_1000.cpp"
+            callDtor( 415, rhsData[0] );
+            callDtor( 1164, rhsData[1] );
+            callDtor( 664, rhsData[2] );
+            break;
+        }
+
+        case 989:
+        {
+            // list247 ::= list247 COMMA elem247
+#line 0 "bench/work/lists_1000.lem"
+#line 10139 "bench/work/lists_1000.cpp"
+            callDtor( 1164, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 914, rhsData[2] );
+            break;
+        }
+
+        case 990:
+        {
+            // list247 ::= elem247
+#line 0 "bench/work/lists_1000.lem"
+#line 10150 "bench/work/lists_1000.cpp"
+            callDtor( 914, rhsData[0] );
+            break;
+        }
+
+        case 991:
+        {
+            // elem247 ::= ATOM247
+#line 0 "bench/work/lists_1000.lem"
+#line 10159 "bench/work/lists_1000.cpp"
+            callDtor( 166, rhsData[0] );
+            break;
+        }
+
+        case 992:
+        {
+            // elem247 ::= LP247 list248 RP247
+#line 0 "bench/work/lists_1000.lem"
+#line 10168 "bench/work/lists_1000.cpp"
+            callDtor( 416, rhsData[0] );
+            callDtor( 1165, rhsData[1] );
+            callDtor( 665, rhsData[2] );
+            break;
+        }
+
+        case 993:
+        {
+            // list248 ::= list248 COMMA elem248
+#line 0 "bench/work/lists_1000.lem"
+#line 10179 "bench/work/lists_1000.cpp"
+            callDtor( 1165, rhsData[0] );
+            callDtor( 250, rhsData[1] );
+            callDtor( 915, rhsData[2] );
+            break;
+        }
+
+        case 994:
+        {
+            // list248 ::= elem248
+#line 0 "bench/work/lists_1000.lem"
+#line 10190 "bench/work/lists_1000.cpp"
+            callDtor( 915, rhsData[0] );
+            break;
+        }
+
+        case 995:
+        {
+            // elem248 ::= ATOM248
+#line 0 "bench/work/lists_1000.lem"
+#line 10199 "bench/work/lists_1000.cpp"
+            callDtor( 167, rhsData[0] );
+            break;
+        }
+
+        case 996:
+        {
+            // elem248 ::= LP248 RP248
+#line 0 "bench/work/lists_1000.lem"
+#line 10208 "bench/work/lists_1000.cpp"
+            callDtor( 417, rhsData[0] );
+            callDtor( 666, rhsData[1] );
+            break;
+        }
+
+        default:
+            throw "Unknown Rule Number";
+            break;
+    }
+
+    if ( PA_SHIFT == next )
+        shift( newVal, myRules[ruleNum].first, data );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::callDtor( int symIdx, privBenchImpl::Value &data )
+{
+    switch ( symIdx )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+        case 12:
+        case 13:
+        case 14:
+        case 15:
+        case 16:
+        case 17:
+        case 18:
+        case 19:
+        case 20:
+        case 21:
+        case 22:
+        case 23:
+        case 24:
+        case 25:
+        case 26:
+        case 27:
+        case 28:
+        case 29:
+        case 30:
+        case 31:
+        case 32:
+        case 33:
+        case 34:
+        case 35:
+        case 36:
+        case 37:
+        case 38:
+        case 39:
+        case 40:
+        case 41:
+        case 42:
+        case 43:
+        case 44:
+        case 45:
+        case 46:
+        case 47:
+        case 48:
+        case 49:
+        case 50:
+        case 51:
+        case 52:
+        case 53:
+        case 54:
+        case 55:
+        case 56:
+        case 57:
+        case 58:
+        case 59:
+        case 60:
+        case 61:
+        case 62:
+        case 63:
+        case 64:
+        case 65:
+        case 66:
+        case 67:
+        case 68:
+        case 69:
+        case 70:
+        case 71:
+        case 72:
+        case 73:
+        case 74:
+        case 75:
+        case 76:
+        case 77:
+        case 78:
+        case 79:
+        case 80:
+        case 81:
+        case 82:
+        case 83:
+        case 84:
+        case 85:
+        case 86:
+        case 87:
+        case 88:
+        case 89:
+        case 90:
+        case 91:
+        case 92:
+        case 93:
+        case 94:
+        case 95:
+        case 96:
+        case 97:
+        case 98:
+        case 99:
+        case 100:
+        case 101:
+        case 102:
+        case 103:
+        case 104:
+        case 105:
+        case 106:
+        case 107:
+        case 108:
+        case 109:
+        case 110:
+        case 111:
+        case 112:
+        case 113:
+        case 114:
+        case 115:
+        case 116:
+        case 117:
+        case 118:
+        case 119:
+        case 120:
+        case 121:
+        case 122:
+        case 123:
+        case 124:
+        case 125:
+        case 126:
+        case 127:
+        case 128:
+        case 129:
+        case 130:
+        case 131:
+        case 132:
+        case 133:
+        case 134:
+        case 135:
+        case 136:
+        case 137:
+        case 138:
+        case 139:
+        case 140:
+        case 141:
+        case 142:
+        case 143:
+        case 144:
+        case 145:
+        case 146:
+        case 147:
+        case 148:
+        case 149:
+        case 150:
+        case 151:
+        case 152:
+        case 153:
+        case 154:
+        case 155:
+        case 156:
+        case 157:
+        case 158:
+        case 159:
+        case 160:
+        case 161:
+        case 162:
+        case 163:
+        case 164:
+        case 165:
+        case 166:
+        case 167:
+        case 168:
+        case 169:
+        case 170:
+        case 171:
+        case 172:
+        case 173:
+        case 174:
+        case 175:
+        case 176:
+        case 177:
+        case 178:
+        case 179:
+        case 180:
+        case 181:
+        case 182:
+        case 183:
+        case 184:
+        case 185:
+        case 186:
+        case 187:
+        case 188:
+        case 189:
+        case 190:
+        case 191:
+        case 192:
+        case 193:
+        case 194:
+        case 195:
+        case 196:
+        case 197:
+        case 198:
+        case 199:
+        case 200:
+        case 201:
+        case 202:
+        case 203:
+        case 204:
+        case 205:
+        case 206:
+        case 207:
+        case 208:
+        case 209:
+        case 210:
+        case 211:
+        case 212:
+        case 213:
+        case 214:
+        case 215:
+        case 216:
+        case 217:
+        case 218:
+        case 219:
+        case 220:
+        case 221:
+        case 222:
+        case 223:
+        case 224:
+        case 225:
+        case 226:
+        case 227:
+        case 228:
+        case 229:
+        case 230:
+        case 231:
+        case 232:
+        case 233:
+        case 234:
+        case 235:
+        case 236:
+        case 237:
+        case 238:
+        case 239:
+        case 240:
+        case 241:
+        case 242:
+        case 243:
+        case 244:
+        case 245:
+        case 246:
+        case 247:
+        case 248:
+        case 249:
+        case 250:
+        case 251:
+        case 252:
+        case 253:
+        case 254:
+        case 255:
+        case 256:
+        case 257:
+        case 258:
+        case 259:
+        case 260:
+        case 261:
+        case 262:
+        case 263:
+        case 264:
+        case 265:
+        case 266:
+        case 267:
+        case 268:
+        case 269:
+        case 270:
+        case 271:
+        case 272:
+        case 273:
+        case 274:
+        case 275:
+        case 276:
+        case 277:
+        case 278:
+        case 279:
+        case 280:
+        case 281:
+        case 282:
+        case 283:
+        case 284:
+        case 285:
+        case 286:
+        case 287:
+        case 288:
+        case 289:
+        case 290:
+        case 291:
+        case 292:
+        case 293:
+        case 294:
+        case 295:
+        case 296:
+        case 297:
+        case 298:
+        case 299:
+        case 300:
+        case 301:
+        case 302:
+        case 303:
+        case 304:
+        case 305:
+        case 306:
+        case 307:
+        case 308:
+        case 309:
+        case 310:
+        case 311:
+        case 312:
+        case 313:
+        case 314:
+        case 315:
+        case 316:
+        case 317:
+        case 318:
+        case 319:
+        case 320:
+        case 321:
+        case 322:
+        case 323:
+        case 324:
+        case 325:
+        case 326:
+        case 327:
+        case 328:
+        case 329:
+        case 330:
+        case 331:
+        case 332:
+        case 333:
+        case 334:
+        case 335:
+        case 336:
+        case 337:
+        case 338:
+        case 339:
+        case 340:
+        case 341:
+        case 342:
+        case 343:
+        case 344:
+        case 345:
+        case 346:
+        case 347:
+        case 348:
+        case 349:
+        case 350:
+        case 351:
+        case 352:
+        case 353:
+        case 354:
+        case 355:
+        case 356:
+        case 357:
+        case 358:
+        case 359:
+        case 360:
+        case 361:
+        case 362:
+        case 363:
+        case 364:
+        case 365:
+        case 366:
+        case 367:
+        case 368:
+        case 369:
+        case 370:
+        case 371:
+        case 372:
+        case 373:
+        case 374:
+        case 375:
+        case 376:
+        case 377:
+        case 378:
+        case 379:
+        case 380:
+        case 381:
+        case 382:
+        case 383:
+        case 384:
+        case 385:
+        case 386:
+        case 387:
+        case 388:
+        case 389:
+        case 390:
+        case 391:
+        case 392:
+        case 393:
+        case 394:
+        case 395:
+        case 396:
+        case 397:
+        case 398:
+        case 399:
+        case 400:
+        case 401:
+        case 402:
+        case 403:
+        case 404:
+        case 405:
+        case 406:
+        case 407:
+        case 408:
+        case 409:
+        case 410:
+        case 411:
+        case 412:
+        case 413:
+        case 414:
+        case 415:
+        case 416:
+        case 417:
+        case 418:
+        case 419:
+        case 420:
+        case 421:
+        case 422:
+        case 423:
+        case 424:
+        case 425:
+        case 426:
+        case 427:
+        case 428:
+        case 429:
+        case 430:
+        case 431:
+        case 432:
+        case 433:
+        case 434:
+        case 435:
+        case 436:
+        case 437:
+        case 438:
+        case 439:
+        case 440:
+        case 441:
+        case 442:
+        case 443:
+        case 444:
+        case 445:
+        case 446:
+        case 447:
+        case 448:
+        case 449:
+        case 450:
+        case 451:
+        case 452:
+        case 453:
+        case 454:
+        case 455:
+        case 456:
+        case 457:
+        case 458:
+        case 459:
+        case 460:
+        case 461:
+        case 462:
+        case 463:
+        case 464:
+        case 465:
+        case 466:
+        case 467:
+        case 468:
+        case 469:
+        case 470:
+        case 471:
+        case 472:
+        case 473:
+        case 474:
+        case 475:
+        case 476:
+        case 477:
+        case 478:
+        case 479:
+        case 480:
+        case 481:
+        case 482:
+        case 483:
+        case 484:
+        case 485:
+        case 486:
+        case 487:
+        case 488:
+        case 489:
+        case 490:
+        case 491:
+        case 492:
+        case 493:
+        case 494:
+        case 495:
+        case 496:
+        case 497:
+        case 498:
+        case 499:
+        case 500:
+        case 501:
+        case 502:
+        case 503:
+        case 504:
+        case 505:
+        case 506:
+        case 507:
+        case 508:
+        case 509:
+        case 510:
+        case 511:
+        case 512:
+        case 513:
+        case 514:
+        case 515:
+        case 516:
+        case 517:
+        case 518:
+        case 519:
+        case 520:
+        case 521:
+        case 522:
+        case 523:
+        case 524:
+        case 525:
+        case 526:
+        case 527:
+        case 528:
+        case 529:
+        case 530:
+        case 531:
+        case 532:
+        case 533:
+        case 534:
+        case 535:
+        case 536:
+        case 537:
+        case 538:
+        case 539:
+        case 540:
+        case 541:
+        case 542:
+        case 543:
+        case 544:
+        case 545:
+        case 546:
+        case 547:
+        case 548:
+        case 549:
+        case 550:
+        case 551:
+        case 552:
+        case 553:
+        case 554:
+        case 555:
+        case 556:
+        case 557:
+        case 558:
+        case 559:
+        case 560:
+        case 561:
+        case 562:
+        case 563:
+        case 564:
+        case 565:
+        case 566:
+        case 567:
+        case 568:
+        case 569:
+        case 570:
+        case 571:
+        case 572:
+        case 573:
+        case 574:
+        case 575:
+        case 576:
+        case 577:
+        case 578:
+        case 579:
+        case 580:
+        case 581:
+        case 582:
+        case 583:
+        case 584:
+        case 585:
+        case 586:
+        case 587:
+        case 588:
+        case 589:
+        case 590:
+        case 591:
+        case 592:
+        case 593:
+        case 594:
+        case 595:
+        case 596:
+        case 597:
+        case 598:
+        case 599:
+        case 600:
+        case 601:
+        case 602:
+        case 603:
+        case 604:
+        case 605:
+        case 606:
+        case 607:
+        case 608:
+        case 609:
+        case 610:
+        case 611:
+        case 612:
+        case 613:
+        case 614:
+        case 615:
+        case 616:
+        case 617:
+        case 618:
+        case 619:
+        case 620:
+        case 621:
+        case 622:
+        case 623:
+        case 624:
+        case 625:
+        case 626:
+        case 627:
+        case 628:
+        case 629:
+        case 630:
+        case 631:
+        case 632:
+        case 633:
+        case 634:
+        case 635:
+        case 636:
+        case 637:
+        case 638:
+        case 639:
+        case 640:
+        case 641:
+        case 642:
+        case 643:
+        case 644:
+        case 645:
+        case 646:
+        case 647:
+        case 648:
+        case 649:
+        case 650:
+        case 651:
+        case 652:
+        case 653:
+        case 654:
+        case 655:
+        case 656:
+        case 657:
+        case 658:
+        case 659:
+        case 660:
+        case 661:
+        case 662:
+        case 663:
+        case 664:
+        case 665:
+        case 666:
+        case 667:
+        case 668:
+        case 669:
+        case 670:
+        case 671:
+        case 672:
+        case 673:
+        case 674:
+        case 675:
+        case 676:
+        case 677:
+        case 678:
+        case 679:
+        case 680:
+        case 681:
+        case 682:
+        case 683:
+        case 684:
+        case 685:
+        case 686:
+        case 687:
+        case 688:
+        case 689:
+        case 690:
+        case 691:
+        case 692:
+        case 693:
+        case 694:
+        case 695:
+        case 696:
+        case 697:
+        case 698:
+        case 699:
+        case 700:
+        case 701:
+        case 702:
+        case 703:
+        case 704:
+        case 705:
+        case 706:
+        case 707:
+        case 708:
+        case 709:
+        case 710:
+        case 711:
+        case 712:
+        case 713:
+        case 714:
+        case 715:
+        case 716:
+        case 717:
+        case 718:
+        case 719:
+        case 720:
+        case 721:
+        case 722:
+        case 723:
+        case 724:
+        case 725:
+        case 726:
+        case 727:
+        case 728:
+        case 729:
+        case 730:
+        case 731:
+        case 732:
+        case 733:
+        case 734:
+        case 735:
+        case 736:
+        case 737:
+        case 738:
+        case 739:
+        case 740:
+        case 741:
+        case 742:
+        case 743:
+        case 744:
+        case 745:
+        case 746:
+        case 747:
+        case 748:
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::popStack( void )
+{
+    callDtor( myStack.top().first.second, myStack.top().second );
+    myStack.pop();
+}
+
+
+////////////////////////////////////////
+
+
+ParserAct privBenchImpl::findParserAction( int &newVal, int tok )
+{
+    int stateNum;
+    ParserAct retval = PA_NOP;
+    bool found = false;
+
+    stateNum = myStack.empty() ? 0 : myStack.top().first.first;
+    ActionMap::iterator i = myStates[stateNum].find( tok );
+    if ( tok >= 0 && tok <= 1249 )
+    {
+        if ( i != myStates[stateNum].end() )
+        {
+            retval = (*i).second.first;
+            newVal = (*i).second.second;
+            found = true;
+        }
+    }
+    else if ( ! myStates[stateNum].empty() )
+    {
+        retval = PA_NOP;
+        newVal = 0;
+        found = true;
+    }
+
+    if ( ! found )
+    {
+        retval = myStateDefaultActions[stateNum].first;
+        newVal = myStateDefaultActions[stateNum].second;
+    }
+    return retval;
+}
+
+
+////////////////////////////////////////
+
+
+static int theStateTable[4235][4] =
+{
+    // State 0
+    { 0, 1, PA_SHIFT, 4 },
+    // State 0
+    { 0, 251, PA_SHIFT, 5 },
+    // State 0
+    { 0, 749, PA_SHIFT, 1743 },
+    // State 0
+    { 0, 999, PA_SHIFT, 1 },
+    // State 0
+    { 0, 1248, PA_ACCEPT, 0 },
+    // State 1
+    { 1, 0, PA_REDUCE, 0 },
+    // State 1
+    { 1, 250, PA_SHIFT, 2 },
+    // State 2
+    { 2, 1, PA_SHIFT, 4 },
+    // State 2
+    { 2, 251, PA_SHIFT, 5 },
+    // State 2
+    { 2, 749, PA_SHIFT, 3 },
+    // State 3
+    { 3, 1249, PA_REDUCE, 1 },
+    // State 3 default action
+    { 3, -1, PA_REDUCE, 1 },
+    // State 4
+    { 4, 1249, PA_REDUCE, 3 },
+    // State 4 default action
+    { 4, -1, PA_REDUCE, 3 },
+    // State 5
+    { 5, 2, PA_SHIFT, 10 },
+    // State 5
+    { 5, 252, PA_SHIFT, 11 },
+    // State 5
+    { 5, 750, PA_SHIFT, 1742 },
+    // State 5
+    { 5, 1000, PA_SHIFT, 6 },
+    // State 6
+    { 6, 250, PA_SHIFT, 8 },
+    // State 6
+    { 6, 500, PA_SHIFT, 7 },
+    // State 7
+    { 7, 1249, PA_REDUCE, 4 },
+    // State 7 default action
+    { 7, -1, PA_REDUCE, 4 },
+    // State 8
+    { 8, 2, PA_SHIFT, 10 },
+    // State 8
+    { 8, 252, PA_SHIFT, 11 },
+    // State 8
+    { 8, 750, PA_SHIFT, 9 },
+    // State 9
+    { 9, 1249, PA_REDUCE, 5 },
+    // State 9 default action
+    { 9, -1, PA_REDUCE, 5 },
+    // State 10
+    { 10, 1249, PA_REDUCE, 7 },
+    // State 10 default action
+    { 10, -1, PA_REDUCE, 7 },
+    // State 11
+    { 11, 113, PA_SHIFT, 16 },
+    // State 11
+    { 11, 363, PA_SHIFT, 17 },
+    // State 11
+    { 11, 861, PA_SHIFT, 1741 },
+    // State 11
+    { 11, 1111, PA_SHIFT, 12 },
+    // State 12
+    { 12, 250, PA_SHIFT, 14 },
+    // State 12
+    { 12, 501, PA_SHIFT, 13 },
+    // State 13
+    { 13, 1249, PA_REDUCE, 8 },
+    // State 13 default action
+    { 13, -1, PA_REDUCE, 8 },
+    // State 14
+    { 14, 113, PA_SHIFT, 16 },
+    // State 14
+    { 14, 363, PA_SHIFT, 17 },
+    // State 14
+    { 14, 861, PA_SHIFT, 15 },
+    // State 15
+    { 15, 1249, PA_REDUCE, 9 },
+    // State 15 default action
+    { 15, -1, PA_REDUCE, 9 },
+    // State 16
+    { 16, 1249, PA_REDUCE, 11 },
+    // State 16 default action
+    { 16, -1, PA_REDUCE, 11 },
+    // State 17
+    { 17, 173, PA_SHIFT, 22 },
+    // State 17
+    { 17, 423, PA_SHIFT, 23 },
+    // State 17
+    { 17, 921, PA_SHIFT, 1740 },
+    // State 17
+    { 17, 1171, PA_SHIFT, 18 },
+    // State 18
+    { 18, 250, PA_SHIFT, 20 },
+    // State 18
+    { 18, 612, PA_SHIFT, 19 },
+    // State 19
+    { 19, 1249, PA_REDUCE, 12 },
+    // State 19 default action
+    { 19, -1, PA_REDUCE, 12 },
+    // State 20
+    { 20, 173, PA_SHIFT, 22 },
+    // State 20
+    { 20, 423, PA_SHIFT, 23 },
+    // State 20
+    { 20, 921, PA_SHIFT, 21 },
+    // State 21
+    { 21, 1249, PA_REDUCE, 13 },
+    // State 21 default action
+    { 21, -1, PA_REDUCE, 13 },
+    // State 22
+    { 22, 1249, PA_REDUCE, 15 },
+    // State 22 default action
+    { 22, -1, PA_REDUCE, 15 },
+    // State 23
+    { 23, 184, PA_SHIFT, 28 },
+    // State 23
+    { 23, 434, PA_SHIFT, 29 },
+    // State 23
+    { 23, 932, PA_SHIFT, 1739 },
+    // State 23
+    { 23, 1182, PA_SHIFT, 24 },
+    // State 24
+    { 24, 250, PA_SHIFT, 26 },
+    // State 24
+    { 24, 672, PA_SHIFT, 25 },
+    // State 25
+    { 25, 1249, PA_REDUCE, 16 },
+    // State 25 default action
+    { 25, -1, PA_REDUCE, 16 },
+    // State 26
+    { 26, 184, PA_SHIFT, 28 },
+    // State 26
+    { 26, 434, PA_SHIFT, 29 },
+    // State 26
+    { 26, 932, PA_SHIFT, 27 },
+    // State 27
+    { 27, 1249, PA_REDUCE, 17 },
+    // State 27 default action
+    { 27, -1, PA_REDUCE, 17 },
+    // State 28
+    { 28, 1249, PA_REDUCE, 19 },
+    // State 28 default action
+    { 28, -1, PA_REDUCE, 19 },
+    // State 29
+    { 29, 195, PA_SHIFT, 34 },
+    // State 29
+    { 29, 445, PA_SHIFT, 35 },
+    // State 29
+    { 29, 943, PA_SHIFT, 1738 },
+    // State 29
+    { 29, 1193, PA_SHIFT, 30 },
+    // State 30
+    { 30, 250, PA_SHIFT, 32 },
+    // State 30
+    { 30, 683, PA_SHIFT, 31 },
+    // State 31
+    { 31, 1249, PA_REDUCE, 20 },
+    // State 31 default action
+    { 31, -1, PA_REDUCE, 20 },
+    // State 32
+    { 32, 195, PA_SHIFT, 34 },
+    // State 32
+    { 32, 445, PA_SHIFT, 35 },
+    // State 32
+    { 32, 943, PA_SHIFT, 33 },
+    // State 33
+    { 33, 1249, PA_REDUCE, 21 },
+    // State 33 default action
+    { 33, -1, PA_REDUCE, 21 },
+    // State 34
+    { 34, 1249, PA_REDUCE, 23 },
+    // State 34 default action
+    { 34, -1, PA_REDUCE, 23 },
+    // State 35
+    { 35, 206, PA_SHIFT, 40 },
+    // State 35
+    { 35, 456, PA_SHIFT, 41 },
+    // State 35
+    { 35, 954, PA_SHIFT, 1737 },
+    // State 35
+    { 35, 1204, PA_SHIFT, 36 },
+    // State 36
+    { 36, 250, PA_SHIFT, 38 },
+    // State 36
+    { 36, 694, PA_SHIFT, 37 },
+    // State 37
+    { 37, 1249, PA_REDUCE, 24 },
+    // State 37 default action
+    { 37, -1, PA_REDUCE, 24 },
+    // State 38
+    { 38, 206, PA_SHIFT, 40 },
+    // State 38
+    { 38, 456, PA_SHIFT, 41 },
+    // State 38
+    { 38, 954, PA_SHIFT, 39 },
+    // State 39
+    { 39, 1249, PA_REDUCE, 25 },
+    // State 39 default action
+    { 39, -1, PA_REDUCE, 25 },
+    // State 40
+    { 40, 1249, PA_REDUCE, 27 },
+    // State 40 default action
+    { 40, -1, PA_REDUCE, 27 },
+    // State 41
+    { 41, 217, PA_SHIFT, 46 },
+    // State 41
+    { 41, 467, PA_SHIFT, 47 },
+    // State 41
+    { 41, 965, PA_SHIFT, 1736 },
+    // State 41
+    { 41, 1215, PA_SHIFT, 42 },
+    // State 42
+    { 42, 250, PA_SHIFT, 44 },
+    // State 42
+    { 42, 705, PA_SHIFT, 43 },
+    // State 43
+    { 43, 1249, PA_REDUCE, 28 },
+    // State 43 default action
+    { 43, -1, PA_REDUCE, 28 },
+    // State 44
+    { 44, 217, PA_SHIFT, 46 },
+    // State 44
+    { 44, 467, PA_SHIFT, 47 },
+    // State 44
+    { 44, 965, PA_SHIFT, 45 },
+    // State 45
+    { 45, 1249, PA_REDUCE, 29 },
+    // State 45 default action
+    { 45, -1, PA_REDUCE, 29 },
+    // State 46
+    { 46, 1249, PA_REDUCE, 31 },
+    // State 46 default action
+    { 46, -1, PA_REDUCE, 31 },
+    // State 47
+    { 47, 228, PA_SHIFT, 52 },
+    // State 47
+    { 47, 478, PA_SHIFT, 53 },
+    // State 47
+    { 47, 976, PA_SHIFT, 1735 },
+    // State 47
+    { 47, 1226, PA_SHIFT, 48 },
+    // State 48
+    { 48, 250, PA_SHIFT, 50 },
+    // State 48
+    { 48, 716, PA_SHIFT, 49 },
+    // State 49
+    { 49, 1249, PA_REDUCE, 32 },
+    // State 49 default action
+    { 49, -1, PA_REDUCE, 32 },
+    // State 50
+    { 50, 228, PA_SHIFT, 52 },
+    // State 50
+    { 50, 478, PA_SHIFT, 53 },
+    // State 50
+    { 50, 976, PA_SHIFT, 51 },
+    // State 51
+    { 51, 1249, PA_REDUCE, 33 },
+    // State 51 default action
+    { 51, -1, PA_REDUCE, 33 },
+    // State 52
+    { 52, 1249, PA_REDUCE, 35 },
+    // State 52 default action
+    { 52, -1, PA_REDUCE, 35 },
+    // State 53
+    { 53, 239, PA_SHIFT, 58 },
+    // State 53
+    { 53, 489, PA_SHIFT, 59 },
+    // State 53
+    { 53, 987, PA_SHIFT, 1734 },
+    // State 53
+    { 53, 1237, PA_SHIFT, 54 },
+    // State 54
+    { 54, 250, PA_SHIFT, 56 },
+    // State 54
+    { 54, 727, PA_SHIFT, 55 },
+    // State 55
+    { 55, 1249, PA_REDUCE, 36 },
+    // State 55 default action
+    { 55, -1, PA_REDUCE, 36 },
+    // State 56
+    { 56, 239, PA_SHIFT, 58 },
+    // State 56
+    { 56, 489, PA_SHIFT, 59 },
+    // State 56
+    { 56, 987, PA_SHIFT, 57 },
+    // State 57
+    { 57, 1249, PA_REDUCE, 37 },
+    // State 57 default action
+    { 57, -1, PA_REDUCE, 37 },
+    // State 58
+    { 58, 1249, PA_REDUCE, 39 },
+    // State 58 default action
+    { 58, -1, PA_REDUCE, 39 },
+    // State 59
+    { 59, 3, PA_SHIFT, 64 },
+    // State 59
+    { 59, 253, PA_SHIFT, 65 },
+    // State 59
+    { 59, 751, PA_SHIFT, 1733 },
+    // State 59
+    { 59, 1001, PA_SHIFT, 60 },
+    // State 60
+    { 60, 250, PA_SHIFT, 62 },
+    // State 60
+    { 60, 738, PA_SHIFT, 61 },
+    // State 61
+    { 61, 1249, PA_REDUCE, 40 },
+    // State 61 default action
+    { 61, -1, PA_REDUCE, 40 },
+    // State 62
+    { 62, 3, PA_SHIFT, 64 },
+    // State 62
+    { 62, 253, PA_SHIFT, 65 },
+    // State 62
+    { 62, 751, PA_SHIFT, 63 },
+    // State 63
+    { 63, 1249, PA_REDUCE, 41 },
+    // State 63 default action
+    { 63, -1, PA_REDUCE, 41 },
+    // State 64
+    { 64, 1249, PA_REDUCE, 43 },
+    // State 64 default action
+    { 64, -1, PA_REDUCE, 43 },
+    // State 65
+    { 65, 14, PA_SHIFT, 70 },
+    // State 65
+    { 65, 264, PA_SHIFT, 71 },
+    // State 65
+    { 65, 762, PA_SHIFT, 1732 },
+    // State 65
+    { 65, 1012, PA_SHIFT, 66 },
+    // State 66
+    { 66, 250, PA_SHIFT, 68 },
+    // State 66
+    { 66, 502, PA_SHIFT, 67 },
+    // State 67
+    { 67, 1249, PA_REDUCE, 44 },
+    // State 67 default action
+    { 67, -1, PA_REDUCE, 44 },
+    // State 68
+    { 68, 14, PA_SHIFT, 70 },
+    // State 68
+    { 68, 264, PA_SHIFT, 71 },
+    // State 68
+    { 68, 762, PA_SHIFT, 69 },
+    // State 69
+    { 69, 1249, PA_REDUCE, 45 },
+    // State 69 default action
+    { 69, -1, PA_REDUCE, 45 },
+    // State 70
+    { 70, 1249, PA_REDUCE, 47 },
+    // State 70 default action
+    { 70, -1, PA_REDUCE, 47 },
+    // State 71
+    { 71, 25, PA_SHIFT, 76 },
+    // State 71
+    { 71, 275, PA_SHIFT, 77 },
+    // State 71
+    { 71, 773, PA_SHIFT, 1731 },
+    // State 71
+    { 71, 1023, PA_SHIFT, 72 },
+    // State 72
+    { 72, 250, PA_SHIFT, 74 },
+    // State 72
+    { 72, 513, PA_SHIFT, 73 },
+    // State 73
+    { 73, 1249, PA_REDUCE, 48 },
+    // State 73 default action
+    { 73, -1, PA_REDUCE, 48 },
+    // State 74
+    { 74, 25, PA_SHIFT, 76 },
+    // State 74
+    { 74, 275, PA_SHIFT, 77 },
+    // State 74
+    { 74, 773, PA_SHIFT, 75 },
+    // State 75
+    { 75, 1249, PA_REDUCE, 49 },
+    // State 75 default action
+    { 75, -1, PA_REDUCE, 49 },
+    // State 76
+    { 76, 1249, PA_REDUCE, 51 },
+    // State 76 default action
+    { 76, -1, PA_REDUCE, 51 },
+    // State 77
+    { 77, 36, PA_SHIFT, 82 },
+    // State 77
+    { 77, 286, PA_SHIFT, 83 },
+    // State 77
+    { 77, 784, PA_SHIFT, 1730 },
+    // State 77
+    { 77, 1034, PA_SHIFT, 78 },
+    // State 78
+    { 78, 250, PA_SHIFT, 80 },
+    // State 78
+    { 78, 524, PA_SHIFT, 79 },
+    // State 79
+    { 79, 1249, PA_REDUCE, 52 },
+    // State 79 default action
+    { 79, -1, PA_REDUCE, 52 },
+    // State 80
+    { 80, 36, PA_SHIFT, 82 },
+    // State 80
+    { 80, 286, PA_SHIFT, 83 },
+    // State 80
+    { 80, 784, PA_SHIFT, 81 },
+    // State 81
+    { 81, 1249, PA_REDUCE, 53 },
+    // State 81 default action
+    { 81, -1, PA_REDUCE, 53 },
+    // State 82
+    { 82, 1249, PA_REDUCE, 55 },
+    // State 82 default action
+    { 82, -1, PA_REDUCE, 55 },
+    // State 83
+    { 83, 47, PA_SHIFT, 88 },
+    // State 83
+    { 83, 297, PA_SHIFT, 89 },
+    // State 83
+    { 83, 795, PA_SHIFT, 1729 },
+    // State 83
+    { 83, 1045, PA_SHIFT, 84 },
+    // State 84
+    { 84, 250, PA_SHIFT, 86 },
+    // State 84
+    { 84, 535, PA_SHIFT, 85 },
+    // State 85
+    { 85, 1249, PA_REDUCE, 56 },
+    // State 85 default action
+    { 85, -1, PA_REDUCE, 56 },
+    // State 86
+    { 86, 47, PA_SHIFT, 88 },
+    // State 86
+    { 86, 297, PA_SHIFT, 89 },
+    // State 86
+    { 86, 795, PA_SHIFT, 87 },
+    // State 87
+    { 87, 1249, PA_REDUCE, 57 },
+    // State 87 default action
+    { 87, -1, PA_REDUCE, 57 },
+    // State 88
+    { 88, 1249, PA_REDUCE, 59 },
+    // State 88 default action
+    { 88, -1, PA_REDUCE, 59 },
+    // State 89
+    { 89, 58, PA_SHIFT, 94 },
+    // State 89
+    { 89, 308, PA_SHIFT, 95 },
+    // State 89
+    { 89, 806, PA_SHIFT, 1728 },
+    // State 89
+    { 89, 1056, PA_SHIFT, 90 },
+    // State 90
+    { 90, 250, PA_SHIFT, 92 },
+    // State 90
+    { 90, 546, PA_SHIFT, 91 },
+    // State 91
+    { 91, 1249, PA_REDUCE, 60 },
+    // State 91 default action
+    { 91, -1, PA_REDUCE, 60 },
+    // State 92
+    { 92, 58, PA_SHIFT, 94 },
+    // State 92
+    { 92, 308, PA_SHIFT, 95 },
+    // State 92
+    { 92, 806, PA_SHIFT, 93 },
+    // State 93
+    { 93, 1249, PA_REDUCE, 61 },
+    // State 93 default action
+    { 93, -1, PA_REDUCE, 61 },
+    // State 94
+    { 94, 1249, PA_REDUCE, 63 },
+    // State 94 default action
+    { 94, -1, PA_REDUCE, 63 },
+    // State 95
+    { 95, 69, PA_SHIFT, 100 },
+    // State 95
+    { 95, 319, PA_SHIFT, 101 },
+    // State 95
+    { 95, 817, PA_SHIFT, 1727 },
+    // State 95
+    { 95, 1067, PA_SHIFT, 96 },
+    // State 96
+    { 96, 250, PA_SHIFT, 98 },
+    // State 96
+    { 96, 557, PA_SHIFT, 97 },
+    // State 97
+    { 97, 1249, PA_REDUCE, 64 },
+    // State 97 default action
+    { 97, -1, PA_REDUCE, 64 },
+    // State 98
+    { 98, 69, PA_SHIFT, 100 },
+    // State 98
+    { 98, 319, PA_SHIFT, 101 },
+    // State 98
+    { 98, 817, PA_SHIFT, 99 },
+    // State 99
+    { 99, 1249, PA_REDUCE, 65 },
+    // State 99 default action
+    { 99, -1, PA_REDUCE, 65 },
+    // State 100
+    { 100, 1249, PA_REDUCE, 67 },
+    // State 100 default action
+    { 100, -1, PA_REDUCE, 67 },
+    // State 101
+    { 101, 80, PA_SHIFT, 106 },
+    // State 101
+    { 101, 330, PA_SHIFT, 107 },
+    // State 101
+    { 101, 828, PA_SHIFT, 1726 },
+    // State 101
+    { 101, 1078, PA_SHIFT, 102 },
+    // State 102
+    { 102, 250, PA_SHIFT, 104 },
+    // State 102
+    { 102, 568, PA_SHIFT, 103 },
+    // State 103
+    { 103, 1249, PA_REDUCE, 68 },
+    // State 103 default action
+    { 103, -1, PA_REDUCE, 68 },
+    // State 104
+    { 104, 80, PA_SHIFT, 106 },
+    // State 104
+    { 104, 330, PA_SHIFT, 107 },
+    // State 104
+    { 104, 828, PA_SHIFT, 105 },
+    // State 105
+    { 105, 1249, PA_REDUCE, 69 },
+    // State 105 default action
+    { 105, -1, PA_REDUCE, 69 },
+    // State 106
+    { 106, 1249, PA_REDUCE, 71 },
+    // State 106 default action
+    { 106, -1, PA_REDUCE, 71 },
+    // State 107
+    { 107, 91, PA_SHIFT, 112 },
+    // State 107
+    { 107, 341, PA_SHIFT, 113 },
+    // State 107
+    { 107, 839, PA_SHIFT, 1725 },
+    // State 107
+    { 107, 1089, PA_SHIFT, 108 },
+    // State 108
+    { 108, 250, PA_SHIFT, 110 },
+    // State 108
+    { 108, 579, PA_SHIFT, 109 },
+    // State 109
+    { 109, 1249, PA_REDUCE, 72 },
+    // State 109 default action
+    { 109, -1, PA_REDUCE, 72 },
+    // State 110
+    { 110, 91, PA_SHIFT, 112 },
+    // State 110
+    { 110, 341, PA_SHIFT, 113 },
+    // State 110
+    { 110, 839, PA_SHIFT, 111 },
+    // State 111
+    { 111, 1249, PA_REDUCE, 73 },
+    // State 111 default action
+    { 111, -1, PA_REDUCE, 73 },
+    // State 112
+    { 112, 1249, PA_REDUCE, 75 },
+    // State 112 default action
+    { 112, -1, PA_REDUCE, 75 },
+    // State 113
+    { 113, 102, PA_SHIFT, 118 },
+    // State 113
+    { 113, 352, PA_SHIFT, 119 },
+    // State 113
+    { 113, 850, PA_SHIFT, 1724 },
+    // State 113
+    { 113, 1100, PA_SHIFT, 114 },
+    // State 114
+    { 114, 250, PA_SHIFT, 116 },
+    // State 114
+    { 114, 590, PA_SHIFT, 115 },
+    // State 115
+    { 115, 1249, PA_REDUCE, 76 },
+    // State 115 default action
+    { 115, -1, PA_REDUCE, 76 },
+    // State 116
+    { 116, 102, PA_SHIFT, 118 },
+    // State 116
+    { 116, 352, PA_SHIFT, 119 },
+    // State 116
+    { 116, 850, PA_SHIFT, 117 },
+    // State 117
+    { 117, 1249, PA_REDUCE, 77 },
+    // State 117 default action
+    { 117, -1, PA_REDUCE, 77 },
+    // State 118
+    { 118, 1249, PA_REDUCE, 79 },
+    // State 118 default action
+    { 118, -1, PA_REDUCE, 79 },
+    // State 119
+    { 119, 114, PA_SHIFT, 124 },
+    // State 119
+    { 119, 364, PA_SHIFT, 125 },
+    // State 119
+    { 119, 862, PA_SHIFT, 1723 },
+    // State 119
+    { 119, 1112, PA_SHIFT, 120 },
+    // State 120
+    { 120, 250, PA_SHIFT, 122 },
+    // State 120
+    { 120, 601, PA_SHIFT, 121 },
+    // State 121
+    { 121, 1249, PA_REDUCE, 80 },
+    // State 121 default action
+    { 121, -1, PA_REDUCE, 80 },
+    // State 122
+    { 122, 114, PA_SHIFT, 124 },
+    // State 122
+    { 122, 364, PA_SHIFT, 125 },
+    // State 122
+    { 122, 862, PA_SHIFT, 123 },
+    // State 123
+    { 123, 1249, PA_REDUCE, 81 },
+    // State 123 default action
+    { 123, -1, PA_REDUCE, 81 },
+    // State 124
+    { 124, 1249, PA_REDUCE, 83 },
+    // State 124 default action
+    { 124, -1, PA_REDUCE, 83 },
+    // State 125
+    { 125, 125, PA_SHIFT, 130 },
+    // State 125
+    { 125, 375, PA_SHIFT, 131 },
+    // State 125
+    { 125, 873, PA_SHIFT, 1722 },
+    // State 125
+    { 125, 1123, PA_SHIFT, 126 },
+    // State 126
+    { 126, 250, PA_SHIFT, 128 },
+    // State 126
+    { 126, 613, PA_SHIFT, 127 },
+    // State 127
+    { 127, 1249, PA_REDUCE, 84 },
+    // State 127 default action
+    { 127, -1, PA_REDUCE, 84 },
+    // State 128
+    { 128, 125, PA_SHIFT, 130 },
+    // State 128
+    { 128, 375, PA_SHIFT, 131 },
+    // State 128
+    { 128, 873, PA_SHIFT, 129 },
+    // State 129
+    { 129, 1249, PA_REDUCE, 85 },
+    // State 129 default action
+    { 129, -1, PA_REDUCE, 85 },
+    // State 130
+    { 130, 1249, PA_REDUCE, 87 },
+    // State 130 default action
+    { 130, -1, PA_REDUCE, 87 },
+    // State 131
+    { 131, 136, PA_SHIFT, 136 },
+    // State 131
+    { 131, 386, PA_SHIFT, 137 },
+    // State 131
+    { 131, 884, PA_SHIFT, 1721 },
+    // State 131
+    { 131, 1134, PA_SHIFT, 132 },
+    // State 132
+    { 132, 250, PA_SHIFT, 134 },
+    // State 132
+    { 132, 624, PA_SHIFT, 133 },
+    // State 133
+    { 133, 1249, PA_REDUCE, 88 },
+    // State 133 default action
+    { 133, -1, PA_REDUCE, 88 },
+    // State 134
+    { 134, 136, PA_SHIFT, 136 },
+    // State 134
+    { 134, 386, PA_SHIFT, 137 },
+    // State 134
+    { 134, 884, PA_SHIFT, 135 },
+    // State 135
+    { 135, 1249, PA_REDUCE, 89 },
+    // State 135 default action
+    { 135, -1, PA_REDUCE, 89 },
+    // State 136
+    { 136, 1249, PA_REDUCE, 91 },
+    // State 136 default action
+    { 136, -1, PA_REDUCE, 91 },
+    // State 137
+    { 137, 147, PA_SHIFT, 142 },
+    // State 137
+    { 137, 397, PA_SHIFT, 143 },
+    // State 137
+    { 137, 895, PA_SHIFT, 1720 },
+    // State 137
+    { 137, 1145, PA_SHIFT, 138 },
+    // State 138
+    { 138, 250, PA_SHIFT, 140 },
+    // State 138
+    { 138, 635, PA_SHIFT, 139 },
+    // State 139
+    { 139, 1249, PA_REDUCE, 92 },
+    // State 139 default action
+    { 139, -1, PA_REDUCE, 92 },
+    // State 140
+    { 140, 147, PA_SHIFT, 142 },
+    // State 140
+    { 140, 397, PA_SHIFT, 143 },
+    // State 140
+    { 140, 895, PA_SHIFT, 141 },
+    // State 141
+    { 141, 1249, PA_REDUCE, 93 },
+    // State 141 default action
+    { 141, -1, PA_REDUCE, 93 },
+    // State 142
+    { 142, 1249, PA_REDUCE, 95 },
+    // State 142 default action
+    { 142, -1, PA_REDUCE, 95 },
+    // State 143
+    { 143, 158, PA_SHIFT, 148 },
+    // State 143
+    { 143, 408, PA_SHIFT, 149 },
+    // State 143
+    { 143, 906, PA_SHIFT, 1719 },
+    // State 143
+    { 143, 1156, PA_SHIFT, 144 },
+    // State 144
+    { 144, 250, PA_SHIFT, 146 },
+    // State 144
+    { 144, 646, PA_SHIFT, 145 },
+    // State 145
+    { 145, 1249, PA_REDUCE, 96 },
+    // State 145 default action
+    { 145, -1, PA_REDUCE, 96 },
+    // State 146
+    { 146, 158, PA_SHIFT, 148 },
+    // State 146
+    { 146, 408, PA_SHIFT, 149 },
+    // State 146
+    { 146, 906, PA_SHIFT, 147 },
+    // State 147
+    { 147, 1249, PA_REDUCE, 97 },
+    // State 147 default action
+    { 147, -1, PA_REDUCE, 97 },
+    // State 148
+    { 148, 1249, PA_REDUCE, 99 },
+    // State 148 default action
+    { 148, -1, PA_REDUCE, 99 },
+    // State 149
+    { 149, 168, PA_SHIFT, 154 },
+    // State 149
+    { 149, 418, PA_SHIFT, 155 },
+    // State 149
+    { 149, 916, PA_SHIFT, 1718 },
+    // State 149
+    { 149, 1166, PA_SHIFT, 150 },
+    // State 150
+    { 150, 250, PA_SHIFT, 152 },
+    // State 150
+    { 150, 657, PA_SHIFT, 151 },
+    // State 151
+    { 151, 1249, PA_REDUCE, 100 },
+    // State 151 default action
+    { 151, -1, PA_REDUCE, 100 },
+    // State 152
+    { 152, 168, PA_SHIFT, 154 },
+    // State 152
+    { 152, 418, PA_SHIFT, 155 },
+    // State 152
+    { 152, 916, PA_SHIFT, 153 },
+    // State 153
+    { 153, 1249, PA_REDUCE, 101 },
+    // State 153 default action
+    { 153, -1, PA_REDUCE, 101 },
+    // State 154
+    { 154, 1249, PA_REDUCE, 103 },
+    // State 154 default action
+    { 154, -1, PA_REDUCE, 103 },
+    // State 155
+    { 155, 169, PA_SHIFT, 160 },
+    // State 155
+    { 155, 419, PA_SHIFT, 161 },
+    // State 155
+    { 155, 917, PA_SHIFT, 1717 },
+    // State 155
+    { 155, 1167, PA_SHIFT, 156 },
+    // State 156
+    { 156, 250, PA_SHIFT, 158 },
+    // State 156
+    { 156, 667, PA_SHIFT, 157 },
+    // State 157
+    { 157, 1249, PA_REDUCE, 104 },
+    // State 157 default action
+    { 157, -1, PA_REDUCE, 104 },
+    // State 158
+    { 158, 169, PA_SHIFT, 160 },
+    // State 158
+    { 158, 419, PA_SHIFT, 161 },
+    // State 158
+    { 158, 917, PA_SHIFT, 159 },
+    // State 159
+    { 159, 1249, PA_REDUCE, 105 },
+    // State 159 default action
+    { 159, -1, PA_REDUCE, 105 },
+    // State 160
+    { 160, 1249, PA_REDUCE, 107 },
+    // State 160 default action
+    { 160, -1, PA_REDUCE, 107 },
+    // State 161
+    { 161, 170, PA_SHIFT, 166 },
+    // State 161
+    { 161, 420, PA_SHIFT, 167 },
+    // State 161
+    { 161, 918, PA_SHIFT, 1716 },
+    // State 161
+    { 161, 1168, PA_SHIFT, 162 },
+    // State 162
+    { 162, 250, PA_SHIFT, 164 },
+    // State 162
+    { 162, 668, PA_SHIFT, 163 },
+    // State 163
+    { 163, 1249, PA_REDUCE, 108 },
+    // State 163 default action
+    { 163, -1, PA_REDUCE, 108 },
+    // State 164
+    { 164, 170, PA_SHIFT, 166 },
+    // State 164
+    { 164, 420, PA_SHIFT, 167 },
+    // State 164
+    { 164, 918, PA_SHIFT, 165 },
+    // State 165
+    { 165, 1249, PA_REDUCE, 109 },
+    // State 165 default action
+    { 165, -1, PA_REDUCE, 109 },
+    // State 166
+    { 166, 1249, PA_REDUCE, 111 },
+    // State 166 default action
+    { 166, -1, PA_REDUCE, 111 },
+    // State 167
+    { 167, 171, PA_SHIFT, 172 },
+    // State 167
+    { 167, 421, PA_SHIFT, 173 },
+    // State 167
+    { 167, 919, PA_SHIFT, 1715 },
+    // State 167
+    { 167, 1169, PA_SHIFT, 168 },
+    // State 168
+    { 168, 250, PA_SHIFT, 170 },
+    // State 168
+    { 168, 669, PA_SHIFT, 169 },
+    // State 169
+    { 169, 1249, PA_REDUCE, 112 },
+    // State 169 default action
+    { 169, -1, PA_REDUCE, 112 },
+    // State 170
+    { 170, 171, PA_SHIFT, 172 },
+    // State 170
+    { 170, 421, PA_SHIFT, 173 },
+    // State 170
+    { 170, 919, PA_SHIFT, 171 },
+    // State 171
+    { 171, 1249, PA_REDUCE, 113 },
+    // State 171 default action
+    { 171, -1, PA_REDUCE, 113 },
+    // State 172
+    { 172, 1249, PA_REDUCE, 115 },
+    // State 172 default action
+    { 172, -1, PA_REDUCE, 115 },
+    // State 173
+    { 173, 172, PA_SHIFT, 178 },
+    // State 173
+    { 173, 422, PA_SHIFT, 179 },
+    // State 173
+    { 173, 920, PA_SHIFT, 1714 },
+    // State 173
+    { 173, 1170, PA_SHIFT, 174 },
+    // State 174
+    { 174, 250, PA_SHIFT, 176 },
+    // State 174
+    { 174, 670, PA_SHIFT, 175 },
+    // State 175
+    { 175, 1249, PA_REDUCE, 116 },
+    // State 175 default action
+    { 175, -1, PA_REDUCE, 116 },
+    // State 176
+    { 176, 172, PA_SHIFT, 178 },
+    // State 176
+    { 176, 422, PA_SHIFT, 179 },
+    // State 176
+    { 176, 920, PA_SHIFT, 177 },
+    // State 177
+    { 177, 1249, PA_REDUCE, 117 },
+    // State 177 default action
+    { 177, -1, PA_REDUCE, 117 },
+    // State 178
+    { 178, 1249, PA_REDUCE, 119 },
+    // State 178 default action
+    { 178, -1, PA_REDUCE, 119 },
+    // State 179
+    { 179, 174, PA_SHIFT, 184 },
+    // State 179
+    { 179, 424, PA_SHIFT, 185 },
+    // State 179
+    { 179, 922, PA_SHIFT, 1713 },
+    // State 179
+    { 179, 1172, PA_SHIFT, 180 },
+    // State 180
+    { 180, 250, PA_SHIFT, 182 },
+    // State 180
+    { 180, 671, PA_SHIFT, 181 },
+    // State 181
+    { 181, 1249, PA_REDUCE, 120 },
+    // State 181 default action
+    { 181, -1, PA_REDUCE, 120 },
+    // State 182
+    { 182, 174, PA_SHIFT, 184 },
+    // State 182
+    { 182, 424, PA_SHIFT, 185 },
+    // State 182
+    { 182, 922, PA_SHIFT, 183 },
+    // State 183
+    { 183, 1249, PA_REDUCE, 121 },
+    // State 183 default action
+    { 183, -1, PA_REDUCE, 121 },
+    // State 184
+    { 184, 1249, PA_REDUCE, 123 },
+    // State 184 default action
+    { 184, -1, PA_REDUCE, 123 },
+    // State 185
+    { 185, 175, PA_SHIFT, 190 },
+    // State 185
+    { 185, 425, PA_SHIFT, 191 },
+    // State 185
+    { 185, 923, PA_SHIFT, 1712 },
+    // State 185
+    { 185, 1173, PA_SHIFT, 186 },
+    // State 186
+    { 186, 250, PA_SHIFT, 188 },
+    // State 186
+    { 186, 673, PA_SHIFT, 187 },
+    // State 187
+    { 187, 1249, PA_REDUCE, 124 },
+    // State 187 default action
+    { 187, -1, PA_REDUCE, 124 },
+    // State 188
+    { 188, 175, PA_SHIFT, 190 },
+    // State 188
+    { 188, 425, PA_SHIFT, 191 },
+    // State 188
+    { 188, 923, PA_SHIFT, 189 },
+    // State 189
+    { 189, 1249, PA_REDUCE, 125 },
+    // State 189 default action
+    { 189, -1, PA_REDUCE, 125 },
+    // State 190
+    { 190, 1249, PA_REDUCE, 127 },
+    // State 190 default action
+    { 190, -1, PA_REDUCE, 127 },
+    // State 191
+    { 191, 176, PA_SHIFT, 196 },
+    // State 191
+    { 191, 426, PA_SHIFT, 197 },
+    // State 191
+    { 191, 924, PA_SHIFT, 1711 },
+    // State 191
+    { 191, 1174, PA_SHIFT, 192 },
+    // State 192
+    { 192, 250, PA_SHIFT, 194 },
+    // State 192
+    { 192, 674, PA_SHIFT, 193 },
+    // State 193
+    { 193, 1249, PA_REDUCE, 128 },
+    // State 193 default action
+    { 193, -1, PA_REDUCE, 128 },
+    // State 194
+    { 194, 176, PA_SHIFT, 196 },
+    // State 194
+    { 194, 426, PA_SHIFT, 197 },
+    // State 194
+    { 194, 924, PA_SHIFT, 195 },
+    // State 195
+    { 195, 1249, PA_REDUCE, 129 },
+    // State 195 default action
+    { 195, -1, PA_REDUCE, 129 },
+    // State 196
+    { 196, 1249, PA_REDUCE, 131 },
+    // State 196 default action
+    { 196, -1, PA_REDUCE, 131 },
+    // State 197
+    { 197, 177, PA_SHIFT, 202 },
+    // State 197
+    { 197, 427, PA_SHIFT, 203 },
+    // State 197
+    { 197, 925, PA_SHIFT, 1710 },
+    // State 197
+    { 197, 1175, PA_SHIFT, 198 },
+    // State 198
+    { 198, 250, PA_SHIFT, 200 },
+    // State 198
+    { 198, 675, PA_SHIFT, 199 },
+    // State 199
+    { 199, 1249, PA_REDUCE, 132 },
+    // State 199 default action
+    { 199, -1, PA_REDUCE, 132 },
+    // State 200
+    { 200, 177, PA_SHIFT, 202 },
+    // State 200
+    { 200, 427, PA_SHIFT, 203 },
+    // State 200
+    { 200, 925, PA_SHIFT, 201 },
+    // State 201
+    { 201, 1249, PA_REDUCE, 133 },
+    // State 201 default action
+    { 201, -1, PA_REDUCE, 133 },
+    // State 202
+    { 202, 1249, PA_REDUCE, 135 },
+    // State 202 default action
+    { 202, -1, PA_REDUCE, 135 },
+    // State 203
+    { 203, 178, PA_SHIFT, 208 },
+    // State 203
+    { 203, 428, PA_SHIFT, 209 },
+    // State 203
+    { 203, 926, PA_SHIFT, 1709 },
+    // State 203
+    { 203, 1176, PA_SHIFT, 204 },
+    // State 204
+    { 204, 250, PA_SHIFT, 206 },
+    // State 204
+    { 204, 676, PA_SHIFT, 205 },
+    // State 205
+    { 205, 1249, PA_REDUCE, 136 },
+    // State 205 default action
+    { 205, -1, PA_REDUCE, 136 },
+    // State 206
+    { 206, 178, PA_SHIFT, 208 },
+    // State 206
+    { 206, 428, PA_SHIFT, 209 },
+    // State 206
+    { 206, 926, PA_SHIFT, 207 },
+    // State 207
+    { 207, 1249, PA_REDUCE, 137 },
+    // State 207 default action
+    { 207, -1, PA_REDUCE, 137 },
+    // State 208
+    { 208, 1249, PA_REDUCE, 139 },
+    // State 208 default action
+    { 208, -1, PA_REDUCE, 139 },
+    // State 209
+    { 209, 179, PA_SHIFT, 214 },
+    // State 209
+    { 209, 429, PA_SHIFT, 215 },
+    // State 209
+    { 209, 927, PA_SHIFT, 1708 },
+    // State 209
+    { 209, 1177, PA_SHIFT, 210 },
+    // State 210
+    { 210, 250, PA_SHIFT, 212 },
+    // State 210
+    { 210, 677, PA_SHIFT, 211 },
+    // State 211
+    { 211, 1249, PA_REDUCE, 140 },
+    // State 211 default action
+    { 211, -1, PA_REDUCE, 140 },
+    // State 212
+    { 212, 179, PA_SHIFT, 214 },
+    // State 212
+    { 212, 429, PA_SHIFT, 215 },
+    // State 212
+    { 212, 927, PA_SHIFT, 213 },
+    // State 213
+    { 213, 1249, PA_REDUCE, 141 },
+    // State 213 default action
+    { 213, -1, PA_REDUCE, 141 },
+    // State 214
+    { 214, 1249, PA_REDUCE, 143 },
+    // State 214 default action
+    { 214, -1, PA_REDUCE, 143 },
+    // State 215
+    { 215, 180, PA_SHIFT, 220 },
+    // State 215
+    { 215, 430, PA_SHIFT, 221 },
+    // State 215
+    { 215, 928, PA_SHIFT, 1707 },
+    // State 215
+    { 215, 1178, PA_SHIFT, 216 },
+    // State 216
+    { 216, 250, PA_SHIFT, 218 },
+    // State 216
+    { 216, 678, PA_SHIFT, 217 },
+    // State 217
+    { 217, 1249, PA_REDUCE, 144 },
+    // State 217 default action
+    { 217, -1, PA_REDUCE, 144 },
+    // State 218
+    { 218, 180, PA_SHIFT, 220 },
+    // State 218
+    { 218, 430, PA_SHIFT, 221 },
+    // State 218
+    { 218, 928, PA_SHIFT, 219 },
+    // State 219
+    { 219, 1249, PA_REDUCE, 145 },
+    // State 219 default action
+    { 219, -1, PA_REDUCE, 145 },
+    // State 220
+    { 220, 1249, PA_REDUCE, 147 },
+    // State 220 default action
+    { 220, -1, PA_REDUCE, 147 },
+    // State 221
+    { 221, 181, PA_SHIFT, 226 },
+    // State 221
+    { 221, 431, PA_SHIFT, 227 },
+    // State 221
+    { 221, 929, PA_SHIFT, 1706 },
+    // State 221
+    { 221, 1179, PA_SHIFT, 222 },
+    // State 222
+    { 222, 250, PA_SHIFT, 224 },
+    // State 222
+    { 222, 679, PA_SHIFT, 223 },
+    // State 223
+    { 223, 1249, PA_REDUCE, 148 },
+    // State 223 default action
+    { 223, -1, PA_REDUCE, 148 },
+    // State 224
+    { 224, 181, PA_SHIFT, 226 },
+    // State 224
+    { 224, 431, PA_SHIFT, 227 },
+    // State 224
+    { 224, 929, PA_SHIFT, 225 },
+    // State 225
+    { 225, 1249, PA_REDUCE, 149 },
+    // State 225 default action
+    { 225, -1, PA_REDUCE, 149 },
+    // State 226
+    { 226, 1249, PA_REDUCE, 151 },
+    // State 226 default action
+    { 226, -1, PA_REDUCE, 151 },
+    // State 227
+    { 227, 182, PA_SHIFT, 232 },
+    // State 227
+    { 227, 432, PA_SHIFT, 233 },
+    // State 227
+    { 227, 930, PA_SHIFT, 1705 },
+    // State 227
+    { 227, 1180, PA_SHIFT, 228 },
+    // State 228
+    { 228, 250, PA_SHIFT, 230 },
+    // State 228
+    { 228, 680, PA_SHIFT, 229 },
+    // State 229
+    { 229, 1249, PA_REDUCE, 152 },
+    // State 229 default action
+    { 229, -1, PA_REDUCE, 152 },
+    // State 230
+    { 230, 182, PA_SHIFT, 232 },
+    // State 230
+    { 230, 432, PA_SHIFT, 233 },
+    // State 230
+    { 230, 930, PA_SHIFT, 231 },
+    // State 231
+    { 231, 1249, PA_REDUCE, 153 },
+    // State 231 default action
+    { 231, -1, PA_REDUCE, 153 },
+    // State 232
+    { 232, 1249, PA_REDUCE, 155 },
+    // State 232 default action
+    { 232, -1, PA_REDUCE, 155 },
+    // State 233
+    { 233, 183, PA_SHIFT, 238 },
+    // State 233
+    { 233, 433, PA_SHIFT, 239 },
+    // State 233
+    { 233, 931, PA_SHIFT, 1704 },
+    // State 233
+    { 233, 1181, PA_SHIFT, 234 },
+    // State 234
+    { 234, 250, PA_SHIFT, 236 },
+    // State 234
+    { 234, 681, PA_SHIFT, 235 },
+    // State 235
+    { 235, 1249, PA_REDUCE, 156 },
+    // State 235 default action
+    { 235, -1, PA_REDUCE, 156 },
+    // State 236
+    { 236, 183, PA_SHIFT, 238 },
+    // State 236
+    { 236, 433, PA_SHIFT, 239 },
+    // State 236
+    { 236, 931, PA_SHIFT, 237 },
+    // State 237
+    { 237, 1249, PA_REDUCE, 157 },
+    // State 237 default action
+    { 237, -1, PA_REDUCE, 157 },
+    // State 238
+    { 238, 1249, PA_REDUCE, 159 },
+    // State 238 default action
+    { 238, -1, PA_REDUCE, 159 },
+    // State 239
+    { 239, 185, PA_SHIFT, 244 },
+    // State 239
+    { 239, 435, PA_SHIFT, 245 },
+    // State 239
+    { 239, 933, PA_SHIFT, 1703 },
+    // State 239
+    { 239, 1183, PA_SHIFT, 240 },
+    // State 240
+    { 240, 250, PA_SHIFT, 242 },
+    // State 240
+    { 240, 682, PA_SHIFT, 241 },
+    // State 241
+    { 241, 1249, PA_REDUCE, 160 },
+    // State 241 default action
+    { 241, -1, PA_REDUCE, 160 },
+    // State 242
+    { 242, 185, PA_SHIFT, 244 },
+    // State 242
+    { 242, 435, PA_SHIFT, 245 },
+    // State 242
+    { 242, 933, PA_SHIFT, 243 },
+    // State 243
+    { 243, 1249, PA_REDUCE, 161 },
+    // State 243 default action
+    { 243, -1, PA_REDUCE, 161 },
+    // State 244
+    { 244, 1249, PA_REDUCE, 163 },
+    // State 244 default action
+    { 244, -1, PA_REDUCE, 163 },
+    // State 245
+    { 245, 186, PA_SHIFT, 250 },
+    // State 245
+    { 245, 436, PA_SHIFT, 251 },
+    // State 245
+    { 245, 934, PA_SHIFT, 1702 },
+    // State 245
+    { 245, 1184, PA_SHIFT, 246 },
+    // State 246
+    { 246, 250, PA_SHIFT, 248 },
+    // State 246
+    { 246, 684, PA_SHIFT, 247 },
+    // State 247
+    { 247, 1249, PA_REDUCE, 164 },
+    // State 247 default action
+    { 247, -1, PA_REDUCE, 164 },
+    // State 248
+    { 248, 186, PA_SHIFT, 250 },
+    // State 248
+    { 248, 436, PA_SHIFT, 251 },
+    // State 248
+    { 248, 934, PA_SHIFT, 249 },
+    // State 249
+    { 249, 1249, PA_REDUCE, 165 },
+    // State 249 default action
+    { 249, -1, PA_REDUCE, 165 },
+    // State 250
+    { 250, 1249, PA_REDUCE, 167 },
+    // State 250 default action
+    { 250, -1, PA_REDUCE, 167 },
+    // State 251
+    { 251, 187, PA_SHIFT, 256 },
+    // State 251
+    { 251, 437, PA_SHIFT, 257 },
+    // State 251
+    { 251, 935, PA_SHIFT, 1701 },
+    // State 251
+    { 251, 1185, PA_SHIFT, 252 },
+    // State 252
+    { 252, 250, PA_SHIFT, 254 },
+    // State 252
+    { 252, 685, PA_SHIFT, 253 },
+    // State 253
+    { 253, 1249, PA_REDUCE, 168 },
+    // State 253 default action
+    { 253, -1, PA_REDUCE, 168 },
+    // State 254
+    { 254, 187, PA_SHIFT, 256 },
+    // State 254
+    { 254, 437, PA_SHIFT, 257 },
+    // State 254
+    { 254, 935, PA_SHIFT, 255 },
+    // State 255
+    { 255, 1249, PA_REDUCE, 169 },
+    // State 255 default action
+    { 255, -1, PA_REDUCE, 169 },
+    // State 256
+    { 256, 1249, PA_REDUCE, 171 },
+    // State 256 default action
+    { 256, -1, PA_REDUCE, 171 },
+    // State 257
+    { 257, 188, PA_SHIFT, 262 },
+    // State 257
+    { 257, 438, PA_SHIFT, 263 },
+    // State 257
+    { 257, 936, PA_SHIFT, 1700 },
+    // State 257
+    { 257, 1186, PA_SHIFT, 258 },
+    // State 258
+    { 258, 250, PA_SHIFT, 260 },
+    // State 258
+    { 258, 686, PA_SHIFT, 259 },
+    // State 259
+    { 259, 1249, PA_REDUCE, 172 },
+    // State 259 default action
+    { 259, -1, PA_REDUCE, 172 },
+    // State 260
+    { 260, 188, PA_SHIFT, 262 },
+    // State 260
+    { 260, 438, PA_SHIFT, 263 },
+    // State 260
+    { 260, 936, PA_SHIFT, 261 },
+    // State 261
+    { 261, 1249, PA_REDUCE, 173 },
+    // State 261 default action
+    { 261, -1, PA_REDUCE, 173 },
+    // State 262
+    { 262, 1249, PA_REDUCE, 175 },
+    // State 262 default action
+    { 262, -1, PA_REDUCE, 175 },
+    // State 263
+    { 263, 189, PA_SHIFT, 268 },
+    // State 263
+    { 263, 439, PA_SHIFT, 269 },
+    // State 263
+    { 263, 937, PA_SHIFT, 1699 },
+    // State 263
+    { 263, 1187, PA_SHIFT, 264 },
+    // State 264
+    { 264, 250, PA_SHIFT, 266 },
+    // State 264
+    { 264, 687, PA_SHIFT, 265 },
+    // State 265
+    { 265, 1249, PA_REDUCE, 176 },
+    // State 265 default action
+    { 265, -1, PA_REDUCE, 176 },
+    // State 266
+    { 266, 189, PA_SHIFT, 268 },
+    // State 266
+    { 266, 439, PA_SHIFT, 269 },
+    // State 266
+    { 266, 937, PA_SHIFT, 267 },
+    // State 267
+    { 267, 1249, PA_REDUCE, 177 },
+    // State 267 default action
+    { 267, -1, PA_REDUCE, 177 },
+    // State 268
+    { 268, 1249, PA_REDUCE, 179 },
+    // State 268 default action
+    { 268, -1, PA_REDUCE, 179 },
+    // State 269
+    { 269, 190, PA_SHIFT, 274 },
+    // State 269
+    { 269, 440, PA_SHIFT, 275 },
+    // State 269
+    { 269, 938, PA_SHIFT, 1698 },
+    // State 269
+    { 269, 1188, PA_SHIFT, 270 },
+    // State 270
+    { 270, 250, PA_SHIFT, 272 },
+    // State 270
+    { 270, 688, PA_SHIFT, 271 },
+    // State 271
+    { 271, 1249, PA_REDUCE, 180 },
+    // State 271 default action
+    { 271, -1, PA_REDUCE, 180 },
+    // State 272
+    { 272, 190, PA_SHIFT, 274 },
+    // State 272
+    { 272, 440, PA_SHIFT, 275 },
+    // State 272
+    { 272, 938, PA_SHIFT, 273 },
+    // State 273
+    { 273, 1249, PA_REDUCE, 181 },
+    // State 273 default action
+    { 273, -1, PA_REDUCE, 181 },
+    // State 274
+    { 274, 1249, PA_REDUCE, 183 },
+    // State 274 default action
+    { 274, -1, PA_REDUCE, 183 },
+    // State 275
+    { 275, 191, PA_SHIFT, 280 },
+    // State 275
+    { 275, 441, PA_SHIFT, 281 },
+    // State 275
+    { 275, 939, PA_SHIFT, 1697 },
+    // State 275
+    { 275, 1189, PA_SHIFT, 276 },
+    // State 276
+    { 276, 250, PA_SHIFT, 278 },
+    // State 276
+    { 276, 689, PA_SHIFT, 277 },
+    // State 277
+    { 277, 1249, PA_REDUCE, 184 },
+    // State 277 default action
+    { 277, -1, PA_REDUCE, 184 },
+    // State 278
+    { 278, 191, PA_SHIFT, 280 },
+    // State 278
+    { 278, 441, PA_SHIFT, 281 },
+    // State 278
+    { 278, 939, PA_SHIFT, 279 },
+    // State 279
+    { 279, 1249, PA_REDUCE, 185 },
+    // State 279 default action
+    { 279, -1, PA_REDUCE, 185 },
+    // State 280
+    { 280, 1249, PA_REDUCE, 187 },
+    // State 280 default action
+    { 280, -1, PA_REDUCE, 187 },
+    // State 281
+    { 281, 192, PA_SHIFT, 286 },
+    // State 281
+    { 281, 442, PA_SHIFT, 287 },
+    // State 281
+    { 281, 940, PA_SHIFT, 1696 },
+    // State 281
+    { 281, 1190, PA_SHIFT, 282 },
+    // State 282
+    { 282, 250, PA_SHIFT, 284 },
+    // State 282
+    { 282, 690, PA_SHIFT, 283 },
+    // State 283
+    { 283, 1249, PA_REDUCE, 188 },
+    // State 283 default action
+    { 283, -1, PA_REDUCE, 188 },
+    // State 284
+    { 284, 192, PA_SHIFT, 286 },
+    // State 284
+    { 284, 442, PA_SHIFT, 287 },
+    // State 284
+    { 284, 940, PA_SHIFT, 285 },
+    // State 285
+    { 285, 1249, PA_REDUCE, 189 },
+    // State 285 default action
+    { 285, -1, PA_REDUCE, 189 },
+    // State 286
+    { 286, 1249, PA_REDUCE, 191 },
+    // State 286 default action
+    { 286, -1, PA_REDUCE, 191 },
+    // State 287
+    { 287, 193, PA_SHIFT, 292 },
+    // State 287
+    { 287, 443, PA_SHIFT, 293 },
+    // State 287
+    { 287, 941, PA_SHIFT, 1695 },
+    // State 287
+    { 287, 1191, PA_SHIFT, 288 },
+    // State 288
+    { 288, 250, PA_SHIFT, 290 },
+    // State 288
+    { 288, 691, PA_SHIFT, 289 },
+    // State 289
+    { 289, 1249, PA_REDUCE, 192 },
+    // State 289 default action
+    { 289, -1, PA_REDUCE, 192 },
+    // State 290
+    { 290, 193, PA_SHIFT, 292 },
+    // State 290
+    { 290, 443, PA_SHIFT, 293 },
+    // State 290
+    { 290, 941, PA_SHIFT, 291 },
+    // State 291
+    { 291, 1249, PA_REDUCE, 193 },
+    // State 291 default action
+    { 291, -1, PA_REDUCE, 193 },
+    // State 292
+    { 292, 1249, PA_REDUCE, 195 },
+    // State 292 default action
+    { 292, -1, PA_REDUCE, 195 },
+    // State 293
+    { 293, 194, PA_SHIFT, 298 },
+    // State 293
+    { 293, 444, PA_SHIFT, 299 },
+    // State 293
+    { 293, 942, PA_SHIFT, 1694 },
+    // State 293
+    { 293, 1192, PA_SHIFT, 294 },
+    // State 294
+    { 294, 250, PA_SHIFT, 296 },
+    // State 294
+    { 294, 692, PA_SHIFT, 295 },
+    // State 295
+    { 295, 1249, PA_REDUCE, 196 },
+    // State 295 default action
+    { 295, -1, PA_REDUCE, 196 },
+    // State 296
+    { 296, 194, PA_SHIFT, 298 },
+    // State 296
+    { 296, 444, PA_SHIFT, 299 },
+    // State 296
+    { 296, 942, PA_SHIFT, 297 },
+    // State 297
+    { 297, 1249, PA_REDUCE, 197 },
+    // State 297 default action
+    { 297, -1, PA_REDUCE, 197 },
+    // State 298
+    { 298, 1249, PA_REDUCE, 199 },
+    // State 298 default action
+    { 298, -1, PA_REDUCE, 199 },
+    // State 299
+    { 299, 196, PA_SHIFT, 304 },
+    // State 299
+    { 299, 446, PA_SHIFT, 305 },
+    // State 299
+    { 299, 944, PA_SHIFT, 1693 },
+    // State 299
+    { 299, 1194, PA_SHIFT, 300 },
+    // State 300
+    { 300, 250, PA_SHIFT, 302 },
+    // State 300
+    { 300, 693, PA_SHIFT, 301 },
+    // State 301
+    { 301, 1249, PA_REDUCE, 200 },
+    // State 301 default action
+    { 301, -1, PA_REDUCE, 200 },
+    // State 302
+    { 302, 196, PA_SHIFT, 304 },
+    // State 302
+    { 302, 446, PA_SHIFT, 305 },
+    // State 302
+    { 302, 944, PA_SHIFT, 303 },
+    // State 303
+    { 303, 1249, PA_REDUCE, 201 },
+    // State 303 default action
+    { 303, -1, PA_REDUCE, 201 },
+    // State 304
+    { 304, 1249, PA_REDUCE, 203 },
+    // State 304 default action
+    { 304, -1, PA_REDUCE, 203 },
+    // State 305
+    { 305, 197, PA_SHIFT, 310 },
+    // State 305
+    { 305, 447, PA_SHIFT, 311 },
+    // State 305
+    { 305, 945, PA_SHIFT, 1692 },
+    // State 305
+    { 305, 1195, PA_SHIFT, 306 },
+    // State 306
+    { 306, 250, PA_SHIFT, 308 },
+    // State 306
+    { 306, 695, PA_SHIFT, 307 },
+    // State 307
+    { 307, 1249, PA_REDUCE, 204 },
+    // State 307 default action
+    { 307, -1, PA_REDUCE, 204 },
+    // State 308
+    { 308, 197, PA_SHIFT, 310 },
+    // State 308
+    { 308, 447, PA_SHIFT, 311 },
+    // State 308
+    { 308, 945, PA_SHIFT, 309 },
+    // State 309
+    { 309, 1249, PA_REDUCE, 205 },
+    // State 309 default action
+    { 309, -1, PA_REDUCE, 205 },
+    // State 310
+    { 310, 1249, PA_REDUCE, 207 },
+    // State 310 default action
+    { 310, -1, PA_REDUCE, 207 },
+    // State 311
+    { 311, 198, PA_SHIFT, 316 },
+    // State 311
+    { 311, 448, PA_SHIFT, 317 },
+    // State 311
+    { 311, 946, PA_SHIFT, 1691 },
+    // State 311
+    { 311, 1196, PA_SHIFT, 312 },
+    // State 312
+    { 312, 250, PA_SHIFT, 314 },
+    // State 312
+    { 312, 696, PA_SHIFT, 313 },
+    // State 313
+    { 313, 1249, PA_REDUCE, 208 },
+    // State 313 default action
+    { 313, -1, PA_REDUCE, 208 },
+    // State 314
+    { 314, 198, PA_SHIFT, 316 },
+    // State 314
+    { 314, 448, PA_SHIFT, 317 },
+    // State 314
+    { 314, 946, PA_SHIFT, 315 },
+    // State 315
+    { 315, 1249, PA_REDUCE, 209 },
+    // State 315 default action
+    { 315, -1, PA_REDUCE, 209 },
+    // State 316
+    { 316, 1249, PA_REDUCE, 211 },
+    // State 316 default action
+    { 316, -1, PA_REDUCE, 211 },
+    // State 317
+    { 317, 199, PA_SHIFT, 322 },
+    // State 317
+    { 317, 449, PA_SHIFT, 323 },
+    // State 317
+    { 317, 947, PA_SHIFT, 1690 },
+    // State 317
+    { 317, 1197, PA_SHIFT, 318 },
+    // State 318
+    { 318, 250, PA_SHIFT, 320 },
+    // State 318
+    { 318, 697, PA_SHIFT, 319 },
+    // State 319
+    { 319, 1249, PA_REDUCE, 212 },
+    // State 319 default action
+    { 319, -1, PA_REDUCE, 212 },
+    // State 320
+    { 320, 199, PA_SHIFT, 322 },
+    // State 320
+    { 320, 449, PA_SHIFT, 323 },
+    // State 320
+    { 320, 947, PA_SHIFT, 321 },
+    // State 321
+    { 321, 1249, PA_REDUCE, 213 },
+    // State 321 default action
+    { 321, -1, PA_REDUCE, 213 },
+    // State 322
+    { 322, 1249, PA_REDUCE, 215 },
+    // State 322 default action
+    { 322, -1, PA_REDUCE, 215 },
+    // State 323
+    { 323, 200, PA_SHIFT, 328 },
+    // State 323
+    { 323, 450, PA_SHIFT, 329 },
+    // State 323
+    { 323, 948, PA_SHIFT, 1689 },
+    // State 323
+    { 323, 1198, PA_SHIFT, 324 },
+    // State 324
+    { 324, 250, PA_SHIFT, 326 },
+    // State 324
+    { 324, 698, PA_SHIFT, 325 },
+    // State 325
+    { 325, 1249, PA_REDUCE, 216 },
+    // State 325 default action
+    { 325, -1, PA_REDUCE, 216 },
+    // State 326
+    { 326, 200, PA_SHIFT, 328 },
+    // State 326
+    { 326, 450, PA_SHIFT, 329 },
+    // State 326
+    { 326, 948, PA_SHIFT, 327 },
+    // State 327
+    { 327, 1249, PA_REDUCE, 217 },
+    // State 327 default action
+    { 327, -1, PA_REDUCE, 217 },
+    // State 328
+    { 328, 1249, PA_REDUCE, 219 },
+    // State 328 default action
+    { 328, -1, PA_REDUCE, 219 },
+    // State 329
+    { 329, 201, PA_SHIFT, 334 },
+    // State 329
+    { 329, 451, PA_SHIFT, 335 },
+    // State 329
+    { 329, 949, PA_SHIFT, 1688 },
+    // State 329
+    { 329, 1199, PA_SHIFT, 330 },
+    // State 330
+    { 330, 250, PA_SHIFT, 332 },
+    // State 330
+    { 330, 699, PA_SHIFT, 331 },
+    // State 331
+    { 331, 1249, PA_REDUCE, 220 },
+    // State 331 default action
+    { 331, -1, PA_REDUCE, 220 },
+    // State 332
+    { 332, 201, PA_SHIFT, 334 },
+    // State 332
+    { 332, 451, PA_SHIFT, 335 },
+    // State 332
+    { 332, 949, PA_SHIFT, 333 },
+    // State 333
+    { 333, 1249, PA_REDUCE, 221 },
+    // State 333 default action
+    { 333, -1, PA_REDUCE, 221 },
+    // State 334
+    { 334, 1249, PA_REDUCE, 223 },
+    // State 334 default action
+    { 334, -1, PA_REDUCE, 223 },
+    // State 335
+    { 335, 202, PA_SHIFT, 340 },
+    // State 335
+    { 335, 452, PA_SHIFT, 341 },
+    // State 335
+    { 335, 950, PA_SHIFT, 1687 },
+    // State 335
+    { 335, 1200, PA_SHIFT, 336 },
+    // State 336
+    { 336, 250, PA_SHIFT, 338 },
+    // State 336
+    { 336, 700, PA_SHIFT, 337 },
+    // State 337
+    { 337, 1249, PA_REDUCE, 224 },
+    // State 337 default action
+    { 337, -1, PA_REDUCE, 224 },
+    // State 338
+    { 338, 202, PA_SHIFT, 340 },
+    // State 338
+    { 338, 452, PA_SHIFT, 341 },
+    // State 338
+    { 338, 950, PA_SHIFT, 339 },
+    // State 339
+    { 339, 1249, PA_REDUCE, 225 },
+    // State 339 default action
+    { 339, -1, PA_REDUCE, 225 },
+    // State 340
+    { 340, 1249, PA_REDUCE, 227 },
+    // State 340 default action
+    { 340, -1, PA_REDUCE, 227 },
+    // State 341
+    { 341, 203, PA_SHIFT, 346 },
+    // State 341
+    { 341, 453, PA_SHIFT, 347 },
+    // State 341
+    { 341, 951, PA_SHIFT, 1686 },
+    // State 341
+    { 341, 1201, PA_SHIFT, 342 },
+    // State 342
+    { 342, 250, PA_SHIFT, 344 },
+    // State 342
+    { 342, 701, PA_SHIFT, 343 },
+    // State 343
+    { 343, 1249, PA_REDUCE, 228 },
+    // State 343 default action
+    { 343, -1, PA_REDUCE, 228 },
+    // State 344
+    { 344, 203, PA_SHIFT, 346 },
+    // State 344
+    { 344, 453, PA_SHIFT, 347 },
+    // State 344
+    { 344, 951, PA_SHIFT, 345 },
+    // State 345
+    { 345, 1249, PA_REDUCE, 229 },
+    // State 345 default action
+    { 345, -1, PA_REDUCE, 229 },
+    // State 346
+    { 346, 1249, PA_REDUCE, 231 },
+    // State 346 default action
+    { 346, -1, PA_REDUCE, 231 },
+    // State 347
+    { 347, 204, PA_SHIFT, 352 },
+    // State 347
+    { 347, 454, PA_SHIFT, 353 },
+    // State 347
+    { 347, 952, PA_SHIFT, 1685 },
+    // State 347
+    { 347, 1202, PA_SHIFT, 348 },
+    // State 348
+    { 348, 250, PA_SHIFT, 350 },
+    // State 348
+    { 348, 702, PA_SHIFT, 349 },
+    // State 349
+    { 349, 1249, PA_REDUCE, 232 },
+    // State 349 default action
+    { 349, -1, PA_REDUCE, 232 },
+    // State 350
+    { 350, 204, PA_SHIFT, 352 },
+    // State 350
+    { 350, 454, PA_SHIFT, 353 },
+    // State 350
+    { 350, 952, PA_SHIFT, 351 },
+    // State 351
+    { 351, 1249, PA_REDUCE, 233 },
+    // State 351 default action
+    { 351, -1, PA_REDUCE, 233 },
+    // State 352
+    { 352, 1249, PA_REDUCE, 235 },
+    // State 352 default action
+    { 352, -1, PA_REDUCE, 235 },
+    // State 353
+    { 353, 205, PA_SHIFT, 358 },
+    // State 353
+    { 353, 455, PA_SHIFT, 359 },
+    // State 353
+    { 353, 953, PA_SHIFT, 1684 },
+    // State 353
+    { 353, 1203, PA_SHIFT, 354 },
+    // State 354
+    { 354, 250, PA_SHIFT, 356 },
+    // State 354
+    { 354, 703, PA_SHIFT, 355 },
+    // State 355
+    { 355, 1249, PA_REDUCE, 236 },
+    // State 355 default action
+    { 355, -1, PA_REDUCE, 236 },
+    // State 356
+    { 356, 205, PA_SHIFT, 358 },
+    // State 356
+    { 356, 455, PA_SHIFT, 359 },
+    // State 356
+    { 356, 953, PA_SHIFT, 357 },
+    // State 357
+    { 357, 1249, PA_REDUCE, 237 },
+    // State 357 default action
+    { 357, -1, PA_REDUCE, 237 },
+    // State 358
+    { 358, 1249, PA_REDUCE, 239 },
+    // State 358 default action
+    { 358, -1, PA_REDUCE, 239 },
+    // State 359
+    { 359, 207, PA_SHIFT, 364 },
+    // State 359
+    { 359, 457, PA_SHIFT, 365 },
+    // State 359
+    { 359, 955, PA_SHIFT, 1683 },
+    // State 359
+    { 359, 1205, PA_SHIFT, 360 },
+    // State 360
+    { 360, 250, PA_SHIFT, 362 },
+    // State 360
+    { 360, 704, PA_SHIFT, 361 },
+    // State 361
+    { 361, 1249, PA_REDUCE, 240 },
+    // State 361 default action
+    { 361, -1, PA_REDUCE, 240 },
+    // State 362
+    { 362, 207, PA_SHIFT, 364 },
+    // State 362
+    { 362, 457, PA_SHIFT, 365 },
+    // State 362
+    { 362, 955, PA_SHIFT, 363 },
+    // State 363
+    { 363, 1249, PA_REDUCE, 241 },
+    // State 363 default action
+    { 363, -1, PA_REDUCE, 241 },
+    // State 364
+    { 364, 1249, PA_REDUCE, 243 },
+    // State 364 default action
+    { 364, -1, PA_REDUCE, 243 },
+    // State 365
+    { 365, 208, PA_SHIFT, 370 },
+    // State 365
+    { 365, 458, PA_SHIFT, 371 },
+    // State 365
+    { 365, 956, PA_SHIFT, 1682 },
+    // State 365
+    { 365, 1206, PA_SHIFT, 366 },
+    // State 366
+    { 366, 250, PA_SHIFT, 368 },
+    // State 366
+    { 366, 706, PA_SHIFT, 367 },
+    // State 367
+    { 367, 1249, PA_REDUCE, 244 },
+    // State 367 default action
+    { 367, -1, PA_REDUCE, 244 },
+    // State 368
+    { 368, 208, PA_SHIFT, 370 },
+    // State 368
+    { 368, 458, PA_SHIFT, 371 },
+    // State 368
+    { 368, 956, PA_SHIFT, 369 },
+    // State 369
+    { 369, 1249, PA_REDUCE, 245 },
+    // State 369 default action
+    { 369, -1, PA_REDUCE, 245 },
+    // State 370
+    { 370, 1249, PA_REDUCE, 247 },
+    // State 370 default action
+    { 370, -1, PA_REDUCE, 247 },
+    // State 371
+    { 371, 209, PA_SHIFT, 376 },
+    // State 371
+    { 371, 459, PA_SHIFT, 377 },
+    // State 371
+    { 371, 957, PA_SHIFT, 1681 },
+    // State 371
+    { 371, 1207, PA_SHIFT, 372 },
+    // State 372
+    { 372, 250, PA_SHIFT, 374 },
+    // State 372
+    { 372, 707, PA_SHIFT, 373 },
+    // State 373
+    { 373, 1249, PA_REDUCE, 248 },
+    // State 373 default action
+    { 373, -1, PA_REDUCE, 248 },
+    // State 374
+    { 374, 209, PA_SHIFT, 376 },
+    // State 374
+    { 374, 459, PA_SHIFT, 377 },
+    // State 374
+    { 374, 957, PA_SHIFT, 375 },
+    // State 375
+    { 375, 1249, PA_REDUCE, 249 },
+    // State 375 default action
+    { 375, -1, PA_REDUCE, 249 },
+    // State 376
+    { 376, 1249, PA_REDUCE, 251 },
+    // State 376 default action
+    { 376, -1, PA_REDUCE, 251 },
+    // State 377
+    { 377, 210, PA_SHIFT, 382 },
+    // State 377
+    { 377, 460, PA_SHIFT, 383 },
+    // State 377
+    { 377, 958, PA_SHIFT, 1680 },
+    // State 377
+    { 377, 1208, PA_SHIFT, 378 },
+    // State 378
+    { 378, 250, PA_SHIFT, 380 },
+    // State 378
+    { 378, 708, PA_SHIFT, 379 },
+    // State 379
+    { 379, 1249, PA_REDUCE, 252 },
+    // State 379 default action
+    { 379, -1, PA_REDUCE, 252 },
+    // State 380
+    { 380, 210, PA_SHIFT, 382 },
+    // State 380
+    { 380, 460, PA_SHIFT, 383 },
+    // State 380
+    { 380, 958, PA_SHIFT, 381 },
+    // State 381
+    { 381, 1249, PA_REDUCE, 253 },
+    // State 381 default action
+    { 381, -1, PA_REDUCE, 253 },
+    // State 382
+    { 382, 1249, PA_REDUCE, 255 },
+    // State 382 default action
+    { 382, -1, PA_REDUCE, 255 },
+    // State 383
+    { 383, 211, PA_SHIFT, 388 },
+    // State 383
+    { 383, 461, PA_SHIFT, 389 },
+    // State 383
+    { 383, 959, PA_SHIFT, 1679 },
+    // State 383
+    { 383, 1209, PA_SHIFT, 384 },
+    // State 384
+    { 384, 250, PA_SHIFT, 386 },
+    // State 384
+    { 384, 709, PA_SHIFT, 385 },
+    // State 385
+    { 385, 1249, PA_REDUCE, 256 },
+    // State 385 default action
+    { 385, -1, PA_REDUCE, 256 },
+    // State 386
+    { 386, 211, PA_SHIFT, 388 },
+    // State 386
+    { 386, 461, PA_SHIFT, 389 },
+    // State 386
+    { 386, 959, PA_SHIFT, 387 },
+    // State 387
+    { 387, 1249, PA_REDUCE, 257 },
+    // State 387 default action
+    { 387, -1, PA_REDUCE, 257 },
+    // State 388
+    { 388, 1249, PA_REDUCE, 259 },
+    // State 388 default action
+    { 388, -1, PA_REDUCE, 259 },
+    // State 389
+    { 389, 212, PA_SHIFT, 394 },
+    // State 389
+    { 389, 462, PA_SHIFT, 395 },
+    // State 389
+    { 389, 960, PA_SHIFT, 1678 },
+    // State 389
+    { 389, 1210, PA_SHIFT, 390 },
+    // State 390
+    { 390, 250, PA_SHIFT, 392 },
+    // State 390
+    { 390, 710, PA_SHIFT, 391 },
+    // State 391
+    { 391, 1249, PA_REDUCE, 260 },
+    // State 391 default action
+    { 391, -1, PA_REDUCE, 260 },
+    // State 392
+    { 392, 212, PA_SHIFT, 394 },
+    // State 392
+    { 392, 462, PA_SHIFT, 395 },
+    // State 392
+    { 392, 960, PA_SHIFT, 393 },
+    // State 393
+    { 393, 1249, PA_REDUCE, 261 },
+    // State 393 default action
+    { 393, -1, PA_REDUCE, 261 },
+    // State 394
+    { 394, 1249, PA_REDUCE, 263 },
+    // State 394 default action
+    { 394, -1, PA_REDUCE, 263 },
+    // State 395
+    { 395, 213, PA_SHIFT, 400 },
+    // State 395
+    { 395, 463, PA_SHIFT, 401 },
+    // State 395
+    { 395, 961, PA_SHIFT, 1677 },
+    // State 395
+    { 395, 1211, PA_SHIFT, 396 },
+    // State 396
+    { 396, 250, PA_SHIFT, 398 },
+    // State 396
+    { 396, 711, PA_SHIFT, 397 },
+    // State 397
+    { 397, 1249, PA_REDUCE, 264 },
+    // State 397 default action
+    { 397, -1, PA_REDUCE, 264 },
+    // State 398
+    { 398, 213, PA_SHIFT, 400 },
+    // State 398
+    { 398, 463, PA_SHIFT, 401 },
+    // State 398
+    { 398, 961, PA_SHIFT, 399 },
+    // State 399
+    { 399, 1249, PA_REDUCE, 265 },
+    // State 399 default action
+    { 399, -1, PA_REDUCE, 265 },
+    // State 400
+    { 400, 1249, PA_REDUCE, 267 },
+    // State 400 default action
+    { 400, -1, PA_REDUCE, 267 },
+    // State 401
+    { 401, 214, PA_SHIFT, 406 },
+    // State 401
+    { 401, 464, PA_SHIFT, 407 },
+    // State 401
+    { 401, 962, PA_SHIFT, 1676 },
+    // State 401
+    { 401, 1212, PA_SHIFT, 402 },
+    // State 402
+    { 402, 250, PA_SHIFT, 404 },
+    // State 402
+    { 402, 712, PA_SHIFT, 403 },
+    // State 403
+    { 403, 1249, PA_REDUCE, 268 },
+    // State 403 default action
+    { 403, -1, PA_REDUCE, 268 },
+    // State 404
+    { 404, 214, PA_SHIFT, 406 },
+    // State 404
+    { 404, 464, PA_SHIFT, 407 },
+    // State 404
+    { 404, 962, PA_SHIFT, 405 },
+    // State 405
+    { 405, 1249, PA_REDUCE, 269 },
+    // State 405 default action
+    { 405, -1, PA_REDUCE, 269 },
+    // State 406
+    { 406, 1249, PA_REDUCE, 271 },
+    // State 406 default action
+    { 406, -1, PA_REDUCE, 271 },
+    // State 407
+    { 407, 215, PA_SHIFT, 412 },
+    // State 407
+    { 407, 465, PA_SHIFT, 413 },
+    // State 407
+    { 407, 963, PA_SHIFT, 1675 },
+    // State 407
+    { 407, 1213, PA_SHIFT, 408 },
+    // State 408
+    { 408, 250, PA_SHIFT, 410 },
+    // State 408
+    { 408, 713, PA_SHIFT, 409 },
+    // State 409
+    { 409, 1249, PA_REDUCE, 272 },
+    // State 409 default action
+    { 409, -1, PA_REDUCE, 272 },
+    // State 410
+    { 410, 215, PA_SHIFT, 412 },
+    // State 410
+    { 410, 465, PA_SHIFT, 413 },
+    // State 410
+    { 410, 963, PA_SHIFT, 411 },
+    // State 411
+    { 411, 1249, PA_REDUCE, 273 },
+    // State 411 default action
+    { 411, -1, PA_REDUCE, 273 },
+    // State 412
+    { 412, 1249, PA_REDUCE, 275 },
+    // State 412 default action
+    { 412, -1, PA_REDUCE, 275 },
+    // State 413
+    { 413, 216, PA_SHIFT, 418 },
+    // State 413
+    { 413, 466, PA_SHIFT, 419 },
+    // State 413
+    { 413, 964, PA_SHIFT, 1674 },
+    // State 413
+    { 413, 1214, PA_SHIFT, 414 },
+    // State 414
+    { 414, 250, PA_SHIFT, 416 },
+    // State 414
+    { 414, 714, PA_SHIFT, 415 },
+    // State 415
+    { 415, 1249, PA_REDUCE, 276 },
+    // State 415 default action
+    { 415, -1, PA_REDUCE, 276 },
+    // State 416
+    { 416, 216, PA_SHIFT, 418 },
+    // State 416
+    { 416, 466, PA_SHIFT, 419 },
+    // State 416
+    { 416, 964, PA_SHIFT, 417 },
+    // State 417
+    { 417, 1249, PA_REDUCE, 277 },
+    // State 417 default action
+    { 417, -1, PA_REDUCE, 277 },
+    // State 418
+    { 418, 1249, PA_REDUCE, 279 },
+    // State 418 default action
+    { 418, -1, PA_REDUCE, 279 },
+    // State 419
+    { 419, 218, PA_SHIFT, 424 },
+    // State 419
+    { 419, 468, PA_SHIFT, 425 },
+    // State 419
+    { 419, 966, PA_SHIFT, 1673 },
+    // State 419
+    { 419, 1216, PA_SHIFT, 420 },
+    // State 420
+    { 420, 250, PA_SHIFT, 422 },
+    // State 420
+    { 420, 715, PA_SHIFT, 421 },
+    // State 421
+    { 421, 1249, PA_REDUCE, 280 },
+    // State 421 default action
+    { 421, -1, PA_REDUCE, 280 },
+    // State 422
+    { 422, 218, PA_SHIFT, 424 },
+    // State 422
+    { 422, 468, PA_SHIFT, 425 },
+    // State 422
+    { 422, 966, PA_SHIFT, 423 },
+    // State 423
+    { 423, 1249, PA_REDUCE, 281 },
+    // State 423 default action
+    { 423, -1, PA_REDUCE, 281 },
+    // State 424
+    { 424, 1249, PA_REDUCE, 283 },
+    // State 424 default action
+    { 424, -1, PA_REDUCE, 283 },
+    // State 425
+    { 425, 219, PA_SHIFT, 430 },
+    // State 425
+    { 425, 469, PA_SHIFT, 431 },
+    // State 425
+    { 425, 967, PA_SHIFT, 1672 },
+    // State 425
+    { 425, 1217, PA_SHIFT, 426 },
+    // State 426
+    { 426, 250, PA_SHIFT, 428 },
+    // State 426
+    { 426, 717, PA_SHIFT, 427 },
+    // State 427
+    { 427, 1249, PA_REDUCE, 284 },
+    // State 427 default action
+    { 427, -1, PA_REDUCE, 284 },
+    // State 428
+    { 428, 219, PA_SHIFT, 430 },
+    // State 428
+    { 428, 469, PA_SHIFT, 431 },
+    // State 428
+    { 428, 967, PA_SHIFT, 429 },
+    // State 429
+    { 429, 1249, PA_REDUCE, 285 },
+    // State 429 default action
+    { 429, -1, PA_REDUCE, 285 },
+    // State 430
+    { 430, 1249, PA_REDUCE, 287 },
+    // State 430 default action
+    { 430, -1, PA_REDUCE, 287 },
+    // State 431
+    { 431, 220, PA_SHIFT, 436 },
+    // State 431
+    { 431, 470, PA_SHIFT, 437 },
+    // State 431
+    { 431, 968, PA_SHIFT, 1671 },
+    // State 431
+    { 431, 1218, PA_SHIFT, 432 },
+    // State 432
+    { 432, 250, PA_SHIFT, 434 },
+    // State 432
+    { 432, 718, PA_SHIFT, 433 },
+    // State 433
+    { 433, 1249, PA_REDUCE, 288 },
+    // State 433 default action
+    { 433, -1, PA_REDUCE, 288 },
+    // State 434
+    { 434, 220, PA_SHIFT, 436 },
+    // State 434
+    { 434, 470, PA_SHIFT, 437 },
+    // State 434
+    { 434, 968, PA_SHIFT, 435 },
+    // State 435
+    { 435, 1249, PA_REDUCE, 289 },
+    // State 435 default action
+    { 435, -1, PA_REDUCE, 289 },
+    // State 436
+    { 436, 1249, PA_REDUCE, 291 },
+    // State 436 default action
+    { 436, -1, PA_REDUCE, 291 },
+    // State 437
+    { 437, 221, PA_SHIFT, 442 },
+    // State 437
+    { 437, 471, PA_SHIFT, 443 },
+    // State 437
+    { 437, 969, PA_SHIFT, 1670 },
+    // State 437
+    { 437, 1219, PA_SHIFT, 438 },
+    // State 438
+    { 438, 250, PA_SHIFT, 440 },
+    // State 438
+    { 438, 719, PA_SHIFT, 439 },
+    // State 439
+    { 439, 1249, PA_REDUCE, 292 },
+    // State 439 default action
+    { 439, -1, PA_REDUCE, 292 },
+    // State 440
+    { 440, 221, PA_SHIFT, 442 },
+    // State 440
+    { 440, 471, PA_SHIFT, 443 },
+    // State 440
+    { 440, 969, PA_SHIFT, 441 },
+    // State 441
+    { 441, 1249, PA_REDUCE, 293 },
+    // State 441 default action
+    { 441, -1, PA_REDUCE, 293 },
+    // State 442
+    { 442, 1249, PA_REDUCE, 295 },
+    // State 442 default action
+    { 442, -1, PA_REDUCE, 295 },
+    // State 443
+    { 443, 222, PA_SHIFT, 448 },
+    // State 443
+    { 443, 472, PA_SHIFT, 449 },
+    // State 443
+    { 443, 970, PA_SHIFT, 1669 },
+    // State 443
+    { 443, 1220, PA_SHIFT, 444 },
+    // State 444
+    { 444, 250, PA_SHIFT, 446 },
+    // State 444
+    { 444, 720, PA_SHIFT, 445 },
+    // State 445
+    { 445, 1249, PA_REDUCE, 296 },
+    // State 445 default action
+    { 445, -1, PA_REDUCE, 296 },
+    // State 446
+    { 446, 222, PA_SHIFT, 448 },
+    // State 446
+    { 446, 472, PA_SHIFT, 449 },
+    // State 446
+    { 446, 970, PA_SHIFT, 447 },
+    // State 447
+    { 447, 1249, PA_REDUCE, 297 },
+    // State 447 default action
+    { 447, -1, PA_REDUCE, 297 },
+    // State 448
+    { 448, 1249, PA_REDUCE, 299 },
+    // State 448 default action
+    { 448, -1, PA_REDUCE, 299 },
+    // State 449
+    { 449, 223, PA_SHIFT, 454 },
+    // State 449
+    { 449, 473, PA_SHIFT, 455 },
+    // State 449
+    { 449, 971, PA_SHIFT, 1668 },
+    // State 449
+    { 449, 1221, PA_SHIFT, 450 },
+    // State 450
+    { 450, 250, PA_SHIFT, 452 },
+    // State 450
+    { 450, 721, PA_SHIFT, 451 },
+    // State 451
+    { 451, 1249, PA_REDUCE, 300 },
+    // State 451 default action
+    { 451, -1, PA_REDUCE, 300 },
+    // State 452
+    { 452, 223, PA_SHIFT, 454 },
+    // State 452
+    { 452, 473, PA_SHIFT, 455 },
+    // State 452
+    { 452, 971, PA_SHIFT, 453 },
+    // State 453
+    { 453, 1249, PA_REDUCE, 301 },
+    // State 453 default action
+    { 453, -1, PA_REDUCE, 301 },
+    // State 454
+    { 454, 1249, PA_REDUCE, 303 },
+    // State 454 default action
+    { 454, -1, PA_REDUCE, 303 },
+    // State 455
+    { 455, 224, PA_SHIFT, 460 },
+    // State 455
+    { 455, 474, PA_SHIFT, 461 },
+    // State 455
+    { 455, 972, PA_SHIFT, 1667 },
+    // State 455
+    { 455, 1222, PA_SHIFT, 456 },
+    // State 456
+    { 456, 250, PA_SHIFT, 458 },
+    // State 456
+    { 456, 722, PA_SHIFT, 457 },
+    // State 457
+    { 457, 1249, PA_REDUCE, 304 },
+    // State 457 default action
+    { 457, -1, PA_REDUCE, 304 },
+    // State 458
+    { 458, 224, PA_SHIFT, 460 },
+    // State 458
+    { 458, 474, PA_SHIFT, 461 },
+    // State 458
+    { 458, 972, PA_SHIFT, 459 },
+    // State 459
+    { 459, 1249, PA_REDUCE, 305 },
+    // State 459 default action
+    { 459, -1, PA_REDUCE, 305 },
+    // State 460
+    { 460, 1249, PA_REDUCE, 307 },
+    // State 460 default action
+    { 460, -1, PA_REDUCE, 307 },
+    // State 461
+    { 461, 225, PA_SHIFT, 466 },
+    // State 461
+    { 461, 475, PA_SHIFT, 467 },
+    // State 461
+    { 461, 973, PA_SHIFT, 1666 },
+    // State 461
+    { 461, 1223, PA_SHIFT, 462 },
+    // State 462
+    { 462, 250, PA_SHIFT, 464 },
+    // State 462
+    { 462, 723, PA_SHIFT, 463 },
+    // State 463
+    { 463, 1249, PA_REDUCE, 308 },
+    // State 463 default action
+    { 463, -1, PA_REDUCE, 308 },
+    // State 464
+    { 464, 225, PA_SHIFT, 466 },
+    // State 464
+    { 464, 475, PA_SHIFT, 467 },
+    // State 464
+    { 464, 973, PA_SHIFT, 465 },
+    // State 465
+    { 465, 1249, PA_REDUCE, 309 },
+    // State 465 default action
+    { 465, -1, PA_REDUCE, 309 },
+    // State 466
+    { 466, 1249, PA_REDUCE, 311 },
+    // State 466 default action
+    { 466, -1, PA_REDUCE, 311 },
+    // State 467
+    { 467, 226, PA_SHIFT, 472 },
+    // State 467
+    { 467, 476, PA_SHIFT, 473 },
+    // State 467
+    { 467, 974, PA_SHIFT, 1665 },
+    // State 467
+    { 467, 1224, PA_SHIFT, 468 },
+    // State 468
+    { 468, 250, PA_SHIFT, 470 },
+    // State 468
+    { 468, 724, PA_SHIFT, 469 },
+    // State 469
+    { 469, 1249, PA_REDUCE, 312 },
+    // State 469 default action
+    { 469, -1, PA_REDUCE, 312 },
+    // State 470
+    { 470, 226, PA_SHIFT, 472 },
+    // State 470
+    { 470, 476, PA_SHIFT, 473 },
+    // State 470
+    { 470, 974, PA_SHIFT, 471 },
+    // State 471
+    { 471, 1249, PA_REDUCE, 313 },
+    // State 471 default action
+    { 471, -1, PA_REDUCE, 313 },
+    // State 472
+    { 472, 1249, PA_REDUCE, 315 },
+    // State 472 default action
+    { 472, -1, PA_REDUCE, 315 },
+    // State 473
+    { 473, 227, PA_SHIFT, 478 },
+    // State 473
+    { 473, 477, PA_SHIFT, 479 },
+    // State 473
+    { 473, 975, PA_SHIFT, 1664 },
+    // State 473
+    { 473, 1225, PA_SHIFT, 474 },
+    // State 474
+    { 474, 250, PA_SHIFT, 476 },
+    // State 474
+    { 474, 725, PA_SHIFT, 475 },
+    // State 475
+    { 475, 1249, PA_REDUCE, 316 },
+    // State 475 default action
+    { 475, -1, PA_REDUCE, 316 },
+    // State 476
+    { 476, 227, PA_SHIFT, 478 },
+    // State 476
+    { 476, 477, PA_SHIFT, 479 },
+    // State 476
+    { 476, 975, PA_SHIFT, 477 },
+    // State 477
+    { 477, 1249, PA_REDUCE, 317 },
+    // State 477 default action
+    { 477, -1, PA_REDUCE, 317 },
+    // State 478
+    { 478, 1249, PA_REDUCE, 319 },
+    // State 478 default action
+    { 478, -1, PA_REDUCE, 319 },
+    // State 479
+    { 479, 229, PA_SHIFT, 484 },
+    // State 479
+    { 479, 479, PA_SHIFT, 485 },
+    // State 479
+    { 479, 977, PA_SHIFT, 1663 },
+    // State 479
+    { 479, 1227, PA_SHIFT, 480 },
+    // State 480
+    { 480, 250, PA_SHIFT, 482 },
+    // State 480
+    { 480, 726, PA_SHIFT, 481 },
+    // State 481
+    { 481, 1249, PA_REDUCE, 320 },
+    // State 481 default action
+    { 481, -1, PA_REDUCE, 320 },
+    // State 482
+    { 482, 229, PA_SHIFT, 484 },
+    // State 482
+    { 482, 479, PA_SHIFT, 485 },
+    // State 482
+    { 482, 977, PA_SHIFT, 483 },
+    // State 483
+    { 483, 1249, PA_REDUCE, 321 },
+    // State 483 default action
+    { 483, -1, PA_REDUCE, 321 },
+    // State 484
+    { 484, 1249, PA_REDUCE, 323 },
+    // State 484 default action
+    { 484, -1, PA_REDUCE, 323 },
+    // State 485
+    { 485, 230, PA_SHIFT, 490 },
+    // State 485
+    { 485, 480, PA_SHIFT, 491 },
+    // State 485
+    { 485, 978, PA_SHIFT, 1662 },
+    // State 485
+    { 485, 1228, PA_SHIFT, 486 },
+    // State 486
+    { 486, 250, PA_SHIFT, 488 },
+    // State 486
+    { 486, 728, PA_SHIFT, 487 },
+    // State 487
+    { 487, 1249, PA_REDUCE, 324 },
+    // State 487 default action
+    { 487, -1, PA_REDUCE, 324 },
+    // State 488
+    { 488, 230, PA_SHIFT, 490 },
+    // State 488
+    { 488, 480, PA_SHIFT, 491 },
+    // State 488
+    { 488, 978, PA_SHIFT, 489 },
+    // State 489
+    { 489, 1249, PA_REDUCE, 325 },
+    // State 489 default action
+    { 489, -1, PA_REDUCE, 325 },
+    // State 490
+    { 490, 1249, PA_REDUCE, 327 },
+    // State 490 default action
+    { 490, -1, PA_REDUCE, 327 },
+    // State 491
+    { 491, 231, PA_SHIFT, 496 },
+    // State 491
+    { 491, 481, PA_SHIFT, 497 },
+    // State 491
+    { 491, 979, PA_SHIFT, 1661 },
+    // State 491
+    { 491, 1229, PA_SHIFT, 492 },
+    // State 492
+    { 492, 250, PA_SHIFT, 494 },
+    // State 492
+    { 492, 729, PA_SHIFT, 493 },
+    // State 493
+    { 493, 1249, PA_REDUCE, 328 },
+    // State 493 default action
+    { 493, -1, PA_REDUCE, 328 },
+    // State 494
+    { 494, 231, PA_SHIFT, 496 },
+    // State 494
+    { 494, 481, PA_SHIFT, 497 },
+    // State 494
+    { 494, 979, PA_SHIFT, 495 },
+    // State 495
+    { 495, 1249, PA_REDUCE, 329 },
+    // State 495 default action
+    { 495, -1, PA_REDUCE, 329 },
+    // State 496
+    { 496, 1249, PA_REDUCE, 331 },
+    // State 496 default action
+    { 496, -1, PA_REDUCE, 331 },
+    // State 497
+    { 497, 232, PA_SHIFT, 502 },
+    // State 497
+    { 497, 482, PA_SHIFT, 503 },
+    // State 497
+    { 497, 980, PA_SHIFT, 1660 },
+    // State 497
+    { 497, 1230, PA_SHIFT, 498 },
+    // State 498
+    { 498, 250, PA_SHIFT, 500 },
+    // State 498
+    { 498, 730, PA_SHIFT, 499 },
+    // State 499
+    { 499, 1249, PA_REDUCE, 332 },
+    // State 499 default action
+    { 499, -1, PA_REDUCE, 332 },
+    // State 500
+    { 500, 232, PA_SHIFT, 502 },
+    // State 500
+    { 500, 482, PA_SHIFT, 503 },
+    // State 500
+    { 500, 980, PA_SHIFT, 501 },
+    // State 501
+    { 501, 1249, PA_REDUCE, 333 },
+    // State 501 default action
+    { 501, -1, PA_REDUCE, 333 },
+    // State 502
+    { 502, 1249, PA_REDUCE, 335 },
+    // State 502 default action
+    { 502, -1, PA_REDUCE, 335 },
+    // State 503
+    { 503, 233, PA_SHIFT, 508 },
+    // State 503
+    { 503, 483, PA_SHIFT, 509 },
+    // State 503
+    { 503, 981, PA_SHIFT, 1659 },
+    // State 503
+    { 503, 1231, PA_SHIFT, 504 },
+    // State 504
+    { 504, 250, PA_SHIFT, 506 },
+    // State 504
+    { 504, 731, PA_SHIFT, 505 },
+    // State 505
+    { 505, 1249, PA_REDUCE, 336 },
+    // State 505 default action
+    { 505, -1, PA_REDUCE, 336 },
+    // State 506
+    { 506, 233, PA_SHIFT, 508 },
+    // State 506
+    { 506, 483, PA_SHIFT, 509 },
+    // State 506
+    { 506, 981, PA_SHIFT, 507 },
+    // State 507
+    { 507, 1249, PA_REDUCE, 337 },
+    // State 507 default action
+    { 507, -1, PA_REDUCE, 337 },
+    // State 508
+    { 508, 1249, PA_REDUCE, 339 },
+    // State 508 default action
+    { 508, -1, PA_REDUCE, 339 },
+    // State 509
+    { 509, 234, PA_SHIFT, 514 },
+    // State 509
+    { 509, 484, PA_SHIFT, 515 },
+    // State 509
+    { 509, 982, PA_SHIFT, 1658 },
+    // State 509
+    { 509, 1232, PA_SHIFT, 510 },
+    // State 510
+    { 510, 250, PA_SHIFT, 512 },
+    // State 510
+    { 510, 732, PA_SHIFT, 511 },
+    // State 511
+    { 511, 1249, PA_REDUCE, 340 },
+    // State 511 default action
+    { 511, -1, PA_REDUCE, 340 },
+    // State 512
+    { 512, 234, PA_SHIFT, 514 },
+    // State 512
+    { 512, 484, PA_SHIFT, 515 },
+    // State 512
+    { 512, 982, PA_SHIFT, 513 },
+    // State 513
+    { 513, 1249, PA_REDUCE, 341 },
+    // State 513 default action
+    { 513, -1, PA_REDUCE, 341 },
+    // State 514
+    { 514, 1249, PA_REDUCE, 343 },
+    // State 514 default action
+    { 514, -1, PA_REDUCE, 343 },
+    // State 515
+    { 515, 235, PA_SHIFT, 520 },
+    // State 515
+    { 515, 485, PA_SHIFT, 521 },
+    // State 515
+    { 515, 983, PA_SHIFT, 1657 },
+    // State 515
+    { 515, 1233, PA_SHIFT, 516 },
+    // State 516
+    { 516, 250, PA_SHIFT, 518 },
+    // State 516
+    { 516, 733, PA_SHIFT, 517 },
+    // State 517
+    { 517, 1249, PA_REDUCE, 344 },
+    // State 517 default action
+    { 517, -1, PA_REDUCE, 344 },
+    // State 518
+    { 518, 235, PA_SHIFT, 520 },
+    // State 518
+    { 518, 485, PA_SHIFT, 521 },
+    // State 518
+    { 518, 983, PA_SHIFT, 519 },
+    // State 519
+    { 519, 1249, PA_REDUCE, 345 },
+    // State 519 default action
+    { 519, -1, PA_REDUCE, 345 },
+    // State 520
+    { 520, 1249, PA_REDUCE, 347 },
+    // State 520 default action
+    { 520, -1, PA_REDUCE, 347 },
+    // State 521
+    { 521, 236, PA_SHIFT, 526 },
+    // State 521
+    { 521, 486, PA_SHIFT, 527 },
+    // State 521
+    { 521, 984, PA_SHIFT, 1656 },
+    // State 521
+    { 521, 1234, PA_SHIFT, 522 },
+    // State 522
+    { 522, 250, PA_SHIFT, 524 },
+    // State 522
+    { 522, 734, PA_SHIFT, 523 },
+    // State 523
+    { 523, 1249, PA_REDUCE, 348 },
+    // State 523 default action
+    { 523, -1, PA_REDUCE, 348 },
+    // State 524
+    { 524, 236, PA_SHIFT, 526 },
+    // State 524
+    { 524, 486, PA_SHIFT, 527 },
+    // State 524
+    { 524, 984, PA_SHIFT, 525 },
+    // State 525
+    { 525, 1249, PA_REDUCE, 349 },
+    // State 525 default action
+    { 525, -1, PA_REDUCE, 349 },
+    // State 526
+    { 526, 1249, PA_REDUCE, 351 },
+    // State 526 default action
+    { 526, -1, PA_REDUCE, 351 },
+    // State 527
+    { 527, 237, PA_SHIFT, 532 },
+    // State 527
+    { 527, 487, PA_SHIFT, 533 },
+    // State 527
+    { 527, 985, PA_SHIFT, 1655 },
+    // State 527
+    { 527, 1235, PA_SHIFT, 528 },
+    // State 528
+    { 528, 250, PA_SHIFT, 530 },
+    // State 528
+    { 528, 735, PA_SHIFT, 529 },
+    // State 529
+    { 529, 1249, PA_REDUCE, 352 },
+    // State 529 default action
+    { 529, -1, PA_REDUCE, 352 },
+    // State 530
+    { 530, 237, PA_SHIFT, 532 },
+    // State 530
+    { 530, 487, PA_SHIFT, 533 },
+    // State 530
+    { 530, 985, PA_SHIFT, 531 },
+    // State 531
+    { 531, 1249, PA_REDUCE, 353 },
+    // State 531 default action
+    { 531, -1, PA_REDUCE, 353 },
+    // State 532
+    { 532, 1249, PA_REDUCE, 355 },
+    // State 532 default action
+    { 532, -1, PA_REDUCE, 355 },
+    // State 533
+    { 533, 238, PA_SHIFT, 538 },
+    // State 533
+    { 533, 488, PA_SHIFT, 539 },
+    // State 533
+    { 533, 986, PA_SHIFT, 1654 },
+    // State 533
+    { 533, 1236, PA_SHIFT, 534 },
+    // State 534
+    { 534, 250, PA_SHIFT, 536 },
+    // State 534
+    { 534, 736, PA_SHIFT, 535 },
+    // State 535
+    { 535, 1249, PA_REDUCE, 356 },
+    // State 535 default action
+    { 535, -1, PA_REDUCE, 356 },
+    // State 536
+    { 536, 238, PA_SHIFT, 538 },
+    // State 536
+    { 536, 488, PA_SHIFT, 539 },
+    // State 536
+    { 536, 986, PA_SHIFT, 537 },
+    // State 537
+    { 537, 1249, PA_REDUCE, 357 },
+    // State 537 default action
+    { 537, -1, PA_REDUCE, 357 },
+    // State 538
+    { 538, 1249, PA_REDUCE, 359 },
+    // State 538 default action
+    { 538, -1, PA_REDUCE, 359 },
+    // State 539
+    { 539, 240, PA_SHIFT, 544 },
+    // State 539
+    { 539, 490, PA_SHIFT, 545 },
+    // State 539
+    { 539, 988, PA_SHIFT, 1653 },
+    // State 539
+    { 539, 1238, PA_SHIFT, 540 },
+    // State 540
+    { 540, 250, PA_SHIFT, 542 },
+    // State 540
+    { 540, 737, PA_SHIFT, 541 },
+    // State 541
+    { 541, 1249, PA_REDUCE, 360 },
+    // State 541 default action
+    { 541, -1, PA_REDUCE, 360 },
+    // State 542
+    { 542, 240, PA_SHIFT, 544 },
+    // State 542
+    { 542, 490, PA_SHIFT, 545 },
+    // State 542
+    { 542, 988, PA_SHIFT, 543 },
+    // State 543
+    { 543, 1249, PA_REDUCE, 361 },
+    // State 543 default action
+    { 543, -1, PA_REDUCE, 361 },
+    // State 544
+    { 544, 1249, PA_REDUCE, 363 },
+    // State 544 default action
+    { 544, -1, PA_REDUCE, 363 },
+    // State 545
+    { 545, 241, PA_SHIFT, 550 },
+    // State 545
+    { 545, 491, PA_SHIFT, 551 },
+    // State 545
+    { 545, 989, PA_SHIFT, 1652 },
+    // State 545
+    { 545, 1239, PA_SHIFT, 546 },
+    // State 546
+    { 546, 250, PA_SHIFT, 548 },
+    // State 546
+    { 546, 739, PA_SHIFT, 547 },
+    // State 547
+    { 547, 1249, PA_REDUCE, 364 },
+    // State 547 default action
+    { 547, -1, PA_REDUCE, 364 },
+    // State 548
+    { 548, 241, PA_SHIFT, 550 },
+    // State 548
+    { 548, 491, PA_SHIFT, 551 },
+    // State 548
+    { 548, 989, PA_SHIFT, 549 },
+    // State 549
+    { 549, 1249, PA_REDUCE, 365 },
+    // State 549 default action
+    { 549, -1, PA_REDUCE, 365 },
+    // State 550
+    { 550, 1249, PA_REDUCE, 367 },
+    // State 550 default action
+    { 550, -1, PA_REDUCE, 367 },
+    // State 551
+    { 551, 242, PA_SHIFT, 556 },
+    // State 551
+    { 551, 492, PA_SHIFT, 557 },
+    // State 551
+    { 551, 990, PA_SHIFT, 1651 },
+    // State 551
+    { 551, 1240, PA_SHIFT, 552 },
+    // State 552
+    { 552, 250, PA_SHIFT, 554 },
+    // State 552
+    { 552, 740, PA_SHIFT, 553 },
+    // State 553
+    { 553, 1249, PA_REDUCE, 368 },
+    // State 553 default action
+    { 553, -1, PA_REDUCE, 368 },
+    // State 554
+    { 554, 242, PA_SHIFT, 556 },
+    // State 554
+    { 554, 492, PA_SHIFT, 557 },
+    // State 554
+    { 554, 990, PA_SHIFT, 555 },
+    // State 555
+    { 555, 1249, PA_REDUCE, 369 },
+    // State 555 default action
+    { 555, -1, PA_REDUCE, 369 },
+    // State 556
+    { 556, 1249, PA_REDUCE, 371 },
+    // State 556 default action
+    { 556, -1, PA_REDUCE, 371 },
+    // State 557
+    { 557, 243, PA_SHIFT, 562 },
+    // State 557
+    { 557, 493, PA_SHIFT, 563 },
+    // State 557
+    { 557, 991, PA_SHIFT, 1650 },
+    // State 557
+    { 557, 1241, PA_SHIFT, 558 },
+    // State 558
+    { 558, 250, PA_SHIFT, 560 },
+    // State 558
+    { 558, 741, PA_SHIFT, 559 },
+    // State 559
+    { 559, 1249, PA_REDUCE, 372 },
+    // State 559 default action
+    { 559, -1, PA_REDUCE, 372 },
+    // State 560
+    { 560, 243, PA_SHIFT, 562 },
+    // State 560
+    { 560, 493, PA_SHIFT, 563 },
+    // State 560
+    { 560, 991, PA_SHIFT, 561 },
+    // State 561
+    { 561, 1249, PA_REDUCE, 373 },
+    // State 561 default action
+    { 561, -1, PA_REDUCE, 373 },
+    // State 562
+    { 562, 1249, PA_REDUCE, 375 },
+    // State 562 default action
+    { 562, -1, PA_REDUCE, 375 },
+    // State 563
+    { 563, 244, PA_SHIFT, 568 },
+    // State 563
+    { 563, 494, PA_SHIFT, 569 },
+    // State 563
+    { 563, 992, PA_SHIFT, 1649 },
+    // State 563
+    { 563, 1242, PA_SHIFT, 564 },
+    // State 564
+    { 564, 250, PA_SHIFT, 566 },
+    // State 564
+    { 564, 742, PA_SHIFT, 565 },
+    // State 565
+    { 565, 1249, PA_REDUCE, 376 },
+    // State 565 default action
+    { 565, -1, PA_REDUCE, 376 },
+    // State 566
+    { 566, 244, PA_SHIFT, 568 },
+    // State 566
+    { 566, 494, PA_SHIFT, 569 },
+    // State 566
+    { 566, 992, PA_SHIFT, 567 },
+    // State 567
+    { 567, 1249, PA_REDUCE, 377 },
+    // State 567 default action
+    { 567, -1, PA_REDUCE, 377 },
+    // State 568
+    { 568, 1249, PA_REDUCE, 379 },
+    // State 568 default action
+    { 568, -1, PA_REDUCE, 379 },
+    // State 569
+    { 569, 245, PA_SHIFT, 574 },
+    // State 569
+    { 569, 495, PA_SHIFT, 575 },
+    // State 569
+    { 569, 993, PA_SHIFT, 1648 },
+    // State 569
+    { 569, 1243, PA_SHIFT, 570 },
+    // State 570
+    { 570, 250, PA_SHIFT, 572 },
+    // State 570
+    { 570, 743, PA_SHIFT, 571 },
+    // State 571
+    { 571, 1249, PA_REDUCE, 380 },
+    // State 571 default action
+    { 571, -1, PA_REDUCE, 380 },
+    // State 572
+    { 572, 245, PA_SHIFT, 574 },
+    // State 572
+    { 572, 495, PA_SHIFT, 575 },
+    // State 572
+    { 572, 993, PA_SHIFT, 573 },
+    // State 573
+    { 573, 1249, PA_REDUCE, 381 },
+    // State 573 default action
+    { 573, -1, PA_REDUCE, 381 },
+    // State 574
+    { 574, 1249, PA_REDUCE, 383 },
+    // State 574 default action
+    { 574, -1, PA_REDUCE, 383 },
+    // State 575
+    { 575, 246, PA_SHIFT, 580 },
+    // State 575
+    { 575, 496, PA_SHIFT, 581 },
+    // State 575
+    { 575, 994, PA_SHIFT, 1647 },
+    // State 575
+    { 575, 1244, PA_SHIFT, 576 },
+    // State 576
+    { 576, 250, PA_SHIFT, 578 },
+    // State 576
+    { 576, 744, PA_SHIFT, 577 },
+    // State 577
+    { 577, 1249, PA_REDUCE, 384 },
+    // State 577 default action
+    { 577, -1, PA_REDUCE, 384 },
+    // State 578
+    { 578, 246, PA_SHIFT, 580 },
+    // State 578
+    { 578, 496, PA_SHIFT, 581 },
+    // State 578
+    { 578, 994, PA_SHIFT, 579 },
+    // State 579
+    { 579, 1249, PA_REDUCE, 385 },
+    // State 579 default action
+    { 579, -1, PA_REDUCE, 385 },
+    // State 580
+    { 580, 1249, PA_REDUCE, 387 },
+    // State 580 default action
+    { 580, -1, PA_REDUCE, 387 },
+    // State 581
+    { 581, 247, PA_SHIFT, 586 },
+    // State 581
+    { 581, 497, PA_SHIFT, 587 },
+    // State 581
+    { 581, 995, PA_SHIFT, 1646 },
+    // State 581
+    { 581, 1245, PA_SHIFT, 582 },
+    // State 582
+    { 582, 250, PA_SHIFT, 584 },
+    // State 582
+    { 582, 745, PA_SHIFT, 583 },
+    // State 583
+    { 583, 1249, PA_REDUCE, 388 },
+    // State 583 default action
+    { 583, -1, PA_REDUCE, 388 },
+    // State 584
+    { 584, 247, PA_SHIFT, 586 },
+    // State 584
+    { 584, 497, PA_SHIFT, 587 },
+    // State 584
+    { 584, 995, PA_SHIFT, 585 },
+    // State 585
+    { 585, 1249, PA_REDUCE, 389 },
+    // State 585 default action
+    { 585, -1, PA_REDUCE, 389 },
+    // State 586
+    { 586, 1249, PA_REDUCE, 391 },
+    // State 586 default action
+    { 586, -1, PA_REDUCE, 391 },
+    // State 587
+    { 587, 248, PA_SHIFT, 592 },
+    // State 587
+    { 587, 498, PA_SHIFT, 593 },
+    // State 587
+    { 587, 996, PA_SHIFT, 1645 },
+    // State 587
+    { 587, 1246, PA_SHIFT, 588 },
+    // State 588
+    { 588, 250, PA_SHIFT, 590 },
+    // State 588
+    { 588, 746, PA_SHIFT, 589 },
+    // State 589
+    { 589, 1249, PA_REDUCE, 392 },
+    // State 589 default action
+    { 589, -1, PA_REDUCE, 392 },
+    // State 590
+    { 590, 248, PA_SHIFT, 592 },
+    // State 590
+    { 590, 498, PA_SHIFT, 593 },
+    // State 590
+    { 590, 996, PA_SHIFT, 591 },
+    // State 591
+    { 591, 1249, PA_REDUCE, 393 },
+    // State 591 default action
+    { 591, -1, PA_REDUCE, 393 },
+    // State 592
+    { 592, 1249, PA_REDUCE, 395 },
+    // State 592 default action
+    { 592, -1, PA_REDUCE, 395 },
+    // State 593
+    { 593, 249, PA_SHIFT, 598 },
+    // State 593
+    { 593, 499, PA_SHIFT, 599 },
+    // State 593
+    { 593, 997, PA_SHIFT, 1644 },
+    // State 593
+    { 593, 1247, PA_SHIFT, 594 },
+    // State 594
+    { 594, 250, PA_SHIFT, 596 },
+    // State 594
+    { 594, 747, PA_SHIFT, 595 },
+    // State 595
+    { 595, 1249, PA_REDUCE, 396 },
+    // State 595 default action
+    { 595, -1, PA_REDUCE, 396 },
+    // State 596
+    { 596, 249, PA_SHIFT, 598 },
+    // State 596
+    { 596, 499, PA_SHIFT, 599 },
+    // State 596
+    { 596, 997, PA_SHIFT, 597 },
+    // State 597
+    { 597, 1249, PA_REDUCE, 397 },
+    // State 597 default action
+    { 597, -1, PA_REDUCE, 397 },
+    // State 598
+    { 598, 1249, PA_REDUCE, 399 },
+    // State 598 default action
+    { 598, -1, PA_REDUCE, 399 },
+    // State 599
+    { 599, 4, PA_SHIFT, 604 },
+    // State 599
+    { 599, 254, PA_SHIFT, 605 },
+    // State 599
+    { 599, 752, PA_SHIFT, 1643 },
+    // State 599
+    { 599, 1002, PA_SHIFT, 600 },
+    // State 600
+    { 600, 250, PA_SHIFT, 602 },
+    // State 600
+    { 600, 748, PA_SHIFT, 601 },
+    // State 601
+    { 601, 1249, PA_REDUCE, 400 },
+    // State 601 default action
+    { 601, -1, PA_REDUCE, 400 },
+    // State 602
+    { 602, 4, PA_SHIFT, 604 },
+    // State 602
+    { 602, 254, PA_SHIFT, 605 },
+    // State 602
+    { 602, 752, PA_SHIFT, 603 },
+    // State 603
+    { 603, 1249, PA_REDUCE, 401 },
+    // State 603 default action
+    { 603, -1, PA_REDUCE, 401 },
+    // State 604
+    { 604, 1249, PA_REDUCE, 403 },
+    // State 604 default action
+    { 604, -1, PA_REDUCE, 403 },
+    // State 605
+    { 605, 5, PA_SHIFT, 610 },
+    // State 605
+    { 605, 255, PA_SHIFT, 611 },
+    // State 605
+    { 605, 753, PA_SHIFT, 1642 },
+    // State 605
+    { 605, 1003, PA_SHIFT, 606 },
+    // State 606
+    { 606, 250, PA_SHIFT, 608 },
+    // State 606
+    { 606, 503, PA_SHIFT, 607 },
+    // State 607
+    { 607, 1249, PA_REDUCE, 404 },
+    // State 607 default action
+    { 607, -1, PA_REDUCE, 404 },
+    // State 608
+    { 608, 5, PA_SHIFT, 610 },
+    // State 608
+    { 608, 255, PA_SHIFT, 611 },
+    // State 608
+    { 608, 753, PA_SHIFT, 609 },
+    // State 609
+    { 609, 1249, PA_REDUCE, 405 },
+    // State 609 default action
+    { 609, -1, PA_REDUCE, 405 },
+    // State 610
+    { 610, 1249, PA_REDUCE, 407 },
+    // State 610 default action
+    { 610, -1, PA_REDUCE, 407 },
+    // State 611
+    { 611, 6, PA_SHIFT, 616 },
+    // State 611
+    { 611, 256, PA_SHIFT, 617 },
+    // State 611
+    { 611, 754, PA_SHIFT, 1641 },
+    // State 611
+    { 611, 1004, PA_SHIFT, 612 },
+    // State 612
+    { 612, 250, PA_SHIFT, 614 },
+    // State 612
+    { 612, 504, PA_SHIFT, 613 },
+    // State 613
+    { 613, 1249, PA_REDUCE, 408 },
+    // State 613 default action
+    { 613, -1, PA_REDUCE, 408 },
+    // State 614
+    { 614, 6, PA_SHIFT, 616 },
+    // State 614
+    { 614, 256, PA_SHIFT, 617 },
+    // State 614
+    { 614, 754, PA_SHIFT, 615 },
+    // State 615
+    { 615, 1249, PA_REDUCE, 409 },
+    // State 615 default action
+    { 615, -1, PA_REDUCE, 409 },
+    // State 616
+    { 616, 1249, PA_REDUCE, 411 },
+    // State 616 default action
+    { 616, -1, PA_REDUCE, 411 },
+    // State 617
+    { 617, 7, PA_SHIFT, 622 },
+    // State 617
+    { 617, 257, PA_SHIFT, 623 },
+    // State 617
+    { 617, 755, PA_SHIFT, 1640 },
+    // State 617
+    { 617, 1005, PA_SHIFT, 618 },
+    // State 618
+    { 618, 250, PA_SHIFT, 620 },
+    // State 618
+    { 618, 505, PA_SHIFT, 619 },
+    // State 619
+    { 619, 1249, PA_REDUCE, 412 },
+    // State 619 default action
+    { 619, -1, PA_REDUCE, 412 },
+    // State 620
+    { 620, 7, PA_SHIFT, 622 },
+    // State 620
+    { 620, 257, PA_SHIFT, 623 },
+    // State 620
+    { 620, 755, PA_SHIFT, 621 },
+    // State 621
+    { 621, 1249, PA_REDUCE, 413 },
+    // State 621 default action
+    { 621, -1, PA_REDUCE, 413 },
+    // State 622
+    { 622, 1249, PA_REDUCE, 415 },
+    // State 622 default action
+    { 622, -1, PA_REDUCE, 415 },
+    // State 623
+    { 623, 8, PA_SHIFT, 628 },
+    // State 623
+    { 623, 258, PA_SHIFT, 629 },
+    // State 623
+    { 623, 756, PA_SHIFT, 1639 },
+    // State 623
+    { 623, 1006, PA_SHIFT, 624 },
+    // State 624
+    { 624, 250, PA_SHIFT, 626 },
+    // State 624
+    { 624, 506, PA_SHIFT, 625 },
+    // State 625
+    { 625, 1249, PA_REDUCE, 416 },
+    // State 625 default action
+    { 625, -1, PA_REDUCE, 416 },
+    // State 626
+    { 626, 8, PA_SHIFT, 628 },
+    // State 626
+    { 626, 258, PA_SHIFT, 629 },
+    // State 626
+    { 626, 756, PA_SHIFT, 627 },
+    // State 627
+    { 627, 1249, PA_REDUCE, 417 },
+    // State 627 default action
+    { 627, -1, PA_REDUCE, 417 },
+    // State 628
+    { 628, 1249, PA_REDUCE, 419 },
+    // State 628 default action
+    { 628, -1, PA_REDUCE, 419 },
+    // State 629
+    { 629, 9, PA_SHIFT, 634 },
+    // State 629
+    { 629, 259, PA_SHIFT, 635 },
+    // State 629
+    { 629, 757, PA_SHIFT, 1638 },
+    // State 629
+    { 629, 1007, PA_SHIFT, 630 },
+    // State 630
+    { 630, 250, PA_SHIFT, 632 },
+    // State 630
+    { 630, 507, PA_SHIFT, 631 },
+    // State 631
+    { 631, 1249, PA_REDUCE, 420 },
+    // State 631 default action
+    { 631, -1, PA_REDUCE, 420 },
+    // State 632
+    { 632, 9, PA_SHIFT, 634 },
+    // State 632
+    { 632, 259, PA_SHIFT, 635 },
+    // State 632
+    { 632, 757, PA_SHIFT, 633 },
+    // State 633
+    { 633, 1249, PA_REDUCE, 421 },
+    // State 633 default action
+    { 633, -1, PA_REDUCE, 421 },
+    // State 634
+    { 634, 1249, PA_REDUCE, 423 },
+    // State 634 default action
+    { 634, -1, PA_REDUCE, 423 },
+    // State 635
+    { 635, 10, PA_SHIFT, 640 },
+    // State 635
+    { 635, 260, PA_SHIFT, 641 },
+    // State 635
+    { 635, 758, PA_SHIFT, 1637 },
+    // State 635
+    { 635, 1008, PA_SHIFT, 636 },
+    // State 636
+    { 636, 250, PA_SHIFT, 638 },
+    // State 636
+    { 636, 508, PA_SHIFT, 637 },
+    // State 637
+    { 637, 1249, PA_REDUCE, 424 },
+    // State 637 default action
+    { 637, -1, PA_REDUCE, 424 },
+    // State 638
+    { 638, 10, PA_SHIFT, 640 },
+    // State 638
+    { 638, 260, PA_SHIFT, 641 },
+    // State 638
+    { 638, 758, PA_SHIFT, 639 },
+    // State 639
+    { 639, 1249, PA_REDUCE, 425 },
+    // State 639 default action
+    { 639, -1, PA_REDUCE, 425 },
+    // State 640
+    { 640, 1249, PA_REDUCE, 427 },
+    // State 640 default action
+    { 640, -1, PA_REDUCE, 427 },
+    // State 641
+    { 641, 11, PA_SHIFT, 646 },
+    // State 641
+    { 641, 261, PA_SHIFT, 647 },
+    // State 641
+    { 641, 759, PA_SHIFT, 1636 },
+    // State 641
+    { 641, 1009, PA_SHIFT, 642 },
+    // State 642
+    { 642, 250, PA_SHIFT, 644 },
+    // State 642
+    { 642, 509, PA_SHIFT, 643 },
+    // State 643
+    { 643, 1249, PA_REDUCE, 428 },
+    // State 643 default action
+    { 643, -1, PA_REDUCE, 428 },
+    // State 644
+    { 644, 11, PA_SHIFT, 646 },
+    // State 644
+    { 644, 261, PA_SHIFT, 647 },
+    // State 644
+    { 644, 759, PA_SHIFT, 645 },
+    // State 645
+    { 645, 1249, PA_REDUCE, 429 },
+    // State 645 default action
+    { 645, -1, PA_REDUCE, 429 },
+    // State 646
+    { 646, 1249, PA_REDUCE, 431 },
+    // State 646 default action
+    { 646, -1, PA_REDUCE, 431 },
+    // State 647
+    { 647, 12, PA_SHIFT, 652 },
+    // State 647
+    { 647, 262, PA_SHIFT, 653 },
+    // State 647
+    { 647, 760, PA_SHIFT, 1635 },
+    // State 647
+    { 647, 1010, PA_SHIFT, 648 },
+    // State 648
+    { 648, 250, PA_SHIFT, 650 },
+    // State 648
+    { 648, 510, PA_SHIFT, 649 },
+    // State 649
+    { 649, 1249, PA_REDUCE, 432 },
+    // State 649 default action
+    { 649, -1, PA_REDUCE, 432 },
+    // State 650
+    { 650, 12, PA_SHIFT, 652 },
+    // State 650
+    { 650, 262, PA_SHIFT, 653 },
+    // State 650
+    { 650, 760, PA_SHIFT, 651 },
+    // State 651
+    { 651, 1249, PA_REDUCE, 433 },
+    // State 651 default action
+    { 651, -1, PA_REDUCE, 433 },
+    // State 652
+    { 652, 1249, PA_REDUCE, 435 },
+    // State 652 default action
+    { 652, -1, PA_REDUCE, 435 },
+    // State 653
+    { 653, 13, PA_SHIFT, 658 },
+    // State 653
+    { 653, 263, PA_SHIFT, 659 },
+    // State 653
+    { 653, 761, PA_SHIFT, 1634 },
+    // State 653
+    { 653, 1011, PA_SHIFT, 654 },
+    // State 654
+    { 654, 250, PA_SHIFT, 656 },
+    // State 654
+    { 654, 511, PA_SHIFT, 655 },
+    // State 655
+    { 655, 1249, PA_REDUCE, 436 },
+    // State 655 default action
+    { 655, -1, PA_REDUCE, 436 },
+    // State 656
+    { 656, 13, PA_SHIFT, 658 },
+    // State 656
+    { 656, 263, PA_SHIFT, 659 },
+    // State 656
+    { 656, 761, PA_SHIFT, 657 },
+    // State 657
+    { 657, 1249, PA_REDUCE, 437 },
+    // State 657 default action
+    { 657, -1, PA_REDUCE, 437 },
+    // State 658
+    { 658, 1249, PA_REDUCE, 439 },
+    // State 658 default action
+    { 658, -1, PA_REDUCE, 439 },
+    // State 659
+    { 659, 15, PA_SHIFT, 664 },
+    // State 659
+    { 659, 265, PA_SHIFT, 665 },
+    // State 659
+    { 659, 763, PA_SHIFT, 1633 },
+    // State 659
+    { 659, 1013, PA_SHIFT, 660 },
+    // State 660
+    { 660, 250, PA_SHIFT, 662 },
+    // State 660
+    { 660, 512, PA_SHIFT, 661 },
+    // State 661
+    { 661, 1249, PA_REDUCE, 440 },
+    // State 661 default action
+    { 661, -1, PA_REDUCE, 440 },
+    // State 662
+    { 662, 15, PA_SHIFT, 664 },
+    // State 662
+    { 662, 265, PA_SHIFT, 665 },
+    // State 662
+    { 662, 763, PA_SHIFT, 663 },
+    // State 663
+    { 663, 1249, PA_REDUCE, 441 },
+    // State 663 default action
+    { 663, -1, PA_REDUCE, 441 },
+    // State 664
+    { 664, 1249, PA_REDUCE, 443 },
+    // State 664 default action
+    { 664, -1, PA_REDUCE, 443 },
+    // State 665
+    { 665, 16, PA_SHIFT, 670 },
+    // State 665
+    { 665, 266, PA_SHIFT, 671 },
+    // State 665
+    { 665, 764, PA_SHIFT, 1632 },
+    // State 665
+    { 665, 1014, PA_SHIFT, 666 },
+    // State 666
+    { 666, 250, PA_SHIFT, 668 },
+    // State 666
+    { 666, 514, PA_SHIFT, 667 },
+    // State 667
+    { 667, 1249, PA_REDUCE, 444 },
+    // State 667 default action
+    { 667, -1, PA_REDUCE, 444 },
+    // State 668
+    { 668, 16, PA_SHIFT, 670 },
+    // State 668
+    { 668, 266, PA_SHIFT, 671 },
+    // State 668
+    { 668, 764, PA_SHIFT, 669 },
+    // State 669
+    { 669, 1249, PA_REDUCE, 445 },
+    // State 669 default action
+    { 669, -1, PA_REDUCE, 445 },
+    // State 670
+    { 670, 1249, PA_REDUCE, 447 },
+    // State 670 default action
+    { 670, -1, PA_REDUCE, 447 },
+    // State 671
+    { 671, 17, PA_SHIFT, 676 },
+    // State 671
+    { 671, 267, PA_SHIFT, 677 },
+    // State 671
+    { 671, 765, PA_SHIFT, 1631 },
+    // State 671
+    { 671, 1015, PA_SHIFT, 672 },
+    // State 672
+    { 672, 250, PA_SHIFT, 674 },
+    // State 672
+    { 672, 515, PA_SHIFT, 673 },
+    // State 673
+    { 673, 1249, PA_REDUCE, 448 },
+    // State 673 default action
+    { 673, -1, PA_REDUCE, 448 },
+    // State 674
+    { 674, 17, PA_SHIFT, 676 },
+    // State 674
+    { 674, 267, PA_SHIFT, 677 },
+    // State 674
+    { 674, 765, PA_SHIFT, 675 },
+    // State 675
+    { 675, 1249, PA_REDUCE, 449 },
+    // State 675 default action
+    { 675, -1, PA_REDUCE, 449 },
+    // State 676
+    { 676, 1249, PA_REDUCE, 451 },
+    // State 676 default action
+    { 676, -1, PA_REDUCE, 451 },
+    // State 677
+    { 677, 18, PA_SHIFT, 682 },
+    // State 677
+    { 677, 268, PA_SHIFT, 683 },
+    // State 677
+    { 677, 766, PA_SHIFT, 1630 },
+    // State 677
+    { 677, 1016, PA_SHIFT, 678 },
+    // State 678
+    { 678, 250, PA_SHIFT, 680 },
+    // State 678
+    { 678, 516, PA_SHIFT, 679 },
+    // State 679
+    { 679, 1249, PA_REDUCE, 452 },
+    // State 679 default action
+    { 679, -1, PA_REDUCE, 452 },
+    // State 680
+    { 680, 18, PA_SHIFT, 682 },
+    // State 680
+    { 680, 268, PA_SHIFT, 683 },
+    // State 680
+    { 680, 766, PA_SHIFT, 681 },
+    // State 681
+    { 681, 1249, PA_REDUCE, 453 },
+    // State 681 default action
+    { 681, -1, PA_REDUCE, 453 },
+    // State 682
+    { 682, 1249, PA_REDUCE, 455 },
+    // State 682 default action
+    { 682, -1, PA_REDUCE, 455 },
+    // State 683
+    { 683, 19, PA_SHIFT, 688 },
+    // State 683
+    { 683, 269, PA_SHIFT, 689 },
+    // State 683
+    { 683, 767, PA_SHIFT, 1629 },
+    // State 683
+    { 683, 1017, PA_SHIFT, 684 },
+    // State 684
+    { 684, 250, PA_SHIFT, 686 },
+    // State 684
+    { 684, 517, PA_SHIFT, 685 },
+    // State 685
+    { 685, 1249, PA_REDUCE, 456 },
+    // State 685 default action
+    { 685, -1, PA_REDUCE, 456 },
+    // State 686
+    { 686, 19, PA_SHIFT, 688 },
+    // State 686
+    { 686, 269, PA_SHIFT, 689 },
+    // State 686
+    { 686, 767, PA_SHIFT, 687 },
+    // State 687
+    { 687, 1249, PA_REDUCE, 457 },
+    // State 687 default action
+    { 687, -1, PA_REDUCE, 457 },
+    // State 688
+    { 688, 1249, PA_REDUCE, 459 },
+    // State 688 default action
+    { 688, -1, PA_REDUCE, 459 },
+    // State 689
+    { 689, 20, PA_SHIFT, 694 },
+    // State 689
+    { 689, 270, PA_SHIFT, 695 },
+    // State 689
+    { 689, 768, PA_SHIFT, 1628 },
+    // State 689
+    { 689, 1018, PA_SHIFT, 690 },
+    // State 690
+    { 690, 250, PA_SHIFT, 692 },
+    // State 690
+    { 690, 518, PA_SHIFT, 691 },
+    // State 691
+    { 691, 1249, PA_REDUCE, 460 },
+    // State 691 default action
+    { 691, -1, PA_REDUCE, 460 },
+    // State 692
+    { 692, 20, PA_SHIFT, 694 },
+    // State 692
+    { 692, 270, PA_SHIFT, 695 },
+    // State 692
+    { 692, 768, PA_SHIFT, 693 },
+    // State 693
+    { 693, 1249, PA_REDUCE, 461 },
+    // State 693 default action
+    { 693, -1, PA_REDUCE, 461 },
+    // State 694
+    { 694, 1249, PA_REDUCE, 463 },
+    // State 694 default action
+    { 694, -1, PA_REDUCE, 463 },
+    // State 695
+    { 695, 21, PA_SHIFT, 700 },
+    // State 695
+    { 695, 271, PA_SHIFT, 701 },
+    // State 695
+    { 695, 769, PA_SHIFT, 1627 },
+    // State 695
+    { 695, 1019, PA_SHIFT, 696 },
+    // State 696
+    { 696, 250, PA_SHIFT, 698 },
+    // State 696
+    { 696, 519, PA_SHIFT, 697 },
+    // State 697
+    { 697, 1249, PA_REDUCE, 464 },
+    // State 697 default action
+    { 697, -1, PA_REDUCE, 464 },
+    // State 698
+    { 698, 21, PA_SHIFT, 700 },
+    // State 698
+    { 698, 271, PA_SHIFT, 701 },
+    // State 698
+    { 698, 769, PA_SHIFT, 699 },
+    // State 699
+    { 699, 1249, PA_REDUCE, 465 },
+    // State 699 default action
+    { 699, -1, PA_REDUCE, 465 },
+    // State 700
+    { 700, 1249, PA_REDUCE, 467 },
+    // State 700 default action
+    { 700, -1, PA_REDUCE, 467 },
+    // State 701
+    { 701, 22, PA_SHIFT, 706 },
+    // State 701
+    { 701, 272, PA_SHIFT, 707 },
+    // State 701
+    { 701, 770, PA_SHIFT, 1626 },
+    // State 701
+    { 701, 1020, PA_SHIFT, 702 },
+    // State 702
+    { 702, 250, PA_SHIFT, 704 },
+    // State 702
+    { 702, 520, PA_SHIFT, 703 },
+    // State 703
+    { 703, 1249, PA_REDUCE, 468 },
+    // State 703 default action
+    { 703, -1, PA_REDUCE, 468 },
+    // State 704
+    { 704, 22, PA_SHIFT, 706 },
+    // State 704
+    { 704, 272, PA_SHIFT, 707 },
+    // State 704
+    { 704, 770, PA_SHIFT, 705 },
+    // State 705
+    { 705, 1249, PA_REDUCE, 469 },
+    // State 705 default action
+    { 705, -1, PA_REDUCE, 469 },
+    // State 706
+    { 706, 1249, PA_REDUCE, 471 },
+    // State 706 default action
+    { 706, -1, PA_REDUCE, 471 },
+    // State 707
+    { 707, 23, PA_SHIFT, 712 },
+    // State 707
+    { 707, 273, PA_SHIFT, 713 },
+    // State 707
+    { 707, 771, PA_SHIFT, 1625 },
+    // State 707
+    { 707, 1021, PA_SHIFT, 708 },
+    // State 708
+    { 708, 250, PA_SHIFT, 710 },
+    // State 708
+    { 708, 521, PA_SHIFT, 709 },
+    // State 709
+    { 709, 1249, PA_REDUCE, 472 },
+    // State 709 default action
+    { 709, -1, PA_REDUCE, 472 },
+    // State 710
+    { 710, 23, PA_SHIFT, 712 },
+    // State 710
+    { 710, 273, PA_SHIFT, 713 },
+    // State 710
+    { 710, 771, PA_SHIFT, 711 },
+    // State 711
+    { 711, 1249, PA_REDUCE, 473 },
+    // State 711 default action
+    { 711, -1, PA_REDUCE, 473 },
+    // State 712
+    { 712, 1249, PA_REDUCE, 475 },
+    // State 712 default action
+    { 712, -1, PA_REDUCE, 475 },
+    // State 713
+    { 713, 24, PA_SHIFT, 718 },
+    // State 713
+    { 713, 274, PA_SHIFT, 719 },
+    // State 713
+    { 713, 772, PA_SHIFT, 1624 },
+    // State 713
+    { 713, 1022, PA_SHIFT, 714 },
+    // State 714
+    { 714, 250, PA_SHIFT, 716 },
+    // State 714
+    { 714, 522, PA_SHIFT, 715 },
+    // State 715
+    { 715, 1249, PA_REDUCE, 476 },
+    // State 715 default action
+    { 715, -1, PA_REDUCE, 476 },
+    // State 716
+    { 716, 24, PA_SHIFT, 718 },
+    // State 716
+    { 716, 274, PA_SHIFT, 719 },
+    // State 716
+    { 716, 772, PA_SHIFT, 717 },
+    // State 717
+    { 717, 1249, PA_REDUCE, 477 },
+    // State 717 default action
+    { 717, -1, PA_REDUCE, 477 },
+    // State 718
+    { 718, 1249, PA_REDUCE, 479 },
+    // State 718 default action
+    { 718, -1, PA_REDUCE, 479 },
+    // State 719
+    { 719, 26, PA_SHIFT, 724 },
+    // State 719
+    { 719, 276, PA_SHIFT, 725 },
+    // State 719
+    { 719, 774, PA_SHIFT, 1623 },
+    // State 719
+    { 719, 1024, PA_SHIFT, 720 },
+    // State 720
+    { 720, 250, PA_SHIFT, 722 },
+    // State 720
+    { 720, 523, PA_SHIFT, 721 },
+    // State 721
+    { 721, 1249, PA_REDUCE, 480 },
+    // State 721 default action
+    { 721, -1, PA_REDUCE, 480 },
+    // State 722
+    { 722, 26, PA_SHIFT, 724 },
+    // State 722
+    { 722, 276, PA_SHIFT, 725 },
+    // State 722
+    { 722, 774, PA_SHIFT, 723 },
+    // State 723
+    { 723, 1249, PA_REDUCE, 481 },
+    // State 723 default action
+    { 723, -1, PA_REDUCE, 481 },
+    // State 724
+    { 724, 1249, PA_REDUCE, 483 },
+    // State 724 default action
+    { 724, -1, PA_REDUCE, 483 },
+    // State 725
+    { 725, 27, PA_SHIFT, 730 },
+    // State 725
+    { 725, 277, PA_SHIFT, 731 },
+    // State 725
+    { 725, 775, PA_SHIFT, 1622 },
+    // State 725
+    { 725, 1025, PA_SHIFT, 726 },
+    // State 726
+    { 726, 250, PA_SHIFT, 728 },
+    // State 726
+    { 726, 525, PA_SHIFT, 727 },
+    // State 727
+    { 727, 1249, PA_REDUCE, 484 },
+    // State 727 default action
+    { 727, -1, PA_REDUCE, 484 },
+    // State 728
+    { 728, 27, PA_SHIFT, 730 },
+    // State 728
+    { 728, 277, PA_SHIFT, 731 },
+    // State 728
+    { 728, 775, PA_SHIFT, 729 },
+    // State 729
+    { 729, 1249, PA_REDUCE, 485 },
+    // State 729 default action
+    { 729, -1, PA_REDUCE, 485 },
+    // State 730
+    { 730, 1249, PA_REDUCE, 487 },
+    // State 730 default action
+    { 730, -1, PA_REDUCE, 487 },
+    // State 731
+    { 731, 28, PA_SHIFT, 736 },
+    // State 731
+    { 731, 278, PA_SHIFT, 737 },
+    // State 731
+    { 731, 776, PA_SHIFT, 1621 },
+    // State 731
+    { 731, 1026, PA_SHIFT, 732 },
+    // State 732
+    { 732, 250, PA_SHIFT, 734 },
+    // State 732
+    { 732, 526, PA_SHIFT, 733 },
+    // State 733
+    { 733, 1249, PA_REDUCE, 488 },
+    // State 733 default action
+    { 733, -1, PA_REDUCE, 488 },
+    // State 734
+    { 734, 28, PA_SHIFT, 736 },
+    // State 734
+    { 734, 278, PA_SHIFT, 737 },
+    // State 734
+    { 734, 776, PA_SHIFT, 735 },
+    // State 735
+    { 735, 1249, PA_REDUCE, 489 },
+    // State 735 default action
+    { 735, -1, PA_REDUCE, 489 },
+    // State 736
+    { 736, 1249, PA_REDUCE, 491 },
+    // State 736 default action
+    { 736, -1, PA_REDUCE, 491 },
+    // State 737
+    { 737, 29, PA_SHIFT, 742 },
+    // State 737
+    { 737, 279, PA_SHIFT, 743 },
+    // State 737
+    { 737, 777, PA_SHIFT, 1620 },
+    // State 737
+    { 737, 1027, PA_SHIFT, 738 },
+    // State 738
+    { 738, 250, PA_SHIFT, 740 },
+    // State 738
+    { 738, 527, PA_SHIFT, 739 },
+    // State 739
+    { 739, 1249, PA_REDUCE, 492 },
+    // State 739 default action
+    { 739, -1, PA_REDUCE, 492 },
+    // State 740
+    { 740, 29, PA_SHIFT, 742 },
+    // State 740
+    { 740, 279, PA_SHIFT, 743 },
+    // State 740
+    { 740, 777, PA_SHIFT, 741 },
+    // State 741
+    { 741, 1249, PA_REDUCE, 493 },
+    // State 741 default action
+    { 741, -1, PA_REDUCE, 493 },
+    // State 742
+    { 742, 1249, PA_REDUCE, 495 },
+    // State 742 default action
+    { 742, -1, PA_REDUCE, 495 },
+    // State 743
+    { 743, 30, PA_SHIFT, 748 },
+    // State 743
+    { 743, 280, PA_SHIFT, 749 },
+    // State 743
+    { 743, 778, PA_SHIFT, 1619 },
+    // State 743
+    { 743, 1028, PA_SHIFT, 744 },
+    // State 744
+    { 744, 250, PA_SHIFT, 746 },
+    // State 744
+    { 744, 528, PA_SHIFT, 745 },
+    // State 745
+    { 745, 1249, PA_REDUCE, 496 },
+    // State 745 default action
+    { 745, -1, PA_REDUCE, 496 },
+    // State 746
+    { 746, 30, PA_SHIFT, 748 },
+    // State 746
+    { 746, 280, PA_SHIFT, 749 },
+    // State 746
+    { 746, 778, PA_SHIFT, 747 },
+    // State 747
+    { 747, 1249, PA_REDUCE, 497 },
+    // State 747 default action
+    { 747, -1, PA_REDUCE, 497 },
+    // State 748
+    { 748, 1249, PA_REDUCE, 499 },
+    // State 748 default action
+    { 748, -1, PA_REDUCE, 499 },
+    // State 749
+    { 749, 31, PA_SHIFT, 754 },
+    // State 749
+    { 749, 281, PA_SHIFT, 755 },
+    // State 749
+    { 749, 779, PA_SHIFT, 1618 },
+    // State 749
+    { 749, 1029, PA_SHIFT, 750 },
+    // State 750
+    { 750, 250, PA_SHIFT, 752 },
+    // State 750
+    { 750, 529, PA_SHIFT, 751 },
+    // State 751
+    { 751, 1249, PA_REDUCE, 500 },
+    // State 751 default action
+    { 751, -1, PA_REDUCE, 500 },
+    // State 752
+    { 752, 31, PA_SHIFT, 754 },
+    // State 752
+    { 752, 281, PA_SHIFT, 755 },
+    // State 752
+    { 752, 779, PA_SHIFT, 753 },
+    // State 753
+    { 753, 1249, PA_REDUCE, 501 },
+    // State 753 default action
+    { 753, -1, PA_REDUCE, 501 },
+    // State 754
+    { 754, 1249, PA_REDUCE, 503 },
+    // State 754 default action
+    { 754, -1, PA_REDUCE, 503 },
+    // State 755
+    { 755, 32, PA_SHIFT, 760 },
+    // State 755
+    { 755, 282, PA_SHIFT, 761 },
+    // State 755
+    { 755, 780, PA_SHIFT, 1617 },
+    // State 755
+    { 755, 1030, PA_SHIFT, 756 },
+    // State 756
+    { 756, 250, PA_SHIFT, 758 },
+    // State 756
+    { 756, 530, PA_SHIFT, 757 },
+    // State 757
+    { 757, 1249, PA_REDUCE, 504 },
+    // State 757 default action
+    { 757, -1, PA_REDUCE, 504 },
+    // State 758
+    { 758, 32, PA_SHIFT, 760 },
+    // State 758
+    { 758, 282, PA_SHIFT, 761 },
+    // State 758
+    { 758, 780, PA_SHIFT, 759 },
+    // State 759
+    { 759, 1249, PA_REDUCE, 505 },
+    // State 759 default action
+    { 759, -1, PA_REDUCE, 505 },
+    // State 760
+    { 760, 1249, PA_REDUCE, 507 },
+    // State 760 default action
+    { 760, -1, PA_REDUCE, 507 },
+    // State 761
+    { 761, 33, PA_SHIFT, 766 },
+    // State 761
+    { 761, 283, PA_SHIFT, 767 },
+    // State 761
+    { 761, 781, PA_SHIFT, 1616 },
+    // State 761
+    { 761, 1031, PA_SHIFT, 762 },
+    // State 762
+    { 762, 250, PA_SHIFT, 764 },
+    // State 762
+    { 762, 531, PA_SHIFT, 763 },
+    // State 763
+    { 763, 1249, PA_REDUCE, 508 },
+    // State 763 default action
+    { 763, -1, PA_REDUCE, 508 },
+    // State 764
+    { 764, 33, PA_SHIFT, 766 },
+    // State 764
+    { 764, 283, PA_SHIFT, 767 },
+    // State 764
+    { 764, 781, PA_SHIFT, 765 },
+    // State 765
+    { 765, 1249, PA_REDUCE, 509 },
+    // State 765 default action
+    { 765, -1, PA_REDUCE, 509 },
+    // State 766
+    { 766, 1249, PA_REDUCE, 511 },
+    // State 766 default action
+    { 766, -1, PA_REDUCE, 511 },
+    // State 767
+    { 767, 34, PA_SHIFT, 772 },
+    // State 767
+    { 767, 284, PA_SHIFT, 773 },
+    // State 767
+    { 767, 782, PA_SHIFT, 1615 },
+    // State 767
+    { 767, 1032, PA_SHIFT, 768 },
+    // State 768
+    { 768, 250, PA_SHIFT, 770 },
+    // State 768
+    { 768, 532, PA_SHIFT, 769 },
+    // State 769
+    { 769, 1249, PA_REDUCE, 512 },
+    // State 769 default action
+    { 769, -1, PA_REDUCE, 512 },
+    // State 770
+    { 770, 34, PA_SHIFT, 772 },
+    // State 770
+    { 770, 284, PA_SHIFT, 773 },
+    // State 770
+    { 770, 782, PA_SHIFT, 771 },
+    // State 771
+    { 771, 1249, PA_REDUCE, 513 },
+    // State 771 default action
+    { 771, -1, PA_REDUCE, 513 },
+    // State 772
+    { 772, 1249, PA_REDUCE, 515 },
+    // State 772 default action
+    { 772, -1, PA_REDUCE, 515 },
+    // State 773
+    { 773, 35, PA_SHIFT, 778 },
+    // State 773
+    { 773, 285, PA_SHIFT, 779 },
+    // State 773
+    { 773, 783, PA_SHIFT, 1614 },
+    // State 773
+    { 773, 1033, PA_SHIFT, 774 },
+    // State 774
+    { 774, 250, PA_SHIFT, 776 },
+    // State 774
+    { 774, 533, PA_SHIFT, 775 },
+    // State 775
+    { 775, 1249, PA_REDUCE, 516 },
+    // State 775 default action
+    { 775, -1, PA_REDUCE, 516 },
+    // State 776
+    { 776, 35, PA_SHIFT, 778 },
+    // State 776
+    { 776, 285, PA_SHIFT, 779 },
+    // State 776
+    { 776, 783, PA_SHIFT, 777 },
+    // State 777
+    { 777, 1249, PA_REDUCE, 517 },
+    // State 777 default action
+    { 777, -1, PA_REDUCE, 517 },
+    // State 778
+    { 778, 1249, PA_REDUCE, 519 },
+    // State 778 default action
+    { 778, -1, PA_REDUCE, 519 },
+    // State 779
+    { 779, 37, PA_SHIFT, 784 },
+    // State 779
+    { 779, 287, PA_SHIFT, 785 },
+    // State 779
+    { 779, 785, PA_SHIFT, 1613 },
+    // State 779
+    { 779, 1035, PA_SHIFT, 780 },
+    // State 780
+    { 780, 250, PA_SHIFT, 782 },
+    // State 780
+    { 780, 534, PA_SHIFT, 781 },
+    // State 781
+    { 781, 1249, PA_REDUCE, 520 },
+    // State 781 default action
+    { 781, -1, PA_REDUCE, 520 },
+    // State 782
+    { 782, 37, PA_SHIFT, 784 },
+    // State 782
+    { 782, 287, PA_SHIFT, 785 },
+    // State 782
+    { 782, 785, PA_SHIFT, 783 },
+    // State 783
+    { 783, 1249, PA_REDUCE, 521 },
+    // State 783 default action
+    { 783, -1, PA_REDUCE, 521 },
+    // State 784
+    { 784, 1249, PA_REDUCE, 523 },
+    // State 784 default action
+    { 784, -1, PA_REDUCE, 523 },
+    // State 785
+    { 785, 38, PA_SHIFT, 790 },
+    // State 785
+    { 785, 288, PA_SHIFT, 791 },
+    // State 785
+    { 785, 786, PA_SHIFT, 1612 },
+    // State 785
+    { 785, 1036, PA_SHIFT, 786 },
+    // State 786
+    { 786, 250, PA_SHIFT, 788 },
+    // State 786
+    { 786, 536, PA_SHIFT, 787 },
+    // State 787
+    { 787, 1249, PA_REDUCE, 524 },
+    // State 787 default action
+    { 787, -1, PA_REDUCE, 524 },
+    // State 788
+    { 788, 38, PA_SHIFT, 790 },
+    // State 788
+    { 788, 288, PA_SHIFT, 791 },
+    // State 788
+    { 788, 786, PA_SHIFT, 789 },
+    // State 789
+    { 789, 1249, PA_REDUCE, 525 },
+    // State 789 default action
+    { 789, -1, PA_REDUCE, 525 },
+    // State 790
+    { 790, 1249, PA_REDUCE, 527 },
+    // State 790 default action
+    { 790, -1, PA_REDUCE, 527 },
+    // State 791
+    { 791, 39, PA_SHIFT, 796 },
+    // State 791
+    { 791, 289, PA_SHIFT, 797 },
+    // State 791
+    { 791, 787, PA_SHIFT, 1611 },
+    // State 791
+    { 791, 1037, PA_SHIFT, 792 },
+    // State 792
+    { 792, 250, PA_SHIFT, 794 },
+    // State 792
+    { 792, 537, PA_SHIFT, 793 },
+    // State 793
+    { 793, 1249, PA_REDUCE, 528 },
+    // State 793 default action
+    { 793, -1, PA_REDUCE, 528 },
+    // State 794
+    { 794, 39, PA_SHIFT, 796 },
+    // State 794
+    { 794, 289, PA_SHIFT, 797 },
+    // State 794
+    { 794, 787, PA_SHIFT, 795 },
+    // State 795
+    { 795, 1249, PA_REDUCE, 529 },
+    // State 795 default action
+    { 795, -1, PA_REDUCE, 529 },
+    // State 796
+    { 796, 1249, PA_REDUCE, 531 },
+    // State 796 default action
+    { 796, -1, PA_REDUCE, 531 },
+    // State 797
+    { 797, 40, PA_SHIFT, 802 },
+    // State 797
+    { 797, 290, PA_SHIFT, 803 },
+    // State 797
+    { 797, 788, PA_SHIFT, 1610 },
+    // State 797
+    { 797, 1038, PA_SHIFT, 798 },
+    // State 798
+    { 798, 250, PA_SHIFT, 800 },
+    // State 798
+    { 798, 538, PA_SHIFT, 799 },
+    // State 799
+    { 799, 1249, PA_REDUCE, 532 },
+    // State 799 default action
+    { 799, -1, PA_REDUCE, 532 },
+    // State 800
+    { 800, 40, PA_SHIFT, 802 },
+    // State 800
+    { 800, 290, PA_SHIFT, 803 },
+    // State 800
+    { 800, 788, PA_SHIFT, 801 },
+    // State 801
+    { 801, 1249, PA_REDUCE, 533 },
+    // State 801 default action
+    { 801, -1, PA_REDUCE, 533 },
+    // State 802
+    { 802, 1249, PA_REDUCE, 535 },
+    // State 802 default action
+    { 802, -1, PA_REDUCE, 535 },
+    // State 803
+    { 803, 41, PA_SHIFT, 808 },
+    // State 803
+    { 803, 291, PA_SHIFT, 809 },
+    // State 803
+    { 803, 789, PA_SHIFT, 1609 },
+    // State 803
+    { 803, 1039, PA_SHIFT, 804 },
+    // State 804
+    { 804, 250, PA_SHIFT, 806 },
+    // State 804
+    { 804, 539, PA_SHIFT, 805 },
+    // State 805
+    { 805, 1249, PA_REDUCE, 536 },
+    // State 805 default action
+    { 805, -1, PA_REDUCE, 536 },
+    // State 806
+    { 806, 41, PA_SHIFT, 808 },
+    // State 806
+    { 806, 291, PA_SHIFT, 809 },
+    // State 806
+    { 806, 789, PA_SHIFT, 807 },
+    // State 807
+    { 807, 1249, PA_REDUCE, 537 },
+    // State 807 default action
+    { 807, -1, PA_REDUCE, 537 },
+    // State 808
+    { 808, 1249, PA_REDUCE, 539 },
+    // State 808 default action
+    { 808, -1, PA_REDUCE, 539 },
+    // State 809
+    { 809, 42, PA_SHIFT, 814 },
+    // State 809
+    { 809, 292, PA_SHIFT, 815 },
+    // State 809
+    { 809, 790, PA_SHIFT, 1608 },
+    // State 809
+    { 809, 1040, PA_SHIFT, 810 },
+    // State 810
+    { 810, 250, PA_SHIFT, 812 },
+    // State 810
+    { 810, 540, PA_SHIFT, 811 },
+    // State 811
+    { 811, 1249, PA_REDUCE, 540 },
+    // State 811 default action
+    { 811, -1, PA_REDUCE, 540 },
+    // State 812
+    { 812, 42, PA_SHIFT, 814 },
+    // State 812
+    { 812, 292, PA_SHIFT, 815 },
+    // State 812
+    { 812, 790, PA_SHIFT, 813 },
+    // State 813
+    { 813, 1249, PA_REDUCE, 541 },
+    // State 813 default action
+    { 813, -1, PA_REDUCE, 541 },
+    // State 814
+    { 814, 1249, PA_REDUCE, 543 },
+    // State 814 default action
+    { 814, -1, PA_REDUCE, 543 },
+    // State 815
+    { 815, 43, PA_SHIFT, 820 },
+    // State 815
+    { 815, 293, PA_SHIFT, 821 },
+    // State 815
+    { 815, 791, PA_SHIFT, 1607 },
+    // State 815
+    { 815, 1041, PA_SHIFT, 816 },
+    // State 816
+    { 816, 250, PA_SHIFT, 818 },
+    // State 816
+    { 816, 541, PA_SHIFT, 817 },
+    // State 817
+    { 817, 1249, PA_REDUCE, 544 },
+    // State 817 default action
+    { 817, -1, PA_REDUCE, 544 },
+    // State 818
+    { 818, 43, PA_SHIFT, 820 },
+    // State 818
+    { 818, 293, PA_SHIFT, 821 },
+    // State 818
+    { 818, 791, PA_SHIFT, 819 },
+    // State 819
+    { 819, 1249, PA_REDUCE, 545 },
+    // State 819 default action
+    { 819, -1, PA_REDUCE, 545 },
+    // State 820
+    { 820, 1249, PA_REDUCE, 547 },
+    // State 820 default action
+    { 820, -1, PA_REDUCE, 547 },
+    // State 821
+    { 821, 44, PA_SHIFT, 826 },
+    // State 821
+    { 821, 294, PA_SHIFT, 827 },
+    // State 821
+    { 821, 792, PA_SHIFT, 1606 },
+    // State 821
+    { 821, 1042, PA_SHIFT, 822 },
+    // State 822
+    { 822, 250, PA_SHIFT, 824 },
+    // State 822
+    { 822, 542, PA_SHIFT, 823 },
+    // State 823
+    { 823, 1249, PA_REDUCE, 548 },
+    // State 823 default action
+    { 823, -1, PA_REDUCE, 548 },
+    // State 824
+    { 824, 44, PA_SHIFT, 826 },
+    // State 824
+    { 824, 294, PA_SHIFT, 827 },
+    // State 824
+    { 824, 792, PA_SHIFT, 825 },
+    // State 825
+    { 825, 1249, PA_REDUCE, 549 },
+    // State 825 default action
+    { 825, -1, PA_REDUCE, 549 },
+    // State 826
+    { 826, 1249, PA_REDUCE, 551 },
+    // State 826 default action
+    { 826, -1, PA_REDUCE, 551 },
+    // State 827
+    { 827, 45, PA_SHIFT, 832 },
+    // State 827
+    { 827, 295, PA_SHIFT, 833 },
+    // State 827
+    { 827, 793, PA_SHIFT, 1605 },
+    // State 827
+    { 827, 1043, PA_SHIFT, 828 },
+    // State 828
+    { 828, 250, PA_SHIFT, 830 },
+    // State 828
+    { 828, 543, PA_SHIFT, 829 },
+    // State 829
+    { 829, 1249, PA_REDUCE, 552 },
+    // State 829 default action
+    { 829, -1, PA_REDUCE, 552 },
+    // State 830
+    { 830, 45, PA_SHIFT, 832 },
+    // State 830
+    { 830, 295, PA_SHIFT, 833 },
+    // State 830
+    { 830, 793, PA_SHIFT, 831 },
+    // State 831
+    { 831, 1249, PA_REDUCE, 553 },
+    // State 831 default action
+    { 831, -1, PA_REDUCE, 553 },
+    // State 832
+    { 832, 1249, PA_REDUCE, 555 },
+    // State 832 default action
+    { 832, -1, PA_REDUCE, 555 },
+    // State 833
+    { 833, 46, PA_SHIFT, 838 },
+    // State 833
+    { 833, 296, PA_SHIFT, 839 },
+    // State 833
+    { 833, 794, PA_SHIFT, 1604 },
+    // State 833
+    { 833, 1044, PA_SHIFT, 834 },
+    // State 834
+    { 834, 250, PA_SHIFT, 836 },
+    // State 834
+    { 834, 544, PA_SHIFT, 835 },
+    // State 835
+    { 835, 1249, PA_REDUCE, 556 },
+    // State 835 default action
+    { 835, -1, PA_REDUCE, 556 },
+    // State 836
+    { 836, 46, PA_SHIFT, 838 },
+    // State 836
+    { 836, 296, PA_SHIFT, 839 },
+    // State 836
+    { 836, 794, PA_SHIFT, 837 },
+    // State 837
+    { 837, 1249, PA_REDUCE, 557 },
+    // State 837 default action
+    { 837, -1, PA_REDUCE, 557 },
+    // State 838
+    { 838, 1249, PA_REDUCE, 559 },
+    // State 838 default action
+    { 838, -1, PA_REDUCE, 559 },
+    // State 839
+    { 839, 48, PA_SHIFT, 844 },
+    // State 839
+    { 839, 298, PA_SHIFT, 845 },
+    // State 839
+    { 839, 796, PA_SHIFT, 1603 },
+    // State 839
+    { 839, 1046, PA_SHIFT, 840 },
+    // State 840
+    { 840, 250, PA_SHIFT, 842 },
+    // State 840
+    { 840, 545, PA_SHIFT, 841 },
+    // State 841
+    { 841, 1249, PA_REDUCE, 560 },
+    // State 841 default action
+    { 841, -1, PA_REDUCE, 560 },
+    // State 842
+    { 842, 48, PA_SHIFT, 844 },
+    // State 842
+    { 842, 298, PA_SHIFT, 845 },
+    // State 842
+    { 842, 796, PA_SHIFT, 843 },
+    // State 843
+    { 843, 1249, PA_REDUCE, 561 },
+    // State 843 default action
+    { 843, -1, PA_REDUCE, 561 },
+    // State 844
+    { 844, 1249, PA_REDUCE, 563 },
+    // State 844 default action
+    { 844, -1, PA_REDUCE, 563 },
+    // State 845
+    { 845, 49, PA_SHIFT, 850 },
+    // State 845
+    { 845, 299, PA_SHIFT, 851 },
+    // State 845
+    { 845, 797, PA_SHIFT, 1602 },
+    // State 845
+    { 845, 1047, PA_SHIFT, 846 },
+    // State 846
+    { 846, 250, PA_SHIFT, 848 },
+    // State 846
+    { 846, 547, PA_SHIFT, 847 },
+    // State 847
+    { 847, 1249, PA_REDUCE, 564 },
+    // State 847 default action
+    { 847, -1, PA_REDUCE, 564 },
+    // State 848
+    { 848, 49, PA_SHIFT, 850 },
+    // State 848
+    { 848, 299, PA_SHIFT, 851 },
+    // State 848
+    { 848, 797, PA_SHIFT, 849 },
+    // State 849
+    { 849, 1249, PA_REDUCE, 565 },
+    // State 849 default action
+    { 849, -1, PA_REDUCE, 565 },
+    // State 850
+    { 850, 1249, PA_REDUCE, 567 },
+    // State 850 default action
+    { 850, -1, PA_REDUCE, 567 },
+    // State 851
+    { 851, 50, PA_SHIFT, 856 },
+    // State 851
+    { 851, 300, PA_SHIFT, 857 },
+    // State 851
+    { 851, 798, PA_SHIFT, 1601 },
+    // State 851
+    { 851, 1048, PA_SHIFT, 852 },
+    // State 852
+    { 852, 250, PA_SHIFT, 854 },
+    // State 852
+    { 852, 548, PA_SHIFT, 853 },
+    // State 853
+    { 853, 1249, PA_REDUCE, 568 },
+    // State 853 default action
+    { 853, -1, PA_REDUCE, 568 },
+    // State 854
+    { 854, 50, PA_SHIFT, 856 },
+    // State 854
+    { 854, 300, PA_SHIFT, 857 },
+    // State 854
+    { 854, 798, PA_SHIFT, 855 },
+    // State 855
+    { 855, 1249, PA_REDUCE, 569 },
+    // State 855 default action
+    { 855, -1, PA_REDUCE, 569 },
+    // State 856
+    { 856, 1249, PA_REDUCE, 571 },
+    // State 856 default action
+    { 856, -1, PA_REDUCE, 571 },
+    // State 857
+    { 857, 51, PA_SHIFT, 862 },
+    // State 857
+    { 857, 301, PA_SHIFT, 863 },
+    // State 857
+    { 857, 799, PA_SHIFT, 1600 },
+    // State 857
+    { 857, 1049, PA_SHIFT, 858 },
+    // State 858
+    { 858, 250, PA_SHIFT, 860 },
+    // State 858
+    { 858, 549, PA_SHIFT, 859 },
+    // State 859
+    { 859, 1249, PA_REDUCE, 572 },
+    // State 859 default action
+    { 859, -1, PA_REDUCE, 572 },
+    // State 860
+    { 860, 51, PA_SHIFT, 862 },
+    // State 860
+    { 860, 301, PA_SHIFT, 863 },
+    // State 860
+    { 860, 799, PA_SHIFT, 861 },
+    // State 861
+    { 861, 1249, PA_REDUCE, 573 },
+    // State 861 default action
+    { 861, -1, PA_REDUCE, 573 },
+    // State 862
+    { 862, 1249, PA_REDUCE, 575 },
+    // State 862 default action
+    { 862, -1, PA_REDUCE, 575 },
+    // State 863
+    { 863, 52, PA_SHIFT, 868 },
+    // State 863
+    { 863, 302, PA_SHIFT, 869 },
+    // State 863
+    { 863, 800, PA_SHIFT, 1599 },
+    // State 863
+    { 863, 1050, PA_SHIFT, 864 },
+    // State 864
+    { 864, 250, PA_SHIFT, 866 },
+    // State 864
+    { 864, 550, PA_SHIFT, 865 },
+    // State 865
+    { 865, 1249, PA_REDUCE, 576 },
+    // State 865 default action
+    { 865, -1, PA_REDUCE, 576 },
+    // State 866
+    { 866, 52, PA_SHIFT, 868 },
+    // State 866
+    { 866, 302, PA_SHIFT, 869 },
+    // State 866
+    { 866, 800, PA_SHIFT, 867 },
+    // State 867
+    { 867, 1249, PA_REDUCE, 577 },
+    // State 867 default action
+    { 867, -1, PA_REDUCE, 577 },
+    // State 868
+    { 868, 1249, PA_REDUCE, 579 },
+    // State 868 default action
+    { 868, -1, PA_REDUCE, 579 },
+    // State 869
+    { 869, 53, PA_SHIFT, 874 },
+    // State 869
+    { 869, 303, PA_SHIFT, 875 },
+    // State 869
+    { 869, 801, PA_SHIFT, 1598 },
+    // State 869
+    { 869, 1051, PA_SHIFT, 870 },
+    // State 870
+    { 870, 250, PA_SHIFT, 872 },
+    // State 870
+    { 870, 551, PA_SHIFT, 871 },
+    // State 871
+    { 871, 1249, PA_REDUCE, 580 },
+    // State 871 default action
+    { 871, -1, PA_REDUCE, 580 },
+    // State 872
+    { 872, 53, PA_SHIFT, 874 },
+    // State 872
+    { 872, 303, PA_SHIFT, 875 },
+    // State 872
+    { 872, 801, PA_SHIFT, 873 },
+    // State 873
+    { 873, 1249, PA_REDUCE, 581 },
+    // State 873 default action
+    { 873, -1, PA_REDUCE, 581 },
+    // State 874
+    { 874, 1249, PA_REDUCE, 583 },
+    // State 874 default action
+    { 874, -1, PA_REDUCE, 583 },
+    // State 875
+    { 875, 54, PA_SHIFT, 880 },
+    // State 875
+    { 875, 304, PA_SHIFT, 881 },
+    // State 875
+    { 875, 802, PA_SHIFT, 1597 },
+    // State 875
+    { 875, 1052, PA_SHIFT, 876 },
+    // State 876
+    { 876, 250, PA_SHIFT, 878 },
+    // State 876
+    { 876, 552, PA_SHIFT, 877 },
+    // State 877
+    { 877, 1249, PA_REDUCE, 584 },
+    // State 877 default action
+    { 877, -1, PA_REDUCE, 584 },
+    // State 878
+    { 878, 54, PA_SHIFT, 880 },
+    // State 878
+    { 878, 304, PA_SHIFT, 881 },
+    // State 878
+    { 878, 802, PA_SHIFT, 879 },
+    // State 879
+    { 879, 1249, PA_REDUCE, 585 },
+    // State 879 default action
+    { 879, -1, PA_REDUCE, 585 },
+    // State 880
+    { 880, 1249, PA_REDUCE, 587 },
+    // State 880 default action
+    { 880, -1, PA_REDUCE, 587 },
+    // State 881
+    { 881, 55, PA_SHIFT, 886 },
+    // State 881
+    { 881, 305, PA_SHIFT, 887 },
+    // State 881
+    { 881, 803, PA_SHIFT, 1596 },
+    // State 881
+    { 881, 1053, PA_SHIFT, 882 },
+    // State 882
+    { 882, 250, PA_SHIFT, 884 },
+    // State 882
+    { 882, 553, PA_SHIFT, 883 },
+    // State 883
+    { 883, 1249, PA_REDUCE, 588 },
+    // State 883 default action
+    { 883, -1, PA_REDUCE, 588 },
+    // State 884
+    { 884, 55, PA_SHIFT, 886 },
+    // State 884
+    { 884, 305, PA_SHIFT, 887 },
+    // State 884
+    { 884, 803, PA_SHIFT, 885 },
+    // State 885
+    { 885, 1249, PA_REDUCE, 589 },
+    // State 885 default action
+    { 885, -1, PA_REDUCE, 589 },
+    // State 886
+    { 886, 1249, PA_REDUCE, 591 },
+    // State 886 default action
+    { 886, -1, PA_REDUCE, 591 },
+    // State 887
+    { 887, 56, PA_SHIFT, 892 },
+    // State 887
+    { 887, 306, PA_SHIFT, 893 },
+    // State 887
+    { 887, 804, PA_SHIFT, 1595 },
+    // State 887
+    { 887, 1054, PA_SHIFT, 888 },
+    // State 888
+    { 888, 250, PA_SHIFT, 890 },
+    // State 888
+    { 888, 554, PA_SHIFT, 889 },
+    // State 889
+    { 889, 1249, PA_REDUCE, 592 },
+    // State 889 default action
+    { 889, -1, PA_REDUCE, 592 },
+    // State 890
+    { 890, 56, PA_SHIFT, 892 },
+    // State 890
+    { 890, 306, PA_SHIFT, 893 },
+    // State 890
+    { 890, 804, PA_SHIFT, 891 },
+    // State 891
+    { 891, 1249, PA_REDUCE, 593 },
+    // State 891 default action
+    { 891, -1, PA_REDUCE, 593 },
+    // State 892
+    { 892, 1249, PA_REDUCE, 595 },
+    // State 892 default action
+    { 892, -1, PA_REDUCE, 595 },
+    // State 893
+    { 893, 57, PA_SHIFT, 898 },
+    // State 893
+    { 893, 307, PA_SHIFT, 899 },
+    // State 893
+    { 893, 805, PA_SHIFT, 1594 },
+    // State 893
+    { 893, 1055, PA_SHIFT, 894 },
+    // State 894
+    { 894, 250, PA_SHIFT, 896 },
+    // State 894
+    { 894, 555, PA_SHIFT, 895 },
+    // State 895
+    { 895, 1249, PA_REDUCE, 596 },
+    // State 895 default action
+    { 895, -1, PA_REDUCE, 596 },
+    // State 896
+    { 896, 57, PA_SHIFT, 898 },
+    // State 896
+    { 896, 307, PA_SHIFT, 899 },
+    // State 896
+    { 896, 805, PA_SHIFT, 897 },
+    // State 897
+    { 897, 1249, PA_REDUCE, 597 },
+    // State 897 default action
+    { 897, -1, PA_REDUCE, 597 },
+    // State 898
+    { 898, 1249, PA_REDUCE, 599 },
+    // State 898 default action
+    { 898, -1, PA_REDUCE, 599 },
+    // State 899
+    { 899, 59, PA_SHIFT, 904 },
+    // State 899
+    { 899, 309, PA_SHIFT, 905 },
+    // State 899
+    { 899, 807, PA_SHIFT, 1593 },
+    // State 899
+    { 899, 1057, PA_SHIFT, 900 },
+    // State 900
+    { 900, 250, PA_SHIFT, 902 },
+    // State 900
+    { 900, 556, PA_SHIFT, 901 },
+    // State 901
+    { 901, 1249, PA_REDUCE, 600 },
+    // State 901 default action
+    { 901, -1, PA_REDUCE, 600 },
+    // State 902
+    { 902, 59, PA_SHIFT, 904 },
+    // State 902
+    { 902, 309, PA_SHIFT, 905 },
+    // State 902
+    { 902, 807, PA_SHIFT, 903 },
+    // State 903
+    { 903, 1249, PA_REDUCE, 601 },
+    // State 903 default action
+    { 903, -1, PA_REDUCE, 601 },
+    // State 904
+    { 904, 1249, PA_REDUCE, 603 },
+    // State 904 default action
+    { 904, -1, PA_REDUCE, 603 },
+    // State 905
+    { 905, 60, PA_SHIFT, 910 },
+    // State 905
+    { 905, 310, PA_SHIFT, 911 },
+    // State 905
+    { 905, 808, PA_SHIFT, 1592 },
+    // State 905
+    { 905, 1058, PA_SHIFT, 906 },
+    // State 906
+    { 906, 250, PA_SHIFT, 908 },
+    // State 906
+    { 906, 558, PA_SHIFT, 907 },
+    // State 907
+    { 907, 1249, PA_REDUCE, 604 },
+    // State 907 default action
+    { 907, -1, PA_REDUCE, 604 },
+    // State 908
+    { 908, 60, PA_SHIFT, 910 },
+    // State 908
+    { 908, 310, PA_SHIFT, 911 },
+    // State 908
+    { 908, 808, PA_SHIFT, 909 },
+    // State 909
+    { 909, 1249, PA_REDUCE, 605 },
+    // State 909 default action
+    { 909, -1, PA_REDUCE, 605 },
+    // State 910
+    { 910, 1249, PA_REDUCE, 607 },
+    // State 910 default action
+    { 910, -1, PA_REDUCE, 607 },
+    // State 911
+    { 911, 61, PA_SHIFT, 916 },
+    // State 911
+    { 911, 311, PA_SHIFT, 917 },
+    // State 911
+    { 911, 809, PA_SHIFT, 1591 },
+    // State 911
+    { 911, 1059, PA_SHIFT, 912 },
+    // State 912
+    { 912, 250, PA_SHIFT, 914 },
+    // State 912
+    { 912, 559, PA_SHIFT, 913 },
+    // State 913
+    { 913, 1249, PA_REDUCE, 608 },
+    // State 913 default action
+    { 913, -1, PA_REDUCE, 608 },
+    // State 914
+    { 914, 61, PA_SHIFT, 916 },
+    // State 914
+    { 914, 311, PA_SHIFT, 917 },
+    // State 914
+    { 914, 809, PA_SHIFT, 915 },
+    // State 915
+    { 915, 1249, PA_REDUCE, 609 },
+    // State 915 default action
+    { 915, -1, PA_REDUCE, 609 },
+    // State 916
+    { 916, 1249, PA_REDUCE, 611 },
+    // State 916 default action
+    { 916, -1, PA_REDUCE, 611 },
+    // State 917
+    { 917, 62, PA_SHIFT, 922 },
+    // State 917
+    { 917, 312, PA_SHIFT, 923 },
+    // State 917
+    { 917, 810, PA_SHIFT, 1590 },
+    // State 917
+    { 917, 1060, PA_SHIFT, 918 },
+    // State 918
+    { 918, 250, PA_SHIFT, 920 },
+    // State 918
+    { 918, 560, PA_SHIFT, 919 },
+    // State 919
+    { 919, 1249, PA_REDUCE, 612 },
+    // State 919 default action
+    { 919, -1, PA_REDUCE, 612 },
+    // State 920
+    { 920, 62, PA_SHIFT, 922 },
+    // State 920
+    { 920, 312, PA_SHIFT, 923 },
+    // State 920
+    { 920, 810, PA_SHIFT, 921 },
+    // State 921
+    { 921, 1249, PA_REDUCE, 613 },
+    // State 921 default action
+    { 921, -1, PA_REDUCE, 613 },
+    // State 922
+    { 922, 1249, PA_REDUCE, 615 },
+    // State 922 default action
+    { 922, -1, PA_REDUCE, 615 },
+    // State 923
+    { 923, 63, PA_SHIFT, 928 },
+    // State 923
+    { 923, 313, PA_SHIFT, 929 },
+    // State 923
+    { 923, 811, PA_SHIFT, 1589 },
+    // State 923
+    { 923, 1061, PA_SHIFT, 924 },
+    // State 924
+    { 924, 250, PA_SHIFT, 926 },
+    // State 924
+    { 924, 561, PA_SHIFT, 925 },
+    // State 925
+    { 925, 1249, PA_REDUCE, 616 },
+    // State 925 default action
+    { 925, -1, PA_REDUCE, 616 },
+    // State 926
+    { 926, 63, PA_SHIFT, 928 },
+    // State 926
+    { 926, 313, PA_SHIFT, 929 },
+    // State 926
+    { 926, 811, PA_SHIFT, 927 },
+    // State 927
+    { 927, 1249, PA_REDUCE, 617 },
+    // State 927 default action
+    { 927, -1, PA_REDUCE, 617 },
+    // State 928
+    { 928, 1249, PA_REDUCE, 619 },
+    // State 928 default action
+    { 928, -1, PA_REDUCE, 619 },
+    // State 929
+    { 929, 64, PA_SHIFT, 934 },
+    // State 929
+    { 929, 314, PA_SHIFT, 935 },
+    // State 929
+    { 929, 812, PA_SHIFT, 1588 },
+    // State 929
+    { 929, 1062, PA_SHIFT, 930 },
+    // State 930
+    { 930, 250, PA_SHIFT, 932 },
+    // State 930
+    { 930, 562, PA_SHIFT, 931 },
+    // State 931
+    { 931, 1249, PA_REDUCE, 620 },
+    // State 931 default action
+    { 931, -1, PA_REDUCE, 620 },
+    // State 932
+    { 932, 64, PA_SHIFT, 934 },
+    // State 932
+    { 932, 314, PA_SHIFT, 935 },
+    // State 932
+    { 932, 812, PA_SHIFT, 933 },
+    // State 933
+    { 933, 1249, PA_REDUCE, 621 },
+    // State 933 default action
+    { 933, -1, PA_REDUCE, 621 },
+    // State 934
+    { 934, 1249, PA_REDUCE, 623 },
+    // State 934 default action
+    { 934, -1, PA_REDUCE, 623 },
+    // State 935
+    { 935, 65, PA_SHIFT, 940 },
+    // State 935
+    { 935, 315, PA_SHIFT, 941 },
+    // State 935
+    { 935, 813, PA_SHIFT, 1587 },
+    // State 935
+    { 935, 1063, PA_SHIFT, 936 },
+    // State 936
+    { 936, 250, PA_SHIFT, 938 },
+    // State 936
+    { 936, 563, PA_SHIFT, 937 },
+    // State 937
+    { 937, 1249, PA_REDUCE, 624 },
+    // State 937 default action
+    { 937, -1, PA_REDUCE, 624 },
+    // State 938
+    { 938, 65, PA_SHIFT, 940 },
+    // State 938
+    { 938, 315, PA_SHIFT, 941 },
+    // State 938
+    { 938, 813, PA_SHIFT, 939 },
+    // State 939
+    { 939, 1249, PA_REDUCE, 625 },
+    // State 939 default action
+    { 939, -1, PA_REDUCE, 625 },
+    // State 940
+    { 940, 1249, PA_REDUCE, 627 },
+    // State 940 default action
+    { 940, -1, PA_REDUCE, 627 },
+    // State 941
+    { 941, 66, PA_SHIFT, 946 },
+    // State 941
+    { 941, 316, PA_SHIFT, 947 },
+    // State 941
+    { 941, 814, PA_SHIFT, 1586 },
+    // State 941
+    { 941, 1064, PA_SHIFT, 942 },
+    // State 942
+    { 942, 250, PA_SHIFT, 944 },
+    // State 942
+    { 942, 564, PA_SHIFT, 943 },
+    // State 943
+    { 943, 1249, PA_REDUCE, 628 },
+    // State 943 default action
+    { 943, -1, PA_REDUCE, 628 },
+    // State 944
+    { 944, 66, PA_SHIFT, 946 },
+    // State 944
+    { 944, 316, PA_SHIFT, 947 },
+    // State 944
+    { 944, 814, PA_SHIFT, 945 },
+    // State 945
+    { 945, 1249, PA_REDUCE, 629 },
+    // State 945 default action
+    { 945, -1, PA_REDUCE, 629 },
+    // State 946
+    { 946, 1249, PA_REDUCE, 631 },
+    // State 946 default action
+    { 946, -1, PA_REDUCE, 631 },
+    // State 947
+    { 947, 67, PA_SHIFT, 952 },
+    // State 947
+    { 947, 317, PA_SHIFT, 953 },
+    // State 947
+    { 947, 815, PA_SHIFT, 1585 },
+    // State 947
+    { 947, 1065, PA_SHIFT, 948 },
+    // State 948
+    { 948, 250, PA_SHIFT, 950 },
+    // State 948
+    { 948, 565, PA_SHIFT, 949 },
+    // State 949
+    { 949, 1249, PA_REDUCE, 632 },
+    // State 949 default action
+    { 949, -1, PA_REDUCE, 632 },
+    // State 950
+    { 950, 67, PA_SHIFT, 952 },
+    // State 950
+    { 950, 317, PA_SHIFT, 953 },
+    // State 950
+    { 950, 815, PA_SHIFT, 951 },
+    // State 951
+    { 951, 1249, PA_REDUCE, 633 },
+    // State 951 default action
+    { 951, -1, PA_REDUCE, 633 },
+    // State 952
+    { 952, 1249, PA_REDUCE, 635 },
+    // State 952 default action
+    { 952, -1, PA_REDUCE, 635 },
+    // State 953
+    { 953, 68, PA_SHIFT, 958 },
+    // State 953
+    { 953, 318, PA_SHIFT, 959 },
+    // State 953
+    { 953, 816, PA_SHIFT, 1584 },
+    // State 953
+    { 953, 1066, PA_SHIFT, 954 },
+    // State 954
+    { 954, 250, PA_SHIFT, 956 },
+    // State 954
+    { 954, 566, PA_SHIFT, 955 },
+    // State 955
+    { 955, 1249, PA_REDUCE, 636 },
+    // State 955 default action
+    { 955, -1, PA_REDUCE, 636 },
+    // State 956
+    { 956, 68, PA_SHIFT, 958 },
+    // State 956
+    { 956, 318, PA_SHIFT, 959 },
+    // State 956
+    { 956, 816, PA_SHIFT, 957 },
+    // State 957
+    { 957, 1249, PA_REDUCE, 637 },
+    // State 957 default action
+    { 957, -1, PA_REDUCE, 637 },
+    // State 958
+    { 958, 1249, PA_REDUCE, 639 },
+    // State 958 default action
+    { 958, -1, PA_REDUCE, 639 },
+    // State 959
+    { 959, 70, PA_SHIFT, 964 },
+    // State 959
+    { 959, 320, PA_SHIFT, 965 },
+    // State 959
+    { 959, 818, PA_SHIFT, 1583 },
+    // State 959
+    { 959, 1068, PA_SHIFT, 960 },
+    // State 960
+    { 960, 250, PA_SHIFT, 962 },
+    // State 960
+    { 960, 567, PA_SHIFT, 961 },
+    // State 961
+    { 961, 1249, PA_REDUCE, 640 },
+    // State 961 default action
+    { 961, -1, PA_REDUCE, 640 },
+    // State 962
+    { 962, 70, PA_SHIFT, 964 },
+    // State 962
+    { 962, 320, PA_SHIFT, 965 },
+    // State 962
+    { 962, 818, PA_SHIFT, 963 },
+    // State 963
+    { 963, 1249, PA_REDUCE, 641 },
+    // State 963 default action
+    { 963, -1, PA_REDUCE, 641 },
+    // State 964
+    { 964, 1249, PA_REDUCE, 643 },
+    // State 964 default action
+    { 964, -1, PA_REDUCE, 643 },
+    // State 965
+    { 965, 71, PA_SHIFT, 970 },
+    // State 965
+    { 965, 321, PA_SHIFT, 971 },
+    // State 965
+    { 965, 819, PA_SHIFT, 1582 },
+    // State 965
+    { 965, 1069, PA_SHIFT, 966 },
+    // State 966
+    { 966, 250, PA_SHIFT, 968 },
+    // State 966
+    { 966, 569, PA_SHIFT, 967 },
+    // State 967
+    { 967, 1249, PA_REDUCE, 644 },
+    // State 967 default action
+    { 967, -1, PA_REDUCE, 644 },
+    // State 968
+    { 968, 71, PA_SHIFT, 970 },
+    // State 968
+    { 968, 321, PA_SHIFT, 971 },
+    // State 968
+    { 968, 819, PA_SHIFT, 969 },
+    // State 969
+    { 969, 1249, PA_REDUCE, 645 },
+    // State 969 default action
+    { 969, -1, PA_REDUCE, 645 },
+    // State 970
+    { 970, 1249, PA_REDUCE, 647 },
+    // State 970 default action
+    { 970, -1, PA_REDUCE, 647 },
+    // State 971
+    { 971, 72, PA_SHIFT, 976 },
+    // State 971
+    { 971, 322, PA_SHIFT, 977 },
+    // State 971
+    { 971, 820, PA_SHIFT, 1581 },
+    // State 971
+    { 971, 1070, PA_SHIFT, 972 },
+    // State 972
+    { 972, 250, PA_SHIFT, 974 },
+    // State 972
+    { 972, 570, PA_SHIFT, 973 },
+    // State 973
+    { 973, 1249, PA_REDUCE, 648 },
+    // State 973 default action
+    { 973, -1, PA_REDUCE, 648 },
+    // State 974
+    { 974, 72, PA_SHIFT, 976 },
+    // State 974
+    { 974, 322, PA_SHIFT, 977 },
+    // State 974
+    { 974, 820, PA_SHIFT, 975 },
+    // State 975
+    { 975, 1249, PA_REDUCE, 649 },
+    // State 975 default action
+    { 975, -1, PA_REDUCE, 649 },
+    // State 976
+    { 976, 1249, PA_REDUCE, 651 },
+    // State 976 default action
+    { 976, -1, PA_REDUCE, 651 },
+    // State 977
+    { 977, 73, PA_SHIFT, 982 },
+    // State 977
+    { 977, 323, PA_SHIFT, 983 },
+    // State 977
+    { 977, 821, PA_SHIFT, 1580 },
+    // State 977
+    { 977, 1071, PA_SHIFT, 978 },
+    // State 978
+    { 978, 250, PA_SHIFT, 980 },
+    // State 978
+    { 978, 571, PA_SHIFT, 979 },
+    // State 979
+    { 979, 1249, PA_REDUCE, 652 },
+    // State 979 default action
+    { 979, -1, PA_REDUCE, 652 },
+    // State 980
+    { 980, 73, PA_SHIFT, 982 },
+    // State 980
+    { 980, 323, PA_SHIFT, 983 },
+    // State 980
+    { 980, 821, PA_SHIFT, 981 },
+    // State 981
+    { 981, 1249, PA_REDUCE, 653 },
+    // State 981 default action
+    { 981, -1, PA_REDUCE, 653 },
+    // State 982
+    { 982, 1249, PA_REDUCE, 655 },
+    // State 982 default action
+    { 982, -1, PA_REDUCE, 655 },
+    // State 983
+    { 983, 74, PA_SHIFT, 988 },
+    // State 983
+    { 983, 324, PA_SHIFT, 989 },
+    // State 983
+    { 983, 822, PA_SHIFT, 1579 },
+    // State 983
+    { 983, 1072, PA_SHIFT, 984 },
+    // State 984
+    { 984, 250, PA_SHIFT, 986 },
+    // State 984
+    { 984, 572, PA_SHIFT, 985 },
+    // State 985
+    { 985, 1249, PA_REDUCE, 656 },
+    // State 985 default action
+    { 985, -1, PA_REDUCE, 656 },
+    // State 986
+    { 986, 74, PA_SHIFT, 988 },
+    // State 986
+    { 986, 324, PA_SHIFT, 989 },
+    // State 986
+    { 986, 822, PA_SHIFT, 987 },
+    // State 987
+    { 987, 1249, PA_REDUCE, 657 },
+    // State 987 default action
+    { 987, -1, PA_REDUCE, 657 },
+    // State 988
+    { 988, 1249, PA_REDUCE, 659 },
+    // State 988 default action
+    { 988, -1, PA_REDUCE, 659 },
+    // State 989
+    { 989, 75, PA_SHIFT, 994 },
+    // State 989
+    { 989, 325, PA_SHIFT, 995 },
+    // State 989
+    { 989, 823, PA_SHIFT, 1578 },
+    // State 989
+    { 989, 1073, PA_SHIFT, 990 },
+    // State 990
+    { 990, 250, PA_SHIFT, 992 },
+    // State 990
+    { 990, 573, PA_SHIFT, 991 },
+    // State 991
+    { 991, 1249, PA_REDUCE, 660 },
+    // State 991 default action
+    { 991, -1, PA_REDUCE, 660 },
+    // State 992
+    { 992, 75, PA_SHIFT, 994 },
+    // State 992
+    { 992, 325, PA_SHIFT, 995 },
+    // State 992
+    { 992, 823, PA_SHIFT, 993 },
+    // State 993
+    { 993, 1249, PA_REDUCE, 661 },
+    // State 993 default action
+    { 993, -1, PA_REDUCE, 661 },
+    // State 994
+    { 994, 1249, PA_REDUCE, 663 },
+    // State 994 default action
+    { 994, -1, PA_REDUCE, 663 },
+    // State 995
+    { 995, 76, PA_SHIFT, 1000 },
+    // State 995
+    { 995, 326, PA_SHIFT, 1001 },
+    // State 995
+    { 995, 824, PA_SHIFT, 1577 },
+    // State 995
+    { 995, 1074, PA_SHIFT, 996 },
+    // State 996
+    { 996, 250, PA_SHIFT, 998 },
+    // State 996
+    { 996, 574, PA_SHIFT, 997 },
+    // State 997
+    { 997, 1249, PA_REDUCE, 664 },
+    // State 997 default action
+    { 997, -1, PA_REDUCE, 664 },
+    // State 998
+    { 998, 76, PA_SHIFT, 1000 },
+    // State 998
+    { 998, 326, PA_SHIFT, 1001 },
+    // State 998
+    { 998, 824, PA_SHIFT, 999 },
+    // State 999
+    { 999, 1249, PA_REDUCE, 665 },
+    // State 999 default action
+    { 999, -1, PA_REDUCE, 665 },
+    // State 1000
+    { 1000, 1249, PA_REDUCE, 667 },
+    // State 1000 default action
+    { 1000, -1, PA_REDUCE, 667 },
+    // State 1001
+    { 1001, 77, PA_SHIFT, 1006 },
+    // State 1001
+    { 1001, 327, PA_SHIFT, 1007 },
+    // State 1001
+    { 1001, 825, PA_SHIFT, 1576 },
+    // State 1001
+    { 1001, 1075, PA_SHIFT, 1002 },
+    // State 1002
+    { 1002, 250, PA_SHIFT, 1004 },
+    // State 1002
+    { 1002, 575, PA_SHIFT, 1003 },
+    // State 1003
+    { 1003, 1249, PA_REDUCE, 668 },
+    // State 1003 default action
+    { 1003, -1, PA_REDUCE, 668 },
+    // State 1004
+    { 1004, 77, PA_SHIFT, 1006 },
+    // State 1004
+    { 1004, 327, PA_SHIFT, 1007 },
+    // State 1004
+    { 1004, 825, PA_SHIFT, 1005 },
+    // State 1005
+    { 1005, 1249, PA_REDUCE, 669 },
+    // State 1005 default action
+    { 1005, -1, PA_REDUCE, 669 },
+    // State 1006
+    { 1006, 1249, PA_REDUCE, 671 },
+    // State 1006 default action
+    { 1006, -1, PA_REDUCE, 671 },
+    // State 1007
+    { 1007, 78, PA_SHIFT, 1012 },
+    // State 1007
+    { 1007, 328, PA_SHIFT, 1013 },
+    // State 1007
+    { 1007, 826, PA_SHIFT, 1575 },
+    // State 1007
+    { 1007, 1076, PA_SHIFT, 1008 },
+    // State 1008
+    { 1008, 250, PA_SHIFT, 1010 },
+    // State 1008
+    { 1008, 576, PA_SHIFT, 1009 },
+    // State 1009
+    { 1009, 1249, PA_REDUCE, 672 },
+    // State 1009 default action
+    { 1009, -1, PA_REDUCE, 672 },
+    // State 1010
+    { 1010, 78, PA_SHIFT, 1012 },
+    // State 1010
+    { 1010, 328, PA_SHIFT, 1013 },
+    // State 1010
+    { 1010, 826, PA_SHIFT, 1011 },
+    // State 1011
+    { 1011, 1249, PA_REDUCE, 673 },
+    // State 1011 default action
+    { 1011, -1, PA_REDUCE, 673 },
+    // State 1012
+    { 1012, 1249, PA_REDUCE, 675 },
+    // State 1012 default action
+    { 1012, -1, PA_REDUCE, 675 },
+    // State 1013
+    { 1013, 79, PA_SHIFT, 1018 },
+    // State 1013
+    { 1013, 329, PA_SHIFT, 1019 },
+    // State 1013
+    { 1013, 827, PA_SHIFT, 1574 },
+    // State 1013
+    { 1013, 1077, PA_SHIFT, 1014 },
+    // State 1014
+    { 1014, 250, PA_SHIFT, 1016 },
+    // State 1014
+    { 1014, 577, PA_SHIFT, 1015 },
+    // State 1015
+    { 1015, 1249, PA_REDUCE, 676 },
+    // State 1015 default action
+    { 1015, -1, PA_REDUCE, 676 },
+    // State 1016
+    { 1016, 79, PA_SHIFT, 1018 },
+    // State 1016
+    { 1016, 329, PA_SHIFT, 1019 },
+    // State 1016
+    { 1016, 827, PA_SHIFT, 1017 },
+    // State 1017
+    { 1017, 1249, PA_REDUCE, 677 },
+    // State 1017 default action
+    { 1017, -1, PA_REDUCE, 677 },
+    // State 1018
+    { 1018, 1249, PA_REDUCE, 679 },
+    // State 1018 default action
+    { 1018, -1, PA_REDUCE, 679 },
+    // State 1019
+    { 1019, 81, PA_SHIFT, 1024 },
+    // State 1019
+    { 1019, 331, PA_SHIFT, 1025 },
+    // State 1019
+    { 1019, 829, PA_SHIFT, 1573 },
+    // State 1019
+    { 1019, 1079, PA_SHIFT, 1020 },
+    // State 1020
+    { 1020, 250, PA_SHIFT, 1022 },
+    // State 1020
+    { 1020, 578, PA_SHIFT, 1021 },
+    // State 1021
+    { 1021, 1249, PA_REDUCE, 680 },
+    // State 1021 default action
+    { 1021, -1, PA_REDUCE, 680 },
+    // State 1022
+    { 1022, 81, PA_SHIFT, 1024 },
+    // State 1022
+    { 1022, 331, PA_SHIFT, 1025 },
+    // State 1022
+    { 1022, 829, PA_SHIFT, 1023 },
+    // State 1023
+    { 1023, 1249, PA_REDUCE, 681 },
+    // State 1023 default action
+    { 1023, -1, PA_REDUCE, 681 },
+    // State 1024
+    { 1024, 1249, PA_REDUCE, 683 },
+    // State 1024 default action
+    { 1024, -1, PA_REDUCE, 683 },
+    // State 1025
+    { 1025, 82, PA_SHIFT, 1030 },
+    // State 1025
+    { 1025, 332, PA_SHIFT, 1031 },
+    // State 1025
+    { 1025, 830, PA_SHIFT, 1572 },
+    // State 1025
+    { 1025, 1080, PA_SHIFT, 1026 },
+    // State 1026
+    { 1026, 250, PA_SHIFT, 1028 },
+    // State 1026
+    { 1026, 580, PA_SHIFT, 1027 },
+    // State 1027
+    { 1027, 1249, PA_REDUCE, 684 },
+    // State 1027 default action
+    { 1027, -1, PA_REDUCE, 684 },
+    // State 1028
+    { 1028, 82, PA_SHIFT, 1030 },
+    // State 1028
+    { 1028, 332, PA_SHIFT, 1031 },
+    // State 1028
+    { 1028, 830, PA_SHIFT, 1029 },
+    // State 1029
+    { 1029, 1249, PA_REDUCE, 685 },
+    // State 1029 default action
+    { 1029, -1, PA_REDUCE, 685 },
+    // State 1030
+    { 1030, 1249, PA_REDUCE, 687 },
+    // State 1030 default action
+    { 1030, -1, PA_REDUCE, 687 },
+    // State 1031
+    { 1031, 83, PA_SHIFT, 1036 },
+    // State 1031
+    { 1031, 333, PA_SHIFT, 1037 },
+    // State 1031
+    { 1031, 831, PA_SHIFT, 1571 },
+    // State 1031
+    { 1031, 1081, PA_SHIFT, 1032 },
+    // State 1032
+    { 1032, 250, PA_SHIFT, 1034 },
+    // State 1032
+    { 1032, 581, PA_SHIFT, 1033 },
+    // State 1033
+    { 1033, 1249, PA_REDUCE, 688 },
+    // State 1033 default action
+    { 1033, -1, PA_REDUCE, 688 },
+    // State 1034
+    { 1034, 83, PA_SHIFT, 1036 },
+    // State 1034
+    { 1034, 333, PA_SHIFT, 1037 },
+    // State 1034
+    { 1034, 831, PA_SHIFT, 1035 },
+    // State 1035
+    { 1035, 1249, PA_REDUCE, 689 },
+    // State 1035 default action
+    { 1035, -1, PA_REDUCE, 689 },
+    // State 1036
+    { 1036, 1249, PA_REDUCE, 691 },
+    // State 1036 default action
+    { 1036, -1, PA_REDUCE, 691 },
+    // State 1037
+    { 1037, 84, PA_SHIFT, 1042 },
+    // State 1037
+    { 1037, 334, PA_SHIFT, 1043 },
+    // State 1037
+    { 1037, 832, PA_SHIFT, 1570 },
+    // State 1037
+    { 1037, 1082, PA_SHIFT, 1038 },
+    // State 1038
+    { 1038, 250, PA_SHIFT, 1040 },
+    // State 1038
+    { 1038, 582, PA_SHIFT, 1039 },
+    // State 1039
+    { 1039, 1249, PA_REDUCE, 692 },
+    // State 1039 default action
+    { 1039, -1, PA_REDUCE, 692 },
+    // State 1040
+    { 1040, 84, PA_SHIFT, 1042 },
+    // State 1040
+    { 1040, 334, PA_SHIFT, 1043 },
+    // State 1040
+    { 1040, 832, PA_SHIFT, 1041 },
+    // State 1041
+    { 1041, 1249, PA_REDUCE, 693 },
+    // State 1041 default action
+    { 1041, -1, PA_REDUCE, 693 },
+    // State 1042
+    { 1042, 1249, PA_REDUCE, 695 },
+    // State 1042 default action
+    { 1042, -1, PA_REDUCE, 695 },
+    // State 1043
+    { 1043, 85, PA_SHIFT, 1048 },
+    // State 1043
+    { 1043, 335, PA_SHIFT, 1049 },
+    // State 1043
+    { 1043, 833, PA_SHIFT, 1569 },
+    // State 1043
+    { 1043, 1083, PA_SHIFT, 1044 },
+    // State 1044
+    { 1044, 250, PA_SHIFT, 1046 },
+    // State 1044
+    { 1044, 583, PA_SHIFT, 1045 },
+    // State 1045
+    { 1045, 1249, PA_REDUCE, 696 },
+    // State 1045 default action
+    { 1045, -1, PA_REDUCE, 696 },
+    // State 1046
+    { 1046, 85, PA_SHIFT, 1048 },
+    // State 1046
+    { 1046, 335, PA_SHIFT, 1049 },
+    // State 1046
+    { 1046, 833, PA_SHIFT, 1047 },
+    // State 1047
+    { 1047, 1249, PA_REDUCE, 697 },
+    // State 1047 default action
+    { 1047, -1, PA_REDUCE, 697 },
+    // State 1048
+    { 1048, 1249, PA_REDUCE, 699 },
+    // State 1048 default action
+    { 1048, -1, PA_REDUCE, 699 },
+    // State 1049
+    { 1049, 86, PA_SHIFT, 1054 },
+    // State 1049
+    { 1049, 336, PA_SHIFT, 1055 },
+    // State 1049
+    { 1049, 834, PA_SHIFT, 1568 },
+    // State 1049
+    { 1049, 1084, PA_SHIFT, 1050 },
+    // State 1050
+    { 1050, 250, PA_SHIFT, 1052 },
+    // State 1050
+    { 1050, 584, PA_SHIFT, 1051 },
+    // State 1051
+    { 1051, 1249, PA_REDUCE, 700 },
+    // State 1051 default action
+    { 1051, -1, PA_REDUCE, 700 },
+    // State 1052
+    { 1052, 86, PA_SHIFT, 1054 },
+    // State 1052
+    { 1052, 336, PA_SHIFT, 1055 },
+    // State 1052
+    { 1052, 834, PA_SHIFT, 1053 },
+    // State 1053
+    { 1053, 1249, PA_REDUCE, 701 },
+    // State 1053 default action
+    { 1053, -1, PA_REDUCE, 701 },
+    // State 1054
+    { 1054, 1249, PA_REDUCE, 703 },
+    // State 1054 default action
+    { 1054, -1, PA_REDUCE, 703 },
+    // State 1055
+    { 1055, 87, PA_SHIFT, 1060 },
+    // State 1055
+    { 1055, 337, PA_SHIFT, 1061 },
+    // State 1055
+    { 1055, 835, PA_SHIFT, 1567 },
+    // State 1055
+    { 1055, 1085, PA_SHIFT, 1056 },
+    // State 1056
+    { 1056, 250, PA_SHIFT, 1058 },
+    // State 1056
+    { 1056, 585, PA_SHIFT, 1057 },
+    // State 1057
+    { 1057, 1249, PA_REDUCE, 704 },
+    // State 1057 default action
+    { 1057, -1, PA_REDUCE, 704 },
+    // State 1058
+    { 1058, 87, PA_SHIFT, 1060 },
+    // State 1058
+    { 1058, 337, PA_SHIFT, 1061 },
+    // State 1058
+    { 1058, 835, PA_SHIFT, 1059 },
+    // State 1059
+    { 1059, 1249, PA_REDUCE, 705 },
+    // State 1059 default action
+    { 1059, -1, PA_REDUCE, 705 },
+    // State 1060
+    { 1060, 1249, PA_REDUCE, 707 },
+    // State 1060 default action
+    { 1060, -1, PA_REDUCE, 707 },
+    // State 1061
+    { 1061, 88, PA_SHIFT, 1066 },
+    // State 1061
+    { 1061, 338, PA_SHIFT, 1067 },
+    // State 1061
+    { 1061, 836, PA_SHIFT, 1566 },
+    // State 1061
+    { 1061, 1086, PA_SHIFT, 1062 },
+    // State 1062
+    { 1062, 250, PA_SHIFT, 1064 },
+    // State 1062
+    { 1062, 586, PA_SHIFT, 1063 },
+    // State 1063
+    { 1063, 1249, PA_REDUCE, 708 },
+    // State 1063 default action
+    { 1063, -1, PA_REDUCE, 708 },
+    // State 1064
+    { 1064, 88, PA_SHIFT, 1066 },
+    // State 1064
+    { 1064, 338, PA_SHIFT, 1067 },
+    // State 1064
+    { 1064, 836, PA_SHIFT, 1065 },
+    // State 1065
+    { 1065, 1249, PA_REDUCE, 709 },
+    // State 1065 default action
+    { 1065, -1, PA_REDUCE, 709 },
+    // State 1066
+    { 1066, 1249, PA_REDUCE, 711 },
+    // State 1066 default action
+    { 1066, -1, PA_REDUCE, 711 },
+    // State 1067
+    { 1067, 89, PA_SHIFT, 1072 },
+    // State 1067
+    { 1067, 339, PA_SHIFT, 1073 },
+    // State 1067
+    { 1067, 837, PA_SHIFT, 1565 },
+    // State 1067
+    { 1067, 1087, PA_SHIFT, 1068 },
+    // State 1068
+    { 1068, 250, PA_SHIFT, 1070 },
+    // State 1068
+    { 1068, 587, PA_SHIFT, 1069 },
+    // State 1069
+    { 1069, 1249, PA_REDUCE, 712 },
+    // State 1069 default action
+    { 1069, -1, PA_REDUCE, 712 },
+    // State 1070
+    { 1070, 89, PA_SHIFT, 1072 },
+    // State 1070
+    { 1070, 339, PA_SHIFT, 1073 },
+    // State 1070
+    { 1070, 837, PA_SHIFT, 1071 },
+    // State 1071
+    { 1071, 1249, PA_REDUCE, 713 },
+    // State 1071 default action
+    { 1071, -1, PA_REDUCE, 713 },
+    // State 1072
+    { 1072, 1249, PA_REDUCE, 715 },
+    // State 1072 default action
+    { 1072, -1, PA_REDUCE, 715 },
+    // State 1073
+    { 1073, 90, PA_SHIFT, 1078 },
+    // State 1073
+    { 1073, 340, PA_SHIFT, 1079 },
+    // State 1073
+    { 1073, 838, PA_SHIFT, 1564 },
+    // State 1073
+    { 1073, 1088, PA_SHIFT, 1074 },
+    // State 1074
+    { 1074, 250, PA_SHIFT, 1076 },
+    // State 1074
+    { 1074, 588, PA_SHIFT, 1075 },
+    // State 1075
+    { 1075, 1249, PA_REDUCE, 716 },
+    // State 1075 default action
+    { 1075, -1, PA_REDUCE, 716 },
+    // State 1076
+    { 1076, 90, PA_SHIFT, 1078 },
+    // State 1076
+    { 1076, 340, PA_SHIFT, 1079 },
+    // State 1076
+    { 1076, 838, PA_SHIFT, 1077 },
+    // State 1077
+    { 1077, 1249, PA_REDUCE, 717 },
+    // State 1077 default action
+    { 1077, -1, PA_REDUCE, 717 },
+    // State 1078
+    { 1078, 1249, PA_REDUCE, 719 },
+    // State 1078 default action
+    { 1078, -1, PA_REDUCE, 719 },
+    // State 1079
+    { 1079, 92, PA_SHIFT, 1084 },
+    // State 1079
+    { 1079, 342, PA_SHIFT, 1085 },
+    // State 1079
+    { 1079, 840, PA_SHIFT, 1563 },
+    // State 1079
+    { 1079, 1090, PA_SHIFT, 1080 },
+    // State 1080
+    { 1080, 250, PA_SHIFT, 1082 },
+    // State 1080
+    { 1080, 589, PA_SHIFT, 1081 },
+    // State 1081
+    { 1081, 1249, PA_REDUCE, 720 },
+    // State 1081 default action
+    { 1081, -1, PA_REDUCE, 720 },
+    // State 1082
+    { 1082, 92, PA_SHIFT, 1084 },
+    // State 1082
+    { 1082, 342, PA_SHIFT, 1085 },
+    // State 1082
+    { 1082, 840, PA_SHIFT, 1083 },
+    // State 1083
+    { 1083, 1249, PA_REDUCE, 721 },
+    // State 1083 default action
+    { 1083, -1, PA_REDUCE, 721 },
+    // State 1084
+    { 1084, 1249, PA_REDUCE, 723 },
+    // State 1084 default action
+    { 1084, -1, PA_REDUCE, 723 },
+    // State 1085
+    { 1085, 93, PA_SHIFT, 1090 },
+    // State 1085
+    { 1085, 343, PA_SHIFT, 1091 },
+    // State 1085
+    { 1085, 841, PA_SHIFT, 1562 },
+    // State 1085
+    { 1085, 1091, PA_SHIFT, 1086 },
+    // State 1086
+    { 1086, 250, PA_SHIFT, 1088 },
+    // State 1086
+    { 1086, 591, PA_SHIFT, 1087 },
+    // State 1087
+    { 1087, 1249, PA_REDUCE, 724 },
+    // State 1087 default action
+    { 1087, -1, PA_REDUCE, 724 },
+    // State 1088
+    { 1088, 93, PA_SHIFT, 1090 },
+    // State 1088
+    { 1088, 343, PA_SHIFT, 1091 },
+    // State 1088
+    { 1088, 841, PA_SHIFT, 1089 },
+    // State 1089
+    { 1089, 1249, PA_REDUCE, 725 },
+    // State 1089 default action
+    { 1089, -1, PA_REDUCE, 725 },
+    // State 1090
+    { 1090, 1249, PA_REDUCE, 727 },
+    // State 1090 default action
+    { 1090, -1, PA_REDUCE, 727 },
+    // State 1091
+    { 1091, 94, PA_SHIFT, 1096 },
+    // State 1091
+    { 1091, 344, PA_SHIFT, 1097 },
+    // State 1091
+    { 1091, 842, PA_SHIFT, 1561 },
+    // State 1091
+    { 1091, 1092, PA_SHIFT, 1092 },
+    // State 1092
+    { 1092, 250, PA_SHIFT, 1094 },
+    // State 1092
+    { 1092, 592, PA_SHIFT, 1093 },
+    // State 1093
+    { 1093, 1249, PA_REDUCE, 728 },
+    // State 1093 default action
+    { 1093, -1, PA_REDUCE, 728 },
+    // State 1094
+    { 1094, 94, PA_SHIFT, 1096 },
+    // State 1094
+    { 1094, 344, PA_SHIFT, 1097 },
+    // State 1094
+    { 1094, 842, PA_SHIFT, 1095 },
+    // State 1095
+    { 1095, 1249, PA_REDUCE, 729 },
+    // State 1095 default action
+    { 1095, -1, PA_REDUCE, 729 },
+    // State 1096
+    { 1096, 1249, PA_REDUCE, 731 },
+    // State 1096 default action
+    { 1096, -1, PA_REDUCE, 731 },
+    // State 1097
+    { 1097, 95, PA_SHIFT, 1102 },
+    // State 1097
+    { 1097, 345, PA_SHIFT, 1103 },
+    // State 1097
+    { 1097, 843, PA_SHIFT, 1560 },
+    // State 1097
+    { 1097, 1093, PA_SHIFT, 1098 },
+    // State 1098
+    { 1098, 250, PA_SHIFT, 1100 },
+    // State 1098
+    { 1098, 593, PA_SHIFT, 1099 },
+    // State 1099
+    { 1099, 1249, PA_REDUCE, 732 },
+    // State 1099 default action
+    { 1099, -1, PA_REDUCE, 732 },
+    // State 1100
+    { 1100, 95, PA_SHIFT, 1102 },
+    // State 1100
+    { 1100, 345, PA_SHIFT, 1103 },
+    // State 1100
+    { 1100, 843, PA_SHIFT, 1101 },
+    // State 1101
+    { 1101, 1249, PA_REDUCE, 733 },
+    // State 1101 default action
+    { 1101, -1, PA_REDUCE, 733 },
+    // State 1102
+    { 1102, 1249, PA_REDUCE, 735 },
+    // State 1102 default action
+    { 1102, -1, PA_REDUCE, 735 },
+    // State 1103
+    { 1103, 96, PA_SHIFT, 1108 },
+    // State 1103
+    { 1103, 346, PA_SHIFT, 1109 },
+    // State 1103
+    { 1103, 844, PA_SHIFT, 1559 },
+    // State 1103
+    { 1103, 1094, PA_SHIFT, 1104 },
+    // State 1104
+    { 1104, 250, PA_SHIFT, 1106 },
+    // State 1104
+    { 1104, 594, PA_SHIFT, 1105 },
+    // State 1105
+    { 1105, 1249, PA_REDUCE, 736 },
+    // State 1105 default action
+    { 1105, -1, PA_REDUCE, 736 },
+    // State 1106
+    { 1106, 96, PA_SHIFT, 1108 },
+    // State 1106
+    { 1106, 346, PA_SHIFT, 1109 },
+    // State 1106
+    { 1106, 844, PA_SHIFT, 1107 },
+    // State 1107
+    { 1107, 1249, PA_REDUCE, 737 },
+    // State 1107 default action
+    { 1107, -1, PA_REDUCE, 737 },
+    // State 1108
+    { 1108, 1249, PA_REDUCE, 739 },
+    // State 1108 default action
+    { 1108, -1, PA_REDUCE, 739 },
+    // State 1109
+    { 1109, 97, PA_SHIFT, 1114 },
+    // State 1109
+    { 1109, 347, PA_SHIFT, 1115 },
+    // State 1109
+    { 1109, 845, PA_SHIFT, 1558 },
+    // State 1109
+    { 1109, 1095, PA_SHIFT, 1110 },
+    // State 1110
+    { 1110, 250, PA_SHIFT, 1112 },
+    // State 1110
+    { 1110, 595, PA_SHIFT, 1111 },
+    // State 1111
+    { 1111, 1249, PA_REDUCE, 740 },
+    // State 1111 default action
+    { 1111, -1, PA_REDUCE, 740 },
+    // State 1112
+    { 1112, 97, PA_SHIFT, 1114 },
+    // State 1112
+    { 1112, 347, PA_SHIFT, 1115 },
+    // State 1112
+    { 1112, 845, PA_SHIFT, 1113 },
+    // State 1113
+    { 1113, 1249, PA_REDUCE, 741 },
+    // State 1113 default action
+    { 1113, -1, PA_REDUCE, 741 },
+    // State 1114
+    { 1114, 1249, PA_REDUCE, 743 },
+    // State 1114 default action
+    { 1114, -1, PA_REDUCE, 743 },
+    // State 1115
+    { 1115, 98, PA_SHIFT, 1120 },
+    // State 1115
+    { 1115, 348, PA_SHIFT, 1121 },
+    // State 1115
+    { 1115, 846, PA_SHIFT, 1557 },
+    // State 1115
+    { 1115, 1096, PA_SHIFT, 1116 },
+    // State 1116
+    { 1116, 250, PA_SHIFT, 1118 },
+    // State 1116
+    { 1116, 596, PA_SHIFT, 1117 },
+    // State 1117
+    { 1117, 1249, PA_REDUCE, 744 },
+    // State 1117 default action
+    { 1117, -1, PA_REDUCE, 744 },
+    // State 1118
+    { 1118, 98, PA_SHIFT, 1120 },
+    // State 1118
+    { 1118, 348, PA_SHIFT, 1121 },
+    // State 1118
+    { 1118, 846, PA_SHIFT, 1119 },
+    // State 1119
+    { 1119, 1249, PA_REDUCE, 745 },
+    // State 1119 default action
+    { 1119, -1, PA_REDUCE, 745 },
+    // State 1120
+    { 1120, 1249, PA_REDUCE, 747 },
+    // State 1120 default action
+    { 1120, -1, PA_REDUCE, 747 },
+    // State 1121
+    { 1121, 99, PA_SHIFT, 1126 },
+    // State 1121
+    { 1121, 349, PA_SHIFT, 1127 },
+    // State 1121
+    { 1121, 847, PA_SHIFT, 1556 },
+    // State 1121
+    { 1121, 1097, PA_SHIFT, 1122 },
+    // State 1122
+    { 1122, 250, PA_SHIFT, 1124 },
+    // State 1122
+    { 1122, 597, PA_SHIFT, 1123 },
+    // State 1123
+    { 1123, 1249, PA_REDUCE, 748 },
+    // State 1123 default action
+    { 1123, -1, PA_REDUCE, 748 },
+    // State 1124
+    { 1124, 99, PA_SHIFT, 1126 },
+    // State 1124
+    { 1124, 349, PA_SHIFT, 1127 },
+    // State 1124
+    { 1124, 847, PA_SHIFT, 1125 },
+    // State 1125
+    { 1125, 1249, PA_REDUCE, 749 },
+    // State 1125 default action
+    { 1125, -1, PA_REDUCE, 749 },
+    // State 1126
+    { 1126, 1249, PA_REDUCE, 751 },
+    // State 1126 default action
+    { 1126, -1, PA_REDUCE, 751 },
+    // State 1127
+    { 1127, 100, PA_SHIFT, 1132 },
+    // State 1127
+    { 1127, 350, PA_SHIFT, 1133 },
+    // State 1127
+    { 1127, 848, PA_SHIFT, 1555 },
+    // State 1127
+    { 1127, 1098, PA_SHIFT, 1128 },
+    // State 1128
+    { 1128, 250, PA_SHIFT, 1130 },
+    // State 1128
+    { 1128, 598, PA_SHIFT, 1129 },
+    // State 1129
+    { 1129, 1249, PA_REDUCE, 752 },
+    // State 1129 default action
+    { 1129, -1, PA_REDUCE, 752 },
+    // State 1130
+    { 1130, 100, PA_SHIFT, 1132 },
+    // State 1130
+    { 1130, 350, PA_SHIFT, 1133 },
+    // State 1130
+    { 1130, 848, PA_SHIFT, 1131 },
+    // State 1131
+    { 1131, 1249, PA_REDUCE, 753 },
+    // State 1131 default action
+    { 1131, -1, PA_REDUCE, 753 },
+    // State 1132
+    { 1132, 1249, PA_REDUCE, 755 },
+    // State 1132 default action
+    { 1132, -1, PA_REDUCE, 755 },
+    // State 1133
+    { 1133, 101, PA_SHIFT, 1138 },
+    // State 1133
+    { 1133, 351, PA_SHIFT, 1139 },
+    // State 1133
+    { 1133, 849, PA_SHIFT, 1554 },
+    // State 1133
+    { 1133, 1099, PA_SHIFT, 1134 },
+    // State 1134
+    { 1134, 250, PA_SHIFT, 1136 },
+    // State 1134
+    { 1134, 599, PA_SHIFT, 1135 },
+    // State 1135
+    { 1135, 1249, PA_REDUCE, 756 },
+    // State 1135 default action
+    { 1135, -1, PA_REDUCE, 756 },
+    // State 1136
+    { 1136, 101, PA_SHIFT, 1138 },
+    // State 1136
+    { 1136, 351, PA_SHIFT, 1139 },
+    // State 1136
+    { 1136, 849, PA_SHIFT, 1137 },
+    // State 1137
+    { 1137, 1249, PA_REDUCE, 757 },
+    // State 1137 default action
+    { 1137, -1, PA_REDUCE, 757 },
+    // State 1138
+    { 1138, 1249, PA_REDUCE, 759 },
+    // State 1138 default action
+    { 1138, -1, PA_REDUCE, 759 },
+    // State 1139
+    { 1139, 103, PA_SHIFT, 1144 },
+    // State 1139
+    { 1139, 353, PA_SHIFT, 1145 },
+    // State 1139
+    { 1139, 851, PA_SHIFT, 1553 },
+    // State 1139
+    { 1139, 1101, PA_SHIFT, 1140 },
+    // State 1140
+    { 1140, 250, PA_SHIFT, 1142 },
+    // State 1140
+    { 1140, 600, PA_SHIFT, 1141 },
+    // State 1141
+    { 1141, 1249, PA_REDUCE, 760 },
+    // State 1141 default action
+    { 1141, -1, PA_REDUCE, 760 },
+    // State 1142
+    { 1142, 103, PA_SHIFT, 1144 },
+    // State 1142
+    { 1142, 353, PA_SHIFT, 1145 },
+    // State 1142
+    { 1142, 851, PA_SHIFT, 1143 },
+    // State 1143
+    { 1143, 1249, PA_REDUCE, 761 },
+    // State 1143 default action
+    { 1143, -1, PA_REDUCE, 761 },
+    // State 1144
+    { 1144, 1249, PA_REDUCE, 763 },
+    // State 1144 default action
+    { 1144, -1, PA_REDUCE, 763 },
+    // State 1145
+    { 1145, 104, PA_SHIFT, 1150 },
+    // State 1145
+    { 1145, 354, PA_SHIFT, 1151 },
+    // State 1145
+    { 1145, 852, PA_SHIFT, 1552 },
+    // State 1145
+    { 1145, 1102, PA_SHIFT, 1146 },
+    // State 1146
+    { 1146, 250, PA_SHIFT, 1148 },
+    // State 1146
+    { 1146, 602, PA_SHIFT, 1147 },
+    // State 1147
+    { 1147, 1249, PA_REDUCE, 764 },
+    // State 1147 default action
+    { 1147, -1, PA_REDUCE, 764 },
+    // State 1148
+    { 1148, 104, PA_SHIFT, 1150 },
+    // State 1148
+    { 1148, 354, PA_SHIFT, 1151 },
+    // State 1148
+    { 1148, 852, PA_SHIFT, 1149 },
+    // State 1149
+    { 1149, 1249, PA_REDUCE, 765 },
+    // State 1149 default action
+    { 1149, -1, PA_REDUCE, 765 },
+    // State 1150
+    { 1150, 1249, PA_REDUCE, 767 },
+    // State 1150 default action
+    { 1150, -1, PA_REDUCE, 767 },
+    // State 1151
+    { 1151, 105, PA_SHIFT, 1156 },
+    // State 1151
+    { 1151, 355, PA_SHIFT, 1157 },
+    // State 1151
+    { 1151, 853, PA_SHIFT, 1551 },
+    // State 1151
+    { 1151, 1103, PA_SHIFT, 1152 },
+    // State 1152
+    { 1152, 250, PA_SHIFT, 1154 },
+    // State 1152
+    { 1152, 603, PA_SHIFT, 1153 },
+    // State 1153
+    { 1153, 1249, PA_REDUCE, 768 },
+    // State 1153 default action
+    { 1153, -1, PA_REDUCE, 768 },
+    // State 1154
+    { 1154, 105, PA_SHIFT, 1156 },
+    // State 1154
+    { 1154, 355, PA_SHIFT, 1157 },
+    // State 1154
+    { 1154, 853, PA_SHIFT, 1155 },
+    // State 1155
+    { 1155, 1249, PA_REDUCE, 769 },
+    // State 1155 default action
+    { 1155, -1, PA_REDUCE, 769 },
+    // State 1156
+    { 1156, 1249, PA_REDUCE, 771 },
+    // State 1156 default action
+    { 1156, -1, PA_REDUCE, 771 },
+    // State 1157
+    { 1157, 106, PA_SHIFT, 1162 },
+    // State 1157
+    { 1157, 356, PA_SHIFT, 1163 },
+    // State 1157
+    { 1157, 854, PA_SHIFT, 1550 },
+    // State 1157
+    { 1157, 1104, PA_SHIFT, 1158 },
+    // State 1158
+    { 1158, 250, PA_SHIFT, 1160 },
+    // State 1158
+    { 1158, 604, PA_SHIFT, 1159 },
+    // State 1159
+    { 1159, 1249, PA_REDUCE, 772 },
+    // State 1159 default action
+    { 1159, -1, PA_REDUCE, 772 },
+    // State 1160
+    { 1160, 106, PA_SHIFT, 1162 },
+    // State 1160
+    { 1160, 356, PA_SHIFT, 1163 },
+    // State 1160
+    { 1160, 854, PA_SHIFT, 1161 },
+    // State 1161
+    { 1161, 1249, PA_REDUCE, 773 },
+    // State 1161 default action
+    { 1161, -1, PA_REDUCE, 773 },
+    // State 1162
+    { 1162, 1249, PA_REDUCE, 775 },
+    // State 1162 default action
+    { 1162, -1, PA_REDUCE, 775 },
+    // State 1163
+    { 1163, 107, PA_SHIFT, 1168 },
+    // State 1163
+    { 1163, 357, PA_SHIFT, 1169 },
+    // State 1163
+    { 1163, 855, PA_SHIFT, 1549 },
+    // State 1163
+    { 1163, 1105, PA_SHIFT, 1164 },
+    // State 1164
+    { 1164, 250, PA_SHIFT, 1166 },
+    // State 1164
+    { 1164, 605, PA_SHIFT, 1165 },
+    // State 1165
+    { 1165, 1249, PA_REDUCE, 776 },
+    // State 1165 default action
+    { 1165, -1, PA_REDUCE, 776 },
+    // State 1166
+    { 1166, 107, PA_SHIFT, 1168 },
+    // State 1166
+    { 1166, 357, PA_SHIFT, 1169 },
+    // State 1166
+    { 1166, 855, PA_SHIFT, 1167 },
+    // State 1167
+    { 1167, 1249, PA_REDUCE, 777 },
+    // State 1167 default action
+    { 1167, -1, PA_REDUCE, 777 },
+    // State 1168
+    { 1168, 1249, PA_REDUCE, 779 },
+    // State 1168 default action
+    { 1168, -1, PA_REDUCE, 779 },
+    // State 1169
+    { 1169, 108, PA_SHIFT, 1174 },
+    // State 1169
+    { 1169, 358, PA_SHIFT, 1175 },
+    // State 1169
+    { 1169, 856, PA_SHIFT, 1548 },
+    // State 1169
+    { 1169, 1106, PA_SHIFT, 1170 },
+    // State 1170
+    { 1170, 250, PA_SHIFT, 1172 },
+    // State 1170
+    { 1170, 606, PA_SHIFT, 1171 },
+    // State 1171
+    { 1171, 1249, PA_REDUCE, 780 },
+    // State 1171 default action
+    { 1171, -1, PA_REDUCE, 780 },
+    // State 1172
+    { 1172, 108, PA_SHIFT, 1174 },
+    // State 1172
+    { 1172, 358, PA_SHIFT, 1175 },
+    // State 1172
+    { 1172, 856, PA_SHIFT, 1173 },
+    // State 1173
+    { 1173, 1249, PA_REDUCE, 781 },
+    // State 1173 default action
+    { 1173, -1, PA_REDUCE, 781 },
+    // State 1174
+    { 1174, 1249, PA_REDUCE, 783 },
+    // State 1174 default action
+    { 1174, -1, PA_REDUCE, 783 },
+    // State 1175
+    { 1175, 109, PA_SHIFT, 1180 },
+    // State 1175
+    { 1175, 359, PA_SHIFT, 1181 },
+    // State 1175
+    { 1175, 857, PA_SHIFT, 1547 },
+    // State 1175
+    { 1175, 1107, PA_SHIFT, 1176 },
+    // State 1176
+    { 1176, 250, PA_SHIFT, 1178 },
+    // State 1176
+    { 1176, 607, PA_SHIFT, 1177 },
+    // State 1177
+    { 1177, 1249, PA_REDUCE, 784 },
+    // State 1177 default action
+    { 1177, -1, PA_REDUCE, 784 },
+    // State 1178
+    { 1178, 109, PA_SHIFT, 1180 },
+    // State 1178
+    { 1178, 359, PA_SHIFT, 1181 },
+    // State 1178
+    { 1178, 857, PA_SHIFT, 1179 },
+    // State 1179
+    { 1179, 1249, PA_REDUCE, 785 },
+    // State 1179 default action
+    { 1179, -1, PA_REDUCE, 785 },
+    // State 1180
+    { 1180, 1249, PA_REDUCE, 787 },
+    // State 1180 default action
+    { 1180, -1, PA_REDUCE, 787 },
+    // State 1181
+    { 1181, 110, PA_SHIFT, 1186 },
+    // State 1181
+    { 1181, 360, PA_SHIFT, 1187 },
+    // State 1181
+    { 1181, 858, PA_SHIFT, 1546 },
+    // State 1181
+    { 1181, 1108, PA_SHIFT, 1182 },
+    // State 1182
+    { 1182, 250, PA_SHIFT, 1184 },
+    // State 1182
+    { 1182, 608, PA_SHIFT, 1183 },
+    // State 1183
+    { 1183, 1249, PA_REDUCE, 788 },
+    // State 1183 default action
+    { 1183, -1, PA_REDUCE, 788 },
+    // State 1184
+    { 1184, 110, PA_SHIFT, 1186 },
+    // State 1184
+    { 1184, 360, PA_SHIFT, 1187 },
+    // State 1184
+    { 1184, 858, PA_SHIFT, 1185 },
+    // State 1185
+    { 1185, 1249, PA_REDUCE, 789 },
+    // State 1185 default action
+    { 1185, -1, PA_REDUCE, 789 },
+    // State 1186
+    { 1186, 1249, PA_REDUCE, 791 },
+    // State 1186 default action
+    { 1186, -1, PA_REDUCE, 791 },
+    // State 1187
+    { 1187, 111, PA_SHIFT, 1192 },
+    // State 1187
+    { 1187, 361, PA_SHIFT, 1193 },
+    // State 1187
+    { 1187, 859, PA_SHIFT, 1545 },
+    // State 1187
+    { 1187, 1109, PA_SHIFT, 1188 },
+    // State 1188
+    { 1188, 250, PA_SHIFT, 1190 },
+    // State 1188
+    { 1188, 609, PA_SHIFT, 1189 },
+    // State 1189
+    { 1189, 1249, PA_REDUCE, 792 },
+    // State 1189 default action
+    { 1189, -1, PA_REDUCE, 792 },
+    // State 1190
+    { 1190, 111, PA_SHIFT, 1192 },
+    // State 1190
+    { 1190, 361, PA_SHIFT, 1193 },
+    // State 1190
+    { 1190, 859, PA_SHIFT, 1191 },
+    // State 1191
+    { 1191, 1249, PA_REDUCE, 793 },
+    // State 1191 default action
+    { 1191, -1, PA_REDUCE, 793 },
+    // State 1192
+    { 1192, 1249, PA_REDUCE, 795 },
+    // State 1192 default action
+    { 1192, -1, PA_REDUCE, 795 },
+    // State 1193
+    { 1193, 112, PA_SHIFT, 1198 },
+    // State 1193
+    { 1193, 362, PA_SHIFT, 1199 },
+    // State 1193
+    { 1193, 860, PA_SHIFT, 1544 },
+    // State 1193
+    { 1193, 1110, PA_SHIFT, 1194 },
+    // State 1194
+    { 1194, 250, PA_SHIFT, 1196 },
+    // State 1194
+    { 1194, 610, PA_SHIFT, 1195 },
+    // State 1195
+    { 1195, 1249, PA_REDUCE, 796 },
+    // State 1195 default action
+    { 1195, -1, PA_REDUCE, 796 },
+    // State 1196
+    { 1196, 112, PA_SHIFT, 1198 },
+    // State 1196
+    { 1196, 362, PA_SHIFT, 1199 },
+    // State 1196
+    { 1196, 860, PA_SHIFT, 1197 },
+    // State 1197
+    { 1197, 1249, PA_REDUCE, 797 },
+    // State 1197 default action
+    { 1197, -1, PA_REDUCE, 797 },
+    // State 1198
+    { 1198, 1249, PA_REDUCE, 799 },
+    // State 1198 default action
+    { 1198, -1, PA_REDUCE, 799 },
+    // State 1199
+    { 1199, 115, PA_SHIFT, 1204 },
+    // State 1199
+    { 1199, 365, PA_SHIFT, 1205 },
+    // State 1199
+    { 1199, 863, PA_SHIFT, 1543 },
+    // State 1199
+    { 1199, 1113, PA_SHIFT, 1200 },
+    // State 1200
+    { 1200, 250, PA_SHIFT, 1202 },
+    // State 1200
+    { 1200, 611, PA_SHIFT, 1201 },
+    // State 1201
+    { 1201, 1249, PA_REDUCE, 800 },
+    // State 1201 default action
+    { 1201, -1, PA_REDUCE, 800 },
+    // State 1202
+    { 1202, 115, PA_SHIFT, 1204 },
+    // State 1202
+    { 1202, 365, PA_SHIFT, 1205 },
+    // State 1202
+    { 1202, 863, PA_SHIFT, 1203 },
+    // State 1203
+    { 1203, 1249, PA_REDUCE, 801 },
+    // State 1203 default action
+    { 1203, -1, PA_REDUCE, 801 },
+    // State 1204
+    { 1204, 1249, PA_REDUCE, 803 },
+    // State 1204 default action
+    { 1204, -1, PA_REDUCE, 803 },
+    // State 1205
+    { 1205, 116, PA_SHIFT, 1210 },
+    // State 1205
+    { 1205, 366, PA_SHIFT, 1211 },
+    // State 1205
+    { 1205, 864, PA_SHIFT, 1542 },
+    // State 1205
+    { 1205, 1114, PA_SHIFT, 1206 },
+    // State 1206
+    { 1206, 250, PA_SHIFT, 1208 },
+    // State 1206
+    { 1206, 614, PA_SHIFT, 1207 },
+    // State 1207
+    { 1207, 1249, PA_REDUCE, 804 },
+    // State 1207 default action
+    { 1207, -1, PA_REDUCE, 804 },
+    // State 1208
+    { 1208, 116, PA_SHIFT, 1210 },
+    // State 1208
+    { 1208, 366, PA_SHIFT, 1211 },
+    // State 1208
+    { 1208, 864, PA_SHIFT, 1209 },
+    // State 1209
+    { 1209, 1249, PA_REDUCE, 805 },
+    // State 1209 default action
+    { 1209, -1, PA_REDUCE, 805 },
+    // State 1210
+    { 1210, 1249, PA_REDUCE, 807 },
+    // State 1210 default action
+    { 1210, -1, PA_REDUCE, 807 },
+    // State 1211
+    { 1211, 117, PA_SHIFT, 1216 },
+    // State 1211
+    { 1211, 367, PA_SHIFT, 1217 },
+    // State 1211
+    { 1211, 865, PA_SHIFT, 1541 },
+    // State 1211
+    { 1211, 1115, PA_SHIFT, 1212 },
+    // State 1212
+    { 1212, 250, PA_SHIFT, 1214 },
+    // State 1212
+    { 1212, 615, PA_SHIFT, 1213 },
+    // State 1213
+    { 1213, 1249, PA_REDUCE, 808 },
+    // State 1213 default action
+    { 1213, -1, PA_REDUCE, 808 },
+    // State 1214
+    { 1214, 117, PA_SHIFT, 1216 },
+    // State 1214
+    { 1214, 367, PA_SHIFT, 1217 },
+    // State 1214
+    { 1214, 865, PA_SHIFT, 1215 },
+    // State 1215
+    { 1215, 1249, PA_REDUCE, 809 },
+    // State 1215 default action
+    { 1215, -1, PA_REDUCE, 809 },
+    // State 1216
+    { 1216, 1249, PA_REDUCE, 811 },
+    // State 1216 default action
+    { 1216, -1, PA_REDUCE, 811 },
+    // State 1217
+    { 1217, 118, PA_SHIFT, 1222 },
+    // State 1217
+    { 1217, 368, PA_SHIFT, 1223 },
+    // State 1217
+    { 1217, 866, PA_SHIFT, 1540 },
+    // State 1217
+    { 1217, 1116, PA_SHIFT, 1218 },
+    // State 1218
+    { 1218, 250, PA_SHIFT, 1220 },
+    // State 1218
+    { 1218, 616, PA_SHIFT, 1219 },
+    // State 1219
+    { 1219, 1249, PA_REDUCE, 812 },
+    // State 1219 default action
+    { 1219, -1, PA_REDUCE, 812 },
+    // State 1220
+    { 1220, 118, PA_SHIFT, 1222 },
+    // State 1220
+    { 1220, 368, PA_SHIFT, 1223 },
+    // State 1220
+    { 1220, 866, PA_SHIFT, 1221 },
+    // State 1221
+    { 1221, 1249, PA_REDUCE, 813 },
+    // State 1221 default action
+    { 1221, -1, PA_REDUCE, 813 },
+    // State 1222
+    { 1222, 1249, PA_REDUCE, 815 },
+    // State 1222 default action
+    { 1222, -1, PA_REDUCE, 815 },
+    // State 1223
+    { 1223, 119, PA_SHIFT, 1228 },
+    // State 1223
+    { 1223, 369, PA_SHIFT, 1229 },
+    // State 1223
+    { 1223, 867, PA_SHIFT, 1539 },
+    // State 1223
+    { 1223, 1117, PA_SHIFT, 1224 },
+    // State 1224
+    { 1224, 250, PA_SHIFT, 1226 },
+    // State 1224
+    { 1224, 617, PA_SHIFT, 1225 },
+    // State 1225
+    { 1225, 1249, PA_REDUCE, 816 },
+    // State 1225 default action
+    { 1225, -1, PA_REDUCE, 816 },
+    // State 1226
+    { 1226, 119, PA_SHIFT, 1228 },
+    // State 1226
+    { 1226, 369, PA_SHIFT, 1229 },
+    // State 1226
+    { 1226, 867, PA_SHIFT, 1227 },
+    // State 1227
+    { 1227, 1249, PA_REDUCE, 817 },
+    // State 1227 default action
+    { 1227, -1, PA_REDUCE, 817 },
+    // State 1228
+    { 1228, 1249, PA_REDUCE, 819 },
+    // State 1228 default action
+    { 1228, -1, PA_REDUCE, 819 },
+    // State 1229
+    { 1229, 120, PA_SHIFT, 1234 },
+    // State 1229
+    { 1229, 370, PA_SHIFT, 1235 },
+    // State 1229
+    { 1229, 868, PA_SHIFT, 1538 },
+    // State 1229
+    { 1229, 1118, PA_SHIFT, 1230 },
+    // State 1230
+    { 1230, 250, PA_SHIFT, 1232 },
+    // State 1230
+    { 1230, 618, PA_SHIFT, 1231 },
+    // State 1231
+    { 1231, 1249, PA_REDUCE, 820 },
+    // State 1231 default action
+    { 1231, -1, PA_REDUCE, 820 },
+    // State 1232
+    { 1232, 120, PA_SHIFT, 1234 },
+    // State 1232
+    { 1232, 370, PA_SHIFT, 1235 },
+    // State 1232
+    { 1232, 868, PA_SHIFT, 1233 },
+    // State 1233
+    { 1233, 1249, PA_REDUCE, 821 },
+    // State 1233 default action
+    { 1233, -1, PA_REDUCE, 821 },
+    // State 1234
+    { 1234, 1249, PA_REDUCE, 823 },
+    // State 1234 default action
+    { 1234, -1, PA_REDUCE, 823 },
+    // State 1235
+    { 1235, 121, PA_SHIFT, 1240 },
+    // State 1235
+    { 1235, 371, PA_SHIFT, 1241 },
+    // State 1235
+    { 1235, 869, PA_SHIFT, 1537 },
+    // State 1235
+    { 1235, 1119, PA_SHIFT, 1236 },
+    // State 1236
+    { 1236, 250, PA_SHIFT, 1238 },
+    // State 1236
+    { 1236, 619, PA_SHIFT, 1237 },
+    // State 1237
+    { 1237, 1249, PA_REDUCE, 824 },
+    // State 1237 default action
+    { 1237, -1, PA_REDUCE, 824 },
+    // State 1238
+    { 1238, 121, PA_SHIFT, 1240 },
+    // State 1238
+    { 1238, 371, PA_SHIFT, 1241 },
+    // State 1238
+    { 1238, 869, PA_SHIFT, 1239 },
+    // State 1239
+    { 1239, 1249, PA_REDUCE, 825 },
+    // State 1239 default action
+    { 1239, -1, PA_REDUCE, 825 },
+    // State 1240
+    { 1240, 1249, PA_REDUCE, 827 },
+    // State 1240 default action
+    { 1240, -1, PA_REDUCE, 827 },
+    // State 1241
+    { 1241, 122, PA_SHIFT, 1246 },
+    // State 1241
+    { 1241, 372, PA_SHIFT, 1247 },
+    // State 1241
+    { 1241, 870, PA_SHIFT, 1536 },
+    // State 1241
+    { 1241, 1120, PA_SHIFT, 1242 },
+    // State 1242
+    { 1242, 250, PA_SHIFT, 1244 },
+    // State 1242
+    { 1242, 620, PA_SHIFT, 1243 },
+    // State 1243
+    { 1243, 1249, PA_REDUCE, 828 },
+    // State 1243 default action
+    { 1243, -1, PA_REDUCE, 828 },
+    // State 1244
+    { 1244, 122, PA_SHIFT, 1246 },
+    // State 1244
+    { 1244, 372, PA_SHIFT, 1247 },
+    // State 1244
+    { 1244, 870, PA_SHIFT, 1245 },
+    // State 1245
+    { 1245, 1249, PA_REDUCE, 829 },
+    // State 1245 default action
+    { 1245, -1, PA_REDUCE, 829 },
+    // State 1246
+    { 1246, 1249, PA_REDUCE, 831 },
+    // State 1246 default action
+    { 1246, -1, PA_REDUCE, 831 },
+    // State 1247
+    { 1247, 123, PA_SHIFT, 1252 },
+    // State 1247
+    { 1247, 373, PA_SHIFT, 1253 },
+    // State 1247
+    { 1247, 871, PA_SHIFT, 1535 },
+    // State 1247
+    { 1247, 1121, PA_SHIFT, 1248 },
+    // State 1248
+    { 1248, 250, PA_SHIFT, 1250 },
+    // State 1248
+    { 1248, 621, PA_SHIFT, 1249 },
+    // State 1249
+    { 1249, 1249, PA_REDUCE, 832 },
+    // State 1249 default action
+    { 1249, -1, PA_REDUCE, 832 },
+    // State 1250
+    { 1250, 123, PA_SHIFT, 1252 },
+    // State 1250
+    { 1250, 373, PA_SHIFT, 1253 },
+    // State 1250
+    { 1250, 871, PA_SHIFT, 1251 },
+    // State 1251
+    { 1251, 1249, PA_REDUCE, 833 },
+    // State 1251 default action
+    { 1251, -1, PA_REDUCE, 833 },
+    // State 1252
+    { 1252, 1249, PA_REDUCE, 835 },
+    // State 1252 default action
+    { 1252, -1, PA_REDUCE, 835 },
+    // State 1253
+    { 1253, 124, PA_SHIFT, 1258 },
+    // State 1253
+    { 1253, 374, PA_SHIFT, 1259 },
+    // State 1253
+    { 1253, 872, PA_SHIFT, 1534 },
+    // State 1253
+    { 1253, 1122, PA_SHIFT, 1254 },
+    // State 1254
+    { 1254, 250, PA_SHIFT, 1256 },
+    // State 1254
+    { 1254, 622, PA_SHIFT, 1255 },
+    // State 1255
+    { 1255, 1249, PA_REDUCE, 836 },
+    // State 1255 default action
+    { 1255, -1, PA_REDUCE, 836 },
+    // State 1256
+    { 1256, 124, PA_SHIFT, 1258 },
+    // State 1256
+    { 1256, 374, PA_SHIFT, 1259 },
+    // State 1256
+    { 1256, 872, PA_SHIFT, 1257 },
+    // State 1257
+    { 1257, 1249, PA_REDUCE, 837 },
+    // State 1257 default action
+    { 1257, -1, PA_REDUCE, 837 },
+    // State 1258
+    { 1258, 1249, PA_REDUCE, 839 },
+    // State 1258 default action
+    { 1258, -1, PA_REDUCE, 839 },
+    // State 1259
+    { 1259, 126, PA_SHIFT, 1264 },
+    // State 1259
+    { 1259, 376, PA_SHIFT, 1265 },
+    // State 1259
+    { 1259, 874, PA_SHIFT, 1533 },
+    // State 1259
+    { 1259, 1124, PA_SHIFT, 1260 },
+    // State 1260
+    { 1260, 250, PA_SHIFT, 1262 },
+    // State 1260
+    { 1260, 623, PA_SHIFT, 1261 },
+    // State 1261
+    { 1261, 1249, PA_REDUCE, 840 },
+    // State 1261 default action
+    { 1261, -1, PA_REDUCE, 840 },
+    // State 1262
+    { 1262, 126, PA_SHIFT, 1264 },
+    // State 1262
+    { 1262, 376, PA_SHIFT, 1265 },
+    // State 1262
+    { 1262, 874, PA_SHIFT, 1263 },
+    // State 1263
+    { 1263, 1249, PA_REDUCE, 841 },
+    // State 1263 default action
+    { 1263, -1, PA_REDUCE, 841 },
+    // State 1264
+    { 1264, 1249, PA_REDUCE, 843 },
+    // State 1264 default action
+    { 1264, -1, PA_REDUCE, 843 },
+    // State 1265
+    { 1265, 127, PA_SHIFT, 1270 },
+    // State 1265
+    { 1265, 377, PA_SHIFT, 1271 },
+    // State 1265
+    { 1265, 875, PA_SHIFT, 1532 },
+    // State 1265
+    { 1265, 1125, PA_SHIFT, 1266 },
+    // State 1266
+    { 1266, 250, PA_SHIFT, 1268 },
+    // State 1266
+    { 1266, 625, PA_SHIFT, 1267 },
+    // State 1267
+    { 1267, 1249, PA_REDUCE, 844 },
+    // State 1267 default action
+    { 1267, -1, PA_REDUCE, 844 },
+    // State 1268
+    { 1268, 127, PA_SHIFT, 1270 },
+    // State 1268
+    { 1268, 377, PA_SHIFT, 1271 },
+    // State 1268
+    { 1268, 875, PA_SHIFT, 1269 },
+    // State 1269
+    { 1269, 1249, PA_REDUCE, 845 },
+    // State 1269 default action
+    { 1269, -1, PA_REDUCE, 845 },
+    // State 1270
+    { 1270, 1249, PA_REDUCE, 847 },
+    // State 1270 default action
+    { 1270, -1, PA_REDUCE, 847 },
+    // State 1271
+    { 1271, 128, PA_SHIFT, 1276 },
+    // State 1271
+    { 1271, 378, PA_SHIFT, 1277 },
+    // State 1271
+    { 1271, 876, PA_SHIFT, 1531 },
+    // State 1271
+    { 1271, 1126, PA_SHIFT, 1272 },
+    // State 1272
+    { 1272, 250, PA_SHIFT, 1274 },
+    // State 1272
+    { 1272, 626, PA_SHIFT, 1273 },
+    // State 1273
+    { 1273, 1249, PA_REDUCE, 848 },
+    // State 1273 default action
+    { 1273, -1, PA_REDUCE, 848 },
+    // State 1274
+    { 1274, 128, PA_SHIFT, 1276 },
+    // State 1274
+    { 1274, 378, PA_SHIFT, 1277 },
+    // State 1274
+    { 1274, 876, PA_SHIFT, 1275 },
+    // State 1275
+    { 1275, 1249, PA_REDUCE, 849 },
+    // State 1275 default action
+    { 1275, -1, PA_REDUCE, 849 },
+    // State 1276
+    { 1276, 1249, PA_REDUCE, 851 },
+    // State 1276 default action
+    { 1276, -1, PA_REDUCE, 851 },
+    // State 1277
+    { 1277, 129, PA_SHIFT, 1282 },
+    // State 1277
+    { 1277, 379, PA_SHIFT, 1283 },
+    // State 1277
+    { 1277, 877, PA_SHIFT, 1530 },
+    // State 1277
+    { 1277, 1127, PA_SHIFT, 1278 },
+    // State 1278
+    { 1278, 250, PA_SHIFT, 1280 },
+    // State 1278
+    { 1278, 627, PA_SHIFT, 1279 },
+    // State 1279
+    { 1279, 1249, PA_REDUCE, 852 },
+    // State 1279 default action
+    { 1279, -1, PA_REDUCE, 852 },
+    // State 1280
+    { 1280, 129, PA_SHIFT, 1282 },
+    // State 1280
+    { 1280, 379, PA_SHIFT, 1283 },
+    // State 1280
+    { 1280, 877, PA_SHIFT, 1281 },
+    // State 1281
+    { 1281, 1249, PA_REDUCE, 853 },
+    // State 1281 default action
+    { 1281, -1, PA_REDUCE, 853 },
+    // State 1282
+    { 1282, 1249, PA_REDUCE, 855 },
+    // State 1282 default action
+    { 1282, -1, PA_REDUCE, 855 },
+    // State 1283
+    { 1283, 130, PA_SHIFT, 1288 },
+    // State 1283
+    { 1283, 380, PA_SHIFT, 1289 },
+    // State 1283
+    { 1283, 878, PA_SHIFT, 1529 },
+    // State 1283
+    { 1283, 1128, PA_SHIFT, 1284 },
+    // State 1284
+    { 1284, 250, PA_SHIFT, 1286 },
+    // State 1284
+    { 1284, 628, PA_SHIFT, 1285 },
+    // State 1285
+    { 1285, 1249, PA_REDUCE, 856 },
+    // State 1285 default action
+    { 1285, -1, PA_REDUCE, 856 },
+    // State 1286
+    { 1286, 130, PA_SHIFT, 1288 },
+    // State 1286
+    { 1286, 380, PA_SHIFT, 1289 },
+    // State 1286
+    { 1286, 878, PA_SHIFT, 1287 },
+    // State 1287
+    { 1287, 1249, PA_REDUCE, 857 },
+    // State 1287 default action
+    { 1287, -1, PA_REDUCE, 857 },
+    // State 1288
+    { 1288, 1249, PA_REDUCE, 859 },
+    // State 1288 default action
+    { 1288, -1, PA_REDUCE, 859 },
+    // State 1289
+    { 1289, 131, PA_SHIFT, 1294 },
+    // State 1289
+    { 1289, 381, PA_SHIFT, 1295 },
+    // State 1289
+    { 1289, 879, PA_SHIFT, 1528 },
+    // State 1289
+    { 1289, 1129, PA_SHIFT, 1290 },
+    // State 1290
+    { 1290, 250, PA_SHIFT, 1292 },
+    // State 1290
+    { 1290, 629, PA_SHIFT, 1291 },
+    // State 1291
+    { 1291, 1249, PA_REDUCE, 860 },
+    // State 1291 default action
+    { 1291, -1, PA_REDUCE, 860 },
+    // State 1292
+    { 1292, 131, PA_SHIFT, 1294 },
+    // State 1292
+    { 1292, 381, PA_SHIFT, 1295 },
+    // State 1292
+    { 1292, 879, PA_SHIFT, 1293 },
+    // State 1293
+    { 1293, 1249, PA_REDUCE, 861 },
+    // State 1293 default action
+    { 1293, -1, PA_REDUCE, 861 },
+    // State 1294
+    { 1294, 1249, PA_REDUCE, 863 },
+    // State 1294 default action
+    { 1294, -1, PA_REDUCE, 863 },
+    // State 1295
+    { 1295, 132, PA_SHIFT, 1300 },
+    // State 1295
+    { 1295, 382, PA_SHIFT, 1301 },
+    // State 1295
+    { 1295, 880, PA_SHIFT, 1527 },
+    // State 1295
+    { 1295, 1130, PA_SHIFT, 1296 },
+    // State 1296
+    { 1296, 250, PA_SHIFT, 1298 },
+    // State 1296
+    { 1296, 630, PA_SHIFT, 1297 },
+    // State 1297
+    { 1297, 1249, PA_REDUCE, 864 },
+    // State 1297 default action
+    { 1297, -1, PA_REDUCE, 864 },
+    // State 1298
+    { 1298, 132, PA_SHIFT, 1300 },
+    // State 1298
+    { 1298, 382, PA_SHIFT, 1301 },
+    // State 1298
+    { 1298, 880, PA_SHIFT, 1299 },
+    // State 1299
+    { 1299, 1249, PA_REDUCE, 865 },
+    // State 1299 default action
+    { 1299, -1, PA_REDUCE, 865 },
+    // State 1300
+    { 1300, 1249, PA_REDUCE, 867 },
+    // State 1300 default action
+    { 1300, -1, PA_REDUCE, 867 },
+    // State 1301
+    { 1301, 133, PA_SHIFT, 1306 },
+    // State 1301
+    { 1301, 383, PA_SHIFT, 1307 },
+    // State 1301
+    { 1301, 881, PA_SHIFT, 1526 },
+    // State 1301
+    { 1301, 1131, PA_SHIFT, 1302 },
+    // State 1302
+    { 1302, 250, PA_SHIFT, 1304 },
+    // State 1302
+    { 1302, 631, PA_SHIFT, 1303 },
+    // State 1303
+    { 1303, 1249, PA_REDUCE, 868 },
+    // State 1303 default action
+    { 1303, -1, PA_REDUCE, 868 },
+    // State 1304
+    { 1304, 133, PA_SHIFT, 1306 },
+    // State 1304
+    { 1304, 383, PA_SHIFT, 1307 },
+    // State 1304
+    { 1304, 881, PA_SHIFT, 1305 },
+    // State 1305
+    { 1305, 1249, PA_REDUCE, 869 },
+    // State 1305 default action
+    { 1305, -1, PA_REDUCE, 869 },
+    // State 1306
+    { 1306, 1249, PA_REDUCE, 871 },
+    // State 1306 default action
+    { 1306, -1, PA_REDUCE, 871 },
+    // State 1307
+    { 1307, 134, PA_SHIFT, 1312 },
+    // State 1307
+    { 1307, 384, PA_SHIFT, 1313 },
+    // State 1307
+    { 1307, 882, PA_SHIFT, 1525 },
+    // State 1307
+    { 1307, 1132, PA_SHIFT, 1308 },
+    // State 1308
+    { 1308, 250, PA_SHIFT, 1310 },
+    // State 1308
+    { 1308, 632, PA_SHIFT, 1309 },
+    // State 1309
+    { 1309, 1249, PA_REDUCE, 872 },
+    // State 1309 default action
+    { 1309, -1, PA_REDUCE, 872 },
+    // State 1310
+    { 1310, 134, PA_SHIFT, 1312 },
+    // State 1310
+    { 1310, 384, PA_SHIFT, 1313 },
+    // State 1310
+    { 1310, 882, PA_SHIFT, 1311 },
+    // State 1311
+    { 1311, 1249, PA_REDUCE, 873 },
+    // State 1311 default action
+    { 1311, -1, PA_REDUCE, 873 },
+    // State 1312
+    { 1312, 1249, PA_REDUCE, 875 },
+    // State 1312 default action
+    { 1312, -1, PA_REDUCE, 875 },
+    // State 1313
+    { 1313, 135, PA_SHIFT, 1318 },
+    // State 1313
+    { 1313, 385, PA_SHIFT, 1319 },
+    // State 1313
+    { 1313, 883, PA_SHIFT, 1524 },
+    // State 1313
+    { 1313, 1133, PA_SHIFT, 1314 },
+    // State 1314
+    { 1314, 250, PA_SHIFT, 1316 },
+    // State 1314
+    { 1314, 633, PA_SHIFT, 1315 },
+    // State 1315
+    { 1315, 1249, PA_REDUCE, 876 },
+    // State 1315 default action
+    { 1315, -1, PA_REDUCE, 876 },
+    // State 1316
+    { 1316, 135, PA_SHIFT, 1318 },
+    // State 1316
+    { 1316, 385, PA_SHIFT, 1319 },
+    // State 1316
+    { 1316, 883, PA_SHIFT, 1317 },
+    // State 1317
+    { 1317, 1249, PA_REDUCE, 877 },
+    // State 1317 default action
+    { 1317, -1, PA_REDUCE, 877 },
+    // State 1318
+    { 1318, 1249, PA_REDUCE, 879 },
+    // State 1318 default action
+    { 1318, -1, PA_REDUCE, 879 },
+    // State 1319
+    { 1319, 137, PA_SHIFT, 1324 },
+    // State 1319
+    { 1319, 387, PA_SHIFT, 1325 },
+    // State 1319
+    { 1319, 885, PA_SHIFT, 1523 },
+    // State 1319
+    { 1319, 1135, PA_SHIFT, 1320 },
+    // State 1320
+    { 1320, 250, PA_SHIFT, 1322 },
+    // State 1320
+    { 1320, 634, PA_SHIFT, 1321 },
+    // State 1321
+    { 1321, 1249, PA_REDUCE, 880 },
+    // State 1321 default action
+    { 1321, -1, PA_REDUCE, 880 },
+    // State 1322
+    { 1322, 137, PA_SHIFT, 1324 },
+    // State 1322
+    { 1322, 387, PA_SHIFT, 1325 },
+    // State 1322
+    { 1322, 885, PA_SHIFT, 1323 },
+    // State 1323
+    { 1323, 1249, PA_REDUCE, 881 },
+    // State 1323 default action
+    { 1323, -1, PA_REDUCE, 881 },
+    // State 1324
+    { 1324, 1249, PA_REDUCE, 883 },
+    // State 1324 default action
+    { 1324, -1, PA_REDUCE, 883 },
+    // State 1325
+    { 1325, 138, PA_SHIFT, 1330 },
+    // State 1325
+    { 1325, 388, PA_SHIFT, 1331 },
+    // State 1325
+    { 1325, 886, PA_SHIFT, 1522 },
+    // State 1325
+    { 1325, 1136, PA_SHIFT, 1326 },
+    // State 1326
+    { 1326, 250, PA_SHIFT, 1328 },
+    // State 1326
+    { 1326, 636, PA_SHIFT, 1327 },
+    // State 1327
+    { 1327, 1249, PA_REDUCE, 884 },
+    // State 1327 default action
+    { 1327, -1, PA_REDUCE, 884 },
+    // State 1328
+    { 1328, 138, PA_SHIFT, 1330 },
+    // State 1328
+    { 1328, 388, PA_SHIFT, 1331 },
+    // State 1328
+    { 1328, 886, PA_SHIFT, 1329 },
+    // State 1329
+    { 1329, 1249, PA_REDUCE, 885 },
+    // State 1329 default action
+    { 1329, -1, PA_REDUCE, 885 },
+    // State 1330
+    { 1330, 1249, PA_REDUCE, 887 },
+    // State 1330 default action
+    { 1330, -1, PA_REDUCE, 887 },
+    // State 1331
+    { 1331, 139, PA_SHIFT, 1336 },
+    // State 1331
+    { 1331, 389, PA_SHIFT, 1337 },
+    // State 1331
+    { 1331, 887, PA_SHIFT, 1521 },
+    // State 1331
+    { 1331, 1137, PA_SHIFT, 1332 },
+    // State 1332
+    { 1332, 250, PA_SHIFT, 1334 },
+    // State 1332
+    { 1332, 637, PA_SHIFT, 1333 },
+    // State 1333
+    { 1333, 1249, PA_REDUCE, 888 },
+    // State 1333 default action
+    { 1333, -1, PA_REDUCE, 888 },
+    // State 1334
+    { 1334, 139, PA_SHIFT, 1336 },
+    // State 1334
+    { 1334, 389, PA_SHIFT, 1337 },
+    // State 1334
+    { 1334, 887, PA_SHIFT, 1335 },
+    // State 1335
+    { 1335, 1249, PA_REDUCE, 889 },
+    // State 1335 default action
+    { 1335, -1, PA_REDUCE, 889 },
+    // State 1336
+    { 1336, 1249, PA_REDUCE, 891 },
+    // State 1336 default action
+    { 1336, -1, PA_REDUCE, 891 },
+    // State 1337
+    { 1337, 140, PA_SHIFT, 1342 },
+    // State 1337
+    { 1337, 390, PA_SHIFT, 1343 },
+    // State 1337
+    { 1337, 888, PA_SHIFT, 1520 },
+    // State 1337
+    { 1337, 1138, PA_SHIFT, 1338 },
+    // State 1338
+    { 1338, 250, PA_SHIFT, 1340 },
+    // State 1338
+    { 1338, 638, PA_SHIFT, 1339 },
+    // State 1339
+    { 1339, 1249, PA_REDUCE, 892 },
+    // State 1339 default action
+    { 1339, -1, PA_REDUCE, 892 },
+    // State 1340
+    { 1340, 140, PA_SHIFT, 1342 },
+    // State 1340
+    { 1340, 390, PA_SHIFT, 1343 },
+    // State 1340
+    { 1340, 888, PA_SHIFT, 1341 },
+    // State 1341
+    { 1341, 1249, PA_REDUCE, 893 },
+    // State 1341 default action
+    { 1341, -1, PA_REDUCE, 893 },
+    // State 1342
+    { 1342, 1249, PA_REDUCE, 895 },
+    // State 1342 default action
+    { 1342, -1, PA_REDUCE, 895 },
+    // State 1343
+    { 1343, 141, PA_SHIFT, 1348 },
+    // State 1343
+    { 1343, 391, PA_SHIFT, 1349 },
+    // State 1343
+    { 1343, 889, PA_SHIFT, 1519 },
+    // State 1343
+    { 1343, 1139, PA_SHIFT, 1344 },
+    // State 1344
+    { 1344, 250, PA_SHIFT, 1346 },
+    // State 1344
+    { 1344, 639, PA_SHIFT, 1345 },
+    // State 1345
+    { 1345, 1249, PA_REDUCE, 896 },
+    // State 1345 default action
+    { 1345, -1, PA_REDUCE, 896 },
+    // State 1346
+    { 1346, 141, PA_SHIFT, 1348 },
+    // State 1346
+    { 1346, 391, PA_SHIFT, 1349 },
+    // State 1346
+    { 1346, 889, PA_SHIFT, 1347 },
+    // State 1347
+    { 1347, 1249, PA_REDUCE, 897 },
+    // State 1347 default action
+    { 1347, -1, PA_REDUCE, 897 },
+    // State 1348
+    { 1348, 1249, PA_REDUCE, 899 },
+    // State 1348 default action
+    { 1348, -1, PA_REDUCE, 899 },
+    // State 1349
+    { 1349, 142, PA_SHIFT, 1354 },
+    // State 1349
+    { 1349, 392, PA_SHIFT, 1355 },
+    // State 1349
+    { 1349, 890, PA_SHIFT, 1518 },
+    // State 1349
+    { 1349, 1140, PA_SHIFT, 1350 },
+    // State 1350
+    { 1350, 250, PA_SHIFT, 1352 },
+    // State 1350
+    { 1350, 640, PA_SHIFT, 1351 },
+    // State 1351
+    { 1351, 1249, PA_REDUCE, 900 },
+    // State 1351 default action
+    { 1351, -1, PA_REDUCE, 900 },
+    // State 1352
+    { 1352, 142, PA_SHIFT, 1354 },
+    // State 1352
+    { 1352, 392, PA_SHIFT, 1355 },
+    // State 1352
+    { 1352, 890, PA_SHIFT, 1353 },
+    // State 1353
+    { 1353, 1249, PA_REDUCE, 901 },
+    // State 1353 default action
+    { 1353, -1, PA_REDUCE, 901 },
+    // State 1354
+    { 1354, 1249, PA_REDUCE, 903 },
+    // State 1354 default action
+    { 1354, -1, PA_REDUCE, 903 },
+    // State 1355
+    { 1355, 143, PA_SHIFT, 1360 },
+    // State 1355
+    { 1355, 393, PA_SHIFT, 1361 },
+    // State 1355
+    { 1355, 891, PA_SHIFT, 1517 },
+    // State 1355
+    { 1355, 1141, PA_SHIFT, 1356 },
+    // State 1356
+    { 1356, 250, PA_SHIFT, 1358 },
+    // State 1356
+    { 1356, 641, PA_SHIFT, 1357 },
+    // State 1357
+    { 1357, 1249, PA_REDUCE, 904 },
+    // State 1357 default action
+    { 1357, -1, PA_REDUCE, 904 },
+    // State 1358
+    { 1358, 143, PA_SHIFT, 1360 },
+    // State 1358
+    { 1358, 393, PA_SHIFT, 1361 },
+    // State 1358
+    { 1358, 891, PA_SHIFT, 1359 },
+    // State 1359
+    { 1359, 1249, PA_REDUCE, 905 },
+    // State 1359 default action
+    { 1359, -1, PA_REDUCE, 905 },
+    // State 1360
+    { 1360, 1249, PA_REDUCE, 907 },
+    // State 1360 default action
+    { 1360, -1, PA_REDUCE, 907 },
+    // State 1361
+    { 1361, 144, PA_SHIFT, 1366 },
+    // State 1361
+    { 1361, 394, PA_SHIFT, 1367 },
+    // State 1361
+    { 1361, 892, PA_SHIFT, 1516 },
+    // State 1361
+    { 1361, 1142, PA_SHIFT, 1362 },
+    // State 1362
+    { 1362, 250, PA_SHIFT, 1364 },
+    // State 1362
+    { 1362, 642, PA_SHIFT, 1363 },
+    // State 1363
+    { 1363, 1249, PA_REDUCE, 908 },
+    // State 1363 default action
+    { 1363, -1, PA_REDUCE, 908 },
+    // State 1364
+    { 1364, 144, PA_SHIFT, 1366 },
+    // State 1364
+    { 1364, 394, PA_SHIFT, 1367 },
+    // State 1364
+    { 1364, 892, PA_SHIFT, 1365 },
+    // State 1365
+    { 1365, 1249, PA_REDUCE, 909 },
+    // State 1365 default action
+    { 1365, -1, PA_REDUCE, 909 },
+    // State 1366
+    { 1366, 1249, PA_REDUCE, 911 },
+    // State 1366 default action
+    { 1366, -1, PA_REDUCE, 911 },
+    // State 1367
+    { 1367, 145, PA_SHIFT, 1372 },
+    // State 1367
+    { 1367, 395, PA_SHIFT, 1373 },
+    // State 1367
+    { 1367, 893, PA_SHIFT, 1515 },
+    // State 1367
+    { 1367, 1143, PA_SHIFT, 1368 },
+    // State 1368
+    { 1368, 250, PA_SHIFT, 1370 },
+    // State 1368
+    { 1368, 643, PA_SHIFT, 1369 },
+    // State 1369
+    { 1369, 1249, PA_REDUCE, 912 },
+    // State 1369 default action
+    { 1369, -1, PA_REDUCE, 912 },
+    // State 1370
+    { 1370, 145, PA_SHIFT, 1372 },
+    // State 1370
+    { 1370, 395, PA_SHIFT, 1373 },
+    // State 1370
+    { 1370, 893, PA_SHIFT, 1371 },
+    // State 1371
+    { 1371, 1249, PA_REDUCE, 913 },
+    // State 1371 default action
+    { 1371, -1, PA_REDUCE, 913 },
+    // State 1372
+    { 1372, 1249, PA_REDUCE, 915 },
+    // State 1372 default action
+    { 1372, -1, PA_REDUCE, 915 },
+    // State 1373
+    { 1373, 146, PA_SHIFT, 1378 },
+    // State 1373
+    { 1373, 396, PA_SHIFT, 1379 },
+    // State 1373
+    { 1373, 894, PA_SHIFT, 1514 },
+    // State 1373
+    { 1373, 1144, PA_SHIFT, 1374 },
+    // State 1374
+    { 1374, 250, PA_SHIFT, 1376 },
+    // State 1374
+    { 1374, 644, PA_SHIFT, 1375 },
+    // State 1375
+    { 1375, 1249, PA_REDUCE, 916 },
+    // State 1375 default action
+    { 1375, -1, PA_REDUCE, 916 },
+    // State 1376
+    { 1376, 146, PA_SHIFT, 1378 },
+    // State 1376
+    { 1376, 396, PA_SHIFT, 1379 },
+    // State 1376
+    { 1376, 894, PA_SHIFT, 1377 },
+    // State 1377
+    { 1377, 1249, PA_REDUCE, 917 },
+    // State 1377 default action
+    { 1377, -1, PA_REDUCE, 917 },
+    // State 1378
+    { 1378, 1249, PA_REDUCE, 919 },
+    // State 1378 default action
+    { 1378, -1, PA_REDUCE, 919 },
+    // State 1379
+    { 1379, 148, PA_SHIFT, 1384 },
+    // State 1379
+    { 1379, 398, PA_SHIFT, 1385 },
+    // State 1379
+    { 1379, 896, PA_SHIFT, 1513 },
+    // State 1379
+    { 1379, 1146, PA_SHIFT, 1380 },
+    // State 1380
+    { 1380, 250, PA_SHIFT, 1382 },
+    // State 1380
+    { 1380, 645, PA_SHIFT, 1381 },
+    // State 1381
+    { 1381, 1249, PA_REDUCE, 920 },
+    // State 1381 default action
+    { 1381, -1, PA_REDUCE, 920 },
+    // State 1382
+    { 1382, 148, PA_SHIFT, 1384 },
+    // State 1382
+    { 1382, 398, PA_SHIFT, 1385 },
+    // State 1382
+    { 1382, 896, PA_SHIFT, 1383 },
+    // State 1383
+    { 1383, 1249, PA_REDUCE, 921 },
+    // State 1383 default action
+    { 1383, -1, PA_REDUCE, 921 },
+    // State 1384
+    { 1384, 1249, PA_REDUCE, 923 },
+    // State 1384 default action
+    { 1384, -1, PA_REDUCE, 923 },
+    // State 1385
+    { 1385, 149, PA_SHIFT, 1390 },
+    // State 1385
+    { 1385, 399, PA_SHIFT, 1391 },
+    // State 1385
+    { 1385, 897, PA_SHIFT, 1512 },
+    // State 1385
+    { 1385, 1147, PA_SHIFT, 1386 },
+    // State 1386
+    { 1386, 250, PA_SHIFT, 1388 },
+    // State 1386
+    { 1386, 647, PA_SHIFT, 1387 },
+    // State 1387
+    { 1387, 1249, PA_REDUCE, 924 },
+    // State 1387 default action
+    { 1387, -1, PA_REDUCE, 924 },
+    // State 1388
+    { 1388, 149, PA_SHIFT, 1390 },
+    // State 1388
+    { 1388, 399, PA_SHIFT, 1391 },
+    // State 1388
+    { 1388, 897, PA_SHIFT, 1389 },
+    // State 1389
+    { 1389, 1249, PA_REDUCE, 925 },
+    // State 1389 default action
+    { 1389, -1, PA_REDUCE, 925 },
+    // State 1390
+    { 1390, 1249, PA_REDUCE, 927 },
+    // State 1390 default action
+    { 1390, -1, PA_REDUCE, 927 },
+    // State 1391
+    { 1391, 150, PA_SHIFT, 1396 },
+    // State 1391
+    { 1391, 400, PA_SHIFT, 1397 },
+    // State 1391
+    { 1391, 898, PA_SHIFT, 1511 },
+    // State 1391
+    { 1391, 1148, PA_SHIFT, 1392 },
+    // State 1392
+    { 1392, 250, PA_SHIFT, 1394 },
+    // State 1392
+    { 1392, 648, PA_SHIFT, 1393 },
+    // State 1393
+    { 1393, 1249, PA_REDUCE, 928 },
+    // State 1393 default action
+    { 1393, -1, PA_REDUCE, 928 },
+    // State 1394
+    { 1394, 150, PA_SHIFT, 1396 },
+    // State 1394
+    { 1394, 400, PA_SHIFT, 1397 },
+    // State 1394
+    { 1394, 898, PA_SHIFT, 1395 },
+    // State 1395
+    { 1395, 1249, PA_REDUCE, 929 },
+    // State 1395 default action
+    { 1395, -1, PA_REDUCE, 929 },
+    // State 1396
+    { 1396, 1249, PA_REDUCE, 931 },
+    // State 1396 default action
+    { 1396, -1, PA_REDUCE, 931 },
+    // State 1397
+    { 1397, 151, PA_SHIFT, 1402 },
+    // State 1397
+    { 1397, 401, PA_SHIFT, 1403 },
+    // State 1397
+    { 1397, 899, PA_SHIFT, 1510 },
+    // State 1397
+    { 1397, 1149, PA_SHIFT, 1398 },
+    // State 1398
+    { 1398, 250, PA_SHIFT, 1400 },
+    // State 1398
+    { 1398, 649, PA_SHIFT, 1399 },
+    // State 1399
+    { 1399, 1249, PA_REDUCE, 932 },
+    // State 1399 default action
+    { 1399, -1, PA_REDUCE, 932 },
+    // State 1400
+    { 1400, 151, PA_SHIFT, 1402 },
+    // State 1400
+    { 1400, 401, PA_SHIFT, 1403 },
+    // State 1400
+    { 1400, 899, PA_SHIFT, 1401 },
+    // State 1401
+    { 1401, 1249, PA_REDUCE, 933 },
+    // State 1401 default action
+    { 1401, -1, PA_REDUCE, 933 },
+    // State 1402
+    { 1402, 1249, PA_REDUCE, 935 },
+    // State 1402 default action
+    { 1402, -1, PA_REDUCE, 935 },
+    // State 1403
+    { 1403, 152, PA_SHIFT, 1408 },
+    // State 1403
+    { 1403, 402, PA_SHIFT, 1409 },
+    // State 1403
+    { 1403, 900, PA_SHIFT, 1509 },
+    // State 1403
+    { 1403, 1150, PA_SHIFT, 1404 },
+    // State 1404
+    { 1404, 250, PA_SHIFT, 1406 },
+    // State 1404
+    { 1404, 650, PA_SHIFT, 1405 },
+    // State 1405
+    { 1405, 1249, PA_REDUCE, 936 },
+    // State 1405 default action
+    { 1405, -1, PA_REDUCE, 936 },
+    // State 1406
+    { 1406, 152, PA_SHIFT, 1408 },
+    // State 1406
+    { 1406, 402, PA_SHIFT, 1409 },
+    // State 1406
+    { 1406, 900, PA_SHIFT, 1407 },
+    // State 1407
+    { 1407, 1249, PA_REDUCE, 937 },
+    // State 1407 default action
+    { 1407, -1, PA_REDUCE, 937 },
+    // State 1408
+    { 1408, 1249, PA_REDUCE, 939 },
+    // State 1408 default action
+    { 1408, -1, PA_REDUCE, 939 },
+    // State 1409
+    { 1409, 153, PA_SHIFT, 1414 },
+    // State 1409
+    { 1409, 403, PA_SHIFT, 1415 },
+    // State 1409
+    { 1409, 901, PA_SHIFT, 1508 },
+    // State 1409
+    { 1409, 1151, PA_SHIFT, 1410 },
+    // State 1410
+    { 1410, 250, PA_SHIFT, 1412 },
+    // State 1410
+    { 1410, 651, PA_SHIFT, 1411 },
+    // State 1411
+    { 1411, 1249, PA_REDUCE, 940 },
+    // State 1411 default action
+    { 1411, -1, PA_REDUCE, 940 },
+    // State 1412
+    { 1412, 153, PA_SHIFT, 1414 },
+    // State 1412
+    { 1412, 403, PA_SHIFT, 1415 },
+    // State 1412
+    { 1412, 901, PA_SHIFT, 1413 },
+    // State 1413
+    { 1413, 1249, PA_REDUCE, 941 },
+    // State 1413 default action
+    { 1413, -1, PA_REDUCE, 941 },
+    // State 1414
+    { 1414, 1249, PA_REDUCE, 943 },
+    // State 1414 default action
+    { 1414, -1, PA_REDUCE, 943 },
+    // State 1415
+    { 1415, 154, PA_SHIFT, 1420 },
+    // State 1415
+    { 1415, 404, PA_SHIFT, 1421 },
+    // State 1415
+    { 1415, 902, PA_SHIFT, 1507 },
+    // State 1415
+    { 1415, 1152, PA_SHIFT, 1416 },
+    // State 1416
+    { 1416, 250, PA_SHIFT, 1418 },
+    // State 1416
+    { 1416, 652, PA_SHIFT, 1417 },
+    // State 1417
+    { 1417, 1249, PA_REDUCE, 944 },
+    // State 1417 default action
+    { 1417, -1, PA_REDUCE, 944 },
+    // State 1418
+    { 1418, 154, PA_SHIFT, 1420 },
+    // State 1418
+    { 1418, 404, PA_SHIFT, 1421 },
+    // State 1418
+    { 1418, 902, PA_SHIFT, 1419 },
+    // State 1419
+    { 1419, 1249, PA_REDUCE, 945 },
+    // State 1419 default action
+    { 1419, -1, PA_REDUCE, 945 },
+    // State 1420
+    { 1420, 1249, PA_REDUCE, 947 },
+    // State 1420 default action
+    { 1420, -1, PA_REDUCE, 947 },
+    // State 1421
+    { 1421, 155, PA_SHIFT, 1426 },
+    // State 1421
+    { 1421, 405, PA_SHIFT, 1427 },
+    // State 1421
+    { 1421, 903, PA_SHIFT, 1506 },
+    // State 1421
+    { 1421, 1153, PA_SHIFT, 1422 },
+    // State 1422
+    { 1422, 250, PA_SHIFT, 1424 },
+    // State 1422
+    { 1422, 653, PA_SHIFT, 1423 },
+    // State 1423
+    { 1423, 1249, PA_REDUCE, 948 },
+    // State 1423 default action
+    { 1423, -1, PA_REDUCE, 948 },
+    // State 1424
+    { 1424, 155, PA_SHIFT, 1426 },
+    // State 1424
+    { 1424, 405, PA_SHIFT, 1427 },
+    // State 1424
+    { 1424, 903, PA_SHIFT, 1425 },
+    // State 1425
+    { 1425, 1249, PA_REDUCE, 949 },
+    // State 1425 default action
+    { 1425, -1, PA_REDUCE, 949 },
+    // State 1426
+    { 1426, 1249, PA_REDUCE, 951 },
+    // State 1426 default action
+    { 1426, -1, PA_REDUCE, 951 },
+    // State 1427
+    { 1427, 156, PA_SHIFT, 1432 },
+    // State 1427
+    { 1427, 406, PA_SHIFT, 1433 },
+    // State 1427
+    { 1427, 904, PA_SHIFT, 1505 },
+    // State 1427
+    { 1427, 1154, PA_SHIFT, 1428 },
+    // State 1428
+    { 1428, 250, PA_SHIFT, 1430 },
+    // State 1428
+    { 1428, 654, PA_SHIFT, 1429 },
+    // State 1429
+    { 1429, 1249, PA_REDUCE, 952 },
+    // State 1429 default action
+    { 1429, -1, PA_REDUCE, 952 },
+    // State 1430
+    { 1430, 156, PA_SHIFT, 1432 },
+    // State 1430
+    { 1430, 406, PA_SHIFT, 1433 },
+    // State 1430
+    { 1430, 904, PA_SHIFT, 1431 },
+    // State 1431
+    { 1431, 1249, PA_REDUCE, 953 },
+    // State 1431 default action
+    { 1431, -1, PA_REDUCE, 953 },
+    // State 1432
+    { 1432, 1249, PA_REDUCE, 955 },
+    // State 1432 default action
+    { 1432, -1, PA_REDUCE, 955 },
+    // State 1433
+    { 1433, 157, PA_SHIFT, 1438 },
+    // State 1433
+    { 1433, 407, PA_SHIFT, 1439 },
+    // State 1433
+    { 1433, 905, PA_SHIFT, 1504 },
+    // State 1433
+    { 1433, 1155, PA_SHIFT, 1434 },
+    // State 1434
+    { 1434, 250, PA_SHIFT, 1436 },
+    // State 1434
+    { 1434, 655, PA_SHIFT, 1435 },
+    // State 1435
+    { 1435, 1249, PA_REDUCE, 956 },
+    // State 1435 default action
+    { 1435, -1, PA_REDUCE, 956 },
+    // State 1436
+    { 1436, 157, PA_SHIFT, 1438 },
+    // State 1436
+    { 1436, 407, PA_SHIFT, 1439 },
+    // State 1436
+    { 1436, 905, PA_SHIFT, 1437 },
+    // State 1437
+    { 1437, 1249, PA_REDUCE, 957 },
+    // State 1437 default action
+    { 1437, -1, PA_REDUCE, 957 },
+    // State 1438
+    { 1438, 1249, PA_REDUCE, 959 },
+    // State 1438 default action
+    { 1438, -1, PA_REDUCE, 959 },
+    // State 1439
+    { 1439, 159, PA_SHIFT, 1444 },
+    // State 1439
+    { 1439, 409, PA_SHIFT, 1445 },
+    // State 1439
+    { 1439, 907, PA_SHIFT, 1503 },
+    // State 1439
+    { 1439, 1157, PA_SHIFT, 1440 },
+    // State 1440
+    { 1440, 250, PA_SHIFT, 1442 },
+    // State 1440
+    { 1440, 656, PA_SHIFT, 1441 },
+    // State 1441
+    { 1441, 1249, PA_REDUCE, 960 },
+    // State 1441 default action
+    { 1441, -1, PA_REDUCE, 960 },
+    // State 1442
+    { 1442, 159, PA_SHIFT, 1444 },
+    // State 1442
+    { 1442, 409, PA_SHIFT, 1445 },
+    // State 1442
+    { 1442, 907, PA_SHIFT, 1443 },
+    // State 1443
+    { 1443, 1249, PA_REDUCE, 961 },
+    // State 1443 default action
+    { 1443, -1, PA_REDUCE, 961 },
+    // State 1444
+    { 1444, 1249, PA_REDUCE, 963 },
+    // State 1444 default action
+    { 1444, -1, PA_REDUCE, 963 },
+    // State 1445
+    { 1445, 160, PA_SHIFT, 1450 },
+    // State 1445
+    { 1445, 410, PA_SHIFT, 1451 },
+    // State 1445
+    { 1445, 908, PA_SHIFT, 1502 },
+    // State 1445
+    { 1445, 1158, PA_SHIFT, 1446 },
+    // State 1446
+    { 1446, 250, PA_SHIFT, 1448 },
+    // State 1446
+    { 1446, 658, PA_SHIFT, 1447 },
+    // State 1447
+    { 1447, 1249, PA_REDUCE, 964 },
+    // State 1447 default action
+    { 1447, -1, PA_REDUCE, 964 },
+    // State 1448
+    { 1448, 160, PA_SHIFT, 1450 },
+    // State 1448
+    { 1448, 410, PA_SHIFT, 1451 },
+    // State 1448
+    { 1448, 908, PA_SHIFT, 1449 },
+    // State 1449
+    { 1449, 1249, PA_REDUCE, 965 },
+    // State 1449 default action
+    { 1449, -1, PA_REDUCE, 965 },
+    // State 1450
+    { 1450, 1249, PA_REDUCE, 967 },
+    // State 1450 default action
+    { 1450, -1, PA_REDUCE, 967 },
+    // State 1451
+    { 1451, 161, PA_SHIFT, 1456 },
+    // State 1451
+    { 1451, 411, PA_SHIFT, 1457 },
+    // State 1451
+    { 1451, 909, PA_SHIFT, 1501 },
+    // State 1451
+    { 1451, 1159, PA_SHIFT, 1452 },
+    // State 1452
+    { 1452, 250, PA_SHIFT, 1454 },
+    // State 1452
+    { 1452, 659, PA_SHIFT, 1453 },
+    // State 1453
+    { 1453, 1249, PA_REDUCE, 968 },
+    // State 1453 default action
+    { 1453, -1, PA_REDUCE, 968 },
+    // State 1454
+    { 1454, 161, PA_SHIFT, 1456 },
+    // State 1454
+    { 1454, 411, PA_SHIFT, 1457 },
+    // State 1454
+    { 1454, 909, PA_SHIFT, 1455 },
+    // State 1455
+    { 1455, 1249, PA_REDUCE, 969 },
+    // State 1455 default action
+    { 1455, -1, PA_REDUCE, 969 },
+    // State 1456
+    { 1456, 1249, PA_REDUCE, 971 },
+    // State 1456 default action
+    { 1456, -1, PA_REDUCE, 971 },
+    // State 1457
+    { 1457, 162, PA_SHIFT, 1462 },
+    // State 1457
+    { 1457, 412, PA_SHIFT, 1463 },
+    // State 1457
+    { 1457, 910, PA_SHIFT, 1500 },
+    // State 1457
+    { 1457, 1160, PA_SHIFT, 1458 },
+    // State 1458
+    { 1458, 250, PA_SHIFT, 1460 },
+    // State 1458
+    { 1458, 660, PA_SHIFT, 1459 },
+    // State 1459
+    { 1459, 1249, PA_REDUCE, 972 },
+    // State 1459 default action
+    { 1459, -1, PA_REDUCE, 972 },
+    // State 1460
+    { 1460, 162, PA_SHIFT, 1462 },
+    // State 1460
+    { 1460, 412, PA_SHIFT, 1463 },
+    // State 1460
+    { 1460, 910, PA_SHIFT, 1461 },
+    // State 1461
+    { 1461, 1249, PA_REDUCE, 973 },
+    // State 1461 default action
+    { 1461, -1, PA_REDUCE, 973 },
+    // State 1462
+    { 1462, 1249, PA_REDUCE, 975 },
+    // State 1462 default action
+    { 1462, -1, PA_REDUCE, 975 },
+    // State 1463
+    { 1463, 163, PA_SHIFT, 1468 },
+    // State 1463
+    { 1463, 413, PA_SHIFT, 1469 },
+    // State 1463
+    { 1463, 911, PA_SHIFT, 1499 },
+    // State 1463
+    { 1463, 1161, PA_SHIFT, 1464 },
+    // State 1464
+    { 1464, 250, PA_SHIFT, 1466 },
+    // State 1464
+    { 1464, 661, PA_SHIFT, 1465 },
+    // State 1465
+    { 1465, 1249, PA_REDUCE, 976 },
+    // State 1465 default action
+    { 1465, -1, PA_REDUCE, 976 },
+    // State 1466
+    { 1466, 163, PA_SHIFT, 1468 },
+    // State 1466
+    { 1466, 413, PA_SHIFT, 1469 },
+    // State 1466
+    { 1466, 911, PA_SHIFT, 1467 },
+    // State 1467
+    { 1467, 1249, PA_REDUCE, 977 },
+    // State 1467 default action
+    { 1467, -1, PA_REDUCE, 977 },
+    // State 1468
+    { 1468, 1249, PA_REDUCE, 979 },
+    // State 1468 default action
+    { 1468, -1, PA_REDUCE, 979 },
+    // State 1469
+    { 1469, 164, PA_SHIFT, 1474 },
+    // State 1469
+    { 1469, 414, PA_SHIFT, 1475 },
+    // State 1469
+    { 1469, 912, PA_SHIFT, 1498 },
+    // State 1469
+    { 1469, 1162, PA_SHIFT, 1470 },
+    // State 1470
+    { 1470, 250, PA_SHIFT, 1472 },
+    // State 1470
+    { 1470, 662, PA_SHIFT, 1471 },
+    // State 1471
+    { 1471, 1249, PA_REDUCE, 980 },
+    // State 1471 default action
+    { 1471, -1, PA_REDUCE, 980 },
+    // State 1472
+    { 1472, 164, PA_SHIFT, 1474 },
+    // State 1472
+    { 1472, 414, PA_SHIFT, 1475 },
+    // State 1472
+    { 1472, 912, PA_SHIFT, 1473 },
+    // State 1473
+    { 1473, 1249, PA_REDUCE, 981 },
+    // State 1473 default action
+    { 1473, -1, PA_REDUCE, 981 },
+    // State 1474
+    { 1474, 1249, PA_REDUCE, 983 },
+    // State 1474 default action
+    { 1474, -1, PA_REDUCE, 983 },
+    // State 1475
+    { 1475, 165, PA_SHIFT, 1480 },
+    // State 1475
+    { 1475, 415, PA_SHIFT, 1481 },
+    // State 1475
+    { 1475, 913, PA_SHIFT, 1497 },
+    // State 1475
+    { 1475, 1163, PA_SHIFT, 1476 },
+    // State 1476
+    { 1476, 250, PA_SHIFT, 1478 },
+    // State 1476
+    { 1476, 663, PA_SHIFT, 1477 },
+    // State 1477
+    { 1477, 1249, PA_REDUCE, 984 },
+    // State 1477 default action
+    { 1477, -1, PA_REDUCE, 984 },
+    // State 1478
+    { 1478, 165, PA_SHIFT, 1480 },
+    // State 1478
+    { 1478, 415, PA_SHIFT, 1481 },
+    // State 1478
+    { 1478, 913, PA_SHIFT, 1479 },
+    // State 1479
+    { 1479, 1249, PA_REDUCE, 985 },
+    // State 1479 default action
+    { 1479, -1, PA_REDUCE, 985 },
+    // State 1480
+    { 1480, 1249, PA_REDUCE, 987 },
+    // State 1480 default action
+    { 1480, -1, PA_REDUCE, 987 },
+    // State 1481
+    { 1481, 166, PA_SHIFT, 1486 },
+    // State 1481
+    { 1481, 416, PA_SHIFT, 1487 },
+    // State 1481
+    { 1481, 914, PA_SHIFT, 1496 },
+    // State 1481
+    { 1481, 1164, PA_SHIFT, 1482 },
+    // State 1482
+    { 1482, 250, PA_SHIFT, 1484 },
+    // State 1482
+    { 1482, 664, PA_SHIFT, 1483 },
+    // State 1483
+    { 1483, 1249, PA_REDUCE, 988 },
+    // State 1483 default action
+    { 1483, -1, PA_REDUCE, 988 },
+    // State 1484
+    { 1484, 166, PA_SHIFT, 1486 },
+    // State 1484
+    { 1484, 416, PA_SHIFT, 1487 },
+    // State 1484
+    { 1484, 914, PA_SHIFT, 1485 },
+    // State 1485
+    { 1485, 1249, PA_REDUCE, 989 },
+    // State 1485 default action
+    { 1485, -1, PA_REDUCE, 989 },
+    // State 1486
+    { 1486, 1249, PA_REDUCE, 991 },
+    // State 1486 default action
+    { 1486, -1, PA_REDUCE, 991 },
+    // State 1487
+    { 1487, 167, PA_SHIFT, 1492 },
+    // State 1487
+    { 1487, 417, PA_SHIFT, 1493 },
+    // State 1487
+    { 1487, 915, PA_SHIFT, 1495 },
+    // State 1487
+    { 1487, 1165, PA_SHIFT, 1488 },
+    // State 1488
+    { 1488, 250, PA_SHIFT, 1490 },
+    // State 1488
+    { 1488, 665, PA_SHIFT, 1489 },
+    // State 1489
+    { 1489, 1249, PA_REDUCE, 992 },
+    // State 1489 default action
+    { 1489, -1, PA_REDUCE, 992 },
+    // State 1490
+    { 1490, 167, PA_SHIFT, 1492 },
+    // State 1490
+    { 1490, 417, PA_SHIFT, 1493 },
+    // State 1490
+    { 1490, 915, PA_SHIFT, 1491 },
+    // State 1491
+    { 1491, 1249, PA_REDUCE, 993 },
+    // State 1491 default action
+    { 1491, -1, PA_REDUCE, 993 },
+    // State 1492
+    { 1492, 1249, PA_REDUCE, 995 },
+    // State 1492 default action
+    { 1492, -1, PA_REDUCE, 995 },
+    // State 1493
+    { 1493, 666, PA_SHIFT, 1494 },
+    // State 1494
+    { 1494, 1249, PA_REDUCE, 996 },
+    // State 1494 default action
+    { 1494, -1, PA_REDUCE, 996 },
+    // State 1495
+    { 1495, 1249, PA_REDUCE, 994 },
+    // State 1495 default action
+    { 1495, -1, PA_REDUCE, 994 },
+    // State 1496
+    { 1496, 1249, PA_REDUCE, 990 },
+    // State 1496 default action
+    { 1496, -1, PA_REDUCE, 990 },
+    // State 1497
+    { 1497, 1249, PA_REDUCE, 986 },
+    // State 1497 default action
+    { 1497, -1, PA_REDUCE, 986 },
+    // State 1498
+    { 1498, 1249, PA_REDUCE, 982 },
+    // State 1498 default action
+    { 1498, -1, PA_REDUCE, 982 },
+    // State 1499
+    { 1499, 1249, PA_REDUCE, 978 },
+    // State 1499 default action
+    { 1499, -1, PA_REDUCE, 978 },
+    // State 1500
+    { 1500, 1249, PA_REDUCE, 974 },
+    // State 1500 default action
+    { 1500, -1, PA_REDUCE, 974 },
+    // State 1501
+    { 1501, 1249, PA_REDUCE, 970 },
+    // State 1501 default action
+    { 1501, -1, PA_REDUCE, 970 },
+    // State 1502
+    { 1502, 1249, PA_REDUCE, 966 },
+    // State 1502 default action
+    { 1502, -1, PA_REDUCE, 966 },
+    // State 1503
+    { 1503, 1249, PA_REDUCE, 962 },
+    // State 1503 default action
+    { 1503, -1, PA_REDUCE, 962 },
+    // State 1504
+    { 1504, 1249, PA_REDUCE, 958 },
+    // State 1504 default action
+    { 1504, -1, PA_REDUCE, 958 },
+    // State 1505
+    { 1505, 1249, PA_REDUCE, 954 },
+    // State 1505 default action
+    { 1505, -1, PA_REDUCE, 954 },
+    // State 1506
+    { 1506, 1249, PA_REDUCE, 950 },
+    // State 1506 default action
+    { 1506, -1, PA_REDUCE, 950 },
+    // State 1507
+    { 1507, 1249, PA_REDUCE, 946 },
+    // State 1507 default action
+    { 1507, -1, PA_REDUCE, 946 },
+    // State 1508
+    { 1508, 1249, PA_REDUCE, 942 },
+    // State 1508 default action
+    { 1508, -1, PA_REDUCE, 942 },
+    // State 1509
+    { 1509, 1249, PA_REDUCE, 938 },
+    // State 1509 default action
+    { 1509, -1, PA_REDUCE, 938 },
+    // State 1510
+    { 1510, 1249, PA_REDUCE, 934 },
+    // State 1510 default action
+    { 1510, -1, PA_REDUCE, 934 },
+    // State 1511
+    { 1511, 1249, PA_REDUCE, 930 },
+    // State 1511 default action
+    { 1511, -1, PA_REDUCE, 930 },
+    // State 1512
+    { 1512, 1249, PA_REDUCE, 926 },
+    // State 1512 default action
+    { 1512, -1, PA_REDUCE, 926 },
+    // State 1513
+    { 1513, 1249, PA_REDUCE, 922 },
+    // State 1513 default action
+    { 1513, -1, PA_REDUCE, 922 },
+    // State 1514
+    { 1514, 1249, PA_REDUCE, 918 },
+    // State 1514 default action
+    { 1514, -1, PA_REDUCE, 918 },
+    // State 1515
+    { 1515, 1249, PA_REDUCE, 914 },
+    // State 1515 default action
+    { 1515, -1, PA_REDUCE, 914 },
+    // State 1516
+    { 1516, 1249, PA_REDUCE, 910 },
+    // State 1516 default action
+    { 1516, -1, PA_REDUCE, 910 },
+    // State 1517
+    { 1517, 1249, PA_REDUCE, 906 },
+    // State 1517 default action
+    { 1517, -1, PA_REDUCE, 906 },
+    // State 1518
+    { 1518, 1249, PA_REDUCE, 902 },
+    // State 1518 default action
+    { 1518, -1, PA_REDUCE, 902 },
+    // State 1519
+    { 1519, 1249, PA_REDUCE, 898 },
+    // State 1519 default action
+    { 1519, -1, PA_REDUCE, 898 },
+    // State 1520
+    { 1520, 1249, PA_REDUCE, 894 },
+    // State 1520 default action
+    { 1520, -1, PA_REDUCE, 894 },
+    // State 1521
+    { 1521, 1249, PA_REDUCE, 890 },
+    // State 1521 default action
+    { 1521, -1, PA_REDUCE, 890 },
+    // State 1522
+    { 1522, 1249, PA_REDUCE, 886 },
+    // State 1522 default action
+    { 1522, -1, PA_REDUCE, 886 },
+    // State 1523
+    { 1523, 1249, PA_REDUCE, 882 },
+    // State 1523 default action
+    { 1523, -1, PA_REDUCE, 882 },
+    // State 1524
+    { 1524, 1249, PA_REDUCE, 878 },
+    // State 1524 default action
+    { 1524, -1, PA_REDUCE, 878 },
+    // State 1525
+    { 1525, 1249, PA_REDUCE, 874 },
+    // State 1525 default action
+    { 1525, -1, PA_REDUCE, 874 },
+    // State 1526
+    { 1526, 1249, PA_REDUCE, 870 },
+    // State 1526 default action
+    { 1526, -1, PA_REDUCE, 870 },
+    // State 1527
+    { 1527, 1249, PA_REDUCE, 866 },
+    // State 1527 default action
+    { 1527, -1, PA_REDUCE, 866 },
+    // State 1528
+    { 1528, 1249, PA_REDUCE, 862 },
+    // State 1528 default action
+    { 1528, -1, PA_REDUCE, 862 },
+    // State 1529
+    { 1529, 1249, PA_REDUCE, 858 },
+    // State 1529 default action
+    { 1529, -1, PA_REDUCE, 858 },
+    // State 1530
+    { 1530, 1249, PA_REDUCE, 854 },
+    // State 1530 default action
+    { 1530, -1, PA_REDUCE, 854 },
+    // State 1531
+    { 1531, 1249, PA_REDUCE, 850 },
+    // State 1531 default action
+    { 1531, -1, PA_REDUCE, 850 },
+    // State 1532
+    { 1532, 1249, PA_REDUCE, 846 },
+    // State 1532 default action
+    { 1532, -1, PA_REDUCE, 846 },
+    // State 1533
+    { 1533, 1249, PA_REDUCE, 842 },
+    // State 1533 default action
+    { 1533, -1, PA_REDUCE, 842 },
+    // State 1534
+    { 1534, 1249, PA_REDUCE, 838 },
+    // State 1534 default action
+    { 1534, -1, PA_REDUCE, 838 },
+    // State 1535
+    { 1535, 1249, PA_REDUCE, 834 },
+    // State 1535 default action
+    { 1535, -1, PA_REDUCE, 834 },
+    // State 1536
+    { 1536, 1249, PA_REDUCE, 830 },
+    // State 1536 default action
+    { 1536, -1, PA_REDUCE, 830 },
+    // State 1537
+    { 1537, 1249, PA_REDUCE, 826 },
+    // State 1537 default action
+    { 1537, -1, PA_REDUCE, 826 },
+    // State 1538
+    { 1538, 1249, PA_REDUCE, 822 },
+    // State 1538 default action
+    { 1538, -1, PA_REDUCE, 822 },
+    // State 1539
+    { 1539, 1249, PA_REDUCE, 818 },
+    // State 1539 default action
+    { 1539, -1, PA_REDUCE, 818 },
+    // State 1540
+    { 1540, 1249, PA_REDUCE, 814 },
+    // State 1540 default action
+    { 1540, -1, PA_REDUCE, 814 },
+    // State 1541
+    { 1541, 1249, PA_REDUCE, 810 },
+    // State 1541 default action
+    { 1541, -1, PA_REDUCE, 810 },
+    // State 1542
+    { 1542, 1249, PA_REDUCE, 806 },
+    // State 1542 default action
+    { 1542, -1, PA_REDUCE, 806 },
+    // State 1543
+    { 1543, 1249, PA_REDUCE, 802 },
+    // State 1543 default action
+    { 1543, -1, PA_REDUCE, 802 },
+    // State 1544
+    { 1544, 1249, PA_REDUCE, 798 },
+    // State 1544 default action
+    { 1544, -1, PA_REDUCE, 798 },
+    // State 1545
+    { 1545, 1249, PA_REDUCE, 794 },
+    // State 1545 default action
+    { 1545, -1, PA_REDUCE, 794 },
+    // State 1546
+    { 1546, 1249, PA_REDUCE, 790 },
+    // State 1546 default action
+    { 1546, -1, PA_REDUCE, 790 },
+    // State 1547
+    { 1547, 1249, PA_REDUCE, 786 },
+    // State 1547 default action
+    { 1547, -1, PA_REDUCE, 786 },
+    // State 1548
+    { 1548, 1249, PA_REDUCE, 782 },
+    // State 1548 default action
+    { 1548, -1, PA_REDUCE, 782 },
+    // State 1549
+    { 1549, 1249, PA_REDUCE, 778 },
+    // State 1549 default action
+    { 1549, -1, PA_REDUCE, 778 },
+    // State 1550
+    { 1550, 1249, PA_REDUCE, 774 },
+    // State 1550 default action
+    { 1550, -1, PA_REDUCE, 774 },
+    // State 1551
+    { 1551, 1249, PA_REDUCE, 770 },
+    // State 1551 default action
+    { 1551, -1, PA_REDUCE, 770 },
+    // State 1552
+    { 1552, 1249, PA_REDUCE, 766 },
+    // State 1552 default action
+    { 1552, -1, PA_REDUCE, 766 },
+    // State 1553
+    { 1553, 1249, PA_REDUCE, 762 },
+    // State 1553 default action
+    { 1553, -1, PA_REDUCE, 762 },
+    // State 1554
+    { 1554, 1249, PA_REDUCE, 758 },
+    // State 1554 default action
+    { 1554, -1, PA_REDUCE, 758 },
+    // State 1555
+    { 1555, 1249, PA_REDUCE, 754 },
+    // State 1555 default action
+    { 1555, -1, PA_REDUCE, 754 },
+    // State 1556
+    { 1556, 1249, PA_REDUCE, 750 },
+    // State 1556 default action
+    { 1556, -1, PA_REDUCE, 750 },
+    // State 1557
+    { 1557, 1249, PA_REDUCE, 746 },
+    // State 1557 default action
+    { 1557, -1, PA_REDUCE, 746 },
+    // State 1558
+    { 1558, 1249, PA_REDUCE, 742 },
+    // State 1558 default action
+    { 1558, -1, PA_REDUCE, 742 },
+    // State 1559
+    { 1559, 1249, PA_REDUCE, 738 },
+    // State 1559 default action
+    { 1559, -1, PA_REDUCE, 738 },
+    // State 1560
+    { 1560, 1249, PA_REDUCE, 734 },
+    // State 1560 default action
+    { 1560, -1, PA_REDUCE, 734 },
+    // State 1561
+    { 1561, 1249, PA_REDUCE, 730 },
+    // State 1561 default action
+    { 1561, -1, PA_REDUCE, 730 },
+    // State 1562
+    { 1562, 1249, PA_REDUCE, 726 },
+    // State 1562 default action
+    { 1562, -1, PA_REDUCE, 726 },
+    // State 1563
+    { 1563, 1249, PA_REDUCE, 722 },
+    // State 1563 default action
+    { 1563, -1, PA_REDUCE, 722 },
+    // State 1564
+    { 1564, 1249, PA_REDUCE, 718 },
+    // State 1564 default action
+    { 1564, -1, PA_REDUCE, 718 },
+    // State 1565
+    { 1565, 1249, PA_REDUCE, 714 },
+    // State 1565 default action
+    { 1565, -1, PA_REDUCE, 714 },
+    // State 1566
+    { 1566, 1249, PA_REDUCE, 710 },
+    // State 1566 default action
+    { 1566, -1, PA_REDUCE, 710 },
+    // State 1567
+    { 1567, 1249, PA_REDUCE, 706 },
+    // State 1567 default action
+    { 1567, -1, PA_REDUCE, 706 },
+    // State 1568
+    { 1568, 1249, PA_REDUCE, 702 },
+    // State 1568 default action
+    { 1568, -1, PA_REDUCE, 702 },
+    // State 1569
+    { 1569, 1249, PA_REDUCE, 698 },
+    // State 1569 default action
+    { 1569, -1, PA_REDUCE, 698 },
+    // State 1570
+    { 1570, 1249, PA_REDUCE, 694 },
+    // State 1570 default action
+    { 1570, -1, PA_REDUCE, 694 },
+    // State 1571
+    { 1571, 1249, PA_REDUCE, 690 },
+    // State 1571 default action
+    { 1571, -1, PA_REDUCE, 690 },
+    // State 1572
+    { 1572, 1249, PA_REDUCE, 686 },
+    // State 1572 default action
+    { 1572, -1, PA_REDUCE, 686 },
+    // State 1573
+    { 1573, 1249, PA_REDUCE, 682 },
+    // State 1573 default action
+    { 1573, -1, PA_REDUCE, 682 },
+    // State 1574
+    { 1574, 1249, PA_REDUCE, 678 },
+    // State 1574 default action
+    { 1574, -1, PA_REDUCE, 678 },
+    // State 1575
+    { 1575, 1249, PA_REDUCE, 674 },
+    // State 1575 default action
+    { 1575, -1, PA_REDUCE, 674 },
+    // State 1576
+    { 1576, 1249, PA_REDUCE, 670 },
+    // State 1576 default action
+    { 1576, -1, PA_REDUCE, 670 },
+    // State 1577
+    { 1577, 1249, PA_REDUCE, 666 },
+    // State 1577 default action
+    { 1577, -1, PA_REDUCE, 666 },
+    // State 1578
+    { 1578, 1249, PA_REDUCE, 662 },
+    // State 1578 default action
+    { 1578, -1, PA_REDUCE, 662 },
+    // State 1579
+    { 1579, 1249, PA_REDUCE, 658 },
+    // State 1579 default action
+    { 1579, -1, PA_REDUCE, 658 },
+    // State 1580
+    { 1580, 1249, PA_REDUCE, 654 },
+    // State 1580 default action
+    { 1580, -1, PA_REDUCE, 654 },
+    // State 1581
+    { 1581, 1249, PA_REDUCE, 650 },
+    // State 1581 default action
+    { 1581, -1, PA_REDUCE, 650 },
+    // State 1582
+    { 1582, 1249, PA_REDUCE, 646 },
+    // State 1582 default action
+    { 1582, -1, PA_REDUCE, 646 },
+    // State 1583
+    { 1583, 1249, PA_REDUCE, 642 },
+    // State 1583 default action
+    { 1583, -1, PA_REDUCE, 642 },
+    // State 1584
+    { 1584, 1249, PA_REDUCE, 638 },
+    // State 1584 default action
+    { 1584, -1, PA_REDUCE, 638 },
+    // State 1585
+    { 1585, 1249, PA_REDUCE, 634 },
+    // State 1585 default action
+    { 1585, -1, PA_REDUCE, 634 },
+    // State 1586
+    { 1586, 1249, PA_REDUCE, 630 },
+    // State 1586 default action
+    { 1586, -1, PA_REDUCE, 630 },
+    // State 1587
+    { 1587, 1249, PA_REDUCE, 626 },
+    // State 1587 default action
+    { 1587, -1, PA_REDUCE, 626 },
+    // State 1588
+    { 1588, 1249, PA_REDUCE, 622 },
+    // State 1588 default action
+    { 1588, -1, PA_REDUCE, 622 },
+    // State 1589
+    { 1589, 1249, PA_REDUCE, 618 },
+    // State 1589 default action
+    { 1589, -1, PA_REDUCE, 618 },
+    // State 1590
+    { 1590, 1249, PA_REDUCE, 614 },
+    // State 1590 default action
+    { 1590, -1, PA_REDUCE, 614 },
+    // State 1591
+    { 1591, 1249, PA_REDUCE, 610 },
+    // State 1591 default action
+    { 1591, -1, PA_REDUCE, 610 },
+    // State 1592
+    { 1592, 1249, PA_REDUCE, 606 },
+    // State 1592 default action
+    { 1592, -1, PA_REDUCE, 606 },
+    // State 1593
+    { 1593, 1249, PA_REDUCE, 602 },
+    // State 1593 default action
+    { 1593, -1, PA_REDUCE, 602 },
+    // State 1594
+    { 1594, 1249, PA_REDUCE, 598 },
+    // State 1594 default action
+    { 1594, -1, PA_REDUCE, 598 },
+    // State 1595
+    { 1595, 1249, PA_REDUCE, 594 },
+    // State 1595 default action
+    { 1595, -1, PA_REDUCE, 594 },
+    // State 1596
+    { 1596, 1249, PA_REDUCE, 590 },
+    // State 1596 default action
+    { 1596, -1, PA_REDUCE, 590 },
+    // State 1597
+    { 1597, 1249, PA_REDUCE, 586 },
+    // State 1597 default action
+    { 1597, -1, PA_REDUCE, 586 },
+    // State 1598
+    { 1598, 1249, PA_REDUCE, 582 },
+    // State 1598 default action
+    { 1598, -1, PA_REDUCE, 582 },
+    // State 1599
+    { 1599, 1249, PA_REDUCE, 578 },
+    // State 1599 default action
+    { 1599, -1, PA_REDUCE, 578 },
+    // State 1600
+    { 1600, 1249, PA_REDUCE, 574 },
+    // State 1600 default action
+    { 1600, -1, PA_REDUCE, 574 },
+    // State 1601
+    { 1601, 1249, PA_REDUCE, 570 },
+    // State 1601 default action
+    { 1601, -1, PA_REDUCE, 570 },
+    // State 1602
+    { 1602, 1249, PA_REDUCE, 566 },
+    // State 1602 default action
+    { 1602, -1, PA_REDUCE, 566 },
+    // State 1603
+    { 1603, 1249, PA_REDUCE, 562 },
+    // State 1603 default action
+    { 1603, -1, PA_REDUCE, 562 },
+    // State 1604
+    { 1604, 1249, PA_REDUCE, 558 },
+    // State 1604 default action
+    { 1604, -1, PA_REDUCE, 558 },
+    // State 1605
+    { 1605, 1249, PA_REDUCE, 554 },
+    // State 1605 default action
+    { 1605, -1, PA_REDUCE, 554 },
+    // State 1606
+    { 1606, 1249, PA_REDUCE, 550 },
+    // State 1606 default action
+    { 1606, -1, PA_REDUCE, 550 },
+    // State 1607
+    { 1607, 1249, PA_REDUCE, 546 },
+    // State 1607 default action
+    { 1607, -1, PA_REDUCE, 546 },
+    // State 1608
+    { 1608, 1249, PA_REDUCE, 542 },
+    // State 1608 default action
+    { 1608, -1, PA_REDUCE, 542 },
+    // State 1609
+    { 1609, 1249, PA_REDUCE, 538 },
+    // State 1609 default action
+    { 1609, -1, PA_REDUCE, 538 },
+    // State 1610
+    { 1610, 1249, PA_REDUCE, 534 },
+    // State 1610 default action
+    { 1610, -1, PA_REDUCE, 534 },
+    // State 1611
+    { 1611, 1249, PA_REDUCE, 530 },
+    // State 1611 default action
+    { 1611, -1, PA_REDUCE, 530 },
+    // State 1612
+    { 1612, 1249, PA_REDUCE, 526 },
+    // State 1612 default action
+    { 1612, -1, PA_REDUCE, 526 },
+    // State 1613
+    { 1613, 1249, PA_REDUCE, 522 },
+    // State 1613 default action
+    { 1613, -1, PA_REDUCE, 522 },
+    // State 1614
+    { 1614, 1249, PA_REDUCE, 518 },
+    // State 1614 default action
+    { 1614, -1, PA_REDUCE, 518 },
+    // State 1615
+    { 1615, 1249, PA_REDUCE, 514 },
+    // State 1615 default action
+    { 1615, -1, PA_REDUCE, 514 },
+    // State 1616
+    { 1616, 1249, PA_REDUCE, 510 },
+    // State 1616 default action
+    { 1616, -1, PA_REDUCE, 510 },
+    // State 1617
+    { 1617, 1249, PA_REDUCE, 506 },
+    // State 1617 default action
+    { 1617, -1, PA_REDUCE, 506 },
+    // State 1618
+    { 1618, 1249, PA_REDUCE, 502 },
+    // State 1618 default action
+    { 1618, -1, PA_REDUCE, 502 },
+    // State 1619
+    { 1619, 1249, PA_REDUCE, 498 },
+    // State 1619 default action
+    { 1619, -1, PA_REDUCE, 498 },
+    // State 1620
+    { 1620, 1249, PA_REDUCE, 494 },
+    // State 1620 default action
+    { 1620, -1, PA_REDUCE, 494 },
+    // State 1621
+    { 1621, 1249, PA_REDUCE, 490 },
+    // State 1621 default action
+    { 1621, -1, PA_REDUCE, 490 },
+    // State 1622
+    { 1622, 1249, PA_REDUCE, 486 },
+    // State 1622 default action
+    { 1622, -1, PA_REDUCE, 486 },
+    // State 1623
+    { 1623, 1249, PA_REDUCE, 482 },
+    // State 1623 default action
+    { 1623, -1, PA_REDUCE, 482 },
+    // State 1624
+    { 1624, 1249, PA_REDUCE, 478 },
+    // State 1624 default action
+    { 1624, -1, PA_REDUCE, 478 },
+    // State 1625
+    { 1625, 1249, PA_REDUCE, 474 },
+    // State 1625 default action
+    { 1625, -1, PA_REDUCE, 474 },
+    // State 1626
+    { 1626, 1249, PA_REDUCE, 470 },
+    // State 1626 default action
+    { 1626, -1, PA_REDUCE, 470 },
+    // State 1627
+    { 1627, 1249, PA_REDUCE, 466 },
+    // State 1627 default action
+    { 1627, -1, PA_REDUCE, 466 },
+    // State 1628
+    { 1628, 1249, PA_REDUCE, 462 },
+    // State 1628 default action
+    { 1628, -1, PA_REDUCE, 462 },
+    // State 1629
+    { 1629, 1249, PA_REDUCE, 458 },
+    // State 1629 default action
+    { 1629, -1, PA_REDUCE, 458 },
+    // State 1630
+    { 1630, 1249, PA_REDUCE, 454 },
+    // State 1630 default action
+    { 1630, -1, PA_REDUCE, 454 },
+    // State 1631
+    { 1631, 1249, PA_REDUCE, 450 },
+    // State 1631 default action
+    { 1631, -1, PA_REDUCE, 450 },
+    // State 1632
+    { 1632, 1249, PA_REDUCE, 446 },
+    // State 1632 default action
+    { 1632, -1, PA_REDUCE, 446 },
+    // State 1633
+    { 1633, 1249, PA_REDUCE, 442 },
+    // State 1633 default action
+    { 1633, -1, PA_REDUCE, 442 },
+    // State 1634
+    { 1634, 1249, PA_REDUCE, 438 },
+    // State 1634 default action
+    { 1634, -1, PA_REDUCE, 438 },
+    // State 1635
+    { 1635, 1249, PA_REDUCE, 434 },
+    // State 1635 default action
+    { 1635, -1, PA_REDUCE, 434 },
+    // State 1636
+    { 1636, 1249, PA_REDUCE, 430 },
+    // State 1636 default action
+    { 1636, -1, PA_REDUCE, 430 },
+    // State 1637
+    { 1637, 1249, PA_REDUCE, 426 },
+    // State 1637 default action
+    { 1637, -1, PA_REDUCE, 426 },
+    // State 1638
+    { 1638, 1249, PA_REDUCE, 422 },
+    // State 1638 default action
+    { 1638, -1, PA_REDUCE, 422 },
+    // State 1639
+    { 1639, 1249, PA_REDUCE, 418 },
+    // State 1639 default action
+    { 1639, -1, PA_REDUCE, 418 },
+    // State 1640
+    { 1640, 1249, PA_REDUCE, 414 },
+    // State 1640 default action
+    { 1640, -1, PA_REDUCE, 414 },
+    // State 1641
+    { 1641, 1249, PA_REDUCE, 410 },
+    // State 1641 default action
+    { 1641, -1, PA_REDUCE, 410 },
+    // State 1642
+    { 1642, 1249, PA_REDUCE, 406 },
+    // State 1642 default action
+    { 1642, -1, PA_REDUCE, 406 },
+    // State 1643
+    { 1643, 1249, PA_REDUCE, 402 },
+    // State 1643 default action
+    { 1643, -1, PA_REDUCE, 402 },
+    // State 1644
+    { 1644, 1249, PA_REDUCE, 398 },
+    // State 1644 default action
+    { 1644, -1, PA_REDUCE, 398 },
+    // State 1645
+    { 1645, 1249, PA_REDUCE, 394 },
+    // State 1645 default action
+    { 1645, -1, PA_REDUCE, 394 },
+    // State 1646
+    { 1646, 1249, PA_REDUCE, 390 },
+    // State 1646 default action
+    { 1646, -1, PA_REDUCE, 390 },
+    // State 1647
+    { 1647, 1249, PA_REDUCE, 386 },
+    // State 1647 default action
+    { 1647, -1, PA_REDUCE, 386 },
+    // State 1648
+    { 1648, 1249, PA_REDUCE, 382 },
+    // State 1648 default action
+    { 1648, -1, PA_REDUCE, 382 },
+    // State 1649
+    { 1649, 1249, PA_REDUCE, 378 },
+    // State 1649 default action
+    { 1649, -1, PA_REDUCE, 378 },
+    // State 1650
+    { 1650, 1249, PA_REDUCE, 374 },
+    // State 1650 default action
+    { 1650, -1, PA_REDUCE, 374 },
+    // State 1651
+    { 1651, 1249, PA_REDUCE, 370 },
+    // State 1651 default action
+    { 1651, -1, PA_REDUCE, 370 },
+    // State 1652
+    { 1652, 1249, PA_REDUCE, 366 },
+    // State 1652 default action
+    { 1652, -1, PA_REDUCE, 366 },
+    // State 1653
+    { 1653, 1249, PA_REDUCE, 362 },
+    // State 1653 default action
+    { 1653, -1, PA_REDUCE, 362 },
+    // State 1654
+    { 1654, 1249, PA_REDUCE, 358 },
+    // State 1654 default action
+    { 1654, -1, PA_REDUCE, 358 },
+    // State 1655
+    { 1655, 1249, PA_REDUCE, 354 },
+    // State 1655 default action
+    { 1655, -1, PA_REDUCE, 354 },
+    // State 1656
+    { 1656, 1249, PA_REDUCE, 350 },
+    // State 1656 default action
+    { 1656, -1, PA_REDUCE, 350 },
+    // State 1657
+    { 1657, 1249, PA_REDUCE, 346 },
+    // State 1657 default action
+    { 1657, -1, PA_REDUCE, 346 },
+    // State 1658
+    { 1658, 1249, PA_REDUCE, 342 },
+    // State 1658 default action
+    { 1658, -1, PA_REDUCE, 342 },
+    // State 1659
+    { 1659, 1249, PA_REDUCE, 338 },
+    // State 1659 default action
+    { 1659, -1, PA_REDUCE, 338 },
+    // State 1660
+    { 1660, 1249, PA_REDUCE, 334 },
+    // State 1660 default action
+    { 1660, -1, PA_REDUCE, 334 },
+    // State 1661
+    { 1661, 1249, PA_REDUCE, 330 },
+    // State 1661 default action
+    { 1661, -1, PA_REDUCE, 330 },
+    // State 1662
+    { 1662, 1249, PA_REDUCE, 326 },
+    // State 1662 default action
+    { 1662, -1, PA_REDUCE, 326 },
+    // State 1663
+    { 1663, 1249, PA_REDUCE, 322 },
+    // State 1663 default action
+    { 1663, -1, PA_REDUCE, 322 },
+    // State 1664
+    { 1664, 1249, PA_REDUCE, 318 },
+    // State 1664 default action
+    { 1664, -1, PA_REDUCE, 318 },
+    // State 1665
+    { 1665, 1249, PA_REDUCE, 314 },
+    // State 1665 default action
+    { 1665, -1, PA_REDUCE, 314 },
+    // State 1666
+    { 1666, 1249, PA_REDUCE, 310 },
+    // State 1666 default action
+    { 1666, -1, PA_REDUCE, 310 },
+    // State 1667
+    { 1667, 1249, PA_REDUCE, 306 },
+    // State 1667 default action
+    { 1667, -1, PA_REDUCE, 306 },
+    // State 1668
+    { 1668, 1249, PA_REDUCE, 302 },
+    // State 1668 default action
+    { 1668, -1, PA_REDUCE, 302 },
+    // State 1669
+    { 1669, 1249, PA_REDUCE, 298 },
+    // State 1669 default action
+    { 1669, -1, PA_REDUCE, 298 },
+    // State 1670
+    { 1670, 1249, PA_REDUCE, 294 },
+    // State 1670 default action
+    { 1670, -1, PA_REDUCE, 294 },
+    // State 1671
+    { 1671, 1249, PA_REDUCE, 290 },
+    // State 1671 default action
+    { 1671, -1, PA_REDUCE, 290 },
+    // State 1672
+    { 1672, 1249, PA_REDUCE, 286 },
+    // State 1672 default action
+    { 1672, -1, PA_REDUCE, 286 },
+    // State 1673
+    { 1673, 1249, PA_REDUCE, 282 },
+    // State 1673 default action
+    { 1673, -1, PA_REDUCE, 282 },
+    // State 1674
+    { 1674, 1249, PA_REDUCE, 278 },
+    // State 1674 default action
+    { 1674, -1, PA_REDUCE, 278 },
+    // State 1675
+    { 1675, 1249, PA_REDUCE, 274 },
+    // State 1675 default action
+    { 1675, -1, PA_REDUCE, 274 },
+    // State 1676
+    { 1676, 1249, PA_REDUCE, 270 },
+    // State 1676 default action
+    { 1676, -1, PA_REDUCE, 270 },
+    // State 1677
+    { 1677, 1249, PA_REDUCE, 266 },
+    // State 1677 default action
+    { 1677, -1, PA_REDUCE, 266 },
+    // State 1678
+    { 1678, 1249, PA_REDUCE, 262 },
+    // State 1678 default action
+    { 1678, -1, PA_REDUCE, 262 },
+    // State 1679
+    { 1679, 1249, PA_REDUCE, 258 },
+    // State 1679 default action
+    { 1679, -1, PA_REDUCE, 258 },
+    // State 1680
+    { 1680, 1249, PA_REDUCE, 254 },
+    // State 1680 default action
+    { 1680, -1, PA_REDUCE, 254 },
+    // State 1681
+    { 1681, 1249, PA_REDUCE, 250 },
+    // State 1681 default action
+    { 1681, -1, PA_REDUCE, 250 },
+    // State 1682
+    { 1682, 1249, PA_REDUCE, 246 },
+    // State 1682 default action
+    { 1682, -1, PA_REDUCE, 246 },
+    // State 1683
+    { 1683, 1249, PA_REDUCE, 242 },
+    // State 1683 default action
+    { 1683, -1, PA_REDUCE, 242 },
+    // State 1684
+    { 1684, 1249, PA_REDUCE, 238 },
+    // State 1684 default action
+    { 1684, -1, PA_REDUCE, 238 },
+    // State 1685
+    { 1685, 1249, PA_REDUCE, 234 },
+    // State 1685 default action
+    { 1685, -1, PA_REDUCE, 234 },
+    // State 1686
+    { 1686, 1249, PA_REDUCE, 230 },
+    // State 1686 default action
+    { 1686, -1, PA_REDUCE, 230 },
+    // State 1687
+    { 1687, 1249, PA_REDUCE, 226 },
+    // State 1687 default action
+    { 1687, -1, PA_REDUCE, 226 },
+    // State 1688
+    { 1688, 1249, PA_REDUCE, 222 },
+    // State 1688 default action
+    { 1688, -1, PA_REDUCE, 222 },
+    // State 1689
+    { 1689, 1249, PA_REDUCE, 218 },
+    // State 1689 default action
+    { 1689, -1, PA_REDUCE, 218 },
+    // State 1690
+    { 1690, 1249, PA_REDUCE, 214 },
+    // State 1690 default action
+    { 1690, -1, PA_REDUCE, 214 },
+    // State 1691
+    { 1691, 1249, PA_REDUCE, 210 },
+    // State 1691 default action
+    { 1691, -1, PA_REDUCE, 210 },
+    // State 1692
+    { 1692, 1249, PA_REDUCE, 206 },
+    // State 1692 default action
+    { 1692, -1, PA_REDUCE, 206 },
+    // State 1693
+    { 1693, 1249, PA_REDUCE, 202 },
+    // State 1693 default action
+    { 1693, -1, PA_REDUCE, 202 },
+    // State 1694
+    { 1694, 1249, PA_REDUCE, 198 },
+    // State 1694 default action
+    { 1694, -1, PA_REDUCE, 198 },
+    // State 1695
+    { 1695, 1249, PA_REDUCE, 194 },
+    // State 1695 default action
+    { 1695, -1, PA_REDUCE, 194 },
+    // State 1696
+    { 1696, 1249, PA_REDUCE, 190 },
+    // State 1696 default action
+    { 1696, -1, PA_REDUCE, 190 },
+    // State 1697
+    { 1697, 1249, PA_REDUCE, 186 },
+    // State 1697 default action
+    { 1697, -1, PA_REDUCE, 186 },
+    // State 1698
+    { 1698, 1249, PA_REDUCE, 182 },
+    // State 1698 default action
+    { 1698, -1, PA_REDUCE, 182 },
+    // State 1699
+    { 1699, 1249, PA_REDUCE, 178 },
+    // State 1699 default action
+    { 1699, -1, PA_REDUCE, 178 },
+    // State 1700
+    { 1700, 1249, PA_REDUCE, 174 },
+    // State 1700 default action
+    { 1700, -1, PA_REDUCE, 174 },
+    // State 1701
+    { 1701, 1249, PA_REDUCE, 170 },
+    // State 1701 default action
+    { 1701, -1, PA_REDUCE, 170 },
+    // State 1702
+    { 1702, 1249, PA_REDUCE, 166 },
+    // State 1702 default action
+    { 1702, -1, PA_REDUCE, 166 },
+    // State 1703
+    { 1703, 1249, PA_REDUCE, 162 },
+    // State 1703 default action
+    { 1703, -1, PA_REDUCE, 162 },
+    // State 1704
+    { 1704, 1249, PA_REDUCE, 158 },
+    // State 1704 default action
+    { 1704, -1, PA_REDUCE, 158 },
+    // State 1705
+    { 1705, 1249, PA_REDUCE, 154 },
+    // State 1705 default action
+    { 1705, -1, PA_REDUCE, 154 },
+    // State 1706
+    { 1706, 1249, PA_REDUCE, 150 },
+    // State 1706 default action
+    { 1706, -1, PA_REDUCE, 150 },
+    // State 1707
+    { 1707, 1249, PA_REDUCE, 146 },
+    // State 1707 default action
+    { 1707, -1, PA_REDUCE, 146 },
+    // State 1708
+    { 1708, 1249, PA_REDUCE, 142 },
+    // State 1708 default action
+    { 1708, -1, PA_REDUCE, 142 },
+    // State 1709
+    { 1709, 1249, PA_REDUCE, 138 },
+    // State 1709 default action
+    { 1709, -1, PA_REDUCE, 138 },
+    // State 1710
+    { 1710, 1249, PA_REDUCE, 134 },
+    // State 1710 default action
+    { 1710, -1, PA_REDUCE, 134 },
+    // State 1711
+    { 1711, 1249, PA_REDUCE, 130 },
+    // State 1711 default action
+    { 1711, -1, PA_REDUCE, 130 },
+    // State 1712
+    { 1712, 1249, PA_REDUCE, 126 },
+    // State 1712 default action
+    { 1712, -1, PA_REDUCE, 126 },
+    // State 1713
+    { 1713, 1249, PA_REDUCE, 122 },
+    // State 1713 default action
+    { 1713, -1, PA_REDUCE, 122 },
+    // State 1714
+    { 1714, 1249, PA_REDUCE, 118 },
+    // State 1714 default action
+    { 1714, -1, PA_REDUCE, 118 },
+    // State 1715
+    { 1715, 1249, PA_REDUCE, 114 },
+    // State 1715 default action
+    { 1715, -1, PA_REDUCE, 114 },
+    // State 1716
+    { 1716, 1249, PA_REDUCE, 110 },
+    // State 1716 default action
+    { 1716, -1, PA_REDUCE, 110 },
+    // State 1717
+    { 1717, 1249, PA_REDUCE, 106 },
+    // State 1717 default action
+    { 1717, -1, PA_REDUCE, 106 },
+    // State 1718
+    { 1718, 1249, PA_REDUCE, 102 },
+    // State 1718 default action
+    { 1718, -1, PA_REDUCE, 102 },
+    // State 1719
+    { 1719, 1249, PA_REDUCE, 98 },
+    // State 1719 default action
+    { 1719, -1, PA_REDUCE, 98 },
+    // State 1720
+    { 1720, 1249, PA_REDUCE, 94 },
+    // State 1720 default action
+    { 1720, -1, PA_REDUCE, 94 },
+    // State 1721
+    { 1721, 1249, PA_REDUCE, 90 },
+    // State 1721 default action
+    { 1721, -1, PA_REDUCE, 90 },
+    // State 1722
+    { 1722, 1249, PA_REDUCE, 86 },
+    // State 1722 default action
+    { 1722, -1, PA_REDUCE, 86 },
+    // State 1723
+    { 1723, 1249, PA_REDUCE, 82 },
+    // State 1723 default action
+    { 1723, -1, PA_REDUCE, 82 },
+    // State 1724
+    { 1724, 1249, PA_REDUCE, 78 },
+    // State 1724 default action
+    { 1724, -1, PA_REDUCE, 78 },
+    // State 1725
+    { 1725, 1249, PA_REDUCE, 74 },
+    // State 1725 default action
+    { 1725, -1, PA_REDUCE, 74 },
+    // State 1726
+    { 1726, 1249, PA_REDUCE, 70 },
+    // State 1726 default action
+    { 1726, -1, PA_REDUCE, 70 },
+    // State 1727
+    { 1727, 1249, PA_REDUCE, 66 },
+    // State 1727 default action
+    { 1727, -1, PA_REDUCE, 66 },
+    // State 1728
+    { 1728, 1249, PA_REDUCE, 62 },
+    // State 1728 default action
+    { 1728, -1, PA_REDUCE, 62 },
+    // State 1729
+    { 1729, 1249, PA_REDUCE, 58 },
+    // State 1729 default action
+    { 1729, -1, PA_REDUCE, 58 },
+    // State 1730
+    { 1730, 1249, PA_REDUCE, 54 },
+    // State 1730 default action
+    { 1730, -1, PA_REDUCE, 54 },
+    // State 1731
+    { 1731, 1249, PA_REDUCE, 50 },
+    // State 1731 default action
+    { 1731, -1, PA_REDUCE, 50 },
+    // State 1732
+    { 1732, 1249, PA_REDUCE, 46 },
+    // State 1732 default action
+    { 1732, -1, PA_REDUCE, 46 },
+    // State 1733
+    { 1733, 1249, PA_REDUCE, 42 },
+    // State 1733 default action
+    { 1733, -1, PA_REDUCE, 42 },
+    // State 1734
+    { 1734, 1249, PA_REDUCE, 38 },
+    // State 1734 default action
+    { 1734, -1, PA_REDUCE, 38 },
+    // State 1735
+    { 1735, 1249, PA_REDUCE, 34 },
+    // State 1735 default action
+    { 1735, -1, PA_REDUCE, 34 },
+    // State 1736
+    { 1736, 1249, PA_REDUCE, 30 },
+    // State 1736 default action
+    { 1736, -1, PA_REDUCE, 30 },
+    // State 1737
+    { 1737, 1249, PA_REDUCE, 26 },
+    // State 1737 default action
+    { 1737, -1, PA_REDUCE, 26 },
+    // State 1738
+    { 1738, 1249, PA_REDUCE, 22 },
+    // State 1738 default action
+    { 1738, -1, PA_REDUCE, 22 },
+    // State 1739
+    { 1739, 1249, PA_REDUCE, 18 },
+    // State 1739 default action
+    { 1739, -1, PA_REDUCE, 18 },
+    // State 1740
+    { 1740, 1249, PA_REDUCE, 14 },
+    // State 1740 default action
+    { 1740, -1, PA_REDUCE, 14 },
+    // State 1741
+    { 1741, 1249, PA_REDUCE, 10 },
+    // State 1741 default action
+    { 1741, -1, PA_REDUCE, 10 },
+    // State 1742
+    { 1742, 1249, PA_REDUCE, 6 },
+    // State 1742 default action
+    { 1742, -1, PA_REDUCE, 6 },
+    // State 1743
+    { 1743, 1249, PA_REDUCE, 2 },
+    // State 1743 default action
+    { 1743, -1, PA_REDUCE, 2 },
+};
+
+
+static int theRuleTable[997][2] =
+{
+    // prog ::= list0
+    { 1248, 1 }, 
+    // list0 ::= list0 COMMA elem0
+    { 999, 3 }, 
+    // list0 ::= elem0
+    { 999, 1 }, 
+    // elem0 ::= ATOM0
+    { 749, 1 }, 
+    // elem0 ::= LP0 list1 RP0
+    { 749, 3 }, 
+    // list1 ::= list1 COMMA elem1
+    { 1000, 3 }, 
+    // list1 ::= elem1
+    { 1000, 1 }, 
+    // elem1 ::= ATOM1
+    { 750, 1 }, 
+    // elem1 ::= LP1 list2 RP1
+    { 750, 3 }, 
+    // list2 ::= list2 COMMA elem2
+    { 1111, 3 }, 
+    // list2 ::= elem2
+    { 1111, 1 }, 
+    // elem2 ::= ATOM2
+    { 861, 1 }, 
+    // elem2 ::= LP2 list3 RP2
+    { 861, 3 }, 
+    // list3 ::= list3 COMMA elem3
+    { 1171, 3 }, 
+    // list3 ::= elem3
+    { 1171, 1 }, 
+    // elem3 ::= ATOM3
+    { 921, 1 }, 
+    // elem3 ::= LP3 list4 RP3
+    { 921, 3 }, 
+    // list4 ::= list4 COMMA elem4
+    { 1182, 3 }, 
+    // list4 ::= elem4
+    { 1182, 1 }, 
+    // elem4 ::= ATOM4
+    { 932, 1 }, 
+    // elem4 ::= LP4 list5 RP4
+    { 932, 3 }, 
+    // list5 ::= list5 COMMA elem5
+    { 1193, 3 }, 
+    // list5 ::= elem5
+    { 1193, 1 }, 
+    // elem5 ::= ATOM5
+    { 943, 1 }, 
+    // elem5 ::= LP5 list6 RP5
+    { 943, 3 }, 
+    // list6 ::= list6 COMMA elem6
+    { 1204, 3 }, 
+    // list6 ::= elem6
+    { 1204, 1 }, 
+    // elem6 ::= ATOM6
+    { 954, 1 }, 
+    // elem6 ::= LP6 list7 RP6
+    { 954, 3 }, 
+    // list7 ::= list7 COMMA elem7
+    { 1215, 3 }, 
+    // list7 ::= elem7
+    { 1215, 1 }, 
+    // elem7 ::= ATOM7
+    { 965, 1 }, 
+    // elem7 ::= LP7 list8 RP7
+    { 965, 3 }, 
+    // list8 ::= list8 COMMA elem8
+    { 1226, 3 }, 
+    // list8 ::= elem8
+    { 1226, 1 }, 
+    // elem8 ::= ATOM8
+    { 976, 1 }, 
+    // elem8 ::= LP8 list9 RP8
+    { 976, 3 }, 
+    // list9 ::= list9 COMMA elem9
+    { 1237, 3 }, 
+    // list9 ::= elem9
+    { 1237, 1 }, 
+    // elem9 ::= ATOM9
+    { 987, 1 }, 
+    // elem9 ::= LP9 list10 RP9
+    { 987, 3 }, 
+    // list10 ::= list10 COMMA elem10
+    { 1001, 3 }, 
+    // list10 ::= elem10
+    { 1001, 1 }, 
+    // elem10 ::= ATOM10
+    { 751, 1 }, 
+    // elem10 ::= LP10 list11 RP10
+    { 751, 3 }, 
+    // list11 ::= list11 COMMA elem11
+    { 1012, 3 }, 
+    // list11 ::= elem11
+    { 1012, 1 }, 
+    // elem11 ::= ATOM11
+    { 762, 1 }, 
+    // elem11 ::= LP11 list12 RP11
+    { 762, 3 }, 
+    // list12 ::= list12 COMMA elem12
+    { 1023, 3 }, 
+    // list12 ::= elem12
+    { 1023, 1 }, 
+    // elem12 ::= ATOM12
+    { 773, 1 }, 
+    // elem12 ::= LP12 list13 RP12
+    { 773, 3 }, 
+    // list13 ::= list13 COMMA elem13
+    { 1034, 3 }, 
+    // list13 ::= elem13
+    { 1034, 1 }, 
+    // elem13 ::= ATOM13
+    { 784, 1 }, 
+    // elem13 ::= LP13 list14 RP13
+    { 784, 3 }, 
+    // list14 ::= list14 COMMA elem14
+    { 1045, 3 }, 
+    // list14 ::= elem14
+    { 1045, 1 }, 
+    // elem14 ::= ATOM14
+    { 795, 1 }, 
+    // elem14 ::= LP14 list15 RP14
+    { 795, 3 }, 
+    // list15 ::= list15 COMMA elem15
+    { 1056, 3 }, 
+    // list15 ::= elem15
+    { 1056, 1 }, 
+    // elem15 ::= ATOM15
+    { 806, 1 }, 
+    // elem15 ::= LP15 list16 RP15
+    { 806, 3 }, 
+    // list16 ::= list16 COMMA elem16
+    { 1067, 3 }, 
+    // list16 ::= elem16
+    { 1067, 1 }, 
+    // elem16 ::= ATOM16
+    { 817, 1 }, 
+    // elem16 ::= LP16 list17 RP16
+    { 817, 3 }, 
+    // list17 ::= list17 COMMA elem17
+    { 1078, 3 }, 
+    // list17 ::= elem17
+    { 1078, 1 }, 
+    // elem17 ::= ATOM17
+    { 828, 1 }, 
+    // elem17 ::= LP17 list18 RP17
+    { 828, 3 }, 
+    // list18 ::= list18 COMMA elem18
+    { 1089, 3 }, 
+    // list18 ::= elem18
+    { 1089, 1 }, 
+    // elem18 ::= ATOM18
+    { 839, 1 }, 
+    // elem18 ::= LP18 list19 RP18
+    { 839, 3 }, 
+    // list19 ::= list19 COMMA elem19
+    { 1100, 3 }, 
+    // list19 ::= elem19
+    { 1100, 1 }, 
+    // elem19 ::= ATOM19
+    { 850, 1 }, 
+    // elem19 ::= LP19 list20 RP19
+    { 850, 3 }, 
+    // list20 ::= list20 COMMA elem20
+    { 1112, 3 }, 
+    // list20 ::= elem20
+    { 1112, 1 }, 
+    // elem20 ::= ATOM20
+    { 862, 1 }, 
+    // elem20 ::= LP20 list21 RP20
+    { 862, 3 }, 
+    // list21 ::= list21 COMMA elem21
+    { 1123, 3 }, 
+    // list21 ::= elem21
+    { 1123, 1 }, 
+    // elem21 ::= ATOM21
+    { 873, 1 }, 
+    // elem21 ::= LP21 list22 RP21
+    { 873, 3 }, 
+    // list22 ::= list22 COMMA elem22
+    { 1134, 3 }, 
+    // list22 ::= elem22
+    { 1134, 1 }, 
+    // elem22 ::= ATOM22
+    { 884, 1 }, 
+    // elem22 ::= LP22 list23 RP22
+    { 884, 3 }, 
+    // list23 ::= list23 COMMA elem23
+    { 1145, 3 }, 
+    // list23 ::= elem23
+    { 1145, 1 }, 
+    // elem23 ::= ATOM23
+    { 895, 1 }, 
+    // elem23 ::= LP23 list24 RP23
+    { 895, 3 }, 
+    // list24 ::= list24 COMMA elem24
+    { 1156, 3 }, 
+    // list24 ::= elem24
+    { 1156, 1 }, 
+    // elem24 ::= ATOM24
+    { 906, 1 }, 
+    // elem24 ::= LP24 list25 RP24
+    { 906, 3 }, 
+    // list25 ::= list25 COMMA elem25
+    { 1166, 3 }, 
+    // list25 ::= elem25
+    { 1166, 1 }, 
+    // elem25 ::= ATOM25
+    { 916, 1 }, 
+    // elem25 ::= LP25 list26 RP25
+    { 916, 3 }, 
+    // list26 ::= list26 COMMA elem26
+    { 1167, 3 }, 
+    // list26 ::= elem26
+    { 1167, 1 }, 
+    // elem26 ::= ATOM26
+    { 917, 1 }, 
+    // elem26 ::= LP26 list27 RP26
+    { 917, 3 }, 
+    // list27 ::= list27 COMMA elem27
+    { 1168, 3 }, 
+    // list27 ::= elem27
+    { 1168, 1 }, 
+    // elem27 ::= ATOM27
+    { 918, 1 }, 
+    // elem27 ::= LP27 list28 RP27
+    { 918, 3 }, 
+    // list28 ::= list28 COMMA elem28
+    { 1169, 3 }, 
+    // list28 ::= elem28
+    { 1169, 1 }, 
+    // elem28 ::= ATOM28
+    { 919, 1 }, 
+    // elem28 ::= LP28 list29 RP28
+    { 919, 3 }, 
+    // list29 ::= list29 COMMA elem29
+    { 1170, 3 }, 
+    // list29 ::= elem29
+    { 1170, 1 }, 
+    // elem29 ::= ATOM29
+    { 920, 1 }, 
+    // elem29 ::= LP29 list30 RP29
+    { 920, 3 }, 
+    // list30 ::= list30 COMMA elem30
+    { 1172, 3 }, 
+    // list30 ::= elem30
+    { 1172, 1 }, 
+    // elem30 ::= ATOM30
+    { 922, 1 }, 
+    // elem30 ::= LP30 list31 RP30
+    { 922, 3 }, 
+    // list31 ::= list31 COMMA elem31
+    { 1173, 3 }, 
+    // list31 ::= elem31
+    { 1173, 1 }, 
+    // elem31 ::= ATOM31
+    { 923, 1 }, 
+    // elem31 ::= LP31 list32 RP31
+    { 923, 3 }, 
+    // list32 ::= list32 COMMA elem32
+    { 1174, 3 }, 
+    // list32 ::= elem32
+    { 1174, 1 }, 
+    // elem32 ::= ATOM32
+    { 924, 1 }, 
+    // elem32 ::= LP32 list33 RP32
+    { 924, 3 }, 
+    // list33 ::= list33 COMMA elem33
+    { 1175, 3 }, 
+    // list33 ::= elem33
+    { 1175, 1 }, 
+    // elem33 ::= ATOM33
+    { 925, 1 }, 
+    // elem33 ::= LP33 list34 RP33
+    { 925, 3 }, 
+    // list34 ::= list34 COMMA elem34
+    { 1176, 3 }, 
+    // list34 ::= elem34
+    { 1176, 1 }, 
+    // elem34 ::= ATOM34
+    { 926, 1 }, 
+    // elem34 ::= LP34 list35 RP34
+    { 926, 3 }, 
+    // list35 ::= list35 COMMA elem35
+    { 1177, 3 }, 
+    // list35 ::= elem35
+    { 1177, 1 }, 
+    // elem35 ::= ATOM35
+    { 927, 1 }, 
+    // elem35 ::= LP35 list36 RP35
+    { 927, 3 }, 
+    // list36 ::= list36 COMMA elem36
+    { 1178, 3 }, 
+    // list36 ::= elem36
+    { 1178, 1 }, 
+    // elem36 ::= ATOM36
+    { 928, 1 }, 
+    // elem36 ::= LP36 list37 RP36
+    { 928, 3 }, 
+    // list37 ::= list37 COMMA elem37
+    { 1179, 3 }, 
+    // list37 ::= elem37
+    { 1179, 1 }, 
+    // elem37 ::= ATOM37
+    { 929, 1 }, 
+    // elem37 ::= LP37 list38 RP37
+    { 929, 3 }, 
+    // list38 ::= list38 COMMA elem38
+    { 1180, 3 }, 
+    // list38 ::= elem38
+    { 1180, 1 }, 
+    // elem38 ::= ATOM38
+    { 930, 1 }, 
+    // elem38 ::= LP38 list39 RP38
+    { 930, 3 }, 
+    // list39 ::= list39 COMMA elem39
+    { 1181, 3 }, 
+    // list39 ::= elem39
+    { 1181, 1 }, 
+    // elem39 ::= ATOM39
+    { 931, 1 }, 
+    // elem39 ::= LP39 list40 RP39
+    { 931, 3 }, 
+    // list40 ::= list40 COMMA elem40
+    { 1183, 3 }, 
+    // list40 ::= elem40
+    { 1183, 1 }, 
+    // elem40 ::= ATOM40
+    { 933, 1 }, 
+    // elem40 ::= LP40 list41 RP40
+    { 933, 3 }, 
+    // list41 ::= list41 COMMA elem41
+    { 1184, 3 }, 
+    // list41 ::= elem41
+    { 1184, 1 }, 
+    // elem41 ::= ATOM41
+    { 934, 1 }, 
+    // elem41 ::= LP41 list42 RP41
+    { 934, 3 }, 
+    // list42 ::= list42 COMMA elem42
+    { 1185, 3 }, 
+    // list42 ::= elem42
+    { 1185, 1 }, 
+    // elem42 ::= ATOM42
+    { 935, 1 }, 
+    // elem42 ::= LP42 list43 RP42
+    { 935, 3 }, 
+    // list43 ::= list43 COMMA elem43
+    { 1186, 3 }, 
+    // list43 ::= elem43
+    { 1186, 1 }, 
+    // elem43 ::= ATOM43
+    { 936, 1 }, 
+    // elem43 ::= LP43 list44 RP43
+    { 936, 3 }, 
+    // list44 ::= list44 COMMA elem44
+    { 1187, 3 }, 
+    // list44 ::= elem44
+    { 1187, 1 }, 
+    // elem44 ::= ATOM44
+    { 937, 1 }, 
+    // elem44 ::= LP44 list45 RP44
+    { 937, 3 }, 
+    // list45 ::= list45 COMMA elem45
+    { 1188, 3 }, 
+    // list45 ::= elem45
+    { 1188, 1 }, 
+    // elem45 ::= ATOM45
+    { 938, 1 }, 
+    // elem45 ::= LP45 list46 RP45
+    { 938, 3 }, 
+    // list46 ::= list46 COMMA elem46
+    { 1189, 3 }, 
+    // list46 ::= elem46
+    { 1189, 1 }, 
+    // elem46 ::= ATOM46
+    { 939, 1 }, 
+    // elem46 ::= LP46 list47 RP46
+    { 939, 3 }, 
+    // list47 ::= list47 COMMA elem47
+    { 1190, 3 }, 
+    // list47 ::= elem47
+    { 1190, 1 }, 
+    // elem47 ::= ATOM47
+    { 940, 1 }, 
+    // elem47 ::= LP47 list48 RP47
+    { 940, 3 }, 
+    // list48 ::= list48 COMMA elem48
+    { 1191, 3 }, 
+    // list48 ::= elem48
+    { 1191, 1 }, 
+    // elem48 ::= ATOM48
+    { 941, 1 }, 
+    // elem48 ::= LP48 list49 RP48
+    { 941, 3 }, 
+    // list49 ::= list49 COMMA elem49
+    { 1192, 3 }, 
+    // list49 ::= elem49
+    { 1192, 1 }, 
+    // elem49 ::= ATOM49
+    { 942, 1 }, 
+    // elem49 ::= LP49 list50 RP49
+    { 942, 3 }, 
+    // list50 ::= list50 COMMA elem50
+    { 1194, 3 }, 
+    // list50 ::= elem50
+    { 1194, 1 }, 
+    // elem50 ::= ATOM50
+    { 944, 1 }, 
+    // elem50 ::= LP50 list51 RP50
+    { 944, 3 }, 
+    // list51 ::= list51 COMMA elem51
+    { 1195, 3 }, 
+    // list51 ::= elem51
+    { 1195, 1 }, 
+    // elem51 ::= ATOM51
+    { 945, 1 }, 
+    // elem51 ::= LP51 list52 RP51
+    { 945, 3 }, 
+    // list52 ::= list52 COMMA elem52
+    { 1196, 3 }, 
+    // list52 ::= elem52
+    { 1196, 1 }, 
+    // elem52 ::= ATOM52
+    { 946, 1 }, 
+    // elem52 ::= LP52 list53 RP52
+    { 946, 3 }, 
+    // list53 ::= list53 COMMA elem53
+    { 1197, 3 }, 
+    // list53 ::= elem53
+    { 1197, 1 }, 
+    // elem53 ::= ATOM53
+    { 947, 1 }, 
+    // elem53 ::= LP53 list54 RP53
+    { 947, 3 }, 
+    // list54 ::= list54 COMMA elem54
+    { 1198, 3 }, 
+    // list54 ::= elem54
+    { 1198, 1 }, 
+    // elem54 ::= ATOM54
+    { 948, 1 }, 
+    // elem54 ::= LP54 list55 RP54
+    { 948, 3 }, 
+    // list55 ::= list55 COMMA elem55
+    { 1199, 3 }, 
+    // list55 ::= elem55
+    { 1199, 1 }, 
+    // elem55 ::= ATOM55
+    { 949, 1 }, 
+    // elem55 ::= LP55 list56 RP55
+    { 949, 3 }, 
+    // list56 ::= list56 COMMA elem56
+    { 1200, 3 }, 
+    // list56 ::= elem56
+    { 1200, 1 }, 
+    // elem56 ::= ATOM56
+    { 950, 1 }, 
+    // elem56 ::= LP56 list57 RP56
+    { 950, 3 }, 
+    // list57 ::= list57 COMMA elem57
+    { 1201, 3 }, 
+    // list57 ::= elem57
+    { 1201, 1 }, 
+    // elem57 ::= ATOM57
+    { 951, 1 }, 
+    // elem57 ::= LP57 list58 RP57
+    { 951, 3 }, 
+    // list58 ::= list58 COMMA elem58
+    { 1202, 3 }, 
+    // list58 ::= elem58
+    { 1202, 1 }, 
+    // elem58 ::= ATOM58
+    { 952, 1 }, 
+    // elem58 ::= LP58 list59 RP58
+    { 952, 3 }, 
+    // list59 ::= list59 COMMA elem59
+    { 1203, 3 }, 
+    // list59 ::= elem59
+    { 1203, 1 }, 
+    // elem59 ::= ATOM59
+    { 953, 1 }, 
+    // elem59 ::= LP59 list60 RP59
+    { 953, 3 }, 
+    // list60 ::= list60 COMMA elem60
+    { 1205, 3 }, 
+    // list60 ::= elem60
+    { 1205, 1 }, 
+    // elem60 ::= ATOM60
+    { 955, 1 }, 
+    // elem60 ::= LP60 list61 RP60
+    { 955, 3 }, 
+    // list61 ::= list61 COMMA elem61
+    { 1206, 3 }, 
+    // list61 ::= elem61
+    { 1206, 1 }, 
+    // elem61 ::= ATOM61
+    { 956, 1 }, 
+    // elem61 ::= LP61 list62 RP61
+    { 956, 3 }, 
+    // list62 ::= list62 COMMA elem62
+    { 1207, 3 }, 
+    // list62 ::= elem62
+    { 1207, 1 }, 
+    // elem62 ::= ATOM62
+    { 957, 1 }, 
+    // elem62 ::= LP62 list63 RP62
+    { 957, 3 }, 
+    // list63 ::= list63 COMMA elem63
+    { 1208, 3 }, 
+    // list63 ::= elem63
+    { 1208, 1 }, 
+    // elem63 ::= ATOM63
+    { 958, 1 }, 
+    // elem63 ::= LP63 list64 RP63
+    { 958, 3 }, 
+    // list64 ::= list64 COMMA elem64
+    { 1209, 3 }, 
+    // list64 ::= elem64
+    { 1209, 1 }, 
+    // elem64 ::= ATOM64
+    { 959, 1 }, 
+    // elem64 ::= LP64 list65 RP64
+    { 959, 3 }, 
+    // list65 ::= list65 COMMA elem65
+    { 1210, 3 }, 
+    // list65 ::= elem65
+    { 1210, 1 }, 
+    // elem65 ::= ATOM65
+    { 960, 1 }, 
+    // elem65 ::= LP65 list66 RP65
+    { 960, 3 }, 
+    // list66 ::= list66 COMMA elem66
+    { 1211, 3 }, 
+    // list66 ::= elem66
+    { 1211, 1 }, 
+    // elem66 ::= ATOM66
+    { 961, 1 }, 
+    // elem66 ::= LP66 list67 RP66
+    { 961, 3 }, 
+    // list67 ::= list67 COMMA elem67
+    { 1212, 3 }, 
+    // list67 ::= elem67
+    { 1212, 1 }, 
+    // elem67 ::= ATOM67
+    { 962, 1 }, 
+    // elem67 ::= LP67 list68 RP67
+    { 962, 3 }, 
+    // list68 ::= list68 COMMA elem68
+    { 1213, 3 }, 
+    // list68 ::= elem68
+    { 1213, 1 }, 
+    // elem68 ::= ATOM68
+    { 963, 1 }, 
+    // elem68 ::= LP68 list69 RP68
+    { 963, 3 }, 
+    // list69 ::= list69 COMMA elem69
+    { 1214, 3 }, 
+    // list69 ::= elem69
+    { 1214, 1 }, 
+    // elem69 ::= ATOM69
+    { 964, 1 }, 
+    // elem69 ::= LP69 list70 RP69
+    { 964, 3 }, 
+    // list70 ::= list70 COMMA elem70
+    { 1216, 3 }, 
+    // list70 ::= elem70
+    { 1216, 1 }, 
+    // elem70 ::= ATOM70
+    { 966, 1 }, 
+    // elem70 ::= LP70 list71 RP70
+    { 966, 3 }, 
+    // list71 ::= list71 COMMA elem71
+    { 1217, 3 }, 
+    // list71 ::= elem71
+    { 1217, 1 }, 
+    // elem71 ::= ATOM71
+    { 967, 1 }, 
+    // elem71 ::= LP71 list72 RP71
+    { 967, 3 }, 
+    // list72 ::= list72 COMMA elem72
+    { 1218, 3 }, 
+    // list72 ::= elem72
+    { 1218, 1 }, 
+    // elem72 ::= ATOM72
+    { 968, 1 }, 
+    // elem72 ::= LP72 list73 RP72
+    { 968, 3 }, 
+    // list73 ::= list73 COMMA elem73
+    { 1219, 3 }, 
+    // list73 ::= elem73
+    { 1219, 1 }, 
+    // elem73 ::= ATOM73
+    { 969, 1 }, 
+    // elem73 ::= LP73 list74 RP73
+    { 969, 3 }, 
+    // list74 ::= list74 COMMA elem74
+    { 1220, 3 }, 
+    // list74 ::= elem74
+    { 1220, 1 }, 
+    // elem74 ::= ATOM74
+    { 970, 1 }, 
+    // elem74 ::= LP74 list75 RP74
+    { 970, 3 }, 
+    // list75 ::= list75 COMMA elem75
+    { 1221, 3 }, 
+    // list75 ::= elem75
+    { 1221, 1 }, 
+    // elem75 ::= ATOM75
+    { 971, 1 }, 
+    // elem75 ::= LP75 list76 RP75
+    { 971, 3 }, 
+    // list76 ::= list76 COMMA elem76
+    { 1222, 3 }, 
+    // list76 ::= elem76
+    { 1222, 1 }, 
+    // elem76 ::= ATOM76
+    { 972, 1 }, 
+    // elem76 ::= LP76 list77 RP76
+    { 972, 3 }, 
+    // list77 ::= list77 COMMA elem77
+    { 1223, 3 }, 
+    // list77 ::= elem77
+    { 1223, 1 }, 
+    // elem77 ::= ATOM77
+    { 973, 1 }, 
+    // elem77 ::= LP77 list78 RP77
+    { 973, 3 }, 
+    // list78 ::= list78 COMMA elem78
+    { 1224, 3 }, 
+    // list78 ::= elem78
+    { 1224, 1 }, 
+    // elem78 ::= ATOM78
+    { 974, 1 }, 
+    // elem78 ::= LP78 list79 RP78
+    { 974, 3 }, 
+    // list79 ::= list79 COMMA elem79
+    { 1225, 3 }, 
+    // list79 ::= elem79
+    { 1225, 1 }, 
+    // elem79 ::= ATOM79
+    { 975, 1 }, 
+    // elem79 ::= LP79 list80 RP79
+    { 975, 3 }, 
+    // list80 ::= list80 COMMA elem80
+    { 1227, 3 }, 
+    // list80 ::= elem80
+    { 1227, 1 }, 
+    // elem80 ::= ATOM80
+    { 977, 1 }, 
+    // elem80 ::= LP80 list81 RP80
+    { 977, 3 }, 
+    // list81 ::= list81 COMMA elem81
+    { 1228, 3 }, 
+    // list81 ::= elem81
+    { 1228, 1 }, 
+    // elem81 ::= ATOM81
+    { 978, 1 }, 
+    // elem81 ::= LP81 list82 RP81
+    { 978, 3 }, 
+    // list82 ::= list82 COMMA elem82
+    { 1229, 3 }, 
+    // list82 ::= elem82
+    { 1229, 1 }, 
+    // elem82 ::= ATOM82
+    { 979, 1 }, 
+    // elem82 ::= LP82 list83 RP82
+    { 979, 3 }, 
+    // list83 ::= list83 COMMA elem83
+    { 1230, 3 }, 
+    // list83 ::= elem83
+    { 1230, 1 }, 
+    // elem83 ::= ATOM83
+    { 980, 1 }, 
+    // elem83 ::= LP83 list84 RP83
+    { 980, 3 }, 
+    // list84 ::= list84 COMMA elem84
+    { 1231, 3 }, 
+    // list84 ::= elem84
+    { 1231, 1 }, 
+    // elem84 ::= ATOM84
+    { 981, 1 }, 
+    // elem84 ::= LP84 list85 RP84
+    { 981, 3 }, 
+    // list85 ::= list85 COMMA elem85
+    { 1232, 3 }, 
+    // list85 ::= elem85
+    { 1232, 1 }, 
+    // elem85 ::= ATOM85
+    { 982, 1 }, 
+    // elem85 ::= LP85 list86 RP85
+    { 982, 3 }, 
+    // list86 ::= list86 COMMA elem86
+    { 1233, 3 }, 
+    // list86 ::= elem86
+    { 1233, 1 }, 
+    // elem86 ::= ATOM86
+    { 983, 1 }, 
+    // elem86 ::= LP86 list87 RP86
+    { 983, 3 }, 
+    // list87 ::= list87 COMMA elem87
+    { 1234, 3 }, 
+    // list87 ::= elem87
+    { 1234, 1 }, 
+    // elem87 ::= ATOM87
+    { 984, 1 }, 
+    // elem87 ::= LP87 list88 RP87
+    { 984, 3 }, 
+    // list88 ::= list88 COMMA elem88
+    { 1235, 3 }, 
+    // list88 ::= elem88
+    { 1235, 1 }, 
+    // elem88 ::= ATOM88
+    { 985, 1 }, 
+    // elem88 ::= LP88 list89 RP88
+    { 985, 3 }, 
+    // list89 ::= list89 COMMA elem89
+    { 1236, 3 }, 
+    // list89 ::= elem89
+    { 1236, 1 }, 
+    // elem89 ::= ATOM89
+    { 986, 1 }, 
+    // elem89 ::= LP89 list90 RP89
+    { 986, 3 }, 
+    // list90 ::= list90 COMMA elem90
+    { 1238, 3 }, 
+    // list90 ::= elem90
+    { 1238, 1 }, 
+    // elem90 ::= ATOM90
+    { 988, 1 }, 
+    // elem90 ::= LP90 list91 RP90
+    { 988, 3 }, 
+    // list91 ::= list91 COMMA elem91
+    { 1239, 3 }, 
+    // list91 ::= elem91
+    { 1239, 1 }, 
+    // elem91 ::= ATOM91
+    { 989, 1 }, 
+    // elem91 ::= LP91 list92 RP91
+    { 989, 3 }, 
+    // list92 ::= list92 COMMA elem92
+    { 1240, 3 }, 
+    // list92 ::= elem92
+    { 1240, 1 }, 
+    // elem92 ::= ATOM92
+    { 990, 1 }, 
+    // elem92 ::= LP92 list93 RP92
+    { 990, 3 }, 
+    // list93 ::= list93 COMMA elem93
+    { 1241, 3 }, 
+    // list93 ::= elem93
+    { 1241, 1 }, 
+    // elem93 ::= ATOM93
+    { 991, 1 }, 
+    // elem93 ::= LP93 list94 RP93
+    { 991, 3 }, 
+    // list94 ::= list94 COMMA elem94
+    { 1242, 3 }, 
+    // list94 ::= elem94
+    { 1242, 1 }, 
+    // elem94 ::= ATOM94
+    { 992, 1 }, 
+    // elem94 ::= LP94 list95 RP94
+    { 992, 3 }, 
+    // list95 ::= list95 COMMA elem95
+    { 1243, 3 }, 
+    // list95 ::= elem95
+    { 1243, 1 }, 
+    // elem95 ::= ATOM95
+    { 993, 1 }, 
+    // elem95 ::= LP95 list96 RP95
+    { 993, 3 }, 
+    // list96 ::= list96 COMMA elem96
+    { 1244, 3 }, 
+    // list96 ::= elem96
+    { 1244, 1 }, 
+    // elem96 ::= ATOM96
+    { 994, 1 }, 
+    // elem96 ::= LP96 list97 RP96
+    { 994, 3 }, 
+    // list97 ::= list97 COMMA elem97
+    { 1245, 3 }, 
+    // list97 ::= elem97
+    { 1245, 1 }, 
+    // elem97 ::= ATOM97
+    { 995, 1 }, 
+    // elem97 ::= LP97 list98 RP97
+    { 995, 3 }, 
+    // list98 ::= list98 COMMA elem98
+    { 1246, 3 }, 
+    // list98 ::= elem98
+    { 1246, 1 }, 
+    // elem98 ::= ATOM98
+    { 996, 1 }, 
+    // elem98 ::= LP98 list99 RP98
+    { 996, 3 }, 
+    // list99 ::= list99 COMMA elem99
+    { 1247, 3 }, 
+    // list99 ::= elem99
+    { 1247, 1 }, 
+    // elem99 ::= ATOM99
+    { 997, 1 }, 
+    // elem99 ::= LP99 list100 RP99
+    { 997, 3 }, 
+    // list100 ::= list100 COMMA elem100
+    { 1002, 3 }, 
+    // list100 ::= elem100
+    { 1002, 1 }, 
+    // elem100 ::= ATOM100
+    { 752, 1 }, 
+    // elem100 ::= LP100 list101 RP100
+    { 752, 3 }, 
+    // list101 ::= list101 COMMA elem101
+    { 1003, 3 }, 
+    // list101 ::= elem101
+    { 1003, 1 }, 
+    // elem101 ::= ATOM101
+    { 753, 1 }, 
+    // elem101 ::= LP101 list102 RP101
+    { 753, 3 }, 
+    // list102 ::= list102 COMMA elem102
+    { 1004, 3 }, 
+    // list102 ::= elem102
+    { 1004, 1 }, 
+    // elem102 ::= ATOM102
+    { 754, 1 }, 
+    // elem102 ::= LP102 list103 RP102
+    { 754, 3 }, 
+    // list103 ::= list103 COMMA elem103
+    { 1005, 3 }, 
+    // list103 ::= elem103
+    { 1005, 1 }, 
+    // elem103 ::= ATOM103
+    { 755, 1 }, 
+    // elem103 ::= LP103 list104 RP103
+    { 755, 3 }, 
+    // list104 ::= list104 COMMA elem104
+    { 1006, 3 }, 
+    // list104 ::= elem104
+    { 1006, 1 }, 
+    // elem104 ::= ATOM104
+    { 756, 1 }, 
+    // elem104 ::= LP104 list105 RP104
+    { 756, 3 }, 
+    // list105 ::= list105 COMMA elem105
+    { 1007, 3 }, 
+    // list105 ::= elem105
+    { 1007, 1 }, 
+    // elem105 ::= ATOM105
+    { 757, 1 }, 
+    // elem105 ::= LP105 list106 RP105
+    { 757, 3 }, 
+    // list106 ::= list106 COMMA elem106
+    { 1008, 3 }, 
+    // list106 ::= elem106
+    { 1008, 1 }, 
+    // elem106 ::= ATOM106
+    { 758, 1 }, 
+    // elem106 ::= LP106 list107 RP106
+    { 758, 3 }, 
+    // list107 ::= list107 COMMA elem107
+    { 1009, 3 }, 
+    // list107 ::= elem107
+    { 1009, 1 }, 
+    // elem107 ::= ATOM107
+    { 759, 1 }, 
+    // elem107 ::= LP107 list108 RP107
+    { 759, 3 }, 
+    // list108 ::= list108 COMMA elem108
+    { 1010, 3 }, 
+    // list108 ::= elem108
+    { 1010, 1 }, 
+    // elem108 ::= ATOM108
+    { 760, 1 }, 
+    // elem108 ::= LP108 list109 RP108
+    { 760, 3 }, 
+    // list109 ::= list109 COMMA elem109
+    { 1011, 3 }, 
+    // list109 ::= elem109
+    { 1011, 1 }, 
+    // elem109 ::= ATOM109
+    { 761, 1 }, 
+    // elem109 ::= LP109 list110 RP109
+    { 761, 3 }, 
+    // list110 ::= list110 COMMA elem110
+    { 1013, 3 }, 
+    // list110 ::= elem110
+    { 1013, 1 }, 
+    // elem110 ::= ATOM110
+    { 763, 1 }, 
+    // elem110 ::= LP110 list111 RP110
+    { 763, 3 }, 
+    // list111 ::= list111 COMMA elem111
+    { 1014, 3 }, 
+    // list111 ::= elem111
+    { 1014, 1 }, 
+    // elem111 ::= ATOM111
+    { 764, 1 }, 
+    // elem111 ::= LP111 list112 RP111
+    { 764, 3 }, 
+    // list112 ::= list112 COMMA elem112
+    { 1015, 3 }, 
+    // list112 ::= elem112
+    { 1015, 1 }, 
+    // elem112 ::= ATOM112
+    { 765, 1 }, 
+    // elem112 ::= LP112 list113 RP112
+    { 765, 3 }, 
+    // list113 ::= list113 COMMA elem113
+    { 1016, 3 }, 
+    // list113 ::= elem113
+    { 1016, 1 }, 
+    // elem113 ::= ATOM113
+    { 766, 1 }, 
+    // elem113 ::= LP113 list114 RP113
+    { 766, 3 }, 
+    // list114 ::= list114 COMMA elem114
+    { 1017, 3 }, 
+    // list114 ::= elem114
+    { 1017, 1 }, 
+    // elem114 ::= ATOM114
+    { 767, 1 }, 
+    // elem114 ::= LP114 list115 RP114
+    { 767, 3 }, 
+    // list115 ::= list115 COMMA elem115
+    { 1018, 3 }, 
+    // list115 ::= elem115
+    { 1018, 1 }, 
+    // elem115 ::= ATOM115
+    { 768, 1 }, 
+    // elem115 ::= LP115 list116 RP115
+    { 768, 3 }, 
+    // list116 ::= list116 COMMA elem116
+    { 1019, 3 }, 
+    // list116 ::= elem116
+    { 1019, 1 }, 
+    // elem116 ::= ATOM116
+    { 769, 1 }, 
+    // elem116 ::= LP116 list117 RP116
+    { 769, 3 }, 
+    // list117 ::= list117 COMMA elem117
+    { 1020, 3 }, 
+    // list117 ::= elem117
+    { 1020, 1 }, 
+    // elem117 ::= ATOM117
+    { 770, 1 }, 
+    // elem117 ::= LP117 list118 RP117
+    { 770, 3 }, 
+    // list118 ::= list118 COMMA elem118
+    { 1021, 3 }, 
+    // list118 ::= elem118
+    { 1021, 1 }, 
+    // elem118 ::= ATOM118
+    { 771, 1 }, 
+    // elem118 ::= LP118 list119 RP118
+    { 771, 3 }, 
+    // list119 ::= list119 COMMA elem119
+    { 1022, 3 }, 
+    // list119 ::= elem119
+    { 1022, 1 }, 
+    // elem119 ::= ATOM119
+    { 772, 1 }, 
+    // elem119 ::= LP119 list120 RP119
+    { 772, 3 }, 
+    // list120 ::= list120 COMMA elem120
+    { 1024, 3 }, 
+    // list120 ::= elem120
+    { 1024, 1 }, 
+    // elem120 ::= ATOM120
+    { 774, 1 }, 
+    // elem120 ::= LP120 list121 RP120
+    { 774, 3 }, 
+    // list121 ::= list121 COMMA elem121
+    { 1025, 3 }, 
+    // list121 ::= elem121
+    { 1025, 1 }, 
+    // elem121 ::= ATOM121
+    { 775, 1 }, 
+    // elem121 ::= LP121 list122 RP121
+    { 775, 3 }, 
+    // list122 ::= list122 COMMA elem122
+    { 1026, 3 }, 
+    // list122 ::= elem122
+    { 1026, 1 }, 
+    // elem122 ::= ATOM122
+    { 776, 1 }, 
+    // elem122 ::= LP122 list123 RP122
+    { 776, 3 }, 
+    // list123 ::= list123 COMMA elem123
+    { 1027, 3 }, 
+    // list123 ::= elem123
+    { 1027, 1 }, 
+    // elem123 ::= ATOM123
+    { 777, 1 }, 
+    // elem123 ::= LP123 list124 RP123
+    { 777, 3 }, 
+    // list124 ::= list124 COMMA elem124
+    { 1028, 3 }, 
+    // list124 ::= elem124
+    { 1028, 1 }, 
+    // elem124 ::= ATOM124
+    { 778, 1 }, 
+    // elem124 ::= LP124 list125 RP124
+    { 778, 3 }, 
+    // list125 ::= list125 COMMA elem125
+    { 1029, 3 }, 
+    // list125 ::= elem125
+    { 1029, 1 }, 
+    // elem125 ::= ATOM125
+    { 779, 1 }, 
+    // elem125 ::= LP125 list126 RP125
+    { 779, 3 }, 
+    // list126 ::= list126 COMMA elem126
+    { 1030, 3 }, 
+    // list126 ::= elem126
+    { 1030, 1 }, 
+    // elem126 ::= ATOM126
+    { 780, 1 }, 
+    // elem126 ::= LP126 list127 RP126
+    { 780, 3 }, 
+    // list127 ::= list127 COMMA elem127
+    { 1031, 3 }, 
+    // list127 ::= elem127
+    { 1031, 1 }, 
+    // elem127 ::= ATOM127
+    { 781, 1 }, 
+    // elem127 ::= LP127 list128 RP127
+    { 781, 3 }, 
+    // list128 ::= list128 COMMA elem128
+    { 1032, 3 }, 
+    // list128 ::= elem128
+    { 1032, 1 }, 
+    // elem128 ::= ATOM128
+    { 782, 1 }, 
+    // elem128 ::= LP128 list129 RP128
+    { 782, 3 }, 
+    // list129 ::= list129 COMMA elem129
+    { 1033, 3 }, 
+    // list129 ::= elem129
+    { 1033, 1 }, 
+    // elem129 ::= ATOM129
+    { 783, 1 }, 
+    // elem129 ::= LP129 list130 RP129
+    { 783, 3 }, 
+    // list130 ::= list130 COMMA elem130
+    { 1035, 3 }, 
+    // list130 ::= elem130
+    { 1035, 1 }, 
+    // elem130 ::= ATOM130
+    { 785, 1 }, 
+    // elem130 ::= LP130 list131 RP130
+    { 785, 3 }, 
+    // list131 ::= list131 COMMA elem131
+    { 1036, 3 }, 
+    // list131 ::= elem131
+    { 1036, 1 }, 
+    // elem131 ::= ATOM131
+    { 786, 1 }, 
+    // elem131 ::= LP131 list132 RP131
+    { 786, 3 }, 
+    // list132 ::= list132 COMMA elem132
+    { 1037, 3 }, 
+    // list132 ::= elem132
+    { 1037, 1 }, 
+    // elem132 ::= ATOM132
+    { 787, 1 }, 
+    // elem132 ::= LP132 list133 RP132
+    { 787, 3 }, 
+    // list133 ::= list133 COMMA elem133
+    { 1038, 3 }, 
+    // list133 ::= elem133
+    { 1038, 1 }, 
+    // elem133 ::= ATOM133
+    { 788, 1 }, 
+    // elem133 ::= LP133 list134 RP133
+    { 788, 3 }, 
+    // list134 ::= list134 COMMA elem134
+    { 1039, 3 }, 
+    // list134 ::= elem134
+    { 1039, 1 }, 
+    // elem134 ::= ATOM134
+    { 789, 1 }, 
+    // elem134 ::= LP134 list135 RP134
+    { 789, 3 }, 
+    // list135 ::= list135 COMMA elem135
+    { 1040, 3 }, 
+    // list135 ::= elem135
+    { 1040, 1 }, 
+    // elem135 ::= ATOM135
+    { 790, 1 }, 
+    // elem135 ::= LP135 list136 RP135
+    { 790, 3 }, 
+    // list136 ::= list136 COMMA elem136
+    { 1041, 3 }, 
+    // list136 ::= elem136
+    { 1041, 1 }, 
+    // elem136 ::= ATOM136
+    { 791, 1 }, 
+    // elem136 ::= LP136 list137 RP136
+    { 791, 3 }, 
+    // list137 ::= list137 COMMA elem137
+    { 1042, 3 }, 
+    // list137 ::= elem137
+    { 1042, 1 }, 
+    // elem137 ::= ATOM137
+    { 792, 1 }, 
+    // elem137 ::= LP137 list138 RP137
+    { 792, 3 }, 
+    // list138 ::= list138 COMMA elem138
+    { 1043, 3 }, 
+    // list138 ::= elem138
+    { 1043, 1 }, 
+    // elem138 ::= ATOM138
+    { 793, 1 }, 
+    // elem138 ::= LP138 list139 RP138
+    { 793, 3 }, 
+    // list139 ::= list139 COMMA elem139
+    { 1044, 3 }, 
+    // list139 ::= elem139
+    { 1044, 1 }, 
+    // elem139 ::= ATOM139
+    { 794, 1 }, 
+    // elem139 ::= LP139 list140 RP139
+    { 794, 3 }, 
+    // list140 ::= list140 COMMA elem140
+    { 1046, 3 }, 
+    // list140 ::= elem140
+    { 1046, 1 }, 
+    // elem140 ::= ATOM140
+    { 796, 1 }, 
+    // elem140 ::= LP140 list141 RP140
+    { 796, 3 }, 
+    // list141 ::= list141 COMMA elem141
+    { 1047, 3 }, 
+    // list141 ::= elem141
+    { 1047, 1 }, 
+    // elem141 ::= ATOM141
+    { 797, 1 }, 
+    // elem141 ::= LP141 list142 RP141
+    { 797, 3 }, 
+    // list142 ::= list142 COMMA elem142
+    { 1048, 3 }, 
+    // list142 ::= elem142
+    { 1048, 1 }, 
+    // elem142 ::= ATOM142
+    { 798, 1 }, 
+    // elem142 ::= LP142 list143 RP142
+    { 798, 3 }, 
+    // list143 ::= list143 COMMA elem143
+    { 1049, 3 }, 
+    // list143 ::= elem143
+    { 1049, 1 }, 
+    // elem143 ::= ATOM143
+    { 799, 1 }, 
+    // elem143 ::= LP143 list144 RP143
+    { 799, 3 }, 
+    // list144 ::= list144 COMMA elem144
+    { 1050, 3 }, 
+    // list144 ::= elem144
+    { 1050, 1 }, 
+    // elem144 ::= ATOM144
+    { 800, 1 }, 
+    // elem144 ::= LP144 list145 RP144
+    { 800, 3 }, 
+    // list145 ::= list145 COMMA elem145
+    { 1051, 3 }, 
+    // list145 ::= elem145
+    { 1051, 1 }, 
+    // elem145 ::= ATOM145
+    { 801, 1 }, 
+    // elem145 ::= LP145 list146 RP145
+    { 801, 3 }, 
+    // list146 ::= list146 COMMA elem146
+    { 1052, 3 }, 
+    // list146 ::= elem146
+    { 1052, 1 }, 
+    // elem146 ::= ATOM146
+    { 802, 1 }, 
+    // elem146 ::= LP146 list147 RP146
+    { 802, 3 }, 
+    // list147 ::= list147 COMMA elem147
+    { 1053, 3 }, 
+    // list147 ::= elem147
+    { 1053, 1 }, 
+    // elem147 ::= ATOM147
+    { 803, 1 }, 
+    // elem147 ::= LP147 list148 RP147
+    { 803, 3 }, 
+    // list148 ::= list148 COMMA elem148
+    { 1054, 3 }, 
+    // list148 ::= elem148
+    { 1054, 1 }, 
+    // elem148 ::= ATOM148
+    { 804, 1 }, 
+    // elem148 ::= LP148 list149 RP148
+    { 804, 3 }, 
+    // list149 ::= list149 COMMA elem149
+    { 1055, 3 }, 
+    // list149 ::= elem149
+    { 1055, 1 }, 
+    // elem149 ::= ATOM149
+    { 805, 1 }, 
+    // elem149 ::= LP149 list150 RP149
+    { 805, 3 }, 
+    // list150 ::= list150 COMMA elem150
+    { 1057, 3 }, 
+    // list150 ::= elem150
+    { 1057, 1 }, 
+    // elem150 ::= ATOM150
+    { 807, 1 }, 
+    // elem150 ::= LP150 list151 RP150
+    { 807, 3 }, 
+    // list151 ::= list151 COMMA elem151
+    { 1058, 3 }, 
+    // list151 ::= elem151
+    { 1058, 1 }, 
+    // elem151 ::= ATOM151
+    { 808, 1 }, 
+    // elem151 ::= LP151 list152 RP151
+    { 808, 3 }, 
+    // list152 ::= list152 COMMA elem152
+    { 1059, 3 }, 
+    // list152 ::= elem152
+    { 1059, 1 }, 
+    // elem152 ::= ATOM152
+    { 809, 1 }, 
+    // elem152 ::= LP152 list153 RP152
+    { 809, 3 }, 
+    // list153 ::= list153 COMMA elem153
+    { 1060, 3 }, 
+    // list153 ::= elem153
+    { 1060, 1 }, 
+    // elem153 ::= ATOM153
+    { 810, 1 }, 
+    // elem153 ::= LP153 list154 RP153
+    { 810, 3 }, 
+    // list154 ::= list154 COMMA elem154
+    { 1061, 3 }, 
+    // list154 ::= elem154
+    { 1061, 1 }, 
+    // elem154 ::= ATOM154
+    { 811, 1 }, 
+    // elem154 ::= LP154 list155 RP154
+    { 811, 3 }, 
+    // list155 ::= list155 COMMA elem155
+    { 1062, 3 }, 
+    // list155 ::= elem155
+    { 1062, 1 }, 
+    // elem155 ::= ATOM155
+    { 812, 1 }, 
+    // elem155 ::= LP155 list156 RP155
+    { 812, 3 }, 
+    // list156 ::= list156 COMMA elem156
+    { 1063, 3 }, 
+    // list156 ::= elem156
+    { 1063, 1 }, 
+    // elem156 ::= ATOM156
+    { 813, 1 }, 
+    // elem156 ::= LP156 list157 RP156
+    { 813, 3 }, 
+    // list157 ::= list157 COMMA elem157
+    { 1064, 3 }, 
+    // list157 ::= elem157
+    { 1064, 1 }, 
+    // elem157 ::= ATOM157
+    { 814, 1 }, 
+    // elem157 ::= LP157 list158 RP157
+    { 814, 3 }, 
+    // list158 ::= list158 COMMA elem158
+    { 1065, 3 }, 
+    // list158 ::= elem158
+    { 1065, 1 }, 
+    // elem158 ::= ATOM158
+    { 815, 1 }, 
+    // elem158 ::= LP158 list159 RP158
+    { 815, 3 }, 
+    // list159 ::= list159 COMMA elem159
+    { 1066, 3 }, 
+    // list159 ::= elem159
+    { 1066, 1 }, 
+    // elem159 ::= ATOM159
+    { 816, 1 }, 
+    // elem159 ::= LP159 list160 RP159
+    { 816, 3 }, 
+    // list160 ::= list160 COMMA elem160
+    { 1068, 3 }, 
+    // list160 ::= elem160
+    { 1068, 1 }, 
+    // elem160 ::= ATOM160
+    { 818, 1 }, 
+    // elem160 ::= LP160 list161 RP160
+    { 818, 3 }, 
+    // list161 ::= list161 COMMA elem161
+    { 1069, 3 }, 
+    // list161 ::= elem161
+    { 1069, 1 }, 
+    // elem161 ::= ATOM161
+    { 819, 1 }, 
+    // elem161 ::= LP161 list162 RP161
+    { 819, 3 }, 
+    // list162 ::= list162 COMMA elem162
+    { 1070, 3 }, 
+    // list162 ::= elem162
+    { 1070, 1 }, 
+    // elem162 ::= ATOM162
+    { 820, 1 }, 
+    // elem162 ::= LP162 list163 RP162
+    { 820, 3 }, 
+    // list163 ::= list163 COMMA elem163
+    { 1071, 3 }, 
+    // list163 ::= elem163
+    { 1071, 1 }, 
+    // elem163 ::= ATOM163
+    { 821, 1 }, 
+    // elem163 ::= LP163 list164 RP163
+    { 821, 3 }, 
+    // list164 ::= list164 COMMA elem164
+    { 1072, 3 }, 
+    // list164 ::= elem164
+    { 1072, 1 }, 
+    // elem164 ::= ATOM164
+    { 822, 1 }, 
+    // elem164 ::= LP164 list165 RP164
+    { 822, 3 }, 
+    // list165 ::= list165 COMMA elem165
+    { 1073, 3 }, 
+    // list165 ::= elem165
+    { 1073, 1 }, 
+    // elem165 ::= ATOM165
+    { 823, 1 }, 
+    // elem165 ::= LP165 list166 RP165
+    { 823, 3 }, 
+    // list166 ::= list166 COMMA elem166
+    { 1074, 3 }, 
+    // list166 ::= elem166
+    { 1074, 1 }, 
+    // elem166 ::= ATOM166
+    { 824, 1 }, 
+    // elem166 ::= LP166 list167 RP166
+    { 824, 3 }, 
+    // list167 ::= list167 COMMA elem167
+    { 1075, 3 }, 
+    // list167 ::= elem167
+    { 1075, 1 }, 
+    // elem167 ::= ATOM167
+    { 825, 1 }, 
+    // elem167 ::= LP167 list168 RP167
+    { 825, 3 }, 
+    // list168 ::= list168 COMMA elem168
+    { 1076, 3 }, 
+    // list168 ::= elem168
+    { 1076, 1 }, 
+    // elem168 ::= ATOM168
+    { 826, 1 }, 
+    // elem168 ::= LP168 list169 RP168
+    { 826, 3 }, 
+    // list169 ::= list169 COMMA elem169
+    { 1077, 3 }, 
+    // list169 ::= elem169
+    { 1077, 1 }, 
+    // elem169 ::= ATOM169
+    { 827, 1 }, 
+    // elem169 ::= LP169 list170 RP169
+    { 827, 3 }, 
+    // list170 ::= list170 COMMA elem170
+    { 1079, 3 }, 
+    // list170 ::= elem170
+    { 1079, 1 }, 
+    // elem170 ::= ATOM170
+    { 829, 1 }, 
+    // elem170 ::= LP170 list171 RP170
+    { 829, 3 }, 
+    // list171 ::= list171 COMMA elem171
+    { 1080, 3 }, 
+    // list171 ::= elem171
+    { 1080, 1 }, 
+    // elem171 ::= ATOM171
+    { 830, 1 }, 
+    // elem171 ::= LP171 list172 RP171
+    { 830, 3 }, 
+    // list172 ::= list172 COMMA elem172
+    { 1081, 3 }, 
+    // list172 ::= elem172
+    { 1081, 1 }, 
+    // elem172 ::= ATOM172
+    { 831, 1 }, 
+    // elem172 ::= LP172 list173 RP172
+    { 831, 3 }, 
+    // list173 ::= list173 COMMA elem173
+    { 1082, 3 }, 
+    // list173 ::= elem173
+    { 1082, 1 }, 
+    // elem173 ::= ATOM173
+    { 832, 1 }, 
+    // elem173 ::= LP173 list174 RP173
+    { 832, 3 }, 
+    // list174 ::= list174 COMMA elem174
+    { 1083, 3 }, 
+    // list174 ::= elem174
+    { 1083, 1 }, 
+    // elem174 ::= ATOM174
+    { 833, 1 }, 
+    // elem174 ::= LP174 list175 RP174
+    { 833, 3 }, 
+    // list175 ::= list175 COMMA elem175
+    { 1084, 3 }, 
+    // list175 ::= elem175
+    { 1084, 1 }, 
+    // elem175 ::= ATOM175
+    { 834, 1 }, 
+    // elem175 ::= LP175 list176 RP175
+    { 834, 3 }, 
+    // list176 ::= list176 COMMA elem176
+    { 1085, 3 }, 
+    // list176 ::= elem176
+    { 1085, 1 }, 
+    // elem176 ::= ATOM176
+    { 835, 1 }, 
+    // elem176 ::= LP176 list177 RP176
+    { 835, 3 }, 
+    // list177 ::= list177 COMMA elem177
+    { 1086, 3 }, 
+    // list177 ::= elem177
+    { 1086, 1 }, 
+    // elem177 ::= ATOM177
+    { 836, 1 }, 
+    // elem177 ::= LP177 list178 RP177
+    { 836, 3 }, 
+    // list178 ::= list178 COMMA elem178
+    { 1087, 3 }, 
+    // list178 ::= elem178
+    { 1087, 1 }, 
+    // elem178 ::= ATOM178
+    { 837, 1 }, 
+    // elem178 ::= LP178 list179 RP178
+    { 837, 3 }, 
+    // list179 ::= list179 COMMA elem179
+    { 1088, 3 }, 
+    // list179 ::= elem179
+    { 1088, 1 }, 
+    // elem179 ::= ATOM179
+    { 838, 1 }, 
+    // elem179 ::= LP179 list180 RP179
+    { 838, 3 }, 
+    // list180 ::= list180 COMMA elem180
+    { 1090, 3 }, 
+    // list180 ::= elem180
+    { 1090, 1 }, 
+    // elem180 ::= ATOM180
+    { 840, 1 }, 
+    // elem180 ::= LP180 list181 RP180
+    { 840, 3 }, 
+    // list181 ::= list181 COMMA elem181
+    { 1091, 3 }, 
+    // list181 ::= elem181
+    { 1091, 1 }, 
+    // elem181 ::= ATOM181
+    { 841, 1 }, 
+    // elem181 ::= LP181 list182 RP181
+    { 841, 3 }, 
+    // list182 ::= list182 COMMA elem182
+    { 1092, 3 }, 
+    // list182 ::= elem182
+    { 1092, 1 }, 
+    // elem182 ::= ATOM182
+    { 842, 1 }, 
+    // elem182 ::= LP182 list183 RP182
+    { 842, 3 }, 
+    // list183 ::= list183 COMMA elem183
+    { 1093, 3 }, 
+    // list183 ::= elem183
+    { 1093, 1 }, 
+    // elem183 ::= ATOM183
+    { 843, 1 }, 
+    // elem183 ::= LP183 list184 RP183
+    { 843, 3 }, 
+    // list184 ::= list184 COMMA elem184
+    { 1094, 3 }, 
+    // list184 ::= elem184
+    { 1094, 1 }, 
+    // elem184 ::= ATOM184
+    { 844, 1 }, 
+    // elem184 ::= LP184 list185 RP184
+    { 844, 3 }, 
+    // list185 ::= list185 COMMA elem185
+    { 1095, 3 }, 
+    // list185 ::= elem185
+    { 1095, 1 }, 
+    // elem185 ::= ATOM185
+    { 845, 1 }, 
+    // elem185 ::= LP185 list186 RP185
+    { 845, 3 }, 
+    // list186 ::= list186 COMMA elem186
+    { 1096, 3 }, 
+    // list186 ::= elem186
+    { 1096, 1 }, 
+    // elem186 ::= ATOM186
+    { 846, 1 }, 
+    // elem186 ::= LP186 list187 RP186
+    { 846, 3 }, 
+    // list187 ::= list187 COMMA elem187
+    { 1097, 3 }, 
+    // list187 ::= elem187
+    { 1097, 1 }, 
+    // elem187 ::= ATOM187
+    { 847, 1 }, 
+    // elem187 ::= LP187 list188 RP187
+    { 847, 3 }, 
+    // list188 ::= list188 COMMA elem188
+    { 1098, 3 }, 
+    // list188 ::= elem188
+    { 1098, 1 }, 
+    // elem188 ::= ATOM188
+    { 848, 1 }, 
+    // elem188 ::= LP188 list189 RP188
+    { 848, 3 }, 
+    // list189 ::= list189 COMMA elem189
+    { 1099, 3 }, 
+    // list189 ::= elem189
+    { 1099, 1 }, 
+    // elem189 ::= ATOM189
+    { 849, 1 }, 
+    // elem189 ::= LP189 list190 RP189
+    { 849, 3 }, 
+    // list190 ::= list190 COMMA elem190
+    { 1101, 3 }, 
+    // list190 ::= elem190
+    { 1101, 1 }, 
+    // elem190 ::= ATOM190
+    { 851, 1 }, 
+    // elem190 ::= LP190 list191 RP190
+    { 851, 3 }, 
+    // list191 ::= list191 COMMA elem191
+    { 1102, 3 }, 
+    // list191 ::= elem191
+    { 1102, 1 }, 
+    // elem191 ::= ATOM191
+    { 852, 1 }, 
+    // elem191 ::= LP191 list192 RP191
+    { 852, 3 }, 
+    // list192 ::= list192 COMMA elem192
+    { 1103, 3 }, 
+    // list192 ::= elem192
+    { 1103, 1 }, 
+    // elem192 ::= ATOM192
+    { 853, 1 }, 
+    // elem192 ::= LP192 list193 RP192
+    { 853, 3 }, 
+    // list193 ::= list193 COMMA elem193
+    { 1104, 3 }, 
+    // list193 ::= elem193
+    { 1104, 1 }, 
+    // elem193 ::= ATOM193
+    { 854, 1 }, 
+    // elem193 ::= LP193 list194 RP193
+    { 854, 3 }, 
+    // list194 ::= list194 COMMA elem194
+    { 1105, 3 }, 
+    // list194 ::= elem194
+    { 1105, 1 }, 
+    // elem194 ::= ATOM194
+    { 855, 1 }, 
+    // elem194 ::= LP194 list195 RP194
+    { 855, 3 }, 
+    // list195 ::= list195 COMMA elem195
+    { 1106, 3 }, 
+    // list195 ::= elem195
+    { 1106, 1 }, 
+    // elem195 ::= ATOM195
+    { 856, 1 }, 
+    // elem195 ::= LP195 list196 RP195
+    { 856, 3 }, 
+    // list196 ::= list196 COMMA elem196
+    { 1107, 3 }, 
+    // list196 ::= elem196
+    { 1107, 1 }, 
+    // elem196 ::= ATOM196
+    { 857, 1 }, 
+    // elem196 ::= LP196 list197 RP196
+    { 857, 3 }, 
+    // list197 ::= list197 COMMA elem197
+    { 1108, 3 }, 
+    // list197 ::= elem197
+    { 1108, 1 }, 
+    // elem197 ::= ATOM197
+    { 858, 1 }, 
+    // elem197 ::= LP197 list198 RP197
+    { 858, 3 }, 
+    // list198 ::= list198 COMMA elem198
+    { 1109, 3 }, 
+    // list198 ::= elem198
+    { 1109, 1 }, 
+    // elem198 ::= ATOM198
+    { 859, 1 }, 
+    // elem198 ::= LP198 list199 RP198
+    { 859, 3 }, 
+    // list199 ::= list199 COMMA elem199
+    { 1110, 3 }, 
+    // list199 ::= elem199
+    { 1110, 1 }, 
+    // elem199 ::= ATOM199
+    { 860, 1 }, 
+    // elem199 ::= LP199 list200 RP199
+    { 860, 3 }, 
+    // list200 ::= list200 COMMA elem200
+    { 1113, 3 }, 
+    // list200 ::= elem200
+    { 1113, 1 }, 
+    // elem200 ::= ATOM200
+    { 863, 1 }, 
+    // elem200 ::= LP200 list201 RP200
+    { 863, 3 }, 
+    // list201 ::= list201 COMMA elem201
+    { 1114, 3 }, 
+    // list201 ::= elem201
+    { 1114, 1 }, 
+    // elem201 ::= ATOM201
+    { 864, 1 }, 
+    // elem201 ::= LP201 list202 RP201
+    { 864, 3 }, 
+    // list202 ::= list202 COMMA elem202
+    { 1115, 3 }, 
+    // list202 ::= elem202
+    { 1115, 1 }, 
+    // elem202 ::= ATOM202
+    { 865, 1 }, 
+    // elem202 ::= LP202 list203 RP202
+    { 865, 3 }, 
+    // list203 ::= list203 COMMA elem203
+    { 1116, 3 }, 
+    // list203 ::= elem203
+    { 1116, 1 }, 
+    // elem203 ::= ATOM203
+    { 866, 1 }, 
+    // elem203 ::= LP203 list204 RP203
+    { 866, 3 }, 
+    // list204 ::= list204 COMMA elem204
+    { 1117, 3 }, 
+    // list204 ::= elem204
+    { 1117, 1 }, 
+    // elem204 ::= ATOM204
+    { 867, 1 }, 
+    // elem204 ::= LP204 list205 RP204
+    { 867, 3 }, 
+    // list205 ::= list205 COMMA elem205
+    { 1118, 3 }, 
+    // list205 ::= elem205
+    { 1118, 1 }, 
+    // elem205 ::= ATOM205
+    { 868, 1 }, 
+    // elem205 ::= LP205 list206 RP205
+    { 868, 3 }, 
+    // list206 ::= list206 COMMA elem206
+    { 1119, 3 }, 
+    // list206 ::= elem206
+    { 1119, 1 }, 
+    // elem206 ::= ATOM206
+    { 869, 1 }, 
+    // elem206 ::= LP206 list207 RP206
+    { 869, 3 }, 
+    // list207 ::= list207 COMMA elem207
+    { 1120, 3 }, 
+    // list207 ::= elem207
+    { 1120, 1 }, 
+    // elem207 ::= ATOM207
+    { 870, 1 }, 
+    // elem207 ::= LP207 list208 RP207
+    { 870, 3 }, 
+    // list208 ::= list208 COMMA elem208
+    { 1121, 3 }, 
+    // list208 ::= elem208
+    { 1121, 1 }, 
+    // elem208 ::= ATOM208
+    { 871, 1 }, 
+    // elem208 ::= LP208 list209 RP208
+    { 871, 3 }, 
+    // list209 ::= list209 COMMA elem209
+    { 1122, 3 }, 
+    // list209 ::= elem209
+    { 1122, 1 }, 
+    // elem209 ::= ATOM209
+    { 872, 1 }, 
+    // elem209 ::= LP209 list210 RP209
+    { 872, 3 }, 
+    // list210 ::= list210 COMMA elem210
+    { 1124, 3 }, 
+    // list210 ::= elem210
+    { 1124, 1 }, 
+    // elem210 ::= ATOM210
+    { 874, 1 }, 
+    // elem210 ::= LP210 list211 RP210
+    { 874, 3 }, 
+    // list211 ::= list211 COMMA elem211
+    { 1125, 3 }, 
+    // list211 ::= elem211
+    { 1125, 1 }, 
+    // elem211 ::= ATOM211
+    { 875, 1 }, 
+    // elem211 ::= LP211 list212 RP211
+    { 875, 3 }, 
+    // list212 ::= list212 COMMA elem212
+    { 1126, 3 }, 
+    // list212 ::= elem212
+    { 1126, 1 }, 
+    // elem212 ::= ATOM212
+    { 876, 1 }, 
+    // elem212 ::= LP212 list213 RP212
+    { 876, 3 }, 
+    // list213 ::= list213 COMMA elem213
+    { 1127, 3 }, 
+    // list213 ::= elem213
+    { 1127, 1 }, 
+    // elem213 ::= ATOM213
+    { 877, 1 }, 
+    // elem213 ::= LP213 list214 RP213
+    { 877, 3 }, 
+    // list214 ::= list214 COMMA elem214
+    { 1128, 3 }, 
+    // list214 ::= elem214
+    { 1128, 1 }, 
+    // elem214 ::= ATOM214
+    { 878, 1 }, 
+    // elem214 ::= LP214 list215 RP214
+    { 878, 3 }, 
+    // list215 ::= list215 COMMA elem215
+    { 1129, 3 }, 
+    // list215 ::= elem215
+    { 1129, 1 }, 
+    // elem215 ::= ATOM215
+    { 879, 1 }, 
+    // elem215 ::= LP215 list216 RP215
+    { 879, 3 }, 
+    // list216 ::= list216 COMMA elem216
+    { 1130, 3 }, 
+    // list216 ::= elem216
+    { 1130, 1 }, 
+    // elem216 ::= ATOM216
+    { 880, 1 }, 
+    // elem216 ::= LP216 list217 RP216
+    { 880, 3 }, 
+    // list217 ::= list217 COMMA elem217
+    { 1131, 3 }, 
+    // list217 ::= elem217
+    { 1131, 1 }, 
+    // elem217 ::= ATOM217
+    { 881, 1 }, 
+    // elem217 ::= LP217 list218 RP217
+    { 881, 3 }, 
+    // list218 ::= list218 COMMA elem218
+    { 1132, 3 }, 
+    // list218 ::= elem218
+    { 1132, 1 }, 
+    // elem218 ::= ATOM218
+    { 882, 1 }, 
+    // elem218 ::= LP218 list219 RP218
+    { 882, 3 }, 
+    // list219 ::= list219 COMMA elem219
+    { 1133, 3 }, 
+    // list219 ::= elem219
+    { 1133, 1 }, 
+    // elem219 ::= ATOM219
+    { 883, 1 }, 
+    // elem219 ::= LP219 list220 RP219
+    { 883, 3 }, 
+    // list220 ::= list220 COMMA elem220
+    { 1135, 3 }, 
+    // list220 ::= elem220
+    { 1135, 1 }, 
+    // elem220 ::= ATOM220
+    { 885, 1 }, 
+    // elem220 ::= LP220 list221 RP220
+    { 885, 3 }, 
+    // list221 ::= list221 COMMA elem221
+    { 1136, 3 }, 
+    // list221 ::= elem221
+    { 1136, 1 }, 
+    // elem221 ::= ATOM221
+    { 886, 1 }, 
+    // elem221 ::= LP221 list222 RP221
+    { 886, 3 }, 
+    // list222 ::= list222 COMMA elem222
+    { 1137, 3 }, 
+    // list222 ::= elem222
+    { 1137, 1 }, 
+    // elem222 ::= ATOM222
+    { 887, 1 }, 
+    // elem222 ::= LP222 list223 RP222
+    { 887, 3 }, 
+    // list223 ::= list223 COMMA elem223
+    { 1138, 3 }, 
+    // list223 ::= elem223
+    { 1138, 1 }, 
+    // elem223 ::= ATOM223
+    { 888, 1 }, 
+    // elem223 ::= LP223 list224 RP223
+    { 888, 3 }, 
+    // list224 ::= list224 COMMA elem224
+    { 1139, 3 }, 
+    // list224 ::= elem224
+    { 1139, 1 }, 
+    // elem224 ::= ATOM224
+    { 889, 1 }, 
+    // elem224 ::= LP224 list225 RP224
+    { 889, 3 }, 
+    // list225 ::= list225 COMMA elem225
+    { 1140, 3 }, 
+    // list225 ::= elem225
+    { 1140, 1 }, 
+    // elem225 ::= ATOM225
+    { 890, 1 }, 
+    // elem225 ::= LP225 list226 RP225
+    { 890, 3 }, 
+    // list226 ::= list226 COMMA elem226
+    { 1141, 3 }, 
+    // list226 ::= elem226
+    { 1141, 1 }, 
+    // elem226 ::= ATOM226
+    { 891, 1 }, 
+    // elem226 ::= LP226 list227 RP226
+    { 891, 3 }, 
+    // list227 ::= list227 COMMA elem227
+    { 1142, 3 }, 
+    // list227 ::= elem227
+    { 1142, 1 }, 
+    // elem227 ::= ATOM227
+    { 892, 1 }, 
+    // elem227 ::= LP227 list228 RP227
+    { 892, 3 }, 
+    // list228 ::= list228 COMMA elem228
+    { 1143, 3 }, 
+    // list228 ::= elem228
+    { 1143, 1 }, 
+    // elem228 ::= ATOM228
+    { 893, 1 }, 
+    // elem228 ::= LP228 list229 RP228
+    { 893, 3 }, 
+    // list229 ::= list229 COMMA elem229
+    { 1144, 3 }, 
+    // list229 ::= elem229
+    { 1144, 1 }, 
+    // elem229 ::= ATOM229
+    { 894, 1 }, 
+    // elem229 ::= LP229 list230 RP229
+    { 894, 3 }, 
+    // list230 ::= list230 COMMA elem230
+    { 1146, 3 }, 
+    // list230 ::= elem230
+    { 1146, 1 }, 
+    // elem230 ::= ATOM230
+    { 896, 1 }, 
+    // elem230 ::= LP230 list231 RP230
+    { 896, 3 }, 
+    // list231 ::= list231 COMMA elem231
+    { 1147, 3 }, 
+    // list231 ::= elem231
+    { 1147, 1 }, 
+    // elem231 ::= ATOM231
+    { 897, 1 }, 
+    // elem231 ::= LP231 list232 RP231
+    { 897, 3 }, 
+    // list232 ::= list232 COMMA elem232
+    { 1148, 3 }, 
+    // list232 ::= elem232
+    { 1148, 1 }, 
+    // elem232 ::= ATOM232
+    { 898, 1 }, 
+    // elem232 ::= LP232 list233 RP232
+    { 898, 3 }, 
+    // list233 ::= list233 COMMA elem233
+    { 1149, 3 }, 
+    // list233 ::= elem233
+    { 1149, 1 }, 
+    // elem233 ::= ATOM233
+    { 899, 1 }, 
+    // elem233 ::= LP233 list234 RP233
+    { 899, 3 }, 
+    // list234 ::= list234 COMMA elem234
+    { 1150, 3 }, 
+    // list234 ::= elem234
+    { 1150, 1 }, 
+    // elem234 ::= ATOM234
+    { 900, 1 }, 
+    // elem234 ::= LP234 list235 RP234
+    { 900, 3 }, 
+    // list235 ::= list235 COMMA elem235
+    { 1151, 3 }, 
+    // list235 ::= elem235
+    { 1151, 1 }, 
+    // elem235 ::= ATOM235
+    { 901, 1 }, 
+    // elem235 ::= LP235 list236 RP235
+    { 901, 3 }, 
+    // list236 ::= list236 COMMA elem236
+    { 1152, 3 }, 
+    // list236 ::= elem236
+    { 1152, 1 }, 
+    // elem236 ::= ATOM236
+    { 902, 1 }, 
+    // elem236 ::= LP236 list237 RP236
+    { 902, 3 }, 
+    // list237 ::= list237 COMMA elem237
+    { 1153, 3 }, 
+    // list237 ::= elem237
+    { 1153, 1 }, 
+    // elem237 ::= ATOM237
+    { 903, 1 }, 
+    // elem237 ::= LP237 list238 RP237
+    { 903, 3 }, 
+    // list238 ::= list238 COMMA elem238
+    { 1154, 3 }, 
+    // list238 ::= elem238
+    { 1154, 1 }, 
+    // elem238 ::= ATOM238
+    { 904, 1 }, 
+    // elem238 ::= LP238 list239 RP238
+    { 904, 3 }, 
+    // list239 ::= list239 COMMA elem239
+    { 1155, 3 }, 
+    // list239 ::= elem239
+    { 1155, 1 }, 
+    // elem239 ::= ATOM239
+    { 905, 1 }, 
+    // elem239 ::= LP239 list240 RP239
+    { 905, 3 }, 
+    // list240 ::= list240 COMMA elem240
+    { 1157, 3 }, 
+    // list240 ::= elem240
+    { 1157, 1 }, 
+    // elem240 ::= ATOM240
+    { 907, 1 }, 
+    // elem240 ::= LP240 list241 RP240
+    { 907, 3 }, 
+    // list241 ::= list241 COMMA elem241
+    { 1158, 3 }, 
+    // list241 ::= elem241
+    { 1158, 1 }, 
+    // elem241 ::= ATOM241
+    { 908, 1 }, 
+    // elem241 ::= LP241 list242 RP241
+    { 908, 3 }, 
+    // list242 ::= list242 COMMA elem242
+    { 1159, 3 }, 
+    // list242 ::= elem242
+    { 1159, 1 }, 
+    // elem242 ::= ATOM242
+    { 909, 1 }, 
+    // elem242 ::= LP242 list243 RP242
+    { 909, 3 }, 
+    // list243 ::= list243 COMMA elem243
+    { 1160, 3 }, 
+    // list243 ::= elem243
+    { 1160, 1 }, 
+    // elem243 ::= ATOM243
+    { 910, 1 }, 
+    // elem243 ::= LP243 list244 RP243
+    { 910, 3 }, 
+    // list244 ::= list244 COMMA elem244
+    { 1161, 3 }, 
+    // list244 ::= elem244
+    { 1161, 1 }, 
+    // elem244 ::= ATOM244
+    { 911, 1 }, 
+    // elem244 ::= LP244 list245 RP244
+    { 911, 3 }, 
+    // list245 ::= list245 COMMA elem245
+    { 1162, 3 }, 
+    // list245 ::= elem245
+    { 1162, 1 }, 
+    // elem245 ::= ATOM245
+    { 912, 1 }, 
+    // elem245 ::= LP245 list246 RP245
+    { 912, 3 }, 
+    // list246 ::= list246 COMMA elem246
+    { 1163, 3 }, 
+    // list246 ::= elem246
+    { 1163, 1 }, 
+    // elem246 ::= ATOM246
+    { 913, 1 }, 
+    // elem246 ::= LP246 list247 RP246
+    { 913, 3 }, 
+    // list247 ::= list247 COMMA elem247
+    { 1164, 3 }, 
+    // list247 ::= elem247
+    { 1164, 1 }, 
+    // elem247 ::= ATOM247
+    { 914, 1 }, 
+    // elem247 ::= LP247 list248 RP247
+    { 914, 3 }, 
+    // list248 ::= list248 COMMA elem248
+    { 1165, 3 }, 
+    // list248 ::= elem248
+    { 1165, 1 }, 
+    // elem248 ::= ATOM248
+    { 915, 1 }, 
+    // elem248 ::= LP248 RP248
+    { 915, 2 }, 
+};
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::initTables( void )
+{
+    myStates.assign( 1744, ActionMap() );
+    myStateDefaultActions.assign( 1744, ActionEntry(PA_ERROR,-2) );
+    for ( int i = 0; i < 4235; ++i )
+    {
+        if ( theStateTable[i][1] == -1 )
+            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+        else
+            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+    }
+
+
+    // Rule Table
+
+    myRules.reserve( 997 );
+    for ( int i = 0; i < 997; ++i )
+        myRules.push_back( RuleInfo( theRuleTable[i][0], theRuleTable[i][1] ) );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::syntaxError( Bench::Terminal tok, privBenchImpl::Value &data )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parseFailed( void )
+{
+}
@@ -0,0 +1,782 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        ATOM0 = 1,
+        ATOM1 = 2,
+        ATOM10 = 3,
+        ATOM100 = 4,
+        ATOM101 = 5,
+        ATOM102 = 6,
+        ATOM103 = 7,
+        ATOM104 = 8,
+        ATOM105 = 9,
+        ATOM106 = 10,
+        ATOM107 = 11,
+        ATOM108 = 12,
+        ATOM109 = 13,
+        ATOM11 = 14,
+        ATOM110 = 15,
+        ATOM111 = 16,
+        ATOM112 = 17,
+        ATOM113 = 18,
+        ATOM114 = 19,
+        ATOM115 = 20,
+        ATOM116 = 21,
+        ATOM117 = 22,
+        ATOM118 = 23,
+        ATOM119 = 24,
+        ATOM12 = 25,
+        ATOM120 = 26,
+        ATOM121 = 27,
+        ATOM122 = 28,
+        ATOM123 = 29,
+        ATOM124 = 30,
+        ATOM125 = 31,
+        ATOM126 = 32,
+        ATOM127 = 33,
+        ATOM128 = 34,
+        ATOM129 = 35,
+        ATOM13 = 36,
+        ATOM130 = 37,
+        ATOM131 = 38,
+        ATOM132 = 39,
+        ATOM133 = 40,
+        ATOM134 = 41,
+        ATOM135 = 42,
+        ATOM136 = 43,
+        ATOM137 = 44,
+        ATOM138 = 45,
+        ATOM139 = 46,
+        ATOM14 = 47,
+        ATOM140 = 48,
+        ATOM141 = 49,
+        ATOM142 = 50,
+        ATOM143 = 51,
+        ATOM144 = 52,
+        ATOM145 = 53,
+        ATOM146 = 54,
+        ATOM147 = 55,
+        ATOM148 = 56,
+        ATOM149 = 57,
+        ATOM15 = 58,
+        ATOM150 = 59,
+        ATOM151 = 60,
+        ATOM152 = 61,
+        ATOM153 = 62,
+        ATOM154 = 63,
+        ATOM155 = 64,
+        ATOM156 = 65,
+        ATOM157 = 66,
+        ATOM158 = 67,
+        ATOM159 = 68,
+        ATOM16 = 69,
+        ATOM160 = 70,
+        ATOM161 = 71,
+        ATOM162 = 72,
+        ATOM163 = 73,
+        ATOM164 = 74,
+        ATOM165 = 75,
+        ATOM166 = 76,
+        ATOM167 = 77,
+        ATOM168 = 78,
+        ATOM169 = 79,
+        ATOM17 = 80,
+        ATOM170 = 81,
+        ATOM171 = 82,
+        ATOM172 = 83,
+        ATOM173 = 84,
+        ATOM174 = 85,
+        ATOM175 = 86,
+        ATOM176 = 87,
+        ATOM177 = 88,
+        ATOM178 = 89,
+        ATOM179 = 90,
+        ATOM18 = 91,
+        ATOM180 = 92,
+        ATOM181 = 93,
+        ATOM182 = 94,
+        ATOM183 = 95,
+        ATOM184 = 96,
+        ATOM185 = 97,
+        ATOM186 = 98,
+        ATOM187 = 99,
+        ATOM188 = 100,
+        ATOM189 = 101,
+        ATOM19 = 102,
+        ATOM190 = 103,
+        ATOM191 = 104,
+        ATOM192 = 105,
+        ATOM193 = 106,
+        ATOM194 = 107,
+        ATOM195 = 108,
+        ATOM196 = 109,
+        ATOM197 = 110,
+        ATOM198 = 111,
+        ATOM199 = 112,
+        ATOM2 = 113,
+        ATOM20 = 114,
+        ATOM200 = 115,
+        ATOM201 = 116,
+        ATOM202 = 117,
+        ATOM203 = 118,
+        ATOM204 = 119,
+        ATOM205 = 120,
+        ATOM206 = 121,
+        ATOM207 = 122,
+        ATOM208 = 123,
+        ATOM209 = 124,
+        ATOM21 = 125,
+        ATOM210 = 126,
+        ATOM211 = 127,
+        ATOM212 = 128,
+        ATOM213 = 129,
+        ATOM214 = 130,
+        ATOM215 = 131,
+        ATOM216 = 132,
+        ATOM217 = 133,
+        ATOM218 = 134,
+        ATOM219 = 135,
+        ATOM22 = 136,
+        ATOM220 = 137,
+        ATOM221 = 138,
+        ATOM222 = 139,
+        ATOM223 = 140,
+        ATOM224 = 141,
+        ATOM225 = 142,
+        ATOM226 = 143,
+        ATOM227 = 144,
+        ATOM228 = 145,
+        ATOM229 = 146,
+        ATOM23 = 147,
+        ATOM230 = 148,
+        ATOM231 = 149,
+        ATOM232 = 150,
+        ATOM233 = 151,
+        ATOM234 = 152,
+        ATOM235 = 153,
+        ATOM236 = 154,
+        ATOM237 = 155,
+        ATOM238 = 156,
+        ATOM239 = 157,
+        ATOM24 = 158,
+        ATOM240 = 159,
+        ATOM241 = 160,
+        ATOM242 = 161,
+        ATOM243 = 162,
+        ATOM244 = 163,
+        ATOM245 = 164,
+        ATOM246 = 165,
+        ATOM247 = 166,
+        ATOM248 = 167,
+        ATOM25 = 168,
+        ATOM26 = 169,
+        ATOM27 = 170,
+        ATOM28 = 171,
+        ATOM29 = 172,
+        ATOM3 = 173,
+        ATOM30 = 174,
+        ATOM31 = 175,
+        ATOM32 = 176,
+        ATOM33 = 177,
+        ATOM34 = 178,
+        ATOM35 = 179,
+        ATOM36 = 180,
+        ATOM37 = 181,
+        ATOM38 = 182,
+        ATOM39 = 183,
+        ATOM4 = 184,
+        ATOM40 = 185,
+        ATOM41 = 186,
+        ATOM42 = 187,
+        ATOM43 = 188,
+        ATOM44 = 189,
+        ATOM45 = 190,
+        ATOM46 = 191,
+        ATOM47 = 192,
+        ATOM48 = 193,
+        ATOM49 = 194,
+        ATOM5 = 195,
+        ATOM50 = 196,
+        ATOM51 = 197,
+        ATOM52 = 198,
+        ATOM53 = 199,
+        ATOM54 = 200,
+        ATOM55 = 201,
+        ATOM56 = 202,
+        ATOM57 = 203,
+        ATOM58 = 204,
+        ATOM59 = 205,
+        ATOM6 = 206,
+        ATOM60 = 207,
+        ATOM61 = 208,
+        ATOM62 = 209,
+        ATOM63 = 210,
+        ATOM64 = 211,
+        ATOM65 = 212,
+        ATOM66 = 213,
+        ATOM67 = 214,
+        ATOM68 = 215,
+        ATOM69 = 216,
+        ATOM7 = 217,
+        ATOM70 = 218,
+        ATOM71 = 219,
+        ATOM72 = 220,
+        ATOM73 = 221,
+        ATOM74 = 222,
+        ATOM75 = 223,
+        ATOM76 = 224,
+        ATOM77 = 225,
+        ATOM78 = 226,
+        ATOM79 = 227,
+        ATOM8 = 228,
+        ATOM80 = 229,
+        ATOM81 = 230,
+        ATOM82 = 231,
+        ATOM83 = 232,
+        ATOM84 = 233,
+        ATOM85 = 234,
+        ATOM86 = 235,
+        ATOM87 = 236,
+        ATOM88 = 237,
+        ATOM89 = 238,
+        ATOM9 = 239,
+        ATOM90 = 240,
+        ATOM91 = 241,
+        ATOM92 = 242,
+        ATOM93 = 243,
+        ATOM94 = 244,
+        ATOM95 = 245,
+        ATOM96 = 246,
+        ATOM97 = 247,
+        ATOM98 = 248,
+        ATOM99 = 249,
+        COMMA = 250,
+        LP0 = 251,
+        LP1 = 252,
+        LP10 = 253,
+        LP100 = 254,
+        LP101 = 255,
+        LP102 = 256,
+        LP103 = 257,
+        LP104 = 258,
+        LP105 = 259,
+        LP106 = 260,
+        LP107 = 261,
+        LP108 = 262,
+        LP109 = 263,
+        LP11 = 264,
+        LP110 = 265,
+        LP111 = 266,
+        LP112 = 267,
+        LP113 = 268,
+        LP114 = 269,
+        LP115 = 270,
+        LP116 = 271,
+        LP117 = 272,
+        LP118 = 273,
+        LP119 = 274,
+        LP12 = 275,
+        LP120 = 276,
+        LP121 = 277,
+        LP122 = 278,
+        LP123 = 279,
+        LP124 = 280,
+        LP125 = 281,
+        LP126 = 282,
+        LP127 = 283,
+        LP128 = 284,
+        LP129 = 285,
+        LP13 = 286,
+        LP130 = 287,
+        LP131 = 288,
+        LP132 = 289,
+        LP133 = 290,
+        LP134 = 291,
+        LP135 = 292,
+        LP136 = 293,
+        LP137 = 294,
+        LP138 = 295,
+        LP139 = 296,
+        LP14 = 297,
+        LP140 = 298,
+        LP141 = 299,
+        LP142 = 300,
+        LP143 = 301,
+        LP144 = 302,
+        LP145 = 303,
+        LP146 = 304,
+        LP147 = 305,
+        LP148 = 306,
+        LP149 = 307,
+        LP15 = 308,
+        LP150 = 309,
+        LP151 = 310,
+        LP152 = 311,
+        LP153 = 312,
+        LP154 = 313,
+        LP155 = 314,
+        LP156 = 315,
+        LP157 = 316,
+        LP158 = 317,
+        LP159 = 318,
+        LP16 = 319,
+        LP160 = 320,
+        LP161 = 321,
+        LP162 = 322,
+        LP163 = 323,
+        LP164 = 324,
+        LP165 = 325,
+        LP166 = 326,
+        LP167 = 327,
+        LP168 = 328,
+        LP169 = 329,
+        LP17 = 330,
+        LP170 = 331,
+        LP171 = 332,
+        LP172 = 333,
+        LP173 = 334,
+        LP174 = 335,
+        LP175 = 336,
+        LP176 = 337,
+        LP177 = 338,
+        LP178 = 339,
+        LP179 = 340,
+        LP18 = 341,
+        LP180 = 342,
+        LP181 = 343,
+        LP182 = 344,
+        LP183 = 345,
+        LP184 = 346,
+        LP185 = 347,
+        LP186 = 348,
+        LP187 = 349,
+        LP188 = 350,
+        LP189 = 351,
+        LP19 = 352,
+        LP190 = 353,
+        LP191 = 354,
+        LP192 = 355,
+        LP193 = 356,
+        LP194 = 357,
+        LP195 = 358,
+        LP196 = 359,
+        LP197 = 360,
+        LP198 = 361,
+        LP199 = 362,
+        LP2 = 363,
+        LP20 = 364,
+        LP200 = 365,
+        LP201 = 366,
+        LP202 = 367,
+        LP203 = 368,
+        LP204 = 369,
+        LP205 = 370,
+        LP206 = 371,
+        LP207 = 372,
+        LP208 = 373,
+        LP209 = 374,
+        LP21 = 375,
+        LP210 = 376,
+        LP211 = 377,
+        LP212 = 378,
+        LP213 = 379,
+        LP214 = 380,
+        LP215 = 381,
+        LP216 = 382,
+        LP217 = 383,
+        LP218 = 384,
+        LP219 = 385,
+        LP22 = 386,
+        LP220 = 387,
+        LP221 = 388,
+        LP222 = 389,
+        LP223 = 390,
+        LP224 = 391,
+        LP225 = 392,
+        LP226 = 393,
+        LP227 = 394,
+        LP228 = 395,
+        LP229 = 396,
+        LP23 = 397,
+        LP230 = 398,
+        LP231 = 399,
+        LP232 = 400,
+        LP233 = 401,
+        LP234 = 402,
+        LP235 = 403,
+        LP236 = 404,
+        LP237 = 405,
+        LP238 = 406,
+        LP239 = 407,
+        LP24 = 408,
+        LP240 = 409,
+        LP241 = 410,
+        LP242 = 411,
+        LP243 = 412,
+        LP244 = 413,
+        LP245 = 414,
+        LP246 = 415,
+        LP247 = 416,
+        LP248 = 417,
+        LP25 = 418,
+        LP26 = 419,
+        LP27 = 420,
+        LP28 = 421,
+        LP29 = 422,
+        LP3 = 423,
+        LP30 = 424,
+        LP31 = 425,
+        LP32 = 426,
+        LP33 = 427,
+        LP34 = 428,
+        LP35 = 429,
+        LP36 = 430,
+        LP37 = 431,
+        LP38 = 432,
+        LP39 = 433,
+        LP4 = 434,
+        LP40 = 435,
+        LP41 = 436,
+        LP42 = 437,
+        LP43 = 438,
+        LP44 = 439,
+        LP45 = 440,
+        LP46 = 441,
+        LP47 = 442,
+        LP48 = 443,
+        LP49 = 444,
+        LP5 = 445,
+        LP50 = 446,
+        LP51 = 447,
+        LP52 = 448,
+        LP53 = 449,
+        LP54 = 450,
+        LP55 = 451,
+        LP56 = 452,
+        LP57 = 453,
+        LP58 = 454,
+        LP59 = 455,
+        LP6 = 456,
+        LP60 = 457,
+        LP61 = 458,
+        LP62 = 459,
+        LP63 = 460,
+        LP64 = 461,
+        LP65 = 462,
+        LP66 = 463,
+        LP67 = 464,
+        LP68 = 465,
+        LP69 = 466,
+        LP7 = 467,
+        LP70 = 468,
+        LP71 = 469,
+        LP72 = 470,
+        LP73 = 471,
+        LP74 = 472,
+        LP75 = 473,
+        LP76 = 474,
+        LP77 = 475,
+        LP78 = 476,
+        LP79 = 477,
+        LP8 = 478,
+        LP80 = 479,
+        LP81 = 480,
+        LP82 = 481,
+        LP83 = 482,
+        LP84 = 483,
+        LP85 = 484,
+        LP86 = 485,
+        LP87 = 486,
+        LP88 = 487,
+        LP89 = 488,
+        LP9 = 489,
+        LP90 = 490,
+        LP91 = 491,
+        LP92 = 492,
+        LP93 = 493,
+        LP94 = 494,
+        LP95 = 495,
+        LP96 = 496,
+        LP97 = 497,
+        LP98 = 498,
+        LP99 = 499,
+        RP0 = 500,
+        RP1 = 501,
+        RP10 = 502,
+        RP100 = 503,
+        RP101 = 504,
+        RP102 = 505,
+        RP103 = 506,
+        RP104 = 507,
+        RP105 = 508,
+        RP106 = 509,
+        RP107 = 510,
+        RP108 = 511,
+        RP109 = 512,
+        RP11 = 513,
+        RP110 = 514,
+        RP111 = 515,
+        RP112 = 516,
+        RP113 = 517,
+        RP114 = 518,
+        RP115 = 519,
+        RP116 = 520,
+        RP117 = 521,
+        RP118 = 522,
+        RP119 = 523,
+        RP12 = 524,
+        RP120 = 525,
+        RP121 = 526,
+        RP122 = 527,
+        RP123 = 528,
+        RP124 = 529,
+        RP125 = 530,
+        RP126 = 531,
+        RP127 = 532,
+        RP128 = 533,
+        RP129 = 534,
+        RP13 = 535,
+        RP130 = 536,
+        RP131 = 537,
+        RP132 = 538,
+        RP133 = 539,
+        RP134 = 540,
+        RP135 = 541,
+        RP136 = 542,
+        RP137 = 543,
+        RP138 = 544,
+        RP139 = 545,
+        RP14 = 546,
+        RP140 = 547,
+        RP141 = 548,
+        RP142 = 549,
+        RP143 = 550,
+        RP144 = 551,
+        RP145 = 552,
+        RP146 = 553,
+        RP147 = 554,
+        RP148 = 555,
+        RP149 = 556,
+        RP15 = 557,
+        RP150 = 558,
+        RP151 = 559,
+        RP152 = 560,
+        RP153 = 561,
+        RP154 = 562,
+        RP155 = 563,
+        RP156 = 564,
+        RP157 = 565,
+        RP158 = 566,
+        RP159 = 567,
+        RP16 = 568,
+        RP160 = 569,
+        RP161 = 570,
+        RP162 = 571,
+        RP163 = 572,
+        RP164 = 573,
+        RP165 = 574,
+        RP166 = 575,
+        RP167 = 576,
+        RP168 = 577,
+        RP169 = 578,
+        RP17 = 579,
+        RP170 = 580,
+        RP171 = 581,
+        RP172 = 582,
+        RP173 = 583,
+        RP174 = 584,
+        RP175 = 585,
+        RP176 = 586,
+        RP177 = 587,
+        RP178 = 588,
+        RP179 = 589,
+        RP18 = 590,
+        RP180 = 591,
+        RP181 = 592,
+        RP182 = 593,
+        RP183 = 594,
+        RP184 = 595,
+        RP185 = 596,
+        RP186 = 597,
+        RP187 = 598,
+        RP188 = 599,
+        RP189 = 600,
+        RP19 = 601,
+        RP190 = 602,
+        RP191 = 603,
+        RP192 = 604,
+        RP193 = 605,
+        RP194 = 606,
+        RP195 = 607,
+        RP196 = 608,
+        RP197 = 609,
+        RP198 = 610,
+        RP199 = 611,
+        RP2 = 612,
+        RP20 = 613,
+        RP200 = 614,
+        RP201 = 615,
+        RP202 = 616,
+        RP203 = 617,
+        RP204 = 618,
+        RP205 = 619,
+        RP206 = 620,
+        RP207 = 621,
+        RP208 = 622,
+        RP209 = 623,
+        RP21 = 624,
+        RP210 = 625,
+        RP211 = 626,
+        RP212 = 627,
+        RP213 = 628,
+        RP214 = 629,
+        RP215 = 630,
+        RP216 = 631,
+        RP217 = 632,
+        RP218 = 633,
+        RP219 = 634,
+        RP22 = 635,
+        RP220 = 636,
+        RP221 = 637,
+        RP222 = 638,
+        RP223 = 639,
+        RP224 = 640,
+        RP225 = 641,
+        RP226 = 642,
+        RP227 = 643,
+        RP228 = 644,
+        RP229 = 645,
+        RP23 = 646,
+        RP230 = 647,
+        RP231 = 648,
+        RP232 = 649,
+        RP233 = 650,
+        RP234 = 651,
+        RP235 = 652,
+        RP236 = 653,
+        RP237 = 654,
+        RP238 = 655,
+        RP239 = 656,
+        RP24 = 657,
+        RP240 = 658,
+        RP241 = 659,
+        RP242 = 660,
+        RP243 = 661,
+        RP244 = 662,
+        RP245 = 663,
+        RP246 = 664,
+        RP247 = 665,
+        RP248 = 666,
+        RP25 = 667,
+        RP26 = 668,
+        RP27 = 669,
+        RP28 = 670,
+        RP29 = 671,
+        RP3 = 672,
+        RP30 = 673,
+        RP31 = 674,
+        RP32 = 675,
+        RP33 = 676,
+        RP34 = 677,
+        RP35 = 678,
+        RP36 = 679,
+        RP37 = 680,
+        RP38 = 681,
+        RP39 = 682,
+        RP4 = 683,
+        RP40 = 684,
+        RP41 = 685,
+        RP42 = 686,
+        RP43 = 687,
+        RP44 = 688,
+        RP45 = 689,
+        RP46 = 690,
+        RP47 = 691,
+        RP48 = 692,
+        RP49 = 693,
+        RP5 = 694,
+        RP50 = 695,
+        RP51 = 696,
+        RP52 = 697,
+        RP53 = 698,
+        RP54 = 699,
+        RP55 = 700,
+        RP56 = 701,
+        RP57 = 702,
+        RP58 = 703,
+        RP59 = 704,
+        RP6 = 705,
+        RP60 = 706,
+        RP61 = 707,
+        RP62 = 708,
+        RP63 = 709,
+        RP64 = 710,
+        RP65 = 711,
+        RP66 = 712,
+        RP67 = 713,
+        RP68 = 714,
+        RP69 = 715,
+        RP7 = 716,
+        RP70 = 717,
+        RP71 = 718,
+        RP72 = 719,
+        RP73 = 720,
+        RP74 = 721,
+        RP75 = 722,
+        RP76 = 723,
+        RP77 = 724,
+        RP78 = 725,
+        RP79 = 726,
+        RP8 = 727,
+        RP80 = 728,
+        RP81 = 729,
+        RP82 = 730,
+        RP83 = 731,
+        RP84 = 732,
+        RP85 = 733,
+        RP86 = 734,
+        RP87 = 735,
+        RP88 = 736,
+        RP89 = 737,
+        RP9 = 738,
+        RP90 = 739,
+        RP91 = 740,
+        RP92 = 741,
+        RP93 = 742,
+        RP94 = 743,
+        RP95 = 744,
+        RP96 = 745,
+        RP97 = 746,
+        RP98 = 747,
+        RP99 = 748
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
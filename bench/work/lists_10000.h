@@ -0,0 +1,7532 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        ATOM0 = 1,
+        ATOM1 = 2,
+        ATOM10 = 3,
+        ATOM100 = 4,
+        ATOM1000 = 5,
+        ATOM1001 = 6,
+        ATOM1002 = 7,
+        ATOM1003 = 8,
+        ATOM1004 = 9,
+        ATOM1005 = 10,
+        ATOM1006 = 11,
+        ATOM1007 = 12,
+        ATOM1008 = 13,
+        ATOM1009 = 14,
+        ATOM101 = 15,
+        ATOM1010 = 16,
+        ATOM1011 = 17,
+        ATOM1012 = 18,
+        ATOM1013 = 19,
+        ATOM1014 = 20,
+        ATOM1015 = 21,
+        ATOM1016 = 22,
+        ATOM1017 = 23,
+        ATOM1018 = 24,
+        ATOM1019 = 25,
+        ATOM102 = 26,
+        ATOM1020 = 27,
+        ATOM1021 = 28,
+        ATOM1022 = 29,
+        ATOM1023 = 30,
+        ATOM1024 = 31,
+        ATOM1025 = 32,
+        ATOM1026 = 33,
+        ATOM1027 = 34,
+        ATOM1028 = 35,
+        ATOM1029 = 36,
+        ATOM103 = 37,
+        ATOM1030 = 38,
+        ATOM1031 = 39,
+        ATOM1032 = 40,
+        ATOM1033 = 41,
+        ATOM1034 = 42,
+        ATOM1035 = 43,
+        ATOM1036 = 44,
+        ATOM1037 = 45,
+        ATOM1038 = 46,
+        ATOM1039 = 47,
+        ATOM104 = 48,
+        ATOM1040 = 49,
+        ATOM1041 = 50,
+        ATOM1042 = 51,
+        ATOM1043 = 52,
+        ATOM1044 = 53,
+        ATOM1045 = 54,
+        ATOM1046 = 55,
+        ATOM1047 = 56,
+        ATOM1048 = 57,
+        ATOM1049 = 58,
+        ATOM105 = 59,
+        ATOM1050 = 60,
+        ATOM1051 = 61,
+        ATOM1052 = 62,
+        ATOM1053 = 63,
+        ATOM1054 = 64,
+        ATOM1055 = 65,
+        ATOM1056 = 66,
+        ATOM1057 = 67,
+        ATOM1058 = 68,
+        ATOM1059 = 69,
+        ATOM106 = 70,
+        ATOM1060 = 71,
+        ATOM1061 = 72,
+        ATOM1062 = 73,
+        ATOM1063 = 74,
+        ATOM1064 = 75,
+        ATOM1065 = 76,
+        ATOM1066 = 77,
+        ATOM1067 = 78,
+        ATOM1068 = 79,
+        ATOM1069 = 80,
+        ATOM107 = 81,
+        ATOM1070 = 82,
+        ATOM1071 = 83,
+        ATOM1072 = 84,
+        ATOM1073 = 85,
+        ATOM1074 = 86,
+        ATOM1075 = 87,
+        ATOM1076 = 88,
+        ATOM1077 = 89,
+        ATOM1078 = 90,
+        ATOM1079 = 91,
+        ATOM108 = 92,
+        ATOM1080 = 93,
+        ATOM1081 = 94,
+        ATOM1082 = 95,
+        ATOM1083 = 96,
+        ATOM1084 = 97,
+        ATOM1085 = 98,
+        ATOM1086 = 99,
+        ATOM1087 = 100,
+        ATOM1088 = 101,
+        ATOM1089 = 102,
+        ATOM109 = 103,
+        ATOM1090 = 104,
+        ATOM1091 = 105,
+        ATOM1092 = 106,
+        ATOM1093 = 107,
+        ATOM1094 = 108,
+        ATOM1095 = 109,
+        ATOM1096 = 110,
+        ATOM1097 = 111,
+        ATOM1098 = 112,
+        ATOM1099 = 113,
+        ATOM11 = 114,
+        ATOM110 = 115,
+        ATOM1100 = 116,
+        ATOM1101 = 117,
+        ATOM1102 = 118,
+        ATOM1103 = 119,
+        ATOM1104 = 120,
+        ATOM1105 = 121,
+        ATOM1106 = 122,
+        ATOM1107 = 123,
+        ATOM1108 = 124,
+        ATOM1109 = 125,
+        ATOM111 = 126,
+        ATOM1110 = 127,
+        ATOM1111 = 128,
+        ATOM1112 = 129,
+        ATOM1113 = 130,
+        ATOM1114 = 131,
+        ATOM1115 = 132,
+        ATOM1116 = 133,
+        ATOM1117 = 134,
+        ATOM1118 = 135,
+        ATOM1119 = 136,
+        ATOM112 = 137,
+        ATOM1120 = 138,
+        ATOM1121 = 139,
+        ATOM1122 = 140,
+        ATOM1123 = 141,
+        ATOM1124 = 142,
+        ATOM1125 = 143,
+        ATOM1126 = 144,
+        ATOM1127 = 145,
+        ATOM1128 = 146,
+        ATOM1129 = 147,
+        ATOM113 = 148,
+        ATOM1130 = 149,
+        ATOM1131 = 150,
+        ATOM1132 = 151,
+        ATOM1133 = 152,
+        ATOM1134 = 153,
+        ATOM1135 = 154,
+        ATOM1136 = 155,
+        ATOM1137 = 156,
+        ATOM1138 = 157,
+        ATOM1139 = 158,
+        ATOM114 = 159,
+        ATOM1140 = 160,
+        ATOM1141 = 161,
+        ATOM1142 = 162,
+        ATOM1143 = 163,
+        ATOM1144 = 164,
+        ATOM1145 = 165,
+        ATOM1146 = 166,
+        ATOM1147 = 167,
+        ATOM1148 = 168,
+        ATOM1149 = 169,
+        ATOM115 = 170,
+        ATOM1150 = 171,
+        ATOM1151 = 172,
+        ATOM1152 = 173,
+        ATOM1153 = 174,
+        ATOM1154 = 175,
+        ATOM1155 = 176,
+        ATOM1156 = 177,
+        ATOM1157 = 178,
+        ATOM1158 = 179,
+        ATOM1159 = 180,
+        ATOM116 = 181,
+        ATOM1160 = 182,
+        ATOM1161 = 183,
+        ATOM1162 = 184,
+        ATOM1163 = 185,
+        ATOM1164 = 186,
+        ATOM1165 = 187,
+        ATOM1166 = 188,
+        ATOM1167 = 189,
+        ATOM1168 = 190,
+        ATOM1169 = 191,
+        ATOM117 = 192,
+        ATOM1170 = 193,
+        ATOM1171 = 194,
+        ATOM1172 = 195,
+        ATOM1173 = 196,
+        ATOM1174 = 197,
+        ATOM1175 = 198,
+        ATOM1176 = 199,
+        ATOM1177 = 200,
+        ATOM1178 = 201,
+        ATOM1179 = 202,
+        ATOM118 = 203,
+        ATOM1180 = 204,
+        ATOM1181 = 205,
+        ATOM1182 = 206,
+        ATOM1183 = 207,
+        ATOM1184 = 208,
+        ATOM1185 = 209,
+        ATOM1186 = 210,
+        ATOM1187 = 211,
+        ATOM1188 = 212,
+        ATOM1189 = 213,
+        ATOM119 = 214,
+        ATOM1190 = 215,
+        ATOM1191 = 216,
+        ATOM1192 = 217,
+        ATOM1193 = 218,
+        ATOM1194 = 219,
+        ATOM1195 = 220,
+        ATOM1196 = 221,
+        ATOM1197 = 222,
+        ATOM1198 = 223,
+        ATOM1199 = 224,
+        ATOM12 = 225,
+        ATOM120 = 226,
+        ATOM1200 = 227,
+        ATOM1201 = 228,
+        ATOM1202 = 229,
+        ATOM1203 = 230,
+        ATOM1204 = 231,
+        ATOM1205 = 232,
+        ATOM1206 = 233,
+        ATOM1207 = 234,
+        ATOM1208 = 235,
+        ATOM1209 = 236,
+        ATOM121 = 237,
+        ATOM1210 = 238,
+        ATOM1211 = 239,
+        ATOM1212 = 240,
+        ATOM1213 = 241,
+        ATOM1214 = 242,
+        ATOM1215 = 243,
+        ATOM1216 = 244,
+        ATOM1217 = 245,
+        ATOM1218 = 246,
+        ATOM1219 = 247,
+        ATOM122 = 248,
+        ATOM1220 = 249,
+        ATOM1221 = 250,
+        ATOM1222 = 251,
+        ATOM1223 = 252,
+        ATOM1224 = 253,
+        ATOM1225 = 254,
+        ATOM1226 = 255,
+        ATOM1227 = 256,
+        ATOM1228 = 257,
+        ATOM1229 = 258,
+        ATOM123 = 259,
+        ATOM1230 = 260,
+        ATOM1231 = 261,
+        ATOM1232 = 262,
+        ATOM1233 = 263,
+        ATOM1234 = 264,
+        ATOM1235 = 265,
+        ATOM1236 = 266,
+        ATOM1237 = 267,
+        ATOM1238 = 268,
+        ATOM1239 = 269,
+        ATOM124 = 270,
+        ATOM1240 = 271,
+        ATOM1241 = 272,
+        ATOM1242 = 273,
+        ATOM1243 = 274,
+        ATOM1244 = 275,
+        ATOM1245 = 276,
+        ATOM1246 = 277,
+        ATOM1247 = 278,
+        ATOM1248 = 279,
+        ATOM1249 = 280,
+        ATOM125 = 281,
+        ATOM1250 = 282,
+        ATOM1251 = 283,
+        ATOM1252 = 284,
+        ATOM1253 = 285,
+        ATOM1254 = 286,
+        ATOM1255 = 287,
+        ATOM1256 = 288,
+        ATOM1257 = 289,
+        ATOM1258 = 290,
+        ATOM1259 = 291,
+        ATOM126 = 292,
+        ATOM1260 = 293,
+        ATOM1261 = 294,
+        ATOM1262 = 295,
+        ATOM1263 = 296,
+        ATOM1264 = 297,
+        ATOM1265 = 298,
+        ATOM1266 = 299,
+        ATOM1267 = 300,
+        ATOM1268 = 301,
+        ATOM1269 = 302,
+        ATOM127 = 303,
+        ATOM1270 = 304,
+        ATOM1271 = 305,
+        ATOM1272 = 306,
+        ATOM1273 = 307,
+        ATOM1274 = 308,
+        ATOM1275 = 309,
+        ATOM1276 = 310,
+        ATOM1277 = 311,
+        ATOM1278 = 312,
+        ATOM1279 = 313,
+        ATOM128 = 314,
+        ATOM1280 = 315,
+        ATOM1281 = 316,
+        ATOM1282 = 317,
+        ATOM1283 = 318,
+        ATOM1284 = 319,
+        ATOM1285 = 320,
+        ATOM1286 = 321,
+        ATOM1287 = 322,
+        ATOM1288 = 323,
+        ATOM1289 = 324,
+        ATOM129 = 325,
+        ATOM1290 = 326,
+        ATOM1291 = 327,
+        ATOM1292 = 328,
+        ATOM1293 = 329,
+        ATOM1294 = 330,
+        ATOM1295 = 331,
+        ATOM1296 = 332,
+        ATOM1297 = 333,
+        ATOM1298 = 334,
+        ATOM1299 = 335,
+        ATOM13 = 336,
+        ATOM130 = 337,
+        ATOM1300 = 338,
+        ATOM1301 = 339,
+        ATOM1302 = 340,
+        ATOM1303 = 341,
+        ATOM1304 = 342,
+        ATOM1305 = 343,
+        ATOM1306 = 344,
+        ATOM1307 = 345,
+        ATOM1308 = 346,
+        ATOM1309 = 347,
+        ATOM131 = 348,
+        ATOM1310 = 349,
+        ATOM1311 = 350,
+        ATOM1312 = 351,
+        ATOM1313 = 352,
+        ATOM1314 = 353,
+        ATOM1315 = 354,
+        ATOM1316 = 355,
+        ATOM1317 = 356,
+        ATOM1318 = 357,
+        ATOM1319 = 358,
+        ATOM132 = 359,
+        ATOM1320 = 360,
+        ATOM1321 = 361,
+        ATOM1322 = 362,
+        ATOM1323 = 363,
+        ATOM1324 = 364,
+        ATOM1325 = 365,
+        ATOM1326 = 366,
+        ATOM1327 = 367,
+        ATOM1328 = 368,
+        ATOM1329 = 369,
+        ATOM133 = 370,
+        ATOM1330 = 371,
+        ATOM1331 = 372,
+        ATOM1332 = 373,
+        ATOM1333 = 374,
+        ATOM1334 = 375,
+        ATOM1335 = 376,
+        ATOM1336 = 377,
+        ATOM1337 = 378,
+        ATOM1338 = 379,
+        ATOM1339 = 380,
+        ATOM134 = 381,
+        ATOM1340 = 382,
+        ATOM1341 = 383,
+        ATOM1342 = 384,
+        ATOM1343 = 385,
+        ATOM1344 = 386,
+        ATOM1345 = 387,
+        ATOM1346 = 388,
+        ATOM1347 = 389,
+        ATOM1348 = 390,
+        ATOM1349 = 391,
+        ATOM135 = 392,
+        ATOM1350 = 393,
+        ATOM1351 = 394,
+        ATOM1352 = 395,
+        ATOM1353 = 396,
+        ATOM1354 = 397,
+        ATOM1355 = 398,
+        ATOM1356 = 399,
+        ATOM1357 = 400,
+        ATOM1358 = 401,
+        ATOM1359 = 402,
+        ATOM136 = 403,
+        ATOM1360 = 404,
+        ATOM1361 = 405,
+        ATOM1362 = 406,
+        ATOM1363 = 407,
+        ATOM1364 = 408,
+        ATOM1365 = 409,
+        ATOM1366 = 410,
+        ATOM1367 = 411,
+        ATOM1368 = 412,
+        ATOM1369 = 413,
+        ATOM137 = 414,
+        ATOM1370 = 415,
+        ATOM1371 = 416,
+        ATOM1372 = 417,
+        ATOM1373 = 418,
+        ATOM1374 = 419,
+        ATOM1375 = 420,
+        ATOM1376 = 421,
+        ATOM1377 = 422,
+        ATOM1378 = 423,
+        ATOM1379 = 424,
+        ATOM138 = 425,
+        ATOM1380 = 426,
+        ATOM1381 = 427,
+        ATOM1382 = 428,
+        ATOM1383 = 429,
+        ATOM1384 = 430,
+        ATOM1385 = 431,
+        ATOM1386 = 432,
+        ATOM1387 = 433,
+        ATOM1388 = 434,
+        ATOM1389 = 435,
+        ATOM139 = 436,
+        ATOM1390 = 437,
+        ATOM1391 = 438,
+        ATOM1392 = 439,
+        ATOM1393 = 440,
+        ATOM1394 = 441,
+        ATOM1395 = 442,
+        ATOM1396 = 443,
+        ATOM1397 = 444,
+        ATOM1398 = 445,
+        ATOM1399 = 446,
+        ATOM14 = 447,
+        ATOM140 = 448,
+        ATOM1400 = 449,
+        ATOM1401 = 450,
+        ATOM1402 = 451,
+        ATOM1403 = 452,
+        ATOM1404 = 453,
+        ATOM1405 = 454,
+        ATOM1406 = 455,
+        ATOM1407 = 456,
+        ATOM1408 = 457,
+        ATOM1409 = 458,
+        ATOM141 = 459,
+        ATOM1410 = 460,
+        ATOM1411 = 461,
+        ATOM1412 = 462,
+        ATOM1413 = 463,
+        ATOM1414 = 464,
+        ATOM1415 = 465,
+        ATOM1416 = 466,
+        ATOM1417 = 467,
+        ATOM1418 = 468,
+        ATOM1419 = 469,
+        ATOM142 = 470,
+        ATOM1420 = 471,
+        ATOM1421 = 472,
+        ATOM1422 = 473,
+        ATOM1423 = 474,
+        ATOM1424 = 475,
+        ATOM1425 = 476,
+        ATOM1426 = 477,
+        ATOM1427 = 478,
+        ATOM1428 = 479,
+        ATOM1429 = 480,
+        ATOM143 = 481,
+        ATOM1430 = 482,
+        ATOM1431 = 483,
+        ATOM1432 = 484,
+        ATOM1433 = 485,
+        ATOM1434 = 486,
+        ATOM1435 = 487,
+        ATOM1436 = 488,
+        ATOM1437 = 489,
+        ATOM1438 = 490,
+        ATOM1439 = 491,
+        ATOM144 = 492,
+        ATOM1440 = 493,
+        ATOM1441 = 494,
+        ATOM1442 = 495,
+        ATOM1443 = 496,
+        ATOM1444 = 497,
+        ATOM1445 = 498,
+        ATOM1446 = 499,
+        ATOM1447 = 500,
+        ATOM1448 = 501,
+        ATOM1449 = 502,
+        ATOM145 = 503,
+        ATOM1450 = 504,
+        ATOM1451 = 505,
+        ATOM1452 = 506,
+        ATOM1453 = 507,
+        ATOM1454 = 508,
+        ATOM1455 = 509,
+        ATOM1456 = 510,
+        ATOM1457 = 511,
+        ATOM1458 = 512,
+        ATOM1459 = 513,
+        ATOM146 = 514,
+        ATOM1460 = 515,
+        ATOM1461 = 516,
+        ATOM1462 = 517,
+        ATOM1463 = 518,
+        ATOM1464 = 519,
+        ATOM1465 = 520,
+        ATOM1466 = 521,
+        ATOM1467 = 522,
+        ATOM1468 = 523,
+        ATOM1469 = 524,
+        ATOM147 = 525,
+        ATOM1470 = 526,
+        ATOM1471 = 527,
+        ATOM1472 = 528,
+        ATOM1473 = 529,
+        ATOM1474 = 530,
+        ATOM1475 = 531,
+        ATOM1476 = 532,
+        ATOM1477 = 533,
+        ATOM1478 = 534,
+        ATOM1479 = 535,
+        ATOM148 = 536,
+        ATOM1480 = 537,
+        ATOM1481 = 538,
+        ATOM1482 = 539,
+        ATOM1483 = 540,
+        ATOM1484 = 541,
+        ATOM1485 = 542,
+        ATOM1486 = 543,
+        ATOM1487 = 544,
+        ATOM1488 = 545,
+        ATOM1489 = 546,
+        ATOM149 = 547,
+        ATOM1490 = 548,
+        ATOM1491 = 549,
+        ATOM1492 = 550,
+        ATOM1493 = 551,
+        ATOM1494 = 552,
+        ATOM1495 = 553,
+        ATOM1496 = 554,
+        ATOM1497 = 555,
+        ATOM1498 = 556,
+        ATOM1499 = 557,
+        ATOM15 = 558,
+        ATOM150 = 559,
+        ATOM1500 = 560,
+        ATOM1501 = 561,
+        ATOM1502 = 562,
+        ATOM1503 = 563,
+        ATOM1504 = 564,
+        ATOM1505 = 565,
+        ATOM1506 = 566,
+        ATOM1507 = 567,
+        ATOM1508 = 568,
+        ATOM1509 = 569,
+        ATOM151 = 570,
+        ATOM1510 = 571,
+        ATOM1511 = 572,
+        ATOM1512 = 573,
+        ATOM1513 = 574,
+        ATOM1514 = 575,
+        ATOM1515 = 576,
+        ATOM1516 = 577,
+        ATOM1517 = 578,
+        ATOM1518 = 579,
+        ATOM1519 = 580,
+        ATOM152 = 581,
+        ATOM1520 = 582,
+        ATOM1521 = 583,
+        ATOM1522 = 584,
+        ATOM1523 = 585,
+        ATOM1524 = 586,
+        ATOM1525 = 587,
+        ATOM1526 = 588,
+        ATOM1527 = 589,
+        ATOM1528 = 590,
+        ATOM1529 = 591,
+        ATOM153 = 592,
+        ATOM1530 = 593,
+        ATOM1531 = 594,
+        ATOM1532 = 595,
+        ATOM1533 = 596,
+        ATOM1534 = 597,
+        ATOM1535 = 598,
+        ATOM1536 = 599,
+        ATOM1537 = 600,
+        ATOM1538 = 601,
+        ATOM1539 = 602,
+        ATOM154 = 603,
+        ATOM1540 = 604,
+        ATOM1541 = 605,
+        ATOM1542 = 606,
+        ATOM1543 = 607,
+        ATOM1544 = 608,
+        ATOM1545 = 609,
+        ATOM1546 = 610,
+        ATOM1547 = 611,
+        ATOM1548 = 612,
+        ATOM1549 = 613,
+        ATOM155 = 614,
+        ATOM1550 = 615,
+        ATOM1551 = 616,
+        ATOM1552 = 617,
+        ATOM1553 = 618,
+        ATOM1554 = 619,
+        ATOM1555 = 620,
+        ATOM1556 = 621,
+        ATOM1557 = 622,
+        ATOM1558 = 623,
+        ATOM1559 = 624,
+        ATOM156 = 625,
+        ATOM1560 = 626,
+        ATOM1561 = 627,
+        ATOM1562 = 628,
+        ATOM1563 = 629,
+        ATOM1564 = 630,
+        ATOM1565 = 631,
+        ATOM1566 = 632,
+        ATOM1567 = 633,
+        ATOM1568 = 634,
+        ATOM1569 = 635,
+        ATOM157 = 636,
+        ATOM1570 = 637,
+        ATOM1571 = 638,
+        ATOM1572 = 639,
+        ATOM1573 = 640,
+        ATOM1574 = 641,
+        ATOM1575 = 642,
+        ATOM1576 = 643,
+        ATOM1577 = 644,
+        ATOM1578 = 645,
+        ATOM1579 = 646,
+        ATOM158 = 647,
+        ATOM1580 = 648,
+        ATOM1581 = 649,
+        ATOM1582 = 650,
+        ATOM1583 = 651,
+        ATOM1584 = 652,
+        ATOM1585 = 653,
+        ATOM1586 = 654,
+        ATOM1587 = 655,
+        ATOM1588 = 656,
+        ATOM1589 = 657,
+        ATOM159 = 658,
+        ATOM1590 = 659,
+        ATOM1591 = 660,
+        ATOM1592 = 661,
+        ATOM1593 = 662,
+        ATOM1594 = 663,
+        ATOM1595 = 664,
+        ATOM1596 = 665,
+        ATOM1597 = 666,
+        ATOM1598 = 667,
+        ATOM1599 = 668,
+        ATOM16 = 669,
+        ATOM160 = 670,
+        ATOM1600 = 671,
+        ATOM1601 = 672,
+        ATOM1602 = 673,
+        ATOM1603 = 674,
+        ATOM1604 = 675,
+        ATOM1605 = 676,
+        ATOM1606 = 677,
+        ATOM1607 = 678,
+        ATOM1608 = 679,
+        ATOM1609 = 680,
+        ATOM161 = 681,
+        ATOM1610 = 682,
+        ATOM1611 = 683,
+        ATOM1612 = 684,
+        ATOM1613 = 685,
+        ATOM1614 = 686,
+        ATOM1615 = 687,
+        ATOM1616 = 688,
+        ATOM1617 = 689,
+        ATOM1618 = 690,
+        ATOM1619 = 691,
+        ATOM162 = 692,
+        ATOM1620 = 693,
+        ATOM1621 = 694,
+        ATOM1622 = 695,
+        ATOM1623 = 696,
+        ATOM1624 = 697,
+        ATOM1625 = 698,
+        ATOM1626 = 699,
+        ATOM1627 = 700,
+        ATOM1628 = 701,
+        ATOM1629 = 702,
+        ATOM163 = 703,
+        ATOM1630 = 704,
+        ATOM1631 = 705,
+        ATOM1632 = 706,
+        ATOM1633 = 707,
+        ATOM1634 = 708,
+        ATOM1635 = 709,
+        ATOM1636 = 710,
+        ATOM1637 = 711,
+        ATOM1638 = 712,
+        ATOM1639 = 713,
+        ATOM164 = 714,
+        ATOM1640 = 715,
+        ATOM1641 = 716,
+        ATOM1642 = 717,
+        ATOM1643 = 718,
+        ATOM1644 = 719,
+        ATOM1645 = 720,
+        ATOM1646 = 721,
+        ATOM1647 = 722,
+        ATOM1648 = 723,
+        ATOM1649 = 724,
+        ATOM165 = 725,
+        ATOM1650 = 726,
+        ATOM1651 = 727,
+        ATOM1652 = 728,
+        ATOM1653 = 729,
+        ATOM1654 = 730,
+        ATOM1655 = 731,
+        ATOM1656 = 732,
+        ATOM1657 = 733,
+        ATOM1658 = 734,
+        ATOM1659 = 735,
+        ATOM166 = 736,
+        ATOM1660 = 737,
+        ATOM1661 = 738,
+        ATOM1662 = 739,
+        ATOM1663 = 740,
+        ATOM1664 = 741,
+        ATOM1665 = 742,
+        ATOM1666 = 743,
+        ATOM1667 = 744,
+        ATOM1668 = 745,
+        ATOM1669 = 746,
+        ATOM167 = 747,
+        ATOM1670 = 748,
+        ATOM1671 = 749,
+        ATOM1672 = 750,
+        ATOM1673 = 751,
+        ATOM1674 = 752,
+        ATOM1675 = 753,
+        ATOM1676 = 754,
+        ATOM1677 = 755,
+        ATOM1678 = 756,
+        ATOM1679 = 757,
+        ATOM168 = 758,
+        ATOM1680 = 759,
+        ATOM1681 = 760,
+        ATOM1682 = 761,
+        ATOM1683 = 762,
+        ATOM1684 = 763,
+        ATOM1685 = 764,
+        ATOM1686 = 765,
+        ATOM1687 = 766,
+        ATOM1688 = 767,
+        ATOM1689 = 768,
+        ATOM169 = 769,
+        ATOM1690 = 770,
+        ATOM1691 = 771,
+        ATOM1692 = 772,
+        ATOM1693 = 773,
+        ATOM1694 = 774,
+        ATOM1695 = 775,
+        ATOM1696 = 776,
+        ATOM1697 = 777,
+        ATOM1698 = 778,
+        ATOM1699 = 779,
+        ATOM17 = 780,
+        ATOM170 = 781,
+        ATOM1700 = 782,
+        ATOM1701 = 783,
+        ATOM1702 = 784,
+        ATOM1703 = 785,
+        ATOM1704 = 786,
+        ATOM1705 = 787,
+        ATOM1706 = 788,
+        ATOM1707 = 789,
+        ATOM1708 = 790,
+        ATOM1709 = 791,
+        ATOM171 = 792,
+        ATOM1710 = 793,
+        ATOM1711 = 794,
+        ATOM1712 = 795,
+        ATOM1713 = 796,
+        ATOM1714 = 797,
+        ATOM1715 = 798,
+        ATOM1716 = 799,
+        ATOM1717 = 800,
+        ATOM1718 = 801,
+        ATOM1719 = 802,
+        ATOM172 = 803,
+        ATOM1720 = 804,
+        ATOM1721 = 805,
+        ATOM1722 = 806,
+        ATOM1723 = 807,
+        ATOM1724 = 808,
+        ATOM1725 = 809,
+        ATOM1726 = 810,
+        ATOM1727 = 811,
+        ATOM1728 = 812,
+        ATOM1729 = 813,
+        ATOM173 = 814,
+        ATOM1730 = 815,
+        ATOM1731 = 816,
+        ATOM1732 = 817,
+        ATOM1733 = 818,
+        ATOM1734 = 819,
+        ATOM1735 = 820,
+        ATOM1736 = 821,
+        ATOM1737 = 822,
+        ATOM1738 = 823,
+        ATOM1739 = 824,
+        ATOM174 = 825,
+        ATOM1740 = 826,
+        ATOM1741 = 827,
+        ATOM1742 = 828,
+        ATOM1743 = 829,
+        ATOM1744 = 830,
+        ATOM1745 = 831,
+        ATOM1746 = 832,
+        ATOM1747 = 833,
+        ATOM1748 = 834,
+        ATOM1749 = 835,
+        ATOM175 = 836,
+        ATOM1750 = 837,
+        ATOM1751 = 838,
+        ATOM1752 = 839,
+        ATOM1753 = 840,
+        ATOM1754 = 841,
+        ATOM1755 = 842,
+        ATOM1756 = 843,
+        ATOM1757 = 844,
+        ATOM1758 = 845,
+        ATOM1759 = 846,
+        ATOM176 = 847,
+        ATOM1760 = 848,
+        ATOM1761 = 849,
+        ATOM1762 = 850,
+        ATOM1763 = 851,
+        ATOM1764 = 852,
+        ATOM1765 = 853,
+        ATOM1766 = 854,
+        ATOM1767 = 855,
+        ATOM1768 = 856,
+        ATOM1769 = 857,
+        ATOM177 = 858,
+        ATOM1770 = 859,
+        ATOM1771 = 860,
+        ATOM1772 = 861,
+        ATOM1773 = 862,
+        ATOM1774 = 863,
+        ATOM1775 = 864,
+        ATOM1776 = 865,
+        ATOM1777 = 866,
+        ATOM1778 = 867,
+        ATOM1779 = 868,
+        ATOM178 = 869,
+        ATOM1780 = 870,
+        ATOM1781 = 871,
+        ATOM1782 = 872,
+        ATOM1783 = 873,
+        ATOM1784 = 874,
+        ATOM1785 = 875,
+        ATOM1786 = 876,
+        ATOM1787 = 877,
+        ATOM1788 = 878,
+        ATOM1789 = 879,
+        ATOM179 = 880,
+        ATOM1790 = 881,
+        ATOM1791 = 882,
+        ATOM1792 = 883,
+        ATOM1793 = 884,
+        ATOM1794 = 885,
+        ATOM1795 = 886,
+        ATOM1796 = 887,
+        ATOM1797 = 888,
+        ATOM1798 = 889,
+        ATOM1799 = 890,
+        ATOM18 = 891,
+        ATOM180 = 892,
+        ATOM1800 = 893,
+        ATOM1801 = 894,
+        ATOM1802 = 895,
+        ATOM1803 = 896,
+        ATOM1804 = 897,
+        ATOM1805 = 898,
+        ATOM1806 = 899,
+        ATOM1807 = 900,
+        ATOM1808 = 901,
+        ATOM1809 = 902,
+        ATOM181 = 903,
+        ATOM1810 = 904,
+        ATOM1811 = 905,
+        ATOM1812 = 906,
+        ATOM1813 = 907,
+        ATOM1814 = 908,
+        ATOM1815 = 909,
+        ATOM1816 = 910,
+        ATOM1817 = 911,
+        ATOM1818 = 912,
+        ATOM1819 = 913,
+        ATOM182 = 914,
+        ATOM1820 = 915,
+        ATOM1821 = 916,
+        ATOM1822 = 917,
+        ATOM1823 = 918,
+        ATOM1824 = 919,
+        ATOM1825 = 920,
+        ATOM1826 = 921,
+        ATOM1827 = 922,
+        ATOM1828 = 923,
+        ATOM1829 = 924,
+        ATOM183 = 925,
+        ATOM1830 = 926,
+        ATOM1831 = 927,
+        ATOM1832 = 928,
+        ATOM1833 = 929,
+        ATOM1834 = 930,
+        ATOM1835 = 931,
+        ATOM1836 = 932,
+        ATOM1837 = 933,
+        ATOM1838 = 934,
+        ATOM1839 = 935,
+        ATOM184 = 936,
+        ATOM1840 = 937,
+        ATOM1841 = 938,
+        ATOM1842 = 939,
+        ATOM1843 = 940,
+        ATOM1844 = 941,
+        ATOM1845 = 942,
+        ATOM1846 = 943,
+        ATOM1847 = 944,
+        ATOM1848 = 945,
+        ATOM1849 = 946,
+        ATOM185 = 947,
+        ATOM1850 = 948,
+        ATOM1851 = 949,
+        ATOM1852 = 950,
+        ATOM1853 = 951,
+        ATOM1854 = 952,
+        ATOM1855 = 953,
+        ATOM1856 = 954,
+        ATOM1857 = 955,
+        ATOM1858 = 956,
+        ATOM1859 = 957,
+        ATOM186 = 958,
+        ATOM1860 = 959,
+        ATOM1861 = 960,
+        ATOM1862 = 961,
+        ATOM1863 = 962,
+        ATOM1864 = 963,
+        ATOM1865 = 964,
+        ATOM1866 = 965,
+        ATOM1867 = 966,
+        ATOM1868 = 967,
+        ATOM1869 = 968,
+        ATOM187 = 969,
+        ATOM1870 = 970,
+        ATOM1871 = 971,
+        ATOM1872 = 972,
+        ATOM1873 = 973,
+        ATOM1874 = 974,
+        ATOM1875 = 975,
+        ATOM1876 = 976,
+        ATOM1877 = 977,
+        ATOM1878 = 978,
+        ATOM1879 = 979,
+        ATOM188 = 980,
+        ATOM1880 = 981,
+        ATOM1881 = 982,
+        ATOM1882 = 983,
+        ATOM1883 = 984,
+        ATOM1884 = 985,
+        ATOM1885 = 986,
+        ATOM1886 = 987,
+        ATOM1887 = 988,
+        ATOM1888 = 989,
+        ATOM1889 = 990,
+        ATOM189 = 991,
+        ATOM1890 = 992,
+        ATOM1891 = 993,
+        ATOM1892 = 994,
+        ATOM1893 = 995,
+        ATOM1894 = 996,
+        ATOM1895 = 997,
+        ATOM1896 = 998,
+        ATOM1897 = 999,
+        ATOM1898 = 1000,
+        ATOM1899 = 1001,
+        ATOM19 = 1002,
+        ATOM190 = 1003,
+        ATOM1900 = 1004,
+        ATOM1901 = 1005,
+        ATOM1902 = 1006,
+        ATOM1903 = 1007,
+        ATOM1904 = 1008,
+        ATOM1905 = 1009,
+        ATOM1906 = 1010,
+        ATOM1907 = 1011,
+        ATOM1908 = 1012,
+        ATOM1909 = 1013,
+        ATOM191 = 1014,
+        ATOM1910 = 1015,
+        ATOM1911 = 1016,
+        ATOM1912 = 1017,
+        ATOM1913 = 1018,
+        ATOM1914 = 1019,
+        ATOM1915 = 1020,
+        ATOM1916 = 1021,
+        ATOM1917 = 1022,
+        ATOM1918 = 1023,
+        ATOM1919 = 1024,
+        ATOM192 = 1025,
+        ATOM1920 = 1026,
+        ATOM1921 = 1027,
+        ATOM1922 = 1028,
+        ATOM1923 = 1029,
+        ATOM1924 = 1030,
+        ATOM1925 = 1031,
+        ATOM1926 = 1032,
+        ATOM1927 = 1033,
+        ATOM1928 = 1034,
+        ATOM1929 = 1035,
+        ATOM193 = 1036,
+        ATOM1930 = 1037,
+        ATOM1931 = 1038,
+        ATOM1932 = 1039,
+        ATOM1933 = 1040,
+        ATOM1934 = 1041,
+        ATOM1935 = 1042,
+        ATOM1936 = 1043,
+        ATOM1937 = 1044,
+        ATOM1938 = 1045,
+        ATOM1939 = 1046,
+        ATOM194 = 1047,
+        ATOM1940 = 1048,
+        ATOM1941 = 1049,
+        ATOM1942 = 1050,
+        ATOM1943 = 1051,
+        ATOM1944 = 1052,
+        ATOM1945 = 1053,
+        ATOM1946 = 1054,
+        ATOM1947 = 1055,
+        ATOM1948 = 1056,
+        ATOM1949 = 1057,
+        ATOM195 = 1058,
+        ATOM1950 = 1059,
+        ATOM1951 = 1060,
+        ATOM1952 = 1061,
+        ATOM1953 = 1062,
+        ATOM1954 = 1063,
+        ATOM1955 = 1064,
+        ATOM1956 = 1065,
+        ATOM1957 = 1066,
+        ATOM1958 = 1067,
+        ATOM1959 = 1068,
+        ATOM196 = 1069,
+        ATOM1960 = 1070,
+        ATOM1961 = 1071,
+        ATOM1962 = 1072,
+        ATOM1963 = 1073,
+        ATOM1964 = 1074,
+        ATOM1965 = 1075,
+        ATOM1966 = 1076,
+        ATOM1967 = 1077,
+        ATOM1968 = 1078,
+        ATOM1969 = 1079,
+        ATOM197 = 1080,
+        ATOM1970 = 1081,
+        ATOM1971 = 1082,
+        ATOM1972 = 1083,
+        ATOM1973 = 1084,
+        ATOM1974 = 1085,
+        ATOM1975 = 1086,
+        ATOM1976 = 1087,
+        ATOM1977 = 1088,
+        ATOM1978 = 1089,
+        ATOM1979 = 1090,
+        ATOM198 = 1091,
+        ATOM1980 = 1092,
+        ATOM1981 = 1093,
+        ATOM1982 = 1094,
+        ATOM1983 = 1095,
+        ATOM1984 = 1096,
+        ATOM1985 = 1097,
+        ATOM1986 = 1098,
+        ATOM1987 = 1099,
+        ATOM1988 = 1100,
+        ATOM1989 = 1101,
+        ATOM199 = 1102,
+        ATOM1990 = 1103,
+        ATOM1991 = 1104,
+        ATOM1992 = 1105,
+        ATOM1993 = 1106,
+        ATOM1994 = 1107,
+        ATOM1995 = 1108,
+        ATOM1996 = 1109,
+        ATOM1997 = 1110,
+        ATOM1998 = 1111,
+        ATOM1999 = 1112,
+        ATOM2 = 1113,
+        ATOM20 = 1114,
+        ATOM200 = 1115,
+        ATOM2000 = 1116,
+        ATOM2001 = 1117,
+        ATOM2002 = 1118,
+        ATOM2003 = 1119,
+        ATOM2004 = 1120,
+        ATOM2005 = 1121,
+        ATOM2006 = 1122,
+        ATOM2007 = 1123,
+        ATOM2008 = 1124,
+        ATOM2009 = 1125,
+        ATOM201 = 1126,
+        ATOM2010 = 1127,
+        ATOM2011 = 1128,
+        ATOM2012 = 1129,
+        ATOM2013 = 1130,
+        ATOM2014 = 1131,
+        ATOM2015 = 1132,
+        ATOM2016 = 1133,
+        ATOM2017 = 1134,
+        ATOM2018 = 1135,
+        ATOM2019 = 1136,
+        ATOM202 = 1137,
+        ATOM2020 = 1138,
+        ATOM2021 = 1139,
+        ATOM2022 = 1140,
+        ATOM2023 = 1141,
+        ATOM2024 = 1142,
+        ATOM2025 = 1143,
+        ATOM2026 = 1144,
+        ATOM2027 = 1145,
+        ATOM2028 = 1146,
+        ATOM2029 = 1147,
+        ATOM203 = 1148,
+        ATOM2030 = 1149,
+        ATOM2031 = 1150,
+        ATOM2032 = 1151,
+        ATOM2033 = 1152,
+        ATOM2034 = 1153,
+        ATOM2035 = 1154,
+        ATOM2036 = 1155,
+        ATOM2037 = 1156,
+        ATOM2038 = 1157,
+        ATOM2039 = 1158,
+        ATOM204 = 1159,
+        ATOM2040 = 1160,
+        ATOM2041 = 1161,
+        ATOM2042 = 1162,
+        ATOM2043 = 1163,
+        ATOM2044 = 1164,
+        ATOM2045 = 1165,
+        ATOM2046 = 1166,
+        ATOM2047 = 1167,
+        ATOM2048 = 1168,
+        ATOM2049 = 1169,
+        ATOM205 = 1170,
+        ATOM2050 = 1171,
+        ATOM2051 = 1172,
+        ATOM2052 = 1173,
+        ATOM2053 = 1174,
+        ATOM2054 = 1175,
+        ATOM2055 = 1176,
+        ATOM2056 = 1177,
+        ATOM2057 = 1178,
+        ATOM2058 = 1179,
+        ATOM2059 = 1180,
+        ATOM206 = 1181,
+        ATOM2060 = 1182,
+        ATOM2061 = 1183,
+        ATOM2062 = 1184,
+        ATOM2063 = 1185,
+        ATOM2064 = 1186,
+        ATOM2065 = 1187,
+        ATOM2066 = 1188,
+        ATOM2067 = 1189,
+        ATOM2068 = 1190,
+        ATOM2069 = 1191,
+        ATOM207 = 1192,
+        ATOM2070 = 1193,
+        ATOM2071 = 1194,
+        ATOM2072 = 1195,
+        ATOM2073 = 1196,
+        ATOM2074 = 1197,
+        ATOM2075 = 1198,
+        ATOM2076 = 1199,
+        ATOM2077 = 1200,
+        ATOM2078 = 1201,
+        ATOM2079 = 1202,
+        ATOM208 = 1203,
+        ATOM2080 = 1204,
+        ATOM2081 = 1205,
+        ATOM2082 = 1206,
+        ATOM2083 = 1207,
+        ATOM2084 = 1208,
+        ATOM2085 = 1209,
+        ATOM2086 = 1210,
+        ATOM2087 = 1211,
+        ATOM2088 = 1212,
+        ATOM2089 = 1213,
+        ATOM209 = 1214,
+        ATOM2090 = 1215,
+        ATOM2091 = 1216,
+        ATOM2092 = 1217,
+        ATOM2093 = 1218,
+        ATOM2094 = 1219,
+        ATOM2095 = 1220,
+        ATOM2096 = 1221,
+        ATOM2097 = 1222,
+        ATOM2098 = 1223,
+        ATOM2099 = 1224,
+        ATOM21 = 1225,
+        ATOM210 = 1226,
+        ATOM2100 = 1227,
+        ATOM2101 = 1228,
+        ATOM2102 = 1229,
+        ATOM2103 = 1230,
+        ATOM2104 = 1231,
+        ATOM2105 = 1232,
+        ATOM2106 = 1233,
+        ATOM2107 = 1234,
+        ATOM2108 = 1235,
+        ATOM2109 = 1236,
+        ATOM211 = 1237,
+        ATOM2110 = 1238,
+        ATOM2111 = 1239,
+        ATOM2112 = 1240,
+        ATOM2113 = 1241,
+        ATOM2114 = 1242,
+        ATOM2115 = 1243,
+        ATOM2116 = 1244,
+        ATOM2117 = 1245,
+        ATOM2118 = 1246,
+        ATOM2119 = 1247,
+        ATOM212 = 1248,
+        ATOM2120 = 1249,
+        ATOM2121 = 1250,
+        ATOM2122 = 1251,
+        ATOM2123 = 1252,
+        ATOM2124 = 1253,
+        ATOM2125 = 1254,
+        ATOM2126 = 1255,
+        ATOM2127 = 1256,
+        ATOM2128 = 1257,
+        ATOM2129 = 1258,
+        ATOM213 = 1259,
+        ATOM2130 = 1260,
+        ATOM2131 = 1261,
+        ATOM2132 = 1262,
+        ATOM2133 = 1263,
+        ATOM2134 = 1264,
+        ATOM2135 = 1265,
+        ATOM2136 = 1266,
+        ATOM2137 = 1267,
+        ATOM2138 = 1268,
+        ATOM2139 = 1269,
+        ATOM214 = 1270,
+        ATOM2140 = 1271,
+        ATOM2141 = 1272,
+        ATOM2142 = 1273,
+        ATOM2143 = 1274,
+        ATOM2144 = 1275,
+        ATOM2145 = 1276,
+        ATOM2146 = 1277,
+        ATOM2147 = 1278,
+        ATOM2148 = 1279,
+        ATOM2149 = 1280,
+        ATOM215 = 1281,
+        ATOM2150 = 1282,
+        ATOM2151 = 1283,
+        ATOM2152 = 1284,
+        ATOM2153 = 1285,
+        ATOM2154 = 1286,
+        ATOM2155 = 1287,
+        ATOM2156 = 1288,
+        ATOM2157 = 1289,
+        ATOM2158 = 1290,
+        ATOM2159 = 1291,
+        ATOM216 = 1292,
+        ATOM2160 = 1293,
+        ATOM2161 = 1294,
+        ATOM2162 = 1295,
+        ATOM2163 = 1296,
+        ATOM2164 = 1297,
+        ATOM2165 = 1298,
+        ATOM2166 = 1299,
+        ATOM2167 = 1300,
+        ATOM2168 = 1301,
+        ATOM2169 = 1302,
+        ATOM217 = 1303,
+        ATOM2170 = 1304,
+        ATOM2171 = 1305,
+        ATOM2172 = 1306,
+        ATOM2173 = 1307,
+        ATOM2174 = 1308,
+        ATOM2175 = 1309,
+        ATOM2176 = 1310,
+        ATOM2177 = 1311,
+        ATOM2178 = 1312,
+        ATOM2179 = 1313,
+        ATOM218 = 1314,
+        ATOM2180 = 1315,
+        ATOM2181 = 1316,
+        ATOM2182 = 1317,
+        ATOM2183 = 1318,
+        ATOM2184 = 1319,
+        ATOM2185 = 1320,
+        ATOM2186 = 1321,
+        ATOM2187 = 1322,
+        ATOM2188 = 1323,
+        ATOM2189 = 1324,
+        ATOM219 = 1325,
+        ATOM2190 = 1326,
+        ATOM2191 = 1327,
+        ATOM2192 = 1328,
+        ATOM2193 = 1329,
+        ATOM2194 = 1330,
+        ATOM2195 = 1331,
+        ATOM2196 = 1332,
+        ATOM2197 = 1333,
+        ATOM2198 = 1334,
+        ATOM2199 = 1335,
+        ATOM22 = 1336,
+        ATOM220 = 1337,
+        ATOM2200 = 1338,
+        ATOM2201 = 1339,
+        ATOM2202 = 1340,
+        ATOM2203 = 1341,
+        ATOM2204 = 1342,
+        ATOM2205 = 1343,
+        ATOM2206 = 1344,
+        ATOM2207 = 1345,
+        ATOM2208 = 1346,
+        ATOM2209 = 1347,
+        ATOM221 = 1348,
+        ATOM2210 = 1349,
+        ATOM2211 = 1350,
+        ATOM2212 = 1351,
+        ATOM2213 = 1352,
+        ATOM2214 = 1353,
+        ATOM2215 = 1354,
+        ATOM2216 = 1355,
+        ATOM2217 = 1356,
+        ATOM2218 = 1357,
+        ATOM2219 = 1358,
+        ATOM222 = 1359,
+        ATOM2220 = 1360,
+        ATOM2221 = 1361,
+        ATOM2222 = 1362,
+        ATOM2223 = 1363,
+        ATOM2224 = 1364,
+        ATOM2225 = 1365,
+        ATOM2226 = 1366,
+        ATOM2227 = 1367,
+        ATOM2228 = 1368,
+        ATOM2229 = 1369,
+        ATOM223 = 1370,
+        ATOM2230 = 1371,
+        ATOM2231 = 1372,
+        ATOM2232 = 1373,
+        ATOM2233 = 1374,
+        ATOM2234 = 1375,
+        ATOM2235 = 1376,
+        ATOM2236 = 1377,
+        ATOM2237 = 1378,
+        ATOM2238 = 1379,
+        ATOM2239 = 1380,
+        ATOM224 = 1381,
+        ATOM2240 = 1382,
+        ATOM2241 = 1383,
+        ATOM2242 = 1384,
+        ATOM2243 = 1385,
+        ATOM2244 = 1386,
+        ATOM2245 = 1387,
+        ATOM2246 = 1388,
+        ATOM2247 = 1389,
+        ATOM2248 = 1390,
+        ATOM2249 = 1391,
+        ATOM225 = 1392,
+        ATOM2250 = 1393,
+        ATOM2251 = 1394,
+        ATOM2252 = 1395,
+        ATOM2253 = 1396,
+        ATOM2254 = 1397,
+        ATOM2255 = 1398,
+        ATOM2256 = 1399,
+        ATOM2257 = 1400,
+        ATOM2258 = 1401,
+        ATOM2259 = 1402,
+        ATOM226 = 1403,
+        ATOM2260 = 1404,
+        ATOM2261 = 1405,
+        ATOM2262 = 1406,
+        ATOM2263 = 1407,
+        ATOM2264 = 1408,
+        ATOM2265 = 1409,
+        ATOM2266 = 1410,
+        ATOM2267 = 1411,
+        ATOM2268 = 1412,
+        ATOM2269 = 1413,
+        ATOM227 = 1414,
+        ATOM2270 = 1415,
+        ATOM2271 = 1416,
+        ATOM2272 = 1417,
+        ATOM2273 = 1418,
+        ATOM2274 = 1419,
+        ATOM2275 = 1420,
+        ATOM2276 = 1421,
+        ATOM2277 = 1422,
+        ATOM2278 = 1423,
+        ATOM2279 = 1424,
+        ATOM228 = 1425,
+        ATOM2280 = 1426,
+        ATOM2281 = 1427,
+        ATOM2282 = 1428,
+        ATOM2283 = 1429,
+        ATOM2284 = 1430,
+        ATOM2285 = 1431,
+        ATOM2286 = 1432,
+        ATOM2287 = 1433,
+        ATOM2288 = 1434,
+        ATOM2289 = 1435,
+        ATOM229 = 1436,
+        ATOM2290 = 1437,
+        ATOM2291 = 1438,
+        ATOM2292 = 1439,
+        ATOM2293 = 1440,
+        ATOM2294 = 1441,
+        ATOM2295 = 1442,
+        ATOM2296 = 1443,
+        ATOM2297 = 1444,
+        ATOM2298 = 1445,
+        ATOM2299 = 1446,
+        ATOM23 = 1447,
+        ATOM230 = 1448,
+        ATOM2300 = 1449,
+        ATOM2301 = 1450,
+        ATOM2302 = 1451,
+        ATOM2303 = 1452,
+        ATOM2304 = 1453,
+        ATOM2305 = 1454,
+        ATOM2306 = 1455,
+        ATOM2307 = 1456,
+        ATOM2308 = 1457,
+        ATOM2309 = 1458,
+        ATOM231 = 1459,
+        ATOM2310 = 1460,
+        ATOM2311 = 1461,
+        ATOM2312 = 1462,
+        ATOM2313 = 1463,
+        ATOM2314 = 1464,
+        ATOM2315 = 1465,
+        ATOM2316 = 1466,
+        ATOM2317 = 1467,
+        ATOM2318 = 1468,
+        ATOM2319 = 1469,
+        ATOM232 = 1470,
+        ATOM2320 = 1471,
+        ATOM2321 = 1472,
+        ATOM2322 = 1473,
+        ATOM2323 = 1474,
+        ATOM2324 = 1475,
+        ATOM2325 = 1476,
+        ATOM2326 = 1477,
+        ATOM2327 = 1478,
+        ATOM2328 = 1479,
+        ATOM2329 = 1480,
+        ATOM233 = 1481,
+        ATOM2330 = 1482,
+        ATOM2331 = 1483,
+        ATOM2332 = 1484,
+        ATOM2333 = 1485,
+        ATOM2334 = 1486,
+        ATOM2335 = 1487,
+        ATOM2336 = 1488,
+        ATOM2337 = 1489,
+        ATOM2338 = 1490,
+        ATOM2339 = 1491,
+        ATOM234 = 1492,
+        ATOM2340 = 1493,
+        ATOM2341 = 1494,
+        ATOM2342 = 1495,
+        ATOM2343 = 1496,
+        ATOM2344 = 1497,
+        ATOM2345 = 1498,
+        ATOM2346 = 1499,
+        ATOM2347 = 1500,
+        ATOM2348 = 1501,
+        ATOM2349 = 1502,
+        ATOM235 = 1503,
+        ATOM2350 = 1504,
+        ATOM2351 = 1505,
+        ATOM2352 = 1506,
+        ATOM2353 = 1507,
+        ATOM2354 = 1508,
+        ATOM2355 = 1509,
+        ATOM2356 = 1510,
+        ATOM2357 = 1511,
+        ATOM2358 = 1512,
+        ATOM2359 = 1513,
+        ATOM236 = 1514,
+        ATOM2360 = 1515,
+        ATOM2361 = 1516,
+        ATOM2362 = 1517,
+        ATOM2363 = 1518,
+        ATOM2364 = 1519,
+        ATOM2365 = 1520,
+        ATOM2366 = 1521,
+        ATOM2367 = 1522,
+        ATOM2368 = 1523,
+        ATOM2369 = 1524,
+        ATOM237 = 1525,
+        ATOM2370 = 1526,
+        ATOM2371 = 1527,
+        ATOM2372 = 1528,
+        ATOM2373 = 1529,
+        ATOM2374 = 1530,
+        ATOM2375 = 1531,
+        ATOM2376 = 1532,
+        ATOM2377 = 1533,
+        ATOM2378 = 1534,
+        ATOM2379 = 1535,
+        ATOM238 = 1536,
+        ATOM2380 = 1537,
+        ATOM2381 = 1538,
+        ATOM2382 = 1539,
+        ATOM2383 = 1540,
+        ATOM2384 = 1541,
+        ATOM2385 = 1542,
+        ATOM2386 = 1543,
+        ATOM2387 = 1544,
+        ATOM2388 = 1545,
+        ATOM2389 = 1546,
+        ATOM239 = 1547,
+        ATOM2390 = 1548,
+        ATOM2391 = 1549,
+        ATOM2392 = 1550,
+        ATOM2393 = 1551,
+        ATOM2394 = 1552,
+        ATOM2395 = 1553,
+        ATOM2396 = 1554,
+        ATOM2397 = 1555,
+        ATOM2398 = 1556,
+        ATOM2399 = 1557,
+        ATOM24 = 1558,
+        ATOM240 = 1559,
+        ATOM2400 = 1560,
+        ATOM2401 = 1561,
+        ATOM2402 = 1562,
+        ATOM2403 = 1563,
+        ATOM2404 = 1564,
+        ATOM2405 = 1565,
+        ATOM2406 = 1566,
+        ATOM2407 = 1567,
+        ATOM2408 = 1568,
+        ATOM2409 = 1569,
+        ATOM241 = 1570,
+        ATOM2410 = 1571,
+        ATOM2411 = 1572,
+        ATOM2412 = 1573,
+        ATOM2413 = 1574,
+        ATOM2414 = 1575,
+        ATOM2415 = 1576,
+        ATOM2416 = 1577,
+        ATOM2417 = 1578,
+        ATOM2418 = 1579,
+        ATOM2419 = 1580,
+        ATOM242 = 1581,
+        ATOM2420 = 1582,
+        ATOM2421 = 1583,
+        ATOM2422 = 1584,
+        ATOM2423 = 1585,
+        ATOM2424 = 1586,
+        ATOM2425 = 1587,
+        ATOM2426 = 1588,
+        ATOM2427 = 1589,
+        ATOM2428 = 1590,
+        ATOM2429 = 1591,
+        ATOM243 = 1592,
+        ATOM2430 = 1593,
+        ATOM2431 = 1594,
+        ATOM2432 = 1595,
+        ATOM2433 = 1596,
+        ATOM2434 = 1597,
+        ATOM2435 = 1598,
+        ATOM2436 = 1599,
+        ATOM2437 = 1600,
+        ATOM2438 = 1601,
+        ATOM2439 = 1602,
+        ATOM244 = 1603,
+        ATOM2440 = 1604,
+        ATOM2441 = 1605,
+        ATOM2442 = 1606,
+        ATOM2443 = 1607,
+        ATOM2444 = 1608,
+        ATOM2445 = 1609,
+        ATOM2446 = 1610,
+        ATOM2447 = 1611,
+        ATOM2448 = 1612,
+        ATOM2449 = 1613,
+        ATOM245 = 1614,
+        ATOM2450 = 1615,
+        ATOM2451 = 1616,
+        ATOM2452 = 1617,
+        ATOM2453 = 1618,
+        ATOM2454 = 1619,
+        ATOM2455 = 1620,
+        ATOM2456 = 1621,
+        ATOM2457 = 1622,
+        ATOM2458 = 1623,
+        ATOM2459 = 1624,
+        ATOM246 = 1625,
+        ATOM2460 = 1626,
+        ATOM2461 = 1627,
+        ATOM2462 = 1628,
+        ATOM2463 = 1629,
+        ATOM2464 = 1630,
+        ATOM2465 = 1631,
+        ATOM2466 = 1632,
+        ATOM2467 = 1633,
+        ATOM2468 = 1634,
+        ATOM2469 = 1635,
+        ATOM247 = 1636,
+        ATOM2470 = 1637,
+        ATOM2471 = 1638,
+        ATOM2472 = 1639,
+        ATOM2473 = 1640,
+        ATOM2474 = 1641,
+        ATOM2475 = 1642,
+        ATOM2476 = 1643,
+        ATOM2477 = 1644,
+        ATOM2478 = 1645,
+        ATOM2479 = 1646,
+        ATOM248 = 1647,
+        ATOM2480 = 1648,
+        ATOM2481 = 1649,
+        ATOM2482 = 1650,
+        ATOM2483 = 1651,
+        ATOM2484 = 1652,
+        ATOM2485 = 1653,
+        ATOM2486 = 1654,
+        ATOM2487 = 1655,
+        ATOM2488 = 1656,
+        ATOM2489 = 1657,
+        ATOM249 = 1658,
+        ATOM2490 = 1659,
+        ATOM2491 = 1660,
+        ATOM2492 = 1661,
+        ATOM2493 = 1662,
+        ATOM2494 = 1663,
+        ATOM2495 = 1664,
+        ATOM2496 = 1665,
+        ATOM2497 = 1666,
+        ATOM2498 = 1667,
+        ATOM25 = 1668,
+        ATOM250 = 1669,
+        ATOM251 = 1670,
+        ATOM252 = 1671,
+        ATOM253 = 1672,
+        ATOM254 = 1673,
+        ATOM255 = 1674,
+        ATOM256 = 1675,
+        ATOM257 = 1676,
+        ATOM258 = 1677,
+        ATOM259 = 1678,
+        ATOM26 = 1679,
+        ATOM260 = 1680,
+        ATOM261 = 1681,
+        ATOM262 = 1682,
+        ATOM263 = 1683,
+        ATOM264 = 1684,
+        ATOM265 = 1685,
+        ATOM266 = 1686,
+        ATOM267 = 1687,
+        ATOM268 = 1688,
+        ATOM269 = 1689,
+        ATOM27 = 1690,
+        ATOM270 = 1691,
+        ATOM271 = 1692,
+        ATOM272 = 1693,
+        ATOM273 = 1694,
+        ATOM274 = 1695,
+        ATOM275 = 1696,
+        ATOM276 = 1697,
+        ATOM277 = 1698,
+        ATOM278 = 1699,
+        ATOM279 = 1700,
+        ATOM28 = 1701,
+        ATOM280 = 1702,
+        ATOM281 = 1703,
+        ATOM282 = 1704,
+        ATOM283 = 1705,
+        ATOM284 = 1706,
+        ATOM285 = 1707,
+        ATOM286 = 1708,
+        ATOM287 = 1709,
+        ATOM288 = 1710,
+        ATOM289 = 1711,
+        ATOM29 = 1712,
+        ATOM290 = 1713,
+        ATOM291 = 1714,
+        ATOM292 = 1715,
+        ATOM293 = 1716,
+        ATOM294 = 1717,
+        ATOM295 = 1718,
+        ATOM296 = 1719,
+        ATOM297 = 1720,
+        ATOM298 = 1721,
+        ATOM299 = 1722,
+        ATOM3 = 1723,
+        ATOM30 = 1724,
+        ATOM300 = 1725,
+        ATOM301 = 1726,
+        ATOM302 = 1727,
+        ATOM303 = 1728,
+        ATOM304 = 1729,
+        ATOM305 = 1730,
+        ATOM306 = 1731,
+        ATOM307 = 1732,
+        ATOM308 = 1733,
+        ATOM309 = 1734,
+        ATOM31 = 1735,
+        ATOM310 = 1736,
+        ATOM311 = 1737,
+        ATOM312 = 1738,
+        ATOM313 = 1739,
+        ATOM314 = 1740,
+        ATOM315 = 1741,
+        ATOM316 = 1742,
+        ATOM317 = 1743,
+        ATOM318 = 1744,
+        ATOM319 = 1745,
+        ATOM32 = 1746,
+        ATOM320 = 1747,
+        ATOM321 = 1748,
+        ATOM322 = 1749,
+        ATOM323 = 1750,
+        ATOM324 = 1751,
+        ATOM325 = 1752,
+        ATOM326 = 1753,
+        ATOM327 = 1754,
+        ATOM328 = 1755,
+        ATOM329 = 1756,
+        ATOM33 = 1757,
+        ATOM330 = 1758,
+        ATOM331 = 1759,
+        ATOM332 = 1760,
+        ATOM333 = 1761,
+        ATOM334 = 1762,
+        ATOM335 = 1763,
+        ATOM336 = 1764,
+        ATOM337 = 1765,
+        ATOM338 = 1766,
+        ATOM339 = 1767,
+        ATOM34 = 1768,
+        ATOM340 = 1769,
+        ATOM341 = 1770,
+        ATOM342 = 1771,
+        ATOM343 = 1772,
+        ATOM344 = 1773,
+        ATOM345 = 1774,
+        ATOM346 = 1775,
+        ATOM347 = 1776,
+        ATOM348 = 1777,
+        ATOM349 = 1778,
+        ATOM35 = 1779,
+        ATOM350 = 1780,
+        ATOM351 = 1781,
+        ATOM352 = 1782,
+        ATOM353 = 1783,
+        ATOM354 = 1784,
+        ATOM355 = 1785,
+        ATOM356 = 1786,
+        ATOM357 = 1787,
+        ATOM358 = 1788,
+        ATOM359 = 1789,
+        ATOM36 = 1790,
+        ATOM360 = 1791,
+        ATOM361 = 1792,
+        ATOM362 = 1793,
+        ATOM363 = 1794,
+        ATOM364 = 1795,
+        ATOM365 = 1796,
+        ATOM366 = 1797,
+        ATOM367 = 1798,
+        ATOM368 = 1799,
+        ATOM369 = 1800,
+        ATOM37 = 1801,
+        ATOM370 = 1802,
+        ATOM371 = 1803,
+        ATOM372 = 1804,
+        ATOM373 = 1805,
+        ATOM374 = 1806,
+        ATOM375 = 1807,
+        ATOM376 = 1808,
+        ATOM377 = 1809,
+        ATOM378 = 1810,
+        ATOM379 = 1811,
+        ATOM38 = 1812,
+        ATOM380 = 1813,
+        ATOM381 = 1814,
+        ATOM382 = 1815,
+        ATOM383 = 1816,
+        ATOM384 = 1817,
+        ATOM385 = 1818,
+        ATOM386 = 1819,
+        ATOM387 = 1820,
+        ATOM388 = 1821,
+        ATOM389 = 1822,
+        ATOM39 = 1823,
+        ATOM390 = 1824,
+        ATOM391 = 1825,
+        ATOM392 = 1826,
+        ATOM393 = 1827,
+        ATOM394 = 1828,
+        ATOM395 = 1829,
+        ATOM396 = 1830,
+        ATOM397 = 1831,
+        ATOM398 = 1832,
+        ATOM399 = 1833,
+        ATOM4 = 1834,
+        ATOM40 = 1835,
+        ATOM400 = 1836,
+        ATOM401 = 1837,
+        ATOM402 = 1838,
+        ATOM403 = 1839,
+        ATOM404 = 1840,
+        ATOM405 = 1841,
+        ATOM406 = 1842,
+        ATOM407 = 1843,
+        ATOM408 = 1844,
+        ATOM409 = 1845,
+        ATOM41 = 1846,
+        ATOM410 = 1847,
+        ATOM411 = 1848,
+        ATOM412 = 1849,
+        ATOM413 = 1850,
+        ATOM414 = 1851,
+        ATOM415 = 1852,
+        ATOM416 = 1853,
+        ATOM417 = 1854,
+        ATOM418 = 1855,
+        ATOM419 = 1856,
+        ATOM42 = 1857,
+        ATOM420 = 1858,
+        ATOM421 = 1859,
+        ATOM422 = 1860,
+        ATOM423 = 1861,
+        ATOM424 = 1862,
+        ATOM425 = 1863,
+        ATOM426 = 1864,
+        ATOM427 = 1865,
+        ATOM428 = 1866,
+        ATOM429 = 1867,
+        ATOM43 = 1868,
+        ATOM430 = 1869,
+        ATOM431 = 1870,
+        ATOM432 = 1871,
+        ATOM433 = 1872,
+        ATOM434 = 1873,
+        ATOM435 = 1874,
+        ATOM436 = 1875,
+        ATOM437 = 1876,
+        ATOM438 = 1877,
+        ATOM439 = 1878,
+        ATOM44 = 1879,
+        ATOM440 = 1880,
+        ATOM441 = 1881,
+        ATOM442 = 1882,
+        ATOM443 = 1883,
+        ATOM444 = 1884,
+        ATOM445 = 1885,
+        ATOM446 = 1886,
+        ATOM447 = 1887,
+        ATOM448 = 1888,
+        ATOM449 = 1889,
+        ATOM45 = 1890,
+        ATOM450 = 1891,
+        ATOM451 = 1892,
+        ATOM452 = 1893,
+        ATOM453 = 1894,
+        ATOM454 = 1895,
+        ATOM455 = 1896,
+        ATOM456 = 1897,
+        ATOM457 = 1898,
+        ATOM458 = 1899,
+        ATOM459 = 1900,
+        ATOM46 = 1901,
+        ATOM460 = 1902,
+        ATOM461 = 1903,
+        ATOM462 = 1904,
+        ATOM463 = 1905,
+        ATOM464 = 1906,
+        ATOM465 = 1907,
+        ATOM466 = 1908,
+        ATOM467 = 1909,
+        ATOM468 = 1910,
+        ATOM469 = 1911,
+        ATOM47 = 1912,
+        ATOM470 = 1913,
+        ATOM471 = 1914,
+        ATOM472 = 1915,
+        ATOM473 = 1916,
+        ATOM474 = 1917,
+        ATOM475 = 1918,
+        ATOM476 = 1919,
+        ATOM477 = 1920,
+        ATOM478 = 1921,
+        ATOM479 = 1922,
+        ATOM48 = 1923,
+        ATOM480 = 1924,
+        ATOM481 = 1925,
+        ATOM482 = 1926,
+        ATOM483 = 1927,
+        ATOM484 = 1928,
+        ATOM485 = 1929,
+        ATOM486 = 1930,
+        ATOM487 = 1931,
+        ATOM488 = 1932,
+        ATOM489 = 1933,
+        ATOM49 = 1934,
+        ATOM490 = 1935,
+        ATOM491 = 1936,
+        ATOM492 = 1937,
+        ATOM493 = 1938,
+        ATOM494 = 1939,
+        ATOM495 = 1940,
+        ATOM496 = 1941,
+        ATOM497 = 1942,
+        ATOM498 = 1943,
+        ATOM499 = 1944,
+        ATOM5 = 1945,
+        ATOM50 = 1946,
+        ATOM500 = 1947,
+        ATOM501 = 1948,
+        ATOM502 = 1949,
+        ATOM503 = 1950,
+        ATOM504 = 1951,
+        ATOM505 = 1952,
+        ATOM506 = 1953,
+        ATOM507 = 1954,
+        ATOM508 = 1955,
+        ATOM509 = 1956,
+        ATOM51 = 1957,
+        ATOM510 = 1958,
+        ATOM511 = 1959,
+        ATOM512 = 1960,
+        ATOM513 = 1961,
+        ATOM514 = 1962,
+        ATOM515 = 1963,
+        ATOM516 = 1964,
+        ATOM517 = 1965,
+        ATOM518 = 1966,
+        ATOM519 = 1967,
+        ATOM52 = 1968,
+        ATOM520 = 1969,
+        ATOM521 = 1970,
+        ATOM522 = 1971,
+        ATOM523 = 1972,
+        ATOM524 = 1973,
+        ATOM525 = 1974,
+        ATOM526 = 1975,
+        ATOM527 = 1976,
+        ATOM528 = 1977,
+        ATOM529 = 1978,
+        ATOM53 = 1979,
+        ATOM530 = 1980,
+        ATOM531 = 1981,
+        ATOM532 = 1982,
+        ATOM533 = 1983,
+        ATOM534 = 1984,
+        ATOM535 = 1985,
+        ATOM536 = 1986,
+        ATOM537 = 1987,
+        ATOM538 = 1988,
+        ATOM539 = 1989,
+        ATOM54 = 1990,
+        ATOM540 = 1991,
+        ATOM541 = 1992,
+        ATOM542 = 1993,
+        ATOM543 = 1994,
+        ATOM544 = 1995,
+        ATOM545 = 1996,
+        ATOM546 = 1997,
+        ATOM547 = 1998,
+        ATOM548 = 1999,
+        ATOM549 = 2000,
+        ATOM55 = 2001,
+        ATOM550 = 2002,
+        ATOM551 = 2003,
+        ATOM552 = 2004,
+        ATOM553 = 2005,
+        ATOM554 = 2006,
+        ATOM555 = 2007,
+        ATOM556 = 2008,
+        ATOM557 = 2009,
+        ATOM558 = 2010,
+        ATOM559 = 2011,
+        ATOM56 = 2012,
+        ATOM560 = 2013,
+        ATOM561 = 2014,
+        ATOM562 = 2015,
+        ATOM563 = 2016,
+        ATOM564 = 2017,
+        ATOM565 = 2018,
+        ATOM566 = 2019,
+        ATOM567 = 2020,
+        ATOM568 = 2021,
+        ATOM569 = 2022,
+        ATOM57 = 2023,
+        ATOM570 = 2024,
+        ATOM571 = 2025,
+        ATOM572 = 2026,
+        ATOM573 = 2027,
+        ATOM574 = 2028,
+        ATOM575 = 2029,
+        ATOM576 = 2030,
+        ATOM577 = 2031,
+        ATOM578 = 2032,
+        ATOM579 = 2033,
+        ATOM58 = 2034,
+        ATOM580 = 2035,
+        ATOM581 = 2036,
+        ATOM582 = 2037,
+        ATOM583 = 2038,
+        ATOM584 = 2039,
+        ATOM585 = 2040,
+        ATOM586 = 2041,
+        ATOM587 = 2042,
+        ATOM588 = 2043,
+        ATOM589 = 2044,
+        ATOM59 = 2045,
+        ATOM590 = 2046,
+        ATOM591 = 2047,
+        ATOM592 = 2048,
+        ATOM593 = 2049,
+        ATOM594 = 2050,
+        ATOM595 = 2051,
+        ATOM596 = 2052,
+        ATOM597 = 2053,
+        ATOM598 = 2054,
+        ATOM599 = 2055,
+        ATOM6 = 2056,
+        ATOM60 = 2057,
+        ATOM600 = 2058,
+        ATOM601 = 2059,
+        ATOM602 = 2060,
+        ATOM603 = 2061,
+        ATOM604 = 2062,
+        ATOM605 = 2063,
+        ATOM606 = 2064,
+        ATOM607 = 2065,
+        ATOM608 = 2066,
+        ATOM609 = 2067,
+        ATOM61 = 2068,
+        ATOM610 = 2069,
+        ATOM611 = 2070,
+        ATOM612 = 2071,
+        ATOM613 = 2072,
+        ATOM614 = 2073,
+        ATOM615 = 2074,
+        ATOM616 = 2075,
+        ATOM617 = 2076,
+        ATOM618 = 2077,
+        ATOM619 = 2078,
+        ATOM62 = 2079,
+        ATOM620 = 2080,
+        ATOM621 = 2081,
+        ATOM622 = 2082,
+        ATOM623 = 2083,
+        ATOM624 = 2084,
+        ATOM625 = 2085,
+        ATOM626 = 2086,
+        ATOM627 = 2087,
+        ATOM628 = 2088,
+        ATOM629 = 2089,
+        ATOM63 = 2090,
+        ATOM630 = 2091,
+        ATOM631 = 2092,
+        ATOM632 = 2093,
+        ATOM633 = 2094,
+        ATOM634 = 2095,
+        ATOM635 = 2096,
+        ATOM636 = 2097,
+        ATOM637 = 2098,
+        ATOM638 = 2099,
+        ATOM639 = 2100,
+        ATOM64 = 2101,
+        ATOM640 = 2102,
+        ATOM641 = 2103,
+        ATOM642 = 2104,
+        ATOM643 = 2105,
+        ATOM644 = 2106,
+        ATOM645 = 2107,
+        ATOM646 = 2108,
+        ATOM647 = 2109,
+        ATOM648 = 2110,
+        ATOM649 = 2111,
+        ATOM65 = 2112,
+        ATOM650 = 2113,
+        ATOM651 = 2114,
+        ATOM652 = 2115,
+        ATOM653 = 2116,
+        ATOM654 = 2117,
+        ATOM655 = 2118,
+        ATOM656 = 2119,
+        ATOM657 = 2120,
+        ATOM658 = 2121,
+        ATOM659 = 2122,
+        ATOM66 = 2123,
+        ATOM660 = 2124,
+        ATOM661 = 2125,
+        ATOM662 = 2126,
+        ATOM663 = 2127,
+        ATOM664 = 2128,
+        ATOM665 = 2129,
+        ATOM666 = 2130,
+        ATOM667 = 2131,
+        ATOM668 = 2132,
+        ATOM669 = 2133,
+        ATOM67 = 2134,
+        ATOM670 = 2135,
+        ATOM671 = 2136,
+        ATOM672 = 2137,
+        ATOM673 = 2138,
+        ATOM674 = 2139,
+        ATOM675 = 2140,
+        ATOM676 = 2141,
+        ATOM677 = 2142,
+        ATOM678 = 2143,
+        ATOM679 = 2144,
+        ATOM68 = 2145,
+        ATOM680 = 2146,
+        ATOM681 = 2147,
+        ATOM682 = 2148,
+        ATOM683 = 2149,
+        ATOM684 = 2150,
+        ATOM685 = 2151,
+        ATOM686 = 2152,
+        ATOM687 = 2153,
+        ATOM688 = 2154,
+        ATOM689 = 2155,
+        ATOM69 = 2156,
+        ATOM690 = 2157,
+        ATOM691 = 2158,
+        ATOM692 = 2159,
+        ATOM693 = 2160,
+        ATOM694 = 2161,
+        ATOM695 = 2162,
+        ATOM696 = 2163,
+        ATOM697 = 2164,
+        ATOM698 = 2165,
+        ATOM699 = 2166,
+        ATOM7 = 2167,
+        ATOM70 = 2168,
+        ATOM700 = 2169,
+        ATOM701 = 2170,
+        ATOM702 = 2171,
+        ATOM703 = 2172,
+        ATOM704 = 2173,
+        ATOM705 = 2174,
+        ATOM706 = 2175,
+        ATOM707 = 2176,
+        ATOM708 = 2177,
+        ATOM709 = 2178,
+        ATOM71 = 2179,
+        ATOM710 = 2180,
+        ATOM711 = 2181,
+        ATOM712 = 2182,
+        ATOM713 = 2183,
+        ATOM714 = 2184,
+        ATOM715 = 2185,
+        ATOM716 = 2186,
+        ATOM717 = 2187,
+        ATOM718 = 2188,
+        ATOM719 = 2189,
+        ATOM72 = 2190,
+        ATOM720 = 2191,
+        ATOM721 = 2192,
+        ATOM722 = 2193,
+        ATOM723 = 2194,
+        ATOM724 = 2195,
+        ATOM725 = 2196,
+        ATOM726 = 2197,
+        ATOM727 = 2198,
+        ATOM728 = 2199,
+        ATOM729 = 2200,
+        ATOM73 = 2201,
+        ATOM730 = 2202,
+        ATOM731 = 2203,
+        ATOM732 = 2204,
+        ATOM733 = 2205,
+        ATOM734 = 2206,
+        ATOM735 = 2207,
+        ATOM736 = 2208,
+        ATOM737 = 2209,
+        ATOM738 = 2210,
+        ATOM739 = 2211,
+        ATOM74 = 2212,
+        ATOM740 = 2213,
+        ATOM741 = 2214,
+        ATOM742 = 2215,
+        ATOM743 = 2216,
+        ATOM744 = 2217,
+        ATOM745 = 2218,
+        ATOM746 = 2219,
+        ATOM747 = 2220,
+        ATOM748 = 2221,
+        ATOM749 = 2222,
+        ATOM75 = 2223,
+        ATOM750 = 2224,
+        ATOM751 = 2225,
+        ATOM752 = 2226,
+        ATOM753 = 2227,
+        ATOM754 = 2228,
+        ATOM755 = 2229,
+        ATOM756 = 2230,
+        ATOM757 = 2231,
+        ATOM758 = 2232,
+        ATOM759 = 2233,
+        ATOM76 = 2234,
+        ATOM760 = 2235,
+        ATOM761 = 2236,
+        ATOM762 = 2237,
+        ATOM763 = 2238,
+        ATOM764 = 2239,
+        ATOM765 = 2240,
+        ATOM766 = 2241,
+        ATOM767 = 2242,
+        ATOM768 = 2243,
+        ATOM769 = 2244,
+        ATOM77 = 2245,
+        ATOM770 = 2246,
+        ATOM771 = 2247,
+        ATOM772 = 2248,
+        ATOM773 = 2249,
+        ATOM774 = 2250,
+        ATOM775 = 2251,
+        ATOM776 = 2252,
+        ATOM777 = 2253,
+        ATOM778 = 2254,
+        ATOM779 = 2255,
+        ATOM78 = 2256,
+        ATOM780 = 2257,
+        ATOM781 = 2258,
+        ATOM782 = 2259,
+        ATOM783 = 2260,
+        ATOM784 = 2261,
+        ATOM785 = 2262,
+        ATOM786 = 2263,
+        ATOM787 = 2264,
+        ATOM788 = 2265,
+        ATOM789 = 2266,
+        ATOM79 = 2267,
+        ATOM790 = 2268,
+        ATOM791 = 2269,
+        ATOM792 = 2270,
+        ATOM793 = 2271,
+        ATOM794 = 2272,
+        ATOM795 = 2273,
+        ATOM796 = 2274,
+        ATOM797 = 2275,
+        ATOM798 = 2276,
+        ATOM799 = 2277,
+        ATOM8 = 2278,
+        ATOM80 = 2279,
+        ATOM800 = 2280,
+        ATOM801 = 2281,
+        ATOM802 = 2282,
+        ATOM803 = 2283,
+        ATOM804 = 2284,
+        ATOM805 = 2285,
+        ATOM806 = 2286,
+        ATOM807 = 2287,
+        ATOM808 = 2288,
+        ATOM809 = 2289,
+        ATOM81 = 2290,
+        ATOM810 = 2291,
+        ATOM811 = 2292,
+        ATOM812 = 2293,
+        ATOM813 = 2294,
+        ATOM814 = 2295,
+        ATOM815 = 2296,
+        ATOM816 = 2297,
+        ATOM817 = 2298,
+        ATOM818 = 2299,
+        ATOM819 = 2300,
+        ATOM82 = 2301,
+        ATOM820 = 2302,
+        ATOM821 = 2303,
+        ATOM822 = 2304,
+        ATOM823 = 2305,
+        ATOM824 = 2306,
+        ATOM825 = 2307,
+        ATOM826 = 2308,
+        ATOM827 = 2309,
+        ATOM828 = 2310,
+        ATOM829 = 2311,
+        ATOM83 = 2312,
+        ATOM830 = 2313,
+        ATOM831 = 2314,
+        ATOM832 = 2315,
+        ATOM833 = 2316,
+        ATOM834 = 2317,
+        ATOM835 = 2318,
+        ATOM836 = 2319,
+        ATOM837 = 2320,
+        ATOM838 = 2321,
+        ATOM839 = 2322,
+        ATOM84 = 2323,
+        ATOM840 = 2324,
+        ATOM841 = 2325,
+        ATOM842 = 2326,
+        ATOM843 = 2327,
+        ATOM844 = 2328,
+        ATOM845 = 2329,
+        ATOM846 = 2330,
+        ATOM847 = 2331,
+        ATOM848 = 2332,
+        ATOM849 = 2333,
+        ATOM85 = 2334,
+        ATOM850 = 2335,
+        ATOM851 = 2336,
+        ATOM852 = 2337,
+        ATOM853 = 2338,
+        ATOM854 = 2339,
+        ATOM855 = 2340,
+        ATOM856 = 2341,
+        ATOM857 = 2342,
+        ATOM858 = 2343,
+        ATOM859 = 2344,
+        ATOM86 = 2345,
+        ATOM860 = 2346,
+        ATOM861 = 2347,
+        ATOM862 = 2348,
+        ATOM863 = 2349,
+        ATOM864 = 2350,
+        ATOM865 = 2351,
+        ATOM866 = 2352,
+        ATOM867 = 2353,
+        ATOM868 = 2354,
+        ATOM869 = 2355,
+        ATOM87 = 2356,
+        ATOM870 = 2357,
+        ATOM871 = 2358,
+        ATOM872 = 2359,
+        ATOM873 = 2360,
+        ATOM874 = 2361,
+        ATOM875 = 2362,
+        ATOM876 = 2363,
+        ATOM877 = 2364,
+        ATOM878 = 2365,
+        ATOM879 = 2366,
+        ATOM88 = 2367,
+        ATOM880 = 2368,
+        ATOM881 = 2369,
+        ATOM882 = 2370,
+        ATOM883 = 2371,
+        ATOM884 = 2372,
+        ATOM885 = 2373,
+        ATOM886 = 2374,
+        ATOM887 = 2375,
+        ATOM888 = 2376,
+        ATOM889 = 2377,
+        ATOM89 = 2378,
+        ATOM890 = 2379,
+        ATOM891 = 2380,
+        ATOM892 = 2381,
+        ATOM893 = 2382,
+        ATOM894 = 2383,
+        ATOM895 = 2384,
+        ATOM896 = 2385,
+        ATOM897 = 2386,
+        ATOM898 = 2387,
+        ATOM899 = 2388,
+        ATOM9 = 2389,
+        ATOM90 = 2390,
+        ATOM900 = 2391,
+        ATOM901 = 2392,
+        ATOM902 = 2393,
+        ATOM903 = 2394,
+        ATOM904 = 2395,
+        ATOM905 = 2396,
+        ATOM906 = 2397,
+        ATOM907 = 2398,
+        ATOM908 = 2399,
+        ATOM909 = 2400,
+        ATOM91 = 2401,
+        ATOM910 = 2402,
+        ATOM911 = 2403,
+        ATOM912 = 2404,
+        ATOM913 = 2405,
+        ATOM914 = 2406,
+        ATOM915 = 2407,
+        ATOM916 = 2408,
+        ATOM917 = 2409,
+        ATOM918 = 2410,
+        ATOM919 = 2411,
+        ATOM92 = 2412,
+        ATOM920 = 2413,
+        ATOM921 = 2414,
+        ATOM922 = 2415,
+        ATOM923 = 2416,
+        ATOM924 = 2417,
+        ATOM925 = 2418,
+        ATOM926 = 2419,
+        ATOM927 = 2420,
+        ATOM928 = 2421,
+        ATOM929 = 2422,
+        ATOM93 = 2423,
+        ATOM930 = 2424,
+        ATOM931 = 2425,
+        ATOM932 = 2426,
+        ATOM933 = 2427,
+        ATOM934 = 2428,
+        ATOM935 = 2429,
+        ATOM936 = 2430,
+        ATOM937 = 2431,
+        ATOM938 = 2432,
+        ATOM939 = 2433,
+        ATOM94 = 2434,
+        ATOM940 = 2435,
+        ATOM941 = 2436,
+        ATOM942 = 2437,
+        ATOM943 = 2438,
+        ATOM944 = 2439,
+        ATOM945 = 2440,
+        ATOM946 = 2441,
+        ATOM947 = 2442,
+        ATOM948 = 2443,
+        ATOM949 = 2444,
+        ATOM95 = 2445,
+        ATOM950 = 2446,
+        ATOM951 = 2447,
+        ATOM952 = 2448,
+        ATOM953 = 2449,
+        ATOM954 = 2450,
+        ATOM955 = 2451,
+        ATOM956 = 2452,
+        ATOM957 = 2453,
+        ATOM958 = 2454,
+        ATOM959 = 2455,
+        ATOM96 = 2456,
+        ATOM960 = 2457,
+        ATOM961 = 2458,
+        ATOM962 = 2459,
+        ATOM963 = 2460,
+        ATOM964 = 2461,
+        ATOM965 = 2462,
+        ATOM966 = 2463,
+        ATOM967 = 2464,
+        ATOM968 = 2465,
+        ATOM969 = 2466,
+        ATOM97 = 2467,
+        ATOM970 = 2468,
+        ATOM971 = 2469,
+        ATOM972 = 2470,
+        ATOM973 = 2471,
+        ATOM974 = 2472,
+        ATOM975 = 2473,
+        ATOM976 = 2474,
+        ATOM977 = 2475,
+        ATOM978 = 2476,
+        ATOM979 = 2477,
+        ATOM98 = 2478,
+        ATOM980 = 2479,
+        ATOM981 = 2480,
+        ATOM982 = 2481,
+        ATOM983 = 2482,
+        ATOM984 = 2483,
+        ATOM985 = 2484,
+        ATOM986 = 2485,
+        ATOM987 = 2486,
+        ATOM988 = 2487,
+        ATOM989 = 2488,
+        ATOM99 = 2489,
+        ATOM990 = 2490,
+        ATOM991 = 2491,
+        ATOM992 = 2492,
+        ATOM993 = 2493,
+        ATOM994 = 2494,
+        ATOM995 = 2495,
+        ATOM996 = 2496,
+        ATOM997 = 2497,
+        ATOM998 = 2498,
+        ATOM999 = 2499,
+        COMMA = 2500,
+        LP0 = 2501,
+        LP1 = 2502,
+        LP10 = 2503,
+        LP100 = 2504,
+        LP1000 = 2505,
+        LP1001 = 2506,
+        LP1002 = 2507,
+        LP1003 = 2508,
+        LP1004 = 2509,
+        LP1005 = 2510,
+        LP1006 = 2511,
+        LP1007 = 2512,
+        LP1008 = 2513,
+        LP1009 = 2514,
+        LP101 = 2515,
+        LP1010 = 2516,
+        LP1011 = 2517,
+        LP1012 = 2518,
+        LP1013 = 2519,
+        LP1014 = 2520,
+        LP1015 = 2521,
+        LP1016 = 2522,
+        LP1017 = 2523,
+        LP1018 = 2524,
+        LP1019 = 2525,
+        LP102 = 2526,
+        LP1020 = 2527,
+        LP1021 = 2528,
+        LP1022 = 2529,
+        LP1023 = 2530,
+        LP1024 = 2531,
+        LP1025 = 2532,
+        LP1026 = 2533,
+        LP1027 = 2534,
+        LP1028 = 2535,
+        LP1029 = 2536,
+        LP103 = 2537,
+        LP1030 = 2538,
+        LP1031 = 2539,
+        LP1032 = 2540,
+        LP1033 = 2541,
+        LP1034 = 2542,
+        LP1035 = 2543,
+        LP1036 = 2544,
+        LP1037 = 2545,
+        LP1038 = 2546,
+        LP1039 = 2547,
+        LP104 = 2548,
+        LP1040 = 2549,
+        LP1041 = 2550,
+        LP1042 = 2551,
+        LP1043 = 2552,
+        LP1044 = 2553,
+        LP1045 = 2554,
+        LP1046 = 2555,
+        LP1047 = 2556,
+        LP1048 = 2557,
+        LP1049 = 2558,
+        LP105 = 2559,
+        LP1050 = 2560,
+        LP1051 = 2561,
+        LP1052 = 2562,
+        LP1053 = 2563,
+        LP1054 = 2564,
+        LP1055 = 2565,
+        LP1056 = 2566,
+        LP1057 = 2567,
+        LP1058 = 2568,
+        LP1059 = 2569,
+        LP106 = 2570,
+        LP1060 = 2571,
+        LP1061 = 2572,
+        LP1062 = 2573,
+        LP1063 = 2574,
+        LP1064 = 2575,
+        LP1065 = 2576,
+        LP1066 = 2577,
+        LP1067 = 2578,
+        LP1068 = 2579,
+        LP1069 = 2580,
+        LP107 = 2581,
+        LP1070 = 2582,
+        LP1071 = 2583,
+        LP1072 = 2584,
+        LP1073 = 2585,
+        LP1074 = 2586,
+        LP1075 = 2587,
+        LP1076 = 2588,
+        LP1077 = 2589,
+        LP1078 = 2590,
+        LP1079 = 2591,
+        LP108 = 2592,
+        LP1080 = 2593,
+        LP1081 = 2594,
+        LP1082 = 2595,
+        LP1083 = 2596,
+        LP1084 = 2597,
+        LP1085 = 2598,
+        LP1086 = 2599,
+        LP1087 = 2600,
+        LP1088 = 2601,
+        LP1089 = 2602,
+        LP109 = 2603,
+        LP1090 = 2604,
+        LP1091 = 2605,
+        LP1092 = 2606,
+        LP1093 = 2607,
+        LP1094 = 2608,
+        LP1095 = 2609,
+        LP1096 = 2610,
+        LP1097 = 2611,
+        LP1098 = 2612,
+        LP1099 = 2613,
+        LP11 = 2614,
+        LP110 = 2615,
+        LP1100 = 2616,
+        LP1101 = 2617,
+        LP1102 = 2618,
+        LP1103 = 2619,
+        LP1104 = 2620,
+        LP1105 = 2621,
+        LP1106 = 2622,
+        LP1107 = 2623,
+        LP1108 = 2624,
+        LP1109 = 2625,
+        LP111 = 2626,
+        LP1110 = 2627,
+        LP1111 = 2628,
+        LP1112 = 2629,
+        LP1113 = 2630,
+        LP1114 = 2631,
+        LP1115 = 2632,
+        LP1116 = 2633,
+        LP1117 = 2634,
+        LP1118 = 2635,
+        LP1119 = 2636,
+        LP112 = 2637,
+        LP1120 = 2638,
+        LP1121 = 2639,
+        LP1122 = 2640,
+        LP1123 = 2641,
+        LP1124 = 2642,
+        LP1125 = 2643,
+        LP1126 = 2644,
+        LP1127 = 2645,
+        LP1128 = 2646,
+        LP1129 = 2647,
+        LP113 = 2648,
+        LP1130 = 2649,
+        LP1131 = 2650,
+        LP1132 = 2651,
+        LP1133 = 2652,
+        LP1134 = 2653,
+        LP1135 = 2654,
+        LP1136 = 2655,
+        LP1137 = 2656,
+        LP1138 = 2657,
+        LP1139 = 2658,
+        LP114 = 2659,
+        LP1140 = 2660,
+        LP1141 = 2661,
+        LP1142 = 2662,
+        LP1143 = 2663,
+        LP1144 = 2664,
+        LP1145 = 2665,
+        LP1146 = 2666,
+        LP1147 = 2667,
+        LP1148 = 2668,
+        LP1149 = 2669,
+        LP115 = 2670,
+        LP1150 = 2671,
+        LP1151 = 2672,
+        LP1152 = 2673,
+        LP1153 = 2674,
+        LP1154 = 2675,
+        LP1155 = 2676,
+        LP1156 = 2677,
+        LP1157 = 2678,
+        LP1158 = 2679,
+        LP1159 = 2680,
+        LP116 = 2681,
+        LP1160 = 2682,
+        LP1161 = 2683,
+        LP1162 = 2684,
+        LP1163 = 2685,
+        LP1164 = 2686,
+        LP1165 = 2687,
+        LP1166 = 2688,
+        LP1167 = 2689,
+        LP1168 = 2690,
+        LP1169 = 2691,
+        LP117 = 2692,
+        LP1170 = 2693,
+        LP1171 = 2694,
+        LP1172 = 2695,
+        LP1173 = 2696,
+        LP1174 = 2697,
+        LP1175 = 2698,
+        LP1176 = 2699,
+        LP1177 = 2700,
+        LP1178 = 2701,
+        LP1179 = 2702,
+        LP118 = 2703,
+        LP1180 = 2704,
+        LP1181 = 2705,
+        LP1182 = 2706,
+        LP1183 = 2707,
+        LP1184 = 2708,
+        LP1185 = 2709,
+        LP1186 = 2710,
+        LP1187 = 2711,
+        LP1188 = 2712,
+        LP1189 = 2713,
+        LP119 = 2714,
+        LP1190 = 2715,
+        LP1191 = 2716,
+        LP1192 = 2717,
+        LP1193 = 2718,
+        LP1194 = 2719,
+        LP1195 = 2720,
+        LP1196 = 2721,
+        LP1197 = 2722,
+        LP1198 = 2723,
+        LP1199 = 2724,
+        LP12 = 2725,
+        LP120 = 2726,
+        LP1200 = 2727,
+        LP1201 = 2728,
+        LP1202 = 2729,
+        LP1203 = 2730,
+        LP1204 = 2731,
+        LP1205 = 2732,
+        LP1206 = 2733,
+        LP1207 = 2734,
+        LP1208 = 2735,
+        LP1209 = 2736,
+        LP121 = 2737,
+        LP1210 = 2738,
+        LP1211 = 2739,
+        LP1212 = 2740,
+        LP1213 = 2741,
+        LP1214 = 2742,
+        LP1215 = 2743,
+        LP1216 = 2744,
+        LP1217 = 2745,
+        LP1218 = 2746,
+        LP1219 = 2747,
+        LP122 = 2748,
+        LP1220 = 2749,
+        LP1221 = 2750,
+        LP1222 = 2751,
+        LP1223 = 2752,
+        LP1224 = 2753,
+        LP1225 = 2754,
+        LP1226 = 2755,
+        LP1227 = 2756,
+        LP1228 = 2757,
+        LP1229 = 2758,
+        LP123 = 2759,
+        LP1230 = 2760,
+        LP1231 = 2761,
+        LP1232 = 2762,
+        LP1233 = 2763,
+        LP1234 = 2764,
+        LP1235 = 2765,
+        LP1236 = 2766,
+        LP1237 = 2767,
+        LP1238 = 2768,
+        LP1239 = 2769,
+        LP124 = 2770,
+        LP1240 = 2771,
+        LP1241 = 2772,
+        LP1242 = 2773,
+        LP1243 = 2774,
+        LP1244 = 2775,
+        LP1245 = 2776,
+        LP1246 = 2777,
+        LP1247 = 2778,
+        LP1248 = 2779,
+        LP1249 = 2780,
+        LP125 = 2781,
+        LP1250 = 2782,
+        LP1251 = 2783,
+        LP1252 = 2784,
+        LP1253 = 2785,
+        LP1254 = 2786,
+        LP1255 = 2787,
+        LP1256 = 2788,
+        LP1257 = 2789,
+        LP1258 = 2790,
+        LP1259 = 2791,
+        LP126 = 2792,
+        LP1260 = 2793,
+        LP1261 = 2794,
+        LP1262 = 2795,
+        LP1263 = 2796,
+        LP1264 = 2797,
+        LP1265 = 2798,
+        LP1266 = 2799,
+        LP1267 = 2800,
+        LP1268 = 2801,
+        LP1269 = 2802,
+        LP127 = 2803,
+        LP1270 = 2804,
+        LP1271 = 2805,
+        LP1272 = 2806,
+        LP1273 = 2807,
+        LP1274 = 2808,
+        LP1275 = 2809,
+        LP1276 = 2810,
+        LP1277 = 2811,
+        LP1278 = 2812,
+        LP1279 = 2813,
+        LP128 = 2814,
+        LP1280 = 2815,
+        LP1281 = 2816,
+        LP1282 = 2817,
+        LP1283 = 2818,
+        LP1284 = 2819,
+        LP1285 = 2820,
+        LP1286 = 2821,
+        LP1287 = 2822,
+        LP1288 = 2823,
+        LP1289 = 2824,
+        LP129 = 2825,
+        LP1290 = 2826,
+        LP1291 = 2827,
+        LP1292 = 2828,
+        LP1293 = 2829,
+        LP1294 = 2830,
+        LP1295 = 2831,
+        LP1296 = 2832,
+        LP1297 = 2833,
+        LP1298 = 2834,
+        LP1299 = 2835,
+        LP13 = 2836,
+        LP130 = 2837,
+        LP1300 = 2838,
+        LP1301 = 2839,
+        LP1302 = 2840,
+        LP1303 = 2841,
+        LP1304 = 2842,
+        LP1305 = 2843,
+        LP1306 = 2844,
+        LP1307 = 2845,
+        LP1308 = 2846,
+        LP1309 = 2847,
+        LP131 = 2848,
+        LP1310 = 2849,
+        LP1311 = 2850,
+        LP1312 = 2851,
+        LP1313 = 2852,
+        LP1314 = 2853,
+        LP1315 = 2854,
+        LP1316 = 2855,
+        LP1317 = 2856,
+        LP1318 = 2857,
+        LP1319 = 2858,
+        LP132 = 2859,
+        LP1320 = 2860,
+        LP1321 = 2861,
+        LP1322 = 2862,
+        LP1323 = 2863,
+        LP1324 = 2864,
+        LP1325 = 2865,
+        LP1326 = 2866,
+        LP1327 = 2867,
+        LP1328 = 2868,
+        LP1329 = 2869,
+        LP133 = 2870,
+        LP1330 = 2871,
+        LP1331 = 2872,
+        LP1332 = 2873,
+        LP1333 = 2874,
+        LP1334 = 2875,
+        LP1335 = 2876,
+        LP1336 = 2877,
+        LP1337 = 2878,
+        LP1338 = 2879,
+        LP1339 = 2880,
+        LP134 = 2881,
+        LP1340 = 2882,
+        LP1341 = 2883,
+        LP1342 = 2884,
+        LP1343 = 2885,
+        LP1344 = 2886,
+        LP1345 = 2887,
+        LP1346 = 2888,
+        LP1347 = 2889,
+        LP1348 = 2890,
+        LP1349 = 2891,
+        LP135 = 2892,
+        LP1350 = 2893,
+        LP1351 = 2894,
+        LP1352 = 2895,
+        LP1353 = 2896,
+        LP1354 = 2897,
+        LP1355 = 2898,
+        LP1356 = 2899,
+        LP1357 = 2900,
+        LP1358 = 2901,
+        LP1359 = 2902,
+        LP136 = 2903,
+        LP1360 = 2904,
+        LP1361 = 2905,
+        LP1362 = 2906,
+        LP1363 = 2907,
+        LP1364 = 2908,
+        LP1365 = 2909,
+        LP1366 = 2910,
+        LP1367 = 2911,
+        LP1368 = 2912,
+        LP1369 = 2913,
+        LP137 = 2914,
+        LP1370 = 2915,
+        LP1371 = 2916,
+        LP1372 = 2917,
+        LP1373 = 2918,
+        LP1374 = 2919,
+        LP1375 = 2920,
+        LP1376 = 2921,
+        LP1377 = 2922,
+        LP1378 = 2923,
+        LP1379 = 2924,
+        LP138 = 2925,
+        LP1380 = 2926,
+        LP1381 = 2927,
+        LP1382 = 2928,
+        LP1383 = 2929,
+        LP1384 = 2930,
+        LP1385 = 2931,
+        LP1386 = 2932,
+        LP1387 = 2933,
+        LP1388 = 2934,
+        LP1389 = 2935,
+        LP139 = 2936,
+        LP1390 = 2937,
+        LP1391 = 2938,
+        LP1392 = 2939,
+        LP1393 = 2940,
+        LP1394 = 2941,
+        LP1395 = 2942,
+        LP1396 = 2943,
+        LP1397 = 2944,
+        LP1398 = 2945,
+        LP1399 = 2946,
+        LP14 = 2947,
+        LP140 = 2948,
+        LP1400 = 2949,
+        LP1401 = 2950,
+        LP1402 = 2951,
+        LP1403 = 2952,
+        LP1404 = 2953,
+        LP1405 = 2954,
+        LP1406 = 2955,
+        LP1407 = 2956,
+        LP1408 = 2957,
+        LP1409 = 2958,
+        LP141 = 2959,
+        LP1410 = 2960,
+        LP1411 = 2961,
+        LP1412 = 2962,
+        LP1413 = 2963,
+        LP1414 = 2964,
+        LP1415 = 2965,
+        LP1416 = 2966,
+        LP1417 = 2967,
+        LP1418 = 2968,
+        LP1419 = 2969,
+        LP142 = 2970,
+        LP1420 = 2971,
+        LP1421 = 2972,
+        LP1422 = 2973,
+        LP1423 = 2974,
+        LP1424 = 2975,
+        LP1425 = 2976,
+        LP1426 = 2977,
+        LP1427 = 2978,
+        LP1428 = 2979,
+        LP1429 = 2980,
+        LP143 = 2981,
+        LP1430 = 2982,
+        LP1431 = 2983,
+        LP1432 = 2984,
+        LP1433 = 2985,
+        LP1434 = 2986,
+        LP1435 = 2987,
+        LP1436 = 2988,
+        LP1437 = 2989,
+        LP1438 = 2990,
+        LP1439 = 2991,
+        LP144 = 2992,
+        LP1440 = 2993,
+        LP1441 = 2994,
+        LP1442 = 2995,
+        LP1443 = 2996,
+        LP1444 = 2997,
+        LP1445 = 2998,
+        LP1446 = 2999,
+        LP1447 = 3000,
+        LP1448 = 3001,
+        LP1449 = 3002,
+        LP145 = 3003,
+        LP1450 = 3004,
+        LP1451 = 3005,
+        LP1452 = 3006,
+        LP1453 = 3007,
+        LP1454 = 3008,
+        LP1455 = 3009,
+        LP1456 = 3010,
+        LP1457 = 3011,
+        LP1458 = 3012,
+        LP1459 = 3013,
+        LP146 = 3014,
+        LP1460 = 3015,
+        LP1461 = 3016,
+        LP1462 = 3017,
+        LP1463 = 3018,
+        LP1464 = 3019,
+        LP1465 = 3020,
+        LP1466 = 3021,
+        LP1467 = 3022,
+        LP1468 = 3023,
+        LP1469 = 3024,
+        LP147 = 3025,
+        LP1470 = 3026,
+        LP1471 = 3027,
+        LP1472 = 3028,
+        LP1473 = 3029,
+        LP1474 = 3030,
+        LP1475 = 3031,
+        LP1476 = 3032,
+        LP1477 = 3033,
+        LP1478 = 3034,
+        LP1479 = 3035,
+        LP148 = 3036,
+        LP1480 = 3037,
+        LP1481 = 3038,
+        LP1482 = 3039,
+        LP1483 = 3040,
+        LP1484 = 3041,
+        LP1485 = 3042,
+        LP1486 = 3043,
+        LP1487 = 3044,
+        LP1488 = 3045,
+        LP1489 = 3046,
+        LP149 = 3047,
+        LP1490 = 3048,
+        LP1491 = 3049,
+        LP1492 = 3050,
+        LP1493 = 3051,
+        LP1494 = 3052,
+        LP1495 = 3053,
+        LP1496 = 3054,
+        LP1497 = 3055,
+        LP1498 = 3056,
+        LP1499 = 3057,
+        LP15 = 3058,
+        LP150 = 3059,
+        LP1500 = 3060,
+        LP1501 = 3061,
+        LP1502 = 3062,
+        LP1503 = 3063,
+        LP1504 = 3064,
+        LP1505 = 3065,
+        LP1506 = 3066,
+        LP1507 = 3067,
+        LP1508 = 3068,
+        LP1509 = 3069,
+        LP151 = 3070,
+        LP1510 = 3071,
+        LP1511 = 3072,
+        LP1512 = 3073,
+        LP1513 = 3074,
+        LP1514 = 3075,
+        LP1515 = 3076,
+        LP1516 = 3077,
+        LP1517 = 3078,
+        LP1518 = 3079,
+        LP1519 = 3080,
+        LP152 = 3081,
+        LP1520 = 3082,
+        LP1521 = 3083,
+        LP1522 = 3084,
+        LP1523 = 3085,
+        LP1524 = 3086,
+        LP1525 = 3087,
+        LP1526 = 3088,
+        LP1527 = 3089,
+        LP1528 = 3090,
+        LP1529 = 3091,
+        LP153 = 3092,
+        LP1530 = 3093,
+        LP1531 = 3094,
+        LP1532 = 3095,
+        LP1533 = 3096,
+        LP1534 = 3097,
+        LP1535 = 3098,
+        LP1536 = 3099,
+        LP1537 = 3100,
+        LP1538 = 3101,
+        LP1539 = 3102,
+        LP154 = 3103,
+        LP1540 = 3104,
+        LP1541 = 3105,
+        LP1542 = 3106,
+        LP1543 = 3107,
+        LP1544 = 3108,
+        LP1545 = 3109,
+        LP1546 = 3110,
+        LP1547 = 3111,
+        LP1548 = 3112,
+        LP1549 = 3113,
+        LP155 = 3114,
+        LP1550 = 3115,
+        LP1551 = 3116,
+        LP1552 = 3117,
+        LP1553 = 3118,
+        LP1554 = 3119,
+        LP1555 = 3120,
+        LP1556 = 3121,
+        LP1557 = 3122,
+        LP1558 = 3123,
+        LP1559 = 3124,
+        LP156 = 3125,
+        LP1560 = 3126,
+        LP1561 = 3127,
+        LP1562 = 3128,
+        LP1563 = 3129,
+        LP1564 = 3130,
+        LP1565 = 3131,
+        LP1566 = 3132,
+        LP1567 = 3133,
+        LP1568 = 3134,
+        LP1569 = 3135,
+        LP157 = 3136,
+        LP1570 = 3137,
+        LP1571 = 3138,
+        LP1572 = 3139,
+        LP1573 = 3140,
+        LP1574 = 3141,
+        LP1575 = 3142,
+        LP1576 = 3143,
+        LP1577 = 3144,
+        LP1578 = 3145,
+        LP1579 = 3146,
+        LP158 = 3147,
+        LP1580 = 3148,
+        LP1581 = 3149,
+        LP1582 = 3150,
+        LP1583 = 3151,
+        LP1584 = 3152,
+        LP1585 = 3153,
+        LP1586 = 3154,
+        LP1587 = 3155,
+        LP1588 = 3156,
+        LP1589 = 3157,
+        LP159 = 3158,
+        LP1590 = 3159,
+        LP1591 = 3160,
+        LP1592 = 3161,
+        LP1593 = 3162,
+        LP1594 = 3163,
+        LP1595 = 3164,
+        LP1596 = 3165,
+        LP1597 = 3166,
+        LP1598 = 3167,
+        LP1599 = 3168,
+        LP16 = 3169,
+        LP160 = 3170,
+        LP1600 = 3171,
+        LP1601 = 3172,
+        LP1602 = 3173,
+        LP1603 = 3174,
+        LP1604 = 3175,
+        LP1605 = 3176,
+        LP1606 = 3177,
+        LP1607 = 3178,
+        LP1608 = 3179,
+        LP1609 = 3180,
+        LP161 = 3181,
+        LP1610 = 3182,
+        LP1611 = 3183,
+        LP1612 = 3184,
+        LP1613 = 3185,
+        LP1614 = 3186,
+        LP1615 = 3187,
+        LP1616 = 3188,
+        LP1617 = 3189,
+        LP1618 = 3190,
+        LP1619 = 3191,
+        LP162 = 3192,
+        LP1620 = 3193,
+        LP1621 = 3194,
+        LP1622 = 3195,
+        LP1623 = 3196,
+        LP1624 = 3197,
+        LP1625 = 3198,
+        LP1626 = 3199,
+        LP1627 = 3200,
+        LP1628 = 3201,
+        LP1629 = 3202,
+        LP163 = 3203,
+        LP1630 = 3204,
+        LP1631 = 3205,
+        LP1632 = 3206,
+        LP1633 = 3207,
+        LP1634 = 3208,
+        LP1635 = 3209,
+        LP1636 = 3210,
+        LP1637 = 3211,
+        LP1638 = 3212,
+        LP1639 = 3213,
+        LP164 = 3214,
+        LP1640 = 3215,
+        LP1641 = 3216,
+        LP1642 = 3217,
+        LP1643 = 3218,
+        LP1644 = 3219,
+        LP1645 = 3220,
+        LP1646 = 3221,
+        LP1647 = 3222,
+        LP1648 = 3223,
+        LP1649 = 3224,
+        LP165 = 3225,
+        LP1650 = 3226,
+        LP1651 = 3227,
+        LP1652 = 3228,
+        LP1653 = 3229,
+        LP1654 = 3230,
+        LP1655 = 3231,
+        LP1656 = 3232,
+        LP1657 = 3233,
+        LP1658 = 3234,
+        LP1659 = 3235,
+        LP166 = 3236,
+        LP1660 = 3237,
+        LP1661 = 3238,
+        LP1662 = 3239,
+        LP1663 = 3240,
+        LP1664 = 3241,
+        LP1665 = 3242,
+        LP1666 = 3243,
+        LP1667 = 3244,
+        LP1668 = 3245,
+        LP1669 = 3246,
+        LP167 = 3247,
+        LP1670 = 3248,
+        LP1671 = 3249,
+        LP1672 = 3250,
+        LP1673 = 3251,
+        LP1674 = 3252,
+        LP1675 = 3253,
+        LP1676 = 3254,
+        LP1677 = 3255,
+        LP1678 = 3256,
+        LP1679 = 3257,
+        LP168 = 3258,
+        LP1680 = 3259,
+        LP1681 = 3260,
+        LP1682 = 3261,
+        LP1683 = 3262,
+        LP1684 = 3263,
+        LP1685 = 3264,
+        LP1686 = 3265,
+        LP1687 = 3266,
+        LP1688 = 3267,
+        LP1689 = 3268,
+        LP169 = 3269,
+        LP1690 = 3270,
+        LP1691 = 3271,
+        LP1692 = 3272,
+        LP1693 = 3273,
+        LP1694 = 3274,
+        LP1695 = 3275,
+        LP1696 = 3276,
+        LP1697 = 3277,
+        LP1698 = 3278,
+        LP1699 = 3279,
+        LP17 = 3280,
+        LP170 = 3281,
+        LP1700 = 3282,
+        LP1701 = 3283,
+        LP1702 = 3284,
+        LP1703 = 3285,
+        LP1704 = 3286,
+        LP1705 = 3287,
+        LP1706 = 3288,
+        LP1707 = 3289,
+        LP1708 = 3290,
+        LP1709 = 3291,
+        LP171 = 3292,
+        LP1710 = 3293,
+        LP1711 = 3294,
+        LP1712 = 3295,
+        LP1713 = 3296,
+        LP1714 = 3297,
+        LP1715 = 3298,
+        LP1716 = 3299,
+        LP1717 = 3300,
+        LP1718 = 3301,
+        LP1719 = 3302,
+        LP172 = 3303,
+        LP1720 = 3304,
+        LP1721 = 3305,
+        LP1722 = 3306,
+        LP1723 = 3307,
+        LP1724 = 3308,
+        LP1725 = 3309,
+        LP1726 = 3310,
+        LP1727 = 3311,
+        LP1728 = 3312,
+        LP1729 = 3313,
+        LP173 = 3314,
+        LP1730 = 3315,
+        LP1731 = 3316,
+        LP1732 = 3317,
+        LP1733 = 3318,
+        LP1734 = 3319,
+        LP1735 = 3320,
+        LP1736 = 3321,
+        LP1737 = 3322,
+        LP1738 = 3323,
+        LP1739 = 3324,
+        LP174 = 3325,
+        LP1740 = 3326,
+        LP1741 = 3327,
+        LP1742 = 3328,
+        LP1743 = 3329,
+        LP1744 = 3330,
+        LP1745 = 3331,
+        LP1746 = 3332,
+        LP1747 = 3333,
+        LP1748 = 3334,
+        LP1749 = 3335,
+        LP175 = 3336,
+        LP1750 = 3337,
+        LP1751 = 3338,
+        LP1752 = 3339,
+        LP1753 = 3340,
+        LP1754 = 3341,
+        LP1755 = 3342,
+        LP1756 = 3343,
+        LP1757 = 3344,
+        LP1758 = 3345,
+        LP1759 = 3346,
+        LP176 = 3347,
+        LP1760 = 3348,
+        LP1761 = 3349,
+        LP1762 = 3350,
+        LP1763 = 3351,
+        LP1764 = 3352,
+        LP1765 = 3353,
+        LP1766 = 3354,
+        LP1767 = 3355,
+        LP1768 = 3356,
+        LP1769 = 3357,
+        LP177 = 3358,
+        LP1770 = 3359,
+        LP1771 = 3360,
+        LP1772 = 3361,
+        LP1773 = 3362,
+        LP1774 = 3363,
+        LP1775 = 3364,
+        LP1776 = 3365,
+        LP1777 = 3366,
+        LP1778 = 3367,
+        LP1779 = 3368,
+        LP178 = 3369,
+        LP1780 = 3370,
+        LP1781 = 3371,
+        LP1782 = 3372,
+        LP1783 = 3373,
+        LP1784 = 3374,
+        LP1785 = 3375,
+        LP1786 = 3376,
+        LP1787 = 3377,
+        LP1788 = 3378,
+        LP1789 = 3379,
+        LP179 = 3380,
+        LP1790 = 3381,
+        LP1791 = 3382,
+        LP1792 = 3383,
+        LP1793 = 3384,
+        LP1794 = 3385,
+        LP1795 = 3386,
+        LP1796 = 3387,
+        LP1797 = 3388,
+        LP1798 = 3389,
+        LP1799 = 3390,
+        LP18 = 3391,
+        LP180 = 3392,
+        LP1800 = 3393,
+        LP1801 = 3394,
+        LP1802 = 3395,
+        LP1803 = 3396,
+        LP1804 = 3397,
+        LP1805 = 3398,
+        LP1806 = 3399,
+        LP1807 = 3400,
+        LP1808 = 3401,
+        LP1809 = 3402,
+        LP181 = 3403,
+        LP1810 = 3404,
+        LP1811 = 3405,
+        LP1812 = 3406,
+        LP1813 = 3407,
+        LP1814 = 3408,
+        LP1815 = 3409,
+        LP1816 = 3410,
+        LP1817 = 3411,
+        LP1818 = 3412,
+        LP1819 = 3413,
+        LP182 = 3414,
+        LP1820 = 3415,
+        LP1821 = 3416,
+        LP1822 = 3417,
+        LP1823 = 3418,
+        LP1824 = 3419,
+        LP1825 = 3420,
+        LP1826 = 3421,
+        LP1827 = 3422,
+        LP1828 = 3423,
+        LP1829 = 3424,
+        LP183 = 3425,
+        LP1830 = 3426,
+        LP1831 = 3427,
+        LP1832 = 3428,
+        LP1833 = 3429,
+        LP1834 = 3430,
+        LP1835 = 3431,
+        LP1836 = 3432,
+        LP1837 = 3433,
+        LP1838 = 3434,
+        LP1839 = 3435,
+        LP184 = 3436,
+        LP1840 = 3437,
+        LP1841 = 3438,
+        LP1842 = 3439,
+        LP1843 = 3440,
+        LP1844 = 3441,
+        LP1845 = 3442,
+        LP1846 = 3443,
+        LP1847 = 3444,
+        LP1848 = 3445,
+        LP1849 = 3446,
+        LP185 = 3447,
+        LP1850 = 3448,
+        LP1851 = 3449,
+        LP1852 = 3450,
+        LP1853 = 3451,
+        LP1854 = 3452,
+        LP1855 = 3453,
+        LP1856 = 3454,
+        LP1857 = 3455,
+        LP1858 = 3456,
+        LP1859 = 3457,
+        LP186 = 3458,
+        LP1860 = 3459,
+        LP1861 = 3460,
+        LP1862 = 3461,
+        LP1863 = 3462,
+        LP1864 = 3463,
+        LP1865 = 3464,
+        LP1866 = 3465,
+        LP1867 = 3466,
+        LP1868 = 3467,
+        LP1869 = 3468,
+        LP187 = 3469,
+        LP1870 = 3470,
+        LP1871 = 3471,
+        LP1872 = 3472,
+        LP1873 = 3473,
+        LP1874 = 3474,
+        LP1875 = 3475,
+        LP1876 = 3476,
+        LP1877 = 3477,
+        LP1878 = 3478,
+        LP1879 = 3479,
+        LP188 = 3480,
+        LP1880 = 3481,
+        LP1881 = 3482,
+        LP1882 = 3483,
+        LP1883 = 3484,
+        LP1884 = 3485,
+        LP1885 = 3486,
+        LP1886 = 3487,
+        LP1887 = 3488,
+        LP1888 = 3489,
+        LP1889 = 3490,
+        LP189 = 3491,
+        LP1890 = 3492,
+        LP1891 = 3493,
+        LP1892 = 3494,
+        LP1893 = 3495,
+        LP1894 = 3496,
+        LP1895 = 3497,
+        LP1896 = 3498,
+        LP1897 = 3499,
+        LP1898 = 3500,
+        LP1899 = 3501,
+        LP19 = 3502,
+        LP190 = 3503,
+        LP1900 = 3504,
+        LP1901 = 3505,
+        LP1902 = 3506,
+        LP1903 = 3507,
+        LP1904 = 3508,
+        LP1905 = 3509,
+        LP1906 = 3510,
+        LP1907 = 3511,
+        LP1908 = 3512,
+        LP1909 = 3513,
+        LP191 = 3514,
+        LP1910 = 3515,
+        LP1911 = 3516,
+        LP1912 = 3517,
+        LP1913 = 3518,
+        LP1914 = 3519,
+        LP1915 = 3520,
+        LP1916 = 3521,
+        LP1917 = 3522,
+        LP1918 = 3523,
+        LP1919 = 3524,
+        LP192 = 3525,
+        LP1920 = 3526,
+        LP1921 = 3527,
+        LP1922 = 3528,
+        LP1923 = 3529,
+        LP1924 = 3530,
+        LP1925 = 3531,
+        LP1926 = 3532,
+        LP1927 = 3533,
+        LP1928 = 3534,
+        LP1929 = 3535,
+        LP193 = 3536,
+        LP1930 = 3537,
+        LP1931 = 3538,
+        LP1932 = 3539,
+        LP1933 = 3540,
+        LP1934 = 3541,
+        LP1935 = 3542,
+        LP1936 = 3543,
+        LP1937 = 3544,
+        LP1938 = 3545,
+        LP1939 = 3546,
+        LP194 = 3547,
+        LP1940 = 3548,
+        LP1941 = 3549,
+        LP1942 = 3550,
+        LP1943 = 3551,
+        LP1944 = 3552,
+        LP1945 = 3553,
+        LP1946 = 3554,
+        LP1947 = 3555,
+        LP1948 = 3556,
+        LP1949 = 3557,
+        LP195 = 3558,
+        LP1950 = 3559,
+        LP1951 = 3560,
+        LP1952 = 3561,
+        LP1953 = 3562,
+        LP1954 = 3563,
+        LP1955 = 3564,
+        LP1956 = 3565,
+        LP1957 = 3566,
+        LP1958 = 3567,
+        LP1959 = 3568,
+        LP196 = 3569,
+        LP1960 = 3570,
+        LP1961 = 3571,
+        LP1962 = 3572,
+        LP1963 = 3573,
+        LP1964 = 3574,
+        LP1965 = 3575,
+        LP1966 = 3576,
+        LP1967 = 3577,
+        LP1968 = 3578,
+        LP1969 = 3579,
+        LP197 = 3580,
+        LP1970 = 3581,
+        LP1971 = 3582,
+        LP1972 = 3583,
+        LP1973 = 3584,
+        LP1974 = 3585,
+        LP1975 = 3586,
+        LP1976 = 3587,
+        LP1977 = 3588,
+        LP1978 = 3589,
+        LP1979 = 3590,
+        LP198 = 3591,
+        LP1980 = 3592,
+        LP1981 = 3593,
+        LP1982 = 3594,
+        LP1983 = 3595,
+        LP1984 = 3596,
+        LP1985 = 3597,
+        LP1986 = 3598,
+        LP1987 = 3599,
+        LP1988 = 3600,
+        LP1989 = 3601,
+        LP199 = 3602,
+        LP1990 = 3603,
+        LP1991 = 3604,
+        LP1992 = 3605,
+        LP1993 = 3606,
+        LP1994 = 3607,
+        LP1995 = 3608,
+        LP1996 = 3609,
+        LP1997 = 3610,
+        LP1998 = 3611,
+        LP1999 = 3612,
+        LP2 = 3613,
+        LP20 = 3614,
+        LP200 = 3615,
+        LP2000 = 3616,
+        LP2001 = 3617,
+        LP2002 = 3618,
+        LP2003 = 3619,
+        LP2004 = 3620,
+        LP2005 = 3621,
+        LP2006 = 3622,
+        LP2007 = 3623,
+        LP2008 = 3624,
+        LP2009 = 3625,
+        LP201 = 3626,
+        LP2010 = 3627,
+        LP2011 = 3628,
+        LP2012 = 3629,
+        LP2013 = 3630,
+        LP2014 = 3631,
+        LP2015 = 3632,
+        LP2016 = 3633,
+        LP2017 = 3634,
+        LP2018 = 3635,
+        LP2019 = 3636,
+        LP202 = 3637,
+        LP2020 = 3638,
+        LP2021 = 3639,
+        LP2022 = 3640,
+        LP2023 = 3641,
+        LP2024 = 3642,
+        LP2025 = 3643,
+        LP2026 = 3644,
+        LP2027 = 3645,
+        LP2028 = 3646,
+        LP2029 = 3647,
+        LP203 = 3648,
+        LP2030 = 3649,
+        LP2031 = 3650,
+        LP2032 = 3651,
+        LP2033 = 3652,
+        LP2034 = 3653,
+        LP2035 = 3654,
+        LP2036 = 3655,
+        LP2037 = 3656,
+        LP2038 = 3657,
+        LP2039 = 3658,
+        LP204 = 3659,
+        LP2040 = 3660,
+        LP2041 = 3661,
+        LP2042 = 3662,
+        LP2043 = 3663,
+        LP2044 = 3664,
+        LP2045 = 3665,
+        LP2046 = 3666,
+        LP2047 = 3667,
+        LP2048 = 3668,
+        LP2049 = 3669,
+        LP205 = 3670,
+        LP2050 = 3671,
+        LP2051 = 3672,
+        LP2052 = 3673,
+        LP2053 = 3674,
+        LP2054 = 3675,
+        LP2055 = 3676,
+        LP2056 = 3677,
+        LP2057 = 3678,
+        LP2058 = 3679,
+        LP2059 = 3680,
+        LP206 = 3681,
+        LP2060 = 3682,
+        LP2061 = 3683,
+        LP2062 = 3684,
+        LP2063 = 3685,
+        LP2064 = 3686,
+        LP2065 = 3687,
+        LP2066 = 3688,
+        LP2067 = 3689,
+        LP2068 = 3690,
+        LP2069 = 3691,
+        LP207 = 3692,
+        LP2070 = 3693,
+        LP2071 = 3694,
+        LP2072 = 3695,
+        LP2073 = 3696,
+        LP2074 = 3697,
+        LP2075 = 3698,
+        LP2076 = 3699,
+        LP2077 = 3700,
+        LP2078 = 3701,
+        LP2079 = 3702,
+        LP208 = 3703,
+        LP2080 = 3704,
+        LP2081 = 3705,
+        LP2082 = 3706,
+        LP2083 = 3707,
+        LP2084 = 3708,
+        LP2085 = 3709,
+        LP2086 = 3710,
+        LP2087 = 3711,
+        LP2088 = 3712,
+        LP2089 = 3713,
+        LP209 = 3714,
+        LP2090 = 3715,
+        LP2091 = 3716,
+        LP2092 = 3717,
+        LP2093 = 3718,
+        LP2094 = 3719,
+        LP2095 = 3720,
+        LP2096 = 3721,
+        LP2097 = 3722,
+        LP2098 = 3723,
+        LP2099 = 3724,
+        LP21 = 3725,
+        LP210 = 3726,
+        LP2100 = 3727,
+        LP2101 = 3728,
+        LP2102 = 3729,
+        LP2103 = 3730,
+        LP2104 = 3731,
+        LP2105 = 3732,
+        LP2106 = 3733,
+        LP2107 = 3734,
+        LP2108 = 3735,
+        LP2109 = 3736,
+        LP211 = 3737,
+        LP2110 = 3738,
+        LP2111 = 3739,
+        LP2112 = 3740,
+        LP2113 = 3741,
+        LP2114 = 3742,
+        LP2115 = 3743,
+        LP2116 = 3744,
+        LP2117 = 3745,
+        LP2118 = 3746,
+        LP2119 = 3747,
+        LP212 = 3748,
+        LP2120 = 3749,
+        LP2121 = 3750,
+        LP2122 = 3751,
+        LP2123 = 3752,
+        LP2124 = 3753,
+        LP2125 = 3754,
+        LP2126 = 3755,
+        LP2127 = 3756,
+        LP2128 = 3757,
+        LP2129 = 3758,
+        LP213 = 3759,
+        LP2130 = 3760,
+        LP2131 = 3761,
+        LP2132 = 3762,
+        LP2133 = 3763,
+        LP2134 = 3764,
+        LP2135 = 3765,
+        LP2136 = 3766,
+        LP2137 = 3767,
+        LP2138 = 3768,
+        LP2139 = 3769,
+        LP214 = 3770,
+        LP2140 = 3771,
+        LP2141 = 3772,
+        LP2142 = 3773,
+        LP2143 = 3774,
+        LP2144 = 3775,
+        LP2145 = 3776,
+        LP2146 = 3777,
+        LP2147 = 3778,
+        LP2148 = 3779,
+        LP2149 = 3780,
+        LP215 = 3781,
+        LP2150 = 3782,
+        LP2151 = 3783,
+        LP2152 = 3784,
+        LP2153 = 3785,
+        LP2154 = 3786,
+        LP2155 = 3787,
+        LP2156 = 3788,
+        LP2157 = 3789,
+        LP2158 = 3790,
+        LP2159 = 3791,
+        LP216 = 3792,
+        LP2160 = 3793,
+        LP2161 = 3794,
+        LP2162 = 3795,
+        LP2163 = 3796,
+        LP2164 = 3797,
+        LP2165 = 3798,
+        LP2166 = 3799,
+        LP2167 = 3800,
+        LP2168 = 3801,
+        LP2169 = 3802,
+        LP217 = 3803,
+        LP2170 = 3804,
+        LP2171 = 3805,
+        LP2172 = 3806,
+        LP2173 = 3807,
+        LP2174 = 3808,
+        LP2175 = 3809,
+        LP2176 = 3810,
+        LP2177 = 3811,
+        LP2178 = 3812,
+        LP2179 = 3813,
+        LP218 = 3814,
+        LP2180 = 3815,
+        LP2181 = 3816,
+        LP2182 = 3817,
+        LP2183 = 3818,
+        LP2184 = 3819,
+        LP2185 = 3820,
+        LP2186 = 3821,
+        LP2187 = 3822,
+        LP2188 = 3823,
+        LP2189 = 3824,
+        LP219 = 3825,
+        LP2190 = 3826,
+        LP2191 = 3827,
+        LP2192 = 3828,
+        LP2193 = 3829,
+        LP2194 = 3830,
+        LP2195 = 3831,
+        LP2196 = 3832,
+        LP2197 = 3833,
+        LP2198 = 3834,
+        LP2199 = 3835,
+        LP22 = 3836,
+        LP220 = 3837,
+        LP2200 = 3838,
+        LP2201 = 3839,
+        LP2202 = 3840,
+        LP2203 = 3841,
+        LP2204 = 3842,
+        LP2205 = 3843,
+        LP2206 = 3844,
+        LP2207 = 3845,
+        LP2208 = 3846,
+        LP2209 = 3847,
+        LP221 = 3848,
+        LP2210 = 3849,
+        LP2211 = 3850,
+        LP2212 = 3851,
+        LP2213 = 3852,
+        LP2214 = 3853,
+        LP2215 = 3854,
+        LP2216 = 3855,
+        LP2217 = 3856,
+        LP2218 = 3857,
+        LP2219 = 3858,
+        LP222 = 3859,
+        LP2220 = 3860,
+        LP2221 = 3861,
+        LP2222 = 3862,
+        LP2223 = 3863,
+        LP2224 = 3864,
+        LP2225 = 3865,
+        LP2226 = 3866,
+        LP2227 = 3867,
+        LP2228 = 3868,
+        LP2229 = 3869,
+        LP223 = 3870,
+        LP2230 = 3871,
+        LP2231 = 3872,
+        LP2232 = 3873,
+        LP2233 = 3874,
+        LP2234 = 3875,
+        LP2235 = 3876,
+        LP2236 = 3877,
+        LP2237 = 3878,
+        LP2238 = 3879,
+        LP2239 = 3880,
+        LP224 = 3881,
+        LP2240 = 3882,
+        LP2241 = 3883,
+        LP2242 = 3884,
+        LP2243 = 3885,
+        LP2244 = 3886,
+        LP2245 = 3887,
+        LP2246 = 3888,
+        LP2247 = 3889,
+        LP2248 = 3890,
+        LP2249 = 3891,
+        LP225 = 3892,
+        LP2250 = 3893,
+        LP2251 = 3894,
+        LP2252 = 3895,
+        LP2253 = 3896,
+        LP2254 = 3897,
+        LP2255 = 3898,
+        LP2256 = 3899,
+        LP2257 = 3900,
+        LP2258 = 3901,
+        LP2259 = 3902,
+        LP226 = 3903,
+        LP2260 = 3904,
+        LP2261 = 3905,
+        LP2262 = 3906,
+        LP2263 = 3907,
+        LP2264 = 3908,
+        LP2265 = 3909,
+        LP2266 = 3910,
+        LP2267 = 3911,
+        LP2268 = 3912,
+        LP2269 = 3913,
+        LP227 = 3914,
+        LP2270 = 3915,
+        LP2271 = 3916,
+        LP2272 = 3917,
+        LP2273 = 3918,
+        LP2274 = 3919,
+        LP2275 = 3920,
+        LP2276 = 3921,
+        LP2277 = 3922,
+        LP2278 = 3923,
+        LP2279 = 3924,
+        LP228 = 3925,
+        LP2280 = 3926,
+        LP2281 = 3927,
+        LP2282 = 3928,
+        LP2283 = 3929,
+        LP2284 = 3930,
+        LP2285 = 3931,
+        LP2286 = 3932,
+        LP2287 = 3933,
+        LP2288 = 3934,
+        LP2289 = 3935,
+        LP229 = 3936,
+        LP2290 = 3937,
+        LP2291 = 3938,
+        LP2292 = 3939,
+        LP2293 = 3940,
+        LP2294 = 3941,
+        LP2295 = 3942,
+        LP2296 = 3943,
+        LP2297 = 3944,
+        LP2298 = 3945,
+        LP2299 = 3946,
+        LP23 = 3947,
+        LP230 = 3948,
+        LP2300 = 3949,
+        LP2301 = 3950,
+        LP2302 = 3951,
+        LP2303 = 3952,
+        LP2304 = 3953,
+        LP2305 = 3954,
+        LP2306 = 3955,
+        LP2307 = 3956,
+        LP2308 = 3957,
+        LP2309 = 3958,
+        LP231 = 3959,
+        LP2310 = 3960,
+        LP2311 = 3961,
+        LP2312 = 3962,
+        LP2313 = 3963,
+        LP2314 = 3964,
+        LP2315 = 3965,
+        LP2316 = 3966,
+        LP2317 = 3967,
+        LP2318 = 3968,
+        LP2319 = 3969,
+        LP232 = 3970,
+        LP2320 = 3971,
+        LP2321 = 3972,
+        LP2322 = 3973,
+        LP2323 = 3974,
+        LP2324 = 3975,
+        LP2325 = 3976,
+        LP2326 = 3977,
+        LP2327 = 3978,
+        LP2328 = 3979,
+        LP2329 = 3980,
+        LP233 = 3981,
+        LP2330 = 3982,
+        LP2331 = 3983,
+        LP2332 = 3984,
+        LP2333 = 3985,
+        LP2334 = 3986,
+        LP2335 = 3987,
+        LP2336 = 3988,
+        LP2337 = 3989,
+        LP2338 = 3990,
+        LP2339 = 3991,
+        LP234 = 3992,
+        LP2340 = 3993,
+        LP2341 = 3994,
+        LP2342 = 3995,
+        LP2343 = 3996,
+        LP2344 = 3997,
+        LP2345 = 3998,
+        LP2346 = 3999,
+        LP2347 = 4000,
+        LP2348 = 4001,
+        LP2349 = 4002,
+        LP235 = 4003,
+        LP2350 = 4004,
+        LP2351 = 4005,
+        LP2352 = 4006,
+        LP2353 = 4007,
+        LP2354 = 4008,
+        LP2355 = 4009,
+        LP2356 = 4010,
+        LP2357 = 4011,
+        LP2358 = 4012,
+        LP2359 = 4013,
+        LP236 = 4014,
+        LP2360 = 4015,
+        LP2361 = 4016,
+        LP2362 = 4017,
+        LP2363 = 4018,
+        LP2364 = 4019,
+        LP2365 = 4020,
+        LP2366 = 4021,
+        LP2367 = 4022,
+        LP2368 = 4023,
+        LP2369 = 4024,
+        LP237 = 4025,
+        LP2370 = 4026,
+        LP2371 = 4027,
+        LP2372 = 4028,
+        LP2373 = 4029,
+        LP2374 = 4030,
+        LP2375 = 4031,
+        LP2376 = 4032,
+        LP2377 = 4033,
+        LP2378 = 4034,
+        LP2379 = 4035,
+        LP238 = 4036,
+        LP2380 = 4037,
+        LP2381 = 4038,
+        LP2382 = 4039,
+        LP2383 = 4040,
+        LP2384 = 4041,
+        LP2385 = 4042,
+        LP2386 = 4043,
+        LP2387 = 4044,
+        LP2388 = 4045,
+        LP2389 = 4046,
+        LP239 = 4047,
+        LP2390 = 4048,
+        LP2391 = 4049,
+        LP2392 = 4050,
+        LP2393 = 4051,
+        LP2394 = 4052,
+        LP2395 = 4053,
+        LP2396 = 4054,
+        LP2397 = 4055,
+        LP2398 = 4056,
+        LP2399 = 4057,
+        LP24 = 4058,
+        LP240 = 4059,
+        LP2400 = 4060,
+        LP2401 = 4061,
+        LP2402 = 4062,
+        LP2403 = 4063,
+        LP2404 = 4064,
+        LP2405 = 4065,
+        LP2406 = 4066,
+        LP2407 = 4067,
+        LP2408 = 4068,
+        LP2409 = 4069,
+        LP241 = 4070,
+        LP2410 = 4071,
+        LP2411 = 4072,
+        LP2412 = 4073,
+        LP2413 = 4074,
+        LP2414 = 4075,
+        LP2415 = 4076,
+        LP2416 = 4077,
+        LP2417 = 4078,
+        LP2418 = 4079,
+        LP2419 = 4080,
+        LP242 = 4081,
+        LP2420 = 4082,
+        LP2421 = 4083,
+        LP2422 = 4084,
+        LP2423 = 4085,
+        LP2424 = 4086,
+        LP2425 = 4087,
+        LP2426 = 4088,
+        LP2427 = 4089,
+        LP2428 = 4090,
+        LP2429 = 4091,
+        LP243 = 4092,
+        LP2430 = 4093,
+        LP2431 = 4094,
+        LP2432 = 4095,
+        LP2433 = 4096,
+        LP2434 = 4097,
+        LP2435 = 4098,
+        LP2436 = 4099,
+        LP2437 = 4100,
+        LP2438 = 4101,
+        LP2439 = 4102,
+        LP244 = 4103,
+        LP2440 = 4104,
+        LP2441 = 4105,
+        LP2442 = 4106,
+        LP2443 = 4107,
+        LP2444 = 4108,
+        LP2445 = 4109,
+        LP2446 = 4110,
+        LP2447 = 4111,
+        LP2448 = 4112,
+        LP2449 = 4113,
+        LP245 = 4114,
+        LP2450 = 4115,
+        LP2451 = 4116,
+        LP2452 = 4117,
+        LP2453 = 4118,
+        LP2454 = 4119,
+        LP2455 = 4120,
+        LP2456 = 4121,
+        LP2457 = 4122,
+        LP2458 = 4123,
+        LP2459 = 4124,
+        LP246 = 4125,
+        LP2460 = 4126,
+        LP2461 = 4127,
+        LP2462 = 4128,
+        LP2463 = 4129,
+        LP2464 = 4130,
+        LP2465 = 4131,
+        LP2466 = 4132,
+        LP2467 = 4133,
+        LP2468 = 4134,
+        LP2469 = 4135,
+        LP247 = 4136,
+        LP2470 = 4137,
+        LP2471 = 4138,
+        LP2472 = 4139,
+        LP2473 = 4140,
+        LP2474 = 4141,
+        LP2475 = 4142,
+        LP2476 = 4143,
+        LP2477 = 4144,
+        LP2478 = 4145,
+        LP2479 = 4146,
+        LP248 = 4147,
+        LP2480 = 4148,
+        LP2481 = 4149,
+        LP2482 = 4150,
+        LP2483 = 4151,
+        LP2484 = 4152,
+        LP2485 = 4153,
+        LP2486 = 4154,
+        LP2487 = 4155,
+        LP2488 = 4156,
+        LP2489 = 4157,
+        LP249 = 4158,
+        LP2490 = 4159,
+        LP2491 = 4160,
+        LP2492 = 4161,
+        LP2493 = 4162,
+        LP2494 = 4163,
+        LP2495 = 4164,
+        LP2496 = 4165,
+        LP2497 = 4166,
+        LP2498 = 4167,
+        LP25 = 4168,
+        LP250 = 4169,
+        LP251 = 4170,
+        LP252 = 4171,
+        LP253 = 4172,
+        LP254 = 4173,
+        LP255 = 4174,
+        LP256 = 4175,
+        LP257 = 4176,
+        LP258 = 4177,
+        LP259 = 4178,
+        LP26 = 4179,
+        LP260 = 4180,
+        LP261 = 4181,
+        LP262 = 4182,
+        LP263 = 4183,
+        LP264 = 4184,
+        LP265 = 4185,
+        LP266 = 4186,
+        LP267 = 4187,
+        LP268 = 4188,
+        LP269 = 4189,
+        LP27 = 4190,
+        LP270 = 4191,
+        LP271 = 4192,
+        LP272 = 4193,
+        LP273 = 4194,
+        LP274 = 4195,
+        LP275 = 4196,
+        LP276 = 4197,
+        LP277 = 4198,
+        LP278 = 4199,
+        LP279 = 4200,
+        LP28 = 4201,
+        LP280 = 4202,
+        LP281 = 4203,
+        LP282 = 4204,
+        LP283 = 4205,
+        LP284 = 4206,
+        LP285 = 4207,
+        LP286 = 4208,
+        LP287 = 4209,
+        LP288 = 4210,
+        LP289 = 4211,
+        LP29 = 4212,
+        LP290 = 4213,
+        LP291 = 4214,
+        LP292 = 4215,
+        LP293 = 4216,
+        LP294 = 4217,
+        LP295 = 4218,
+        LP296 = 4219,
+        LP297 = 4220,
+        LP298 = 4221,
+        LP299 = 4222,
+        LP3 = 4223,
+        LP30 = 4224,
+        LP300 = 4225,
+        LP301 = 4226,
+        LP302 = 4227,
+        LP303 = 4228,
+        LP304 = 4229,
+        LP305 = 4230,
+        LP306 = 4231,
+        LP307 = 4232,
+        LP308 = 4233,
+        LP309 = 4234,
+        LP31 = 4235,
+        LP310 = 4236,
+        LP311 = 4237,
+        LP312 = 4238,
+        LP313 = 4239,
+        LP314 = 4240,
+        LP315 = 4241,
+        LP316 = 4242,
+        LP317 = 4243,
+        LP318 = 4244,
+        LP319 = 4245,
+        LP32 = 4246,
+        LP320 = 4247,
+        LP321 = 4248,
+        LP322 = 4249,
+        LP323 = 4250,
+        LP324 = 4251,
+        LP325 = 4252,
+        LP326 = 4253,
+        LP327 = 4254,
+        LP328 = 4255,
+        LP329 = 4256,
+        LP33 = 4257,
+        LP330 = 4258,
+        LP331 = 4259,
+        LP332 = 4260,
+        LP333 = 4261,
+        LP334 = 4262,
+        LP335 = 4263,
+        LP336 = 4264,
+        LP337 = 4265,
+        LP338 = 4266,
+        LP339 = 4267,
+        LP34 = 4268,
+        LP340 = 4269,
+        LP341 = 4270,
+        LP342 = 4271,
+        LP343 = 4272,
+        LP344 = 4273,
+        LP345 = 4274,
+        LP346 = 4275,
+        LP347 = 4276,
+        LP348 = 4277,
+        LP349 = 4278,
+        LP35 = 4279,
+        LP350 = 4280,
+        LP351 = 4281,
+        LP352 = 4282,
+        LP353 = 4283,
+        LP354 = 4284,
+        LP355 = 4285,
+        LP356 = 4286,
+        LP357 = 4287,
+        LP358 = 4288,
+        LP359 = 4289,
+        LP36 = 4290,
+        LP360 = 4291,
+        LP361 = 4292,
+        LP362 = 4293,
+        LP363 = 4294,
+        LP364 = 4295,
+        LP365 = 4296,
+        LP366 = 4297,
+        LP367 = 4298,
+        LP368 = 4299,
+        LP369 = 4300,
+        LP37 = 4301,
+        LP370 = 4302,
+        LP371 = 4303,
+        LP372 = 4304,
+        LP373 = 4305,
+        LP374 = 4306,
+        LP375 = 4307,
+        LP376 = 4308,
+        LP377 = 4309,
+        LP378 = 4310,
+        LP379 = 4311,
+        LP38 = 4312,
+        LP380 = 4313,
+        LP381 = 4314,
+        LP382 = 4315,
+        LP383 = 4316,
+        LP384 = 4317,
+        LP385 = 4318,
+        LP386 = 4319,
+        LP387 = 4320,
+        LP388 = 4321,
+        LP389 = 4322,
+        LP39 = 4323,
+        LP390 = 4324,
+        LP391 = 4325,
+        LP392 = 4326,
+        LP393 = 4327,
+        LP394 = 4328,
+        LP395 = 4329,
+        LP396 = 4330,
+        LP397 = 4331,
+        LP398 = 4332,
+        LP399 = 4333,
+        LP4 = 4334,
+        LP40 = 4335,
+        LP400 = 4336,
+        LP401 = 4337,
+        LP402 = 4338,
+        LP403 = 4339,
+        LP404 = 4340,
+        LP405 = 4341,
+        LP406 = 4342,
+        LP407 = 4343,
+        LP408 = 4344,
+        LP409 = 4345,
+        LP41 = 4346,
+        LP410 = 4347,
+        LP411 = 4348,
+        LP412 = 4349,
+        LP413 = 4350,
+        LP414 = 4351,
+        LP415 = 4352,
+        LP416 = 4353,
+        LP417 = 4354,
+        LP418 = 4355,
+        LP419 = 4356,
+        LP42 = 4357,
+        LP420 = 4358,
+        LP421 = 4359,
+        LP422 = 4360,
+        LP423 = 4361,
+        LP424 = 4362,
+        LP425 = 4363,
+        LP426 = 4364,
+        LP427 = 4365,
+        LP428 = 4366,
+        LP429 = 4367,
+        LP43 = 4368,
+        LP430 = 4369,
+        LP431 = 4370,
+        LP432 = 4371,
+        LP433 = 4372,
+        LP434 = 4373,
+        LP435 = 4374,
+        LP436 = 4375,
+        LP437 = 4376,
+        LP438 = 4377,
+        LP439 = 4378,
+        LP44 = 4379,
+        LP440 = 4380,
+        LP441 = 4381,
+        LP442 = 4382,
+        LP443 = 4383,
+        LP444 = 4384,
+        LP445 = 4385,
+        LP446 = 4386,
+        LP447 = 4387,
+        LP448 = 4388,
+        LP449 = 4389,
+        LP45 = 4390,
+        LP450 = 4391,
+        LP451 = 4392,
+        LP452 = 4393,
+        LP453 = 4394,
+        LP454 = 4395,
+        LP455 = 4396,
+        LP456 = 4397,
+        LP457 = 4398,
+        LP458 = 4399,
+        LP459 = 4400,
+        LP46 = 4401,
+        LP460 = 4402,
+        LP461 = 4403,
+        LP462 = 4404,
+        LP463 = 4405,
+        LP464 = 4406,
+        LP465 = 4407,
+        LP466 = 4408,
+        LP467 = 4409,
+        LP468 = 4410,
+        LP469 = 4411,
+        LP47 = 4412,
+        LP470 = 4413,
+        LP471 = 4414,
+        LP472 = 4415,
+        LP473 = 4416,
+        LP474 = 4417,
+        LP475 = 4418,
+        LP476 = 4419,
+        LP477 = 4420,
+        LP478 = 4421,
+        LP479 = 4422,
+        LP48 = 4423,
+        LP480 = 4424,
+        LP481 = 4425,
+        LP482 = 4426,
+        LP483 = 4427,
+        LP484 = 4428,
+        LP485 = 4429,
+        LP486 = 4430,
+        LP487 = 4431,
+        LP488 = 4432,
+        LP489 = 4433,
+        LP49 = 4434,
+        LP490 = 4435,
+        LP491 = 4436,
+        LP492 = 4437,
+        LP493 = 4438,
+        LP494 = 4439,
+        LP495 = 4440,
+        LP496 = 4441,
+        LP497 = 4442,
+        LP498 = 4443,
+        LP499 = 4444,
+        LP5 = 4445,
+        LP50 = 4446,
+        LP500 = 4447,
+        LP501 = 4448,
+        LP502 = 4449,
+        LP503 = 4450,
+        LP504 = 4451,
+        LP505 = 4452,
+        LP506 = 4453,
+        LP507 = 4454,
+        LP508 = 4455,
+        LP509 = 4456,
+        LP51 = 4457,
+        LP510 = 4458,
+        LP511 = 4459,
+        LP512 = 4460,
+        LP513 = 4461,
+        LP514 = 4462,
+        LP515 = 4463,
+        LP516 = 4464,
+        LP517 = 4465,
+        LP518 = 4466,
+        LP519 = 4467,
+        LP52 = 4468,
+        LP520 = 4469,
+        LP521 = 4470,
+        LP522 = 4471,
+        LP523 = 4472,
+        LP524 = 4473,
+        LP525 = 4474,
+        LP526 = 4475,
+        LP527 = 4476,
+        LP528 = 4477,
+        LP529 = 4478,
+        LP53 = 4479,
+        LP530 = 4480,
+        LP531 = 4481,
+        LP532 = 4482,
+        LP533 = 4483,
+        LP534 = 4484,
+        LP535 = 4485,
+        LP536 = 4486,
+        LP537 = 4487,
+        LP538 = 4488,
+        LP539 = 4489,
+        LP54 = 4490,
+        LP540 = 4491,
+        LP541 = 4492,
+        LP542 = 4493,
+        LP543 = 4494,
+        LP544 = 4495,
+        LP545 = 4496,
+        LP546 = 4497,
+        LP547 = 4498,
+        LP548 = 4499,
+        LP549 = 4500,
+        LP55 = 4501,
+        LP550 = 4502,
+        LP551 = 4503,
+        LP552 = 4504,
+        LP553 = 4505,
+        LP554 = 4506,
+        LP555 = 4507,
+        LP556 = 4508,
+        LP557 = 4509,
+        LP558 = 4510,
+        LP559 = 4511,
+        LP56 = 4512,
+        LP560 = 4513,
+        LP561 = 4514,
+        LP562 = 4515,
+        LP563 = 4516,
+        LP564 = 4517,
+        LP565 = 4518,
+        LP566 = 4519,
+        LP567 = 4520,
+        LP568 = 4521,
+        LP569 = 4522,
+        LP57 = 4523,
+        LP570 = 4524,
+        LP571 = 4525,
+        LP572 = 4526,
+        LP573 = 4527,
+        LP574 = 4528,
+        LP575 = 4529,
+        LP576 = 4530,
+        LP577 = 4531,
+        LP578 = 4532,
+        LP579 = 4533,
+        LP58 = 4534,
+        LP580 = 4535,
+        LP581 = 4536,
+        LP582 = 4537,
+        LP583 = 4538,
+        LP584 = 4539,
+        LP585 = 4540,
+        LP586 = 4541,
+        LP587 = 4542,
+        LP588 = 4543,
+        LP589 = 4544,
+        LP59 = 4545,
+        LP590 = 4546,
+        LP591 = 4547,
+        LP592 = 4548,
+        LP593 = 4549,
+        LP594 = 4550,
+        LP595 = 4551,
+        LP596 = 4552,
+        LP597 = 4553,
+        LP598 = 4554,
+        LP599 = 4555,
+        LP6 = 4556,
+        LP60 = 4557,
+        LP600 = 4558,
+        LP601 = 4559,
+        LP602 = 4560,
+        LP603 = 4561,
+        LP604 = 4562,
+        LP605 = 4563,
+        LP606 = 4564,
+        LP607 = 4565,
+        LP608 = 4566,
+        LP609 = 4567,
+        LP61 = 4568,
+        LP610 = 4569,
+        LP611 = 4570,
+        LP612 = 4571,
+        LP613 = 4572,
+        LP614 = 4573,
+        LP615 = 4574,
+        LP616 = 4575,
+        LP617 = 4576,
+        LP618 = 4577,
+        LP619 = 4578,
+        LP62 = 4579,
+        LP620 = 4580,
+        LP621 = 4581,
+        LP622 = 4582,
+        LP623 = 4583,
+        LP624 = 4584,
+        LP625 = 4585,
+        LP626 = 4586,
+        LP627 = 4587,
+        LP628 = 4588,
+        LP629 = 4589,
+        LP63 = 4590,
+        LP630 = 4591,
+        LP631 = 4592,
+        LP632 = 4593,
+        LP633 = 4594,
+        LP634 = 4595,
+        LP635 = 4596,
+        LP636 = 4597,
+        LP637 = 4598,
+        LP638 = 4599,
+        LP639 = 4600,
+        LP64 = 4601,
+        LP640 = 4602,
+        LP641 = 4603,
+        LP642 = 4604,
+        LP643 = 4605,
+        LP644 = 4606,
+        LP645 = 4607,
+        LP646 = 4608,
+        LP647 = 4609,
+        LP648 = 4610,
+        LP649 = 4611,
+        LP65 = 4612,
+        LP650 = 4613,
+        LP651 = 4614,
+        LP652 = 4615,
+        LP653 = 4616,
+        LP654 = 4617,
+        LP655 = 4618,
+        LP656 = 4619,
+        LP657 = 4620,
+        LP658 = 4621,
+        LP659 = 4622,
+        LP66 = 4623,
+        LP660 = 4624,
+        LP661 = 4625,
+        LP662 = 4626,
+        LP663 = 4627,
+        LP664 = 4628,
+        LP665 = 4629,
+        LP666 = 4630,
+        LP667 = 4631,
+        LP668 = 4632,
+        LP669 = 4633,
+        LP67 = 4634,
+        LP670 = 4635,
+        LP671 = 4636,
+        LP672 = 4637,
+        LP673 = 4638,
+        LP674 = 4639,
+        LP675 = 4640,
+        LP676 = 4641,
+        LP677 = 4642,
+        LP678 = 4643,
+        LP679 = 4644,
+        LP68 = 4645,
+        LP680 = 4646,
+        LP681 = 4647,
+        LP682 = 4648,
+        LP683 = 4649,
+        LP684 = 4650,
+        LP685 = 4651,
+        LP686 = 4652,
+        LP687 = 4653,
+        LP688 = 4654,
+        LP689 = 4655,
+        LP69 = 4656,
+        LP690 = 4657,
+        LP691 = 4658,
+        LP692 = 4659,
+        LP693 = 4660,
+        LP694 = 4661,
+        LP695 = 4662,
+        LP696 = 4663,
+        LP697 = 4664,
+        LP698 = 4665,
+        LP699 = 4666,
+        LP7 = 4667,
+        LP70 = 4668,
+        LP700 = 4669,
+        LP701 = 4670,
+        LP702 = 4671,
+        LP703 = 4672,
+        LP704 = 4673,
+        LP705 = 4674,
+        LP706 = 4675,
+        LP707 = 4676,
+        LP708 = 4677,
+        LP709 = 4678,
+        LP71 = 4679,
+        LP710 = 4680,
+        LP711 = 4681,
+        LP712 = 4682,
+        LP713 = 4683,
+        LP714 = 4684,
+        LP715 = 4685,
+        LP716 = 4686,
+        LP717 = 4687,
+        LP718 = 4688,
+        LP719 = 4689,
+        LP72 = 4690,
+        LP720 = 4691,
+        LP721 = 4692,
+        LP722 = 4693,
+        LP723 = 4694,
+        LP724 = 4695,
+        LP725 = 4696,
+        LP726 = 4697,
+        LP727 = 4698,
+        LP728 = 4699,
+        LP729 = 4700,
+        LP73 = 4701,
+        LP730 = 4702,
+        LP731 = 4703,
+        LP732 = 4704,
+        LP733 = 4705,
+        LP734 = 4706,
+        LP735 = 4707,
+        LP736 = 4708,
+        LP737 = 4709,
+        LP738 = 4710,
+        LP739 = 4711,
+        LP74 = 4712,
+        LP740 = 4713,
+        LP741 = 4714,
+        LP742 = 4715,
+        LP743 = 4716,
+        LP744 = 4717,
+        LP745 = 4718,
+        LP746 = 4719,
+        LP747 = 4720,
+        LP748 = 4721,
+        LP749 = 4722,
+        LP75 = 4723,
+        LP750 = 4724,
+        LP751 = 4725,
+        LP752 = 4726,
+        LP753 = 4727,
+        LP754 = 4728,
+        LP755 = 4729,
+        LP756 = 4730,
+        LP757 = 4731,
+        LP758 = 4732,
+        LP759 = 4733,
+        LP76 = 4734,
+        LP760 = 4735,
+        LP761 = 4736,
+        LP762 = 4737,
+        LP763 = 4738,
+        LP764 = 4739,
+        LP765 = 4740,
+        LP766 = 4741,
+        LP767 = 4742,
+        LP768 = 4743,
+        LP769 = 4744,
+        LP77 = 4745,
+        LP770 = 4746,
+        LP771 = 4747,
+        LP772 = 4748,
+        LP773 = 4749,
+        LP774 = 4750,
+        LP775 = 4751,
+        LP776 = 4752,
+        LP777 = 4753,
+        LP778 = 4754,
+        LP779 = 4755,
+        LP78 = 4756,
+        LP780 = 4757,
+        LP781 = 4758,
+        LP782 = 4759,
+        LP783 = 4760,
+        LP784 = 4761,
+        LP785 = 4762,
+        LP786 = 4763,
+        LP787 = 4764,
+        LP788 = 4765,
+        LP789 = 4766,
+        LP79 = 4767,
+        LP790 = 4768,
+        LP791 = 4769,
+        LP792 = 4770,
+        LP793 = 4771,
+        LP794 = 4772,
+        LP795 = 4773,
+        LP796 = 4774,
+        LP797 = 4775,
+        LP798 = 4776,
+        LP799 = 4777,
+        LP8 = 4778,
+        LP80 = 4779,
+        LP800 = 4780,
+        LP801 = 4781,
+        LP802 = 4782,
+        LP803 = 4783,
+        LP804 = 4784,
+        LP805 = 4785,
+        LP806 = 4786,
+        LP807 = 4787,
+        LP808 = 4788,
+        LP809 = 4789,
+        LP81 = 4790,
+        LP810 = 4791,
+        LP811 = 4792,
+        LP812 = 4793,
+        LP813 = 4794,
+        LP814 = 4795,
+        LP815 = 4796,
+        LP816 = 4797,
+        LP817 = 4798,
+        LP818 = 4799,
+        LP819 = 4800,
+        LP82 = 4801,
+        LP820 = 4802,
+        LP821 = 4803,
+        LP822 = 4804,
+        LP823 = 4805,
+        LP824 = 4806,
+        LP825 = 4807,
+        LP826 = 4808,
+        LP827 = 4809,
+        LP828 = 4810,
+        LP829 = 4811,
+        LP83 = 4812,
+        LP830 = 4813,
+        LP831 = 4814,
+        LP832 = 4815,
+        LP833 = 4816,
+        LP834 = 4817,
+        LP835 = 4818,
+        LP836 = 4819,
+        LP837 = 4820,
+        LP838 = 4821,
+        LP839 = 4822,
+        LP84 = 4823,
+        LP840 = 4824,
+        LP841 = 4825,
+        LP842 = 4826,
+        LP843 = 4827,
+        LP844 = 4828,
+        LP845 = 4829,
+        LP846 = 4830,
+        LP847 = 4831,
+        LP848 = 4832,
+        LP849 = 4833,
+        LP85 = 4834,
+        LP850 = 4835,
+        LP851 = 4836,
+        LP852 = 4837,
+        LP853 = 4838,
+        LP854 = 4839,
+        LP855 = 4840,
+        LP856 = 4841,
+        LP857 = 4842,
+        LP858 = 4843,
+        LP859 = 4844,
+        LP86 = 4845,
+        LP860 = 4846,
+        LP861 = 4847,
+        LP862 = 4848,
+        LP863 = 4849,
+        LP864 = 4850,
+        LP865 = 4851,
+        LP866 = 4852,
+        LP867 = 4853,
+        LP868 = 4854,
+        LP869 = 4855,
+        LP87 = 4856,
+        LP870 = 4857,
+        LP871 = 4858,
+        LP872 = 4859,
+        LP873 = 4860,
+        LP874 = 4861,
+        LP875 = 4862,
+        LP876 = 4863,
+        LP877 = 4864,
+        LP878 = 4865,
+        LP879 = 4866,
+        LP88 = 4867,
+        LP880 = 4868,
+        LP881 = 4869,
+        LP882 = 4870,
+        LP883 = 4871,
+        LP884 = 4872,
+        LP885 = 4873,
+        LP886 = 4874,
+        LP887 = 4875,
+        LP888 = 4876,
+        LP889 = 4877,
+        LP89 = 4878,
+        LP890 = 4879,
+        LP891 = 4880,
+        LP892 = 4881,
+        LP893 = 4882,
+        LP894 = 4883,
+        LP895 = 4884,
+        LP896 = 4885,
+        LP897 = 4886,
+        LP898 = 4887,
+        LP899 = 4888,
+        LP9 = 4889,
+        LP90 = 4890,
+        LP900 = 4891,
+        LP901 = 4892,
+        LP902 = 4893,
+        LP903 = 4894,
+        LP904 = 4895,
+        LP905 = 4896,
+        LP906 = 4897,
+        LP907 = 4898,
+        LP908 = 4899,
+        LP909 = 4900,
+        LP91 = 4901,
+        LP910 = 4902,
+        LP911 = 4903,
+        LP912 = 4904,
+        LP913 = 4905,
+        LP914 = 4906,
+        LP915 = 4907,
+        LP916 = 4908,
+        LP917 = 4909,
+        LP918 = 4910,
+        LP919 = 4911,
+        LP92 = 4912,
+        LP920 = 4913,
+        LP921 = 4914,
+        LP922 = 4915,
+        LP923 = 4916,
+        LP924 = 4917,
+        LP925 = 4918,
+        LP926 = 4919,
+        LP927 = 4920,
+        LP928 = 4921,
+        LP929 = 4922,
+        LP93 = 4923,
+        LP930 = 4924,
+        LP931 = 4925,
+        LP932 = 4926,
+        LP933 = 4927,
+        LP934 = 4928,
+        LP935 = 4929,
+        LP936 = 4930,
+        LP937 = 4931,
+        LP938 = 4932,
+        LP939 = 4933,
+        LP94 = 4934,
+        LP940 = 4935,
+        LP941 = 4936,
+        LP942 = 4937,
+        LP943 = 4938,
+        LP944 = 4939,
+        LP945 = 4940,
+        LP946 = 4941,
+        LP947 = 4942,
+        LP948 = 4943,
+        LP949 = 4944,
+        LP95 = 4945,
+        LP950 = 4946,
+        LP951 = 4947,
+        LP952 = 4948,
+        LP953 = 4949,
+        LP954 = 4950,
+        LP955 = 4951,
+        LP956 = 4952,
+        LP957 = 4953,
+        LP958 = 4954,
+        LP959 = 4955,
+        LP96 = 4956,
+        LP960 = 4957,
+        LP961 = 4958,
+        LP962 = 4959,
+        LP963 = 4960,
+        LP964 = 4961,
+        LP965 = 4962,
+        LP966 = 4963,
+        LP967 = 4964,
+        LP968 = 4965,
+        LP969 = 4966,
+        LP97 = 4967,
+        LP970 = 4968,
+        LP971 = 4969,
+        LP972 = 4970,
+        LP973 = 4971,
+        LP974 = 4972,
+        LP975 = 4973,
+        LP976 = 4974,
+        LP977 = 4975,
+        LP978 = 4976,
+        LP979 = 4977,
+        LP98 = 4978,
+        LP980 = 4979,
+        LP981 = 4980,
+        LP982 = 4981,
+        LP983 = 4982,
+        LP984 = 4983,
+        LP985 = 4984,
+        LP986 = 4985,
+        LP987 = 4986,
+        LP988 = 4987,
+        LP989 = 4988,
+        LP99 = 4989,
+        LP990 = 4990,
+        LP991 = 4991,
+        LP992 = 4992,
+        LP993 = 4993,
+        LP994 = 4994,
+        LP995 = 4995,
+        LP996 = 4996,
+        LP997 = 4997,
+        LP998 = 4998,
+        LP999 = 4999,
+        RP0 = 5000,
+        RP1 = 5001,
+        RP10 = 5002,
+        RP100 = 5003,
+        RP1000 = 5004,
+        RP1001 = 5005,
+        RP1002 = 5006,
+        RP1003 = 5007,
+        RP1004 = 5008,
+        RP1005 = 5009,
+        RP1006 = 5010,
+        RP1007 = 5011,
+        RP1008 = 5012,
+        RP1009 = 5013,
+        RP101 = 5014,
+        RP1010 = 5015,
+        RP1011 = 5016,
+        RP1012 = 5017,
+        RP1013 = 5018,
+        RP1014 = 5019,
+        RP1015 = 5020,
+        RP1016 = 5021,
+        RP1017 = 5022,
+        RP1018 = 5023,
+        RP1019 = 5024,
+        RP102 = 5025,
+        RP1020 = 5026,
+        RP1021 = 5027,
+        RP1022 = 5028,
+        RP1023 = 5029,
+        RP1024 = 5030,
+        RP1025 = 5031,
+        RP1026 = 5032,
+        RP1027 = 5033,
+        RP1028 = 5034,
+        RP1029 = 5035,
+        RP103 = 5036,
+        RP1030 = 5037,
+        RP1031 = 5038,
+        RP1032 = 5039,
+        RP1033 = 5040,
+        RP1034 = 5041,
+        RP1035 = 5042,
+        RP1036 = 5043,
+        RP1037 = 5044,
+        RP1038 = 5045,
+        RP1039 = 5046,
+        RP104 = 5047,
+        RP1040 = 5048,
+        RP1041 = 5049,
+        RP1042 = 5050,
+        RP1043 = 5051,
+        RP1044 = 5052,
+        RP1045 = 5053,
+        RP1046 = 5054,
+        RP1047 = 5055,
+        RP1048 = 5056,
+        RP1049 = 5057,
+        RP105 = 5058,
+        RP1050 = 5059,
+        RP1051 = 5060,
+        RP1052 = 5061,
+        RP1053 = 5062,
+        RP1054 = 5063,
+        RP1055 = 5064,
+        RP1056 = 5065,
+        RP1057 = 5066,
+        RP1058 = 5067,
+        RP1059 = 5068,
+        RP106 = 5069,
+        RP1060 = 5070,
+        RP1061 = 5071,
+        RP1062 = 5072,
+        RP1063 = 5073,
+        RP1064 = 5074,
+        RP1065 = 5075,
+        RP1066 = 5076,
+        RP1067 = 5077,
+        RP1068 = 5078,
+        RP1069 = 5079,
+        RP107 = 5080,
+        RP1070 = 5081,
+        RP1071 = 5082,
+        RP1072 = 5083,
+        RP1073 = 5084,
+        RP1074 = 5085,
+        RP1075 = 5086,
+        RP1076 = 5087,
+        RP1077 = 5088,
+        RP1078 = 5089,
+        RP1079 = 5090,
+        RP108 = 5091,
+        RP1080 = 5092,
+        RP1081 = 5093,
+        RP1082 = 5094,
+        RP1083 = 5095,
+        RP1084 = 5096,
+        RP1085 = 5097,
+        RP1086 = 5098,
+        RP1087 = 5099,
+        RP1088 = 5100,
+        RP1089 = 5101,
+        RP109 = 5102,
+        RP1090 = 5103,
+        RP1091 = 5104,
+        RP1092 = 5105,
+        RP1093 = 5106,
+        RP1094 = 5107,
+        RP1095 = 5108,
+        RP1096 = 5109,
+        RP1097 = 5110,
+        RP1098 = 5111,
+        RP1099 = 5112,
+        RP11 = 5113,
+        RP110 = 5114,
+        RP1100 = 5115,
+        RP1101 = 5116,
+        RP1102 = 5117,
+        RP1103 = 5118,
+        RP1104 = 5119,
+        RP1105 = 5120,
+        RP1106 = 5121,
+        RP1107 = 5122,
+        RP1108 = 5123,
+        RP1109 = 5124,
+        RP111 = 5125,
+        RP1110 = 5126,
+        RP1111 = 5127,
+        RP1112 = 5128,
+        RP1113 = 5129,
+        RP1114 = 5130,
+        RP1115 = 5131,
+        RP1116 = 5132,
+        RP1117 = 5133,
+        RP1118 = 5134,
+        RP1119 = 5135,
+        RP112 = 5136,
+        RP1120 = 5137,
+        RP1121 = 5138,
+        RP1122 = 5139,
+        RP1123 = 5140,
+        RP1124 = 5141,
+        RP1125 = 5142,
+        RP1126 = 5143,
+        RP1127 = 5144,
+        RP1128 = 5145,
+        RP1129 = 5146,
+        RP113 = 5147,
+        RP1130 = 5148,
+        RP1131 = 5149,
+        RP1132 = 5150,
+        RP1133 = 5151,
+        RP1134 = 5152,
+        RP1135 = 5153,
+        RP1136 = 5154,
+        RP1137 = 5155,
+        RP1138 = 5156,
+        RP1139 = 5157,
+        RP114 = 5158,
+        RP1140 = 5159,
+        RP1141 = 5160,
+        RP1142 = 5161,
+        RP1143 = 5162,
+        RP1144 = 5163,
+        RP1145 = 5164,
+        RP1146 = 5165,
+        RP1147 = 5166,
+        RP1148 = 5167,
+        RP1149 = 5168,
+        RP115 = 5169,
+        RP1150 = 5170,
+        RP1151 = 5171,
+        RP1152 = 5172,
+        RP1153 = 5173,
+        RP1154 = 5174,
+        RP1155 = 5175,
+        RP1156 = 5176,
+        RP1157 = 5177,
+        RP1158 = 5178,
+        RP1159 = 5179,
+        RP116 = 5180,
+        RP1160 = 5181,
+        RP1161 = 5182,
+        RP1162 = 5183,
+        RP1163 = 5184,
+        RP1164 = 5185,
+        RP1165 = 5186,
+        RP1166 = 5187,
+        RP1167 = 5188,
+        RP1168 = 5189,
+        RP1169 = 5190,
+        RP117 = 5191,
+        RP1170 = 5192,
+        RP1171 = 5193,
+        RP1172 = 5194,
+        RP1173 = 5195,
+        RP1174 = 5196,
+        RP1175 = 5197,
+        RP1176 = 5198,
+        RP1177 = 5199,
+        RP1178 = 5200,
+        RP1179 = 5201,
+        RP118 = 5202,
+        RP1180 = 5203,
+        RP1181 = 5204,
+        RP1182 = 5205,
+        RP1183 = 5206,
+        RP1184 = 5207,
+        RP1185 = 5208,
+        RP1186 = 5209,
+        RP1187 = 5210,
+        RP1188 = 5211,
+        RP1189 = 5212,
+        RP119 = 5213,
+        RP1190 = 5214,
+        RP1191 = 5215,
+        RP1192 = 5216,
+        RP1193 = 5217,
+        RP1194 = 5218,
+        RP1195 = 5219,
+        RP1196 = 5220,
+        RP1197 = 5221,
+        RP1198 = 5222,
+        RP1199 = 5223,
+        RP12 = 5224,
+        RP120 = 5225,
+        RP1200 = 5226,
+        RP1201 = 5227,
+        RP1202 = 5228,
+        RP1203 = 5229,
+        RP1204 = 5230,
+        RP1205 = 5231,
+        RP1206 = 5232,
+        RP1207 = 5233,
+        RP1208 = 5234,
+        RP1209 = 5235,
+        RP121 = 5236,
+        RP1210 = 5237,
+        RP1211 = 5238,
+        RP1212 = 5239,
+        RP1213 = 5240,
+        RP1214 = 5241,
+        RP1215 = 5242,
+        RP1216 = 5243,
+        RP1217 = 5244,
+        RP1218 = 5245,
+        RP1219 = 5246,
+        RP122 = 5247,
+        RP1220 = 5248,
+        RP1221 = 5249,
+        RP1222 = 5250,
+        RP1223 = 5251,
+        RP1224 = 5252,
+        RP1225 = 5253,
+        RP1226 = 5254,
+        RP1227 = 5255,
+        RP1228 = 5256,
+        RP1229 = 5257,
+        RP123 = 5258,
+        RP1230 = 5259,
+        RP1231 = 5260,
+        RP1232 = 5261,
+        RP1233 = 5262,
+        RP1234 = 5263,
+        RP1235 = 5264,
+        RP1236 = 5265,
+        RP1237 = 5266,
+        RP1238 = 5267,
+        RP1239 = 5268,
+        RP124 = 5269,
+        RP1240 = 5270,
+        RP1241 = 5271,
+        RP1242 = 5272,
+        RP1243 = 5273,
+        RP1244 = 5274,
+        RP1245 = 5275,
+        RP1246 = 5276,
+        RP1247 = 5277,
+        RP1248 = 5278,
+        RP1249 = 5279,
+        RP125 = 5280,
+        RP1250 = 5281,
+        RP1251 = 5282,
+        RP1252 = 5283,
+        RP1253 = 5284,
+        RP1254 = 5285,
+        RP1255 = 5286,
+        RP1256 = 5287,
+        RP1257 = 5288,
+        RP1258 = 5289,
+        RP1259 = 5290,
+        RP126 = 5291,
+        RP1260 = 5292,
+        RP1261 = 5293,
+        RP1262 = 5294,
+        RP1263 = 5295,
+        RP1264 = 5296,
+        RP1265 = 5297,
+        RP1266 = 5298,
+        RP1267 = 5299,
+        RP1268 = 5300,
+        RP1269 = 5301,
+        RP127 = 5302,
+        RP1270 = 5303,
+        RP1271 = 5304,
+        RP1272 = 5305,
+        RP1273 = 5306,
+        RP1274 = 5307,
+        RP1275 = 5308,
+        RP1276 = 5309,
+        RP1277 = 5310,
+        RP1278 = 5311,
+        RP1279 = 5312,
+        RP128 = 5313,
+        RP1280 = 5314,
+        RP1281 = 5315,
+        RP1282 = 5316,
+        RP1283 = 5317,
+        RP1284 = 5318,
+        RP1285 = 5319,
+        RP1286 = 5320,
+        RP1287 = 5321,
+        RP1288 = 5322,
+        RP1289 = 5323,
+        RP129 = 5324,
+        RP1290 = 5325,
+        RP1291 = 5326,
+        RP1292 = 5327,
+        RP1293 = 5328,
+        RP1294 = 5329,
+        RP1295 = 5330,
+        RP1296 = 5331,
+        RP1297 = 5332,
+        RP1298 = 5333,
+        RP1299 = 5334,
+        RP13 = 5335,
+        RP130 = 5336,
+        RP1300 = 5337,
+        RP1301 = 5338,
+        RP1302 = 5339,
+        RP1303 = 5340,
+        RP1304 = 5341,
+        RP1305 = 5342,
+        RP1306 = 5343,
+        RP1307 = 5344,
+        RP1308 = 5345,
+        RP1309 = 5346,
+        RP131 = 5347,
+        RP1310 = 5348,
+        RP1311 = 5349,
+        RP1312 = 5350,
+        RP1313 = 5351,
+        RP1314 = 5352,
+        RP1315 = 5353,
+        RP1316 = 5354,
+        RP1317 = 5355,
+        RP1318 = 5356,
+        RP1319 = 5357,
+        RP132 = 5358,
+        RP1320 = 5359,
+        RP1321 = 5360,
+        RP1322 = 5361,
+        RP1323 = 5362,
+        RP1324 = 5363,
+        RP1325 = 5364,
+        RP1326 = 5365,
+        RP1327 = 5366,
+        RP1328 = 5367,
+        RP1329 = 5368,
+        RP133 = 5369,
+        RP1330 = 5370,
+        RP1331 = 5371,
+        RP1332 = 5372,
+        RP1333 = 5373,
+        RP1334 = 5374,
+        RP1335 = 5375,
+        RP1336 = 5376,
+        RP1337 = 5377,
+        RP1338 = 5378,
+        RP1339 = 5379,
+        RP134 = 5380,
+        RP1340 = 5381,
+        RP1341 = 5382,
+        RP1342 = 5383,
+        RP1343 = 5384,
+        RP1344 = 5385,
+        RP1345 = 5386,
+        RP1346 = 5387,
+        RP1347 = 5388,
+        RP1348 = 5389,
+        RP1349 = 5390,
+        RP135 = 5391,
+        RP1350 = 5392,
+        RP1351 = 5393,
+        RP1352 = 5394,
+        RP1353 = 5395,
+        RP1354 = 5396,
+        RP1355 = 5397,
+        RP1356 = 5398,
+        RP1357 = 5399,
+        RP1358 = 5400,
+        RP1359 = 5401,
+        RP136 = 5402,
+        RP1360 = 5403,
+        RP1361 = 5404,
+        RP1362 = 5405,
+        RP1363 = 5406,
+        RP1364 = 5407,
+        RP1365 = 5408,
+        RP1366 = 5409,
+        RP1367 = 5410,
+        RP1368 = 5411,
+        RP1369 = 5412,
+        RP137 = 5413,
+        RP1370 = 5414,
+        RP1371 = 5415,
+        RP1372 = 5416,
+        RP1373 = 5417,
+        RP1374 = 5418,
+        RP1375 = 5419,
+        RP1376 = 5420,
+        RP1377 = 5421,
+        RP1378 = 5422,
+        RP1379 = 5423,
+        RP138 = 5424,
+        RP1380 = 5425,
+        RP1381 = 5426,
+        RP1382 = 5427,
+        RP1383 = 5428,
+        RP1384 = 5429,
+        RP1385 = 5430,
+        RP1386 = 5431,
+        RP1387 = 5432,
+        RP1388 = 5433,
+        RP1389 = 5434,
+        RP139 = 5435,
+        RP1390 = 5436,
+        RP1391 = 5437,
+        RP1392 = 5438,
+        RP1393 = 5439,
+        RP1394 = 5440,
+        RP1395 = 5441,
+        RP1396 = 5442,
+        RP1397 = 5443,
+        RP1398 = 5444,
+        RP1399 = 5445,
+        RP14 = 5446,
+        RP140 = 5447,
+        RP1400 = 5448,
+        RP1401 = 5449,
+        RP1402 = 5450,
+        RP1403 = 5451,
+        RP1404 = 5452,
+        RP1405 = 5453,
+        RP1406 = 5454,
+        RP1407 = 5455,
+        RP1408 = 5456,
+        RP1409 = 5457,
+        RP141 = 5458,
+        RP1410 = 5459,
+        RP1411 = 5460,
+        RP1412 = 5461,
+        RP1413 = 5462,
+        RP1414 = 5463,
+        RP1415 = 5464,
+        RP1416 = 5465,
+        RP1417 = 5466,
+        RP1418 = 5467,
+        RP1419 = 5468,
+        RP142 = 5469,
+        RP1420 = 5470,
+        RP1421 = 5471,
+        RP1422 = 5472,
+        RP1423 = 5473,
+        RP1424 = 5474,
+        RP1425 = 5475,
+        RP1426 = 5476,
+        RP1427 = 5477,
+        RP1428 = 5478,
+        RP1429 = 5479,
+        RP143 = 5480,
+        RP1430 = 5481,
+        RP1431 = 5482,
+        RP1432 = 5483,
+        RP1433 = 5484,
+        RP1434 = 5485,
+        RP1435 = 5486,
+        RP1436 = 5487,
+        RP1437 = 5488,
+        RP1438 = 5489,
+        RP1439 = 5490,
+        RP144 = 5491,
+        RP1440 = 5492,
+        RP1441 = 5493,
+        RP1442 = 5494,
+        RP1443 = 5495,
+        RP1444 = 5496,
+        RP1445 = 5497,
+        RP1446 = 5498,
+        RP1447 = 5499,
+        RP1448 = 5500,
+        RP1449 = 5501,
+        RP145 = 5502,
+        RP1450 = 5503,
+        RP1451 = 5504,
+        RP1452 = 5505,
+        RP1453 = 5506,
+        RP1454 = 5507,
+        RP1455 = 5508,
+        RP1456 = 5509,
+        RP1457 = 5510,
+        RP1458 = 5511,
+        RP1459 = 5512,
+        RP146 = 5513,
+        RP1460 = 5514,
+        RP1461 = 5515,
+        RP1462 = 5516,
+        RP1463 = 5517,
+        RP1464 = 5518,
+        RP1465 = 5519,
+        RP1466 = 5520,
+        RP1467 = 5521,
+        RP1468 = 5522,
+        RP1469 = 5523,
+        RP147 = 5524,
+        RP1470 = 5525,
+        RP1471 = 5526,
+        RP1472 = 5527,
+        RP1473 = 5528,
+        RP1474 = 5529,
+        RP1475 = 5530,
+        RP1476 = 5531,
+        RP1477 = 5532,
+        RP1478 = 5533,
+        RP1479 = 5534,
+        RP148 = 5535,
+        RP1480 = 5536,
+        RP1481 = 5537,
+        RP1482 = 5538,
+        RP1483 = 5539,
+        RP1484 = 5540,
+        RP1485 = 5541,
+        RP1486 = 5542,
+        RP1487 = 5543,
+        RP1488 = 5544,
+        RP1489 = 5545,
+        RP149 = 5546,
+        RP1490 = 5547,
+        RP1491 = 5548,
+        RP1492 = 5549,
+        RP1493 = 5550,
+        RP1494 = 5551,
+        RP1495 = 5552,
+        RP1496 = 5553,
+        RP1497 = 5554,
+        RP1498 = 5555,
+        RP1499 = 5556,
+        RP15 = 5557,
+        RP150 = 5558,
+        RP1500 = 5559,
+        RP1501 = 5560,
+        RP1502 = 5561,
+        RP1503 = 5562,
+        RP1504 = 5563,
+        RP1505 = 5564,
+        RP1506 = 5565,
+        RP1507 = 5566,
+        RP1508 = 5567,
+        RP1509 = 5568,
+        RP151 = 5569,
+        RP1510 = 5570,
+        RP1511 = 5571,
+        RP1512 = 5572,
+        RP1513 = 5573,
+        RP1514 = 5574,
+        RP1515 = 5575,
+        RP1516 = 5576,
+        RP1517 = 5577,
+        RP1518 = 5578,
+        RP1519 = 5579,
+        RP152 = 5580,
+        RP1520 = 5581,
+        RP1521 = 5582,
+        RP1522 = 5583,
+        RP1523 = 5584,
+        RP1524 = 5585,
+        RP1525 = 5586,
+        RP1526 = 5587,
+        RP1527 = 5588,
+        RP1528 = 5589,
+        RP1529 = 5590,
+        RP153 = 5591,
+        RP1530 = 5592,
+        RP1531 = 5593,
+        RP1532 = 5594,
+        RP1533 = 5595,
+        RP1534 = 5596,
+        RP1535 = 5597,
+        RP1536 = 5598,
+        RP1537 = 5599,
+        RP1538 = 5600,
+        RP1539 = 5601,
+        RP154 = 5602,
+        RP1540 = 5603,
+        RP1541 = 5604,
+        RP1542 = 5605,
+        RP1543 = 5606,
+        RP1544 = 5607,
+        RP1545 = 5608,
+        RP1546 = 5609,
+        RP1547 = 5610,
+        RP1548 = 5611,
+        RP1549 = 5612,
+        RP155 = 5613,
+        RP1550 = 5614,
+        RP1551 = 5615,
+        RP1552 = 5616,
+        RP1553 = 5617,
+        RP1554 = 5618,
+        RP1555 = 5619,
+        RP1556 = 5620,
+        RP1557 = 5621,
+        RP1558 = 5622,
+        RP1559 = 5623,
+        RP156 = 5624,
+        RP1560 = 5625,
+        RP1561 = 5626,
+        RP1562 = 5627,
+        RP1563 = 5628,
+        RP1564 = 5629,
+        RP1565 = 5630,
+        RP1566 = 5631,
+        RP1567 = 5632,
+        RP1568 = 5633,
+        RP1569 = 5634,
+        RP157 = 5635,
+        RP1570 = 5636,
+        RP1571 = 5637,
+        RP1572 = 5638,
+        RP1573 = 5639,
+        RP1574 = 5640,
+        RP1575 = 5641,
+        RP1576 = 5642,
+        RP1577 = 5643,
+        RP1578 = 5644,
+        RP1579 = 5645,
+        RP158 = 5646,
+        RP1580 = 5647,
+        RP1581 = 5648,
+        RP1582 = 5649,
+        RP1583 = 5650,
+        RP1584 = 5651,
+        RP1585 = 5652,
+        RP1586 = 5653,
+        RP1587 = 5654,
+        RP1588 = 5655,
+        RP1589 = 5656,
+        RP159 = 5657,
+        RP1590 = 5658,
+        RP1591 = 5659,
+        RP1592 = 5660,
+        RP1593 = 5661,
+        RP1594 = 5662,
+        RP1595 = 5663,
+        RP1596 = 5664,
+        RP1597 = 5665,
+        RP1598 = 5666,
+        RP1599 = 5667,
+        RP16 = 5668,
+        RP160 = 5669,
+        RP1600 = 5670,
+        RP1601 = 5671,
+        RP1602 = 5672,
+        RP1603 = 5673,
+        RP1604 = 5674,
+        RP1605 = 5675,
+        RP1606 = 5676,
+        RP1607 = 5677,
+        RP1608 = 5678,
+        RP1609 = 5679,
+        RP161 = 5680,
+        RP1610 = 5681,
+        RP1611 = 5682,
+        RP1612 = 5683,
+        RP1613 = 5684,
+        RP1614 = 5685,
+        RP1615 = 5686,
+        RP1616 = 5687,
+        RP1617 = 5688,
+        RP1618 = 5689,
+        RP1619 = 5690,
+        RP162 = 5691,
+        RP1620 = 5692,
+        RP1621 = 5693,
+        RP1622 = 5694,
+        RP1623 = 5695,
+        RP1624 = 5696,
+        RP1625 = 5697,
+        RP1626 = 5698,
+        RP1627 = 5699,
+        RP1628 = 5700,
+        RP1629 = 5701,
+        RP163 = 5702,
+        RP1630 = 5703,
+        RP1631 = 5704,
+        RP1632 = 5705,
+        RP1633 = 5706,
+        RP1634 = 5707,
+        RP1635 = 5708,
+        RP1636 = 5709,
+        RP1637 = 5710,
+        RP1638 = 5711,
+        RP1639 = 5712,
+        RP164 = 5713,
+        RP1640 = 5714,
+        RP1641 = 5715,
+        RP1642 = 5716,
+        RP1643 = 5717,
+        RP1644 = 5718,
+        RP1645 = 5719,
+        RP1646 = 5720,
+        RP1647 = 5721,
+        RP1648 = 5722,
+        RP1649 = 5723,
+        RP165 = 5724,
+        RP1650 = 5725,
+        RP1651 = 5726,
+        RP1652 = 5727,
+        RP1653 = 5728,
+        RP1654 = 5729,
+        RP1655 = 5730,
+        RP1656 = 5731,
+        RP1657 = 5732,
+        RP1658 = 5733,
+        RP1659 = 5734,
+        RP166 = 5735,
+        RP1660 = 5736,
+        RP1661 = 5737,
+        RP1662 = 5738,
+        RP1663 = 5739,
+        RP1664 = 5740,
+        RP1665 = 5741,
+        RP1666 = 5742,
+        RP1667 = 5743,
+        RP1668 = 5744,
+        RP1669 = 5745,
+        RP167 = 5746,
+        RP1670 = 5747,
+        RP1671 = 5748,
+        RP1672 = 5749,
+        RP1673 = 5750,
+        RP1674 = 5751,
+        RP1675 = 5752,
+        RP1676 = 5753,
+        RP1677 = 5754,
+        RP1678 = 5755,
+        RP1679 = 5756,
+        RP168 = 5757,
+        RP1680 = 5758,
+        RP1681 = 5759,
+        RP1682 = 5760,
+        RP1683 = 5761,
+        RP1684 = 5762,
+        RP1685 = 5763,
+        RP1686 = 5764,
+        RP1687 = 5765,
+        RP1688 = 5766,
+        RP1689 = 5767,
+        RP169 = 5768,
+        RP1690 = 5769,
+        RP1691 = 5770,
+        RP1692 = 5771,
+        RP1693 = 5772,
+        RP1694 = 5773,
+        RP1695 = 5774,
+        RP1696 = 5775,
+        RP1697 = 5776,
+        RP1698 = 5777,
+        RP1699 = 5778,
+        RP17 = 5779,
+        RP170 = 5780,
+        RP1700 = 5781,
+        RP1701 = 5782,
+        RP1702 = 5783,
+        RP1703 = 5784,
+        RP1704 = 5785,
+        RP1705 = 5786,
+        RP1706 = 5787,
+        RP1707 = 5788,
+        RP1708 = 5789,
+        RP1709 = 5790,
+        RP171 = 5791,
+        RP1710 = 5792,
+        RP1711 = 5793,
+        RP1712 = 5794,
+        RP1713 = 5795,
+        RP1714 = 5796,
+        RP1715 = 5797,
+        RP1716 = 5798,
+        RP1717 = 5799,
+        RP1718 = 5800,
+        RP1719 = 5801,
+        RP172 = 5802,
+        RP1720 = 5803,
+        RP1721 = 5804,
+        RP1722 = 5805,
+        RP1723 = 5806,
+        RP1724 = 5807,
+        RP1725 = 5808,
+        RP1726 = 5809,
+        RP1727 = 5810,
+        RP1728 = 5811,
+        RP1729 = 5812,
+        RP173 = 5813,
+        RP1730 = 5814,
+        RP1731 = 5815,
+        RP1732 = 5816,
+        RP1733 = 5817,
+        RP1734 = 5818,
+        RP1735 = 5819,
+        RP1736 = 5820,
+        RP1737 = 5821,
+        RP1738 = 5822,
+        RP1739 = 5823,
+        RP174 = 5824,
+        RP1740 = 5825,
+        RP1741 = 5826,
+        RP1742 = 5827,
+        RP1743 = 5828,
+        RP1744 = 5829,
+        RP1745 = 5830,
+        RP1746 = 5831,
+        RP1747 = 5832,
+        RP1748 = 5833,
+        RP1749 = 5834,
+        RP175 = 5835,
+        RP1750 = 5836,
+        RP1751 = 5837,
+        RP1752 = 5838,
+        RP1753 = 5839,
+        RP1754 = 5840,
+        RP1755 = 5841,
+        RP1756 = 5842,
+        RP1757 = 5843,
+        RP1758 = 5844,
+        RP1759 = 5845,
+        RP176 = 5846,
+        RP1760 = 5847,
+        RP1761 = 5848,
+        RP1762 = 5849,
+        RP1763 = 5850,
+        RP1764 = 5851,
+        RP1765 = 5852,
+        RP1766 = 5853,
+        RP1767 = 5854,
+        RP1768 = 5855,
+        RP1769 = 5856,
+        RP177 = 5857,
+        RP1770 = 5858,
+        RP1771 = 5859,
+        RP1772 = 5860,
+        RP1773 = 5861,
+        RP1774 = 5862,
+        RP1775 = 5863,
+        RP1776 = 5864,
+        RP1777 = 5865,
+        RP1778 = 5866,
+        RP1779 = 5867,
+        RP178 = 5868,
+        RP1780 = 5869,
+        RP1781 = 5870,
+        RP1782 = 5871,
+        RP1783 = 5872,
+        RP1784 = 5873,
+        RP1785 = 5874,
+        RP1786 = 5875,
+        RP1787 = 5876,
+        RP1788 = 5877,
+        RP1789 = 5878,
+        RP179 = 5879,
+        RP1790 = 5880,
+        RP1791 = 5881,
+        RP1792 = 5882,
+        RP1793 = 5883,
+        RP1794 = 5884,
+        RP1795 = 5885,
+        RP1796 = 5886,
+        RP1797 = 5887,
+        RP1798 = 5888,
+        RP1799 = 5889,
+        RP18 = 5890,
+        RP180 = 5891,
+        RP1800 = 5892,
+        RP1801 = 5893,
+        RP1802 = 5894,
+        RP1803 = 5895,
+        RP1804 = 5896,
+        RP1805 = 5897,
+        RP1806 = 5898,
+        RP1807 = 5899,
+        RP1808 = 5900,
+        RP1809 = 5901,
+        RP181 = 5902,
+        RP1810 = 5903,
+        RP1811 = 5904,
+        RP1812 = 5905,
+        RP1813 = 5906,
+        RP1814 = 5907,
+        RP1815 = 5908,
+        RP1816 = 5909,
+        RP1817 = 5910,
+        RP1818 = 5911,
+        RP1819 = 5912,
+        RP182 = 5913,
+        RP1820 = 5914,
+        RP1821 = 5915,
+        RP1822 = 5916,
+        RP1823 = 5917,
+        RP1824 = 5918,
+        RP1825 = 5919,
+        RP1826 = 5920,
+        RP1827 = 5921,
+        RP1828 = 5922,
+        RP1829 = 5923,
+        RP183 = 5924,
+        RP1830 = 5925,
+        RP1831 = 5926,
+        RP1832 = 5927,
+        RP1833 = 5928,
+        RP1834 = 5929,
+        RP1835 = 5930,
+        RP1836 = 5931,
+        RP1837 = 5932,
+        RP1838 = 5933,
+        RP1839 = 5934,
+        RP184 = 5935,
+        RP1840 = 5936,
+        RP1841 = 5937,
+        RP1842 = 5938,
+        RP1843 = 5939,
+        RP1844 = 5940,
+        RP1845 = 5941,
+        RP1846 = 5942,
+        RP1847 = 5943,
+        RP1848 = 5944,
+        RP1849 = 5945,
+        RP185 = 5946,
+        RP1850 = 5947,
+        RP1851 = 5948,
+        RP1852 = 5949,
+        RP1853 = 5950,
+        RP1854 = 5951,
+        RP1855 = 5952,
+        RP1856 = 5953,
+        RP1857 = 5954,
+        RP1858 = 5955,
+        RP1859 = 5956,
+        RP186 = 5957,
+        RP1860 = 5958,
+        RP1861 = 5959,
+        RP1862 = 5960,
+        RP1863 = 5961,
+        RP1864 = 5962,
+        RP1865 = 5963,
+        RP1866 = 5964,
+        RP1867 = 5965,
+        RP1868 = 5966,
+        RP1869 = 5967,
+        RP187 = 5968,
+        RP1870 = 5969,
+        RP1871 = 5970,
+        RP1872 = 5971,
+        RP1873 = 5972,
+        RP1874 = 5973,
+        RP1875 = 5974,
+        RP1876 = 5975,
+        RP1877 = 5976,
+        RP1878 = 5977,
+        RP1879 = 5978,
+        RP188 = 5979,
+        RP1880 = 5980,
+        RP1881 = 5981,
+        RP1882 = 5982,
+        RP1883 = 5983,
+        RP1884 = 5984,
+        RP1885 = 5985,
+        RP1886 = 5986,
+        RP1887 = 5987,
+        RP1888 = 5988,
+        RP1889 = 5989,
+        RP189 = 5990,
+        RP1890 = 5991,
+        RP1891 = 5992,
+        RP1892 = 5993,
+        RP1893 = 5994,
+        RP1894 = 5995,
+        RP1895 = 5996,
+        RP1896 = 5997,
+        RP1897 = 5998,
+        RP1898 = 5999,
+        RP1899 = 6000,
+        RP19 = 6001,
+        RP190 = 6002,
+        RP1900 = 6003,
+        RP1901 = 6004,
+        RP1902 = 6005,
+        RP1903 = 6006,
+        RP1904 = 6007,
+        RP1905 = 6008,
+        RP1906 = 6009,
+        RP1907 = 6010,
+        RP1908 = 6011,
+        RP1909 = 6012,
+        RP191 = 6013,
+        RP1910 = 6014,
+        RP1911 = 6015,
+        RP1912 = 6016,
+        RP1913 = 6017,
+        RP1914 = 6018,
+        RP1915 = 6019,
+        RP1916 = 6020,
+        RP1917 = 6021,
+        RP1918 = 6022,
+        RP1919 = 6023,
+        RP192 = 6024,
+        RP1920 = 6025,
+        RP1921 = 6026,
+        RP1922 = 6027,
+        RP1923 = 6028,
+        RP1924 = 6029,
+        RP1925 = 6030,
+        RP1926 = 6031,
+        RP1927 = 6032,
+        RP1928 = 6033,
+        RP1929 = 6034,
+        RP193 = 6035,
+        RP1930 = 6036,
+        RP1931 = 6037,
+        RP1932 = 6038,
+        RP1933 = 6039,
+        RP1934 = 6040,
+        RP1935 = 6041,
+        RP1936 = 6042,
+        RP1937 = 6043,
+        RP1938 = 6044,
+        RP1939 = 6045,
+        RP194 = 6046,
+        RP1940 = 6047,
+        RP1941 = 6048,
+        RP1942 = 6049,
+        RP1943 = 6050,
+        RP1944 = 6051,
+        RP1945 = 6052,
+        RP1946 = 6053,
+        RP1947 = 6054,
+        RP1948 = 6055,
+        RP1949 = 6056,
+        RP195 = 6057,
+        RP1950 = 6058,
+        RP1951 = 6059,
+        RP1952 = 6060,
+        RP1953 = 6061,
+        RP1954 = 6062,
+        RP1955 = 6063,
+        RP1956 = 6064,
+        RP1957 = 6065,
+        RP1958 = 6066,
+        RP1959 = 6067,
+        RP196 = 6068,
+        RP1960 = 6069,
+        RP1961 = 6070,
+        RP1962 = 6071,
+        RP1963 = 6072,
+        RP1964 = 6073,
+        RP1965 = 6074,
+        RP1966 = 6075,
+        RP1967 = 6076,
+        RP1968 = 6077,
+        RP1969 = 6078,
+        RP197 = 6079,
+        RP1970 = 6080,
+        RP1971 = 6081,
+        RP1972 = 6082,
+        RP1973 = 6083,
+        RP1974 = 6084,
+        RP1975 = 6085,
+        RP1976 = 6086,
+        RP1977 = 6087,
+        RP1978 = 6088,
+        RP1979 = 6089,
+        RP198 = 6090,
+        RP1980 = 6091,
+        RP1981 = 6092,
+        RP1982 = 6093,
+        RP1983 = 6094,
+        RP1984 = 6095,
+        RP1985 = 6096,
+        RP1986 = 6097,
+        RP1987 = 6098,
+        RP1988 = 6099,
+        RP1989 = 6100,
+        RP199 = 6101,
+        RP1990 = 6102,
+        RP1991 = 6103,
+        RP1992 = 6104,
+        RP1993 = 6105,
+        RP1994 = 6106,
+        RP1995 = 6107,
+        RP1996 = 6108,
+        RP1997 = 6109,
+        RP1998 = 6110,
+        RP1999 = 6111,
+        RP2 = 6112,
+        RP20 = 6113,
+        RP200 = 6114,
+        RP2000 = 6115,
+        RP2001 = 6116,
+        RP2002 = 6117,
+        RP2003 = 6118,
+        RP2004 = 6119,
+        RP2005 = 6120,
+        RP2006 = 6121,
+        RP2007 = 6122,
+        RP2008 = 6123,
+        RP2009 = 6124,
+        RP201 = 6125,
+        RP2010 = 6126,
+        RP2011 = 6127,
+        RP2012 = 6128,
+        RP2013 = 6129,
+        RP2014 = 6130,
+        RP2015 = 6131,
+        RP2016 = 6132,
+        RP2017 = 6133,
+        RP2018 = 6134,
+        RP2019 = 6135,
+        RP202 = 6136,
+        RP2020 = 6137,
+        RP2021 = 6138,
+        RP2022 = 6139,
+        RP2023 = 6140,
+        RP2024 = 6141,
+        RP2025 = 6142,
+        RP2026 = 6143,
+        RP2027 = 6144,
+        RP2028 = 6145,
+        RP2029 = 6146,
+        RP203 = 6147,
+        RP2030 = 6148,
+        RP2031 = 6149,
+        RP2032 = 6150,
+        RP2033 = 6151,
+        RP2034 = 6152,
+        RP2035 = 6153,
+        RP2036 = 6154,
+        RP2037 = 6155,
+        RP2038 = 6156,
+        RP2039 = 6157,
+        RP204 = 6158,
+        RP2040 = 6159,
+        RP2041 = 6160,
+        RP2042 = 6161,
+        RP2043 = 6162,
+        RP2044 = 6163,
+        RP2045 = 6164,
+        RP2046 = 6165,
+        RP2047 = 6166,
+        RP2048 = 6167,
+        RP2049 = 6168,
+        RP205 = 6169,
+        RP2050 = 6170,
+        RP2051 = 6171,
+        RP2052 = 6172,
+        RP2053 = 6173,
+        RP2054 = 6174,
+        RP2055 = 6175,
+        RP2056 = 6176,
+        RP2057 = 6177,
+        RP2058 = 6178,
+        RP2059 = 6179,
+        RP206 = 6180,
+        RP2060 = 6181,
+        RP2061 = 6182,
+        RP2062 = 6183,
+        RP2063 = 6184,
+        RP2064 = 6185,
+        RP2065 = 6186,
+        RP2066 = 6187,
+        RP2067 = 6188,
+        RP2068 = 6189,
+        RP2069 = 6190,
+        RP207 = 6191,
+        RP2070 = 6192,
+        RP2071 = 6193,
+        RP2072 = 6194,
+        RP2073 = 6195,
+        RP2074 = 6196,
+        RP2075 = 6197,
+        RP2076 = 6198,
+        RP2077 = 6199,
+        RP2078 = 6200,
+        RP2079 = 6201,
+        RP208 = 6202,
+        RP2080 = 6203,
+        RP2081 = 6204,
+        RP2082 = 6205,
+        RP2083 = 6206,
+        RP2084 = 6207,
+        RP2085 = 6208,
+        RP2086 = 6209,
+        RP2087 = 6210,
+        RP2088 = 6211,
+        RP2089 = 6212,
+        RP209 = 6213,
+        RP2090 = 6214,
+        RP2091 = 6215,
+        RP2092 = 6216,
+        RP2093 = 6217,
+        RP2094 = 6218,
+        RP2095 = 6219,
+        RP2096 = 6220,
+        RP2097 = 6221,
+        RP2098 = 6222,
+        RP2099 = 6223,
+        RP21 = 6224,
+        RP210 = 6225,
+        RP2100 = 6226,
+        RP2101 = 6227,
+        RP2102 = 6228,
+        RP2103 = 6229,
+        RP2104 = 6230,
+        RP2105 = 6231,
+        RP2106 = 6232,
+        RP2107 = 6233,
+        RP2108 = 6234,
+        RP2109 = 6235,
+        RP211 = 6236,
+        RP2110 = 6237,
+        RP2111 = 6238,
+        RP2112 = 6239,
+        RP2113 = 6240,
+        RP2114 = 6241,
+        RP2115 = 6242,
+        RP2116 = 6243,
+        RP2117 = 6244,
+        RP2118 = 6245,
+        RP2119 = 6246,
+        RP212 = 6247,
+        RP2120 = 6248,
+        RP2121 = 6249,
+        RP2122 = 6250,
+        RP2123 = 6251,
+        RP2124 = 6252,
+        RP2125 = 6253,
+        RP2126 = 6254,
+        RP2127 = 6255,
+        RP2128 = 6256,
+        RP2129 = 6257,
+        RP213 = 6258,
+        RP2130 = 6259,
+        RP2131 = 6260,
+        RP2132 = 6261,
+        RP2133 = 6262,
+        RP2134 = 6263,
+        RP2135 = 6264,
+        RP2136 = 6265,
+        RP2137 = 6266,
+        RP2138 = 6267,
+        RP2139 = 6268,
+        RP214 = 6269,
+        RP2140 = 6270,
+        RP2141 = 6271,
+        RP2142 = 6272,
+        RP2143 = 6273,
+        RP2144 = 6274,
+        RP2145 = 6275,
+        RP2146 = 6276,
+        RP2147 = 6277,
+        RP2148 = 6278,
+        RP2149 = 6279,
+        RP215 = 6280,
+        RP2150 = 6281,
+        RP2151 = 6282,
+        RP2152 = 6283,
+        RP2153 = 6284,
+        RP2154 = 6285,
+        RP2155 = 6286,
+        RP2156 = 6287,
+        RP2157 = 6288,
+        RP2158 = 6289,
+        RP2159 = 6290,
+        RP216 = 6291,
+        RP2160 = 6292,
+        RP2161 = 6293,
+        RP2162 = 6294,
+        RP2163 = 6295,
+        RP2164 = 6296,
+        RP2165 = 6297,
+        RP2166 = 6298,
+        RP2167 = 6299,
+        RP2168 = 6300,
+        RP2169 = 6301,
+        RP217 = 6302,
+        RP2170 = 6303,
+        RP2171 = 6304,
+        RP2172 = 6305,
+        RP2173 = 6306,
+        RP2174 = 6307,
+        RP2175 = 6308,
+        RP2176 = 6309,
+        RP2177 = 6310,
+        RP2178 = 6311,
+        RP2179 = 6312,
+        RP218 = 6313,
+        RP2180 = 6314,
+        RP2181 = 6315,
+        RP2182 = 6316,
+        RP2183 = 6317,
+        RP2184 = 6318,
+        RP2185 = 6319,
+        RP2186 = 6320,
+        RP2187 = 6321,
+        RP2188 = 6322,
+        RP2189 = 6323,
+        RP219 = 6324,
+        RP2190 = 6325,
+        RP2191 = 6326,
+        RP2192 = 6327,
+        RP2193 = 6328,
+        RP2194 = 6329,
+        RP2195 = 6330,
+        RP2196 = 6331,
+        RP2197 = 6332,
+        RP2198 = 6333,
+        RP2199 = 6334,
+        RP22 = 6335,
+        RP220 = 6336,
+        RP2200 = 6337,
+        RP2201 = 6338,
+        RP2202 = 6339,
+        RP2203 = 6340,
+        RP2204 = 6341,
+        RP2205 = 6342,
+        RP2206 = 6343,
+        RP2207 = 6344,
+        RP2208 = 6345,
+        RP2209 = 6346,
+        RP221 = 6347,
+        RP2210 = 6348,
+        RP2211 = 6349,
+        RP2212 = 6350,
+        RP2213 = 6351,
+        RP2214 = 6352,
+        RP2215 = 6353,
+        RP2216 = 6354,
+        RP2217 = 6355,
+        RP2218 = 6356,
+        RP2219 = 6357,
+        RP222 = 6358,
+        RP2220 = 6359,
+        RP2221 = 6360,
+        RP2222 = 6361,
+        RP2223 = 6362,
+        RP2224 = 6363,
+        RP2225 = 6364,
+        RP2226 = 6365,
+        RP2227 = 6366,
+        RP2228 = 6367,
+        RP2229 = 6368,
+        RP223 = 6369,
+        RP2230 = 6370,
+        RP2231 = 6371,
+        RP2232 = 6372,
+        RP2233 = 6373,
+        RP2234 = 6374,
+        RP2235 = 6375,
+        RP2236 = 6376,
+        RP2237 = 6377,
+        RP2238 = 6378,
+        RP2239 = 6379,
+        RP224 = 6380,
+        RP2240 = 6381,
+        RP2241 = 6382,
+        RP2242 = 6383,
+        RP2243 = 6384,
+        RP2244 = 6385,
+        RP2245 = 6386,
+        RP2246 = 6387,
+        RP2247 = 6388,
+        RP2248 = 6389,
+        RP2249 = 6390,
+        RP225 = 6391,
+        RP2250 = 6392,
+        RP2251 = 6393,
+        RP2252 = 6394,
+        RP2253 = 6395,
+        RP2254 = 6396,
+        RP2255 = 6397,
+        RP2256 = 6398,
+        RP2257 = 6399,
+        RP2258 = 6400,
+        RP2259 = 6401,
+        RP226 = 6402,
+        RP2260 = 6403,
+        RP2261 = 6404,
+        RP2262 = 6405,
+        RP2263 = 6406,
+        RP2264 = 6407,
+        RP2265 = 6408,
+        RP2266 = 6409,
+        RP2267 = 6410,
+        RP2268 = 6411,
+        RP2269 = 6412,
+        RP227 = 6413,
+        RP2270 = 6414,
+        RP2271 = 6415,
+        RP2272 = 6416,
+        RP2273 = 6417,
+        RP2274 = 6418,
+        RP2275 = 6419,
+        RP2276 = 6420,
+        RP2277 = 6421,
+        RP2278 = 6422,
+        RP2279 = 6423,
+        RP228 = 6424,
+        RP2280 = 6425,
+        RP2281 = 6426,
+        RP2282 = 6427,
+        RP2283 = 6428,
+        RP2284 = 6429,
+        RP2285 = 6430,
+        RP2286 = 6431,
+        RP2287 = 6432,
+        RP2288 = 6433,
+        RP2289 = 6434,
+        RP229 = 6435,
+        RP2290 = 6436,
+        RP2291 = 6437,
+        RP2292 = 6438,
+        RP2293 = 6439,
+        RP2294 = 6440,
+        RP2295 = 6441,
+        RP2296 = 6442,
+        RP2297 = 6443,
+        RP2298 = 6444,
+        RP2299 = 6445,
+        RP23 = 6446,
+        RP230 = 6447,
+        RP2300 = 6448,
+        RP2301 = 6449,
+        RP2302 = 6450,
+        RP2303 = 6451,
+        RP2304 = 6452,
+        RP2305 = 6453,
+        RP2306 = 6454,
+        RP2307 = 6455,
+        RP2308 = 6456,
+        RP2309 = 6457,
+        RP231 = 6458,
+        RP2310 = 6459,
+        RP2311 = 6460,
+        RP2312 = 6461,
+        RP2313 = 6462,
+        RP2314 = 6463,
+        RP2315 = 6464,
+        RP2316 = 6465,
+        RP2317 = 6466,
+        RP2318 = 6467,
+        RP2319 = 6468,
+        RP232 = 6469,
+        RP2320 = 6470,
+        RP2321 = 6471,
+        RP2322 = 6472,
+        RP2323 = 6473,
+        RP2324 = 6474,
+        RP2325 = 6475,
+        RP2326 = 6476,
+        RP2327 = 6477,
+        RP2328 = 6478,
+        RP2329 = 6479,
+        RP233 = 6480,
+        RP2330 = 6481,
+        RP2331 = 6482,
+        RP2332 = 6483,
+        RP2333 = 6484,
+        RP2334 = 6485,
+        RP2335 = 6486,
+        RP2336 = 6487,
+        RP2337 = 6488,
+        RP2338 = 6489,
+        RP2339 = 6490,
+        RP234 = 6491,
+        RP2340 = 6492,
+        RP2341 = 6493,
+        RP2342 = 6494,
+        RP2343 = 6495,
+        RP2344 = 6496,
+        RP2345 = 6497,
+        RP2346 = 6498,
+        RP2347 = 6499,
+        RP2348 = 6500,
+        RP2349 = 6501,
+        RP235 = 6502,
+        RP2350 = 6503,
+        RP2351 = 6504,
+        RP2352 = 6505,
+        RP2353 = 6506,
+        RP2354 = 6507,
+        RP2355 = 6508,
+        RP2356 = 6509,
+        RP2357 = 6510,
+        RP2358 = 6511,
+        RP2359 = 6512,
+        RP236 = 6513,
+        RP2360 = 6514,
+        RP2361 = 6515,
+        RP2362 = 6516,
+        RP2363 = 6517,
+        RP2364 = 6518,
+        RP2365 = 6519,
+        RP2366 = 6520,
+        RP2367 = 6521,
+        RP2368 = 6522,
+        RP2369 = 6523,
+        RP237 = 6524,
+        RP2370 = 6525,
+        RP2371 = 6526,
+        RP2372 = 6527,
+        RP2373 = 6528,
+        RP2374 = 6529,
+        RP2375 = 6530,
+        RP2376 = 6531,
+        RP2377 = 6532,
+        RP2378 = 6533,
+        RP2379 = 6534,
+        RP238 = 6535,
+        RP2380 = 6536,
+        RP2381 = 6537,
+        RP2382 = 6538,
+        RP2383 = 6539,
+        RP2384 = 6540,
+        RP2385 = 6541,
+        RP2386 = 6542,
+        RP2387 = 6543,
+        RP2388 = 6544,
+        RP2389 = 6545,
+        RP239 = 6546,
+        RP2390 = 6547,
+        RP2391 = 6548,
+        RP2392 = 6549,
+        RP2393 = 6550,
+        RP2394 = 6551,
+        RP2395 = 6552,
+        RP2396 = 6553,
+        RP2397 = 6554,
+        RP2398 = 6555,
+        RP2399 = 6556,
+        RP24 = 6557,
+        RP240 = 6558,
+        RP2400 = 6559,
+        RP2401 = 6560,
+        RP2402 = 6561,
+        RP2403 = 6562,
+        RP2404 = 6563,
+        RP2405 = 6564,
+        RP2406 = 6565,
+        RP2407 = 6566,
+        RP2408 = 6567,
+        RP2409 = 6568,
+        RP241 = 6569,
+        RP2410 = 6570,
+        RP2411 = 6571,
+        RP2412 = 6572,
+        RP2413 = 6573,
+        RP2414 = 6574,
+        RP2415 = 6575,
+        RP2416 = 6576,
+        RP2417 = 6577,
+        RP2418 = 6578,
+        RP2419 = 6579,
+        RP242 = 6580,
+        RP2420 = 6581,
+        RP2421 = 6582,
+        RP2422 = 6583,
+        RP2423 = 6584,
+        RP2424 = 6585,
+        RP2425 = 6586,
+        RP2426 = 6587,
+        RP2427 = 6588,
+        RP2428 = 6589,
+        RP2429 = 6590,
+        RP243 = 6591,
+        RP2430 = 6592,
+        RP2431 = 6593,
+        RP2432 = 6594,
+        RP2433 = 6595,
+        RP2434 = 6596,
+        RP2435 = 6597,
+        RP2436 = 6598,
+        RP2437 = 6599,
+        RP2438 = 6600,
+        RP2439 = 6601,
+        RP244 = 6602,
+        RP2440 = 6603,
+        RP2441 = 6604,
+        RP2442 = 6605,
+        RP2443 = 6606,
+        RP2444 = 6607,
+        RP2445 = 6608,
+        RP2446 = 6609,
+        RP2447 = 6610,
+        RP2448 = 6611,
+        RP2449 = 6612,
+        RP245 = 6613,
+        RP2450 = 6614,
+        RP2451 = 6615,
+        RP2452 = 6616,
+        RP2453 = 6617,
+        RP2454 = 6618,
+        RP2455 = 6619,
+        RP2456 = 6620,
+        RP2457 = 6621,
+        RP2458 = 6622,
+        RP2459 = 6623,
+        RP246 = 6624,
+        RP2460 = 6625,
+        RP2461 = 6626,
+        RP2462 = 6627,
+        RP2463 = 6628,
+        RP2464 = 6629,
+        RP2465 = 6630,
+        RP2466 = 6631,
+        RP2467 = 6632,
+        RP2468 = 6633,
+        RP2469 = 6634,
+        RP247 = 6635,
+        RP2470 = 6636,
+        RP2471 = 6637,
+        RP2472 = 6638,
+        RP2473 = 6639,
+        RP2474 = 6640,
+        RP2475 = 6641,
+        RP2476 = 6642,
+        RP2477 = 6643,
+        RP2478 = 6644,
+        RP2479 = 6645,
+        RP248 = 6646,
+        RP2480 = 6647,
+        RP2481 = 6648,
+        RP2482 = 6649,
+        RP2483 = 6650,
+        RP2484 = 6651,
+        RP2485 = 6652,
+        RP2486 = 6653,
+        RP2487 = 6654,
+        RP2488 = 6655,
+        RP2489 = 6656,
+        RP249 = 6657,
+        RP2490 = 6658,
+        RP2491 = 6659,
+        RP2492 = 6660,
+        RP2493 = 6661,
+        RP2494 = 6662,
+        RP2495 = 6663,
+        RP2496 = 6664,
+        RP2497 = 6665,
+        RP2498 = 6666,
+        RP25 = 6667,
+        RP250 = 6668,
+        RP251 = 6669,
+        RP252 = 6670,
+        RP253 = 6671,
+        RP254 = 6672,
+        RP255 = 6673,
+        RP256 = 6674,
+        RP257 = 6675,
+        RP258 = 6676,
+        RP259 = 6677,
+        RP26 = 6678,
+        RP260 = 6679,
+        RP261 = 6680,
+        RP262 = 6681,
+        RP263 = 6682,
+        RP264 = 6683,
+        RP265 = 6684,
+        RP266 = 6685,
+        RP267 = 6686,
+        RP268 = 6687,
+        RP269 = 6688,
+        RP27 = 6689,
+        RP270 = 6690,
+        RP271 = 6691,
+        RP272 = 6692,
+        RP273 = 6693,
+        RP274 = 6694,
+        RP275 = 6695,
+        RP276 = 6696,
+        RP277 = 6697,
+        RP278 = 6698,
+        RP279 = 6699,
+        RP28 = 6700,
+        RP280 = 6701,
+        RP281 = 6702,
+        RP282 = 6703,
+        RP283 = 6704,
+        RP284 = 6705,
+        RP285 = 6706,
+        RP286 = 6707,
+        RP287 = 6708,
+        RP288 = 6709,
+        RP289 = 6710,
+        RP29 = 6711,
+        RP290 = 6712,
+        RP291 = 6713,
+        RP292 = 6714,
+        RP293 = 6715,
+        RP294 = 6716,
+        RP295 = 6717,
+        RP296 = 6718,
+        RP297 = 6719,
+        RP298 = 6720,
+        RP299 = 6721,
+        RP3 = 6722,
+        RP30 = 6723,
+        RP300 = 6724,
+        RP301 = 6725,
+        RP302 = 6726,
+        RP303 = 6727,
+        RP304 = 6728,
+        RP305 = 6729,
+        RP306 = 6730,
+        RP307 = 6731,
+        RP308 = 6732,
+        RP309 = 6733,
+        RP31 = 6734,
+        RP310 = 6735,
+        RP311 = 6736,
+        RP312 = 6737,
+        RP313 = 6738,
+        RP314 = 6739,
+        RP315 = 6740,
+        RP316 = 6741,
+        RP317 = 6742,
+        RP318 = 6743,
+        RP319 = 6744,
+        RP32 = 6745,
+        RP320 = 6746,
+        RP321 = 6747,
+        RP322 = 6748,
+        RP323 = 6749,
+        RP324 = 6750,
+        RP325 = 6751,
+        RP326 = 6752,
+        RP327 = 6753,
+        RP328 = 6754,
+        RP329 = 6755,
+        RP33 = 6756,
+        RP330 = 6757,
+        RP331 = 6758,
+        RP332 = 6759,
+        RP333 = 6760,
+        RP334 = 6761,
+        RP335 = 6762,
+        RP336 = 6763,
+        RP337 = 6764,
+        RP338 = 6765,
+        RP339 = 6766,
+        RP34 = 6767,
+        RP340 = 6768,
+        RP341 = 6769,
+        RP342 = 6770,
+        RP343 = 6771,
+        RP344 = 6772,
+        RP345 = 6773,
+        RP346 = 6774,
+        RP347 = 6775,
+        RP348 = 6776,
+        RP349 = 6777,
+        RP35 = 6778,
+        RP350 = 6779,
+        RP351 = 6780,
+        RP352 = 6781,
+        RP353 = 6782,
+        RP354 = 6783,
+        RP355 = 6784,
+        RP356 = 6785,
+        RP357 = 6786,
+        RP358 = 6787,
+        RP359 = 6788,
+        RP36 = 6789,
+        RP360 = 6790,
+        RP361 = 6791,
+        RP362 = 6792,
+        RP363 = 6793,
+        RP364 = 6794,
+        RP365 = 6795,
+        RP366 = 6796,
+        RP367 = 6797,
+        RP368 = 6798,
+        RP369 = 6799,
+        RP37 = 6800,
+        RP370 = 6801,
+        RP371 = 6802,
+        RP372 = 6803,
+        RP373 = 6804,
+        RP374 = 6805,
+        RP375 = 6806,
+        RP376 = 6807,
+        RP377 = 6808,
+        RP378 = 6809,
+        RP379 = 6810,
+        RP38 = 6811,
+        RP380 = 6812,
+        RP381 = 6813,
+        RP382 = 6814,
+        RP383 = 6815,
+        RP384 = 6816,
+        RP385 = 6817,
+        RP386 = 6818,
+        RP387 = 6819,
+        RP388 = 6820,
+        RP389 = 6821,
+        RP39 = 6822,
+        RP390 = 6823,
+        RP391 = 6824,
+        RP392 = 6825,
+        RP393 = 6826,
+        RP394 = 6827,
+        RP395 = 6828,
+        RP396 = 6829,
+        RP397 = 6830,
+        RP398 = 6831,
+        RP399 = 6832,
+        RP4 = 6833,
+        RP40 = 6834,
+        RP400 = 6835,
+        RP401 = 6836,
+        RP402 = 6837,
+        RP403 = 6838,
+        RP404 = 6839,
+        RP405 = 6840,
+        RP406 = 6841,
+        RP407 = 6842,
+        RP408 = 6843,
+        RP409 = 6844,
+        RP41 = 6845,
+        RP410 = 6846,
+        RP411 = 6847,
+        RP412 = 6848,
+        RP413 = 6849,
+        RP414 = 6850,
+        RP415 = 6851,
+        RP416 = 6852,
+        RP417 = 6853,
+        RP418 = 6854,
+        RP419 = 6855,
+        RP42 = 6856,
+        RP420 = 6857,
+        RP421 = 6858,
+        RP422 = 6859,
+        RP423 = 6860,
+        RP424 = 6861,
+        RP425 = 6862,
+        RP426 = 6863,
+        RP427 = 6864,
+        RP428 = 6865,
+        RP429 = 6866,
+        RP43 = 6867,
+        RP430 = 6868,
+        RP431 = 6869,
+        RP432 = 6870,
+        RP433 = 6871,
+        RP434 = 6872,
+        RP435 = 6873,
+        RP436 = 6874,
+        RP437 = 6875,
+        RP438 = 6876,
+        RP439 = 6877,
+        RP44 = 6878,
+        RP440 = 6879,
+        RP441 = 6880,
+        RP442 = 6881,
+        RP443 = 6882,
+        RP444 = 6883,
+        RP445 = 6884,
+        RP446 = 6885,
+        RP447 = 6886,
+        RP448 = 6887,
+        RP449 = 6888,
+        RP45 = 6889,
+        RP450 = 6890,
+        RP451 = 6891,
+        RP452 = 6892,
+        RP453 = 6893,
+        RP454 = 6894,
+        RP455 = 6895,
+        RP456 = 6896,
+        RP457 = 6897,
+        RP458 = 6898,
+        RP459 = 6899,
+        RP46 = 6900,
+        RP460 = 6901,
+        RP461 = 6902,
+        RP462 = 6903,
+        RP463 = 6904,
+        RP464 = 6905,
+        RP465 = 6906,
+        RP466 = 6907,
+        RP467 = 6908,
+        RP468 = 6909,
+        RP469 = 6910,
+        RP47 = 6911,
+        RP470 = 6912,
+        RP471 = 6913,
+        RP472 = 6914,
+        RP473 = 6915,
+        RP474 = 6916,
+        RP475 = 6917,
+        RP476 = 6918,
+        RP477 = 6919,
+        RP478 = 6920,
+        RP479 = 6921,
+        RP48 = 6922,
+        RP480 = 6923,
+        RP481 = 6924,
+        RP482 = 6925,
+        RP483 = 6926,
+        RP484 = 6927,
+        RP485 = 6928,
+        RP486 = 6929,
+        RP487 = 6930,
+        RP488 = 6931,
+        RP489 = 6932,
+        RP49 = 6933,
+        RP490 = 6934,
+        RP491 = 6935,
+        RP492 = 6936,
+        RP493 = 6937,
+        RP494 = 6938,
+        RP495 = 6939,
+        RP496 = 6940,
+        RP497 = 6941,
+        RP498 = 6942,
+        RP499 = 6943,
+        RP5 = 6944,
+        RP50 = 6945,
+        RP500 = 6946,
+        RP501 = 6947,
+        RP502 = 6948,
+        RP503 = 6949,
+        RP504 = 6950,
+        RP505 = 6951,
+        RP506 = 6952,
+        RP507 = 6953,
+        RP508 = 6954,
+        RP509 = 6955,
+        RP51 = 6956,
+        RP510 = 6957,
+        RP511 = 6958,
+        RP512 = 6959,
+        RP513 = 6960,
+        RP514 = 6961,
+        RP515 = 6962,
+        RP516 = 6963,
+        RP517 = 6964,
+        RP518 = 6965,
+        RP519 = 6966,
+        RP52 = 6967,
+        RP520 = 6968,
+        RP521 = 6969,
+        RP522 = 6970,
+        RP523 = 6971,
+        RP524 = 6972,
+        RP525 = 6973,
+        RP526 = 6974,
+        RP527 = 6975,
+        RP528 = 6976,
+        RP529 = 6977,
+        RP53 = 6978,
+        RP530 = 6979,
+        RP531 = 6980,
+        RP532 = 6981,
+        RP533 = 6982,
+        RP534 = 6983,
+        RP535 = 6984,
+        RP536 = 6985,
+        RP537 = 6986,
+        RP538 = 6987,
+        RP539 = 6988,
+        RP54 = 6989,
+        RP540 = 6990,
+        RP541 = 6991,
+        RP542 = 6992,
+        RP543 = 6993,
+        RP544 = 6994,
+        RP545 = 6995,
+        RP546 = 6996,
+        RP547 = 6997,
+        RP548 = 6998,
+        RP549 = 6999,
+        RP55 = 7000,
+        RP550 = 7001,
+        RP551 = 7002,
+        RP552 = 7003,
+        RP553 = 7004,
+        RP554 = 7005,
+        RP555 = 7006,
+        RP556 = 7007,
+        RP557 = 7008,
+        RP558 = 7009,
+        RP559 = 7010,
+        RP56 = 7011,
+        RP560 = 7012,
+        RP561 = 7013,
+        RP562 = 7014,
+        RP563 = 7015,
+        RP564 = 7016,
+        RP565 = 7017,
+        RP566 = 7018,
+        RP567 = 7019,
+        RP568 = 7020,
+        RP569 = 7021,
+        RP57 = 7022,
+        RP570 = 7023,
+        RP571 = 7024,
+        RP572 = 7025,
+        RP573 = 7026,
+        RP574 = 7027,
+        RP575 = 7028,
+        RP576 = 7029,
+        RP577 = 7030,
+        RP578 = 7031,
+        RP579 = 7032,
+        RP58 = 7033,
+        RP580 = 7034,
+        RP581 = 7035,
+        RP582 = 7036,
+        RP583 = 7037,
+        RP584 = 7038,
+        RP585 = 7039,
+        RP586 = 7040,
+        RP587 = 7041,
+        RP588 = 7042,
+        RP589 = 7043,
+        RP59 = 7044,
+        RP590 = 7045,
+        RP591 = 7046,
+        RP592 = 7047,
+        RP593 = 7048,
+        RP594 = 7049,
+        RP595 = 7050,
+        RP596 = 7051,
+        RP597 = 7052,
+        RP598 = 7053,
+        RP599 = 7054,
+        RP6 = 7055,
+        RP60 = 7056,
+        RP600 = 7057,
+        RP601 = 7058,
+        RP602 = 7059,
+        RP603 = 7060,
+        RP604 = 7061,
+        RP605 = 7062,
+        RP606 = 7063,
+        RP607 = 7064,
+        RP608 = 7065,
+        RP609 = 7066,
+        RP61 = 7067,
+        RP610 = 7068,
+        RP611 = 7069,
+        RP612 = 7070,
+        RP613 = 7071,
+        RP614 = 7072,
+        RP615 = 7073,
+        RP616 = 7074,
+        RP617 = 7075,
+        RP618 = 7076,
+        RP619 = 7077,
+        RP62 = 7078,
+        RP620 = 7079,
+        RP621 = 7080,
+        RP622 = 7081,
+        RP623 = 7082,
+        RP624 = 7083,
+        RP625 = 7084,
+        RP626 = 7085,
+        RP627 = 7086,
+        RP628 = 7087,
+        RP629 = 7088,
+        RP63 = 7089,
+        RP630 = 7090,
+        RP631 = 7091,
+        RP632 = 7092,
+        RP633 = 7093,
+        RP634 = 7094,
+        RP635 = 7095,
+        RP636 = 7096,
+        RP637 = 7097,
+        RP638 = 7098,
+        RP639 = 7099,
+        RP64 = 7100,
+        RP640 = 7101,
+        RP641 = 7102,
+        RP642 = 7103,
+        RP643 = 7104,
+        RP644 = 7105,
+        RP645 = 7106,
+        RP646 = 7107,
+        RP647 = 7108,
+        RP648 = 7109,
+        RP649 = 7110,
+        RP65 = 7111,
+        RP650 = 7112,
+        RP651 = 7113,
+        RP652 = 7114,
+        RP653 = 7115,
+        RP654 = 7116,
+        RP655 = 7117,
+        RP656 = 7118,
+        RP657 = 7119,
+        RP658 = 7120,
+        RP659 = 7121,
+        RP66 = 7122,
+        RP660 = 7123,
+        RP661 = 7124,
+        RP662 = 7125,
+        RP663 = 7126,
+        RP664 = 7127,
+        RP665 = 7128,
+        RP666 = 7129,
+        RP667 = 7130,
+        RP668 = 7131,
+        RP669 = 7132,
+        RP67 = 7133,
+        RP670 = 7134,
+        RP671 = 7135,
+        RP672 = 7136,
+        RP673 = 7137,
+        RP674 = 7138,
+        RP675 = 7139,
+        RP676 = 7140,
+        RP677 = 7141,
+        RP678 = 7142,
+        RP679 = 7143,
+        RP68 = 7144,
+        RP680 = 7145,
+        RP681 = 7146,
+        RP682 = 7147,
+        RP683 = 7148,
+        RP684 = 7149,
+        RP685 = 7150,
+        RP686 = 7151,
+        RP687 = 7152,
+        RP688 = 7153,
+        RP689 = 7154,
+        RP69 = 7155,
+        RP690 = 7156,
+        RP691 = 7157,
+        RP692 = 7158,
+        RP693 = 7159,
+        RP694 = 7160,
+        RP695 = 7161,
+        RP696 = 7162,
+        RP697 = 7163,
+        RP698 = 7164,
+        RP699 = 7165,
+        RP7 = 7166,
+        RP70 = 7167,
+        RP700 = 7168,
+        RP701 = 7169,
+        RP702 = 7170,
+        RP703 = 7171,
+        RP704 = 7172,
+        RP705 = 7173,
+        RP706 = 7174,
+        RP707 = 7175,
+        RP708 = 7176,
+        RP709 = 7177,
+        RP71 = 7178,
+        RP710 = 7179,
+        RP711 = 7180,
+        RP712 = 7181,
+        RP713 = 7182,
+        RP714 = 7183,
+        RP715 = 7184,
+        RP716 = 7185,
+        RP717 = 7186,
+        RP718 = 7187,
+        RP719 = 7188,
+        RP72 = 7189,
+        RP720 = 7190,
+        RP721 = 7191,
+        RP722 = 7192,
+        RP723 = 7193,
+        RP724 = 7194,
+        RP725 = 7195,
+        RP726 = 7196,
+        RP727 = 7197,
+        RP728 = 7198,
+        RP729 = 7199,
+        RP73 = 7200,
+        RP730 = 7201,
+        RP731 = 7202,
+        RP732 = 7203,
+        RP733 = 7204,
+        RP734 = 7205,
+        RP735 = 7206,
+        RP736 = 7207,
+        RP737 = 7208,
+        RP738 = 7209,
+        RP739 = 7210,
+        RP74 = 7211,
+        RP740 = 7212,
+        RP741 = 7213,
+        RP742 = 7214,
+        RP743 = 7215,
+        RP744 = 7216,
+        RP745 = 7217,
+        RP746 = 7218,
+        RP747 = 7219,
+        RP748 = 7220,
+        RP749 = 7221,
+        RP75 = 7222,
+        RP750 = 7223,
+        RP751 = 7224,
+        RP752 = 7225,
+        RP753 = 7226,
+        RP754 = 7227,
+        RP755 = 7228,
+        RP756 = 7229,
+        RP757 = 7230,
+        RP758 = 7231,
+        RP759 = 7232,
+        RP76 = 7233,
+        RP760 = 7234,
+        RP761 = 7235,
+        RP762 = 7236,
+        RP763 = 7237,
+        RP764 = 7238,
+        RP765 = 7239,
+        RP766 = 7240,
+        RP767 = 7241,
+        RP768 = 7242,
+        RP769 = 7243,
+        RP77 = 7244,
+        RP770 = 7245,
+        RP771 = 7246,
+        RP772 = 7247,
+        RP773 = 7248,
+        RP774 = 7249,
+        RP775 = 7250,
+        RP776 = 7251,
+        RP777 = 7252,
+        RP778 = 7253,
+        RP779 = 7254,
+        RP78 = 7255,
+        RP780 = 7256,
+        RP781 = 7257,
+        RP782 = 7258,
+        RP783 = 7259,
+        RP784 = 7260,
+        RP785 = 7261,
+        RP786 = 7262,
+        RP787 = 7263,
+        RP788 = 7264,
+        RP789 = 7265,
+        RP79 = 7266,
+        RP790 = 7267,
+        RP791 = 7268,
+        RP792 = 7269,
+        RP793 = 7270,
+        RP794 = 7271,
+        RP795 = 7272,
+        RP796 = 7273,
+        RP797 = 7274,
+        RP798 = 7275,
+        RP799 = 7276,
+        RP8 = 7277,
+        RP80 = 7278,
+        RP800 = 7279,
+        RP801 = 7280,
+        RP802 = 7281,
+        RP803 = 7282,
+        RP804 = 7283,
+        RP805 = 7284,
+        RP806 = 7285,
+        RP807 = 7286,
+        RP808 = 7287,
+        RP809 = 7288,
+        RP81 = 7289,
+        RP810 = 7290,
+        RP811 = 7291,
+        RP812 = 7292,
+        RP813 = 7293,
+        RP814 = 7294,
+        RP815 = 7295,
+        RP816 = 7296,
+        RP817 = 7297,
+        RP818 = 7298,
+        RP819 = 7299,
+        RP82 = 7300,
+        RP820 = 7301,
+        RP821 = 7302,
+        RP822 = 7303,
+        RP823 = 7304,
+        RP824 = 7305,
+        RP825 = 7306,
+        RP826 = 7307,
+        RP827 = 7308,
+        RP828 = 7309,
+        RP829 = 7310,
+        RP83 = 7311,
+        RP830 = 7312,
+        RP831 = 7313,
+        RP832 = 7314,
+        RP833 = 7315,
+        RP834 = 7316,
+        RP835 = 7317,
+        RP836 = 7318,
+        RP837 = 7319,
+        RP838 = 7320,
+        RP839 = 7321,
+        RP84 = 7322,
+        RP840 = 7323,
+        RP841 = 7324,
+        RP842 = 7325,
+        RP843 = 7326,
+        RP844 = 7327,
+        RP845 = 7328,
+        RP846 = 7329,
+        RP847 = 7330,
+        RP848 = 7331,
+        RP849 = 7332,
+        RP85 = 7333,
+        RP850 = 7334,
+        RP851 = 7335,
+        RP852 = 7336,
+        RP853 = 7337,
+        RP854 = 7338,
+        RP855 = 7339,
+        RP856 = 7340,
+        RP857 = 7341,
+        RP858 = 7342,
+        RP859 = 7343,
+        RP86 = 7344,
+        RP860 = 7345,
+        RP861 = 7346,
+        RP862 = 7347,
+        RP863 = 7348,
+        RP864 = 7349,
+        RP865 = 7350,
+        RP866 = 7351,
+        RP867 = 7352,
+        RP868 = 7353,
+        RP869 = 7354,
+        RP87 = 7355,
+        RP870 = 7356,
+        RP871 = 7357,
+        RP872 = 7358,
+        RP873 = 7359,
+        RP874 = 7360,
+        RP875 = 7361,
+        RP876 = 7362,
+        RP877 = 7363,
+        RP878 = 7364,
+        RP879 = 7365,
+        RP88 = 7366,
+        RP880 = 7367,
+        RP881 = 7368,
+        RP882 = 7369,
+        RP883 = 7370,
+        RP884 = 7371,
+        RP885 = 7372,
+        RP886 = 7373,
+        RP887 = 7374,
+        RP888 = 7375,
+        RP889 = 7376,
+        RP89 = 7377,
+        RP890 = 7378,
+        RP891 = 7379,
+        RP892 = 7380,
+        RP893 = 7381,
+        RP894 = 7382,
+        RP895 = 7383,
+        RP896 = 7384,
+        RP897 = 7385,
+        RP898 = 7386,
+        RP899 = 7387,
+        RP9 = 7388,
+        RP90 = 7389,
+        RP900 = 7390,
+        RP901 = 7391,
+        RP902 = 7392,
+        RP903 = 7393,
+        RP904 = 7394,
+        RP905 = 7395,
+        RP906 = 7396,
+        RP907 = 7397,
+        RP908 = 7398,
+        RP909 = 7399,
+        RP91 = 7400,
+        RP910 = 7401,
+        RP911 = 7402,
+        RP912 = 7403,
+        RP913 = 7404,
+        RP914 = 7405,
+        RP915 = 7406,
+        RP916 = 7407,
+        RP917 = 7408,
+        RP918 = 7409,
+        RP919 = 7410,
+        RP92 = 7411,
+        RP920 = 7412,
+        RP921 = 7413,
+        RP922 = 7414,
+        RP923 = 7415,
+        RP924 = 7416,
+        RP925 = 7417,
+        RP926 = 7418,
+        RP927 = 7419,
+        RP928 = 7420,
+        RP929 = 7421,
+        RP93 = 7422,
+        RP930 = 7423,
+        RP931 = 7424,
+        RP932 = 7425,
+        RP933 = 7426,
+        RP934 = 7427,
+        RP935 = 7428,
+        RP936 = 7429,
+        RP937 = 7430,
+        RP938 = 7431,
+        RP939 = 7432,
+        RP94 = 7433,
+        RP940 = 7434,
+        RP941 = 7435,
+        RP942 = 7436,
+        RP943 = 7437,
+        RP944 = 7438,
+        RP945 = 7439,
+        RP946 = 7440,
+        RP947 = 7441,
+        RP948 = 7442,
+        RP949 = 7443,
+        RP95 = 7444,
+        RP950 = 7445,
+        RP951 = 7446,
+        RP952 = 7447,
+        RP953 = 7448,
+        RP954 = 7449,
+        RP955 = 7450,
+        RP956 = 7451,
+        RP957 = 7452,
+        RP958 = 7453,
+        RP959 = 7454,
+        RP96 = 7455,
+        RP960 = 7456,
+        RP961 = 7457,
+        RP962 = 7458,
+        RP963 = 7459,
+        RP964 = 7460,
+        RP965 = 7461,
+        RP966 = 7462,
+        RP967 = 7463,
+        RP968 = 7464,
+        RP969 = 7465,
+        RP97 = 7466,
+        RP970 = 7467,
+        RP971 = 7468,
+        RP972 = 7469,
+        RP973 = 7470,
+        RP974 = 7471,
+        RP975 = 7472,
+        RP976 = 7473,
+        RP977 = 7474,
+        RP978 = 7475,
+        RP979 = 7476,
+        RP98 = 7477,
+        RP980 = 7478,
+        RP981 = 7479,
+        RP982 = 7480,
+        RP983 = 7481,
+        RP984 = 7482,
+        RP985 = 7483,
+        RP986 = 7484,
+        RP987 = 7485,
+        RP988 = 7486,
+        RP989 = 7487,
+        RP99 = 7488,
+        RP990 = 7489,
+        RP991 = 7490,
+        RP992 = 7491,
+        RP993 = 7492,
+        RP994 = 7493,
+        RP995 = 7494,
+        RP996 = 7495,
+        RP997 = 7496,
+        RP998 = 7497,
+        RP999 = 7498
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
@@ -0,0 +1,714 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#include <utility>
+#include <stack>
+#include <map>
+#include <vector>
+#include <iostream>
+
+
+#include "nullable_10.h"
+
+enum ParserAct
+{
+    PA_SHIFT,
+    PA_REDUCE,
+    PA_ERROR,
+    PA_ACCEPT,
+    PA_NOP
+};
+
+class privBenchImpl
+{
+public:
+
+    privBenchImpl( void );
+    ~privBenchImpl( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    struct Value
+    {
+        union
+        {
+            int tokenType;
+            int errorType;
+        };
+    };
+    // first is stack num, second is the symbol index
+    typedef std::pair<int,int> StackID;
+    typedef std::pair<StackID,Value> StackEntry;
+    typedef std::stack<StackEntry> ParseStack;
+
+    void shift( int newState, int symIdx, Value &data );
+    void reduce( int ruleNum );
+    void callDtor( int symIdx, Value &data );
+    void popStack( void );
+    ParserAct findParserAction( int &newVal, int tok );
+    void initTables( void );
+    void syntaxError( Bench::Terminal tok, Value &data );
+    void parseFailed( void );
+
+    ParseStack myStack;
+    int myErrCount;
+
+
+    typedef std::pair<ParserAct,int> ActionEntry;
+    typedef std::map<int,ActionEntry> ActionMap;
+    typedef std::vector<ActionMap> StateList;
+    typedef std::vector<ActionEntry> StateDefaultList;
+
+    StateList myStates;
+    StateDefaultList myStateDefaultActions;
+
+
+    // first is LHS, second is number of RHS
+    typedef std::pair<int,int> RuleInfo;
+    typedef std::vector<RuleInfo> RuleList;
+
+    RuleList myRules;
+};
+
+
+////////////////////////////////////////
+
+
+Bench::Bench( void )
+    : myImplementation( new privBenchImpl )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Bench::~Bench( void )
+{
+    delete myImplementation;
+}
+
+
+////////////////////////////////////////
+
+
+void Bench::parse( Bench::Terminal tok, int value )
+{
+    myImplementation->parse( tok, value );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parse( Bench::Terminal tok, int value )
+{
+    int actVal;
+    ParserAct action;
+    bool errHit = false;
+    bool eoInput = (tok == Bench::EOF );
+    bool done = false;
+
+    if ( myStack.empty() )
+    {
+        if ( eoInput )
+            return;
+
+        myErrCount = -1;
+    }
+
+    privBenchImpl::Value data;
+    data.tokenType = value;
+
+    do
+    {
+        action = findParserAction( actVal, tok );
+        if ( PA_SHIFT == action )
+        {
+            shift( actVal, tok, data );
+            --myErrCount;
+            if ( eoInput && ! myStack.empty() )
+                tok = Bench::EOF;
+            else
+                done = true;
+        }
+        else if ( PA_REDUCE == action )
+        {
+            reduce( actVal );
+        }
+        else if ( PA_ERROR == action )
+        {
+            // Syntax error handling:
+            // 1. Call the %syntax_error function.
+            // 2. Pop stack until a state where we can shift the err symbol.
+            // 3. Shift the error symbol.
+            // 4. Set error count to three.
+            // 5. Begin accepting and shifting new tokens.
+            // 6. No new error processing will begin until 3 tokens are successful.
+            if ( myErrCount < 0 )
+            {
+                syntaxError( tok, data );
+            }
+            if ( myStack.top().first.first == 13 || errHit )
+            {
+                callDtor( static_cast<int>(tok), data );
+                done = true;
+            }
+            else
+            {
+                while ( ! myStack.empty() &&
+                        myStack.top().first.first != 13 )
+                {
+                    action = findParserAction( actVal, 13 );
+                    if ( action == PA_SHIFT )
+                        break;
+                    popStack();
+                }
+                if ( myStack.empty() || tok == Bench::EOF )
+                {
+                    callDtor( static_cast<int>(tok), data );
+                    parseFailed();
+                    done = true;
+                }
+                else if ( myStack.top().first.first != 13 )
+                {
+                    data.errorType = 0;
+                    shift( actVal, 13, data );
+                }
+            }
+            myErrCount = 3;
+            errHit = true;
+        }
+        else // ACCEPT == action || NOP == action
+        {
+            done = true;
+        }
+    } while ( ! done && ! myStack.empty() );
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::privBenchImpl( void )
+    : myErrCount( -1 )
+{
+    initTables();
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::~privBenchImpl( void )
+{
+    while ( ! myStack.empty() )
+        popStack();
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::shift( int newState, int symIdx, privBenchImpl::Value &data )
+{
+    StackEntry newItem = StackEntry( StackID( newState, symIdx ), data );
+    myStack.push( newItem );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::reduce( int ruleNum )
+{
+    int newVal;
+    ParserAct next;
+    privBenchImpl::Value data = { 0 };
+    std::vector<privBenchImpl::Value> rhsData;
+    for ( int i = 0, N = myRules[ruleNum].second; i != N; ++i )
+    {
+        if ( myStack.empty() )
+            rhsData.insert( rhsData.begin(), data );
+        else
+        {
+            rhsData.insert( rhsData.begin(), myStack.top().second );
+            myStack.pop();
+        }
+    }
+
+    next = findParserAction( newVal, myRules[ruleNum].first );
+
+    switch ( ruleNum )
+    {
+        case 0:
+        {
+            // prog ::= blocks
+#line 0 "bench/work/nullable_10.lem"
+#line 250 "bench/work/nullable_10.cpp"
+            callDtor( 12, rhsData[0] );
+            break;
+        }
+
+        case 1:
+        {
+            // blocks ::=
+#line 0 "bench/work/nullable_10.lem"
+#line 259 "bench/work/nullable_10.cpp"
+            break;
+        }
+
+        case 2:
+        {
+            // blocks ::= blocks block
+#line 0 "bench/work/nullable_10.lem"
+#line 267 "bench/work/nullable_10.cpp"
+            callDtor( 12, rhsData[0] );
+            callDtor( 11, rhsData[1] );
+            break;
+        }
+
+        case 3:
+        {
+            // block ::= B0 o0_0 o0_1 o0_2 o0_3 o0_4 o0_5 o0_6 o0_7 END
+#line 0 "bench/work/nullable_10.lem"
+#line 277 "bench/work/nullable_10.cpp"
+            callDtor( 9, rhsData[0] );
+            callDtor( 14, rhsData[1] );
+            callDtor( 15, rhsData[2] );
+            callDtor( 16, rhsData[3] );
+            callDtor( 17, rhsData[4] );
+            callDtor( 18, rhsData[5] );
+            callDtor( 19, rhsData[6] );
+            callDtor( 20, rhsData[7] );
+            callDtor( 21, rhsData[8] );
+            callDtor( 10, rhsData[9] );
+            break;
+        }
+
+        case 4:
+        {
+            // o0_0 ::=
+#line 0 "bench/work/nullable_10.lem"
+#line 295 "bench/work/nullable_10.cpp"
+            break;
+        }
+
+        case 5:
+        {
+            // o0_0 ::= A0
+#line 0 "bench/work/nullable_10.lem"
+#line 303 "bench/work/nullable_10.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 6:
+        {
+            // o0_1 ::=
+#line 0 "bench/work/nullable_10.lem"
+#line 312 "bench/work/nullable_10.cpp"
+            break;
+        }
+
+        case 7:
+        {
+            // o0_1 ::= A1
+#line 0 "bench/work/nullable_10.lem"
+#line 320 "bench/work/nullable_10.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 8:
+        {
+            // o0_2 ::=
+#line 0 "bench/work/nullable_10.lem"
+#line 329 "bench/work/nullable_10.cpp"
+            break;
+        }
+
+        case 9:
+        {
+            // o0_2 ::= A2
+#line 0 "bench/work/nullable_10.lem"
+#line 337 "bench/work/nullable_10.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 10:
+        {
+            // o0_3 ::=
+#line 0 "bench/work/nullable_10.lem"
+#line 346 "bench/work/nullable_10.cpp"
+            break;
+        }
+
+        case 11:
+        {
+            // o0_3 ::= A3
+#line 0 "bench/work/nullable_10.lem"
+#line 354 "bench/work/nullable_10.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 12:
+        {
+            // o0_4 ::=
+#line 0 "bench/work/nullable_10.lem"
+#line 363 "bench/work/nullable_10.cpp"
+            break;
+        }
+
+        case 13:
+        {
+            // o0_4 ::= A4
+#line 0 "bench/work/nullable_10.lem"
+#line 371 "bench/work/nullable_10.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 14:
+        {
+            // o0_5 ::=
+#line 0 "bench/work/nullable_10.lem"
+#line 380 "bench/work/nullable_10.cpp"
+            break;
+        }
+
+        case 15:
+        {
+            // o0_5 ::= A5
+#line 0 "bench/work/nullable_10.lem"
+#line 388 "bench/work/nullable_10.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 16:
+        {
+            // o0_6 ::=
+#line 0 "bench/work/nullable_10.lem"
+#line 397 "bench/work/nullable_10.cpp"
+            break;
+        }
+
+        case 17:
+        {
+            // o0_6 ::= A6
+#line 0 "bench/work/nullable_10.lem"
+#line 405 "bench/work/nullable_10.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 18:
+        {
+            // o0_7 ::=
+#line 0 "bench/work/nullable_10.lem"
+#line 414 "bench/work/nullable_10.cpp"
+            break;
+        }
+
+        case 19:
+        {
+            // o0_7 ::= A7
+#line 0 "bench/work/nullable_10.lem"
+#line 422 "bench/work/nullable_10.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        default:
+            throw "Unknown Rule Number";
+            break;
+    }
+
+    if ( PA_SHIFT == next )
+        shift( newVal, myRules[ruleNum].first, data );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::callDtor( int symIdx, privBenchImpl::Value &data )
+{
+    switch ( symIdx )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::popStack( void )
+{
+    callDtor( myStack.top().first.second, myStack.top().second );
+    myStack.pop();
+}
+
+
+////////////////////////////////////////
+
+
+ParserAct privBenchImpl::findParserAction( int &newVal, int tok )
+{
+    int stateNum;
+    ParserAct retval = PA_NOP;
+    bool found = false;
+
+    stateNum = myStack.empty() ? 0 : myStack.top().first.first;
+    ActionMap::iterator i = myStates[stateNum].find( tok );
+    if ( tok >= 0 && tok <= 23 )
+    {
+        if ( i != myStates[stateNum].end() )
+        {
+            retval = (*i).second.first;
+            newVal = (*i).second.second;
+            found = true;
+        }
+    }
+    else if ( ! myStates[stateNum].empty() )
+    {
+        retval = PA_NOP;
+        newVal = 0;
+        found = true;
+    }
+
+    if ( ! found )
+    {
+        retval = myStateDefaultActions[stateNum].first;
+        newVal = myStateDefaultActions[stateNum].second;
+    }
+    return retval;
+}
+
+
+////////////////////////////////////////
+
+
+static int theStateTable[58][4] =
+{
+    // State 0
+    { 0, 12, PA_SHIFT, 1 },
+    // State 0
+    { 0, 22, PA_ACCEPT, 0 },
+    // State 0
+    { 0, 23, PA_REDUCE, 1 },
+    // State 0 default action
+    { 0, -1, PA_REDUCE, 1 },
+    // State 1
+    { 1, 0, PA_REDUCE, 0 },
+    // State 1
+    { 1, 9, PA_SHIFT, 3 },
+    // State 1
+    { 1, 11, PA_SHIFT, 2 },
+    // State 2
+    { 2, 23, PA_REDUCE, 2 },
+    // State 2 default action
+    { 2, -1, PA_REDUCE, 2 },
+    // State 3
+    { 3, 1, PA_SHIFT, 20 },
+    // State 3
+    { 3, 14, PA_SHIFT, 4 },
+    // State 3
+    { 3, 23, PA_REDUCE, 4 },
+    // State 3 default action
+    { 3, -1, PA_REDUCE, 4 },
+    // State 4
+    { 4, 2, PA_SHIFT, 19 },
+    // State 4
+    { 4, 15, PA_SHIFT, 5 },
+    // State 4
+    { 4, 23, PA_REDUCE, 6 },
+    // State 4 default action
+    { 4, -1, PA_REDUCE, 6 },
+    // State 5
+    { 5, 3, PA_SHIFT, 18 },
+    // State 5
+    { 5, 16, PA_SHIFT, 6 },
+    // State 5
+    { 5, 23, PA_REDUCE, 8 },
+    // State 5 default action
+    { 5, -1, PA_REDUCE, 8 },
+    // State 6
+    { 6, 4, PA_SHIFT, 17 },
+    // State 6
+    { 6, 17, PA_SHIFT, 7 },
+    // State 6
+    { 6, 23, PA_REDUCE, 10 },
+    // State 6 default action
+    { 6, -1, PA_REDUCE, 10 },
+    // State 7
+    { 7, 5, PA_SHIFT, 16 },
+    // State 7
+    { 7, 18, PA_SHIFT, 8 },
+    // State 7
+    { 7, 23, PA_REDUCE, 12 },
+    // State 7 default action
+    { 7, -1, PA_REDUCE, 12 },
+    // State 8
+    { 8, 6, PA_SHIFT, 15 },
+    // State 8
+    { 8, 19, PA_SHIFT, 9 },
+    // State 8
+    { 8, 23, PA_REDUCE, 14 },
+    // State 8 default action
+    { 8, -1, PA_REDUCE, 14 },
+    // State 9
+    { 9, 7, PA_SHIFT, 14 },
+    // State 9
+    { 9, 20, PA_SHIFT, 10 },
+    // State 9
+    { 9, 23, PA_REDUCE, 16 },
+    // State 9 default action
+    { 9, -1, PA_REDUCE, 16 },
+    // State 10
+    { 10, 8, PA_SHIFT, 13 },
+    // State 10
+    { 10, 10, PA_REDUCE, 18 },
+    // State 10
+    { 10, 21, PA_SHIFT, 11 },
+    // State 11
+    { 11, 10, PA_SHIFT, 12 },
+    // State 12
+    { 12, 23, PA_REDUCE, 3 },
+    // State 12 default action
+    { 12, -1, PA_REDUCE, 3 },
+    // State 13
+    { 13, 10, PA_REDUCE, 19 },
+    // State 14
+    { 14, 23, PA_REDUCE, 17 },
+    // State 14 default action
+    { 14, -1, PA_REDUCE, 17 },
+    // State 15
+    { 15, 23, PA_REDUCE, 15 },
+    // State 15 default action
+    { 15, -1, PA_REDUCE, 15 },
+    // State 16
+    { 16, 23, PA_REDUCE, 13 },
+    // State 16 default action
+    { 16, -1, PA_REDUCE, 13 },
+    // State 17
+    { 17, 23, PA_REDUCE, 11 },
+    // State 17 default action
+    { 17, -1, PA_REDUCE, 11 },
+    // State 18
+    { 18, 23, PA_REDUCE, 9 },
+    // State 18 default action
+    { 18, -1, PA_REDUCE, 9 },
+    // State 19
+    { 19, 23, PA_REDUCE, 7 },
+    // State 19 default action
+    { 19, -1, PA_REDUCE, 7 },
+    // State 20
+    { 20, 23, PA_REDUCE, 5 },
+    // State 20 default action
+    { 20, -1, PA_REDUCE, 5 },
+};
+
+
+static int theRuleTable[20][2] =
+{
+    // prog ::= blocks
+    { 22, 1 }, 
+    // blocks ::=
+    { 12, 0 }, 
+    // blocks ::= blocks block
+    { 12, 2 }, 
+    // block ::= B0 o0_0 o0_1 o0_2 o0_3 o0_4 o0_5 o0_6 o0_7 END
+    { 11, 10 }, 
+    // o0_0 ::=
+    { 14, 0 }, 
+    // o0_0 ::= A0
+    { 14, 1 }, 
+    // o0_1 ::=
+    { 15, 0 }, 
+    // o0_1 ::= A1
+    { 15, 1 }, 
+    // o0_2 ::=
+    { 16, 0 }, 
+    // o0_2 ::= A2
+    { 16, 1 }, 
+    // o0_3 ::=
+    { 17, 0 }, 
+    // o0_3 ::= A3
+    { 17, 1 }, 
+    // o0_4 ::=
+    { 18, 0 }, 
+    // o0_4 ::= A4
+    { 18, 1 }, 
+    // o0_5 ::=
+    { 19, 0 }, 
+    // o0_5 ::= A5
+    { 19, 1 }, 
+    // o0_6 ::=
+    { 20, 0 }, 
+    // o0_6 ::= A6
+    { 20, 1 }, 
+    // o0_7 ::=
+    { 21, 0 }, 
+    // o0_7 ::= A7
+    { 21, 1 }, 
+};
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::initTables( void )
+{
+    myStates.assign( 21, ActionMap() );
+    myStateDefaultActions.assign( 21, ActionEntry(PA_ERROR,-2) );
+    for ( int i = 0; i < 58; ++i )
+    {
+        if ( theStateTable[i][1] == -1 )
+            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+        else
+            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+    }
+
+
+    // Rule Table
+
+    myRules.reserve( 20 );
+    for ( int i = 0; i < 20; ++i )
+        myRules.push_back( RuleInfo( theRuleTable[i][0], theRuleTable[i][1] ) );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::syntaxError( Bench::Terminal tok, privBenchImpl::Value &data )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parseFailed( void )
+{
+}
@@ -0,0 +1,1870 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#include <utility>
+#include <stack>
+#include <map>
+#include <vector>
+#include <iostream>
+
+
+#include "nullable_100.h"
+
+enum ParserAct
+{
+    PA_SHIFT,
+    PA_REDUCE,
+    PA_ERROR,
+    PA_ACCEPT,
+    PA_NOP
+};
+
+class privBenchImpl
+{
+public:
+
+    privBenchImpl( void );
+    ~privBenchImpl( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    struct Value
+    {
+        union
+        {
+            int tokenType;
+            int errorType;
+        };
+    };
+    // first is stack num, second is the symbol index
+    typedef std::pair<int,int> StackID;
+    typedef std::pair<StackID,Value> StackEntry;
+    typedef std::stack<StackEntry> ParseStack;
+
+    void shift( int newState, int symIdx, Value &data );
+    void reduce( int ruleNum );
+    void callDtor( int symIdx, Value &data );
+    void popStack( void );
+    ParserAct findParserAction( int &newVal, int tok );
+    void initTables( void );
+    void syntaxError( Bench::Terminal tok, Value &data );
+    void parseFailed( void );
+
+    ParseStack myStack;
+    int myErrCount;
+
+
+    typedef std::pair<ParserAct,int> ActionEntry;
+    typedef std::map<int,ActionEntry> ActionMap;
+    typedef std::vector<ActionMap> StateList;
+    typedef std::vector<ActionEntry> StateDefaultList;
+
+    StateList myStates;
+    StateDefaultList myStateDefaultActions;
+
+
+    // first is LHS, second is number of RHS
+    typedef std::pair<int,int> RuleInfo;
+    typedef std::vector<RuleInfo> RuleList;
+
+    RuleList myRules;
+};
+
+
+////////////////////////////////////////
+
+
+Bench::Bench( void )
+    : myImplementation( new privBenchImpl )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Bench::~Bench( void )
+{
+    delete myImplementation;
+}
+
+
+////////////////////////////////////////
+
+
+void Bench::parse( Bench::Terminal tok, int value )
+{
+    myImplementation->parse( tok, value );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parse( Bench::Terminal tok, int value )
+{
+    int actVal;
+    ParserAct action;
+    bool errHit = false;
+    bool eoInput = (tok == Bench::EOF );
+    bool done = false;
+
+    if ( myStack.empty() )
+    {
+        if ( eoInput )
+            return;
+
+        myErrCount = -1;
+    }
+
+    privBenchImpl::Value data;
+    data.tokenType = value;
+
+    do
+    {
+        action = findParserAction( actVal, tok );
+        if ( PA_SHIFT == action )
+        {
+            shift( actVal, tok, data );
+            --myErrCount;
+            if ( eoInput && ! myStack.empty() )
+                tok = Bench::EOF;
+            else
+                done = true;
+        }
+        else if ( PA_REDUCE == action )
+        {
+            reduce( actVal );
+        }
+        else if ( PA_ERROR == action )
+        {
+            // Syntax error handling:
+            // 1. Call the %syntax_error function.
+            // 2. Pop stack until a state where we can shift the err symbol.
+            // 3. Shift the error symbol.
+            // 4. Set error count to three.
+            // 5. Begin accepting and shifting new tokens.
+            // 6. No new error processing will begin until 3 tokens are successful.
+            if ( myErrCount < 0 )
+            {
+                syntaxError( tok, data );
+            }
+            if ( myStack.top().first.first == 17 || errHit )
+            {
+                callDtor( static_cast<int>(tok), data );
+                done = true;
+            }
+            else
+            {
+                while ( ! myStack.empty() &&
+                        myStack.top().first.first != 17 )
+                {
+                    action = findParserAction( actVal, 17 );
+                    if ( action == PA_SHIFT )
+                        break;
+                    popStack();
+                }
+                if ( myStack.empty() || tok == Bench::EOF )
+                {
+                    callDtor( static_cast<int>(tok), data );
+                    parseFailed();
+                    done = true;
+                }
+                else if ( myStack.top().first.first != 17 )
+                {
+                    data.errorType = 0;
+                    shift( actVal, 17, data );
+                }
+            }
+            myErrCount = 3;
+            errHit = true;
+        }
+        else // ACCEPT == action || NOP == action
+        {
+            done = true;
+        }
+    } while ( ! done && ! myStack.empty() );
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::privBenchImpl( void )
+    : myErrCount( -1 )
+{
+    initTables();
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::~privBenchImpl( void )
+{
+    while ( ! myStack.empty() )
+        popStack();
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::shift( int newState, int symIdx, privBenchImpl::Value &data )
+{
+    StackEntry newItem = StackEntry( StackID( newState, symIdx ), data );
+    myStack.push( newItem );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::reduce( int ruleNum )
+{
+    int newVal;
+    ParserAct next;
+    privBenchImpl::Value data = { 0 };
+    std::vector<privBenchImpl::Value> rhsData;
+    for ( int i = 0, N = myRules[ruleNum].second; i != N; ++i )
+    {
+        if ( myStack.empty() )
+            rhsData.insert( rhsData.begin(), data );
+        else
+        {
+            rhsData.insert( rhsData.begin(), myStack.top().second );
+            myStack.pop();
+        }
+    }
+
+    next = findParserAction( newVal, myRules[ruleNum].first );
+
+    switch ( ruleNum )
+    {
+        case 0:
+        {
+            // prog ::= blocks
+#line 0 "bench/work/nullable_100.lem"
+#line 250 "bench/work/nullable_100.cpp"
+            callDtor( 16, rhsData[0] );
+            break;
+        }
+
+        case 1:
+        {
+            // blocks ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 259 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 2:
+        {
+            // blocks ::= blocks block
+#line 0 "bench/work/nullable_100.lem"
+#line 267 "bench/work/nullable_100.cpp"
+            callDtor( 16, rhsData[0] );
+            callDtor( 15, rhsData[1] );
+            break;
+        }
+
+        case 3:
+        {
+            // block ::= B0 o0_0 o0_1 o0_2 o0_3 o0_4 o0_5 o0_6 o0_7 END
+#line 0 "bench/work/nullable_100.lem"
+#line 277 "bench/work/nullable_100.cpp"
+            callDtor( 9, rhsData[0] );
+            callDtor( 18, rhsData[1] );
+            callDtor( 19, rhsData[2] );
+            callDtor( 20, rhsData[3] );
+            callDtor( 21, rhsData[4] );
+            callDtor( 22, rhsData[5] );
+            callDtor( 23, rhsData[6] );
+            callDtor( 24, rhsData[7] );
+            callDtor( 25, rhsData[8] );
+            callDtor( 14, rhsData[9] );
+            break;
+        }
+
+        case 4:
+        {
+            // o0_0 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 295 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 5:
+        {
+            // o0_0 ::= A0
+#line 0 "bench/work/nullable_100.lem"
+#line 303 "bench/work/nullable_100.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 6:
+        {
+            // o0_1 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 312 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 7:
+        {
+            // o0_1 ::= A1
+#line 0 "bench/work/nullable_100.lem"
+#line 320 "bench/work/nullable_100.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 8:
+        {
+            // o0_2 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 329 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 9:
+        {
+            // o0_2 ::= A2
+#line 0 "bench/work/nullable_100.lem"
+#line 337 "bench/work/nullable_100.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 10:
+        {
+            // o0_3 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 346 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 11:
+        {
+            // o0_3 ::= A3
+#line 0 "bench/work/nullable_100.lem"
+#line 354 "bench/work/nullable_100.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 12:
+        {
+            // o0_4 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 363 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 13:
+        {
+            // o0_4 ::= A4
+#line 0 "bench/work/nullable_100.lem"
+#line 371 "bench/work/nullable_100.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 14:
+        {
+            // o0_5 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 380 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 15:
+        {
+            // o0_5 ::= A5
+#line 0 "bench/work/nullable_100.lem"
+#line 388 "bench/work/nullable_100.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 16:
+        {
+            // o0_6 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 397 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 17:
+        {
+            // o0_6 ::= A6
+#line 0 "bench/work/nullable_100.lem"
+#line 405 "bench/work/nullable_100.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 18:
+        {
+            // o0_7 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 414 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 19:
+        {
+            // o0_7 ::= A7
+#line 0 "bench/work/nullable_100.lem"
+#line 422 "bench/work/nullable_100.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 20:
+        {
+            // block ::= B1 o1_0 o1_1 o1_2 o1_3 o1_4 o1_5 o1_6 o1_7 END
+#line 0 "bench/work/nullable_100.lem"
+#line 431 "bench/work/nullable_100.cpp"
+            callDtor( 10, rhsData[0] );
+            callDtor( 26, rhsData[1] );
+            callDtor( 27, rhsData[2] );
+            callDtor( 28, rhsData[3] );
+            callDtor( 29, rhsData[4] );
+            callDtor( 30, rhsData[5] );
+            callDtor( 31, rhsData[6] );
+            callDtor( 32, rhsData[7] );
+            callDtor( 33, rhsData[8] );
+            callDtor( 14, rhsData[9] );
+            break;
+        }
+
+        case 21:
+        {
+            // o1_0 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 449 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 22:
+        {
+            // o1_0 ::= A0
+#line 0 "bench/work/nullable_100.lem"
+#line 457 "bench/work/nullable_100.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 23:
+        {
+            // o1_1 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 466 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 24:
+        {
+            // o1_1 ::= A1
+#line 0 "bench/work/nullable_100.lem"
+#line 474 "bench/work/nullable_100.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 25:
+        {
+            // o1_2 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 483 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 26:
+        {
+            // o1_2 ::= A2
+#line 0 "bench/work/nullable_100.lem"
+#line 491 "bench/work/nullable_100.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 27:
+        {
+            // o1_3 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 500 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 28:
+        {
+            // o1_3 ::= A3
+#line 0 "bench/work/nullable_100.lem"
+#line 508 "bench/work/nullable_100.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 29:
+        {
+            // o1_4 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 517 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 30:
+        {
+            // o1_4 ::= A4
+#line 0 "bench/work/nullable_100.lem"
+#line 525 "bench/work/nullable_100.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 31:
+        {
+            // o1_5 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 534 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 32:
+        {
+            // o1_5 ::= A5
+#line 0 "bench/work/nullable_100.lem"
+#line 542 "bench/work/nullable_100.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 33:
+        {
+            // o1_6 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 551 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 34:
+        {
+            // o1_6 ::= A6
+#line 0 "bench/work/nullable_100.lem"
+#line 559 "bench/work/nullable_100.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 35:
+        {
+            // o1_7 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 568 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 36:
+        {
+            // o1_7 ::= A7
+#line 0 "bench/work/nullable_100.lem"
+#line 576 "bench/work/nullable_100.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 37:
+        {
+            // block ::= B2 o2_0 o2_1 o2_2 o2_3 o2_4 o2_5 o2_6 o2_7 END
+#line 0 "bench/work/nullable_100.lem"
+#line 585 "bench/work/nullable_100.cpp"
+            callDtor( 11, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 35, rhsData[2] );
+            callDtor( 36, rhsData[3] );
+            callDtor( 37, rhsData[4] );
+            callDtor( 38, rhsData[5] );
+            callDtor( 39, rhsData[6] );
+            callDtor( 40, rhsData[7] );
+            callDtor( 41, rhsData[8] );
+            callDtor( 14, rhsData[9] );
+            break;
+        }
+
+        case 38:
+        {
+            // o2_0 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 603 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 39:
+        {
+            // o2_0 ::= A0
+#line 0 "bench/work/nullable_100.lem"
+#line 611 "bench/work/nullable_100.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 40:
+        {
+            // o2_1 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 620 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 41:
+        {
+            // o2_1 ::= A1
+#line 0 "bench/work/nullable_100.lem"
+#line 628 "bench/work/nullable_100.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 42:
+        {
+            // o2_2 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 637 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 43:
+        {
+            // o2_2 ::= A2
+#line 0 "bench/work/nullable_100.lem"
+#line 645 "bench/work/nullable_100.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 44:
+        {
+            // o2_3 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 654 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 45:
+        {
+            // o2_3 ::= A3
+#line 0 "bench/work/nullable_100.lem"
+#line 662 "bench/work/nullable_100.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 46:
+        {
+            // o2_4 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 671 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 47:
+        {
+            // o2_4 ::= A4
+#line 0 "bench/work/nullable_100.lem"
+#line 679 "bench/work/nullable_100.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 48:
+        {
+            // o2_5 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 688 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 49:
+        {
+            // o2_5 ::= A5
+#line 0 "bench/work/nullable_100.lem"
+#line 696 "bench/work/nullable_100.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 50:
+        {
+            // o2_6 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 705 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 51:
+        {
+            // o2_6 ::= A6
+#line 0 "bench/work/nullable_100.lem"
+#line 713 "bench/work/nullable_100.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 52:
+        {
+            // o2_7 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 722 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 53:
+        {
+            // o2_7 ::= A7
+#line 0 "bench/work/nullable_100.lem"
+#line 730 "bench/work/nullable_100.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 54:
+        {
+            // block ::= B3 o3_0 o3_1 o3_2 o3_3 o3_4 o3_5 o3_6 o3_7 END
+#line 0 "bench/work/nullable_100.lem"
+#line 739 "bench/work/nullable_100.cpp"
+            callDtor( 12, rhsData[0] );
+            callDtor( 42, rhsData[1] );
+            callDtor( 43, rhsData[2] );
+            callDtor( 44, rhsData[3] );
+            callDtor( 45, rhsData[4] );
+            callDtor( 46, rhsData[5] );
+            callDtor( 47, rhsData[6] );
+            callDtor( 48, rhsData[7] );
+            callDtor( 49, rhsData[8] );
+            callDtor( 14, rhsData[9] );
+            break;
+        }
+
+        case 55:
+        {
+            // o3_0 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 757 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 56:
+        {
+            // o3_0 ::= A0
+#line 0 "bench/work/nullable_100.lem"
+#line 765 "bench/work/nullable_100.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 57:
+        {
+            // o3_1 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 774 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 58:
+        {
+            // o3_1 ::= A1
+#line 0 "bench/work/nullable_100.lem"
+#line 782 "bench/work/nullable_100.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 59:
+        {
+            // o3_2 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 791 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 60:
+        {
+            // o3_2 ::= A2
+#line 0 "bench/work/nullable_100.lem"
+#line 799 "bench/work/nullable_100.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 61:
+        {
+            // o3_3 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 808 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 62:
+        {
+            // o3_3 ::= A3
+#line 0 "bench/work/nullable_100.lem"
+#line 816 "bench/work/nullable_100.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 63:
+        {
+            // o3_4 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 825 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 64:
+        {
+            // o3_4 ::= A4
+#line 0 "bench/work/nullable_100.lem"
+#line 833 "bench/work/nullable_100.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 65:
+        {
+            // o3_5 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 842 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 66:
+        {
+            // o3_5 ::= A5
+#line 0 "bench/work/nullable_100.lem"
+#line 850 "bench/work/nullable_100.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 67:
+        {
+            // o3_6 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 859 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 68:
+        {
+            // o3_6 ::= A6
+#line 0 "bench/work/nullable_100.lem"
+#line 867 "bench/work/nullable_100.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 69:
+        {
+            // o3_7 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 876 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 70:
+        {
+            // o3_7 ::= A7
+#line 0 "bench/work/nullable_100.lem"
+#line 884 "bench/work/nullable_100.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 71:
+        {
+            // block ::= B4 o4_0 o4_1 o4_2 o4_3 o4_4 o4_5 o4_6 o4_7 END
+#line 0 "bench/work/nullable_100.lem"
+#line 893 "bench/work/nullable_100.cpp"
+            callDtor( 13, rhsData[0] );
+            callDtor( 50, rhsData[1] );
+            callDtor( 51, rhsData[2] );
+            callDtor( 52, rhsData[3] );
+            callDtor( 53, rhsData[4] );
+            callDtor( 54, rhsData[5] );
+            callDtor( 55, rhsData[6] );
+            callDtor( 56, rhsData[7] );
+            callDtor( 57, rhsData[8] );
+            callDtor( 14, rhsData[9] );
+            break;
+        }
+
+        case 72:
+        {
+            // o4_0 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 911 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 73:
+        {
+            // o4_0 ::= A0
+#line 0 "bench/work/nullable_100.lem"
+#line 919 "bench/work/nullable_100.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 74:
+        {
+            // o4_1 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 928 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 75:
+        {
+            // o4_1 ::= A1
+#line 0 "bench/work/nullable_100.lem"
+#line 936 "bench/work/nullable_100.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 76:
+        {
+            // o4_2 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 945 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 77:
+        {
+            // o4_2 ::= A2
+#line 0 "bench/work/nullable_100.lem"
+#line 953 "bench/work/nullable_100.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 78:
+        {
+            // o4_3 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 962 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 79:
+        {
+            // o4_3 ::= A3
+#line 0 "bench/work/nullable_100.lem"
+#line 970 "bench/work/nullable_100.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 80:
+        {
+            // o4_4 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 979 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 81:
+        {
+            // o4_4 ::= A4
+#line 0 "bench/work/nullable_100.lem"
+#line 987 "bench/work/nullable_100.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 82:
+        {
+            // o4_5 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 996 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 83:
+        {
+            // o4_5 ::= A5
+#line 0 "bench/work/nullable_100.lem"
+#line 1004 "bench/work/nullable_100.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 84:
+        {
+            // o4_6 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 1013 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 85:
+        {
+            // o4_6 ::= A6
+#line 0 "bench/work/nullable_100.lem"
+#line 1021 "bench/work/nullable_100.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 86:
+        {
+            // o4_7 ::=
+#line 0 "bench/work/nullable_100.lem"
+#line 1030 "bench/work/nullable_100.cpp"
+            break;
+        }
+
+        case 87:
+        {
+            // o4_7 ::= A7
+#line 0 "bench/work/nullable_100.lem"
+#line 1038 "bench/work/nullable_100.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        default:
+            throw "Unknown Rule Number";
+            break;
+    }
+
+    if ( PA_SHIFT == next )
+        shift( newVal, myRules[ruleNum].first, data );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::callDtor( int symIdx, privBenchImpl::Value &data )
+{
+    switch ( symIdx )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+        case 12:
+        case 13:
+        case 14:
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::popStack( void )
+{
+    callDtor( myStack.top().first.second, myStack.top().second );
+    myStack.pop();
+}
+
+
+////////////////////////////////////////
+
+
+ParserAct privBenchImpl::findParserAction( int &newVal, int tok )
+{
+    int stateNum;
+    ParserAct retval = PA_NOP;
+    bool found = false;
+
+    stateNum = myStack.empty() ? 0 : myStack.top().first.first;
+    ActionMap::iterator i = myStates[stateNum].find( tok );
+    if ( tok >= 0 && tok <= 59 )
+    {
+        if ( i != myStates[stateNum].end() )
+        {
+            retval = (*i).second.first;
+            newVal = (*i).second.second;
+            found = true;
+        }
+    }
+    else if ( ! myStates[stateNum].empty() )
+    {
+        retval = PA_NOP;
+        newVal = 0;
+        found = true;
+    }
+
+    if ( ! found )
+    {
+        retval = myStateDefaultActions[stateNum].first;
+        newVal = myStateDefaultActions[stateNum].second;
+    }
+    return retval;
+}
+
+
+////////////////////////////////////////
+
+
+static int theStateTable[258][4] =
+{
+    // State 0
+    { 0, 16, PA_SHIFT, 1 },
+    // State 0
+    { 0, 58, PA_ACCEPT, 0 },
+    // State 0
+    { 0, 59, PA_REDUCE, 1 },
+    // State 0 default action
+    { 0, -1, PA_REDUCE, 1 },
+    // State 1
+    { 1, 0, PA_REDUCE, 0 },
+    // State 1
+    { 1, 9, PA_SHIFT, 3 },
+    // State 1
+    { 1, 10, PA_SHIFT, 21 },
+    // State 1
+    { 1, 11, PA_SHIFT, 39 },
+    // State 1
+    { 1, 12, PA_SHIFT, 57 },
+    // State 1
+    { 1, 13, PA_SHIFT, 75 },
+    // State 1
+    { 1, 15, PA_SHIFT, 2 },
+    // State 2
+    { 2, 59, PA_REDUCE, 2 },
+    // State 2 default action
+    { 2, -1, PA_REDUCE, 2 },
+    // State 3
+    { 3, 1, PA_SHIFT, 20 },
+    // State 3
+    { 3, 18, PA_SHIFT, 4 },
+    // State 3
+    { 3, 59, PA_REDUCE, 4 },
+    // State 3 default action
+    { 3, -1, PA_REDUCE, 4 },
+    // State 4
+    { 4, 2, PA_SHIFT, 19 },
+    // State 4
+    { 4, 19, PA_SHIFT, 5 },
+    // State 4
+    { 4, 59, PA_REDUCE, 6 },
+    // State 4 default action
+    { 4, -1, PA_REDUCE, 6 },
+    // State 5
+    { 5, 3, PA_SHIFT, 18 },
+    // State 5
+    { 5, 20, PA_SHIFT, 6 },
+    // State 5
+    { 5, 59, PA_REDUCE, 8 },
+    // State 5 default action
+    { 5, -1, PA_REDUCE, 8 },
+    // State 6
+    { 6, 4, PA_SHIFT, 17 },
+    // State 6
+    { 6, 21, PA_SHIFT, 7 },
+    // State 6
+    { 6, 59, PA_REDUCE, 10 },
+    // State 6 default action
+    { 6, -1, PA_REDUCE, 10 },
+    // State 7
+    { 7, 5, PA_SHIFT, 16 },
+    // State 7
+    { 7, 22, PA_SHIFT, 8 },
+    // State 7
+    { 7, 59, PA_REDUCE, 12 },
+    // State 7 default action
+    { 7, -1, PA_REDUCE, 12 },
+    // State 8
+    { 8, 6, PA_SHIFT, 15 },
+    // State 8
+    { 8, 23, PA_SHIFT, 9 },
+    // State 8
+    { 8, 59, PA_REDUCE, 14 },
+    // State 8 default action
+    { 8, -1, PA_REDUCE, 14 },
+    // State 9
+    { 9, 7, PA_SHIFT, 14 },
+    // State 9
+    { 9, 24, PA_SHIFT, 10 },
+    // State 9
+    { 9, 59, PA_REDUCE, 16 },
+    // State 9 default action
+    { 9, -1, PA_REDUCE, 16 },
+    // State 10
+    { 10, 8, PA_SHIFT, 13 },
+    // State 10
+    { 10, 14, PA_REDUCE, 18 },
+    // State 10
+    { 10, 25, PA_SHIFT, 11 },
+    // State 11
+    { 11, 14, PA_SHIFT, 12 },
+    // State 12
+    { 12, 59, PA_REDUCE, 3 },
+    // State 12 default action
+    { 12, -1, PA_REDUCE, 3 },
+    // State 13
+    { 13, 14, PA_REDUCE, 19 },
+    // State 14
+    { 14, 59, PA_REDUCE, 17 },
+    // State 14 default action
+    { 14, -1, PA_REDUCE, 17 },
+    // State 15
+    { 15, 59, PA_REDUCE, 15 },
+    // State 15 default action
+    { 15, -1, PA_REDUCE, 15 },
+    // State 16
+    { 16, 59, PA_REDUCE, 13 },
+    // State 16 default action
+    { 16, -1, PA_REDUCE, 13 },
+    // State 17
+    { 17, 59, PA_REDUCE, 11 },
+    // State 17 default action
+    { 17, -1, PA_REDUCE, 11 },
+    // State 18
+    { 18, 59, PA_REDUCE, 9 },
+    // State 18 default action
+    { 18, -1, PA_REDUCE, 9 },
+    // State 19
+    { 19, 59, PA_REDUCE, 7 },
+    // State 19 default action
+    { 19, -1, PA_REDUCE, 7 },
+    // State 20
+    { 20, 59, PA_REDUCE, 5 },
+    // State 20 default action
+    { 20, -1, PA_REDUCE, 5 },
+    // State 21
+    { 21, 1, PA_SHIFT, 38 },
+    // State 21
+    { 21, 26, PA_SHIFT, 22 },
+    // State 21
+    { 21, 59, PA_REDUCE, 21 },
+    // State 21 default action
+    { 21, -1, PA_REDUCE, 21 },
+    // State 22
+    { 22, 2, PA_SHIFT, 37 },
+    // State 22
+    { 22, 27, PA_SHIFT, 23 },
+    // State 22
+    { 22, 59, PA_REDUCE, 23 },
+    // State 22 default action
+    { 22, -1, PA_REDUCE, 23 },
+    // State 23
+    { 23, 3, PA_SHIFT, 36 },
+    // State 23
+    { 23, 28, PA_SHIFT, 24 },
+    // State 23
+    { 23, 59, PA_REDUCE, 25 },
+    // State 23 default action
+    { 23, -1, PA_REDUCE, 25 },
+    // State 24
+    { 24, 4, PA_SHIFT, 35 },
+    // State 24
+    { 24, 29, PA_SHIFT, 25 },
+    // State 24
+    { 24, 59, PA_REDUCE, 27 },
+    // State 24 default action
+    { 24, -1, PA_REDUCE, 27 },
+    // State 25
+    { 25, 5, PA_SHIFT, 34 },
+    // State 25
+    { 25, 30, PA_SHIFT, 26 },
+    // State 25
+    { 25, 59, PA_REDUCE, 29 },
+    // State 25 default action
+    { 25, -1, PA_REDUCE, 29 },
+    // State 26
+    { 26, 6, PA_SHIFT, 33 },
+    // State 26
+    { 26, 31, PA_SHIFT, 27 },
+    // State 26
+    { 26, 59, PA_REDUCE, 31 },
+    // State 26 default action
+    { 26, -1, PA_REDUCE, 31 },
+    // State 27
+    { 27, 7, PA_SHIFT, 32 },
+    // State 27
+    { 27, 32, PA_SHIFT, 28 },
+    // State 27
+    { 27, 59, PA_REDUCE, 33 },
+    // State 27 default action
+    { 27, -1, PA_REDUCE, 33 },
+    // State 28
+    { 28, 8, PA_SHIFT, 31 },
+    // State 28
+    { 28, 14, PA_REDUCE, 35 },
+    // State 28
+    { 28, 33, PA_SHIFT, 29 },
+    // State 29
+    { 29, 14, PA_SHIFT, 30 },
+    // State 30
+    { 30, 59, PA_REDUCE, 20 },
+    // State 30 default action
+    { 30, -1, PA_REDUCE, 20 },
+    // State 31
+    { 31, 14, PA_REDUCE, 36 },
+    // State 32
+    { 32, 59, PA_REDUCE, 34 },
+    // State 32 default action
+    { 32, -1, PA_REDUCE, 34 },
+    // State 33
+    { 33, 59, PA_REDUCE, 32 },
+    // State 33 default action
+    { 33, -1, PA_REDUCE, 32 },
+    // State 34
+    { 34, 59, PA_REDUCE, 30 },
+    // State 34 default action
+    { 34, -1, PA_REDUCE, 30 },
+    // State 35
+    { 35, 59, PA_REDUCE, 28 },
+    // State 35 default action
+    { 35, -1, PA_REDUCE, 28 },
+    // State 36
+    { 36, 59, PA_REDUCE, 26 },
+    // State 36 default action
+    { 36, -1, PA_REDUCE, 26 },
+    // State 37
+    { 37, 59, PA_REDUCE, 24 },
+    // State 37 default action
+    { 37, -1, PA_REDUCE, 24 },
+    // State 38
+    { 38, 59, PA_REDUCE, 22 },
+    // State 38 default action
+    { 38, -1, PA_REDUCE, 22 },
+    // State 39
+    { 39, 1, PA_SHIFT, 56 },
+    // State 39
+    { 39, 34, PA_SHIFT, 40 },
+    // State 39
+    { 39, 59, PA_REDUCE, 38 },
+    // State 39 default action
+    { 39, -1, PA_REDUCE, 38 },
+    // State 40
+    { 40, 2, PA_SHIFT, 55 },
+    // State 40
+    { 40, 35, PA_SHIFT, 41 },
+    // State 40
+    { 40, 59, PA_REDUCE, 40 },
+    // State 40 default action
+    { 40, -1, PA_REDUCE, 40 },
+    // State 41
+    { 41, 3, PA_SHIFT, 54 },
+    // State 41
+    { 41, 36, PA_SHIFT, 42 },
+    // State 41
+    { 41, 59, PA_REDUCE, 42 },
+    // State 41 default action
+    { 41, -1, PA_REDUCE, 42 },
+    // State 42
+    { 42, 4, PA_SHIFT, 53 },
+    // State 42
+    { 42, 37, PA_SHIFT, 43 },
+    // State 42
+    { 42, 59, PA_REDUCE, 44 },
+    // State 42 default action
+    { 42, -1, PA_REDUCE, 44 },
+    // State 43
+    { 43, 5, PA_SHIFT, 52 },
+    // State 43
+    { 43, 38, PA_SHIFT, 44 },
+    // State 43
+    { 43, 59, PA_REDUCE, 46 },
+    // State 43 default action
+    { 43, -1, PA_REDUCE, 46 },
+    // State 44
+    { 44, 6, PA_SHIFT, 51 },
+    // State 44
+    { 44, 39, PA_SHIFT, 45 },
+    // State 44
+    { 44, 59, PA_REDUCE, 48 },
+    // State 44 default action
+    { 44, -1, PA_REDUCE, 48 },
+    // State 45
+    { 45, 7, PA_SHIFT, 50 },
+    // State 45
+    { 45, 40, PA_SHIFT, 46 },
+    // State 45
+    { 45, 59, PA_REDUCE, 50 },
+    // State 45 default action
+    { 45, -1, PA_REDUCE, 50 },
+    // State 46
+    { 46, 8, PA_SHIFT, 49 },
+    // State 46
+    { 46, 14, PA_REDUCE, 52 },
+    // State 46
+    { 46, 41, PA_SHIFT, 47 },
+    // State 47
+    { 47, 14, PA_SHIFT, 48 },
+    // State 48
+    { 48, 59, PA_REDUCE, 37 },
+    // State 48 default action
+    { 48, -1, PA_REDUCE, 37 },
+    // State 49
+    { 49, 14, PA_REDUCE, 53 },
+    // State 50
+    { 50, 59, PA_REDUCE, 51 },
+    // State 50 default action
+    { 50, -1, PA_REDUCE, 51 },
+    // State 51
+    { 51, 59, PA_REDUCE, 49 },
+    // State 51 default action
+    { 51, -1, PA_REDUCE, 49 },
+    // State 52
+    { 52, 59, PA_REDUCE, 47 },
+    // State 52 default action
+    { 52, -1, PA_REDUCE, 47 },
+    // State 53
+    { 53, 59, PA_REDUCE, 45 },
+    // State 53 default action
+    { 53, -1, PA_REDUCE, 45 },
+    // State 54
+    { 54, 59, PA_REDUCE, 43 },
+    // State 54 default action
+    { 54, -1, PA_REDUCE, 43 },
+    // State 55
+    { 55, 59, PA_REDUCE, 41 },
+    // State 55 default action
+    { 55, -1, PA_REDUCE, 41 },
+    // State 56
+    { 56, 59, PA_REDUCE, 39 },
+    // State 56 default action
+    { 56, -1, PA_REDUCE, 39 },
+    // State 57
+    { 57, 1, PA_SHIFT, 74 },
+    // State 57
+    { 57, 42, PA_SHIFT, 58 },
+    // State 57
+    { 57, 59, PA_REDUCE, 55 },
+    // State 57 default action
+    { 57, -1, PA_REDUCE, 55 },
+    // State 58
+    { 58, 2, PA_SHIFT, 73 },
+    // State 58
+    { 58, 43, PA_SHIFT, 59 },
+    // State 58
+    { 58, 59, PA_REDUCE, 57 },
+    // State 58 default action
+    { 58, -1, PA_REDUCE, 57 },
+    // State 59
+    { 59, 3, PA_SHIFT, 72 },
+    // State 59
+    { 59, 44, PA_SHIFT, 60 },
+    // State 59
+    { 59, 59, PA_REDUCE, 59 },
+    // State 59 default action
+    { 59, -1, PA_REDUCE, 59 },
+    // State 60
+    { 60, 4, PA_SHIFT, 71 },
+    // State 60
+    { 60, 45, PA_SHIFT, 61 },
+    // State 60
+    { 60, 59, PA_REDUCE, 61 },
+    // State 60 default action
+    { 60, -1, PA_REDUCE, 61 },
+    // State 61
+    { 61, 5, PA_SHIFT, 70 },
+    // State 61
+    { 61, 46, PA_SHIFT, 62 },
+    // State 61
+    { 61, 59, PA_REDUCE, 63 },
+    // State 61 default action
+    { 61, -1, PA_REDUCE, 63 },
+    // State 62
+    { 62, 6, PA_SHIFT, 69 },
+    // State 62
+    { 62, 47, PA_SHIFT, 63 },
+    // State 62
+    { 62, 59, PA_REDUCE, 65 },
+    // State 62 default action
+    { 62, -1, PA_REDUCE, 65 },
+    // State 63
+    { 63, 7, PA_SHIFT, 68 },
+    // State 63
+    { 63, 48, PA_SHIFT, 64 },
+    // State 63
+    { 63, 59, PA_REDUCE, 67 },
+    // State 63 default action
+    { 63, -1, PA_REDUCE, 67 },
+    // State 64
+    { 64, 8, PA_SHIFT, 67 },
+    // State 64
+    { 64, 14, PA_REDUCE, 69 },
+    // State 64
+    { 64, 49, PA_SHIFT, 65 },
+    // State 65
+    { 65, 14, PA_SHIFT, 66 },
+    // State 66
+    { 66, 59, PA_REDUCE, 54 },
+    // State 66 default action
+    { 66, -1, PA_REDUCE, 54 },
+    // State 67
+    { 67, 14, PA_REDUCE, 70 },
+    // State 68
+    { 68, 59, PA_REDUCE, 68 },
+    // State 68 default action
+    { 68, -1, PA_REDUCE, 68 },
+    // State 69
+    { 69, 59, PA_REDUCE, 66 },
+    // State 69 default action
+    { 69, -1, PA_REDUCE, 66 },
+    // State 70
+    { 70, 59, PA_REDUCE, 64 },
+    // State 70 default action
+    { 70, -1, PA_REDUCE, 64 },
+    // State 71
+    { 71, 59, PA_REDUCE, 62 },
+    // State 71 default action
+    { 71, -1, PA_REDUCE, 62 },
+    // State 72
+    { 72, 59, PA_REDUCE, 60 },
+    // State 72 default action
+    { 72, -1, PA_REDUCE, 60 },
+    // State 73
+    { 73, 59, PA_REDUCE, 58 },
+    // State 73 default action
+    { 73, -1, PA_REDUCE, 58 },
+    // State 74
+    { 74, 59, PA_REDUCE, 56 },
+    // State 74 default action
+    { 74, -1, PA_REDUCE, 56 },
+    // State 75
+    { 75, 1, PA_SHIFT, 92 },
+    // State 75
+    { 75, 50, PA_SHIFT, 76 },
+    // State 75
+    { 75, 59, PA_REDUCE, 72 },
+    // State 75 default action
+    { 75, -1, PA_REDUCE, 72 },
+    // State 76
+    { 76, 2, PA_SHIFT, 91 },
+    // State 76
+    { 76, 51, PA_SHIFT, 77 },
+    // State 76
+    { 76, 59, PA_REDUCE, 74 },
+    // State 76 default action
+    { 76, -1, PA_REDUCE, 74 },
+    // State 77
+    { 77, 3, PA_SHIFT, 90 },
+    // State 77
+    { 77, 52, PA_SHIFT, 78 },
+    // State 77
+    { 77, 59, PA_REDUCE, 76 },
+    // State 77 default action
+    { 77, -1, PA_REDUCE, 76 },
+    // State 78
+    { 78, 4, PA_SHIFT, 89 },
+    // State 78
+    { 78, 53, PA_SHIFT, 79 },
+    // State 78
+    { 78, 59, PA_REDUCE, 78 },
+    // State 78 default action
+    { 78, -1, PA_REDUCE, 78 },
+    // State 79
+    { 79, 5, PA_SHIFT, 88 },
+    // State 79
+    { 79, 54, PA_SHIFT, 80 },
+    // State 79
+    { 79, 59, PA_REDUCE, 80 },
+    // State 79 default action
+    { 79, -1, PA_REDUCE, 80 },
+    // State 80
+    { 80, 6, PA_SHIFT, 87 },
+    // State 80
+    { 80, 55, PA_SHIFT, 81 },
+    // State 80
+    { 80, 59, PA_REDUCE, 82 },
+    // State 80 default action
+    { 80, -1, PA_REDUCE, 82 },
+    // State 81
+    { 81, 7, PA_SHIFT, 86 },
+    // State 81
+    { 81, 56, PA_SHIFT, 82 },
+    // State 81
+    { 81, 59, PA_REDUCE, 84 },
+    // State 81 default action
+    { 81, -1, PA_REDUCE, 84 },
+    // State 82
+    { 82, 8, PA_SHIFT, 85 },
+    // State 82
+    { 82, 14, PA_REDUCE, 86 },
+    // State 82
+    { 82, 57, PA_SHIFT, 83 },
+    // State 83
+    { 83, 14, PA_SHIFT, 84 },
+    // State 84
+    { 84, 59, PA_REDUCE, 71 },
+    // State 84 default action
+    { 84, -1, PA_REDUCE, 71 },
+    // State 85
+    { 85, 14, PA_REDUCE, 87 },
+    // State 86
+    { 86, 59, PA_REDUCE, 85 },
+    // State 86 default action
+    { 86, -1, PA_REDUCE, 85 },
+    // State 87
+    { 87, 59, PA_REDUCE, 83 },
+    // State 87 default action
+    { 87, -1, PA_REDUCE, 83 },
+    // State 88
+    { 88, 59, PA_REDUCE, 81 },
+    // State 88 default action
+    { 88, -1, PA_REDUCE, 81 },
+    // State 89
+    { 89, 59, PA_REDUCE, 79 },
+    // State 89 default action
+    { 89, -1, PA_REDUCE, 79 },
+    // State 90
+    { 90, 59, PA_REDUCE, 77 },
+    // State 90 default action
+    { 90, -1, PA_REDUCE, 77 },
+    // State 91
+    { 91, 59, PA_REDUCE, 75 },
+    // State 91 default action
+    { 91, -1, PA_REDUCE, 75 },
+    // State 92
+    { 92, 59, PA_REDUCE, 73 },
+    // State 92 default action
+    { 92, -1, PA_REDUCE, 73 },
+};
+
+
+static int theRuleTable[88][2] =
+{
+    // prog ::= blocks
+    { 58, 1 }, 
+    // blocks ::=
+    { 16, 0 }, 
+    // blocks ::= blocks block
+    { 16, 2 }, 
+    // block ::= B0 o0_0 o0_1 o0_2 o0_3 o0_4 o0_5 o0_6 o0_7 END
+    { 15, 10 }, 
+    // o0_0 ::=
+    { 18, 0 }, 
+    // o0_0 ::= A0
+    { 18, 1 }, 
+    // o0_1 ::=
+    { 19, 0 }, 
+    // o0_1 ::= A1
+    { 19, 1 }, 
+    // o0_2 ::=
+    { 20, 0 }, 
+    // o0_2 ::= A2
+    { 20, 1 }, 
+    // o0_3 ::=
+    { 21, 0 }, 
+    // o0_3 ::= A3
+    { 21, 1 }, 
+    // o0_4 ::=
+    { 22, 0 }, 
+    // o0_4 ::= A4
+    { 22, 1 }, 
+    // o0_5 ::=
+    { 23, 0 }, 
+    // o0_5 ::= A5
+    { 23, 1 }, 
+    // o0_6 ::=
+    { 24, 0 }, 
+    // o0_6 ::= A6
+    { 24, 1 }, 
+    // o0_7 ::=
+    { 25, 0 }, 
+    // o0_7 ::= A7
+    { 25, 1 }, 
+    // block ::= B1 o1_0 o1_1 o1_2 o1_3 o1_4 o1_5 o1_6 o1_7 END
+    { 15, 10 }, 
+    // o1_0 ::=
+    { 26, 0 }, 
+    // o1_0 ::= A0
+    { 26, 1 }, 
+    // o1_1 ::=
+    { 27, 0 }, 
+    // o1_1 ::= A1
+    { 27, 1 }, 
+    // o1_2 ::=
+    { 28, 0 }, 
+    // o1_2 ::= A2
+    { 28, 1 }, 
+    // o1_3 ::=
+    { 29, 0 }, 
+    // o1_3 ::= A3
+    { 29, 1 }, 
+    // o1_4 ::=
+    { 30, 0 }, 
+    // o1_4 ::= A4
+    { 30, 1 }, 
+    // o1_5 ::=
+    { 31, 0 }, 
+    // o1_5 ::= A5
+    { 31, 1 }, 
+    // o1_6 ::=
+    { 32, 0 }, 
+    // o1_6 ::= A6
+    { 32, 1 }, 
+    // o1_7 ::=
+    { 33, 0 }, 
+    // o1_7 ::= A7
+    { 33, 1 }, 
+    // block ::= B2 o2_0 o2_1 o2_2 o2_3 o2_4 o2_5 o2_6 o2_7 END
+    { 15, 10 }, 
+    // o2_0 ::=
+    { 34, 0 }, 
+    // o2_0 ::= A0
+    { 34, 1 }, 
+    // o2_1 ::=
+    { 35, 0 }, 
+    // o2_1 ::= A1
+    { 35, 1 }, 
+    // o2_2 ::=
+    { 36, 0 }, 
+    // o2_2 ::= A2
+    { 36, 1 }, 
+    // o2_3 ::=
+    { 37, 0 }, 
+    // o2_3 ::= A3
+    { 37, 1 }, 
+    // o2_4 ::=
+    { 38, 0 }, 
+    // o2_4 ::= A4
+    { 38, 1 }, 
+    // o2_5 ::=
+    { 39, 0 }, 
+    // o2_5 ::= A5
+    { 39, 1 }, 
+    // o2_6 ::=
+    { 40, 0 }, 
+    // o2_6 ::= A6
+    { 40, 1 }, 
+    // o2_7 ::=
+    { 41, 0 }, 
+    // o2_7 ::= A7
+    { 41, 1 }, 
+    // block ::= B3 o3_0 o3_1 o3_2 o3_3 o3_4 o3_5 o3_6 o3_7 END
+    { 15, 10 }, 
+    // o3_0 ::=
+    { 42, 0 }, 
+    // o3_0 ::= A0
+    { 42, 1 }, 
+    // o3_1 ::=
+    { 43, 0 }, 
+    // o3_1 ::= A1
+    { 43, 1 }, 
+    // o3_2 ::=
+    { 44, 0 }, 
+    // o3_2 ::= A2
+    { 44, 1 }, 
+    // o3_3 ::=
+    { 45, 0 }, 
+    // o3_3 ::= A3
+    { 45, 1 }, 
+    // o3_4 ::=
+    { 46, 0 }, 
+    // o3_4 ::= A4
+    { 46, 1 }, 
+    // o3_5 ::=
+    { 47, 0 }, 
+    // o3_5 ::= A5
+    { 47, 1 }, 
+    // o3_6 ::=
+    { 48, 0 }, 
+    // o3_6 ::= A6
+    { 48, 1 }, 
+    // o3_7 ::=
+    { 49, 0 }, 
+    // o3_7 ::= A7
+    { 49, 1 }, 
+    // block ::= B4 o4_0 o4_1 o4_2 o4_3 o4_4 o4_5 o4_6 o4_7 END
+    { 15, 10 }, 
+    // o4_0 ::=
+    { 50, 0 }, 
+    // o4_0 ::= A0
+    { 50, 1 }, 
+    // o4_1 ::=
+    { 51, 0 }, 
+    // o4_1 ::= A1
+    { 51, 1 }, 
+    // o4_2 ::=
+    { 52, 0 }, 
+    // o4_2 ::= A2
+    { 52, 1 }, 
+    // o4_3 ::=
+    { 53, 0 }, 
+    // o4_3 ::= A3
+    { 53, 1 }, 
+    // o4_4 ::=
+    { 54, 0 }, 
+    // o4_4 ::= A4
+    { 54, 1 }, 
+    // o4_5 ::=
+    { 55, 0 }, 
+    // o4_5 ::= A5
+    { 55, 1 }, 
+    // o4_6 ::=
+    { 56, 0 }, 
+    // o4_6 ::= A6
+    { 56, 1 }, 
+    // o4_7 ::=
+    { 57, 0 }, 
+    // o4_7 ::= A7
+    { 57, 1 }, 
+};
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::initTables( void )
+{
+    myStates.assign( 93, ActionMap() );
+    myStateDefaultActions.assign( 93, ActionEntry(PA_ERROR,-2) );
+    for ( int i = 0; i < 258; ++i )
+    {
+        if ( theStateTable[i][1] == -1 )
+            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+        else
+            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+    }
+
+
+    // Rule Table
+
+    myRules.reserve( 88 );
+    for ( int i = 0; i < 88; ++i )
+        myRules.push_back( RuleInfo( theRuleTable[i][0], theRuleTable[i][1] ) );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::syntaxError( Bench::Terminal tok, privBenchImpl::Value &data )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parseFailed( void )
+{
+}
@@ -0,0 +1,48 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        A0 = 1,
+        A1 = 2,
+        A2 = 3,
+        A3 = 4,
+        A4 = 5,
+        A5 = 6,
+        A6 = 7,
+        A7 = 8,
+        B0 = 9,
+        B1 = 10,
+        B2 = 11,
+        B3 = 12,
+        B4 = 13,
+        END = 14
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
@@ -0,0 +1,17187 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#include <utility>
+#include <stack>
+#include <map>
+#include <vector>
+#include <iostream>
+
+
+#include "nullable_1000.h"
+
+enum ParserAct
+{
+    PA_SHIFT,
+    PA_REDUCE,
+    PA_ERROR,
+    PA_ACCEPT,
+    PA_NOP
+};
+
+class privBenchImpl
+{
+public:
+
+    privBenchImpl( void );
+    ~privBenchImpl( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    struct Value
+    {
+        union
+        {
+            int tokenType;
+            int errorType;
+        };
+    };
+    // first is stack num, second is the symbol index
+    typedef std::pair<int,int> StackID;
+    typedef std::pair<StackID,Value> StackEntry;
+    typedef std::stack<StackEntry> ParseStack;
+
+    void shift( int newState, int symIdx, Value &data );
+    void reduce( int ruleNum );
+    void callDtor( int symIdx, Value &data );
+    void popStack( void );
+    ParserAct findParserAction( int &newVal, int tok );
+    void initTables( void );
+    void syntaxError( Bench::Terminal tok, Value &data );
+    void parseFailed( void );
+
+    ParseStack myStack;
+    int myErrCount;
+
+
+    typedef std::pair<ParserAct,int> ActionEntry;
+    typedef std::map<int,ActionEntry> ActionMap;
+    typedef std::vector<ActionMap> StateList;
+    typedef std::vector<ActionEntry> StateDefaultList;
+
+    StateList myStates;
+    StateDefaultList myStateDefaultActions;
+
+
+    // first is LHS, second is number of RHS
+    typedef std::pair<int,int> RuleInfo;
+    typedef std::vector<RuleInfo> RuleList;
+
+    RuleList myRules;
+};
+
+
+////////////////////////////////////////
+
+
+Bench::Bench( void )
+    : myImplementation( new privBenchImpl )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Bench::~Bench( void )
+{
+    delete myImplementation;
+}
+
+
+////////////////////////////////////////
+
+
+void Bench::parse( Bench::Terminal tok, int value )
+{
+    myImplementation->parse( tok, value );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parse( Bench::Terminal tok, int value )
+{
+    int actVal;
+    ParserAct action;
+    bool errHit = false;
+    bool eoInput = (tok == Bench::EOF );
+    bool done = false;
+
+    if ( myStack.empty() )
+    {
+        if ( eoInput )
+            return;
+
+        myErrCount = -1;
+    }
+
+    privBenchImpl::Value data;
+    data.tokenType = value;
+
+    do
+    {
+        action = findParserAction( actVal, tok );
+        if ( PA_SHIFT == action )
+        {
+            shift( actVal, tok, data );
+            --myErrCount;
+            if ( eoInput && ! myStack.empty() )
+                tok = Bench::EOF;
+            else
+                done = true;
+        }
+        else if ( PA_REDUCE == action )
+        {
+            reduce( actVal );
+        }
+        else if ( PA_ERROR == action )
+        {
+            // Syntax error handling:
+            // 1. Call the %syntax_error function.
+            // 2. Pop stack until a state where we can shift the err symbol.
+            // 3. Shift the error symbol.
+            // 4. Set error count to three.
+            // 5. Begin accepting and shifting new tokens.
+            // 6. No new error processing will begin until 3 tokens are successful.
+            if ( myErrCount < 0 )
+            {
+                syntaxError( tok, data );
+            }
+            if ( myStack.top().first.first == 70 || errHit )
+            {
+                callDtor( static_cast<int>(tok), data );
+                done = true;
+            }
+            else
+            {
+                while ( ! myStack.empty() &&
+                        myStack.top().first.first != 70 )
+                {
+                    action = findParserAction( actVal, 70 );
+                    if ( action == PA_SHIFT )
+                        break;
+                    popStack();
+                }
+                if ( myStack.empty() || tok == Bench::EOF )
+                {
+                    callDtor( static_cast<int>(tok), data );
+                    parseFailed();
+                    done = true;
+                }
+                else if ( myStack.top().first.first != 70 )
+                {
+                    data.errorType = 0;
+                    shift( actVal, 70, data );
+                }
+            }
+            myErrCount = 3;
+            errHit = true;
+        }
+        else // ACCEPT == action || NOP == action
+        {
+            done = true;
+        }
+    } while ( ! done && ! myStack.empty() );
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::privBenchImpl( void )
+    : myErrCount( -1 )
+{
+    initTables();
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::~privBenchImpl( void )
+{
+    while ( ! myStack.empty() )
+        popStack();
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::shift( int newState, int symIdx, privBenchImpl::Value &data )
+{
+    StackEntry newItem = StackEntry( StackID( newState, symIdx ), data );
+    myStack.push( newItem );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::reduce( int ruleNum )
+{
+    int newVal;
+    ParserAct next;
+    privBenchImpl::Value data = { 0 };
+    std::vector<privBenchImpl::Value> rhsData;
+    for ( int i = 0, N = myRules[ruleNum].second; i != N; ++i )
+    {
+        if ( myStack.empty() )
+            rhsData.insert( rhsData.begin(), data );
+        else
+        {
+            rhsData.insert( rhsData.begin(), myStack.top().second );
+            myStack.pop();
+        }
+    }
+
+    next = findParserAction( newVal, myRules[ruleNum].first );
+
+    switch ( ruleNum )
+    {
+        case 0:
+        {
+            // prog ::= blocks
+#line 0 "bench/work/nullable_1000.lem"
+#line 250 "bench/work/nullable_1000.cpp"
+            callDtor( 69, rhsData[0] );
+            break;
+        }
+
+        case 1:
+        {
+            // blocks ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 259 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 2:
+        {
+            // blocks ::= blocks block
+#line 0 "bench/work/nullable_1000.lem"
+#line 267 "bench/work/nullable_1000.cpp"
+            callDtor( 69, rhsData[0] );
+            callDtor( 68, rhsData[1] );
+            break;
+        }
+
+        case 3:
+        {
+            // block ::= B0 o0_0 o0_1 o0_2 o0_3 o0_4 o0_5 o0_6 o0_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 277 "bench/work/nullable_1000.cpp"
+            callDtor( 9, rhsData[0] );
+            callDtor( 71, rhsData[1] );
+            callDtor( 72, rhsData[2] );
+            callDtor( 73, rhsData[3] );
+            callDtor( 74, rhsData[4] );
+            callDtor( 75, rhsData[5] );
+            callDtor( 76, rhsData[6] );
+            callDtor( 77, rhsData[7] );
+            callDtor( 78, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 4:
+        {
+            // o0_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 295 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 5:
+        {
+            // o0_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 303 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 6:
+        {
+            // o0_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 312 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 7:
+        {
+            // o0_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 320 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 8:
+        {
+            // o0_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 329 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 9:
+        {
+            // o0_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 337 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 10:
+        {
+            // o0_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 346 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 11:
+        {
+            // o0_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 354 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 12:
+        {
+            // o0_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 363 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 13:
+        {
+            // o0_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 371 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 14:
+        {
+            // o0_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 380 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 15:
+        {
+            // o0_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 388 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 16:
+        {
+            // o0_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 397 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 17:
+        {
+            // o0_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 405 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 18:
+        {
+            // o0_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 414 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 19:
+        {
+            // o0_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 422 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 20:
+        {
+            // block ::= B1 o1_0 o1_1 o1_2 o1_3 o1_4 o1_5 o1_6 o1_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 431 "bench/work/nullable_1000.cpp"
+            callDtor( 10, rhsData[0] );
+            callDtor( 159, rhsData[1] );
+            callDtor( 160, rhsData[2] );
+            callDtor( 161, rhsData[3] );
+            callDtor( 162, rhsData[4] );
+            callDtor( 163, rhsData[5] );
+            callDtor( 164, rhsData[6] );
+            callDtor( 165, rhsData[7] );
+            callDtor( 166, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 21:
+        {
+            // o1_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 449 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 22:
+        {
+            // o1_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 457 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 23:
+        {
+            // o1_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 466 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 24:
+        {
+            // o1_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 474 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 25:
+        {
+            // o1_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 483 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 26:
+        {
+            // o1_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 491 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 27:
+        {
+            // o1_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 500 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 28:
+        {
+            // o1_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 508 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 29:
+        {
+            // o1_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 517 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 30:
+        {
+            // o1_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 525 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 31:
+        {
+            // o1_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 534 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 32:
+        {
+            // o1_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 542 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 33:
+        {
+            // o1_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 551 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 34:
+        {
+            // o1_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 559 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 35:
+        {
+            // o1_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 568 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 36:
+        {
+            // o1_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 576 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 37:
+        {
+            // block ::= B2 o2_0 o2_1 o2_2 o2_3 o2_4 o2_5 o2_6 o2_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 585 "bench/work/nullable_1000.cpp"
+            callDtor( 21, rhsData[0] );
+            callDtor( 247, rhsData[1] );
+            callDtor( 248, rhsData[2] );
+            callDtor( 249, rhsData[3] );
+            callDtor( 250, rhsData[4] );
+            callDtor( 251, rhsData[5] );
+            callDtor( 252, rhsData[6] );
+            callDtor( 253, rhsData[7] );
+            callDtor( 254, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 38:
+        {
+            // o2_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 603 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 39:
+        {
+            // o2_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 611 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 40:
+        {
+            // o2_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 620 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 41:
+        {
+            // o2_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 628 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 42:
+        {
+            // o2_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 637 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 43:
+        {
+            // o2_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 645 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 44:
+        {
+            // o2_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 654 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 45:
+        {
+            // o2_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 662 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 46:
+        {
+            // o2_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 671 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 47:
+        {
+            // o2_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 679 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 48:
+        {
+            // o2_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 688 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 49:
+        {
+            // o2_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 696 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 50:
+        {
+            // o2_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 705 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 51:
+        {
+            // o2_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 713 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 52:
+        {
+            // o2_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 722 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 53:
+        {
+            // o2_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 730 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 54:
+        {
+            // block ::= B3 o3_0 o3_1 o3_2 o3_3 o3_4 o3_5 o3_6 o3_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 739 "bench/work/nullable_1000.cpp"
+            callDtor( 32, rhsData[0] );
+            callDtor( 335, rhsData[1] );
+            callDtor( 336, rhsData[2] );
+            callDtor( 337, rhsData[3] );
+            callDtor( 338, rhsData[4] );
+            callDtor( 339, rhsData[5] );
+            callDtor( 340, rhsData[6] );
+            callDtor( 341, rhsData[7] );
+            callDtor( 342, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 55:
+        {
+            // o3_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 757 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 56:
+        {
+            // o3_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 765 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 57:
+        {
+            // o3_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 774 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 58:
+        {
+            // o3_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 782 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 59:
+        {
+            // o3_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 791 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 60:
+        {
+            // o3_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 799 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 61:
+        {
+            // o3_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 808 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 62:
+        {
+            // o3_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 816 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 63:
+        {
+            // o3_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 825 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 64:
+        {
+            // o3_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 833 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 65:
+        {
+            // o3_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 842 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 66:
+        {
+            // o3_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 850 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 67:
+        {
+            // o3_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 859 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 68:
+        {
+            // o3_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 867 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 69:
+        {
+            // o3_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 876 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 70:
+        {
+            // o3_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 884 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 71:
+        {
+            // block ::= B4 o4_0 o4_1 o4_2 o4_3 o4_4 o4_5 o4_6 o4_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 893 "bench/work/nullable_1000.cpp"
+            callDtor( 43, rhsData[0] );
+            callDtor( 423, rhsData[1] );
+            callDtor( 424, rhsData[2] );
+            callDtor( 425, rhsData[3] );
+            callDtor( 426, rhsData[4] );
+            callDtor( 427, rhsData[5] );
+            callDtor( 428, rhsData[6] );
+            callDtor( 429, rhsData[7] );
+            callDtor( 430, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 72:
+        {
+            // o4_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 911 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 73:
+        {
+            // o4_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 919 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 74:
+        {
+            // o4_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 928 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 75:
+        {
+            // o4_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 936 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 76:
+        {
+            // o4_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 945 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 77:
+        {
+            // o4_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 953 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 78:
+        {
+            // o4_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 962 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 79:
+        {
+            // o4_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 970 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 80:
+        {
+            // o4_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 979 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 81:
+        {
+            // o4_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 987 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 82:
+        {
+            // o4_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 996 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 83:
+        {
+            // o4_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 1004 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 84:
+        {
+            // o4_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1013 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 85:
+        {
+            // o4_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 1021 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 86:
+        {
+            // o4_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1030 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 87:
+        {
+            // o4_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 1038 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 88:
+        {
+            // block ::= B5 o5_0 o5_1 o5_2 o5_3 o5_4 o5_5 o5_6 o5_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 1047 "bench/work/nullable_1000.cpp"
+            callDtor( 54, rhsData[0] );
+            callDtor( 495, rhsData[1] );
+            callDtor( 496, rhsData[2] );
+            callDtor( 497, rhsData[3] );
+            callDtor( 498, rhsData[4] );
+            callDtor( 499, rhsData[5] );
+            callDtor( 500, rhsData[6] );
+            callDtor( 501, rhsData[7] );
+            callDtor( 502, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 89:
+        {
+            // o5_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1065 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 90:
+        {
+            // o5_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 1073 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 91:
+        {
+            // o5_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1082 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 92:
+        {
+            // o5_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 1090 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 93:
+        {
+            // o5_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1099 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 94:
+        {
+            // o5_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 1107 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 95:
+        {
+            // o5_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1116 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 96:
+        {
+            // o5_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 1124 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 97:
+        {
+            // o5_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1133 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 98:
+        {
+            // o5_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 1141 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 99:
+        {
+            // o5_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1150 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 100:
+        {
+            // o5_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 1158 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 101:
+        {
+            // o5_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1167 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 102:
+        {
+            // o5_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 1175 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 103:
+        {
+            // o5_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1184 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 104:
+        {
+            // o5_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 1192 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 105:
+        {
+            // block ::= B6 o6_0 o6_1 o6_2 o6_3 o6_4 o6_5 o6_6 o6_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 1201 "bench/work/nullable_1000.cpp"
+            callDtor( 63, rhsData[0] );
+            callDtor( 503, rhsData[1] );
+            callDtor( 504, rhsData[2] );
+            callDtor( 505, rhsData[3] );
+            callDtor( 506, rhsData[4] );
+            callDtor( 507, rhsData[5] );
+            callDtor( 508, rhsData[6] );
+            callDtor( 509, rhsData[7] );
+            callDtor( 510, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 106:
+        {
+            // o6_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1219 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 107:
+        {
+            // o6_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 1227 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 108:
+        {
+            // o6_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1236 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 109:
+        {
+            // o6_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 1244 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 110:
+        {
+            // o6_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1253 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 111:
+        {
+            // o6_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 1261 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 112:
+        {
+            // o6_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1270 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 113:
+        {
+            // o6_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 1278 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 114:
+        {
+            // o6_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1287 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 115:
+        {
+            // o6_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 1295 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 116:
+        {
+            // o6_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1304 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 117:
+        {
+            // o6_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 1312 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 118:
+        {
+            // o6_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1321 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 119:
+        {
+            // o6_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 1329 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 120:
+        {
+            // o6_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1338 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 121:
+        {
+            // o6_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 1346 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 122:
+        {
+            // block ::= B7 o7_0 o7_1 o7_2 o7_3 o7_4 o7_5 o7_6 o7_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 1355 "bench/work/nullable_1000.cpp"
+            callDtor( 64, rhsData[0] );
+            callDtor( 511, rhsData[1] );
+            callDtor( 512, rhsData[2] );
+            callDtor( 513, rhsData[3] );
+            callDtor( 514, rhsData[4] );
+            callDtor( 515, rhsData[5] );
+            callDtor( 516, rhsData[6] );
+            callDtor( 517, rhsData[7] );
+            callDtor( 518, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 123:
+        {
+            // o7_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1373 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 124:
+        {
+            // o7_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 1381 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 125:
+        {
+            // o7_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1390 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 126:
+        {
+            // o7_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 1398 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 127:
+        {
+            // o7_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1407 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 128:
+        {
+            // o7_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 1415 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 129:
+        {
+            // o7_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1424 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 130:
+        {
+            // o7_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 1432 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 131:
+        {
+            // o7_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1441 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 132:
+        {
+            // o7_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 1449 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 133:
+        {
+            // o7_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1458 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 134:
+        {
+            // o7_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 1466 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 135:
+        {
+            // o7_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1475 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 136:
+        {
+            // o7_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 1483 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 137:
+        {
+            // o7_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1492 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 138:
+        {
+            // o7_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 1500 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 139:
+        {
+            // block ::= B8 o8_0 o8_1 o8_2 o8_3 o8_4 o8_5 o8_6 o8_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 1509 "bench/work/nullable_1000.cpp"
+            callDtor( 65, rhsData[0] );
+            callDtor( 519, rhsData[1] );
+            callDtor( 520, rhsData[2] );
+            callDtor( 521, rhsData[3] );
+            callDtor( 522, rhsData[4] );
+            callDtor( 523, rhsData[5] );
+            callDtor( 524, rhsData[6] );
+            callDtor( 525, rhsData[7] );
+            callDtor( 526, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 140:
+        {
+            // o8_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1527 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 141:
+        {
+            // o8_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 1535 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 142:
+        {
+            // o8_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1544 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 143:
+        {
+            // o8_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 1552 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 144:
+        {
+            // o8_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1561 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 145:
+        {
+            // o8_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 1569 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 146:
+        {
+            // o8_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1578 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 147:
+        {
+            // o8_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 1586 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 148:
+        {
+            // o8_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1595 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 149:
+        {
+            // o8_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 1603 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 150:
+        {
+            // o8_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1612 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 151:
+        {
+            // o8_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 1620 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 152:
+        {
+            // o8_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1629 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 153:
+        {
+            // o8_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 1637 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 154:
+        {
+            // o8_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1646 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 155:
+        {
+            // o8_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 1654 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 156:
+        {
+            // block ::= B9 o9_0 o9_1 o9_2 o9_3 o9_4 o9_5 o9_6 o9_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 1663 "bench/work/nullable_1000.cpp"
+            callDtor( 66, rhsData[0] );
+            callDtor( 527, rhsData[1] );
+            callDtor( 528, rhsData[2] );
+            callDtor( 529, rhsData[3] );
+            callDtor( 530, rhsData[4] );
+            callDtor( 531, rhsData[5] );
+            callDtor( 532, rhsData[6] );
+            callDtor( 533, rhsData[7] );
+            callDtor( 534, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 157:
+        {
+            // o9_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1681 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 158:
+        {
+            // o9_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 1689 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 159:
+        {
+            // o9_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1698 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 160:
+        {
+            // o9_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 1706 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 161:
+        {
+            // o9_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1715 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 162:
+        {
+            // o9_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 1723 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 163:
+        {
+            // o9_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1732 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 164:
+        {
+            // o9_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 1740 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 165:
+        {
+            // o9_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1749 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 166:
+        {
+            // o9_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 1757 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 167:
+        {
+            // o9_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1766 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 168:
+        {
+            // o9_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 1774 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 169:
+        {
+            // o9_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1783 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 170:
+        {
+            // o9_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 1791 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 171:
+        {
+            // o9_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1800 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 172:
+        {
+            // o9_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 1808 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 173:
+        {
+            // block ::= B10 o10_0 o10_1 o10_2 o10_3 o10_4 o10_5 o10_6 o10_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 1817 "bench/work/nullable_1000.cpp"
+            callDtor( 11, rhsData[0] );
+            callDtor( 79, rhsData[1] );
+            callDtor( 80, rhsData[2] );
+            callDtor( 81, rhsData[3] );
+            callDtor( 82, rhsData[4] );
+            callDtor( 83, rhsData[5] );
+            callDtor( 84, rhsData[6] );
+            callDtor( 85, rhsData[7] );
+            callDtor( 86, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 174:
+        {
+            // o10_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1835 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 175:
+        {
+            // o10_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 1843 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 176:
+        {
+            // o10_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1852 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 177:
+        {
+            // o10_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 1860 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 178:
+        {
+            // o10_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1869 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 179:
+        {
+            // o10_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 1877 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 180:
+        {
+            // o10_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1886 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 181:
+        {
+            // o10_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 1894 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 182:
+        {
+            // o10_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1903 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 183:
+        {
+            // o10_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 1911 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 184:
+        {
+            // o10_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1920 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 185:
+        {
+            // o10_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 1928 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 186:
+        {
+            // o10_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1937 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 187:
+        {
+            // o10_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 1945 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 188:
+        {
+            // o10_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1954 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 189:
+        {
+            // o10_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 1962 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 190:
+        {
+            // block ::= B11 o11_0 o11_1 o11_2 o11_3 o11_4 o11_5 o11_6 o11_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 1971 "bench/work/nullable_1000.cpp"
+            callDtor( 12, rhsData[0] );
+            callDtor( 87, rhsData[1] );
+            callDtor( 88, rhsData[2] );
+            callDtor( 89, rhsData[3] );
+            callDtor( 90, rhsData[4] );
+            callDtor( 91, rhsData[5] );
+            callDtor( 92, rhsData[6] );
+            callDtor( 93, rhsData[7] );
+            callDtor( 94, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 191:
+        {
+            // o11_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 1989 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 192:
+        {
+            // o11_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 1997 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 193:
+        {
+            // o11_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2006 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 194:
+        {
+            // o11_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 2014 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 195:
+        {
+            // o11_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2023 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 196:
+        {
+            // o11_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 2031 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 197:
+        {
+            // o11_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2040 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 198:
+        {
+            // o11_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 2048 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 199:
+        {
+            // o11_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2057 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 200:
+        {
+            // o11_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 2065 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 201:
+        {
+            // o11_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2074 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 202:
+        {
+            // o11_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 2082 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 203:
+        {
+            // o11_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2091 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 204:
+        {
+            // o11_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 2099 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 205:
+        {
+            // o11_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2108 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 206:
+        {
+            // o11_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 2116 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 207:
+        {
+            // block ::= B12 o12_0 o12_1 o12_2 o12_3 o12_4 o12_5 o12_6 o12_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 2125 "bench/work/nullable_1000.cpp"
+            callDtor( 13, rhsData[0] );
+            callDtor( 95, rhsData[1] );
+            callDtor( 96, rhsData[2] );
+            callDtor( 97, rhsData[3] );
+            callDtor( 98, rhsData[4] );
+            callDtor( 99, rhsData[5] );
+            callDtor( 100, rhsData[6] );
+            callDtor( 101, rhsData[7] );
+            callDtor( 102, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 208:
+        {
+            // o12_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2143 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 209:
+        {
+            // o12_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 2151 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 210:
+        {
+            // o12_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2160 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 211:
+        {
+            // o12_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 2168 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 212:
+        {
+            // o12_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2177 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 213:
+        {
+            // o12_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 2185 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 214:
+        {
+            // o12_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2194 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 215:
+        {
+            // o12_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 2202 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 216:
+        {
+            // o12_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2211 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 217:
+        {
+            // o12_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 2219 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 218:
+        {
+            // o12_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2228 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 219:
+        {
+            // o12_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 2236 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 220:
+        {
+            // o12_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2245 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 221:
+        {
+            // o12_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 2253 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 222:
+        {
+            // o12_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2262 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 223:
+        {
+            // o12_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 2270 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 224:
+        {
+            // block ::= B13 o13_0 o13_1 o13_2 o13_3 o13_4 o13_5 o13_6 o13_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 2279 "bench/work/nullable_1000.cpp"
+            callDtor( 14, rhsData[0] );
+            callDtor( 103, rhsData[1] );
+            callDtor( 104, rhsData[2] );
+            callDtor( 105, rhsData[3] );
+            callDtor( 106, rhsData[4] );
+            callDtor( 107, rhsData[5] );
+            callDtor( 108, rhsData[6] );
+            callDtor( 109, rhsData[7] );
+            callDtor( 110, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 225:
+        {
+            // o13_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2297 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 226:
+        {
+            // o13_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 2305 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 227:
+        {
+            // o13_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2314 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 228:
+        {
+            // o13_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 2322 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 229:
+        {
+            // o13_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2331 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 230:
+        {
+            // o13_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 2339 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 231:
+        {
+            // o13_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2348 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 232:
+        {
+            // o13_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 2356 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 233:
+        {
+            // o13_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2365 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 234:
+        {
+            // o13_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 2373 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 235:
+        {
+            // o13_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2382 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 236:
+        {
+            // o13_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 2390 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 237:
+        {
+            // o13_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2399 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 238:
+        {
+            // o13_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 2407 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 239:
+        {
+            // o13_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2416 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 240:
+        {
+            // o13_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 2424 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 241:
+        {
+            // block ::= B14 o14_0 o14_1 o14_2 o14_3 o14_4 o14_5 o14_6 o14_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 2433 "bench/work/nullable_1000.cpp"
+            callDtor( 15, rhsData[0] );
+            callDtor( 111, rhsData[1] );
+            callDtor( 112, rhsData[2] );
+            callDtor( 113, rhsData[3] );
+            callDtor( 114, rhsData[4] );
+            callDtor( 115, rhsData[5] );
+            callDtor( 116, rhsData[6] );
+            callDtor( 117, rhsData[7] );
+            callDtor( 118, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 242:
+        {
+            // o14_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2451 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 243:
+        {
+            // o14_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 2459 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 244:
+        {
+            // o14_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2468 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 245:
+        {
+            // o14_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 2476 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 246:
+        {
+            // o14_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2485 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 247:
+        {
+            // o14_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 2493 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 248:
+        {
+            // o14_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2502 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 249:
+        {
+            // o14_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 2510 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 250:
+        {
+            // o14_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2519 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 251:
+        {
+            // o14_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 2527 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 252:
+        {
+            // o14_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2536 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 253:
+        {
+            // o14_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 2544 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 254:
+        {
+            // o14_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2553 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 255:
+        {
+            // o14_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 2561 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 256:
+        {
+            // o14_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2570 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 257:
+        {
+            // o14_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 2578 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 258:
+        {
+            // block ::= B15 o15_0 o15_1 o15_2 o15_3 o15_4 o15_5 o15_6 o15_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 2587 "bench/work/nullable_1000.cpp"
+            callDtor( 16, rhsData[0] );
+            callDtor( 119, rhsData[1] );
+            callDtor( 120, rhsData[2] );
+            callDtor( 121, rhsData[3] );
+            callDtor( 122, rhsData[4] );
+            callDtor( 123, rhsData[5] );
+            callDtor( 124, rhsData[6] );
+            callDtor( 125, rhsData[7] );
+            callDtor( 126, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 259:
+        {
+            // o15_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2605 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 260:
+        {
+            // o15_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 2613 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 261:
+        {
+            // o15_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2622 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 262:
+        {
+            // o15_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 2630 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 263:
+        {
+            // o15_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2639 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 264:
+        {
+            // o15_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 2647 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 265:
+        {
+            // o15_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2656 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 266:
+        {
+            // o15_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 2664 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 267:
+        {
+            // o15_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2673 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 268:
+        {
+            // o15_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 2681 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 269:
+        {
+            // o15_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2690 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 270:
+        {
+            // o15_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 2698 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 271:
+        {
+            // o15_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2707 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 272:
+        {
+            // o15_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 2715 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 273:
+        {
+            // o15_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2724 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 274:
+        {
+            // o15_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 2732 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 275:
+        {
+            // block ::= B16 o16_0 o16_1 o16_2 o16_3 o16_4 o16_5 o16_6 o16_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 2741 "bench/work/nullable_1000.cpp"
+            callDtor( 17, rhsData[0] );
+            callDtor( 127, rhsData[1] );
+            callDtor( 128, rhsData[2] );
+            callDtor( 129, rhsData[3] );
+            callDtor( 130, rhsData[4] );
+            callDtor( 131, rhsData[5] );
+            callDtor( 132, rhsData[6] );
+            callDtor( 133, rhsData[7] );
+            callDtor( 134, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 276:
+        {
+            // o16_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2759 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 277:
+        {
+            // o16_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 2767 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 278:
+        {
+            // o16_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2776 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 279:
+        {
+            // o16_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 2784 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 280:
+        {
+            // o16_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2793 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 281:
+        {
+            // o16_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 2801 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 282:
+        {
+            // o16_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2810 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 283:
+        {
+            // o16_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 2818 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 284:
+        {
+            // o16_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2827 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 285:
+        {
+            // o16_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 2835 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 286:
+        {
+            // o16_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2844 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 287:
+        {
+            // o16_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 2852 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 288:
+        {
+            // o16_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2861 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 289:
+        {
+            // o16_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 2869 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 290:
+        {
+            // o16_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2878 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 291:
+        {
+            // o16_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 2886 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 292:
+        {
+            // block ::= B17 o17_0 o17_1 o17_2 o17_3 o17_4 o17_5 o17_6 o17_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 2895 "bench/work/nullable_1000.cpp"
+            callDtor( 18, rhsData[0] );
+            callDtor( 135, rhsData[1] );
+            callDtor( 136, rhsData[2] );
+            callDtor( 137, rhsData[3] );
+            callDtor( 138, rhsData[4] );
+            callDtor( 139, rhsData[5] );
+            callDtor( 140, rhsData[6] );
+            callDtor( 141, rhsData[7] );
+            callDtor( 142, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 293:
+        {
+            // o17_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2913 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 294:
+        {
+            // o17_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 2921 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 295:
+        {
+            // o17_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2930 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 296:
+        {
+            // o17_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 2938 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 297:
+        {
+            // o17_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2947 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 298:
+        {
+            // o17_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 2955 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 299:
+        {
+            // o17_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2964 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 300:
+        {
+            // o17_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 2972 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 301:
+        {
+            // o17_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2981 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 302:
+        {
+            // o17_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 2989 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 303:
+        {
+            // o17_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 2998 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 304:
+        {
+            // o17_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 3006 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 305:
+        {
+            // o17_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3015 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 306:
+        {
+            // o17_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 3023 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 307:
+        {
+            // o17_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3032 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 308:
+        {
+            // o17_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 3040 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 309:
+        {
+            // block ::= B18 o18_0 o18_1 o18_2 o18_3 o18_4 o18_5 o18_6 o18_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 3049 "bench/work/nullable_1000.cpp"
+            callDtor( 19, rhsData[0] );
+            callDtor( 143, rhsData[1] );
+            callDtor( 144, rhsData[2] );
+            callDtor( 145, rhsData[3] );
+            callDtor( 146, rhsData[4] );
+            callDtor( 147, rhsData[5] );
+            callDtor( 148, rhsData[6] );
+            callDtor( 149, rhsData[7] );
+            callDtor( 150, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 310:
+        {
+            // o18_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3067 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 311:
+        {
+            // o18_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 3075 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 312:
+        {
+            // o18_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3084 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 313:
+        {
+            // o18_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 3092 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 314:
+        {
+            // o18_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3101 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 315:
+        {
+            // o18_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 3109 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 316:
+        {
+            // o18_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3118 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 317:
+        {
+            // o18_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 3126 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 318:
+        {
+            // o18_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3135 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 319:
+        {
+            // o18_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 3143 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 320:
+        {
+            // o18_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3152 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 321:
+        {
+            // o18_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 3160 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 322:
+        {
+            // o18_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3169 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 323:
+        {
+            // o18_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 3177 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 324:
+        {
+            // o18_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3186 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 325:
+        {
+            // o18_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 3194 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 326:
+        {
+            // block ::= B19 o19_0 o19_1 o19_2 o19_3 o19_4 o19_5 o19_6 o19_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 3203 "bench/work/nullable_1000.cpp"
+            callDtor( 20, rhsData[0] );
+            callDtor( 151, rhsData[1] );
+            callDtor( 152, rhsData[2] );
+            callDtor( 153, rhsData[3] );
+            callDtor( 154, rhsData[4] );
+            callDtor( 155, rhsData[5] );
+            callDtor( 156, rhsData[6] );
+            callDtor( 157, rhsData[7] );
+            callDtor( 158, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 327:
+        {
+            // o19_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3221 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 328:
+        {
+            // o19_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 3229 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 329:
+        {
+            // o19_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3238 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 330:
+        {
+            // o19_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 3246 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 331:
+        {
+            // o19_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3255 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 332:
+        {
+            // o19_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 3263 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 333:
+        {
+            // o19_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3272 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 334:
+        {
+            // o19_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 3280 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 335:
+        {
+            // o19_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3289 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 336:
+        {
+            // o19_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 3297 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 337:
+        {
+            // o19_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3306 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 338:
+        {
+            // o19_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 3314 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 339:
+        {
+            // o19_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3323 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 340:
+        {
+            // o19_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 3331 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 341:
+        {
+            // o19_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3340 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 342:
+        {
+            // o19_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 3348 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 343:
+        {
+            // block ::= B20 o20_0 o20_1 o20_2 o20_3 o20_4 o20_5 o20_6 o20_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 3357 "bench/work/nullable_1000.cpp"
+            callDtor( 22, rhsData[0] );
+            callDtor( 167, rhsData[1] );
+            callDtor( 168, rhsData[2] );
+            callDtor( 169, rhsData[3] );
+            callDtor( 170, rhsData[4] );
+            callDtor( 171, rhsData[5] );
+            callDtor( 172, rhsData[6] );
+            callDtor( 173, rhsData[7] );
+            callDtor( 174, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 344:
+        {
+            // o20_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3375 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 345:
+        {
+            // o20_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 3383 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 346:
+        {
+            // o20_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3392 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 347:
+        {
+            // o20_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 3400 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 348:
+        {
+            // o20_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3409 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 349:
+        {
+            // o20_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 3417 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 350:
+        {
+            // o20_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3426 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 351:
+        {
+            // o20_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 3434 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 352:
+        {
+            // o20_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3443 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 353:
+        {
+            // o20_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 3451 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 354:
+        {
+            // o20_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3460 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 355:
+        {
+            // o20_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 3468 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 356:
+        {
+            // o20_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3477 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 357:
+        {
+            // o20_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 3485 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 358:
+        {
+            // o20_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3494 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 359:
+        {
+            // o20_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 3502 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 360:
+        {
+            // block ::= B21 o21_0 o21_1 o21_2 o21_3 o21_4 o21_5 o21_6 o21_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 3511 "bench/work/nullable_1000.cpp"
+            callDtor( 23, rhsData[0] );
+            callDtor( 175, rhsData[1] );
+            callDtor( 176, rhsData[2] );
+            callDtor( 177, rhsData[3] );
+            callDtor( 178, rhsData[4] );
+            callDtor( 179, rhsData[5] );
+            callDtor( 180, rhsData[6] );
+            callDtor( 181, rhsData[7] );
+            callDtor( 182, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 361:
+        {
+            // o21_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3529 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 362:
+        {
+            // o21_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 3537 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 363:
+        {
+            // o21_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3546 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 364:
+        {
+            // o21_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 3554 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 365:
+        {
+            // o21_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3563 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 366:
+        {
+            // o21_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 3571 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 367:
+        {
+            // o21_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3580 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 368:
+        {
+            // o21_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 3588 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 369:
+        {
+            // o21_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3597 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 370:
+        {
+            // o21_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 3605 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 371:
+        {
+            // o21_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3614 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 372:
+        {
+            // o21_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 3622 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 373:
+        {
+            // o21_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3631 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 374:
+        {
+            // o21_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 3639 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 375:
+        {
+            // o21_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3648 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 376:
+        {
+            // o21_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 3656 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 377:
+        {
+            // block ::= B22 o22_0 o22_1 o22_2 o22_3 o22_4 o22_5 o22_6 o22_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 3665 "bench/work/nullable_1000.cpp"
+            callDtor( 24, rhsData[0] );
+            callDtor( 183, rhsData[1] );
+            callDtor( 184, rhsData[2] );
+            callDtor( 185, rhsData[3] );
+            callDtor( 186, rhsData[4] );
+            callDtor( 187, rhsData[5] );
+            callDtor( 188, rhsData[6] );
+            callDtor( 189, rhsData[7] );
+            callDtor( 190, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 378:
+        {
+            // o22_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3683 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 379:
+        {
+            // o22_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 3691 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 380:
+        {
+            // o22_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3700 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 381:
+        {
+            // o22_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 3708 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 382:
+        {
+            // o22_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3717 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 383:
+        {
+            // o22_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 3725 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 384:
+        {
+            // o22_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3734 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 385:
+        {
+            // o22_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 3742 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 386:
+        {
+            // o22_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3751 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 387:
+        {
+            // o22_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 3759 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 388:
+        {
+            // o22_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3768 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 389:
+        {
+            // o22_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 3776 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 390:
+        {
+            // o22_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3785 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 391:
+        {
+            // o22_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 3793 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 392:
+        {
+            // o22_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3802 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 393:
+        {
+            // o22_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 3810 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 394:
+        {
+            // block ::= B23 o23_0 o23_1 o23_2 o23_3 o23_4 o23_5 o23_6 o23_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 3819 "bench/work/nullable_1000.cpp"
+            callDtor( 25, rhsData[0] );
+            callDtor( 191, rhsData[1] );
+            callDtor( 192, rhsData[2] );
+            callDtor( 193, rhsData[3] );
+            callDtor( 194, rhsData[4] );
+            callDtor( 195, rhsData[5] );
+            callDtor( 196, rhsData[6] );
+            callDtor( 197, rhsData[7] );
+            callDtor( 198, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 395:
+        {
+            // o23_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3837 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 396:
+        {
+            // o23_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 3845 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 397:
+        {
+            // o23_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3854 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 398:
+        {
+            // o23_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 3862 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 399:
+        {
+            // o23_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3871 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 400:
+        {
+            // o23_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 3879 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 401:
+        {
+            // o23_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3888 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 402:
+        {
+            // o23_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 3896 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 403:
+        {
+            // o23_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3905 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 404:
+        {
+            // o23_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 3913 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 405:
+        {
+            // o23_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3922 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 406:
+        {
+            // o23_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 3930 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 407:
+        {
+            // o23_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3939 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 408:
+        {
+            // o23_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 3947 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 409:
+        {
+            // o23_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3956 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 410:
+        {
+            // o23_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 3964 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 411:
+        {
+            // block ::= B24 o24_0 o24_1 o24_2 o24_3 o24_4 o24_5 o24_6 o24_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 3973 "bench/work/nullable_1000.cpp"
+            callDtor( 26, rhsData[0] );
+            callDtor( 199, rhsData[1] );
+            callDtor( 200, rhsData[2] );
+            callDtor( 201, rhsData[3] );
+            callDtor( 202, rhsData[4] );
+            callDtor( 203, rhsData[5] );
+            callDtor( 204, rhsData[6] );
+            callDtor( 205, rhsData[7] );
+            callDtor( 206, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 412:
+        {
+            // o24_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 3991 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 413:
+        {
+            // o24_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 3999 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 414:
+        {
+            // o24_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4008 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 415:
+        {
+            // o24_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 4016 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 416:
+        {
+            // o24_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4025 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 417:
+        {
+            // o24_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 4033 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 418:
+        {
+            // o24_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4042 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 419:
+        {
+            // o24_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 4050 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 420:
+        {
+            // o24_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4059 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 421:
+        {
+            // o24_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 4067 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 422:
+        {
+            // o24_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4076 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 423:
+        {
+            // o24_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 4084 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 424:
+        {
+            // o24_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4093 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 425:
+        {
+            // o24_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 4101 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 426:
+        {
+            // o24_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4110 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 427:
+        {
+            // o24_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 4118 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 428:
+        {
+            // block ::= B25 o25_0 o25_1 o25_2 o25_3 o25_4 o25_5 o25_6 o25_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 4127 "bench/work/nullable_1000.cpp"
+            callDtor( 27, rhsData[0] );
+            callDtor( 207, rhsData[1] );
+            callDtor( 208, rhsData[2] );
+            callDtor( 209, rhsData[3] );
+            callDtor( 210, rhsData[4] );
+            callDtor( 211, rhsData[5] );
+            callDtor( 212, rhsData[6] );
+            callDtor( 213, rhsData[7] );
+            callDtor( 214, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 429:
+        {
+            // o25_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4145 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 430:
+        {
+            // o25_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 4153 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 431:
+        {
+            // o25_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4162 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 432:
+        {
+            // o25_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 4170 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 433:
+        {
+            // o25_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4179 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 434:
+        {
+            // o25_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 4187 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 435:
+        {
+            // o25_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4196 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 436:
+        {
+            // o25_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 4204 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 437:
+        {
+            // o25_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4213 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 438:
+        {
+            // o25_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 4221 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 439:
+        {
+            // o25_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4230 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 440:
+        {
+            // o25_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 4238 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 441:
+        {
+            // o25_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4247 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 442:
+        {
+            // o25_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 4255 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 443:
+        {
+            // o25_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4264 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 444:
+        {
+            // o25_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 4272 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 445:
+        {
+            // block ::= B26 o26_0 o26_1 o26_2 o26_3 o26_4 o26_5 o26_6 o26_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 4281 "bench/work/nullable_1000.cpp"
+            callDtor( 28, rhsData[0] );
+            callDtor( 215, rhsData[1] );
+            callDtor( 216, rhsData[2] );
+            callDtor( 217, rhsData[3] );
+            callDtor( 218, rhsData[4] );
+            callDtor( 219, rhsData[5] );
+            callDtor( 220, rhsData[6] );
+            callDtor( 221, rhsData[7] );
+            callDtor( 222, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 446:
+        {
+            // o26_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4299 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 447:
+        {
+            // o26_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 4307 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 448:
+        {
+            // o26_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4316 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 449:
+        {
+            // o26_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 4324 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 450:
+        {
+            // o26_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4333 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 451:
+        {
+            // o26_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 4341 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 452:
+        {
+            // o26_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4350 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 453:
+        {
+            // o26_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 4358 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 454:
+        {
+            // o26_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4367 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 455:
+        {
+            // o26_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 4375 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 456:
+        {
+            // o26_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4384 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 457:
+        {
+            // o26_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 4392 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 458:
+        {
+            // o26_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4401 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 459:
+        {
+            // o26_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 4409 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 460:
+        {
+            // o26_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4418 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 461:
+        {
+            // o26_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 4426 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 462:
+        {
+            // block ::= B27 o27_0 o27_1 o27_2 o27_3 o27_4 o27_5 o27_6 o27_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 4435 "bench/work/nullable_1000.cpp"
+            callDtor( 29, rhsData[0] );
+            callDtor( 223, rhsData[1] );
+            callDtor( 224, rhsData[2] );
+            callDtor( 225, rhsData[3] );
+            callDtor( 226, rhsData[4] );
+            callDtor( 227, rhsData[5] );
+            callDtor( 228, rhsData[6] );
+            callDtor( 229, rhsData[7] );
+            callDtor( 230, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 463:
+        {
+            // o27_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4453 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 464:
+        {
+            // o27_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 4461 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 465:
+        {
+            // o27_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4470 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 466:
+        {
+            // o27_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 4478 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 467:
+        {
+            // o27_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4487 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 468:
+        {
+            // o27_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 4495 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 469:
+        {
+            // o27_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4504 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 470:
+        {
+            // o27_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 4512 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 471:
+        {
+            // o27_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4521 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 472:
+        {
+            // o27_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 4529 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 473:
+        {
+            // o27_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4538 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 474:
+        {
+            // o27_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 4546 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 475:
+        {
+            // o27_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4555 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 476:
+        {
+            // o27_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 4563 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 477:
+        {
+            // o27_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4572 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 478:
+        {
+            // o27_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 4580 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 479:
+        {
+            // block ::= B28 o28_0 o28_1 o28_2 o28_3 o28_4 o28_5 o28_6 o28_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 4589 "bench/work/nullable_1000.cpp"
+            callDtor( 30, rhsData[0] );
+            callDtor( 231, rhsData[1] );
+            callDtor( 232, rhsData[2] );
+            callDtor( 233, rhsData[3] );
+            callDtor( 234, rhsData[4] );
+            callDtor( 235, rhsData[5] );
+            callDtor( 236, rhsData[6] );
+            callDtor( 237, rhsData[7] );
+            callDtor( 238, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 480:
+        {
+            // o28_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4607 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 481:
+        {
+            // o28_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 4615 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 482:
+        {
+            // o28_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4624 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 483:
+        {
+            // o28_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 4632 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 484:
+        {
+            // o28_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4641 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 485:
+        {
+            // o28_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 4649 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 486:
+        {
+            // o28_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4658 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 487:
+        {
+            // o28_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 4666 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 488:
+        {
+            // o28_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4675 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 489:
+        {
+            // o28_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 4683 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 490:
+        {
+            // o28_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4692 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 491:
+        {
+            // o28_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 4700 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 492:
+        {
+            // o28_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4709 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 493:
+        {
+            // o28_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 4717 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 494:
+        {
+            // o28_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4726 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 495:
+        {
+            // o28_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 4734 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 496:
+        {
+            // block ::= B29 o29_0 o29_1 o29_2 o29_3 o29_4 o29_5 o29_6 o29_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 4743 "bench/work/nullable_1000.cpp"
+            callDtor( 31, rhsData[0] );
+            callDtor( 239, rhsData[1] );
+            callDtor( 240, rhsData[2] );
+            callDtor( 241, rhsData[3] );
+            callDtor( 242, rhsData[4] );
+            callDtor( 243, rhsData[5] );
+            callDtor( 244, rhsData[6] );
+            callDtor( 245, rhsData[7] );
+            callDtor( 246, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 497:
+        {
+            // o29_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4761 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 498:
+        {
+            // o29_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 4769 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 499:
+        {
+            // o29_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4778 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 500:
+        {
+            // o29_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 4786 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 501:
+        {
+            // o29_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4795 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 502:
+        {
+            // o29_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 4803 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 503:
+        {
+            // o29_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4812 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 504:
+        {
+            // o29_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 4820 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 505:
+        {
+            // o29_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4829 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 506:
+        {
+            // o29_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 4837 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 507:
+        {
+            // o29_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4846 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 508:
+        {
+            // o29_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 4854 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 509:
+        {
+            // o29_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4863 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 510:
+        {
+            // o29_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 4871 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 511:
+        {
+            // o29_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4880 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 512:
+        {
+            // o29_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 4888 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 513:
+        {
+            // block ::= B30 o30_0 o30_1 o30_2 o30_3 o30_4 o30_5 o30_6 o30_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 4897 "bench/work/nullable_1000.cpp"
+            callDtor( 33, rhsData[0] );
+            callDtor( 255, rhsData[1] );
+            callDtor( 256, rhsData[2] );
+            callDtor( 257, rhsData[3] );
+            callDtor( 258, rhsData[4] );
+            callDtor( 259, rhsData[5] );
+            callDtor( 260, rhsData[6] );
+            callDtor( 261, rhsData[7] );
+            callDtor( 262, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 514:
+        {
+            // o30_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4915 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 515:
+        {
+            // o30_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 4923 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 516:
+        {
+            // o30_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4932 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 517:
+        {
+            // o30_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 4940 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 518:
+        {
+            // o30_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4949 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 519:
+        {
+            // o30_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 4957 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 520:
+        {
+            // o30_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4966 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 521:
+        {
+            // o30_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 4974 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 522:
+        {
+            // o30_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 4983 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 523:
+        {
+            // o30_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 4991 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 524:
+        {
+            // o30_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5000 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 525:
+        {
+            // o30_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 5008 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 526:
+        {
+            // o30_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5017 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 527:
+        {
+            // o30_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 5025 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 528:
+        {
+            // o30_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5034 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 529:
+        {
+            // o30_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 5042 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 530:
+        {
+            // block ::= B31 o31_0 o31_1 o31_2 o31_3 o31_4 o31_5 o31_6 o31_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 5051 "bench/work/nullable_1000.cpp"
+            callDtor( 34, rhsData[0] );
+            callDtor( 263, rhsData[1] );
+            callDtor( 264, rhsData[2] );
+            callDtor( 265, rhsData[3] );
+            callDtor( 266, rhsData[4] );
+            callDtor( 267, rhsData[5] );
+            callDtor( 268, rhsData[6] );
+            callDtor( 269, rhsData[7] );
+            callDtor( 270, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 531:
+        {
+            // o31_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5069 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 532:
+        {
+            // o31_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 5077 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 533:
+        {
+            // o31_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5086 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 534:
+        {
+            // o31_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 5094 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 535:
+        {
+            // o31_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5103 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 536:
+        {
+            // o31_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 5111 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 537:
+        {
+            // o31_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5120 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 538:
+        {
+            // o31_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 5128 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 539:
+        {
+            // o31_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5137 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 540:
+        {
+            // o31_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 5145 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 541:
+        {
+            // o31_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5154 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 542:
+        {
+            // o31_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 5162 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 543:
+        {
+            // o31_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5171 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 544:
+        {
+            // o31_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 5179 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 545:
+        {
+            // o31_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5188 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 546:
+        {
+            // o31_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 5196 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 547:
+        {
+            // block ::= B32 o32_0 o32_1 o32_2 o32_3 o32_4 o32_5 o32_6 o32_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 5205 "bench/work/nullable_1000.cpp"
+            callDtor( 35, rhsData[0] );
+            callDtor( 271, rhsData[1] );
+            callDtor( 272, rhsData[2] );
+            callDtor( 273, rhsData[3] );
+            callDtor( 274, rhsData[4] );
+            callDtor( 275, rhsData[5] );
+            callDtor( 276, rhsData[6] );
+            callDtor( 277, rhsData[7] );
+            callDtor( 278, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 548:
+        {
+            // o32_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5223 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 549:
+        {
+            // o32_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 5231 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 550:
+        {
+            // o32_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5240 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 551:
+        {
+            // o32_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 5248 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 552:
+        {
+            // o32_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5257 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 553:
+        {
+            // o32_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 5265 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 554:
+        {
+            // o32_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5274 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 555:
+        {
+            // o32_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 5282 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 556:
+        {
+            // o32_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5291 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 557:
+        {
+            // o32_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 5299 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 558:
+        {
+            // o32_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5308 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 559:
+        {
+            // o32_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 5316 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 560:
+        {
+            // o32_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5325 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 561:
+        {
+            // o32_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 5333 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 562:
+        {
+            // o32_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5342 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 563:
+        {
+            // o32_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 5350 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 564:
+        {
+            // block ::= B33 o33_0 o33_1 o33_2 o33_3 o33_4 o33_5 o33_6 o33_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 5359 "bench/work/nullable_1000.cpp"
+            callDtor( 36, rhsData[0] );
+            callDtor( 279, rhsData[1] );
+            callDtor( 280, rhsData[2] );
+            callDtor( 281, rhsData[3] );
+            callDtor( 282, rhsData[4] );
+            callDtor( 283, rhsData[5] );
+            callDtor( 284, rhsData[6] );
+            callDtor( 285, rhsData[7] );
+            callDtor( 286, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 565:
+        {
+            // o33_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5377 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 566:
+        {
+            // o33_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 5385 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 567:
+        {
+            // o33_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5394 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 568:
+        {
+            // o33_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 5402 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 569:
+        {
+            // o33_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5411 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 570:
+        {
+            // o33_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 5419 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 571:
+        {
+            // o33_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5428 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 572:
+        {
+            // o33_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 5436 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 573:
+        {
+            // o33_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5445 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 574:
+        {
+            // o33_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 5453 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 575:
+        {
+            // o33_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5462 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 576:
+        {
+            // o33_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 5470 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 577:
+        {
+            // o33_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5479 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 578:
+        {
+            // o33_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 5487 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 579:
+        {
+            // o33_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5496 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 580:
+        {
+            // o33_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 5504 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 581:
+        {
+            // block ::= B34 o34_0 o34_1 o34_2 o34_3 o34_4 o34_5 o34_6 o34_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 5513 "bench/work/nullable_1000.cpp"
+            callDtor( 37, rhsData[0] );
+            callDtor( 287, rhsData[1] );
+            callDtor( 288, rhsData[2] );
+            callDtor( 289, rhsData[3] );
+            callDtor( 290, rhsData[4] );
+            callDtor( 291, rhsData[5] );
+            callDtor( 292, rhsData[6] );
+            callDtor( 293, rhsData[7] );
+            callDtor( 294, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 582:
+        {
+            // o34_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5531 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 583:
+        {
+            // o34_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 5539 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 584:
+        {
+            // o34_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5548 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 585:
+        {
+            // o34_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 5556 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 586:
+        {
+            // o34_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5565 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 587:
+        {
+            // o34_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 5573 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 588:
+        {
+            // o34_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5582 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 589:
+        {
+            // o34_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 5590 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 590:
+        {
+            // o34_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5599 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 591:
+        {
+            // o34_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 5607 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 592:
+        {
+            // o34_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5616 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 593:
+        {
+            // o34_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 5624 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 594:
+        {
+            // o34_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5633 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 595:
+        {
+            // o34_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 5641 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 596:
+        {
+            // o34_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5650 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 597:
+        {
+            // o34_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 5658 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 598:
+        {
+            // block ::= B35 o35_0 o35_1 o35_2 o35_3 o35_4 o35_5 o35_6 o35_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 5667 "bench/work/nullable_1000.cpp"
+            callDtor( 38, rhsData[0] );
+            callDtor( 295, rhsData[1] );
+            callDtor( 296, rhsData[2] );
+            callDtor( 297, rhsData[3] );
+            callDtor( 298, rhsData[4] );
+            callDtor( 299, rhsData[5] );
+            callDtor( 300, rhsData[6] );
+            callDtor( 301, rhsData[7] );
+            callDtor( 302, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 599:
+        {
+            // o35_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5685 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 600:
+        {
+            // o35_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 5693 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 601:
+        {
+            // o35_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5702 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 602:
+        {
+            // o35_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 5710 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 603:
+        {
+            // o35_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5719 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 604:
+        {
+            // o35_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 5727 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 605:
+        {
+            // o35_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5736 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 606:
+        {
+            // o35_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 5744 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 607:
+        {
+            // o35_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5753 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 608:
+        {
+            // o35_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 5761 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 609:
+        {
+            // o35_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5770 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 610:
+        {
+            // o35_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 5778 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 611:
+        {
+            // o35_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5787 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 612:
+        {
+            // o35_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 5795 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 613:
+        {
+            // o35_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5804 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 614:
+        {
+            // o35_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 5812 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 615:
+        {
+            // block ::= B36 o36_0 o36_1 o36_2 o36_3 o36_4 o36_5 o36_6 o36_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 5821 "bench/work/nullable_1000.cpp"
+            callDtor( 39, rhsData[0] );
+            callDtor( 303, rhsData[1] );
+            callDtor( 304, rhsData[2] );
+            callDtor( 305, rhsData[3] );
+            callDtor( 306, rhsData[4] );
+            callDtor( 307, rhsData[5] );
+            callDtor( 308, rhsData[6] );
+            callDtor( 309, rhsData[7] );
+            callDtor( 310, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 616:
+        {
+            // o36_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5839 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 617:
+        {
+            // o36_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 5847 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 618:
+        {
+            // o36_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5856 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 619:
+        {
+            // o36_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 5864 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 620:
+        {
+            // o36_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5873 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 621:
+        {
+            // o36_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 5881 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 622:
+        {
+            // o36_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5890 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 623:
+        {
+            // o36_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 5898 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 624:
+        {
+            // o36_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5907 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 625:
+        {
+            // o36_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 5915 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 626:
+        {
+            // o36_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5924 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 627:
+        {
+            // o36_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 5932 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 628:
+        {
+            // o36_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5941 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 629:
+        {
+            // o36_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 5949 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 630:
+        {
+            // o36_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5958 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 631:
+        {
+            // o36_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 5966 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 632:
+        {
+            // block ::= B37 o37_0 o37_1 o37_2 o37_3 o37_4 o37_5 o37_6 o37_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 5975 "bench/work/nullable_1000.cpp"
+            callDtor( 40, rhsData[0] );
+            callDtor( 311, rhsData[1] );
+            callDtor( 312, rhsData[2] );
+            callDtor( 313, rhsData[3] );
+            callDtor( 314, rhsData[4] );
+            callDtor( 315, rhsData[5] );
+            callDtor( 316, rhsData[6] );
+            callDtor( 317, rhsData[7] );
+            callDtor( 318, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 633:
+        {
+            // o37_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 5993 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 634:
+        {
+            // o37_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 6001 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 635:
+        {
+            // o37_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6010 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 636:
+        {
+            // o37_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 6018 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 637:
+        {
+            // o37_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6027 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 638:
+        {
+            // o37_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 6035 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 639:
+        {
+            // o37_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6044 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 640:
+        {
+            // o37_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 6052 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 641:
+        {
+            // o37_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6061 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 642:
+        {
+            // o37_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 6069 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 643:
+        {
+            // o37_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6078 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 644:
+        {
+            // o37_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 6086 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 645:
+        {
+            // o37_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6095 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 646:
+        {
+            // o37_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 6103 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 647:
+        {
+            // o37_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6112 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 648:
+        {
+            // o37_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 6120 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 649:
+        {
+            // block ::= B38 o38_0 o38_1 o38_2 o38_3 o38_4 o38_5 o38_6 o38_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 6129 "bench/work/nullable_1000.cpp"
+            callDtor( 41, rhsData[0] );
+            callDtor( 319, rhsData[1] );
+            callDtor( 320, rhsData[2] );
+            callDtor( 321, rhsData[3] );
+            callDtor( 322, rhsData[4] );
+            callDtor( 323, rhsData[5] );
+            callDtor( 324, rhsData[6] );
+            callDtor( 325, rhsData[7] );
+            callDtor( 326, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 650:
+        {
+            // o38_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6147 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 651:
+        {
+            // o38_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 6155 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 652:
+        {
+            // o38_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6164 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 653:
+        {
+            // o38_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 6172 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 654:
+        {
+            // o38_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6181 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 655:
+        {
+            // o38_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 6189 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 656:
+        {
+            // o38_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6198 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 657:
+        {
+            // o38_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 6206 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 658:
+        {
+            // o38_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6215 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 659:
+        {
+            // o38_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 6223 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 660:
+        {
+            // o38_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6232 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 661:
+        {
+            // o38_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 6240 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 662:
+        {
+            // o38_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6249 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 663:
+        {
+            // o38_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 6257 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 664:
+        {
+            // o38_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6266 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 665:
+        {
+            // o38_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 6274 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 666:
+        {
+            // block ::= B39 o39_0 o39_1 o39_2 o39_3 o39_4 o39_5 o39_6 o39_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 6283 "bench/work/nullable_1000.cpp"
+            callDtor( 42, rhsData[0] );
+            callDtor( 327, rhsData[1] );
+            callDtor( 328, rhsData[2] );
+            callDtor( 329, rhsData[3] );
+            callDtor( 330, rhsData[4] );
+            callDtor( 331, rhsData[5] );
+            callDtor( 332, rhsData[6] );
+            callDtor( 333, rhsData[7] );
+            callDtor( 334, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 667:
+        {
+            // o39_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6301 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 668:
+        {
+            // o39_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 6309 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 669:
+        {
+            // o39_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6318 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 670:
+        {
+            // o39_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 6326 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 671:
+        {
+            // o39_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6335 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 672:
+        {
+            // o39_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 6343 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 673:
+        {
+            // o39_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6352 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 674:
+        {
+            // o39_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 6360 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 675:
+        {
+            // o39_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6369 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 676:
+        {
+            // o39_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 6377 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 677:
+        {
+            // o39_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6386 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 678:
+        {
+            // o39_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 6394 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 679:
+        {
+            // o39_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6403 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 680:
+        {
+            // o39_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 6411 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 681:
+        {
+            // o39_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6420 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 682:
+        {
+            // o39_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 6428 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 683:
+        {
+            // block ::= B40 o40_0 o40_1 o40_2 o40_3 o40_4 o40_5 o40_6 o40_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 6437 "bench/work/nullable_1000.cpp"
+            callDtor( 44, rhsData[0] );
+            callDtor( 343, rhsData[1] );
+            callDtor( 344, rhsData[2] );
+            callDtor( 345, rhsData[3] );
+            callDtor( 346, rhsData[4] );
+            callDtor( 347, rhsData[5] );
+            callDtor( 348, rhsData[6] );
+            callDtor( 349, rhsData[7] );
+            callDtor( 350, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 684:
+        {
+            // o40_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6455 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 685:
+        {
+            // o40_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 6463 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 686:
+        {
+            // o40_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6472 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 687:
+        {
+            // o40_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 6480 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 688:
+        {
+            // o40_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6489 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 689:
+        {
+            // o40_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 6497 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 690:
+        {
+            // o40_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6506 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 691:
+        {
+            // o40_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 6514 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 692:
+        {
+            // o40_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6523 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 693:
+        {
+            // o40_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 6531 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 694:
+        {
+            // o40_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6540 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 695:
+        {
+            // o40_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 6548 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 696:
+        {
+            // o40_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6557 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 697:
+        {
+            // o40_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 6565 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 698:
+        {
+            // o40_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6574 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 699:
+        {
+            // o40_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 6582 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 700:
+        {
+            // block ::= B41 o41_0 o41_1 o41_2 o41_3 o41_4 o41_5 o41_6 o41_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 6591 "bench/work/nullable_1000.cpp"
+            callDtor( 45, rhsData[0] );
+            callDtor( 351, rhsData[1] );
+            callDtor( 352, rhsData[2] );
+            callDtor( 353, rhsData[3] );
+            callDtor( 354, rhsData[4] );
+            callDtor( 355, rhsData[5] );
+            callDtor( 356, rhsData[6] );
+            callDtor( 357, rhsData[7] );
+            callDtor( 358, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 701:
+        {
+            // o41_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6609 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 702:
+        {
+            // o41_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 6617 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 703:
+        {
+            // o41_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6626 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 704:
+        {
+            // o41_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 6634 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 705:
+        {
+            // o41_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6643 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 706:
+        {
+            // o41_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 6651 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 707:
+        {
+            // o41_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6660 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 708:
+        {
+            // o41_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 6668 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 709:
+        {
+            // o41_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6677 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 710:
+        {
+            // o41_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 6685 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 711:
+        {
+            // o41_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6694 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 712:
+        {
+            // o41_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 6702 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 713:
+        {
+            // o41_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6711 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 714:
+        {
+            // o41_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 6719 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 715:
+        {
+            // o41_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6728 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 716:
+        {
+            // o41_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 6736 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 717:
+        {
+            // block ::= B42 o42_0 o42_1 o42_2 o42_3 o42_4 o42_5 o42_6 o42_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 6745 "bench/work/nullable_1000.cpp"
+            callDtor( 46, rhsData[0] );
+            callDtor( 359, rhsData[1] );
+            callDtor( 360, rhsData[2] );
+            callDtor( 361, rhsData[3] );
+            callDtor( 362, rhsData[4] );
+            callDtor( 363, rhsData[5] );
+            callDtor( 364, rhsData[6] );
+            callDtor( 365, rhsData[7] );
+            callDtor( 366, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 718:
+        {
+            // o42_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6763 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 719:
+        {
+            // o42_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 6771 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 720:
+        {
+            // o42_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6780 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 721:
+        {
+            // o42_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 6788 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 722:
+        {
+            // o42_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6797 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 723:
+        {
+            // o42_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 6805 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 724:
+        {
+            // o42_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6814 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 725:
+        {
+            // o42_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 6822 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 726:
+        {
+            // o42_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6831 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 727:
+        {
+            // o42_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 6839 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 728:
+        {
+            // o42_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6848 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 729:
+        {
+            // o42_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 6856 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 730:
+        {
+            // o42_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6865 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 731:
+        {
+            // o42_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 6873 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 732:
+        {
+            // o42_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6882 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 733:
+        {
+            // o42_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 6890 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 734:
+        {
+            // block ::= B43 o43_0 o43_1 o43_2 o43_3 o43_4 o43_5 o43_6 o43_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 6899 "bench/work/nullable_1000.cpp"
+            callDtor( 47, rhsData[0] );
+            callDtor( 367, rhsData[1] );
+            callDtor( 368, rhsData[2] );
+            callDtor( 369, rhsData[3] );
+            callDtor( 370, rhsData[4] );
+            callDtor( 371, rhsData[5] );
+            callDtor( 372, rhsData[6] );
+            callDtor( 373, rhsData[7] );
+            callDtor( 374, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 735:
+        {
+            // o43_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6917 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 736:
+        {
+            // o43_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 6925 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 737:
+        {
+            // o43_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6934 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 738:
+        {
+            // o43_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 6942 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 739:
+        {
+            // o43_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6951 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 740:
+        {
+            // o43_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 6959 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 741:
+        {
+            // o43_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6968 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 742:
+        {
+            // o43_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 6976 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 743:
+        {
+            // o43_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 6985 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 744:
+        {
+            // o43_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 6993 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 745:
+        {
+            // o43_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7002 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 746:
+        {
+            // o43_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 7010 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 747:
+        {
+            // o43_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7019 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 748:
+        {
+            // o43_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 7027 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 749:
+        {
+            // o43_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7036 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 750:
+        {
+            // o43_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 7044 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 751:
+        {
+            // block ::= B44 o44_0 o44_1 o44_2 o44_3 o44_4 o44_5 o44_6 o44_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 7053 "bench/work/nullable_1000.cpp"
+            callDtor( 48, rhsData[0] );
+            callDtor( 375, rhsData[1] );
+            callDtor( 376, rhsData[2] );
+            callDtor( 377, rhsData[3] );
+            callDtor( 378, rhsData[4] );
+            callDtor( 379, rhsData[5] );
+            callDtor( 380, rhsData[6] );
+            callDtor( 381, rhsData[7] );
+            callDtor( 382, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 752:
+        {
+            // o44_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7071 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 753:
+        {
+            // o44_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 7079 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 754:
+        {
+            // o44_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7088 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 755:
+        {
+            // o44_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 7096 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 756:
+        {
+            // o44_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7105 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 757:
+        {
+            // o44_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 7113 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 758:
+        {
+            // o44_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7122 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 759:
+        {
+            // o44_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 7130 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 760:
+        {
+            // o44_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7139 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 761:
+        {
+            // o44_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 7147 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 762:
+        {
+            // o44_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7156 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 763:
+        {
+            // o44_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 7164 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 764:
+        {
+            // o44_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7173 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 765:
+        {
+            // o44_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 7181 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 766:
+        {
+            // o44_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7190 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 767:
+        {
+            // o44_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 7198 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 768:
+        {
+            // block ::= B45 o45_0 o45_1 o45_2 o45_3 o45_4 o45_5 o45_6 o45_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 7207 "bench/work/nullable_1000.cpp"
+            callDtor( 49, rhsData[0] );
+            callDtor( 383, rhsData[1] );
+            callDtor( 384, rhsData[2] );
+            callDtor( 385, rhsData[3] );
+            callDtor( 386, rhsData[4] );
+            callDtor( 387, rhsData[5] );
+            callDtor( 388, rhsData[6] );
+            callDtor( 389, rhsData[7] );
+            callDtor( 390, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 769:
+        {
+            // o45_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7225 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 770:
+        {
+            // o45_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 7233 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 771:
+        {
+            // o45_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7242 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 772:
+        {
+            // o45_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 7250 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 773:
+        {
+            // o45_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7259 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 774:
+        {
+            // o45_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 7267 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 775:
+        {
+            // o45_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7276 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 776:
+        {
+            // o45_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 7284 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 777:
+        {
+            // o45_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7293 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 778:
+        {
+            // o45_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 7301 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 779:
+        {
+            // o45_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7310 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 780:
+        {
+            // o45_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 7318 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 781:
+        {
+            // o45_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7327 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 782:
+        {
+            // o45_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 7335 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 783:
+        {
+            // o45_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7344 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 784:
+        {
+            // o45_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 7352 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 785:
+        {
+            // block ::= B46 o46_0 o46_1 o46_2 o46_3 o46_4 o46_5 o46_6 o46_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 7361 "bench/work/nullable_1000.cpp"
+            callDtor( 50, rhsData[0] );
+            callDtor( 391, rhsData[1] );
+            callDtor( 392, rhsData[2] );
+            callDtor( 393, rhsData[3] );
+            callDtor( 394, rhsData[4] );
+            callDtor( 395, rhsData[5] );
+            callDtor( 396, rhsData[6] );
+            callDtor( 397, rhsData[7] );
+            callDtor( 398, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 786:
+        {
+            // o46_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7379 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 787:
+        {
+            // o46_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 7387 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 788:
+        {
+            // o46_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7396 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 789:
+        {
+            // o46_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 7404 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 790:
+        {
+            // o46_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7413 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 791:
+        {
+            // o46_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 7421 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 792:
+        {
+            // o46_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7430 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 793:
+        {
+            // o46_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 7438 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 794:
+        {
+            // o46_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7447 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 795:
+        {
+            // o46_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 7455 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 796:
+        {
+            // o46_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7464 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 797:
+        {
+            // o46_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 7472 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 798:
+        {
+            // o46_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7481 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 799:
+        {
+            // o46_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 7489 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 800:
+        {
+            // o46_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7498 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 801:
+        {
+            // o46_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 7506 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 802:
+        {
+            // block ::= B47 o47_0 o47_1 o47_2 o47_3 o47_4 o47_5 o47_6 o47_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 7515 "bench/work/nullable_1000.cpp"
+            callDtor( 51, rhsData[0] );
+            callDtor( 399, rhsData[1] );
+            callDtor( 400, rhsData[2] );
+            callDtor( 401, rhsData[3] );
+            callDtor( 402, rhsData[4] );
+            callDtor( 403, rhsData[5] );
+            callDtor( 404, rhsData[6] );
+            callDtor( 405, rhsData[7] );
+            callDtor( 406, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 803:
+        {
+            // o47_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7533 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 804:
+        {
+            // o47_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 7541 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 805:
+        {
+            // o47_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7550 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 806:
+        {
+            // o47_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 7558 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 807:
+        {
+            // o47_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7567 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 808:
+        {
+            // o47_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 7575 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 809:
+        {
+            // o47_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7584 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 810:
+        {
+            // o47_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 7592 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 811:
+        {
+            // o47_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7601 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 812:
+        {
+            // o47_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 7609 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 813:
+        {
+            // o47_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7618 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 814:
+        {
+            // o47_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 7626 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 815:
+        {
+            // o47_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7635 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 816:
+        {
+            // o47_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 7643 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 817:
+        {
+            // o47_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7652 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 818:
+        {
+            // o47_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 7660 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 819:
+        {
+            // block ::= B48 o48_0 o48_1 o48_2 o48_3 o48_4 o48_5 o48_6 o48_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 7669 "bench/work/nullable_1000.cpp"
+            callDtor( 52, rhsData[0] );
+            callDtor( 407, rhsData[1] );
+            callDtor( 408, rhsData[2] );
+            callDtor( 409, rhsData[3] );
+            callDtor( 410, rhsData[4] );
+            callDtor( 411, rhsData[5] );
+            callDtor( 412, rhsData[6] );
+            callDtor( 413, rhsData[7] );
+            callDtor( 414, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 820:
+        {
+            // o48_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7687 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 821:
+        {
+            // o48_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 7695 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 822:
+        {
+            // o48_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7704 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 823:
+        {
+            // o48_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 7712 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 824:
+        {
+            // o48_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7721 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 825:
+        {
+            // o48_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 7729 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 826:
+        {
+            // o48_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7738 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 827:
+        {
+            // o48_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 7746 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 828:
+        {
+            // o48_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7755 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 829:
+        {
+            // o48_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 7763 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 830:
+        {
+            // o48_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7772 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 831:
+        {
+            // o48_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 7780 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 832:
+        {
+            // o48_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7789 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 833:
+        {
+            // o48_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 7797 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 834:
+        {
+            // o48_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7806 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 835:
+        {
+            // o48_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 7814 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 836:
+        {
+            // block ::= B49 o49_0 o49_1 o49_2 o49_3 o49_4 o49_5 o49_6 o49_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 7823 "bench/work/nullable_1000.cpp"
+            callDtor( 53, rhsData[0] );
+            callDtor( 415, rhsData[1] );
+            callDtor( 416, rhsData[2] );
+            callDtor( 417, rhsData[3] );
+            callDtor( 418, rhsData[4] );
+            callDtor( 419, rhsData[5] );
+            callDtor( 420, rhsData[6] );
+            callDtor( 421, rhsData[7] );
+            callDtor( 422, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 837:
+        {
+            // o49_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7841 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 838:
+        {
+            // o49_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 7849 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 839:
+        {
+            // o49_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7858 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 840:
+        {
+            // o49_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 7866 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 841:
+        {
+            // o49_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7875 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 842:
+        {
+            // o49_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 7883 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 843:
+        {
+            // o49_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7892 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 844:
+        {
+            // o49_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 7900 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 845:
+        {
+            // o49_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7909 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 846:
+        {
+            // o49_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 7917 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 847:
+        {
+            // o49_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7926 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 848:
+        {
+            // o49_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 7934 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 849:
+        {
+            // o49_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7943 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 850:
+        {
+            // o49_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 7951 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 851:
+        {
+            // o49_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7960 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 852:
+        {
+            // o49_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 7968 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 853:
+        {
+            // block ::= B50 o50_0 o50_1 o50_2 o50_3 o50_4 o50_5 o50_6 o50_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 7977 "bench/work/nullable_1000.cpp"
+            callDtor( 55, rhsData[0] );
+            callDtor( 431, rhsData[1] );
+            callDtor( 432, rhsData[2] );
+            callDtor( 433, rhsData[3] );
+            callDtor( 434, rhsData[4] );
+            callDtor( 435, rhsData[5] );
+            callDtor( 436, rhsData[6] );
+            callDtor( 437, rhsData[7] );
+            callDtor( 438, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 854:
+        {
+            // o50_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 7995 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 855:
+        {
+            // o50_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 8003 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 856:
+        {
+            // o50_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8012 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 857:
+        {
+            // o50_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 8020 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 858:
+        {
+            // o50_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8029 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 859:
+        {
+            // o50_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 8037 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 860:
+        {
+            // o50_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8046 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 861:
+        {
+            // o50_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 8054 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 862:
+        {
+            // o50_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8063 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 863:
+        {
+            // o50_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 8071 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 864:
+        {
+            // o50_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8080 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 865:
+        {
+            // o50_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 8088 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 866:
+        {
+            // o50_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8097 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 867:
+        {
+            // o50_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 8105 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 868:
+        {
+            // o50_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8114 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 869:
+        {
+            // o50_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 8122 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 870:
+        {
+            // block ::= B51 o51_0 o51_1 o51_2 o51_3 o51_4 o51_5 o51_6 o51_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 8131 "bench/work/nullable_1000.cpp"
+            callDtor( 56, rhsData[0] );
+            callDtor( 439, rhsData[1] );
+            callDtor( 440, rhsData[2] );
+            callDtor( 441, rhsData[3] );
+            callDtor( 442, rhsData[4] );
+            callDtor( 443, rhsData[5] );
+            callDtor( 444, rhsData[6] );
+            callDtor( 445, rhsData[7] );
+            callDtor( 446, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 871:
+        {
+            // o51_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8149 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 872:
+        {
+            // o51_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 8157 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 873:
+        {
+            // o51_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8166 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 874:
+        {
+            // o51_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 8174 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 875:
+        {
+            // o51_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8183 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 876:
+        {
+            // o51_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 8191 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 877:
+        {
+            // o51_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8200 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 878:
+        {
+            // o51_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 8208 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 879:
+        {
+            // o51_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8217 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 880:
+        {
+            // o51_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 8225 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 881:
+        {
+            // o51_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8234 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 882:
+        {
+            // o51_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 8242 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 883:
+        {
+            // o51_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8251 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 884:
+        {
+            // o51_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 8259 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 885:
+        {
+            // o51_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8268 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 886:
+        {
+            // o51_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 8276 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 887:
+        {
+            // block ::= B52 o52_0 o52_1 o52_2 o52_3 o52_4 o52_5 o52_6 o52_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 8285 "bench/work/nullable_1000.cpp"
+            callDtor( 57, rhsData[0] );
+            callDtor( 447, rhsData[1] );
+            callDtor( 448, rhsData[2] );
+            callDtor( 449, rhsData[3] );
+            callDtor( 450, rhsData[4] );
+            callDtor( 451, rhsData[5] );
+            callDtor( 452, rhsData[6] );
+            callDtor( 453, rhsData[7] );
+            callDtor( 454, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 888:
+        {
+            // o52_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8303 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 889:
+        {
+            // o52_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 8311 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 890:
+        {
+            // o52_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8320 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 891:
+        {
+            // o52_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 8328 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 892:
+        {
+            // o52_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8337 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 893:
+        {
+            // o52_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 8345 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 894:
+        {
+            // o52_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8354 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 895:
+        {
+            // o52_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 8362 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 896:
+        {
+            // o52_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8371 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 897:
+        {
+            // o52_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 8379 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 898:
+        {
+            // o52_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8388 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 899:
+        {
+            // o52_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 8396 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 900:
+        {
+            // o52_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8405 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 901:
+        {
+            // o52_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 8413 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 902:
+        {
+            // o52_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8422 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 903:
+        {
+            // o52_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 8430 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 904:
+        {
+            // block ::= B53 o53_0 o53_1 o53_2 o53_3 o53_4 o53_5 o53_6 o53_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 8439 "bench/work/nullable_1000.cpp"
+            callDtor( 58, rhsData[0] );
+            callDtor( 455, rhsData[1] );
+            callDtor( 456, rhsData[2] );
+            callDtor( 457, rhsData[3] );
+            callDtor( 458, rhsData[4] );
+            callDtor( 459, rhsData[5] );
+            callDtor( 460, rhsData[6] );
+            callDtor( 461, rhsData[7] );
+            callDtor( 462, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 905:
+        {
+            // o53_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8457 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 906:
+        {
+            // o53_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 8465 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 907:
+        {
+            // o53_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8474 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 908:
+        {
+            // o53_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 8482 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 909:
+        {
+            // o53_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8491 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 910:
+        {
+            // o53_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 8499 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 911:
+        {
+            // o53_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8508 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 912:
+        {
+            // o53_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 8516 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 913:
+        {
+            // o53_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8525 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 914:
+        {
+            // o53_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 8533 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 915:
+        {
+            // o53_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8542 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 916:
+        {
+            // o53_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 8550 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 917:
+        {
+            // o53_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8559 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 918:
+        {
+            // o53_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 8567 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 919:
+        {
+            // o53_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8576 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 920:
+        {
+            // o53_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 8584 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 921:
+        {
+            // block ::= B54 o54_0 o54_1 o54_2 o54_3 o54_4 o54_5 o54_6 o54_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 8593 "bench/work/nullable_1000.cpp"
+            callDtor( 59, rhsData[0] );
+            callDtor( 463, rhsData[1] );
+            callDtor( 464, rhsData[2] );
+            callDtor( 465, rhsData[3] );
+            callDtor( 466, rhsData[4] );
+            callDtor( 467, rhsData[5] );
+            callDtor( 468, rhsData[6] );
+            callDtor( 469, rhsData[7] );
+            callDtor( 470, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 922:
+        {
+            // o54_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8611 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 923:
+        {
+            // o54_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 8619 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 924:
+        {
+            // o54_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8628 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 925:
+        {
+            // o54_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 8636 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 926:
+        {
+            // o54_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8645 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 927:
+        {
+            // o54_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 8653 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 928:
+        {
+            // o54_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8662 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 929:
+        {
+            // o54_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 8670 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 930:
+        {
+            // o54_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8679 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 931:
+        {
+            // o54_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 8687 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 932:
+        {
+            // o54_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8696 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 933:
+        {
+            // o54_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 8704 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 934:
+        {
+            // o54_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8713 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 935:
+        {
+            // o54_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 8721 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 936:
+        {
+            // o54_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8730 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 937:
+        {
+            // o54_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 8738 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 938:
+        {
+            // block ::= B55 o55_0 o55_1 o55_2 o55_3 o55_4 o55_5 o55_6 o55_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 8747 "bench/work/nullable_1000.cpp"
+            callDtor( 60, rhsData[0] );
+            callDtor( 471, rhsData[1] );
+            callDtor( 472, rhsData[2] );
+            callDtor( 473, rhsData[3] );
+            callDtor( 474, rhsData[4] );
+            callDtor( 475, rhsData[5] );
+            callDtor( 476, rhsData[6] );
+            callDtor( 477, rhsData[7] );
+            callDtor( 478, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 939:
+        {
+            // o55_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8765 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 940:
+        {
+            // o55_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 8773 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 941:
+        {
+            // o55_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8782 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 942:
+        {
+            // o55_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 8790 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 943:
+        {
+            // o55_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8799 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 944:
+        {
+            // o55_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 8807 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 945:
+        {
+            // o55_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8816 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 946:
+        {
+            // o55_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 8824 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 947:
+        {
+            // o55_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8833 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 948:
+        {
+            // o55_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 8841 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 949:
+        {
+            // o55_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8850 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 950:
+        {
+            // o55_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 8858 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 951:
+        {
+            // o55_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8867 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 952:
+        {
+            // o55_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 8875 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 953:
+        {
+            // o55_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8884 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 954:
+        {
+            // o55_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 8892 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 955:
+        {
+            // block ::= B56 o56_0 o56_1 o56_2 o56_3 o56_4 o56_5 o56_6 o56_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 8901 "bench/work/nullable_1000.cpp"
+            callDtor( 61, rhsData[0] );
+            callDtor( 479, rhsData[1] );
+            callDtor( 480, rhsData[2] );
+            callDtor( 481, rhsData[3] );
+            callDtor( 482, rhsData[4] );
+            callDtor( 483, rhsData[5] );
+            callDtor( 484, rhsData[6] );
+            callDtor( 485, rhsData[7] );
+            callDtor( 486, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 956:
+        {
+            // o56_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8919 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 957:
+        {
+            // o56_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 8927 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 958:
+        {
+            // o56_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8936 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 959:
+        {
+            // o56_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 8944 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 960:
+        {
+            // o56_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8953 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 961:
+        {
+            // o56_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 8961 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 962:
+        {
+            // o56_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8970 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 963:
+        {
+            // o56_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 8978 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 964:
+        {
+            // o56_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 8987 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 965:
+        {
+            // o56_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 8995 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 966:
+        {
+            // o56_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 9004 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 967:
+        {
+            // o56_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 9012 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 968:
+        {
+            // o56_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 9021 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 969:
+        {
+            // o56_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 9029 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 970:
+        {
+            // o56_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 9038 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 971:
+        {
+            // o56_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 9046 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        case 972:
+        {
+            // block ::= B57 o57_0 o57_1 o57_2 o57_3 o57_4 o57_5 o57_6 o57_7 END
+#line 0 "bench/work/nullable_1000.lem"
+#line 9055 "bench/work/nullable_1000.cpp"
+            callDtor( 62, rhsData[0] );
+            callDtor( 487, rhsData[1] );
+            callDtor( 488, rhsData[2] );
+            callDtor( 489, rhsData[3] );
+            callDtor( 490, rhsData[4] );
+            callDtor( 491, rhsData[5] );
+            callDtor( 492, rhsData[6] );
+            callDtor( 493, rhsData[7] );
+            callDtor( 494, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            break;
+        }
+
+        case 973:
+        {
+            // o57_0 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 9073 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 974:
+        {
+            // o57_0 ::= A0
+#line 0 "bench/work/nullable_1000.lem"
+#line 9081 "bench/work/nullable_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 975:
+        {
+            // o57_1 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 9090 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 976:
+        {
+            // o57_1 ::= A1
+#line 0 "bench/work/nullable_1000.lem"
+#line 9098 "bench/work/nullable_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            break;
+        }
+
+        case 977:
+        {
+            // o57_2 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 9107 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 978:
+        {
+            // o57_2 ::= A2
+#line 0 "bench/work/nullable_1000.lem"
+#line 9115 "bench/work/nullable_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            break;
+        }
+
+        case 979:
+        {
+            // o57_3 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 9124 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 980:
+        {
+            // o57_3 ::= A3
+#line 0 "bench/work/nullable_1000.lem"
+#line 9132 "bench/work/nullable_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            break;
+        }
+
+        case 981:
+        {
+            // o57_4 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 9141 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 982:
+        {
+            // o57_4 ::= A4
+#line 0 "bench/work/nullable_1000.lem"
+#line 9149 "bench/work/nullable_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            break;
+        }
+
+        case 983:
+        {
+            // o57_5 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 9158 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 984:
+        {
+            // o57_5 ::= A5
+#line 0 "bench/work/nullable_1000.lem"
+#line 9166 "bench/work/nullable_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            break;
+        }
+
+        case 985:
+        {
+            // o57_6 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 9175 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 986:
+        {
+            // o57_6 ::= A6
+#line 0 "bench/work/nullable_1000.lem"
+#line 9183 "bench/work/nullable_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 987:
+        {
+            // o57_7 ::=
+#line 0 "bench/work/nullable_1000.lem"
+#line 9192 "bench/work/nullable_1000.cpp"
+            break;
+        }
+
+        case 988:
+        {
+            // o57_7 ::= A7
+#line 0 "bench/work/nullable_1000.lem"
+#line 9200 "bench/work/nullable_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            break;
+        }
+
+        default:
+            throw "Unknown Rule Number";
+            break;
+    }
+
+    if ( PA_SHIFT == next )
+        shift( newVal, myRules[ruleNum].first, data );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::callDtor( int symIdx, privBenchImpl::Value &data )
+{
+    switch ( symIdx )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+        case 12:
+        case 13:
+        case 14:
+        case 15:
+        case 16:
+        case 17:
+        case 18:
+        case 19:
+        case 20:
+        case 21:
+        case 22:
+        case 23:
+        case 24:
+        case 25:
+        case 26:
+        case 27:
+        case 28:
+        case 29:
+        case 30:
+        case 31:
+        case 32:
+        case 33:
+        case 34:
+        case 35:
+        case 36:
+        case 37:
+        case 38:
+        case 39:
+        case 40:
+        case 41:
+        case 42:
+        case 43:
+        case 44:
+        case 45:
+        case 46:
+        case 47:
+        case 48:
+        case 49:
+        case 50:
+        case 51:
+        case 52:
+        case 53:
+        case 54:
+        case 55:
+        case 56:
+        case 57:
+        case 58:
+        case 59:
+        case 60:
+        case 61:
+        case 62:
+        case 63:
+        case 64:
+        case 65:
+        case 66:
+        case 67:
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::popStack( void )
+{
+    callDtor( myStack.top().first.second, myStack.top().second );
+    myStack.pop();
+}
+
+
+////////////////////////////////////////
+
+
+ParserAct privBenchImpl::findParserAction( int &newVal, int tok )
+{
+    int stateNum;
+    ParserAct retval = PA_NOP;
+    bool found = false;
+
+    stateNum = myStack.empty() ? 0 : myStack.top().first.first;
+    ActionMap::iterator i = myStates[stateNum].find( tok );
+    if ( tok >= 0 && tok <= 536 )
+    {
+        if ( i != myStates[stateNum].end() )
+        {
+            retval = (*i).second.first;
+            newVal = (*i).second.second;
+            found = true;
+        }
+    }
+    else if ( ! myStates[stateNum].empty() )
+    {
+        retval = PA_NOP;
+        newVal = 0;
+        found = true;
+    }
+
+    if ( ! found )
+    {
+        retval = myStateDefaultActions[stateNum].first;
+        newVal = myStateDefaultActions[stateNum].second;
+    }
+    return retval;
+}
+
+
+////////////////////////////////////////
+
+
+static int theStateTable[2908][4] =
+{
+    // State 0
+    { 0, 69, PA_SHIFT, 1 },
+    // State 0
+    { 0, 535, PA_ACCEPT, 0 },
+    // State 0
+    { 0, 536, PA_REDUCE, 1 },
+    // State 0 default action
+    { 0, -1, PA_REDUCE, 1 },
+    // State 1
+    { 1, 0, PA_REDUCE, 0 },
+    // State 1
+    { 1, 9, PA_SHIFT, 3 },
+    // State 1
+    { 1, 10, PA_SHIFT, 21 },
+    // State 1
+    { 1, 11, PA_SHIFT, 183 },
+    // State 1
+    { 1, 12, PA_SHIFT, 201 },
+    // State 1
+    { 1, 13, PA_SHIFT, 219 },
+    // State 1
+    { 1, 14, PA_SHIFT, 237 },
+    // State 1
+    { 1, 15, PA_SHIFT, 255 },
+    // State 1
+    { 1, 16, PA_SHIFT, 273 },
+    // State 1
+    { 1, 17, PA_SHIFT, 291 },
+    // State 1
+    { 1, 18, PA_SHIFT, 309 },
+    // State 1
+    { 1, 19, PA_SHIFT, 327 },
+    // State 1
+    { 1, 20, PA_SHIFT, 345 },
+    // State 1
+    { 1, 21, PA_SHIFT, 39 },
+    // State 1
+    { 1, 22, PA_SHIFT, 363 },
+    // State 1
+    { 1, 23, PA_SHIFT, 381 },
+    // State 1
+    { 1, 24, PA_SHIFT, 399 },
+    // State 1
+    { 1, 25, PA_SHIFT, 417 },
+    // State 1
+    { 1, 26, PA_SHIFT, 435 },
+    // State 1
+    { 1, 27, PA_SHIFT, 453 },
+    // State 1
+    { 1, 28, PA_SHIFT, 471 },
+    // State 1
+    { 1, 29, PA_SHIFT, 489 },
+    // State 1
+    { 1, 30, PA_SHIFT, 507 },
+    // State 1
+    { 1, 31, PA_SHIFT, 525 },
+    // State 1
+    { 1, 32, PA_SHIFT, 57 },
+    // State 1
+    { 1, 33, PA_SHIFT, 543 },
+    // State 1
+    { 1, 34, PA_SHIFT, 561 },
+    // State 1
+    { 1, 35, PA_SHIFT, 579 },
+    // State 1
+    { 1, 36, PA_SHIFT, 597 },
+    // State 1
+    { 1, 37, PA_SHIFT, 615 },
+    // State 1
+    { 1, 38, PA_SHIFT, 633 },
+    // State 1
+    { 1, 39, PA_SHIFT, 651 },
+    // State 1
+    { 1, 40, PA_SHIFT, 669 },
+    // State 1
+    { 1, 41, PA_SHIFT, 687 },
+    // State 1
+    { 1, 42, PA_SHIFT, 705 },
+    // State 1
+    { 1, 43, PA_SHIFT, 75 },
+    // State 1
+    { 1, 44, PA_SHIFT, 723 },
+    // State 1
+    { 1, 45, PA_SHIFT, 741 },
+    // State 1
+    { 1, 46, PA_SHIFT, 759 },
+    // State 1
+    { 1, 47, PA_SHIFT, 777 },
+    // State 1
+    { 1, 48, PA_SHIFT, 795 },
+    // State 1
+    { 1, 49, PA_SHIFT, 813 },
+    // State 1
+    { 1, 50, PA_SHIFT, 831 },
+    // State 1
+    { 1, 51, PA_SHIFT, 849 },
+    // State 1
+    { 1, 52, PA_SHIFT, 867 },
+    // State 1
+    { 1, 53, PA_SHIFT, 885 },
+    // State 1
+    { 1, 54, PA_SHIFT, 93 },
+    // State 1
+    { 1, 55, PA_SHIFT, 903 },
+    // State 1
+    { 1, 56, PA_SHIFT, 921 },
+    // State 1
+    { 1, 57, PA_SHIFT, 939 },
+    // State 1
+    { 1, 58, PA_SHIFT, 957 },
+    // State 1
+    { 1, 59, PA_SHIFT, 975 },
+    // State 1
+    { 1, 60, PA_SHIFT, 993 },
+    // State 1
+    { 1, 61, PA_SHIFT, 1011 },
+    // State 1
+    { 1, 62, PA_SHIFT, 1029 },
+    // State 1
+    { 1, 63, PA_SHIFT, 111 },
+    // State 1
+    { 1, 64, PA_SHIFT, 129 },
+    // State 1
+    { 1, 65, PA_SHIFT, 147 },
+    // State 1
+    { 1, 66, PA_SHIFT, 165 },
+    // State 1
+    { 1, 68, PA_SHIFT, 2 },
+    // State 2
+    { 2, 536, PA_REDUCE, 2 },
+    // State 2 default action
+    { 2, -1, PA_REDUCE, 2 },
+    // State 3
+    { 3, 1, PA_SHIFT, 20 },
+    // State 3
+    { 3, 71, PA_SHIFT, 4 },
+    // State 3
+    { 3, 536, PA_REDUCE, 4 },
+    // State 3 default action
+    { 3, -1, PA_REDUCE, 4 },
+    // State 4
+    { 4, 2, PA_SHIFT, 19 },
+    // State 4
+    { 4, 72, PA_SHIFT, 5 },
+    // State 4
+    { 4, 536, PA_REDUCE, 6 },
+    // State 4 default action
+    { 4, -1, PA_REDUCE, 6 },
+    // State 5
+    { 5, 3, PA_SHIFT, 18 },
+    // State 5
+    { 5, 73, PA_SHIFT, 6 },
+    // State 5
+    { 5, 536, PA_REDUCE, 8 },
+    // State 5 default action
+    { 5, -1, PA_REDUCE, 8 },
+    // State 6
+    { 6, 4, PA_SHIFT, 17 },
+    // State 6
+    { 6, 74, PA_SHIFT, 7 },
+    // State 6
+    { 6, 536, PA_REDUCE, 10 },
+    // State 6 default action
+    { 6, -1, PA_REDUCE, 10 },
+    // State 7
+    { 7, 5, PA_SHIFT, 16 },
+    // State 7
+    { 7, 75, PA_SHIFT, 8 },
+    // State 7
+    { 7, 536, PA_REDUCE, 12 },
+    // State 7 default action
+    { 7, -1, PA_REDUCE, 12 },
+    // State 8
+    { 8, 6, PA_SHIFT, 15 },
+    // State 8
+    { 8, 76, PA_SHIFT, 9 },
+    // State 8
+    { 8, 536, PA_REDUCE, 14 },
+    // State 8 default action
+    { 8, -1, PA_REDUCE, 14 },
+    // State 9
+    { 9, 7, PA_SHIFT, 14 },
+    // State 9
+    { 9, 77, PA_SHIFT, 10 },
+    // State 9
+    { 9, 536, PA_REDUCE, 16 },
+    // State 9 default action
+    { 9, -1, PA_REDUCE, 16 },
+    // State 10
+    { 10, 8, PA_SHIFT, 13 },
+    // State 10
+    { 10, 67, PA_REDUCE, 18 },
+    // State 10
+    { 10, 78, PA_SHIFT, 11 },
+    // State 11
+    { 11, 67, PA_SHIFT, 12 },
+    // State 12
+    { 12, 536, PA_REDUCE, 3 },
+    // State 12 default action
+    { 12, -1, PA_REDUCE, 3 },
+    // State 13
+    { 13, 67, PA_REDUCE, 19 },
+    // State 14
+    { 14, 536, PA_REDUCE, 17 },
+    // State 14 default action
+    { 14, -1, PA_REDUCE, 17 },
+    // State 15
+    { 15, 536, PA_REDUCE, 15 },
+    // State 15 default action
+    { 15, -1, PA_REDUCE, 15 },
+    // State 16
+    { 16, 536, PA_REDUCE, 13 },
+    // State 16 default action
+    { 16, -1, PA_REDUCE, 13 },
+    // State 17
+    { 17, 536, PA_REDUCE, 11 },
+    // State 17 default action
+    { 17, -1, PA_REDUCE, 11 },
+    // State 18
+    { 18, 536, PA_REDUCE, 9 },
+    // State 18 default action
+    { 18, -1, PA_REDUCE, 9 },
+    // State 19
+    { 19, 536, PA_REDUCE, 7 },
+    // State 19 default action
+    { 19, -1, PA_REDUCE, 7 },
+    // State 20
+    { 20, 536, PA_REDUCE, 5 },
+    // State 20 default action
+    { 20, -1, PA_REDUCE, 5 },
+    // State 21
+    { 21, 1, PA_SHIFT, 38 },
+    // State 21
+    { 21, 159, PA_SHIFT, 22 },
+    // State 21
+    { 21, 536, PA_REDUCE, 21 },
+    // State 21 default action
+    { 21, -1, PA_REDUCE, 21 },
+    // State 22
+    { 22, 2, PA_SHIFT, 37 },
+    // State 22
+    { 22, 160, PA_SHIFT, 23 },
+    // State 22
+    { 22, 536, PA_REDUCE, 23 },
+    // State 22 default action
+    { 22, -1, PA_REDUCE, 23 },
+    // State 23
+    { 23, 3, PA_SHIFT, 36 },
+    // State 23
+    { 23, 161, PA_SHIFT, 24 },
+    // State 23
+    { 23, 536, PA_REDUCE, 25 },
+    // State 23 default action
+    { 23, -1, PA_REDUCE, 25 },
+    // State 24
+    { 24, 4, PA_SHIFT, 35 },
+    // State 24
+    { 24, 162, PA_SHIFT, 25 },
+    // State 24
+    { 24, 536, PA_REDUCE, 27 },
+    // State 24 default action
+    { 24, -1, PA_REDUCE, 27 },
+    // State 25
+    { 25, 5, PA_SHIFT, 34 },
+    // State 25
+    { 25, 163, PA_SHIFT, 26 },
+    // State 25
+    { 25, 536, PA_REDUCE, 29 },
+    // State 25 default action
+    { 25, -1, PA_REDUCE, 29 },
+    // State 26
+    { 26, 6, PA_SHIFT, 33 },
+    // State 26
+    { 26, 164, PA_SHIFT, 27 },
+    // State 26
+    { 26, 536, PA_REDUCE, 31 },
+    // State 26 default action
+    { 26, -1, PA_REDUCE, 31 },
+    // State 27
+    { 27, 7, PA_SHIFT, 32 },
+    // State 27
+    { 27, 165, PA_SHIFT, 28 },
+    // State 27
+    { 27, 536, PA_REDUCE, 33 },
+    // State 27 default action
+    { 27, -1, PA_REDUCE, 33 },
+    // State 28
+    { 28, 8, PA_SHIFT, 31 },
+    // State 28
+    { 28, 67, PA_REDUCE, 35 },
+    // State 28
+    { 28, 166, PA_SHIFT, 29 },
+    // State 29
+    { 29, 67, PA_SHIFT, 30 },
+    // State 30
+    { 30, 536, PA_REDUCE, 20 },
+    // State 30 default action
+    { 30, -1, PA_REDUCE, 20 },
+    // State 31
+    { 31, 67, PA_REDUCE, 36 },
+    // State 32
+    { 32, 536, PA_REDUCE, 34 },
+    // State 32 default action
+    { 32, -1, PA_REDUCE, 34 },
+    // State 33
+    { 33, 536, PA_REDUCE, 32 },
+    // State 33 default action
+    { 33, -1, PA_REDUCE, 32 },
+    // State 34
+    { 34, 536, PA_REDUCE, 30 },
+    // State 34 default action
+    { 34, -1, PA_REDUCE, 30 },
+    // State 35
+    { 35, 536, PA_REDUCE, 28 },
+    // State 35 default action
+    { 35, -1, PA_REDUCE, 28 },
+    // State 36
+    { 36, 536, PA_REDUCE, 26 },
+    // State 36 default action
+    { 36, -1, PA_REDUCE, 26 },
+    // State 37
+    { 37, 536, PA_REDUCE, 24 },
+    // State 37 default action
+    { 37, -1, PA_REDUCE, 24 },
+    // State 38
+    { 38, 536, PA_REDUCE, 22 },
+    // State 38 default action
+    { 38, -1, PA_REDUCE, 22 },
+    // State 39
+    { 39, 1, PA_SHIFT, 56 },
+    // State 39
+    { 39, 247, PA_SHIFT, 40 },
+    // State 39
+    { 39, 536, PA_REDUCE, 38 },
+    // State 39 default action
+    { 39, -1, PA_REDUCE, 38 },
+    // State 40
+    { 40, 2, PA_SHIFT, 55 },
+    // State 40
+    { 40, 248, PA_SHIFT, 41 },
+    // State 40
+    { 40, 536, PA_REDUCE, 40 },
+    // State 40 default action
+    { 40, -1, PA_REDUCE, 40 },
+    // State 41
+    { 41, 3, PA_SHIFT, 54 },
+    // State 41
+    { 41, 249, PA_SHIFT, 42 },
+    // State 41
+    { 41, 536, PA_REDUCE, 42 },
+    // State 41 default action
+    { 41, -1, PA_REDUCE, 42 },
+    // State 42
+    { 42, 4, PA_SHIFT, 53 },
+    // State 42
+    { 42, 250, PA_SHIFT, 43 },
+    // State 42
+    { 42, 536, PA_REDUCE, 44 },
+    // State 42 default action
+    { 42, -1, PA_REDUCE, 44 },
+    // State 43
+    { 43, 5, PA_SHIFT, 52 },
+    // State 43
+    { 43, 251, PA_SHIFT, 44 },
+    // State 43
+    { 43, 536, PA_REDUCE, 46 },
+    // State 43 default action
+    { 43, -1, PA_REDUCE, 46 },
+    // State 44
+    { 44, 6, PA_SHIFT, 51 },
+    // State 44
+    { 44, 252, PA_SHIFT, 45 },
+    // State 44
+    { 44, 536, PA_REDUCE, 48 },
+    // State 44 default action
+    { 44, -1, PA_REDUCE, 48 },
+    // State 45
+    { 45, 7, PA_SHIFT, 50 },
+    // State 45
+    { 45, 253, PA_SHIFT, 46 },
+    // State 45
+    { 45, 536, PA_REDUCE, 50 },
+    // State 45 default action
+    { 45, -1, PA_REDUCE, 50 },
+    // State 46
+    { 46, 8, PA_SHIFT, 49 },
+    // State 46
+    { 46, 67, PA_REDUCE, 52 },
+    // State 46
+    { 46, 254, PA_SHIFT, 47 },
+    // State 47
+    { 47, 67, PA_SHIFT, 48 },
+    // State 48
+    { 48, 536, PA_REDUCE, 37 },
+    // State 48 default action
+    { 48, -1, PA_REDUCE, 37 },
+    // State 49
+    { 49, 67, PA_REDUCE, 53 },
+    // State 50
+    { 50, 536, PA_REDUCE, 51 },
+    // State 50 default action
+    { 50, -1, PA_REDUCE, 51 },
+    // State 51
+    { 51, 536, PA_REDUCE, 49 },
+    // State 51 default action
+    { 51, -1, PA_REDUCE, 49 },
+    // State 52
+    { 52, 536, PA_REDUCE, 47 },
+    // State 52 default action
+    { 52, -1, PA_REDUCE, 47 },
+    // State 53
+    { 53, 536, PA_REDUCE, 45 },
+    // State 53 default action
+    { 53, -1, PA_REDUCE, 45 },
+    // State 54
+    { 54, 536, PA_REDUCE, 43 },
+    // State 54 default action
+    { 54, -1, PA_REDUCE, 43 },
+    // State 55
+    { 55, 536, PA_REDUCE, 41 },
+    // State 55 default action
+    { 55, -1, PA_REDUCE, 41 },
+    // State 56
+    { 56, 536, PA_REDUCE, 39 },
+    // State 56 default action
+    { 56, -1, PA_REDUCE, 39 },
+    // State 57
+    { 57, 1, PA_SHIFT, 74 },
+    // State 57
+    { 57, 335, PA_SHIFT, 58 },
+    // State 57
+    { 57, 536, PA_REDUCE, 55 },
+    // State 57 default action
+    { 57, -1, PA_REDUCE, 55 },
+    // State 58
+    { 58, 2, PA_SHIFT, 73 },
+    // State 58
+    { 58, 336, PA_SHIFT, 59 },
+    // State 58
+    { 58, 536, PA_REDUCE, 57 },
+    // State 58 default action
+    { 58, -1, PA_REDUCE, 57 },
+    // State 59
+    { 59, 3, PA_SHIFT, 72 },
+    // State 59
+    { 59, 337, PA_SHIFT, 60 },
+    // State 59
+    { 59, 536, PA_REDUCE, 59 },
+    // State 59 default action
+    { 59, -1, PA_REDUCE, 59 },
+    // State 60
+    { 60, 4, PA_SHIFT, 71 },
+    // State 60
+    { 60, 338, PA_SHIFT, 61 },
+    // State 60
+    { 60, 536, PA_REDUCE, 61 },
+    // State 60 default action
+    { 60, -1, PA_REDUCE, 61 },
+    // State 61
+    { 61, 5, PA_SHIFT, 70 },
+    // State 61
+    { 61, 339, PA_SHIFT, 62 },
+    // State 61
+    { 61, 536, PA_REDUCE, 63 },
+    // State 61 default action
+    { 61, -1, PA_REDUCE, 63 },
+    // State 62
+    { 62, 6, PA_SHIFT, 69 },
+    // State 62
+    { 62, 340, PA_SHIFT, 63 },
+    // State 62
+    { 62, 536, PA_REDUCE, 65 },
+    // State 62 default action
+    { 62, -1, PA_REDUCE, 65 },
+    // State 63
+    { 63, 7, PA_SHIFT, 68 },
+    // State 63
+    { 63, 341, PA_SHIFT, 64 },
+    // State 63
+    { 63, 536, PA_REDUCE, 67 },
+    // State 63 default action
+    { 63, -1, PA_REDUCE, 67 },
+    // State 64
+    { 64, 8, PA_SHIFT, 67 },
+    // State 64
+    { 64, 67, PA_REDUCE, 69 },
+    // State 64
+    { 64, 342, PA_SHIFT, 65 },
+    // State 65
+    { 65, 67, PA_SHIFT, 66 },
+    // State 66
+    { 66, 536, PA_REDUCE, 54 },
+    // State 66 default action
+    { 66, -1, PA_REDUCE, 54 },
+    // State 67
+    { 67, 67, PA_REDUCE, 70 },
+    // State 68
+    { 68, 536, PA_REDUCE, 68 },
+    // State 68 default action
+    { 68, -1, PA_REDUCE, 68 },
+    // State 69
+    { 69, 536, PA_REDUCE, 66 },
+    // State 69 default action
+    { 69, -1, PA_REDUCE, 66 },
+    // State 70
+    { 70, 536, PA_REDUCE, 64 },
+    // State 70 default action
+    { 70, -1, PA_REDUCE, 64 },
+    // State 71
+    { 71, 536, PA_REDUCE, 62 },
+    // State 71 default action
+    { 71, -1, PA_REDUCE, 62 },
+    // State 72
+    { 72, 536, PA_REDUCE, 60 },
+    // State 72 default action
+    { 72, -1, PA_REDUCE, 60 },
+    // State 73
+    { 73, 536, PA_REDUCE, 58 },
+    // State 73 default action
+    { 73, -1, PA_REDUCE, 58 },
+    // State 74
+    { 74, 536, PA_REDUCE, 56 },
+    // State 74 default action
+    { 74, -1, PA_REDUCE, 56 },
+    // State 75
+    { 75, 1, PA_SHIFT, 92 },
+    // State 75
+    { 75, 423, PA_SHIFT, 76 },
+    // State 75
+    { 75, 536, PA_REDUCE, 72 },
+    // State 75 default action
+    { 75, -1, PA_REDUCE, 72 },
+    // State 76
+    { 76, 2, PA_SHIFT, 91 },
+    // State 76
+    { 76, 424, PA_SHIFT, 77 },
+    // State 76
+    { 76, 536, PA_REDUCE, 74 },
+    // State 76 default action
+    { 76, -1, PA_REDUCE, 74 },
+    // State 77
+    { 77, 3, PA_SHIFT, 90 },
+    // State 77
+    { 77, 425, PA_SHIFT, 78 },
+    // State 77
+    { 77, 536, PA_REDUCE, 76 },
+    // State 77 default action
+    { 77, -1, PA_REDUCE, 76 },
+    // State 78
+    { 78, 4, PA_SHIFT, 89 },
+    // State 78
+    { 78, 426, PA_SHIFT, 79 },
+    // State 78
+    { 78, 536, PA_REDUCE, 78 },
+    // State 78 default action
+    { 78, -1, PA_REDUCE, 78 },
+    // State 79
+    { 79, 5, PA_SHIFT, 88 },
+    // State 79
+    { 79, 427, PA_SHIFT, 80 },
+    // State 79
+    { 79, 536, PA_REDUCE, 80 },
+    // State 79 default action
+    { 79, -1, PA_REDUCE, 80 },
+    // State 80
+    { 80, 6, PA_SHIFT, 87 },
+    // State 80
+    { 80, 428, PA_SHIFT, 81 },
+    // State 80
+    { 80, 536, PA_REDUCE, 82 },
+    // State 80 default action
+    { 80, -1, PA_REDUCE, 82 },
+    // State 81
+    { 81, 7, PA_SHIFT, 86 },
+    // State 81
+    { 81, 429, PA_SHIFT, 82 },
+    // State 81
+    { 81, 536, PA_REDUCE, 84 },
+    // State 81 default action
+    { 81, -1, PA_REDUCE, 84 },
+    // State 82
+    { 82, 8, PA_SHIFT, 85 },
+    // State 82
+    { 82, 67, PA_REDUCE, 86 },
+    // State 82
+    { 82, 430, PA_SHIFT, 83 },
+    // State 83
+    { 83, 67, PA_SHIFT, 84 },
+    // State 84
+    { 84, 536, PA_REDUCE, 71 },
+    // State 84 default action
+    { 84, -1, PA_REDUCE, 71 },
+    // State 85
+    { 85, 67, PA_REDUCE, 87 },
+    // State 86
+    { 86, 536, PA_REDUCE, 85 },
+    // State 86 default action
+    { 86, -1, PA_REDUCE, 85 },
+    // State 87
+    { 87, 536, PA_REDUCE, 83 },
+    // State 87 default action
+    { 87, -1, PA_REDUCE, 83 },
+    // State 88
+    { 88, 536, PA_REDUCE, 81 },
+    // State 88 default action
+    { 88, -1, PA_REDUCE, 81 },
+    // State 89
+    { 89, 536, PA_REDUCE, 79 },
+    // State 89 default action
+    { 89, -1, PA_REDUCE, 79 },
+    // State 90
+    { 90, 536, PA_REDUCE, 77 },
+    // State 90 default action
+    { 90, -1, PA_REDUCE, 77 },
+    // State 91
+    { 91, 536, PA_REDUCE, 75 },
+    // State 91 default action
+    { 91, -1, PA_REDUCE, 75 },
+    // State 92
+    { 92, 536, PA_REDUCE, 73 },
+    // State 92 default action
+    { 92, -1, PA_REDUCE, 73 },
+    // State 93
+    { 93, 1, PA_SHIFT, 110 },
+    // State 93
+    { 93, 495, PA_SHIFT, 94 },
+    // State 93
+    { 93, 536, PA_REDUCE, 89 },
+    // State 93 default action
+    { 93, -1, PA_REDUCE, 89 },
+    // State 94
+    { 94, 2, PA_SHIFT, 109 },
+    // State 94
+    { 94, 496, PA_SHIFT, 95 },
+    // State 94
+    { 94, 536, PA_REDUCE, 91 },
+    // State 94 default action
+    { 94, -1, PA_REDUCE, 91 },
+    // State 95
+    { 95, 3, PA_SHIFT, 108 },
+    // State 95
+    { 95, 497, PA_SHIFT, 96 },
+    // State 95
+    { 95, 536, PA_REDUCE, 93 },
+    // State 95 default action
+    { 95, -1, PA_REDUCE, 93 },
+    // State 96
+    { 96, 4, PA_SHIFT, 107 },
+    // State 96
+    { 96, 498, PA_SHIFT, 97 },
+    // State 96
+    { 96, 536, PA_REDUCE, 95 },
+    // State 96 default action
+    { 96, -1, PA_REDUCE, 95 },
+    // State 97
+    { 97, 5, PA_SHIFT, 106 },
+    // State 97
+    { 97, 499, PA_SHIFT, 98 },
+    // State 97
+    { 97, 536, PA_REDUCE, 97 },
+    // State 97 default action
+    { 97, -1, PA_REDUCE, 97 },
+    // State 98
+    { 98, 6, PA_SHIFT, 105 },
+    // State 98
+    { 98, 500, PA_SHIFT, 99 },
+    // State 98
+    { 98, 536, PA_REDUCE, 99 },
+    // State 98 default action
+    { 98, -1, PA_REDUCE, 99 },
+    // State 99
+    { 99, 7, PA_SHIFT, 104 },
+    // State 99
+    { 99, 501, PA_SHIFT, 100 },
+    // State 99
+    { 99, 536, PA_REDUCE, 101 },
+    // State 99 default action
+    { 99, -1, PA_REDUCE, 101 },
+    // State 100
+    { 100, 8, PA_SHIFT, 103 },
+    // State 100
+    { 100, 67, PA_REDUCE, 103 },
+    // State 100
+    { 100, 502, PA_SHIFT, 101 },
+    // State 101
+    { 101, 67, PA_SHIFT, 102 },
+    // State 102
+    { 102, 536, PA_REDUCE, 88 },
+    // State 102 default action
+    { 102, -1, PA_REDUCE, 88 },
+    // State 103
+    { 103, 67, PA_REDUCE, 104 },
+    // State 104
+    { 104, 536, PA_REDUCE, 102 },
+    // State 104 default action
+    { 104, -1, PA_REDUCE, 102 },
+    // State 105
+    { 105, 536, PA_REDUCE, 100 },
+    // State 105 default action
+    { 105, -1, PA_REDUCE, 100 },
+    // State 106
+    { 106, 536, PA_REDUCE, 98 },
+    // State 106 default action
+    { 106, -1, PA_REDUCE, 98 },
+    // State 107
+    { 107, 536, PA_REDUCE, 96 },
+    // State 107 default action
+    { 107, -1, PA_REDUCE, 96 },
+    // State 108
+    { 108, 536, PA_REDUCE, 94 },
+    // State 108 default action
+    { 108, -1, PA_REDUCE, 94 },
+    // State 109
+    { 109, 536, PA_REDUCE, 92 },
+    // State 109 default action
+    { 109, -1, PA_REDUCE, 92 },
+    // State 110
+    { 110, 536, PA_REDUCE, 90 },
+    // State 110 default action
+    { 110, -1, PA_REDUCE, 90 },
+    // State 111
+    { 111, 1, PA_SHIFT, 128 },
+    // State 111
+    { 111, 503, PA_SHIFT, 112 },
+    // State 111
+    { 111, 536, PA_REDUCE, 106 },
+    // State 111 default action
+    { 111, -1, PA_REDUCE, 106 },
+    // State 112
+    { 112, 2, PA_SHIFT, 127 },
+    // State 112
+    { 112, 504, PA_SHIFT, 113 },
+    // State 112
+    { 112, 536, PA_REDUCE, 108 },
+    // State 112 default action
+    { 112, -1, PA_REDUCE, 108 },
+    // State 113
+    { 113, 3, PA_SHIFT, 126 },
+    // State 113
+    { 113, 505, PA_SHIFT, 114 },
+    // State 113
+    { 113, 536, PA_REDUCE, 110 },
+    // State 113 default action
+    { 113, -1, PA_REDUCE, 110 },
+    // State 114
+    { 114, 4, PA_SHIFT, 125 },
+    // State 114
+    { 114, 506, PA_SHIFT, 115 },
+    // State 114
+    { 114, 536, PA_REDUCE, 112 },
+    // State 114 default action
+    { 114, -1, PA_REDUCE, 112 },
+    // State 115
+    { 115, 5, PA_SHIFT, 124 },
+    // State 115
+    { 115, 507, PA_SHIFT, 116 },
+    // State 115
+    { 115, 536, PA_REDUCE, 114 },
+    // State 115 default action
+    { 115, -1, PA_REDUCE, 114 },
+    // State 116
+    { 116, 6, PA_SHIFT, 123 },
+    // State 116
+    { 116, 508, PA_SHIFT, 117 },
+    // State 116
+    { 116, 536, PA_REDUCE, 116 },
+    // State 116 default action
+    { 116, -1, PA_REDUCE, 116 },
+    // State 117
+    { 117, 7, PA_SHIFT, 122 },
+    // State 117
+    { 117, 509, PA_SHIFT, 118 },
+    // State 117
+    { 117, 536, PA_REDUCE, 118 },
+    // State 117 default action
+    { 117, -1, PA_REDUCE, 118 },
+    // State 118
+    { 118, 8, PA_SHIFT, 121 },
+    // State 118
+    { 118, 67, PA_REDUCE, 120 },
+    // State 118
+    { 118, 510, PA_SHIFT, 119 },
+    // State 119
+    { 119, 67, PA_SHIFT, 120 },
+    // State 120
+    { 120, 536, PA_REDUCE, 105 },
+    // State 120 default action
+    { 120, -1, PA_REDUCE, 105 },
+    // State 121
+    { 121, 67, PA_REDUCE, 121 },
+    // State 122
+    { 122, 536, PA_REDUCE, 119 },
+    // State 122 default action
+    { 122, -1, PA_REDUCE, 119 },
+    // State 123
+    { 123, 536, PA_REDUCE, 117 },
+    // State 123 default action
+    { 123, -1, PA_REDUCE, 117 },
+    // State 124
+    { 124, 536, PA_REDUCE, 115 },
+    // State 124 default action
+    { 124, -1, PA_REDUCE, 115 },
+    // State 125
+    { 125, 536, PA_REDUCE, 113 },
+    // State 125 default action
+    { 125, -1, PA_REDUCE, 113 },
+    // State 126
+    { 126, 536, PA_REDUCE, 111 },
+    // State 126 default action
+    { 126, -1, PA_REDUCE, 111 },
+    // State 127
+    { 127, 536, PA_REDUCE, 109 },
+    // State 127 default action
+    { 127, -1, PA_REDUCE, 109 },
+    // State 128
+    { 128, 536, PA_REDUCE, 107 },
+    // State 128 default action
+    { 128, -1, PA_REDUCE, 107 },
+    // State 129
+    { 129, 1, PA_SHIFT, 146 },
+    // State 129
+    { 129, 511, PA_SHIFT, 130 },
+    // State 129
+    { 129, 536, PA_REDUCE, 123 },
+    // State 129 default action
+    { 129, -1, PA_REDUCE, 123 },
+    // State 130
+    { 130, 2, PA_SHIFT, 145 },
+    // State 130
+    { 130, 512, PA_SHIFT, 131 },
+    // State 130
+    { 130, 536, PA_REDUCE, 125 },
+    // State 130 default action
+    { 130, -1, PA_REDUCE, 125 },
+    // State 131
+    { 131, 3, PA_SHIFT, 144 },
+    // State 131
+    { 131, 513, PA_SHIFT, 132 },
+    // State 131
+    { 131, 536, PA_REDUCE, 127 },
+    // State 131 default action
+    { 131, -1, PA_REDUCE, 127 },
+    // State 132
+    { 132, 4, PA_SHIFT, 143 },
+    // State 132
+    { 132, 514, PA_SHIFT, 133 },
+    // State 132
+    { 132, 536, PA_REDUCE, 129 },
+    // State 132 default action
+    { 132, -1, PA_REDUCE, 129 },
+    // State 133
+    { 133, 5, PA_SHIFT, 142 },
+    // State 133
+    { 133, 515, PA_SHIFT, 134 },
+    // State 133
+    { 133, 536, PA_REDUCE, 131 },
+    // State 133 default action
+    { 133, -1, PA_REDUCE, 131 },
+    // State 134
+    { 134, 6, PA_SHIFT, 141 },
+    // State 134
+    { 134, 516, PA_SHIFT, 135 },
+    // State 134
+    { 134, 536, PA_REDUCE, 133 },
+    // State 134 default action
+    { 134, -1, PA_REDUCE, 133 },
+    // State 135
+    { 135, 7, PA_SHIFT, 140 },
+    // State 135
+    { 135, 517, PA_SHIFT, 136 },
+    // State 135
+    { 135, 536, PA_REDUCE, 135 },
+    // State 135 default action
+    { 135, -1, PA_REDUCE, 135 },
+    // State 136
+    { 136, 8, PA_SHIFT, 139 },
+    // State 136
+    { 136, 67, PA_REDUCE, 137 },
+    // State 136
+    { 136, 518, PA_SHIFT, 137 },
+    // State 137
+    { 137, 67, PA_SHIFT, 138 },
+    // State 138
+    { 138, 536, PA_REDUCE, 122 },
+    // State 138 default action
+    { 138, -1, PA_REDUCE, 122 },
+    // State 139
+    { 139, 67, PA_REDUCE, 138 },
+    // State 140
+    { 140, 536, PA_REDUCE, 136 },
+    // State 140 default action
+    { 140, -1, PA_REDUCE, 136 },
+    // State 141
+    { 141, 536, PA_REDUCE, 134 },
+    // State 141 default action
+    { 141, -1, PA_REDUCE, 134 },
+    // State 142
+    { 142, 536, PA_REDUCE, 132 },
+    // State 142 default action
+    { 142, -1, PA_REDUCE, 132 },
+    // State 143
+    { 143, 536, PA_REDUCE, 130 },
+    // State 143 default action
+    { 143, -1, PA_REDUCE, 130 },
+    // State 144
+    { 144, 536, PA_REDUCE, 128 },
+    // State 144 default action
+    { 144, -1, PA_REDUCE, 128 },
+    // State 145
+    { 145, 536, PA_REDUCE, 126 },
+    // State 145 default action
+    { 145, -1, PA_REDUCE, 126 },
+    // State 146
+    { 146, 536, PA_REDUCE, 124 },
+    // State 146 default action
+    { 146, -1, PA_REDUCE, 124 },
+    // State 147
+    { 147, 1, PA_SHIFT, 164 },
+    // State 147
+    { 147, 519, PA_SHIFT, 148 },
+    // State 147
+    { 147, 536, PA_REDUCE, 140 },
+    // State 147 default action
+    { 147, -1, PA_REDUCE, 140 },
+    // State 148
+    { 148, 2, PA_SHIFT, 163 },
+    // State 148
+    { 148, 520, PA_SHIFT, 149 },
+    // State 148
+    { 148, 536, PA_REDUCE, 142 },
+    // State 148 default action
+    { 148, -1, PA_REDUCE, 142 },
+    // State 149
+    { 149, 3, PA_SHIFT, 162 },
+    // State 149
+    { 149, 521, PA_SHIFT, 150 },
+    // State 149
+    { 149, 536, PA_REDUCE, 144 },
+    // State 149 default action
+    { 149, -1, PA_REDUCE, 144 },
+    // State 150
+    { 150, 4, PA_SHIFT, 161 },
+    // State 150
+    { 150, 522, PA_SHIFT, 151 },
+    // State 150
+    { 150, 536, PA_REDUCE, 146 },
+    // State 150 default action
+    { 150, -1, PA_REDUCE, 146 },
+    // State 151
+    { 151, 5, PA_SHIFT, 160 },
+    // State 151
+    { 151, 523, PA_SHIFT, 152 },
+    // State 151
+    { 151, 536, PA_REDUCE, 148 },
+    // State 151 default action
+    { 151, -1, PA_REDUCE, 148 },
+    // State 152
+    { 152, 6, PA_SHIFT, 159 },
+    // State 152
+    { 152, 524, PA_SHIFT, 153 },
+    // State 152
+    { 152, 536, PA_REDUCE, 150 },
+    // State 152 default action
+    { 152, -1, PA_REDUCE, 150 },
+    // State 153
+    { 153, 7, PA_SHIFT, 158 },
+    // State 153
+    { 153, 525, PA_SHIFT, 154 },
+    // State 153
+    { 153, 536, PA_REDUCE, 152 },
+    // State 153 default action
+    { 153, -1, PA_REDUCE, 152 },
+    // State 154
+    { 154, 8, PA_SHIFT, 157 },
+    // State 154
+    { 154, 67, PA_REDUCE, 154 },
+    // State 154
+    { 154, 526, PA_SHIFT, 155 },
+    // State 155
+    { 155, 67, PA_SHIFT, 156 },
+    // State 156
+    { 156, 536, PA_REDUCE, 139 },
+    // State 156 default action
+    { 156, -1, PA_REDUCE, 139 },
+    // State 157
+    { 157, 67, PA_REDUCE, 155 },
+    // State 158
+    { 158, 536, PA_REDUCE, 153 },
+    // State 158 default action
+    { 158, -1, PA_REDUCE, 153 },
+    // State 159
+    { 159, 536, PA_REDUCE, 151 },
+    // State 159 default action
+    { 159, -1, PA_REDUCE, 151 },
+    // State 160
+    { 160, 536, PA_REDUCE, 149 },
+    // State 160 default action
+    { 160, -1, PA_REDUCE, 149 },
+    // State 161
+    { 161, 536, PA_REDUCE, 147 },
+    // State 161 default action
+    { 161, -1, PA_REDUCE, 147 },
+    // State 162
+    { 162, 536, PA_REDUCE, 145 },
+    // State 162 default action
+    { 162, -1, PA_REDUCE, 145 },
+    // State 163
+    { 163, 536, PA_REDUCE, 143 },
+    // State 163 default action
+    { 163, -1, PA_REDUCE, 143 },
+    // State 164
+    { 164, 536, PA_REDUCE, 141 },
+    // State 164 default action
+    { 164, -1, PA_REDUCE, 141 },
+    // State 165
+    { 165, 1, PA_SHIFT, 182 },
+    // State 165
+    { 165, 527, PA_SHIFT, 166 },
+    // State 165
+    { 165, 536, PA_REDUCE, 157 },
+    // State 165 default action
+    { 165, -1, PA_REDUCE, 157 },
+    // State 166
+    { 166, 2, PA_SHIFT, 181 },
+    // State 166
+    { 166, 528, PA_SHIFT, 167 },
+    // State 166
+    { 166, 536, PA_REDUCE, 159 },
+    // State 166 default action
+    { 166, -1, PA_REDUCE, 159 },
+    // State 167
+    { 167, 3, PA_SHIFT, 180 },
+    // State 167
+    { 167, 529, PA_SHIFT, 168 },
+    // State 167
+    { 167, 536, PA_REDUCE, 161 },
+    // State 167 default action
+    { 167, -1, PA_REDUCE, 161 },
+    // State 168
+    { 168, 4, PA_SHIFT, 179 },
+    // State 168
+    { 168, 530, PA_SHIFT, 169 },
+    // State 168
+    { 168, 536, PA_REDUCE, 163 },
+    // State 168 default action
+    { 168, -1, PA_REDUCE, 163 },
+    // State 169
+    { 169, 5, PA_SHIFT, 178 },
+    // State 169
+    { 169, 531, PA_SHIFT, 170 },
+    // State 169
+    { 169, 536, PA_REDUCE, 165 },
+    // State 169 default action
+    { 169, -1, PA_REDUCE, 165 },
+    // State 170
+    { 170, 6, PA_SHIFT, 177 },
+    // State 170
+    { 170, 532, PA_SHIFT, 171 },
+    // State 170
+    { 170, 536, PA_REDUCE, 167 },
+    // State 170 default action
+    { 170, -1, PA_REDUCE, 167 },
+    // State 171
+    { 171, 7, PA_SHIFT, 176 },
+    // State 171
+    { 171, 533, PA_SHIFT, 172 },
+    // State 171
+    { 171, 536, PA_REDUCE, 169 },
+    // State 171 default action
+    { 171, -1, PA_REDUCE, 169 },
+    // State 172
+    { 172, 8, PA_SHIFT, 175 },
+    // State 172
+    { 172, 67, PA_REDUCE, 171 },
+    // State 172
+    { 172, 534, PA_SHIFT, 173 },
+    // State 173
+    { 173, 67, PA_SHIFT, 174 },
+    // State 174
+    { 174, 536, PA_REDUCE, 156 },
+    // State 174 default action
+    { 174, -1, PA_REDUCE, 156 },
+    // State 175
+    { 175, 67, PA_REDUCE, 172 },
+    // State 176
+    { 176, 536, PA_REDUCE, 170 },
+    // State 176 default action
+    { 176, -1, PA_REDUCE, 170 },
+    // State 177
+    { 177, 536, PA_REDUCE, 168 },
+    // State 177 default action
+    { 177, -1, PA_REDUCE, 168 },
+    // State 178
+    { 178, 536, PA_REDUCE, 166 },
+    // State 178 default action
+    { 178, -1, PA_REDUCE, 166 },
+    // State 179
+    { 179, 536, PA_REDUCE, 164 },
+    // State 179 default action
+    { 179, -1, PA_REDUCE, 164 },
+    // State 180
+    { 180, 536, PA_REDUCE, 162 },
+    // State 180 default action
+    { 180, -1, PA_REDUCE, 162 },
+    // State 181
+    { 181, 536, PA_REDUCE, 160 },
+    // State 181 default action
+    { 181, -1, PA_REDUCE, 160 },
+    // State 182
+    { 182, 536, PA_REDUCE, 158 },
+    // State 182 default action
+    { 182, -1, PA_REDUCE, 158 },
+    // State 183
+    { 183, 1, PA_SHIFT, 200 },
+    // State 183
+    { 183, 79, PA_SHIFT, 184 },
+    // State 183
+    { 183, 536, PA_REDUCE, 174 },
+    // State 183 default action
+    { 183, -1, PA_REDUCE, 174 },
+    // State 184
+    { 184, 2, PA_SHIFT, 199 },
+    // State 184
+    { 184, 80, PA_SHIFT, 185 },
+    // State 184
+    { 184, 536, PA_REDUCE, 176 },
+    // State 184 default action
+    { 184, -1, PA_REDUCE, 176 },
+    // State 185
+    { 185, 3, PA_SHIFT, 198 },
+    // State 185
+    { 185, 81, PA_SHIFT, 186 },
+    // State 185
+    { 185, 536, PA_REDUCE, 178 },
+    // State 185 default action
+    { 185, -1, PA_REDUCE, 178 },
+    // State 186
+    { 186, 4, PA_SHIFT, 197 },
+    // State 186
+    { 186, 82, PA_SHIFT, 187 },
+    // State 186
+    { 186, 536, PA_REDUCE, 180 },
+    // State 186 default action
+    { 186, -1, PA_REDUCE, 180 },
+    // State 187
+    { 187, 5, PA_SHIFT, 196 },
+    // State 187
+    { 187, 83, PA_SHIFT, 188 },
+    // State 187
+    { 187, 536, PA_REDUCE, 182 },
+    // State 187 default action
+    { 187, -1, PA_REDUCE, 182 },
+    // State 188
+    { 188, 6, PA_SHIFT, 195 },
+    // State 188
+    { 188, 84, PA_SHIFT, 189 },
+    // State 188
+    { 188, 536, PA_REDUCE, 184 },
+    // State 188 default action
+    { 188, -1, PA_REDUCE, 184 },
+    // State 189
+    { 189, 7, PA_SHIFT, 194 },
+    // State 189
+    { 189, 85, PA_SHIFT, 190 },
+    // State 189
+    { 189, 536, PA_REDUCE, 186 },
+    // State 189 default action
+    { 189, -1, PA_REDUCE, 186 },
+    // State 190
+    { 190, 8, PA_SHIFT, 193 },
+    // State 190
+    { 190, 67, PA_REDUCE, 188 },
+    // State 190
+    { 190, 86, PA_SHIFT, 191 },
+    // State 191
+    { 191, 67, PA_SHIFT, 192 },
+    // State 192
+    { 192, 536, PA_REDUCE, 173 },
+    // State 192 default action
+    { 192, -1, PA_REDUCE, 173 },
+    // State 193
+    { 193, 67, PA_REDUCE, 189 },
+    // State 194
+    { 194, 536, PA_REDUCE, 187 },
+    // State 194 default action
+    { 194, -1, PA_REDUCE, 187 },
+    // State 195
+    { 195, 536, PA_REDUCE, 185 },
+    // State 195 default action
+    { 195, -1, PA_REDUCE, 185 },
+    // State 196
+    { 196, 536, PA_REDUCE, 183 },
+    // State 196 default action
+    { 196, -1, PA_REDUCE, 183 },
+    // State 197
+    { 197, 536, PA_REDUCE, 181 },
+    // State 197 default action
+    { 197, -1, PA_REDUCE, 181 },
+    // State 198
+    { 198, 536, PA_REDUCE, 179 },
+    // State 198 default action
+    { 198, -1, PA_REDUCE, 179 },
+    // State 199
+    { 199, 536, PA_REDUCE, 177 },
+    // State 199 default action
+    { 199, -1, PA_REDUCE, 177 },
+    // State 200
+    { 200, 536, PA_REDUCE, 175 },
+    // State 200 default action
+    { 200, -1, PA_REDUCE, 175 },
+    // State 201
+    { 201, 1, PA_SHIFT, 218 },
+    // State 201
+    { 201, 87, PA_SHIFT, 202 },
+    // State 201
+    { 201, 536, PA_REDUCE, 191 },
+    // State 201 default action
+    { 201, -1, PA_REDUCE, 191 },
+    // State 202
+    { 202, 2, PA_SHIFT, 217 },
+    // State 202
+    { 202, 88, PA_SHIFT, 203 },
+    // State 202
+    { 202, 536, PA_REDUCE, 193 },
+    // State 202 default action
+    { 202, -1, PA_REDUCE, 193 },
+    // State 203
+    { 203, 3, PA_SHIFT, 216 },
+    // State 203
+    { 203, 89, PA_SHIFT, 204 },
+    // State 203
+    { 203, 536, PA_REDUCE, 195 },
+    // State 203 default action
+    { 203, -1, PA_REDUCE, 195 },
+    // State 204
+    { 204, 4, PA_SHIFT, 215 },
+    // State 204
+    { 204, 90, PA_SHIFT, 205 },
+    // State 204
+    { 204, 536, PA_REDUCE, 197 },
+    // State 204 default action
+    { 204, -1, PA_REDUCE, 197 },
+    // State 205
+    { 205, 5, PA_SHIFT, 214 },
+    // State 205
+    { 205, 91, PA_SHIFT, 206 },
+    // State 205
+    { 205, 536, PA_REDUCE, 199 },
+    // State 205 default action
+    { 205, -1, PA_REDUCE, 199 },
+    // State 206
+    { 206, 6, PA_SHIFT, 213 },
+    // State 206
+    { 206, 92, PA_SHIFT, 207 },
+    // State 206
+    { 206, 536, PA_REDUCE, 201 },
+    // State 206 default action
+    { 206, -1, PA_REDUCE, 201 },
+    // State 207
+    { 207, 7, PA_SHIFT, 212 },
+    // State 207
+    { 207, 93, PA_SHIFT, 208 },
+    // State 207
+    { 207, 536, PA_REDUCE, 203 },
+    // State 207 default action
+    { 207, -1, PA_REDUCE, 203 },
+    // State 208
+    { 208, 8, PA_SHIFT, 211 },
+    // State 208
+    { 208, 67, PA_REDUCE, 205 },
+    // State 208
+    { 208, 94, PA_SHIFT, 209 },
+    // State 209
+    { 209, 67, PA_SHIFT, 210 },
+    // State 210
+    { 210, 536, PA_REDUCE, 190 },
+    // State 210 default action
+    { 210, -1, PA_REDUCE, 190 },
+    // State 211
+    { 211, 67, PA_REDUCE, 206 },
+    // State 212
+    { 212, 536, PA_REDUCE, 204 },
+    // State 212 default action
+    { 212, -1, PA_REDUCE, 204 },
+    // State 213
+    { 213, 536, PA_REDUCE, 202 },
+    // State 213 default action
+    { 213, -1, PA_REDUCE, 202 },
+    // State 214
+    { 214, 536, PA_REDUCE, 200 },
+    // State 214 default action
+    { 214, -1, PA_REDUCE, 200 },
+    // State 215
+    { 215, 536, PA_REDUCE, 198 },
+    // State 215 default action
+    { 215, -1, PA_REDUCE, 198 },
+    // State 216
+    { 216, 536, PA_REDUCE, 196 },
+    // State 216 default action
+    { 216, -1, PA_REDUCE, 196 },
+    // State 217
+    { 217, 536, PA_REDUCE, 194 },
+    // State 217 default action
+    { 217, -1, PA_REDUCE, 194 },
+    // State 218
+    { 218, 536, PA_REDUCE, 192 },
+    // State 218 default action
+    { 218, -1, PA_REDUCE, 192 },
+    // State 219
+    { 219, 1, PA_SHIFT, 236 },
+    // State 219
+    { 219, 95, PA_SHIFT, 220 },
+    // State 219
+    { 219, 536, PA_REDUCE, 208 },
+    // State 219 default action
+    { 219, -1, PA_REDUCE, 208 },
+    // State 220
+    { 220, 2, PA_SHIFT, 235 },
+    // State 220
+    { 220, 96, PA_SHIFT, 221 },
+    // State 220
+    { 220, 536, PA_REDUCE, 210 },
+    // State 220 default action
+    { 220, -1, PA_REDUCE, 210 },
+    // State 221
+    { 221, 3, PA_SHIFT, 234 },
+    // State 221
+    { 221, 97, PA_SHIFT, 222 },
+    // State 221
+    { 221, 536, PA_REDUCE, 212 },
+    // State 221 default action
+    { 221, -1, PA_REDUCE, 212 },
+    // State 222
+    { 222, 4, PA_SHIFT, 233 },
+    // State 222
+    { 222, 98, PA_SHIFT, 223 },
+    // State 222
+    { 222, 536, PA_REDUCE, 214 },
+    // State 222 default action
+    { 222, -1, PA_REDUCE, 214 },
+    // State 223
+    { 223, 5, PA_SHIFT, 232 },
+    // State 223
+    { 223, 99, PA_SHIFT, 224 },
+    // State 223
+    { 223, 536, PA_REDUCE, 216 },
+    // State 223 default action
+    { 223, -1, PA_REDUCE, 216 },
+    // State 224
+    { 224, 6, PA_SHIFT, 231 },
+    // State 224
+    { 224, 100, PA_SHIFT, 225 },
+    // State 224
+    { 224, 536, PA_REDUCE, 218 },
+    // State 224 default action
+    { 224, -1, PA_REDUCE, 218 },
+    // State 225
+    { 225, 7, PA_SHIFT, 230 },
+    // State 225
+    { 225, 101, PA_SHIFT, 226 },
+    // State 225
+    { 225, 536, PA_REDUCE, 220 },
+    // State 225 default action
+    { 225, -1, PA_REDUCE, 220 },
+    // State 226
+    { 226, 8, PA_SHIFT, 229 },
+    // State 226
+    { 226, 67, PA_REDUCE, 222 },
+    // State 226
+    { 226, 102, PA_SHIFT, 227 },
+    // State 227
+    { 227, 67, PA_SHIFT, 228 },
+    // State 228
+    { 228, 536, PA_REDUCE, 207 },
+    // State 228 default action
+    { 228, -1, PA_REDUCE, 207 },
+    // State 229
+    { 229, 67, PA_REDUCE, 223 },
+    // State 230
+    { 230, 536, PA_REDUCE, 221 },
+    // State 230 default action
+    { 230, -1, PA_REDUCE, 221 },
+    // State 231
+    { 231, 536, PA_REDUCE, 219 },
+    // State 231 default action
+    { 231, -1, PA_REDUCE, 219 },
+    // State 232
+    { 232, 536, PA_REDUCE, 217 },
+    // State 232 default action
+    { 232, -1, PA_REDUCE, 217 },
+    // State 233
+    { 233, 536, PA_REDUCE, 215 },
+    // State 233 default action
+    { 233, -1, PA_REDUCE, 215 },
+    // State 234
+    { 234, 536, PA_REDUCE, 213 },
+    // State 234 default action
+    { 234, -1, PA_REDUCE, 213 },
+    // State 235
+    { 235, 536, PA_REDUCE, 211 },
+    // State 235 default action
+    { 235, -1, PA_REDUCE, 211 },
+    // State 236
+    { 236, 536, PA_REDUCE, 209 },
+    // State 236 default action
+    { 236, -1, PA_REDUCE, 209 },
+    // State 237
+    { 237, 1, PA_SHIFT, 254 },
+    // State 237
+    { 237, 103, PA_SHIFT, 238 },
+    // State 237
+    { 237, 536, PA_REDUCE, 225 },
+    // State 237 default action
+    { 237, -1, PA_REDUCE, 225 },
+    // State 238
+    { 238, 2, PA_SHIFT, 253 },
+    // State 238
+    { 238, 104, PA_SHIFT, 239 },
+    // State 238
+    { 238, 536, PA_REDUCE, 227 },
+    // State 238 default action
+    { 238, -1, PA_REDUCE, 227 },
+    // State 239
+    { 239, 3, PA_SHIFT, 252 },
+    // State 239
+    { 239, 105, PA_SHIFT, 240 },
+    // State 239
+    { 239, 536, PA_REDUCE, 229 },
+    // State 239 default action
+    { 239, -1, PA_REDUCE, 229 },
+    // State 240
+    { 240, 4, PA_SHIFT, 251 },
+    // State 240
+    { 240, 106, PA_SHIFT, 241 },
+    // State 240
+    { 240, 536, PA_REDUCE, 231 },
+    // State 240 default action
+    { 240, -1, PA_REDUCE, 231 },
+    // State 241
+    { 241, 5, PA_SHIFT, 250 },
+    // State 241
+    { 241, 107, PA_SHIFT, 242 },
+    // State 241
+    { 241, 536, PA_REDUCE, 233 },
+    // State 241 default action
+    { 241, -1, PA_REDUCE, 233 },
+    // State 242
+    { 242, 6, PA_SHIFT, 249 },
+    // State 242
+    { 242, 108, PA_SHIFT, 243 },
+    // State 242
+    { 242, 536, PA_REDUCE, 235 },
+    // State 242 default action
+    { 242, -1, PA_REDUCE, 235 },
+    // State 243
+    { 243, 7, PA_SHIFT, 248 },
+    // State 243
+    { 243, 109, PA_SHIFT, 244 },
+    // State 243
+    { 243, 536, PA_REDUCE, 237 },
+    // State 243 default action
+    { 243, -1, PA_REDUCE, 237 },
+    // State 244
+    { 244, 8, PA_SHIFT, 247 },
+    // State 244
+    { 244, 67, PA_REDUCE, 239 },
+    // State 244
+    { 244, 110, PA_SHIFT, 245 },
+    // State 245
+    { 245, 67, PA_SHIFT, 246 },
+    // State 246
+    { 246, 536, PA_REDUCE, 224 },
+    // State 246 default action
+    { 246, -1, PA_REDUCE, 224 },
+    // State 247
+    { 247, 67, PA_REDUCE, 240 },
+    // State 248
+    { 248, 536, PA_REDUCE, 238 },
+    // State 248 default action
+    { 248, -1, PA_REDUCE, 238 },
+    // State 249
+    { 249, 536, PA_REDUCE, 236 },
+    // State 249 default action
+    { 249, -1, PA_REDUCE, 236 },
+    // State 250
+    { 250, 536, PA_REDUCE, 234 },
+    // State 250 default action
+    { 250, -1, PA_REDUCE, 234 },
+    // State 251
+    { 251, 536, PA_REDUCE, 232 },
+    // State 251 default action
+    { 251, -1, PA_REDUCE, 232 },
+    // State 252
+    { 252, 536, PA_REDUCE, 230 },
+    // State 252 default action
+    { 252, -1, PA_REDUCE, 230 },
+    // State 253
+    { 253, 536, PA_REDUCE, 228 },
+    // State 253 default action
+    { 253, -1, PA_REDUCE, 228 },
+    // State 254
+    { 254, 536, PA_REDUCE, 226 },
+    // State 254 default action
+    { 254, -1, PA_REDUCE, 226 },
+    // State 255
+    { 255, 1, PA_SHIFT, 272 },
+    // State 255
+    { 255, 111, PA_SHIFT, 256 },
+    // State 255
+    { 255, 536, PA_REDUCE, 242 },
+    // State 255 default action
+    { 255, -1, PA_REDUCE, 242 },
+    // State 256
+    { 256, 2, PA_SHIFT, 271 },
+    // State 256
+    { 256, 112, PA_SHIFT, 257 },
+    // State 256
+    { 256, 536, PA_REDUCE, 244 },
+    // State 256 default action
+    { 256, -1, PA_REDUCE, 244 },
+    // State 257
+    { 257, 3, PA_SHIFT, 270 },
+    // State 257
+    { 257, 113, PA_SHIFT, 258 },
+    // State 257
+    { 257, 536, PA_REDUCE, 246 },
+    // State 257 default action
+    { 257, -1, PA_REDUCE, 246 },
+    // State 258
+    { 258, 4, PA_SHIFT, 269 },
+    // State 258
+    { 258, 114, PA_SHIFT, 259 },
+    // State 258
+    { 258, 536, PA_REDUCE, 248 },
+    // State 258 default action
+    { 258, -1, PA_REDUCE, 248 },
+    // State 259
+    { 259, 5, PA_SHIFT, 268 },
+    // State 259
+    { 259, 115, PA_SHIFT, 260 },
+    // State 259
+    { 259, 536, PA_REDUCE, 250 },
+    // State 259 default action
+    { 259, -1, PA_REDUCE, 250 },
+    // State 260
+    { 260, 6, PA_SHIFT, 267 },
+    // State 260
+    { 260, 116, PA_SHIFT, 261 },
+    // State 260
+    { 260, 536, PA_REDUCE, 252 },
+    // State 260 default action
+    { 260, -1, PA_REDUCE, 252 },
+    // State 261
+    { 261, 7, PA_SHIFT, 266 },
+    // State 261
+    { 261, 117, PA_SHIFT, 262 },
+    // State 261
+    { 261, 536, PA_REDUCE, 254 },
+    // State 261 default action
+    { 261, -1, PA_REDUCE, 254 },
+    // State 262
+    { 262, 8, PA_SHIFT, 265 },
+    // State 262
+    { 262, 67, PA_REDUCE, 256 },
+    // State 262
+    { 262, 118, PA_SHIFT, 263 },
+    // State 263
+    { 263, 67, PA_SHIFT, 264 },
+    // State 264
+    { 264, 536, PA_REDUCE, 241 },
+    // State 264 default action
+    { 264, -1, PA_REDUCE, 241 },
+    // State 265
+    { 265, 67, PA_REDUCE, 257 },
+    // State 266
+    { 266, 536, PA_REDUCE, 255 },
+    // State 266 default action
+    { 266, -1, PA_REDUCE, 255 },
+    // State 267
+    { 267, 536, PA_REDUCE, 253 },
+    // State 267 default action
+    { 267, -1, PA_REDUCE, 253 },
+    // State 268
+    { 268, 536, PA_REDUCE, 251 },
+    // State 268 default action
+    { 268, -1, PA_REDUCE, 251 },
+    // State 269
+    { 269, 536, PA_REDUCE, 249 },
+    // State 269 default action
+    { 269, -1, PA_REDUCE, 249 },
+    // State 270
+    { 270, 536, PA_REDUCE, 247 },
+    // State 270 default action
+    { 270, -1, PA_REDUCE, 247 },
+    // State 271
+    { 271, 536, PA_REDUCE, 245 },
+    // State 271 default action
+    { 271, -1, PA_REDUCE, 245 },
+    // State 272
+    { 272, 536, PA_REDUCE, 243 },
+    // State 272 default action
+    { 272, -1, PA_REDUCE, 243 },
+    // State 273
+    { 273, 1, PA_SHIFT, 290 },
+    // State 273
+    { 273, 119, PA_SHIFT, 274 },
+    // State 273
+    { 273, 536, PA_REDUCE, 259 },
+    // State 273 default action
+    { 273, -1, PA_REDUCE, 259 },
+    // State 274
+    { 274, 2, PA_SHIFT, 289 },
+    // State 274
+    { 274, 120, PA_SHIFT, 275 },
+    // State 274
+    { 274, 536, PA_REDUCE, 261 },
+    // State 274 default action
+    { 274, -1, PA_REDUCE, 261 },
+    // State 275
+    { 275, 3, PA_SHIFT, 288 },
+    // State 275
+    { 275, 121, PA_SHIFT, 276 },
+    // State 275
+    { 275, 536, PA_REDUCE, 263 },
+    // State 275 default action
+    { 275, -1, PA_REDUCE, 263 },
+    // State 276
+    { 276, 4, PA_SHIFT, 287 },
+    // State 276
+    { 276, 122, PA_SHIFT, 277 },
+    // State 276
+    { 276, 536, PA_REDUCE, 265 },
+    // State 276 default action
+    { 276, -1, PA_REDUCE, 265 },
+    // State 277
+    { 277, 5, PA_SHIFT, 286 },
+    // State 277
+    { 277, 123, PA_SHIFT, 278 },
+    // State 277
+    { 277, 536, PA_REDUCE, 267 },
+    // State 277 default action
+    { 277, -1, PA_REDUCE, 267 },
+    // State 278
+    { 278, 6, PA_SHIFT, 285 },
+    // State 278
+    { 278, 124, PA_SHIFT, 279 },
+    // State 278
+    { 278, 536, PA_REDUCE, 269 },
+    // State 278 default action
+    { 278, -1, PA_REDUCE, 269 },
+    // State 279
+    { 279, 7, PA_SHIFT, 284 },
+    // State 279
+    { 279, 125, PA_SHIFT, 280 },
+    // State 279
+    { 279, 536, PA_REDUCE, 271 },
+    // State 279 default action
+    { 279, -1, PA_REDUCE, 271 },
+    // State 280
+    { 280, 8, PA_SHIFT, 283 },
+    // State 280
+    { 280, 67, PA_REDUCE, 273 },
+    // State 280
+    { 280, 126, PA_SHIFT, 281 },
+    // State 281
+    { 281, 67, PA_SHIFT, 282 },
+    // State 282
+    { 282, 536, PA_REDUCE, 258 },
+    // State 282 default action
+    { 282, -1, PA_REDUCE, 258 },
+    // State 283
+    { 283, 67, PA_REDUCE, 274 },
+    // State 284
+    { 284, 536, PA_REDUCE, 272 },
+    // State 284 default action
+    { 284, -1, PA_REDUCE, 272 },
+    // State 285
+    { 285, 536, PA_REDUCE, 270 },
+    // State 285 default action
+    { 285, -1, PA_REDUCE, 270 },
+    // State 286
+    { 286, 536, PA_REDUCE, 268 },
+    // State 286 default action
+    { 286, -1, PA_REDUCE, 268 },
+    // State 287
+    { 287, 536, PA_REDUCE, 266 },
+    // State 287 default action
+    { 287, -1, PA_REDUCE, 266 },
+    // State 288
+    { 288, 536, PA_REDUCE, 264 },
+    // State 288 default action
+    { 288, -1, PA_REDUCE, 264 },
+    // State 289
+    { 289, 536, PA_REDUCE, 262 },
+    // State 289 default action
+    { 289, -1, PA_REDUCE, 262 },
+    // State 290
+    { 290, 536, PA_REDUCE, 260 },
+    // State 290 default action
+    { 290, -1, PA_REDUCE, 260 },
+    // State 291
+    { 291, 1, PA_SHIFT, 308 },
+    // State 291
+    { 291, 127, PA_SHIFT, 292 },
+    // State 291
+    { 291, 536, PA_REDUCE, 276 },
+    // State 291 default action
+    { 291, -1, PA_REDUCE, 276 },
+    // State 292
+    { 292, 2, PA_SHIFT, 307 },
+    // State 292
+    { 292, 128, PA_SHIFT, 293 },
+    // State 292
+    { 292, 536, PA_REDUCE, 278 },
+    // State 292 default action
+    { 292, -1, PA_REDUCE, 278 },
+    // State 293
+    { 293, 3, PA_SHIFT, 306 },
+    // State 293
+    { 293, 129, PA_SHIFT, 294 },
+    // State 293
+    { 293, 536, PA_REDUCE, 280 },
+    // State 293 default action
+    { 293, -1, PA_REDUCE, 280 },
+    // State 294
+    { 294, 4, PA_SHIFT, 305 },
+    // State 294
+    { 294, 130, PA_SHIFT, 295 },
+    // State 294
+    { 294, 536, PA_REDUCE, 282 },
+    // State 294 default action
+    { 294, -1, PA_REDUCE, 282 },
+    // State 295
+    { 295, 5, PA_SHIFT, 304 },
+    // State 295
+    { 295, 131, PA_SHIFT, 296 },
+    // State 295
+    { 295, 536, PA_REDUCE, 284 },
+    // State 295 default action
+    { 295, -1, PA_REDUCE, 284 },
+    // State 296
+    { 296, 6, PA_SHIFT, 303 },
+    // State 296
+    { 296, 132, PA_SHIFT, 297 },
+    // State 296
+    { 296, 536, PA_REDUCE, 286 },
+    // State 296 default action
+    { 296, -1, PA_REDUCE, 286 },
+    // State 297
+    { 297, 7, PA_SHIFT, 302 },
+    // State 297
+    { 297, 133, PA_SHIFT, 298 },
+    // State 297
+    { 297, 536, PA_REDUCE, 288 },
+    // State 297 default action
+    { 297, -1, PA_REDUCE, 288 },
+    // State 298
+    { 298, 8, PA_SHIFT, 301 },
+    // State 298
+    { 298, 67, PA_REDUCE, 290 },
+    // State 298
+    { 298, 134, PA_SHIFT, 299 },
+    // State 299
+    { 299, 67, PA_SHIFT, 300 },
+    // State 300
+    { 300, 536, PA_REDUCE, 275 },
+    // State 300 default action
+    { 300, -1, PA_REDUCE, 275 },
+    // State 301
+    { 301, 67, PA_REDUCE, 291 },
+    // State 302
+    { 302, 536, PA_REDUCE, 289 },
+    // State 302 default action
+    { 302, -1, PA_REDUCE, 289 },
+    // State 303
+    { 303, 536, PA_REDUCE, 287 },
+    // State 303 default action
+    { 303, -1, PA_REDUCE, 287 },
+    // State 304
+    { 304, 536, PA_REDUCE, 285 },
+    // State 304 default action
+    { 304, -1, PA_REDUCE, 285 },
+    // State 305
+    { 305, 536, PA_REDUCE, 283 },
+    // State 305 default action
+    { 305, -1, PA_REDUCE, 283 },
+    // State 306
+    { 306, 536, PA_REDUCE, 281 },
+    // State 306 default action
+    { 306, -1, PA_REDUCE, 281 },
+    // State 307
+    { 307, 536, PA_REDUCE, 279 },
+    // State 307 default action
+    { 307, -1, PA_REDUCE, 279 },
+    // State 308
+    { 308, 536, PA_REDUCE, 277 },
+    // State 308 default action
+    { 308, -1, PA_REDUCE, 277 },
+    // State 309
+    { 309, 1, PA_SHIFT, 326 },
+    // State 309
+    { 309, 135, PA_SHIFT, 310 },
+    // State 309
+    { 309, 536, PA_REDUCE, 293 },
+    // State 309 default action
+    { 309, -1, PA_REDUCE, 293 },
+    // State 310
+    { 310, 2, PA_SHIFT, 325 },
+    // State 310
+    { 310, 136, PA_SHIFT, 311 },
+    // State 310
+    { 310, 536, PA_REDUCE, 295 },
+    // State 310 default action
+    { 310, -1, PA_REDUCE, 295 },
+    // State 311
+    { 311, 3, PA_SHIFT, 324 },
+    // State 311
+    { 311, 137, PA_SHIFT, 312 },
+    // State 311
+    { 311, 536, PA_REDUCE, 297 },
+    // State 311 default action
+    { 311, -1, PA_REDUCE, 297 },
+    // State 312
+    { 312, 4, PA_SHIFT, 323 },
+    // State 312
+    { 312, 138, PA_SHIFT, 313 },
+    // State 312
+    { 312, 536, PA_REDUCE, 299 },
+    // State 312 default action
+    { 312, -1, PA_REDUCE, 299 },
+    // State 313
+    { 313, 5, PA_SHIFT, 322 },
+    // State 313
+    { 313, 139, PA_SHIFT, 314 },
+    // State 313
+    { 313, 536, PA_REDUCE, 301 },
+    // State 313 default action
+    { 313, -1, PA_REDUCE, 301 },
+    // State 314
+    { 314, 6, PA_SHIFT, 321 },
+    // State 314
+    { 314, 140, PA_SHIFT, 315 },
+    // State 314
+    { 314, 536, PA_REDUCE, 303 },
+    // State 314 default action
+    { 314, -1, PA_REDUCE, 303 },
+    // State 315
+    { 315, 7, PA_SHIFT, 320 },
+    // State 315
+    { 315, 141, PA_SHIFT, 316 },
+    // State 315
+    { 315, 536, PA_REDUCE, 305 },
+    // State 315 default action
+    { 315, -1, PA_REDUCE, 305 },
+    // State 316
+    { 316, 8, PA_SHIFT, 319 },
+    // State 316
+    { 316, 67, PA_REDUCE, 307 },
+    // State 316
+    { 316, 142, PA_SHIFT, 317 },
+    // State 317
+    { 317, 67, PA_SHIFT, 318 },
+    // State 318
+    { 318, 536, PA_REDUCE, 292 },
+    // State 318 default action
+    { 318, -1, PA_REDUCE, 292 },
+    // State 319
+    { 319, 67, PA_REDUCE, 308 },
+    // State 320
+    { 320, 536, PA_REDUCE, 306 },
+    // State 320 default action
+    { 320, -1, PA_REDUCE, 306 },
+    // State 321
+    { 321, 536, PA_REDUCE, 304 },
+    // State 321 default action
+    { 321, -1, PA_REDUCE, 304 },
+    // State 322
+    { 322, 536, PA_REDUCE, 302 },
+    // State 322 default action
+    { 322, -1, PA_REDUCE, 302 },
+    // State 323
+    { 323, 536, PA_REDUCE, 300 },
+    // State 323 default action
+    { 323, -1, PA_REDUCE, 300 },
+    // State 324
+    { 324, 536, PA_REDUCE, 298 },
+    // State 324 default action
+    { 324, -1, PA_REDUCE, 298 },
+    // State 325
+    { 325, 536, PA_REDUCE, 296 },
+    // State 325 default action
+    { 325, -1, PA_REDUCE, 296 },
+    // State 326
+    { 326, 536, PA_REDUCE, 294 },
+    // State 326 default action
+    { 326, -1, PA_REDUCE, 294 },
+    // State 327
+    { 327, 1, PA_SHIFT, 344 },
+    // State 327
+    { 327, 143, PA_SHIFT, 328 },
+    // State 327
+    { 327, 536, PA_REDUCE, 310 },
+    // State 327 default action
+    { 327, -1, PA_REDUCE, 310 },
+    // State 328
+    { 328, 2, PA_SHIFT, 343 },
+    // State 328
+    { 328, 144, PA_SHIFT, 329 },
+    // State 328
+    { 328, 536, PA_REDUCE, 312 },
+    // State 328 default action
+    { 328, -1, PA_REDUCE, 312 },
+    // State 329
+    { 329, 3, PA_SHIFT, 342 },
+    // State 329
+    { 329, 145, PA_SHIFT, 330 },
+    // State 329
+    { 329, 536, PA_REDUCE, 314 },
+    // State 329 default action
+    { 329, -1, PA_REDUCE, 314 },
+    // State 330
+    { 330, 4, PA_SHIFT, 341 },
+    // State 330
+    { 330, 146, PA_SHIFT, 331 },
+    // State 330
+    { 330, 536, PA_REDUCE, 316 },
+    // State 330 default action
+    { 330, -1, PA_REDUCE, 316 },
+    // State 331
+    { 331, 5, PA_SHIFT, 340 },
+    // State 331
+    { 331, 147, PA_SHIFT, 332 },
+    // State 331
+    { 331, 536, PA_REDUCE, 318 },
+    // State 331 default action
+    { 331, -1, PA_REDUCE, 318 },
+    // State 332
+    { 332, 6, PA_SHIFT, 339 },
+    // State 332
+    { 332, 148, PA_SHIFT, 333 },
+    // State 332
+    { 332, 536, PA_REDUCE, 320 },
+    // State 332 default action
+    { 332, -1, PA_REDUCE, 320 },
+    // State 333
+    { 333, 7, PA_SHIFT, 338 },
+    // State 333
+    { 333, 149, PA_SHIFT, 334 },
+    // State 333
+    { 333, 536, PA_REDUCE, 322 },
+    // State 333 default action
+    { 333, -1, PA_REDUCE, 322 },
+    // State 334
+    { 334, 8, PA_SHIFT, 337 },
+    // State 334
+    { 334, 67, PA_REDUCE, 324 },
+    // State 334
+    { 334, 150, PA_SHIFT, 335 },
+    // State 335
+    { 335, 67, PA_SHIFT, 336 },
+    // State 336
+    { 336, 536, PA_REDUCE, 309 },
+    // State 336 default action
+    { 336, -1, PA_REDUCE, 309 },
+    // State 337
+    { 337, 67, PA_REDUCE, 325 },
+    // State 338
+    { 338, 536, PA_REDUCE, 323 },
+    // State 338 default action
+    { 338, -1, PA_REDUCE, 323 },
+    // State 339
+    { 339, 536, PA_REDUCE, 321 },
+    // State 339 default action
+    { 339, -1, PA_REDUCE, 321 },
+    // State 340
+    { 340, 536, PA_REDUCE, 319 },
+    // State 340 default action
+    { 340, -1, PA_REDUCE, 319 },
+    // State 341
+    { 341, 536, PA_REDUCE, 317 },
+    // State 341 default action
+    { 341, -1, PA_REDUCE, 317 },
+    // State 342
+    { 342, 536, PA_REDUCE, 315 },
+    // State 342 default action
+    { 342, -1, PA_REDUCE, 315 },
+    // State 343
+    { 343, 536, PA_REDUCE, 313 },
+    // State 343 default action
+    { 343, -1, PA_REDUCE, 313 },
+    // State 344
+    { 344, 536, PA_REDUCE, 311 },
+    // State 344 default action
+    { 344, -1, PA_REDUCE, 311 },
+    // State 345
+    { 345, 1, PA_SHIFT, 362 },
+    // State 345
+    { 345, 151, PA_SHIFT, 346 },
+    // State 345
+    { 345, 536, PA_REDUCE, 327 },
+    // State 345 default action
+    { 345, -1, PA_REDUCE, 327 },
+    // State 346
+    { 346, 2, PA_SHIFT, 361 },
+    // State 346
+    { 346, 152, PA_SHIFT, 347 },
+    // State 346
+    { 346, 536, PA_REDUCE, 329 },
+    // State 346 default action
+    { 346, -1, PA_REDUCE, 329 },
+    // State 347
+    { 347, 3, PA_SHIFT, 360 },
+    // State 347
+    { 347, 153, PA_SHIFT, 348 },
+    // State 347
+    { 347, 536, PA_REDUCE, 331 },
+    // State 347 default action
+    { 347, -1, PA_REDUCE, 331 },
+    // State 348
+    { 348, 4, PA_SHIFT, 359 },
+    // State 348
+    { 348, 154, PA_SHIFT, 349 },
+    // State 348
+    { 348, 536, PA_REDUCE, 333 },
+    // State 348 default action
+    { 348, -1, PA_REDUCE, 333 },
+    // State 349
+    { 349, 5, PA_SHIFT, 358 },
+    // State 349
+    { 349, 155, PA_SHIFT, 350 },
+    // State 349
+    { 349, 536, PA_REDUCE, 335 },
+    // State 349 default action
+    { 349, -1, PA_REDUCE, 335 },
+    // State 350
+    { 350, 6, PA_SHIFT, 357 },
+    // State 350
+    { 350, 156, PA_SHIFT, 351 },
+    // State 350
+    { 350, 536, PA_REDUCE, 337 },
+    // State 350 default action
+    { 350, -1, PA_REDUCE, 337 },
+    // State 351
+    { 351, 7, PA_SHIFT, 356 },
+    // State 351
+    { 351, 157, PA_SHIFT, 352 },
+    // State 351
+    { 351, 536, PA_REDUCE, 339 },
+    // State 351 default action
+    { 351, -1, PA_REDUCE, 339 },
+    // State 352
+    { 352, 8, PA_SHIFT, 355 },
+    // State 352
+    { 352, 67, PA_REDUCE, 341 },
+    // State 352
+    { 352, 158, PA_SHIFT, 353 },
+    // State 353
+    { 353, 67, PA_SHIFT, 354 },
+    // State 354
+    { 354, 536, PA_REDUCE, 326 },
+    // State 354 default action
+    { 354, -1, PA_REDUCE, 326 },
+    // State 355
+    { 355, 67, PA_REDUCE, 342 },
+    // State 356
+    { 356, 536, PA_REDUCE, 340 },
+    // State 356 default action
+    { 356, -1, PA_REDUCE, 340 },
+    // State 357
+    { 357, 536, PA_REDUCE, 338 },
+    // State 357 default action
+    { 357, -1, PA_REDUCE, 338 },
+    // State 358
+    { 358, 536, PA_REDUCE, 336 },
+    // State 358 default action
+    { 358, -1, PA_REDUCE, 336 },
+    // State 359
+    { 359, 536, PA_REDUCE, 334 },
+    // State 359 default action
+    { 359, -1, PA_REDUCE, 334 },
+    // State 360
+    { 360, 536, PA_REDUCE, 332 },
+    // State 360 default action
+    { 360, -1, PA_REDUCE, 332 },
+    // State 361
+    { 361, 536, PA_REDUCE, 330 },
+    // State 361 default action
+    { 361, -1, PA_REDUCE, 330 },
+    // State 362
+    { 362, 536, PA_REDUCE, 328 },
+    // State 362 default action
+    { 362, -1, PA_REDUCE, 328 },
+    // State 363
+    { 363, 1, PA_SHIFT, 380 },
+    // State 363
+    { 363, 167, PA_SHIFT, 364 },
+    // State 363
+    { 363, 536, PA_REDUCE, 344 },
+    // State 363 default action
+    { 363, -1, PA_REDUCE, 344 },
+    // State 364
+    { 364, 2, PA_SHIFT, 379 },
+    // State 364
+    { 364, 168, PA_SHIFT, 365 },
+    // State 364
+    { 364, 536, PA_REDUCE, 346 },
+    // State 364 default action
+    { 364, -1, PA_REDUCE, 346 },
+    // State 365
+    { 365, 3, PA_SHIFT, 378 },
+    // State 365
+    { 365, 169, PA_SHIFT, 366 },
+    // State 365
+    { 365, 536, PA_REDUCE, 348 },
+    // State 365 default action
+    { 365, -1, PA_REDUCE, 348 },
+    // State 366
+    { 366, 4, PA_SHIFT, 377 },
+    // State 366
+    { 366, 170, PA_SHIFT, 367 },
+    // State 366
+    { 366, 536, PA_REDUCE, 350 },
+    // State 366 default action
+    { 366, -1, PA_REDUCE, 350 },
+    // State 367
+    { 367, 5, PA_SHIFT, 376 },
+    // State 367
+    { 367, 171, PA_SHIFT, 368 },
+    // State 367
+    { 367, 536, PA_REDUCE, 352 },
+    // State 367 default action
+    { 367, -1, PA_REDUCE, 352 },
+    // State 368
+    { 368, 6, PA_SHIFT, 375 },
+    // State 368
+    { 368, 172, PA_SHIFT, 369 },
+    // State 368
+    { 368, 536, PA_REDUCE, 354 },
+    // State 368 default action
+    { 368, -1, PA_REDUCE, 354 },
+    // State 369
+    { 369, 7, PA_SHIFT, 374 },
+    // State 369
+    { 369, 173, PA_SHIFT, 370 },
+    // State 369
+    { 369, 536, PA_REDUCE, 356 },
+    // State 369 default action
+    { 369, -1, PA_REDUCE, 356 },
+    // State 370
+    { 370, 8, PA_SHIFT, 373 },
+    // State 370
+    { 370, 67, PA_REDUCE, 358 },
+    // State 370
+    { 370, 174, PA_SHIFT, 371 },
+    // State 371
+    { 371, 67, PA_SHIFT, 372 },
+    // State 372
+    { 372, 536, PA_REDUCE, 343 },
+    // State 372 default action
+    { 372, -1, PA_REDUCE, 343 },
+    // State 373
+    { 373, 67, PA_REDUCE, 359 },
+    // State 374
+    { 374, 536, PA_REDUCE, 357 },
+    // State 374 default action
+    { 374, -1, PA_REDUCE, 357 },
+    // State 375
+    { 375, 536, PA_REDUCE, 355 },
+    // State 375 default action
+    { 375, -1, PA_REDUCE, 355 },
+    // State 376
+    { 376, 536, PA_REDUCE, 353 },
+    // State 376 default action
+    { 376, -1, PA_REDUCE, 353 },
+    // State 377
+    { 377, 536, PA_REDUCE, 351 },
+    // State 377 default action
+    { 377, -1, PA_REDUCE, 351 },
+    // State 378
+    { 378, 536, PA_REDUCE, 349 },
+    // State 378 default action
+    { 378, -1, PA_REDUCE, 349 },
+    // State 379
+    { 379, 536, PA_REDUCE, 347 },
+    // State 379 default action
+    { 379, -1, PA_REDUCE, 347 },
+    // State 380
+    { 380, 536, PA_REDUCE, 345 },
+    // State 380 default action
+    { 380, -1, PA_REDUCE, 345 },
+    // State 381
+    { 381, 1, PA_SHIFT, 398 },
+    // State 381
+    { 381, 175, PA_SHIFT, 382 },
+    // State 381
+    { 381, 536, PA_REDUCE, 361 },
+    // State 381 default action
+    { 381, -1, PA_REDUCE, 361 },
+    // State 382
+    { 382, 2, PA_SHIFT, 397 },
+    // State 382
+    { 382, 176, PA_SHIFT, 383 },
+    // State 382
+    { 382, 536, PA_REDUCE, 363 },
+    // State 382 default action
+    { 382, -1, PA_REDUCE, 363 },
+    // State 383
+    { 383, 3, PA_SHIFT, 396 },
+    // State 383
+    { 383, 177, PA_SHIFT, 384 },
+    // State 383
+    { 383, 536, PA_REDUCE, 365 },
+    // State 383 default action
+    { 383, -1, PA_REDUCE, 365 },
+    // State 384
+    { 384, 4, PA_SHIFT, 395 },
+    // State 384
+    { 384, 178, PA_SHIFT, 385 },
+    // State 384
+    { 384, 536, PA_REDUCE, 367 },
+    // State 384 default action
+    { 384, -1, PA_REDUCE, 367 },
+    // State 385
+    { 385, 5, PA_SHIFT, 394 },
+    // State 385
+    { 385, 179, PA_SHIFT, 386 },
+    // State 385
+    { 385, 536, PA_REDUCE, 369 },
+    // State 385 default action
+    { 385, -1, PA_REDUCE, 369 },
+    // State 386
+    { 386, 6, PA_SHIFT, 393 },
+    // State 386
+    { 386, 180, PA_SHIFT, 387 },
+    // State 386
+    { 386, 536, PA_REDUCE, 371 },
+    // State 386 default action
+    { 386, -1, PA_REDUCE, 371 },
+    // State 387
+    { 387, 7, PA_SHIFT, 392 },
+    // State 387
+    { 387, 181, PA_SHIFT, 388 },
+    // State 387
+    { 387, 536, PA_REDUCE, 373 },
+    // State 387 default action
+    { 387, -1, PA_REDUCE, 373 },
+    // State 388
+    { 388, 8, PA_SHIFT, 391 },
+    // State 388
+    { 388, 67, PA_REDUCE, 375 },
+    // State 388
+    { 388, 182, PA_SHIFT, 389 },
+    // State 389
+    { 389, 67, PA_SHIFT, 390 },
+    // State 390
+    { 390, 536, PA_REDUCE, 360 },
+    // State 390 default action
+    { 390, -1, PA_REDUCE, 360 },
+    // State 391
+    { 391, 67, PA_REDUCE, 376 },
+    // State 392
+    { 392, 536, PA_REDUCE, 374 },
+    // State 392 default action
+    { 392, -1, PA_REDUCE, 374 },
+    // State 393
+    { 393, 536, PA_REDUCE, 372 },
+    // State 393 default action
+    { 393, -1, PA_REDUCE, 372 },
+    // State 394
+    { 394, 536, PA_REDUCE, 370 },
+    // State 394 default action
+    { 394, -1, PA_REDUCE, 370 },
+    // State 395
+    { 395, 536, PA_REDUCE, 368 },
+    // State 395 default action
+    { 395, -1, PA_REDUCE, 368 },
+    // State 396
+    { 396, 536, PA_REDUCE, 366 },
+    // State 396 default action
+    { 396, -1, PA_REDUCE, 366 },
+    // State 397
+    { 397, 536, PA_REDUCE, 364 },
+    // State 397 default action
+    { 397, -1, PA_REDUCE, 364 },
+    // State 398
+    { 398, 536, PA_REDUCE, 362 },
+    // State 398 default action
+    { 398, -1, PA_REDUCE, 362 },
+    // State 399
+    { 399, 1, PA_SHIFT, 416 },
+    // State 399
+    { 399, 183, PA_SHIFT, 400 },
+    // State 399
+    { 399, 536, PA_REDUCE, 378 },
+    // State 399 default action
+    { 399, -1, PA_REDUCE, 378 },
+    // State 400
+    { 400, 2, PA_SHIFT, 415 },
+    // State 400
+    { 400, 184, PA_SHIFT, 401 },
+    // State 400
+    { 400, 536, PA_REDUCE, 380 },
+    // State 400 default action
+    { 400, -1, PA_REDUCE, 380 },
+    // State 401
+    { 401, 3, PA_SHIFT, 414 },
+    // State 401
+    { 401, 185, PA_SHIFT, 402 },
+    // State 401
+    { 401, 536, PA_REDUCE, 382 },
+    // State 401 default action
+    { 401, -1, PA_REDUCE, 382 },
+    // State 402
+    { 402, 4, PA_SHIFT, 413 },
+    // State 402
+    { 402, 186, PA_SHIFT, 403 },
+    // State 402
+    { 402, 536, PA_REDUCE, 384 },
+    // State 402 default action
+    { 402, -1, PA_REDUCE, 384 },
+    // State 403
+    { 403, 5, PA_SHIFT, 412 },
+    // State 403
+    { 403, 187, PA_SHIFT, 404 },
+    // State 403
+    { 403, 536, PA_REDUCE, 386 },
+    // State 403 default action
+    { 403, -1, PA_REDUCE, 386 },
+    // State 404
+    { 404, 6, PA_SHIFT, 411 },
+    // State 404
+    { 404, 188, PA_SHIFT, 405 },
+    // State 404
+    { 404, 536, PA_REDUCE, 388 },
+    // State 404 default action
+    { 404, -1, PA_REDUCE, 388 },
+    // State 405
+    { 405, 7, PA_SHIFT, 410 },
+    // State 405
+    { 405, 189, PA_SHIFT, 406 },
+    // State 405
+    { 405, 536, PA_REDUCE, 390 },
+    // State 405 default action
+    { 405, -1, PA_REDUCE, 390 },
+    // State 406
+    { 406, 8, PA_SHIFT, 409 },
+    // State 406
+    { 406, 67, PA_REDUCE, 392 },
+    // State 406
+    { 406, 190, PA_SHIFT, 407 },
+    // State 407
+    { 407, 67, PA_SHIFT, 408 },
+    // State 408
+    { 408, 536, PA_REDUCE, 377 },
+    // State 408 default action
+    { 408, -1, PA_REDUCE, 377 },
+    // State 409
+    { 409, 67, PA_REDUCE, 393 },
+    // State 410
+    { 410, 536, PA_REDUCE, 391 },
+    // State 410 default action
+    { 410, -1, PA_REDUCE, 391 },
+    // State 411
+    { 411, 536, PA_REDUCE, 389 },
+    // State 411 default action
+    { 411, -1, PA_REDUCE, 389 },
+    // State 412
+    { 412, 536, PA_REDUCE, 387 },
+    // State 412 default action
+    { 412, -1, PA_REDUCE, 387 },
+    // State 413
+    { 413, 536, PA_REDUCE, 385 },
+    // State 413 default action
+    { 413, -1, PA_REDUCE, 385 },
+    // State 414
+    { 414, 536, PA_REDUCE, 383 },
+    // State 414 default action
+    { 414, -1, PA_REDUCE, 383 },
+    // State 415
+    { 415, 536, PA_REDUCE, 381 },
+    // State 415 default action
+    { 415, -1, PA_REDUCE, 381 },
+    // State 416
+    { 416, 536, PA_REDUCE, 379 },
+    // State 416 default action
+    { 416, -1, PA_REDUCE, 379 },
+    // State 417
+    { 417, 1, PA_SHIFT, 434 },
+    // State 417
+    { 417, 191, PA_SHIFT, 418 },
+    // State 417
+    { 417, 536, PA_REDUCE, 395 },
+    // State 417 default action
+    { 417, -1, PA_REDUCE, 395 },
+    // State 418
+    { 418, 2, PA_SHIFT, 433 },
+    // State 418
+    { 418, 192, PA_SHIFT, 419 },
+    // State 418
+    { 418, 536, PA_REDUCE, 397 },
+    // State 418 default action
+    { 418, -1, PA_REDUCE, 397 },
+    // State 419
+    { 419, 3, PA_SHIFT, 432 },
+    // State 419
+    { 419, 193, PA_SHIFT, 420 },
+    // State 419
+    { 419, 536, PA_REDUCE, 399 },
+    // State 419 default action
+    { 419, -1, PA_REDUCE, 399 },
+    // State 420
+    { 420, 4, PA_SHIFT, 431 },
+    // State 420
+    { 420, 194, PA_SHIFT, 421 },
+    // State 420
+    { 420, 536, PA_REDUCE, 401 },
+    // State 420 default action
+    { 420, -1, PA_REDUCE, 401 },
+    // State 421
+    { 421, 5, PA_SHIFT, 430 },
+    // State 421
+    { 421, 195, PA_SHIFT, 422 },
+    // State 421
+    { 421, 536, PA_REDUCE, 403 },
+    // State 421 default action
+    { 421, -1, PA_REDUCE, 403 },
+    // State 422
+    { 422, 6, PA_SHIFT, 429 },
+    // State 422
+    { 422, 196, PA_SHIFT, 423 },
+    // State 422
+    { 422, 536, PA_REDUCE, 405 },
+    // State 422 default action
+    { 422, -1, PA_REDUCE, 405 },
+    // State 423
+    { 423, 7, PA_SHIFT, 428 },
+    // State 423
+    { 423, 197, PA_SHIFT, 424 },
+    // State 423
+    { 423, 536, PA_REDUCE, 407 },
+    // State 423 default action
+    { 423, -1, PA_REDUCE, 407 },
+    // State 424
+    { 424, 8, PA_SHIFT, 427 },
+    // State 424
+    { 424, 67, PA_REDUCE, 409 },
+    // State 424
+    { 424, 198, PA_SHIFT, 425 },
+    // State 425
+    { 425, 67, PA_SHIFT, 426 },
+    // State 426
+    { 426, 536, PA_REDUCE, 394 },
+    // State 426 default action
+    { 426, -1, PA_REDUCE, 394 },
+    // State 427
+    { 427, 67, PA_REDUCE, 410 },
+    // State 428
+    { 428, 536, PA_REDUCE, 408 },
+    // State 428 default action
+    { 428, -1, PA_REDUCE, 408 },
+    // State 429
+    { 429, 536, PA_REDUCE, 406 },
+    // State 429 default action
+    { 429, -1, PA_REDUCE, 406 },
+    // State 430
+    { 430, 536, PA_REDUCE, 404 },
+    // State 430 default action
+    { 430, -1, PA_REDUCE, 404 },
+    // State 431
+    { 431, 536, PA_REDUCE, 402 },
+    // State 431 default action
+    { 431, -1, PA_REDUCE, 402 },
+    // State 432
+    { 432, 536, PA_REDUCE, 400 },
+    // State 432 default action
+    { 432, -1, PA_REDUCE, 400 },
+    // State 433
+    { 433, 536, PA_REDUCE, 398 },
+    // State 433 default action
+    { 433, -1, PA_REDUCE, 398 },
+    // State 434
+    { 434, 536, PA_REDUCE, 396 },
+    // State 434 default action
+    { 434, -1, PA_REDUCE, 396 },
+    // State 435
+    { 435, 1, PA_SHIFT, 452 },
+    // State 435
+    { 435, 199, PA_SHIFT, 436 },
+    // State 435
+    { 435, 536, PA_REDUCE, 412 },
+    // State 435 default action
+    { 435, -1, PA_REDUCE, 412 },
+    // State 436
+    { 436, 2, PA_SHIFT, 451 },
+    // State 436
+    { 436, 200, PA_SHIFT, 437 },
+    // State 436
+    { 436, 536, PA_REDUCE, 414 },
+    // State 436 default action
+    { 436, -1, PA_REDUCE, 414 },
+    // State 437
+    { 437, 3, PA_SHIFT, 450 },
+    // State 437
+    { 437, 201, PA_SHIFT, 438 },
+    // State 437
+    { 437, 536, PA_REDUCE, 416 },
+    // State 437 default action
+    { 437, -1, PA_REDUCE, 416 },
+    // State 438
+    { 438, 4, PA_SHIFT, 449 },
+    // State 438
+    { 438, 202, PA_SHIFT, 439 },
+    // State 438
+    { 438, 536, PA_REDUCE, 418 },
+    // State 438 default action
+    { 438, -1, PA_REDUCE, 418 },
+    // State 439
+    { 439, 5, PA_SHIFT, 448 },
+    // State 439
+    { 439, 203, PA_SHIFT, 440 },
+    // State 439
+    { 439, 536, PA_REDUCE, 420 },
+    // State 439 default action
+    { 439, -1, PA_REDUCE, 420 },
+    // State 440
+    { 440, 6, PA_SHIFT, 447 },
+    // State 440
+    { 440, 204, PA_SHIFT, 441 },
+    // State 440
+    { 440, 536, PA_REDUCE, 422 },
+    // State 440 default action
+    { 440, -1, PA_REDUCE, 422 },
+    // State 441
+    { 441, 7, PA_SHIFT, 446 },
+    // State 441
+    { 441, 205, PA_SHIFT, 442 },
+    // State 441
+    { 441, 536, PA_REDUCE, 424 },
+    // State 441 default action
+    { 441, -1, PA_REDUCE, 424 },
+    // State 442
+    { 442, 8, PA_SHIFT, 445 },
+    // State 442
+    { 442, 67, PA_REDUCE, 426 },
+    // State 442
+    { 442, 206, PA_SHIFT, 443 },
+    // State 443
+    { 443, 67, PA_SHIFT, 444 },
+    // State 444
+    { 444, 536, PA_REDUCE, 411 },
+    // State 444 default action
+    { 444, -1, PA_REDUCE, 411 },
+    // State 445
+    { 445, 67, PA_REDUCE, 427 },
+    // State 446
+    { 446, 536, PA_REDUCE, 425 },
+    // State 446 default action
+    { 446, -1, PA_REDUCE, 425 },
+    // State 447
+    { 447, 536, PA_REDUCE, 423 },
+    // State 447 default action
+    { 447, -1, PA_REDUCE, 423 },
+    // State 448
+    { 448, 536, PA_REDUCE, 421 },
+    // State 448 default action
+    { 448, -1, PA_REDUCE, 421 },
+    // State 449
+    { 449, 536, PA_REDUCE, 419 },
+    // State 449 default action
+    { 449, -1, PA_REDUCE, 419 },
+    // State 450
+    { 450, 536, PA_REDUCE, 417 },
+    // State 450 default action
+    { 450, -1, PA_REDUCE, 417 },
+    // State 451
+    { 451, 536, PA_REDUCE, 415 },
+    // State 451 default action
+    { 451, -1, PA_REDUCE, 415 },
+    // State 452
+    { 452, 536, PA_REDUCE, 413 },
+    // State 452 default action
+    { 452, -1, PA_REDUCE, 413 },
+    // State 453
+    { 453, 1, PA_SHIFT, 470 },
+    // State 453
+    { 453, 207, PA_SHIFT, 454 },
+    // State 453
+    { 453, 536, PA_REDUCE, 429 },
+    // State 453 default action
+    { 453, -1, PA_REDUCE, 429 },
+    // State 454
+    { 454, 2, PA_SHIFT, 469 },
+    // State 454
+    { 454, 208, PA_SHIFT, 455 },
+    // State 454
+    { 454, 536, PA_REDUCE, 431 },
+    // State 454 default action
+    { 454, -1, PA_REDUCE, 431 },
+    // State 455
+    { 455, 3, PA_SHIFT, 468 },
+    // State 455
+    { 455, 209, PA_SHIFT, 456 },
+    // State 455
+    { 455, 536, PA_REDUCE, 433 },
+    // State 455 default action
+    { 455, -1, PA_REDUCE, 433 },
+    // State 456
+    { 456, 4, PA_SHIFT, 467 },
+    // State 456
+    { 456, 210, PA_SHIFT, 457 },
+    // State 456
+    { 456, 536, PA_REDUCE, 435 },
+    // State 456 default action
+    { 456, -1, PA_REDUCE, 435 },
+    // State 457
+    { 457, 5, PA_SHIFT, 466 },
+    // State 457
+    { 457, 211, PA_SHIFT, 458 },
+    // State 457
+    { 457, 536, PA_REDUCE, 437 },
+    // State 457 default action
+    { 457, -1, PA_REDUCE, 437 },
+    // State 458
+    { 458, 6, PA_SHIFT, 465 },
+    // State 458
+    { 458, 212, PA_SHIFT, 459 },
+    // State 458
+    { 458, 536, PA_REDUCE, 439 },
+    // State 458 default action
+    { 458, -1, PA_REDUCE, 439 },
+    // State 459
+    { 459, 7, PA_SHIFT, 464 },
+    // State 459
+    { 459, 213, PA_SHIFT, 460 },
+    // State 459
+    { 459, 536, PA_REDUCE, 441 },
+    // State 459 default action
+    { 459, -1, PA_REDUCE, 441 },
+    // State 460
+    { 460, 8, PA_SHIFT, 463 },
+    // State 460
+    { 460, 67, PA_REDUCE, 443 },
+    // State 460
+    { 460, 214, PA_SHIFT, 461 },
+    // State 461
+    { 461, 67, PA_SHIFT, 462 },
+    // State 462
+    { 462, 536, PA_REDUCE, 428 },
+    // State 462 default action
+    { 462, -1, PA_REDUCE, 428 },
+    // State 463
+    { 463, 67, PA_REDUCE, 444 },
+    // State 464
+    { 464, 536, PA_REDUCE, 442 },
+    // State 464 default action
+    { 464, -1, PA_REDUCE, 442 },
+    // State 465
+    { 465, 536, PA_REDUCE, 440 },
+    // State 465 default action
+    { 465, -1, PA_REDUCE, 440 },
+    // State 466
+    { 466, 536, PA_REDUCE, 438 },
+    // State 466 default action
+    { 466, -1, PA_REDUCE, 438 },
+    // State 467
+    { 467, 536, PA_REDUCE, 436 },
+    // State 467 default action
+    { 467, -1, PA_REDUCE, 436 },
+    // State 468
+    { 468, 536, PA_REDUCE, 434 },
+    // State 468 default action
+    { 468, -1, PA_REDUCE, 434 },
+    // State 469
+    { 469, 536, PA_REDUCE, 432 },
+    // State 469 default action
+    { 469, -1, PA_REDUCE, 432 },
+    // State 470
+    { 470, 536, PA_REDUCE, 430 },
+    // State 470 default action
+    { 470, -1, PA_REDUCE, 430 },
+    // State 471
+    { 471, 1, PA_SHIFT, 488 },
+    // State 471
+    { 471, 215, PA_SHIFT, 472 },
+    // State 471
+    { 471, 536, PA_REDUCE, 446 },
+    // State 471 default action
+    { 471, -1, PA_REDUCE, 446 },
+    // State 472
+    { 472, 2, PA_SHIFT, 487 },
+    // State 472
+    { 472, 216, PA_SHIFT, 473 },
+    // State 472
+    { 472, 536, PA_REDUCE, 448 },
+    // State 472 default action
+    { 472, -1, PA_REDUCE, 448 },
+    // State 473
+    { 473, 3, PA_SHIFT, 486 },
+    // State 473
+    { 473, 217, PA_SHIFT, 474 },
+    // State 473
+    { 473, 536, PA_REDUCE, 450 },
+    // State 473 default action
+    { 473, -1, PA_REDUCE, 450 },
+    // State 474
+    { 474, 4, PA_SHIFT, 485 },
+    // State 474
+    { 474, 218, PA_SHIFT, 475 },
+    // State 474
+    { 474, 536, PA_REDUCE, 452 },
+    // State 474 default action
+    { 474, -1, PA_REDUCE, 452 },
+    // State 475
+    { 475, 5, PA_SHIFT, 484 },
+    // State 475
+    { 475, 219, PA_SHIFT, 476 },
+    // State 475
+    { 475, 536, PA_REDUCE, 454 },
+    // State 475 default action
+    { 475, -1, PA_REDUCE, 454 },
+    // State 476
+    { 476, 6, PA_SHIFT, 483 },
+    // State 476
+    { 476, 220, PA_SHIFT, 477 },
+    // State 476
+    { 476, 536, PA_REDUCE, 456 },
+    // State 476 default action
+    { 476, -1, PA_REDUCE, 456 },
+    // State 477
+    { 477, 7, PA_SHIFT, 482 },
+    // State 477
+    { 477, 221, PA_SHIFT, 478 },
+    // State 477
+    { 477, 536, PA_REDUCE, 458 },
+    // State 477 default action
+    { 477, -1, PA_REDUCE, 458 },
+    // State 478
+    { 478, 8, PA_SHIFT, 481 },
+    // State 478
+    { 478, 67, PA_REDUCE, 460 },
+    // State 478
+    { 478, 222, PA_SHIFT, 479 },
+    // State 479
+    { 479, 67, PA_SHIFT, 480 },
+    // State 480
+    { 480, 536, PA_REDUCE, 445 },
+    // State 480 default action
+    { 480, -1, PA_REDUCE, 445 },
+    // State 481
+    { 481, 67, PA_REDUCE, 461 },
+    // State 482
+    { 482, 536, PA_REDUCE, 459 },
+    // State 482 default action
+    { 482, -1, PA_REDUCE, 459 },
+    // State 483
+    { 483, 536, PA_REDUCE, 457 },
+    // State 483 default action
+    { 483, -1, PA_REDUCE, 457 },
+    // State 484
+    { 484, 536, PA_REDUCE, 455 },
+    // State 484 default action
+    { 484, -1, PA_REDUCE, 455 },
+    // State 485
+    { 485, 536, PA_REDUCE, 453 },
+    // State 485 default action
+    { 485, -1, PA_REDUCE, 453 },
+    // State 486
+    { 486, 536, PA_REDUCE, 451 },
+    // State 486 default action
+    { 486, -1, PA_REDUCE, 451 },
+    // State 487
+    { 487, 536, PA_REDUCE, 449 },
+    // State 487 default action
+    { 487, -1, PA_REDUCE, 449 },
+    // State 488
+    { 488, 536, PA_REDUCE, 447 },
+    // State 488 default action
+    { 488, -1, PA_REDUCE, 447 },
+    // State 489
+    { 489, 1, PA_SHIFT, 506 },
+    // State 489
+    { 489, 223, PA_SHIFT, 490 },
+    // State 489
+    { 489, 536, PA_REDUCE, 463 },
+    // State 489 default action
+    { 489, -1, PA_REDUCE, 463 },
+    // State 490
+    { 490, 2, PA_SHIFT, 505 },
+    // State 490
+    { 490, 224, PA_SHIFT, 491 },
+    // State 490
+    { 490, 536, PA_REDUCE, 465 },
+    // State 490 default action
+    { 490, -1, PA_REDUCE, 465 },
+    // State 491
+    { 491, 3, PA_SHIFT, 504 },
+    // State 491
+    { 491, 225, PA_SHIFT, 492 },
+    // State 491
+    { 491, 536, PA_REDUCE, 467 },
+    // State 491 default action
+    { 491, -1, PA_REDUCE, 467 },
+    // State 492
+    { 492, 4, PA_SHIFT, 503 },
+    // State 492
+    { 492, 226, PA_SHIFT, 493 },
+    // State 492
+    { 492, 536, PA_REDUCE, 469 },
+    // State 492 default action
+    { 492, -1, PA_REDUCE, 469 },
+    // State 493
+    { 493, 5, PA_SHIFT, 502 },
+    // State 493
+    { 493, 227, PA_SHIFT, 494 },
+    // State 493
+    { 493, 536, PA_REDUCE, 471 },
+    // State 493 default action
+    { 493, -1, PA_REDUCE, 471 },
+    // State 494
+    { 494, 6, PA_SHIFT, 501 },
+    // State 494
+    { 494, 228, PA_SHIFT, 495 },
+    // State 494
+    { 494, 536, PA_REDUCE, 473 },
+    // State 494 default action
+    { 494, -1, PA_REDUCE, 473 },
+    // State 495
+    { 495, 7, PA_SHIFT, 500 },
+    // State 495
+    { 495, 229, PA_SHIFT, 496 },
+    // State 495
+    { 495, 536, PA_REDUCE, 475 },
+    // State 495 default action
+    { 495, -1, PA_REDUCE, 475 },
+    // State 496
+    { 496, 8, PA_SHIFT, 499 },
+    // State 496
+    { 496, 67, PA_REDUCE, 477 },
+    // State 496
+    { 496, 230, PA_SHIFT, 497 },
+    // State 497
+    { 497, 67, PA_SHIFT, 498 },
+    // State 498
+    { 498, 536, PA_REDUCE, 462 },
+    // State 498 default action
+    { 498, -1, PA_REDUCE, 462 },
+    // State 499
+    { 499, 67, PA_REDUCE, 478 },
+    // State 500
+    { 500, 536, PA_REDUCE, 476 },
+    // State 500 default action
+    { 500, -1, PA_REDUCE, 476 },
+    // State 501
+    { 501, 536, PA_REDUCE, 474 },
+    // State 501 default action
+    { 501, -1, PA_REDUCE, 474 },
+    // State 502
+    { 502, 536, PA_REDUCE, 472 },
+    // State 502 default action
+    { 502, -1, PA_REDUCE, 472 },
+    // State 503
+    { 503, 536, PA_REDUCE, 470 },
+    // State 503 default action
+    { 503, -1, PA_REDUCE, 470 },
+    // State 504
+    { 504, 536, PA_REDUCE, 468 },
+    // State 504 default action
+    { 504, -1, PA_REDUCE, 468 },
+    // State 505
+    { 505, 536, PA_REDUCE, 466 },
+    // State 505 default action
+    { 505, -1, PA_REDUCE, 466 },
+    // State 506
+    { 506, 536, PA_REDUCE, 464 },
+    // State 506 default action
+    { 506, -1, PA_REDUCE, 464 },
+    // State 507
+    { 507, 1, PA_SHIFT, 524 },
+    // State 507
+    { 507, 231, PA_SHIFT, 508 },
+    // State 507
+    { 507, 536, PA_REDUCE, 480 },
+    // State 507 default action
+    { 507, -1, PA_REDUCE, 480 },
+    // State 508
+    { 508, 2, PA_SHIFT, 523 },
+    // State 508
+    { 508, 232, PA_SHIFT, 509 },
+    // State 508
+    { 508, 536, PA_REDUCE, 482 },
+    // State 508 default action
+    { 508, -1, PA_REDUCE, 482 },
+    // State 509
+    { 509, 3, PA_SHIFT, 522 },
+    // State 509
+    { 509, 233, PA_SHIFT, 510 },
+    // State 509
+    { 509, 536, PA_REDUCE, 484 },
+    // State 509 default action
+    { 509, -1, PA_REDUCE, 484 },
+    // State 510
+    { 510, 4, PA_SHIFT, 521 },
+    // State 510
+    { 510, 234, PA_SHIFT, 511 },
+    // State 510
+    { 510, 536, PA_REDUCE, 486 },
+    // State 510 default action
+    { 510, -1, PA_REDUCE, 486 },
+    // State 511
+    { 511, 5, PA_SHIFT, 520 },
+    // State 511
+    { 511, 235, PA_SHIFT, 512 },
+    // State 511
+    { 511, 536, PA_REDUCE, 488 },
+    // State 511 default action
+    { 511, -1, PA_REDUCE, 488 },
+    // State 512
+    { 512, 6, PA_SHIFT, 519 },
+    // State 512
+    { 512, 236, PA_SHIFT, 513 },
+    // State 512
+    { 512, 536, PA_REDUCE, 490 },
+    // State 512 default action
+    { 512, -1, PA_REDUCE, 490 },
+    // State 513
+    { 513, 7, PA_SHIFT, 518 },
+    // State 513
+    { 513, 237, PA_SHIFT, 514 },
+    // State 513
+    { 513, 536, PA_REDUCE, 492 },
+    // State 513 default action
+    { 513, -1, PA_REDUCE, 492 },
+    // State 514
+    { 514, 8, PA_SHIFT, 517 },
+    // State 514
+    { 514, 67, PA_REDUCE, 494 },
+    // State 514
+    { 514, 238, PA_SHIFT, 515 },
+    // State 515
+    { 515, 67, PA_SHIFT, 516 },
+    // State 516
+    { 516, 536, PA_REDUCE, 479 },
+    // State 516 default action
+    { 516, -1, PA_REDUCE, 479 },
+    // State 517
+    { 517, 67, PA_REDUCE, 495 },
+    // State 518
+    { 518, 536, PA_REDUCE, 493 },
+    // State 518 default action
+    { 518, -1, PA_REDUCE, 493 },
+    // State 519
+    { 519, 536, PA_REDUCE, 491 },
+    // State 519 default action
+    { 519, -1, PA_REDUCE, 491 },
+    // State 520
+    { 520, 536, PA_REDUCE, 489 },
+    // State 520 default action
+    { 520, -1, PA_REDUCE, 489 },
+    // State 521
+    { 521, 536, PA_REDUCE, 487 },
+    // State 521 default action
+    { 521, -1, PA_REDUCE, 487 },
+    // State 522
+    { 522, 536, PA_REDUCE, 485 },
+    // State 522 default action
+    { 522, -1, PA_REDUCE, 485 },
+    // State 523
+    { 523, 536, PA_REDUCE, 483 },
+    // State 523 default action
+    { 523, -1, PA_REDUCE, 483 },
+    // State 524
+    { 524, 536, PA_REDUCE, 481 },
+    // State 524 default action
+    { 524, -1, PA_REDUCE, 481 },
+    // State 525
+    { 525, 1, PA_SHIFT, 542 },
+    // State 525
+    { 525, 239, PA_SHIFT, 526 },
+    // State 525
+    { 525, 536, PA_REDUCE, 497 },
+    // State 525 default action
+    { 525, -1, PA_REDUCE, 497 },
+    // State 526
+    { 526, 2, PA_SHIFT, 541 },
+    // State 526
+    { 526, 240, PA_SHIFT, 527 },
+    // State 526
+    { 526, 536, PA_REDUCE, 499 },
+    // State 526 default action
+    { 526, -1, PA_REDUCE, 499 },
+    // State 527
+    { 527, 3, PA_SHIFT, 540 },
+    // State 527
+    { 527, 241, PA_SHIFT, 528 },
+    // State 527
+    { 527, 536, PA_REDUCE, 501 },
+    // State 527 default action
+    { 527, -1, PA_REDUCE, 501 },
+    // State 528
+    { 528, 4, PA_SHIFT, 539 },
+    // State 528
+    { 528, 242, PA_SHIFT, 529 },
+    // State 528
+    { 528, 536, PA_REDUCE, 503 },
+    // State 528 default action
+    { 528, -1, PA_REDUCE, 503 },
+    // State 529
+    { 529, 5, PA_SHIFT, 538 },
+    // State 529
+    { 529, 243, PA_SHIFT, 530 },
+    // State 529
+    { 529, 536, PA_REDUCE, 505 },
+    // State 529 default action
+    { 529, -1, PA_REDUCE, 505 },
+    // State 530
+    { 530, 6, PA_SHIFT, 537 },
+    // State 530
+    { 530, 244, PA_SHIFT, 531 },
+    // State 530
+    { 530, 536, PA_REDUCE, 507 },
+    // State 530 default action
+    { 530, -1, PA_REDUCE, 507 },
+    // State 531
+    { 531, 7, PA_SHIFT, 536 },
+    // State 531
+    { 531, 245, PA_SHIFT, 532 },
+    // State 531
+    { 531, 536, PA_REDUCE, 509 },
+    // State 531 default action
+    { 531, -1, PA_REDUCE, 509 },
+    // State 532
+    { 532, 8, PA_SHIFT, 535 },
+    // State 532
+    { 532, 67, PA_REDUCE, 511 },
+    // State 532
+    { 532, 246, PA_SHIFT, 533 },
+    // State 533
+    { 533, 67, PA_SHIFT, 534 },
+    // State 534
+    { 534, 536, PA_REDUCE, 496 },
+    // State 534 default action
+    { 534, -1, PA_REDUCE, 496 },
+    // State 535
+    { 535, 67, PA_REDUCE, 512 },
+    // State 536
+    { 536, 536, PA_REDUCE, 510 },
+    // State 536 default action
+    { 536, -1, PA_REDUCE, 510 },
+    // State 537
+    { 537, 536, PA_REDUCE, 508 },
+    // State 537 default action
+    { 537, -1, PA_REDUCE, 508 },
+    // State 538
+    { 538, 536, PA_REDUCE, 506 },
+    // State 538 default action
+    { 538, -1, PA_REDUCE, 506 },
+    // State 539
+    { 539, 536, PA_REDUCE, 504 },
+    // State 539 default action
+    { 539, -1, PA_REDUCE, 504 },
+    // State 540
+    { 540, 536, PA_REDUCE, 502 },
+    // State 540 default action
+    { 540, -1, PA_REDUCE, 502 },
+    // State 541
+    { 541, 536, PA_REDUCE, 500 },
+    // State 541 default action
+    { 541, -1, PA_REDUCE, 500 },
+    // State 542
+    { 542, 536, PA_REDUCE, 498 },
+    // State 542 default action
+    { 542, -1, PA_REDUCE, 498 },
+    // State 543
+    { 543, 1, PA_SHIFT, 560 },
+    // State 543
+    { 543, 255, PA_SHIFT, 544 },
+    // State 543
+    { 543, 536, PA_REDUCE, 514 },
+    // State 543 default action
+    { 543, -1, PA_REDUCE, 514 },
+    // State 544
+    { 544, 2, PA_SHIFT, 559 },
+    // State 544
+    { 544, 256, PA_SHIFT, 545 },
+    // State 544
+    { 544, 536, PA_REDUCE, 516 },
+    // State 544 default action
+    { 544, -1, PA_REDUCE, 516 },
+    // State 545
+    { 545, 3, PA_SHIFT, 558 },
+    // State 545
+    { 545, 257, PA_SHIFT, 546 },
+    // State 545
+    { 545, 536, PA_REDUCE, 518 },
+    // State 545 default action
+    { 545, -1, PA_REDUCE, 518 },
+    // State 546
+    { 546, 4, PA_SHIFT, 557 },
+    // State 546
+    { 546, 258, PA_SHIFT, 547 },
+    // State 546
+    { 546, 536, PA_REDUCE, 520 },
+    // State 546 default action
+    { 546, -1, PA_REDUCE, 520 },
+    // State 547
+    { 547, 5, PA_SHIFT, 556 },
+    // State 547
+    { 547, 259, PA_SHIFT, 548 },
+    // State 547
+    { 547, 536, PA_REDUCE, 522 },
+    // State 547 default action
+    { 547, -1, PA_REDUCE, 522 },
+    // State 548
+    { 548, 6, PA_SHIFT, 555 },
+    // State 548
+    { 548, 260, PA_SHIFT, 549 },
+    // State 548
+    { 548, 536, PA_REDUCE, 524 },
+    // State 548 default action
+    { 548, -1, PA_REDUCE, 524 },
+    // State 549
+    { 549, 7, PA_SHIFT, 554 },
+    // State 549
+    { 549, 261, PA_SHIFT, 550 },
+    // State 549
+    { 549, 536, PA_REDUCE, 526 },
+    // State 549 default action
+    { 549, -1, PA_REDUCE, 526 },
+    // State 550
+    { 550, 8, PA_SHIFT, 553 },
+    // State 550
+    { 550, 67, PA_REDUCE, 528 },
+    // State 550
+    { 550, 262, PA_SHIFT, 551 },
+    // State 551
+    { 551, 67, PA_SHIFT, 552 },
+    // State 552
+    { 552, 536, PA_REDUCE, 513 },
+    // State 552 default action
+    { 552, -1, PA_REDUCE, 513 },
+    // State 553
+    { 553, 67, PA_REDUCE, 529 },
+    // State 554
+    { 554, 536, PA_REDUCE, 527 },
+    // State 554 default action
+    { 554, -1, PA_REDUCE, 527 },
+    // State 555
+    { 555, 536, PA_REDUCE, 525 },
+    // State 555 default action
+    { 555, -1, PA_REDUCE, 525 },
+    // State 556
+    { 556, 536, PA_REDUCE, 523 },
+    // State 556 default action
+    { 556, -1, PA_REDUCE, 523 },
+    // State 557
+    { 557, 536, PA_REDUCE, 521 },
+    // State 557 default action
+    { 557, -1, PA_REDUCE, 521 },
+    // State 558
+    { 558, 536, PA_REDUCE, 519 },
+    // State 558 default action
+    { 558, -1, PA_REDUCE, 519 },
+    // State 559
+    { 559, 536, PA_REDUCE, 517 },
+    // State 559 default action
+    { 559, -1, PA_REDUCE, 517 },
+    // State 560
+    { 560, 536, PA_REDUCE, 515 },
+    // State 560 default action
+    { 560, -1, PA_REDUCE, 515 },
+    // State 561
+    { 561, 1, PA_SHIFT, 578 },
+    // State 561
+    { 561, 263, PA_SHIFT, 562 },
+    // State 561
+    { 561, 536, PA_REDUCE, 531 },
+    // State 561 default action
+    { 561, -1, PA_REDUCE, 531 },
+    // State 562
+    { 562, 2, PA_SHIFT, 577 },
+    // State 562
+    { 562, 264, PA_SHIFT, 563 },
+    // State 562
+    { 562, 536, PA_REDUCE, 533 },
+    // State 562 default action
+    { 562, -1, PA_REDUCE, 533 },
+    // State 563
+    { 563, 3, PA_SHIFT, 576 },
+    // State 563
+    { 563, 265, PA_SHIFT, 564 },
+    // State 563
+    { 563, 536, PA_REDUCE, 535 },
+    // State 563 default action
+    { 563, -1, PA_REDUCE, 535 },
+    // State 564
+    { 564, 4, PA_SHIFT, 575 },
+    // State 564
+    { 564, 266, PA_SHIFT, 565 },
+    // State 564
+    { 564, 536, PA_REDUCE, 537 },
+    // State 564 default action
+    { 564, -1, PA_REDUCE, 537 },
+    // State 565
+    { 565, 5, PA_SHIFT, 574 },
+    // State 565
+    { 565, 267, PA_SHIFT, 566 },
+    // State 565
+    { 565, 536, PA_REDUCE, 539 },
+    // State 565 default action
+    { 565, -1, PA_REDUCE, 539 },
+    // State 566
+    { 566, 6, PA_SHIFT, 573 },
+    // State 566
+    { 566, 268, PA_SHIFT, 567 },
+    // State 566
+    { 566, 536, PA_REDUCE, 541 },
+    // State 566 default action
+    { 566, -1, PA_REDUCE, 541 },
+    // State 567
+    { 567, 7, PA_SHIFT, 572 },
+    // State 567
+    { 567, 269, PA_SHIFT, 568 },
+    // State 567
+    { 567, 536, PA_REDUCE, 543 },
+    // State 567 default action
+    { 567, -1, PA_REDUCE, 543 },
+    // State 568
+    { 568, 8, PA_SHIFT, 571 },
+    // State 568
+    { 568, 67, PA_REDUCE, 545 },
+    // State 568
+    { 568, 270, PA_SHIFT, 569 },
+    // State 569
+    { 569, 67, PA_SHIFT, 570 },
+    // State 570
+    { 570, 536, PA_REDUCE, 530 },
+    // State 570 default action
+    { 570, -1, PA_REDUCE, 530 },
+    // State 571
+    { 571, 67, PA_REDUCE, 546 },
+    // State 572
+    { 572, 536, PA_REDUCE, 544 },
+    // State 572 default action
+    { 572, -1, PA_REDUCE, 544 },
+    // State 573
+    { 573, 536, PA_REDUCE, 542 },
+    // State 573 default action
+    { 573, -1, PA_REDUCE, 542 },
+    // State 574
+    { 574, 536, PA_REDUCE, 540 },
+    // State 574 default action
+    { 574, -1, PA_REDUCE, 540 },
+    // State 575
+    { 575, 536, PA_REDUCE, 538 },
+    // State 575 default action
+    { 575, -1, PA_REDUCE, 538 },
+    // State 576
+    { 576, 536, PA_REDUCE, 536 },
+    // State 576 default action
+    { 576, -1, PA_REDUCE, 536 },
+    // State 577
+    { 577, 536, PA_REDUCE, 534 },
+    // State 577 default action
+    { 577, -1, PA_REDUCE, 534 },
+    // State 578
+    { 578, 536, PA_REDUCE, 532 },
+    // State 578 default action
+    { 578, -1, PA_REDUCE, 532 },
+    // State 579
+    { 579, 1, PA_SHIFT, 596 },
+    // State 579
+    { 579, 271, PA_SHIFT, 580 },
+    // State 579
+    { 579, 536, PA_REDUCE, 548 },
+    // State 579 default action
+    { 579, -1, PA_REDUCE, 548 },
+    // State 580
+    { 580, 2, PA_SHIFT, 595 },
+    // State 580
+    { 580, 272, PA_SHIFT, 581 },
+    // State 580
+    { 580, 536, PA_REDUCE, 550 },
+    // State 580 default action
+    { 580, -1, PA_REDUCE, 550 },
+    // State 581
+    { 581, 3, PA_SHIFT, 594 },
+    // State 581
+    { 581, 273, PA_SHIFT, 582 },
+    // State 581
+    { 581, 536, PA_REDUCE, 552 },
+    // State 581 default action
+    { 581, -1, PA_REDUCE, 552 },
+    // State 582
+    { 582, 4, PA_SHIFT, 593 },
+    // State 582
+    { 582, 274, PA_SHIFT, 583 },
+    // State 582
+    { 582, 536, PA_REDUCE, 554 },
+    // State 582 default action
+    { 582, -1, PA_REDUCE, 554 },
+    // State 583
+    { 583, 5, PA_SHIFT, 592 },
+    // State 583
+    { 583, 275, PA_SHIFT, 584 },
+    // State 583
+    { 583, 536, PA_REDUCE, 556 },
+    // State 583 default action
+    { 583, -1, PA_REDUCE, 556 },
+    // State 584
+    { 584, 6, PA_SHIFT, 591 },
+    // State 584
+    { 584, 276, PA_SHIFT, 585 },
+    // State 584
+    { 584, 536, PA_REDUCE, 558 },
+    // State 584 default action
+    { 584, -1, PA_REDUCE, 558 },
+    // State 585
+    { 585, 7, PA_SHIFT, 590 },
+    // State 585
+    { 585, 277, PA_SHIFT, 586 },
+    // State 585
+    { 585, 536, PA_REDUCE, 560 },
+    // State 585 default action
+    { 585, -1, PA_REDUCE, 560 },
+    // State 586
+    { 586, 8, PA_SHIFT, 589 },
+    // State 586
+    { 586, 67, PA_REDUCE, 562 },
+    // State 586
+    { 586, 278, PA_SHIFT, 587 },
+    // State 587
+    { 587, 67, PA_SHIFT, 588 },
+    // State 588
+    { 588, 536, PA_REDUCE, 547 },
+    // State 588 default action
+    { 588, -1, PA_REDUCE, 547 },
+    // State 589
+    { 589, 67, PA_REDUCE, 563 },
+    // State 590
+    { 590, 536, PA_REDUCE, 561 },
+    // State 590 default action
+    { 590, -1, PA_REDUCE, 561 },
+    // State 591
+    { 591, 536, PA_REDUCE, 559 },
+    // State 591 default action
+    { 591, -1, PA_REDUCE, 559 },
+    // State 592
+    { 592, 536, PA_REDUCE, 557 },
+    // State 592 default action
+    { 592, -1, PA_REDUCE, 557 },
+    // State 593
+    { 593, 536, PA_REDUCE, 555 },
+    // State 593 default action
+    { 593, -1, PA_REDUCE, 555 },
+    // State 594
+    { 594, 536, PA_REDUCE, 553 },
+    // State 594 default action
+    { 594, -1, PA_REDUCE, 553 },
+    // State 595
+    { 595, 536, PA_REDUCE, 551 },
+    // State 595 default action
+    { 595, -1, PA_REDUCE, 551 },
+    // State 596
+    { 596, 536, PA_REDUCE, 549 },
+    // State 596 default action
+    { 596, -1, PA_REDUCE, 549 },
+    // State 597
+    { 597, 1, PA_SHIFT, 614 },
+    // State 597
+    { 597, 279, PA_SHIFT, 598 },
+    // State 597
+    { 597, 536, PA_REDUCE, 565 },
+    // State 597 default action
+    { 597, -1, PA_REDUCE, 565 },
+    // State 598
+    { 598, 2, PA_SHIFT, 613 },
+    // State 598
+    { 598, 280, PA_SHIFT, 599 },
+    // State 598
+    { 598, 536, PA_REDUCE, 567 },
+    // State 598 default action
+    { 598, -1, PA_REDUCE, 567 },
+    // State 599
+    { 599, 3, PA_SHIFT, 612 },
+    // State 599
+    { 599, 281, PA_SHIFT, 600 },
+    // State 599
+    { 599, 536, PA_REDUCE, 569 },
+    // State 599 default action
+    { 599, -1, PA_REDUCE, 569 },
+    // State 600
+    { 600, 4, PA_SHIFT, 611 },
+    // State 600
+    { 600, 282, PA_SHIFT, 601 },
+    // State 600
+    { 600, 536, PA_REDUCE, 571 },
+    // State 600 default action
+    { 600, -1, PA_REDUCE, 571 },
+    // State 601
+    { 601, 5, PA_SHIFT, 610 },
+    // State 601
+    { 601, 283, PA_SHIFT, 602 },
+    // State 601
+    { 601, 536, PA_REDUCE, 573 },
+    // State 601 default action
+    { 601, -1, PA_REDUCE, 573 },
+    // State 602
+    { 602, 6, PA_SHIFT, 609 },
+    // State 602
+    { 602, 284, PA_SHIFT, 603 },
+    // State 602
+    { 602, 536, PA_REDUCE, 575 },
+    // State 602 default action
+    { 602, -1, PA_REDUCE, 575 },
+    // State 603
+    { 603, 7, PA_SHIFT, 608 },
+    // State 603
+    { 603, 285, PA_SHIFT, 604 },
+    // State 603
+    { 603, 536, PA_REDUCE, 577 },
+    // State 603 default action
+    { 603, -1, PA_REDUCE, 577 },
+    // State 604
+    { 604, 8, PA_SHIFT, 607 },
+    // State 604
+    { 604, 67, PA_REDUCE, 579 },
+    // State 604
+    { 604, 286, PA_SHIFT, 605 },
+    // State 605
+    { 605, 67, PA_SHIFT, 606 },
+    // State 606
+    { 606, 536, PA_REDUCE, 564 },
+    // State 606 default action
+    { 606, -1, PA_REDUCE, 564 },
+    // State 607
+    { 607, 67, PA_REDUCE, 580 },
+    // State 608
+    { 608, 536, PA_REDUCE, 578 },
+    // State 608 default action
+    { 608, -1, PA_REDUCE, 578 },
+    // State 609
+    { 609, 536, PA_REDUCE, 576 },
+    // State 609 default action
+    { 609, -1, PA_REDUCE, 576 },
+    // State 610
+    { 610, 536, PA_REDUCE, 574 },
+    // State 610 default action
+    { 610, -1, PA_REDUCE, 574 },
+    // State 611
+    { 611, 536, PA_REDUCE, 572 },
+    // State 611 default action
+    { 611, -1, PA_REDUCE, 572 },
+    // State 612
+    { 612, 536, PA_REDUCE, 570 },
+    // State 612 default action
+    { 612, -1, PA_REDUCE, 570 },
+    // State 613
+    { 613, 536, PA_REDUCE, 568 },
+    // State 613 default action
+    { 613, -1, PA_REDUCE, 568 },
+    // State 614
+    { 614, 536, PA_REDUCE, 566 },
+    // State 614 default action
+    { 614, -1, PA_REDUCE, 566 },
+    // State 615
+    { 615, 1, PA_SHIFT, 632 },
+    // State 615
+    { 615, 287, PA_SHIFT, 616 },
+    // State 615
+    { 615, 536, PA_REDUCE, 582 },
+    // State 615 default action
+    { 615, -1, PA_REDUCE, 582 },
+    // State 616
+    { 616, 2, PA_SHIFT, 631 },
+    // State 616
+    { 616, 288, PA_SHIFT, 617 },
+    // State 616
+    { 616, 536, PA_REDUCE, 584 },
+    // State 616 default action
+    { 616, -1, PA_REDUCE, 584 },
+    // State 617
+    { 617, 3, PA_SHIFT, 630 },
+    // State 617
+    { 617, 289, PA_SHIFT, 618 },
+    // State 617
+    { 617, 536, PA_REDUCE, 586 },
+    // State 617 default action
+    { 617, -1, PA_REDUCE, 586 },
+    // State 618
+    { 618, 4, PA_SHIFT, 629 },
+    // State 618
+    { 618, 290, PA_SHIFT, 619 },
+    // State 618
+    { 618, 536, PA_REDUCE, 588 },
+    // State 618 default action
+    { 618, -1, PA_REDUCE, 588 },
+    // State 619
+    { 619, 5, PA_SHIFT, 628 },
+    // State 619
+    { 619, 291, PA_SHIFT, 620 },
+    // State 619
+    { 619, 536, PA_REDUCE, 590 },
+    // State 619 default action
+    { 619, -1, PA_REDUCE, 590 },
+    // State 620
+    { 620, 6, PA_SHIFT, 627 },
+    // State 620
+    { 620, 292, PA_SHIFT, 621 },
+    // State 620
+    { 620, 536, PA_REDUCE, 592 },
+    // State 620 default action
+    { 620, -1, PA_REDUCE, 592 },
+    // State 621
+    { 621, 7, PA_SHIFT, 626 },
+    // State 621
+    { 621, 293, PA_SHIFT, 622 },
+    // State 621
+    { 621, 536, PA_REDUCE, 594 },
+    // State 621 default action
+    { 621, -1, PA_REDUCE, 594 },
+    // State 622
+    { 622, 8, PA_SHIFT, 625 },
+    // State 622
+    { 622, 67, PA_REDUCE, 596 },
+    // State 622
+    { 622, 294, PA_SHIFT, 623 },
+    // State 623
+    { 623, 67, PA_SHIFT, 624 },
+    // State 624
+    { 624, 536, PA_REDUCE, 581 },
+    // State 624 default action
+    { 624, -1, PA_REDUCE, 581 },
+    // State 625
+    { 625, 67, PA_REDUCE, 597 },
+    // State 626
+    { 626, 536, PA_REDUCE, 595 },
+    // State 626 default action
+    { 626, -1, PA_REDUCE, 595 },
+    // State 627
+    { 627, 536, PA_REDUCE, 593 },
+    // State 627 default action
+    { 627, -1, PA_REDUCE, 593 },
+    // State 628
+    { 628, 536, PA_REDUCE, 591 },
+    // State 628 default action
+    { 628, -1, PA_REDUCE, 591 },
+    // State 629
+    { 629, 536, PA_REDUCE, 589 },
+    // State 629 default action
+    { 629, -1, PA_REDUCE, 589 },
+    // State 630
+    { 630, 536, PA_REDUCE, 587 },
+    // State 630 default action
+    { 630, -1, PA_REDUCE, 587 },
+    // State 631
+    { 631, 536, PA_REDUCE, 585 },
+    // State 631 default action
+    { 631, -1, PA_REDUCE, 585 },
+    // State 632
+    { 632, 536, PA_REDUCE, 583 },
+    // State 632 default action
+    { 632, -1, PA_REDUCE, 583 },
+    // State 633
+    { 633, 1, PA_SHIFT, 650 },
+    // State 633
+    { 633, 295, PA_SHIFT, 634 },
+    // State 633
+    { 633, 536, PA_REDUCE, 599 },
+    // State 633 default action
+    { 633, -1, PA_REDUCE, 599 },
+    // State 634
+    { 634, 2, PA_SHIFT, 649 },
+    // State 634
+    { 634, 296, PA_SHIFT, 635 },
+    // State 634
+    { 634, 536, PA_REDUCE, 601 },
+    // State 634 default action
+    { 634, -1, PA_REDUCE, 601 },
+    // State 635
+    { 635, 3, PA_SHIFT, 648 },
+    // State 635
+    { 635, 297, PA_SHIFT, 636 },
+    // State 635
+    { 635, 536, PA_REDUCE, 603 },
+    // State 635 default action
+    { 635, -1, PA_REDUCE, 603 },
+    // State 636
+    { 636, 4, PA_SHIFT, 647 },
+    // State 636
+    { 636, 298, PA_SHIFT, 637 },
+    // State 636
+    { 636, 536, PA_REDUCE, 605 },
+    // State 636 default action
+    { 636, -1, PA_REDUCE, 605 },
+    // State 637
+    { 637, 5, PA_SHIFT, 646 },
+    // State 637
+    { 637, 299, PA_SHIFT, 638 },
+    // State 637
+    { 637, 536, PA_REDUCE, 607 },
+    // State 637 default action
+    { 637, -1, PA_REDUCE, 607 },
+    // State 638
+    { 638, 6, PA_SHIFT, 645 },
+    // State 638
+    { 638, 300, PA_SHIFT, 639 },
+    // State 638
+    { 638, 536, PA_REDUCE, 609 },
+    // State 638 default action
+    { 638, -1, PA_REDUCE, 609 },
+    // State 639
+    { 639, 7, PA_SHIFT, 644 },
+    // State 639
+    { 639, 301, PA_SHIFT, 640 },
+    // State 639
+    { 639, 536, PA_REDUCE, 611 },
+    // State 639 default action
+    { 639, -1, PA_REDUCE, 611 },
+    // State 640
+    { 640, 8, PA_SHIFT, 643 },
+    // State 640
+    { 640, 67, PA_REDUCE, 613 },
+    // State 640
+    { 640, 302, PA_SHIFT, 641 },
+    // State 641
+    { 641, 67, PA_SHIFT, 642 },
+    // State 642
+    { 642, 536, PA_REDUCE, 598 },
+    // State 642 default action
+    { 642, -1, PA_REDUCE, 598 },
+    // State 643
+    { 643, 67, PA_REDUCE, 614 },
+    // State 644
+    { 644, 536, PA_REDUCE, 612 },
+    // State 644 default action
+    { 644, -1, PA_REDUCE, 612 },
+    // State 645
+    { 645, 536, PA_REDUCE, 610 },
+    // State 645 default action
+    { 645, -1, PA_REDUCE, 610 },
+    // State 646
+    { 646, 536, PA_REDUCE, 608 },
+    // State 646 default action
+    { 646, -1, PA_REDUCE, 608 },
+    // State 647
+    { 647, 536, PA_REDUCE, 606 },
+    // State 647 default action
+    { 647, -1, PA_REDUCE, 606 },
+    // State 648
+    { 648, 536, PA_REDUCE, 604 },
+    // State 648 default action
+    { 648, -1, PA_REDUCE, 604 },
+    // State 649
+    { 649, 536, PA_REDUCE, 602 },
+    // State 649 default action
+    { 649, -1, PA_REDUCE, 602 },
+    // State 650
+    { 650, 536, PA_REDUCE, 600 },
+    // State 650 default action
+    { 650, -1, PA_REDUCE, 600 },
+    // State 651
+    { 651, 1, PA_SHIFT, 668 },
+    // State 651
+    { 651, 303, PA_SHIFT, 652 },
+    // State 651
+    { 651, 536, PA_REDUCE, 616 },
+    // State 651 default action
+    { 651, -1, PA_REDUCE, 616 },
+    // State 652
+    { 652, 2, PA_SHIFT, 667 },
+    // State 652
+    { 652, 304, PA_SHIFT, 653 },
+    // State 652
+    { 652, 536, PA_REDUCE, 618 },
+    // State 652 default action
+    { 652, -1, PA_REDUCE, 618 },
+    // State 653
+    { 653, 3, PA_SHIFT, 666 },
+    // State 653
+    { 653, 305, PA_SHIFT, 654 },
+    // State 653
+    { 653, 536, PA_REDUCE, 620 },
+    // State 653 default action
+    { 653, -1, PA_REDUCE, 620 },
+    // State 654
+    { 654, 4, PA_SHIFT, 665 },
+    // State 654
+    { 654, 306, PA_SHIFT, 655 },
+    // State 654
+    { 654, 536, PA_REDUCE, 622 },
+    // State 654 default action
+    { 654, -1, PA_REDUCE, 622 },
+    // State 655
+    { 655, 5, PA_SHIFT, 664 },
+    // State 655
+    { 655, 307, PA_SHIFT, 656 },
+    // State 655
+    { 655, 536, PA_REDUCE, 624 },
+    // State 655 default action
+    { 655, -1, PA_REDUCE, 624 },
+    // State 656
+    { 656, 6, PA_SHIFT, 663 },
+    // State 656
+    { 656, 308, PA_SHIFT, 657 },
+    // State 656
+    { 656, 536, PA_REDUCE, 626 },
+    // State 656 default action
+    { 656, -1, PA_REDUCE, 626 },
+    // State 657
+    { 657, 7, PA_SHIFT, 662 },
+    // State 657
+    { 657, 309, PA_SHIFT, 658 },
+    // State 657
+    { 657, 536, PA_REDUCE, 628 },
+    // State 657 default action
+    { 657, -1, PA_REDUCE, 628 },
+    // State 658
+    { 658, 8, PA_SHIFT, 661 },
+    // State 658
+    { 658, 67, PA_REDUCE, 630 },
+    // State 658
+    { 658, 310, PA_SHIFT, 659 },
+    // State 659
+    { 659, 67, PA_SHIFT, 660 },
+    // State 660
+    { 660, 536, PA_REDUCE, 615 },
+    // State 660 default action
+    { 660, -1, PA_REDUCE, 615 },
+    // State 661
+    { 661, 67, PA_REDUCE, 631 },
+    // State 662
+    { 662, 536, PA_REDUCE, 629 },
+    // State 662 default action
+    { 662, -1, PA_REDUCE, 629 },
+    // State 663
+    { 663, 536, PA_REDUCE, 627 },
+    // State 663 default action
+    { 663, -1, PA_REDUCE, 627 },
+    // State 664
+    { 664, 536, PA_REDUCE, 625 },
+    // State 664 default action
+    { 664, -1, PA_REDUCE, 625 },
+    // State 665
+    { 665, 536, PA_REDUCE, 623 },
+    // State 665 default action
+    { 665, -1, PA_REDUCE, 623 },
+    // State 666
+    { 666, 536, PA_REDUCE, 621 },
+    // State 666 default action
+    { 666, -1, PA_REDUCE, 621 },
+    // State 667
+    { 667, 536, PA_REDUCE, 619 },
+    // State 667 default action
+    { 667, -1, PA_REDUCE, 619 },
+    // State 668
+    { 668, 536, PA_REDUCE, 617 },
+    // State 668 default action
+    { 668, -1, PA_REDUCE, 617 },
+    // State 669
+    { 669, 1, PA_SHIFT, 686 },
+    // State 669
+    { 669, 311, PA_SHIFT, 670 },
+    // State 669
+    { 669, 536, PA_REDUCE, 633 },
+    // State 669 default action
+    { 669, -1, PA_REDUCE, 633 },
+    // State 670
+    { 670, 2, PA_SHIFT, 685 },
+    // State 670
+    { 670, 312, PA_SHIFT, 671 },
+    // State 670
+    { 670, 536, PA_REDUCE, 635 },
+    // State 670 default action
+    { 670, -1, PA_REDUCE, 635 },
+    // State 671
+    { 671, 3, PA_SHIFT, 684 },
+    // State 671
+    { 671, 313, PA_SHIFT, 672 },
+    // State 671
+    { 671, 536, PA_REDUCE, 637 },
+    // State 671 default action
+    { 671, -1, PA_REDUCE, 637 },
+    // State 672
+    { 672, 4, PA_SHIFT, 683 },
+    // State 672
+    { 672, 314, PA_SHIFT, 673 },
+    // State 672
+    { 672, 536, PA_REDUCE, 639 },
+    // State 672 default action
+    { 672, -1, PA_REDUCE, 639 },
+    // State 673
+    { 673, 5, PA_SHIFT, 682 },
+    // State 673
+    { 673, 315, PA_SHIFT, 674 },
+    // State 673
+    { 673, 536, PA_REDUCE, 641 },
+    // State 673 default action
+    { 673, -1, PA_REDUCE, 641 },
+    // State 674
+    { 674, 6, PA_SHIFT, 681 },
+    // State 674
+    { 674, 316, PA_SHIFT, 675 },
+    // State 674
+    { 674, 536, PA_REDUCE, 643 },
+    // State 674 default action
+    { 674, -1, PA_REDUCE, 643 },
+    // State 675
+    { 675, 7, PA_SHIFT, 680 },
+    // State 675
+    { 675, 317, PA_SHIFT, 676 },
+    // State 675
+    { 675, 536, PA_REDUCE, 645 },
+    // State 675 default action
+    { 675, -1, PA_REDUCE, 645 },
+    // State 676
+    { 676, 8, PA_SHIFT, 679 },
+    // State 676
+    { 676, 67, PA_REDUCE, 647 },
+    // State 676
+    { 676, 318, PA_SHIFT, 677 },
+    // State 677
+    { 677, 67, PA_SHIFT, 678 },
+    // State 678
+    { 678, 536, PA_REDUCE, 632 },
+    // State 678 default action
+    { 678, -1, PA_REDUCE, 632 },
+    // State 679
+    { 679, 67, PA_REDUCE, 648 },
+    // State 680
+    { 680, 536, PA_REDUCE, 646 },
+    // State 680 default action
+    { 680, -1, PA_REDUCE, 646 },
+    // State 681
+    { 681, 536, PA_REDUCE, 644 },
+    // State 681 default action
+    { 681, -1, PA_REDUCE, 644 },
+    // State 682
+    { 682, 536, PA_REDUCE, 642 },
+    // State 682 default action
+    { 682, -1, PA_REDUCE, 642 },
+    // State 683
+    { 683, 536, PA_REDUCE, 640 },
+    // State 683 default action
+    { 683, -1, PA_REDUCE, 640 },
+    // State 684
+    { 684, 536, PA_REDUCE, 638 },
+    // State 684 default action
+    { 684, -1, PA_REDUCE, 638 },
+    // State 685
+    { 685, 536, PA_REDUCE, 636 },
+    // State 685 default action
+    { 685, -1, PA_REDUCE, 636 },
+    // State 686
+    { 686, 536, PA_REDUCE, 634 },
+    // State 686 default action
+    { 686, -1, PA_REDUCE, 634 },
+    // State 687
+    { 687, 1, PA_SHIFT, 704 },
+    // State 687
+    { 687, 319, PA_SHIFT, 688 },
+    // State 687
+    { 687, 536, PA_REDUCE, 650 },
+    // State 687 default action
+    { 687, -1, PA_REDUCE, 650 },
+    // State 688
+    { 688, 2, PA_SHIFT, 703 },
+    // State 688
+    { 688, 320, PA_SHIFT, 689 },
+    // State 688
+    { 688, 536, PA_REDUCE, 652 },
+    // State 688 default action
+    { 688, -1, PA_REDUCE, 652 },
+    // State 689
+    { 689, 3, PA_SHIFT, 702 },
+    // State 689
+    { 689, 321, PA_SHIFT, 690 },
+    // State 689
+    { 689, 536, PA_REDUCE, 654 },
+    // State 689 default action
+    { 689, -1, PA_REDUCE, 654 },
+    // State 690
+    { 690, 4, PA_SHIFT, 701 },
+    // State 690
+    { 690, 322, PA_SHIFT, 691 },
+    // State 690
+    { 690, 536, PA_REDUCE, 656 },
+    // State 690 default action
+    { 690, -1, PA_REDUCE, 656 },
+    // State 691
+    { 691, 5, PA_SHIFT, 700 },
+    // State 691
+    { 691, 323, PA_SHIFT, 692 },
+    // State 691
+    { 691, 536, PA_REDUCE, 658 },
+    // State 691 default action
+    { 691, -1, PA_REDUCE, 658 },
+    // State 692
+    { 692, 6, PA_SHIFT, 699 },
+    // State 692
+    { 692, 324, PA_SHIFT, 693 },
+    // State 692
+    { 692, 536, PA_REDUCE, 660 },
+    // State 692 default action
+    { 692, -1, PA_REDUCE, 660 },
+    // State 693
+    { 693, 7, PA_SHIFT, 698 },
+    // State 693
+    { 693, 325, PA_SHIFT, 694 },
+    // State 693
+    { 693, 536, PA_REDUCE, 662 },
+    // State 693 default action
+    { 693, -1, PA_REDUCE, 662 },
+    // State 694
+    { 694, 8, PA_SHIFT, 697 },
+    // State 694
+    { 694, 67, PA_REDUCE, 664 },
+    // State 694
+    { 694, 326, PA_SHIFT, 695 },
+    // State 695
+    { 695, 67, PA_SHIFT, 696 },
+    // State 696
+    { 696, 536, PA_REDUCE, 649 },
+    // State 696 default action
+    { 696, -1, PA_REDUCE, 649 },
+    // State 697
+    { 697, 67, PA_REDUCE, 665 },
+    // State 698
+    { 698, 536, PA_REDUCE, 663 },
+    // State 698 default action
+    { 698, -1, PA_REDUCE, 663 },
+    // State 699
+    { 699, 536, PA_REDUCE, 661 },
+    // State 699 default action
+    { 699, -1, PA_REDUCE, 661 },
+    // State 700
+    { 700, 536, PA_REDUCE, 659 },
+    // State 700 default action
+    { 700, -1, PA_REDUCE, 659 },
+    // State 701
+    { 701, 536, PA_REDUCE, 657 },
+    // State 701 default action
+    { 701, -1, PA_REDUCE, 657 },
+    // State 702
+    { 702, 536, PA_REDUCE, 655 },
+    // State 702 default action
+    { 702, -1, PA_REDUCE, 655 },
+    // State 703
+    { 703, 536, PA_REDUCE, 653 },
+    // State 703 default action
+    { 703, -1, PA_REDUCE, 653 },
+    // State 704
+    { 704, 536, PA_REDUCE, 651 },
+    // State 704 default action
+    { 704, -1, PA_REDUCE, 651 },
+    // State 705
+    { 705, 1, PA_SHIFT, 722 },
+    // State 705
+    { 705, 327, PA_SHIFT, 706 },
+    // State 705
+    { 705, 536, PA_REDUCE, 667 },
+    // State 705 default action
+    { 705, -1, PA_REDUCE, 667 },
+    // State 706
+    { 706, 2, PA_SHIFT, 721 },
+    // State 706
+    { 706, 328, PA_SHIFT, 707 },
+    // State 706
+    { 706, 536, PA_REDUCE, 669 },
+    // State 706 default action
+    { 706, -1, PA_REDUCE, 669 },
+    // State 707
+    { 707, 3, PA_SHIFT, 720 },
+    // State 707
+    { 707, 329, PA_SHIFT, 708 },
+    // State 707
+    { 707, 536, PA_REDUCE, 671 },
+    // State 707 default action
+    { 707, -1, PA_REDUCE, 671 },
+    // State 708
+    { 708, 4, PA_SHIFT, 719 },
+    // State 708
+    { 708, 330, PA_SHIFT, 709 },
+    // State 708
+    { 708, 536, PA_REDUCE, 673 },
+    // State 708 default action
+    { 708, -1, PA_REDUCE, 673 },
+    // State 709
+    { 709, 5, PA_SHIFT, 718 },
+    // State 709
+    { 709, 331, PA_SHIFT, 710 },
+    // State 709
+    { 709, 536, PA_REDUCE, 675 },
+    // State 709 default action
+    { 709, -1, PA_REDUCE, 675 },
+    // State 710
+    { 710, 6, PA_SHIFT, 717 },
+    // State 710
+    { 710, 332, PA_SHIFT, 711 },
+    // State 710
+    { 710, 536, PA_REDUCE, 677 },
+    // State 710 default action
+    { 710, -1, PA_REDUCE, 677 },
+    // State 711
+    { 711, 7, PA_SHIFT, 716 },
+    // State 711
+    { 711, 333, PA_SHIFT, 712 },
+    // State 711
+    { 711, 536, PA_REDUCE, 679 },
+    // State 711 default action
+    { 711, -1, PA_REDUCE, 679 },
+    // State 712
+    { 712, 8, PA_SHIFT, 715 },
+    // State 712
+    { 712, 67, PA_REDUCE, 681 },
+    // State 712
+    { 712, 334, PA_SHIFT, 713 },
+    // State 713
+    { 713, 67, PA_SHIFT, 714 },
+    // State 714
+    { 714, 536, PA_REDUCE, 666 },
+    // State 714 default action
+    { 714, -1, PA_REDUCE, 666 },
+    // State 715
+    { 715, 67, PA_REDUCE, 682 },
+    // State 716
+    { 716, 536, PA_REDUCE, 680 },
+    // State 716 default action
+    { 716, -1, PA_REDUCE, 680 },
+    // State 717
+    { 717, 536, PA_REDUCE, 678 },
+    // State 717 default action
+    { 717, -1, PA_REDUCE, 678 },
+    // State 718
+    { 718, 536, PA_REDUCE, 676 },
+    // State 718 default action
+    { 718, -1, PA_REDUCE, 676 },
+    // State 719
+    { 719, 536, PA_REDUCE, 674 },
+    // State 719 default action
+    { 719, -1, PA_REDUCE, 674 },
+    // State 720
+    { 720, 536, PA_REDUCE, 672 },
+    // State 720 default action
+    { 720, -1, PA_REDUCE, 672 },
+    // State 721
+    { 721, 536, PA_REDUCE, 670 },
+    // State 721 default action
+    { 721, -1, PA_REDUCE, 670 },
+    // State 722
+    { 722, 536, PA_REDUCE, 668 },
+    // State 722 default action
+    { 722, -1, PA_REDUCE, 668 },
+    // State 723
+    { 723, 1, PA_SHIFT, 740 },
+    // State 723
+    { 723, 343, PA_SHIFT, 724 },
+    // State 723
+    { 723, 536, PA_REDUCE, 684 },
+    // State 723 default action
+    { 723, -1, PA_REDUCE, 684 },
+    // State 724
+    { 724, 2, PA_SHIFT, 739 },
+    // State 724
+    { 724, 344, PA_SHIFT, 725 },
+    // State 724
+    { 724, 536, PA_REDUCE, 686 },
+    // State 724 default action
+    { 724, -1, PA_REDUCE, 686 },
+    // State 725
+    { 725, 3, PA_SHIFT, 738 },
+    // State 725
+    { 725, 345, PA_SHIFT, 726 },
+    // State 725
+    { 725, 536, PA_REDUCE, 688 },
+    // State 725 default action
+    { 725, -1, PA_REDUCE, 688 },
+    // State 726
+    { 726, 4, PA_SHIFT, 737 },
+    // State 726
+    { 726, 346, PA_SHIFT, 727 },
+    // State 726
+    { 726, 536, PA_REDUCE, 690 },
+    // State 726 default action
+    { 726, -1, PA_REDUCE, 690 },
+    // State 727
+    { 727, 5, PA_SHIFT, 736 },
+    // State 727
+    { 727, 347, PA_SHIFT, 728 },
+    // State 727
+    { 727, 536, PA_REDUCE, 692 },
+    // State 727 default action
+    { 727, -1, PA_REDUCE, 692 },
+    // State 728
+    { 728, 6, PA_SHIFT, 735 },
+    // State 728
+    { 728, 348, PA_SHIFT, 729 },
+    // State 728
+    { 728, 536, PA_REDUCE, 694 },
+    // State 728 default action
+    { 728, -1, PA_REDUCE, 694 },
+    // State 729
+    { 729, 7, PA_SHIFT, 734 },
+    // State 729
+    { 729, 349, PA_SHIFT, 730 },
+    // State 729
+    { 729, 536, PA_REDUCE, 696 },
+    // State 729 default action
+    { 729, -1, PA_REDUCE, 696 },
+    // State 730
+    { 730, 8, PA_SHIFT, 733 },
+    // State 730
+    { 730, 67, PA_REDUCE, 698 },
+    // State 730
+    { 730, 350, PA_SHIFT, 731 },
+    // State 731
+    { 731, 67, PA_SHIFT, 732 },
+    // State 732
+    { 732, 536, PA_REDUCE, 683 },
+    // State 732 default action
+    { 732, -1, PA_REDUCE, 683 },
+    // State 733
+    { 733, 67, PA_REDUCE, 699 },
+    // State 734
+    { 734, 536, PA_REDUCE, 697 },
+    // State 734 default action
+    { 734, -1, PA_REDUCE, 697 },
+    // State 735
+    { 735, 536, PA_REDUCE, 695 },
+    // State 735 default action
+    { 735, -1, PA_REDUCE, 695 },
+    // State 736
+    { 736, 536, PA_REDUCE, 693 },
+    // State 736 default action
+    { 736, -1, PA_REDUCE, 693 },
+    // State 737
+    { 737, 536, PA_REDUCE, 691 },
+    // State 737 default action
+    { 737, -1, PA_REDUCE, 691 },
+    // State 738
+    { 738, 536, PA_REDUCE, 689 },
+    // State 738 default action
+    { 738, -1, PA_REDUCE, 689 },
+    // State 739
+    { 739, 536, PA_REDUCE, 687 },
+    // State 739 default action
+    { 739, -1, PA_REDUCE, 687 },
+    // State 740
+    { 740, 536, PA_REDUCE, 685 },
+    // State 740 default action
+    { 740, -1, PA_REDUCE, 685 },
+    // State 741
+    { 741, 1, PA_SHIFT, 758 },
+    // State 741
+    { 741, 351, PA_SHIFT, 742 },
+    // State 741
+    { 741, 536, PA_REDUCE, 701 },
+    // State 741 default action
+    { 741, -1, PA_REDUCE, 701 },
+    // State 742
+    { 742, 2, PA_SHIFT, 757 },
+    // State 742
+    { 742, 352, PA_SHIFT, 743 },
+    // State 742
+    { 742, 536, PA_REDUCE, 703 },
+    // State 742 default action
+    { 742, -1, PA_REDUCE, 703 },
+    // State 743
+    { 743, 3, PA_SHIFT, 756 },
+    // State 743
+    { 743, 353, PA_SHIFT, 744 },
+    // State 743
+    { 743, 536, PA_REDUCE, 705 },
+    // State 743 default action
+    { 743, -1, PA_REDUCE, 705 },
+    // State 744
+    { 744, 4, PA_SHIFT, 755 },
+    // State 744
+    { 744, 354, PA_SHIFT, 745 },
+    // State 744
+    { 744, 536, PA_REDUCE, 707 },
+    // State 744 default action
+    { 744, -1, PA_REDUCE, 707 },
+    // State 745
+    { 745, 5, PA_SHIFT, 754 },
+    // State 745
+    { 745, 355, PA_SHIFT, 746 },
+    // State 745
+    { 745, 536, PA_REDUCE, 709 },
+    // State 745 default action
+    { 745, -1, PA_REDUCE, 709 },
+    // State 746
+    { 746, 6, PA_SHIFT, 753 },
+    // State 746
+    { 746, 356, PA_SHIFT, 747 },
+    // State 746
+    { 746, 536, PA_REDUCE, 711 },
+    // State 746 default action
+    { 746, -1, PA_REDUCE, 711 },
+    // State 747
+    { 747, 7, PA_SHIFT, 752 },
+    // State 747
+    { 747, 357, PA_SHIFT, 748 },
+    // State 747
+    { 747, 536, PA_REDUCE, 713 },
+    // State 747 default action
+    { 747, -1, PA_REDUCE, 713 },
+    // State 748
+    { 748, 8, PA_SHIFT, 751 },
+    // State 748
+    { 748, 67, PA_REDUCE, 715 },
+    // State 748
+    { 748, 358, PA_SHIFT, 749 },
+    // State 749
+    { 749, 67, PA_SHIFT, 750 },
+    // State 750
+    { 750, 536, PA_REDUCE, 700 },
+    // State 750 default action
+    { 750, -1, PA_REDUCE, 700 },
+    // State 751
+    { 751, 67, PA_REDUCE, 716 },
+    // State 752
+    { 752, 536, PA_REDUCE, 714 },
+    // State 752 default action
+    { 752, -1, PA_REDUCE, 714 },
+    // State 753
+    { 753, 536, PA_REDUCE, 712 },
+    // State 753 default action
+    { 753, -1, PA_REDUCE, 712 },
+    // State 754
+    { 754, 536, PA_REDUCE, 710 },
+    // State 754 default action
+    { 754, -1, PA_REDUCE, 710 },
+    // State 755
+    { 755, 536, PA_REDUCE, 708 },
+    // State 755 default action
+    { 755, -1, PA_REDUCE, 708 },
+    // State 756
+    { 756, 536, PA_REDUCE, 706 },
+    // State 756 default action
+    { 756, -1, PA_REDUCE, 706 },
+    // State 757
+    { 757, 536, PA_REDUCE, 704 },
+    // State 757 default action
+    { 757, -1, PA_REDUCE, 704 },
+    // State 758
+    { 758, 536, PA_REDUCE, 702 },
+    // State 758 default action
+    { 758, -1, PA_REDUCE, 702 },
+    // State 759
+    { 759, 1, PA_SHIFT, 776 },
+    // State 759
+    { 759, 359, PA_SHIFT, 760 },
+    // State 759
+    { 759, 536, PA_REDUCE, 718 },
+    // State 759 default action
+    { 759, -1, PA_REDUCE, 718 },
+    // State 760
+    { 760, 2, PA_SHIFT, 775 },
+    // State 760
+    { 760, 360, PA_SHIFT, 761 },
+    // State 760
+    { 760, 536, PA_REDUCE, 720 },
+    // State 760 default action
+    { 760, -1, PA_REDUCE, 720 },
+    // State 761
+    { 761, 3, PA_SHIFT, 774 },
+    // State 761
+    { 761, 361, PA_SHIFT, 762 },
+    // State 761
+    { 761, 536, PA_REDUCE, 722 },
+    // State 761 default action
+    { 761, -1, PA_REDUCE, 722 },
+    // State 762
+    { 762, 4, PA_SHIFT, 773 },
+    // State 762
+    { 762, 362, PA_SHIFT, 763 },
+    // State 762
+    { 762, 536, PA_REDUCE, 724 },
+    // State 762 default action
+    { 762, -1, PA_REDUCE, 724 },
+    // State 763
+    { 763, 5, PA_SHIFT, 772 },
+    // State 763
+    { 763, 363, PA_SHIFT, 764 },
+    // State 763
+    { 763, 536, PA_REDUCE, 726 },
+    // State 763 default action
+    { 763, -1, PA_REDUCE, 726 },
+    // State 764
+    { 764, 6, PA_SHIFT, 771 },
+    // State 764
+    { 764, 364, PA_SHIFT, 765 },
+    // State 764
+    { 764, 536, PA_REDUCE, 728 },
+    // State 764 default action
+    { 764, -1, PA_REDUCE, 728 },
+    // State 765
+    { 765, 7, PA_SHIFT, 770 },
+    // State 765
+    { 765, 365, PA_SHIFT, 766 },
+    // State 765
+    { 765, 536, PA_REDUCE, 730 },
+    // State 765 default action
+    { 765, -1, PA_REDUCE, 730 },
+    // State 766
+    { 766, 8, PA_SHIFT, 769 },
+    // State 766
+    { 766, 67, PA_REDUCE, 732 },
+    // State 766
+    { 766, 366, PA_SHIFT, 767 },
+    // State 767
+    { 767, 67, PA_SHIFT, 768 },
+    // State 768
+    { 768, 536, PA_REDUCE, 717 },
+    // State 768 default action
+    { 768, -1, PA_REDUCE, 717 },
+    // State 769
+    { 769, 67, PA_REDUCE, 733 },
+    // State 770
+    { 770, 536, PA_REDUCE, 731 },
+    // State 770 default action
+    { 770, -1, PA_REDUCE, 731 },
+    // State 771
+    { 771, 536, PA_REDUCE, 729 },
+    // State 771 default action
+    { 771, -1, PA_REDUCE, 729 },
+    // State 772
+    { 772, 536, PA_REDUCE, 727 },
+    // State 772 default action
+    { 772, -1, PA_REDUCE, 727 },
+    // State 773
+    { 773, 536, PA_REDUCE, 725 },
+    // State 773 default action
+    { 773, -1, PA_REDUCE, 725 },
+    // State 774
+    { 774, 536, PA_REDUCE, 723 },
+    // State 774 default action
+    { 774, -1, PA_REDUCE, 723 },
+    // State 775
+    { 775, 536, PA_REDUCE, 721 },
+    // State 775 default action
+    { 775, -1, PA_REDUCE, 721 },
+    // State 776
+    { 776, 536, PA_REDUCE, 719 },
+    // State 776 default action
+    { 776, -1, PA_REDUCE, 719 },
+    // State 777
+    { 777, 1, PA_SHIFT, 794 },
+    // State 777
+    { 777, 367, PA_SHIFT, 778 },
+    // State 777
+    { 777, 536, PA_REDUCE, 735 },
+    // State 777 default action
+    { 777, -1, PA_REDUCE, 735 },
+    // State 778
+    { 778, 2, PA_SHIFT, 793 },
+    // State 778
+    { 778, 368, PA_SHIFT, 779 },
+    // State 778
+    { 778, 536, PA_REDUCE, 737 },
+    // State 778 default action
+    { 778, -1, PA_REDUCE, 737 },
+    // State 779
+    { 779, 3, PA_SHIFT, 792 },
+    // State 779
+    { 779, 369, PA_SHIFT, 780 },
+    // State 779
+    { 779, 536, PA_REDUCE, 739 },
+    // State 779 default action
+    { 779, -1, PA_REDUCE, 739 },
+    // State 780
+    { 780, 4, PA_SHIFT, 791 },
+    // State 780
+    { 780, 370, PA_SHIFT, 781 },
+    // State 780
+    { 780, 536, PA_REDUCE, 741 },
+    // State 780 default action
+    { 780, -1, PA_REDUCE, 741 },
+    // State 781
+    { 781, 5, PA_SHIFT, 790 },
+    // State 781
+    { 781, 371, PA_SHIFT, 782 },
+    // State 781
+    { 781, 536, PA_REDUCE, 743 },
+    // State 781 default action
+    { 781, -1, PA_REDUCE, 743 },
+    // State 782
+    { 782, 6, PA_SHIFT, 789 },
+    // State 782
+    { 782, 372, PA_SHIFT, 783 },
+    // State 782
+    { 782, 536, PA_REDUCE, 745 },
+    // State 782 default action
+    { 782, -1, PA_REDUCE, 745 },
+    // State 783
+    { 783, 7, PA_SHIFT, 788 },
+    // State 783
+    { 783, 373, PA_SHIFT, 784 },
+    // State 783
+    { 783, 536, PA_REDUCE, 747 },
+    // State 783 default action
+    { 783, -1, PA_REDUCE, 747 },
+    // State 784
+    { 784, 8, PA_SHIFT, 787 },
+    // State 784
+    { 784, 67, PA_REDUCE, 749 },
+    // State 784
+    { 784, 374, PA_SHIFT, 785 },
+    // State 785
+    { 785, 67, PA_SHIFT, 786 },
+    // State 786
+    { 786, 536, PA_REDUCE, 734 },
+    // State 786 default action
+    { 786, -1, PA_REDUCE, 734 },
+    // State 787
+    { 787, 67, PA_REDUCE, 750 },
+    // State 788
+    { 788, 536, PA_REDUCE, 748 },
+    // State 788 default action
+    { 788, -1, PA_REDUCE, 748 },
+    // State 789
+    { 789, 536, PA_REDUCE, 746 },
+    // State 789 default action
+    { 789, -1, PA_REDUCE, 746 },
+    // State 790
+    { 790, 536, PA_REDUCE, 744 },
+    // State 790 default action
+    { 790, -1, PA_REDUCE, 744 },
+    // State 791
+    { 791, 536, PA_REDUCE, 742 },
+    // State 791 default action
+    { 791, -1, PA_REDUCE, 742 },
+    // State 792
+    { 792, 536, PA_REDUCE, 740 },
+    // State 792 default action
+    { 792, -1, PA_REDUCE, 740 },
+    // State 793
+    { 793, 536, PA_REDUCE, 738 },
+    // State 793 default action
+    { 793, -1, PA_REDUCE, 738 },
+    // State 794
+    { 794, 536, PA_REDUCE, 736 },
+    // State 794 default action
+    { 794, -1, PA_REDUCE, 736 },
+    // State 795
+    { 795, 1, PA_SHIFT, 812 },
+    // State 795
+    { 795, 375, PA_SHIFT, 796 },
+    // State 795
+    { 795, 536, PA_REDUCE, 752 },
+    // State 795 default action
+    { 795, -1, PA_REDUCE, 752 },
+    // State 796
+    { 796, 2, PA_SHIFT, 811 },
+    // State 796
+    { 796, 376, PA_SHIFT, 797 },
+    // State 796
+    { 796, 536, PA_REDUCE, 754 },
+    // State 796 default action
+    { 796, -1, PA_REDUCE, 754 },
+    // State 797
+    { 797, 3, PA_SHIFT, 810 },
+    // State 797
+    { 797, 377, PA_SHIFT, 798 },
+    // State 797
+    { 797, 536, PA_REDUCE, 756 },
+    // State 797 default action
+    { 797, -1, PA_REDUCE, 756 },
+    // State 798
+    { 798, 4, PA_SHIFT, 809 },
+    // State 798
+    { 798, 378, PA_SHIFT, 799 },
+    // State 798
+    { 798, 536, PA_REDUCE, 758 },
+    // State 798 default action
+    { 798, -1, PA_REDUCE, 758 },
+    // State 799
+    { 799, 5, PA_SHIFT, 808 },
+    // State 799
+    { 799, 379, PA_SHIFT, 800 },
+    // State 799
+    { 799, 536, PA_REDUCE, 760 },
+    // State 799 default action
+    { 799, -1, PA_REDUCE, 760 },
+    // State 800
+    { 800, 6, PA_SHIFT, 807 },
+    // State 800
+    { 800, 380, PA_SHIFT, 801 },
+    // State 800
+    { 800, 536, PA_REDUCE, 762 },
+    // State 800 default action
+    { 800, -1, PA_REDUCE, 762 },
+    // State 801
+    { 801, 7, PA_SHIFT, 806 },
+    // State 801
+    { 801, 381, PA_SHIFT, 802 },
+    // State 801
+    { 801, 536, PA_REDUCE, 764 },
+    // State 801 default action
+    { 801, -1, PA_REDUCE, 764 },
+    // State 802
+    { 802, 8, PA_SHIFT, 805 },
+    // State 802
+    { 802, 67, PA_REDUCE, 766 },
+    // State 802
+    { 802, 382, PA_SHIFT, 803 },
+    // State 803
+    { 803, 67, PA_SHIFT, 804 },
+    // State 804
+    { 804, 536, PA_REDUCE, 751 },
+    // State 804 default action
+    { 804, -1, PA_REDUCE, 751 },
+    // State 805
+    { 805, 67, PA_REDUCE, 767 },
+    // State 806
+    { 806, 536, PA_REDUCE, 765 },
+    // State 806 default action
+    { 806, -1, PA_REDUCE, 765 },
+    // State 807
+    { 807, 536, PA_REDUCE, 763 },
+    // State 807 default action
+    { 807, -1, PA_REDUCE, 763 },
+    // State 808
+    { 808, 536, PA_REDUCE, 761 },
+    // State 808 default action
+    { 808, -1, PA_REDUCE, 761 },
+    // State 809
+    { 809, 536, PA_REDUCE, 759 },
+    // State 809 default action
+    { 809, -1, PA_REDUCE, 759 },
+    // State 810
+    { 810, 536, PA_REDUCE, 757 },
+    // State 810 default action
+    { 810, -1, PA_REDUCE, 757 },
+    // State 811
+    { 811, 536, PA_REDUCE, 755 },
+    // State 811 default action
+    { 811, -1, PA_REDUCE, 755 },
+    // State 812
+    { 812, 536, PA_REDUCE, 753 },
+    // State 812 default action
+    { 812, -1, PA_REDUCE, 753 },
+    // State 813
+    { 813, 1, PA_SHIFT, 830 },
+    // State 813
+    { 813, 383, PA_SHIFT, 814 },
+    // State 813
+    { 813, 536, PA_REDUCE, 769 },
+    // State 813 default action
+    { 813, -1, PA_REDUCE, 769 },
+    // State 814
+    { 814, 2, PA_SHIFT, 829 },
+    // State 814
+    { 814, 384, PA_SHIFT, 815 },
+    // State 814
+    { 814, 536, PA_REDUCE, 771 },
+    // State 814 default action
+    { 814, -1, PA_REDUCE, 771 },
+    // State 815
+    { 815, 3, PA_SHIFT, 828 },
+    // State 815
+    { 815, 385, PA_SHIFT, 816 },
+    // State 815
+    { 815, 536, PA_REDUCE, 773 },
+    // State 815 default action
+    { 815, -1, PA_REDUCE, 773 },
+    // State 816
+    { 816, 4, PA_SHIFT, 827 },
+    // State 816
+    { 816, 386, PA_SHIFT, 817 },
+    // State 816
+    { 816, 536, PA_REDUCE, 775 },
+    // State 816 default action
+    { 816, -1, PA_REDUCE, 775 },
+    // State 817
+    { 817, 5, PA_SHIFT, 826 },
+    // State 817
+    { 817, 387, PA_SHIFT, 818 },
+    // State 817
+    { 817, 536, PA_REDUCE, 777 },
+    // State 817 default action
+    { 817, -1, PA_REDUCE, 777 },
+    // State 818
+    { 818, 6, PA_SHIFT, 825 },
+    // State 818
+    { 818, 388, PA_SHIFT, 819 },
+    // State 818
+    { 818, 536, PA_REDUCE, 779 },
+    // State 818 default action
+    { 818, -1, PA_REDUCE, 779 },
+    // State 819
+    { 819, 7, PA_SHIFT, 824 },
+    // State 819
+    { 819, 389, PA_SHIFT, 820 },
+    // State 819
+    { 819, 536, PA_REDUCE, 781 },
+    // State 819 default action
+    { 819, -1, PA_REDUCE, 781 },
+    // State 820
+    { 820, 8, PA_SHIFT, 823 },
+    // State 820
+    { 820, 67, PA_REDUCE, 783 },
+    // State 820
+    { 820, 390, PA_SHIFT, 821 },
+    // State 821
+    { 821, 67, PA_SHIFT, 822 },
+    // State 822
+    { 822, 536, PA_REDUCE, 768 },
+    // State 822 default action
+    { 822, -1, PA_REDUCE, 768 },
+    // State 823
+    { 823, 67, PA_REDUCE, 784 },
+    // State 824
+    { 824, 536, PA_REDUCE, 782 },
+    // State 824 default action
+    { 824, -1, PA_REDUCE, 782 },
+    // State 825
+    { 825, 536, PA_REDUCE, 780 },
+    // State 825 default action
+    { 825, -1, PA_REDUCE, 780 },
+    // State 826
+    { 826, 536, PA_REDUCE, 778 },
+    // State 826 default action
+    { 826, -1, PA_REDUCE, 778 },
+    // State 827
+    { 827, 536, PA_REDUCE, 776 },
+    // State 827 default action
+    { 827, -1, PA_REDUCE, 776 },
+    // State 828
+    { 828, 536, PA_REDUCE, 774 },
+    // State 828 default action
+    { 828, -1, PA_REDUCE, 774 },
+    // State 829
+    { 829, 536, PA_REDUCE, 772 },
+    // State 829 default action
+    { 829, -1, PA_REDUCE, 772 },
+    // State 830
+    { 830, 536, PA_REDUCE, 770 },
+    // State 830 default action
+    { 830, -1, PA_REDUCE, 770 },
+    // State 831
+    { 831, 1, PA_SHIFT, 848 },
+    // State 831
+    { 831, 391, PA_SHIFT, 832 },
+    // State 831
+    { 831, 536, PA_REDUCE, 786 },
+    // State 831 default action
+    { 831, -1, PA_REDUCE, 786 },
+    // State 832
+    { 832, 2, PA_SHIFT, 847 },
+    // State 832
+    { 832, 392, PA_SHIFT, 833 },
+    // State 832
+    { 832, 536, PA_REDUCE, 788 },
+    // State 832 default action
+    { 832, -1, PA_REDUCE, 788 },
+    // State 833
+    { 833, 3, PA_SHIFT, 846 },
+    // State 833
+    { 833, 393, PA_SHIFT, 834 },
+    // State 833
+    { 833, 536, PA_REDUCE, 790 },
+    // State 833 default action
+    { 833, -1, PA_REDUCE, 790 },
+    // State 834
+    { 834, 4, PA_SHIFT, 845 },
+    // State 834
+    { 834, 394, PA_SHIFT, 835 },
+    // State 834
+    { 834, 536, PA_REDUCE, 792 },
+    // State 834 default action
+    { 834, -1, PA_REDUCE, 792 },
+    // State 835
+    { 835, 5, PA_SHIFT, 844 },
+    // State 835
+    { 835, 395, PA_SHIFT, 836 },
+    // State 835
+    { 835, 536, PA_REDUCE, 794 },
+    // State 835 default action
+    { 835, -1, PA_REDUCE, 794 },
+    // State 836
+    { 836, 6, PA_SHIFT, 843 },
+    // State 836
+    { 836, 396, PA_SHIFT, 837 },
+    // State 836
+    { 836, 536, PA_REDUCE, 796 },
+    // State 836 default action
+    { 836, -1, PA_REDUCE, 796 },
+    // State 837
+    { 837, 7, PA_SHIFT, 842 },
+    // State 837
+    { 837, 397, PA_SHIFT, 838 },
+    // State 837
+    { 837, 536, PA_REDUCE, 798 },
+    // State 837 default action
+    { 837, -1, PA_REDUCE, 798 },
+    // State 838
+    { 838, 8, PA_SHIFT, 841 },
+    // State 838
+    { 838, 67, PA_REDUCE, 800 },
+    // State 838
+    { 838, 398, PA_SHIFT, 839 },
+    // State 839
+    { 839, 67, PA_SHIFT, 840 },
+    // State 840
+    { 840, 536, PA_REDUCE, 785 },
+    // State 840 default action
+    { 840, -1, PA_REDUCE, 785 },
+    // State 841
+    { 841, 67, PA_REDUCE, 801 },
+    // State 842
+    { 842, 536, PA_REDUCE, 799 },
+    // State 842 default action
+    { 842, -1, PA_REDUCE, 799 },
+    // State 843
+    { 843, 536, PA_REDUCE, 797 },
+    // State 843 default action
+    { 843, -1, PA_REDUCE, 797 },
+    // State 844
+    { 844, 536, PA_REDUCE, 795 },
+    // State 844 default action
+    { 844, -1, PA_REDUCE, 795 },
+    // State 845
+    { 845, 536, PA_REDUCE, 793 },
+    // State 845 default action
+    { 845, -1, PA_REDUCE, 793 },
+    // State 846
+    { 846, 536, PA_REDUCE, 791 },
+    // State 846 default action
+    { 846, -1, PA_REDUCE, 791 },
+    // State 847
+    { 847, 536, PA_REDUCE, 789 },
+    // State 847 default action
+    { 847, -1, PA_REDUCE, 789 },
+    // State 848
+    { 848, 536, PA_REDUCE, 787 },
+    // State 848 default action
+    { 848, -1, PA_REDUCE, 787 },
+    // State 849
+    { 849, 1, PA_SHIFT, 866 },
+    // State 849
+    { 849, 399, PA_SHIFT, 850 },
+    // State 849
+    { 849, 536, PA_REDUCE, 803 },
+    // State 849 default action
+    { 849, -1, PA_REDUCE, 803 },
+    // State 850
+    { 850, 2, PA_SHIFT, 865 },
+    // State 850
+    { 850, 400, PA_SHIFT, 851 },
+    // State 850
+    { 850, 536, PA_REDUCE, 805 },
+    // State 850 default action
+    { 850, -1, PA_REDUCE, 805 },
+    // State 851
+    { 851, 3, PA_SHIFT, 864 },
+    // State 851
+    { 851, 401, PA_SHIFT, 852 },
+    // State 851
+    { 851, 536, PA_REDUCE, 807 },
+    // State 851 default action
+    { 851, -1, PA_REDUCE, 807 },
+    // State 852
+    { 852, 4, PA_SHIFT, 863 },
+    // State 852
+    { 852, 402, PA_SHIFT, 853 },
+    // State 852
+    { 852, 536, PA_REDUCE, 809 },
+    // State 852 default action
+    { 852, -1, PA_REDUCE, 809 },
+    // State 853
+    { 853, 5, PA_SHIFT, 862 },
+    // State 853
+    { 853, 403, PA_SHIFT, 854 },
+    // State 853
+    { 853, 536, PA_REDUCE, 811 },
+    // State 853 default action
+    { 853, -1, PA_REDUCE, 811 },
+    // State 854
+    { 854, 6, PA_SHIFT, 861 },
+    // State 854
+    { 854, 404, PA_SHIFT, 855 },
+    // State 854
+    { 854, 536, PA_REDUCE, 813 },
+    // State 854 default action
+    { 854, -1, PA_REDUCE, 813 },
+    // State 855
+    { 855, 7, PA_SHIFT, 860 },
+    // State 855
+    { 855, 405, PA_SHIFT, 856 },
+    // State 855
+    { 855, 536, PA_REDUCE, 815 },
+    // State 855 default action
+    { 855, -1, PA_REDUCE, 815 },
+    // State 856
+    { 856, 8, PA_SHIFT, 859 },
+    // State 856
+    { 856, 67, PA_REDUCE, 817 },
+    // State 856
+    { 856, 406, PA_SHIFT, 857 },
+    // State 857
+    { 857, 67, PA_SHIFT, 858 },
+    // State 858
+    { 858, 536, PA_REDUCE, 802 },
+    // State 858 default action
+    { 858, -1, PA_REDUCE, 802 },
+    // State 859
+    { 859, 67, PA_REDUCE, 818 },
+    // State 860
+    { 860, 536, PA_REDUCE, 816 },
+    // State 860 default action
+    { 860, -1, PA_REDUCE, 816 },
+    // State 861
+    { 861, 536, PA_REDUCE, 814 },
+    // State 861 default action
+    { 861, -1, PA_REDUCE, 814 },
+    // State 862
+    { 862, 536, PA_REDUCE, 812 },
+    // State 862 default action
+    { 862, -1, PA_REDUCE, 812 },
+    // State 863
+    { 863, 536, PA_REDUCE, 810 },
+    // State 863 default action
+    { 863, -1, PA_REDUCE, 810 },
+    // State 864
+    { 864, 536, PA_REDUCE, 808 },
+    // State 864 default action
+    { 864, -1, PA_REDUCE, 808 },
+    // State 865
+    { 865, 536, PA_REDUCE, 806 },
+    // State 865 default action
+    { 865, -1, PA_REDUCE, 806 },
+    // State 866
+    { 866, 536, PA_REDUCE, 804 },
+    // State 866 default action
+    { 866, -1, PA_REDUCE, 804 },
+    // State 867
+    { 867, 1, PA_SHIFT, 884 },
+    // State 867
+    { 867, 407, PA_SHIFT, 868 },
+    // State 867
+    { 867, 536, PA_REDUCE, 820 },
+    // State 867 default action
+    { 867, -1, PA_REDUCE, 820 },
+    // State 868
+    { 868, 2, PA_SHIFT, 883 },
+    // State 868
+    { 868, 408, PA_SHIFT, 869 },
+    // State 868
+    { 868, 536, PA_REDUCE, 822 },
+    // State 868 default action
+    { 868, -1, PA_REDUCE, 822 },
+    // State 869
+    { 869, 3, PA_SHIFT, 882 },
+    // State 869
+    { 869, 409, PA_SHIFT, 870 },
+    // State 869
+    { 869, 536, PA_REDUCE, 824 },
+    // State 869 default action
+    { 869, -1, PA_REDUCE, 824 },
+    // State 870
+    { 870, 4, PA_SHIFT, 881 },
+    // State 870
+    { 870, 410, PA_SHIFT, 871 },
+    // State 870
+    { 870, 536, PA_REDUCE, 826 },
+    // State 870 default action
+    { 870, -1, PA_REDUCE, 826 },
+    // State 871
+    { 871, 5, PA_SHIFT, 880 },
+    // State 871
+    { 871, 411, PA_SHIFT, 872 },
+    // State 871
+    { 871, 536, PA_REDUCE, 828 },
+    // State 871 default action
+    { 871, -1, PA_REDUCE, 828 },
+    // State 872
+    { 872, 6, PA_SHIFT, 879 },
+    // State 872
+    { 872, 412, PA_SHIFT, 873 },
+    // State 872
+    { 872, 536, PA_REDUCE, 830 },
+    // State 872 default action
+    { 872, -1, PA_REDUCE, 830 },
+    // State 873
+    { 873, 7, PA_SHIFT, 878 },
+    // State 873
+    { 873, 413, PA_SHIFT, 874 },
+    // State 873
+    { 873, 536, PA_REDUCE, 832 },
+    // State 873 default action
+    { 873, -1, PA_REDUCE, 832 },
+    // State 874
+    { 874, 8, PA_SHIFT, 877 },
+    // State 874
+    { 874, 67, PA_REDUCE, 834 },
+    // State 874
+    { 874, 414, PA_SHIFT, 875 },
+    // State 875
+    { 875, 67, PA_SHIFT, 876 },
+    // State 876
+    { 876, 536, PA_REDUCE, 819 },
+    // State 876 default action
+    { 876, -1, PA_REDUCE, 819 },
+    // State 877
+    { 877, 67, PA_REDUCE, 835 },
+    // State 878
+    { 878, 536, PA_REDUCE, 833 },
+    // State 878 default action
+    { 878, -1, PA_REDUCE, 833 },
+    // State 879
+    { 879, 536, PA_REDUCE, 831 },
+    // State 879 default action
+    { 879, -1, PA_REDUCE, 831 },
+    // State 880
+    { 880, 536, PA_REDUCE, 829 },
+    // State 880 default action
+    { 880, -1, PA_REDUCE, 829 },
+    // State 881
+    { 881, 536, PA_REDUCE, 827 },
+    // State 881 default action
+    { 881, -1, PA_REDUCE, 827 },
+    // State 882
+    { 882, 536, PA_REDUCE, 825 },
+    // State 882 default action
+    { 882, -1, PA_REDUCE, 825 },
+    // State 883
+    { 883, 536, PA_REDUCE, 823 },
+    // State 883 default action
+    { 883, -1, PA_REDUCE, 823 },
+    // State 884
+    { 884, 536, PA_REDUCE, 821 },
+    // State 884 default action
+    { 884, -1, PA_REDUCE, 821 },
+    // State 885
+    { 885, 1, PA_SHIFT, 902 },
+    // State 885
+    { 885, 415, PA_SHIFT, 886 },
+    // State 885
+    { 885, 536, PA_REDUCE, 837 },
+    // State 885 default action
+    { 885, -1, PA_REDUCE, 837 },
+    // State 886
+    { 886, 2, PA_SHIFT, 901 },
+    // State 886
+    { 886, 416, PA_SHIFT, 887 },
+    // State 886
+    { 886, 536, PA_REDUCE, 839 },
+    // State 886 default action
+    { 886, -1, PA_REDUCE, 839 },
+    // State 887
+    { 887, 3, PA_SHIFT, 900 },
+    // State 887
+    { 887, 417, PA_SHIFT, 888 },
+    // State 887
+    { 887, 536, PA_REDUCE, 841 },
+    // State 887 default action
+    { 887, -1, PA_REDUCE, 841 },
+    // State 888
+    { 888, 4, PA_SHIFT, 899 },
+    // State 888
+    { 888, 418, PA_SHIFT, 889 },
+    // State 888
+    { 888, 536, PA_REDUCE, 843 },
+    // State 888 default action
+    { 888, -1, PA_REDUCE, 843 },
+    // State 889
+    { 889, 5, PA_SHIFT, 898 },
+    // State 889
+    { 889, 419, PA_SHIFT, 890 },
+    // State 889
+    { 889, 536, PA_REDUCE, 845 },
+    // State 889 default action
+    { 889, -1, PA_REDUCE, 845 },
+    // State 890
+    { 890, 6, PA_SHIFT, 897 },
+    // State 890
+    { 890, 420, PA_SHIFT, 891 },
+    // State 890
+    { 890, 536, PA_REDUCE, 847 },
+    // State 890 default action
+    { 890, -1, PA_REDUCE, 847 },
+    // State 891
+    { 891, 7, PA_SHIFT, 896 },
+    // State 891
+    { 891, 421, PA_SHIFT, 892 },
+    // State 891
+    { 891, 536, PA_REDUCE, 849 },
+    // State 891 default action
+    { 891, -1, PA_REDUCE, 849 },
+    // State 892
+    { 892, 8, PA_SHIFT, 895 },
+    // State 892
+    { 892, 67, PA_REDUCE, 851 },
+    // State 892
+    { 892, 422, PA_SHIFT, 893 },
+    // State 893
+    { 893, 67, PA_SHIFT, 894 },
+    // State 894
+    { 894, 536, PA_REDUCE, 836 },
+    // State 894 default action
+    { 894, -1, PA_REDUCE, 836 },
+    // State 895
+    { 895, 67, PA_REDUCE, 852 },
+    // State 896
+    { 896, 536, PA_REDUCE, 850 },
+    // State 896 default action
+    { 896, -1, PA_REDUCE, 850 },
+    // State 897
+    { 897, 536, PA_REDUCE, 848 },
+    // State 897 default action
+    { 897, -1, PA_REDUCE, 848 },
+    // State 898
+    { 898, 536, PA_REDUCE, 846 },
+    // State 898 default action
+    { 898, -1, PA_REDUCE, 846 },
+    // State 899
+    { 899, 536, PA_REDUCE, 844 },
+    // State 899 default action
+    { 899, -1, PA_REDUCE, 844 },
+    // State 900
+    { 900, 536, PA_REDUCE, 842 },
+    // State 900 default action
+    { 900, -1, PA_REDUCE, 842 },
+    // State 901
+    { 901, 536, PA_REDUCE, 840 },
+    // State 901 default action
+    { 901, -1, PA_REDUCE, 840 },
+    // State 902
+    { 902, 536, PA_REDUCE, 838 },
+    // State 902 default action
+    { 902, -1, PA_REDUCE, 838 },
+    // State 903
+    { 903, 1, PA_SHIFT, 920 },
+    // State 903
+    { 903, 431, PA_SHIFT, 904 },
+    // State 903
+    { 903, 536, PA_REDUCE, 854 },
+    // State 903 default action
+    { 903, -1, PA_REDUCE, 854 },
+    // State 904
+    { 904, 2, PA_SHIFT, 919 },
+    // State 904
+    { 904, 432, PA_SHIFT, 905 },
+    // State 904
+    { 904, 536, PA_REDUCE, 856 },
+    // State 904 default action
+    { 904, -1, PA_REDUCE, 856 },
+    // State 905
+    { 905, 3, PA_SHIFT, 918 },
+    // State 905
+    { 905, 433, PA_SHIFT, 906 },
+    // State 905
+    { 905, 536, PA_REDUCE, 858 },
+    // State 905 default action
+    { 905, -1, PA_REDUCE, 858 },
+    // State 906
+    { 906, 4, PA_SHIFT, 917 },
+    // State 906
+    { 906, 434, PA_SHIFT, 907 },
+    // State 906
+    { 906, 536, PA_REDUCE, 860 },
+    // State 906 default action
+    { 906, -1, PA_REDUCE, 860 },
+    // State 907
+    { 907, 5, PA_SHIFT, 916 },
+    // State 907
+    { 907, 435, PA_SHIFT, 908 },
+    // State 907
+    { 907, 536, PA_REDUCE, 862 },
+    // State 907 default action
+    { 907, -1, PA_REDUCE, 862 },
+    // State 908
+    { 908, 6, PA_SHIFT, 915 },
+    // State 908
+    { 908, 436, PA_SHIFT, 909 },
+    // State 908
+    { 908, 536, PA_REDUCE, 864 },
+    // State 908 default action
+    { 908, -1, PA_REDUCE, 864 },
+    // State 909
+    { 909, 7, PA_SHIFT, 914 },
+    // State 909
+    { 909, 437, PA_SHIFT, 910 },
+    // State 909
+    { 909, 536, PA_REDUCE, 866 },
+    // State 909 default action
+    { 909, -1, PA_REDUCE, 866 },
+    // State 910
+    { 910, 8, PA_SHIFT, 913 },
+    // State 910
+    { 910, 67, PA_REDUCE, 868 },
+    // State 910
+    { 910, 438, PA_SHIFT, 911 },
+    // State 911
+    { 911, 67, PA_SHIFT, 912 },
+    // State 912
+    { 912, 536, PA_REDUCE, 853 },
+    // State 912 default action
+    { 912, -1, PA_REDUCE, 853 },
+    // State 913
+    { 913, 67, PA_REDUCE, 869 },
+    // State 914
+    { 914, 536, PA_REDUCE, 867 },
+    // State 914 default action
+    { 914, -1, PA_REDUCE, 867 },
+    // State 915
+    { 915, 536, PA_REDUCE, 865 },
+    // State 915 default action
+    { 915, -1, PA_REDUCE, 865 },
+    // State 916
+    { 916, 536, PA_REDUCE, 863 },
+    // State 916 default action
+    { 916, -1, PA_REDUCE, 863 },
+    // State 917
+    { 917, 536, PA_REDUCE, 861 },
+    // State 917 default action
+    { 917, -1, PA_REDUCE, 861 },
+    // State 918
+    { 918, 536, PA_REDUCE, 859 },
+    // State 918 default action
+    { 918, -1, PA_REDUCE, 859 },
+    // State 919
+    { 919, 536, PA_REDUCE, 857 },
+    // State 919 default action
+    { 919, -1, PA_REDUCE, 857 },
+    // State 920
+    { 920, 536, PA_REDUCE, 855 },
+    // State 920 default action
+    { 920, -1, PA_REDUCE, 855 },
+    // State 921
+    { 921, 1, PA_SHIFT, 938 },
+    // State 921
+    { 921, 439, PA_SHIFT, 922 },
+    // State 921
+    { 921, 536, PA_REDUCE, 871 },
+    // State 921 default action
+    { 921, -1, PA_REDUCE, 871 },
+    // State 922
+    { 922, 2, PA_SHIFT, 937 },
+    // State 922
+    { 922, 440, PA_SHIFT, 923 },
+    // State 922
+    { 922, 536, PA_REDUCE, 873 },
+    // State 922 default action
+    { 922, -1, PA_REDUCE, 873 },
+    // State 923
+    { 923, 3, PA_SHIFT, 936 },
+    // State 923
+    { 923, 441, PA_SHIFT, 924 },
+    // State 923
+    { 923, 536, PA_REDUCE, 875 },
+    // State 923 default action
+    { 923, -1, PA_REDUCE, 875 },
+    // State 924
+    { 924, 4, PA_SHIFT, 935 },
+    // State 924
+    { 924, 442, PA_SHIFT, 925 },
+    // State 924
+    { 924, 536, PA_REDUCE, 877 },
+    // State 924 default action
+    { 924, -1, PA_REDUCE, 877 },
+    // State 925
+    { 925, 5, PA_SHIFT, 934 },
+    // State 925
+    { 925, 443, PA_SHIFT, 926 },
+    // State 925
+    { 925, 536, PA_REDUCE, 879 },
+    // State 925 default action
+    { 925, -1, PA_REDUCE, 879 },
+    // State 926
+    { 926, 6, PA_SHIFT, 933 },
+    // State 926
+    { 926, 444, PA_SHIFT, 927 },
+    // State 926
+    { 926, 536, PA_REDUCE, 881 },
+    // State 926 default action
+    { 926, -1, PA_REDUCE, 881 },
+    // State 927
+    { 927, 7, PA_SHIFT, 932 },
+    // State 927
+    { 927, 445, PA_SHIFT, 928 },
+    // State 927
+    { 927, 536, PA_REDUCE, 883 },
+    // State 927 default action
+    { 927, -1, PA_REDUCE, 883 },
+    // State 928
+    { 928, 8, PA_SHIFT, 931 },
+    // State 928
+    { 928, 67, PA_REDUCE, 885 },
+    // State 928
+    { 928, 446, PA_SHIFT, 929 },
+    // State 929
+    { 929, 67, PA_SHIFT, 930 },
+    // State 930
+    { 930, 536, PA_REDUCE, 870 },
+    // State 930 default action
+    { 930, -1, PA_REDUCE, 870 },
+    // State 931
+    { 931, 67, PA_REDUCE, 886 },
+    // State 932
+    { 932, 536, PA_REDUCE, 884 },
+    // State 932 default action
+    { 932, -1, PA_REDUCE, 884 },
+    // State 933
+    { 933, 536, PA_REDUCE, 882 },
+    // State 933 default action
+    { 933, -1, PA_REDUCE, 882 },
+    // State 934
+    { 934, 536, PA_REDUCE, 880 },
+    // State 934 default action
+    { 934, -1, PA_REDUCE, 880 },
+    // State 935
+    { 935, 536, PA_REDUCE, 878 },
+    // State 935 default action
+    { 935, -1, PA_REDUCE, 878 },
+    // State 936
+    { 936, 536, PA_REDUCE, 876 },
+    // State 936 default action
+    { 936, -1, PA_REDUCE, 876 },
+    // State 937
+    { 937, 536, PA_REDUCE, 874 },
+    // State 937 default action
+    { 937, -1, PA_REDUCE, 874 },
+    // State 938
+    { 938, 536, PA_REDUCE, 872 },
+    // State 938 default action
+    { 938, -1, PA_REDUCE, 872 },
+    // State 939
+    { 939, 1, PA_SHIFT, 956 },
+    // State 939
+    { 939, 447, PA_SHIFT, 940 },
+    // State 939
+    { 939, 536, PA_REDUCE, 888 },
+    // State 939 default action
+    { 939, -1, PA_REDUCE, 888 },
+    // State 940
+    { 940, 2, PA_SHIFT, 955 },
+    // State 940
+    { 940, 448, PA_SHIFT, 941 },
+    // State 940
+    { 940, 536, PA_REDUCE, 890 },
+    // State 940 default action
+    { 940, -1, PA_REDUCE, 890 },
+    // State 941
+    { 941, 3, PA_SHIFT, 954 },
+    // State 941
+    { 941, 449, PA_SHIFT, 942 },
+    // State 941
+    { 941, 536, PA_REDUCE, 892 },
+    // State 941 default action
+    { 941, -1, PA_REDUCE, 892 },
+    // State 942
+    { 942, 4, PA_SHIFT, 953 },
+    // State 942
+    { 942, 450, PA_SHIFT, 943 },
+    // State 942
+    { 942, 536, PA_REDUCE, 894 },
+    // State 942 default action
+    { 942, -1, PA_REDUCE, 894 },
+    // State 943
+    { 943, 5, PA_SHIFT, 952 },
+    // State 943
+    { 943, 451, PA_SHIFT, 944 },
+    // State 943
+    { 943, 536, PA_REDUCE, 896 },
+    // State 943 default action
+    { 943, -1, PA_REDUCE, 896 },
+    // State 944
+    { 944, 6, PA_SHIFT, 951 },
+    // State 944
+    { 944, 452, PA_SHIFT, 945 },
+    // State 944
+    { 944, 536, PA_REDUCE, 898 },
+    // State 944 default action
+    { 944, -1, PA_REDUCE, 898 },
+    // State 945
+    { 945, 7, PA_SHIFT, 950 },
+    // State 945
+    { 945, 453, PA_SHIFT, 946 },
+    // State 945
+    { 945, 536, PA_REDUCE, 900 },
+    // State 945 default action
+    { 945, -1, PA_REDUCE, 900 },
+    // State 946
+    { 946, 8, PA_SHIFT, 949 },
+    // State 946
+    { 946, 67, PA_REDUCE, 902 },
+    // State 946
+    { 946, 454, PA_SHIFT, 947 },
+    // State 947
+    { 947, 67, PA_SHIFT, 948 },
+    // State 948
+    { 948, 536, PA_REDUCE, 887 },
+    // State 948 default action
+    { 948, -1, PA_REDUCE, 887 },
+    // State 949
+    { 949, 67, PA_REDUCE, 903 },
+    // State 950
+    { 950, 536, PA_REDUCE, 901 },
+    // State 950 default action
+    { 950, -1, PA_REDUCE, 901 },
+    // State 951
+    { 951, 536, PA_REDUCE, 899 },
+    // State 951 default action
+    { 951, -1, PA_REDUCE, 899 },
+    // State 952
+    { 952, 536, PA_REDUCE, 897 },
+    // State 952 default action
+    { 952, -1, PA_REDUCE, 897 },
+    // State 953
+    { 953, 536, PA_REDUCE, 895 },
+    // State 953 default action
+    { 953, -1, PA_REDUCE, 895 },
+    // State 954
+    { 954, 536, PA_REDUCE, 893 },
+    // State 954 default action
+    { 954, -1, PA_REDUCE, 893 },
+    // State 955
+    { 955, 536, PA_REDUCE, 891 },
+    // State 955 default action
+    { 955, -1, PA_REDUCE, 891 },
+    // State 956
+    { 956, 536, PA_REDUCE, 889 },
+    // State 956 default action
+    { 956, -1, PA_REDUCE, 889 },
+    // State 957
+    { 957, 1, PA_SHIFT, 974 },
+    // State 957
+    { 957, 455, PA_SHIFT, 958 },
+    // State 957
+    { 957, 536, PA_REDUCE, 905 },
+    // State 957 default action
+    { 957, -1, PA_REDUCE, 905 },
+    // State 958
+    { 958, 2, PA_SHIFT, 973 },
+    // State 958
+    { 958, 456, PA_SHIFT, 959 },
+    // State 958
+    { 958, 536, PA_REDUCE, 907 },
+    // State 958 default action
+    { 958, -1, PA_REDUCE, 907 },
+    // State 959
+    { 959, 3, PA_SHIFT, 972 },
+    // State 959
+    { 959, 457, PA_SHIFT, 960 },
+    // State 959
+    { 959, 536, PA_REDUCE, 909 },
+    // State 959 default action
+    { 959, -1, PA_REDUCE, 909 },
+    // State 960
+    { 960, 4, PA_SHIFT, 971 },
+    // State 960
+    { 960, 458, PA_SHIFT, 961 },
+    // State 960
+    { 960, 536, PA_REDUCE, 911 },
+    // State 960 default action
+    { 960, -1, PA_REDUCE, 911 },
+    // State 961
+    { 961, 5, PA_SHIFT, 970 },
+    // State 961
+    { 961, 459, PA_SHIFT, 962 },
+    // State 961
+    { 961, 536, PA_REDUCE, 913 },
+    // State 961 default action
+    { 961, -1, PA_REDUCE, 913 },
+    // State 962
+    { 962, 6, PA_SHIFT, 969 },
+    // State 962
+    { 962, 460, PA_SHIFT, 963 },
+    // State 962
+    { 962, 536, PA_REDUCE, 915 },
+    // State 962 default action
+    { 962, -1, PA_REDUCE, 915 },
+    // State 963
+    { 963, 7, PA_SHIFT, 968 },
+    // State 963
+    { 963, 461, PA_SHIFT, 964 },
+    // State 963
+    { 963, 536, PA_REDUCE, 917 },
+    // State 963 default action
+    { 963, -1, PA_REDUCE, 917 },
+    // State 964
+    { 964, 8, PA_SHIFT, 967 },
+    // State 964
+    { 964, 67, PA_REDUCE, 919 },
+    // State 964
+    { 964, 462, PA_SHIFT, 965 },
+    // State 965
+    { 965, 67, PA_SHIFT, 966 },
+    // State 966
+    { 966, 536, PA_REDUCE, 904 },
+    // State 966 default action
+    { 966, -1, PA_REDUCE, 904 },
+    // State 967
+    { 967, 67, PA_REDUCE, 920 },
+    // State 968
+    { 968, 536, PA_REDUCE, 918 },
+    // State 968 default action
+    { 968, -1, PA_REDUCE, 918 },
+    // State 969
+    { 969, 536, PA_REDUCE, 916 },
+    // State 969 default action
+    { 969, -1, PA_REDUCE, 916 },
+    // State 970
+    { 970, 536, PA_REDUCE, 914 },
+    // State 970 default action
+    { 970, -1, PA_REDUCE, 914 },
+    // State 971
+    { 971, 536, PA_REDUCE, 912 },
+    // State 971 default action
+    { 971, -1, PA_REDUCE, 912 },
+    // State 972
+    { 972, 536, PA_REDUCE, 910 },
+    // State 972 default action
+    { 972, -1, PA_REDUCE, 910 },
+    // State 973
+    { 973, 536, PA_REDUCE, 908 },
+    // State 973 default action
+    { 973, -1, PA_REDUCE, 908 },
+    // State 974
+    { 974, 536, PA_REDUCE, 906 },
+    // State 974 default action
+    { 974, -1, PA_REDUCE, 906 },
+    // State 975
+    { 975, 1, PA_SHIFT, 992 },
+    // State 975
+    { 975, 463, PA_SHIFT, 976 },
+    // State 975
+    { 975, 536, PA_REDUCE, 922 },
+    // State 975 default action
+    { 975, -1, PA_REDUCE, 922 },
+    // State 976
+    { 976, 2, PA_SHIFT, 991 },
+    // State 976
+    { 976, 464, PA_SHIFT, 977 },
+    // State 976
+    { 976, 536, PA_REDUCE, 924 },
+    // State 976 default action
+    { 976, -1, PA_REDUCE, 924 },
+    // State 977
+    { 977, 3, PA_SHIFT, 990 },
+    // State 977
+    { 977, 465, PA_SHIFT, 978 },
+    // State 977
+    { 977, 536, PA_REDUCE, 926 },
+    // State 977 default action
+    { 977, -1, PA_REDUCE, 926 },
+    // State 978
+    { 978, 4, PA_SHIFT, 989 },
+    // State 978
+    { 978, 466, PA_SHIFT, 979 },
+    // State 978
+    { 978, 536, PA_REDUCE, 928 },
+    // State 978 default action
+    { 978, -1, PA_REDUCE, 928 },
+    // State 979
+    { 979, 5, PA_SHIFT, 988 },
+    // State 979
+    { 979, 467, PA_SHIFT, 980 },
+    // State 979
+    { 979, 536, PA_REDUCE, 930 },
+    // State 979 default action
+    { 979, -1, PA_REDUCE, 930 },
+    // State 980
+    { 980, 6, PA_SHIFT, 987 },
+    // State 980
+    { 980, 468, PA_SHIFT, 981 },
+    // State 980
+    { 980, 536, PA_REDUCE, 932 },
+    // State 980 default action
+    { 980, -1, PA_REDUCE, 932 },
+    // State 981
+    { 981, 7, PA_SHIFT, 986 },
+    // State 981
+    { 981, 469, PA_SHIFT, 982 },
+    // State 981
+    { 981, 536, PA_REDUCE, 934 },
+    // State 981 default action
+    { 981, -1, PA_REDUCE, 934 },
+    // State 982
+    { 982, 8, PA_SHIFT, 985 },
+    // State 982
+    { 982, 67, PA_REDUCE, 936 },
+    // State 982
+    { 982, 470, PA_SHIFT, 983 },
+    // State 983
+    { 983, 67, PA_SHIFT, 984 },
+    // State 984
+    { 984, 536, PA_REDUCE, 921 },
+    // State 984 default action
+    { 984, -1, PA_REDUCE, 921 },
+    // State 985
+    { 985, 67, PA_REDUCE, 937 },
+    // State 986
+    { 986, 536, PA_REDUCE, 935 },
+    // State 986 default action
+    { 986, -1, PA_REDUCE, 935 },
+    // State 987
+    { 987, 536, PA_REDUCE, 933 },
+    // State 987 default action
+    { 987, -1, PA_REDUCE, 933 },
+    // State 988
+    { 988, 536, PA_REDUCE, 931 },
+    // State 988 default action
+    { 988, -1, PA_REDUCE, 931 },
+    // State 989
+    { 989, 536, PA_REDUCE, 929 },
+    // State 989 default action
+    { 989, -1, PA_REDUCE, 929 },
+    // State 990
+    { 990, 536, PA_REDUCE, 927 },
+    // State 990 default action
+    { 990, -1, PA_REDUCE, 927 },
+    // State 991
+    { 991, 536, PA_REDUCE, 925 },
+    // State 991 default action
+    { 991, -1, PA_REDUCE, 925 },
+    // State 992
+    { 992, 536, PA_REDUCE, 923 },
+    // State 992 default action
+    { 992, -1, PA_REDUCE, 923 },
+    // State 993
+    { 993, 1, PA_SHIFT, 1010 },
+    // State 993
+    { 993, 471, PA_SHIFT, 994 },
+    // State 993
+    { 993, 536, PA_REDUCE, 939 },
+    // State 993 default action
+    { 993, -1, PA_REDUCE, 939 },
+    // State 994
+    { 994, 2, PA_SHIFT, 1009 },
+    // State 994
+    { 994, 472, PA_SHIFT, 995 },
+    // State 994
+    { 994, 536, PA_REDUCE, 941 },
+    // State 994 default action
+    { 994, -1, PA_REDUCE, 941 },
+    // State 995
+    { 995, 3, PA_SHIFT, 1008 },
+    // State 995
+    { 995, 473, PA_SHIFT, 996 },
+    // State 995
+    { 995, 536, PA_REDUCE, 943 },
+    // State 995 default action
+    { 995, -1, PA_REDUCE, 943 },
+    // State 996
+    { 996, 4, PA_SHIFT, 1007 },
+    // State 996
+    { 996, 474, PA_SHIFT, 997 },
+    // State 996
+    { 996, 536, PA_REDUCE, 945 },
+    // State 996 default action
+    { 996, -1, PA_REDUCE, 945 },
+    // State 997
+    { 997, 5, PA_SHIFT, 1006 },
+    // State 997
+    { 997, 475, PA_SHIFT, 998 },
+    // State 997
+    { 997, 536, PA_REDUCE, 947 },
+    // State 997 default action
+    { 997, -1, PA_REDUCE, 947 },
+    // State 998
+    { 998, 6, PA_SHIFT, 1005 },
+    // State 998
+    { 998, 476, PA_SHIFT, 999 },
+    // State 998
+    { 998, 536, PA_REDUCE, 949 },
+    // State 998 default action
+    { 998, -1, PA_REDUCE, 949 },
+    // State 999
+    { 999, 7, PA_SHIFT, 1004 },
+    // State 999
+    { 999, 477, PA_SHIFT, 1000 },
+    // State 999
+    { 999, 536, PA_REDUCE, 951 },
+    // State 999 default action
+    { 999, -1, PA_REDUCE, 951 },
+    // State 1000
+    { 1000, 8, PA_SHIFT, 1003 },
+    // State 1000
+    { 1000, 67, PA_REDUCE, 953 },
+    // State 1000
+    { 1000, 478, PA_SHIFT, 1001 },
+    // State 1001
+    { 1001, 67, PA_SHIFT, 1002 },
+    // State 1002
+    { 1002, 536, PA_REDUCE, 938 },
+    // State 1002 default action
+    { 1002, -1, PA_REDUCE, 938 },
+    // State 1003
+    { 1003, 67, PA_REDUCE, 954 },
+    // State 1004
+    { 1004, 536, PA_REDUCE, 952 },
+    // State 1004 default action
+    { 1004, -1, PA_REDUCE, 952 },
+    // State 1005
+    { 1005, 536, PA_REDUCE, 950 },
+    // State 1005 default action
+    { 1005, -1, PA_REDUCE, 950 },
+    // State 1006
+    { 1006, 536, PA_REDUCE, 948 },
+    // State 1006 default action
+    { 1006, -1, PA_REDUCE, 948 },
+    // State 1007
+    { 1007, 536, PA_REDUCE, 946 },
+    // State 1007 default action
+    { 1007, -1, PA_REDUCE, 946 },
+    // State 1008
+    { 1008, 536, PA_REDUCE, 944 },
+    // State 1008 default action
+    { 1008, -1, PA_REDUCE, 944 },
+    // State 1009
+    { 1009, 536, PA_REDUCE, 942 },
+    // State 1009 default action
+    { 1009, -1, PA_REDUCE, 942 },
+    // State 1010
+    { 1010, 536, PA_REDUCE, 940 },
+    // State 1010 default action
+    { 1010, -1, PA_REDUCE, 940 },
+    // State 1011
+    { 1011, 1, PA_SHIFT, 1028 },
+    // State 1011
+    { 1011, 479, PA_SHIFT, 1012 },
+    // State 1011
+    { 1011, 536, PA_REDUCE, 956 },
+    // State 1011 default action
+    { 1011, -1, PA_REDUCE, 956 },
+    // State 1012
+    { 1012, 2, PA_SHIFT, 1027 },
+    // State 1012
+    { 1012, 480, PA_SHIFT, 1013 },
+    // State 1012
+    { 1012, 536, PA_REDUCE, 958 },
+    // State 1012 default action
+    { 1012, -1, PA_REDUCE, 958 },
+    // State 1013
+    { 1013, 3, PA_SHIFT, 1026 },
+    // State 1013
+    { 1013, 481, PA_SHIFT, 1014 },
+    // State 1013
+    { 1013, 536, PA_REDUCE, 960 },
+    // State 1013 default action
+    { 1013, -1, PA_REDUCE, 960 },
+    // State 1014
+    { 1014, 4, PA_SHIFT, 1025 },
+    // State 1014
+    { 1014, 482, PA_SHIFT, 1015 },
+    // State 1014
+    { 1014, 536, PA_REDUCE, 962 },
+    // State 1014 default action
+    { 1014, -1, PA_REDUCE, 962 },
+    // State 1015
+    { 1015, 5, PA_SHIFT, 1024 },
+    // State 1015
+    { 1015, 483, PA_SHIFT, 1016 },
+    // State 1015
+    { 1015, 536, PA_REDUCE, 964 },
+    // State 1015 default action
+    { 1015, -1, PA_REDUCE, 964 },
+    // State 1016
+    { 1016, 6, PA_SHIFT, 1023 },
+    // State 1016
+    { 1016, 484, PA_SHIFT, 1017 },
+    // State 1016
+    { 1016, 536, PA_REDUCE, 966 },
+    // State 1016 default action
+    { 1016, -1, PA_REDUCE, 966 },
+    // State 1017
+    { 1017, 7, PA_SHIFT, 1022 },
+    // State 1017
+    { 1017, 485, PA_SHIFT, 1018 },
+    // State 1017
+    { 1017, 536, PA_REDUCE, 968 },
+    // State 1017 default action
+    { 1017, -1, PA_REDUCE, 968 },
+    // State 1018
+    { 1018, 8, PA_SHIFT, 1021 },
+    // State 1018
+    { 1018, 67, PA_REDUCE, 970 },
+    // State 1018
+    { 1018, 486, PA_SHIFT, 1019 },
+    // State 1019
+    { 1019, 67, PA_SHIFT, 1020 },
+    // State 1020
+    { 1020, 536, PA_REDUCE, 955 },
+    // State 1020 default action
+    { 1020, -1, PA_REDUCE, 955 },
+    // State 1021
+    { 1021, 67, PA_REDUCE, 971 },
+    // State 1022
+    { 1022, 536, PA_REDUCE, 969 },
+    // State 1022 default action
+    { 1022, -1, PA_REDUCE, 969 },
+    // State 1023
+    { 1023, 536, PA_REDUCE, 967 },
+    // State 1023 default action
+    { 1023, -1, PA_REDUCE, 967 },
+    // State 1024
+    { 1024, 536, PA_REDUCE, 965 },
+    // State 1024 default action
+    { 1024, -1, PA_REDUCE, 965 },
+    // State 1025
+    { 1025, 536, PA_REDUCE, 963 },
+    // State 1025 default action
+    { 1025, -1, PA_REDUCE, 963 },
+    // State 1026
+    { 1026, 536, PA_REDUCE, 961 },
+    // State 1026 default action
+    { 1026, -1, PA_REDUCE, 961 },
+    // State 1027
+    { 1027, 536, PA_REDUCE, 959 },
+    // State 1027 default action
+    { 1027, -1, PA_REDUCE, 959 },
+    // State 1028
+    { 1028, 536, PA_REDUCE, 957 },
+    // State 1028 default action
+    { 1028, -1, PA_REDUCE, 957 },
+    // State 1029
+    { 1029, 1, PA_SHIFT, 1046 },
+    // State 1029
+    { 1029, 487, PA_SHIFT, 1030 },
+    // State 1029
+    { 1029, 536, PA_REDUCE, 973 },
+    // State 1029 default action
+    { 1029, -1, PA_REDUCE, 973 },
+    // State 1030
+    { 1030, 2, PA_SHIFT, 1045 },
+    // State 1030
+    { 1030, 488, PA_SHIFT, 1031 },
+    // State 1030
+    { 1030, 536, PA_REDUCE, 975 },
+    // State 1030 default action
+    { 1030, -1, PA_REDUCE, 975 },
+    // State 1031
+    { 1031, 3, PA_SHIFT, 1044 },
+    // State 1031
+    { 1031, 489, PA_SHIFT, 1032 },
+    // State 1031
+    { 1031, 536, PA_REDUCE, 977 },
+    // State 1031 default action
+    { 1031, -1, PA_REDUCE, 977 },
+    // State 1032
+    { 1032, 4, PA_SHIFT, 1043 },
+    // State 1032
+    { 1032, 490, PA_SHIFT, 1033 },
+    // State 1032
+    { 1032, 536, PA_REDUCE, 979 },
+    // State 1032 default action
+    { 1032, -1, PA_REDUCE, 979 },
+    // State 1033
+    { 1033, 5, PA_SHIFT, 1042 },
+    // State 1033
+    { 1033, 491, PA_SHIFT, 1034 },
+    // State 1033
+    { 1033, 536, PA_REDUCE, 981 },
+    // State 1033 default action
+    { 1033, -1, PA_REDUCE, 981 },
+    // State 1034
+    { 1034, 6, PA_SHIFT, 1041 },
+    // State 1034
+    { 1034, 492, PA_SHIFT, 1035 },
+    // State 1034
+    { 1034, 536, PA_REDUCE, 983 },
+    // State 1034 default action
+    { 1034, -1, PA_REDUCE, 983 },
+    // State 1035
+    { 1035, 7, PA_SHIFT, 1040 },
+    // State 1035
+    { 1035, 493, PA_SHIFT, 1036 },
+    // State 1035
+    { 1035, 536, PA_REDUCE, 985 },
+    // State 1035 default action
+    { 1035, -1, PA_REDUCE, 985 },
+    // State 1036
+    { 1036, 8, PA_SHIFT, 1039 },
+    // State 1036
+    { 1036, 67, PA_REDUCE, 987 },
+    // State 1036
+    { 1036, 494, PA_SHIFT, 1037 },
+    // State 1037
+    { 1037, 67, PA_SHIFT, 1038 },
+    // State 1038
+    { 1038, 536, PA_REDUCE, 972 },
+    // State 1038 default action
+    { 1038, -1, PA_REDUCE, 972 },
+    // State 1039
+    { 1039, 67, PA_REDUCE, 988 },
+    // State 1040
+    { 1040, 536, PA_REDUCE, 986 },
+    // State 1040 default action
+    { 1040, -1, PA_REDUCE, 986 },
+    // State 1041
+    { 1041, 536, PA_REDUCE, 984 },
+    // State 1041 default action
+    { 1041, -1, PA_REDUCE, 984 },
+    // State 1042
+    { 1042, 536, PA_REDUCE, 982 },
+    // State 1042 default action
+    { 1042, -1, PA_REDUCE, 982 },
+    // State 1043
+    { 1043, 536, PA_REDUCE, 980 },
+    // State 1043 default action
+    { 1043, -1, PA_REDUCE, 980 },
+    // State 1044
+    { 1044, 536, PA_REDUCE, 978 },
+    // State 1044 default action
+    { 1044, -1, PA_REDUCE, 978 },
+    // State 1045
+    { 1045, 536, PA_REDUCE, 976 },
+    // State 1045 default action
+    { 1045, -1, PA_REDUCE, 976 },
+    // State 1046
+    { 1046, 536, PA_REDUCE, 974 },
+    // State 1046 default action
+    { 1046, -1, PA_REDUCE, 974 },
+};
+
+
+static int theRuleTable[989][2] =
+{
+    // prog ::= blocks
+    { 535, 1 }, 
+    // blocks ::=
+    { 69, 0 }, 
+    // blocks ::= blocks block
+    { 69, 2 }, 
+    // block ::= B0 o0_0 o0_1 o0_2 o0_3 o0_4 o0_5 o0_6 o0_7 END
+    { 68, 10 }, 
+    // o0_0 ::=
+    { 71, 0 }, 
+    // o0_0 ::= A0
+    { 71, 1 }, 
+    // o0_1 ::=
+    { 72, 0 }, 
+    // o0_1 ::= A1
+    { 72, 1 }, 
+    // o0_2 ::=
+    { 73, 0 }, 
+    // o0_2 ::= A2
+    { 73, 1 }, 
+    // o0_3 ::=
+    { 74, 0 }, 
+    // o0_3 ::= A3
+    { 74, 1 }, 
+    // o0_4 ::=
+    { 75, 0 }, 
+    // o0_4 ::= A4
+    { 75, 1 }, 
+    // o0_5 ::=
+    { 76, 0 }, 
+    // o0_5 ::= A5
+    { 76, 1 }, 
+    // o0_6 ::=
+    { 77, 0 }, 
+    // o0_6 ::= A6
+    { 77, 1 }, 
+    // o0_7 ::=
+    { 78, 0 }, 
+    // o0_7 ::= A7
+    { 78, 1 }, 
+    // block ::= B1 o1_0 o1_1 o1_2 o1_3 o1_4 o1_5 o1_6 o1_7 END
+    { 68, 10 }, 
+    // o1_0 ::=
+    { 159, 0 }, 
+    // o1_0 ::= A0
+    { 159, 1 }, 
+    // o1_1 ::=
+    { 160, 0 }, 
+    // o1_1 ::= A1
+    { 160, 1 }, 
+    // o1_2 ::=
+    { 161, 0 }, 
+    // o1_2 ::= A2
+    { 161, 1 }, 
+    // o1_3 ::=
+    { 162, 0 }, 
+    // o1_3 ::= A3
+    { 162, 1 }, 
+    // o1_4 ::=
+    { 163, 0 }, 
+    // o1_4 ::= A4
+    { 163, 1 }, 
+    // o1_5 ::=
+    { 164, 0 }, 
+    // o1_5 ::= A5
+    { 164, 1 }, 
+    // o1_6 ::=
+    { 165, 0 }, 
+    // o1_6 ::= A6
+    { 165, 1 }, 
+    // o1_7 ::=
+    { 166, 0 }, 
+    // o1_7 ::= A7
+    { 166, 1 }, 
+    // block ::= B2 o2_0 o2_1 o2_2 o2_3 o2_4 o2_5 o2_6 o2_7 END
+    { 68, 10 }, 
+    // o2_0 ::=
+    { 247, 0 }, 
+    // o2_0 ::= A0
+    { 247, 1 }, 
+    // o2_1 ::=
+    { 248, 0 }, 
+    // o2_1 ::= A1
+    { 248, 1 }, 
+    // o2_2 ::=
+    { 249, 0 }, 
+    // o2_2 ::= A2
+    { 249, 1 }, 
+    // o2_3 ::=
+    { 250, 0 }, 
+    // o2_3 ::= A3
+    { 250, 1 }, 
+    // o2_4 ::=
+    { 251, 0 }, 
+    // o2_4 ::= A4
+    { 251, 1 }, 
+    // o2_5 ::=
+    { 252, 0 }, 
+    // o2_5 ::= A5
+    { 252, 1 }, 
+    // o2_6 ::=
+    { 253, 0 }, 
+    // o2_6 ::= A6
+    { 253, 1 }, 
+    // o2_7 ::=
+    { 254, 0 }, 
+    // o2_7 ::= A7
+    { 254, 1 }, 
+    // block ::= B3 o3_0 o3_1 o3_2 o3_3 o3_4 o3_5 o3_6 o3_7 END
+    { 68, 10 }, 
+    // o3_0 ::=
+    { 335, 0 }, 
+    // o3_0 ::= A0
+    { 335, 1 }, 
+    // o3_1 ::=
+    { 336, 0 }, 
+    // o3_1 ::= A1
+    { 336, 1 }, 
+    // o3_2 ::=
+    { 337, 0 }, 
+    // o3_2 ::= A2
+    { 337, 1 }, 
+    // o3_3 ::=
+    { 338, 0 }, 
+    // o3_3 ::= A3
+    { 338, 1 }, 
+    // o3_4 ::=
+    { 339, 0 }, 
+    // o3_4 ::= A4
+    { 339, 1 }, 
+    // o3_5 ::=
+    { 340, 0 }, 
+    // o3_5 ::= A5
+    { 340, 1 }, 
+    // o3_6 ::=
+    { 341, 0 }, 
+    // o3_6 ::= A6
+    { 341, 1 }, 
+    // o3_7 ::=
+    { 342, 0 }, 
+    // o3_7 ::= A7
+    { 342, 1 }, 
+    // block ::= B4 o4_0 o4_1 o4_2 o4_3 o4_4 o4_5 o4_6 o4_7 END
+    { 68, 10 }, 
+    // o4_0 ::=
+    { 423, 0 }, 
+    // o4_0 ::= A0
+    { 423, 1 }, 
+    // o4_1 ::=
+    { 424, 0 }, 
+    // o4_1 ::= A1
+    { 424, 1 }, 
+    // o4_2 ::=
+    { 425, 0 }, 
+    // o4_2 ::= A2
+    { 425, 1 }, 
+    // o4_3 ::=
+    { 426, 0 }, 
+    // o4_3 ::= A3
+    { 426, 1 }, 
+    // o4_4 ::=
+    { 427, 0 }, 
+    // o4_4 ::= A4
+    { 427, 1 }, 
+    // o4_5 ::=
+    { 428, 0 }, 
+    // o4_5 ::= A5
+    { 428, 1 }, 
+    // o4_6 ::=
+    { 429, 0 }, 
+    // o4_6 ::= A6
+    { 429, 1 }, 
+    // o4_7 ::=
+    { 430, 0 }, 
+    // o4_7 ::= A7
+    { 430, 1 }, 
+    // block ::= B5 o5_0 o5_1 o5_2 o5_3 o5_4 o5_5 o5_6 o5_7 END
+    { 68, 10 }, 
+    // o5_0 ::=
+    { 495, 0 }, 
+    // o5_0 ::= A0
+    { 495, 1 }, 
+    // o5_1 ::=
+    { 496, 0 }, 
+    // o5_1 ::= A1
+    { 496, 1 }, 
+    // o5_2 ::=
+    { 497, 0 }, 
+    // o5_2 ::= A2
+    { 497, 1 }, 
+    // o5_3 ::=
+    { 498, 0 }, 
+    // o5_3 ::= A3
+    { 498, 1 }, 
+    // o5_4 ::=
+    { 499, 0 }, 
+    // o5_4 ::= A4
+    { 499, 1 }, 
+    // o5_5 ::=
+    { 500, 0 }, 
+    // o5_5 ::= A5
+    { 500, 1 }, 
+    // o5_6 ::=
+    { 501, 0 }, 
+    // o5_6 ::= A6
+    { 501, 1 }, 
+    // o5_7 ::=
+    { 502, 0 }, 
+    // o5_7 ::= A7
+    { 502, 1 }, 
+    // block ::= B6 o6_0 o6_1 o6_2 o6_3 o6_4 o6_5 o6_6 o6_7 END
+    { 68, 10 }, 
+    // o6_0 ::=
+    { 503, 0 }, 
+    // o6_0 ::= A0
+    { 503, 1 }, 
+    // o6_1 ::=
+    { 504, 0 }, 
+    // o6_1 ::= A1
+    { 504, 1 }, 
+    // o6_2 ::=
+    { 505, 0 }, 
+    // o6_2 ::= A2
+    { 505, 1 }, 
+    // o6_3 ::=
+    { 506, 0 }, 
+    // o6_3 ::= A3
+    { 506, 1 }, 
+    // o6_4 ::=
+    { 507, 0 }, 
+    // o6_4 ::= A4
+    { 507, 1 }, 
+    // o6_5 ::=
+    { 508, 0 }, 
+    // o6_5 ::= A5
+    { 508, 1 }, 
+    // o6_6 ::=
+    { 509, 0 }, 
+    // o6_6 ::= A6
+    { 509, 1 }, 
+    // o6_7 ::=
+    { 510, 0 }, 
+    // o6_7 ::= A7
+    { 510, 1 }, 
+    // block ::= B7 o7_0 o7_1 o7_2 o7_3 o7_4 o7_5 o7_6 o7_7 END
+    { 68, 10 }, 
+    // o7_0 ::=
+    { 511, 0 }, 
+    // o7_0 ::= A0
+    { 511, 1 }, 
+    // o7_1 ::=
+    { 512, 0 }, 
+    // o7_1 ::= A1
+    { 512, 1 }, 
+    // o7_2 ::=
+    { 513, 0 }, 
+    // o7_2 ::= A2
+    { 513, 1 }, 
+    // o7_3 ::=
+    { 514, 0 }, 
+    // o7_3 ::= A3
+    { 514, 1 }, 
+    // o7_4 ::=
+    { 515, 0 }, 
+    // o7_4 ::= A4
+    { 515, 1 }, 
+    // o7_5 ::=
+    { 516, 0 }, 
+    // o7_5 ::= A5
+    { 516, 1 }, 
+    // o7_6 ::=
+    { 517, 0 }, 
+    // o7_6 ::= A6
+    { 517, 1 }, 
+    // o7_7 ::=
+    { 518, 0 }, 
+    // o7_7 ::= A7
+    { 518, 1 }, 
+    // block ::= B8 o8_0 o8_1 o8_2 o8_3 o8_4 o8_5 o8_6 o8_7 END
+    { 68, 10 }, 
+    // o8_0 ::=
+    { 519, 0 }, 
+    // o8_0 ::= A0
+    { 519, 1 }, 
+    // o8_1 ::=
+    { 520, 0 }, 
+    // o8_1 ::= A1
+    { 520, 1 }, 
+    // o8_2 ::=
+    { 521, 0 }, 
+    // o8_2 ::= A2
+    { 521, 1 }, 
+    // o8_3 ::=
+    { 522, 0 }, 
+    // o8_3 ::= A3
+    { 522, 1 }, 
+    // o8_4 ::=
+    { 523, 0 }, 
+    // o8_4 ::= A4
+    { 523, 1 }, 
+    // o8_5 ::=
+    { 524, 0 }, 
+    // o8_5 ::= A5
+    { 524, 1 }, 
+    // o8_6 ::=
+    { 525, 0 }, 
+    // o8_6 ::= A6
+    { 525, 1 }, 
+    // o8_7 ::=
+    { 526, 0 }, 
+    // o8_7 ::= A7
+    { 526, 1 }, 
+    // block ::= B9 o9_0 o9_1 o9_2 o9_3 o9_4 o9_5 o9_6 o9_7 END
+    { 68, 10 }, 
+    // o9_0 ::=
+    { 527, 0 }, 
+    // o9_0 ::= A0
+    { 527, 1 }, 
+    // o9_1 ::=
+    { 528, 0 }, 
+    // o9_1 ::= A1
+    { 528, 1 }, 
+    // o9_2 ::=
+    { 529, 0 }, 
+    // o9_2 ::= A2
+    { 529, 1 }, 
+    // o9_3 ::=
+    { 530, 0 }, 
+    // o9_3 ::= A3
+    { 530, 1 }, 
+    // o9_4 ::=
+    { 531, 0 }, 
+    // o9_4 ::= A4
+    { 531, 1 }, 
+    // o9_5 ::=
+    { 532, 0 }, 
+    // o9_5 ::= A5
+    { 532, 1 }, 
+    // o9_6 ::=
+    { 533, 0 }, 
+    // o9_6 ::= A6
+    { 533, 1 }, 
+    // o9_7 ::=
+    { 534, 0 }, 
+    // o9_7 ::= A7
+    { 534, 1 }, 
+    // block ::= B10 o10_0 o10_1 o10_2 o10_3 o10_4 o10_5 o10_6 o10_7 END
+    { 68, 10 }, 
+    // o10_0 ::=
+    { 79, 0 }, 
+    // o10_0 ::= A0
+    { 79, 1 }, 
+    // o10_1 ::=
+    { 80, 0 }, 
+    // o10_1 ::= A1
+    { 80, 1 }, 
+    // o10_2 ::=
+    { 81, 0 }, 
+    // o10_2 ::= A2
+    { 81, 1 }, 
+    // o10_3 ::=
+    { 82, 0 }, 
+    // o10_3 ::= A3
+    { 82, 1 }, 
+    // o10_4 ::=
+    { 83, 0 }, 
+    // o10_4 ::= A4
+    { 83, 1 }, 
+    // o10_5 ::=
+    { 84, 0 }, 
+    // o10_5 ::= A5
+    { 84, 1 }, 
+    // o10_6 ::=
+    { 85, 0 }, 
+    // o10_6 ::= A6
+    { 85, 1 }, 
+    // o10_7 ::=
+    { 86, 0 }, 
+    // o10_7 ::= A7
+    { 86, 1 }, 
+    // block ::= B11 o11_0 o11_1 o11_2 o11_3 o11_4 o11_5 o11_6 o11_7 END
+    { 68, 10 }, 
+    // o11_0 ::=
+    { 87, 0 }, 
+    // o11_0 ::= A0
+    { 87, 1 }, 
+    // o11_1 ::=
+    { 88, 0 }, 
+    // o11_1 ::= A1
+    { 88, 1 }, 
+    // o11_2 ::=
+    { 89, 0 }, 
+    // o11_2 ::= A2
+    { 89, 1 }, 
+    // o11_3 ::=
+    { 90, 0 }, 
+    // o11_3 ::= A3
+    { 90, 1 }, 
+    // o11_4 ::=
+    { 91, 0 }, 
+    // o11_4 ::= A4
+    { 91, 1 }, 
+    // o11_5 ::=
+    { 92, 0 }, 
+    // o11_5 ::= A5
+    { 92, 1 }, 
+    // o11_6 ::=
+    { 93, 0 }, 
+    // o11_6 ::= A6
+    { 93, 1 }, 
+    // o11_7 ::=
+    { 94, 0 }, 
+    // o11_7 ::= A7
+    { 94, 1 }, 
+    // block ::= B12 o12_0 o12_1 o12_2 o12_3 o12_4 o12_5 o12_6 o12_7 END
+    { 68, 10 }, 
+    // o12_0 ::=
+    { 95, 0 }, 
+    // o12_0 ::= A0
+    { 95, 1 }, 
+    // o12_1 ::=
+    { 96, 0 }, 
+    // o12_1 ::= A1
+    { 96, 1 }, 
+    // o12_2 ::=
+    { 97, 0 }, 
+    // o12_2 ::= A2
+    { 97, 1 }, 
+    // o12_3 ::=
+    { 98, 0 }, 
+    // o12_3 ::= A3
+    { 98, 1 }, 
+    // o12_4 ::=
+    { 99, 0 }, 
+    // o12_4 ::= A4
+    { 99, 1 }, 
+    // o12_5 ::=
+    { 100, 0 }, 
+    // o12_5 ::= A5
+    { 100, 1 }, 
+    // o12_6 ::=
+    { 101, 0 }, 
+    // o12_6 ::= A6
+    { 101, 1 }, 
+    // o12_7 ::=
+    { 102, 0 }, 
+    // o12_7 ::= A7
+    { 102, 1 }, 
+    // block ::= B13 o13_0 o13_1 o13_2 o13_3 o13_4 o13_5 o13_6 o13_7 END
+    { 68, 10 }, 
+    // o13_0 ::=
+    { 103, 0 }, 
+    // o13_0 ::= A0
+    { 103, 1 }, 
+    // o13_1 ::=
+    { 104, 0 }, 
+    // o13_1 ::= A1
+    { 104, 1 }, 
+    // o13_2 ::=
+    { 105, 0 }, 
+    // o13_2 ::= A2
+    { 105, 1 }, 
+    // o13_3 ::=
+    { 106, 0 }, 
+    // o13_3 ::= A3
+    { 106, 1 }, 
+    // o13_4 ::=
+    { 107, 0 }, 
+    // o13_4 ::= A4
+    { 107, 1 }, 
+    // o13_5 ::=
+    { 108, 0 }, 
+    // o13_5 ::= A5
+    { 108, 1 }, 
+    // o13_6 ::=
+    { 109, 0 }, 
+    // o13_6 ::= A6
+    { 109, 1 }, 
+    // o13_7 ::=
+    { 110, 0 }, 
+    // o13_7 ::= A7
+    { 110, 1 }, 
+    // block ::= B14 o14_0 o14_1 o14_2 o14_3 o14_4 o14_5 o14_6 o14_7 END
+    { 68, 10 }, 
+    // o14_0 ::=
+    { 111, 0 }, 
+    // o14_0 ::= A0
+    { 111, 1 }, 
+    // o14_1 ::=
+    { 112, 0 }, 
+    // o14_1 ::= A1
+    { 112, 1 }, 
+    // o14_2 ::=
+    { 113, 0 }, 
+    // o14_2 ::= A2
+    { 113, 1 }, 
+    // o14_3 ::=
+    { 114, 0 }, 
+    // o14_3 ::= A3
+    { 114, 1 }, 
+    // o14_4 ::=
+    { 115, 0 }, 
+    // o14_4 ::= A4
+    { 115, 1 }, 
+    // o14_5 ::=
+    { 116, 0 }, 
+    // o14_5 ::= A5
+    { 116, 1 }, 
+    // o14_6 ::=
+    { 117, 0 }, 
+    // o14_6 ::= A6
+    { 117, 1 }, 
+    // o14_7 ::=
+    { 118, 0 }, 
+    // o14_7 ::= A7
+    { 118, 1 }, 
+    // block ::= B15 o15_0 o15_1 o15_2 o15_3 o15_4 o15_5 o15_6 o15_7 END
+    { 68, 10 }, 
+    // o15_0 ::=
+    { 119, 0 }, 
+    // o15_0 ::= A0
+    { 119, 1 }, 
+    // o15_1 ::=
+    { 120, 0 }, 
+    // o15_1 ::= A1
+    { 120, 1 }, 
+    // o15_2 ::=
+    { 121, 0 }, 
+    // o15_2 ::= A2
+    { 121, 1 }, 
+    // o15_3 ::=
+    { 122, 0 }, 
+    // o15_3 ::= A3
+    { 122, 1 }, 
+    // o15_4 ::=
+    { 123, 0 }, 
+    // o15_4 ::= A4
+    { 123, 1 }, 
+    // o15_5 ::=
+    { 124, 0 }, 
+    // o15_5 ::= A5
+    { 124, 1 }, 
+    // o15_6 ::=
+    { 125, 0 }, 
+    // o15_6 ::= A6
+    { 125, 1 }, 
+    // o15_7 ::=
+    { 126, 0 }, 
+    // o15_7 ::= A7
+    { 126, 1 }, 
+    // block ::= B16 o16_0 o16_1 o16_2 o16_3 o16_4 o16_5 o16_6 o16_7 END
+    { 68, 10 }, 
+    // o16_0 ::=
+    { 127, 0 }, 
+    // o16_0 ::= A0
+    { 127, 1 }, 
+    // o16_1 ::=
+    { 128, 0 }, 
+    // o16_1 ::= A1
+    { 128, 1 }, 
+    // o16_2 ::=
+    { 129, 0 }, 
+    // o16_2 ::= A2
+    { 129, 1 }, 
+    // o16_3 ::=
+    { 130, 0 }, 
+    // o16_3 ::= A3
+    { 130, 1 }, 
+    // o16_4 ::=
+    { 131, 0 }, 
+    // o16_4 ::= A4
+    { 131, 1 }, 
+    // o16_5 ::=
+    { 132, 0 }, 
+    // o16_5 ::= A5
+    { 132, 1 }, 
+    // o16_6 ::=
+    { 133, 0 }, 
+    // o16_6 ::= A6
+    { 133, 1 }, 
+    // o16_7 ::=
+    { 134, 0 }, 
+    // o16_7 ::= A7
+    { 134, 1 }, 
+    // block ::= B17 o17_0 o17_1 o17_2 o17_3 o17_4 o17_5 o17_6 o17_7 END
+    { 68, 10 }, 
+    // o17_0 ::=
+    { 135, 0 }, 
+    // o17_0 ::= A0
+    { 135, 1 }, 
+    // o17_1 ::=
+    { 136, 0 }, 
+    // o17_1 ::= A1
+    { 136, 1 }, 
+    // o17_2 ::=
+    { 137, 0 }, 
+    // o17_2 ::= A2
+    { 137, 1 }, 
+    // o17_3 ::=
+    { 138, 0 }, 
+    // o17_3 ::= A3
+    { 138, 1 }, 
+    // o17_4 ::=
+    { 139, 0 }, 
+    // o17_4 ::= A4
+    { 139, 1 }, 
+    // o17_5 ::=
+    { 140, 0 }, 
+    // o17_5 ::= A5
+    { 140, 1 }, 
+    // o17_6 ::=
+    { 141, 0 }, 
+    // o17_6 ::= A6
+    { 141, 1 }, 
+    // o17_7 ::=
+    { 142, 0 }, 
+    // o17_7 ::= A7
+    { 142, 1 }, 
+    // block ::= B18 o18_0 o18_1 o18_2 o18_3 o18_4 o18_5 o18_6 o18_7 END
+    { 68, 10 }, 
+    // o18_0 ::=
+    { 143, 0 }, 
+    // o18_0 ::= A0
+    { 143, 1 }, 
+    // o18_1 ::=
+    { 144, 0 }, 
+    // o18_1 ::= A1
+    { 144, 1 }, 
+    // o18_2 ::=
+    { 145, 0 }, 
+    // o18_2 ::= A2
+    { 145, 1 }, 
+    // o18_3 ::=
+    { 146, 0 }, 
+    // o18_3 ::= A3
+    { 146, 1 }, 
+    // o18_4 ::=
+    { 147, 0 }, 
+    // o18_4 ::= A4
+    { 147, 1 }, 
+    // o18_5 ::=
+    { 148, 0 }, 
+    // o18_5 ::= A5
+    { 148, 1 }, 
+    // o18_6 ::=
+    { 149, 0 }, 
+    // o18_6 ::= A6
+    { 149, 1 }, 
+    // o18_7 ::=
+    { 150, 0 }, 
+    // o18_7 ::= A7
+    { 150, 1 }, 
+    // block ::= B19 o19_0 o19_1 o19_2 o19_3 o19_4 o19_5 o19_6 o19_7 END
+    { 68, 10 }, 
+    // o19_0 ::=
+    { 151, 0 }, 
+    // o19_0 ::= A0
+    { 151, 1 }, 
+    // o19_1 ::=
+    { 152, 0 }, 
+    // o19_1 ::= A1
+    { 152, 1 }, 
+    // o19_2 ::=
+    { 153, 0 }, 
+    // o19_2 ::= A2
+    { 153, 1 }, 
+    // o19_3 ::=
+    { 154, 0 }, 
+    // o19_3 ::= A3
+    { 154, 1 }, 
+    // o19_4 ::=
+    { 155, 0 }, 
+    // o19_4 ::= A4
+    { 155, 1 }, 
+    // o19_5 ::=
+    { 156, 0 }, 
+    // o19_5 ::= A5
+    { 156, 1 }, 
+    // o19_6 ::=
+    { 157, 0 }, 
+    // o19_6 ::= A6
+    { 157, 1 }, 
+    // o19_7 ::=
+    { 158, 0 }, 
+    // o19_7 ::= A7
+    { 158, 1 }, 
+    // block ::= B20 o20_0 o20_1 o20_2 o20_3 o20_4 o20_5 o20_6 o20_7 END
+    { 68, 10 }, 
+    // o20_0 ::=
+    { 167, 0 }, 
+    // o20_0 ::= A0
+    { 167, 1 }, 
+    // o20_1 ::=
+    { 168, 0 }, 
+    // o20_1 ::= A1
+    { 168, 1 }, 
+    // o20_2 ::=
+    { 169, 0 }, 
+    // o20_2 ::= A2
+    { 169, 1 }, 
+    // o20_3 ::=
+    { 170, 0 }, 
+    // o20_3 ::= A3
+    { 170, 1 }, 
+    // o20_4 ::=
+    { 171, 0 }, 
+    // o20_4 ::= A4
+    { 171, 1 }, 
+    // o20_5 ::=
+    { 172, 0 }, 
+    // o20_5 ::= A5
+    { 172, 1 }, 
+    // o20_6 ::=
+    { 173, 0 }, 
+    // o20_6 ::= A6
+    { 173, 1 }, 
+    // o20_7 ::=
+    { 174, 0 }, 
+    // o20_7 ::= A7
+    { 174, 1 }, 
+    // block ::= B21 o21_0 o21_1 o21_2 o21_3 o21_4 o21_5 o21_6 o21_7 END
+    { 68, 10 }, 
+    // o21_0 ::=
+    { 175, 0 }, 
+    // o21_0 ::= A0
+    { 175, 1 }, 
+    // o21_1 ::=
+    { 176, 0 }, 
+    // o21_1 ::= A1
+    { 176, 1 }, 
+    // o21_2 ::=
+    { 177, 0 }, 
+    // o21_2 ::= A2
+    { 177, 1 }, 
+    // o21_3 ::=
+    { 178, 0 }, 
+    // o21_3 ::= A3
+    { 178, 1 }, 
+    // o21_4 ::=
+    { 179, 0 }, 
+    // o21_4 ::= A4
+    { 179, 1 }, 
+    // o21_5 ::=
+    { 180, 0 }, 
+    // o21_5 ::= A5
+    { 180, 1 }, 
+    // o21_6 ::=
+    { 181, 0 }, 
+    // o21_6 ::= A6
+    { 181, 1 }, 
+    // o21_7 ::=
+    { 182, 0 }, 
+    // o21_7 ::= A7
+    { 182, 1 }, 
+    // block ::= B22 o22_0 o22_1 o22_2 o22_3 o22_4 o22_5 o22_6 o22_7 END
+    { 68, 10 }, 
+    // o22_0 ::=
+    { 183, 0 }, 
+    // o22_0 ::= A0
+    { 183, 1 }, 
+    // o22_1 ::=
+    { 184, 0 }, 
+    // o22_1 ::= A1
+    { 184, 1 }, 
+    // o22_2 ::=
+    { 185, 0 }, 
+    // o22_2 ::= A2
+    { 185, 1 }, 
+    // o22_3 ::=
+    { 186, 0 }, 
+    // o22_3 ::= A3
+    { 186, 1 }, 
+    // o22_4 ::=
+    { 187, 0 }, 
+    // o22_4 ::= A4
+    { 187, 1 }, 
+    // o22_5 ::=
+    { 188, 0 }, 
+    // o22_5 ::= A5
+    { 188, 1 }, 
+    // o22_6 ::=
+    { 189, 0 }, 
+    // o22_6 ::= A6
+    { 189, 1 }, 
+    // o22_7 ::=
+    { 190, 0 }, 
+    // o22_7 ::= A7
+    { 190, 1 }, 
+    // block ::= B23 o23_0 o23_1 o23_2 o23_3 o23_4 o23_5 o23_6 o23_7 END
+    { 68, 10 }, 
+    // o23_0 ::=
+    { 191, 0 }, 
+    // o23_0 ::= A0
+    { 191, 1 }, 
+    // o23_1 ::=
+    { 192, 0 }, 
+    // o23_1 ::= A1
+    { 192, 1 }, 
+    // o23_2 ::=
+    { 193, 0 }, 
+    // o23_2 ::= A2
+    { 193, 1 }, 
+    // o23_3 ::=
+    { 194, 0 }, 
+    // o23_3 ::= A3
+    { 194, 1 }, 
+    // o23_4 ::=
+    { 195, 0 }, 
+    // o23_4 ::= A4
+    { 195, 1 }, 
+    // o23_5 ::=
+    { 196, 0 }, 
+    // o23_5 ::= A5
+    { 196, 1 }, 
+    // o23_6 ::=
+    { 197, 0 }, 
+    // o23_6 ::= A6
+    { 197, 1 }, 
+    // o23_7 ::=
+    { 198, 0 }, 
+    // o23_7 ::= A7
+    { 198, 1 }, 
+    // block ::= B24 o24_0 o24_1 o24_2 o24_3 o24_4 o24_5 o24_6 o24_7 END
+    { 68, 10 }, 
+    // o24_0 ::=
+    { 199, 0 }, 
+    // o24_0 ::= A0
+    { 199, 1 }, 
+    // o24_1 ::=
+    { 200, 0 }, 
+    // o24_1 ::= A1
+    { 200, 1 }, 
+    // o24_2 ::=
+    { 201, 0 }, 
+    // o24_2 ::= A2
+    { 201, 1 }, 
+    // o24_3 ::=
+    { 202, 0 }, 
+    // o24_3 ::= A3
+    { 202, 1 }, 
+    // o24_4 ::=
+    { 203, 0 }, 
+    // o24_4 ::= A4
+    { 203, 1 }, 
+    // o24_5 ::=
+    { 204, 0 }, 
+    // o24_5 ::= A5
+    { 204, 1 }, 
+    // o24_6 ::=
+    { 205, 0 }, 
+    // o24_6 ::= A6
+    { 205, 1 }, 
+    // o24_7 ::=
+    { 206, 0 }, 
+    // o24_7 ::= A7
+    { 206, 1 }, 
+    // block ::= B25 o25_0 o25_1 o25_2 o25_3 o25_4 o25_5 o25_6 o25_7 END
+    { 68, 10 }, 
+    // o25_0 ::=
+    { 207, 0 }, 
+    // o25_0 ::= A0
+    { 207, 1 }, 
+    // o25_1 ::=
+    { 208, 0 }, 
+    // o25_1 ::= A1
+    { 208, 1 }, 
+    // o25_2 ::=
+    { 209, 0 }, 
+    // o25_2 ::= A2
+    { 209, 1 }, 
+    // o25_3 ::=
+    { 210, 0 }, 
+    // o25_3 ::= A3
+    { 210, 1 }, 
+    // o25_4 ::=
+    { 211, 0 }, 
+    // o25_4 ::= A4
+    { 211, 1 }, 
+    // o25_5 ::=
+    { 212, 0 }, 
+    // o25_5 ::= A5
+    { 212, 1 }, 
+    // o25_6 ::=
+    { 213, 0 }, 
+    // o25_6 ::= A6
+    { 213, 1 }, 
+    // o25_7 ::=
+    { 214, 0 }, 
+    // o25_7 ::= A7
+    { 214, 1 }, 
+    // block ::= B26 o26_0 o26_1 o26_2 o26_3 o26_4 o26_5 o26_6 o26_7 END
+    { 68, 10 }, 
+    // o26_0 ::=
+    { 215, 0 }, 
+    // o26_0 ::= A0
+    { 215, 1 }, 
+    // o26_1 ::=
+    { 216, 0 }, 
+    // o26_1 ::= A1
+    { 216, 1 }, 
+    // o26_2 ::=
+    { 217, 0 }, 
+    // o26_2 ::= A2
+    { 217, 1 }, 
+    // o26_3 ::=
+    { 218, 0 }, 
+    // o26_3 ::= A3
+    { 218, 1 }, 
+    // o26_4 ::=
+    { 219, 0 }, 
+    // o26_4 ::= A4
+    { 219, 1 }, 
+    // o26_5 ::=
+    { 220, 0 }, 
+    // o26_5 ::= A5
+    { 220, 1 }, 
+    // o26_6 ::=
+    { 221, 0 }, 
+    // o26_6 ::= A6
+    { 221, 1 }, 
+    // o26_7 ::=
+    { 222, 0 }, 
+    // o26_7 ::= A7
+    { 222, 1 }, 
+    // block ::= B27 o27_0 o27_1 o27_2 o27_3 o27_4 o27_5 o27_6 o27_7 END
+    { 68, 10 }, 
+    // o27_0 ::=
+    { 223, 0 }, 
+    // o27_0 ::= A0
+    { 223, 1 }, 
+    // o27_1 ::=
+    { 224, 0 }, 
+    // o27_1 ::= A1
+    { 224, 1 }, 
+    // o27_2 ::=
+    { 225, 0 }, 
+    // o27_2 ::= A2
+    { 225, 1 }, 
+    // o27_3 ::=
+    { 226, 0 }, 
+    // o27_3 ::= A3
+    { 226, 1 }, 
+    // o27_4 ::=
+    { 227, 0 }, 
+    // o27_4 ::= A4
+    { 227, 1 }, 
+    // o27_5 ::=
+    { 228, 0 }, 
+    // o27_5 ::= A5
+    { 228, 1 }, 
+    // o27_6 ::=
+    { 229, 0 }, 
+    // o27_6 ::= A6
+    { 229, 1 }, 
+    // o27_7 ::=
+    { 230, 0 }, 
+    // o27_7 ::= A7
+    { 230, 1 }, 
+    // block ::= B28 o28_0 o28_1 o28_2 o28_3 o28_4 o28_5 o28_6 o28_7 END
+    { 68, 10 }, 
+    // o28_0 ::=
+    { 231, 0 }, 
+    // o28_0 ::= A0
+    { 231, 1 }, 
+    // o28_1 ::=
+    { 232, 0 }, 
+    // o28_1 ::= A1
+    { 232, 1 }, 
+    // o28_2 ::=
+    { 233, 0 }, 
+    // o28_2 ::= A2
+    { 233, 1 }, 
+    // o28_3 ::=
+    { 234, 0 }, 
+    // o28_3 ::= A3
+    { 234, 1 }, 
+    // o28_4 ::=
+    { 235, 0 }, 
+    // o28_4 ::= A4
+    { 235, 1 }, 
+    // o28_5 ::=
+    { 236, 0 }, 
+    // o28_5 ::= A5
+    { 236, 1 }, 
+    // o28_6 ::=
+    { 237, 0 }, 
+    // o28_6 ::= A6
+    { 237, 1 }, 
+    // o28_7 ::=
+    { 238, 0 }, 
+    // o28_7 ::= A7
+    { 238, 1 }, 
+    // block ::= B29 o29_0 o29_1 o29_2 o29_3 o29_4 o29_5 o29_6 o29_7 END
+    { 68, 10 }, 
+    // o29_0 ::=
+    { 239, 0 }, 
+    // o29_0 ::= A0
+    { 239, 1 }, 
+    // o29_1 ::=
+    { 240, 0 }, 
+    // o29_1 ::= A1
+    { 240, 1 }, 
+    // o29_2 ::=
+    { 241, 0 }, 
+    // o29_2 ::= A2
+    { 241, 1 }, 
+    // o29_3 ::=
+    { 242, 0 }, 
+    // o29_3 ::= A3
+    { 242, 1 }, 
+    // o29_4 ::=
+    { 243, 0 }, 
+    // o29_4 ::= A4
+    { 243, 1 }, 
+    // o29_5 ::=
+    { 244, 0 }, 
+    // o29_5 ::= A5
+    { 244, 1 }, 
+    // o29_6 ::=
+    { 245, 0 }, 
+    // o29_6 ::= A6
+    { 245, 1 }, 
+    // o29_7 ::=
+    { 246, 0 }, 
+    // o29_7 ::= A7
+    { 246, 1 }, 
+    // block ::= B30 o30_0 o30_1 o30_2 o30_3 o30_4 o30_5 o30_6 o30_7 END
+    { 68, 10 }, 
+    // o30_0 ::=
+    { 255, 0 }, 
+    // o30_0 ::= A0
+    { 255, 1 }, 
+    // o30_1 ::=
+    { 256, 0 }, 
+    // o30_1 ::= A1
+    { 256, 1 }, 
+    // o30_2 ::=
+    { 257, 0 }, 
+    // o30_2 ::= A2
+    { 257, 1 }, 
+    // o30_3 ::=
+    { 258, 0 }, 
+    // o30_3 ::= A3
+    { 258, 1 }, 
+    // o30_4 ::=
+    { 259, 0 }, 
+    // o30_4 ::= A4
+    { 259, 1 }, 
+    // o30_5 ::=
+    { 260, 0 }, 
+    // o30_5 ::= A5
+    { 260, 1 }, 
+    // o30_6 ::=
+    { 261, 0 }, 
+    // o30_6 ::= A6
+    { 261, 1 }, 
+    // o30_7 ::=
+    { 262, 0 }, 
+    // o30_7 ::= A7
+    { 262, 1 }, 
+    // block ::= B31 o31_0 o31_1 o31_2 o31_3 o31_4 o31_5 o31_6 o31_7 END
+    { 68, 10 }, 
+    // o31_0 ::=
+    { 263, 0 }, 
+    // o31_0 ::= A0
+    { 263, 1 }, 
+    // o31_1 ::=
+    { 264, 0 }, 
+    // o31_1 ::= A1
+    { 264, 1 }, 
+    // o31_2 ::=
+    { 265, 0 }, 
+    // o31_2 ::= A2
+    { 265, 1 }, 
+    // o31_3 ::=
+    { 266, 0 }, 
+    // o31_3 ::= A3
+    { 266, 1 }, 
+    // o31_4 ::=
+    { 267, 0 }, 
+    // o31_4 ::= A4
+    { 267, 1 }, 
+    // o31_5 ::=
+    { 268, 0 }, 
+    // o31_5 ::= A5
+    { 268, 1 }, 
+    // o31_6 ::=
+    { 269, 0 }, 
+    // o31_6 ::= A6
+    { 269, 1 }, 
+    // o31_7 ::=
+    { 270, 0 }, 
+    // o31_7 ::= A7
+    { 270, 1 }, 
+    // block ::= B32 o32_0 o32_1 o32_2 o32_3 o32_4 o32_5 o32_6 o32_7 END
+    { 68, 10 }, 
+    // o32_0 ::=
+    { 271, 0 }, 
+    // o32_0 ::= A0
+    { 271, 1 }, 
+    // o32_1 ::=
+    { 272, 0 }, 
+    // o32_1 ::= A1
+    { 272, 1 }, 
+    // o32_2 ::=
+    { 273, 0 }, 
+    // o32_2 ::= A2
+    { 273, 1 }, 
+    // o32_3 ::=
+    { 274, 0 }, 
+    // o32_3 ::= A3
+    { 274, 1 }, 
+    // o32_4 ::=
+    { 275, 0 }, 
+    // o32_4 ::= A4
+    { 275, 1 }, 
+    // o32_5 ::=
+    { 276, 0 }, 
+    // o32_5 ::= A5
+    { 276, 1 }, 
+    // o32_6 ::=
+    { 277, 0 }, 
+    // o32_6 ::= A6
+    { 277, 1 }, 
+    // o32_7 ::=
+    { 278, 0 }, 
+    // o32_7 ::= A7
+    { 278, 1 }, 
+    // block ::= B33 o33_0 o33_1 o33_2 o33_3 o33_4 o33_5 o33_6 o33_7 END
+    { 68, 10 }, 
+    // o33_0 ::=
+    { 279, 0 }, 
+    // o33_0 ::= A0
+    { 279, 1 }, 
+    // o33_1 ::=
+    { 280, 0 }, 
+    // o33_1 ::= A1
+    { 280, 1 }, 
+    // o33_2 ::=
+    { 281, 0 }, 
+    // o33_2 ::= A2
+    { 281, 1 }, 
+    // o33_3 ::=
+    { 282, 0 }, 
+    // o33_3 ::= A3
+    { 282, 1 }, 
+    // o33_4 ::=
+    { 283, 0 }, 
+    // o33_4 ::= A4
+    { 283, 1 }, 
+    // o33_5 ::=
+    { 284, 0 }, 
+    // o33_5 ::= A5
+    { 284, 1 }, 
+    // o33_6 ::=
+    { 285, 0 }, 
+    // o33_6 ::= A6
+    { 285, 1 }, 
+    // o33_7 ::=
+    { 286, 0 }, 
+    // o33_7 ::= A7
+    { 286, 1 }, 
+    // block ::= B34 o34_0 o34_1 o34_2 o34_3 o34_4 o34_5 o34_6 o34_7 END
+    { 68, 10 }, 
+    // o34_0 ::=
+    { 287, 0 }, 
+    // o34_0 ::= A0
+    { 287, 1 }, 
+    // o34_1 ::=
+    { 288, 0 }, 
+    // o34_1 ::= A1
+    { 288, 1 }, 
+    // o34_2 ::=
+    { 289, 0 }, 
+    // o34_2 ::= A2
+    { 289, 1 }, 
+    // o34_3 ::=
+    { 290, 0 }, 
+    // o34_3 ::= A3
+    { 290, 1 }, 
+    // o34_4 ::=
+    { 291, 0 }, 
+    // o34_4 ::= A4
+    { 291, 1 }, 
+    // o34_5 ::=
+    { 292, 0 }, 
+    // o34_5 ::= A5
+    { 292, 1 }, 
+    // o34_6 ::=
+    { 293, 0 }, 
+    // o34_6 ::= A6
+    { 293, 1 }, 
+    // o34_7 ::=
+    { 294, 0 }, 
+    // o34_7 ::= A7
+    { 294, 1 }, 
+    // block ::= B35 o35_0 o35_1 o35_2 o35_3 o35_4 o35_5 o35_6 o35_7 END
+    { 68, 10 }, 
+    // o35_0 ::=
+    { 295, 0 }, 
+    // o35_0 ::= A0
+    { 295, 1 }, 
+    // o35_1 ::=
+    { 296, 0 }, 
+    // o35_1 ::= A1
+    { 296, 1 }, 
+    // o35_2 ::=
+    { 297, 0 }, 
+    // o35_2 ::= A2
+    { 297, 1 }, 
+    // o35_3 ::=
+    { 298, 0 }, 
+    // o35_3 ::= A3
+    { 298, 1 }, 
+    // o35_4 ::=
+    { 299, 0 }, 
+    // o35_4 ::= A4
+    { 299, 1 }, 
+    // o35_5 ::=
+    { 300, 0 }, 
+    // o35_5 ::= A5
+    { 300, 1 }, 
+    // o35_6 ::=
+    { 301, 0 }, 
+    // o35_6 ::= A6
+    { 301, 1 }, 
+    // o35_7 ::=
+    { 302, 0 }, 
+    // o35_7 ::= A7
+    { 302, 1 }, 
+    // block ::= B36 o36_0 o36_1 o36_2 o36_3 o36_4 o36_5 o36_6 o36_7 END
+    { 68, 10 }, 
+    // o36_0 ::=
+    { 303, 0 }, 
+    // o36_0 ::= A0
+    { 303, 1 }, 
+    // o36_1 ::=
+    { 304, 0 }, 
+    // o36_1 ::= A1
+    { 304, 1 }, 
+    // o36_2 ::=
+    { 305, 0 }, 
+    // o36_2 ::= A2
+    { 305, 1 }, 
+    // o36_3 ::=
+    { 306, 0 }, 
+    // o36_3 ::= A3
+    { 306, 1 }, 
+    // o36_4 ::=
+    { 307, 0 }, 
+    // o36_4 ::= A4
+    { 307, 1 }, 
+    // o36_5 ::=
+    { 308, 0 }, 
+    // o36_5 ::= A5
+    { 308, 1 }, 
+    // o36_6 ::=
+    { 309, 0 }, 
+    // o36_6 ::= A6
+    { 309, 1 }, 
+    // o36_7 ::=
+    { 310, 0 }, 
+    // o36_7 ::= A7
+    { 310, 1 }, 
+    // block ::= B37 o37_0 o37_1 o37_2 o37_3 o37_4 o37_5 o37_6 o37_7 END
+    { 68, 10 }, 
+    // o37_0 ::=
+    { 311, 0 }, 
+    // o37_0 ::= A0
+    { 311, 1 }, 
+    // o37_1 ::=
+    { 312, 0 }, 
+    // o37_1 ::= A1
+    { 312, 1 }, 
+    // o37_2 ::=
+    { 313, 0 }, 
+    // o37_2 ::= A2
+    { 313, 1 }, 
+    // o37_3 ::=
+    { 314, 0 }, 
+    // o37_3 ::= A3
+    { 314, 1 }, 
+    // o37_4 ::=
+    { 315, 0 }, 
+    // o37_4 ::= A4
+    { 315, 1 }, 
+    // o37_5 ::=
+    { 316, 0 }, 
+    // o37_5 ::= A5
+    { 316, 1 }, 
+    // o37_6 ::=
+    { 317, 0 }, 
+    // o37_6 ::= A6
+    { 317, 1 }, 
+    // o37_7 ::=
+    { 318, 0 }, 
+    // o37_7 ::= A7
+    { 318, 1 }, 
+    // block ::= B38 o38_0 o38_1 o38_2 o38_3 o38_4 o38_5 o38_6 o38_7 END
+    { 68, 10 }, 
+    // o38_0 ::=
+    { 319, 0 }, 
+    // o38_0 ::= A0
+    { 319, 1 }, 
+    // o38_1 ::=
+    { 320, 0 }, 
+    // o38_1 ::= A1
+    { 320, 1 }, 
+    // o38_2 ::=
+    { 321, 0 }, 
+    // o38_2 ::= A2
+    { 321, 1 }, 
+    // o38_3 ::=
+    { 322, 0 }, 
+    // o38_3 ::= A3
+    { 322, 1 }, 
+    // o38_4 ::=
+    { 323, 0 }, 
+    // o38_4 ::= A4
+    { 323, 1 }, 
+    // o38_5 ::=
+    { 324, 0 }, 
+    // o38_5 ::= A5
+    { 324, 1 }, 
+    // o38_6 ::=
+    { 325, 0 }, 
+    // o38_6 ::= A6
+    { 325, 1 }, 
+    // o38_7 ::=
+    { 326, 0 }, 
+    // o38_7 ::= A7
+    { 326, 1 }, 
+    // block ::= B39 o39_0 o39_1 o39_2 o39_3 o39_4 o39_5 o39_6 o39_7 END
+    { 68, 10 }, 
+    // o39_0 ::=
+    { 327, 0 }, 
+    // o39_0 ::= A0
+    { 327, 1 }, 
+    // o39_1 ::=
+    { 328, 0 }, 
+    // o39_1 ::= A1
+    { 328, 1 }, 
+    // o39_2 ::=
+    { 329, 0 }, 
+    // o39_2 ::= A2
+    { 329, 1 }, 
+    // o39_3 ::=
+    { 330, 0 }, 
+    // o39_3 ::= A3
+    { 330, 1 }, 
+    // o39_4 ::=
+    { 331, 0 }, 
+    // o39_4 ::= A4
+    { 331, 1 }, 
+    // o39_5 ::=
+    { 332, 0 }, 
+    // o39_5 ::= A5
+    { 332, 1 }, 
+    // o39_6 ::=
+    { 333, 0 }, 
+    // o39_6 ::= A6
+    { 333, 1 }, 
+    // o39_7 ::=
+    { 334, 0 }, 
+    // o39_7 ::= A7
+    { 334, 1 }, 
+    // block ::= B40 o40_0 o40_1 o40_2 o40_3 o40_4 o40_5 o40_6 o40_7 END
+    { 68, 10 }, 
+    // o40_0 ::=
+    { 343, 0 }, 
+    // o40_0 ::= A0
+    { 343, 1 }, 
+    // o40_1 ::=
+    { 344, 0 }, 
+    // o40_1 ::= A1
+    { 344, 1 }, 
+    // o40_2 ::=
+    { 345, 0 }, 
+    // o40_2 ::= A2
+    { 345, 1 }, 
+    // o40_3 ::=
+    { 346, 0 }, 
+    // o40_3 ::= A3
+    { 346, 1 }, 
+    // o40_4 ::=
+    { 347, 0 }, 
+    // o40_4 ::= A4
+    { 347, 1 }, 
+    // o40_5 ::=
+    { 348, 0 }, 
+    // o40_5 ::= A5
+    { 348, 1 }, 
+    // o40_6 ::=
+    { 349, 0 }, 
+    // o40_6 ::= A6
+    { 349, 1 }, 
+    // o40_7 ::=
+    { 350, 0 }, 
+    // o40_7 ::= A7
+    { 350, 1 }, 
+    // block ::= B41 o41_0 o41_1 o41_2 o41_3 o41_4 o41_5 o41_6 o41_7 END
+    { 68, 10 }, 
+    // o41_0 ::=
+    { 351, 0 }, 
+    // o41_0 ::= A0
+    { 351, 1 }, 
+    // o41_1 ::=
+    { 352, 0 }, 
+    // o41_1 ::= A1
+    { 352, 1 }, 
+    // o41_2 ::=
+    { 353, 0 }, 
+    // o41_2 ::= A2
+    { 353, 1 }, 
+    // o41_3 ::=
+    { 354, 0 }, 
+    // o41_3 ::= A3
+    { 354, 1 }, 
+    // o41_4 ::=
+    { 355, 0 }, 
+    // o41_4 ::= A4
+    { 355, 1 }, 
+    // o41_5 ::=
+    { 356, 0 }, 
+    // o41_5 ::= A5
+    { 356, 1 }, 
+    // o41_6 ::=
+    { 357, 0 }, 
+    // o41_6 ::= A6
+    { 357, 1 }, 
+    // o41_7 ::=
+    { 358, 0 }, 
+    // o41_7 ::= A7
+    { 358, 1 }, 
+    // block ::= B42 o42_0 o42_1 o42_2 o42_3 o42_4 o42_5 o42_6 o42_7 END
+    { 68, 10 }, 
+    // o42_0 ::=
+    { 359, 0 }, 
+    // o42_0 ::= A0
+    { 359, 1 }, 
+    // o42_1 ::=
+    { 360, 0 }, 
+    // o42_1 ::= A1
+    { 360, 1 }, 
+    // o42_2 ::=
+    { 361, 0 }, 
+    // o42_2 ::= A2
+    { 361, 1 }, 
+    // o42_3 ::=
+    { 362, 0 }, 
+    // o42_3 ::= A3
+    { 362, 1 }, 
+    // o42_4 ::=
+    { 363, 0 }, 
+    // o42_4 ::= A4
+    { 363, 1 }, 
+    // o42_5 ::=
+    { 364, 0 }, 
+    // o42_5 ::= A5
+    { 364, 1 }, 
+    // o42_6 ::=
+    { 365, 0 }, 
+    // o42_6 ::= A6
+    { 365, 1 }, 
+    // o42_7 ::=
+    { 366, 0 }, 
+    // o42_7 ::= A7
+    { 366, 1 }, 
+    // block ::= B43 o43_0 o43_1 o43_2 o43_3 o43_4 o43_5 o43_6 o43_7 END
+    { 68, 10 }, 
+    // o43_0 ::=
+    { 367, 0 }, 
+    // o43_0 ::= A0
+    { 367, 1 }, 
+    // o43_1 ::=
+    { 368, 0 }, 
+    // o43_1 ::= A1
+    { 368, 1 }, 
+    // o43_2 ::=
+    { 369, 0 }, 
+    // o43_2 ::= A2
+    { 369, 1 }, 
+    // o43_3 ::=
+    { 370, 0 }, 
+    // o43_3 ::= A3
+    { 370, 1 }, 
+    // o43_4 ::=
+    { 371, 0 }, 
+    // o43_4 ::= A4
+    { 371, 1 }, 
+    // o43_5 ::=
+    { 372, 0 }, 
+    // o43_5 ::= A5
+    { 372, 1 }, 
+    // o43_6 ::=
+    { 373, 0 }, 
+    // o43_6 ::= A6
+    { 373, 1 }, 
+    // o43_7 ::=
+    { 374, 0 }, 
+    // o43_7 ::= A7
+    { 374, 1 }, 
+    // block ::= B44 o44_0 o44_1 o44_2 o44_3 o44_4 o44_5 o44_6 o44_7 END
+    { 68, 10 }, 
+    // o44_0 ::=
+    { 375, 0 }, 
+    // o44_0 ::= A0
+    { 375, 1 }, 
+    // o44_1 ::=
+    { 376, 0 }, 
+    // o44_1 ::= A1
+    { 376, 1 }, 
+    // o44_2 ::=
+    { 377, 0 }, 
+    // o44_2 ::= A2
+    { 377, 1 }, 
+    // o44_3 ::=
+    { 378, 0 }, 
+    // o44_3 ::= A3
+    { 378, 1 }, 
+    // o44_4 ::=
+    { 379, 0 }, 
+    // o44_4 ::= A4
+    { 379, 1 }, 
+    // o44_5 ::=
+    { 380, 0 }, 
+    // o44_5 ::= A5
+    { 380, 1 }, 
+    // o44_6 ::=
+    { 381, 0 }, 
+    // o44_6 ::= A6
+    { 381, 1 }, 
+    // o44_7 ::=
+    { 382, 0 }, 
+    // o44_7 ::= A7
+    { 382, 1 }, 
+    // block ::= B45 o45_0 o45_1 o45_2 o45_3 o45_4 o45_5 o45_6 o45_7 END
+    { 68, 10 }, 
+    // o45_0 ::=
+    { 383, 0 }, 
+    // o45_0 ::= A0
+    { 383, 1 }, 
+    // o45_1 ::=
+    { 384, 0 }, 
+    // o45_1 ::= A1
+    { 384, 1 }, 
+    // o45_2 ::=
+    { 385, 0 }, 
+    // o45_2 ::= A2
+    { 385, 1 }, 
+    // o45_3 ::=
+    { 386, 0 }, 
+    // o45_3 ::= A3
+    { 386, 1 }, 
+    // o45_4 ::=
+    { 387, 0 }, 
+    // o45_4 ::= A4
+    { 387, 1 }, 
+    // o45_5 ::=
+    { 388, 0 }, 
+    // o45_5 ::= A5
+    { 388, 1 }, 
+    // o45_6 ::=
+    { 389, 0 }, 
+    // o45_6 ::= A6
+    { 389, 1 }, 
+    // o45_7 ::=
+    { 390, 0 }, 
+    // o45_7 ::= A7
+    { 390, 1 }, 
+    // block ::= B46 o46_0 o46_1 o46_2 o46_3 o46_4 o46_5 o46_6 o46_7 END
+    { 68, 10 }, 
+    // o46_0 ::=
+    { 391, 0 }, 
+    // o46_0 ::= A0
+    { 391, 1 }, 
+    // o46_1 ::=
+    { 392, 0 }, 
+    // o46_1 ::= A1
+    { 392, 1 }, 
+    // o46_2 ::=
+    { 393, 0 }, 
+    // o46_2 ::= A2
+    { 393, 1 }, 
+    // o46_3 ::=
+    { 394, 0 }, 
+    // o46_3 ::= A3
+    { 394, 1 }, 
+    // o46_4 ::=
+    { 395, 0 }, 
+    // o46_4 ::= A4
+    { 395, 1 }, 
+    // o46_5 ::=
+    { 396, 0 }, 
+    // o46_5 ::= A5
+    { 396, 1 }, 
+    // o46_6 ::=
+    { 397, 0 }, 
+    // o46_6 ::= A6
+    { 397, 1 }, 
+    // o46_7 ::=
+    { 398, 0 }, 
+    // o46_7 ::= A7
+    { 398, 1 }, 
+    // block ::= B47 o47_0 o47_1 o47_2 o47_3 o47_4 o47_5 o47_6 o47_7 END
+    { 68, 10 }, 
+    // o47_0 ::=
+    { 399, 0 }, 
+    // o47_0 ::= A0
+    { 399, 1 }, 
+    // o47_1 ::=
+    { 400, 0 }, 
+    // o47_1 ::= A1
+    { 400, 1 }, 
+    // o47_2 ::=
+    { 401, 0 }, 
+    // o47_2 ::= A2
+    { 401, 1 }, 
+    // o47_3 ::=
+    { 402, 0 }, 
+    // o47_3 ::= A3
+    { 402, 1 }, 
+    // o47_4 ::=
+    { 403, 0 }, 
+    // o47_4 ::= A4
+    { 403, 1 }, 
+    // o47_5 ::=
+    { 404, 0 }, 
+    // o47_5 ::= A5
+    { 404, 1 }, 
+    // o47_6 ::=
+    { 405, 0 }, 
+    // o47_6 ::= A6
+    { 405, 1 }, 
+    // o47_7 ::=
+    { 406, 0 }, 
+    // o47_7 ::= A7
+    { 406, 1 }, 
+    // block ::= B48 o48_0 o48_1 o48_2 o48_3 o48_4 o48_5 o48_6 o48_7 END
+    { 68, 10 }, 
+    // o48_0 ::=
+    { 407, 0 }, 
+    // o48_0 ::= A0
+    { 407, 1 }, 
+    // o48_1 ::=
+    { 408, 0 }, 
+    // o48_1 ::= A1
+    { 408, 1 }, 
+    // o48_2 ::=
+    { 409, 0 }, 
+    // o48_2 ::= A2
+    { 409, 1 }, 
+    // o48_3 ::=
+    { 410, 0 }, 
+    // o48_3 ::= A3
+    { 410, 1 }, 
+    // o48_4 ::=
+    { 411, 0 }, 
+    // o48_4 ::= A4
+    { 411, 1 }, 
+    // o48_5 ::=
+    { 412, 0 }, 
+    // o48_5 ::= A5
+    { 412, 1 }, 
+    // o48_6 ::=
+    { 413, 0 }, 
+    // o48_6 ::= A6
+    { 413, 1 }, 
+    // o48_7 ::=
+    { 414, 0 }, 
+    // o48_7 ::= A7
+    { 414, 1 }, 
+    // block ::= B49 o49_0 o49_1 o49_2 o49_3 o49_4 o49_5 o49_6 o49_7 END
+    { 68, 10 }, 
+    // o49_0 ::=
+    { 415, 0 }, 
+    // o49_0 ::= A0
+    { 415, 1 }, 
+    // o49_1 ::=
+    { 416, 0 }, 
+    // o49_1 ::= A1
+    { 416, 1 }, 
+    // o49_2 ::=
+    { 417, 0 }, 
+    // o49_2 ::= A2
+    { 417, 1 }, 
+    // o49_3 ::=
+    { 418, 0 }, 
+    // o49_3 ::= A3
+    { 418, 1 }, 
+    // o49_4 ::=
+    { 419, 0 }, 
+    // o49_4 ::= A4
+    { 419, 1 }, 
+    // o49_5 ::=
+    { 420, 0 }, 
+    // o49_5 ::= A5
+    { 420, 1 }, 
+    // o49_6 ::=
+    { 421, 0 }, 
+    // o49_6 ::= A6
+    { 421, 1 }, 
+    // o49_7 ::=
+    { 422, 0 }, 
+    // o49_7 ::= A7
+    { 422, 1 }, 
+    // block ::= B50 o50_0 o50_1 o50_2 o50_3 o50_4 o50_5 o50_6 o50_7 END
+    { 68, 10 }, 
+    // o50_0 ::=
+    { 431, 0 }, 
+    // o50_0 ::= A0
+    { 431, 1 }, 
+    // o50_1 ::=
+    { 432, 0 }, 
+    // o50_1 ::= A1
+    { 432, 1 }, 
+    // o50_2 ::=
+    { 433, 0 }, 
+    // o50_2 ::= A2
+    { 433, 1 }, 
+    // o50_3 ::=
+    { 434, 0 }, 
+    // o50_3 ::= A3
+    { 434, 1 }, 
+    // o50_4 ::=
+    { 435, 0 }, 
+    // o50_4 ::= A4
+    { 435, 1 }, 
+    // o50_5 ::=
+    { 436, 0 }, 
+    // o50_5 ::= A5
+    { 436, 1 }, 
+    // o50_6 ::=
+    { 437, 0 }, 
+    // o50_6 ::= A6
+    { 437, 1 }, 
+    // o50_7 ::=
+    { 438, 0 }, 
+    // o50_7 ::= A7
+    { 438, 1 }, 
+    // block ::= B51 o51_0 o51_1 o51_2 o51_3 o51_4 o51_5 o51_6 o51_7 END
+    { 68, 10 }, 
+    // o51_0 ::=
+    { 439, 0 }, 
+    // o51_0 ::= A0
+    { 439, 1 }, 
+    // o51_1 ::=
+    { 440, 0 }, 
+    // o51_1 ::= A1
+    { 440, 1 }, 
+    // o51_2 ::=
+    { 441, 0 }, 
+    // o51_2 ::= A2
+    { 441, 1 }, 
+    // o51_3 ::=
+    { 442, 0 }, 
+    // o51_3 ::= A3
+    { 442, 1 }, 
+    // o51_4 ::=
+    { 443, 0 }, 
+    // o51_4 ::= A4
+    { 443, 1 }, 
+    // o51_5 ::=
+    { 444, 0 }, 
+    // o51_5 ::= A5
+    { 444, 1 }, 
+    // o51_6 ::=
+    { 445, 0 }, 
+    // o51_6 ::= A6
+    { 445, 1 }, 
+    // o51_7 ::=
+    { 446, 0 }, 
+    // o51_7 ::= A7
+    { 446, 1 }, 
+    // block ::= B52 o52_0 o52_1 o52_2 o52_3 o52_4 o52_5 o52_6 o52_7 END
+    { 68, 10 }, 
+    // o52_0 ::=
+    { 447, 0 }, 
+    // o52_0 ::= A0
+    { 447, 1 }, 
+    // o52_1 ::=
+    { 448, 0 }, 
+    // o52_1 ::= A1
+    { 448, 1 }, 
+    // o52_2 ::=
+    { 449, 0 }, 
+    // o52_2 ::= A2
+    { 449, 1 }, 
+    // o52_3 ::=
+    { 450, 0 }, 
+    // o52_3 ::= A3
+    { 450, 1 }, 
+    // o52_4 ::=
+    { 451, 0 }, 
+    // o52_4 ::= A4
+    { 451, 1 }, 
+    // o52_5 ::=
+    { 452, 0 }, 
+    // o52_5 ::= A5
+    { 452, 1 }, 
+    // o52_6 ::=
+    { 453, 0 }, 
+    // o52_6 ::= A6
+    { 453, 1 }, 
+    // o52_7 ::=
+    { 454, 0 }, 
+    // o52_7 ::= A7
+    { 454, 1 }, 
+    // block ::= B53 o53_0 o53_1 o53_2 o53_3 o53_4 o53_5 o53_6 o53_7 END
+    { 68, 10 }, 
+    // o53_0 ::=
+    { 455, 0 }, 
+    // o53_0 ::= A0
+    { 455, 1 }, 
+    // o53_1 ::=
+    { 456, 0 }, 
+    // o53_1 ::= A1
+    { 456, 1 }, 
+    // o53_2 ::=
+    { 457, 0 }, 
+    // o53_2 ::= A2
+    { 457, 1 }, 
+    // o53_3 ::=
+    { 458, 0 }, 
+    // o53_3 ::= A3
+    { 458, 1 }, 
+    // o53_4 ::=
+    { 459, 0 }, 
+    // o53_4 ::= A4
+    { 459, 1 }, 
+    // o53_5 ::=
+    { 460, 0 }, 
+    // o53_5 ::= A5
+    { 460, 1 }, 
+    // o53_6 ::=
+    { 461, 0 }, 
+    // o53_6 ::= A6
+    { 461, 1 }, 
+    // o53_7 ::=
+    { 462, 0 }, 
+    // o53_7 ::= A7
+    { 462, 1 }, 
+    // block ::= B54 o54_0 o54_1 o54_2 o54_3 o54_4 o54_5 o54_6 o54_7 END
+    { 68, 10 }, 
+    // o54_0 ::=
+    { 463, 0 }, 
+    // o54_0 ::= A0
+    { 463, 1 }, 
+    // o54_1 ::=
+    { 464, 0 }, 
+    // o54_1 ::= A1
+    { 464, 1 }, 
+    // o54_2 ::=
+    { 465, 0 }, 
+    // o54_2 ::= A2
+    { 465, 1 }, 
+    // o54_3 ::=
+    { 466, 0 }, 
+    // o54_3 ::= A3
+    { 466, 1 }, 
+    // o54_4 ::=
+    { 467, 0 }, 
+    // o54_4 ::= A4
+    { 467, 1 }, 
+    // o54_5 ::=
+    { 468, 0 }, 
+    // o54_5 ::= A5
+    { 468, 1 }, 
+    // o54_6 ::=
+    { 469, 0 }, 
+    // o54_6 ::= A6
+    { 469, 1 }, 
+    // o54_7 ::=
+    { 470, 0 }, 
+    // o54_7 ::= A7
+    { 470, 1 }, 
+    // block ::= B55 o55_0 o55_1 o55_2 o55_3 o55_4 o55_5 o55_6 o55_7 END
+    { 68, 10 }, 
+    // o55_0 ::=
+    { 471, 0 }, 
+    // o55_0 ::= A0
+    { 471, 1 }, 
+    // o55_1 ::=
+    { 472, 0 }, 
+    // o55_1 ::= A1
+    { 472, 1 }, 
+    // o55_2 ::=
+    { 473, 0 }, 
+    // o55_2 ::= A2
+    { 473, 1 }, 
+    // o55_3 ::=
+    { 474, 0 }, 
+    // o55_3 ::= A3
+    { 474, 1 }, 
+    // o55_4 ::=
+    { 475, 0 }, 
+    // o55_4 ::= A4
+    { 475, 1 }, 
+    // o55_5 ::=
+    { 476, 0 }, 
+    // o55_5 ::= A5
+    { 476, 1 }, 
+    // o55_6 ::=
+    { 477, 0 }, 
+    // o55_6 ::= A6
+    { 477, 1 }, 
+    // o55_7 ::=
+    { 478, 0 }, 
+    // o55_7 ::= A7
+    { 478, 1 }, 
+    // block ::= B56 o56_0 o56_1 o56_2 o56_3 o56_4 o56_5 o56_6 o56_7 END
+    { 68, 10 }, 
+    // o56_0 ::=
+    { 479, 0 }, 
+    // o56_0 ::= A0
+    { 479, 1 }, 
+    // o56_1 ::=
+    { 480, 0 }, 
+    // o56_1 ::= A1
+    { 480, 1 }, 
+    // o56_2 ::=
+    { 481, 0 }, 
+    // o56_2 ::= A2
+    { 481, 1 }, 
+    // o56_3 ::=
+    { 482, 0 }, 
+    // o56_3 ::= A3
+    { 482, 1 }, 
+    // o56_4 ::=
+    { 483, 0 }, 
+    // o56_4 ::= A4
+    { 483, 1 }, 
+    // o56_5 ::=
+    { 484, 0 }, 
+    // o56_5 ::= A5
+    { 484, 1 }, 
+    // o56_6 ::=
+    { 485, 0 }, 
+    // o56_6 ::= A6
+    { 485, 1 }, 
+    // o56_7 ::=
+    { 486, 0 }, 
+    // o56_7 ::= A7
+    { 486, 1 }, 
+    // block ::= B57 o57_0 o57_1 o57_2 o57_3 o57_4 o57_5 o57_6 o57_7 END
+    { 68, 10 }, 
+    // o57_0 ::=
+    { 487, 0 }, 
+    // o57_0 ::= A0
+    { 487, 1 }, 
+    // o57_1 ::=
+    { 488, 0 }, 
+    // o57_1 ::= A1
+    { 488, 1 }, 
+    // o57_2 ::=
+    { 489, 0 }, 
+    // o57_2 ::= A2
+    { 489, 1 }, 
+    // o57_3 ::=
+    { 490, 0 }, 
+    // o57_3 ::= A3
+    { 490, 1 }, 
+    // o57_4 ::=
+    { 491, 0 }, 
+    // o57_4 ::= A4
+    { 491, 1 }, 
+    // o57_5 ::=
+    { 492, 0 }, 
+    // o57_5 ::= A5
+    { 492, 1 }, 
+    // o57_6 ::=
+    { 493, 0 }, 
+    // o57_6 ::= A6
+    { 493, 1 }, 
+    // o57_7 ::=
+    { 494, 0 }, 
+    // o57_7 ::= A7
+    { 494, 1 }, 
+};
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::initTables( void )
+{
+    myStates.assign( 1047, ActionMap() );
+    myStateDefaultActions.assign( 1047, ActionEntry(PA_ERROR,-2) );
+    for ( int i = 0; i < 2908; ++i )
+    {
+        if ( theStateTable[i][1] == -1 )
+            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+        else
+            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+    }
+
+
+    // Rule Table
+
+    myRules.reserve( 989 );
+    for ( int i = 0; i < 989; ++i )
+        myRules.push_back( RuleInfo( theRuleTable[i][0], theRuleTable[i][1] ) );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::syntaxError( Bench::Terminal tok, privBenchImpl::Value &data )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parseFailed( void )
+{
+}
@@ -0,0 +1,101 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        A0 = 1,
+        A1 = 2,
+        A2 = 3,
+        A3 = 4,
+        A4 = 5,
+        A5 = 6,
+        A6 = 7,
+        A7 = 8,
+        B0 = 9,
+        B1 = 10,
+        B10 = 11,
+        B11 = 12,
+        B12 = 13,
+        B13 = 14,
+        B14 = 15,
+        B15 = 16,
+        B16 = 17,
+        B17 = 18,
+        B18 = 19,
+        B19 = 20,
+        B2 = 21,
+        B20 = 22,
+        B21 = 23,
+        B22 = 24,
+        B23 = 25,
+        B24 = 26,
+        B25 = 27,
+        B26 = 28,
+        B27 = 29,
+        B28 = 30,
+        B29 = 31,
+        B3 = 32,
+        B30 = 33,
+        B31 = 34,
+        B32 = 35,
+        B33 = 36,
+        B34 = 37,
+        B35 = 38,
+        B36 = 39,
+        B37 = 40,
+        B38 = 41,
+        B39 = 42,
+        B4 = 43,
+        B40 = 44,
+        B41 = 45,
+        B42 = 46,
+        B43 = 47,
+        B44 = 48,
+        B45 = 49,
+        B46 = 50,
+        B47 = 51,
+        B48 = 52,
+        B49 = 53,
+        B5 = 54,
+        B50 = 55,
+        B51 = 56,
+        B52 = 57,
+        B53 = 58,
+        B54 = 59,
+        B55 = 60,
+        B56 = 61,
+        B57 = 62,
+        B6 = 63,
+        B7 = 64,
+        B8 = 65,
+        B9 = 66,
+        END = 67
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
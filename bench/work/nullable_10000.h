@@ -0,0 +1,631 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        A0 = 1,
+        A1 = 2,
+        A2 = 3,
+        A3 = 4,
+        A4 = 5,
+        A5 = 6,
+        A6 = 7,
+        A7 = 8,
+        B0 = 9,
+        B1 = 10,
+        B10 = 11,
+        B100 = 12,
+        B101 = 13,
+        B102 = 14,
+        B103 = 15,
+        B104 = 16,
+        B105 = 17,
+        B106 = 18,
+        B107 = 19,
+        B108 = 20,
+        B109 = 21,
+        B11 = 22,
+        B110 = 23,
+        B111 = 24,
+        B112 = 25,
+        B113 = 26,
+        B114 = 27,
+        B115 = 28,
+        B116 = 29,
+        B117 = 30,
+        B118 = 31,
+        B119 = 32,
+        B12 = 33,
+        B120 = 34,
+        B121 = 35,
+        B122 = 36,
+        B123 = 37,
+        B124 = 38,
+        B125 = 39,
+        B126 = 40,
+        B127 = 41,
+        B128 = 42,
+        B129 = 43,
+        B13 = 44,
+        B130 = 45,
+        B131 = 46,
+        B132 = 47,
+        B133 = 48,
+        B134 = 49,
+        B135 = 50,
+        B136 = 51,
+        B137 = 52,
+        B138 = 53,
+        B139 = 54,
+        B14 = 55,
+        B140 = 56,
+        B141 = 57,
+        B142 = 58,
+        B143 = 59,
+        B144 = 60,
+        B145 = 61,
+        B146 = 62,
+        B147 = 63,
+        B148 = 64,
+        B149 = 65,
+        B15 = 66,
+        B150 = 67,
+        B151 = 68,
+        B152 = 69,
+        B153 = 70,
+        B154 = 71,
+        B155 = 72,
+        B156 = 73,
+        B157 = 74,
+        B158 = 75,
+        B159 = 76,
+        B16 = 77,
+        B160 = 78,
+        B161 = 79,
+        B162 = 80,
+        B163 = 81,
+        B164 = 82,
+        B165 = 83,
+        B166 = 84,
+        B167 = 85,
+        B168 = 86,
+        B169 = 87,
+        B17 = 88,
+        B170 = 89,
+        B171 = 90,
+        B172 = 91,
+        B173 = 92,
+        B174 = 93,
+        B175 = 94,
+        B176 = 95,
+        B177 = 96,
+        B178 = 97,
+        B179 = 98,
+        B18 = 99,
+        B180 = 100,
+        B181 = 101,
+        B182 = 102,
+        B183 = 103,
+        B184 = 104,
+        B185 = 105,
+        B186 = 106,
+        B187 = 107,
+        B188 = 108,
+        B189 = 109,
+        B19 = 110,
+        B190 = 111,
+        B191 = 112,
+        B192 = 113,
+        B193 = 114,
+        B194 = 115,
+        B195 = 116,
+        B196 = 117,
+        B197 = 118,
+        B198 = 119,
+        B199 = 120,
+        B2 = 121,
+        B20 = 122,
+        B200 = 123,
+        B201 = 124,
+        B202 = 125,
+        B203 = 126,
+        B204 = 127,
+        B205 = 128,
+        B206 = 129,
+        B207 = 130,
+        B208 = 131,
+        B209 = 132,
+        B21 = 133,
+        B210 = 134,
+        B211 = 135,
+        B212 = 136,
+        B213 = 137,
+        B214 = 138,
+        B215 = 139,
+        B216 = 140,
+        B217 = 141,
+        B218 = 142,
+        B219 = 143,
+        B22 = 144,
+        B220 = 145,
+        B221 = 146,
+        B222 = 147,
+        B223 = 148,
+        B224 = 149,
+        B225 = 150,
+        B226 = 151,
+        B227 = 152,
+        B228 = 153,
+        B229 = 154,
+        B23 = 155,
+        B230 = 156,
+        B231 = 157,
+        B232 = 158,
+        B233 = 159,
+        B234 = 160,
+        B235 = 161,
+        B236 = 162,
+        B237 = 163,
+        B238 = 164,
+        B239 = 165,
+        B24 = 166,
+        B240 = 167,
+        B241 = 168,
+        B242 = 169,
+        B243 = 170,
+        B244 = 171,
+        B245 = 172,
+        B246 = 173,
+        B247 = 174,
+        B248 = 175,
+        B249 = 176,
+        B25 = 177,
+        B250 = 178,
+        B251 = 179,
+        B252 = 180,
+        B253 = 181,
+        B254 = 182,
+        B255 = 183,
+        B256 = 184,
+        B257 = 185,
+        B258 = 186,
+        B259 = 187,
+        B26 = 188,
+        B260 = 189,
+        B261 = 190,
+        B262 = 191,
+        B263 = 192,
+        B264 = 193,
+        B265 = 194,
+        B266 = 195,
+        B267 = 196,
+        B268 = 197,
+        B269 = 198,
+        B27 = 199,
+        B270 = 200,
+        B271 = 201,
+        B272 = 202,
+        B273 = 203,
+        B274 = 204,
+        B275 = 205,
+        B276 = 206,
+        B277 = 207,
+        B278 = 208,
+        B279 = 209,
+        B28 = 210,
+        B280 = 211,
+        B281 = 212,
+        B282 = 213,
+        B283 = 214,
+        B284 = 215,
+        B285 = 216,
+        B286 = 217,
+        B287 = 218,
+        B288 = 219,
+        B289 = 220,
+        B29 = 221,
+        B290 = 222,
+        B291 = 223,
+        B292 = 224,
+        B293 = 225,
+        B294 = 226,
+        B295 = 227,
+        B296 = 228,
+        B297 = 229,
+        B298 = 230,
+        B299 = 231,
+        B3 = 232,
+        B30 = 233,
+        B300 = 234,
+        B301 = 235,
+        B302 = 236,
+        B303 = 237,
+        B304 = 238,
+        B305 = 239,
+        B306 = 240,
+        B307 = 241,
+        B308 = 242,
+        B309 = 243,
+        B31 = 244,
+        B310 = 245,
+        B311 = 246,
+        B312 = 247,
+        B313 = 248,
+        B314 = 249,
+        B315 = 250,
+        B316 = 251,
+        B317 = 252,
+        B318 = 253,
+        B319 = 254,
+        B32 = 255,
+        B320 = 256,
+        B321 = 257,
+        B322 = 258,
+        B323 = 259,
+        B324 = 260,
+        B325 = 261,
+        B326 = 262,
+        B327 = 263,
+        B328 = 264,
+        B329 = 265,
+        B33 = 266,
+        B330 = 267,
+        B331 = 268,
+        B332 = 269,
+        B333 = 270,
+        B334 = 271,
+        B335 = 272,
+        B336 = 273,
+        B337 = 274,
+        B338 = 275,
+        B339 = 276,
+        B34 = 277,
+        B340 = 278,
+        B341 = 279,
+        B342 = 280,
+        B343 = 281,
+        B344 = 282,
+        B345 = 283,
+        B346 = 284,
+        B347 = 285,
+        B348 = 286,
+        B349 = 287,
+        B35 = 288,
+        B350 = 289,
+        B351 = 290,
+        B352 = 291,
+        B353 = 292,
+        B354 = 293,
+        B355 = 294,
+        B356 = 295,
+        B357 = 296,
+        B358 = 297,
+        B359 = 298,
+        B36 = 299,
+        B360 = 300,
+        B361 = 301,
+        B362 = 302,
+        B363 = 303,
+        B364 = 304,
+        B365 = 305,
+        B366 = 306,
+        B367 = 307,
+        B368 = 308,
+        B369 = 309,
+        B37 = 310,
+        B370 = 311,
+        B371 = 312,
+        B372 = 313,
+        B373 = 314,
+        B374 = 315,
+        B375 = 316,
+        B376 = 317,
+        B377 = 318,
+        B378 = 319,
+        B379 = 320,
+        B38 = 321,
+        B380 = 322,
+        B381 = 323,
+        B382 = 324,
+        B383 = 325,
+        B384 = 326,
+        B385 = 327,
+        B386 = 328,
+        B387 = 329,
+        B388 = 330,
+        B389 = 331,
+        B39 = 332,
+        B390 = 333,
+        B391 = 334,
+        B392 = 335,
+        B393 = 336,
+        B394 = 337,
+        B395 = 338,
+        B396 = 339,
+        B397 = 340,
+        B398 = 341,
+        B399 = 342,
+        B4 = 343,
+        B40 = 344,
+        B400 = 345,
+        B401 = 346,
+        B402 = 347,
+        B403 = 348,
+        B404 = 349,
+        B405 = 350,
+        B406 = 351,
+        B407 = 352,
+        B408 = 353,
+        B409 = 354,
+        B41 = 355,
+        B410 = 356,
+        B411 = 357,
+        B412 = 358,
+        B413 = 359,
+        B414 = 360,
+        B415 = 361,
+        B416 = 362,
+        B417 = 363,
+        B418 = 364,
+        B419 = 365,
+        B42 = 366,
+        B420 = 367,
+        B421 = 368,
+        B422 = 369,
+        B423 = 370,
+        B424 = 371,
+        B425 = 372,
+        B426 = 373,
+        B427 = 374,
+        B428 = 375,
+        B429 = 376,
+        B43 = 377,
+        B430 = 378,
+        B431 = 379,
+        B432 = 380,
+        B433 = 381,
+        B434 = 382,
+        B435 = 383,
+        B436 = 384,
+        B437 = 385,
+        B438 = 386,
+        B439 = 387,
+        B44 = 388,
+        B440 = 389,
+        B441 = 390,
+        B442 = 391,
+        B443 = 392,
+        B444 = 393,
+        B445 = 394,
+        B446 = 395,
+        B447 = 396,
+        B448 = 397,
+        B449 = 398,
+        B45 = 399,
+        B450 = 400,
+        B451 = 401,
+        B452 = 402,
+        B453 = 403,
+        B454 = 404,
+        B455 = 405,
+        B456 = 406,
+        B457 = 407,
+        B458 = 408,
+        B459 = 409,
+        B46 = 410,
+        B460 = 411,
+        B461 = 412,
+        B462 = 413,
+        B463 = 414,
+        B464 = 415,
+        B465 = 416,
+        B466 = 417,
+        B467 = 418,
+        B468 = 419,
+        B469 = 420,
+        B47 = 421,
+        B470 = 422,
+        B471 = 423,
+        B472 = 424,
+        B473 = 425,
+        B474 = 426,
+        B475 = 427,
+        B476 = 428,
+        B477 = 429,
+        B478 = 430,
+        B479 = 431,
+        B48 = 432,
+        B480 = 433,
+        B481 = 434,
+        B482 = 435,
+        B483 = 436,
+        B484 = 437,
+        B485 = 438,
+        B486 = 439,
+        B487 = 440,
+        B488 = 441,
+        B489 = 442,
+        B49 = 443,
+        B490 = 444,
+        B491 = 445,
+        B492 = 446,
+        B493 = 447,
+        B494 = 448,
+        B495 = 449,
+        B496 = 450,
+        B497 = 451,
+        B498 = 452,
+        B499 = 453,
+        B5 = 454,
+        B50 = 455,
+        B500 = 456,
+        B501 = 457,
+        B502 = 458,
+        B503 = 459,
+        B504 = 460,
+        B505 = 461,
+        B506 = 462,
+        B507 = 463,
+        B508 = 464,
+        B509 = 465,
+        B51 = 466,
+        B510 = 467,
+        B511 = 468,
+        B512 = 469,
+        B513 = 470,
+        B514 = 471,
+        B515 = 472,
+        B516 = 473,
+        B517 = 474,
+        B518 = 475,
+        B519 = 476,
+        B52 = 477,
+        B520 = 478,
+        B521 = 479,
+        B522 = 480,
+        B523 = 481,
+        B524 = 482,
+        B525 = 483,
+        B526 = 484,
+        B527 = 485,
+        B528 = 486,
+        B529 = 487,
+        B53 = 488,
+        B530 = 489,
+        B531 = 490,
+        B532 = 491,
+        B533 = 492,
+        B534 = 493,
+        B535 = 494,
+        B536 = 495,
+        B537 = 496,
+        B538 = 497,
+        B539 = 498,
+        B54 = 499,
+        B540 = 500,
+        B541 = 501,
+        B542 = 502,
+        B543 = 503,
+        B544 = 504,
+        B545 = 505,
+        B546 = 506,
+        B547 = 507,
+        B548 = 508,
+        B549 = 509,
+        B55 = 510,
+        B550 = 511,
+        B551 = 512,
+        B552 = 513,
+        B553 = 514,
+        B554 = 515,
+        B555 = 516,
+        B556 = 517,
+        B557 = 518,
+        B558 = 519,
+        B559 = 520,
+        B56 = 521,
+        B560 = 522,
+        B561 = 523,
+        B562 = 524,
+        B563 = 525,
+        B564 = 526,
+        B565 = 527,
+        B566 = 528,
+        B567 = 529,
+        B568 = 530,
+        B569 = 531,
+        B57 = 532,
+        B570 = 533,
+        B571 = 534,
+        B572 = 535,
+        B573 = 536,
+        B574 = 537,
+        B575 = 538,
+        B576 = 539,
+        B577 = 540,
+        B578 = 541,
+        B579 = 542,
+        B58 = 543,
+        B580 = 544,
+        B581 = 545,
+        B582 = 546,
+        B583 = 547,
+        B584 = 548,
+        B585 = 549,
+        B586 = 550,
+        B587 = 551,
+        B59 = 552,
+        B6 = 553,
+        B60 = 554,
+        B61 = 555,
+        B62 = 556,
+        B63 = 557,
+        B64 = 558,
+        B65 = 559,
+        B66 = 560,
+        B67 = 561,
+        B68 = 562,
+        B69 = 563,
+        B7 = 564,
+        B70 = 565,
+        B71 = 566,
+        B72 = 567,
+        B73 = 568,
+        B74 = 569,
+        B75 = 570,
+        B76 = 571,
+        B77 = 572,
+        B78 = 573,
+        B79 = 574,
+        B8 = 575,
+        B80 = 576,
+        B81 = 577,
+        B82 = 578,
+        B83 = 579,
+        B84 = 580,
+        B85 = 581,
+        B86 = 582,
+        B87 = 583,
+        B88 = 584,
+        B89 = 585,
+        B9 = 586,
+        B90 = 587,
+        B91 = 588,
+        B92 = 589,
+        B93 = 590,
+        B94 = 591,
+        B95 = 592,
+        B96 = 593,
+        B97 = 594,
+        B98 = 595,
+        B99 = 596,
+        END = 597
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
@@ -0,0 +1,806 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#include <utility>
+#include <stack>
+#include <map>
+#include <vector>
+#include <iostream>
+
+
+#include "seq_10.h"
+
+enum ParserAct
+{
+    PA_SHIFT,
+    PA_REDUCE,
+    PA_ERROR,
+    PA_ACCEPT,
+    PA_NOP
+};
+
+class privBenchImpl
+{
+public:
+
+    privBenchImpl( void );
+    ~privBenchImpl( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    struct Value
+    {
+        union
+        {
+            int tokenType;
+            int errorType;
+        };
+    };
+    // first is stack num, second is the symbol index
+    typedef std::pair<int,int> StackID;
+    typedef std::pair<StackID,Value> StackEntry;
+    typedef std::stack<StackEntry> ParseStack;
+
+    void shift( int newState, int symIdx, Value &data );
+    void reduce( int ruleNum );
+    void callDtor( int symIdx, Value &data );
+    void popStack( void );
+    ParserAct findParserAction( int &newVal, int tok );
+    void initTables( void );
+    void syntaxError( Bench::Terminal tok, Value &data );
+    void parseFailed( void );
+
+    ParseStack myStack;
+    int myErrCount;
+
+
+    typedef std::pair<ParserAct,int> ActionEntry;
+    typedef std::map<int,ActionEntry> ActionMap;
+    typedef std::vector<ActionMap> StateList;
+    typedef std::vector<ActionEntry> StateDefaultList;
+
+    StateList myStates;
+    StateDefaultList myStateDefaultActions;
+
+
+    // first is LHS, second is number of RHS
+    typedef std::pair<int,int> RuleInfo;
+    typedef std::vector<RuleInfo> RuleList;
+
+    RuleList myRules;
+};
+
+
+////////////////////////////////////////
+
+
+Bench::Bench( void )
+    : myImplementation( new privBenchImpl )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Bench::~Bench( void )
+{
+    delete myImplementation;
+}
+
+
+////////////////////////////////////////
+
+
+void Bench::parse( Bench::Terminal tok, int value )
+{
+    myImplementation->parse( tok, value );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parse( Bench::Terminal tok, int value )
+{
+    int actVal;
+    ParserAct action;
+    bool errHit = false;
+    bool eoInput = (tok == Bench::EOF );
+    bool done = false;
+
+    if ( myStack.empty() )
+    {
+        if ( eoInput )
+            return;
+
+        myErrCount = -1;
+    }
+
+    privBenchImpl::Value data;
+    data.tokenType = value;
+
+    do
+    {
+        action = findParserAction( actVal, tok );
+        if ( PA_SHIFT == action )
+        {
+            shift( actVal, tok, data );
+            --myErrCount;
+            if ( eoInput && ! myStack.empty() )
+                tok = Bench::EOF;
+            else
+                done = true;
+        }
+        else if ( PA_REDUCE == action )
+        {
+            reduce( actVal );
+        }
+        else if ( PA_ERROR == action )
+        {
+            // Syntax error handling:
+            // 1. Call the %syntax_error function.
+            // 2. Pop stack until a state where we can shift the err symbol.
+            // 3. Shift the error symbol.
+            // 4. Set error count to three.
+            // 5. Begin accepting and shifting new tokens.
+            // 6. No new error processing will begin until 3 tokens are successful.
+            if ( myErrCount < 0 )
+            {
+                syntaxError( tok, data );
+            }
+            if ( myStack.top().first.first == 24 || errHit )
+            {
+                callDtor( static_cast<int>(tok), data );
+                done = true;
+            }
+            else
+            {
+                while ( ! myStack.empty() &&
+                        myStack.top().first.first != 24 )
+                {
+                    action = findParserAction( actVal, 24 );
+                    if ( action == PA_SHIFT )
+                        break;
+                    popStack();
+                }
+                if ( myStack.empty() || tok == Bench::EOF )
+                {
+                    callDtor( static_cast<int>(tok), data );
+                    parseFailed();
+                    done = true;
+                }
+                else if ( myStack.top().first.first != 24 )
+                {
+                    data.errorType = 0;
+                    shift( actVal, 24, data );
+                }
+            }
+            myErrCount = 3;
+            errHit = true;
+        }
+        else // ACCEPT == action || NOP == action
+        {
+            done = true;
+        }
+    } while ( ! done && ! myStack.empty() );
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::privBenchImpl( void )
+    : myErrCount( -1 )
+{
+    initTables();
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::~privBenchImpl( void )
+{
+    while ( ! myStack.empty() )
+        popStack();
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::shift( int newState, int symIdx, privBenchImpl::Value &data )
+{
+    StackEntry newItem = StackEntry( StackID( newState, symIdx ), data );
+    myStack.push( newItem );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::reduce( int ruleNum )
+{
+    int newVal;
+    ParserAct next;
+    privBenchImpl::Value data = { 0 };
+    std::vector<privBenchImpl::Value> rhsData;
+    for ( int i = 0, N = myRules[ruleNum].second; i != N; ++i )
+    {
+        if ( myStack.empty() )
+            rhsData.insert( rhsData.begin(), data );
+        else
+        {
+            rhsData.insert( rhsData.begin(), myStack.top().second );
+            myStack.pop();
+        }
+    }
+
+    next = findParserAction( newVal, myRules[ruleNum].first );
+
+    switch ( ruleNum )
+    {
+        case 0:
+        {
+            // prog ::= items
+#line 0 "bench/work/seq_10.lem"
+#line 250 "bench/work/seq_10.cpp"
+            callDtor( 26, rhsData[0] );
+            break;
+        }
+
+        case 1:
+        {
+            // items ::= items item
+#line 0 "bench/work/seq_10.lem"
+#line 259 "bench/work/seq_10.cpp"
+            callDtor( 26, rhsData[0] );
+            callDtor( 25, rhsData[1] );
+            break;
+        }
+
+        case 2:
+        {
+            // items ::= item
+#line 0 "bench/work/seq_10.lem"
+#line 269 "bench/work/seq_10.cpp"
+            callDtor( 25, rhsData[0] );
+            break;
+        }
+
+        case 3:
+        {
+            // item ::= K0 T0 T0 T3 T4 T5 T6 T7 T8 T9 T10 T11
+#line 0 "bench/work/seq_10.lem"
+#line 278 "bench/work/seq_10.cpp"
+            callDtor( 1, rhsData[0] );
+            callDtor( 8, rhsData[1] );
+            callDtor( 8, rhsData[2] );
+            callDtor( 17, rhsData[3] );
+            callDtor( 18, rhsData[4] );
+            callDtor( 19, rhsData[5] );
+            callDtor( 20, rhsData[6] );
+            callDtor( 21, rhsData[7] );
+            callDtor( 22, rhsData[8] );
+            callDtor( 23, rhsData[9] );
+            callDtor( 9, rhsData[10] );
+            callDtor( 10, rhsData[11] );
+            break;
+        }
+
+        case 4:
+        {
+            // item ::= K1 T0 T0 T4 T5 T6 T7 T8 T9 T10 T11 T12
+#line 0 "bench/work/seq_10.lem"
+#line 298 "bench/work/seq_10.cpp"
+            callDtor( 2, rhsData[0] );
+            callDtor( 8, rhsData[1] );
+            callDtor( 8, rhsData[2] );
+            callDtor( 18, rhsData[3] );
+            callDtor( 19, rhsData[4] );
+            callDtor( 20, rhsData[5] );
+            callDtor( 21, rhsData[6] );
+            callDtor( 22, rhsData[7] );
+            callDtor( 23, rhsData[8] );
+            callDtor( 9, rhsData[9] );
+            callDtor( 10, rhsData[10] );
+            callDtor( 11, rhsData[11] );
+            break;
+        }
+
+        case 5:
+        {
+            // item ::= K2 T0 T0 T5 T6 T7 T8 T9 T10 T11 T12 T13
+#line 0 "bench/work/seq_10.lem"
+#line 318 "bench/work/seq_10.cpp"
+            callDtor( 3, rhsData[0] );
+            callDtor( 8, rhsData[1] );
+            callDtor( 8, rhsData[2] );
+            callDtor( 19, rhsData[3] );
+            callDtor( 20, rhsData[4] );
+            callDtor( 21, rhsData[5] );
+            callDtor( 22, rhsData[6] );
+            callDtor( 23, rhsData[7] );
+            callDtor( 9, rhsData[8] );
+            callDtor( 10, rhsData[9] );
+            callDtor( 11, rhsData[10] );
+            callDtor( 12, rhsData[11] );
+            break;
+        }
+
+        case 6:
+        {
+            // item ::= K3 T0 T0 T6 T7 T8 T9 T10 T11 T12 T13 T14
+#line 0 "bench/work/seq_10.lem"
+#line 338 "bench/work/seq_10.cpp"
+            callDtor( 4, rhsData[0] );
+            callDtor( 8, rhsData[1] );
+            callDtor( 8, rhsData[2] );
+            callDtor( 20, rhsData[3] );
+            callDtor( 21, rhsData[4] );
+            callDtor( 22, rhsData[5] );
+            callDtor( 23, rhsData[6] );
+            callDtor( 9, rhsData[7] );
+            callDtor( 10, rhsData[8] );
+            callDtor( 11, rhsData[9] );
+            callDtor( 12, rhsData[10] );
+            callDtor( 13, rhsData[11] );
+            break;
+        }
+
+        case 7:
+        {
+            // item ::= K4 T0 T0 T7 T8 T9 T10 T11 T12 T13 T14 T15
+#line 0 "bench/work/seq_10.lem"
+#line 358 "bench/work/seq_10.cpp"
+            callDtor( 5, rhsData[0] );
+            callDtor( 8, rhsData[1] );
+            callDtor( 8, rhsData[2] );
+            callDtor( 21, rhsData[3] );
+            callDtor( 22, rhsData[4] );
+            callDtor( 23, rhsData[5] );
+            callDtor( 9, rhsData[6] );
+            callDtor( 10, rhsData[7] );
+            callDtor( 11, rhsData[8] );
+            callDtor( 12, rhsData[9] );
+            callDtor( 13, rhsData[10] );
+            callDtor( 14, rhsData[11] );
+            break;
+        }
+
+        case 8:
+        {
+            // item ::= K5 T0 T0 T8 T9 T10 T11 T12 T13 T14 T15 T16
+#line 0 "bench/work/seq_10.lem"
+#line 378 "bench/work/seq_10.cpp"
+            callDtor( 6, rhsData[0] );
+            callDtor( 8, rhsData[1] );
+            callDtor( 8, rhsData[2] );
+            callDtor( 22, rhsData[3] );
+            callDtor( 23, rhsData[4] );
+            callDtor( 9, rhsData[5] );
+            callDtor( 10, rhsData[6] );
+            callDtor( 11, rhsData[7] );
+            callDtor( 12, rhsData[8] );
+            callDtor( 13, rhsData[9] );
+            callDtor( 14, rhsData[10] );
+            callDtor( 15, rhsData[11] );
+            break;
+        }
+
+        case 9:
+        {
+            // item ::= K6 T0 T0 T9 T10 T11 T12 T13 T14 T15 T16 T17
+#line 0 "bench/work/seq_10.lem"
+#line 398 "bench/work/seq_10.cpp"
+            callDtor( 7, rhsData[0] );
+            callDtor( 8, rhsData[1] );
+            callDtor( 8, rhsData[2] );
+            callDtor( 23, rhsData[3] );
+            callDtor( 9, rhsData[4] );
+            callDtor( 10, rhsData[5] );
+            callDtor( 11, rhsData[6] );
+            callDtor( 12, rhsData[7] );
+            callDtor( 13, rhsData[8] );
+            callDtor( 14, rhsData[9] );
+            callDtor( 15, rhsData[10] );
+            callDtor( 16, rhsData[11] );
+            break;
+        }
+
+        default:
+            throw "Unknown Rule Number";
+            break;
+    }
+
+    if ( PA_SHIFT == next )
+        shift( newVal, myRules[ruleNum].first, data );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::callDtor( int symIdx, privBenchImpl::Value &data )
+{
+    switch ( symIdx )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+        case 12:
+        case 13:
+        case 14:
+        case 15:
+        case 16:
+        case 17:
+        case 18:
+        case 19:
+        case 20:
+        case 21:
+        case 22:
+        case 23:
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::popStack( void )
+{
+    callDtor( myStack.top().first.second, myStack.top().second );
+    myStack.pop();
+}
+
+
+////////////////////////////////////////
+
+
+ParserAct privBenchImpl::findParserAction( int &newVal, int tok )
+{
+    int stateNum;
+    ParserAct retval = PA_NOP;
+    bool found = false;
+
+    stateNum = myStack.empty() ? 0 : myStack.top().first.first;
+    ActionMap::iterator i = myStates[stateNum].find( tok );
+    if ( tok >= 0 && tok <= 28 )
+    {
+        if ( i != myStates[stateNum].end() )
+        {
+            retval = (*i).second.first;
+            newVal = (*i).second.second;
+            found = true;
+        }
+    }
+    else if ( ! myStates[stateNum].empty() )
+    {
+        retval = PA_NOP;
+        newVal = 0;
+        found = true;
+    }
+
+    if ( ! found )
+    {
+        retval = myStateDefaultActions[stateNum].first;
+        newVal = myStateDefaultActions[stateNum].second;
+    }
+    return retval;
+}
+
+
+////////////////////////////////////////
+
+
+static int theStateTable[114][4] =
+{
+    // State 0
+    { 0, 1, PA_SHIFT, 3 },
+    // State 0
+    { 0, 2, PA_SHIFT, 15 },
+    // State 0
+    { 0, 3, PA_SHIFT, 27 },
+    // State 0
+    { 0, 4, PA_SHIFT, 39 },
+    // State 0
+    { 0, 5, PA_SHIFT, 51 },
+    // State 0
+    { 0, 6, PA_SHIFT, 63 },
+    // State 0
+    { 0, 7, PA_SHIFT, 75 },
+    // State 0
+    { 0, 25, PA_SHIFT, 87 },
+    // State 0
+    { 0, 26, PA_SHIFT, 1 },
+    // State 0
+    { 0, 27, PA_ACCEPT, 0 },
+    // State 1
+    { 1, 0, PA_REDUCE, 0 },
+    // State 1
+    { 1, 1, PA_SHIFT, 3 },
+    // State 1
+    { 1, 2, PA_SHIFT, 15 },
+    // State 1
+    { 1, 3, PA_SHIFT, 27 },
+    // State 1
+    { 1, 4, PA_SHIFT, 39 },
+    // State 1
+    { 1, 5, PA_SHIFT, 51 },
+    // State 1
+    { 1, 6, PA_SHIFT, 63 },
+    // State 1
+    { 1, 7, PA_SHIFT, 75 },
+    // State 1
+    { 1, 25, PA_SHIFT, 2 },
+    // State 2
+    { 2, 28, PA_REDUCE, 1 },
+    // State 2 default action
+    { 2, -1, PA_REDUCE, 1 },
+    // State 3
+    { 3, 8, PA_SHIFT, 4 },
+    // State 4
+    { 4, 8, PA_SHIFT, 5 },
+    // State 5
+    { 5, 17, PA_SHIFT, 6 },
+    // State 6
+    { 6, 18, PA_SHIFT, 7 },
+    // State 7
+    { 7, 19, PA_SHIFT, 8 },
+    // State 8
+    { 8, 20, PA_SHIFT, 9 },
+    // State 9
+    { 9, 21, PA_SHIFT, 10 },
+    // State 10
+    { 10, 22, PA_SHIFT, 11 },
+    // State 11
+    { 11, 23, PA_SHIFT, 12 },
+    // State 12
+    { 12, 9, PA_SHIFT, 13 },
+    // State 13
+    { 13, 10, PA_SHIFT, 14 },
+    // State 14
+    { 14, 28, PA_REDUCE, 3 },
+    // State 14 default action
+    { 14, -1, PA_REDUCE, 3 },
+    // State 15
+    { 15, 8, PA_SHIFT, 16 },
+    // State 16
+    { 16, 8, PA_SHIFT, 17 },
+    // State 17
+    { 17, 18, PA_SHIFT, 18 },
+    // State 18
+    { 18, 19, PA_SHIFT, 19 },
+    // State 19
+    { 19, 20, PA_SHIFT, 20 },
+    // State 20
+    { 20, 21, PA_SHIFT, 21 },
+    // State 21
+    { 21, 22, PA_SHIFT, 22 },
+    // State 22
+    { 22, 23, PA_SHIFT, 23 },
+    // State 23
+    { 23, 9, PA_SHIFT, 24 },
+    // State 24
+    { 24, 10, PA_SHIFT, 25 },
+    // State 25
+    { 25, 11, PA_SHIFT, 26 },
+    // State 26
+    { 26, 28, PA_REDUCE, 4 },
+    // State 26 default action
+    { 26, -1, PA_REDUCE, 4 },
+    // State 27
+    { 27, 8, PA_SHIFT, 28 },
+    // State 28
+    { 28, 8, PA_SHIFT, 29 },
+    // State 29
+    { 29, 19, PA_SHIFT, 30 },
+    // State 30
+    { 30, 20, PA_SHIFT, 31 },
+    // State 31
+    { 31, 21, PA_SHIFT, 32 },
+    // State 32
+    { 32, 22, PA_SHIFT, 33 },
+    // State 33
+    { 33, 23, PA_SHIFT, 34 },
+    // State 34
+    { 34, 9, PA_SHIFT, 35 },
+    // State 35
+    { 35, 10, PA_SHIFT, 36 },
+    // State 36
+    { 36, 11, PA_SHIFT, 37 },
+    // State 37
+    { 37, 12, PA_SHIFT, 38 },
+    // State 38
+    { 38, 28, PA_REDUCE, 5 },
+    // State 38 default action
+    { 38, -1, PA_REDUCE, 5 },
+    // State 39
+    { 39, 8, PA_SHIFT, 40 },
+    // State 40
+    { 40, 8, PA_SHIFT, 41 },
+    // State 41
+    { 41, 20, PA_SHIFT, 42 },
+    // State 42
+    { 42, 21, PA_SHIFT, 43 },
+    // State 43
+    { 43, 22, PA_SHIFT, 44 },
+    // State 44
+    { 44, 23, PA_SHIFT, 45 },
+    // State 45
+    { 45, 9, PA_SHIFT, 46 },
+    // State 46
+    { 46, 10, PA_SHIFT, 47 },
+    // State 47
+    { 47, 11, PA_SHIFT, 48 },
+    // State 48
+    { 48, 12, PA_SHIFT, 49 },
+    // State 49
+    { 49, 13, PA_SHIFT, 50 },
+    // State 50
+    { 50, 28, PA_REDUCE, 6 },
+    // State 50 default action
+    { 50, -1, PA_REDUCE, 6 },
+    // State 51
+    { 51, 8, PA_SHIFT, 52 },
+    // State 52
+    { 52, 8, PA_SHIFT, 53 },
+    // State 53
+    { 53, 21, PA_SHIFT, 54 },
+    // State 54
+    { 54, 22, PA_SHIFT, 55 },
+    // State 55
+    { 55, 23, PA_SHIFT, 56 },
+    // State 56
+    { 56, 9, PA_SHIFT, 57 },
+    // State 57
+    { 57, 10, PA_SHIFT, 58 },
+    // State 58
+    { 58, 11, PA_SHIFT, 59 },
+    // State 59
+    { 59, 12, PA_SHIFT, 60 },
+    // State 60
+    { 60, 13, PA_SHIFT, 61 },
+    // State 61
+    { 61, 14, PA_SHIFT, 62 },
+    // State 62
+    { 62, 28, PA_REDUCE, 7 },
+    // State 62 default action
+    { 62, -1, PA_REDUCE, 7 },
+    // State 63
+    { 63, 8, PA_SHIFT, 64 },
+    // State 64
+    { 64, 8, PA_SHIFT, 65 },
+    // State 65
+    { 65, 22, PA_SHIFT, 66 },
+    // State 66
+    { 66, 23, PA_SHIFT, 67 },
+    // State 67
+    { 67, 9, PA_SHIFT, 68 },
+    // State 68
+    { 68, 10, PA_SHIFT, 69 },
+    // State 69
+    { 69, 11, PA_SHIFT, 70 },
+    // State 70
+    { 70, 12, PA_SHIFT, 71 },
+    // State 71
+    { 71, 13, PA_SHIFT, 72 },
+    // State 72
+    { 72, 14, PA_SHIFT, 73 },
+    // State 73
+    { 73, 15, PA_SHIFT, 74 },
+    // State 74
+    { 74, 28, PA_REDUCE, 8 },
+    // State 74 default action
+    { 74, -1, PA_REDUCE, 8 },
+    // State 75
+    { 75, 8, PA_SHIFT, 76 },
+    // State 76
+    { 76, 8, PA_SHIFT, 77 },
+    // State 77
+    { 77, 23, PA_SHIFT, 78 },
+    // State 78
+    { 78, 9, PA_SHIFT, 79 },
+    // State 79
+    { 79, 10, PA_SHIFT, 80 },
+    // State 80
+    { 80, 11, PA_SHIFT, 81 },
+    // State 81
+    { 81, 12, PA_SHIFT, 82 },
+    // State 82
+    { 82, 13, PA_SHIFT, 83 },
+    // State 83
+    { 83, 14, PA_SHIFT, 84 },
+    // State 84
+    { 84, 15, PA_SHIFT, 85 },
+    // State 85
+    { 85, 16, PA_SHIFT, 86 },
+    // State 86
+    { 86, 28, PA_REDUCE, 9 },
+    // State 86 default action
+    { 86, -1, PA_REDUCE, 9 },
+    // State 87
+    { 87, 28, PA_REDUCE, 2 },
+    // State 87 default action
+    { 87, -1, PA_REDUCE, 2 },
+};
+
+
+static int theRuleTable[10][2] =
+{
+    // prog ::= items
+    { 27, 1 }, 
+    // items ::= items item
+    { 26, 2 }, 
+    // items ::= item
+    { 26, 1 }, 
+    // item ::= K0 T0 T0 T3 T4 T5 T6 T7 T8 T9 T10 T11
+    { 25, 12 }, 
+    // item ::= K1 T0 T0 T4 T5 T6 T7 T8 T9 T10 T11 T12
+    { 25, 12 }, 
+    // item ::= K2 T0 T0 T5 T6 T7 T8 T9 T10 T11 T12 T13
+    { 25, 12 }, 
+    // item ::= K3 T0 T0 T6 T7 T8 T9 T10 T11 T12 T13 T14
+    { 25, 12 }, 
+    // item ::= K4 T0 T0 T7 T8 T9 T10 T11 T12 T13 T14 T15
+    { 25, 12 }, 
+    // item ::= K5 T0 T0 T8 T9 T10 T11 T12 T13 T14 T15 T16
+    { 25, 12 }, 
+    // item ::= K6 T0 T0 T9 T10 T11 T12 T13 T14 T15 T16 T17
+    { 25, 12 }, 
+};
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::initTables( void )
+{
+    myStates.assign( 88, ActionMap() );
+    myStateDefaultActions.assign( 88, ActionEntry(PA_ERROR,-2) );
+    for ( int i = 0; i < 114; ++i )
+    {
+        if ( theStateTable[i][1] == -1 )
+            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+        else
+            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+    }
+
+
+    // Rule Table
+
+    myRules.reserve( 10 );
+    for ( int i = 0; i < 10; ++i )
+        myRules.push_back( RuleInfo( theRuleTable[i][0], theRuleTable[i][1] ) );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::syntaxError( Bench::Terminal tok, privBenchImpl::Value &data )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parseFailed( void )
+{
+}
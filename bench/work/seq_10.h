@@ -0,0 +1,57 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        K0 = 1,
+        K1 = 2,
+        K2 = 3,
+        K3 = 4,
+        K4 = 5,
+        K5 = 6,
+        K6 = 7,
+        T0 = 8,
+        T10 = 9,
+        T11 = 10,
+        T12 = 11,
+        T13 = 12,
+        T14 = 13,
+        T15 = 14,
+        T16 = 15,
+        T17 = 16,
+        T3 = 17,
+        T4 = 18,
+        T5 = 19,
+        T6 = 20,
+        T7 = 21,
+        T8 = 22,
+        T9 = 23
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
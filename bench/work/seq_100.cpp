@@ -0,0 +1,5299 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#include <utility>
+#include <stack>
+#include <map>
+#include <vector>
+#include <iostream>
+
+
+#include "seq_100.h"
+
+enum ParserAct
+{
+    PA_SHIFT,
+    PA_REDUCE,
+    PA_ERROR,
+    PA_ACCEPT,
+    PA_NOP
+};
+
+class privBenchImpl
+{
+public:
+
+    privBenchImpl( void );
+    ~privBenchImpl( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    struct Value
+    {
+        union
+        {
+            int tokenType;
+            int errorType;
+        };
+    };
+    // first is stack num, second is the symbol index
+    typedef std::pair<int,int> StackID;
+    typedef std::pair<StackID,Value> StackEntry;
+    typedef std::stack<StackEntry> ParseStack;
+
+    void shift( int newState, int symIdx, Value &data );
+    void reduce( int ruleNum );
+    void callDtor( int symIdx, Value &data );
+    void popStack( void );
+    ParserAct findParserAction( int &newVal, int tok );
+    void initTables( void );
+    void syntaxError( Bench::Terminal tok, Value &data );
+    void parseFailed( void );
+
+    ParseStack myStack;
+    int myErrCount;
+
+
+    typedef std::pair<ParserAct,int> ActionEntry;
+    typedef std::map<int,ActionEntry> ActionMap;
+    typedef std::vector<ActionMap> StateList;
+    typedef std::vector<ActionEntry> StateDefaultList;
+
+    StateList myStates;
+    StateDefaultList myStateDefaultActions;
+
+
+    // first is LHS, second is number of RHS
+    typedef std::pair<int,int> RuleInfo;
+    typedef std::vector<RuleInfo> RuleList;
+
+    RuleList myRules;
+};
+
+
+////////////////////////////////////////
+
+
+Bench::Bench( void )
+    : myImplementation( new privBenchImpl )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Bench::~Bench( void )
+{
+    delete myImplementation;
+}
+
+
+////////////////////////////////////////
+
+
+void Bench::parse( Bench::Terminal tok, int value )
+{
+    myImplementation->parse( tok, value );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parse( Bench::Terminal tok, int value )
+{
+    int actVal;
+    ParserAct action;
+    bool errHit = false;
+    bool eoInput = (tok == Bench::EOF );
+    bool done = false;
+
+    if ( myStack.empty() )
+    {
+        if ( eoInput )
+            return;
+
+        myErrCount = -1;
+    }
+
+    privBenchImpl::Value data;
+    data.tokenType = value;
+
+    do
+    {
+        action = findParserAction( actVal, tok );
+        if ( PA_SHIFT == action )
+        {
+            shift( actVal, tok, data );
+            --myErrCount;
+            if ( eoInput && ! myStack.empty() )
+                tok = Bench::EOF;
+            else
+                done = true;
+        }
+        else if ( PA_REDUCE == action )
+        {
+            reduce( actVal );
+        }
+        else if ( PA_ERROR == action )
+        {
+            // Syntax error handling:
+            // 1. Call the %syntax_error function.
+            // 2. Pop stack until a state where we can shift the err symbol.
+            // 3. Shift the error symbol.
+            // 4. Set error count to three.
+            // 5. Begin accepting and shifting new tokens.
+            // 6. No new error processing will begin until 3 tokens are successful.
+            if ( myErrCount < 0 )
+            {
+                syntaxError( tok, data );
+            }
+            if ( myStack.top().first.first == 97 || errHit )
+            {
+                callDtor( static_cast<int>(tok), data );
+                done = true;
+            }
+            else
+            {
+                while ( ! myStack.empty() &&
+                        myStack.top().first.first != 97 )
+                {
+                    action = findParserAction( actVal, 97 );
+                    if ( action == PA_SHIFT )
+                        break;
+                    popStack();
+                }
+                if ( myStack.empty() || tok == Bench::EOF )
+                {
+                    callDtor( static_cast<int>(tok), data );
+                    parseFailed();
+                    done = true;
+                }
+                else if ( myStack.top().first.first != 97 )
+                {
+                    data.errorType = 0;
+                    shift( actVal, 97, data );
+                }
+            }
+            myErrCount = 3;
+            errHit = true;
+        }
+        else // ACCEPT == action || NOP == action
+        {
+            done = true;
+        }
+    } while ( ! done && ! myStack.empty() );
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::privBenchImpl( void )
+    : myErrCount( -1 )
+{
+    initTables();
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::~privBenchImpl( void )
+{
+    while ( ! myStack.empty() )
+        popStack();
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::shift( int newState, int symIdx, privBenchImpl::Value &data )
+{
+    StackEntry newItem = StackEntry( StackID( newState, symIdx ), data );
+    myStack.push( newItem );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::reduce( int ruleNum )
+{
+    int newVal;
+    ParserAct next;
+    privBenchImpl::Value data = { 0 };
+    std::vector<privBenchImpl::Value> rhsData;
+    for ( int i = 0, N = myRules[ruleNum].second; i != N; ++i )
+    {
+        if ( myStack.empty() )
+            rhsData.insert( rhsData.begin(), data );
+        else
+        {
+            rhsData.insert( rhsData.begin(), myStack.top().second );
+            myStack.pop();
+        }
+    }
+
+    next = findParserAction( newVal, myRules[ruleNum].first );
+
+    switch ( ruleNum )
+    {
+        case 0:
+        {
+            // prog ::= items
+#line 0 "bench/work/seq_100.lem"
+#line 250 "bench/work/seq_100.cpp"
+            callDtor( 99, rhsData[0] );
+            break;
+        }
+
+        case 1:
+        {
+            // items ::= items item
+#line 0 "bench/work/seq_100.lem"
+#line 259 "bench/work/seq_100.cpp"
+            callDtor( 99, rhsData[0] );
+            callDtor( 98, rhsData[1] );
+            break;
+        }
+
+        case 2:
+        {
+            // items ::= item
+#line 0 "bench/work/seq_100.lem"
+#line 269 "bench/work/seq_100.cpp"
+            callDtor( 98, rhsData[0] );
+            break;
+        }
+
+        case 3:
+        {
+            // item ::= K0 T0 T0 T3 T4 T5 T6 T7 T8 T9 T10 T11
+#line 0 "bench/work/seq_100.lem"
+#line 278 "bench/work/seq_100.cpp"
+            callDtor( 1, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 56, rhsData[3] );
+            callDtor( 67, rhsData[4] );
+            callDtor( 78, rhsData[5] );
+            callDtor( 89, rhsData[6] );
+            callDtor( 94, rhsData[7] );
+            callDtor( 95, rhsData[8] );
+            callDtor( 96, rhsData[9] );
+            callDtor( 35, rhsData[10] );
+            callDtor( 36, rhsData[11] );
+            break;
+        }
+
+        case 4:
+        {
+            // item ::= K1 T0 T0 T4 T5 T6 T7 T8 T9 T10 T11 T12
+#line 0 "bench/work/seq_100.lem"
+#line 298 "bench/work/seq_100.cpp"
+            callDtor( 2, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 67, rhsData[3] );
+            callDtor( 78, rhsData[4] );
+            callDtor( 89, rhsData[5] );
+            callDtor( 94, rhsData[6] );
+            callDtor( 95, rhsData[7] );
+            callDtor( 96, rhsData[8] );
+            callDtor( 35, rhsData[9] );
+            callDtor( 36, rhsData[10] );
+            callDtor( 37, rhsData[11] );
+            break;
+        }
+
+        case 5:
+        {
+            // item ::= K2 T0 T0 T5 T6 T7 T8 T9 T10 T11 T12 T13
+#line 0 "bench/work/seq_100.lem"
+#line 318 "bench/work/seq_100.cpp"
+            callDtor( 13, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 78, rhsData[3] );
+            callDtor( 89, rhsData[4] );
+            callDtor( 94, rhsData[5] );
+            callDtor( 95, rhsData[6] );
+            callDtor( 96, rhsData[7] );
+            callDtor( 35, rhsData[8] );
+            callDtor( 36, rhsData[9] );
+            callDtor( 37, rhsData[10] );
+            callDtor( 38, rhsData[11] );
+            break;
+        }
+
+        case 6:
+        {
+            // item ::= K3 T0 T0 T6 T7 T8 T9 T10 T11 T12 T13 T14
+#line 0 "bench/work/seq_100.lem"
+#line 338 "bench/work/seq_100.cpp"
+            callDtor( 24, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 89, rhsData[3] );
+            callDtor( 94, rhsData[4] );
+            callDtor( 95, rhsData[5] );
+            callDtor( 96, rhsData[6] );
+            callDtor( 35, rhsData[7] );
+            callDtor( 36, rhsData[8] );
+            callDtor( 37, rhsData[9] );
+            callDtor( 38, rhsData[10] );
+            callDtor( 39, rhsData[11] );
+            break;
+        }
+
+        case 7:
+        {
+            // item ::= K4 T0 T0 T7 T8 T9 T10 T11 T12 T13 T14 T15
+#line 0 "bench/work/seq_100.lem"
+#line 358 "bench/work/seq_100.cpp"
+            callDtor( 27, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 94, rhsData[3] );
+            callDtor( 95, rhsData[4] );
+            callDtor( 96, rhsData[5] );
+            callDtor( 35, rhsData[6] );
+            callDtor( 36, rhsData[7] );
+            callDtor( 37, rhsData[8] );
+            callDtor( 38, rhsData[9] );
+            callDtor( 39, rhsData[10] );
+            callDtor( 40, rhsData[11] );
+            break;
+        }
+
+        case 8:
+        {
+            // item ::= K5 T0 T0 T8 T9 T10 T11 T12 T13 T14 T15 T16
+#line 0 "bench/work/seq_100.lem"
+#line 378 "bench/work/seq_100.cpp"
+            callDtor( 28, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 95, rhsData[3] );
+            callDtor( 96, rhsData[4] );
+            callDtor( 35, rhsData[5] );
+            callDtor( 36, rhsData[6] );
+            callDtor( 37, rhsData[7] );
+            callDtor( 38, rhsData[8] );
+            callDtor( 39, rhsData[9] );
+            callDtor( 40, rhsData[10] );
+            callDtor( 41, rhsData[11] );
+            break;
+        }
+
+        case 9:
+        {
+            // item ::= K6 T0 T0 T9 T10 T11 T12 T13 T14 T15 T16 T17
+#line 0 "bench/work/seq_100.lem"
+#line 398 "bench/work/seq_100.cpp"
+            callDtor( 29, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 96, rhsData[3] );
+            callDtor( 35, rhsData[4] );
+            callDtor( 36, rhsData[5] );
+            callDtor( 37, rhsData[6] );
+            callDtor( 38, rhsData[7] );
+            callDtor( 39, rhsData[8] );
+            callDtor( 40, rhsData[9] );
+            callDtor( 41, rhsData[10] );
+            callDtor( 42, rhsData[11] );
+            break;
+        }
+
+        case 10:
+        {
+            // item ::= K7 T0 T0 T10 T11 T12 T13 T14 T15 T16 T17 T18
+#line 0 "bench/work/seq_100.lem"
+#line 418 "bench/work/seq_100.cpp"
+            callDtor( 30, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 35, rhsData[3] );
+            callDtor( 36, rhsData[4] );
+            callDtor( 37, rhsData[5] );
+            callDtor( 38, rhsData[6] );
+            callDtor( 39, rhsData[7] );
+            callDtor( 40, rhsData[8] );
+            callDtor( 41, rhsData[9] );
+            callDtor( 42, rhsData[10] );
+            callDtor( 43, rhsData[11] );
+            break;
+        }
+
+        case 11:
+        {
+            // item ::= K8 T0 T0 T11 T12 T13 T14 T15 T16 T17 T18 T19
+#line 0 "bench/work/seq_100.lem"
+#line 438 "bench/work/seq_100.cpp"
+            callDtor( 31, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 36, rhsData[3] );
+            callDtor( 37, rhsData[4] );
+            callDtor( 38, rhsData[5] );
+            callDtor( 39, rhsData[6] );
+            callDtor( 40, rhsData[7] );
+            callDtor( 41, rhsData[8] );
+            callDtor( 42, rhsData[9] );
+            callDtor( 43, rhsData[10] );
+            callDtor( 44, rhsData[11] );
+            break;
+        }
+
+        case 12:
+        {
+            // item ::= K9 T0 T0 T12 T13 T14 T15 T16 T17 T18 T19 T20
+#line 0 "bench/work/seq_100.lem"
+#line 458 "bench/work/seq_100.cpp"
+            callDtor( 32, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 37, rhsData[3] );
+            callDtor( 38, rhsData[4] );
+            callDtor( 39, rhsData[5] );
+            callDtor( 40, rhsData[6] );
+            callDtor( 41, rhsData[7] );
+            callDtor( 42, rhsData[8] );
+            callDtor( 43, rhsData[9] );
+            callDtor( 44, rhsData[10] );
+            callDtor( 46, rhsData[11] );
+            break;
+        }
+
+        case 13:
+        {
+            // item ::= K10 T0 T0 T13 T14 T15 T16 T17 T18 T19 T20 T21
+#line 0 "bench/work/seq_100.lem"
+#line 478 "bench/work/seq_100.cpp"
+            callDtor( 3, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 38, rhsData[3] );
+            callDtor( 39, rhsData[4] );
+            callDtor( 40, rhsData[5] );
+            callDtor( 41, rhsData[6] );
+            callDtor( 42, rhsData[7] );
+            callDtor( 43, rhsData[8] );
+            callDtor( 44, rhsData[9] );
+            callDtor( 46, rhsData[10] );
+            callDtor( 47, rhsData[11] );
+            break;
+        }
+
+        case 14:
+        {
+            // item ::= K11 T0 T0 T14 T15 T16 T17 T18 T19 T20 T21 T22
+#line 0 "bench/work/seq_100.lem"
+#line 498 "bench/work/seq_100.cpp"
+            callDtor( 4, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 39, rhsData[3] );
+            callDtor( 40, rhsData[4] );
+            callDtor( 41, rhsData[5] );
+            callDtor( 42, rhsData[6] );
+            callDtor( 43, rhsData[7] );
+            callDtor( 44, rhsData[8] );
+            callDtor( 46, rhsData[9] );
+            callDtor( 47, rhsData[10] );
+            callDtor( 48, rhsData[11] );
+            break;
+        }
+
+        case 15:
+        {
+            // item ::= K12 T0 T0 T15 T16 T17 T18 T19 T20 T21 T22 T23
+#line 0 "bench/work/seq_100.lem"
+#line 518 "bench/work/seq_100.cpp"
+            callDtor( 5, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 40, rhsData[3] );
+            callDtor( 41, rhsData[4] );
+            callDtor( 42, rhsData[5] );
+            callDtor( 43, rhsData[6] );
+            callDtor( 44, rhsData[7] );
+            callDtor( 46, rhsData[8] );
+            callDtor( 47, rhsData[9] );
+            callDtor( 48, rhsData[10] );
+            callDtor( 49, rhsData[11] );
+            break;
+        }
+
+        case 16:
+        {
+            // item ::= K13 T0 T0 T16 T17 T18 T19 T20 T21 T22 T23 T24
+#line 0 "bench/work/seq_100.lem"
+#line 538 "bench/work/seq_100.cpp"
+            callDtor( 6, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 41, rhsData[3] );
+            callDtor( 42, rhsData[4] );
+            callDtor( 43, rhsData[5] );
+            callDtor( 44, rhsData[6] );
+            callDtor( 46, rhsData[7] );
+            callDtor( 47, rhsData[8] );
+            callDtor( 48, rhsData[9] );
+            callDtor( 49, rhsData[10] );
+            callDtor( 50, rhsData[11] );
+            break;
+        }
+
+        case 17:
+        {
+            // item ::= K14 T0 T0 T17 T18 T19 T20 T21 T22 T23 T24 T25
+#line 0 "bench/work/seq_100.lem"
+#line 558 "bench/work/seq_100.cpp"
+            callDtor( 7, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 42, rhsData[3] );
+            callDtor( 43, rhsData[4] );
+            callDtor( 44, rhsData[5] );
+            callDtor( 46, rhsData[6] );
+            callDtor( 47, rhsData[7] );
+            callDtor( 48, rhsData[8] );
+            callDtor( 49, rhsData[9] );
+            callDtor( 50, rhsData[10] );
+            callDtor( 51, rhsData[11] );
+            break;
+        }
+
+        case 18:
+        {
+            // item ::= K15 T0 T0 T18 T19 T20 T21 T22 T23 T24 T25 T26
+#line 0 "bench/work/seq_100.lem"
+#line 578 "bench/work/seq_100.cpp"
+            callDtor( 8, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 43, rhsData[3] );
+            callDtor( 44, rhsData[4] );
+            callDtor( 46, rhsData[5] );
+            callDtor( 47, rhsData[6] );
+            callDtor( 48, rhsData[7] );
+            callDtor( 49, rhsData[8] );
+            callDtor( 50, rhsData[9] );
+            callDtor( 51, rhsData[10] );
+            callDtor( 52, rhsData[11] );
+            break;
+        }
+
+        case 19:
+        {
+            // item ::= K16 T0 T0 T19 T20 T21 T22 T23 T24 T25 T26 T27
+#line 0 "bench/work/seq_100.lem"
+#line 598 "bench/work/seq_100.cpp"
+            callDtor( 9, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 44, rhsData[3] );
+            callDtor( 46, rhsData[4] );
+            callDtor( 47, rhsData[5] );
+            callDtor( 48, rhsData[6] );
+            callDtor( 49, rhsData[7] );
+            callDtor( 50, rhsData[8] );
+            callDtor( 51, rhsData[9] );
+            callDtor( 52, rhsData[10] );
+            callDtor( 53, rhsData[11] );
+            break;
+        }
+
+        case 20:
+        {
+            // item ::= K17 T0 T0 T20 T21 T22 T23 T24 T25 T26 T27 T28
+#line 0 "bench/work/seq_100.lem"
+#line 618 "bench/work/seq_100.cpp"
+            callDtor( 10, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 46, rhsData[3] );
+            callDtor( 47, rhsData[4] );
+            callDtor( 48, rhsData[5] );
+            callDtor( 49, rhsData[6] );
+            callDtor( 50, rhsData[7] );
+            callDtor( 51, rhsData[8] );
+            callDtor( 52, rhsData[9] );
+            callDtor( 53, rhsData[10] );
+            callDtor( 54, rhsData[11] );
+            break;
+        }
+
+        case 21:
+        {
+            // item ::= K18 T0 T0 T21 T22 T23 T24 T25 T26 T27 T28 T29
+#line 0 "bench/work/seq_100.lem"
+#line 638 "bench/work/seq_100.cpp"
+            callDtor( 11, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 47, rhsData[3] );
+            callDtor( 48, rhsData[4] );
+            callDtor( 49, rhsData[5] );
+            callDtor( 50, rhsData[6] );
+            callDtor( 51, rhsData[7] );
+            callDtor( 52, rhsData[8] );
+            callDtor( 53, rhsData[9] );
+            callDtor( 54, rhsData[10] );
+            callDtor( 55, rhsData[11] );
+            break;
+        }
+
+        case 22:
+        {
+            // item ::= K19 T0 T0 T22 T23 T24 T25 T26 T27 T28 T29 T30
+#line 0 "bench/work/seq_100.lem"
+#line 658 "bench/work/seq_100.cpp"
+            callDtor( 12, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 48, rhsData[3] );
+            callDtor( 49, rhsData[4] );
+            callDtor( 50, rhsData[5] );
+            callDtor( 51, rhsData[6] );
+            callDtor( 52, rhsData[7] );
+            callDtor( 53, rhsData[8] );
+            callDtor( 54, rhsData[9] );
+            callDtor( 55, rhsData[10] );
+            callDtor( 57, rhsData[11] );
+            break;
+        }
+
+        case 23:
+        {
+            // item ::= K20 T0 T0 T23 T24 T25 T26 T27 T28 T29 T30 T31
+#line 0 "bench/work/seq_100.lem"
+#line 678 "bench/work/seq_100.cpp"
+            callDtor( 14, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 49, rhsData[3] );
+            callDtor( 50, rhsData[4] );
+            callDtor( 51, rhsData[5] );
+            callDtor( 52, rhsData[6] );
+            callDtor( 53, rhsData[7] );
+            callDtor( 54, rhsData[8] );
+            callDtor( 55, rhsData[9] );
+            callDtor( 57, rhsData[10] );
+            callDtor( 58, rhsData[11] );
+            break;
+        }
+
+        case 24:
+        {
+            // item ::= K21 T0 T0 T24 T25 T26 T27 T28 T29 T30 T31 T32
+#line 0 "bench/work/seq_100.lem"
+#line 698 "bench/work/seq_100.cpp"
+            callDtor( 15, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 50, rhsData[3] );
+            callDtor( 51, rhsData[4] );
+            callDtor( 52, rhsData[5] );
+            callDtor( 53, rhsData[6] );
+            callDtor( 54, rhsData[7] );
+            callDtor( 55, rhsData[8] );
+            callDtor( 57, rhsData[9] );
+            callDtor( 58, rhsData[10] );
+            callDtor( 59, rhsData[11] );
+            break;
+        }
+
+        case 25:
+        {
+            // item ::= K22 T0 T0 T25 T26 T27 T28 T29 T30 T31 T32 T33
+#line 0 "bench/work/seq_100.lem"
+#line 718 "bench/work/seq_100.cpp"
+            callDtor( 16, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 51, rhsData[3] );
+            callDtor( 52, rhsData[4] );
+            callDtor( 53, rhsData[5] );
+            callDtor( 54, rhsData[6] );
+            callDtor( 55, rhsData[7] );
+            callDtor( 57, rhsData[8] );
+            callDtor( 58, rhsData[9] );
+            callDtor( 59, rhsData[10] );
+            callDtor( 60, rhsData[11] );
+            break;
+        }
+
+        case 26:
+        {
+            // item ::= K23 T0 T0 T26 T27 T28 T29 T30 T31 T32 T33 T34
+#line 0 "bench/work/seq_100.lem"
+#line 738 "bench/work/seq_100.cpp"
+            callDtor( 17, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 52, rhsData[3] );
+            callDtor( 53, rhsData[4] );
+            callDtor( 54, rhsData[5] );
+            callDtor( 55, rhsData[6] );
+            callDtor( 57, rhsData[7] );
+            callDtor( 58, rhsData[8] );
+            callDtor( 59, rhsData[9] );
+            callDtor( 60, rhsData[10] );
+            callDtor( 61, rhsData[11] );
+            break;
+        }
+
+        case 27:
+        {
+            // item ::= K24 T0 T0 T27 T28 T29 T30 T31 T32 T33 T34 T35
+#line 0 "bench/work/seq_100.lem"
+#line 758 "bench/work/seq_100.cpp"
+            callDtor( 18, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 53, rhsData[3] );
+            callDtor( 54, rhsData[4] );
+            callDtor( 55, rhsData[5] );
+            callDtor( 57, rhsData[6] );
+            callDtor( 58, rhsData[7] );
+            callDtor( 59, rhsData[8] );
+            callDtor( 60, rhsData[9] );
+            callDtor( 61, rhsData[10] );
+            callDtor( 62, rhsData[11] );
+            break;
+        }
+
+        case 28:
+        {
+            // item ::= K25 T0 T0 T28 T29 T30 T31 T32 T33 T34 T35 T36
+#line 0 "bench/work/seq_100.lem"
+#line 778 "bench/work/seq_100.cpp"
+            callDtor( 19, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 54, rhsData[3] );
+            callDtor( 55, rhsData[4] );
+            callDtor( 57, rhsData[5] );
+            callDtor( 58, rhsData[6] );
+            callDtor( 59, rhsData[7] );
+            callDtor( 60, rhsData[8] );
+            callDtor( 61, rhsData[9] );
+            callDtor( 62, rhsData[10] );
+            callDtor( 63, rhsData[11] );
+            break;
+        }
+
+        case 29:
+        {
+            // item ::= K26 T0 T0 T29 T30 T31 T32 T33 T34 T35 T36 T37
+#line 0 "bench/work/seq_100.lem"
+#line 798 "bench/work/seq_100.cpp"
+            callDtor( 20, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 55, rhsData[3] );
+            callDtor( 57, rhsData[4] );
+            callDtor( 58, rhsData[5] );
+            callDtor( 59, rhsData[6] );
+            callDtor( 60, rhsData[7] );
+            callDtor( 61, rhsData[8] );
+            callDtor( 62, rhsData[9] );
+            callDtor( 63, rhsData[10] );
+            callDtor( 64, rhsData[11] );
+            break;
+        }
+
+        case 30:
+        {
+            // item ::= K27 T0 T0 T30 T31 T32 T33 T34 T35 T36 T37 T38
+#line 0 "bench/work/seq_100.lem"
+#line 818 "bench/work/seq_100.cpp"
+            callDtor( 21, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 57, rhsData[3] );
+            callDtor( 58, rhsData[4] );
+            callDtor( 59, rhsData[5] );
+            callDtor( 60, rhsData[6] );
+            callDtor( 61, rhsData[7] );
+            callDtor( 62, rhsData[8] );
+            callDtor( 63, rhsData[9] );
+            callDtor( 64, rhsData[10] );
+            callDtor( 65, rhsData[11] );
+            break;
+        }
+
+        case 31:
+        {
+            // item ::= K28 T0 T0 T31 T32 T33 T34 T35 T36 T37 T38 T39
+#line 0 "bench/work/seq_100.lem"
+#line 838 "bench/work/seq_100.cpp"
+            callDtor( 22, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 58, rhsData[3] );
+            callDtor( 59, rhsData[4] );
+            callDtor( 60, rhsData[5] );
+            callDtor( 61, rhsData[6] );
+            callDtor( 62, rhsData[7] );
+            callDtor( 63, rhsData[8] );
+            callDtor( 64, rhsData[9] );
+            callDtor( 65, rhsData[10] );
+            callDtor( 66, rhsData[11] );
+            break;
+        }
+
+        case 32:
+        {
+            // item ::= K29 T0 T0 T32 T33 T34 T35 T36 T37 T38 T39 T40
+#line 0 "bench/work/seq_100.lem"
+#line 858 "bench/work/seq_100.cpp"
+            callDtor( 23, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 59, rhsData[3] );
+            callDtor( 60, rhsData[4] );
+            callDtor( 61, rhsData[5] );
+            callDtor( 62, rhsData[6] );
+            callDtor( 63, rhsData[7] );
+            callDtor( 64, rhsData[8] );
+            callDtor( 65, rhsData[9] );
+            callDtor( 66, rhsData[10] );
+            callDtor( 68, rhsData[11] );
+            break;
+        }
+
+        case 33:
+        {
+            // item ::= K30 T0 T0 T33 T34 T35 T36 T37 T38 T39 T40 T41
+#line 0 "bench/work/seq_100.lem"
+#line 878 "bench/work/seq_100.cpp"
+            callDtor( 25, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 60, rhsData[3] );
+            callDtor( 61, rhsData[4] );
+            callDtor( 62, rhsData[5] );
+            callDtor( 63, rhsData[6] );
+            callDtor( 64, rhsData[7] );
+            callDtor( 65, rhsData[8] );
+            callDtor( 66, rhsData[9] );
+            callDtor( 68, rhsData[10] );
+            callDtor( 69, rhsData[11] );
+            break;
+        }
+
+        case 34:
+        {
+            // item ::= K31 T0 T0 T34 T35 T36 T37 T38 T39 T40 T41 T42
+#line 0 "bench/work/seq_100.lem"
+#line 898 "bench/work/seq_100.cpp"
+            callDtor( 26, rhsData[0] );
+            callDtor( 33, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 61, rhsData[3] );
+            callDtor( 62, rhsData[4] );
+            callDtor( 63, rhsData[5] );
+            callDtor( 64, rhsData[6] );
+            callDtor( 65, rhsData[7] );
+            callDtor( 66, rhsData[8] );
+            callDtor( 68, rhsData[9] );
+            callDtor( 69, rhsData[10] );
+            callDtor( 70, rhsData[11] );
+            break;
+        }
+
+        case 35:
+        {
+            // item ::= K0 T1 T0 T35 T36 T37 T38 T39 T40 T41 T42 T43
+#line 0 "bench/work/seq_100.lem"
+#line 918 "bench/work/seq_100.cpp"
+            callDtor( 1, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 62, rhsData[3] );
+            callDtor( 63, rhsData[4] );
+            callDtor( 64, rhsData[5] );
+            callDtor( 65, rhsData[6] );
+            callDtor( 66, rhsData[7] );
+            callDtor( 68, rhsData[8] );
+            callDtor( 69, rhsData[9] );
+            callDtor( 70, rhsData[10] );
+            callDtor( 71, rhsData[11] );
+            break;
+        }
+
+        case 36:
+        {
+            // item ::= K1 T1 T0 T36 T37 T38 T39 T40 T41 T42 T43 T44
+#line 0 "bench/work/seq_100.lem"
+#line 938 "bench/work/seq_100.cpp"
+            callDtor( 2, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 63, rhsData[3] );
+            callDtor( 64, rhsData[4] );
+            callDtor( 65, rhsData[5] );
+            callDtor( 66, rhsData[6] );
+            callDtor( 68, rhsData[7] );
+            callDtor( 69, rhsData[8] );
+            callDtor( 70, rhsData[9] );
+            callDtor( 71, rhsData[10] );
+            callDtor( 72, rhsData[11] );
+            break;
+        }
+
+        case 37:
+        {
+            // item ::= K2 T1 T0 T37 T38 T39 T40 T41 T42 T43 T44 T45
+#line 0 "bench/work/seq_100.lem"
+#line 958 "bench/work/seq_100.cpp"
+            callDtor( 13, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 64, rhsData[3] );
+            callDtor( 65, rhsData[4] );
+            callDtor( 66, rhsData[5] );
+            callDtor( 68, rhsData[6] );
+            callDtor( 69, rhsData[7] );
+            callDtor( 70, rhsData[8] );
+            callDtor( 71, rhsData[9] );
+            callDtor( 72, rhsData[10] );
+            callDtor( 73, rhsData[11] );
+            break;
+        }
+
+        case 38:
+        {
+            // item ::= K3 T1 T0 T38 T39 T40 T41 T42 T43 T44 T45 T46
+#line 0 "bench/work/seq_100.lem"
+#line 978 "bench/work/seq_100.cpp"
+            callDtor( 24, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 65, rhsData[3] );
+            callDtor( 66, rhsData[4] );
+            callDtor( 68, rhsData[5] );
+            callDtor( 69, rhsData[6] );
+            callDtor( 70, rhsData[7] );
+            callDtor( 71, rhsData[8] );
+            callDtor( 72, rhsData[9] );
+            callDtor( 73, rhsData[10] );
+            callDtor( 74, rhsData[11] );
+            break;
+        }
+
+        case 39:
+        {
+            // item ::= K4 T1 T0 T39 T40 T41 T42 T43 T44 T45 T46 T47
+#line 0 "bench/work/seq_100.lem"
+#line 998 "bench/work/seq_100.cpp"
+            callDtor( 27, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 66, rhsData[3] );
+            callDtor( 68, rhsData[4] );
+            callDtor( 69, rhsData[5] );
+            callDtor( 70, rhsData[6] );
+            callDtor( 71, rhsData[7] );
+            callDtor( 72, rhsData[8] );
+            callDtor( 73, rhsData[9] );
+            callDtor( 74, rhsData[10] );
+            callDtor( 75, rhsData[11] );
+            break;
+        }
+
+        case 40:
+        {
+            // item ::= K5 T1 T0 T40 T41 T42 T43 T44 T45 T46 T47 T48
+#line 0 "bench/work/seq_100.lem"
+#line 1018 "bench/work/seq_100.cpp"
+            callDtor( 28, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 68, rhsData[3] );
+            callDtor( 69, rhsData[4] );
+            callDtor( 70, rhsData[5] );
+            callDtor( 71, rhsData[6] );
+            callDtor( 72, rhsData[7] );
+            callDtor( 73, rhsData[8] );
+            callDtor( 74, rhsData[9] );
+            callDtor( 75, rhsData[10] );
+            callDtor( 76, rhsData[11] );
+            break;
+        }
+
+        case 41:
+        {
+            // item ::= K6 T1 T0 T41 T42 T43 T44 T45 T46 T47 T48 T49
+#line 0 "bench/work/seq_100.lem"
+#line 1038 "bench/work/seq_100.cpp"
+            callDtor( 29, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 69, rhsData[3] );
+            callDtor( 70, rhsData[4] );
+            callDtor( 71, rhsData[5] );
+            callDtor( 72, rhsData[6] );
+            callDtor( 73, rhsData[7] );
+            callDtor( 74, rhsData[8] );
+            callDtor( 75, rhsData[9] );
+            callDtor( 76, rhsData[10] );
+            callDtor( 77, rhsData[11] );
+            break;
+        }
+
+        case 42:
+        {
+            // item ::= K7 T1 T0 T42 T43 T44 T45 T46 T47 T48 T49 T50
+#line 0 "bench/work/seq_100.lem"
+#line 1058 "bench/work/seq_100.cpp"
+            callDtor( 30, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 70, rhsData[3] );
+            callDtor( 71, rhsData[4] );
+            callDtor( 72, rhsData[5] );
+            callDtor( 73, rhsData[6] );
+            callDtor( 74, rhsData[7] );
+            callDtor( 75, rhsData[8] );
+            callDtor( 76, rhsData[9] );
+            callDtor( 77, rhsData[10] );
+            callDtor( 79, rhsData[11] );
+            break;
+        }
+
+        case 43:
+        {
+            // item ::= K8 T1 T0 T43 T44 T45 T46 T47 T48 T49 T50 T51
+#line 0 "bench/work/seq_100.lem"
+#line 1078 "bench/work/seq_100.cpp"
+            callDtor( 31, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 71, rhsData[3] );
+            callDtor( 72, rhsData[4] );
+            callDtor( 73, rhsData[5] );
+            callDtor( 74, rhsData[6] );
+            callDtor( 75, rhsData[7] );
+            callDtor( 76, rhsData[8] );
+            callDtor( 77, rhsData[9] );
+            callDtor( 79, rhsData[10] );
+            callDtor( 80, rhsData[11] );
+            break;
+        }
+
+        case 44:
+        {
+            // item ::= K9 T1 T0 T44 T45 T46 T47 T48 T49 T50 T51 T52
+#line 0 "bench/work/seq_100.lem"
+#line 1098 "bench/work/seq_100.cpp"
+            callDtor( 32, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 72, rhsData[3] );
+            callDtor( 73, rhsData[4] );
+            callDtor( 74, rhsData[5] );
+            callDtor( 75, rhsData[6] );
+            callDtor( 76, rhsData[7] );
+            callDtor( 77, rhsData[8] );
+            callDtor( 79, rhsData[9] );
+            callDtor( 80, rhsData[10] );
+            callDtor( 81, rhsData[11] );
+            break;
+        }
+
+        case 45:
+        {
+            // item ::= K10 T1 T0 T45 T46 T47 T48 T49 T50 T51 T52 T53
+#line 0 "bench/work/seq_100.lem"
+#line 1118 "bench/work/seq_100.cpp"
+            callDtor( 3, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 73, rhsData[3] );
+            callDtor( 74, rhsData[4] );
+            callDtor( 75, rhsData[5] );
+            callDtor( 76, rhsData[6] );
+            callDtor( 77, rhsData[7] );
+            callDtor( 79, rhsData[8] );
+            callDtor( 80, rhsData[9] );
+            callDtor( 81, rhsData[10] );
+            callDtor( 82, rhsData[11] );
+            break;
+        }
+
+        case 46:
+        {
+            // item ::= K11 T1 T0 T46 T47 T48 T49 T50 T51 T52 T53 T54
+#line 0 "bench/work/seq_100.lem"
+#line 1138 "bench/work/seq_100.cpp"
+            callDtor( 4, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 74, rhsData[3] );
+            callDtor( 75, rhsData[4] );
+            callDtor( 76, rhsData[5] );
+            callDtor( 77, rhsData[6] );
+            callDtor( 79, rhsData[7] );
+            callDtor( 80, rhsData[8] );
+            callDtor( 81, rhsData[9] );
+            callDtor( 82, rhsData[10] );
+            callDtor( 83, rhsData[11] );
+            break;
+        }
+
+        case 47:
+        {
+            // item ::= K12 T1 T0 T47 T48 T49 T50 T51 T52 T53 T54 T55
+#line 0 "bench/work/seq_100.lem"
+#line 1158 "bench/work/seq_100.cpp"
+            callDtor( 5, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 75, rhsData[3] );
+            callDtor( 76, rhsData[4] );
+            callDtor( 77, rhsData[5] );
+            callDtor( 79, rhsData[6] );
+            callDtor( 80, rhsData[7] );
+            callDtor( 81, rhsData[8] );
+            callDtor( 82, rhsData[9] );
+            callDtor( 83, rhsData[10] );
+            callDtor( 84, rhsData[11] );
+            break;
+        }
+
+        case 48:
+        {
+            // item ::= K13 T1 T0 T48 T49 T50 T51 T52 T53 T54 T55 T56
+#line 0 "bench/work/seq_100.lem"
+#line 1178 "bench/work/seq_100.cpp"
+            callDtor( 6, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 76, rhsData[3] );
+            callDtor( 77, rhsData[4] );
+            callDtor( 79, rhsData[5] );
+            callDtor( 80, rhsData[6] );
+            callDtor( 81, rhsData[7] );
+            callDtor( 82, rhsData[8] );
+            callDtor( 83, rhsData[9] );
+            callDtor( 84, rhsData[10] );
+            callDtor( 85, rhsData[11] );
+            break;
+        }
+
+        case 49:
+        {
+            // item ::= K14 T1 T0 T49 T50 T51 T52 T53 T54 T55 T56 T57
+#line 0 "bench/work/seq_100.lem"
+#line 1198 "bench/work/seq_100.cpp"
+            callDtor( 7, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 77, rhsData[3] );
+            callDtor( 79, rhsData[4] );
+            callDtor( 80, rhsData[5] );
+            callDtor( 81, rhsData[6] );
+            callDtor( 82, rhsData[7] );
+            callDtor( 83, rhsData[8] );
+            callDtor( 84, rhsData[9] );
+            callDtor( 85, rhsData[10] );
+            callDtor( 86, rhsData[11] );
+            break;
+        }
+
+        case 50:
+        {
+            // item ::= K15 T1 T0 T50 T51 T52 T53 T54 T55 T56 T57 T58
+#line 0 "bench/work/seq_100.lem"
+#line 1218 "bench/work/seq_100.cpp"
+            callDtor( 8, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 79, rhsData[3] );
+            callDtor( 80, rhsData[4] );
+            callDtor( 81, rhsData[5] );
+            callDtor( 82, rhsData[6] );
+            callDtor( 83, rhsData[7] );
+            callDtor( 84, rhsData[8] );
+            callDtor( 85, rhsData[9] );
+            callDtor( 86, rhsData[10] );
+            callDtor( 87, rhsData[11] );
+            break;
+        }
+
+        case 51:
+        {
+            // item ::= K16 T1 T0 T51 T52 T53 T54 T55 T56 T57 T58 T59
+#line 0 "bench/work/seq_100.lem"
+#line 1238 "bench/work/seq_100.cpp"
+            callDtor( 9, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 80, rhsData[3] );
+            callDtor( 81, rhsData[4] );
+            callDtor( 82, rhsData[5] );
+            callDtor( 83, rhsData[6] );
+            callDtor( 84, rhsData[7] );
+            callDtor( 85, rhsData[8] );
+            callDtor( 86, rhsData[9] );
+            callDtor( 87, rhsData[10] );
+            callDtor( 88, rhsData[11] );
+            break;
+        }
+
+        case 52:
+        {
+            // item ::= K17 T1 T0 T52 T53 T54 T55 T56 T57 T58 T59 T60
+#line 0 "bench/work/seq_100.lem"
+#line 1258 "bench/work/seq_100.cpp"
+            callDtor( 10, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 81, rhsData[3] );
+            callDtor( 82, rhsData[4] );
+            callDtor( 83, rhsData[5] );
+            callDtor( 84, rhsData[6] );
+            callDtor( 85, rhsData[7] );
+            callDtor( 86, rhsData[8] );
+            callDtor( 87, rhsData[9] );
+            callDtor( 88, rhsData[10] );
+            callDtor( 90, rhsData[11] );
+            break;
+        }
+
+        case 53:
+        {
+            // item ::= K18 T1 T0 T53 T54 T55 T56 T57 T58 T59 T60 T61
+#line 0 "bench/work/seq_100.lem"
+#line 1278 "bench/work/seq_100.cpp"
+            callDtor( 11, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 82, rhsData[3] );
+            callDtor( 83, rhsData[4] );
+            callDtor( 84, rhsData[5] );
+            callDtor( 85, rhsData[6] );
+            callDtor( 86, rhsData[7] );
+            callDtor( 87, rhsData[8] );
+            callDtor( 88, rhsData[9] );
+            callDtor( 90, rhsData[10] );
+            callDtor( 91, rhsData[11] );
+            break;
+        }
+
+        case 54:
+        {
+            // item ::= K19 T1 T0 T54 T55 T56 T57 T58 T59 T60 T61 T62
+#line 0 "bench/work/seq_100.lem"
+#line 1298 "bench/work/seq_100.cpp"
+            callDtor( 12, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 83, rhsData[3] );
+            callDtor( 84, rhsData[4] );
+            callDtor( 85, rhsData[5] );
+            callDtor( 86, rhsData[6] );
+            callDtor( 87, rhsData[7] );
+            callDtor( 88, rhsData[8] );
+            callDtor( 90, rhsData[9] );
+            callDtor( 91, rhsData[10] );
+            callDtor( 92, rhsData[11] );
+            break;
+        }
+
+        case 55:
+        {
+            // item ::= K20 T1 T0 T55 T56 T57 T58 T59 T60 T61 T62 T63
+#line 0 "bench/work/seq_100.lem"
+#line 1318 "bench/work/seq_100.cpp"
+            callDtor( 14, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 84, rhsData[3] );
+            callDtor( 85, rhsData[4] );
+            callDtor( 86, rhsData[5] );
+            callDtor( 87, rhsData[6] );
+            callDtor( 88, rhsData[7] );
+            callDtor( 90, rhsData[8] );
+            callDtor( 91, rhsData[9] );
+            callDtor( 92, rhsData[10] );
+            callDtor( 93, rhsData[11] );
+            break;
+        }
+
+        case 56:
+        {
+            // item ::= K21 T1 T0 T56 T57 T58 T59 T60 T61 T62 T63 T0
+#line 0 "bench/work/seq_100.lem"
+#line 1338 "bench/work/seq_100.cpp"
+            callDtor( 15, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 85, rhsData[3] );
+            callDtor( 86, rhsData[4] );
+            callDtor( 87, rhsData[5] );
+            callDtor( 88, rhsData[6] );
+            callDtor( 90, rhsData[7] );
+            callDtor( 91, rhsData[8] );
+            callDtor( 92, rhsData[9] );
+            callDtor( 93, rhsData[10] );
+            callDtor( 33, rhsData[11] );
+            break;
+        }
+
+        case 57:
+        {
+            // item ::= K22 T1 T0 T57 T58 T59 T60 T61 T62 T63 T0 T1
+#line 0 "bench/work/seq_100.lem"
+#line 1358 "bench/work/seq_100.cpp"
+            callDtor( 16, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 86, rhsData[3] );
+            callDtor( 87, rhsData[4] );
+            callDtor( 88, rhsData[5] );
+            callDtor( 90, rhsData[6] );
+            callDtor( 91, rhsData[7] );
+            callDtor( 92, rhsData[8] );
+            callDtor( 93, rhsData[9] );
+            callDtor( 33, rhsData[10] );
+            callDtor( 34, rhsData[11] );
+            break;
+        }
+
+        case 58:
+        {
+            // item ::= K23 T1 T0 T58 T59 T60 T61 T62 T63 T0 T1 T2
+#line 0 "bench/work/seq_100.lem"
+#line 1378 "bench/work/seq_100.cpp"
+            callDtor( 17, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 87, rhsData[3] );
+            callDtor( 88, rhsData[4] );
+            callDtor( 90, rhsData[5] );
+            callDtor( 91, rhsData[6] );
+            callDtor( 92, rhsData[7] );
+            callDtor( 93, rhsData[8] );
+            callDtor( 33, rhsData[9] );
+            callDtor( 34, rhsData[10] );
+            callDtor( 45, rhsData[11] );
+            break;
+        }
+
+        case 59:
+        {
+            // item ::= K24 T1 T0 T59 T60 T61 T62 T63 T0 T1 T2 T3
+#line 0 "bench/work/seq_100.lem"
+#line 1398 "bench/work/seq_100.cpp"
+            callDtor( 18, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 88, rhsData[3] );
+            callDtor( 90, rhsData[4] );
+            callDtor( 91, rhsData[5] );
+            callDtor( 92, rhsData[6] );
+            callDtor( 93, rhsData[7] );
+            callDtor( 33, rhsData[8] );
+            callDtor( 34, rhsData[9] );
+            callDtor( 45, rhsData[10] );
+            callDtor( 56, rhsData[11] );
+            break;
+        }
+
+        case 60:
+        {
+            // item ::= K25 T1 T0 T60 T61 T62 T63 T0 T1 T2 T3 T4
+#line 0 "bench/work/seq_100.lem"
+#line 1418 "bench/work/seq_100.cpp"
+            callDtor( 19, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 90, rhsData[3] );
+            callDtor( 91, rhsData[4] );
+            callDtor( 92, rhsData[5] );
+            callDtor( 93, rhsData[6] );
+            callDtor( 33, rhsData[7] );
+            callDtor( 34, rhsData[8] );
+            callDtor( 45, rhsData[9] );
+            callDtor( 56, rhsData[10] );
+            callDtor( 67, rhsData[11] );
+            break;
+        }
+
+        case 61:
+        {
+            // item ::= K26 T1 T0 T61 T62 T63 T0 T1 T2 T3 T4 T5
+#line 0 "bench/work/seq_100.lem"
+#line 1438 "bench/work/seq_100.cpp"
+            callDtor( 20, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 91, rhsData[3] );
+            callDtor( 92, rhsData[4] );
+            callDtor( 93, rhsData[5] );
+            callDtor( 33, rhsData[6] );
+            callDtor( 34, rhsData[7] );
+            callDtor( 45, rhsData[8] );
+            callDtor( 56, rhsData[9] );
+            callDtor( 67, rhsData[10] );
+            callDtor( 78, rhsData[11] );
+            break;
+        }
+
+        case 62:
+        {
+            // item ::= K27 T1 T0 T62 T63 T0 T1 T2 T3 T4 T5 T6
+#line 0 "bench/work/seq_100.lem"
+#line 1458 "bench/work/seq_100.cpp"
+            callDtor( 21, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 92, rhsData[3] );
+            callDtor( 93, rhsData[4] );
+            callDtor( 33, rhsData[5] );
+            callDtor( 34, rhsData[6] );
+            callDtor( 45, rhsData[7] );
+            callDtor( 56, rhsData[8] );
+            callDtor( 67, rhsData[9] );
+            callDtor( 78, rhsData[10] );
+            callDtor( 89, rhsData[11] );
+            break;
+        }
+
+        case 63:
+        {
+            // item ::= K28 T1 T0 T63 T0 T1 T2 T3 T4 T5 T6 T7
+#line 0 "bench/work/seq_100.lem"
+#line 1478 "bench/work/seq_100.cpp"
+            callDtor( 22, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 93, rhsData[3] );
+            callDtor( 33, rhsData[4] );
+            callDtor( 34, rhsData[5] );
+            callDtor( 45, rhsData[6] );
+            callDtor( 56, rhsData[7] );
+            callDtor( 67, rhsData[8] );
+            callDtor( 78, rhsData[9] );
+            callDtor( 89, rhsData[10] );
+            callDtor( 94, rhsData[11] );
+            break;
+        }
+
+        case 64:
+        {
+            // item ::= K29 T1 T0 T0 T1 T2 T3 T4 T5 T6 T7 T8
+#line 0 "bench/work/seq_100.lem"
+#line 1498 "bench/work/seq_100.cpp"
+            callDtor( 23, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 33, rhsData[3] );
+            callDtor( 34, rhsData[4] );
+            callDtor( 45, rhsData[5] );
+            callDtor( 56, rhsData[6] );
+            callDtor( 67, rhsData[7] );
+            callDtor( 78, rhsData[8] );
+            callDtor( 89, rhsData[9] );
+            callDtor( 94, rhsData[10] );
+            callDtor( 95, rhsData[11] );
+            break;
+        }
+
+        case 65:
+        {
+            // item ::= K30 T1 T0 T1 T2 T3 T4 T5 T6 T7 T8 T9
+#line 0 "bench/work/seq_100.lem"
+#line 1518 "bench/work/seq_100.cpp"
+            callDtor( 25, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 34, rhsData[3] );
+            callDtor( 45, rhsData[4] );
+            callDtor( 56, rhsData[5] );
+            callDtor( 67, rhsData[6] );
+            callDtor( 78, rhsData[7] );
+            callDtor( 89, rhsData[8] );
+            callDtor( 94, rhsData[9] );
+            callDtor( 95, rhsData[10] );
+            callDtor( 96, rhsData[11] );
+            break;
+        }
+
+        case 66:
+        {
+            // item ::= K31 T1 T0 T2 T3 T4 T5 T6 T7 T8 T9 T10
+#line 0 "bench/work/seq_100.lem"
+#line 1538 "bench/work/seq_100.cpp"
+            callDtor( 26, rhsData[0] );
+            callDtor( 34, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 45, rhsData[3] );
+            callDtor( 56, rhsData[4] );
+            callDtor( 67, rhsData[5] );
+            callDtor( 78, rhsData[6] );
+            callDtor( 89, rhsData[7] );
+            callDtor( 94, rhsData[8] );
+            callDtor( 95, rhsData[9] );
+            callDtor( 96, rhsData[10] );
+            callDtor( 35, rhsData[11] );
+            break;
+        }
+
+        case 67:
+        {
+            // item ::= K0 T2 T0 T3 T4 T5 T6 T7 T8 T9 T10 T11
+#line 0 "bench/work/seq_100.lem"
+#line 1558 "bench/work/seq_100.cpp"
+            callDtor( 1, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 56, rhsData[3] );
+            callDtor( 67, rhsData[4] );
+            callDtor( 78, rhsData[5] );
+            callDtor( 89, rhsData[6] );
+            callDtor( 94, rhsData[7] );
+            callDtor( 95, rhsData[8] );
+            callDtor( 96, rhsData[9] );
+            callDtor( 35, rhsData[10] );
+            callDtor( 36, rhsData[11] );
+            break;
+        }
+
+        case 68:
+        {
+            // item ::= K1 T2 T0 T4 T5 T6 T7 T8 T9 T10 T11 T12
+#line 0 "bench/work/seq_100.lem"
+#line 1578 "bench/work/seq_100.cpp"
+            callDtor( 2, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 67, rhsData[3] );
+            callDtor( 78, rhsData[4] );
+            callDtor( 89, rhsData[5] );
+            callDtor( 94, rhsData[6] );
+            callDtor( 95, rhsData[7] );
+            callDtor( 96, rhsData[8] );
+            callDtor( 35, rhsData[9] );
+            callDtor( 36, rhsData[10] );
+            callDtor( 37, rhsData[11] );
+            break;
+        }
+
+        case 69:
+        {
+            // item ::= K2 T2 T0 T5 T6 T7 T8 T9 T10 T11 T12 T13
+#line 0 "bench/work/seq_100.lem"
+#line 1598 "bench/work/seq_100.cpp"
+            callDtor( 13, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 78, rhsData[3] );
+            callDtor( 89, rhsData[4] );
+            callDtor( 94, rhsData[5] );
+            callDtor( 95, rhsData[6] );
+            callDtor( 96, rhsData[7] );
+            callDtor( 35, rhsData[8] );
+            callDtor( 36, rhsData[9] );
+            callDtor( 37, rhsData[10] );
+            callDtor( 38, rhsData[11] );
+            break;
+        }
+
+        case 70:
+        {
+            // item ::= K3 T2 T0 T6 T7 T8 T9 T10 T11 T12 T13 T14
+#line 0 "bench/work/seq_100.lem"
+#line 1618 "bench/work/seq_100.cpp"
+            callDtor( 24, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 89, rhsData[3] );
+            callDtor( 94, rhsData[4] );
+            callDtor( 95, rhsData[5] );
+            callDtor( 96, rhsData[6] );
+            callDtor( 35, rhsData[7] );
+            callDtor( 36, rhsData[8] );
+            callDtor( 37, rhsData[9] );
+            callDtor( 38, rhsData[10] );
+            callDtor( 39, rhsData[11] );
+            break;
+        }
+
+        case 71:
+        {
+            // item ::= K4 T2 T0 T7 T8 T9 T10 T11 T12 T13 T14 T15
+#line 0 "bench/work/seq_100.lem"
+#line 1638 "bench/work/seq_100.cpp"
+            callDtor( 27, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 94, rhsData[3] );
+            callDtor( 95, rhsData[4] );
+            callDtor( 96, rhsData[5] );
+            callDtor( 35, rhsData[6] );
+            callDtor( 36, rhsData[7] );
+            callDtor( 37, rhsData[8] );
+            callDtor( 38, rhsData[9] );
+            callDtor( 39, rhsData[10] );
+            callDtor( 40, rhsData[11] );
+            break;
+        }
+
+        case 72:
+        {
+            // item ::= K5 T2 T0 T8 T9 T10 T11 T12 T13 T14 T15 T16
+#line 0 "bench/work/seq_100.lem"
+#line 1658 "bench/work/seq_100.cpp"
+            callDtor( 28, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 95, rhsData[3] );
+            callDtor( 96, rhsData[4] );
+            callDtor( 35, rhsData[5] );
+            callDtor( 36, rhsData[6] );
+            callDtor( 37, rhsData[7] );
+            callDtor( 38, rhsData[8] );
+            callDtor( 39, rhsData[9] );
+            callDtor( 40, rhsData[10] );
+            callDtor( 41, rhsData[11] );
+            break;
+        }
+
+        case 73:
+        {
+            // item ::= K6 T2 T0 T9 T10 T11 T12 T13 T14 T15 T16 T17
+#line 0 "bench/work/seq_100.lem"
+#line 1678 "bench/work/seq_100.cpp"
+            callDtor( 29, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 96, rhsData[3] );
+            callDtor( 35, rhsData[4] );
+            callDtor( 36, rhsData[5] );
+            callDtor( 37, rhsData[6] );
+            callDtor( 38, rhsData[7] );
+            callDtor( 39, rhsData[8] );
+            callDtor( 40, rhsData[9] );
+            callDtor( 41, rhsData[10] );
+            callDtor( 42, rhsData[11] );
+            break;
+        }
+
+        case 74:
+        {
+            // item ::= K7 T2 T0 T10 T11 T12 T13 T14 T15 T16 T17 T18
+#line 0 "bench/work/seq_100.lem"
+#line 1698 "bench/work/seq_100.cpp"
+            callDtor( 30, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 35, rhsData[3] );
+            callDtor( 36, rhsData[4] );
+            callDtor( 37, rhsData[5] );
+            callDtor( 38, rhsData[6] );
+            callDtor( 39, rhsData[7] );
+            callDtor( 40, rhsData[8] );
+            callDtor( 41, rhsData[9] );
+            callDtor( 42, rhsData[10] );
+            callDtor( 43, rhsData[11] );
+            break;
+        }
+
+        case 75:
+        {
+            // item ::= K8 T2 T0 T11 T12 T13 T14 T15 T16 T17 T18 T19
+#line 0 "bench/work/seq_100.lem"
+#line 1718 "bench/work/seq_100.cpp"
+            callDtor( 31, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 36, rhsData[3] );
+            callDtor( 37, rhsData[4] );
+            callDtor( 38, rhsData[5] );
+            callDtor( 39, rhsData[6] );
+            callDtor( 40, rhsData[7] );
+            callDtor( 41, rhsData[8] );
+            callDtor( 42, rhsData[9] );
+            callDtor( 43, rhsData[10] );
+            callDtor( 44, rhsData[11] );
+            break;
+        }
+
+        case 76:
+        {
+            // item ::= K9 T2 T0 T12 T13 T14 T15 T16 T17 T18 T19 T20
+#line 0 "bench/work/seq_100.lem"
+#line 1738 "bench/work/seq_100.cpp"
+            callDtor( 32, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 37, rhsData[3] );
+            callDtor( 38, rhsData[4] );
+            callDtor( 39, rhsData[5] );
+            callDtor( 40, rhsData[6] );
+            callDtor( 41, rhsData[7] );
+            callDtor( 42, rhsData[8] );
+            callDtor( 43, rhsData[9] );
+            callDtor( 44, rhsData[10] );
+            callDtor( 46, rhsData[11] );
+            break;
+        }
+
+        case 77:
+        {
+            // item ::= K10 T2 T0 T13 T14 T15 T16 T17 T18 T19 T20 T21
+#line 0 "bench/work/seq_100.lem"
+#line 1758 "bench/work/seq_100.cpp"
+            callDtor( 3, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 38, rhsData[3] );
+            callDtor( 39, rhsData[4] );
+            callDtor( 40, rhsData[5] );
+            callDtor( 41, rhsData[6] );
+            callDtor( 42, rhsData[7] );
+            callDtor( 43, rhsData[8] );
+            callDtor( 44, rhsData[9] );
+            callDtor( 46, rhsData[10] );
+            callDtor( 47, rhsData[11] );
+            break;
+        }
+
+        case 78:
+        {
+            // item ::= K11 T2 T0 T14 T15 T16 T17 T18 T19 T20 T21 T22
+#line 0 "bench/work/seq_100.lem"
+#line 1778 "bench/work/seq_100.cpp"
+            callDtor( 4, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 39, rhsData[3] );
+            callDtor( 40, rhsData[4] );
+            callDtor( 41, rhsData[5] );
+            callDtor( 42, rhsData[6] );
+            callDtor( 43, rhsData[7] );
+            callDtor( 44, rhsData[8] );
+            callDtor( 46, rhsData[9] );
+            callDtor( 47, rhsData[10] );
+            callDtor( 48, rhsData[11] );
+            break;
+        }
+
+        case 79:
+        {
+            // item ::= K12 T2 T0 T15 T16 T17 T18 T19 T20 T21 T22 T23
+#line 0 "bench/work/seq_100.lem"
+#line 1798 "bench/work/seq_100.cpp"
+            callDtor( 5, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 40, rhsData[3] );
+            callDtor( 41, rhsData[4] );
+            callDtor( 42, rhsData[5] );
+            callDtor( 43, rhsData[6] );
+            callDtor( 44, rhsData[7] );
+            callDtor( 46, rhsData[8] );
+            callDtor( 47, rhsData[9] );
+            callDtor( 48, rhsData[10] );
+            callDtor( 49, rhsData[11] );
+            break;
+        }
+
+        case 80:
+        {
+            // item ::= K13 T2 T0 T16 T17 T18 T19 T20 T21 T22 T23 T24
+#line 0 "bench/work/seq_100.lem"
+#line 1818 "bench/work/seq_100.cpp"
+            callDtor( 6, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 41, rhsData[3] );
+            callDtor( 42, rhsData[4] );
+            callDtor( 43, rhsData[5] );
+            callDtor( 44, rhsData[6] );
+            callDtor( 46, rhsData[7] );
+            callDtor( 47, rhsData[8] );
+            callDtor( 48, rhsData[9] );
+            callDtor( 49, rhsData[10] );
+            callDtor( 50, rhsData[11] );
+            break;
+        }
+
+        case 81:
+        {
+            // item ::= K14 T2 T0 T17 T18 T19 T20 T21 T22 T23 T24 T25
+#line 0 "bench/work/seq_100.lem"
+#line 1838 "bench/work/seq_100.cpp"
+            callDtor( 7, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 42, rhsData[3] );
+            callDtor( 43, rhsData[4] );
+            callDtor( 44, rhsData[5] );
+            callDtor( 46, rhsData[6] );
+            callDtor( 47, rhsData[7] );
+            callDtor( 48, rhsData[8] );
+            callDtor( 49, rhsData[9] );
+            callDtor( 50, rhsData[10] );
+            callDtor( 51, rhsData[11] );
+            break;
+        }
+
+        case 82:
+        {
+            // item ::= K15 T2 T0 T18 T19 T20 T21 T22 T23 T24 T25 T26
+#line 0 "bench/work/seq_100.lem"
+#line 1858 "bench/work/seq_100.cpp"
+            callDtor( 8, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 43, rhsData[3] );
+            callDtor( 44, rhsData[4] );
+            callDtor( 46, rhsData[5] );
+            callDtor( 47, rhsData[6] );
+            callDtor( 48, rhsData[7] );
+            callDtor( 49, rhsData[8] );
+            callDtor( 50, rhsData[9] );
+            callDtor( 51, rhsData[10] );
+            callDtor( 52, rhsData[11] );
+            break;
+        }
+
+        case 83:
+        {
+            // item ::= K16 T2 T0 T19 T20 T21 T22 T23 T24 T25 T26 T27
+#line 0 "bench/work/seq_100.lem"
+#line 1878 "bench/work/seq_100.cpp"
+            callDtor( 9, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 44, rhsData[3] );
+            callDtor( 46, rhsData[4] );
+            callDtor( 47, rhsData[5] );
+            callDtor( 48, rhsData[6] );
+            callDtor( 49, rhsData[7] );
+            callDtor( 50, rhsData[8] );
+            callDtor( 51, rhsData[9] );
+            callDtor( 52, rhsData[10] );
+            callDtor( 53, rhsData[11] );
+            break;
+        }
+
+        case 84:
+        {
+            // item ::= K17 T2 T0 T20 T21 T22 T23 T24 T25 T26 T27 T28
+#line 0 "bench/work/seq_100.lem"
+#line 1898 "bench/work/seq_100.cpp"
+            callDtor( 10, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 46, rhsData[3] );
+            callDtor( 47, rhsData[4] );
+            callDtor( 48, rhsData[5] );
+            callDtor( 49, rhsData[6] );
+            callDtor( 50, rhsData[7] );
+            callDtor( 51, rhsData[8] );
+            callDtor( 52, rhsData[9] );
+            callDtor( 53, rhsData[10] );
+            callDtor( 54, rhsData[11] );
+            break;
+        }
+
+        case 85:
+        {
+            // item ::= K18 T2 T0 T21 T22 T23 T24 T25 T26 T27 T28 T29
+#line 0 "bench/work/seq_100.lem"
+#line 1918 "bench/work/seq_100.cpp"
+            callDtor( 11, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 47, rhsData[3] );
+            callDtor( 48, rhsData[4] );
+            callDtor( 49, rhsData[5] );
+            callDtor( 50, rhsData[6] );
+            callDtor( 51, rhsData[7] );
+            callDtor( 52, rhsData[8] );
+            callDtor( 53, rhsData[9] );
+            callDtor( 54, rhsData[10] );
+            callDtor( 55, rhsData[11] );
+            break;
+        }
+
+        case 86:
+        {
+            // item ::= K19 T2 T0 T22 T23 T24 T25 T26 T27 T28 T29 T30
+#line 0 "bench/work/seq_100.lem"
+#line 1938 "bench/work/seq_100.cpp"
+            callDtor( 12, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 48, rhsData[3] );
+            callDtor( 49, rhsData[4] );
+            callDtor( 50, rhsData[5] );
+            callDtor( 51, rhsData[6] );
+            callDtor( 52, rhsData[7] );
+            callDtor( 53, rhsData[8] );
+            callDtor( 54, rhsData[9] );
+            callDtor( 55, rhsData[10] );
+            callDtor( 57, rhsData[11] );
+            break;
+        }
+
+        case 87:
+        {
+            // item ::= K20 T2 T0 T23 T24 T25 T26 T27 T28 T29 T30 T31
+#line 0 "bench/work/seq_100.lem"
+#line 1958 "bench/work/seq_100.cpp"
+            callDtor( 14, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 49, rhsData[3] );
+            callDtor( 50, rhsData[4] );
+            callDtor( 51, rhsData[5] );
+            callDtor( 52, rhsData[6] );
+            callDtor( 53, rhsData[7] );
+            callDtor( 54, rhsData[8] );
+            callDtor( 55, rhsData[9] );
+            callDtor( 57, rhsData[10] );
+            callDtor( 58, rhsData[11] );
+            break;
+        }
+
+        case 88:
+        {
+            // item ::= K21 T2 T0 T24 T25 T26 T27 T28 T29 T30 T31 T32
+#line 0 "bench/work/seq_100.lem"
+#line 1978 "bench/work/seq_100.cpp"
+            callDtor( 15, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 50, rhsData[3] );
+            callDtor( 51, rhsData[4] );
+            callDtor( 52, rhsData[5] );
+            callDtor( 53, rhsData[6] );
+            callDtor( 54, rhsData[7] );
+            callDtor( 55, rhsData[8] );
+            callDtor( 57, rhsData[9] );
+            callDtor( 58, rhsData[10] );
+            callDtor( 59, rhsData[11] );
+            break;
+        }
+
+        case 89:
+        {
+            // item ::= K22 T2 T0 T25 T26 T27 T28 T29 T30 T31 T32 T33
+#line 0 "bench/work/seq_100.lem"
+#line 1998 "bench/work/seq_100.cpp"
+            callDtor( 16, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 51, rhsData[3] );
+            callDtor( 52, rhsData[4] );
+            callDtor( 53, rhsData[5] );
+            callDtor( 54, rhsData[6] );
+            callDtor( 55, rhsData[7] );
+            callDtor( 57, rhsData[8] );
+            callDtor( 58, rhsData[9] );
+            callDtor( 59, rhsData[10] );
+            callDtor( 60, rhsData[11] );
+            break;
+        }
+
+        case 90:
+        {
+            // item ::= K23 T2 T0 T26 T27 T28 T29 T30 T31 T32 T33 T34
+#line 0 "bench/work/seq_100.lem"
+#line 2018 "bench/work/seq_100.cpp"
+            callDtor( 17, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 52, rhsData[3] );
+            callDtor( 53, rhsData[4] );
+            callDtor( 54, rhsData[5] );
+            callDtor( 55, rhsData[6] );
+            callDtor( 57, rhsData[7] );
+            callDtor( 58, rhsData[8] );
+            callDtor( 59, rhsData[9] );
+            callDtor( 60, rhsData[10] );
+            callDtor( 61, rhsData[11] );
+            break;
+        }
+
+        case 91:
+        {
+            // item ::= K24 T2 T0 T27 T28 T29 T30 T31 T32 T33 T34 T35
+#line 0 "bench/work/seq_100.lem"
+#line 2038 "bench/work/seq_100.cpp"
+            callDtor( 18, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 53, rhsData[3] );
+            callDtor( 54, rhsData[4] );
+            callDtor( 55, rhsData[5] );
+            callDtor( 57, rhsData[6] );
+            callDtor( 58, rhsData[7] );
+            callDtor( 59, rhsData[8] );
+            callDtor( 60, rhsData[9] );
+            callDtor( 61, rhsData[10] );
+            callDtor( 62, rhsData[11] );
+            break;
+        }
+
+        case 92:
+        {
+            // item ::= K25 T2 T0 T28 T29 T30 T31 T32 T33 T34 T35 T36
+#line 0 "bench/work/seq_100.lem"
+#line 2058 "bench/work/seq_100.cpp"
+            callDtor( 19, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 54, rhsData[3] );
+            callDtor( 55, rhsData[4] );
+            callDtor( 57, rhsData[5] );
+            callDtor( 58, rhsData[6] );
+            callDtor( 59, rhsData[7] );
+            callDtor( 60, rhsData[8] );
+            callDtor( 61, rhsData[9] );
+            callDtor( 62, rhsData[10] );
+            callDtor( 63, rhsData[11] );
+            break;
+        }
+
+        case 93:
+        {
+            // item ::= K26 T2 T0 T29 T30 T31 T32 T33 T34 T35 T36 T37
+#line 0 "bench/work/seq_100.lem"
+#line 2078 "bench/work/seq_100.cpp"
+            callDtor( 20, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 55, rhsData[3] );
+            callDtor( 57, rhsData[4] );
+            callDtor( 58, rhsData[5] );
+            callDtor( 59, rhsData[6] );
+            callDtor( 60, rhsData[7] );
+            callDtor( 61, rhsData[8] );
+            callDtor( 62, rhsData[9] );
+            callDtor( 63, rhsData[10] );
+            callDtor( 64, rhsData[11] );
+            break;
+        }
+
+        case 94:
+        {
+            // item ::= K27 T2 T0 T30 T31 T32 T33 T34 T35 T36 T37 T38
+#line 0 "bench/work/seq_100.lem"
+#line 2098 "bench/work/seq_100.cpp"
+            callDtor( 21, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 57, rhsData[3] );
+            callDtor( 58, rhsData[4] );
+            callDtor( 59, rhsData[5] );
+            callDtor( 60, rhsData[6] );
+            callDtor( 61, rhsData[7] );
+            callDtor( 62, rhsData[8] );
+            callDtor( 63, rhsData[9] );
+            callDtor( 64, rhsData[10] );
+            callDtor( 65, rhsData[11] );
+            break;
+        }
+
+        case 95:
+        {
+            // item ::= K28 T2 T0 T31 T32 T33 T34 T35 T36 T37 T38 T39
+#line 0 "bench/work/seq_100.lem"
+#line 2118 "bench/work/seq_100.cpp"
+            callDtor( 22, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 58, rhsData[3] );
+            callDtor( 59, rhsData[4] );
+            callDtor( 60, rhsData[5] );
+            callDtor( 61, rhsData[6] );
+            callDtor( 62, rhsData[7] );
+            callDtor( 63, rhsData[8] );
+            callDtor( 64, rhsData[9] );
+            callDtor( 65, rhsData[10] );
+            callDtor( 66, rhsData[11] );
+            break;
+        }
+
+        case 96:
+        {
+            // item ::= K29 T2 T0 T32 T33 T34 T35 T36 T37 T38 T39 T40
+#line 0 "bench/work/seq_100.lem"
+#line 2138 "bench/work/seq_100.cpp"
+            callDtor( 23, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 59, rhsData[3] );
+            callDtor( 60, rhsData[4] );
+            callDtor( 61, rhsData[5] );
+            callDtor( 62, rhsData[6] );
+            callDtor( 63, rhsData[7] );
+            callDtor( 64, rhsData[8] );
+            callDtor( 65, rhsData[9] );
+            callDtor( 66, rhsData[10] );
+            callDtor( 68, rhsData[11] );
+            break;
+        }
+
+        case 97:
+        {
+            // item ::= K30 T2 T0 T33 T34 T35 T36 T37 T38 T39 T40 T41
+#line 0 "bench/work/seq_100.lem"
+#line 2158 "bench/work/seq_100.cpp"
+            callDtor( 25, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 60, rhsData[3] );
+            callDtor( 61, rhsData[4] );
+            callDtor( 62, rhsData[5] );
+            callDtor( 63, rhsData[6] );
+            callDtor( 64, rhsData[7] );
+            callDtor( 65, rhsData[8] );
+            callDtor( 66, rhsData[9] );
+            callDtor( 68, rhsData[10] );
+            callDtor( 69, rhsData[11] );
+            break;
+        }
+
+        case 98:
+        {
+            // item ::= K31 T2 T0 T34 T35 T36 T37 T38 T39 T40 T41 T42
+#line 0 "bench/work/seq_100.lem"
+#line 2178 "bench/work/seq_100.cpp"
+            callDtor( 26, rhsData[0] );
+            callDtor( 45, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 61, rhsData[3] );
+            callDtor( 62, rhsData[4] );
+            callDtor( 63, rhsData[5] );
+            callDtor( 64, rhsData[6] );
+            callDtor( 65, rhsData[7] );
+            callDtor( 66, rhsData[8] );
+            callDtor( 68, rhsData[9] );
+            callDtor( 69, rhsData[10] );
+            callDtor( 70, rhsData[11] );
+            break;
+        }
+
+        case 99:
+        {
+            // item ::= K0 T3 T0 T35 T36 T37 T38 T39 T40 T41 T42 T43
+#line 0 "bench/work/seq_100.lem"
+#line 2198 "bench/work/seq_100.cpp"
+            callDtor( 1, rhsData[0] );
+            callDtor( 56, rhsData[1] );
+            callDtor( 33, rhsData[2] );
+            callDtor( 62, rhsData[3] );
+            callDtor( 63, rhsData[4] );
+            callDtor( 64, rhsData[5] );
+            callDtor( 65, rhsData[6] );
+            callDtor( 66, rhsData[7] );
+            callDtor( 68, rhsData[8] );
+            callDtor( 69, rhsData[9] );
+            callDtor( 70, rhsData[10] );
+            callDtor( 71, rhsData[11] );
+            break;
+        }
+
+        default:
+            throw "Unknown Rule Number";
+            break;
+    }
+
+    if ( PA_SHIFT == next )
+        shift( newVal, myRules[ruleNum].first, data );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::callDtor( int symIdx, privBenchImpl::Value &data )
+{
+    switch ( symIdx )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+        case 12:
+        case 13:
+        case 14:
+        case 15:
+        case 16:
+        case 17:
+        case 18:
+        case 19:
+        case 20:
+        case 21:
+        case 22:
+        case 23:
+        case 24:
+        case 25:
+        case 26:
+        case 27:
+        case 28:
+        case 29:
+        case 30:
+        case 31:
+        case 32:
+        case 33:
+        case 34:
+        case 35:
+        case 36:
+        case 37:
+        case 38:
+        case 39:
+        case 40:
+        case 41:
+        case 42:
+        case 43:
+        case 44:
+        case 45:
+        case 46:
+        case 47:
+        case 48:
+        case 49:
+        case 50:
+        case 51:
+        case 52:
+        case 53:
+        case 54:
+        case 55:
+        case 56:
+        case 57:
+        case 58:
+        case 59:
+        case 60:
+        case 61:
+        case 62:
+        case 63:
+        case 64:
+        case 65:
+        case 66:
+        case 67:
+        case 68:
+        case 69:
+        case 70:
+        case 71:
+        case 72:
+        case 73:
+        case 74:
+        case 75:
+        case 76:
+        case 77:
+        case 78:
+        case 79:
+        case 80:
+        case 81:
+        case 82:
+        case 83:
+        case 84:
+        case 85:
+        case 86:
+        case 87:
+        case 88:
+        case 89:
+        case 90:
+        case 91:
+        case 92:
+        case 93:
+        case 94:
+        case 95:
+        case 96:
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::popStack( void )
+{
+    callDtor( myStack.top().first.second, myStack.top().second );
+    myStack.pop();
+}
+
+
+////////////////////////////////////////
+
+
+ParserAct privBenchImpl::findParserAction( int &newVal, int tok )
+{
+    int stateNum;
+    ParserAct retval = PA_NOP;
+    bool found = false;
+
+    stateNum = myStack.empty() ? 0 : myStack.top().first.first;
+    ActionMap::iterator i = myStates[stateNum].find( tok );
+    if ( tok >= 0 && tok <= 101 )
+    {
+        if ( i != myStates[stateNum].end() )
+        {
+            retval = (*i).second.first;
+            newVal = (*i).second.second;
+            found = true;
+        }
+    }
+    else if ( ! myStates[stateNum].empty() )
+    {
+        retval = PA_NOP;
+        newVal = 0;
+        found = true;
+    }
+
+    if ( ! found )
+    {
+        retval = myStateDefaultActions[stateNum].first;
+        newVal = myStateDefaultActions[stateNum].second;
+    }
+    return retval;
+}
+
+
+////////////////////////////////////////
+
+
+static int theStateTable[1334][4] =
+{
+    // State 0
+    { 0, 1, PA_SHIFT, 3 },
+    // State 0
+    { 0, 2, PA_SHIFT, 48 },
+    // State 0
+    { 0, 3, PA_SHIFT, 354 },
+    // State 0
+    { 0, 4, PA_SHIFT, 388 },
+    // State 0
+    { 0, 5, PA_SHIFT, 422 },
+    // State 0
+    { 0, 6, PA_SHIFT, 456 },
+    // State 0
+    { 0, 7, PA_SHIFT, 490 },
+    // State 0
+    { 0, 8, PA_SHIFT, 524 },
+    // State 0
+    { 0, 9, PA_SHIFT, 558 },
+    // State 0
+    { 0, 10, PA_SHIFT, 592 },
+    // State 0
+    { 0, 11, PA_SHIFT, 626 },
+    // State 0
+    { 0, 12, PA_SHIFT, 660 },
+    // State 0
+    { 0, 13, PA_SHIFT, 82 },
+    // State 0
+    { 0, 14, PA_SHIFT, 694 },
+    // State 0
+    { 0, 15, PA_SHIFT, 728 },
+    // State 0
+    { 0, 16, PA_SHIFT, 762 },
+    // State 0
+    { 0, 17, PA_SHIFT, 796 },
+    // State 0
+    { 0, 18, PA_SHIFT, 830 },
+    // State 0
+    { 0, 19, PA_SHIFT, 864 },
+    // State 0
+    { 0, 20, PA_SHIFT, 898 },
+    // State 0
+    { 0, 21, PA_SHIFT, 932 },
+    // State 0
+    { 0, 22, PA_SHIFT, 966 },
+    // State 0
+    { 0, 23, PA_SHIFT, 1000 },
+    // State 0
+    { 0, 24, PA_SHIFT, 116 },
+    // State 0
+    { 0, 25, PA_SHIFT, 1034 },
+    // State 0
+    { 0, 26, PA_SHIFT, 1068 },
+    // State 0
+    { 0, 27, PA_SHIFT, 150 },
+    // State 0
+    { 0, 28, PA_SHIFT, 184 },
+    // State 0
+    { 0, 29, PA_SHIFT, 218 },
+    // State 0
+    { 0, 30, PA_SHIFT, 252 },
+    // State 0
+    { 0, 31, PA_SHIFT, 286 },
+    // State 0
+    { 0, 32, PA_SHIFT, 320 },
+    // State 0
+    { 0, 98, PA_SHIFT, 1102 },
+    // State 0
+    { 0, 99, PA_SHIFT, 1 },
+    // State 0
+    { 0, 100, PA_ACCEPT, 0 },
+    // State 1
+    { 1, 0, PA_REDUCE, 0 },
+    // State 1
+    { 1, 1, PA_SHIFT, 3 },
+    // State 1
+    { 1, 2, PA_SHIFT, 48 },
+    // State 1
+    { 1, 3, PA_SHIFT, 354 },
+    // State 1
+    { 1, 4, PA_SHIFT, 388 },
+    // State 1
+    { 1, 5, PA_SHIFT, 422 },
+    // State 1
+    { 1, 6, PA_SHIFT, 456 },
+    // State 1
+    { 1, 7, PA_SHIFT, 490 },
+    // State 1
+    { 1, 8, PA_SHIFT, 524 },
+    // State 1
+    { 1, 9, PA_SHIFT, 558 },
+    // State 1
+    { 1, 10, PA_SHIFT, 592 },
+    // State 1
+    { 1, 11, PA_SHIFT, 626 },
+    // State 1
+    { 1, 12, PA_SHIFT, 660 },
+    // State 1
+    { 1, 13, PA_SHIFT, 82 },
+    // State 1
+    { 1, 14, PA_SHIFT, 694 },
+    // State 1
+    { 1, 15, PA_SHIFT, 728 },
+    // State 1
+    { 1, 16, PA_SHIFT, 762 },
+    // State 1
+    { 1, 17, PA_SHIFT, 796 },
+    // State 1
+    { 1, 18, PA_SHIFT, 830 },
+    // State 1
+    { 1, 19, PA_SHIFT, 864 },
+    // State 1
+    { 1, 20, PA_SHIFT, 898 },
+    // State 1
+    { 1, 21, PA_SHIFT, 932 },
+    // State 1
+    { 1, 22, PA_SHIFT, 966 },
+    // State 1
+    { 1, 23, PA_SHIFT, 1000 },
+    // State 1
+    { 1, 24, PA_SHIFT, 116 },
+    // State 1
+    { 1, 25, PA_SHIFT, 1034 },
+    // State 1
+    { 1, 26, PA_SHIFT, 1068 },
+    // State 1
+    { 1, 27, PA_SHIFT, 150 },
+    // State 1
+    { 1, 28, PA_SHIFT, 184 },
+    // State 1
+    { 1, 29, PA_SHIFT, 218 },
+    // State 1
+    { 1, 30, PA_SHIFT, 252 },
+    // State 1
+    { 1, 31, PA_SHIFT, 286 },
+    // State 1
+    { 1, 32, PA_SHIFT, 320 },
+    // State 1
+    { 1, 98, PA_SHIFT, 2 },
+    // State 2
+    { 2, 101, PA_REDUCE, 1 },
+    // State 2 default action
+    { 2, -1, PA_REDUCE, 1 },
+    // State 3
+    { 3, 33, PA_SHIFT, 4 },
+    // State 3
+    { 3, 34, PA_SHIFT, 15 },
+    // State 3
+    { 3, 45, PA_SHIFT, 26 },
+    // State 3
+    { 3, 56, PA_SHIFT, 37 },
+    // State 4
+    { 4, 33, PA_SHIFT, 5 },
+    // State 5
+    { 5, 56, PA_SHIFT, 6 },
+    // State 6
+    { 6, 67, PA_SHIFT, 7 },
+    // State 7
+    { 7, 78, PA_SHIFT, 8 },
+    // State 8
+    { 8, 89, PA_SHIFT, 9 },
+    // State 9
+    { 9, 94, PA_SHIFT, 10 },
+    // State 10
+    { 10, 95, PA_SHIFT, 11 },
+    // State 11
+    { 11, 96, PA_SHIFT, 12 },
+    // State 12
+    { 12, 35, PA_SHIFT, 13 },
+    // State 13
+    { 13, 36, PA_SHIFT, 14 },
+    // State 14
+    { 14, 101, PA_REDUCE, 3 },
+    // State 14 default action
+    { 14, -1, PA_REDUCE, 3 },
+    // State 15
+    { 15, 33, PA_SHIFT, 16 },
+    // State 16
+    { 16, 62, PA_SHIFT, 17 },
+    // State 17
+    { 17, 63, PA_SHIFT, 18 },
+    // State 18
+    { 18, 64, PA_SHIFT, 19 },
+    // State 19
+    { 19, 65, PA_SHIFT, 20 },
+    // State 20
+    { 20, 66, PA_SHIFT, 21 },
+    // State 21
+    { 21, 68, PA_SHIFT, 22 },
+    // State 22
+    { 22, 69, PA_SHIFT, 23 },
+    // State 23
+    { 23, 70, PA_SHIFT, 24 },
+    // State 24
+    { 24, 71, PA_SHIFT, 25 },
+    // State 25
+    { 25, 101, PA_REDUCE, 35 },
+    // State 25 default action
+    { 25, -1, PA_REDUCE, 35 },
+    // State 26
+    { 26, 33, PA_SHIFT, 27 },
+    // State 27
+    { 27, 56, PA_SHIFT, 28 },
+    // State 28
+    { 28, 67, PA_SHIFT, 29 },
+    // State 29
+    { 29, 78, PA_SHIFT, 30 },
+    // State 30
+    { 30, 89, PA_SHIFT, 31 },
+    // State 31
+    { 31, 94, PA_SHIFT, 32 },
+    // State 32
+    { 32, 95, PA_SHIFT, 33 },
+    // State 33
+    { 33, 96, PA_SHIFT, 34 },
+    // State 34
+    { 34, 35, PA_SHIFT, 35 },
+    // State 35
+    { 35, 36, PA_SHIFT, 36 },
+    // State 36
+    { 36, 101, PA_REDUCE, 67 },
+    // State 36 default action
+    { 36, -1, PA_REDUCE, 67 },
+    // State 37
+    { 37, 33, PA_SHIFT, 38 },
+    // State 38
+    { 38, 62, PA_SHIFT, 39 },
+    // State 39
+    { 39, 63, PA_SHIFT, 40 },
+    // State 40
+    { 40, 64, PA_SHIFT, 41 },
+    // State 41
+    { 41, 65, PA_SHIFT, 42 },
+    // State 42
+    { 42, 66, PA_SHIFT, 43 },
+    // State 43
+    { 43, 68, PA_SHIFT, 44 },
+    // State 44
+    { 44, 69, PA_SHIFT, 45 },
+    // State 45
+    { 45, 70, PA_SHIFT, 46 },
+    // State 46
+    { 46, 71, PA_SHIFT, 47 },
+    // State 47
+    { 47, 101, PA_REDUCE, 99 },
+    // State 47 default action
+    { 47, -1, PA_REDUCE, 99 },
+    // State 48
+    { 48, 33, PA_SHIFT, 49 },
+    // State 48
+    { 48, 34, PA_SHIFT, 60 },
+    // State 48
+    { 48, 45, PA_SHIFT, 71 },
+    // State 49
+    { 49, 33, PA_SHIFT, 50 },
+    // State 50
+    { 50, 67, PA_SHIFT, 51 },
+    // State 51
+    { 51, 78, PA_SHIFT, 52 },
+    // State 52
+    { 52, 89, PA_SHIFT, 53 },
+    // State 53
+    { 53, 94, PA_SHIFT, 54 },
+    // State 54
+    { 54, 95, PA_SHIFT, 55 },
+    // State 55
+    { 55, 96, PA_SHIFT, 56 },
+    // State 56
+    { 56, 35, PA_SHIFT, 57 },
+    // State 57
+    { 57, 36, PA_SHIFT, 58 },
+    // State 58
+    { 58, 37, PA_SHIFT, 59 },
+    // State 59
+    { 59, 101, PA_REDUCE, 4 },
+    // State 59 default action
+    { 59, -1, PA_REDUCE, 4 },
+    // State 60
+    { 60, 33, PA_SHIFT, 61 },
+    // State 61
+    { 61, 63, PA_SHIFT, 62 },
+    // State 62
+    { 62, 64, PA_SHIFT, 63 },
+    // State 63
+    { 63, 65, PA_SHIFT, 64 },
+    // State 64
+    { 64, 66, PA_SHIFT, 65 },
+    // State 65
+    { 65, 68, PA_SHIFT, 66 },
+    // State 66
+    { 66, 69, PA_SHIFT, 67 },
+    // State 67
+    { 67, 70, PA_SHIFT, 68 },
+    // State 68
+    { 68, 71, PA_SHIFT, 69 },
+    // State 69
+    { 69, 72, PA_SHIFT, 70 },
+    // State 70
+    { 70, 101, PA_REDUCE, 36 },
+    // State 70 default action
+    { 70, -1, PA_REDUCE, 36 },
+    // State 71
+    { 71, 33, PA_SHIFT, 72 },
+    // State 72
+    { 72, 67, PA_SHIFT, 73 },
+    // State 73
+    { 73, 78, PA_SHIFT, 74 },
+    // State 74
+    { 74, 89, PA_SHIFT, 75 },
+    // State 75
+    { 75, 94, PA_SHIFT, 76 },
+    // State 76
+    { 76, 95, PA_SHIFT, 77 },
+    // State 77
+    { 77, 96, PA_SHIFT, 78 },
+    // State 78
+    { 78, 35, PA_SHIFT, 79 },
+    // State 79
+    { 79, 36, PA_SHIFT, 80 },
+    // State 80
+    { 80, 37, PA_SHIFT, 81 },
+    // State 81
+    { 81, 101, PA_REDUCE, 68 },
+    // State 81 default action
+    { 81, -1, PA_REDUCE, 68 },
+    // State 82
+    { 82, 33, PA_SHIFT, 83 },
+    // State 82
+    { 82, 34, PA_SHIFT, 94 },
+    // State 82
+    { 82, 45, PA_SHIFT, 105 },
+    // State 83
+    { 83, 33, PA_SHIFT, 84 },
+    // State 84
+    { 84, 78, PA_SHIFT, 85 },
+    // State 85
+    { 85, 89, PA_SHIFT, 86 },
+    // State 86
+    { 86, 94, PA_SHIFT, 87 },
+    // State 87
+    { 87, 95, PA_SHIFT, 88 },
+    // State 88
+    { 88, 96, PA_SHIFT, 89 },
+    // State 89
+    { 89, 35, PA_SHIFT, 90 },
+    // State 90
+    { 90, 36, PA_SHIFT, 91 },
+    // State 91
+    { 91, 37, PA_SHIFT, 92 },
+    // State 92
+    { 92, 38, PA_SHIFT, 93 },
+    // State 93
+    { 93, 101, PA_REDUCE, 5 },
+    // State 93 default action
+    { 93, -1, PA_REDUCE, 5 },
+    // State 94
+    { 94, 33, PA_SHIFT, 95 },
+    // State 95
+    { 95, 64, PA_SHIFT, 96 },
+    // State 96
+    { 96, 65, PA_SHIFT, 97 },
+    // State 97
+    { 97, 66, PA_SHIFT, 98 },
+    // State 98
+    { 98, 68, PA_SHIFT, 99 },
+    // State 99
+    { 99, 69, PA_SHIFT, 100 },
+    // State 100
+    { 100, 70, PA_SHIFT, 101 },
+    // State 101
+    { 101, 71, PA_SHIFT, 102 },
+    // State 102
+    { 102, 72, PA_SHIFT, 103 },
+    // State 103
+    { 103, 73, PA_SHIFT, 104 },
+    // State 104
+    { 104, 101, PA_REDUCE, 37 },
+    // State 104 default action
+    { 104, -1, PA_REDUCE, 37 },
+    // State 105
+    { 105, 33, PA_SHIFT, 106 },
+    // State 106
+    { 106, 78, PA_SHIFT, 107 },
+    // State 107
+    { 107, 89, PA_SHIFT, 108 },
+    // State 108
+    { 108, 94, PA_SHIFT, 109 },
+    // State 109
+    { 109, 95, PA_SHIFT, 110 },
+    // State 110
+    { 110, 96, PA_SHIFT, 111 },
+    // State 111
+    { 111, 35, PA_SHIFT, 112 },
+    // State 112
+    { 112, 36, PA_SHIFT, 113 },
+    // State 113
+    { 113, 37, PA_SHIFT, 114 },
+    // State 114
+    { 114, 38, PA_SHIFT, 115 },
+    // State 115
+    { 115, 101, PA_REDUCE, 69 },
+    // State 115 default action
+    { 115, -1, PA_REDUCE, 69 },
+    // State 116
+    { 116, 33, PA_SHIFT, 117 },
+    // State 116
+    { 116, 34, PA_SHIFT, 128 },
+    // State 116
+    { 116, 45, PA_SHIFT, 139 },
+    // State 117
+    { 117, 33, PA_SHIFT, 118 },
+    // State 118
+    { 118, 89, PA_SHIFT, 119 },
+    // State 119
+    { 119, 94, PA_SHIFT, 120 },
+    // State 120
+    { 120, 95, PA_SHIFT, 121 },
+    // State 121
+    { 121, 96, PA_SHIFT, 122 },
+    // State 122
+    { 122, 35, PA_SHIFT, 123 },
+    // State 123
+    { 123, 36, PA_SHIFT, 124 },
+    // State 124
+    { 124, 37, PA_SHIFT, 125 },
+    // State 125
+    { 125, 38, PA_SHIFT, 126 },
+    // State 126
+    { 126, 39, PA_SHIFT, 127 },
+    // State 127
+    { 127, 101, PA_REDUCE, 6 },
+    // State 127 default action
+    { 127, -1, PA_REDUCE, 6 },
+    // State 128
+    { 128, 33, PA_SHIFT, 129 },
+    // State 129
+    { 129, 65, PA_SHIFT, 130 },
+    // State 130
+    { 130, 66, PA_SHIFT, 131 },
+    // State 131
+    { 131, 68, PA_SHIFT, 132 },
+    // State 132
+    { 132, 69, PA_SHIFT, 133 },
+    // State 133
+    { 133, 70, PA_SHIFT, 134 },
+    // State 134
+    { 134, 71, PA_SHIFT, 135 },
+    // State 135
+    { 135, 72, PA_SHIFT, 136 },
+    // State 136
+    { 136, 73, PA_SHIFT, 137 },
+    // State 137
+    { 137, 74, PA_SHIFT, 138 },
+    // State 138
+    { 138, 101, PA_REDUCE, 38 },
+    // State 138 default action
+    { 138, -1, PA_REDUCE, 38 },
+    // State 139
+    { 139, 33, PA_SHIFT, 140 },
+    // State 140
+    { 140, 89, PA_SHIFT, 141 },
+    // State 141
+    { 141, 94, PA_SHIFT, 142 },
+    // State 142
+    { 142, 95, PA_SHIFT, 143 },
+    // State 143
+    { 143, 96, PA_SHIFT, 144 },
+    // State 144
+    { 144, 35, PA_SHIFT, 145 },
+    // State 145
+    { 145, 36, PA_SHIFT, 146 },
+    // State 146
+    { 146, 37, PA_SHIFT, 147 },
+    // State 147
+    { 147, 38, PA_SHIFT, 148 },
+    // State 148
+    { 148, 39, PA_SHIFT, 149 },
+    // State 149
+    { 149, 101, PA_REDUCE, 70 },
+    // State 149 default action
+    { 149, -1, PA_REDUCE, 70 },
+    // State 150
+    { 150, 33, PA_SHIFT, 151 },
+    // State 150
+    { 150, 34, PA_SHIFT, 162 },
+    // State 150
+    { 150, 45, PA_SHIFT, 173 },
+    // State 151
+    { 151, 33, PA_SHIFT, 152 },
+    // State 152
+    { 152, 94, PA_SHIFT, 153 },
+    // State 153
+    { 153, 95, PA_SHIFT, 154 },
+    // State 154
+    { 154, 96, PA_SHIFT, 155 },
+    // State 155
+    { 155, 35, PA_SHIFT, 156 },
+    // State 156
+    { 156, 36, PA_SHIFT, 157 },
+    // State 157
+    { 157, 37, PA_SHIFT, 158 },
+    // State 158
+    { 158, 38, PA_SHIFT, 159 },
+    // State 159
+    { 159, 39, PA_SHIFT, 160 },
+    // State 160
+    { 160, 40, PA_SHIFT, 161 },
+    // State 161
+    { 161, 101, PA_REDUCE, 7 },
+    // State 161 default action
+    { 161, -1, PA_REDUCE, 7 },
+    // State 162
+    { 162, 33, PA_SHIFT, 163 },
+    // State 163
+    { 163, 66, PA_SHIFT, 164 },
+    // State 164
+    { 164, 68, PA_SHIFT, 165 },
+    // State 165
+    { 165, 69, PA_SHIFT, 166 },
+    // State 166
+    { 166, 70, PA_SHIFT, 167 },
+    // State 167
+    { 167, 71, PA_SHIFT, 168 },
+    // State 168
+    { 168, 72, PA_SHIFT, 169 },
+    // State 169
+    { 169, 73, PA_SHIFT, 170 },
+    // State 170
+    { 170, 74, PA_SHIFT, 171 },
+    // State 171
+    { 171, 75, PA_SHIFT, 172 },
+    // State 172
+    { 172, 101, PA_REDUCE, 39 },
+    // State 172 default action
+    { 172, -1, PA_REDUCE, 39 },
+    // State 173
+    { 173, 33, PA_SHIFT, 174 },
+    // State 174
+    { 174, 94, PA_SHIFT, 175 },
+    // State 175
+    { 175, 95, PA_SHIFT, 176 },
+    // State 176
+    { 176, 96, PA_SHIFT, 177 },
+    // State 177
+    { 177, 35, PA_SHIFT, 178 },
+    // State 178
+    { 178, 36, PA_SHIFT, 179 },
+    // State 179
+    { 179, 37, PA_SHIFT, 180 },
+    // State 180
+    { 180, 38, PA_SHIFT, 181 },
+    // State 181
+    { 181, 39, PA_SHIFT, 182 },
+    // State 182
+    { 182, 40, PA_SHIFT, 183 },
+    // State 183
+    { 183, 101, PA_REDUCE, 71 },
+    // State 183 default action
+    { 183, -1, PA_REDUCE, 71 },
+    // State 184
+    { 184, 33, PA_SHIFT, 185 },
+    // State 184
+    { 184, 34, PA_SHIFT, 196 },
+    // State 184
+    { 184, 45, PA_SHIFT, 207 },
+    // State 185
+    { 185, 33, PA_SHIFT, 186 },
+    // State 186
+    { 186, 95, PA_SHIFT, 187 },
+    // State 187
+    { 187, 96, PA_SHIFT, 188 },
+    // State 188
+    { 188, 35, PA_SHIFT, 189 },
+    // State 189
+    { 189, 36, PA_SHIFT, 190 },
+    // State 190
+    { 190, 37, PA_SHIFT, 191 },
+    // State 191
+    { 191, 38, PA_SHIFT, 192 },
+    // State 192
+    { 192, 39, PA_SHIFT, 193 },
+    // State 193
+    { 193, 40, PA_SHIFT, 194 },
+    // State 194
+    { 194, 41, PA_SHIFT, 195 },
+    // State 195
+    { 195, 101, PA_REDUCE, 8 },
+    // State 195 default action
+    { 195, -1, PA_REDUCE, 8 },
+    // State 196
+    { 196, 33, PA_SHIFT, 197 },
+    // State 197
+    { 197, 68, PA_SHIFT, 198 },
+    // State 198
+    { 198, 69, PA_SHIFT, 199 },
+    // State 199
+    { 199, 70, PA_SHIFT, 200 },
+    // State 200
+    { 200, 71, PA_SHIFT, 201 },
+    // State 201
+    { 201, 72, PA_SHIFT, 202 },
+    // State 202
+    { 202, 73, PA_SHIFT, 203 },
+    // State 203
+    { 203, 74, PA_SHIFT, 204 },
+    // State 204
+    { 204, 75, PA_SHIFT, 205 },
+    // State 205
+    { 205, 76, PA_SHIFT, 206 },
+    // State 206
+    { 206, 101, PA_REDUCE, 40 },
+    // State 206 default action
+    { 206, -1, PA_REDUCE, 40 },
+    // State 207
+    { 207, 33, PA_SHIFT, 208 },
+    // State 208
+    { 208, 95, PA_SHIFT, 209 },
+    // State 209
+    { 209, 96, PA_SHIFT, 210 },
+    // State 210
+    { 210, 35, PA_SHIFT, 211 },
+    // State 211
+    { 211, 36, PA_SHIFT, 212 },
+    // State 212
+    { 212, 37, PA_SHIFT, 213 },
+    // State 213
+    { 213, 38, PA_SHIFT, 214 },
+    // State 214
+    { 214, 39, PA_SHIFT, 215 },
+    // State 215
+    { 215, 40, PA_SHIFT, 216 },
+    // State 216
+    { 216, 41, PA_SHIFT, 217 },
+    // State 217
+    { 217, 101, PA_REDUCE, 72 },
+    // State 217 default action
+    { 217, -1, PA_REDUCE, 72 },
+    // State 218
+    { 218, 33, PA_SHIFT, 219 },
+    // State 218
+    { 218, 34, PA_SHIFT, 230 },
+    // State 218
+    { 218, 45, PA_SHIFT, 241 },
+    // State 219
+    { 219, 33, PA_SHIFT, 220 },
+    // State 220
+    { 220, 96, PA_SHIFT, 221 },
+    // State 221
+    { 221, 35, PA_SHIFT, 222 },
+    // State 222
+    { 222, 36, PA_SHIFT, 223 },
+    // State 223
+    { 223, 37, PA_SHIFT, 224 },
+    // State 224
+    { 224, 38, PA_SHIFT, 225 },
+    // State 225
+    { 225, 39, PA_SHIFT, 226 },
+    // State 226
+    { 226, 40, PA_SHIFT, 227 },
+    // State 227
+    { 227, 41, PA_SHIFT, 228 },
+    // State 228
+    { 228, 42, PA_SHIFT, 229 },
+    // State 229
+    { 229, 101, PA_REDUCE, 9 },
+    // State 229 default action
+    { 229, -1, PA_REDUCE, 9 },
+    // State 230
+    { 230, 33, PA_SHIFT, 231 },
+    // State 231
+    { 231, 69, PA_SHIFT, 232 },
+    // State 232
+    { 232, 70, PA_SHIFT, 233 },
+    // State 233
+    { 233, 71, PA_SHIFT, 234 },
+    // State 234
+    { 234, 72, PA_SHIFT, 235 },
+    // State 235
+    { 235, 73, PA_SHIFT, 236 },
+    // State 236
+    { 236, 74, PA_SHIFT, 237 },
+    // State 237
+    { 237, 75, PA_SHIFT, 238 },
+    // State 238
+    { 238, 76, PA_SHIFT, 239 },
+    // State 239
+    { 239, 77, PA_SHIFT, 240 },
+    // State 240
+    { 240, 101, PA_REDUCE, 41 },
+    // State 240 default action
+    { 240, -1, PA_REDUCE, 41 },
+    // State 241
+    { 241, 33, PA_SHIFT, 242 },
+    // State 242
+    { 242, 96, PA_SHIFT, 243 },
+    // State 243
+    { 243, 35, PA_SHIFT, 244 },
+    // State 244
+    { 244, 36, PA_SHIFT, 245 },
+    // State 245
+    { 245, 37, PA_SHIFT, 246 },
+    // State 246
+    { 246, 38, PA_SHIFT, 247 },
+    // State 247
+    { 247, 39, PA_SHIFT, 248 },
+    // State 248
+    { 248, 40, PA_SHIFT, 249 },
+    // State 249
+    { 249, 41, PA_SHIFT, 250 },
+    // State 250
+    { 250, 42, PA_SHIFT, 251 },
+    // State 251
+    { 251, 101, PA_REDUCE, 73 },
+    // State 251 default action
+    { 251, -1, PA_REDUCE, 73 },
+    // State 252
+    { 252, 33, PA_SHIFT, 253 },
+    // State 252
+    { 252, 34, PA_SHIFT, 264 },
+    // State 252
+    { 252, 45, PA_SHIFT, 275 },
+    // State 253
+    { 253, 33, PA_SHIFT, 254 },
+    // State 254
+    { 254, 35, PA_SHIFT, 255 },
+    // State 255
+    { 255, 36, PA_SHIFT, 256 },
+    // State 256
+    { 256, 37, PA_SHIFT, 257 },
+    // State 257
+    { 257, 38, PA_SHIFT, 258 },
+    // State 258
+    { 258, 39, PA_SHIFT, 259 },
+    // State 259
+    { 259, 40, PA_SHIFT, 260 },
+    // State 260
+    { 260, 41, PA_SHIFT, 261 },
+    // State 261
+    { 261, 42, PA_SHIFT, 262 },
+    // State 262
+    { 262, 43, PA_SHIFT, 263 },
+    // State 263
+    { 263, 101, PA_REDUCE, 10 },
+    // State 263 default action
+    { 263, -1, PA_REDUCE, 10 },
+    // State 264
+    { 264, 33, PA_SHIFT, 265 },
+    // State 265
+    { 265, 70, PA_SHIFT, 266 },
+    // State 266
+    { 266, 71, PA_SHIFT, 267 },
+    // State 267
+    { 267, 72, PA_SHIFT, 268 },
+    // State 268
+    { 268, 73, PA_SHIFT, 269 },
+    // State 269
+    { 269, 74, PA_SHIFT, 270 },
+    // State 270
+    { 270, 75, PA_SHIFT, 271 },
+    // State 271
+    { 271, 76, PA_SHIFT, 272 },
+    // State 272
+    { 272, 77, PA_SHIFT, 273 },
+    // State 273
+    { 273, 79, PA_SHIFT, 274 },
+    // State 274
+    { 274, 101, PA_REDUCE, 42 },
+    // State 274 default action
+    { 274, -1, PA_REDUCE, 42 },
+    // State 275
+    { 275, 33, PA_SHIFT, 276 },
+    // State 276
+    { 276, 35, PA_SHIFT, 277 },
+    // State 277
+    { 277, 36, PA_SHIFT, 278 },
+    // State 278
+    { 278, 37, PA_SHIFT, 279 },
+    // State 279
+    { 279, 38, PA_SHIFT, 280 },
+    // State 280
+    { 280, 39, PA_SHIFT, 281 },
+    // State 281
+    { 281, 40, PA_SHIFT, 282 },
+    // State 282
+    { 282, 41, PA_SHIFT, 283 },
+    // State 283
+    { 283, 42, PA_SHIFT, 284 },
+    // State 284
+    { 284, 43, PA_SHIFT, 285 },
+    // State 285
+    { 285, 101, PA_REDUCE, 74 },
+    // State 285 default action
+    { 285, -1, PA_REDUCE, 74 },
+    // State 286
+    { 286, 33, PA_SHIFT, 287 },
+    // State 286
+    { 286, 34, PA_SHIFT, 298 },
+    // State 286
+    { 286, 45, PA_SHIFT, 309 },
+    // State 287
+    { 287, 33, PA_SHIFT, 288 },
+    // State 288
+    { 288, 36, PA_SHIFT, 289 },
+    // State 289
+    { 289, 37, PA_SHIFT, 290 },
+    // State 290
+    { 290, 38, PA_SHIFT, 291 },
+    // State 291
+    { 291, 39, PA_SHIFT, 292 },
+    // State 292
+    { 292, 40, PA_SHIFT, 293 },
+    // State 293
+    { 293, 41, PA_SHIFT, 294 },
+    // State 294
+    { 294, 42, PA_SHIFT, 295 },
+    // State 295
+    { 295, 43, PA_SHIFT, 296 },
+    // State 296
+    { 296, 44, PA_SHIFT, 297 },
+    // State 297
+    { 297, 101, PA_REDUCE, 11 },
+    // State 297 default action
+    { 297, -1, PA_REDUCE, 11 },
+    // State 298
+    { 298, 33, PA_SHIFT, 299 },
+    // State 299
+    { 299, 71, PA_SHIFT, 300 },
+    // State 300
+    { 300, 72, PA_SHIFT, 301 },
+    // State 301
+    { 301, 73, PA_SHIFT, 302 },
+    // State 302
+    { 302, 74, PA_SHIFT, 303 },
+    // State 303
+    { 303, 75, PA_SHIFT, 304 },
+    // State 304
+    { 304, 76, PA_SHIFT, 305 },
+    // State 305
+    { 305, 77, PA_SHIFT, 306 },
+    // State 306
+    { 306, 79, PA_SHIFT, 307 },
+    // State 307
+    { 307, 80, PA_SHIFT, 308 },
+    // State 308
+    { 308, 101, PA_REDUCE, 43 },
+    // State 308 default action
+    { 308, -1, PA_REDUCE, 43 },
+    // State 309
+    { 309, 33, PA_SHIFT, 310 },
+    // State 310
+    { 310, 36, PA_SHIFT, 311 },
+    // State 311
+    { 311, 37, PA_SHIFT, 312 },
+    // State 312
+    { 312, 38, PA_SHIFT, 313 },
+    // State 313
+    { 313, 39, PA_SHIFT, 314 },
+    // State 314
+    { 314, 40, PA_SHIFT, 315 },
+    // State 315
+    { 315, 41, PA_SHIFT, 316 },
+    // State 316
+    { 316, 42, PA_SHIFT, 317 },
+    // State 317
+    { 317, 43, PA_SHIFT, 318 },
+    // State 318
+    { 318, 44, PA_SHIFT, 319 },
+    // State 319
+    { 319, 101, PA_REDUCE, 75 },
+    // State 319 default action
+    { 319, -1, PA_REDUCE, 75 },
+    // State 320
+    { 320, 33, PA_SHIFT, 321 },
+    // State 320
+    { 320, 34, PA_SHIFT, 332 },
+    // State 320
+    { 320, 45, PA_SHIFT, 343 },
+    // State 321
+    { 321, 33, PA_SHIFT, 322 },
+    // State 322
+    { 322, 37, PA_SHIFT, 323 },
+    // State 323
+    { 323, 38, PA_SHIFT, 324 },
+    // State 324
+    { 324, 39, PA_SHIFT, 325 },
+    // State 325
+    { 325, 40, PA_SHIFT, 326 },
+    // State 326
+    { 326, 41, PA_SHIFT, 327 },
+    // State 327
+    { 327, 42, PA_SHIFT, 328 },
+    // State 328
+    { 328, 43, PA_SHIFT, 329 },
+    // State 329
+    { 329, 44, PA_SHIFT, 330 },
+    // State 330
+    { 330, 46, PA_SHIFT, 331 },
+    // State 331
+    { 331, 101, PA_REDUCE, 12 },
+    // State 331 default action
+    { 331, -1, PA_REDUCE, 12 },
+    // State 332
+    { 332, 33, PA_SHIFT, 333 },
+    // State 333
+    { 333, 72, PA_SHIFT, 334 },
+    // State 334
+    { 334, 73, PA_SHIFT, 335 },
+    // State 335
+    { 335, 74, PA_SHIFT, 336 },
+    // State 336
+    { 336, 75, PA_SHIFT, 337 },
+    // State 337
+    { 337, 76, PA_SHIFT, 338 },
+    // State 338
+    { 338, 77, PA_SHIFT, 339 },
+    // State 339
+    { 339, 79, PA_SHIFT, 340 },
+    // State 340
+    { 340, 80, PA_SHIFT, 341 },
+    // State 341
+    { 341, 81, PA_SHIFT, 342 },
+    // State 342
+    { 342, 101, PA_REDUCE, 44 },
+    // State 342 default action
+    { 342, -1, PA_REDUCE, 44 },
+    // State 343
+    { 343, 33, PA_SHIFT, 344 },
+    // State 344
+    { 344, 37, PA_SHIFT, 345 },
+    // State 345
+    { 345, 38, PA_SHIFT, 346 },
+    // State 346
+    { 346, 39, PA_SHIFT, 347 },
+    // State 347
+    { 347, 40, PA_SHIFT, 348 },
+    // State 348
+    { 348, 41, PA_SHIFT, 349 },
+    // State 349
+    { 349, 42, PA_SHIFT, 350 },
+    // State 350
+    { 350, 43, PA_SHIFT, 351 },
+    // State 351
+    { 351, 44, PA_SHIFT, 352 },
+    // State 352
+    { 352, 46, PA_SHIFT, 353 },
+    // State 353
+    { 353, 101, PA_REDUCE, 76 },
+    // State 353 default action
+    { 353, -1, PA_REDUCE, 76 },
+    // State 354
+    { 354, 33, PA_SHIFT, 355 },
+    // State 354
+    { 354, 34, PA_SHIFT, 366 },
+    // State 354
+    { 354, 45, PA_SHIFT, 377 },
+    // State 355
+    { 355, 33, PA_SHIFT, 356 },
+    // State 356
+    { 356, 38, PA_SHIFT, 357 },
+    // State 357
+    { 357, 39, PA_SHIFT, 358 },
+    // State 358
+    { 358, 40, PA_SHIFT, 359 },
+    // State 359
+    { 359, 41, PA_SHIFT, 360 },
+    // State 360
+    { 360, 42, PA_SHIFT, 361 },
+    // State 361
+    { 361, 43, PA_SHIFT, 362 },
+    // State 362
+    { 362, 44, PA_SHIFT, 363 },
+    // State 363
+    { 363, 46, PA_SHIFT, 364 },
+    // State 364
+    { 364, 47, PA_SHIFT, 365 },
+    // State 365
+    { 365, 101, PA_REDUCE, 13 },
+    // State 365 default action
+    { 365, -1, PA_REDUCE, 13 },
+    // State 366
+    { 366, 33, PA_SHIFT, 367 },
+    // State 367
+    { 367, 73, PA_SHIFT, 368 },
+    // State 368
+    { 368, 74, PA_SHIFT, 369 },
+    // State 369
+    { 369, 75, PA_SHIFT, 370 },
+    // State 370
+    { 370, 76, PA_SHIFT, 371 },
+    // State 371
+    { 371, 77, PA_SHIFT, 372 },
+    // State 372
+    { 372, 79, PA_SHIFT, 373 },
+    // State 373
+    { 373, 80, PA_SHIFT, 374 },
+    // State 374
+    { 374, 81, PA_SHIFT, 375 },
+    // State 375
+    { 375, 82, PA_SHIFT, 376 },
+    // State 376
+    { 376, 101, PA_REDUCE, 45 },
+    // State 376 default action
+    { 376, -1, PA_REDUCE, 45 },
+    // State 377
+    { 377, 33, PA_SHIFT, 378 },
+    // State 378
+    { 378, 38, PA_SHIFT, 379 },
+    // State 379
+    { 379, 39, PA_SHIFT, 380 },
+    // State 380
+    { 380, 40, PA_SHIFT, 381 },
+    // State 381
+    { 381, 41, PA_SHIFT, 382 },
+    // State 382
+    { 382, 42, PA_SHIFT, 383 },
+    // State 383
+    { 383, 43, PA_SHIFT, 384 },
+    // State 384
+    { 384, 44, PA_SHIFT, 385 },
+    // State 385
+    { 385, 46, PA_SHIFT, 386 },
+    // State 386
+    { 386, 47, PA_SHIFT, 387 },
+    // State 387
+    { 387, 101, PA_REDUCE, 77 },
+    // State 387 default action
+    { 387, -1, PA_REDUCE, 77 },
+    // State 388
+    { 388, 33, PA_SHIFT, 389 },
+    // State 388
+    { 388, 34, PA_SHIFT, 400 },
+    // State 388
+    { 388, 45, PA_SHIFT, 411 },
+    // State 389
+    { 389, 33, PA_SHIFT, 390 },
+    // State 390
+    { 390, 39, PA_SHIFT, 391 },
+    // State 391
+    { 391, 40, PA_SHIFT, 392 },
+    // State 392
+    { 392, 41, PA_SHIFT, 393 },
+    // State 393
+    { 393, 42, PA_SHIFT, 394 },
+    // State 394
+    { 394, 43, PA_SHIFT, 395 },
+    // State 395
+    { 395, 44, PA_SHIFT, 396 },
+    // State 396
+    { 396, 46, PA_SHIFT, 397 },
+    // State 397
+    { 397, 47, PA_SHIFT, 398 },
+    // State 398
+    { 398, 48, PA_SHIFT, 399 },
+    // State 399
+    { 399, 101, PA_REDUCE, 14 },
+    // State 399 default action
+    { 399, -1, PA_REDUCE, 14 },
+    // State 400
+    { 400, 33, PA_SHIFT, 401 },
+    // State 401
+    { 401, 74, PA_SHIFT, 402 },
+    // State 402
+    { 402, 75, PA_SHIFT, 403 },
+    // State 403
+    { 403, 76, PA_SHIFT, 404 },
+    // State 404
+    { 404, 77, PA_SHIFT, 405 },
+    // State 405
+    { 405, 79, PA_SHIFT, 406 },
+    // State 406
+    { 406, 80, PA_SHIFT, 407 },
+    // State 407
+    { 407, 81, PA_SHIFT, 408 },
+    // State 408
+    { 408, 82, PA_SHIFT, 409 },
+    // State 409
+    { 409, 83, PA_SHIFT, 410 },
+    // State 410
+    { 410, 101, PA_REDUCE, 46 },
+    // State 410 default action
+    { 410, -1, PA_REDUCE, 46 },
+    // State 411
+    { 411, 33, PA_SHIFT, 412 },
+    // State 412
+    { 412, 39, PA_SHIFT, 413 },
+    // State 413
+    { 413, 40, PA_SHIFT, 414 },
+    // State 414
+    { 414, 41, PA_SHIFT, 415 },
+    // State 415
+    { 415, 42, PA_SHIFT, 416 },
+    // State 416
+    { 416, 43, PA_SHIFT, 417 },
+    // State 417
+    { 417, 44, PA_SHIFT, 418 },
+    // State 418
+    { 418, 46, PA_SHIFT, 419 },
+    // State 419
+    { 419, 47, PA_SHIFT, 420 },
+    // State 420
+    { 420, 48, PA_SHIFT, 421 },
+    // State 421
+    { 421, 101, PA_REDUCE, 78 },
+    // State 421 default action
+    { 421, -1, PA_REDUCE, 78 },
+    // State 422
+    { 422, 33, PA_SHIFT, 423 },
+    // State 422
+    { 422, 34, PA_SHIFT, 434 },
+    // State 422
+    { 422, 45, PA_SHIFT, 445 },
+    // State 423
+    { 423, 33, PA_SHIFT, 424 },
+    // State 424
+    { 424, 40, PA_SHIFT, 425 },
+    // State 425
+    { 425, 41, PA_SHIFT, 426 },
+    // State 426
+    { 426, 42, PA_SHIFT, 427 },
+    // State 427
+    { 427, 43, PA_SHIFT, 428 },
+    // State 428
+    { 428, 44, PA_SHIFT, 429 },
+    // State 429
+    { 429, 46, PA_SHIFT, 430 },
+    // State 430
+    { 430, 47, PA_SHIFT, 431 },
+    // State 431
+    { 431, 48, PA_SHIFT, 432 },
+    // State 432
+    { 432, 49, PA_SHIFT, 433 },
+    // State 433
+    { 433, 101, PA_REDUCE, 15 },
+    // State 433 default action
+    { 433, -1, PA_REDUCE, 15 },
+    // State 434
+    { 434, 33, PA_SHIFT, 435 },
+    // State 435
+    { 435, 75, PA_SHIFT, 436 },
+    // State 436
+    { 436, 76, PA_SHIFT, 437 },
+    // State 437
+    { 437, 77, PA_SHIFT, 438 },
+    // State 438
+    { 438, 79, PA_SHIFT, 439 },
+    // State 439
+    { 439, 80, PA_SHIFT, 440 },
+    // State 440
+    { 440, 81, PA_SHIFT, 441 },
+    // State 441
+    { 441, 82, PA_SHIFT, 442 },
+    // State 442
+    { 442, 83, PA_SHIFT, 443 },
+    // State 443
+    { 443, 84, PA_SHIFT, 444 },
+    // State 444
+    { 444, 101, PA_REDUCE, 47 },
+    // State 444 default action
+    { 444, -1, PA_REDUCE, 47 },
+    // State 445
+    { 445, 33, PA_SHIFT, 446 },
+    // State 446
+    { 446, 40, PA_SHIFT, 447 },
+    // State 447
+    { 447, 41, PA_SHIFT, 448 },
+    // State 448
+    { 448, 42, PA_SHIFT, 449 },
+    // State 449
+    { 449, 43, PA_SHIFT, 450 },
+    // State 450
+    { 450, 44, PA_SHIFT, 451 },
+    // State 451
+    { 451, 46, PA_SHIFT, 452 },
+    // State 452
+    { 452, 47, PA_SHIFT, 453 },
+    // State 453
+    { 453, 48, PA_SHIFT, 454 },
+    // State 454
+    { 454, 49, PA_SHIFT, 455 },
+    // State 455
+    { 455, 101, PA_REDUCE, 79 },
+    // State 455 default action
+    { 455, -1, PA_REDUCE, 79 },
+    // State 456
+    { 456, 33, PA_SHIFT, 457 },
+    // State 456
+    { 456, 34, PA_SHIFT, 468 },
+    // State 456
+    { 456, 45, PA_SHIFT, 479 },
+    // State 457
+    { 457, 33, PA_SHIFT, 458 },
+    // State 458
+    { 458, 41, PA_SHIFT, 459 },
+    // State 459
+    { 459, 42, PA_SHIFT, 460 },
+    // State 460
+    { 460, 43, PA_SHIFT, 461 },
+    // State 461
+    { 461, 44, PA_SHIFT, 462 },
+    // State 462
+    { 462, 46, PA_SHIFT, 463 },
+    // State 463
+    { 463, 47, PA_SHIFT, 464 },
+    // State 464
+    { 464, 48, PA_SHIFT, 465 },
+    // State 465
+    { 465, 49, PA_SHIFT, 466 },
+    // State 466
+    { 466, 50, PA_SHIFT, 467 },
+    // State 467
+    { 467, 101, PA_REDUCE, 16 },
+    // State 467 default action
+    { 467, -1, PA_REDUCE, 16 },
+    // State 468
+    { 468, 33, PA_SHIFT, 469 },
+    // State 469
+    { 469, 76, PA_SHIFT, 470 },
+    // State 470
+    { 470, 77, PA_SHIFT, 471 },
+    // State 471
+    { 471, 79, PA_SHIFT, 472 },
+    // State 472
+    { 472, 80, PA_SHIFT, 473 },
+    // State 473
+    { 473, 81, PA_SHIFT, 474 },
+    // State 474
+    { 474, 82, PA_SHIFT, 475 },
+    // State 475
+    { 475, 83, PA_SHIFT, 476 },
+    // State 476
+    { 476, 84, PA_SHIFT, 477 },
+    // State 477
+    { 477, 85, PA_SHIFT, 478 },
+    // State 478
+    { 478, 101, PA_REDUCE, 48 },
+    // State 478 default action
+    { 478, -1, PA_REDUCE, 48 },
+    // State 479
+    { 479, 33, PA_SHIFT, 480 },
+    // State 480
+    { 480, 41, PA_SHIFT, 481 },
+    // State 481
+    { 481, 42, PA_SHIFT, 482 },
+    // State 482
+    { 482, 43, PA_SHIFT, 483 },
+    // State 483
+    { 483, 44, PA_SHIFT, 484 },
+    // State 484
+    { 484, 46, PA_SHIFT, 485 },
+    // State 485
+    { 485, 47, PA_SHIFT, 486 },
+    // State 486
+    { 486, 48, PA_SHIFT, 487 },
+    // State 487
+    { 487, 49, PA_SHIFT, 488 },
+    // State 488
+    { 488, 50, PA_SHIFT, 489 },
+    // State 489
+    { 489, 101, PA_REDUCE, 80 },
+    // State 489 default action
+    { 489, -1, PA_REDUCE, 80 },
+    // State 490
+    { 490, 33, PA_SHIFT, 491 },
+    // State 490
+    { 490, 34, PA_SHIFT, 502 },
+    // State 490
+    { 490, 45, PA_SHIFT, 513 },
+    // State 491
+    { 491, 33, PA_SHIFT, 492 },
+    // State 492
+    { 492, 42, PA_SHIFT, 493 },
+    // State 493
+    { 493, 43, PA_SHIFT, 494 },
+    // State 494
+    { 494, 44, PA_SHIFT, 495 },
+    // State 495
+    { 495, 46, PA_SHIFT, 496 },
+    // State 496
+    { 496, 47, PA_SHIFT, 497 },
+    // State 497
+    { 497, 48, PA_SHIFT, 498 },
+    // State 498
+    { 498, 49, PA_SHIFT, 499 },
+    // State 499
+    { 499, 50, PA_SHIFT, 500 },
+    // State 500
+    { 500, 51, PA_SHIFT, 501 },
+    // State 501
+    { 501, 101, PA_REDUCE, 17 },
+    // State 501 default action
+    { 501, -1, PA_REDUCE, 17 },
+    // State 502
+    { 502, 33, PA_SHIFT, 503 },
+    // State 503
+    { 503, 77, PA_SHIFT, 504 },
+    // State 504
+    { 504, 79, PA_SHIFT, 505 },
+    // State 505
+    { 505, 80, PA_SHIFT, 506 },
+    // State 506
+    { 506, 81, PA_SHIFT, 507 },
+    // State 507
+    { 507, 82, PA_SHIFT, 508 },
+    // State 508
+    { 508, 83, PA_SHIFT, 509 },
+    // State 509
+    { 509, 84, PA_SHIFT, 510 },
+    // State 510
+    { 510, 85, PA_SHIFT, 511 },
+    // State 511
+    { 511, 86, PA_SHIFT, 512 },
+    // State 512
+    { 512, 101, PA_REDUCE, 49 },
+    // State 512 default action
+    { 512, -1, PA_REDUCE, 49 },
+    // State 513
+    { 513, 33, PA_SHIFT, 514 },
+    // State 514
+    { 514, 42, PA_SHIFT, 515 },
+    // State 515
+    { 515, 43, PA_SHIFT, 516 },
+    // State 516
+    { 516, 44, PA_SHIFT, 517 },
+    // State 517
+    { 517, 46, PA_SHIFT, 518 },
+    // State 518
+    { 518, 47, PA_SHIFT, 519 },
+    // State 519
+    { 519, 48, PA_SHIFT, 520 },
+    // State 520
+    { 520, 49, PA_SHIFT, 521 },
+    // State 521
+    { 521, 50, PA_SHIFT, 522 },
+    // State 522
+    { 522, 51, PA_SHIFT, 523 },
+    // State 523
+    { 523, 101, PA_REDUCE, 81 },
+    // State 523 default action
+    { 523, -1, PA_REDUCE, 81 },
+    // State 524
+    { 524, 33, PA_SHIFT, 525 },
+    // State 524
+    { 524, 34, PA_SHIFT, 536 },
+    // State 524
+    { 524, 45, PA_SHIFT, 547 },
+    // State 525
+    { 525, 33, PA_SHIFT, 526 },
+    // State 526
+    { 526, 43, PA_SHIFT, 527 },
+    // State 527
+    { 527, 44, PA_SHIFT, 528 },
+    // State 528
+    { 528, 46, PA_SHIFT, 529 },
+    // State 529
+    { 529, 47, PA_SHIFT, 530 },
+    // State 530
+    { 530, 48, PA_SHIFT, 531 },
+    // State 531
+    { 531, 49, PA_SHIFT, 532 },
+    // State 532
+    { 532, 50, PA_SHIFT, 533 },
+    // State 533
+    { 533, 51, PA_SHIFT, 534 },
+    // State 534
+    { 534, 52, PA_SHIFT, 535 },
+    // State 535
+    { 535, 101, PA_REDUCE, 18 },
+    // State 535 default action
+    { 535, -1, PA_REDUCE, 18 },
+    // State 536
+    { 536, 33, PA_SHIFT, 537 },
+    // State 537
+    { 537, 79, PA_SHIFT, 538 },
+    // State 538
+    { 538, 80, PA_SHIFT, 539 },
+    // State 539
+    { 539, 81, PA_SHIFT, 540 },
+    // State 540
+    { 540, 82, PA_SHIFT, 541 },
+    // State 541
+    { 541, 83, PA_SHIFT, 542 },
+    // State 542
+    { 542, 84, PA_SHIFT, 543 },
+    // State 543
+    { 543, 85, PA_SHIFT, 544 },
+    // State 544
+    { 544, 86, PA_SHIFT, 545 },
+    // State 545
+    { 545, 87, PA_SHIFT, 546 },
+    // State 546
+    { 546, 101, PA_REDUCE, 50 },
+    // State 546 default action
+    { 546, -1, PA_REDUCE, 50 },
+    // State 547
+    { 547, 33, PA_SHIFT, 548 },
+    // State 548
+    { 548, 43, PA_SHIFT, 549 },
+    // State 549
+    { 549, 44, PA_SHIFT, 550 },
+    // State 550
+    { 550, 46, PA_SHIFT, 551 },
+    // State 551
+    { 551, 47, PA_SHIFT, 552 },
+    // State 552
+    { 552, 48, PA_SHIFT, 553 },
+    // State 553
+    { 553, 49, PA_SHIFT, 554 },
+    // State 554
+    { 554, 50, PA_SHIFT, 555 },
+    // State 555
+    { 555, 51, PA_SHIFT, 556 },
+    // State 556
+    { 556, 52, PA_SHIFT, 557 },
+    // State 557
+    { 557, 101, PA_REDUCE, 82 },
+    // State 557 default action
+    { 557, -1, PA_REDUCE, 82 },
+    // State 558
+    { 558, 33, PA_SHIFT, 559 },
+    // State 558
+    { 558, 34, PA_SHIFT, 570 },
+    // State 558
+    { 558, 45, PA_SHIFT, 581 },
+    // State 559
+    { 559, 33, PA_SHIFT, 560 },
+    // State 560
+    { 560, 44, PA_SHIFT, 561 },
+    // State 561
+    { 561, 46, PA_SHIFT, 562 },
+    // State 562
+    { 562, 47, PA_SHIFT, 563 },
+    // State 563
+    { 563, 48, PA_SHIFT, 564 },
+    // State 564
+    { 564, 49, PA_SHIFT, 565 },
+    // State 565
+    { 565, 50, PA_SHIFT, 566 },
+    // State 566
+    { 566, 51, PA_SHIFT, 567 },
+    // State 567
+    { 567, 52, PA_SHIFT, 568 },
+    // State 568
+    { 568, 53, PA_SHIFT, 569 },
+    // State 569
+    { 569, 101, PA_REDUCE, 19 },
+    // State 569 default action
+    { 569, -1, PA_REDUCE, 19 },
+    // State 570
+    { 570, 33, PA_SHIFT, 571 },
+    // State 571
+    { 571, 80, PA_SHIFT, 572 },
+    // State 572
+    { 572, 81, PA_SHIFT, 573 },
+    // State 573
+    { 573, 82, PA_SHIFT, 574 },
+    // State 574
+    { 574, 83, PA_SHIFT, 575 },
+    // State 575
+    { 575, 84, PA_SHIFT, 576 },
+    // State 576
+    { 576, 85, PA_SHIFT, 577 },
+    // State 577
+    { 577, 86, PA_SHIFT, 578 },
+    // State 578
+    { 578, 87, PA_SHIFT, 579 },
+    // State 579
+    { 579, 88, PA_SHIFT, 580 },
+    // State 580
+    { 580, 101, PA_REDUCE, 51 },
+    // State 580 default action
+    { 580, -1, PA_REDUCE, 51 },
+    // State 581
+    { 581, 33, PA_SHIFT, 582 },
+    // State 582
+    { 582, 44, PA_SHIFT, 583 },
+    // State 583
+    { 583, 46, PA_SHIFT, 584 },
+    // State 584
+    { 584, 47, PA_SHIFT, 585 },
+    // State 585
+    { 585, 48, PA_SHIFT, 586 },
+    // State 586
+    { 586, 49, PA_SHIFT, 587 },
+    // State 587
+    { 587, 50, PA_SHIFT, 588 },
+    // State 588
+    { 588, 51, PA_SHIFT, 589 },
+    // State 589
+    { 589, 52, PA_SHIFT, 590 },
+    // State 590
+    { 590, 53, PA_SHIFT, 591 },
+    // State 591
+    { 591, 101, PA_REDUCE, 83 },
+    // State 591 default action
+    { 591, -1, PA_REDUCE, 83 },
+    // State 592
+    { 592, 33, PA_SHIFT, 593 },
+    // State 592
+    { 592, 34, PA_SHIFT, 604 },
+    // State 592
+    { 592, 45, PA_SHIFT, 615 },
+    // State 593
+    { 593, 33, PA_SHIFT, 594 },
+    // State 594
+    { 594, 46, PA_SHIFT, 595 },
+    // State 595
+    { 595, 47, PA_SHIFT, 596 },
+    // State 596
+    { 596, 48, PA_SHIFT, 597 },
+    // State 597
+    { 597, 49, PA_SHIFT, 598 },
+    // State 598
+    { 598, 50, PA_SHIFT, 599 },
+    // State 599
+    { 599, 51, PA_SHIFT, 600 },
+    // State 600
+    { 600, 52, PA_SHIFT, 601 },
+    // State 601
+    { 601, 53, PA_SHIFT, 602 },
+    // State 602
+    { 602, 54, PA_SHIFT, 603 },
+    // State 603
+    { 603, 101, PA_REDUCE, 20 },
+    // State 603 default action
+    { 603, -1, PA_REDUCE, 20 },
+    // State 604
+    { 604, 33, PA_SHIFT, 605 },
+    // State 605
+    { 605, 81, PA_SHIFT, 606 },
+    // State 606
+    { 606, 82, PA_SHIFT, 607 },
+    // State 607
+    { 607, 83, PA_SHIFT, 608 },
+    // State 608
+    { 608, 84, PA_SHIFT, 609 },
+    // State 609
+    { 609, 85, PA_SHIFT, 610 },
+    // State 610
+    { 610, 86, PA_SHIFT, 611 },
+    // State 611
+    { 611, 87, PA_SHIFT, 612 },
+    // State 612
+    { 612, 88, PA_SHIFT, 613 },
+    // State 613
+    { 613, 90, PA_SHIFT, 614 },
+    // State 614
+    { 614, 101, PA_REDUCE, 52 },
+    // State 614 default action
+    { 614, -1, PA_REDUCE, 52 },
+    // State 615
+    { 615, 33, PA_SHIFT, 616 },
+    // State 616
+    { 616, 46, PA_SHIFT, 617 },
+    // State 617
+    { 617, 47, PA_SHIFT, 618 },
+    // State 618
+    { 618, 48, PA_SHIFT, 619 },
+    // State 619
+    { 619, 49, PA_SHIFT, 620 },
+    // State 620
+    { 620, 50, PA_SHIFT, 621 },
+    // State 621
+    { 621, 51, PA_SHIFT, 622 },
+    // State 622
+    { 622, 52, PA_SHIFT, 623 },
+    // State 623
+    { 623, 53, PA_SHIFT, 624 },
+    // State 624
+    { 624, 54, PA_SHIFT, 625 },
+    // State 625
+    { 625, 101, PA_REDUCE, 84 },
+    // State 625 default action
+    { 625, -1, PA_REDUCE, 84 },
+    // State 626
+    { 626, 33, PA_SHIFT, 627 },
+    // State 626
+    { 626, 34, PA_SHIFT, 638 },
+    // State 626
+    { 626, 45, PA_SHIFT, 649 },
+    // State 627
+    { 627, 33, PA_SHIFT, 628 },
+    // State 628
+    { 628, 47, PA_SHIFT, 629 },
+    // State 629
+    { 629, 48, PA_SHIFT, 630 },
+    // State 630
+    { 630, 49, PA_SHIFT, 631 },
+    // State 631
+    { 631, 50, PA_SHIFT, 632 },
+    // State 632
+    { 632, 51, PA_SHIFT, 633 },
+    // State 633
+    { 633, 52, PA_SHIFT, 634 },
+    // State 634
+    { 634, 53, PA_SHIFT, 635 },
+    // State 635
+    { 635, 54, PA_SHIFT, 636 },
+    // State 636
+    { 636, 55, PA_SHIFT, 637 },
+    // State 637
+    { 637, 101, PA_REDUCE, 21 },
+    // State 637 default action
+    { 637, -1, PA_REDUCE, 21 },
+    // State 638
+    { 638, 33, PA_SHIFT, 639 },
+    // State 639
+    { 639, 82, PA_SHIFT, 640 },
+    // State 640
+    { 640, 83, PA_SHIFT, 641 },
+    // State 641
+    { 641, 84, PA_SHIFT, 642 },
+    // State 642
+    { 642, 85, PA_SHIFT, 643 },
+    // State 643
+    { 643, 86, PA_SHIFT, 644 },
+    // State 644
+    { 644, 87, PA_SHIFT, 645 },
+    // State 645
+    { 645, 88, PA_SHIFT, 646 },
+    // State 646
+    { 646, 90, PA_SHIFT, 647 },
+    // State 647
+    { 647, 91, PA_SHIFT, 648 },
+    // State 648
+    { 648, 101, PA_REDUCE, 53 },
+    // State 648 default action
+    { 648, -1, PA_REDUCE, 53 },
+    // State 649
+    { 649, 33, PA_SHIFT, 650 },
+    // State 650
+    { 650, 47, PA_SHIFT, 651 },
+    // State 651
+    { 651, 48, PA_SHIFT, 652 },
+    // State 652
+    { 652, 49, PA_SHIFT, 653 },
+    // State 653
+    { 653, 50, PA_SHIFT, 654 },
+    // State 654
+    { 654, 51, PA_SHIFT, 655 },
+    // State 655
+    { 655, 52, PA_SHIFT, 656 },
+    // State 656
+    { 656, 53, PA_SHIFT, 657 },
+    // State 657
+    { 657, 54, PA_SHIFT, 658 },
+    // State 658
+    { 658, 55, PA_SHIFT, 659 },
+    // State 659
+    { 659, 101, PA_REDUCE, 85 },
+    // State 659 default action
+    { 659, -1, PA_REDUCE, 85 },
+    // State 660
+    { 660, 33, PA_SHIFT, 661 },
+    // State 660
+    { 660, 34, PA_SHIFT, 672 },
+    // State 660
+    { 660, 45, PA_SHIFT, 683 },
+    // State 661
+    { 661, 33, PA_SHIFT, 662 },
+    // State 662
+    { 662, 48, PA_SHIFT, 663 },
+    // State 663
+    { 663, 49, PA_SHIFT, 664 },
+    // State 664
+    { 664, 50, PA_SHIFT, 665 },
+    // State 665
+    { 665, 51, PA_SHIFT, 666 },
+    // State 666
+    { 666, 52, PA_SHIFT, 667 },
+    // State 667
+    { 667, 53, PA_SHIFT, 668 },
+    // State 668
+    { 668, 54, PA_SHIFT, 669 },
+    // State 669
+    { 669, 55, PA_SHIFT, 670 },
+    // State 670
+    { 670, 57, PA_SHIFT, 671 },
+    // State 671
+    { 671, 101, PA_REDUCE, 22 },
+    // State 671 default action
+    { 671, -1, PA_REDUCE, 22 },
+    // State 672
+    { 672, 33, PA_SHIFT, 673 },
+    // State 673
+    { 673, 83, PA_SHIFT, 674 },
+    // State 674
+    { 674, 84, PA_SHIFT, 675 },
+    // State 675
+    { 675, 85, PA_SHIFT, 676 },
+    // State 676
+    { 676, 86, PA_SHIFT, 677 },
+    // State 677
+    { 677, 87, PA_SHIFT, 678 },
+    // State 678
+    { 678, 88, PA_SHIFT, 679 },
+    // State 679
+    { 679, 90, PA_SHIFT, 680 },
+    // State 680
+    { 680, 91, PA_SHIFT, 681 },
+    // State 681
+    { 681, 92, PA_SHIFT, 682 },
+    // State 682
+    { 682, 101, PA_REDUCE, 54 },
+    // State 682 default action
+    { 682, -1, PA_REDUCE, 54 },
+    // State 683
+    { 683, 33, PA_SHIFT, 684 },
+    // State 684
+    { 684, 48, PA_SHIFT, 685 },
+    // State 685
+    { 685, 49, PA_SHIFT, 686 },
+    // State 686
+    { 686, 50, PA_SHIFT, 687 },
+    // State 687
+    { 687, 51, PA_SHIFT, 688 },
+    // State 688
+    { 688, 52, PA_SHIFT, 689 },
+    // State 689
+    { 689, 53, PA_SHIFT, 690 },
+    // State 690
+    { 690, 54, PA_SHIFT, 691 },
+    // State 691
+    { 691, 55, PA_SHIFT, 692 },
+    // State 692
+    { 692, 57, PA_SHIFT, 693 },
+    // State 693
+    { 693, 101, PA_REDUCE, 86 },
+    // State 693 default action
+    { 693, -1, PA_REDUCE, 86 },
+    // State 694
+    { 694, 33, PA_SHIFT, 695 },
+    // State 694
+    { 694, 34, PA_SHIFT, 706 },
+    // State 694
+    { 694, 45, PA_SHIFT, 717 },
+    // State 695
+    { 695, 33, PA_SHIFT, 696 },
+    // State 696
+    { 696, 49, PA_SHIFT, 697 },
+    // State 697
+    { 697, 50, PA_SHIFT, 698 },
+    // State 698
+    { 698, 51, PA_SHIFT, 699 },
+    // State 699
+    { 699, 52, PA_SHIFT, 700 },
+    // State 700
+    { 700, 53, PA_SHIFT, 701 },
+    // State 701
+    { 701, 54, PA_SHIFT, 702 },
+    // State 702
+    { 702, 55, PA_SHIFT, 703 },
+    // State 703
+    { 703, 57, PA_SHIFT, 704 },
+    // State 704
+    { 704, 58, PA_SHIFT, 705 },
+    // State 705
+    { 705, 101, PA_REDUCE, 23 },
+    // State 705 default action
+    { 705, -1, PA_REDUCE, 23 },
+    // State 706
+    { 706, 33, PA_SHIFT, 707 },
+    // State 707
+    { 707, 84, PA_SHIFT, 708 },
+    // State 708
+    { 708, 85, PA_SHIFT, 709 },
+    // State 709
+    { 709, 86, PA_SHIFT, 710 },
+    // State 710
+    { 710, 87, PA_SHIFT, 711 },
+    // State 711
+    { 711, 88, PA_SHIFT, 712 },
+    // State 712
+    { 712, 90, PA_SHIFT, 713 },
+    // State 713
+    { 713, 91, PA_SHIFT, 714 },
+    // State 714
+    { 714, 92, PA_SHIFT, 715 },
+    // State 715
+    { 715, 93, PA_SHIFT, 716 },
+    // State 716
+    { 716, 101, PA_REDUCE, 55 },
+    // State 716 default action
+    { 716, -1, PA_REDUCE, 55 },
+    // State 717
+    { 717, 33, PA_SHIFT, 718 },
+    // State 718
+    { 718, 49, PA_SHIFT, 719 },
+    // State 719
+    { 719, 50, PA_SHIFT, 720 },
+    // State 720
+    { 720, 51, PA_SHIFT, 721 },
+    // State 721
+    { 721, 52, PA_SHIFT, 722 },
+    // State 722
+    { 722, 53, PA_SHIFT, 723 },
+    // State 723
+    { 723, 54, PA_SHIFT, 724 },
+    // State 724
+    { 724, 55, PA_SHIFT, 725 },
+    // State 725
+    { 725, 57, PA_SHIFT, 726 },
+    // State 726
+    { 726, 58, PA_SHIFT, 727 },
+    // State 727
+    { 727, 101, PA_REDUCE, 87 },
+    // State 727 default action
+    { 727, -1, PA_REDUCE, 87 },
+    // State 728
+    { 728, 33, PA_SHIFT, 729 },
+    // State 728
+    { 728, 34, PA_SHIFT, 740 },
+    // State 728
+    { 728, 45, PA_SHIFT, 751 },
+    // State 729
+    { 729, 33, PA_SHIFT, 730 },
+    // State 730
+    { 730, 50, PA_SHIFT, 731 },
+    // State 731
+    { 731, 51, PA_SHIFT, 732 },
+    // State 732
+    { 732, 52, PA_SHIFT, 733 },
+    // State 733
+    { 733, 53, PA_SHIFT, 734 },
+    // State 734
+    { 734, 54, PA_SHIFT, 735 },
+    // State 735
+    { 735, 55, PA_SHIFT, 736 },
+    // State 736
+    { 736, 57, PA_SHIFT, 737 },
+    // State 737
+    { 737, 58, PA_SHIFT, 738 },
+    // State 738
+    { 738, 59, PA_SHIFT, 739 },
+    // State 739
+    { 739, 101, PA_REDUCE, 24 },
+    // State 739 default action
+    { 739, -1, PA_REDUCE, 24 },
+    // State 740
+    { 740, 33, PA_SHIFT, 741 },
+    // State 741
+    { 741, 85, PA_SHIFT, 742 },
+    // State 742
+    { 742, 86, PA_SHIFT, 743 },
+    // State 743
+    { 743, 87, PA_SHIFT, 744 },
+    // State 744
+    { 744, 88, PA_SHIFT, 745 },
+    // State 745
+    { 745, 90, PA_SHIFT, 746 },
+    // State 746
+    { 746, 91, PA_SHIFT, 747 },
+    // State 747
+    { 747, 92, PA_SHIFT, 748 },
+    // State 748
+    { 748, 93, PA_SHIFT, 749 },
+    // State 749
+    { 749, 33, PA_SHIFT, 750 },
+    // State 750
+    { 750, 101, PA_REDUCE, 56 },
+    // State 750 default action
+    { 750, -1, PA_REDUCE, 56 },
+    // State 751
+    { 751, 33, PA_SHIFT, 752 },
+    // State 752
+    { 752, 50, PA_SHIFT, 753 },
+    // State 753
+    { 753, 51, PA_SHIFT, 754 },
+    // State 754
+    { 754, 52, PA_SHIFT, 755 },
+    // State 755
+    { 755, 53, PA_SHIFT, 756 },
+    // State 756
+    { 756, 54, PA_SHIFT, 757 },
+    // State 757
+    { 757, 55, PA_SHIFT, 758 },
+    // State 758
+    { 758, 57, PA_SHIFT, 759 },
+    // State 759
+    { 759, 58, PA_SHIFT, 760 },
+    // State 760
+    { 760, 59, PA_SHIFT, 761 },
+    // State 761
+    { 761, 101, PA_REDUCE, 88 },
+    // State 761 default action
+    { 761, -1, PA_REDUCE, 88 },
+    // State 762
+    { 762, 33, PA_SHIFT, 763 },
+    // State 762
+    { 762, 34, PA_SHIFT, 774 },
+    // State 762
+    { 762, 45, PA_SHIFT, 785 },
+    // State 763
+    { 763, 33, PA_SHIFT, 764 },
+    // State 764
+    { 764, 51, PA_SHIFT, 765 },
+    // State 765
+    { 765, 52, PA_SHIFT, 766 },
+    // State 766
+    { 766, 53, PA_SHIFT, 767 },
+    // State 767
+    { 767, 54, PA_SHIFT, 768 },
+    // State 768
+    { 768, 55, PA_SHIFT, 769 },
+    // State 769
+    { 769, 57, PA_SHIFT, 770 },
+    // State 770
+    { 770, 58, PA_SHIFT, 771 },
+    // State 771
+    { 771, 59, PA_SHIFT, 772 },
+    // State 772
+    { 772, 60, PA_SHIFT, 773 },
+    // State 773
+    { 773, 101, PA_REDUCE, 25 },
+    // State 773 default action
+    { 773, -1, PA_REDUCE, 25 },
+    // State 774
+    { 774, 33, PA_SHIFT, 775 },
+    // State 775
+    { 775, 86, PA_SHIFT, 776 },
+    // State 776
+    { 776, 87, PA_SHIFT, 777 },
+    // State 777
+    { 777, 88, PA_SHIFT, 778 },
+    // State 778
+    { 778, 90, PA_SHIFT, 779 },
+    // State 779
+    { 779, 91, PA_SHIFT, 780 },
+    // State 780
+    { 780, 92, PA_SHIFT, 781 },
+    // State 781
+    { 781, 93, PA_SHIFT, 782 },
+    // State 782
+    { 782, 33, PA_SHIFT, 783 },
+    // State 783
+    { 783, 34, PA_SHIFT, 784 },
+    // State 784
+    { 784, 101, PA_REDUCE, 57 },
+    // State 784 default action
+    { 784, -1, PA_REDUCE, 57 },
+    // State 785
+    { 785, 33, PA_SHIFT, 786 },
+    // State 786
+    { 786, 51, PA_SHIFT, 787 },
+    // State 787
+    { 787, 52, PA_SHIFT, 788 },
+    // State 788
+    { 788, 53, PA_SHIFT, 789 },
+    // State 789
+    { 789, 54, PA_SHIFT, 790 },
+    // State 790
+    { 790, 55, PA_SHIFT, 791 },
+    // State 791
+    { 791, 57, PA_SHIFT, 792 },
+    // State 792
+    { 792, 58, PA_SHIFT, 793 },
+    // State 793
+    { 793, 59, PA_SHIFT, 794 },
+    // State 794
+    { 794, 60, PA_SHIFT, 795 },
+    // State 795
+    { 795, 101, PA_REDUCE, 89 },
+    // State 795 default action
+    { 795, -1, PA_REDUCE, 89 },
+    // State 796
+    { 796, 33, PA_SHIFT, 797 },
+    // State 796
+    { 796, 34, PA_SHIFT, 808 },
+    // State 796
+    { 796, 45, PA_SHIFT, 819 },
+    // State 797
+    { 797, 33, PA_SHIFT, 798 },
+    // State 798
+    { 798, 52, PA_SHIFT, 799 },
+    // State 799
+    { 799, 53, PA_SHIFT, 800 },
+    // State 800
+    { 800, 54, PA_SHIFT, 801 },
+    // State 801
+    { 801, 55, PA_SHIFT, 802 },
+    // State 802
+    { 802, 57, PA_SHIFT, 803 },
+    // State 803
+    { 803, 58, PA_SHIFT, 804 },
+    // State 804
+    { 804, 59, PA_SHIFT, 805 },
+    // State 805
+    { 805, 60, PA_SHIFT, 806 },
+    // State 806
+    { 806, 61, PA_SHIFT, 807 },
+    // State 807
+    { 807, 101, PA_REDUCE, 26 },
+    // State 807 default action
+    { 807, -1, PA_REDUCE, 26 },
+    // State 808
+    { 808, 33, PA_SHIFT, 809 },
+    // State 809
+    { 809, 87, PA_SHIFT, 810 },
+    // State 810
+    { 810, 88, PA_SHIFT, 811 },
+    // State 811
+    { 811, 90, PA_SHIFT, 812 },
+    // State 812
+    { 812, 91, PA_SHIFT, 813 },
+    // State 813
+    { 813, 92, PA_SHIFT, 814 },
+    // State 814
+    { 814, 93, PA_SHIFT, 815 },
+    // State 815
+    { 815, 33, PA_SHIFT, 816 },
+    // State 816
+    { 816, 34, PA_SHIFT, 817 },
+    // State 817
+    { 817, 45, PA_SHIFT, 818 },
+    // State 818
+    { 818, 101, PA_REDUCE, 58 },
+    // State 818 default action
+    { 818, -1, PA_REDUCE, 58 },
+    // State 819
+    { 819, 33, PA_SHIFT, 820 },
+    // State 820
+    { 820, 52, PA_SHIFT, 821 },
+    // State 821
+    { 821, 53, PA_SHIFT, 822 },
+    // State 822
+    { 822, 54, PA_SHIFT, 823 },
+    // State 823
+    { 823, 55, PA_SHIFT, 824 },
+    // State 824
+    { 824, 57, PA_SHIFT, 825 },
+    // State 825
+    { 825, 58, PA_SHIFT, 826 },
+    // State 826
+    { 826, 59, PA_SHIFT, 827 },
+    // State 827
+    { 827, 60, PA_SHIFT, 828 },
+    // State 828
+    { 828, 61, PA_SHIFT, 829 },
+    // State 829
+    { 829, 101, PA_REDUCE, 90 },
+    // State 829 default action
+    { 829, -1, PA_REDUCE, 90 },
+    // State 830
+    { 830, 33, PA_SHIFT, 831 },
+    // State 830
+    { 830, 34, PA_SHIFT, 842 },
+    // State 830
+    { 830, 45, PA_SHIFT, 853 },
+    // State 831
+    { 831, 33, PA_SHIFT, 832 },
+    // State 832
+    { 832, 53, PA_SHIFT, 833 },
+    // State 833
+    { 833, 54, PA_SHIFT, 834 },
+    // State 834
+    { 834, 55, PA_SHIFT, 835 },
+    // State 835
+    { 835, 57, PA_SHIFT, 836 },
+    // State 836
+    { 836, 58, PA_SHIFT, 837 },
+    // State 837
+    { 837, 59, PA_SHIFT, 838 },
+    // State 838
+    { 838, 60, PA_SHIFT, 839 },
+    // State 839
+    { 839, 61, PA_SHIFT, 840 },
+    // State 840
+    { 840, 62, PA_SHIFT, 841 },
+    // State 841
+    { 841, 101, PA_REDUCE, 27 },
+    // State 841 default action
+    { 841, -1, PA_REDUCE, 27 },
+    // State 842
+    { 842, 33, PA_SHIFT, 843 },
+    // State 843
+    { 843, 88, PA_SHIFT, 844 },
+    // State 844
+    { 844, 90, PA_SHIFT, 845 },
+    // State 845
+    { 845, 91, PA_SHIFT, 846 },
+    // State 846
+    { 846, 92, PA_SHIFT, 847 },
+    // State 847
+    { 847, 93, PA_SHIFT, 848 },
+    // State 848
+    { 848, 33, PA_SHIFT, 849 },
+    // State 849
+    { 849, 34, PA_SHIFT, 850 },
+    // State 850
+    { 850, 45, PA_SHIFT, 851 },
+    // State 851
+    { 851, 56, PA_SHIFT, 852 },
+    // State 852
+    { 852, 101, PA_REDUCE, 59 },
+    // State 852 default action
+    { 852, -1, PA_REDUCE, 59 },
+    // State 853
+    { 853, 33, PA_SHIFT, 854 },
+    // State 854
+    { 854, 53, PA_SHIFT, 855 },
+    // State 855
+    { 855, 54, PA_SHIFT, 856 },
+    // State 856
+    { 856, 55, PA_SHIFT, 857 },
+    // State 857
+    { 857, 57, PA_SHIFT, 858 },
+    // State 858
+    { 858, 58, PA_SHIFT, 859 },
+    // State 859
+    { 859, 59, PA_SHIFT, 860 },
+    // State 860
+    { 860, 60, PA_SHIFT, 861 },
+    // State 861
+    { 861, 61, PA_SHIFT, 862 },
+    // State 862
+    { 862, 62, PA_SHIFT, 863 },
+    // State 863
+    { 863, 101, PA_REDUCE, 91 },
+    // State 863 default action
+    { 863, -1, PA_REDUCE, 91 },
+    // State 864
+    { 864, 33, PA_SHIFT, 865 },
+    // State 864
+    { 864, 34, PA_SHIFT, 876 },
+    // State 864
+    { 864, 45, PA_SHIFT, 887 },
+    // State 865
+    { 865, 33, PA_SHIFT, 866 },
+    // State 866
+    { 866, 54, PA_SHIFT, 867 },
+    // State 867
+    { 867, 55, PA_SHIFT, 868 },
+    // State 868
+    { 868, 57, PA_SHIFT, 869 },
+    // State 869
+    { 869, 58, PA_SHIFT, 870 },
+    // State 870
+    { 870, 59, PA_SHIFT, 871 },
+    // State 871
+    { 871, 60, PA_SHIFT, 872 },
+    // State 872
+    { 872, 61, PA_SHIFT, 873 },
+    // State 873
+    { 873, 62, PA_SHIFT, 874 },
+    // State 874
+    { 874, 63, PA_SHIFT, 875 },
+    // State 875
+    { 875, 101, PA_REDUCE, 28 },
+    // State 875 default action
+    { 875, -1, PA_REDUCE, 28 },
+    // State 876
+    { 876, 33, PA_SHIFT, 877 },
+    // State 877
+    { 877, 90, PA_SHIFT, 878 },
+    // State 878
+    { 878, 91, PA_SHIFT, 879 },
+    // State 879
+    { 879, 92, PA_SHIFT, 880 },
+    // State 880
+    { 880, 93, PA_SHIFT, 881 },
+    // State 881
+    { 881, 33, PA_SHIFT, 882 },
+    // State 882
+    { 882, 34, PA_SHIFT, 883 },
+    // State 883
+    { 883, 45, PA_SHIFT, 884 },
+    // State 884
+    { 884, 56, PA_SHIFT, 885 },
+    // State 885
+    { 885, 67, PA_SHIFT, 886 },
+    // State 886
+    { 886, 101, PA_REDUCE, 60 },
+    // State 886 default action
+    { 886, -1, PA_REDUCE, 60 },
+    // State 887
+    { 887, 33, PA_SHIFT, 888 },
+    // State 888
+    { 888, 54, PA_SHIFT, 889 },
+    // State 889
+    { 889, 55, PA_SHIFT, 890 },
+    // State 890
+    { 890, 57, PA_SHIFT, 891 },
+    // State 891
+    { 891, 58, PA_SHIFT, 892 },
+    // State 892
+    { 892, 59, PA_SHIFT, 893 },
+    // State 893
+    { 893, 60, PA_SHIFT, 894 },
+    // State 894
+    { 894, 61, PA_SHIFT, 895 },
+    // State 895
+    { 895, 62, PA_SHIFT, 896 },
+    // State 896
+    { 896, 63, PA_SHIFT, 897 },
+    // State 897
+    { 897, 101, PA_REDUCE, 92 },
+    // State 897 default action
+    { 897, -1, PA_REDUCE, 92 },
+    // State 898
+    { 898, 33, PA_SHIFT, 899 },
+    // State 898
+    { 898, 34, PA_SHIFT, 910 },
+    // State 898
+    { 898, 45, PA_SHIFT, 921 },
+    // State 899
+    { 899, 33, PA_SHIFT, 900 },
+    // State 900
+    { 900, 55, PA_SHIFT, 901 },
+    // State 901
+    { 901, 57, PA_SHIFT, 902 },
+    // State 902
+    { 902, 58, PA_SHIFT, 903 },
+    // State 903
+    { 903, 59, PA_SHIFT, 904 },
+    // State 904
+    { 904, 60, PA_SHIFT, 905 },
+    // State 905
+    { 905, 61, PA_SHIFT, 906 },
+    // State 906
+    { 906, 62, PA_SHIFT, 907 },
+    // State 907
+    { 907, 63, PA_SHIFT, 908 },
+    // State 908
+    { 908, 64, PA_SHIFT, 909 },
+    // State 909
+    { 909, 101, PA_REDUCE, 29 },
+    // State 909 default action
+    { 909, -1, PA_REDUCE, 29 },
+    // State 910
+    { 910, 33, PA_SHIFT, 911 },
+    // State 911
+    { 911, 91, PA_SHIFT, 912 },
+    // State 912
+    { 912, 92, PA_SHIFT, 913 },
+    // State 913
+    { 913, 93, PA_SHIFT, 914 },
+    // State 914
+    { 914, 33, PA_SHIFT, 915 },
+    // State 915
+    { 915, 34, PA_SHIFT, 916 },
+    // State 916
+    { 916, 45, PA_SHIFT, 917 },
+    // State 917
+    { 917, 56, PA_SHIFT, 918 },
+    // State 918
+    { 918, 67, PA_SHIFT, 919 },
+    // State 919
+    { 919, 78, PA_SHIFT, 920 },
+    // State 920
+    { 920, 101, PA_REDUCE, 61 },
+    // State 920 default action
+    { 920, -1, PA_REDUCE, 61 },
+    // State 921
+    { 921, 33, PA_SHIFT, 922 },
+    // State 922
+    { 922, 55, PA_SHIFT, 923 },
+    // State 923
+    { 923, 57, PA_SHIFT, 924 },
+    // State 924
+    { 924, 58, PA_SHIFT, 925 },
+    // State 925
+    { 925, 59, PA_SHIFT, 926 },
+    // State 926
+    { 926, 60, PA_SHIFT, 927 },
+    // State 927
+    { 927, 61, PA_SHIFT, 928 },
+    // State 928
+    { 928, 62, PA_SHIFT, 929 },
+    // State 929
+    { 929, 63, PA_SHIFT, 930 },
+    // State 930
+    { 930, 64, PA_SHIFT, 931 },
+    // State 931
+    { 931, 101, PA_REDUCE, 93 },
+    // State 931 default action
+    { 931, -1, PA_REDUCE, 93 },
+    // State 932
+    { 932, 33, PA_SHIFT, 933 },
+    // State 932
+    { 932, 34, PA_SHIFT, 944 },
+    // State 932
+    { 932, 45, PA_SHIFT, 955 },
+    // State 933
+    { 933, 33, PA_SHIFT, 934 },
+    // State 934
+    { 934, 57, PA_SHIFT, 935 },
+    // State 935
+    { 935, 58, PA_SHIFT, 936 },
+    // State 936
+    { 936, 59, PA_SHIFT, 937 },
+    // State 937
+    { 937, 60, PA_SHIFT, 938 },
+    // State 938
+    { 938, 61, PA_SHIFT, 939 },
+    // State 939
+    { 939, 62, PA_SHIFT, 940 },
+    // State 940
+    { 940, 63, PA_SHIFT, 941 },
+    // State 941
+    { 941, 64, PA_SHIFT, 942 },
+    // State 942
+    { 942, 65, PA_SHIFT, 943 },
+    // State 943
+    { 943, 101, PA_REDUCE, 30 },
+    // State 943 default action
+    { 943, -1, PA_REDUCE, 30 },
+    // State 944
+    { 944, 33, PA_SHIFT, 945 },
+    // State 945
+    { 945, 92, PA_SHIFT, 946 },
+    // State 946
+    { 946, 93, PA_SHIFT, 947 },
+    // State 947
+    { 947, 33, PA_SHIFT, 948 },
+    // State 948
+    { 948, 34, PA_SHIFT, 949 },
+    // State 949
+    { 949, 45, PA_SHIFT, 950 },
+    // State 950
+    { 950, 56, PA_SHIFT, 951 },
+    // State 951
+    { 951, 67, PA_SHIFT, 952 },
+    // State 952
+    { 952, 78, PA_SHIFT, 953 },
+    // State 953
+    { 953, 89, PA_SHIFT, 954 },
+    // State 954
+    { 954, 101, PA_REDUCE, 62 },
+    // State 954 default action
+    { 954, -1, PA_REDUCE, 62 },
+    // State 955
+    { 955, 33, PA_SHIFT, 956 },
+    // State 956
+    { 956, 57, PA_SHIFT, 957 },
+    // State 957
+    { 957, 58, PA_SHIFT, 958 },
+    // State 958
+    { 958, 59, PA_SHIFT, 959 },
+    // State 959
+    { 959, 60, PA_SHIFT, 960 },
+    // State 960
+    { 960, 61, PA_SHIFT, 961 },
+    // State 961
+    { 961, 62, PA_SHIFT, 962 },
+    // State 962
+    { 962, 63, PA_SHIFT, 963 },
+    // State 963
+    { 963, 64, PA_SHIFT, 964 },
+    // State 964
+    { 964, 65, PA_SHIFT, 965 },
+    // State 965
+    { 965, 101, PA_REDUCE, 94 },
+    // State 965 default action
+    { 965, -1, PA_REDUCE, 94 },
+    // State 966
+    { 966, 33, PA_SHIFT, 967 },
+    // State 966
+    { 966, 34, PA_SHIFT, 978 },
+    // State 966
+    { 966, 45, PA_SHIFT, 989 },
+    // State 967
+    { 967, 33, PA_SHIFT, 968 },
+    // State 968
+    { 968, 58, PA_SHIFT, 969 },
+    // State 969
+    { 969, 59, PA_SHIFT, 970 },
+    // State 970
+    { 970, 60, PA_SHIFT, 971 },
+    // State 971
+    { 971, 61, PA_SHIFT, 972 },
+    // State 972
+    { 972, 62, PA_SHIFT, 973 },
+    // State 973
+    { 973, 63, PA_SHIFT, 974 },
+    // State 974
+    { 974, 64, PA_SHIFT, 975 },
+    // State 975
+    { 975, 65, PA_SHIFT, 976 },
+    // State 976
+    { 976, 66, PA_SHIFT, 977 },
+    // State 977
+    { 977, 101, PA_REDUCE, 31 },
+    // State 977 default action
+    { 977, -1, PA_REDUCE, 31 },
+    // State 978
+    { 978, 33, PA_SHIFT, 979 },
+    // State 979
+    { 979, 93, PA_SHIFT, 980 },
+    // State 980
+    { 980, 33, PA_SHIFT, 981 },
+    // State 981
+    { 981, 34, PA_SHIFT, 982 },
+    // State 982
+    { 982, 45, PA_SHIFT, 983 },
+    // State 983
+    { 983, 56, PA_SHIFT, 984 },
+    // State 984
+    { 984, 67, PA_SHIFT, 985 },
+    // State 985
+    { 985, 78, PA_SHIFT, 986 },
+    // State 986
+    { 986, 89, PA_SHIFT, 987 },
+    // State 987
+    { 987, 94, PA_SHIFT, 988 },
+    // State 988
+    { 988, 101, PA_REDUCE, 63 },
+    // State 988 default action
+    { 988, -1, PA_REDUCE, 63 },
+    // State 989
+    { 989, 33, PA_SHIFT, 990 },
+    // State 990
+    { 990, 58, PA_SHIFT, 991 },
+    // State 991
+    { 991, 59, PA_SHIFT, 992 },
+    // State 992
+    { 992, 60, PA_SHIFT, 993 },
+    // State 993
+    { 993, 61, PA_SHIFT, 994 },
+    // State 994
+    { 994, 62, PA_SHIFT, 995 },
+    // State 995
+    { 995, 63, PA_SHIFT, 996 },
+    // State 996
+    { 996, 64, PA_SHIFT, 997 },
+    // State 997
+    { 997, 65, PA_SHIFT, 998 },
+    // State 998
+    { 998, 66, PA_SHIFT, 999 },
+    // State 999
+    { 999, 101, PA_REDUCE, 95 },
+    // State 999 default action
+    { 999, -1, PA_REDUCE, 95 },
+    // State 1000
+    { 1000, 33, PA_SHIFT, 1001 },
+    // State 1000
+    { 1000, 34, PA_SHIFT, 1012 },
+    // State 1000
+    { 1000, 45, PA_SHIFT, 1023 },
+    // State 1001
+    { 1001, 33, PA_SHIFT, 1002 },
+    // State 1002
+    { 1002, 59, PA_SHIFT, 1003 },
+    // State 1003
+    { 1003, 60, PA_SHIFT, 1004 },
+    // State 1004
+    { 1004, 61, PA_SHIFT, 1005 },
+    // State 1005
+    { 1005, 62, PA_SHIFT, 1006 },
+    // State 1006
+    { 1006, 63, PA_SHIFT, 1007 },
+    // State 1007
+    { 1007, 64, PA_SHIFT, 1008 },
+    // State 1008
+    { 1008, 65, PA_SHIFT, 1009 },
+    // State 1009
+    { 1009, 66, PA_SHIFT, 1010 },
+    // State 1010
+    { 1010, 68, PA_SHIFT, 1011 },
+    // State 1011
+    { 1011, 101, PA_REDUCE, 32 },
+    // State 1011 default action
+    { 1011, -1, PA_REDUCE, 32 },
+    // State 1012
+    { 1012, 33, PA_SHIFT, 1013 },
+    // State 1013
+    { 1013, 33, PA_SHIFT, 1014 },
+    // State 1014
+    { 1014, 34, PA_SHIFT, 1015 },
+    // State 1015
+    { 1015, 45, PA_SHIFT, 1016 },
+    // State 1016
+    { 1016, 56, PA_SHIFT, 1017 },
+    // State 1017
+    { 1017, 67, PA_SHIFT, 1018 },
+    // State 1018
+    { 1018, 78, PA_SHIFT, 1019 },
+    // State 1019
+    { 1019, 89, PA_SHIFT, 1020 },
+    // State 1020
+    { 1020, 94, PA_SHIFT, 1021 },
+    // State 1021
+    { 1021, 95, PA_SHIFT, 1022 },
+    // State 1022
+    { 1022, 101, PA_REDUCE, 64 },
+    // State 1022 default action
+    { 1022, -1, PA_REDUCE, 64 },
+    // State 1023
+    { 1023, 33, PA_SHIFT, 1024 },
+    // State 1024
+    { 1024, 59, PA_SHIFT, 1025 },
+    // State 1025
+    { 1025, 60, PA_SHIFT, 1026 },
+    // State 1026
+    { 1026, 61, PA_SHIFT, 1027 },
+    // State 1027
+    { 1027, 62, PA_SHIFT, 1028 },
+    // State 1028
+    { 1028, 63, PA_SHIFT, 1029 },
+    // State 1029
+    { 1029, 64, PA_SHIFT, 1030 },
+    // State 1030
+    { 1030, 65, PA_SHIFT, 1031 },
+    // State 1031
+    { 1031, 66, PA_SHIFT, 1032 },
+    // State 1032
+    { 1032, 68, PA_SHIFT, 1033 },
+    // State 1033
+    { 1033, 101, PA_REDUCE, 96 },
+    // State 1033 default action
+    { 1033, -1, PA_REDUCE, 96 },
+    // State 1034
+    { 1034, 33, PA_SHIFT, 1035 },
+    // State 1034
+    { 1034, 34, PA_SHIFT, 1046 },
+    // State 1034
+    { 1034, 45, PA_SHIFT, 1057 },
+    // State 1035
+    { 1035, 33, PA_SHIFT, 1036 },
+    // State 1036
+    { 1036, 60, PA_SHIFT, 1037 },
+    // State 1037
+    { 1037, 61, PA_SHIFT, 1038 },
+    // State 1038
+    { 1038, 62, PA_SHIFT, 1039 },
+    // State 1039
+    { 1039, 63, PA_SHIFT, 1040 },
+    // State 1040
+    { 1040, 64, PA_SHIFT, 1041 },
+    // State 1041
+    { 1041, 65, PA_SHIFT, 1042 },
+    // State 1042
+    { 1042, 66, PA_SHIFT, 1043 },
+    // State 1043
+    { 1043, 68, PA_SHIFT, 1044 },
+    // State 1044
+    { 1044, 69, PA_SHIFT, 1045 },
+    // State 1045
+    { 1045, 101, PA_REDUCE, 33 },
+    // State 1045 default action
+    { 1045, -1, PA_REDUCE, 33 },
+    // State 1046
+    { 1046, 33, PA_SHIFT, 1047 },
+    // State 1047
+    { 1047, 34, PA_SHIFT, 1048 },
+    // State 1048
+    { 1048, 45, PA_SHIFT, 1049 },
+    // State 1049
+    { 1049, 56, PA_SHIFT, 1050 },
+    // State 1050
+    { 1050, 67, PA_SHIFT, 1051 },
+    // State 1051
+    { 1051, 78, PA_SHIFT, 1052 },
+    // State 1052
+    { 1052, 89, PA_SHIFT, 1053 },
+    // State 1053
+    { 1053, 94, PA_SHIFT, 1054 },
+    // State 1054
+    { 1054, 95, PA_SHIFT, 1055 },
+    // State 1055
+    { 1055, 96, PA_SHIFT, 1056 },
+    // State 1056
+    { 1056, 101, PA_REDUCE, 65 },
+    // State 1056 default action
+    { 1056, -1, PA_REDUCE, 65 },
+    // State 1057
+    { 1057, 33, PA_SHIFT, 1058 },
+    // State 1058
+    { 1058, 60, PA_SHIFT, 1059 },
+    // State 1059
+    { 1059, 61, PA_SHIFT, 1060 },
+    // State 1060
+    { 1060, 62, PA_SHIFT, 1061 },
+    // State 1061
+    { 1061, 63, PA_SHIFT, 1062 },
+    // State 1062
+    { 1062, 64, PA_SHIFT, 1063 },
+    // State 1063
+    { 1063, 65, PA_SHIFT, 1064 },
+    // State 1064
+    { 1064, 66, PA_SHIFT, 1065 },
+    // State 1065
+    { 1065, 68, PA_SHIFT, 1066 },
+    // State 1066
+    { 1066, 69, PA_SHIFT, 1067 },
+    // State 1067
+    { 1067, 101, PA_REDUCE, 97 },
+    // State 1067 default action
+    { 1067, -1, PA_REDUCE, 97 },
+    // State 1068
+    { 1068, 33, PA_SHIFT, 1069 },
+    // State 1068
+    { 1068, 34, PA_SHIFT, 1080 },
+    // State 1068
+    { 1068, 45, PA_SHIFT, 1091 },
+    // State 1069
+    { 1069, 33, PA_SHIFT, 1070 },
+    // State 1070
+    { 1070, 61, PA_SHIFT, 1071 },
+    // State 1071
+    { 1071, 62, PA_SHIFT, 1072 },
+    // State 1072
+    { 1072, 63, PA_SHIFT, 1073 },
+    // State 1073
+    { 1073, 64, PA_SHIFT, 1074 },
+    // State 1074
+    { 1074, 65, PA_SHIFT, 1075 },
+    // State 1075
+    { 1075, 66, PA_SHIFT, 1076 },
+    // State 1076
+    { 1076, 68, PA_SHIFT, 1077 },
+    // State 1077
+    { 1077, 69, PA_SHIFT, 1078 },
+    // State 1078
+    { 1078, 70, PA_SHIFT, 1079 },
+    // State 1079
+    { 1079, 101, PA_REDUCE, 34 },
+    // State 1079 default action
+    { 1079, -1, PA_REDUCE, 34 },
+    // State 1080
+    { 1080, 33, PA_SHIFT, 1081 },
+    // State 1081
+    { 1081, 45, PA_SHIFT, 1082 },
+    // State 1082
+    { 1082, 56, PA_SHIFT, 1083 },
+    // State 1083
+    { 1083, 67, PA_SHIFT, 1084 },
+    // State 1084
+    { 1084, 78, PA_SHIFT, 1085 },
+    // State 1085
+    { 1085, 89, PA_SHIFT, 1086 },
+    // State 1086
+    { 1086, 94, PA_SHIFT, 1087 },
+    // State 1087
+    { 1087, 95, PA_SHIFT, 1088 },
+    // State 1088
+    { 1088, 96, PA_SHIFT, 1089 },
+    // State 1089
+    { 1089, 35, PA_SHIFT, 1090 },
+    // State 1090
+    { 1090, 101, PA_REDUCE, 66 },
+    // State 1090 default action
+    { 1090, -1, PA_REDUCE, 66 },
+    // State 1091
+    { 1091, 33, PA_SHIFT, 1092 },
+    // State 1092
+    { 1092, 61, PA_SHIFT, 1093 },
+    // State 1093
+    { 1093, 62, PA_SHIFT, 1094 },
+    // State 1094
+    { 1094, 63, PA_SHIFT, 1095 },
+    // State 1095
+    { 1095, 64, PA_SHIFT, 1096 },
+    // State 1096
+    { 1096, 65, PA_SHIFT, 1097 },
+    // State 1097
+    { 1097, 66, PA_SHIFT, 1098 },
+    // State 1098
+    { 1098, 68, PA_SHIFT, 1099 },
+    // State 1099
+    { 1099, 69, PA_SHIFT, 1100 },
+    // State 1100
+    { 1100, 70, PA_SHIFT, 1101 },
+    // State 1101
+    { 1101, 101, PA_REDUCE, 98 },
+    // State 1101 default action
+    { 1101, -1, PA_REDUCE, 98 },
+    // State 1102
+    { 1102, 101, PA_REDUCE, 2 },
+    // State 1102 default action
+    { 1102, -1, PA_REDUCE, 2 },
+};
+
+
+static int theRuleTable[100][2] =
+{
+    // prog ::= items
+    { 100, 1 }, 
+    // items ::= items item
+    { 99, 2 }, 
+    // items ::= item
+    { 99, 1 }, 
+    // item ::= K0 T0 T0 T3 T4 T5 T6 T7 T8 T9 T10 T11
+    { 98, 12 }, 
+    // item ::= K1 T0 T0 T4 T5 T6 T7 T8 T9 T10 T11 T12
+    { 98, 12 }, 
+    // item ::= K2 T0 T0 T5 T6 T7 T8 T9 T10 T11 T12 T13
+    { 98, 12 }, 
+    // item ::= K3 T0 T0 T6 T7 T8 T9 T10 T11 T12 T13 T14
+    { 98, 12 }, 
+    // item ::= K4 T0 T0 T7 T8 T9 T10 T11 T12 T13 T14 T15
+    { 98, 12 }, 
+    // item ::= K5 T0 T0 T8 T9 T10 T11 T12 T13 T14 T15 T16
+    { 98, 12 }, 
+    // item ::= K6 T0 T0 T9 T10 T11 T12 T13 T14 T15 T16 T17
+    { 98, 12 }, 
+    // item ::= K7 T0 T0 T10 T11 T12 T13 T14 T15 T16 T17 T18
+    { 98, 12 }, 
+    // item ::= K8 T0 T0 T11 T12 T13 T14 T15 T16 T17 T18 T19
+    { 98, 12 }, 
+    // item ::= K9 T0 T0 T12 T13 T14 T15 T16 T17 T18 T19 T20
+    { 98, 12 }, 
+    // item ::= K10 T0 T0 T13 T14 T15 T16 T17 T18 T19 T20 T21
+    { 98, 12 }, 
+    // item ::= K11 T0 T0 T14 T15 T16 T17 T18 T19 T20 T21 T22
+    { 98, 12 }, 
+    // item ::= K12 T0 T0 T15 T16 T17 T18 T19 T20 T21 T22 T23
+    { 98, 12 }, 
+    // item ::= K13 T0 T0 T16 T17 T18 T19 T20 T21 T22 T23 T24
+    { 98, 12 }, 
+    // item ::= K14 T0 T0 T17 T18 T19 T20 T21 T22 T23 T24 T25
+    { 98, 12 }, 
+    // item ::= K15 T0 T0 T18 T19 T20 T21 T22 T23 T24 T25 T26
+    { 98, 12 }, 
+    // item ::= K16 T0 T0 T19 T20 T21 T22 T23 T24 T25 T26 T27
+    { 98, 12 }, 
+    // item ::= K17 T0 T0 T20 T21 T22 T23 T24 T25 T26 T27 T28
+    { 98, 12 }, 
+    // item ::= K18 T0 T0 T21 T22 T23 T24 T25 T26 T27 T28 T29
+    { 98, 12 }, 
+    // item ::= K19 T0 T0 T22 T23 T24 T25 T26 T27 T28 T29 T30
+    { 98, 12 }, 
+    // item ::= K20 T0 T0 T23 T24 T25 T26 T27 T28 T29 T30 T31
+    { 98, 12 }, 
+    // item ::= K21 T0 T0 T24 T25 T26 T27 T28 T29 T30 T31 T32
+    { 98, 12 }, 
+    // item ::= K22 T0 T0 T25 T26 T27 T28 T29 T30 T31 T32 T33
+    { 98, 12 }, 
+    // item ::= K23 T0 T0 T26 T27 T28 T29 T30 T31 T32 T33 T34
+    { 98, 12 }, 
+    // item ::= K24 T0 T0 T27 T28 T29 T30 T31 T32 T33 T34 T35
+    { 98, 12 }, 
+    // item ::= K25 T0 T0 T28 T29 T30 T31 T32 T33 T34 T35 T36
+    { 98, 12 }, 
+    // item ::= K26 T0 T0 T29 T30 T31 T32 T33 T34 T35 T36 T37
+    { 98, 12 }, 
+    // item ::= K27 T0 T0 T30 T31 T32 T33 T34 T35 T36 T37 T38
+    { 98, 12 }, 
+    // item ::= K28 T0 T0 T31 T32 T33 T34 T35 T36 T37 T38 T39
+    { 98, 12 }, 
+    // item ::= K29 T0 T0 T32 T33 T34 T35 T36 T37 T38 T39 T40
+    { 98, 12 }, 
+    // item ::= K30 T0 T0 T33 T34 T35 T36 T37 T38 T39 T40 T41
+    { 98, 12 }, 
+    // item ::= K31 T0 T0 T34 T35 T36 T37 T38 T39 T40 T41 T42
+    { 98, 12 }, 
+    // item ::= K0 T1 T0 T35 T36 T37 T38 T39 T40 T41 T42 T43
+    { 98, 12 }, 
+    // item ::= K1 T1 T0 T36 T37 T38 T39 T40 T41 T42 T43 T44
+    { 98, 12 }, 
+    // item ::= K2 T1 T0 T37 T38 T39 T40 T41 T42 T43 T44 T45
+    { 98, 12 }, 
+    // item ::= K3 T1 T0 T38 T39 T40 T41 T42 T43 T44 T45 T46
+    { 98, 12 }, 
+    // item ::= K4 T1 T0 T39 T40 T41 T42 T43 T44 T45 T46 T47
+    { 98, 12 }, 
+    // item ::= K5 T1 T0 T40 T41 T42 T43 T44 T45 T46 T47 T48
+    { 98, 12 }, 
+    // item ::= K6 T1 T0 T41 T42 T43 T44 T45 T46 T47 T48 T49
+    { 98, 12 }, 
+    // item ::= K7 T1 T0 T42 T43 T44 T45 T46 T47 T48 T49 T50
+    { 98, 12 }, 
+    // item ::= K8 T1 T0 T43 T44 T45 T46 T47 T48 T49 T50 T51
+    { 98, 12 }, 
+    // item ::= K9 T1 T0 T44 T45 T46 T47 T48 T49 T50 T51 T52
+    { 98, 12 }, 
+    // item ::= K10 T1 T0 T45 T46 T47 T48 T49 T50 T51 T52 T53
+    { 98, 12 }, 
+    // item ::= K11 T1 T0 T46 T47 T48 T49 T50 T51 T52 T53 T54
+    { 98, 12 }, 
+    // item ::= K12 T1 T0 T47 T48 T49 T50 T51 T52 T53 T54 T55
+    { 98, 12 }, 
+    // item ::= K13 T1 T0 T48 T49 T50 T51 T52 T53 T54 T55 T56
+    { 98, 12 }, 
+    // item ::= K14 T1 T0 T49 T50 T51 T52 T53 T54 T55 T56 T57
+    { 98, 12 }, 
+    // item ::= K15 T1 T0 T50 T51 T52 T53 T54 T55 T56 T57 T58
+    { 98, 12 }, 
+    // item ::= K16 T1 T0 T51 T52 T53 T54 T55 T56 T57 T58 T59
+    { 98, 12 }, 
+    // item ::= K17 T1 T0 T52 T53 T54 T55 T56 T57 T58 T59 T60
+    { 98, 12 }, 
+    // item ::= K18 T1 T0 T53 T54 T55 T56 T57 T58 T59 T60 T61
+    { 98, 12 }, 
+    // item ::= K19 T1 T0 T54 T55 T56 T57 T58 T59 T60 T61 T62
+    { 98, 12 }, 
+    // item ::= K20 T1 T0 T55 T56 T57 T58 T59 T60 T61 T62 T63
+    { 98, 12 }, 
+    // item ::= K21 T1 T0 T56 T57 T58 T59 T60 T61 T62 T63 T0
+    { 98, 12 }, 
+    // item ::= K22 T1 T0 T57 T58 T59 T60 T61 T62 T63 T0 T1
+    { 98, 12 }, 
+    // item ::= K23 T1 T0 T58 T59 T60 T61 T62 T63 T0 T1 T2
+    { 98, 12 }, 
+    // item ::= K24 T1 T0 T59 T60 T61 T62 T63 T0 T1 T2 T3
+    { 98, 12 }, 
+    // item ::= K25 T1 T0 T60 T61 T62 T63 T0 T1 T2 T3 T4
+    { 98, 12 }, 
+    // item ::= K26 T1 T0 T61 T62 T63 T0 T1 T2 T3 T4 T5
+    { 98, 12 }, 
+    // item ::= K27 T1 T0 T62 T63 T0 T1 T2 T3 T4 T5 T6
+    { 98, 12 }, 
+    // item ::= K28 T1 T0 T63 T0 T1 T2 T3 T4 T5 T6 T7
+    { 98, 12 }, 
+    // item ::= K29 T1 T0 T0 T1 T2 T3 T4 T5 T6 T7 T8
+    { 98, 12 }, 
+    // item ::= K30 T1 T0 T1 T2 T3 T4 T5 T6 T7 T8 T9
+    { 98, 12 }, 
+    // item ::= K31 T1 T0 T2 T3 T4 T5 T6 T7 T8 T9 T10
+    { 98, 12 }, 
+    // item ::= K0 T2 T0 T3 T4 T5 T6 T7 T8 T9 T10 T11
+    { 98, 12 }, 
+    // item ::= K1 T2 T0 T4 T5 T6 T7 T8 T9 T10 T11 T12
+    { 98, 12 }, 
+    // item ::= K2 T2 T0 T5 T6 T7 T8 T9 T10 T11 T12 T13
+    { 98, 12 }, 
+    // item ::= K3 T2 T0 T6 T7 T8 T9 T10 T11 T12 T13 T14
+    { 98, 12 }, 
+    // item ::= K4 T2 T0 T7 T8 T9 T10 T11 T12 T13 T14 T15
+    { 98, 12 }, 
+    // item ::= K5 T2 T0 T8 T9 T10 T11 T12 T13 T14 T15 T16
+    { 98, 12 }, 
+    // item ::= K6 T2 T0 T9 T10 T11 T12 T13 T14 T15 T16 T17
+    { 98, 12 }, 
+    // item ::= K7 T2 T0 T10 T11 T12 T13 T14 T15 T16 T17 T18
+    { 98, 12 }, 
+    // item ::= K8 T2 T0 T11 T12 T13 T14 T15 T16 T17 T18 T19
+    { 98, 12 }, 
+    // item ::= K9 T2 T0 T12 T13 T14 T15 T16 T17 T18 T19 T20
+    { 98, 12 }, 
+    // item ::= K10 T2 T0 T13 T14 T15 T16 T17 T18 T19 T20 T21
+    { 98, 12 }, 
+    // item ::= K11 T2 T0 T14 T15 T16 T17 T18 T19 T20 T21 T22
+    { 98, 12 }, 
+    // item ::= K12 T2 T0 T15 T16 T17 T18 T19 T20 T21 T22 T23
+    { 98, 12 }, 
+    // item ::= K13 T2 T0 T16 T17 T18 T19 T20 T21 T22 T23 T24
+    { 98, 12 }, 
+    // item ::= K14 T2 T0 T17 T18 T19 T20 T21 T22 T23 T24 T25
+    { 98, 12 }, 
+    // item ::= K15 T2 T0 T18 T19 T20 T21 T22 T23 T24 T25 T26
+    { 98, 12 }, 
+    // item ::= K16 T2 T0 T19 T20 T21 T22 T23 T24 T25 T26 T27
+    { 98, 12 }, 
+    // item ::= K17 T2 T0 T20 T21 T22 T23 T24 T25 T26 T27 T28
+    { 98, 12 }, 
+    // item ::= K18 T2 T0 T21 T22 T23 T24 T25 T26 T27 T28 T29
+    { 98, 12 }, 
+    // item ::= K19 T2 T0 T22 T23 T24 T25 T26 T27 T28 T29 T30
+    { 98, 12 }, 
+    // item ::= K20 T2 T0 T23 T24 T25 T26 T27 T28 T29 T30 T31
+    { 98, 12 }, 
+    // item ::= K21 T2 T0 T24 T25 T26 T27 T28 T29 T30 T31 T32
+    { 98, 12 }, 
+    // item ::= K22 T2 T0 T25 T26 T27 T28 T29 T30 T31 T32 T33
+    { 98, 12 }, 
+    // item ::= K23 T2 T0 T26 T27 T28 T29 T30 T31 T32 T33 T34
+    { 98, 12 }, 
+    // item ::= K24 T2 T0 T27 T28 T29 T30 T31 T32 T33 T34 T35
+    { 98, 12 }, 
+    // item ::= K25 T2 T0 T28 T29 T30 T31 T32 T33 T34 T35 T36
+    { 98, 12 }, 
+    // item ::= K26 T2 T0 T29 T30 T31 T32 T33 T34 T35 T36 T37
+    { 98, 12 }, 
+    // item ::= K27 T2 T0 T30 T31 T32 T33 T34 T35 T36 T37 T38
+    { 98, 12 }, 
+    // item ::= K28 T2 T0 T31 T32 T33 T34 T35 T36 T37 T38 T39
+    { 98, 12 }, 
+    // item ::= K29 T2 T0 T32 T33 T34 T35 T36 T37 T38 T39 T40
+    { 98, 12 }, 
+    // item ::= K30 T2 T0 T33 T34 T35 T36 T37 T38 T39 T40 T41
+    { 98, 12 }, 
+    // item ::= K31 T2 T0 T34 T35 T36 T37 T38 T39 T40 T41 T42
+    { 98, 12 }, 
+    // item ::= K0 T3 T0 T35 T36 T37 T38 T39 T40 T41 T42 T43
+    { 98, 12 }, 
+};
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::initTables( void )
+{
+    myStates.assign( 1103, ActionMap() );
+    myStateDefaultActions.assign( 1103, ActionEntry(PA_ERROR,-2) );
+    for ( int i = 0; i < 1334; ++i )
+    {
+        if ( theStateTable[i][1] == -1 )
+            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+        else
+            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+    }
+
+
+    // Rule Table
+
+    myRules.reserve( 100 );
+    for ( int i = 0; i < 100; ++i )
+        myRules.push_back( RuleInfo( theRuleTable[i][0], theRuleTable[i][1] ) );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::syntaxError( Bench::Terminal tok, privBenchImpl::Value &data )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parseFailed( void )
+{
+}
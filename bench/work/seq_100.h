@@ -0,0 +1,130 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        K0 = 1,
+        K1 = 2,
+        K10 = 3,
+        K11 = 4,
+        K12 = 5,
+        K13 = 6,
+        K14 = 7,
+        K15 = 8,
+        K16 = 9,
+        K17 = 10,
+        K18 = 11,
+        K19 = 12,
+        K2 = 13,
+        K20 = 14,
+        K21 = 15,
+        K22 = 16,
+        K23 = 17,
+        K24 = 18,
+        K25 = 19,
+        K26 = 20,
+        K27 = 21,
+        K28 = 22,
+        K29 = 23,
+        K3 = 24,
+        K30 = 25,
+        K31 = 26,
+        K4 = 27,
+        K5 = 28,
+        K6 = 29,
+        K7 = 30,
+        K8 = 31,
+        K9 = 32,
+        T0 = 33,
+        T1 = 34,
+        T10 = 35,
+        T11 = 36,
+        T12 = 37,
+        T13 = 38,
+        T14 = 39,
+        T15 = 40,
+        T16 = 41,
+        T17 = 42,
+        T18 = 43,
+        T19 = 44,
+        T2 = 45,
+        T20 = 46,
+        T21 = 47,
+        T22 = 48,
+        T23 = 49,
+        T24 = 50,
+        T25 = 51,
+        T26 = 52,
+        T27 = 53,
+        T28 = 54,
+        T29 = 55,
+        T3 = 56,
+        T30 = 57,
+        T31 = 58,
+        T32 = 59,
+        T33 = 60,
+        T34 = 61,
+        T35 = 62,
+        T36 = 63,
+        T37 = 64,
+        T38 = 65,
+        T39 = 66,
+        T4 = 67,
+        T40 = 68,
+        T41 = 69,
+        T42 = 70,
+        T43 = 71,
+        T44 = 72,
+        T45 = 73,
+        T46 = 74,
+        T47 = 75,
+        T48 = 76,
+        T49 = 77,
+        T5 = 78,
+        T50 = 79,
+        T51 = 80,
+        T52 = 81,
+        T53 = 82,
+        T54 = 83,
+        T55 = 84,
+        T56 = 85,
+        T57 = 86,
+        T58 = 87,
+        T59 = 88,
+        T6 = 89,
+        T60 = 90,
+        T61 = 91,
+        T62 = 92,
+        T63 = 93,
+        T7 = 94,
+        T8 = 95,
+        T9 = 96
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
@@ -0,0 +1,642 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#include <utility>
+#include <stack>
+#include <map>
+#include <vector>
+#include <iostream>
+
+
+#include "wide_10.h"
+
+enum ParserAct
+{
+    PA_SHIFT,
+    PA_REDUCE,
+    PA_ERROR,
+    PA_ACCEPT,
+    PA_NOP
+};
+
+class privBenchImpl
+{
+public:
+
+    privBenchImpl( void );
+    ~privBenchImpl( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    struct Value
+    {
+        union
+        {
+            int tokenType;
+            int errorType;
+        };
+    };
+    // first is stack num, second is the symbol index
+    typedef std::pair<int,int> StackID;
+    typedef std::pair<StackID,Value> StackEntry;
+    typedef std::stack<StackEntry> ParseStack;
+
+    void shift( int newState, int symIdx, Value &data );
+    void reduce( int ruleNum );
+    void callDtor( int symIdx, Value &data );
+    void popStack( void );
+    ParserAct findParserAction( int &newVal, int tok );
+    void initTables( void );
+    void syntaxError( Bench::Terminal tok, Value &data );
+    void parseFailed( void );
+
+    ParseStack myStack;
+    int myErrCount;
+
+
+    typedef std::pair<ParserAct,int> ActionEntry;
+    typedef std::map<int,ActionEntry> ActionMap;
+    typedef std::vector<ActionMap> StateList;
+    typedef std::vector<ActionEntry> StateDefaultList;
+
+    StateList myStates;
+    StateDefaultList myStateDefaultActions;
+
+
+    // first is LHS, second is number of RHS
+    typedef std::pair<int,int> RuleInfo;
+    typedef std::vector<RuleInfo> RuleList;
+
+    RuleList myRules;
+};
+
+
+////////////////////////////////////////
+
+
+Bench::Bench( void )
+    : myImplementation( new privBenchImpl )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Bench::~Bench( void )
+{
+    delete myImplementation;
+}
+
+
+////////////////////////////////////////
+
+
+void Bench::parse( Bench::Terminal tok, int value )
+{
+    myImplementation->parse( tok, value );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parse( Bench::Terminal tok, int value )
+{
+    int actVal;
+    ParserAct action;
+    bool errHit = false;
+    bool eoInput = (tok == Bench::EOF );
+    bool done = false;
+
+    if ( myStack.empty() )
+    {
+        if ( eoInput )
+            return;
+
+        myErrCount = -1;
+    }
+
+    privBenchImpl::Value data;
+    data.tokenType = value;
+
+    do
+    {
+        action = findParserAction( actVal, tok );
+        if ( PA_SHIFT == action )
+        {
+            shift( actVal, tok, data );
+            --myErrCount;
+            if ( eoInput && ! myStack.empty() )
+                tok = Bench::EOF;
+            else
+                done = true;
+        }
+        else if ( PA_REDUCE == action )
+        {
+            reduce( actVal );
+        }
+        else if ( PA_ERROR == action )
+        {
+            // Syntax error handling:
+            // 1. Call the %syntax_error function.
+            // 2. Pop stack until a state where we can shift the err symbol.
+            // 3. Shift the error symbol.
+            // 4. Set error count to three.
+            // 5. Begin accepting and shifting new tokens.
+            // 6. No new error processing will begin until 3 tokens are successful.
+            if ( myErrCount < 0 )
+            {
+                syntaxError( tok, data );
+            }
+            if ( myStack.top().first.first == 11 || errHit )
+            {
+                callDtor( static_cast<int>(tok), data );
+                done = true;
+            }
+            else
+            {
+                while ( ! myStack.empty() &&
+                        myStack.top().first.first != 11 )
+                {
+                    action = findParserAction( actVal, 11 );
+                    if ( action == PA_SHIFT )
+                        break;
+                    popStack();
+                }
+                if ( myStack.empty() || tok == Bench::EOF )
+                {
+                    callDtor( static_cast<int>(tok), data );
+                    parseFailed();
+                    done = true;
+                }
+                else if ( myStack.top().first.first != 11 )
+                {
+                    data.errorType = 0;
+                    shift( actVal, 11, data );
+                }
+            }
+            myErrCount = 3;
+            errHit = true;
+        }
+        else // ACCEPT == action || NOP == action
+        {
+            done = true;
+        }
+    } while ( ! done && ! myStack.empty() );
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::privBenchImpl( void )
+    : myErrCount( -1 )
+{
+    initTables();
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::~privBenchImpl( void )
+{
+    while ( ! myStack.empty() )
+        popStack();
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::shift( int newState, int symIdx, privBenchImpl::Value &data )
+{
+    StackEntry newItem = StackEntry( StackID( newState, symIdx ), data );
+    myStack.push( newItem );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::reduce( int ruleNum )
+{
+    int newVal;
+    ParserAct next;
+    privBenchImpl::Value data = { 0 };
+    std::vector<privBenchImpl::Value> rhsData;
+    for ( int i = 0, N = myRules[ruleNum].second; i != N; ++i )
+    {
+        if ( myStack.empty() )
+            rhsData.insert( rhsData.begin(), data );
+        else
+        {
+            rhsData.insert( rhsData.begin(), myStack.top().second );
+            myStack.pop();
+        }
+    }
+
+    next = findParserAction( newVal, myRules[ruleNum].first );
+
+    switch ( ruleNum )
+    {
+        case 0:
+        {
+            // prog ::= stmts
+#line 0 "bench/work/wide_10.lem"
+#line 250 "bench/work/wide_10.cpp"
+            callDtor( 15, rhsData[0] );
+            break;
+        }
+
+        case 1:
+        {
+            // stmts ::=
+#line 0 "bench/work/wide_10.lem"
+#line 259 "bench/work/wide_10.cpp"
+            break;
+        }
+
+        case 2:
+        {
+            // stmts ::= stmts stmt SEMI
+#line 0 "bench/work/wide_10.lem"
+#line 267 "bench/work/wide_10.cpp"
+            callDtor( 15, rhsData[0] );
+            callDtor( 14, rhsData[1] );
+            callDtor( 10, rhsData[2] );
+            break;
+        }
+
+        case 3:
+        {
+            // expr ::= expr PLUS term
+#line 0 "bench/work/wide_10.lem"
+#line 278 "bench/work/wide_10.cpp"
+            callDtor( 12, rhsData[0] );
+            callDtor( 8, rhsData[1] );
+            callDtor( 16, rhsData[2] );
+            break;
+        }
+
+        case 4:
+        {
+            // expr ::= term
+#line 0 "bench/work/wide_10.lem"
+#line 289 "bench/work/wide_10.cpp"
+            callDtor( 16, rhsData[0] );
+            break;
+        }
+
+        case 5:
+        {
+            // term ::= ID
+#line 0 "bench/work/wide_10.lem"
+#line 298 "bench/work/wide_10.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 6:
+        {
+            // term ::= NUM
+#line 0 "bench/work/wide_10.lem"
+#line 307 "bench/work/wide_10.cpp"
+            callDtor( 7, rhsData[0] );
+            break;
+        }
+
+        case 7:
+        {
+            // term ::= LP expr RP
+#line 0 "bench/work/wide_10.lem"
+#line 316 "bench/work/wide_10.cpp"
+            callDtor( 6, rhsData[0] );
+            callDtor( 12, rhsData[1] );
+            callDtor( 9, rhsData[2] );
+            break;
+        }
+
+        case 8:
+        {
+            // stmt ::= KW0 expr
+#line 0 "bench/work/wide_10.lem"
+#line 327 "bench/work/wide_10.cpp"
+            callDtor( 2, rhsData[0] );
+            callDtor( 12, rhsData[1] );
+            break;
+        }
+
+        case 9:
+        {
+            // stmt ::= KW1 expr
+#line 0 "bench/work/wide_10.lem"
+#line 337 "bench/work/wide_10.cpp"
+            callDtor( 3, rhsData[0] );
+            callDtor( 12, rhsData[1] );
+            break;
+        }
+
+        case 10:
+        {
+            // stmt ::= KW2 expr
+#line 0 "bench/work/wide_10.lem"
+#line 347 "bench/work/wide_10.cpp"
+            callDtor( 4, rhsData[0] );
+            callDtor( 12, rhsData[1] );
+            break;
+        }
+
+        case 11:
+        {
+            // stmt ::= KW3 expr
+#line 0 "bench/work/wide_10.lem"
+#line 357 "bench/work/wide_10.cpp"
+            callDtor( 5, rhsData[0] );
+            callDtor( 12, rhsData[1] );
+            break;
+        }
+
+        default:
+            throw "Unknown Rule Number";
+            break;
+    }
+
+    if ( PA_SHIFT == next )
+        shift( newVal, myRules[ruleNum].first, data );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::callDtor( int symIdx, privBenchImpl::Value &data )
+{
+    switch ( symIdx )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::popStack( void )
+{
+    callDtor( myStack.top().first.second, myStack.top().second );
+    myStack.pop();
+}
+
+
+////////////////////////////////////////
+
+
+ParserAct privBenchImpl::findParserAction( int &newVal, int tok )
+{
+    int stateNum;
+    ParserAct retval = PA_NOP;
+    bool found = false;
+
+    stateNum = myStack.empty() ? 0 : myStack.top().first.first;
+    ActionMap::iterator i = myStates[stateNum].find( tok );
+    if ( tok >= 0 && tok <= 17 )
+    {
+        if ( i != myStates[stateNum].end() )
+        {
+            retval = (*i).second.first;
+            newVal = (*i).second.second;
+            found = true;
+        }
+    }
+    else if ( ! myStates[stateNum].empty() )
+    {
+        retval = PA_NOP;
+        newVal = 0;
+        found = true;
+    }
+
+    if ( ! found )
+    {
+        retval = myStateDefaultActions[stateNum].first;
+        newVal = myStateDefaultActions[stateNum].second;
+    }
+    return retval;
+}
+
+
+////////////////////////////////////////
+
+
+static int theStateTable[62][4] =
+{
+    // State 0
+    { 0, 13, PA_ACCEPT, 0 },
+    // State 0
+    { 0, 15, PA_SHIFT, 1 },
+    // State 0
+    { 0, 17, PA_REDUCE, 1 },
+    // State 0 default action
+    { 0, -1, PA_REDUCE, 1 },
+    // State 1
+    { 1, 0, PA_REDUCE, 0 },
+    // State 1
+    { 1, 2, PA_SHIFT, 4 },
+    // State 1
+    { 1, 3, PA_SHIFT, 14 },
+    // State 1
+    { 1, 4, PA_SHIFT, 16 },
+    // State 1
+    { 1, 5, PA_SHIFT, 18 },
+    // State 1
+    { 1, 14, PA_SHIFT, 2 },
+    // State 2
+    { 2, 10, PA_SHIFT, 3 },
+    // State 3
+    { 3, 17, PA_REDUCE, 2 },
+    // State 3 default action
+    { 3, -1, PA_REDUCE, 2 },
+    // State 4
+    { 4, 1, PA_SHIFT, 8 },
+    // State 4
+    { 4, 6, PA_SHIFT, 10 },
+    // State 4
+    { 4, 7, PA_SHIFT, 9 },
+    // State 4
+    { 4, 12, PA_SHIFT, 5 },
+    // State 4
+    { 4, 16, PA_SHIFT, 13 },
+    // State 5
+    { 5, 8, PA_SHIFT, 6 },
+    // State 5
+    { 5, 10, PA_REDUCE, 8 },
+    // State 6
+    { 6, 1, PA_SHIFT, 8 },
+    // State 6
+    { 6, 6, PA_SHIFT, 10 },
+    // State 6
+    { 6, 7, PA_SHIFT, 9 },
+    // State 6
+    { 6, 16, PA_SHIFT, 7 },
+    // State 7
+    { 7, 17, PA_REDUCE, 3 },
+    // State 7 default action
+    { 7, -1, PA_REDUCE, 3 },
+    // State 8
+    { 8, 17, PA_REDUCE, 5 },
+    // State 8 default action
+    { 8, -1, PA_REDUCE, 5 },
+    // State 9
+    { 9, 17, PA_REDUCE, 6 },
+    // State 9 default action
+    { 9, -1, PA_REDUCE, 6 },
+    // State 10
+    { 10, 1, PA_SHIFT, 8 },
+    // State 10
+    { 10, 6, PA_SHIFT, 10 },
+    // State 10
+    { 10, 7, PA_SHIFT, 9 },
+    // State 10
+    { 10, 12, PA_SHIFT, 11 },
+    // State 10
+    { 10, 16, PA_SHIFT, 13 },
+    // State 11
+    { 11, 8, PA_SHIFT, 6 },
+    // State 11
+    { 11, 9, PA_SHIFT, 12 },
+    // State 12
+    { 12, 17, PA_REDUCE, 7 },
+    // State 12 default action
+    { 12, -1, PA_REDUCE, 7 },
+    // State 13
+    { 13, 17, PA_REDUCE, 4 },
+    // State 13 default action
+    { 13, -1, PA_REDUCE, 4 },
+    // State 14
+    { 14, 1, PA_SHIFT, 8 },
+    // State 14
+    { 14, 6, PA_SHIFT, 10 },
+    // State 14
+    { 14, 7, PA_SHIFT, 9 },
+    // State 14
+    { 14, 12, PA_SHIFT, 15 },
+    // State 14
+    { 14, 16, PA_SHIFT, 13 },
+    // State 15
+    { 15, 8, PA_SHIFT, 6 },
+    // State 15
+    { 15, 10, PA_REDUCE, 9 },
+    // State 16
+    { 16, 1, PA_SHIFT, 8 },
+    // State 16
+    { 16, 6, PA_SHIFT, 10 },
+    // State 16
+    { 16, 7, PA_SHIFT, 9 },
+    // State 16
+    { 16, 12, PA_SHIFT, 17 },
+    // State 16
+    { 16, 16, PA_SHIFT, 13 },
+    // State 17
+    { 17, 8, PA_SHIFT, 6 },
+    // State 17
+    { 17, 10, PA_REDUCE, 10 },
+    // State 18
+    { 18, 1, PA_SHIFT, 8 },
+    // State 18
+    { 18, 6, PA_SHIFT, 10 },
+    // State 18
+    { 18, 7, PA_SHIFT, 9 },
+    // State 18
+    { 18, 12, PA_SHIFT, 19 },
+    // State 18
+    { 18, 16, PA_SHIFT, 13 },
+    // State 19
+    { 19, 8, PA_SHIFT, 6 },
+    // State 19
+    { 19, 10, PA_REDUCE, 11 },
+};
+
+
+static int theRuleTable[12][2] =
+{
+    // prog ::= stmts
+    { 13, 1 }, 
+    // stmts ::=
+    { 15, 0 }, 
+    // stmts ::= stmts stmt SEMI
+    { 15, 3 }, 
+    // expr ::= expr PLUS term
+    { 12, 3 }, 
+    // expr ::= term
+    { 12, 1 }, 
+    // term ::= ID
+    { 16, 1 }, 
+    // term ::= NUM
+    { 16, 1 }, 
+    // term ::= LP expr RP
+    { 16, 3 }, 
+    // stmt ::= KW0 expr
+    { 14, 2 }, 
+    // stmt ::= KW1 expr
+    { 14, 2 }, 
+    // stmt ::= KW2 expr
+    { 14, 2 }, 
+    // stmt ::= KW3 expr
+    { 14, 2 }, 
+};
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::initTables( void )
+{
+    myStates.assign( 20, ActionMap() );
+    myStateDefaultActions.assign( 20, ActionEntry(PA_ERROR,-2) );
+    for ( int i = 0; i < 62; ++i )
+    {
+        if ( theStateTable[i][1] == -1 )
+            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+        else
+            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+    }
+
+
+    // Rule Table
+
+    myRules.reserve( 12 );
+    for ( int i = 0; i < 12; ++i )
+        myRules.push_back( RuleInfo( theRuleTable[i][0], theRuleTable[i][1] ) );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::syntaxError( Bench::Terminal tok, privBenchImpl::Value &data )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parseFailed( void )
+{
+}
@@ -0,0 +1,44 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        ID = 1,
+        KW0 = 2,
+        KW1 = 3,
+        KW2 = 4,
+        KW3 = 5,
+        LP = 6,
+        NUM = 7,
+        PLUS = 8,
+        RP = 9,
+        SEMI = 10
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
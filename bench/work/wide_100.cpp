@@ -0,0 +1,3194 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#include <utility>
+#include <stack>
+#include <map>
+#include <vector>
+#include <iostream>
+
+
+#include "wide_100.h"
+
+enum ParserAct
+{
+    PA_SHIFT,
+    PA_REDUCE,
+    PA_ERROR,
+    PA_ACCEPT,
+    PA_NOP
+};
+
+class privBenchImpl
+{
+public:
+
+    privBenchImpl( void );
+    ~privBenchImpl( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    struct Value
+    {
+        union
+        {
+            int tokenType;
+            int errorType;
+        };
+    };
+    // first is stack num, second is the symbol index
+    typedef std::pair<int,int> StackID;
+    typedef std::pair<StackID,Value> StackEntry;
+    typedef std::stack<StackEntry> ParseStack;
+
+    void shift( int newState, int symIdx, Value &data );
+    void reduce( int ruleNum );
+    void callDtor( int symIdx, Value &data );
+    void popStack( void );
+    ParserAct findParserAction( int &newVal, int tok );
+    void initTables( void );
+    void syntaxError( Bench::Terminal tok, Value &data );
+    void parseFailed( void );
+
+    ParseStack myStack;
+    int myErrCount;
+
+
+    typedef std::pair<ParserAct,int> ActionEntry;
+    typedef std::map<int,ActionEntry> ActionMap;
+    typedef std::vector<ActionMap> StateList;
+    typedef std::vector<ActionEntry> StateDefaultList;
+
+    StateList myStates;
+    StateDefaultList myStateDefaultActions;
+
+
+    // first is LHS, second is number of RHS
+    typedef std::pair<int,int> RuleInfo;
+    typedef std::vector<RuleInfo> RuleList;
+
+    RuleList myRules;
+};
+
+
+////////////////////////////////////////
+
+
+Bench::Bench( void )
+    : myImplementation( new privBenchImpl )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Bench::~Bench( void )
+{
+    delete myImplementation;
+}
+
+
+////////////////////////////////////////
+
+
+void Bench::parse( Bench::Terminal tok, int value )
+{
+    myImplementation->parse( tok, value );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parse( Bench::Terminal tok, int value )
+{
+    int actVal;
+    ParserAct action;
+    bool errHit = false;
+    bool eoInput = (tok == Bench::EOF );
+    bool done = false;
+
+    if ( myStack.empty() )
+    {
+        if ( eoInput )
+            return;
+
+        myErrCount = -1;
+    }
+
+    privBenchImpl::Value data;
+    data.tokenType = value;
+
+    do
+    {
+        action = findParserAction( actVal, tok );
+        if ( PA_SHIFT == action )
+        {
+            shift( actVal, tok, data );
+            --myErrCount;
+            if ( eoInput && ! myStack.empty() )
+                tok = Bench::EOF;
+            else
+                done = true;
+        }
+        else if ( PA_REDUCE == action )
+        {
+            reduce( actVal );
+        }
+        else if ( PA_ERROR == action )
+        {
+            // Syntax error handling:
+            // 1. Call the %syntax_error function.
+            // 2. Pop stack until a state where we can shift the err symbol.
+            // 3. Shift the error symbol.
+            // 4. Set error count to three.
+            // 5. Begin accepting and shifting new tokens.
+            // 6. No new error processing will begin until 3 tokens are successful.
+            if ( myErrCount < 0 )
+            {
+                syntaxError( tok, data );
+            }
+            if ( myStack.top().first.first == 99 || errHit )
+            {
+                callDtor( static_cast<int>(tok), data );
+                done = true;
+            }
+            else
+            {
+                while ( ! myStack.empty() &&
+                        myStack.top().first.first != 99 )
+                {
+                    action = findParserAction( actVal, 99 );
+                    if ( action == PA_SHIFT )
+                        break;
+                    popStack();
+                }
+                if ( myStack.empty() || tok == Bench::EOF )
+                {
+                    callDtor( static_cast<int>(tok), data );
+                    parseFailed();
+                    done = true;
+                }
+                else if ( myStack.top().first.first != 99 )
+                {
+                    data.errorType = 0;
+                    shift( actVal, 99, data );
+                }
+            }
+            myErrCount = 3;
+            errHit = true;
+        }
+        else // ACCEPT == action || NOP == action
+        {
+            done = true;
+        }
+    } while ( ! done && ! myStack.empty() );
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::privBenchImpl( void )
+    : myErrCount( -1 )
+{
+    initTables();
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::~privBenchImpl( void )
+{
+    while ( ! myStack.empty() )
+        popStack();
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::shift( int newState, int symIdx, privBenchImpl::Value &data )
+{
+    StackEntry newItem = StackEntry( StackID( newState, symIdx ), data );
+    myStack.push( newItem );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::reduce( int ruleNum )
+{
+    int newVal;
+    ParserAct next;
+    privBenchImpl::Value data = { 0 };
+    std::vector<privBenchImpl::Value> rhsData;
+    for ( int i = 0, N = myRules[ruleNum].second; i != N; ++i )
+    {
+        if ( myStack.empty() )
+            rhsData.insert( rhsData.begin(), data );
+        else
+        {
+            rhsData.insert( rhsData.begin(), myStack.top().second );
+            myStack.pop();
+        }
+    }
+
+    next = findParserAction( newVal, myRules[ruleNum].first );
+
+    switch ( ruleNum )
+    {
+        case 0:
+        {
+            // prog ::= stmts
+#line 0 "bench/work/wide_100.lem"
+#line 250 "bench/work/wide_100.cpp"
+            callDtor( 103, rhsData[0] );
+            break;
+        }
+
+        case 1:
+        {
+            // stmts ::=
+#line 0 "bench/work/wide_100.lem"
+#line 259 "bench/work/wide_100.cpp"
+            break;
+        }
+
+        case 2:
+        {
+            // stmts ::= stmts stmt SEMI
+#line 0 "bench/work/wide_100.lem"
+#line 267 "bench/work/wide_100.cpp"
+            callDtor( 103, rhsData[0] );
+            callDtor( 102, rhsData[1] );
+            callDtor( 98, rhsData[2] );
+            break;
+        }
+
+        case 3:
+        {
+            // expr ::= expr PLUS term
+#line 0 "bench/work/wide_100.lem"
+#line 278 "bench/work/wide_100.cpp"
+            callDtor( 100, rhsData[0] );
+            callDtor( 96, rhsData[1] );
+            callDtor( 104, rhsData[2] );
+            break;
+        }
+
+        case 4:
+        {
+            // expr ::= term
+#line 0 "bench/work/wide_100.lem"
+#line 289 "bench/work/wide_100.cpp"
+            callDtor( 104, rhsData[0] );
+            break;
+        }
+
+        case 5:
+        {
+            // term ::= ID
+#line 0 "bench/work/wide_100.lem"
+#line 298 "bench/work/wide_100.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 6:
+        {
+            // term ::= NUM
+#line 0 "bench/work/wide_100.lem"
+#line 307 "bench/work/wide_100.cpp"
+            callDtor( 95, rhsData[0] );
+            break;
+        }
+
+        case 7:
+        {
+            // term ::= LP expr RP
+#line 0 "bench/work/wide_100.lem"
+#line 316 "bench/work/wide_100.cpp"
+            callDtor( 94, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            callDtor( 97, rhsData[2] );
+            break;
+        }
+
+        case 8:
+        {
+            // stmt ::= KW0 expr
+#line 0 "bench/work/wide_100.lem"
+#line 327 "bench/work/wide_100.cpp"
+            callDtor( 2, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 9:
+        {
+            // stmt ::= KW1 expr
+#line 0 "bench/work/wide_100.lem"
+#line 337 "bench/work/wide_100.cpp"
+            callDtor( 3, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 10:
+        {
+            // stmt ::= KW2 expr
+#line 0 "bench/work/wide_100.lem"
+#line 347 "bench/work/wide_100.cpp"
+            callDtor( 14, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 11:
+        {
+            // stmt ::= KW3 expr
+#line 0 "bench/work/wide_100.lem"
+#line 357 "bench/work/wide_100.cpp"
+            callDtor( 25, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 12:
+        {
+            // stmt ::= KW4 expr
+#line 0 "bench/work/wide_100.lem"
+#line 367 "bench/work/wide_100.cpp"
+            callDtor( 36, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 13:
+        {
+            // stmt ::= KW5 expr
+#line 0 "bench/work/wide_100.lem"
+#line 377 "bench/work/wide_100.cpp"
+            callDtor( 47, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 14:
+        {
+            // stmt ::= KW6 expr
+#line 0 "bench/work/wide_100.lem"
+#line 387 "bench/work/wide_100.cpp"
+            callDtor( 58, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 15:
+        {
+            // stmt ::= KW7 expr
+#line 0 "bench/work/wide_100.lem"
+#line 397 "bench/work/wide_100.cpp"
+            callDtor( 69, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 16:
+        {
+            // stmt ::= KW8 expr
+#line 0 "bench/work/wide_100.lem"
+#line 407 "bench/work/wide_100.cpp"
+            callDtor( 80, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 17:
+        {
+            // stmt ::= KW9 expr
+#line 0 "bench/work/wide_100.lem"
+#line 417 "bench/work/wide_100.cpp"
+            callDtor( 91, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 18:
+        {
+            // stmt ::= KW10 expr
+#line 0 "bench/work/wide_100.lem"
+#line 427 "bench/work/wide_100.cpp"
+            callDtor( 4, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 19:
+        {
+            // stmt ::= KW11 expr
+#line 0 "bench/work/wide_100.lem"
+#line 437 "bench/work/wide_100.cpp"
+            callDtor( 5, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 20:
+        {
+            // stmt ::= KW12 expr
+#line 0 "bench/work/wide_100.lem"
+#line 447 "bench/work/wide_100.cpp"
+            callDtor( 6, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 21:
+        {
+            // stmt ::= KW13 expr
+#line 0 "bench/work/wide_100.lem"
+#line 457 "bench/work/wide_100.cpp"
+            callDtor( 7, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 22:
+        {
+            // stmt ::= KW14 expr
+#line 0 "bench/work/wide_100.lem"
+#line 467 "bench/work/wide_100.cpp"
+            callDtor( 8, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 23:
+        {
+            // stmt ::= KW15 expr
+#line 0 "bench/work/wide_100.lem"
+#line 477 "bench/work/wide_100.cpp"
+            callDtor( 9, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 24:
+        {
+            // stmt ::= KW16 expr
+#line 0 "bench/work/wide_100.lem"
+#line 487 "bench/work/wide_100.cpp"
+            callDtor( 10, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 25:
+        {
+            // stmt ::= KW17 expr
+#line 0 "bench/work/wide_100.lem"
+#line 497 "bench/work/wide_100.cpp"
+            callDtor( 11, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 26:
+        {
+            // stmt ::= KW18 expr
+#line 0 "bench/work/wide_100.lem"
+#line 507 "bench/work/wide_100.cpp"
+            callDtor( 12, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 27:
+        {
+            // stmt ::= KW19 expr
+#line 0 "bench/work/wide_100.lem"
+#line 517 "bench/work/wide_100.cpp"
+            callDtor( 13, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 28:
+        {
+            // stmt ::= KW20 expr
+#line 0 "bench/work/wide_100.lem"
+#line 527 "bench/work/wide_100.cpp"
+            callDtor( 15, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 29:
+        {
+            // stmt ::= KW21 expr
+#line 0 "bench/work/wide_100.lem"
+#line 537 "bench/work/wide_100.cpp"
+            callDtor( 16, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 30:
+        {
+            // stmt ::= KW22 expr
+#line 0 "bench/work/wide_100.lem"
+#line 547 "bench/work/wide_100.cpp"
+            callDtor( 17, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 31:
+        {
+            // stmt ::= KW23 expr
+#line 0 "bench/work/wide_100.lem"
+#line 557 "bench/work/wide_100.cpp"
+            callDtor( 18, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 32:
+        {
+            // stmt ::= KW24 expr
+#line 0 "bench/work/wide_100.lem"
+#line 567 "bench/work/wide_100.cpp"
+            callDtor( 19, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 33:
+        {
+            // stmt ::= KW25 expr
+#line 0 "bench/work/wide_100.lem"
+#line 577 "bench/work/wide_100.cpp"
+            callDtor( 20, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 34:
+        {
+            // stmt ::= KW26 expr
+#line 0 "bench/work/wide_100.lem"
+#line 587 "bench/work/wide_100.cpp"
+            callDtor( 21, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 35:
+        {
+            // stmt ::= KW27 expr
+#line 0 "bench/work/wide_100.lem"
+#line 597 "bench/work/wide_100.cpp"
+            callDtor( 22, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 36:
+        {
+            // stmt ::= KW28 expr
+#line 0 "bench/work/wide_100.lem"
+#line 607 "bench/work/wide_100.cpp"
+            callDtor( 23, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 37:
+        {
+            // stmt ::= KW29 expr
+#line 0 "bench/work/wide_100.lem"
+#line 617 "bench/work/wide_100.cpp"
+            callDtor( 24, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 38:
+        {
+            // stmt ::= KW30 expr
+#line 0 "bench/work/wide_100.lem"
+#line 627 "bench/work/wide_100.cpp"
+            callDtor( 26, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 39:
+        {
+            // stmt ::= KW31 expr
+#line 0 "bench/work/wide_100.lem"
+#line 637 "bench/work/wide_100.cpp"
+            callDtor( 27, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 40:
+        {
+            // stmt ::= KW32 expr
+#line 0 "bench/work/wide_100.lem"
+#line 647 "bench/work/wide_100.cpp"
+            callDtor( 28, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 41:
+        {
+            // stmt ::= KW33 expr
+#line 0 "bench/work/wide_100.lem"
+#line 657 "bench/work/wide_100.cpp"
+            callDtor( 29, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 42:
+        {
+            // stmt ::= KW34 expr
+#line 0 "bench/work/wide_100.lem"
+#line 667 "bench/work/wide_100.cpp"
+            callDtor( 30, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 43:
+        {
+            // stmt ::= KW35 expr
+#line 0 "bench/work/wide_100.lem"
+#line 677 "bench/work/wide_100.cpp"
+            callDtor( 31, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 44:
+        {
+            // stmt ::= KW36 expr
+#line 0 "bench/work/wide_100.lem"
+#line 687 "bench/work/wide_100.cpp"
+            callDtor( 32, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 45:
+        {
+            // stmt ::= KW37 expr
+#line 0 "bench/work/wide_100.lem"
+#line 697 "bench/work/wide_100.cpp"
+            callDtor( 33, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 46:
+        {
+            // stmt ::= KW38 expr
+#line 0 "bench/work/wide_100.lem"
+#line 707 "bench/work/wide_100.cpp"
+            callDtor( 34, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 47:
+        {
+            // stmt ::= KW39 expr
+#line 0 "bench/work/wide_100.lem"
+#line 717 "bench/work/wide_100.cpp"
+            callDtor( 35, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 48:
+        {
+            // stmt ::= KW40 expr
+#line 0 "bench/work/wide_100.lem"
+#line 727 "bench/work/wide_100.cpp"
+            callDtor( 37, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 49:
+        {
+            // stmt ::= KW41 expr
+#line 0 "bench/work/wide_100.lem"
+#line 737 "bench/work/wide_100.cpp"
+            callDtor( 38, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 50:
+        {
+            // stmt ::= KW42 expr
+#line 0 "bench/work/wide_100.lem"
+#line 747 "bench/work/wide_100.cpp"
+            callDtor( 39, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 51:
+        {
+            // stmt ::= KW43 expr
+#line 0 "bench/work/wide_100.lem"
+#line 757 "bench/work/wide_100.cpp"
+            callDtor( 40, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 52:
+        {
+            // stmt ::= KW44 expr
+#line 0 "bench/work/wide_100.lem"
+#line 767 "bench/work/wide_100.cpp"
+            callDtor( 41, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 53:
+        {
+            // stmt ::= KW45 expr
+#line 0 "bench/work/wide_100.lem"
+#line 777 "bench/work/wide_100.cpp"
+            callDtor( 42, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 54:
+        {
+            // stmt ::= KW46 expr
+#line 0 "bench/work/wide_100.lem"
+#line 787 "bench/work/wide_100.cpp"
+            callDtor( 43, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 55:
+        {
+            // stmt ::= KW47 expr
+#line 0 "bench/work/wide_100.lem"
+#line 797 "bench/work/wide_100.cpp"
+            callDtor( 44, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 56:
+        {
+            // stmt ::= KW48 expr
+#line 0 "bench/work/wide_100.lem"
+#line 807 "bench/work/wide_100.cpp"
+            callDtor( 45, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 57:
+        {
+            // stmt ::= KW49 expr
+#line 0 "bench/work/wide_100.lem"
+#line 817 "bench/work/wide_100.cpp"
+            callDtor( 46, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 58:
+        {
+            // stmt ::= KW50 expr
+#line 0 "bench/work/wide_100.lem"
+#line 827 "bench/work/wide_100.cpp"
+            callDtor( 48, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 59:
+        {
+            // stmt ::= KW51 expr
+#line 0 "bench/work/wide_100.lem"
+#line 837 "bench/work/wide_100.cpp"
+            callDtor( 49, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 60:
+        {
+            // stmt ::= KW52 expr
+#line 0 "bench/work/wide_100.lem"
+#line 847 "bench/work/wide_100.cpp"
+            callDtor( 50, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 61:
+        {
+            // stmt ::= KW53 expr
+#line 0 "bench/work/wide_100.lem"
+#line 857 "bench/work/wide_100.cpp"
+            callDtor( 51, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 62:
+        {
+            // stmt ::= KW54 expr
+#line 0 "bench/work/wide_100.lem"
+#line 867 "bench/work/wide_100.cpp"
+            callDtor( 52, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 63:
+        {
+            // stmt ::= KW55 expr
+#line 0 "bench/work/wide_100.lem"
+#line 877 "bench/work/wide_100.cpp"
+            callDtor( 53, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 64:
+        {
+            // stmt ::= KW56 expr
+#line 0 "bench/work/wide_100.lem"
+#line 887 "bench/work/wide_100.cpp"
+            callDtor( 54, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 65:
+        {
+            // stmt ::= KW57 expr
+#line 0 "bench/work/wide_100.lem"
+#line 897 "bench/work/wide_100.cpp"
+            callDtor( 55, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 66:
+        {
+            // stmt ::= KW58 expr
+#line 0 "bench/work/wide_100.lem"
+#line 907 "bench/work/wide_100.cpp"
+            callDtor( 56, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 67:
+        {
+            // stmt ::= KW59 expr
+#line 0 "bench/work/wide_100.lem"
+#line 917 "bench/work/wide_100.cpp"
+            callDtor( 57, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 68:
+        {
+            // stmt ::= KW60 expr
+#line 0 "bench/work/wide_100.lem"
+#line 927 "bench/work/wide_100.cpp"
+            callDtor( 59, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 69:
+        {
+            // stmt ::= KW61 expr
+#line 0 "bench/work/wide_100.lem"
+#line 937 "bench/work/wide_100.cpp"
+            callDtor( 60, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 70:
+        {
+            // stmt ::= KW62 expr
+#line 0 "bench/work/wide_100.lem"
+#line 947 "bench/work/wide_100.cpp"
+            callDtor( 61, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 71:
+        {
+            // stmt ::= KW63 expr
+#line 0 "bench/work/wide_100.lem"
+#line 957 "bench/work/wide_100.cpp"
+            callDtor( 62, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 72:
+        {
+            // stmt ::= KW64 expr
+#line 0 "bench/work/wide_100.lem"
+#line 967 "bench/work/wide_100.cpp"
+            callDtor( 63, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 73:
+        {
+            // stmt ::= KW65 expr
+#line 0 "bench/work/wide_100.lem"
+#line 977 "bench/work/wide_100.cpp"
+            callDtor( 64, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 74:
+        {
+            // stmt ::= KW66 expr
+#line 0 "bench/work/wide_100.lem"
+#line 987 "bench/work/wide_100.cpp"
+            callDtor( 65, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 75:
+        {
+            // stmt ::= KW67 expr
+#line 0 "bench/work/wide_100.lem"
+#line 997 "bench/work/wide_100.cpp"
+            callDtor( 66, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 76:
+        {
+            // stmt ::= KW68 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1007 "bench/work/wide_100.cpp"
+            callDtor( 67, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 77:
+        {
+            // stmt ::= KW69 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1017 "bench/work/wide_100.cpp"
+            callDtor( 68, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 78:
+        {
+            // stmt ::= KW70 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1027 "bench/work/wide_100.cpp"
+            callDtor( 70, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 79:
+        {
+            // stmt ::= KW71 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1037 "bench/work/wide_100.cpp"
+            callDtor( 71, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 80:
+        {
+            // stmt ::= KW72 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1047 "bench/work/wide_100.cpp"
+            callDtor( 72, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 81:
+        {
+            // stmt ::= KW73 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1057 "bench/work/wide_100.cpp"
+            callDtor( 73, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 82:
+        {
+            // stmt ::= KW74 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1067 "bench/work/wide_100.cpp"
+            callDtor( 74, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 83:
+        {
+            // stmt ::= KW75 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1077 "bench/work/wide_100.cpp"
+            callDtor( 75, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 84:
+        {
+            // stmt ::= KW76 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1087 "bench/work/wide_100.cpp"
+            callDtor( 76, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 85:
+        {
+            // stmt ::= KW77 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1097 "bench/work/wide_100.cpp"
+            callDtor( 77, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 86:
+        {
+            // stmt ::= KW78 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1107 "bench/work/wide_100.cpp"
+            callDtor( 78, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 87:
+        {
+            // stmt ::= KW79 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1117 "bench/work/wide_100.cpp"
+            callDtor( 79, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 88:
+        {
+            // stmt ::= KW80 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1127 "bench/work/wide_100.cpp"
+            callDtor( 81, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 89:
+        {
+            // stmt ::= KW81 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1137 "bench/work/wide_100.cpp"
+            callDtor( 82, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 90:
+        {
+            // stmt ::= KW82 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1147 "bench/work/wide_100.cpp"
+            callDtor( 83, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 91:
+        {
+            // stmt ::= KW83 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1157 "bench/work/wide_100.cpp"
+            callDtor( 84, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 92:
+        {
+            // stmt ::= KW84 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1167 "bench/work/wide_100.cpp"
+            callDtor( 85, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 93:
+        {
+            // stmt ::= KW85 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1177 "bench/work/wide_100.cpp"
+            callDtor( 86, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 94:
+        {
+            // stmt ::= KW86 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1187 "bench/work/wide_100.cpp"
+            callDtor( 87, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 95:
+        {
+            // stmt ::= KW87 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1197 "bench/work/wide_100.cpp"
+            callDtor( 88, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 96:
+        {
+            // stmt ::= KW88 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1207 "bench/work/wide_100.cpp"
+            callDtor( 89, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 97:
+        {
+            // stmt ::= KW89 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1217 "bench/work/wide_100.cpp"
+            callDtor( 90, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 98:
+        {
+            // stmt ::= KW90 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1227 "bench/work/wide_100.cpp"
+            callDtor( 92, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        case 99:
+        {
+            // stmt ::= KW91 expr
+#line 0 "bench/work/wide_100.lem"
+#line 1237 "bench/work/wide_100.cpp"
+            callDtor( 93, rhsData[0] );
+            callDtor( 100, rhsData[1] );
+            break;
+        }
+
+        default:
+            throw "Unknown Rule Number";
+            break;
+    }
+
+    if ( PA_SHIFT == next )
+        shift( newVal, myRules[ruleNum].first, data );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::callDtor( int symIdx, privBenchImpl::Value &data )
+{
+    switch ( symIdx )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+        case 12:
+        case 13:
+        case 14:
+        case 15:
+        case 16:
+        case 17:
+        case 18:
+        case 19:
+        case 20:
+        case 21:
+        case 22:
+        case 23:
+        case 24:
+        case 25:
+        case 26:
+        case 27:
+        case 28:
+        case 29:
+        case 30:
+        case 31:
+        case 32:
+        case 33:
+        case 34:
+        case 35:
+        case 36:
+        case 37:
+        case 38:
+        case 39:
+        case 40:
+        case 41:
+        case 42:
+        case 43:
+        case 44:
+        case 45:
+        case 46:
+        case 47:
+        case 48:
+        case 49:
+        case 50:
+        case 51:
+        case 52:
+        case 53:
+        case 54:
+        case 55:
+        case 56:
+        case 57:
+        case 58:
+        case 59:
+        case 60:
+        case 61:
+        case 62:
+        case 63:
+        case 64:
+        case 65:
+        case 66:
+        case 67:
+        case 68:
+        case 69:
+        case 70:
+        case 71:
+        case 72:
+        case 73:
+        case 74:
+        case 75:
+        case 76:
+        case 77:
+        case 78:
+        case 79:
+        case 80:
+        case 81:
+        case 82:
+        case 83:
+        case 84:
+        case 85:
+        case 86:
+        case 87:
+        case 88:
+        case 89:
+        case 90:
+        case 91:
+        case 92:
+        case 93:
+        case 94:
+        case 95:
+        case 96:
+        case 97:
+        case 98:
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::popStack( void )
+{
+    callDtor( myStack.top().first.second, myStack.top().second );
+    myStack.pop();
+}
+
+
+////////////////////////////////////////
+
+
+ParserAct privBenchImpl::findParserAction( int &newVal, int tok )
+{
+    int stateNum;
+    ParserAct retval = PA_NOP;
+    bool found = false;
+
+    stateNum = myStack.empty() ? 0 : myStack.top().first.first;
+    ActionMap::iterator i = myStates[stateNum].find( tok );
+    if ( tok >= 0 && tok <= 105 )
+    {
+        if ( i != myStates[stateNum].end() )
+        {
+            retval = (*i).second.first;
+            newVal = (*i).second.second;
+            found = true;
+        }
+    }
+    else if ( ! myStates[stateNum].empty() )
+    {
+        retval = PA_NOP;
+        newVal = 0;
+        found = true;
+    }
+
+    if ( ! found )
+    {
+        retval = myStateDefaultActions[stateNum].first;
+        newVal = myStateDefaultActions[stateNum].second;
+    }
+    return retval;
+}
+
+
+////////////////////////////////////////
+
+
+static int theStateTable[766][4] =
+{
+    // State 0
+    { 0, 101, PA_ACCEPT, 0 },
+    // State 0
+    { 0, 103, PA_SHIFT, 1 },
+    // State 0
+    { 0, 105, PA_REDUCE, 1 },
+    // State 0 default action
+    { 0, -1, PA_REDUCE, 1 },
+    // State 1
+    { 1, 0, PA_REDUCE, 0 },
+    // State 1
+    { 1, 2, PA_SHIFT, 4 },
+    // State 1
+    { 1, 3, PA_SHIFT, 14 },
+    // State 1
+    { 1, 4, PA_SHIFT, 32 },
+    // State 1
+    { 1, 5, PA_SHIFT, 34 },
+    // State 1
+    { 1, 6, PA_SHIFT, 36 },
+    // State 1
+    { 1, 7, PA_SHIFT, 38 },
+    // State 1
+    { 1, 8, PA_SHIFT, 40 },
+    // State 1
+    { 1, 9, PA_SHIFT, 42 },
+    // State 1
+    { 1, 10, PA_SHIFT, 44 },
+    // State 1
+    { 1, 11, PA_SHIFT, 46 },
+    // State 1
+    { 1, 12, PA_SHIFT, 48 },
+    // State 1
+    { 1, 13, PA_SHIFT, 50 },
+    // State 1
+    { 1, 14, PA_SHIFT, 16 },
+    // State 1
+    { 1, 15, PA_SHIFT, 52 },
+    // State 1
+    { 1, 16, PA_SHIFT, 54 },
+    // State 1
+    { 1, 17, PA_SHIFT, 56 },
+    // State 1
+    { 1, 18, PA_SHIFT, 58 },
+    // State 1
+    { 1, 19, PA_SHIFT, 60 },
+    // State 1
+    { 1, 20, PA_SHIFT, 62 },
+    // State 1
+    { 1, 21, PA_SHIFT, 64 },
+    // State 1
+    { 1, 22, PA_SHIFT, 66 },
+    // State 1
+    { 1, 23, PA_SHIFT, 68 },
+    // State 1
+    { 1, 24, PA_SHIFT, 70 },
+    // State 1
+    { 1, 25, PA_SHIFT, 18 },
+    // State 1
+    { 1, 26, PA_SHIFT, 72 },
+    // State 1
+    { 1, 27, PA_SHIFT, 74 },
+    // State 1
+    { 1, 28, PA_SHIFT, 76 },
+    // State 1
+    { 1, 29, PA_SHIFT, 78 },
+    // State 1
+    { 1, 30, PA_SHIFT, 80 },
+    // State 1
+    { 1, 31, PA_SHIFT, 82 },
+    // State 1
+    { 1, 32, PA_SHIFT, 84 },
+    // State 1
+    { 1, 33, PA_SHIFT, 86 },
+    // State 1
+    { 1, 34, PA_SHIFT, 88 },
+    // State 1
+    { 1, 35, PA_SHIFT, 90 },
+    // State 1
+    { 1, 36, PA_SHIFT, 20 },
+    // State 1
+    { 1, 37, PA_SHIFT, 92 },
+    // State 1
+    { 1, 38, PA_SHIFT, 94 },
+    // State 1
+    { 1, 39, PA_SHIFT, 96 },
+    // State 1
+    { 1, 40, PA_SHIFT, 98 },
+    // State 1
+    { 1, 41, PA_SHIFT, 100 },
+    // State 1
+    { 1, 42, PA_SHIFT, 102 },
+    // State 1
+    { 1, 43, PA_SHIFT, 104 },
+    // State 1
+    { 1, 44, PA_SHIFT, 106 },
+    // State 1
+    { 1, 45, PA_SHIFT, 108 },
+    // State 1
+    { 1, 46, PA_SHIFT, 110 },
+    // State 1
+    { 1, 47, PA_SHIFT, 22 },
+    // State 1
+    { 1, 48, PA_SHIFT, 112 },
+    // State 1
+    { 1, 49, PA_SHIFT, 114 },
+    // State 1
+    { 1, 50, PA_SHIFT, 116 },
+    // State 1
+    { 1, 51, PA_SHIFT, 118 },
+    // State 1
+    { 1, 52, PA_SHIFT, 120 },
+    // State 1
+    { 1, 53, PA_SHIFT, 122 },
+    // State 1
+    { 1, 54, PA_SHIFT, 124 },
+    // State 1
+    { 1, 55, PA_SHIFT, 126 },
+    // State 1
+    { 1, 56, PA_SHIFT, 128 },
+    // State 1
+    { 1, 57, PA_SHIFT, 130 },
+    // State 1
+    { 1, 58, PA_SHIFT, 24 },
+    // State 1
+    { 1, 59, PA_SHIFT, 132 },
+    // State 1
+    { 1, 60, PA_SHIFT, 134 },
+    // State 1
+    { 1, 61, PA_SHIFT, 136 },
+    // State 1
+    { 1, 62, PA_SHIFT, 138 },
+    // State 1
+    { 1, 63, PA_SHIFT, 140 },
+    // State 1
+    { 1, 64, PA_SHIFT, 142 },
+    // State 1
+    { 1, 65, PA_SHIFT, 144 },
+    // State 1
+    { 1, 66, PA_SHIFT, 146 },
+    // State 1
+    { 1, 67, PA_SHIFT, 148 },
+    // State 1
+    { 1, 68, PA_SHIFT, 150 },
+    // State 1
+    { 1, 69, PA_SHIFT, 26 },
+    // State 1
+    { 1, 70, PA_SHIFT, 152 },
+    // State 1
+    { 1, 71, PA_SHIFT, 154 },
+    // State 1
+    { 1, 72, PA_SHIFT, 156 },
+    // State 1
+    { 1, 73, PA_SHIFT, 158 },
+    // State 1
+    { 1, 74, PA_SHIFT, 160 },
+    // State 1
+    { 1, 75, PA_SHIFT, 162 },
+    // State 1
+    { 1, 76, PA_SHIFT, 164 },
+    // State 1
+    { 1, 77, PA_SHIFT, 166 },
+    // State 1
+    { 1, 78, PA_SHIFT, 168 },
+    // State 1
+    { 1, 79, PA_SHIFT, 170 },
+    // State 1
+    { 1, 80, PA_SHIFT, 28 },
+    // State 1
+    { 1, 81, PA_SHIFT, 172 },
+    // State 1
+    { 1, 82, PA_SHIFT, 174 },
+    // State 1
+    { 1, 83, PA_SHIFT, 176 },
+    // State 1
+    { 1, 84, PA_SHIFT, 178 },
+    // State 1
+    { 1, 85, PA_SHIFT, 180 },
+    // State 1
+    { 1, 86, PA_SHIFT, 182 },
+    // State 1
+    { 1, 87, PA_SHIFT, 184 },
+    // State 1
+    { 1, 88, PA_SHIFT, 186 },
+    // State 1
+    { 1, 89, PA_SHIFT, 188 },
+    // State 1
+    { 1, 90, PA_SHIFT, 190 },
+    // State 1
+    { 1, 91, PA_SHIFT, 30 },
+    // State 1
+    { 1, 92, PA_SHIFT, 192 },
+    // State 1
+    { 1, 93, PA_SHIFT, 194 },
+    // State 1
+    { 1, 102, PA_SHIFT, 2 },
+    // State 2
+    { 2, 98, PA_SHIFT, 3 },
+    // State 3
+    { 3, 105, PA_REDUCE, 2 },
+    // State 3 default action
+    { 3, -1, PA_REDUCE, 2 },
+    // State 4
+    { 4, 1, PA_SHIFT, 8 },
+    // State 4
+    { 4, 94, PA_SHIFT, 10 },
+    // State 4
+    { 4, 95, PA_SHIFT, 9 },
+    // State 4
+    { 4, 100, PA_SHIFT, 5 },
+    // State 4
+    { 4, 104, PA_SHIFT, 13 },
+    // State 5
+    { 5, 96, PA_SHIFT, 6 },
+    // State 5
+    { 5, 98, PA_REDUCE, 8 },
+    // State 6
+    { 6, 1, PA_SHIFT, 8 },
+    // State 6
+    { 6, 94, PA_SHIFT, 10 },
+    // State 6
+    { 6, 95, PA_SHIFT, 9 },
+    // State 6
+    { 6, 104, PA_SHIFT, 7 },
+    // State 7
+    { 7, 105, PA_REDUCE, 3 },
+    // State 7 default action
+    { 7, -1, PA_REDUCE, 3 },
+    // State 8
+    { 8, 105, PA_REDUCE, 5 },
+    // State 8 default action
+    { 8, -1, PA_REDUCE, 5 },
+    // State 9
+    { 9, 105, PA_REDUCE, 6 },
+    // State 9 default action
+    { 9, -1, PA_REDUCE, 6 },
+    // State 10
+    { 10, 1, PA_SHIFT, 8 },
+    // State 10
+    { 10, 94, PA_SHIFT, 10 },
+    // State 10
+    { 10, 95, PA_SHIFT, 9 },
+    // State 10
+    { 10, 100, PA_SHIFT, 11 },
+    // State 10
+    { 10, 104, PA_SHIFT, 13 },
+    // State 11
+    { 11, 96, PA_SHIFT, 6 },
+    // State 11
+    { 11, 97, PA_SHIFT, 12 },
+    // State 12
+    { 12, 105, PA_REDUCE, 7 },
+    // State 12 default action
+    { 12, -1, PA_REDUCE, 7 },
+    // State 13
+    { 13, 105, PA_REDUCE, 4 },
+    // State 13 default action
+    { 13, -1, PA_REDUCE, 4 },
+    // State 14
+    { 14, 1, PA_SHIFT, 8 },
+    // State 14
+    { 14, 94, PA_SHIFT, 10 },
+    // State 14
+    { 14, 95, PA_SHIFT, 9 },
+    // State 14
+    { 14, 100, PA_SHIFT, 15 },
+    // State 14
+    { 14, 104, PA_SHIFT, 13 },
+    // State 15
+    { 15, 96, PA_SHIFT, 6 },
+    // State 15
+    { 15, 98, PA_REDUCE, 9 },
+    // State 16
+    { 16, 1, PA_SHIFT, 8 },
+    // State 16
+    { 16, 94, PA_SHIFT, 10 },
+    // State 16
+    { 16, 95, PA_SHIFT, 9 },
+    // State 16
+    { 16, 100, PA_SHIFT, 17 },
+    // State 16
+    { 16, 104, PA_SHIFT, 13 },
+    // State 17
+    { 17, 96, PA_SHIFT, 6 },
+    // State 17
+    { 17, 98, PA_REDUCE, 10 },
+    // State 18
+    { 18, 1, PA_SHIFT, 8 },
+    // State 18
+    { 18, 94, PA_SHIFT, 10 },
+    // State 18
+    { 18, 95, PA_SHIFT, 9 },
+    // State 18
+    { 18, 100, PA_SHIFT, 19 },
+    // State 18
+    { 18, 104, PA_SHIFT, 13 },
+    // State 19
+    { 19, 96, PA_SHIFT, 6 },
+    // State 19
+    { 19, 98, PA_REDUCE, 11 },
+    // State 20
+    { 20, 1, PA_SHIFT, 8 },
+    // State 20
+    { 20, 94, PA_SHIFT, 10 },
+    // State 20
+    { 20, 95, PA_SHIFT, 9 },
+    // State 20
+    { 20, 100, PA_SHIFT, 21 },
+    // State 20
+    { 20, 104, PA_SHIFT, 13 },
+    // State 21
+    { 21, 96, PA_SHIFT, 6 },
+    // State 21
+    { 21, 98, PA_REDUCE, 12 },
+    // State 22
+    { 22, 1, PA_SHIFT, 8 },
+    // State 22
+    { 22, 94, PA_SHIFT, 10 },
+    // State 22
+    { 22, 95, PA_SHIFT, 9 },
+    // State 22
+    { 22, 100, PA_SHIFT, 23 },
+    // State 22
+    { 22, 104, PA_SHIFT, 13 },
+    // State 23
+    { 23, 96, PA_SHIFT, 6 },
+    // State 23
+    { 23, 98, PA_REDUCE, 13 },
+    // State 24
+    { 24, 1, PA_SHIFT, 8 },
+    // State 24
+    { 24, 94, PA_SHIFT, 10 },
+    // State 24
+    { 24, 95, PA_SHIFT, 9 },
+    // State 24
+    { 24, 100, PA_SHIFT, 25 },
+    // State 24
+    { 24, 104, PA_SHIFT, 13 },
+    // State 25
+    { 25, 96, PA_SHIFT, 6 },
+    // State 25
+    { 25, 98, PA_REDUCE, 14 },
+    // State 26
+    { 26, 1, PA_SHIFT, 8 },
+    // State 26
+    { 26, 94, PA_SHIFT, 10 },
+    // State 26
+    { 26, 95, PA_SHIFT, 9 },
+    // State 26
+    { 26, 100, PA_SHIFT, 27 },
+    // State 26
+    { 26, 104, PA_SHIFT, 13 },
+    // State 27
+    { 27, 96, PA_SHIFT, 6 },
+    // State 27
+    { 27, 98, PA_REDUCE, 15 },
+    // State 28
+    { 28, 1, PA_SHIFT, 8 },
+    // State 28
+    { 28, 94, PA_SHIFT, 10 },
+    // State 28
+    { 28, 95, PA_SHIFT, 9 },
+    // State 28
+    { 28, 100, PA_SHIFT, 29 },
+    // State 28
+    { 28, 104, PA_SHIFT, 13 },
+    // State 29
+    { 29, 96, PA_SHIFT, 6 },
+    // State 29
+    { 29, 98, PA_REDUCE, 16 },
+    // State 30
+    { 30, 1, PA_SHIFT, 8 },
+    // State 30
+    { 30, 94, PA_SHIFT, 10 },
+    // State 30
+    { 30, 95, PA_SHIFT, 9 },
+    // State 30
+    { 30, 100, PA_SHIFT, 31 },
+    // State 30
+    { 30, 104, PA_SHIFT, 13 },
+    // State 31
+    { 31, 96, PA_SHIFT, 6 },
+    // State 31
+    { 31, 98, PA_REDUCE, 17 },
+    // State 32
+    { 32, 1, PA_SHIFT, 8 },
+    // State 32
+    { 32, 94, PA_SHIFT, 10 },
+    // State 32
+    { 32, 95, PA_SHIFT, 9 },
+    // State 32
+    { 32, 100, PA_SHIFT, 33 },
+    // State 32
+    { 32, 104, PA_SHIFT, 13 },
+    // State 33
+    { 33, 96, PA_SHIFT, 6 },
+    // State 33
+    { 33, 98, PA_REDUCE, 18 },
+    // State 34
+    { 34, 1, PA_SHIFT, 8 },
+    // State 34
+    { 34, 94, PA_SHIFT, 10 },
+    // State 34
+    { 34, 95, PA_SHIFT, 9 },
+    // State 34
+    { 34, 100, PA_SHIFT, 35 },
+    // State 34
+    { 34, 104, PA_SHIFT, 13 },
+    // State 35
+    { 35, 96, PA_SHIFT, 6 },
+    // State 35
+    { 35, 98, PA_REDUCE, 19 },
+    // State 36
+    { 36, 1, PA_SHIFT, 8 },
+    // State 36
+    { 36, 94, PA_SHIFT, 10 },
+    // State 36
+    { 36, 95, PA_SHIFT, 9 },
+    // State 36
+    { 36, 100, PA_SHIFT, 37 },
+    // State 36
+    { 36, 104, PA_SHIFT, 13 },
+    // State 37
+    { 37, 96, PA_SHIFT, 6 },
+    // State 37
+    { 37, 98, PA_REDUCE, 20 },
+    // State 38
+    { 38, 1, PA_SHIFT, 8 },
+    // State 38
+    { 38, 94, PA_SHIFT, 10 },
+    // State 38
+    { 38, 95, PA_SHIFT, 9 },
+    // State 38
+    { 38, 100, PA_SHIFT, 39 },
+    // State 38
+    { 38, 104, PA_SHIFT, 13 },
+    // State 39
+    { 39, 96, PA_SHIFT, 6 },
+    // State 39
+    { 39, 98, PA_REDUCE, 21 },
+    // State 40
+    { 40, 1, PA_SHIFT, 8 },
+    // State 40
+    { 40, 94, PA_SHIFT, 10 },
+    // State 40
+    { 40, 95, PA_SHIFT, 9 },
+    // State 40
+    { 40, 100, PA_SHIFT, 41 },
+    // State 40
+    { 40, 104, PA_SHIFT, 13 },
+    // State 41
+    { 41, 96, PA_SHIFT, 6 },
+    // State 41
+    { 41, 98, PA_REDUCE, 22 },
+    // State 42
+    { 42, 1, PA_SHIFT, 8 },
+    // State 42
+    { 42, 94, PA_SHIFT, 10 },
+    // State 42
+    { 42, 95, PA_SHIFT, 9 },
+    // State 42
+    { 42, 100, PA_SHIFT, 43 },
+    // State 42
+    { 42, 104, PA_SHIFT, 13 },
+    // State 43
+    { 43, 96, PA_SHIFT, 6 },
+    // State 43
+    { 43, 98, PA_REDUCE, 23 },
+    // State 44
+    { 44, 1, PA_SHIFT, 8 },
+    // State 44
+    { 44, 94, PA_SHIFT, 10 },
+    // State 44
+    { 44, 95, PA_SHIFT, 9 },
+    // State 44
+    { 44, 100, PA_SHIFT, 45 },
+    // State 44
+    { 44, 104, PA_SHIFT, 13 },
+    // State 45
+    { 45, 96, PA_SHIFT, 6 },
+    // State 45
+    { 45, 98, PA_REDUCE, 24 },
+    // State 46
+    { 46, 1, PA_SHIFT, 8 },
+    // State 46
+    { 46, 94, PA_SHIFT, 10 },
+    // State 46
+    { 46, 95, PA_SHIFT, 9 },
+    // State 46
+    { 46, 100, PA_SHIFT, 47 },
+    // State 46
+    { 46, 104, PA_SHIFT, 13 },
+    // State 47
+    { 47, 96, PA_SHIFT, 6 },
+    // State 47
+    { 47, 98, PA_REDUCE, 25 },
+    // State 48
+    { 48, 1, PA_SHIFT, 8 },
+    // State 48
+    { 48, 94, PA_SHIFT, 10 },
+    // State 48
+    { 48, 95, PA_SHIFT, 9 },
+    // State 48
+    { 48, 100, PA_SHIFT, 49 },
+    // State 48
+    { 48, 104, PA_SHIFT, 13 },
+    // State 49
+    { 49, 96, PA_SHIFT, 6 },
+    // State 49
+    { 49, 98, PA_REDUCE, 26 },
+    // State 50
+    { 50, 1, PA_SHIFT, 8 },
+    // State 50
+    { 50, 94, PA_SHIFT, 10 },
+    // State 50
+    { 50, 95, PA_SHIFT, 9 },
+    // State 50
+    { 50, 100, PA_SHIFT, 51 },
+    // State 50
+    { 50, 104, PA_SHIFT, 13 },
+    // State 51
+    { 51, 96, PA_SHIFT, 6 },
+    // State 51
+    { 51, 98, PA_REDUCE, 27 },
+    // State 52
+    { 52, 1, PA_SHIFT, 8 },
+    // State 52
+    { 52, 94, PA_SHIFT, 10 },
+    // State 52
+    { 52, 95, PA_SHIFT, 9 },
+    // State 52
+    { 52, 100, PA_SHIFT, 53 },
+    // State 52
+    { 52, 104, PA_SHIFT, 13 },
+    // State 53
+    { 53, 96, PA_SHIFT, 6 },
+    // State 53
+    { 53, 98, PA_REDUCE, 28 },
+    // State 54
+    { 54, 1, PA_SHIFT, 8 },
+    // State 54
+    { 54, 94, PA_SHIFT, 10 },
+    // State 54
+    { 54, 95, PA_SHIFT, 9 },
+    // State 54
+    { 54, 100, PA_SHIFT, 55 },
+    // State 54
+    { 54, 104, PA_SHIFT, 13 },
+    // State 55
+    { 55, 96, PA_SHIFT, 6 },
+    // State 55
+    { 55, 98, PA_REDUCE, 29 },
+    // State 56
+    { 56, 1, PA_SHIFT, 8 },
+    // State 56
+    { 56, 94, PA_SHIFT, 10 },
+    // State 56
+    { 56, 95, PA_SHIFT, 9 },
+    // State 56
+    { 56, 100, PA_SHIFT, 57 },
+    // State 56
+    { 56, 104, PA_SHIFT, 13 },
+    // State 57
+    { 57, 96, PA_SHIFT, 6 },
+    // State 57
+    { 57, 98, PA_REDUCE, 30 },
+    // State 58
+    { 58, 1, PA_SHIFT, 8 },
+    // State 58
+    { 58, 94, PA_SHIFT, 10 },
+    // State 58
+    { 58, 95, PA_SHIFT, 9 },
+    // State 58
+    { 58, 100, PA_SHIFT, 59 },
+    // State 58
+    { 58, 104, PA_SHIFT, 13 },
+    // State 59
+    { 59, 96, PA_SHIFT, 6 },
+    // State 59
+    { 59, 98, PA_REDUCE, 31 },
+    // State 60
+    { 60, 1, PA_SHIFT, 8 },
+    // State 60
+    { 60, 94, PA_SHIFT, 10 },
+    // State 60
+    { 60, 95, PA_SHIFT, 9 },
+    // State 60
+    { 60, 100, PA_SHIFT, 61 },
+    // State 60
+    { 60, 104, PA_SHIFT, 13 },
+    // State 61
+    { 61, 96, PA_SHIFT, 6 },
+    // State 61
+    { 61, 98, PA_REDUCE, 32 },
+    // State 62
+    { 62, 1, PA_SHIFT, 8 },
+    // State 62
+    { 62, 94, PA_SHIFT, 10 },
+    // State 62
+    { 62, 95, PA_SHIFT, 9 },
+    // State 62
+    { 62, 100, PA_SHIFT, 63 },
+    // State 62
+    { 62, 104, PA_SHIFT, 13 },
+    // State 63
+    { 63, 96, PA_SHIFT, 6 },
+    // State 63
+    { 63, 98, PA_REDUCE, 33 },
+    // State 64
+    { 64, 1, PA_SHIFT, 8 },
+    // State 64
+    { 64, 94, PA_SHIFT, 10 },
+    // State 64
+    { 64, 95, PA_SHIFT, 9 },
+    // State 64
+    { 64, 100, PA_SHIFT, 65 },
+    // State 64
+    { 64, 104, PA_SHIFT, 13 },
+    // State 65
+    { 65, 96, PA_SHIFT, 6 },
+    // State 65
+    { 65, 98, PA_REDUCE, 34 },
+    // State 66
+    { 66, 1, PA_SHIFT, 8 },
+    // State 66
+    { 66, 94, PA_SHIFT, 10 },
+    // State 66
+    { 66, 95, PA_SHIFT, 9 },
+    // State 66
+    { 66, 100, PA_SHIFT, 67 },
+    // State 66
+    { 66, 104, PA_SHIFT, 13 },
+    // State 67
+    { 67, 96, PA_SHIFT, 6 },
+    // State 67
+    { 67, 98, PA_REDUCE, 35 },
+    // State 68
+    { 68, 1, PA_SHIFT, 8 },
+    // State 68
+    { 68, 94, PA_SHIFT, 10 },
+    // State 68
+    { 68, 95, PA_SHIFT, 9 },
+    // State 68
+    { 68, 100, PA_SHIFT, 69 },
+    // State 68
+    { 68, 104, PA_SHIFT, 13 },
+    // State 69
+    { 69, 96, PA_SHIFT, 6 },
+    // State 69
+    { 69, 98, PA_REDUCE, 36 },
+    // State 70
+    { 70, 1, PA_SHIFT, 8 },
+    // State 70
+    { 70, 94, PA_SHIFT, 10 },
+    // State 70
+    { 70, 95, PA_SHIFT, 9 },
+    // State 70
+    { 70, 100, PA_SHIFT, 71 },
+    // State 70
+    { 70, 104, PA_SHIFT, 13 },
+    // State 71
+    { 71, 96, PA_SHIFT, 6 },
+    // State 71
+    { 71, 98, PA_REDUCE, 37 },
+    // State 72
+    { 72, 1, PA_SHIFT, 8 },
+    // State 72
+    { 72, 94, PA_SHIFT, 10 },
+    // State 72
+    { 72, 95, PA_SHIFT, 9 },
+    // State 72
+    { 72, 100, PA_SHIFT, 73 },
+    // State 72
+    { 72, 104, PA_SHIFT, 13 },
+    // State 73
+    { 73, 96, PA_SHIFT, 6 },
+    // State 73
+    { 73, 98, PA_REDUCE, 38 },
+    // State 74
+    { 74, 1, PA_SHIFT, 8 },
+    // State 74
+    { 74, 94, PA_SHIFT, 10 },
+    // State 74
+    { 74, 95, PA_SHIFT, 9 },
+    // State 74
+    { 74, 100, PA_SHIFT, 75 },
+    // State 74
+    { 74, 104, PA_SHIFT, 13 },
+    // State 75
+    { 75, 96, PA_SHIFT, 6 },
+    // State 75
+    { 75, 98, PA_REDUCE, 39 },
+    // State 76
+    { 76, 1, PA_SHIFT, 8 },
+    // State 76
+    { 76, 94, PA_SHIFT, 10 },
+    // State 76
+    { 76, 95, PA_SHIFT, 9 },
+    // State 76
+    { 76, 100, PA_SHIFT, 77 },
+    // State 76
+    { 76, 104, PA_SHIFT, 13 },
+    // State 77
+    { 77, 96, PA_SHIFT, 6 },
+    // State 77
+    { 77, 98, PA_REDUCE, 40 },
+    // State 78
+    { 78, 1, PA_SHIFT, 8 },
+    // State 78
+    { 78, 94, PA_SHIFT, 10 },
+    // State 78
+    { 78, 95, PA_SHIFT, 9 },
+    // State 78
+    { 78, 100, PA_SHIFT, 79 },
+    // State 78
+    { 78, 104, PA_SHIFT, 13 },
+    // State 79
+    { 79, 96, PA_SHIFT, 6 },
+    // State 79
+    { 79, 98, PA_REDUCE, 41 },
+    // State 80
+    { 80, 1, PA_SHIFT, 8 },
+    // State 80
+    { 80, 94, PA_SHIFT, 10 },
+    // State 80
+    { 80, 95, PA_SHIFT, 9 },
+    // State 80
+    { 80, 100, PA_SHIFT, 81 },
+    // State 80
+    { 80, 104, PA_SHIFT, 13 },
+    // State 81
+    { 81, 96, PA_SHIFT, 6 },
+    // State 81
+    { 81, 98, PA_REDUCE, 42 },
+    // State 82
+    { 82, 1, PA_SHIFT, 8 },
+    // State 82
+    { 82, 94, PA_SHIFT, 10 },
+    // State 82
+    { 82, 95, PA_SHIFT, 9 },
+    // State 82
+    { 82, 100, PA_SHIFT, 83 },
+    // State 82
+    { 82, 104, PA_SHIFT, 13 },
+    // State 83
+    { 83, 96, PA_SHIFT, 6 },
+    // State 83
+    { 83, 98, PA_REDUCE, 43 },
+    // State 84
+    { 84, 1, PA_SHIFT, 8 },
+    // State 84
+    { 84, 94, PA_SHIFT, 10 },
+    // State 84
+    { 84, 95, PA_SHIFT, 9 },
+    // State 84
+    { 84, 100, PA_SHIFT, 85 },
+    // State 84
+    { 84, 104, PA_SHIFT, 13 },
+    // State 85
+    { 85, 96, PA_SHIFT, 6 },
+    // State 85
+    { 85, 98, PA_REDUCE, 44 },
+    // State 86
+    { 86, 1, PA_SHIFT, 8 },
+    // State 86
+    { 86, 94, PA_SHIFT, 10 },
+    // State 86
+    { 86, 95, PA_SHIFT, 9 },
+    // State 86
+    { 86, 100, PA_SHIFT, 87 },
+    // State 86
+    { 86, 104, PA_SHIFT, 13 },
+    // State 87
+    { 87, 96, PA_SHIFT, 6 },
+    // State 87
+    { 87, 98, PA_REDUCE, 45 },
+    // State 88
+    { 88, 1, PA_SHIFT, 8 },
+    // State 88
+    { 88, 94, PA_SHIFT, 10 },
+    // State 88
+    { 88, 95, PA_SHIFT, 9 },
+    // State 88
+    { 88, 100, PA_SHIFT, 89 },
+    // State 88
+    { 88, 104, PA_SHIFT, 13 },
+    // State 89
+    { 89, 96, PA_SHIFT, 6 },
+    // State 89
+    { 89, 98, PA_REDUCE, 46 },
+    // State 90
+    { 90, 1, PA_SHIFT, 8 },
+    // State 90
+    { 90, 94, PA_SHIFT, 10 },
+    // State 90
+    { 90, 95, PA_SHIFT, 9 },
+    // State 90
+    { 90, 100, PA_SHIFT, 91 },
+    // State 90
+    { 90, 104, PA_SHIFT, 13 },
+    // State 91
+    { 91, 96, PA_SHIFT, 6 },
+    // State 91
+    { 91, 98, PA_REDUCE, 47 },
+    // State 92
+    { 92, 1, PA_SHIFT, 8 },
+    // State 92
+    { 92, 94, PA_SHIFT, 10 },
+    // State 92
+    { 92, 95, PA_SHIFT, 9 },
+    // State 92
+    { 92, 100, PA_SHIFT, 93 },
+    // State 92
+    { 92, 104, PA_SHIFT, 13 },
+    // State 93
+    { 93, 96, PA_SHIFT, 6 },
+    // State 93
+    { 93, 98, PA_REDUCE, 48 },
+    // State 94
+    { 94, 1, PA_SHIFT, 8 },
+    // State 94
+    { 94, 94, PA_SHIFT, 10 },
+    // State 94
+    { 94, 95, PA_SHIFT, 9 },
+    // State 94
+    { 94, 100, PA_SHIFT, 95 },
+    // State 94
+    { 94, 104, PA_SHIFT, 13 },
+    // State 95
+    { 95, 96, PA_SHIFT, 6 },
+    // State 95
+    { 95, 98, PA_REDUCE, 49 },
+    // State 96
+    { 96, 1, PA_SHIFT, 8 },
+    // State 96
+    { 96, 94, PA_SHIFT, 10 },
+    // State 96
+    { 96, 95, PA_SHIFT, 9 },
+    // State 96
+    { 96, 100, PA_SHIFT, 97 },
+    // State 96
+    { 96, 104, PA_SHIFT, 13 },
+    // State 97
+    { 97, 96, PA_SHIFT, 6 },
+    // State 97
+    { 97, 98, PA_REDUCE, 50 },
+    // State 98
+    { 98, 1, PA_SHIFT, 8 },
+    // State 98
+    { 98, 94, PA_SHIFT, 10 },
+    // State 98
+    { 98, 95, PA_SHIFT, 9 },
+    // State 98
+    { 98, 100, PA_SHIFT, 99 },
+    // State 98
+    { 98, 104, PA_SHIFT, 13 },
+    // State 99
+    { 99, 96, PA_SHIFT, 6 },
+    // State 99
+    { 99, 98, PA_REDUCE, 51 },
+    // State 100
+    { 100, 1, PA_SHIFT, 8 },
+    // State 100
+    { 100, 94, PA_SHIFT, 10 },
+    // State 100
+    { 100, 95, PA_SHIFT, 9 },
+    // State 100
+    { 100, 100, PA_SHIFT, 101 },
+    // State 100
+    { 100, 104, PA_SHIFT, 13 },
+    // State 101
+    { 101, 96, PA_SHIFT, 6 },
+    // State 101
+    { 101, 98, PA_REDUCE, 52 },
+    // State 102
+    { 102, 1, PA_SHIFT, 8 },
+    // State 102
+    { 102, 94, PA_SHIFT, 10 },
+    // State 102
+    { 102, 95, PA_SHIFT, 9 },
+    // State 102
+    { 102, 100, PA_SHIFT, 103 },
+    // State 102
+    { 102, 104, PA_SHIFT, 13 },
+    // State 103
+    { 103, 96, PA_SHIFT, 6 },
+    // State 103
+    { 103, 98, PA_REDUCE, 53 },
+    // State 104
+    { 104, 1, PA_SHIFT, 8 },
+    // State 104
+    { 104, 94, PA_SHIFT, 10 },
+    // State 104
+    { 104, 95, PA_SHIFT, 9 },
+    // State 104
+    { 104, 100, PA_SHIFT, 105 },
+    // State 104
+    { 104, 104, PA_SHIFT, 13 },
+    // State 105
+    { 105, 96, PA_SHIFT, 6 },
+    // State 105
+    { 105, 98, PA_REDUCE, 54 },
+    // State 106
+    { 106, 1, PA_SHIFT, 8 },
+    // State 106
+    { 106, 94, PA_SHIFT, 10 },
+    // State 106
+    { 106, 95, PA_SHIFT, 9 },
+    // State 106
+    { 106, 100, PA_SHIFT, 107 },
+    // State 106
+    { 106, 104, PA_SHIFT, 13 },
+    // State 107
+    { 107, 96, PA_SHIFT, 6 },
+    // State 107
+    { 107, 98, PA_REDUCE, 55 },
+    // State 108
+    { 108, 1, PA_SHIFT, 8 },
+    // State 108
+    { 108, 94, PA_SHIFT, 10 },
+    // State 108
+    { 108, 95, PA_SHIFT, 9 },
+    // State 108
+    { 108, 100, PA_SHIFT, 109 },
+    // State 108
+    { 108, 104, PA_SHIFT, 13 },
+    // State 109
+    { 109, 96, PA_SHIFT, 6 },
+    // State 109
+    { 109, 98, PA_REDUCE, 56 },
+    // State 110
+    { 110, 1, PA_SHIFT, 8 },
+    // State 110
+    { 110, 94, PA_SHIFT, 10 },
+    // State 110
+    { 110, 95, PA_SHIFT, 9 },
+    // State 110
+    { 110, 100, PA_SHIFT, 111 },
+    // State 110
+    { 110, 104, PA_SHIFT, 13 },
+    // State 111
+    { 111, 96, PA_SHIFT, 6 },
+    // State 111
+    { 111, 98, PA_REDUCE, 57 },
+    // State 112
+    { 112, 1, PA_SHIFT, 8 },
+    // State 112
+    { 112, 94, PA_SHIFT, 10 },
+    // State 112
+    { 112, 95, PA_SHIFT, 9 },
+    // State 112
+    { 112, 100, PA_SHIFT, 113 },
+    // State 112
+    { 112, 104, PA_SHIFT, 13 },
+    // State 113
+    { 113, 96, PA_SHIFT, 6 },
+    // State 113
+    { 113, 98, PA_REDUCE, 58 },
+    // State 114
+    { 114, 1, PA_SHIFT, 8 },
+    // State 114
+    { 114, 94, PA_SHIFT, 10 },
+    // State 114
+    { 114, 95, PA_SHIFT, 9 },
+    // State 114
+    { 114, 100, PA_SHIFT, 115 },
+    // State 114
+    { 114, 104, PA_SHIFT, 13 },
+    // State 115
+    { 115, 96, PA_SHIFT, 6 },
+    // State 115
+    { 115, 98, PA_REDUCE, 59 },
+    // State 116
+    { 116, 1, PA_SHIFT, 8 },
+    // State 116
+    { 116, 94, PA_SHIFT, 10 },
+    // State 116
+    { 116, 95, PA_SHIFT, 9 },
+    // State 116
+    { 116, 100, PA_SHIFT, 117 },
+    // State 116
+    { 116, 104, PA_SHIFT, 13 },
+    // State 117
+    { 117, 96, PA_SHIFT, 6 },
+    // State 117
+    { 117, 98, PA_REDUCE, 60 },
+    // State 118
+    { 118, 1, PA_SHIFT, 8 },
+    // State 118
+    { 118, 94, PA_SHIFT, 10 },
+    // State 118
+    { 118, 95, PA_SHIFT, 9 },
+    // State 118
+    { 118, 100, PA_SHIFT, 119 },
+    // State 118
+    { 118, 104, PA_SHIFT, 13 },
+    // State 119
+    { 119, 96, PA_SHIFT, 6 },
+    // State 119
+    { 119, 98, PA_REDUCE, 61 },
+    // State 120
+    { 120, 1, PA_SHIFT, 8 },
+    // State 120
+    { 120, 94, PA_SHIFT, 10 },
+    // State 120
+    { 120, 95, PA_SHIFT, 9 },
+    // State 120
+    { 120, 100, PA_SHIFT, 121 },
+    // State 120
+    { 120, 104, PA_SHIFT, 13 },
+    // State 121
+    { 121, 96, PA_SHIFT, 6 },
+    // State 121
+    { 121, 98, PA_REDUCE, 62 },
+    // State 122
+    { 122, 1, PA_SHIFT, 8 },
+    // State 122
+    { 122, 94, PA_SHIFT, 10 },
+    // State 122
+    { 122, 95, PA_SHIFT, 9 },
+    // State 122
+    { 122, 100, PA_SHIFT, 123 },
+    // State 122
+    { 122, 104, PA_SHIFT, 13 },
+    // State 123
+    { 123, 96, PA_SHIFT, 6 },
+    // State 123
+    { 123, 98, PA_REDUCE, 63 },
+    // State 124
+    { 124, 1, PA_SHIFT, 8 },
+    // State 124
+    { 124, 94, PA_SHIFT, 10 },
+    // State 124
+    { 124, 95, PA_SHIFT, 9 },
+    // State 124
+    { 124, 100, PA_SHIFT, 125 },
+    // State 124
+    { 124, 104, PA_SHIFT, 13 },
+    // State 125
+    { 125, 96, PA_SHIFT, 6 },
+    // State 125
+    { 125, 98, PA_REDUCE, 64 },
+    // State 126
+    { 126, 1, PA_SHIFT, 8 },
+    // State 126
+    { 126, 94, PA_SHIFT, 10 },
+    // State 126
+    { 126, 95, PA_SHIFT, 9 },
+    // State 126
+    { 126, 100, PA_SHIFT, 127 },
+    // State 126
+    { 126, 104, PA_SHIFT, 13 },
+    // State 127
+    { 127, 96, PA_SHIFT, 6 },
+    // State 127
+    { 127, 98, PA_REDUCE, 65 },
+    // State 128
+    { 128, 1, PA_SHIFT, 8 },
+    // State 128
+    { 128, 94, PA_SHIFT, 10 },
+    // State 128
+    { 128, 95, PA_SHIFT, 9 },
+    // State 128
+    { 128, 100, PA_SHIFT, 129 },
+    // State 128
+    { 128, 104, PA_SHIFT, 13 },
+    // State 129
+    { 129, 96, PA_SHIFT, 6 },
+    // State 129
+    { 129, 98, PA_REDUCE, 66 },
+    // State 130
+    { 130, 1, PA_SHIFT, 8 },
+    // State 130
+    { 130, 94, PA_SHIFT, 10 },
+    // State 130
+    { 130, 95, PA_SHIFT, 9 },
+    // State 130
+    { 130, 100, PA_SHIFT, 131 },
+    // State 130
+    { 130, 104, PA_SHIFT, 13 },
+    // State 131
+    { 131, 96, PA_SHIFT, 6 },
+    // State 131
+    { 131, 98, PA_REDUCE, 67 },
+    // State 132
+    { 132, 1, PA_SHIFT, 8 },
+    // State 132
+    { 132, 94, PA_SHIFT, 10 },
+    // State 132
+    { 132, 95, PA_SHIFT, 9 },
+    // State 132
+    { 132, 100, PA_SHIFT, 133 },
+    // State 132
+    { 132, 104, PA_SHIFT, 13 },
+    // State 133
+    { 133, 96, PA_SHIFT, 6 },
+    // State 133
+    { 133, 98, PA_REDUCE, 68 },
+    // State 134
+    { 134, 1, PA_SHIFT, 8 },
+    // State 134
+    { 134, 94, PA_SHIFT, 10 },
+    // State 134
+    { 134, 95, PA_SHIFT, 9 },
+    // State 134
+    { 134, 100, PA_SHIFT, 135 },
+    // State 134
+    { 134, 104, PA_SHIFT, 13 },
+    // State 135
+    { 135, 96, PA_SHIFT, 6 },
+    // State 135
+    { 135, 98, PA_REDUCE, 69 },
+    // State 136
+    { 136, 1, PA_SHIFT, 8 },
+    // State 136
+    { 136, 94, PA_SHIFT, 10 },
+    // State 136
+    { 136, 95, PA_SHIFT, 9 },
+    // State 136
+    { 136, 100, PA_SHIFT, 137 },
+    // State 136
+    { 136, 104, PA_SHIFT, 13 },
+    // State 137
+    { 137, 96, PA_SHIFT, 6 },
+    // State 137
+    { 137, 98, PA_REDUCE, 70 },
+    // State 138
+    { 138, 1, PA_SHIFT, 8 },
+    // State 138
+    { 138, 94, PA_SHIFT, 10 },
+    // State 138
+    { 138, 95, PA_SHIFT, 9 },
+    // State 138
+    { 138, 100, PA_SHIFT, 139 },
+    // State 138
+    { 138, 104, PA_SHIFT, 13 },
+    // State 139
+    { 139, 96, PA_SHIFT, 6 },
+    // State 139
+    { 139, 98, PA_REDUCE, 71 },
+    // State 140
+    { 140, 1, PA_SHIFT, 8 },
+    // State 140
+    { 140, 94, PA_SHIFT, 10 },
+    // State 140
+    { 140, 95, PA_SHIFT, 9 },
+    // State 140
+    { 140, 100, PA_SHIFT, 141 },
+    // State 140
+    { 140, 104, PA_SHIFT, 13 },
+    // State 141
+    { 141, 96, PA_SHIFT, 6 },
+    // State 141
+    { 141, 98, PA_REDUCE, 72 },
+    // State 142
+    { 142, 1, PA_SHIFT, 8 },
+    // State 142
+    { 142, 94, PA_SHIFT, 10 },
+    // State 142
+    { 142, 95, PA_SHIFT, 9 },
+    // State 142
+    { 142, 100, PA_SHIFT, 143 },
+    // State 142
+    { 142, 104, PA_SHIFT, 13 },
+    // State 143
+    { 143, 96, PA_SHIFT, 6 },
+    // State 143
+    { 143, 98, PA_REDUCE, 73 },
+    // State 144
+    { 144, 1, PA_SHIFT, 8 },
+    // State 144
+    { 144, 94, PA_SHIFT, 10 },
+    // State 144
+    { 144, 95, PA_SHIFT, 9 },
+    // State 144
+    { 144, 100, PA_SHIFT, 145 },
+    // State 144
+    { 144, 104, PA_SHIFT, 13 },
+    // State 145
+    { 145, 96, PA_SHIFT, 6 },
+    // State 145
+    { 145, 98, PA_REDUCE, 74 },
+    // State 146
+    { 146, 1, PA_SHIFT, 8 },
+    // State 146
+    { 146, 94, PA_SHIFT, 10 },
+    // State 146
+    { 146, 95, PA_SHIFT, 9 },
+    // State 146
+    { 146, 100, PA_SHIFT, 147 },
+    // State 146
+    { 146, 104, PA_SHIFT, 13 },
+    // State 147
+    { 147, 96, PA_SHIFT, 6 },
+    // State 147
+    { 147, 98, PA_REDUCE, 75 },
+    // State 148
+    { 148, 1, PA_SHIFT, 8 },
+    // State 148
+    { 148, 94, PA_SHIFT, 10 },
+    // State 148
+    { 148, 95, PA_SHIFT, 9 },
+    // State 148
+    { 148, 100, PA_SHIFT, 149 },
+    // State 148
+    { 148, 104, PA_SHIFT, 13 },
+    // State 149
+    { 149, 96, PA_SHIFT, 6 },
+    // State 149
+    { 149, 98, PA_REDUCE, 76 },
+    // State 150
+    { 150, 1, PA_SHIFT, 8 },
+    // State 150
+    { 150, 94, PA_SHIFT, 10 },
+    // State 150
+    { 150, 95, PA_SHIFT, 9 },
+    // State 150
+    { 150, 100, PA_SHIFT, 151 },
+    // State 150
+    { 150, 104, PA_SHIFT, 13 },
+    // State 151
+    { 151, 96, PA_SHIFT, 6 },
+    // State 151
+    { 151, 98, PA_REDUCE, 77 },
+    // State 152
+    { 152, 1, PA_SHIFT, 8 },
+    // State 152
+    { 152, 94, PA_SHIFT, 10 },
+    // State 152
+    { 152, 95, PA_SHIFT, 9 },
+    // State 152
+    { 152, 100, PA_SHIFT, 153 },
+    // State 152
+    { 152, 104, PA_SHIFT, 13 },
+    // State 153
+    { 153, 96, PA_SHIFT, 6 },
+    // State 153
+    { 153, 98, PA_REDUCE, 78 },
+    // State 154
+    { 154, 1, PA_SHIFT, 8 },
+    // State 154
+    { 154, 94, PA_SHIFT, 10 },
+    // State 154
+    { 154, 95, PA_SHIFT, 9 },
+    // State 154
+    { 154, 100, PA_SHIFT, 155 },
+    // State 154
+    { 154, 104, PA_SHIFT, 13 },
+    // State 155
+    { 155, 96, PA_SHIFT, 6 },
+    // State 155
+    { 155, 98, PA_REDUCE, 79 },
+    // State 156
+    { 156, 1, PA_SHIFT, 8 },
+    // State 156
+    { 156, 94, PA_SHIFT, 10 },
+    // State 156
+    { 156, 95, PA_SHIFT, 9 },
+    // State 156
+    { 156, 100, PA_SHIFT, 157 },
+    // State 156
+    { 156, 104, PA_SHIFT, 13 },
+    // State 157
+    { 157, 96, PA_SHIFT, 6 },
+    // State 157
+    { 157, 98, PA_REDUCE, 80 },
+    // State 158
+    { 158, 1, PA_SHIFT, 8 },
+    // State 158
+    { 158, 94, PA_SHIFT, 10 },
+    // State 158
+    { 158, 95, PA_SHIFT, 9 },
+    // State 158
+    { 158, 100, PA_SHIFT, 159 },
+    // State 158
+    { 158, 104, PA_SHIFT, 13 },
+    // State 159
+    { 159, 96, PA_SHIFT, 6 },
+    // State 159
+    { 159, 98, PA_REDUCE, 81 },
+    // State 160
+    { 160, 1, PA_SHIFT, 8 },
+    // State 160
+    { 160, 94, PA_SHIFT, 10 },
+    // State 160
+    { 160, 95, PA_SHIFT, 9 },
+    // State 160
+    { 160, 100, PA_SHIFT, 161 },
+    // State 160
+    { 160, 104, PA_SHIFT, 13 },
+    // State 161
+    { 161, 96, PA_SHIFT, 6 },
+    // State 161
+    { 161, 98, PA_REDUCE, 82 },
+    // State 162
+    { 162, 1, PA_SHIFT, 8 },
+    // State 162
+    { 162, 94, PA_SHIFT, 10 },
+    // State 162
+    { 162, 95, PA_SHIFT, 9 },
+    // State 162
+    { 162, 100, PA_SHIFT, 163 },
+    // State 162
+    { 162, 104, PA_SHIFT, 13 },
+    // State 163
+    { 163, 96, PA_SHIFT, 6 },
+    // State 163
+    { 163, 98, PA_REDUCE, 83 },
+    // State 164
+    { 164, 1, PA_SHIFT, 8 },
+    // State 164
+    { 164, 94, PA_SHIFT, 10 },
+    // State 164
+    { 164, 95, PA_SHIFT, 9 },
+    // State 164
+    { 164, 100, PA_SHIFT, 165 },
+    // State 164
+    { 164, 104, PA_SHIFT, 13 },
+    // State 165
+    { 165, 96, PA_SHIFT, 6 },
+    // State 165
+    { 165, 98, PA_REDUCE, 84 },
+    // State 166
+    { 166, 1, PA_SHIFT, 8 },
+    // State 166
+    { 166, 94, PA_SHIFT, 10 },
+    // State 166
+    { 166, 95, PA_SHIFT, 9 },
+    // State 166
+    { 166, 100, PA_SHIFT, 167 },
+    // State 166
+    { 166, 104, PA_SHIFT, 13 },
+    // State 167
+    { 167, 96, PA_SHIFT, 6 },
+    // State 167
+    { 167, 98, PA_REDUCE, 85 },
+    // State 168
+    { 168, 1, PA_SHIFT, 8 },
+    // State 168
+    { 168, 94, PA_SHIFT, 10 },
+    // State 168
+    { 168, 95, PA_SHIFT, 9 },
+    // State 168
+    { 168, 100, PA_SHIFT, 169 },
+    // State 168
+    { 168, 104, PA_SHIFT, 13 },
+    // State 169
+    { 169, 96, PA_SHIFT, 6 },
+    // State 169
+    { 169, 98, PA_REDUCE, 86 },
+    // State 170
+    { 170, 1, PA_SHIFT, 8 },
+    // State 170
+    { 170, 94, PA_SHIFT, 10 },
+    // State 170
+    { 170, 95, PA_SHIFT, 9 },
+    // State 170
+    { 170, 100, PA_SHIFT, 171 },
+    // State 170
+    { 170, 104, PA_SHIFT, 13 },
+    // State 171
+    { 171, 96, PA_SHIFT, 6 },
+    // State 171
+    { 171, 98, PA_REDUCE, 87 },
+    // State 172
+    { 172, 1, PA_SHIFT, 8 },
+    // State 172
+    { 172, 94, PA_SHIFT, 10 },
+    // State 172
+    { 172, 95, PA_SHIFT, 9 },
+    // State 172
+    { 172, 100, PA_SHIFT, 173 },
+    // State 172
+    { 172, 104, PA_SHIFT, 13 },
+    // State 173
+    { 173, 96, PA_SHIFT, 6 },
+    // State 173
+    { 173, 98, PA_REDUCE, 88 },
+    // State 174
+    { 174, 1, PA_SHIFT, 8 },
+    // State 174
+    { 174, 94, PA_SHIFT, 10 },
+    // State 174
+    { 174, 95, PA_SHIFT, 9 },
+    // State 174
+    { 174, 100, PA_SHIFT, 175 },
+    // State 174
+    { 174, 104, PA_SHIFT, 13 },
+    // State 175
+    { 175, 96, PA_SHIFT, 6 },
+    // State 175
+    { 175, 98, PA_REDUCE, 89 },
+    // State 176
+    { 176, 1, PA_SHIFT, 8 },
+    // State 176
+    { 176, 94, PA_SHIFT, 10 },
+    // State 176
+    { 176, 95, PA_SHIFT, 9 },
+    // State 176
+    { 176, 100, PA_SHIFT, 177 },
+    // State 176
+    { 176, 104, PA_SHIFT, 13 },
+    // State 177
+    { 177, 96, PA_SHIFT, 6 },
+    // State 177
+    { 177, 98, PA_REDUCE, 90 },
+    // State 178
+    { 178, 1, PA_SHIFT, 8 },
+    // State 178
+    { 178, 94, PA_SHIFT, 10 },
+    // State 178
+    { 178, 95, PA_SHIFT, 9 },
+    // State 178
+    { 178, 100, PA_SHIFT, 179 },
+    // State 178
+    { 178, 104, PA_SHIFT, 13 },
+    // State 179
+    { 179, 96, PA_SHIFT, 6 },
+    // State 179
+    { 179, 98, PA_REDUCE, 91 },
+    // State 180
+    { 180, 1, PA_SHIFT, 8 },
+    // State 180
+    { 180, 94, PA_SHIFT, 10 },
+    // State 180
+    { 180, 95, PA_SHIFT, 9 },
+    // State 180
+    { 180, 100, PA_SHIFT, 181 },
+    // State 180
+    { 180, 104, PA_SHIFT, 13 },
+    // State 181
+    { 181, 96, PA_SHIFT, 6 },
+    // State 181
+    { 181, 98, PA_REDUCE, 92 },
+    // State 182
+    { 182, 1, PA_SHIFT, 8 },
+    // State 182
+    { 182, 94, PA_SHIFT, 10 },
+    // State 182
+    { 182, 95, PA_SHIFT, 9 },
+    // State 182
+    { 182, 100, PA_SHIFT, 183 },
+    // State 182
+    { 182, 104, PA_SHIFT, 13 },
+    // State 183
+    { 183, 96, PA_SHIFT, 6 },
+    // State 183
+    { 183, 98, PA_REDUCE, 93 },
+    // State 184
+    { 184, 1, PA_SHIFT, 8 },
+    // State 184
+    { 184, 94, PA_SHIFT, 10 },
+    // State 184
+    { 184, 95, PA_SHIFT, 9 },
+    // State 184
+    { 184, 100, PA_SHIFT, 185 },
+    // State 184
+    { 184, 104, PA_SHIFT, 13 },
+    // State 185
+    { 185, 96, PA_SHIFT, 6 },
+    // State 185
+    { 185, 98, PA_REDUCE, 94 },
+    // State 186
+    { 186, 1, PA_SHIFT, 8 },
+    // State 186
+    { 186, 94, PA_SHIFT, 10 },
+    // State 186
+    { 186, 95, PA_SHIFT, 9 },
+    // State 186
+    { 186, 100, PA_SHIFT, 187 },
+    // State 186
+    { 186, 104, PA_SHIFT, 13 },
+    // State 187
+    { 187, 96, PA_SHIFT, 6 },
+    // State 187
+    { 187, 98, PA_REDUCE, 95 },
+    // State 188
+    { 188, 1, PA_SHIFT, 8 },
+    // State 188
+    { 188, 94, PA_SHIFT, 10 },
+    // State 188
+    { 188, 95, PA_SHIFT, 9 },
+    // State 188
+    { 188, 100, PA_SHIFT, 189 },
+    // State 188
+    { 188, 104, PA_SHIFT, 13 },
+    // State 189
+    { 189, 96, PA_SHIFT, 6 },
+    // State 189
+    { 189, 98, PA_REDUCE, 96 },
+    // State 190
+    { 190, 1, PA_SHIFT, 8 },
+    // State 190
+    { 190, 94, PA_SHIFT, 10 },
+    // State 190
+    { 190, 95, PA_SHIFT, 9 },
+    // State 190
+    { 190, 100, PA_SHIFT, 191 },
+    // State 190
+    { 190, 104, PA_SHIFT, 13 },
+    // State 191
+    { 191, 96, PA_SHIFT, 6 },
+    // State 191
+    { 191, 98, PA_REDUCE, 97 },
+    // State 192
+    { 192, 1, PA_SHIFT, 8 },
+    // State 192
+    { 192, 94, PA_SHIFT, 10 },
+    // State 192
+    { 192, 95, PA_SHIFT, 9 },
+    // State 192
+    { 192, 100, PA_SHIFT, 193 },
+    // State 192
+    { 192, 104, PA_SHIFT, 13 },
+    // State 193
+    { 193, 96, PA_SHIFT, 6 },
+    // State 193
+    { 193, 98, PA_REDUCE, 98 },
+    // State 194
+    { 194, 1, PA_SHIFT, 8 },
+    // State 194
+    { 194, 94, PA_SHIFT, 10 },
+    // State 194
+    { 194, 95, PA_SHIFT, 9 },
+    // State 194
+    { 194, 100, PA_SHIFT, 195 },
+    // State 194
+    { 194, 104, PA_SHIFT, 13 },
+    // State 195
+    { 195, 96, PA_SHIFT, 6 },
+    // State 195
+    { 195, 98, PA_REDUCE, 99 },
+};
+
+
+static int theRuleTable[100][2] =
+{
+    // prog ::= stmts
+    { 101, 1 }, 
+    // stmts ::=
+    { 103, 0 }, 
+    // stmts ::= stmts stmt SEMI
+    { 103, 3 }, 
+    // expr ::= expr PLUS term
+    { 100, 3 }, 
+    // expr ::= term
+    { 100, 1 }, 
+    // term ::= ID
+    { 104, 1 }, 
+    // term ::= NUM
+    { 104, 1 }, 
+    // term ::= LP expr RP
+    { 104, 3 }, 
+    // stmt ::= KW0 expr
+    { 102, 2 }, 
+    // stmt ::= KW1 expr
+    { 102, 2 }, 
+    // stmt ::= KW2 expr
+    { 102, 2 }, 
+    // stmt ::= KW3 expr
+    { 102, 2 }, 
+    // stmt ::= KW4 expr
+    { 102, 2 }, 
+    // stmt ::= KW5 expr
+    { 102, 2 }, 
+    // stmt ::= KW6 expr
+    { 102, 2 }, 
+    // stmt ::= KW7 expr
+    { 102, 2 }, 
+    // stmt ::= KW8 expr
+    { 102, 2 }, 
+    // stmt ::= KW9 expr
+    { 102, 2 }, 
+    // stmt ::= KW10 expr
+    { 102, 2 }, 
+    // stmt ::= KW11 expr
+    { 102, 2 }, 
+    // stmt ::= KW12 expr
+    { 102, 2 }, 
+    // stmt ::= KW13 expr
+    { 102, 2 }, 
+    // stmt ::= KW14 expr
+    { 102, 2 }, 
+    // stmt ::= KW15 expr
+    { 102, 2 }, 
+    // stmt ::= KW16 expr
+    { 102, 2 }, 
+    // stmt ::= KW17 expr
+    { 102, 2 }, 
+    // stmt ::= KW18 expr
+    { 102, 2 }, 
+    // stmt ::= KW19 expr
+    { 102, 2 }, 
+    // stmt ::= KW20 expr
+    { 102, 2 }, 
+    // stmt ::= KW21 expr
+    { 102, 2 }, 
+    // stmt ::= KW22 expr
+    { 102, 2 }, 
+    // stmt ::= KW23 expr
+    { 102, 2 }, 
+    // stmt ::= KW24 expr
+    { 102, 2 }, 
+    // stmt ::= KW25 expr
+    { 102, 2 }, 
+    // stmt ::= KW26 expr
+    { 102, 2 }, 
+    // stmt ::= KW27 expr
+    { 102, 2 }, 
+    // stmt ::= KW28 expr
+    { 102, 2 }, 
+    // stmt ::= KW29 expr
+    { 102, 2 }, 
+    // stmt ::= KW30 expr
+    { 102, 2 }, 
+    // stmt ::= KW31 expr
+    { 102, 2 }, 
+    // stmt ::= KW32 expr
+    { 102, 2 }, 
+    // stmt ::= KW33 expr
+    { 102, 2 }, 
+    // stmt ::= KW34 expr
+    { 102, 2 }, 
+    // stmt ::= KW35 expr
+    { 102, 2 }, 
+    // stmt ::= KW36 expr
+    { 102, 2 }, 
+    // stmt ::= KW37 expr
+    { 102, 2 }, 
+    // stmt ::= KW38 expr
+    { 102, 2 }, 
+    // stmt ::= KW39 expr
+    { 102, 2 }, 
+    // stmt ::= KW40 expr
+    { 102, 2 }, 
+    // stmt ::= KW41 expr
+    { 102, 2 }, 
+    // stmt ::= KW42 expr
+    { 102, 2 }, 
+    // stmt ::= KW43 expr
+    { 102, 2 }, 
+    // stmt ::= KW44 expr
+    { 102, 2 }, 
+    // stmt ::= KW45 expr
+    { 102, 2 }, 
+    // stmt ::= KW46 expr
+    { 102, 2 }, 
+    // stmt ::= KW47 expr
+    { 102, 2 }, 
+    // stmt ::= KW48 expr
+    { 102, 2 }, 
+    // stmt ::= KW49 expr
+    { 102, 2 }, 
+    // stmt ::= KW50 expr
+    { 102, 2 }, 
+    // stmt ::= KW51 expr
+    { 102, 2 }, 
+    // stmt ::= KW52 expr
+    { 102, 2 }, 
+    // stmt ::= KW53 expr
+    { 102, 2 }, 
+    // stmt ::= KW54 expr
+    { 102, 2 }, 
+    // stmt ::= KW55 expr
+    { 102, 2 }, 
+    // stmt ::= KW56 expr
+    { 102, 2 }, 
+    // stmt ::= KW57 expr
+    { 102, 2 }, 
+    // stmt ::= KW58 expr
+    { 102, 2 }, 
+    // stmt ::= KW59 expr
+    { 102, 2 }, 
+    // stmt ::= KW60 expr
+    { 102, 2 }, 
+    // stmt ::= KW61 expr
+    { 102, 2 }, 
+    // stmt ::= KW62 expr
+    { 102, 2 }, 
+    // stmt ::= KW63 expr
+    { 102, 2 }, 
+    // stmt ::= KW64 expr
+    { 102, 2 }, 
+    // stmt ::= KW65 expr
+    { 102, 2 }, 
+    // stmt ::= KW66 expr
+    { 102, 2 }, 
+    // stmt ::= KW67 expr
+    { 102, 2 }, 
+    // stmt ::= KW68 expr
+    { 102, 2 }, 
+    // stmt ::= KW69 expr
+    { 102, 2 }, 
+    // stmt ::= KW70 expr
+    { 102, 2 }, 
+    // stmt ::= KW71 expr
+    { 102, 2 }, 
+    // stmt ::= KW72 expr
+    { 102, 2 }, 
+    // stmt ::= KW73 expr
+    { 102, 2 }, 
+    // stmt ::= KW74 expr
+    { 102, 2 }, 
+    // stmt ::= KW75 expr
+    { 102, 2 }, 
+    // stmt ::= KW76 expr
+    { 102, 2 }, 
+    // stmt ::= KW77 expr
+    { 102, 2 }, 
+    // stmt ::= KW78 expr
+    { 102, 2 }, 
+    // stmt ::= KW79 expr
+    { 102, 2 }, 
+    // stmt ::= KW80 expr
+    { 102, 2 }, 
+    // stmt ::= KW81 expr
+    { 102, 2 }, 
+    // stmt ::= KW82 expr
+    { 102, 2 }, 
+    // stmt ::= KW83 expr
+    { 102, 2 }, 
+    // stmt ::= KW84 expr
+    { 102, 2 }, 
+    // stmt ::= KW85 expr
+    { 102, 2 }, 
+    // stmt ::= KW86 expr
+    { 102, 2 }, 
+    // stmt ::= KW87 expr
+    { 102, 2 }, 
+    // stmt ::= KW88 expr
+    { 102, 2 }, 
+    // stmt ::= KW89 expr
+    { 102, 2 }, 
+    // stmt ::= KW90 expr
+    { 102, 2 }, 
+    // stmt ::= KW91 expr
+    { 102, 2 }, 
+};
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::initTables( void )
+{
+    myStates.assign( 196, ActionMap() );
+    myStateDefaultActions.assign( 196, ActionEntry(PA_ERROR,-2) );
+    for ( int i = 0; i < 766; ++i )
+    {
+        if ( theStateTable[i][1] == -1 )
+            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+        else
+            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+    }
+
+
+    // Rule Table
+
+    myRules.reserve( 100 );
+    for ( int i = 0; i < 100; ++i )
+        myRules.push_back( RuleInfo( theRuleTable[i][0], theRuleTable[i][1] ) );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::syntaxError( Bench::Terminal tok, privBenchImpl::Value &data )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parseFailed( void )
+{
+}
@@ -0,0 +1,132 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        ID = 1,
+        KW0 = 2,
+        KW1 = 3,
+        KW10 = 4,
+        KW11 = 5,
+        KW12 = 6,
+        KW13 = 7,
+        KW14 = 8,
+        KW15 = 9,
+        KW16 = 10,
+        KW17 = 11,
+        KW18 = 12,
+        KW19 = 13,
+        KW2 = 14,
+        KW20 = 15,
+        KW21 = 16,
+        KW22 = 17,
+        KW23 = 18,
+        KW24 = 19,
+        KW25 = 20,
+        KW26 = 21,
+        KW27 = 22,
+        KW28 = 23,
+        KW29 = 24,
+        KW3 = 25,
+        KW30 = 26,
+        KW31 = 27,
+        KW32 = 28,
+        KW33 = 29,
+        KW34 = 30,
+        KW35 = 31,
+        KW36 = 32,
+        KW37 = 33,
+        KW38 = 34,
+        KW39 = 35,
+        KW4 = 36,
+        KW40 = 37,
+        KW41 = 38,
+        KW42 = 39,
+        KW43 = 40,
+        KW44 = 41,
+        KW45 = 42,
+        KW46 = 43,
+        KW47 = 44,
+        KW48 = 45,
+        KW49 = 46,
+        KW5 = 47,
+        KW50 = 48,
+        KW51 = 49,
+        KW52 = 50,
+        KW53 = 51,
+        KW54 = 52,
+        KW55 = 53,
+        KW56 = 54,
+        KW57 = 55,
+        KW58 = 56,
+        KW59 = 57,
+        KW6 = 58,
+        KW60 = 59,
+        KW61 = 60,
+        KW62 = 61,
+        KW63 = 62,
+        KW64 = 63,
+        KW65 = 64,
+        KW66 = 65,
+        KW67 = 66,
+        KW68 = 67,
+        KW69 = 68,
+        KW7 = 69,
+        KW70 = 70,
+        KW71 = 71,
+        KW72 = 72,
+        KW73 = 73,
+        KW74 = 74,
+        KW75 = 75,
+        KW76 = 76,
+        KW77 = 77,
+        KW78 = 78,
+        KW79 = 79,
+        KW8 = 80,
+        KW80 = 81,
+        KW81 = 82,
+        KW82 = 83,
+        KW83 = 84,
+        KW84 = 85,
+        KW85 = 86,
+        KW86 = 87,
+        KW87 = 88,
+        KW88 = 89,
+        KW89 = 90,
+        KW9 = 91,
+        KW90 = 92,
+        KW91 = 93,
+        LP = 94,
+        NUM = 95,
+        PLUS = 96,
+        RP = 97,
+        SEMI = 98
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
@@ -0,0 +1,29294 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#include <utility>
+#include <stack>
+#include <map>
+#include <vector>
+#include <iostream>
+
+
+#include "wide_1000.h"
+
+enum ParserAct
+{
+    PA_SHIFT,
+    PA_REDUCE,
+    PA_ERROR,
+    PA_ACCEPT,
+    PA_NOP
+};
+
+class privBenchImpl
+{
+public:
+
+    privBenchImpl( void );
+    ~privBenchImpl( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    struct Value
+    {
+        union
+        {
+            int tokenType;
+            int errorType;
+        };
+    };
+    // first is stack num, second is the symbol index
+    typedef std::pair<int,int> StackID;
+    typedef std::pair<StackID,Value> StackEntry;
+    typedef std::stack<StackEntry> ParseStack;
+
+    void shift( int newState, int symIdx, Value &data );
+    void reduce( int ruleNum );
+    void callDtor( int symIdx, Value &data );
+    void popStack( void );
+    ParserAct findParserAction( int &newVal, int tok );
+    void initTables( void );
+    void syntaxError( Bench::Terminal tok, Value &data );
+    void parseFailed( void );
+
+    ParseStack myStack;
+    int myErrCount;
+
+
+    typedef std::pair<ParserAct,int> ActionEntry;
+    typedef std::map<int,ActionEntry> ActionMap;
+    typedef std::vector<ActionMap> StateList;
+    typedef std::vector<ActionEntry> StateDefaultList;
+
+    StateList myStates;
+    StateDefaultList myStateDefaultActions;
+
+
+    // first is LHS, second is number of RHS
+    typedef std::pair<int,int> RuleInfo;
+    typedef std::vector<RuleInfo> RuleList;
+
+    RuleList myRules;
+};
+
+
+////////////////////////////////////////
+
+
+Bench::Bench( void )
+    : myImplementation( new privBenchImpl )
+{
+}
+
+
+////////////////////////////////////////
+
+
+Bench::~Bench( void )
+{
+    delete myImplementation;
+}
+
+
+////////////////////////////////////////
+
+
+void Bench::parse( Bench::Terminal tok, int value )
+{
+    myImplementation->parse( tok, value );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parse( Bench::Terminal tok, int value )
+{
+    int actVal;
+    ParserAct action;
+    bool errHit = false;
+    bool eoInput = (tok == Bench::EOF );
+    bool done = false;
+
+    if ( myStack.empty() )
+    {
+        if ( eoInput )
+            return;
+
+        myErrCount = -1;
+    }
+
+    privBenchImpl::Value data;
+    data.tokenType = value;
+
+    do
+    {
+        action = findParserAction( actVal, tok );
+        if ( PA_SHIFT == action )
+        {
+            shift( actVal, tok, data );
+            --myErrCount;
+            if ( eoInput && ! myStack.empty() )
+                tok = Bench::EOF;
+            else
+                done = true;
+        }
+        else if ( PA_REDUCE == action )
+        {
+            reduce( actVal );
+        }
+        else if ( PA_ERROR == action )
+        {
+            // Syntax error handling:
+            // 1. Call the %syntax_error function.
+            // 2. Pop stack until a state where we can shift the err symbol.
+            // 3. Shift the error symbol.
+            // 4. Set error count to three.
+            // 5. Begin accepting and shifting new tokens.
+            // 6. No new error processing will begin until 3 tokens are successful.
+            if ( myErrCount < 0 )
+            {
+                syntaxError( tok, data );
+            }
+            if ( myStack.top().first.first == 999 || errHit )
+            {
+                callDtor( static_cast<int>(tok), data );
+                done = true;
+            }
+            else
+            {
+                while ( ! myStack.empty() &&
+                        myStack.top().first.first != 999 )
+                {
+                    action = findParserAction( actVal, 999 );
+                    if ( action == PA_SHIFT )
+                        break;
+                    popStack();
+                }
+                if ( myStack.empty() || tok == Bench::EOF )
+                {
+                    callDtor( static_cast<int>(tok), data );
+                    parseFailed();
+                    done = true;
+                }
+                else if ( myStack.top().first.first != 999 )
+                {
+                    data.errorType = 0;
+                    shift( actVal, 999, data );
+                }
+            }
+            myErrCount = 3;
+            errHit = true;
+        }
+        else // ACCEPT == action || NOP == action
+        {
+            done = true;
+        }
+    } while ( ! done && ! myStack.empty() );
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::privBenchImpl( void )
+    : myErrCount( -1 )
+{
+    initTables();
+}
+
+
+////////////////////////////////////////
+
+
+privBenchImpl::~privBenchImpl( void )
+{
+    while ( ! myStack.empty() )
+        popStack();
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::shift( int newState, int symIdx, privBenchImpl::Value &data )
+{
+    StackEntry newItem = StackEntry( StackID( newState, symIdx ), data );
+    myStack.push( newItem );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::reduce( int ruleNum )
+{
+    int newVal;
+    ParserAct next;
+    privBenchImpl::Value data = { 0 };
+    std::vector<privBenchImpl::Value> rhsData;
+    for ( int i = 0, N = myRules[ruleNum].second; i != N; ++i )
+    {
+        if ( myStack.empty() )
+            rhsData.insert( rhsData.begin(), data );
+        else
+        {
+            rhsData.insert( rhsData.begin(), myStack.top().second );
+            myStack.pop();
+        }
+    }
+
+    next = findParserAction( newVal, myRules[ruleNum].first );
+
+    switch ( ruleNum )
+    {
+        case 0:
+        {
+            // prog ::= stmts
+#line 0 "bench/work/wide_1000.lem"
+#line 250 "bench/work/wide_1000.cpp"
+            callDtor( 1003, rhsData[0] );
+            break;
+        }
+
+        case 1:
+        {
+            // stmts ::=
+#line 0 "bench/work/wide_1000.lem"
+#line 259 "bench/work/wide_1000.cpp"
+            break;
+        }
+
+        case 2:
+        {
+            // stmts ::= stmts stmt SEMI
+#line 0 "bench/work/wide_1000.lem"
+#line 267 "bench/work/wide_1000.cpp"
+            callDtor( 1003, rhsData[0] );
+            callDtor( 1002, rhsData[1] );
+            callDtor( 998, rhsData[2] );
+            break;
+        }
+
+        case 3:
+        {
+            // expr ::= expr PLUS term
+#line 0 "bench/work/wide_1000.lem"
+#line 278 "bench/work/wide_1000.cpp"
+            callDtor( 1000, rhsData[0] );
+            callDtor( 996, rhsData[1] );
+            callDtor( 1004, rhsData[2] );
+            break;
+        }
+
+        case 4:
+        {
+            // expr ::= term
+#line 0 "bench/work/wide_1000.lem"
+#line 289 "bench/work/wide_1000.cpp"
+            callDtor( 1004, rhsData[0] );
+            break;
+        }
+
+        case 5:
+        {
+            // term ::= ID
+#line 0 "bench/work/wide_1000.lem"
+#line 298 "bench/work/wide_1000.cpp"
+            callDtor( 1, rhsData[0] );
+            break;
+        }
+
+        case 6:
+        {
+            // term ::= NUM
+#line 0 "bench/work/wide_1000.lem"
+#line 307 "bench/work/wide_1000.cpp"
+            callDtor( 995, rhsData[0] );
+            break;
+        }
+
+        case 7:
+        {
+            // term ::= LP expr RP
+#line 0 "bench/work/wide_1000.lem"
+#line 316 "bench/work/wide_1000.cpp"
+            callDtor( 994, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            callDtor( 997, rhsData[2] );
+            break;
+        }
+
+        case 8:
+        {
+            // stmt ::= KW0 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 327 "bench/work/wide_1000.cpp"
+            callDtor( 2, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 9:
+        {
+            // stmt ::= KW1 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 337 "bench/work/wide_1000.cpp"
+            callDtor( 3, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 10:
+        {
+            // stmt ::= KW2 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 347 "bench/work/wide_1000.cpp"
+            callDtor( 114, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 11:
+        {
+            // stmt ::= KW3 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 357 "bench/work/wide_1000.cpp"
+            callDtor( 225, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 12:
+        {
+            // stmt ::= KW4 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 367 "bench/work/wide_1000.cpp"
+            callDtor( 336, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 13:
+        {
+            // stmt ::= KW5 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 377 "bench/work/wide_1000.cpp"
+            callDtor( 447, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 14:
+        {
+            // stmt ::= KW6 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 387 "bench/work/wide_1000.cpp"
+            callDtor( 558, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 15:
+        {
+            // stmt ::= KW7 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 397 "bench/work/wide_1000.cpp"
+            callDtor( 669, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 16:
+        {
+            // stmt ::= KW8 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 407 "bench/work/wide_1000.cpp"
+            callDtor( 780, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 17:
+        {
+            // stmt ::= KW9 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 417 "bench/work/wide_1000.cpp"
+            callDtor( 891, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 18:
+        {
+            // stmt ::= KW10 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 427 "bench/work/wide_1000.cpp"
+            callDtor( 4, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 19:
+        {
+            // stmt ::= KW11 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 437 "bench/work/wide_1000.cpp"
+            callDtor( 15, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 20:
+        {
+            // stmt ::= KW12 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 447 "bench/work/wide_1000.cpp"
+            callDtor( 26, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 21:
+        {
+            // stmt ::= KW13 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 457 "bench/work/wide_1000.cpp"
+            callDtor( 37, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 22:
+        {
+            // stmt ::= KW14 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 467 "bench/work/wide_1000.cpp"
+            callDtor( 48, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 23:
+        {
+            // stmt ::= KW15 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 477 "bench/work/wide_1000.cpp"
+            callDtor( 59, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 24:
+        {
+            // stmt ::= KW16 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 487 "bench/work/wide_1000.cpp"
+            callDtor( 70, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 25:
+        {
+            // stmt ::= KW17 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 497 "bench/work/wide_1000.cpp"
+            callDtor( 81, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 26:
+        {
+            // stmt ::= KW18 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 507 "bench/work/wide_1000.cpp"
+            callDtor( 92, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 27:
+        {
+            // stmt ::= KW19 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 517 "bench/work/wide_1000.cpp"
+            callDtor( 103, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 28:
+        {
+            // stmt ::= KW20 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 527 "bench/work/wide_1000.cpp"
+            callDtor( 115, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 29:
+        {
+            // stmt ::= KW21 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 537 "bench/work/wide_1000.cpp"
+            callDtor( 126, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 30:
+        {
+            // stmt ::= KW22 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 547 "bench/work/wide_1000.cpp"
+            callDtor( 137, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 31:
+        {
+            // stmt ::= KW23 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 557 "bench/work/wide_1000.cpp"
+            callDtor( 148, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 32:
+        {
+            // stmt ::= KW24 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 567 "bench/work/wide_1000.cpp"
+            callDtor( 159, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 33:
+        {
+            // stmt ::= KW25 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 577 "bench/work/wide_1000.cpp"
+            callDtor( 170, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 34:
+        {
+            // stmt ::= KW26 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 587 "bench/work/wide_1000.cpp"
+            callDtor( 181, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 35:
+        {
+            // stmt ::= KW27 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 597 "bench/work/wide_1000.cpp"
+            callDtor( 192, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 36:
+        {
+            // stmt ::= KW28 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 607 "bench/work/wide_1000.cpp"
+            callDtor( 203, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 37:
+        {
+            // stmt ::= KW29 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 617 "bench/work/wide_1000.cpp"
+            callDtor( 214, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 38:
+        {
+            // stmt ::= KW30 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 627 "bench/work/wide_1000.cpp"
+            callDtor( 226, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 39:
+        {
+            // stmt ::= KW31 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 637 "bench/work/wide_1000.cpp"
+            callDtor( 237, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 40:
+        {
+            // stmt ::= KW32 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 647 "bench/work/wide_1000.cpp"
+            callDtor( 248, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 41:
+        {
+            // stmt ::= KW33 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 657 "bench/work/wide_1000.cpp"
+            callDtor( 259, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 42:
+        {
+            // stmt ::= KW34 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 667 "bench/work/wide_1000.cpp"
+            callDtor( 270, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 43:
+        {
+            // stmt ::= KW35 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 677 "bench/work/wide_1000.cpp"
+            callDtor( 281, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 44:
+        {
+            // stmt ::= KW36 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 687 "bench/work/wide_1000.cpp"
+            callDtor( 292, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 45:
+        {
+            // stmt ::= KW37 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 697 "bench/work/wide_1000.cpp"
+            callDtor( 303, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 46:
+        {
+            // stmt ::= KW38 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 707 "bench/work/wide_1000.cpp"
+            callDtor( 314, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 47:
+        {
+            // stmt ::= KW39 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 717 "bench/work/wide_1000.cpp"
+            callDtor( 325, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 48:
+        {
+            // stmt ::= KW40 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 727 "bench/work/wide_1000.cpp"
+            callDtor( 337, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 49:
+        {
+            // stmt ::= KW41 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 737 "bench/work/wide_1000.cpp"
+            callDtor( 348, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 50:
+        {
+            // stmt ::= KW42 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 747 "bench/work/wide_1000.cpp"
+            callDtor( 359, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 51:
+        {
+            // stmt ::= KW43 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 757 "bench/work/wide_1000.cpp"
+            callDtor( 370, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 52:
+        {
+            // stmt ::= KW44 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 767 "bench/work/wide_1000.cpp"
+            callDtor( 381, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 53:
+        {
+            // stmt ::= KW45 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 777 "bench/work/wide_1000.cpp"
+            callDtor( 392, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 54:
+        {
+            // stmt ::= KW46 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 787 "bench/work/wide_1000.cpp"
+            callDtor( 403, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 55:
+        {
+            // stmt ::= KW47 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 797 "bench/work/wide_1000.cpp"
+            callDtor( 414, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 56:
+        {
+            // stmt ::= KW48 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 807 "bench/work/wide_1000.cpp"
+            callDtor( 425, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 57:
+        {
+            // stmt ::= KW49 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 817 "bench/work/wide_1000.cpp"
+            callDtor( 436, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 58:
+        {
+            // stmt ::= KW50 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 827 "bench/work/wide_1000.cpp"
+            callDtor( 448, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 59:
+        {
+            // stmt ::= KW51 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 837 "bench/work/wide_1000.cpp"
+            callDtor( 459, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 60:
+        {
+            // stmt ::= KW52 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 847 "bench/work/wide_1000.cpp"
+            callDtor( 470, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 61:
+        {
+            // stmt ::= KW53 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 857 "bench/work/wide_1000.cpp"
+            callDtor( 481, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 62:
+        {
+            // stmt ::= KW54 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 867 "bench/work/wide_1000.cpp"
+            callDtor( 492, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 63:
+        {
+            // stmt ::= KW55 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 877 "bench/work/wide_1000.cpp"
+            callDtor( 503, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 64:
+        {
+            // stmt ::= KW56 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 887 "bench/work/wide_1000.cpp"
+            callDtor( 514, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 65:
+        {
+            // stmt ::= KW57 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 897 "bench/work/wide_1000.cpp"
+            callDtor( 525, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 66:
+        {
+            // stmt ::= KW58 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 907 "bench/work/wide_1000.cpp"
+            callDtor( 536, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 67:
+        {
+            // stmt ::= KW59 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 917 "bench/work/wide_1000.cpp"
+            callDtor( 547, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 68:
+        {
+            // stmt ::= KW60 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 927 "bench/work/wide_1000.cpp"
+            callDtor( 559, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 69:
+        {
+            // stmt ::= KW61 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 937 "bench/work/wide_1000.cpp"
+            callDtor( 570, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 70:
+        {
+            // stmt ::= KW62 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 947 "bench/work/wide_1000.cpp"
+            callDtor( 581, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 71:
+        {
+            // stmt ::= KW63 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 957 "bench/work/wide_1000.cpp"
+            callDtor( 592, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 72:
+        {
+            // stmt ::= KW64 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 967 "bench/work/wide_1000.cpp"
+            callDtor( 603, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 73:
+        {
+            // stmt ::= KW65 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 977 "bench/work/wide_1000.cpp"
+            callDtor( 614, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 74:
+        {
+            // stmt ::= KW66 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 987 "bench/work/wide_1000.cpp"
+            callDtor( 625, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 75:
+        {
+            // stmt ::= KW67 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 997 "bench/work/wide_1000.cpp"
+            callDtor( 636, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 76:
+        {
+            // stmt ::= KW68 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1007 "bench/work/wide_1000.cpp"
+            callDtor( 647, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 77:
+        {
+            // stmt ::= KW69 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1017 "bench/work/wide_1000.cpp"
+            callDtor( 658, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 78:
+        {
+            // stmt ::= KW70 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1027 "bench/work/wide_1000.cpp"
+            callDtor( 670, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 79:
+        {
+            // stmt ::= KW71 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1037 "bench/work/wide_1000.cpp"
+            callDtor( 681, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 80:
+        {
+            // stmt ::= KW72 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1047 "bench/work/wide_1000.cpp"
+            callDtor( 692, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 81:
+        {
+            // stmt ::= KW73 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1057 "bench/work/wide_1000.cpp"
+            callDtor( 703, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 82:
+        {
+            // stmt ::= KW74 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1067 "bench/work/wide_1000.cpp"
+            callDtor( 714, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 83:
+        {
+            // stmt ::= KW75 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1077 "bench/work/wide_1000.cpp"
+            callDtor( 725, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 84:
+        {
+            // stmt ::= KW76 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1087 "bench/work/wide_1000.cpp"
+            callDtor( 736, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 85:
+        {
+            // stmt ::= KW77 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1097 "bench/work/wide_1000.cpp"
+            callDtor( 747, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 86:
+        {
+            // stmt ::= KW78 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1107 "bench/work/wide_1000.cpp"
+            callDtor( 758, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 87:
+        {
+            // stmt ::= KW79 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1117 "bench/work/wide_1000.cpp"
+            callDtor( 769, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 88:
+        {
+            // stmt ::= KW80 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1127 "bench/work/wide_1000.cpp"
+            callDtor( 781, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 89:
+        {
+            // stmt ::= KW81 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1137 "bench/work/wide_1000.cpp"
+            callDtor( 792, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 90:
+        {
+            // stmt ::= KW82 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1147 "bench/work/wide_1000.cpp"
+            callDtor( 803, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 91:
+        {
+            // stmt ::= KW83 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1157 "bench/work/wide_1000.cpp"
+            callDtor( 814, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 92:
+        {
+            // stmt ::= KW84 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1167 "bench/work/wide_1000.cpp"
+            callDtor( 825, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 93:
+        {
+            // stmt ::= KW85 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1177 "bench/work/wide_1000.cpp"
+            callDtor( 836, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 94:
+        {
+            // stmt ::= KW86 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1187 "bench/work/wide_1000.cpp"
+            callDtor( 847, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 95:
+        {
+            // stmt ::= KW87 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1197 "bench/work/wide_1000.cpp"
+            callDtor( 858, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 96:
+        {
+            // stmt ::= KW88 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1207 "bench/work/wide_1000.cpp"
+            callDtor( 869, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 97:
+        {
+            // stmt ::= KW89 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1217 "bench/work/wide_1000.cpp"
+            callDtor( 880, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 98:
+        {
+            // stmt ::= KW90 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1227 "bench/work/wide_1000.cpp"
+            callDtor( 892, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 99:
+        {
+            // stmt ::= KW91 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1237 "bench/work/wide_1000.cpp"
+            callDtor( 903, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 100:
+        {
+            // stmt ::= KW92 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1247 "bench/work/wide_1000.cpp"
+            callDtor( 914, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 101:
+        {
+            // stmt ::= KW93 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1257 "bench/work/wide_1000.cpp"
+            callDtor( 925, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 102:
+        {
+            // stmt ::= KW94 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1267 "bench/work/wide_1000.cpp"
+            callDtor( 936, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 103:
+        {
+            // stmt ::= KW95 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1277 "bench/work/wide_1000.cpp"
+            callDtor( 947, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 104:
+        {
+            // stmt ::= KW96 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1287 "bench/work/wide_1000.cpp"
+            callDtor( 958, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 105:
+        {
+            // stmt ::= KW97 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1297 "bench/work/wide_1000.cpp"
+            callDtor( 969, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 106:
+        {
+            // stmt ::= KW98 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1307 "bench/work/wide_1000.cpp"
+            callDtor( 980, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 107:
+        {
+            // stmt ::= KW99 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1317 "bench/work/wide_1000.cpp"
+            callDtor( 991, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 108:
+        {
+            // stmt ::= KW100 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1327 "bench/work/wide_1000.cpp"
+            callDtor( 5, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 109:
+        {
+            // stmt ::= KW101 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1337 "bench/work/wide_1000.cpp"
+            callDtor( 6, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 110:
+        {
+            // stmt ::= KW102 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1347 "bench/work/wide_1000.cpp"
+            callDtor( 7, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 111:
+        {
+            // stmt ::= KW103 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1357 "bench/work/wide_1000.cpp"
+            callDtor( 8, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 112:
+        {
+            // stmt ::= KW104 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1367 "bench/work/wide_1000.cpp"
+            callDtor( 9, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 113:
+        {
+            // stmt ::= KW105 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1377 "bench/work/wide_1000.cpp"
+            callDtor( 10, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 114:
+        {
+            // stmt ::= KW106 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1387 "bench/work/wide_1000.cpp"
+            callDtor( 11, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 115:
+        {
+            // stmt ::= KW107 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1397 "bench/work/wide_1000.cpp"
+            callDtor( 12, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 116:
+        {
+            // stmt ::= KW108 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1407 "bench/work/wide_1000.cpp"
+            callDtor( 13, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 117:
+        {
+            // stmt ::= KW109 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1417 "bench/work/wide_1000.cpp"
+            callDtor( 14, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 118:
+        {
+            // stmt ::= KW110 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1427 "bench/work/wide_1000.cpp"
+            callDtor( 16, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 119:
+        {
+            // stmt ::= KW111 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1437 "bench/work/wide_1000.cpp"
+            callDtor( 17, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 120:
+        {
+            // stmt ::= KW112 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1447 "bench/work/wide_1000.cpp"
+            callDtor( 18, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 121:
+        {
+            // stmt ::= KW113 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1457 "bench/work/wide_1000.cpp"
+            callDtor( 19, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 122:
+        {
+            // stmt ::= KW114 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1467 "bench/work/wide_1000.cpp"
+            callDtor( 20, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 123:
+        {
+            // stmt ::= KW115 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1477 "bench/work/wide_1000.cpp"
+            callDtor( 21, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 124:
+        {
+            // stmt ::= KW116 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1487 "bench/work/wide_1000.cpp"
+            callDtor( 22, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 125:
+        {
+            // stmt ::= KW117 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1497 "bench/work/wide_1000.cpp"
+            callDtor( 23, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 126:
+        {
+            // stmt ::= KW118 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1507 "bench/work/wide_1000.cpp"
+            callDtor( 24, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 127:
+        {
+            // stmt ::= KW119 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1517 "bench/work/wide_1000.cpp"
+            callDtor( 25, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 128:
+        {
+            // stmt ::= KW120 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1527 "bench/work/wide_1000.cpp"
+            callDtor( 27, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 129:
+        {
+            // stmt ::= KW121 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1537 "bench/work/wide_1000.cpp"
+            callDtor( 28, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 130:
+        {
+            // stmt ::= KW122 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1547 "bench/work/wide_1000.cpp"
+            callDtor( 29, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 131:
+        {
+            // stmt ::= KW123 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1557 "bench/work/wide_1000.cpp"
+            callDtor( 30, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 132:
+        {
+            // stmt ::= KW124 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1567 "bench/work/wide_1000.cpp"
+            callDtor( 31, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 133:
+        {
+            // stmt ::= KW125 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1577 "bench/work/wide_1000.cpp"
+            callDtor( 32, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 134:
+        {
+            // stmt ::= KW126 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1587 "bench/work/wide_1000.cpp"
+            callDtor( 33, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 135:
+        {
+            // stmt ::= KW127 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1597 "bench/work/wide_1000.cpp"
+            callDtor( 34, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 136:
+        {
+            // stmt ::= KW128 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1607 "bench/work/wide_1000.cpp"
+            callDtor( 35, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 137:
+        {
+            // stmt ::= KW129 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1617 "bench/work/wide_1000.cpp"
+            callDtor( 36, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 138:
+        {
+            // stmt ::= KW130 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1627 "bench/work/wide_1000.cpp"
+            callDtor( 38, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 139:
+        {
+            // stmt ::= KW131 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1637 "bench/work/wide_1000.cpp"
+            callDtor( 39, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 140:
+        {
+            // stmt ::= KW132 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1647 "bench/work/wide_1000.cpp"
+            callDtor( 40, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 141:
+        {
+            // stmt ::= KW133 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1657 "bench/work/wide_1000.cpp"
+            callDtor( 41, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 142:
+        {
+            // stmt ::= KW134 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1667 "bench/work/wide_1000.cpp"
+            callDtor( 42, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 143:
+        {
+            // stmt ::= KW135 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1677 "bench/work/wide_1000.cpp"
+            callDtor( 43, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 144:
+        {
+            // stmt ::= KW136 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1687 "bench/work/wide_1000.cpp"
+            callDtor( 44, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 145:
+        {
+            // stmt ::= KW137 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1697 "bench/work/wide_1000.cpp"
+            callDtor( 45, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 146:
+        {
+            // stmt ::= KW138 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1707 "bench/work/wide_1000.cpp"
+            callDtor( 46, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 147:
+        {
+            // stmt ::= KW139 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1717 "bench/work/wide_1000.cpp"
+            callDtor( 47, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 148:
+        {
+            // stmt ::= KW140 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1727 "bench/work/wide_1000.cpp"
+            callDtor( 49, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 149:
+        {
+            // stmt ::= KW141 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1737 "bench/work/wide_1000.cpp"
+            callDtor( 50, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 150:
+        {
+            // stmt ::= KW142 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1747 "bench/work/wide_1000.cpp"
+            callDtor( 51, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 151:
+        {
+            // stmt ::= KW143 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1757 "bench/work/wide_1000.cpp"
+            callDtor( 52, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 152:
+        {
+            // stmt ::= KW144 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1767 "bench/work/wide_1000.cpp"
+            callDtor( 53, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 153:
+        {
+            // stmt ::= KW145 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1777 "bench/work/wide_1000.cpp"
+            callDtor( 54, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 154:
+        {
+            // stmt ::= KW146 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1787 "bench/work/wide_1000.cpp"
+            callDtor( 55, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 155:
+        {
+            // stmt ::= KW147 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1797 "bench/work/wide_1000.cpp"
+            callDtor( 56, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 156:
+        {
+            // stmt ::= KW148 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1807 "bench/work/wide_1000.cpp"
+            callDtor( 57, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 157:
+        {
+            // stmt ::= KW149 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1817 "bench/work/wide_1000.cpp"
+            callDtor( 58, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 158:
+        {
+            // stmt ::= KW150 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1827 "bench/work/wide_1000.cpp"
+            callDtor( 60, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 159:
+        {
+            // stmt ::= KW151 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1837 "bench/work/wide_1000.cpp"
+            callDtor( 61, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 160:
+        {
+            // stmt ::= KW152 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1847 "bench/work/wide_1000.cpp"
+            callDtor( 62, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 161:
+        {
+            // stmt ::= KW153 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1857 "bench/work/wide_1000.cpp"
+            callDtor( 63, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 162:
+        {
+            // stmt ::= KW154 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1867 "bench/work/wide_1000.cpp"
+            callDtor( 64, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 163:
+        {
+            // stmt ::= KW155 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1877 "bench/work/wide_1000.cpp"
+            callDtor( 65, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 164:
+        {
+            // stmt ::= KW156 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1887 "bench/work/wide_1000.cpp"
+            callDtor( 66, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 165:
+        {
+            // stmt ::= KW157 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1897 "bench/work/wide_1000.cpp"
+            callDtor( 67, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 166:
+        {
+            // stmt ::= KW158 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1907 "bench/work/wide_1000.cpp"
+            callDtor( 68, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 167:
+        {
+            // stmt ::= KW159 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1917 "bench/work/wide_1000.cpp"
+            callDtor( 69, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 168:
+        {
+            // stmt ::= KW160 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1927 "bench/work/wide_1000.cpp"
+            callDtor( 71, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 169:
+        {
+            // stmt ::= KW161 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1937 "bench/work/wide_1000.cpp"
+            callDtor( 72, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 170:
+        {
+            // stmt ::= KW162 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1947 "bench/work/wide_1000.cpp"
+            callDtor( 73, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 171:
+        {
+            // stmt ::= KW163 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1957 "bench/work/wide_1000.cpp"
+            callDtor( 74, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 172:
+        {
+            // stmt ::= KW164 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1967 "bench/work/wide_1000.cpp"
+            callDtor( 75, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 173:
+        {
+            // stmt ::= KW165 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1977 "bench/work/wide_1000.cpp"
+            callDtor( 76, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 174:
+        {
+            // stmt ::= KW166 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1987 "bench/work/wide_1000.cpp"
+            callDtor( 77, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 175:
+        {
+            // stmt ::= KW167 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 1997 "bench/work/wide_1000.cpp"
+            callDtor( 78, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 176:
+        {
+            // stmt ::= KW168 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2007 "bench/work/wide_1000.cpp"
+            callDtor( 79, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 177:
+        {
+            // stmt ::= KW169 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2017 "bench/work/wide_1000.cpp"
+            callDtor( 80, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 178:
+        {
+            // stmt ::= KW170 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2027 "bench/work/wide_1000.cpp"
+            callDtor( 82, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 179:
+        {
+            // stmt ::= KW171 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2037 "bench/work/wide_1000.cpp"
+            callDtor( 83, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 180:
+        {
+            // stmt ::= KW172 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2047 "bench/work/wide_1000.cpp"
+            callDtor( 84, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 181:
+        {
+            // stmt ::= KW173 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2057 "bench/work/wide_1000.cpp"
+            callDtor( 85, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 182:
+        {
+            // stmt ::= KW174 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2067 "bench/work/wide_1000.cpp"
+            callDtor( 86, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 183:
+        {
+            // stmt ::= KW175 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2077 "bench/work/wide_1000.cpp"
+            callDtor( 87, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 184:
+        {
+            // stmt ::= KW176 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2087 "bench/work/wide_1000.cpp"
+            callDtor( 88, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 185:
+        {
+            // stmt ::= KW177 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2097 "bench/work/wide_1000.cpp"
+            callDtor( 89, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 186:
+        {
+            // stmt ::= KW178 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2107 "bench/work/wide_1000.cpp"
+            callDtor( 90, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 187:
+        {
+            // stmt ::= KW179 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2117 "bench/work/wide_1000.cpp"
+            callDtor( 91, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 188:
+        {
+            // stmt ::= KW180 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2127 "bench/work/wide_1000.cpp"
+            callDtor( 93, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 189:
+        {
+            // stmt ::= KW181 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2137 "bench/work/wide_1000.cpp"
+            callDtor( 94, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 190:
+        {
+            // stmt ::= KW182 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2147 "bench/work/wide_1000.cpp"
+            callDtor( 95, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 191:
+        {
+            // stmt ::= KW183 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2157 "bench/work/wide_1000.cpp"
+            callDtor( 96, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 192:
+        {
+            // stmt ::= KW184 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2167 "bench/work/wide_1000.cpp"
+            callDtor( 97, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 193:
+        {
+            // stmt ::= KW185 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2177 "bench/work/wide_1000.cpp"
+            callDtor( 98, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 194:
+        {
+            // stmt ::= KW186 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2187 "bench/work/wide_1000.cpp"
+            callDtor( 99, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 195:
+        {
+            // stmt ::= KW187 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2197 "bench/work/wide_1000.cpp"
+            callDtor( 100, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 196:
+        {
+            // stmt ::= KW188 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2207 "bench/work/wide_1000.cpp"
+            callDtor( 101, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 197:
+        {
+            // stmt ::= KW189 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2217 "bench/work/wide_1000.cpp"
+            callDtor( 102, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 198:
+        {
+            // stmt ::= KW190 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2227 "bench/work/wide_1000.cpp"
+            callDtor( 104, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 199:
+        {
+            // stmt ::= KW191 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2237 "bench/work/wide_1000.cpp"
+            callDtor( 105, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 200:
+        {
+            // stmt ::= KW192 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2247 "bench/work/wide_1000.cpp"
+            callDtor( 106, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 201:
+        {
+            // stmt ::= KW193 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2257 "bench/work/wide_1000.cpp"
+            callDtor( 107, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 202:
+        {
+            // stmt ::= KW194 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2267 "bench/work/wide_1000.cpp"
+            callDtor( 108, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 203:
+        {
+            // stmt ::= KW195 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2277 "bench/work/wide_1000.cpp"
+            callDtor( 109, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 204:
+        {
+            // stmt ::= KW196 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2287 "bench/work/wide_1000.cpp"
+            callDtor( 110, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 205:
+        {
+            // stmt ::= KW197 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2297 "bench/work/wide_1000.cpp"
+            callDtor( 111, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 206:
+        {
+            // stmt ::= KW198 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2307 "bench/work/wide_1000.cpp"
+            callDtor( 112, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 207:
+        {
+            // stmt ::= KW199 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2317 "bench/work/wide_1000.cpp"
+            callDtor( 113, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 208:
+        {
+            // stmt ::= KW200 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2327 "bench/work/wide_1000.cpp"
+            callDtor( 116, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 209:
+        {
+            // stmt ::= KW201 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2337 "bench/work/wide_1000.cpp"
+            callDtor( 117, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 210:
+        {
+            // stmt ::= KW202 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2347 "bench/work/wide_1000.cpp"
+            callDtor( 118, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 211:
+        {
+            // stmt ::= KW203 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2357 "bench/work/wide_1000.cpp"
+            callDtor( 119, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 212:
+        {
+            // stmt ::= KW204 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2367 "bench/work/wide_1000.cpp"
+            callDtor( 120, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 213:
+        {
+            // stmt ::= KW205 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2377 "bench/work/wide_1000.cpp"
+            callDtor( 121, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 214:
+        {
+            // stmt ::= KW206 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2387 "bench/work/wide_1000.cpp"
+            callDtor( 122, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 215:
+        {
+            // stmt ::= KW207 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2397 "bench/work/wide_1000.cpp"
+            callDtor( 123, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 216:
+        {
+            // stmt ::= KW208 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2407 "bench/work/wide_1000.cpp"
+            callDtor( 124, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 217:
+        {
+            // stmt ::= KW209 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2417 "bench/work/wide_1000.cpp"
+            callDtor( 125, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 218:
+        {
+            // stmt ::= KW210 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2427 "bench/work/wide_1000.cpp"
+            callDtor( 127, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 219:
+        {
+            // stmt ::= KW211 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2437 "bench/work/wide_1000.cpp"
+            callDtor( 128, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 220:
+        {
+            // stmt ::= KW212 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2447 "bench/work/wide_1000.cpp"
+            callDtor( 129, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 221:
+        {
+            // stmt ::= KW213 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2457 "bench/work/wide_1000.cpp"
+            callDtor( 130, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 222:
+        {
+            // stmt ::= KW214 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2467 "bench/work/wide_1000.cpp"
+            callDtor( 131, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 223:
+        {
+            // stmt ::= KW215 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2477 "bench/work/wide_1000.cpp"
+            callDtor( 132, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 224:
+        {
+            // stmt ::= KW216 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2487 "bench/work/wide_1000.cpp"
+            callDtor( 133, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 225:
+        {
+            // stmt ::= KW217 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2497 "bench/work/wide_1000.cpp"
+            callDtor( 134, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 226:
+        {
+            // stmt ::= KW218 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2507 "bench/work/wide_1000.cpp"
+            callDtor( 135, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 227:
+        {
+            // stmt ::= KW219 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2517 "bench/work/wide_1000.cpp"
+            callDtor( 136, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 228:
+        {
+            // stmt ::= KW220 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2527 "bench/work/wide_1000.cpp"
+            callDtor( 138, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 229:
+        {
+            // stmt ::= KW221 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2537 "bench/work/wide_1000.cpp"
+            callDtor( 139, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 230:
+        {
+            // stmt ::= KW222 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2547 "bench/work/wide_1000.cpp"
+            callDtor( 140, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 231:
+        {
+            // stmt ::= KW223 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2557 "bench/work/wide_1000.cpp"
+            callDtor( 141, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 232:
+        {
+            // stmt ::= KW224 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2567 "bench/work/wide_1000.cpp"
+            callDtor( 142, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 233:
+        {
+            // stmt ::= KW225 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2577 "bench/work/wide_1000.cpp"
+            callDtor( 143, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 234:
+        {
+            // stmt ::= KW226 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2587 "bench/work/wide_1000.cpp"
+            callDtor( 144, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 235:
+        {
+            // stmt ::= KW227 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2597 "bench/work/wide_1000.cpp"
+            callDtor( 145, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 236:
+        {
+            // stmt ::= KW228 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2607 "bench/work/wide_1000.cpp"
+            callDtor( 146, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 237:
+        {
+            // stmt ::= KW229 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2617 "bench/work/wide_1000.cpp"
+            callDtor( 147, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 238:
+        {
+            // stmt ::= KW230 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2627 "bench/work/wide_1000.cpp"
+            callDtor( 149, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 239:
+        {
+            // stmt ::= KW231 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2637 "bench/work/wide_1000.cpp"
+            callDtor( 150, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 240:
+        {
+            // stmt ::= KW232 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2647 "bench/work/wide_1000.cpp"
+            callDtor( 151, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 241:
+        {
+            // stmt ::= KW233 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2657 "bench/work/wide_1000.cpp"
+            callDtor( 152, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 242:
+        {
+            // stmt ::= KW234 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2667 "bench/work/wide_1000.cpp"
+            callDtor( 153, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 243:
+        {
+            // stmt ::= KW235 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2677 "bench/work/wide_1000.cpp"
+            callDtor( 154, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 244:
+        {
+            // stmt ::= KW236 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2687 "bench/work/wide_1000.cpp"
+            callDtor( 155, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 245:
+        {
+            // stmt ::= KW237 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2697 "bench/work/wide_1000.cpp"
+            callDtor( 156, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 246:
+        {
+            // stmt ::= KW238 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2707 "bench/work/wide_1000.cpp"
+            callDtor( 157, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 247:
+        {
+            // stmt ::= KW239 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2717 "bench/work/wide_1000.cpp"
+            callDtor( 158, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 248:
+        {
+            // stmt ::= KW240 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2727 "bench/work/wide_1000.cpp"
+            callDtor( 160, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 249:
+        {
+            // stmt ::= KW241 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2737 "bench/work/wide_1000.cpp"
+            callDtor( 161, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 250:
+        {
+            // stmt ::= KW242 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2747 "bench/work/wide_1000.cpp"
+            callDtor( 162, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 251:
+        {
+            // stmt ::= KW243 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2757 "bench/work/wide_1000.cpp"
+            callDtor( 163, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 252:
+        {
+            // stmt ::= KW244 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2767 "bench/work/wide_1000.cpp"
+            callDtor( 164, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 253:
+        {
+            // stmt ::= KW245 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2777 "bench/work/wide_1000.cpp"
+            callDtor( 165, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 254:
+        {
+            // stmt ::= KW246 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2787 "bench/work/wide_1000.cpp"
+            callDtor( 166, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 255:
+        {
+            // stmt ::= KW247 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2797 "bench/work/wide_1000.cpp"
+            callDtor( 167, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 256:
+        {
+            // stmt ::= KW248 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2807 "bench/work/wide_1000.cpp"
+            callDtor( 168, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 257:
+        {
+            // stmt ::= KW249 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2817 "bench/work/wide_1000.cpp"
+            callDtor( 169, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 258:
+        {
+            // stmt ::= KW250 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2827 "bench/work/wide_1000.cpp"
+            callDtor( 171, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 259:
+        {
+            // stmt ::= KW251 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2837 "bench/work/wide_1000.cpp"
+            callDtor( 172, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 260:
+        {
+            // stmt ::= KW252 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2847 "bench/work/wide_1000.cpp"
+            callDtor( 173, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 261:
+        {
+            // stmt ::= KW253 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2857 "bench/work/wide_1000.cpp"
+            callDtor( 174, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 262:
+        {
+            // stmt ::= KW254 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2867 "bench/work/wide_1000.cpp"
+            callDtor( 175, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 263:
+        {
+            // stmt ::= KW255 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2877 "bench/work/wide_1000.cpp"
+            callDtor( 176, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 264:
+        {
+            // stmt ::= KW256 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2887 "bench/work/wide_1000.cpp"
+            callDtor( 177, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 265:
+        {
+            // stmt ::= KW257 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2897 "bench/work/wide_1000.cpp"
+            callDtor( 178, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 266:
+        {
+            // stmt ::= KW258 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2907 "bench/work/wide_1000.cpp"
+            callDtor( 179, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 267:
+        {
+            // stmt ::= KW259 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2917 "bench/work/wide_1000.cpp"
+            callDtor( 180, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 268:
+        {
+            // stmt ::= KW260 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2927 "bench/work/wide_1000.cpp"
+            callDtor( 182, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 269:
+        {
+            // stmt ::= KW261 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2937 "bench/work/wide_1000.cpp"
+            callDtor( 183, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 270:
+        {
+            // stmt ::= KW262 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2947 "bench/work/wide_1000.cpp"
+            callDtor( 184, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 271:
+        {
+            // stmt ::= KW263 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2957 "bench/work/wide_1000.cpp"
+            callDtor( 185, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 272:
+        {
+            // stmt ::= KW264 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2967 "bench/work/wide_1000.cpp"
+            callDtor( 186, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 273:
+        {
+            // stmt ::= KW265 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2977 "bench/work/wide_1000.cpp"
+            callDtor( 187, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 274:
+        {
+            // stmt ::= KW266 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2987 "bench/work/wide_1000.cpp"
+            callDtor( 188, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 275:
+        {
+            // stmt ::= KW267 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 2997 "bench/work/wide_1000.cpp"
+            callDtor( 189, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 276:
+        {
+            // stmt ::= KW268 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3007 "bench/work/wide_1000.cpp"
+            callDtor( 190, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 277:
+        {
+            // stmt ::= KW269 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3017 "bench/work/wide_1000.cpp"
+            callDtor( 191, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 278:
+        {
+            // stmt ::= KW270 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3027 "bench/work/wide_1000.cpp"
+            callDtor( 193, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 279:
+        {
+            // stmt ::= KW271 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3037 "bench/work/wide_1000.cpp"
+            callDtor( 194, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 280:
+        {
+            // stmt ::= KW272 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3047 "bench/work/wide_1000.cpp"
+            callDtor( 195, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 281:
+        {
+            // stmt ::= KW273 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3057 "bench/work/wide_1000.cpp"
+            callDtor( 196, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 282:
+        {
+            // stmt ::= KW274 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3067 "bench/work/wide_1000.cpp"
+            callDtor( 197, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 283:
+        {
+            // stmt ::= KW275 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3077 "bench/work/wide_1000.cpp"
+            callDtor( 198, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 284:
+        {
+            // stmt ::= KW276 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3087 "bench/work/wide_1000.cpp"
+            callDtor( 199, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 285:
+        {
+            // stmt ::= KW277 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3097 "bench/work/wide_1000.cpp"
+            callDtor( 200, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 286:
+        {
+            // stmt ::= KW278 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3107 "bench/work/wide_1000.cpp"
+            callDtor( 201, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 287:
+        {
+            // stmt ::= KW279 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3117 "bench/work/wide_1000.cpp"
+            callDtor( 202, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 288:
+        {
+            // stmt ::= KW280 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3127 "bench/work/wide_1000.cpp"
+            callDtor( 204, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 289:
+        {
+            // stmt ::= KW281 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3137 "bench/work/wide_1000.cpp"
+            callDtor( 205, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 290:
+        {
+            // stmt ::= KW282 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3147 "bench/work/wide_1000.cpp"
+            callDtor( 206, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 291:
+        {
+            // stmt ::= KW283 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3157 "bench/work/wide_1000.cpp"
+            callDtor( 207, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 292:
+        {
+            // stmt ::= KW284 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3167 "bench/work/wide_1000.cpp"
+            callDtor( 208, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 293:
+        {
+            // stmt ::= KW285 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3177 "bench/work/wide_1000.cpp"
+            callDtor( 209, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 294:
+        {
+            // stmt ::= KW286 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3187 "bench/work/wide_1000.cpp"
+            callDtor( 210, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 295:
+        {
+            // stmt ::= KW287 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3197 "bench/work/wide_1000.cpp"
+            callDtor( 211, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 296:
+        {
+            // stmt ::= KW288 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3207 "bench/work/wide_1000.cpp"
+            callDtor( 212, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 297:
+        {
+            // stmt ::= KW289 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3217 "bench/work/wide_1000.cpp"
+            callDtor( 213, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 298:
+        {
+            // stmt ::= KW290 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3227 "bench/work/wide_1000.cpp"
+            callDtor( 215, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 299:
+        {
+            // stmt ::= KW291 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3237 "bench/work/wide_1000.cpp"
+            callDtor( 216, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 300:
+        {
+            // stmt ::= KW292 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3247 "bench/work/wide_1000.cpp"
+            callDtor( 217, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 301:
+        {
+            // stmt ::= KW293 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3257 "bench/work/wide_1000.cpp"
+            callDtor( 218, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 302:
+        {
+            // stmt ::= KW294 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3267 "bench/work/wide_1000.cpp"
+            callDtor( 219, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 303:
+        {
+            // stmt ::= KW295 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3277 "bench/work/wide_1000.cpp"
+            callDtor( 220, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 304:
+        {
+            // stmt ::= KW296 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3287 "bench/work/wide_1000.cpp"
+            callDtor( 221, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 305:
+        {
+            // stmt ::= KW297 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3297 "bench/work/wide_1000.cpp"
+            callDtor( 222, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 306:
+        {
+            // stmt ::= KW298 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3307 "bench/work/wide_1000.cpp"
+            callDtor( 223, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 307:
+        {
+            // stmt ::= KW299 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3317 "bench/work/wide_1000.cpp"
+            callDtor( 224, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 308:
+        {
+            // stmt ::= KW300 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3327 "bench/work/wide_1000.cpp"
+            callDtor( 227, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 309:
+        {
+            // stmt ::= KW301 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3337 "bench/work/wide_1000.cpp"
+            callDtor( 228, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 310:
+        {
+            // stmt ::= KW302 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3347 "bench/work/wide_1000.cpp"
+            callDtor( 229, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 311:
+        {
+            // stmt ::= KW303 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3357 "bench/work/wide_1000.cpp"
+            callDtor( 230, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 312:
+        {
+            // stmt ::= KW304 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3367 "bench/work/wide_1000.cpp"
+            callDtor( 231, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 313:
+        {
+            // stmt ::= KW305 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3377 "bench/work/wide_1000.cpp"
+            callDtor( 232, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 314:
+        {
+            // stmt ::= KW306 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3387 "bench/work/wide_1000.cpp"
+            callDtor( 233, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 315:
+        {
+            // stmt ::= KW307 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3397 "bench/work/wide_1000.cpp"
+            callDtor( 234, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 316:
+        {
+            // stmt ::= KW308 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3407 "bench/work/wide_1000.cpp"
+            callDtor( 235, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 317:
+        {
+            // stmt ::= KW309 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3417 "bench/work/wide_1000.cpp"
+            callDtor( 236, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 318:
+        {
+            // stmt ::= KW310 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3427 "bench/work/wide_1000.cpp"
+            callDtor( 238, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 319:
+        {
+            // stmt ::= KW311 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3437 "bench/work/wide_1000.cpp"
+            callDtor( 239, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 320:
+        {
+            // stmt ::= KW312 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3447 "bench/work/wide_1000.cpp"
+            callDtor( 240, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 321:
+        {
+            // stmt ::= KW313 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3457 "bench/work/wide_1000.cpp"
+            callDtor( 241, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 322:
+        {
+            // stmt ::= KW314 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3467 "bench/work/wide_1000.cpp"
+            callDtor( 242, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 323:
+        {
+            // stmt ::= KW315 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3477 "bench/work/wide_1000.cpp"
+            callDtor( 243, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 324:
+        {
+            // stmt ::= KW316 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3487 "bench/work/wide_1000.cpp"
+            callDtor( 244, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 325:
+        {
+            // stmt ::= KW317 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3497 "bench/work/wide_1000.cpp"
+            callDtor( 245, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 326:
+        {
+            // stmt ::= KW318 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3507 "bench/work/wide_1000.cpp"
+            callDtor( 246, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 327:
+        {
+            // stmt ::= KW319 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3517 "bench/work/wide_1000.cpp"
+            callDtor( 247, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 328:
+        {
+            // stmt ::= KW320 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3527 "bench/work/wide_1000.cpp"
+            callDtor( 249, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 329:
+        {
+            // stmt ::= KW321 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3537 "bench/work/wide_1000.cpp"
+            callDtor( 250, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 330:
+        {
+            // stmt ::= KW322 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3547 "bench/work/wide_1000.cpp"
+            callDtor( 251, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 331:
+        {
+            // stmt ::= KW323 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3557 "bench/work/wide_1000.cpp"
+            callDtor( 252, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 332:
+        {
+            // stmt ::= KW324 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3567 "bench/work/wide_1000.cpp"
+            callDtor( 253, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 333:
+        {
+            // stmt ::= KW325 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3577 "bench/work/wide_1000.cpp"
+            callDtor( 254, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 334:
+        {
+            // stmt ::= KW326 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3587 "bench/work/wide_1000.cpp"
+            callDtor( 255, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 335:
+        {
+            // stmt ::= KW327 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3597 "bench/work/wide_1000.cpp"
+            callDtor( 256, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 336:
+        {
+            // stmt ::= KW328 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3607 "bench/work/wide_1000.cpp"
+            callDtor( 257, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 337:
+        {
+            // stmt ::= KW329 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3617 "bench/work/wide_1000.cpp"
+            callDtor( 258, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 338:
+        {
+            // stmt ::= KW330 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3627 "bench/work/wide_1000.cpp"
+            callDtor( 260, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 339:
+        {
+            // stmt ::= KW331 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3637 "bench/work/wide_1000.cpp"
+            callDtor( 261, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 340:
+        {
+            // stmt ::= KW332 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3647 "bench/work/wide_1000.cpp"
+            callDtor( 262, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 341:
+        {
+            // stmt ::= KW333 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3657 "bench/work/wide_1000.cpp"
+            callDtor( 263, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 342:
+        {
+            // stmt ::= KW334 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3667 "bench/work/wide_1000.cpp"
+            callDtor( 264, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 343:
+        {
+            // stmt ::= KW335 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3677 "bench/work/wide_1000.cpp"
+            callDtor( 265, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 344:
+        {
+            // stmt ::= KW336 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3687 "bench/work/wide_1000.cpp"
+            callDtor( 266, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 345:
+        {
+            // stmt ::= KW337 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3697 "bench/work/wide_1000.cpp"
+            callDtor( 267, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 346:
+        {
+            // stmt ::= KW338 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3707 "bench/work/wide_1000.cpp"
+            callDtor( 268, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 347:
+        {
+            // stmt ::= KW339 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3717 "bench/work/wide_1000.cpp"
+            callDtor( 269, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 348:
+        {
+            // stmt ::= KW340 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3727 "bench/work/wide_1000.cpp"
+            callDtor( 271, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 349:
+        {
+            // stmt ::= KW341 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3737 "bench/work/wide_1000.cpp"
+            callDtor( 272, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 350:
+        {
+            // stmt ::= KW342 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3747 "bench/work/wide_1000.cpp"
+            callDtor( 273, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 351:
+        {
+            // stmt ::= KW343 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3757 "bench/work/wide_1000.cpp"
+            callDtor( 274, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 352:
+        {
+            // stmt ::= KW344 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3767 "bench/work/wide_1000.cpp"
+            callDtor( 275, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 353:
+        {
+            // stmt ::= KW345 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3777 "bench/work/wide_1000.cpp"
+            callDtor( 276, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 354:
+        {
+            // stmt ::= KW346 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3787 "bench/work/wide_1000.cpp"
+            callDtor( 277, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 355:
+        {
+            // stmt ::= KW347 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3797 "bench/work/wide_1000.cpp"
+            callDtor( 278, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 356:
+        {
+            // stmt ::= KW348 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3807 "bench/work/wide_1000.cpp"
+            callDtor( 279, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 357:
+        {
+            // stmt ::= KW349 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3817 "bench/work/wide_1000.cpp"
+            callDtor( 280, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 358:
+        {
+            // stmt ::= KW350 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3827 "bench/work/wide_1000.cpp"
+            callDtor( 282, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 359:
+        {
+            // stmt ::= KW351 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3837 "bench/work/wide_1000.cpp"
+            callDtor( 283, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 360:
+        {
+            // stmt ::= KW352 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3847 "bench/work/wide_1000.cpp"
+            callDtor( 284, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 361:
+        {
+            // stmt ::= KW353 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3857 "bench/work/wide_1000.cpp"
+            callDtor( 285, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 362:
+        {
+            // stmt ::= KW354 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3867 "bench/work/wide_1000.cpp"
+            callDtor( 286, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 363:
+        {
+            // stmt ::= KW355 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3877 "bench/work/wide_1000.cpp"
+            callDtor( 287, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 364:
+        {
+            // stmt ::= KW356 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3887 "bench/work/wide_1000.cpp"
+            callDtor( 288, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 365:
+        {
+            // stmt ::= KW357 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3897 "bench/work/wide_1000.cpp"
+            callDtor( 289, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 366:
+        {
+            // stmt ::= KW358 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3907 "bench/work/wide_1000.cpp"
+            callDtor( 290, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 367:
+        {
+            // stmt ::= KW359 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3917 "bench/work/wide_1000.cpp"
+            callDtor( 291, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 368:
+        {
+            // stmt ::= KW360 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3927 "bench/work/wide_1000.cpp"
+            callDtor( 293, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 369:
+        {
+            // stmt ::= KW361 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3937 "bench/work/wide_1000.cpp"
+            callDtor( 294, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 370:
+        {
+            // stmt ::= KW362 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3947 "bench/work/wide_1000.cpp"
+            callDtor( 295, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 371:
+        {
+            // stmt ::= KW363 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3957 "bench/work/wide_1000.cpp"
+            callDtor( 296, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 372:
+        {
+            // stmt ::= KW364 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3967 "bench/work/wide_1000.cpp"
+            callDtor( 297, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 373:
+        {
+            // stmt ::= KW365 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3977 "bench/work/wide_1000.cpp"
+            callDtor( 298, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 374:
+        {
+            // stmt ::= KW366 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3987 "bench/work/wide_1000.cpp"
+            callDtor( 299, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 375:
+        {
+            // stmt ::= KW367 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 3997 "bench/work/wide_1000.cpp"
+            callDtor( 300, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 376:
+        {
+            // stmt ::= KW368 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4007 "bench/work/wide_1000.cpp"
+            callDtor( 301, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 377:
+        {
+            // stmt ::= KW369 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4017 "bench/work/wide_1000.cpp"
+            callDtor( 302, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 378:
+        {
+            // stmt ::= KW370 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4027 "bench/work/wide_1000.cpp"
+            callDtor( 304, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 379:
+        {
+            // stmt ::= KW371 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4037 "bench/work/wide_1000.cpp"
+            callDtor( 305, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 380:
+        {
+            // stmt ::= KW372 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4047 "bench/work/wide_1000.cpp"
+            callDtor( 306, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 381:
+        {
+            // stmt ::= KW373 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4057 "bench/work/wide_1000.cpp"
+            callDtor( 307, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 382:
+        {
+            // stmt ::= KW374 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4067 "bench/work/wide_1000.cpp"
+            callDtor( 308, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 383:
+        {
+            // stmt ::= KW375 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4077 "bench/work/wide_1000.cpp"
+            callDtor( 309, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 384:
+        {
+            // stmt ::= KW376 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4087 "bench/work/wide_1000.cpp"
+            callDtor( 310, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 385:
+        {
+            // stmt ::= KW377 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4097 "bench/work/wide_1000.cpp"
+            callDtor( 311, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 386:
+        {
+            // stmt ::= KW378 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4107 "bench/work/wide_1000.cpp"
+            callDtor( 312, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 387:
+        {
+            // stmt ::= KW379 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4117 "bench/work/wide_1000.cpp"
+            callDtor( 313, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 388:
+        {
+            // stmt ::= KW380 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4127 "bench/work/wide_1000.cpp"
+            callDtor( 315, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 389:
+        {
+            // stmt ::= KW381 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4137 "bench/work/wide_1000.cpp"
+            callDtor( 316, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 390:
+        {
+            // stmt ::= KW382 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4147 "bench/work/wide_1000.cpp"
+            callDtor( 317, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 391:
+        {
+            // stmt ::= KW383 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4157 "bench/work/wide_1000.cpp"
+            callDtor( 318, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 392:
+        {
+            // stmt ::= KW384 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4167 "bench/work/wide_1000.cpp"
+            callDtor( 319, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 393:
+        {
+            // stmt ::= KW385 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4177 "bench/work/wide_1000.cpp"
+            callDtor( 320, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 394:
+        {
+            // stmt ::= KW386 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4187 "bench/work/wide_1000.cpp"
+            callDtor( 321, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 395:
+        {
+            // stmt ::= KW387 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4197 "bench/work/wide_1000.cpp"
+            callDtor( 322, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 396:
+        {
+            // stmt ::= KW388 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4207 "bench/work/wide_1000.cpp"
+            callDtor( 323, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 397:
+        {
+            // stmt ::= KW389 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4217 "bench/work/wide_1000.cpp"
+            callDtor( 324, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 398:
+        {
+            // stmt ::= KW390 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4227 "bench/work/wide_1000.cpp"
+            callDtor( 326, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 399:
+        {
+            // stmt ::= KW391 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4237 "bench/work/wide_1000.cpp"
+            callDtor( 327, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 400:
+        {
+            // stmt ::= KW392 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4247 "bench/work/wide_1000.cpp"
+            callDtor( 328, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 401:
+        {
+            // stmt ::= KW393 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4257 "bench/work/wide_1000.cpp"
+            callDtor( 329, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 402:
+        {
+            // stmt ::= KW394 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4267 "bench/work/wide_1000.cpp"
+            callDtor( 330, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 403:
+        {
+            // stmt ::= KW395 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4277 "bench/work/wide_1000.cpp"
+            callDtor( 331, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 404:
+        {
+            // stmt ::= KW396 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4287 "bench/work/wide_1000.cpp"
+            callDtor( 332, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 405:
+        {
+            // stmt ::= KW397 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4297 "bench/work/wide_1000.cpp"
+            callDtor( 333, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 406:
+        {
+            // stmt ::= KW398 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4307 "bench/work/wide_1000.cpp"
+            callDtor( 334, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 407:
+        {
+            // stmt ::= KW399 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4317 "bench/work/wide_1000.cpp"
+            callDtor( 335, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 408:
+        {
+            // stmt ::= KW400 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4327 "bench/work/wide_1000.cpp"
+            callDtor( 338, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 409:
+        {
+            // stmt ::= KW401 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4337 "bench/work/wide_1000.cpp"
+            callDtor( 339, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 410:
+        {
+            // stmt ::= KW402 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4347 "bench/work/wide_1000.cpp"
+            callDtor( 340, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 411:
+        {
+            // stmt ::= KW403 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4357 "bench/work/wide_1000.cpp"
+            callDtor( 341, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 412:
+        {
+            // stmt ::= KW404 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4367 "bench/work/wide_1000.cpp"
+            callDtor( 342, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 413:
+        {
+            // stmt ::= KW405 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4377 "bench/work/wide_1000.cpp"
+            callDtor( 343, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 414:
+        {
+            // stmt ::= KW406 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4387 "bench/work/wide_1000.cpp"
+            callDtor( 344, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 415:
+        {
+            // stmt ::= KW407 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4397 "bench/work/wide_1000.cpp"
+            callDtor( 345, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 416:
+        {
+            // stmt ::= KW408 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4407 "bench/work/wide_1000.cpp"
+            callDtor( 346, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 417:
+        {
+            // stmt ::= KW409 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4417 "bench/work/wide_1000.cpp"
+            callDtor( 347, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 418:
+        {
+            // stmt ::= KW410 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4427 "bench/work/wide_1000.cpp"
+            callDtor( 349, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 419:
+        {
+            // stmt ::= KW411 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4437 "bench/work/wide_1000.cpp"
+            callDtor( 350, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 420:
+        {
+            // stmt ::= KW412 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4447 "bench/work/wide_1000.cpp"
+            callDtor( 351, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 421:
+        {
+            // stmt ::= KW413 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4457 "bench/work/wide_1000.cpp"
+            callDtor( 352, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 422:
+        {
+            // stmt ::= KW414 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4467 "bench/work/wide_1000.cpp"
+            callDtor( 353, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 423:
+        {
+            // stmt ::= KW415 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4477 "bench/work/wide_1000.cpp"
+            callDtor( 354, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 424:
+        {
+            // stmt ::= KW416 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4487 "bench/work/wide_1000.cpp"
+            callDtor( 355, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 425:
+        {
+            // stmt ::= KW417 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4497 "bench/work/wide_1000.cpp"
+            callDtor( 356, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 426:
+        {
+            // stmt ::= KW418 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4507 "bench/work/wide_1000.cpp"
+            callDtor( 357, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 427:
+        {
+            // stmt ::= KW419 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4517 "bench/work/wide_1000.cpp"
+            callDtor( 358, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 428:
+        {
+            // stmt ::= KW420 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4527 "bench/work/wide_1000.cpp"
+            callDtor( 360, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 429:
+        {
+            // stmt ::= KW421 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4537 "bench/work/wide_1000.cpp"
+            callDtor( 361, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 430:
+        {
+            // stmt ::= KW422 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4547 "bench/work/wide_1000.cpp"
+            callDtor( 362, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 431:
+        {
+            // stmt ::= KW423 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4557 "bench/work/wide_1000.cpp"
+            callDtor( 363, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 432:
+        {
+            // stmt ::= KW424 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4567 "bench/work/wide_1000.cpp"
+            callDtor( 364, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 433:
+        {
+            // stmt ::= KW425 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4577 "bench/work/wide_1000.cpp"
+            callDtor( 365, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 434:
+        {
+            // stmt ::= KW426 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4587 "bench/work/wide_1000.cpp"
+            callDtor( 366, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 435:
+        {
+            // stmt ::= KW427 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4597 "bench/work/wide_1000.cpp"
+            callDtor( 367, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 436:
+        {
+            // stmt ::= KW428 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4607 "bench/work/wide_1000.cpp"
+            callDtor( 368, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 437:
+        {
+            // stmt ::= KW429 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4617 "bench/work/wide_1000.cpp"
+            callDtor( 369, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 438:
+        {
+            // stmt ::= KW430 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4627 "bench/work/wide_1000.cpp"
+            callDtor( 371, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 439:
+        {
+            // stmt ::= KW431 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4637 "bench/work/wide_1000.cpp"
+            callDtor( 372, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 440:
+        {
+            // stmt ::= KW432 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4647 "bench/work/wide_1000.cpp"
+            callDtor( 373, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 441:
+        {
+            // stmt ::= KW433 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4657 "bench/work/wide_1000.cpp"
+            callDtor( 374, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 442:
+        {
+            // stmt ::= KW434 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4667 "bench/work/wide_1000.cpp"
+            callDtor( 375, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 443:
+        {
+            // stmt ::= KW435 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4677 "bench/work/wide_1000.cpp"
+            callDtor( 376, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 444:
+        {
+            // stmt ::= KW436 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4687 "bench/work/wide_1000.cpp"
+            callDtor( 377, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 445:
+        {
+            // stmt ::= KW437 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4697 "bench/work/wide_1000.cpp"
+            callDtor( 378, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 446:
+        {
+            // stmt ::= KW438 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4707 "bench/work/wide_1000.cpp"
+            callDtor( 379, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 447:
+        {
+            // stmt ::= KW439 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4717 "bench/work/wide_1000.cpp"
+            callDtor( 380, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 448:
+        {
+            // stmt ::= KW440 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4727 "bench/work/wide_1000.cpp"
+            callDtor( 382, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 449:
+        {
+            // stmt ::= KW441 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4737 "bench/work/wide_1000.cpp"
+            callDtor( 383, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 450:
+        {
+            // stmt ::= KW442 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4747 "bench/work/wide_1000.cpp"
+            callDtor( 384, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 451:
+        {
+            // stmt ::= KW443 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4757 "bench/work/wide_1000.cpp"
+            callDtor( 385, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 452:
+        {
+            // stmt ::= KW444 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4767 "bench/work/wide_1000.cpp"
+            callDtor( 386, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 453:
+        {
+            // stmt ::= KW445 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4777 "bench/work/wide_1000.cpp"
+            callDtor( 387, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 454:
+        {
+            // stmt ::= KW446 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4787 "bench/work/wide_1000.cpp"
+            callDtor( 388, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 455:
+        {
+            // stmt ::= KW447 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4797 "bench/work/wide_1000.cpp"
+            callDtor( 389, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 456:
+        {
+            // stmt ::= KW448 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4807 "bench/work/wide_1000.cpp"
+            callDtor( 390, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 457:
+        {
+            // stmt ::= KW449 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4817 "bench/work/wide_1000.cpp"
+            callDtor( 391, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 458:
+        {
+            // stmt ::= KW450 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4827 "bench/work/wide_1000.cpp"
+            callDtor( 393, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 459:
+        {
+            // stmt ::= KW451 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4837 "bench/work/wide_1000.cpp"
+            callDtor( 394, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 460:
+        {
+            // stmt ::= KW452 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4847 "bench/work/wide_1000.cpp"
+            callDtor( 395, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 461:
+        {
+            // stmt ::= KW453 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4857 "bench/work/wide_1000.cpp"
+            callDtor( 396, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 462:
+        {
+            // stmt ::= KW454 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4867 "bench/work/wide_1000.cpp"
+            callDtor( 397, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 463:
+        {
+            // stmt ::= KW455 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4877 "bench/work/wide_1000.cpp"
+            callDtor( 398, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 464:
+        {
+            // stmt ::= KW456 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4887 "bench/work/wide_1000.cpp"
+            callDtor( 399, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 465:
+        {
+            // stmt ::= KW457 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4897 "bench/work/wide_1000.cpp"
+            callDtor( 400, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 466:
+        {
+            // stmt ::= KW458 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4907 "bench/work/wide_1000.cpp"
+            callDtor( 401, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 467:
+        {
+            // stmt ::= KW459 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4917 "bench/work/wide_1000.cpp"
+            callDtor( 402, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 468:
+        {
+            // stmt ::= KW460 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4927 "bench/work/wide_1000.cpp"
+            callDtor( 404, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 469:
+        {
+            // stmt ::= KW461 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4937 "bench/work/wide_1000.cpp"
+            callDtor( 405, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 470:
+        {
+            // stmt ::= KW462 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4947 "bench/work/wide_1000.cpp"
+            callDtor( 406, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 471:
+        {
+            // stmt ::= KW463 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4957 "bench/work/wide_1000.cpp"
+            callDtor( 407, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 472:
+        {
+            // stmt ::= KW464 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4967 "bench/work/wide_1000.cpp"
+            callDtor( 408, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 473:
+        {
+            // stmt ::= KW465 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4977 "bench/work/wide_1000.cpp"
+            callDtor( 409, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 474:
+        {
+            // stmt ::= KW466 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4987 "bench/work/wide_1000.cpp"
+            callDtor( 410, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 475:
+        {
+            // stmt ::= KW467 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 4997 "bench/work/wide_1000.cpp"
+            callDtor( 411, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 476:
+        {
+            // stmt ::= KW468 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5007 "bench/work/wide_1000.cpp"
+            callDtor( 412, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 477:
+        {
+            // stmt ::= KW469 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5017 "bench/work/wide_1000.cpp"
+            callDtor( 413, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 478:
+        {
+            // stmt ::= KW470 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5027 "bench/work/wide_1000.cpp"
+            callDtor( 415, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 479:
+        {
+            // stmt ::= KW471 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5037 "bench/work/wide_1000.cpp"
+            callDtor( 416, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 480:
+        {
+            // stmt ::= KW472 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5047 "bench/work/wide_1000.cpp"
+            callDtor( 417, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 481:
+        {
+            // stmt ::= KW473 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5057 "bench/work/wide_1000.cpp"
+            callDtor( 418, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 482:
+        {
+            // stmt ::= KW474 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5067 "bench/work/wide_1000.cpp"
+            callDtor( 419, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 483:
+        {
+            // stmt ::= KW475 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5077 "bench/work/wide_1000.cpp"
+            callDtor( 420, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 484:
+        {
+            // stmt ::= KW476 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5087 "bench/work/wide_1000.cpp"
+            callDtor( 421, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 485:
+        {
+            // stmt ::= KW477 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5097 "bench/work/wide_1000.cpp"
+            callDtor( 422, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 486:
+        {
+            // stmt ::= KW478 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5107 "bench/work/wide_1000.cpp"
+            callDtor( 423, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 487:
+        {
+            // stmt ::= KW479 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5117 "bench/work/wide_1000.cpp"
+            callDtor( 424, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 488:
+        {
+            // stmt ::= KW480 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5127 "bench/work/wide_1000.cpp"
+            callDtor( 426, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 489:
+        {
+            // stmt ::= KW481 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5137 "bench/work/wide_1000.cpp"
+            callDtor( 427, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 490:
+        {
+            // stmt ::= KW482 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5147 "bench/work/wide_1000.cpp"
+            callDtor( 428, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 491:
+        {
+            // stmt ::= KW483 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5157 "bench/work/wide_1000.cpp"
+            callDtor( 429, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 492:
+        {
+            // stmt ::= KW484 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5167 "bench/work/wide_1000.cpp"
+            callDtor( 430, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 493:
+        {
+            // stmt ::= KW485 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5177 "bench/work/wide_1000.cpp"
+            callDtor( 431, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 494:
+        {
+            // stmt ::= KW486 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5187 "bench/work/wide_1000.cpp"
+            callDtor( 432, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 495:
+        {
+            // stmt ::= KW487 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5197 "bench/work/wide_1000.cpp"
+            callDtor( 433, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 496:
+        {
+            // stmt ::= KW488 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5207 "bench/work/wide_1000.cpp"
+            callDtor( 434, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 497:
+        {
+            // stmt ::= KW489 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5217 "bench/work/wide_1000.cpp"
+            callDtor( 435, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 498:
+        {
+            // stmt ::= KW490 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5227 "bench/work/wide_1000.cpp"
+            callDtor( 437, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 499:
+        {
+            // stmt ::= KW491 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5237 "bench/work/wide_1000.cpp"
+            callDtor( 438, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 500:
+        {
+            // stmt ::= KW492 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5247 "bench/work/wide_1000.cpp"
+            callDtor( 439, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 501:
+        {
+            // stmt ::= KW493 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5257 "bench/work/wide_1000.cpp"
+            callDtor( 440, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 502:
+        {
+            // stmt ::= KW494 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5267 "bench/work/wide_1000.cpp"
+            callDtor( 441, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 503:
+        {
+            // stmt ::= KW495 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5277 "bench/work/wide_1000.cpp"
+            callDtor( 442, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 504:
+        {
+            // stmt ::= KW496 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5287 "bench/work/wide_1000.cpp"
+            callDtor( 443, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 505:
+        {
+            // stmt ::= KW497 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5297 "bench/work/wide_1000.cpp"
+            callDtor( 444, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 506:
+        {
+            // stmt ::= KW498 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5307 "bench/work/wide_1000.cpp"
+            callDtor( 445, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 507:
+        {
+            // stmt ::= KW499 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5317 "bench/work/wide_1000.cpp"
+            callDtor( 446, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 508:
+        {
+            // stmt ::= KW500 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5327 "bench/work/wide_1000.cpp"
+            callDtor( 449, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 509:
+        {
+            // stmt ::= KW501 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5337 "bench/work/wide_1000.cpp"
+            callDtor( 450, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 510:
+        {
+            // stmt ::= KW502 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5347 "bench/work/wide_1000.cpp"
+            callDtor( 451, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 511:
+        {
+            // stmt ::= KW503 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5357 "bench/work/wide_1000.cpp"
+            callDtor( 452, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 512:
+        {
+            // stmt ::= KW504 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5367 "bench/work/wide_1000.cpp"
+            callDtor( 453, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 513:
+        {
+            // stmt ::= KW505 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5377 "bench/work/wide_1000.cpp"
+            callDtor( 454, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 514:
+        {
+            // stmt ::= KW506 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5387 "bench/work/wide_1000.cpp"
+            callDtor( 455, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 515:
+        {
+            // stmt ::= KW507 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5397 "bench/work/wide_1000.cpp"
+            callDtor( 456, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 516:
+        {
+            // stmt ::= KW508 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5407 "bench/work/wide_1000.cpp"
+            callDtor( 457, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 517:
+        {
+            // stmt ::= KW509 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5417 "bench/work/wide_1000.cpp"
+            callDtor( 458, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 518:
+        {
+            // stmt ::= KW510 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5427 "bench/work/wide_1000.cpp"
+            callDtor( 460, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 519:
+        {
+            // stmt ::= KW511 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5437 "bench/work/wide_1000.cpp"
+            callDtor( 461, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 520:
+        {
+            // stmt ::= KW512 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5447 "bench/work/wide_1000.cpp"
+            callDtor( 462, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 521:
+        {
+            // stmt ::= KW513 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5457 "bench/work/wide_1000.cpp"
+            callDtor( 463, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 522:
+        {
+            // stmt ::= KW514 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5467 "bench/work/wide_1000.cpp"
+            callDtor( 464, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 523:
+        {
+            // stmt ::= KW515 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5477 "bench/work/wide_1000.cpp"
+            callDtor( 465, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 524:
+        {
+            // stmt ::= KW516 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5487 "bench/work/wide_1000.cpp"
+            callDtor( 466, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 525:
+        {
+            // stmt ::= KW517 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5497 "bench/work/wide_1000.cpp"
+            callDtor( 467, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 526:
+        {
+            // stmt ::= KW518 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5507 "bench/work/wide_1000.cpp"
+            callDtor( 468, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 527:
+        {
+            // stmt ::= KW519 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5517 "bench/work/wide_1000.cpp"
+            callDtor( 469, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 528:
+        {
+            // stmt ::= KW520 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5527 "bench/work/wide_1000.cpp"
+            callDtor( 471, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 529:
+        {
+            // stmt ::= KW521 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5537 "bench/work/wide_1000.cpp"
+            callDtor( 472, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 530:
+        {
+            // stmt ::= KW522 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5547 "bench/work/wide_1000.cpp"
+            callDtor( 473, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 531:
+        {
+            // stmt ::= KW523 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5557 "bench/work/wide_1000.cpp"
+            callDtor( 474, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 532:
+        {
+            // stmt ::= KW524 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5567 "bench/work/wide_1000.cpp"
+            callDtor( 475, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 533:
+        {
+            // stmt ::= KW525 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5577 "bench/work/wide_1000.cpp"
+            callDtor( 476, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 534:
+        {
+            // stmt ::= KW526 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5587 "bench/work/wide_1000.cpp"
+            callDtor( 477, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 535:
+        {
+            // stmt ::= KW527 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5597 "bench/work/wide_1000.cpp"
+            callDtor( 478, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 536:
+        {
+            // stmt ::= KW528 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5607 "bench/work/wide_1000.cpp"
+            callDtor( 479, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 537:
+        {
+            // stmt ::= KW529 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5617 "bench/work/wide_1000.cpp"
+            callDtor( 480, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 538:
+        {
+            // stmt ::= KW530 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5627 "bench/work/wide_1000.cpp"
+            callDtor( 482, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 539:
+        {
+            // stmt ::= KW531 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5637 "bench/work/wide_1000.cpp"
+            callDtor( 483, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 540:
+        {
+            // stmt ::= KW532 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5647 "bench/work/wide_1000.cpp"
+            callDtor( 484, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 541:
+        {
+            // stmt ::= KW533 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5657 "bench/work/wide_1000.cpp"
+            callDtor( 485, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 542:
+        {
+            // stmt ::= KW534 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5667 "bench/work/wide_1000.cpp"
+            callDtor( 486, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 543:
+        {
+            // stmt ::= KW535 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5677 "bench/work/wide_1000.cpp"
+            callDtor( 487, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 544:
+        {
+            // stmt ::= KW536 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5687 "bench/work/wide_1000.cpp"
+            callDtor( 488, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 545:
+        {
+            // stmt ::= KW537 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5697 "bench/work/wide_1000.cpp"
+            callDtor( 489, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 546:
+        {
+            // stmt ::= KW538 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5707 "bench/work/wide_1000.cpp"
+            callDtor( 490, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 547:
+        {
+            // stmt ::= KW539 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5717 "bench/work/wide_1000.cpp"
+            callDtor( 491, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 548:
+        {
+            // stmt ::= KW540 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5727 "bench/work/wide_1000.cpp"
+            callDtor( 493, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 549:
+        {
+            // stmt ::= KW541 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5737 "bench/work/wide_1000.cpp"
+            callDtor( 494, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 550:
+        {
+            // stmt ::= KW542 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5747 "bench/work/wide_1000.cpp"
+            callDtor( 495, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 551:
+        {
+            // stmt ::= KW543 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5757 "bench/work/wide_1000.cpp"
+            callDtor( 496, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 552:
+        {
+            // stmt ::= KW544 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5767 "bench/work/wide_1000.cpp"
+            callDtor( 497, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 553:
+        {
+            // stmt ::= KW545 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5777 "bench/work/wide_1000.cpp"
+            callDtor( 498, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 554:
+        {
+            // stmt ::= KW546 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5787 "bench/work/wide_1000.cpp"
+            callDtor( 499, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 555:
+        {
+            // stmt ::= KW547 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5797 "bench/work/wide_1000.cpp"
+            callDtor( 500, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 556:
+        {
+            // stmt ::= KW548 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5807 "bench/work/wide_1000.cpp"
+            callDtor( 501, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 557:
+        {
+            // stmt ::= KW549 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5817 "bench/work/wide_1000.cpp"
+            callDtor( 502, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 558:
+        {
+            // stmt ::= KW550 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5827 "bench/work/wide_1000.cpp"
+            callDtor( 504, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 559:
+        {
+            // stmt ::= KW551 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5837 "bench/work/wide_1000.cpp"
+            callDtor( 505, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 560:
+        {
+            // stmt ::= KW552 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5847 "bench/work/wide_1000.cpp"
+            callDtor( 506, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 561:
+        {
+            // stmt ::= KW553 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5857 "bench/work/wide_1000.cpp"
+            callDtor( 507, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 562:
+        {
+            // stmt ::= KW554 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5867 "bench/work/wide_1000.cpp"
+            callDtor( 508, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 563:
+        {
+            // stmt ::= KW555 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5877 "bench/work/wide_1000.cpp"
+            callDtor( 509, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 564:
+        {
+            // stmt ::= KW556 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5887 "bench/work/wide_1000.cpp"
+            callDtor( 510, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 565:
+        {
+            // stmt ::= KW557 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5897 "bench/work/wide_1000.cpp"
+            callDtor( 511, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 566:
+        {
+            // stmt ::= KW558 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5907 "bench/work/wide_1000.cpp"
+            callDtor( 512, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 567:
+        {
+            // stmt ::= KW559 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5917 "bench/work/wide_1000.cpp"
+            callDtor( 513, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 568:
+        {
+            // stmt ::= KW560 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5927 "bench/work/wide_1000.cpp"
+            callDtor( 515, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 569:
+        {
+            // stmt ::= KW561 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5937 "bench/work/wide_1000.cpp"
+            callDtor( 516, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 570:
+        {
+            // stmt ::= KW562 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5947 "bench/work/wide_1000.cpp"
+            callDtor( 517, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 571:
+        {
+            // stmt ::= KW563 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5957 "bench/work/wide_1000.cpp"
+            callDtor( 518, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 572:
+        {
+            // stmt ::= KW564 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5967 "bench/work/wide_1000.cpp"
+            callDtor( 519, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 573:
+        {
+            // stmt ::= KW565 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5977 "bench/work/wide_1000.cpp"
+            callDtor( 520, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 574:
+        {
+            // stmt ::= KW566 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5987 "bench/work/wide_1000.cpp"
+            callDtor( 521, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 575:
+        {
+            // stmt ::= KW567 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 5997 "bench/work/wide_1000.cpp"
+            callDtor( 522, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 576:
+        {
+            // stmt ::= KW568 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6007 "bench/work/wide_1000.cpp"
+            callDtor( 523, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 577:
+        {
+            // stmt ::= KW569 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6017 "bench/work/wide_1000.cpp"
+            callDtor( 524, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 578:
+        {
+            // stmt ::= KW570 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6027 "bench/work/wide_1000.cpp"
+            callDtor( 526, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 579:
+        {
+            // stmt ::= KW571 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6037 "bench/work/wide_1000.cpp"
+            callDtor( 527, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 580:
+        {
+            // stmt ::= KW572 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6047 "bench/work/wide_1000.cpp"
+            callDtor( 528, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 581:
+        {
+            // stmt ::= KW573 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6057 "bench/work/wide_1000.cpp"
+            callDtor( 529, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 582:
+        {
+            // stmt ::= KW574 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6067 "bench/work/wide_1000.cpp"
+            callDtor( 530, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 583:
+        {
+            // stmt ::= KW575 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6077 "bench/work/wide_1000.cpp"
+            callDtor( 531, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 584:
+        {
+            // stmt ::= KW576 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6087 "bench/work/wide_1000.cpp"
+            callDtor( 532, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 585:
+        {
+            // stmt ::= KW577 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6097 "bench/work/wide_1000.cpp"
+            callDtor( 533, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 586:
+        {
+            // stmt ::= KW578 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6107 "bench/work/wide_1000.cpp"
+            callDtor( 534, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 587:
+        {
+            // stmt ::= KW579 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6117 "bench/work/wide_1000.cpp"
+            callDtor( 535, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 588:
+        {
+            // stmt ::= KW580 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6127 "bench/work/wide_1000.cpp"
+            callDtor( 537, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 589:
+        {
+            // stmt ::= KW581 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6137 "bench/work/wide_1000.cpp"
+            callDtor( 538, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 590:
+        {
+            // stmt ::= KW582 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6147 "bench/work/wide_1000.cpp"
+            callDtor( 539, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 591:
+        {
+            // stmt ::= KW583 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6157 "bench/work/wide_1000.cpp"
+            callDtor( 540, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 592:
+        {
+            // stmt ::= KW584 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6167 "bench/work/wide_1000.cpp"
+            callDtor( 541, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 593:
+        {
+            // stmt ::= KW585 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6177 "bench/work/wide_1000.cpp"
+            callDtor( 542, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 594:
+        {
+            // stmt ::= KW586 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6187 "bench/work/wide_1000.cpp"
+            callDtor( 543, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 595:
+        {
+            // stmt ::= KW587 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6197 "bench/work/wide_1000.cpp"
+            callDtor( 544, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 596:
+        {
+            // stmt ::= KW588 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6207 "bench/work/wide_1000.cpp"
+            callDtor( 545, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 597:
+        {
+            // stmt ::= KW589 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6217 "bench/work/wide_1000.cpp"
+            callDtor( 546, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 598:
+        {
+            // stmt ::= KW590 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6227 "bench/work/wide_1000.cpp"
+            callDtor( 548, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 599:
+        {
+            // stmt ::= KW591 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6237 "bench/work/wide_1000.cpp"
+            callDtor( 549, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 600:
+        {
+            // stmt ::= KW592 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6247 "bench/work/wide_1000.cpp"
+            callDtor( 550, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 601:
+        {
+            // stmt ::= KW593 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6257 "bench/work/wide_1000.cpp"
+            callDtor( 551, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 602:
+        {
+            // stmt ::= KW594 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6267 "bench/work/wide_1000.cpp"
+            callDtor( 552, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 603:
+        {
+            // stmt ::= KW595 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6277 "bench/work/wide_1000.cpp"
+            callDtor( 553, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 604:
+        {
+            // stmt ::= KW596 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6287 "bench/work/wide_1000.cpp"
+            callDtor( 554, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 605:
+        {
+            // stmt ::= KW597 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6297 "bench/work/wide_1000.cpp"
+            callDtor( 555, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 606:
+        {
+            // stmt ::= KW598 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6307 "bench/work/wide_1000.cpp"
+            callDtor( 556, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 607:
+        {
+            // stmt ::= KW599 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6317 "bench/work/wide_1000.cpp"
+            callDtor( 557, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 608:
+        {
+            // stmt ::= KW600 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6327 "bench/work/wide_1000.cpp"
+            callDtor( 560, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 609:
+        {
+            // stmt ::= KW601 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6337 "bench/work/wide_1000.cpp"
+            callDtor( 561, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 610:
+        {
+            // stmt ::= KW602 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6347 "bench/work/wide_1000.cpp"
+            callDtor( 562, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 611:
+        {
+            // stmt ::= KW603 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6357 "bench/work/wide_1000.cpp"
+            callDtor( 563, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 612:
+        {
+            // stmt ::= KW604 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6367 "bench/work/wide_1000.cpp"
+            callDtor( 564, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 613:
+        {
+            // stmt ::= KW605 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6377 "bench/work/wide_1000.cpp"
+            callDtor( 565, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 614:
+        {
+            // stmt ::= KW606 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6387 "bench/work/wide_1000.cpp"
+            callDtor( 566, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 615:
+        {
+            // stmt ::= KW607 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6397 "bench/work/wide_1000.cpp"
+            callDtor( 567, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 616:
+        {
+            // stmt ::= KW608 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6407 "bench/work/wide_1000.cpp"
+            callDtor( 568, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 617:
+        {
+            // stmt ::= KW609 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6417 "bench/work/wide_1000.cpp"
+            callDtor( 569, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 618:
+        {
+            // stmt ::= KW610 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6427 "bench/work/wide_1000.cpp"
+            callDtor( 571, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 619:
+        {
+            // stmt ::= KW611 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6437 "bench/work/wide_1000.cpp"
+            callDtor( 572, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 620:
+        {
+            // stmt ::= KW612 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6447 "bench/work/wide_1000.cpp"
+            callDtor( 573, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 621:
+        {
+            // stmt ::= KW613 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6457 "bench/work/wide_1000.cpp"
+            callDtor( 574, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 622:
+        {
+            // stmt ::= KW614 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6467 "bench/work/wide_1000.cpp"
+            callDtor( 575, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 623:
+        {
+            // stmt ::= KW615 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6477 "bench/work/wide_1000.cpp"
+            callDtor( 576, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 624:
+        {
+            // stmt ::= KW616 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6487 "bench/work/wide_1000.cpp"
+            callDtor( 577, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 625:
+        {
+            // stmt ::= KW617 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6497 "bench/work/wide_1000.cpp"
+            callDtor( 578, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 626:
+        {
+            // stmt ::= KW618 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6507 "bench/work/wide_1000.cpp"
+            callDtor( 579, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 627:
+        {
+            // stmt ::= KW619 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6517 "bench/work/wide_1000.cpp"
+            callDtor( 580, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 628:
+        {
+            // stmt ::= KW620 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6527 "bench/work/wide_1000.cpp"
+            callDtor( 582, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 629:
+        {
+            // stmt ::= KW621 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6537 "bench/work/wide_1000.cpp"
+            callDtor( 583, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 630:
+        {
+            // stmt ::= KW622 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6547 "bench/work/wide_1000.cpp"
+            callDtor( 584, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 631:
+        {
+            // stmt ::= KW623 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6557 "bench/work/wide_1000.cpp"
+            callDtor( 585, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 632:
+        {
+            // stmt ::= KW624 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6567 "bench/work/wide_1000.cpp"
+            callDtor( 586, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 633:
+        {
+            // stmt ::= KW625 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6577 "bench/work/wide_1000.cpp"
+            callDtor( 587, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 634:
+        {
+            // stmt ::= KW626 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6587 "bench/work/wide_1000.cpp"
+            callDtor( 588, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 635:
+        {
+            // stmt ::= KW627 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6597 "bench/work/wide_1000.cpp"
+            callDtor( 589, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 636:
+        {
+            // stmt ::= KW628 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6607 "bench/work/wide_1000.cpp"
+            callDtor( 590, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 637:
+        {
+            // stmt ::= KW629 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6617 "bench/work/wide_1000.cpp"
+            callDtor( 591, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 638:
+        {
+            // stmt ::= KW630 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6627 "bench/work/wide_1000.cpp"
+            callDtor( 593, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 639:
+        {
+            // stmt ::= KW631 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6637 "bench/work/wide_1000.cpp"
+            callDtor( 594, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 640:
+        {
+            // stmt ::= KW632 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6647 "bench/work/wide_1000.cpp"
+            callDtor( 595, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 641:
+        {
+            // stmt ::= KW633 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6657 "bench/work/wide_1000.cpp"
+            callDtor( 596, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 642:
+        {
+            // stmt ::= KW634 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6667 "bench/work/wide_1000.cpp"
+            callDtor( 597, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 643:
+        {
+            // stmt ::= KW635 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6677 "bench/work/wide_1000.cpp"
+            callDtor( 598, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 644:
+        {
+            // stmt ::= KW636 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6687 "bench/work/wide_1000.cpp"
+            callDtor( 599, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 645:
+        {
+            // stmt ::= KW637 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6697 "bench/work/wide_1000.cpp"
+            callDtor( 600, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 646:
+        {
+            // stmt ::= KW638 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6707 "bench/work/wide_1000.cpp"
+            callDtor( 601, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 647:
+        {
+            // stmt ::= KW639 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6717 "bench/work/wide_1000.cpp"
+            callDtor( 602, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 648:
+        {
+            // stmt ::= KW640 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6727 "bench/work/wide_1000.cpp"
+            callDtor( 604, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 649:
+        {
+            // stmt ::= KW641 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6737 "bench/work/wide_1000.cpp"
+            callDtor( 605, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 650:
+        {
+            // stmt ::= KW642 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6747 "bench/work/wide_1000.cpp"
+            callDtor( 606, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 651:
+        {
+            // stmt ::= KW643 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6757 "bench/work/wide_1000.cpp"
+            callDtor( 607, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 652:
+        {
+            // stmt ::= KW644 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6767 "bench/work/wide_1000.cpp"
+            callDtor( 608, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 653:
+        {
+            // stmt ::= KW645 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6777 "bench/work/wide_1000.cpp"
+            callDtor( 609, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 654:
+        {
+            // stmt ::= KW646 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6787 "bench/work/wide_1000.cpp"
+            callDtor( 610, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 655:
+        {
+            // stmt ::= KW647 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6797 "bench/work/wide_1000.cpp"
+            callDtor( 611, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 656:
+        {
+            // stmt ::= KW648 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6807 "bench/work/wide_1000.cpp"
+            callDtor( 612, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 657:
+        {
+            // stmt ::= KW649 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6817 "bench/work/wide_1000.cpp"
+            callDtor( 613, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 658:
+        {
+            // stmt ::= KW650 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6827 "bench/work/wide_1000.cpp"
+            callDtor( 615, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 659:
+        {
+            // stmt ::= KW651 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6837 "bench/work/wide_1000.cpp"
+            callDtor( 616, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 660:
+        {
+            // stmt ::= KW652 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6847 "bench/work/wide_1000.cpp"
+            callDtor( 617, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 661:
+        {
+            // stmt ::= KW653 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6857 "bench/work/wide_1000.cpp"
+            callDtor( 618, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 662:
+        {
+            // stmt ::= KW654 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6867 "bench/work/wide_1000.cpp"
+            callDtor( 619, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 663:
+        {
+            // stmt ::= KW655 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6877 "bench/work/wide_1000.cpp"
+            callDtor( 620, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 664:
+        {
+            // stmt ::= KW656 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6887 "bench/work/wide_1000.cpp"
+            callDtor( 621, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 665:
+        {
+            // stmt ::= KW657 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6897 "bench/work/wide_1000.cpp"
+            callDtor( 622, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 666:
+        {
+            // stmt ::= KW658 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6907 "bench/work/wide_1000.cpp"
+            callDtor( 623, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 667:
+        {
+            // stmt ::= KW659 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6917 "bench/work/wide_1000.cpp"
+            callDtor( 624, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 668:
+        {
+            // stmt ::= KW660 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6927 "bench/work/wide_1000.cpp"
+            callDtor( 626, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 669:
+        {
+            // stmt ::= KW661 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6937 "bench/work/wide_1000.cpp"
+            callDtor( 627, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 670:
+        {
+            // stmt ::= KW662 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6947 "bench/work/wide_1000.cpp"
+            callDtor( 628, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 671:
+        {
+            // stmt ::= KW663 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6957 "bench/work/wide_1000.cpp"
+            callDtor( 629, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 672:
+        {
+            // stmt ::= KW664 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6967 "bench/work/wide_1000.cpp"
+            callDtor( 630, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 673:
+        {
+            // stmt ::= KW665 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6977 "bench/work/wide_1000.cpp"
+            callDtor( 631, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 674:
+        {
+            // stmt ::= KW666 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6987 "bench/work/wide_1000.cpp"
+            callDtor( 632, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 675:
+        {
+            // stmt ::= KW667 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 6997 "bench/work/wide_1000.cpp"
+            callDtor( 633, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 676:
+        {
+            // stmt ::= KW668 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7007 "bench/work/wide_1000.cpp"
+            callDtor( 634, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 677:
+        {
+            // stmt ::= KW669 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7017 "bench/work/wide_1000.cpp"
+            callDtor( 635, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 678:
+        {
+            // stmt ::= KW670 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7027 "bench/work/wide_1000.cpp"
+            callDtor( 637, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 679:
+        {
+            // stmt ::= KW671 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7037 "bench/work/wide_1000.cpp"
+            callDtor( 638, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 680:
+        {
+            // stmt ::= KW672 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7047 "bench/work/wide_1000.cpp"
+            callDtor( 639, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 681:
+        {
+            // stmt ::= KW673 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7057 "bench/work/wide_1000.cpp"
+            callDtor( 640, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 682:
+        {
+            // stmt ::= KW674 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7067 "bench/work/wide_1000.cpp"
+            callDtor( 641, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 683:
+        {
+            // stmt ::= KW675 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7077 "bench/work/wide_1000.cpp"
+            callDtor( 642, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 684:
+        {
+            // stmt ::= KW676 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7087 "bench/work/wide_1000.cpp"
+            callDtor( 643, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 685:
+        {
+            // stmt ::= KW677 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7097 "bench/work/wide_1000.cpp"
+            callDtor( 644, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 686:
+        {
+            // stmt ::= KW678 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7107 "bench/work/wide_1000.cpp"
+            callDtor( 645, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 687:
+        {
+            // stmt ::= KW679 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7117 "bench/work/wide_1000.cpp"
+            callDtor( 646, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 688:
+        {
+            // stmt ::= KW680 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7127 "bench/work/wide_1000.cpp"
+            callDtor( 648, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 689:
+        {
+            // stmt ::= KW681 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7137 "bench/work/wide_1000.cpp"
+            callDtor( 649, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 690:
+        {
+            // stmt ::= KW682 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7147 "bench/work/wide_1000.cpp"
+            callDtor( 650, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 691:
+        {
+            // stmt ::= KW683 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7157 "bench/work/wide_1000.cpp"
+            callDtor( 651, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 692:
+        {
+            // stmt ::= KW684 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7167 "bench/work/wide_1000.cpp"
+            callDtor( 652, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 693:
+        {
+            // stmt ::= KW685 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7177 "bench/work/wide_1000.cpp"
+            callDtor( 653, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 694:
+        {
+            // stmt ::= KW686 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7187 "bench/work/wide_1000.cpp"
+            callDtor( 654, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 695:
+        {
+            // stmt ::= KW687 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7197 "bench/work/wide_1000.cpp"
+            callDtor( 655, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 696:
+        {
+            // stmt ::= KW688 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7207 "bench/work/wide_1000.cpp"
+            callDtor( 656, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 697:
+        {
+            // stmt ::= KW689 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7217 "bench/work/wide_1000.cpp"
+            callDtor( 657, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 698:
+        {
+            // stmt ::= KW690 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7227 "bench/work/wide_1000.cpp"
+            callDtor( 659, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 699:
+        {
+            // stmt ::= KW691 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7237 "bench/work/wide_1000.cpp"
+            callDtor( 660, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 700:
+        {
+            // stmt ::= KW692 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7247 "bench/work/wide_1000.cpp"
+            callDtor( 661, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 701:
+        {
+            // stmt ::= KW693 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7257 "bench/work/wide_1000.cpp"
+            callDtor( 662, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 702:
+        {
+            // stmt ::= KW694 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7267 "bench/work/wide_1000.cpp"
+            callDtor( 663, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 703:
+        {
+            // stmt ::= KW695 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7277 "bench/work/wide_1000.cpp"
+            callDtor( 664, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 704:
+        {
+            // stmt ::= KW696 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7287 "bench/work/wide_1000.cpp"
+            callDtor( 665, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 705:
+        {
+            // stmt ::= KW697 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7297 "bench/work/wide_1000.cpp"
+            callDtor( 666, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 706:
+        {
+            // stmt ::= KW698 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7307 "bench/work/wide_1000.cpp"
+            callDtor( 667, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 707:
+        {
+            // stmt ::= KW699 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7317 "bench/work/wide_1000.cpp"
+            callDtor( 668, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 708:
+        {
+            // stmt ::= KW700 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7327 "bench/work/wide_1000.cpp"
+            callDtor( 671, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 709:
+        {
+            // stmt ::= KW701 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7337 "bench/work/wide_1000.cpp"
+            callDtor( 672, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 710:
+        {
+            // stmt ::= KW702 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7347 "bench/work/wide_1000.cpp"
+            callDtor( 673, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 711:
+        {
+            // stmt ::= KW703 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7357 "bench/work/wide_1000.cpp"
+            callDtor( 674, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 712:
+        {
+            // stmt ::= KW704 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7367 "bench/work/wide_1000.cpp"
+            callDtor( 675, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 713:
+        {
+            // stmt ::= KW705 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7377 "bench/work/wide_1000.cpp"
+            callDtor( 676, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 714:
+        {
+            // stmt ::= KW706 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7387 "bench/work/wide_1000.cpp"
+            callDtor( 677, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 715:
+        {
+            // stmt ::= KW707 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7397 "bench/work/wide_1000.cpp"
+            callDtor( 678, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 716:
+        {
+            // stmt ::= KW708 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7407 "bench/work/wide_1000.cpp"
+            callDtor( 679, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 717:
+        {
+            // stmt ::= KW709 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7417 "bench/work/wide_1000.cpp"
+            callDtor( 680, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 718:
+        {
+            // stmt ::= KW710 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7427 "bench/work/wide_1000.cpp"
+            callDtor( 682, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 719:
+        {
+            // stmt ::= KW711 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7437 "bench/work/wide_1000.cpp"
+            callDtor( 683, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 720:
+        {
+            // stmt ::= KW712 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7447 "bench/work/wide_1000.cpp"
+            callDtor( 684, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 721:
+        {
+            // stmt ::= KW713 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7457 "bench/work/wide_1000.cpp"
+            callDtor( 685, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 722:
+        {
+            // stmt ::= KW714 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7467 "bench/work/wide_1000.cpp"
+            callDtor( 686, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 723:
+        {
+            // stmt ::= KW715 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7477 "bench/work/wide_1000.cpp"
+            callDtor( 687, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 724:
+        {
+            // stmt ::= KW716 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7487 "bench/work/wide_1000.cpp"
+            callDtor( 688, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 725:
+        {
+            // stmt ::= KW717 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7497 "bench/work/wide_1000.cpp"
+            callDtor( 689, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 726:
+        {
+            // stmt ::= KW718 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7507 "bench/work/wide_1000.cpp"
+            callDtor( 690, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 727:
+        {
+            // stmt ::= KW719 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7517 "bench/work/wide_1000.cpp"
+            callDtor( 691, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 728:
+        {
+            // stmt ::= KW720 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7527 "bench/work/wide_1000.cpp"
+            callDtor( 693, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 729:
+        {
+            // stmt ::= KW721 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7537 "bench/work/wide_1000.cpp"
+            callDtor( 694, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 730:
+        {
+            // stmt ::= KW722 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7547 "bench/work/wide_1000.cpp"
+            callDtor( 695, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 731:
+        {
+            // stmt ::= KW723 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7557 "bench/work/wide_1000.cpp"
+            callDtor( 696, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 732:
+        {
+            // stmt ::= KW724 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7567 "bench/work/wide_1000.cpp"
+            callDtor( 697, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 733:
+        {
+            // stmt ::= KW725 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7577 "bench/work/wide_1000.cpp"
+            callDtor( 698, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 734:
+        {
+            // stmt ::= KW726 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7587 "bench/work/wide_1000.cpp"
+            callDtor( 699, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 735:
+        {
+            // stmt ::= KW727 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7597 "bench/work/wide_1000.cpp"
+            callDtor( 700, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 736:
+        {
+            // stmt ::= KW728 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7607 "bench/work/wide_1000.cpp"
+            callDtor( 701, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 737:
+        {
+            // stmt ::= KW729 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7617 "bench/work/wide_1000.cpp"
+            callDtor( 702, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 738:
+        {
+            // stmt ::= KW730 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7627 "bench/work/wide_1000.cpp"
+            callDtor( 704, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 739:
+        {
+            // stmt ::= KW731 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7637 "bench/work/wide_1000.cpp"
+            callDtor( 705, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 740:
+        {
+            // stmt ::= KW732 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7647 "bench/work/wide_1000.cpp"
+            callDtor( 706, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 741:
+        {
+            // stmt ::= KW733 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7657 "bench/work/wide_1000.cpp"
+            callDtor( 707, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 742:
+        {
+            // stmt ::= KW734 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7667 "bench/work/wide_1000.cpp"
+            callDtor( 708, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 743:
+        {
+            // stmt ::= KW735 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7677 "bench/work/wide_1000.cpp"
+            callDtor( 709, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 744:
+        {
+            // stmt ::= KW736 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7687 "bench/work/wide_1000.cpp"
+            callDtor( 710, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 745:
+        {
+            // stmt ::= KW737 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7697 "bench/work/wide_1000.cpp"
+            callDtor( 711, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 746:
+        {
+            // stmt ::= KW738 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7707 "bench/work/wide_1000.cpp"
+            callDtor( 712, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 747:
+        {
+            // stmt ::= KW739 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7717 "bench/work/wide_1000.cpp"
+            callDtor( 713, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 748:
+        {
+            // stmt ::= KW740 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7727 "bench/work/wide_1000.cpp"
+            callDtor( 715, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 749:
+        {
+            // stmt ::= KW741 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7737 "bench/work/wide_1000.cpp"
+            callDtor( 716, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 750:
+        {
+            // stmt ::= KW742 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7747 "bench/work/wide_1000.cpp"
+            callDtor( 717, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 751:
+        {
+            // stmt ::= KW743 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7757 "bench/work/wide_1000.cpp"
+            callDtor( 718, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 752:
+        {
+            // stmt ::= KW744 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7767 "bench/work/wide_1000.cpp"
+            callDtor( 719, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 753:
+        {
+            // stmt ::= KW745 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7777 "bench/work/wide_1000.cpp"
+            callDtor( 720, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 754:
+        {
+            // stmt ::= KW746 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7787 "bench/work/wide_1000.cpp"
+            callDtor( 721, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 755:
+        {
+            // stmt ::= KW747 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7797 "bench/work/wide_1000.cpp"
+            callDtor( 722, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 756:
+        {
+            // stmt ::= KW748 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7807 "bench/work/wide_1000.cpp"
+            callDtor( 723, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 757:
+        {
+            // stmt ::= KW749 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7817 "bench/work/wide_1000.cpp"
+            callDtor( 724, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 758:
+        {
+            // stmt ::= KW750 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7827 "bench/work/wide_1000.cpp"
+            callDtor( 726, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 759:
+        {
+            // stmt ::= KW751 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7837 "bench/work/wide_1000.cpp"
+            callDtor( 727, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 760:
+        {
+            // stmt ::= KW752 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7847 "bench/work/wide_1000.cpp"
+            callDtor( 728, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 761:
+        {
+            // stmt ::= KW753 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7857 "bench/work/wide_1000.cpp"
+            callDtor( 729, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 762:
+        {
+            // stmt ::= KW754 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7867 "bench/work/wide_1000.cpp"
+            callDtor( 730, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 763:
+        {
+            // stmt ::= KW755 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7877 "bench/work/wide_1000.cpp"
+            callDtor( 731, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 764:
+        {
+            // stmt ::= KW756 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7887 "bench/work/wide_1000.cpp"
+            callDtor( 732, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 765:
+        {
+            // stmt ::= KW757 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7897 "bench/work/wide_1000.cpp"
+            callDtor( 733, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 766:
+        {
+            // stmt ::= KW758 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7907 "bench/work/wide_1000.cpp"
+            callDtor( 734, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 767:
+        {
+            // stmt ::= KW759 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7917 "bench/work/wide_1000.cpp"
+            callDtor( 735, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 768:
+        {
+            // stmt ::= KW760 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7927 "bench/work/wide_1000.cpp"
+            callDtor( 737, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 769:
+        {
+            // stmt ::= KW761 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7937 "bench/work/wide_1000.cpp"
+            callDtor( 738, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 770:
+        {
+            // stmt ::= KW762 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7947 "bench/work/wide_1000.cpp"
+            callDtor( 739, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 771:
+        {
+            // stmt ::= KW763 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7957 "bench/work/wide_1000.cpp"
+            callDtor( 740, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 772:
+        {
+            // stmt ::= KW764 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7967 "bench/work/wide_1000.cpp"
+            callDtor( 741, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 773:
+        {
+            // stmt ::= KW765 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7977 "bench/work/wide_1000.cpp"
+            callDtor( 742, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 774:
+        {
+            // stmt ::= KW766 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7987 "bench/work/wide_1000.cpp"
+            callDtor( 743, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 775:
+        {
+            // stmt ::= KW767 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 7997 "bench/work/wide_1000.cpp"
+            callDtor( 744, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 776:
+        {
+            // stmt ::= KW768 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8007 "bench/work/wide_1000.cpp"
+            callDtor( 745, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 777:
+        {
+            // stmt ::= KW769 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8017 "bench/work/wide_1000.cpp"
+            callDtor( 746, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 778:
+        {
+            // stmt ::= KW770 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8027 "bench/work/wide_1000.cpp"
+            callDtor( 748, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 779:
+        {
+            // stmt ::= KW771 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8037 "bench/work/wide_1000.cpp"
+            callDtor( 749, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 780:
+        {
+            // stmt ::= KW772 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8047 "bench/work/wide_1000.cpp"
+            callDtor( 750, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 781:
+        {
+            // stmt ::= KW773 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8057 "bench/work/wide_1000.cpp"
+            callDtor( 751, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 782:
+        {
+            // stmt ::= KW774 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8067 "bench/work/wide_1000.cpp"
+            callDtor( 752, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 783:
+        {
+            // stmt ::= KW775 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8077 "bench/work/wide_1000.cpp"
+            callDtor( 753, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 784:
+        {
+            // stmt ::= KW776 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8087 "bench/work/wide_1000.cpp"
+            callDtor( 754, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 785:
+        {
+            // stmt ::= KW777 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8097 "bench/work/wide_1000.cpp"
+            callDtor( 755, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 786:
+        {
+            // stmt ::= KW778 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8107 "bench/work/wide_1000.cpp"
+            callDtor( 756, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 787:
+        {
+            // stmt ::= KW779 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8117 "bench/work/wide_1000.cpp"
+            callDtor( 757, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 788:
+        {
+            // stmt ::= KW780 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8127 "bench/work/wide_1000.cpp"
+            callDtor( 759, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 789:
+        {
+            // stmt ::= KW781 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8137 "bench/work/wide_1000.cpp"
+            callDtor( 760, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 790:
+        {
+            // stmt ::= KW782 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8147 "bench/work/wide_1000.cpp"
+            callDtor( 761, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 791:
+        {
+            // stmt ::= KW783 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8157 "bench/work/wide_1000.cpp"
+            callDtor( 762, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 792:
+        {
+            // stmt ::= KW784 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8167 "bench/work/wide_1000.cpp"
+            callDtor( 763, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 793:
+        {
+            // stmt ::= KW785 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8177 "bench/work/wide_1000.cpp"
+            callDtor( 764, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 794:
+        {
+            // stmt ::= KW786 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8187 "bench/work/wide_1000.cpp"
+            callDtor( 765, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 795:
+        {
+            // stmt ::= KW787 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8197 "bench/work/wide_1000.cpp"
+            callDtor( 766, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 796:
+        {
+            // stmt ::= KW788 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8207 "bench/work/wide_1000.cpp"
+            callDtor( 767, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 797:
+        {
+            // stmt ::= KW789 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8217 "bench/work/wide_1000.cpp"
+            callDtor( 768, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 798:
+        {
+            // stmt ::= KW790 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8227 "bench/work/wide_1000.cpp"
+            callDtor( 770, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 799:
+        {
+            // stmt ::= KW791 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8237 "bench/work/wide_1000.cpp"
+            callDtor( 771, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 800:
+        {
+            // stmt ::= KW792 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8247 "bench/work/wide_1000.cpp"
+            callDtor( 772, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 801:
+        {
+            // stmt ::= KW793 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8257 "bench/work/wide_1000.cpp"
+            callDtor( 773, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 802:
+        {
+            // stmt ::= KW794 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8267 "bench/work/wide_1000.cpp"
+            callDtor( 774, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 803:
+        {
+            // stmt ::= KW795 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8277 "bench/work/wide_1000.cpp"
+            callDtor( 775, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 804:
+        {
+            // stmt ::= KW796 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8287 "bench/work/wide_1000.cpp"
+            callDtor( 776, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 805:
+        {
+            // stmt ::= KW797 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8297 "bench/work/wide_1000.cpp"
+            callDtor( 777, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 806:
+        {
+            // stmt ::= KW798 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8307 "bench/work/wide_1000.cpp"
+            callDtor( 778, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 807:
+        {
+            // stmt ::= KW799 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8317 "bench/work/wide_1000.cpp"
+            callDtor( 779, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 808:
+        {
+            // stmt ::= KW800 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8327 "bench/work/wide_1000.cpp"
+            callDtor( 782, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 809:
+        {
+            // stmt ::= KW801 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8337 "bench/work/wide_1000.cpp"
+            callDtor( 783, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 810:
+        {
+            // stmt ::= KW802 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8347 "bench/work/wide_1000.cpp"
+            callDtor( 784, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 811:
+        {
+            // stmt ::= KW803 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8357 "bench/work/wide_1000.cpp"
+            callDtor( 785, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 812:
+        {
+            // stmt ::= KW804 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8367 "bench/work/wide_1000.cpp"
+            callDtor( 786, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 813:
+        {
+            // stmt ::= KW805 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8377 "bench/work/wide_1000.cpp"
+            callDtor( 787, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 814:
+        {
+            // stmt ::= KW806 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8387 "bench/work/wide_1000.cpp"
+            callDtor( 788, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 815:
+        {
+            // stmt ::= KW807 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8397 "bench/work/wide_1000.cpp"
+            callDtor( 789, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 816:
+        {
+            // stmt ::= KW808 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8407 "bench/work/wide_1000.cpp"
+            callDtor( 790, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 817:
+        {
+            // stmt ::= KW809 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8417 "bench/work/wide_1000.cpp"
+            callDtor( 791, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 818:
+        {
+            // stmt ::= KW810 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8427 "bench/work/wide_1000.cpp"
+            callDtor( 793, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 819:
+        {
+            // stmt ::= KW811 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8437 "bench/work/wide_1000.cpp"
+            callDtor( 794, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 820:
+        {
+            // stmt ::= KW812 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8447 "bench/work/wide_1000.cpp"
+            callDtor( 795, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 821:
+        {
+            // stmt ::= KW813 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8457 "bench/work/wide_1000.cpp"
+            callDtor( 796, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 822:
+        {
+            // stmt ::= KW814 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8467 "bench/work/wide_1000.cpp"
+            callDtor( 797, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 823:
+        {
+            // stmt ::= KW815 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8477 "bench/work/wide_1000.cpp"
+            callDtor( 798, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 824:
+        {
+            // stmt ::= KW816 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8487 "bench/work/wide_1000.cpp"
+            callDtor( 799, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 825:
+        {
+            // stmt ::= KW817 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8497 "bench/work/wide_1000.cpp"
+            callDtor( 800, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 826:
+        {
+            // stmt ::= KW818 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8507 "bench/work/wide_1000.cpp"
+            callDtor( 801, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 827:
+        {
+            // stmt ::= KW819 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8517 "bench/work/wide_1000.cpp"
+            callDtor( 802, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 828:
+        {
+            // stmt ::= KW820 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8527 "bench/work/wide_1000.cpp"
+            callDtor( 804, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 829:
+        {
+            // stmt ::= KW821 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8537 "bench/work/wide_1000.cpp"
+            callDtor( 805, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 830:
+        {
+            // stmt ::= KW822 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8547 "bench/work/wide_1000.cpp"
+            callDtor( 806, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 831:
+        {
+            // stmt ::= KW823 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8557 "bench/work/wide_1000.cpp"
+            callDtor( 807, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 832:
+        {
+            // stmt ::= KW824 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8567 "bench/work/wide_1000.cpp"
+            callDtor( 808, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 833:
+        {
+            // stmt ::= KW825 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8577 "bench/work/wide_1000.cpp"
+            callDtor( 809, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 834:
+        {
+            // stmt ::= KW826 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8587 "bench/work/wide_1000.cpp"
+            callDtor( 810, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 835:
+        {
+            // stmt ::= KW827 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8597 "bench/work/wide_1000.cpp"
+            callDtor( 811, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 836:
+        {
+            // stmt ::= KW828 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8607 "bench/work/wide_1000.cpp"
+            callDtor( 812, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 837:
+        {
+            // stmt ::= KW829 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8617 "bench/work/wide_1000.cpp"
+            callDtor( 813, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 838:
+        {
+            // stmt ::= KW830 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8627 "bench/work/wide_1000.cpp"
+            callDtor( 815, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 839:
+        {
+            // stmt ::= KW831 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8637 "bench/work/wide_1000.cpp"
+            callDtor( 816, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 840:
+        {
+            // stmt ::= KW832 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8647 "bench/work/wide_1000.cpp"
+            callDtor( 817, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 841:
+        {
+            // stmt ::= KW833 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8657 "bench/work/wide_1000.cpp"
+            callDtor( 818, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 842:
+        {
+            // stmt ::= KW834 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8667 "bench/work/wide_1000.cpp"
+            callDtor( 819, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 843:
+        {
+            // stmt ::= KW835 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8677 "bench/work/wide_1000.cpp"
+            callDtor( 820, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 844:
+        {
+            // stmt ::= KW836 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8687 "bench/work/wide_1000.cpp"
+            callDtor( 821, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 845:
+        {
+            // stmt ::= KW837 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8697 "bench/work/wide_1000.cpp"
+            callDtor( 822, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 846:
+        {
+            // stmt ::= KW838 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8707 "bench/work/wide_1000.cpp"
+            callDtor( 823, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 847:
+        {
+            // stmt ::= KW839 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8717 "bench/work/wide_1000.cpp"
+            callDtor( 824, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 848:
+        {
+            // stmt ::= KW840 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8727 "bench/work/wide_1000.cpp"
+            callDtor( 826, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 849:
+        {
+            // stmt ::= KW841 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8737 "bench/work/wide_1000.cpp"
+            callDtor( 827, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 850:
+        {
+            // stmt ::= KW842 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8747 "bench/work/wide_1000.cpp"
+            callDtor( 828, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 851:
+        {
+            // stmt ::= KW843 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8757 "bench/work/wide_1000.cpp"
+            callDtor( 829, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 852:
+        {
+            // stmt ::= KW844 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8767 "bench/work/wide_1000.cpp"
+            callDtor( 830, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 853:
+        {
+            // stmt ::= KW845 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8777 "bench/work/wide_1000.cpp"
+            callDtor( 831, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 854:
+        {
+            // stmt ::= KW846 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8787 "bench/work/wide_1000.cpp"
+            callDtor( 832, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 855:
+        {
+            // stmt ::= KW847 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8797 "bench/work/wide_1000.cpp"
+            callDtor( 833, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 856:
+        {
+            // stmt ::= KW848 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8807 "bench/work/wide_1000.cpp"
+            callDtor( 834, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 857:
+        {
+            // stmt ::= KW849 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8817 "bench/work/wide_1000.cpp"
+            callDtor( 835, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 858:
+        {
+            // stmt ::= KW850 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8827 "bench/work/wide_1000.cpp"
+            callDtor( 837, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 859:
+        {
+            // stmt ::= KW851 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8837 "bench/work/wide_1000.cpp"
+            callDtor( 838, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 860:
+        {
+            // stmt ::= KW852 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8847 "bench/work/wide_1000.cpp"
+            callDtor( 839, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 861:
+        {
+            // stmt ::= KW853 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8857 "bench/work/wide_1000.cpp"
+            callDtor( 840, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 862:
+        {
+            // stmt ::= KW854 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8867 "bench/work/wide_1000.cpp"
+            callDtor( 841, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 863:
+        {
+            // stmt ::= KW855 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8877 "bench/work/wide_1000.cpp"
+            callDtor( 842, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 864:
+        {
+            // stmt ::= KW856 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8887 "bench/work/wide_1000.cpp"
+            callDtor( 843, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 865:
+        {
+            // stmt ::= KW857 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8897 "bench/work/wide_1000.cpp"
+            callDtor( 844, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 866:
+        {
+            // stmt ::= KW858 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8907 "bench/work/wide_1000.cpp"
+            callDtor( 845, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 867:
+        {
+            // stmt ::= KW859 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8917 "bench/work/wide_1000.cpp"
+            callDtor( 846, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 868:
+        {
+            // stmt ::= KW860 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8927 "bench/work/wide_1000.cpp"
+            callDtor( 848, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 869:
+        {
+            // stmt ::= KW861 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8937 "bench/work/wide_1000.cpp"
+            callDtor( 849, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 870:
+        {
+            // stmt ::= KW862 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8947 "bench/work/wide_1000.cpp"
+            callDtor( 850, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 871:
+        {
+            // stmt ::= KW863 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8957 "bench/work/wide_1000.cpp"
+            callDtor( 851, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 872:
+        {
+            // stmt ::= KW864 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8967 "bench/work/wide_1000.cpp"
+            callDtor( 852, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 873:
+        {
+            // stmt ::= KW865 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8977 "bench/work/wide_1000.cpp"
+            callDtor( 853, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 874:
+        {
+            // stmt ::= KW866 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8987 "bench/work/wide_1000.cpp"
+            callDtor( 854, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 875:
+        {
+            // stmt ::= KW867 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 8997 "bench/work/wide_1000.cpp"
+            callDtor( 855, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 876:
+        {
+            // stmt ::= KW868 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9007 "bench/work/wide_1000.cpp"
+            callDtor( 856, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 877:
+        {
+            // stmt ::= KW869 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9017 "bench/work/wide_1000.cpp"
+            callDtor( 857, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 878:
+        {
+            // stmt ::= KW870 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9027 "bench/work/wide_1000.cpp"
+            callDtor( 859, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 879:
+        {
+            // stmt ::= KW871 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9037 "bench/work/wide_1000.cpp"
+            callDtor( 860, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 880:
+        {
+            // stmt ::= KW872 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9047 "bench/work/wide_1000.cpp"
+            callDtor( 861, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 881:
+        {
+            // stmt ::= KW873 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9057 "bench/work/wide_1000.cpp"
+            callDtor( 862, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 882:
+        {
+            // stmt ::= KW874 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9067 "bench/work/wide_1000.cpp"
+            callDtor( 863, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 883:
+        {
+            // stmt ::= KW875 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9077 "bench/work/wide_1000.cpp"
+            callDtor( 864, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 884:
+        {
+            // stmt ::= KW876 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9087 "bench/work/wide_1000.cpp"
+            callDtor( 865, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 885:
+        {
+            // stmt ::= KW877 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9097 "bench/work/wide_1000.cpp"
+            callDtor( 866, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 886:
+        {
+            // stmt ::= KW878 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9107 "bench/work/wide_1000.cpp"
+            callDtor( 867, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 887:
+        {
+            // stmt ::= KW879 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9117 "bench/work/wide_1000.cpp"
+            callDtor( 868, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 888:
+        {
+            // stmt ::= KW880 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9127 "bench/work/wide_1000.cpp"
+            callDtor( 870, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 889:
+        {
+            // stmt ::= KW881 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9137 "bench/work/wide_1000.cpp"
+            callDtor( 871, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 890:
+        {
+            // stmt ::= KW882 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9147 "bench/work/wide_1000.cpp"
+            callDtor( 872, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 891:
+        {
+            // stmt ::= KW883 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9157 "bench/work/wide_1000.cpp"
+            callDtor( 873, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 892:
+        {
+            // stmt ::= KW884 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9167 "bench/work/wide_1000.cpp"
+            callDtor( 874, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 893:
+        {
+            // stmt ::= KW885 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9177 "bench/work/wide_1000.cpp"
+            callDtor( 875, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 894:
+        {
+            // stmt ::= KW886 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9187 "bench/work/wide_1000.cpp"
+            callDtor( 876, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 895:
+        {
+            // stmt ::= KW887 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9197 "bench/work/wide_1000.cpp"
+            callDtor( 877, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 896:
+        {
+            // stmt ::= KW888 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9207 "bench/work/wide_1000.cpp"
+            callDtor( 878, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 897:
+        {
+            // stmt ::= KW889 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9217 "bench/work/wide_1000.cpp"
+            callDtor( 879, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 898:
+        {
+            // stmt ::= KW890 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9227 "bench/work/wide_1000.cpp"
+            callDtor( 881, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 899:
+        {
+            // stmt ::= KW891 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9237 "bench/work/wide_1000.cpp"
+            callDtor( 882, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 900:
+        {
+            // stmt ::= KW892 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9247 "bench/work/wide_1000.cpp"
+            callDtor( 883, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 901:
+        {
+            // stmt ::= KW893 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9257 "bench/work/wide_1000.cpp"
+            callDtor( 884, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 902:
+        {
+            // stmt ::= KW894 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9267 "bench/work/wide_1000.cpp"
+            callDtor( 885, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 903:
+        {
+            // stmt ::= KW895 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9277 "bench/work/wide_1000.cpp"
+            callDtor( 886, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 904:
+        {
+            // stmt ::= KW896 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9287 "bench/work/wide_1000.cpp"
+            callDtor( 887, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 905:
+        {
+            // stmt ::= KW897 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9297 "bench/work/wide_1000.cpp"
+            callDtor( 888, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 906:
+        {
+            // stmt ::= KW898 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9307 "bench/work/wide_1000.cpp"
+            callDtor( 889, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 907:
+        {
+            // stmt ::= KW899 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9317 "bench/work/wide_1000.cpp"
+            callDtor( 890, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 908:
+        {
+            // stmt ::= KW900 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9327 "bench/work/wide_1000.cpp"
+            callDtor( 893, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 909:
+        {
+            // stmt ::= KW901 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9337 "bench/work/wide_1000.cpp"
+            callDtor( 894, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 910:
+        {
+            // stmt ::= KW902 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9347 "bench/work/wide_1000.cpp"
+            callDtor( 895, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 911:
+        {
+            // stmt ::= KW903 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9357 "bench/work/wide_1000.cpp"
+            callDtor( 896, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 912:
+        {
+            // stmt ::= KW904 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9367 "bench/work/wide_1000.cpp"
+            callDtor( 897, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 913:
+        {
+            // stmt ::= KW905 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9377 "bench/work/wide_1000.cpp"
+            callDtor( 898, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 914:
+        {
+            // stmt ::= KW906 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9387 "bench/work/wide_1000.cpp"
+            callDtor( 899, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 915:
+        {
+            // stmt ::= KW907 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9397 "bench/work/wide_1000.cpp"
+            callDtor( 900, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 916:
+        {
+            // stmt ::= KW908 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9407 "bench/work/wide_1000.cpp"
+            callDtor( 901, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 917:
+        {
+            // stmt ::= KW909 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9417 "bench/work/wide_1000.cpp"
+            callDtor( 902, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 918:
+        {
+            // stmt ::= KW910 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9427 "bench/work/wide_1000.cpp"
+            callDtor( 904, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 919:
+        {
+            // stmt ::= KW911 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9437 "bench/work/wide_1000.cpp"
+            callDtor( 905, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 920:
+        {
+            // stmt ::= KW912 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9447 "bench/work/wide_1000.cpp"
+            callDtor( 906, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 921:
+        {
+            // stmt ::= KW913 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9457 "bench/work/wide_1000.cpp"
+            callDtor( 907, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 922:
+        {
+            // stmt ::= KW914 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9467 "bench/work/wide_1000.cpp"
+            callDtor( 908, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 923:
+        {
+            // stmt ::= KW915 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9477 "bench/work/wide_1000.cpp"
+            callDtor( 909, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 924:
+        {
+            // stmt ::= KW916 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9487 "bench/work/wide_1000.cpp"
+            callDtor( 910, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 925:
+        {
+            // stmt ::= KW917 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9497 "bench/work/wide_1000.cpp"
+            callDtor( 911, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 926:
+        {
+            // stmt ::= KW918 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9507 "bench/work/wide_1000.cpp"
+            callDtor( 912, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 927:
+        {
+            // stmt ::= KW919 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9517 "bench/work/wide_1000.cpp"
+            callDtor( 913, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 928:
+        {
+            // stmt ::= KW920 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9527 "bench/work/wide_1000.cpp"
+            callDtor( 915, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 929:
+        {
+            // stmt ::= KW921 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9537 "bench/work/wide_1000.cpp"
+            callDtor( 916, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 930:
+        {
+            // stmt ::= KW922 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9547 "bench/work/wide_1000.cpp"
+            callDtor( 917, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 931:
+        {
+            // stmt ::= KW923 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9557 "bench/work/wide_1000.cpp"
+            callDtor( 918, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 932:
+        {
+            // stmt ::= KW924 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9567 "bench/work/wide_1000.cpp"
+            callDtor( 919, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 933:
+        {
+            // stmt ::= KW925 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9577 "bench/work/wide_1000.cpp"
+            callDtor( 920, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 934:
+        {
+            // stmt ::= KW926 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9587 "bench/work/wide_1000.cpp"
+            callDtor( 921, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 935:
+        {
+            // stmt ::= KW927 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9597 "bench/work/wide_1000.cpp"
+            callDtor( 922, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 936:
+        {
+            // stmt ::= KW928 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9607 "bench/work/wide_1000.cpp"
+            callDtor( 923, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 937:
+        {
+            // stmt ::= KW929 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9617 "bench/work/wide_1000.cpp"
+            callDtor( 924, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 938:
+        {
+            // stmt ::= KW930 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9627 "bench/work/wide_1000.cpp"
+            callDtor( 926, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 939:
+        {
+            // stmt ::= KW931 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9637 "bench/work/wide_1000.cpp"
+            callDtor( 927, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 940:
+        {
+            // stmt ::= KW932 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9647 "bench/work/wide_1000.cpp"
+            callDtor( 928, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 941:
+        {
+            // stmt ::= KW933 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9657 "bench/work/wide_1000.cpp"
+            callDtor( 929, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 942:
+        {
+            // stmt ::= KW934 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9667 "bench/work/wide_1000.cpp"
+            callDtor( 930, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 943:
+        {
+            // stmt ::= KW935 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9677 "bench/work/wide_1000.cpp"
+            callDtor( 931, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 944:
+        {
+            // stmt ::= KW936 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9687 "bench/work/wide_1000.cpp"
+            callDtor( 932, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 945:
+        {
+            // stmt ::= KW937 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9697 "bench/work/wide_1000.cpp"
+            callDtor( 933, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 946:
+        {
+            // stmt ::= KW938 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9707 "bench/work/wide_1000.cpp"
+            callDtor( 934, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 947:
+        {
+            // stmt ::= KW939 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9717 "bench/work/wide_1000.cpp"
+            callDtor( 935, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 948:
+        {
+            // stmt ::= KW940 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9727 "bench/work/wide_1000.cpp"
+            callDtor( 937, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 949:
+        {
+            // stmt ::= KW941 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9737 "bench/work/wide_1000.cpp"
+            callDtor( 938, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 950:
+        {
+            // stmt ::= KW942 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9747 "bench/work/wide_1000.cpp"
+            callDtor( 939, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 951:
+        {
+            // stmt ::= KW943 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9757 "bench/work/wide_1000.cpp"
+            callDtor( 940, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 952:
+        {
+            // stmt ::= KW944 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9767 "bench/work/wide_1000.cpp"
+            callDtor( 941, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 953:
+        {
+            // stmt ::= KW945 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9777 "bench/work/wide_1000.cpp"
+            callDtor( 942, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 954:
+        {
+            // stmt ::= KW946 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9787 "bench/work/wide_1000.cpp"
+            callDtor( 943, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 955:
+        {
+            // stmt ::= KW947 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9797 "bench/work/wide_1000.cpp"
+            callDtor( 944, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 956:
+        {
+            // stmt ::= KW948 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9807 "bench/work/wide_1000.cpp"
+            callDtor( 945, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 957:
+        {
+            // stmt ::= KW949 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9817 "bench/work/wide_1000.cpp"
+            callDtor( 946, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 958:
+        {
+            // stmt ::= KW950 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9827 "bench/work/wide_1000.cpp"
+            callDtor( 948, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 959:
+        {
+            // stmt ::= KW951 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9837 "bench/work/wide_1000.cpp"
+            callDtor( 949, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 960:
+        {
+            // stmt ::= KW952 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9847 "bench/work/wide_1000.cpp"
+            callDtor( 950, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 961:
+        {
+            // stmt ::= KW953 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9857 "bench/work/wide_1000.cpp"
+            callDtor( 951, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 962:
+        {
+            // stmt ::= KW954 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9867 "bench/work/wide_1000.cpp"
+            callDtor( 952, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 963:
+        {
+            // stmt ::= KW955 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9877 "bench/work/wide_1000.cpp"
+            callDtor( 953, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 964:
+        {
+            // stmt ::= KW956 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9887 "bench/work/wide_1000.cpp"
+            callDtor( 954, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 965:
+        {
+            // stmt ::= KW957 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9897 "bench/work/wide_1000.cpp"
+            callDtor( 955, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 966:
+        {
+            // stmt ::= KW958 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9907 "bench/work/wide_1000.cpp"
+            callDtor( 956, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 967:
+        {
+            // stmt ::= KW959 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9917 "bench/work/wide_1000.cpp"
+            callDtor( 957, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 968:
+        {
+            // stmt ::= KW960 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9927 "bench/work/wide_1000.cpp"
+            callDtor( 959, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 969:
+        {
+            // stmt ::= KW961 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9937 "bench/work/wide_1000.cpp"
+            callDtor( 960, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 970:
+        {
+            // stmt ::= KW962 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9947 "bench/work/wide_1000.cpp"
+            callDtor( 961, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 971:
+        {
+            // stmt ::= KW963 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9957 "bench/work/wide_1000.cpp"
+            callDtor( 962, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 972:
+        {
+            // stmt ::= KW964 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9967 "bench/work/wide_1000.cpp"
+            callDtor( 963, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 973:
+        {
+            // stmt ::= KW965 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9977 "bench/work/wide_1000.cpp"
+            callDtor( 964, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 974:
+        {
+            // stmt ::= KW966 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9987 "bench/work/wide_1000.cpp"
+            callDtor( 965, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 975:
+        {
+            // stmt ::= KW967 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 9997 "bench/work/wide_1000.cpp"
+            callDtor( 966, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 976:
+        {
+            // stmt ::= KW968 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10007 "bench/work/wide_1000.cpp"
+            callDtor( 967, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 977:
+        {
+            // stmt ::= KW969 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10017 "bench/work/wide_1000.cpp"
+            callDtor( 968, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 978:
+        {
+            // stmt ::= KW970 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10027 "bench/work/wide_1000.cpp"
+            callDtor( 970, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 979:
+        {
+            // stmt ::= KW971 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10037 "bench/work/wide_1000.cpp"
+            callDtor( 971, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 980:
+        {
+            // stmt ::= KW972 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10047 "bench/work/wide_1000.cpp"
+            callDtor( 972, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 981:
+        {
+            // stmt ::= KW973 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10057 "bench/work/wide_1000.cpp"
+            callDtor( 973, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 982:
+        {
+            // stmt ::= KW974 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10067 "bench/work/wide_1000.cpp"
+            callDtor( 974, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 983:
+        {
+            // stmt ::= KW975 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10077 "bench/work/wide_1000.cpp"
+            callDtor( 975, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 984:
+        {
+            // stmt ::= KW976 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10087 "bench/work/wide_1000.cpp"
+            callDtor( 976, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 985:
+        {
+            // stmt ::= KW977 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10097 "bench/work/wide_1000.cpp"
+            callDtor( 977, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 986:
+        {
+            // stmt ::= KW978 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10107 "bench/work/wide_1000.cpp"
+            callDtor( 978, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 987:
+        {
+            // stmt ::= KW979 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10117 "bench/work/wide_1000.cpp"
+            callDtor( 979, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 988:
+        {
+            // stmt ::= KW980 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10127 "bench/work/wide_1000.cpp"
+            callDtor( 981, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 989:
+        {
+            // stmt ::= KW981 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10137 "bench/work/wide_1000.cpp"
+            callDtor( 982, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 990:
+        {
+            // stmt ::= KW982 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10147 "bench/work/wide_1000.cpp"
+            callDtor( 983, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 991:
+        {
+            // stmt ::= KW983 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10157 "bench/work/wide_1000.cpp"
+            callDtor( 984, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 992:
+        {
+            // stmt ::= KW984 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10167 "bench/work/wide_1000.cpp"
+            callDtor( 985, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 993:
+        {
+            // stmt ::= KW985 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10177 "bench/work/wide_1000.cpp"
+            callDtor( 986, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 994:
+        {
+            // stmt ::= KW986 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10187 "bench/work/wide_1000.cpp"
+            callDtor( 987, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 995:
+        {
+            // stmt ::= KW987 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10197 "bench/work/wide_1000.cpp"
+            callDtor( 988, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 996:
+        {
+            // stmt ::= KW988 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10207 "bench/work/wide_1000.cpp"
+            callDtor( 989, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 997:
+        {
+            // stmt ::= KW989 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10217 "bench/work/wide_1000.cpp"
+            callDtor( 990, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 998:
+        {
+            // stmt ::= KW990 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10227 "bench/work/wide_1000.cpp"
+            callDtor( 992, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        case 999:
+        {
+            // stmt ::= KW991 expr
+#line 0 "bench/work/wide_1000.lem"
+#line 10237 "bench/work/wide_1000.cpp"
+            callDtor( 993, rhsData[0] );
+            callDtor( 1000, rhsData[1] );
+            break;
+        }
+
+        default:
+            throw "Unknown Rule Number";
+            break;
+    }
+
+    if ( PA_SHIFT == next )
+        shift( newVal, myRules[ruleNum].first, data );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::callDtor( int symIdx, privBenchImpl::Value &data )
+{
+    switch ( symIdx )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+        case 12:
+        case 13:
+        case 14:
+        case 15:
+        case 16:
+        case 17:
+        case 18:
+        case 19:
+        case 20:
+        case 21:
+        case 22:
+        case 23:
+        case 24:
+        case 25:
+        case 26:
+        case 27:
+        case 28:
+        case 29:
+        case 30:
+        case 31:
+        case 32:
+        case 33:
+        case 34:
+        case 35:
+        case 36:
+        case 37:
+        case 38:
+        case 39:
+        case 40:
+        case 41:
+        case 42:
+        case 43:
+        case 44:
+        case 45:
+        case 46:
+        case 47:
+        case 48:
+        case 49:
+        case 50:
+        case 51:
+        case 52:
+        case 53:
+        case 54:
+        case 55:
+        case 56:
+        case 57:
+        case 58:
+        case 59:
+        case 60:
+        case 61:
+        case 62:
+        case 63:
+        case 64:
+        case 65:
+        case 66:
+        case 67:
+        case 68:
+        case 69:
+        case 70:
+        case 71:
+        case 72:
+        case 73:
+        case 74:
+        case 75:
+        case 76:
+        case 77:
+        case 78:
+        case 79:
+        case 80:
+        case 81:
+        case 82:
+        case 83:
+        case 84:
+        case 85:
+        case 86:
+        case 87:
+        case 88:
+        case 89:
+        case 90:
+        case 91:
+        case 92:
+        case 93:
+        case 94:
+        case 95:
+        case 96:
+        case 97:
+        case 98:
+        case 99:
+        case 100:
+        case 101:
+        case 102:
+        case 103:
+        case 104:
+        case 105:
+        case 106:
+        case 107:
+        case 108:
+        case 109:
+        case 110:
+        case 111:
+        case 112:
+        case 113:
+        case 114:
+        case 115:
+        case 116:
+        case 117:
+        case 118:
+        case 119:
+        case 120:
+        case 121:
+        case 122:
+        case 123:
+        case 124:
+        case 125:
+        case 126:
+        case 127:
+        case 128:
+        case 129:
+        case 130:
+        case 131:
+        case 132:
+        case 133:
+        case 134:
+        case 135:
+        case 136:
+        case 137:
+        case 138:
+        case 139:
+        case 140:
+        case 141:
+        case 142:
+        case 143:
+        case 144:
+        case 145:
+        case 146:
+        case 147:
+        case 148:
+        case 149:
+        case 150:
+        case 151:
+        case 152:
+        case 153:
+        case 154:
+        case 155:
+        case 156:
+        case 157:
+        case 158:
+        case 159:
+        case 160:
+        case 161:
+        case 162:
+        case 163:
+        case 164:
+        case 165:
+        case 166:
+        case 167:
+        case 168:
+        case 169:
+        case 170:
+        case 171:
+        case 172:
+        case 173:
+        case 174:
+        case 175:
+        case 176:
+        case 177:
+        case 178:
+        case 179:
+        case 180:
+        case 181:
+        case 182:
+        case 183:
+        case 184:
+        case 185:
+        case 186:
+        case 187:
+        case 188:
+        case 189:
+        case 190:
+        case 191:
+        case 192:
+        case 193:
+        case 194:
+        case 195:
+        case 196:
+        case 197:
+        case 198:
+        case 199:
+        case 200:
+        case 201:
+        case 202:
+        case 203:
+        case 204:
+        case 205:
+        case 206:
+        case 207:
+        case 208:
+        case 209:
+        case 210:
+        case 211:
+        case 212:
+        case 213:
+        case 214:
+        case 215:
+        case 216:
+        case 217:
+        case 218:
+        case 219:
+        case 220:
+        case 221:
+        case 222:
+        case 223:
+        case 224:
+        case 225:
+        case 226:
+        case 227:
+        case 228:
+        case 229:
+        case 230:
+        case 231:
+        case 232:
+        case 233:
+        case 234:
+        case 235:
+        case 236:
+        case 237:
+        case 238:
+        case 239:
+        case 240:
+        case 241:
+        case 242:
+        case 243:
+        case 244:
+        case 245:
+        case 246:
+        case 247:
+        case 248:
+        case 249:
+        case 250:
+        case 251:
+        case 252:
+        case 253:
+        case 254:
+        case 255:
+        case 256:
+        case 257:
+        case 258:
+        case 259:
+        case 260:
+        case 261:
+        case 262:
+        case 263:
+        case 264:
+        case 265:
+        case 266:
+        case 267:
+        case 268:
+        case 269:
+        case 270:
+        case 271:
+        case 272:
+        case 273:
+        case 274:
+        case 275:
+        case 276:
+        case 277:
+        case 278:
+        case 279:
+        case 280:
+        case 281:
+        case 282:
+        case 283:
+        case 284:
+        case 285:
+        case 286:
+        case 287:
+        case 288:
+        case 289:
+        case 290:
+        case 291:
+        case 292:
+        case 293:
+        case 294:
+        case 295:
+        case 296:
+        case 297:
+        case 298:
+        case 299:
+        case 300:
+        case 301:
+        case 302:
+        case 303:
+        case 304:
+        case 305:
+        case 306:
+        case 307:
+        case 308:
+        case 309:
+        case 310:
+        case 311:
+        case 312:
+        case 313:
+        case 314:
+        case 315:
+        case 316:
+        case 317:
+        case 318:
+        case 319:
+        case 320:
+        case 321:
+        case 322:
+        case 323:
+        case 324:
+        case 325:
+        case 326:
+        case 327:
+        case 328:
+        case 329:
+        case 330:
+        case 331:
+        case 332:
+        case 333:
+        case 334:
+        case 335:
+        case 336:
+        case 337:
+        case 338:
+        case 339:
+        case 340:
+        case 341:
+        case 342:
+        case 343:
+        case 344:
+        case 345:
+        case 346:
+        case 347:
+        case 348:
+        case 349:
+        case 350:
+        case 351:
+        case 352:
+        case 353:
+        case 354:
+        case 355:
+        case 356:
+        case 357:
+        case 358:
+        case 359:
+        case 360:
+        case 361:
+        case 362:
+        case 363:
+        case 364:
+        case 365:
+        case 366:
+        case 367:
+        case 368:
+        case 369:
+        case 370:
+        case 371:
+        case 372:
+        case 373:
+        case 374:
+        case 375:
+        case 376:
+        case 377:
+        case 378:
+        case 379:
+        case 380:
+        case 381:
+        case 382:
+        case 383:
+        case 384:
+        case 385:
+        case 386:
+        case 387:
+        case 388:
+        case 389:
+        case 390:
+        case 391:
+        case 392:
+        case 393:
+        case 394:
+        case 395:
+        case 396:
+        case 397:
+        case 398:
+        case 399:
+        case 400:
+        case 401:
+        case 402:
+        case 403:
+        case 404:
+        case 405:
+        case 406:
+        case 407:
+        case 408:
+        case 409:
+        case 410:
+        case 411:
+        case 412:
+        case 413:
+        case 414:
+        case 415:
+        case 416:
+        case 417:
+        case 418:
+        case 419:
+        case 420:
+        case 421:
+        case 422:
+        case 423:
+        case 424:
+        case 425:
+        case 426:
+        case 427:
+        case 428:
+        case 429:
+        case 430:
+        case 431:
+        case 432:
+        case 433:
+        case 434:
+        case 435:
+        case 436:
+        case 437:
+        case 438:
+        case 439:
+        case 440:
+        case 441:
+        case 442:
+        case 443:
+        case 444:
+        case 445:
+        case 446:
+        case 447:
+        case 448:
+        case 449:
+        case 450:
+        case 451:
+        case 452:
+        case 453:
+        case 454:
+        case 455:
+        case 456:
+        case 457:
+        case 458:
+        case 459:
+        case 460:
+        case 461:
+        case 462:
+        case 463:
+        case 464:
+        case 465:
+        case 466:
+        case 467:
+        case 468:
+        case 469:
+        case 470:
+        case 471:
+        case 472:
+        case 473:
+        case 474:
+        case 475:
+        case 476:
+        case 477:
+        case 478:
+        case 479:
+        case 480:
+        case 481:
+        case 482:
+        case 483:
+        case 484:
+        case 485:
+        case 486:
+        case 487:
+        case 488:
+        case 489:
+        case 490:
+        case 491:
+        case 492:
+        case 493:
+        case 494:
+        case 495:
+        case 496:
+        case 497:
+        case 498:
+        case 499:
+        case 500:
+        case 501:
+        case 502:
+        case 503:
+        case 504:
+        case 505:
+        case 506:
+        case 507:
+        case 508:
+        case 509:
+        case 510:
+        case 511:
+        case 512:
+        case 513:
+        case 514:
+        case 515:
+        case 516:
+        case 517:
+        case 518:
+        case 519:
+        case 520:
+        case 521:
+        case 522:
+        case 523:
+        case 524:
+        case 525:
+        case 526:
+        case 527:
+        case 528:
+        case 529:
+        case 530:
+        case 531:
+        case 532:
+        case 533:
+        case 534:
+        case 535:
+        case 536:
+        case 537:
+        case 538:
+        case 539:
+        case 540:
+        case 541:
+        case 542:
+        case 543:
+        case 544:
+        case 545:
+        case 546:
+        case 547:
+        case 548:
+        case 549:
+        case 550:
+        case 551:
+        case 552:
+        case 553:
+        case 554:
+        case 555:
+        case 556:
+        case 557:
+        case 558:
+        case 559:
+        case 560:
+        case 561:
+        case 562:
+        case 563:
+        case 564:
+        case 565:
+        case 566:
+        case 567:
+        case 568:
+        case 569:
+        case 570:
+        case 571:
+        case 572:
+        case 573:
+        case 574:
+        case 575:
+        case 576:
+        case 577:
+        case 578:
+        case 579:
+        case 580:
+        case 581:
+        case 582:
+        case 583:
+        case 584:
+        case 585:
+        case 586:
+        case 587:
+        case 588:
+        case 589:
+        case 590:
+        case 591:
+        case 592:
+        case 593:
+        case 594:
+        case 595:
+        case 596:
+        case 597:
+        case 598:
+        case 599:
+        case 600:
+        case 601:
+        case 602:
+        case 603:
+        case 604:
+        case 605:
+        case 606:
+        case 607:
+        case 608:
+        case 609:
+        case 610:
+        case 611:
+        case 612:
+        case 613:
+        case 614:
+        case 615:
+        case 616:
+        case 617:
+        case 618:
+        case 619:
+        case 620:
+        case 621:
+        case 622:
+        case 623:
+        case 624:
+        case 625:
+        case 626:
+        case 627:
+        case 628:
+        case 629:
+        case 630:
+        case 631:
+        case 632:
+        case 633:
+        case 634:
+        case 635:
+        case 636:
+        case 637:
+        case 638:
+        case 639:
+        case 640:
+        case 641:
+        case 642:
+        case 643:
+        case 644:
+        case 645:
+        case 646:
+        case 647:
+        case 648:
+        case 649:
+        case 650:
+        case 651:
+        case 652:
+        case 653:
+        case 654:
+        case 655:
+        case 656:
+        case 657:
+        case 658:
+        case 659:
+        case 660:
+        case 661:
+        case 662:
+        case 663:
+        case 664:
+        case 665:
+        case 666:
+        case 667:
+        case 668:
+        case 669:
+        case 670:
+        case 671:
+        case 672:
+        case 673:
+        case 674:
+        case 675:
+        case 676:
+        case 677:
+        case 678:
+        case 679:
+        case 680:
+        case 681:
+        case 682:
+        case 683:
+        case 684:
+        case 685:
+        case 686:
+        case 687:
+        case 688:
+        case 689:
+        case 690:
+        case 691:
+        case 692:
+        case 693:
+        case 694:
+        case 695:
+        case 696:
+        case 697:
+        case 698:
+        case 699:
+        case 700:
+        case 701:
+        case 702:
+        case 703:
+        case 704:
+        case 705:
+        case 706:
+        case 707:
+        case 708:
+        case 709:
+        case 710:
+        case 711:
+        case 712:
+        case 713:
+        case 714:
+        case 715:
+        case 716:
+        case 717:
+        case 718:
+        case 719:
+        case 720:
+        case 721:
+        case 722:
+        case 723:
+        case 724:
+        case 725:
+        case 726:
+        case 727:
+        case 728:
+        case 729:
+        case 730:
+        case 731:
+        case 732:
+        case 733:
+        case 734:
+        case 735:
+        case 736:
+        case 737:
+        case 738:
+        case 739:
+        case 740:
+        case 741:
+        case 742:
+        case 743:
+        case 744:
+        case 745:
+        case 746:
+        case 747:
+        case 748:
+        case 749:
+        case 750:
+        case 751:
+        case 752:
+        case 753:
+        case 754:
+        case 755:
+        case 756:
+        case 757:
+        case 758:
+        case 759:
+        case 760:
+        case 761:
+        case 762:
+        case 763:
+        case 764:
+        case 765:
+        case 766:
+        case 767:
+        case 768:
+        case 769:
+        case 770:
+        case 771:
+        case 772:
+        case 773:
+        case 774:
+        case 775:
+        case 776:
+        case 777:
+        case 778:
+        case 779:
+        case 780:
+        case 781:
+        case 782:
+        case 783:
+        case 784:
+        case 785:
+        case 786:
+        case 787:
+        case 788:
+        case 789:
+        case 790:
+        case 791:
+        case 792:
+        case 793:
+        case 794:
+        case 795:
+        case 796:
+        case 797:
+        case 798:
+        case 799:
+        case 800:
+        case 801:
+        case 802:
+        case 803:
+        case 804:
+        case 805:
+        case 806:
+        case 807:
+        case 808:
+        case 809:
+        case 810:
+        case 811:
+        case 812:
+        case 813:
+        case 814:
+        case 815:
+        case 816:
+        case 817:
+        case 818:
+        case 819:
+        case 820:
+        case 821:
+        case 822:
+        case 823:
+        case 824:
+        case 825:
+        case 826:
+        case 827:
+        case 828:
+        case 829:
+        case 830:
+        case 831:
+        case 832:
+        case 833:
+        case 834:
+        case 835:
+        case 836:
+        case 837:
+        case 838:
+        case 839:
+        case 840:
+        case 841:
+        case 842:
+        case 843:
+        case 844:
+        case 845:
+        case 846:
+        case 847:
+        case 848:
+        case 849:
+        case 850:
+        case 851:
+        case 852:
+        case 853:
+        case 854:
+        case 855:
+        case 856:
+        case 857:
+        case 858:
+        case 859:
+        case 860:
+        case 861:
+        case 862:
+        case 863:
+        case 864:
+        case 865:
+        case 866:
+        case 867:
+        case 868:
+        case 869:
+        case 870:
+        case 871:
+        case 872:
+        case 873:
+        case 874:
+        case 875:
+        case 876:
+        case 877:
+        case 878:
+        case 879:
+        case 880:
+        case 881:
+        case 882:
+        case 883:
+        case 884:
+        case 885:
+        case 886:
+        case 887:
+        case 888:
+        case 889:
+        case 890:
+        case 891:
+        case 892:
+        case 893:
+        case 894:
+        case 895:
+        case 896:
+        case 897:
+        case 898:
+        case 899:
+        case 900:
+        case 901:
+        case 902:
+        case 903:
+        case 904:
+        case 905:
+        case 906:
+        case 907:
+        case 908:
+        case 909:
+        case 910:
+        case 911:
+        case 912:
+        case 913:
+        case 914:
+        case 915:
+        case 916:
+        case 917:
+        case 918:
+        case 919:
+        case 920:
+        case 921:
+        case 922:
+        case 923:
+        case 924:
+        case 925:
+        case 926:
+        case 927:
+        case 928:
+        case 929:
+        case 930:
+        case 931:
+        case 932:
+        case 933:
+        case 934:
+        case 935:
+        case 936:
+        case 937:
+        case 938:
+        case 939:
+        case 940:
+        case 941:
+        case 942:
+        case 943:
+        case 944:
+        case 945:
+        case 946:
+        case 947:
+        case 948:
+        case 949:
+        case 950:
+        case 951:
+        case 952:
+        case 953:
+        case 954:
+        case 955:
+        case 956:
+        case 957:
+        case 958:
+        case 959:
+        case 960:
+        case 961:
+        case 962:
+        case 963:
+        case 964:
+        case 965:
+        case 966:
+        case 967:
+        case 968:
+        case 969:
+        case 970:
+        case 971:
+        case 972:
+        case 973:
+        case 974:
+        case 975:
+        case 976:
+        case 977:
+        case 978:
+        case 979:
+        case 980:
+        case 981:
+        case 982:
+        case 983:
+        case 984:
+        case 985:
+        case 986:
+        case 987:
+        case 988:
+        case 989:
+        case 990:
+        case 991:
+        case 992:
+        case 993:
+        case 994:
+        case 995:
+        case 996:
+        case 997:
+        case 998:
+            break;
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::popStack( void )
+{
+    callDtor( myStack.top().first.second, myStack.top().second );
+    myStack.pop();
+}
+
+
+////////////////////////////////////////
+
+
+ParserAct privBenchImpl::findParserAction( int &newVal, int tok )
+{
+    int stateNum;
+    ParserAct retval = PA_NOP;
+    bool found = false;
+
+    stateNum = myStack.empty() ? 0 : myStack.top().first.first;
+    ActionMap::iterator i = myStates[stateNum].find( tok );
+    if ( tok >= 0 && tok <= 1005 )
+    {
+        if ( i != myStates[stateNum].end() )
+        {
+            retval = (*i).second.first;
+            newVal = (*i).second.second;
+            found = true;
+        }
+    }
+    else if ( ! myStates[stateNum].empty() )
+    {
+        retval = PA_NOP;
+        newVal = 0;
+        found = true;
+    }
+
+    if ( ! found )
+    {
+        retval = myStateDefaultActions[stateNum].first;
+        newVal = myStateDefaultActions[stateNum].second;
+    }
+    return retval;
+}
+
+
+////////////////////////////////////////
+
+
+static int theStateTable[7966][4] =
+{
+    // State 0
+    { 0, 1001, PA_ACCEPT, 0 },
+    // State 0
+    { 0, 1003, PA_SHIFT, 1 },
+    // State 0
+    { 0, 1005, PA_REDUCE, 1 },
+    // State 0 default action
+    { 0, -1, PA_REDUCE, 1 },
+    // State 1
+    { 1, 0, PA_REDUCE, 0 },
+    // State 1
+    { 1, 2, PA_SHIFT, 4 },
+    // State 1
+    { 1, 3, PA_SHIFT, 14 },
+    // State 1
+    { 1, 4, PA_SHIFT, 32 },
+    // State 1
+    { 1, 5, PA_SHIFT, 212 },
+    // State 1
+    { 1, 6, PA_SHIFT, 214 },
+    // State 1
+    { 1, 7, PA_SHIFT, 216 },
+    // State 1
+    { 1, 8, PA_SHIFT, 218 },
+    // State 1
+    { 1, 9, PA_SHIFT, 220 },
+    // State 1
+    { 1, 10, PA_SHIFT, 222 },
+    // State 1
+    { 1, 11, PA_SHIFT, 224 },
+    // State 1
+    { 1, 12, PA_SHIFT, 226 },
+    // State 1
+    { 1, 13, PA_SHIFT, 228 },
+    // State 1
+    { 1, 14, PA_SHIFT, 230 },
+    // State 1
+    { 1, 15, PA_SHIFT, 34 },
+    // State 1
+    { 1, 16, PA_SHIFT, 232 },
+    // State 1
+    { 1, 17, PA_SHIFT, 234 },
+    // State 1
+    { 1, 18, PA_SHIFT, 236 },
+    // State 1
+    { 1, 19, PA_SHIFT, 238 },
+    // State 1
+    { 1, 20, PA_SHIFT, 240 },
+    // State 1
+    { 1, 21, PA_SHIFT, 242 },
+    // State 1
+    { 1, 22, PA_SHIFT, 244 },
+    // State 1
+    { 1, 23, PA_SHIFT, 246 },
+    // State 1
+    { 1, 24, PA_SHIFT, 248 },
+    // State 1
+    { 1, 25, PA_SHIFT, 250 },
+    // State 1
+    { 1, 26, PA_SHIFT, 36 },
+    // State 1
+    { 1, 27, PA_SHIFT, 252 },
+    // State 1
+    { 1, 28, PA_SHIFT, 254 },
+    // State 1
+    { 1, 29, PA_SHIFT, 256 },
+    // State 1
+    { 1, 30, PA_SHIFT, 258 },
+    // State 1
+    { 1, 31, PA_SHIFT, 260 },
+    // State 1
+    { 1, 32, PA_SHIFT, 262 },
+    // State 1
+    { 1, 33, PA_SHIFT, 264 },
+    // State 1
+    { 1, 34, PA_SHIFT, 266 },
+    // State 1
+    { 1, 35, PA_SHIFT, 268 },
+    // State 1
+    { 1, 36, PA_SHIFT, 270 },
+    // State 1
+    { 1, 37, PA_SHIFT, 38 },
+    // State 1
+    { 1, 38, PA_SHIFT, 272 },
+    // State 1
+    { 1, 39, PA_SHIFT, 274 },
+    // State 1
+    { 1, 40, PA_SHIFT, 276 },
+    // State 1
+    { 1, 41, PA_SHIFT, 278 },
+    // State 1
+    { 1, 42, PA_SHIFT, 280 },
+    // State 1
+    { 1, 43, PA_SHIFT, 282 },
+    // State 1
+    { 1, 44, PA_SHIFT, 284 },
+    // State 1
+    { 1, 45, PA_SHIFT, 286 },
+    // State 1
+    { 1, 46, PA_SHIFT, 288 },
+    // State 1
+    { 1, 47, PA_SHIFT, 290 },
+    // State 1
+    { 1, 48, PA_SHIFT, 40 },
+    // State 1
+    { 1, 49, PA_SHIFT, 292 },
+    // State 1
+    { 1, 50, PA_SHIFT, 294 },
+    // State 1
+    { 1, 51, PA_SHIFT, 296 },
+    // State 1
+    { 1, 52, PA_SHIFT, 298 },
+    // State 1
+    { 1, 53, PA_SHIFT, 300 },
+    // State 1
+    { 1, 54, PA_SHIFT, 302 },
+    // State 1
+    { 1, 55, PA_SHIFT, 304 },
+    // State 1
+    { 1, 56, PA_SHIFT, 306 },
+    // State 1
+    { 1, 57, PA_SHIFT, 308 },
+    // State 1
+    { 1, 58, PA_SHIFT, 310 },
+    // State 1
+    { 1, 59, PA_SHIFT, 42 },
+    // State 1
+    { 1, 60, PA_SHIFT, 312 },
+    // State 1
+    { 1, 61, PA_SHIFT, 314 },
+    // State 1
+    { 1, 62, PA_SHIFT, 316 },
+    // State 1
+    { 1, 63, PA_SHIFT, 318 },
+    // State 1
+    { 1, 64, PA_SHIFT, 320 },
+    // State 1
+    { 1, 65, PA_SHIFT, 322 },
+    // State 1
+    { 1, 66, PA_SHIFT, 324 },
+    // State 1
+    { 1, 67, PA_SHIFT, 326 },
+    // State 1
+    { 1, 68, PA_SHIFT, 328 },
+    // State 1
+    { 1, 69, PA_SHIFT, 330 },
+    // State 1
+    { 1, 70, PA_SHIFT, 44 },
+    // State 1
+    { 1, 71, PA_SHIFT, 332 },
+    // State 1
+    { 1, 72, PA_SHIFT, 334 },
+    // State 1
+    { 1, 73, PA_SHIFT, 336 },
+    // State 1
+    { 1, 74, PA_SHIFT, 338 },
+    // State 1
+    { 1, 75, PA_SHIFT, 340 },
+    // State 1
+    { 1, 76, PA_SHIFT, 342 },
+    // State 1
+    { 1, 77, PA_SHIFT, 344 },
+    // State 1
+    { 1, 78, PA_SHIFT, 346 },
+    // State 1
+    { 1, 79, PA_SHIFT, 348 },
+    // State 1
+    { 1, 80, PA_SHIFT, 350 },
+    // State 1
+    { 1, 81, PA_SHIFT, 46 },
+    // State 1
+    { 1, 82, PA_SHIFT, 352 },
+    // State 1
+    { 1, 83, PA_SHIFT, 354 },
+    // State 1
+    { 1, 84, PA_SHIFT, 356 },
+    // State 1
+    { 1, 85, PA_SHIFT, 358 },
+    // State 1
+    { 1, 86, PA_SHIFT, 360 },
+    // State 1
+    { 1, 87, PA_SHIFT, 362 },
+    // State 1
+    { 1, 88, PA_SHIFT, 364 },
+    // State 1
+    { 1, 89, PA_SHIFT, 366 },
+    // State 1
+    { 1, 90, PA_SHIFT, 368 },
+    // State 1
+    { 1, 91, PA_SHIFT, 370 },
+    // State 1
+    { 1, 92, PA_SHIFT, 48 },
+    // State 1
+    { 1, 93, PA_SHIFT, 372 },
+    // State 1
+    { 1, 94, PA_SHIFT, 374 },
+    // State 1
+    { 1, 95, PA_SHIFT, 376 },
+    // State 1
+    { 1, 96, PA_SHIFT, 378 },
+    // State 1
+    { 1, 97, PA_SHIFT, 380 },
+    // State 1
+    { 1, 98, PA_SHIFT, 382 },
+    // State 1
+    { 1, 99, PA_SHIFT, 384 },
+    // State 1
+    { 1, 100, PA_SHIFT, 386 },
+    // State 1
+    { 1, 101, PA_SHIFT, 388 },
+    // State 1
+    { 1, 102, PA_SHIFT, 390 },
+    // State 1
+    { 1, 103, PA_SHIFT, 50 },
+    // State 1
+    { 1, 104, PA_SHIFT, 392 },
+    // State 1
+    { 1, 105, PA_SHIFT, 394 },
+    // State 1
+    { 1, 106, PA_SHIFT, 396 },
+    // State 1
+    { 1, 107, PA_SHIFT, 398 },
+    // State 1
+    { 1, 108, PA_SHIFT, 400 },
+    // State 1
+    { 1, 109, PA_SHIFT, 402 },
+    // State 1
+    { 1, 110, PA_SHIFT, 404 },
+    // State 1
+    { 1, 111, PA_SHIFT, 406 },
+    // State 1
+    { 1, 112, PA_SHIFT, 408 },
+    // State 1
+    { 1, 113, PA_SHIFT, 410 },
+    // State 1
+    { 1, 114, PA_SHIFT, 16 },
+    // State 1
+    { 1, 115, PA_SHIFT, 52 },
+    // State 1
+    { 1, 116, PA_SHIFT, 412 },
+    // State 1
+    { 1, 117, PA_SHIFT, 414 },
+    // State 1
+    { 1, 118, PA_SHIFT, 416 },
+    // State 1
+    { 1, 119, PA_SHIFT, 418 },
+    // State 1
+    { 1, 120, PA_SHIFT, 420 },
+    // State 1
+    { 1, 121, PA_SHIFT, 422 },
+    // State 1
+    { 1, 122, PA_SHIFT, 424 },
+    // State 1
+    { 1, 123, PA_SHIFT, 426 },
+    // State 1
+    { 1, 124, PA_SHIFT, 428 },
+    // State 1
+    { 1, 125, PA_SHIFT, 430 },
+    // State 1
+    { 1, 126, PA_SHIFT, 54 },
+    // State 1
+    { 1, 127, PA_SHIFT, 432 },
+    // State 1
+    { 1, 128, PA_SHIFT, 434 },
+    // State 1
+    { 1, 129, PA_SHIFT, 436 },
+    // State 1
+    { 1, 130, PA_SHIFT, 438 },
+    // State 1
+    { 1, 131, PA_SHIFT, 440 },
+    // State 1
+    { 1, 132, PA_SHIFT, 442 },
+    // State 1
+    { 1, 133, PA_SHIFT, 444 },
+    // State 1
+    { 1, 134, PA_SHIFT, 446 },
+    // State 1
+    { 1, 135, PA_SHIFT, 448 },
+    // State 1
+    { 1, 136, PA_SHIFT, 450 },
+    // State 1
+    { 1, 137, PA_SHIFT, 56 },
+    // State 1
+    { 1, 138, PA_SHIFT, 452 },
+    // State 1
+    { 1, 139, PA_SHIFT, 454 },
+    // State 1
+    { 1, 140, PA_SHIFT, 456 },
+    // State 1
+    { 1, 141, PA_SHIFT, 458 },
+    // State 1
+    { 1, 142, PA_SHIFT, 460 },
+    // State 1
+    { 1, 143, PA_SHIFT, 462 },
+    // State 1
+    { 1, 144, PA_SHIFT, 464 },
+    // State 1
+    { 1, 145, PA_SHIFT, 466 },
+    // State 1
+    { 1, 146, PA_SHIFT, 468 },
+    // State 1
+    { 1, 147, PA_SHIFT, 470 },
+    // State 1
+    { 1, 148, PA_SHIFT, 58 },
+    // State 1
+    { 1, 149, PA_SHIFT, 472 },
+    // State 1
+    { 1, 150, PA_SHIFT, 474 },
+    // State 1
+    { 1, 151, PA_SHIFT, 476 },
+    // State 1
+    { 1, 152, PA_SHIFT, 478 },
+    // State 1
+    { 1, 153, PA_SHIFT, 480 },
+    // State 1
+    { 1, 154, PA_SHIFT, 482 },
+    // State 1
+    { 1, 155, PA_SHIFT, 484 },
+    // State 1
+    { 1, 156, PA_SHIFT, 486 },
+    // State 1
+    { 1, 157, PA_SHIFT, 488 },
+    // State 1
+    { 1, 158, PA_SHIFT, 490 },
+    // State 1
+    { 1, 159, PA_SHIFT, 60 },
+    // State 1
+    { 1, 160, PA_SHIFT, 492 },
+    // State 1
+    { 1, 161, PA_SHIFT, 494 },
+    // State 1
+    { 1, 162, PA_SHIFT, 496 },
+    // State 1
+    { 1, 163, PA_SHIFT, 498 },
+    // State 1
+    { 1, 164, PA_SHIFT, 500 },
+    // State 1
+    { 1, 165, PA_SHIFT, 502 },
+    // State 1
+    { 1, 166, PA_SHIFT, 504 },
+    // State 1
+    { 1, 167, PA_SHIFT, 506 },
+    // State 1
+    { 1, 168, PA_SHIFT, 508 },
+    // State 1
+    { 1, 169, PA_SHIFT, 510 },
+    // State 1
+    { 1, 170, PA_SHIFT, 62 },
+    // State 1
+    { 1, 171, PA_SHIFT, 512 },
+    // State 1
+    { 1, 172, PA_SHIFT, 514 },
+    // State 1
+    { 1, 173, PA_SHIFT, 516 },
+    // State 1
+    { 1, 174, PA_SHIFT, 518 },
+    // State 1
+    { 1, 175, PA_SHIFT, 520 },
+    // State 1
+    { 1, 176, PA_SHIFT, 522 },
+    // State 1
+    { 1, 177, PA_SHIFT, 524 },
+    // State 1
+    { 1, 178, PA_SHIFT, 526 },
+    // State 1
+    { 1, 179, PA_SHIFT, 528 },
+    // State 1
+    { 1, 180, PA_SHIFT, 530 },
+    // State 1
+    { 1, 181, PA_SHIFT, 64 },
+    // State 1
+    { 1, 182, PA_SHIFT, 532 },
+    // State 1
+    { 1, 183, PA_SHIFT, 534 },
+    // State 1
+    { 1, 184, PA_SHIFT, 536 },
+    // State 1
+    { 1, 185, PA_SHIFT, 538 },
+    // State 1
+    { 1, 186, PA_SHIFT, 540 },
+    // State 1
+    { 1, 187, PA_SHIFT, 542 },
+    // State 1
+    { 1, 188, PA_SHIFT, 544 },
+    // State 1
+    { 1, 189, PA_SHIFT, 546 },
+    // State 1
+    { 1, 190, PA_SHIFT, 548 },
+    // State 1
+    { 1, 191, PA_SHIFT, 550 },
+    // State 1
+    { 1, 192, PA_SHIFT, 66 },
+    // State 1
+    { 1, 193, PA_SHIFT, 552 },
+    // State 1
+    { 1, 194, PA_SHIFT, 554 },
+    // State 1
+    { 1, 195, PA_SHIFT, 556 },
+    // State 1
+    { 1, 196, PA_SHIFT, 558 },
+    // State 1
+    { 1, 197, PA_SHIFT, 560 },
+    // State 1
+    { 1, 198, PA_SHIFT, 562 },
+    // State 1
+    { 1, 199, PA_SHIFT, 564 },
+    // State 1
+    { 1, 200, PA_SHIFT, 566 },
+    // State 1
+    { 1, 201, PA_SHIFT, 568 },
+    // State 1
+    { 1, 202, PA_SHIFT, 570 },
+    // State 1
+    { 1, 203, PA_SHIFT, 68 },
+    // State 1
+    { 1, 204, PA_SHIFT, 572 },
+    // State 1
+    { 1, 205, PA_SHIFT, 574 },
+    // State 1
+    { 1, 206, PA_SHIFT, 576 },
+    // State 1
+    { 1, 207, PA_SHIFT, 578 },
+    // State 1
+    { 1, 208, PA_SHIFT, 580 },
+    // State 1
+    { 1, 209, PA_SHIFT, 582 },
+    // State 1
+    { 1, 210, PA_SHIFT, 584 },
+    // State 1
+    { 1, 211, PA_SHIFT, 586 },
+    // State 1
+    { 1, 212, PA_SHIFT, 588 },
+    // State 1
+    { 1, 213, PA_SHIFT, 590 },
+    // State 1
+    { 1, 214, PA_SHIFT, 70 },
+    // State 1
+    { 1, 215, PA_SHIFT, 592 },
+    // State 1
+    { 1, 216, PA_SHIFT, 594 },
+    // State 1
+    { 1, 217, PA_SHIFT, 596 },
+    // State 1
+    { 1, 218, PA_SHIFT, 598 },
+    // State 1
+    { 1, 219, PA_SHIFT, 600 },
+    // State 1
+    { 1, 220, PA_SHIFT, 602 },
+    // State 1
+    { 1, 221, PA_SHIFT, 604 },
+    // State 1
+    { 1, 222, PA_SHIFT, 606 },
+    // State 1
+    { 1, 223, PA_SHIFT, 608 },
+    // State 1
+    { 1, 224, PA_SHIFT, 610 },
+    // State 1
+    { 1, 225, PA_SHIFT, 18 },
+    // State 1
+    { 1, 226, PA_SHIFT, 72 },
+    // State 1
+    { 1, 227, PA_SHIFT, 612 },
+    // State 1
+    { 1, 228, PA_SHIFT, 614 },
+    // State 1
+    { 1, 229, PA_SHIFT, 616 },
+    // State 1
+    { 1, 230, PA_SHIFT, 618 },
+    // State 1
+    { 1, 231, PA_SHIFT, 620 },
+    // State 1
+    { 1, 232, PA_SHIFT, 622 },
+    // State 1
+    { 1, 233, PA_SHIFT, 624 },
+    // State 1
+    { 1, 234, PA_SHIFT, 626 },
+    // State 1
+    { 1, 235, PA_SHIFT, 628 },
+    // State 1
+    { 1, 236, PA_SHIFT, 630 },
+    // State 1
+    { 1, 237, PA_SHIFT, 74 },
+    // State 1
+    { 1, 238, PA_SHIFT, 632 },
+    // State 1
+    { 1, 239, PA_SHIFT, 634 },
+    // State 1
+    { 1, 240, PA_SHIFT, 636 },
+    // State 1
+    { 1, 241, PA_SHIFT, 638 },
+    // State 1
+    { 1, 242, PA_SHIFT, 640 },
+    // State 1
+    { 1, 243, PA_SHIFT, 642 },
+    // State 1
+    { 1, 244, PA_SHIFT, 644 },
+    // State 1
+    { 1, 245, PA_SHIFT, 646 },
+    // State 1
+    { 1, 246, PA_SHIFT, 648 },
+    // State 1
+    { 1, 247, PA_SHIFT, 650 },
+    // State 1
+    { 1, 248, PA_SHIFT, 76 },
+    // State 1
+    { 1, 249, PA_SHIFT, 652 },
+    // State 1
+    { 1, 250, PA_SHIFT, 654 },
+    // State 1
+    { 1, 251, PA_SHIFT, 656 },
+    // State 1
+    { 1, 252, PA_SHIFT, 658 },
+    // State 1
+    { 1, 253, PA_SHIFT, 660 },
+    // State 1
+    { 1, 254, PA_SHIFT, 662 },
+    // State 1
+    { 1, 255, PA_SHIFT, 664 },
+    // State 1
+    { 1, 256, PA_SHIFT, 666 },
+    // State 1
+    { 1, 257, PA_SHIFT, 668 },
+    // State 1
+    { 1, 258, PA_SHIFT, 670 },
+    // State 1
+    { 1, 259, PA_SHIFT, 78 },
+    // State 1
+    { 1, 260, PA_SHIFT, 672 },
+    // State 1
+    { 1, 261, PA_SHIFT, 674 },
+    // State 1
+    { 1, 262, PA_SHIFT, 676 },
+    // State 1
+    { 1, 263, PA_SHIFT, 678 },
+    // State 1
+    { 1, 264, PA_SHIFT, 680 },
+    // State 1
+    { 1, 265, PA_SHIFT, 682 },
+    // State 1
+    { 1, 266, PA_SHIFT, 684 },
+    // State 1
+    { 1, 267, PA_SHIFT, 686 },
+    // State 1
+    { 1, 268, PA_SHIFT, 688 },
+    // State 1
+    { 1, 269, PA_SHIFT, 690 },
+    // State 1
+    { 1, 270, PA_SHIFT, 80 },
+    // State 1
+    { 1, 271, PA_SHIFT, 692 },
+    // State 1
+    { 1, 272, PA_SHIFT, 694 },
+    // State 1
+    { 1, 273, PA_SHIFT, 696 },
+    // State 1
+    { 1, 274, PA_SHIFT, 698 },
+    // State 1
+    { 1, 275, PA_SHIFT, 700 },
+    // State 1
+    { 1, 276, PA_SHIFT, 702 },
+    // State 1
+    { 1, 277, PA_SHIFT, 704 },
+    // State 1
+    { 1, 278, PA_SHIFT, 706 },
+    // State 1
+    { 1, 279, PA_SHIFT, 708 },
+    // State 1
+    { 1, 280, PA_SHIFT, 710 },
+    // State 1
+    { 1, 281, PA_SHIFT, 82 },
+    // State 1
+    { 1, 282, PA_SHIFT, 712 },
+    // State 1
+    { 1, 283, PA_SHIFT, 714 },
+    // State 1
+    { 1, 284, PA_SHIFT, 716 },
+    // State 1
+    { 1, 285, PA_SHIFT, 718 },
+    // State 1
+    { 1, 286, PA_SHIFT, 720 },
+    // State 1
+    { 1, 287, PA_SHIFT, 722 },
+    // State 1
+    { 1, 288, PA_SHIFT, 724 },
+    // State 1
+    { 1, 289, PA_SHIFT, 726 },
+    // State 1
+    { 1, 290, PA_SHIFT, 728 },
+    // State 1
+    { 1, 291, PA_SHIFT, 730 },
+    // State 1
+    { 1, 292, PA_SHIFT, 84 },
+    // State 1
+    { 1, 293, PA_SHIFT, 732 },
+    // State 1
+    { 1, 294, PA_SHIFT, 734 },
+    // State 1
+    { 1, 295, PA_SHIFT, 736 },
+    // State 1
+    { 1, 296, PA_SHIFT, 738 },
+    // State 1
+    { 1, 297, PA_SHIFT, 740 },
+    // State 1
+    { 1, 298, PA_SHIFT, 742 },
+    // State 1
+    { 1, 299, PA_SHIFT, 744 },
+    // State 1
+    { 1, 300, PA_SHIFT, 746 },
+    // State 1
+    { 1, 301, PA_SHIFT, 748 },
+    // State 1
+    { 1, 302, PA_SHIFT, 750 },
+    // State 1
+    { 1, 303, PA_SHIFT, 86 },
+    // State 1
+    { 1, 304, PA_SHIFT, 752 },
+    // State 1
+    { 1, 305, PA_SHIFT, 754 },
+    // State 1
+    { 1, 306, PA_SHIFT, 756 },
+    // State 1
+    { 1, 307, PA_SHIFT, 758 },
+    // State 1
+    { 1, 308, PA_SHIFT, 760 },
+    // State 1
+    { 1, 309, PA_SHIFT, 762 },
+    // State 1
+    { 1, 310, PA_SHIFT, 764 },
+    // State 1
+    { 1, 311, PA_SHIFT, 766 },
+    // State 1
+    { 1, 312, PA_SHIFT, 768 },
+    // State 1
+    { 1, 313, PA_SHIFT, 770 },
+    // State 1
+    { 1, 314, PA_SHIFT, 88 },
+    // State 1
+    { 1, 315, PA_SHIFT, 772 },
+    // State 1
+    { 1, 316, PA_SHIFT, 774 },
+    // State 1
+    { 1, 317, PA_SHIFT, 776 },
+    // State 1
+    { 1, 318, PA_SHIFT, 778 },
+    // State 1
+    { 1, 319, PA_SHIFT, 780 },
+    // State 1
+    { 1, 320, PA_SHIFT, 782 },
+    // State 1
+    { 1, 321, PA_SHIFT, 784 },
+    // State 1
+    { 1, 322, PA_SHIFT, 786 },
+    // State 1
+    { 1, 323, PA_SHIFT, 788 },
+    // State 1
+    { 1, 324, PA_SHIFT, 790 },
+    // State 1
+    { 1, 325, PA_SHIFT, 90 },
+    // State 1
+    { 1, 326, PA_SHIFT, 792 },
+    // State 1
+    { 1, 327, PA_SHIFT, 794 },
+    // State 1
+    { 1, 328, PA_SHIFT, 796 },
+    // State 1
+    { 1, 329, PA_SHIFT, 798 },
+    // State 1
+    { 1, 330, PA_SHIFT, 800 },
+    // State 1
+    { 1, 331, PA_SHIFT, 802 },
+    // State 1
+    { 1, 332, PA_SHIFT, 804 },
+    // State 1
+    { 1, 333, PA_SHIFT, 806 },
+    // State 1
+    { 1, 334, PA_SHIFT, 808 },
+    // State 1
+    { 1, 335, PA_SHIFT, 810 },
+    // State 1
+    { 1, 336, PA_SHIFT, 20 },
+    // State 1
+    { 1, 337, PA_SHIFT, 92 },
+    // State 1
+    { 1, 338, PA_SHIFT, 812 },
+    // State 1
+    { 1, 339, PA_SHIFT, 814 },
+    // State 1
+    { 1, 340, PA_SHIFT, 816 },
+    // State 1
+    { 1, 341, PA_SHIFT, 818 },
+    // State 1
+    { 1, 342, PA_SHIFT, 820 },
+    // State 1
+    { 1, 343, PA_SHIFT, 822 },
+    // State 1
+    { 1, 344, PA_SHIFT, 824 },
+    // State 1
+    { 1, 345, PA_SHIFT, 826 },
+    // State 1
+    { 1, 346, PA_SHIFT, 828 },
+    // State 1
+    { 1, 347, PA_SHIFT, 830 },
+    // State 1
+    { 1, 348, PA_SHIFT, 94 },
+    // State 1
+    { 1, 349, PA_SHIFT, 832 },
+    // State 1
+    { 1, 350, PA_SHIFT, 834 },
+    // State 1
+    { 1, 351, PA_SHIFT, 836 },
+    // State 1
+    { 1, 352, PA_SHIFT, 838 },
+    // State 1
+    { 1, 353, PA_SHIFT, 840 },
+    // State 1
+    { 1, 354, PA_SHIFT, 842 },
+    // State 1
+    { 1, 355, PA_SHIFT, 844 },
+    // State 1
+    { 1, 356, PA_SHIFT, 846 },
+    // State 1
+    { 1, 357, PA_SHIFT, 848 },
+    // State 1
+    { 1, 358, PA_SHIFT, 850 },
+    // State 1
+    { 1, 359, PA_SHIFT, 96 },
+    // State 1
+    { 1, 360, PA_SHIFT, 852 },
+    // State 1
+    { 1, 361, PA_SHIFT, 854 },
+    // State 1
+    { 1, 362, PA_SHIFT, 856 },
+    // State 1
+    { 1, 363, PA_SHIFT, 858 },
+    // State 1
+    { 1, 364, PA_SHIFT, 860 },
+    // State 1
+    { 1, 365, PA_SHIFT, 862 },
+    // State 1
+    { 1, 366, PA_SHIFT, 864 },
+    // State 1
+    { 1, 367, PA_SHIFT, 866 },
+    // State 1
+    { 1, 368, PA_SHIFT, 868 },
+    // State 1
+    { 1, 369, PA_SHIFT, 870 },
+    // State 1
+    { 1, 370, PA_SHIFT, 98 },
+    // State 1
+    { 1, 371, PA_SHIFT, 872 },
+    // State 1
+    { 1, 372, PA_SHIFT, 874 },
+    // State 1
+    { 1, 373, PA_SHIFT, 876 },
+    // State 1
+    { 1, 374, PA_SHIFT, 878 },
+    // State 1
+    { 1, 375, PA_SHIFT, 880 },
+    // State 1
+    { 1, 376, PA_SHIFT, 882 },
+    // State 1
+    { 1, 377, PA_SHIFT, 884 },
+    // State 1
+    { 1, 378, PA_SHIFT, 886 },
+    // State 1
+    { 1, 379, PA_SHIFT, 888 },
+    // State 1
+    { 1, 380, PA_SHIFT, 890 },
+    // State 1
+    { 1, 381, PA_SHIFT, 100 },
+    // State 1
+    { 1, 382, PA_SHIFT, 892 },
+    // State 1
+    { 1, 383, PA_SHIFT, 894 },
+    // State 1
+    { 1, 384, PA_SHIFT, 896 },
+    // State 1
+    { 1, 385, PA_SHIFT, 898 },
+    // State 1
+    { 1, 386, PA_SHIFT, 900 },
+    // State 1
+    { 1, 387, PA_SHIFT, 902 },
+    // State 1
+    { 1, 388, PA_SHIFT, 904 },
+    // State 1
+    { 1, 389, PA_SHIFT, 906 },
+    // State 1
+    { 1, 390, PA_SHIFT, 908 },
+    // State 1
+    { 1, 391, PA_SHIFT, 910 },
+    // State 1
+    { 1, 392, PA_SHIFT, 102 },
+    // State 1
+    { 1, 393, PA_SHIFT, 912 },
+    // State 1
+    { 1, 394, PA_SHIFT, 914 },
+    // State 1
+    { 1, 395, PA_SHIFT, 916 },
+    // State 1
+    { 1, 396, PA_SHIFT, 918 },
+    // State 1
+    { 1, 397, PA_SHIFT, 920 },
+    // State 1
+    { 1, 398, PA_SHIFT, 922 },
+    // State 1
+    { 1, 399, PA_SHIFT, 924 },
+    // State 1
+    { 1, 400, PA_SHIFT, 926 },
+    // State 1
+    { 1, 401, PA_SHIFT, 928 },
+    // State 1
+    { 1, 402, PA_SHIFT, 930 },
+    // State 1
+    { 1, 403, PA_SHIFT, 104 },
+    // State 1
+    { 1, 404, PA_SHIFT, 932 },
+    // State 1
+    { 1, 405, PA_SHIFT, 934 },
+    // State 1
+    { 1, 406, PA_SHIFT, 936 },
+    // State 1
+    { 1, 407, PA_SHIFT, 938 },
+    // State 1
+    { 1, 408, PA_SHIFT, 940 },
+    // State 1
+    { 1, 409, PA_SHIFT, 942 },
+    // State 1
+    { 1, 410, PA_SHIFT, 944 },
+    // State 1
+    { 1, 411, PA_SHIFT, 946 },
+    // State 1
+    { 1, 412, PA_SHIFT, 948 },
+    // State 1
+    { 1, 413, PA_SHIFT, 950 },
+    // State 1
+    { 1, 414, PA_SHIFT, 106 },
+    // State 1
+    { 1, 415, PA_SHIFT, 952 },
+    // State 1
+    { 1, 416, PA_SHIFT, 954 },
+    // State 1
+    { 1, 417, PA_SHIFT, 956 },
+    // State 1
+    { 1, 418, PA_SHIFT, 958 },
+    // State 1
+    { 1, 419, PA_SHIFT, 960 },
+    // State 1
+    { 1, 420, PA_SHIFT, 962 },
+    // State 1
+    { 1, 421, PA_SHIFT, 964 },
+    // State 1
+    { 1, 422, PA_SHIFT, 966 },
+    // State 1
+    { 1, 423, PA_SHIFT, 968 },
+    // State 1
+    { 1, 424, PA_SHIFT, 970 },
+    // State 1
+    { 1, 425, PA_SHIFT, 108 },
+    // State 1
+    { 1, 426, PA_SHIFT, 972 },
+    // State 1
+    { 1, 427, PA_SHIFT, 974 },
+    // State 1
+    { 1, 428, PA_SHIFT, 976 },
+    // State 1
+    { 1, 429, PA_SHIFT, 978 },
+    // State 1
+    { 1, 430, PA_SHIFT, 980 },
+    // State 1
+    { 1, 431, PA_SHIFT, 982 },
+    // State 1
+    { 1, 432, PA_SHIFT, 984 },
+    // State 1
+    { 1, 433, PA_SHIFT, 986 },
+    // State 1
+    { 1, 434, PA_SHIFT, 988 },
+    // State 1
+    { 1, 435, PA_SHIFT, 990 },
+    // State 1
+    { 1, 436, PA_SHIFT, 110 },
+    // State 1
+    { 1, 437, PA_SHIFT, 992 },
+    // State 1
+    { 1, 438, PA_SHIFT, 994 },
+    // State 1
+    { 1, 439, PA_SHIFT, 996 },
+    // State 1
+    { 1, 440, PA_SHIFT, 998 },
+    // State 1
+    { 1, 441, PA_SHIFT, 1000 },
+    // State 1
+    { 1, 442, PA_SHIFT, 1002 },
+    // State 1
+    { 1, 443, PA_SHIFT, 1004 },
+    // State 1
+    { 1, 444, PA_SHIFT, 1006 },
+    // State 1
+    { 1, 445, PA_SHIFT, 1008 },
+    // State 1
+    { 1, 446, PA_SHIFT, 1010 },
+    // State 1
+    { 1, 447, PA_SHIFT, 22 },
+    // State 1
+    { 1, 448, PA_SHIFT, 112 },
+    // State 1
+    { 1, 449, PA_SHIFT, 1012 },
+    // State 1
+    { 1, 450, PA_SHIFT, 1014 },
+    // State 1
+    { 1, 451, PA_SHIFT, 1016 },
+    // State 1
+    { 1, 452, PA_SHIFT, 1018 },
+    // State 1
+    { 1, 453, PA_SHIFT, 1020 },
+    // State 1
+    { 1, 454, PA_SHIFT, 1022 },
+    // State 1
+    { 1, 455, PA_SHIFT, 1024 },
+    // State 1
+    { 1, 456, PA_SHIFT, 1026 },
+    // State 1
+    { 1, 457, PA_SHIFT, 1028 },
+    // State 1
+    { 1, 458, PA_SHIFT, 1030 },
+    // State 1
+    { 1, 459, PA_SHIFT, 114 },
+    // State 1
+    { 1, 460, PA_SHIFT, 1032 },
+    // State 1
+    { 1, 461, PA_SHIFT, 1034 },
+    // State 1
+    { 1, 462, PA_SHIFT, 1036 },
+    // State 1
+    { 1, 463, PA_SHIFT, 1038 },
+    // State 1
+    { 1, 464, PA_SHIFT, 1040 },
+    // State 1
+    { 1, 465, PA_SHIFT, 1042 },
+    // State 1
+    { 1, 466, PA_SHIFT, 1044 },
+    // State 1
+    { 1, 467, PA_SHIFT, 1046 },
+    // State 1
+    { 1, 468, PA_SHIFT, 1048 },
+    // State 1
+    { 1, 469, PA_SHIFT, 1050 },
+    // State 1
+    { 1, 470, PA_SHIFT, 116 },
+    // State 1
+    { 1, 471, PA_SHIFT, 1052 },
+    // State 1
+    { 1, 472, PA_SHIFT, 1054 },
+    // State 1
+    { 1, 473, PA_SHIFT, 1056 },
+    // State 1
+    { 1, 474, PA_SHIFT, 1058 },
+    // State 1
+    { 1, 475, PA_SHIFT, 1060 },
+    // State 1
+    { 1, 476, PA_SHIFT, 1062 },
+    // State 1
+    { 1, 477, PA_SHIFT, 1064 },
+    // State 1
+    { 1, 478, PA_SHIFT, 1066 },
+    // State 1
+    { 1, 479, PA_SHIFT, 1068 },
+    // State 1
+    { 1, 480, PA_SHIFT, 1070 },
+    // State 1
+    { 1, 481, PA_SHIFT, 118 },
+    // State 1
+    { 1, 482, PA_SHIFT, 1072 },
+    // State 1
+    { 1, 483, PA_SHIFT, 1074 },
+    // State 1
+    { 1, 484, PA_SHIFT, 1076 },
+    // State 1
+    { 1, 485, PA_SHIFT, 1078 },
+    // State 1
+    { 1, 486, PA_SHIFT, 1080 },
+    // State 1
+    { 1, 487, PA_SHIFT, 1082 },
+    // State 1
+    { 1, 488, PA_SHIFT, 1084 },
+    // State 1
+    { 1, 489, PA_SHIFT, 1086 },
+    // State 1
+    { 1, 490, PA_SHIFT, 1088 },
+    // State 1
+    { 1, 491, PA_SHIFT, 1090 },
+    // State 1
+    { 1, 492, PA_SHIFT, 120 },
+    // State 1
+    { 1, 493, PA_SHIFT, 1092 },
+    // State 1
+    { 1, 494, PA_SHIFT, 1094 },
+    // State 1
+    { 1, 495, PA_SHIFT, 1096 },
+    // State 1
+    { 1, 496, PA_SHIFT, 1098 },
+    // State 1
+    { 1, 497, PA_SHIFT, 1100 },
+    // State 1
+    { 1, 498, PA_SHIFT, 1102 },
+    // State 1
+    { 1, 499, PA_SHIFT, 1104 },
+    // State 1
+    { 1, 500, PA_SHIFT, 1106 },
+    // State 1
+    { 1, 501, PA_SHIFT, 1108 },
+    // State 1
+    { 1, 502, PA_SHIFT, 1110 },
+    // State 1
+    { 1, 503, PA_SHIFT, 122 },
+    // State 1
+    { 1, 504, PA_SHIFT, 1112 },
+    // State 1
+    { 1, 505, PA_SHIFT, 1114 },
+    // State 1
+    { 1, 506, PA_SHIFT, 1116 },
+    // State 1
+    { 1, 507, PA_SHIFT, 1118 },
+    // State 1
+    { 1, 508, PA_SHIFT, 1120 },
+    // State 1
+    { 1, 509, PA_SHIFT, 1122 },
+    // State 1
+    { 1, 510, PA_SHIFT, 1124 },
+    // State 1
+    { 1, 511, PA_SHIFT, 1126 },
+    // State 1
+    { 1, 512, PA_SHIFT, 1128 },
+    // State 1
+    { 1, 513, PA_SHIFT, 1130 },
+    // State 1
+    { 1, 514, PA_SHIFT, 124 },
+    // State 1
+    { 1, 515, PA_SHIFT, 1132 },
+    // State 1
+    { 1, 516, PA_SHIFT, 1134 },
+    // State 1
+    { 1, 517, PA_SHIFT, 1136 },
+    // State 1
+    { 1, 518, PA_SHIFT, 1138 },
+    // State 1
+    { 1, 519, PA_SHIFT, 1140 },
+    // State 1
+    { 1, 520, PA_SHIFT, 1142 },
+    // State 1
+    { 1, 521, PA_SHIFT, 1144 },
+    // State 1
+    { 1, 522, PA_SHIFT, 1146 },
+    // State 1
+    { 1, 523, PA_SHIFT, 1148 },
+    // State 1
+    { 1, 524, PA_SHIFT, 1150 },
+    // State 1
+    { 1, 525, PA_SHIFT, 126 },
+    // State 1
+    { 1, 526, PA_SHIFT, 1152 },
+    // State 1
+    { 1, 527, PA_SHIFT, 1154 },
+    // State 1
+    { 1, 528, PA_SHIFT, 1156 },
+    // State 1
+    { 1, 529, PA_SHIFT, 1158 },
+    // State 1
+    { 1, 530, PA_SHIFT, 1160 },
+    // State 1
+    { 1, 531, PA_SHIFT, 1162 },
+    // State 1
+    { 1, 532, PA_SHIFT, 1164 },
+    // State 1
+    { 1, 533, PA_SHIFT, 1166 },
+    // State 1
+    { 1, 534, PA_SHIFT, 1168 },
+    // State 1
+    { 1, 535, PA_SHIFT, 1170 },
+    // State 1
+    { 1, 536, PA_SHIFT, 128 },
+    // State 1
+    { 1, 537, PA_SHIFT, 1172 },
+    // State 1
+    { 1, 538, PA_SHIFT, 1174 },
+    // State 1
+    { 1, 539, PA_SHIFT, 1176 },
+    // State 1
+    { 1, 540, PA_SHIFT, 1178 },
+    // State 1
+    { 1, 541, PA_SHIFT, 1180 },
+    // State 1
+    { 1, 542, PA_SHIFT, 1182 },
+    // State 1
+    { 1, 543, PA_SHIFT, 1184 },
+    // State 1
+    { 1, 544, PA_SHIFT, 1186 },
+    // State 1
+    { 1, 545, PA_SHIFT, 1188 },
+    // State 1
+    { 1, 546, PA_SHIFT, 1190 },
+    // State 1
+    { 1, 547, PA_SHIFT, 130 },
+    // State 1
+    { 1, 548, PA_SHIFT, 1192 },
+    // State 1
+    { 1, 549, PA_SHIFT, 1194 },
+    // State 1
+    { 1, 550, PA_SHIFT, 1196 },
+    // State 1
+    { 1, 551, PA_SHIFT, 1198 },
+    // State 1
+    { 1, 552, PA_SHIFT, 1200 },
+    // State 1
+    { 1, 553, PA_SHIFT, 1202 },
+    // State 1
+    { 1, 554, PA_SHIFT, 1204 },
+    // State 1
+    { 1, 555, PA_SHIFT, 1206 },
+    // State 1
+    { 1, 556, PA_SHIFT, 1208 },
+    // State 1
+    { 1, 557, PA_SHIFT, 1210 },
+    // State 1
+    { 1, 558, PA_SHIFT, 24 },
+    // State 1
+    { 1, 559, PA_SHIFT, 132 },
+    // State 1
+    { 1, 560, PA_SHIFT, 1212 },
+    // State 1
+    { 1, 561, PA_SHIFT, 1214 },
+    // State 1
+    { 1, 562, PA_SHIFT, 1216 },
+    // State 1
+    { 1, 563, PA_SHIFT, 1218 },
+    // State 1
+    { 1, 564, PA_SHIFT, 1220 },
+    // State 1
+    { 1, 565, PA_SHIFT, 1222 },
+    // State 1
+    { 1, 566, PA_SHIFT, 1224 },
+    // State 1
+    { 1, 567, PA_SHIFT, 1226 },
+    // State 1
+    { 1, 568, PA_SHIFT, 1228 },
+    // State 1
+    { 1, 569, PA_SHIFT, 1230 },
+    // State 1
+    { 1, 570, PA_SHIFT, 134 },
+    // State 1
+    { 1, 571, PA_SHIFT, 1232 },
+    // State 1
+    { 1, 572, PA_SHIFT, 1234 },
+    // State 1
+    { 1, 573, PA_SHIFT, 1236 },
+    // State 1
+    { 1, 574, PA_SHIFT, 1238 },
+    // State 1
+    { 1, 575, PA_SHIFT, 1240 },
+    // State 1
+    { 1, 576, PA_SHIFT, 1242 },
+    // State 1
+    { 1, 577, PA_SHIFT, 1244 },
+    // State 1
+    { 1, 578, PA_SHIFT, 1246 },
+    // State 1
+    { 1, 579, PA_SHIFT, 1248 },
+    // State 1
+    { 1, 580, PA_SHIFT, 1250 },
+    // State 1
+    { 1, 581, PA_SHIFT, 136 },
+    // State 1
+    { 1, 582, PA_SHIFT, 1252 },
+    // State 1
+    { 1, 583, PA_SHIFT, 1254 },
+    // State 1
+    { 1, 584, PA_SHIFT, 1256 },
+    // State 1
+    { 1, 585, PA_SHIFT, 1258 },
+    // State 1
+    { 1, 586, PA_SHIFT, 1260 },
+    // State 1
+    { 1, 587, PA_SHIFT, 1262 },
+    // State 1
+    { 1, 588, PA_SHIFT, 1264 },
+    // State 1
+    { 1, 589, PA_SHIFT, 1266 },
+    // State 1
+    { 1, 590, PA_SHIFT, 1268 },
+    // State 1
+    { 1, 591, PA_SHIFT, 1270 },
+    // State 1
+    { 1, 592, PA_SHIFT, 138 },
+    // State 1
+    { 1, 593, PA_SHIFT, 1272 },
+    // State 1
+    { 1, 594, PA_SHIFT, 1274 },
+    // State 1
+    { 1, 595, PA_SHIFT, 1276 },
+    // State 1
+    { 1, 596, PA_SHIFT, 1278 },
+    // State 1
+    { 1, 597, PA_SHIFT, 1280 },
+    // State 1
+    { 1, 598, PA_SHIFT, 1282 },
+    // State 1
+    { 1, 599, PA_SHIFT, 1284 },
+    // State 1
+    { 1, 600, PA_SHIFT, 1286 },
+    // State 1
+    { 1, 601, PA_SHIFT, 1288 },
+    // State 1
+    { 1, 602, PA_SHIFT, 1290 },
+    // State 1
+    { 1, 603, PA_SHIFT, 140 },
+    // State 1
+    { 1, 604, PA_SHIFT, 1292 },
+    // State 1
+    { 1, 605, PA_SHIFT, 1294 },
+    // State 1
+    { 1, 606, PA_SHIFT, 1296 },
+    // State 1
+    { 1, 607, PA_SHIFT, 1298 },
+    // State 1
+    { 1, 608, PA_SHIFT, 1300 },
+    // State 1
+    { 1, 609, PA_SHIFT, 1302 },
+    // State 1
+    { 1, 610, PA_SHIFT, 1304 },
+    // State 1
+    { 1, 611, PA_SHIFT, 1306 },
+    // State 1
+    { 1, 612, PA_SHIFT, 1308 },
+    // State 1
+    { 1, 613, PA_SHIFT, 1310 },
+    // State 1
+    { 1, 614, PA_SHIFT, 142 },
+    // State 1
+    { 1, 615, PA_SHIFT, 1312 },
+    // State 1
+    { 1, 616, PA_SHIFT, 1314 },
+    // State 1
+    { 1, 617, PA_SHIFT, 1316 },
+    // State 1
+    { 1, 618, PA_SHIFT, 1318 },
+    // State 1
+    { 1, 619, PA_SHIFT, 1320 },
+    // State 1
+    { 1, 620, PA_SHIFT, 1322 },
+    // State 1
+    { 1, 621, PA_SHIFT, 1324 },
+    // State 1
+    { 1, 622, PA_SHIFT, 1326 },
+    // State 1
+    { 1, 623, PA_SHIFT, 1328 },
+    // State 1
+    { 1, 624, PA_SHIFT, 1330 },
+    // State 1
+    { 1, 625, PA_SHIFT, 144 },
+    // State 1
+    { 1, 626, PA_SHIFT, 1332 },
+    // State 1
+    { 1, 627, PA_SHIFT, 1334 },
+    // State 1
+    { 1, 628, PA_SHIFT, 1336 },
+    // State 1
+    { 1, 629, PA_SHIFT, 1338 },
+    // State 1
+    { 1, 630, PA_SHIFT, 1340 },
+    // State 1
+    { 1, 631, PA_SHIFT, 1342 },
+    // State 1
+    { 1, 632, PA_SHIFT, 1344 },
+    // State 1
+    { 1, 633, PA_SHIFT, 1346 },
+    // State 1
+    { 1, 634, PA_SHIFT, 1348 },
+    // State 1
+    { 1, 635, PA_SHIFT, 1350 },
+    // State 1
+    { 1, 636, PA_SHIFT, 146 },
+    // State 1
+    { 1, 637, PA_SHIFT, 1352 },
+    // State 1
+    { 1, 638, PA_SHIFT, 1354 },
+    // State 1
+    { 1, 639, PA_SHIFT, 1356 },
+    // State 1
+    { 1, 640, PA_SHIFT, 1358 },
+    // State 1
+    { 1, 641, PA_SHIFT, 1360 },
+    // State 1
+    { 1, 642, PA_SHIFT, 1362 },
+    // State 1
+    { 1, 643, PA_SHIFT, 1364 },
+    // State 1
+    { 1, 644, PA_SHIFT, 1366 },
+    // State 1
+    { 1, 645, PA_SHIFT, 1368 },
+    // State 1
+    { 1, 646, PA_SHIFT, 1370 },
+    // State 1
+    { 1, 647, PA_SHIFT, 148 },
+    // State 1
+    { 1, 648, PA_SHIFT, 1372 },
+    // State 1
+    { 1, 649, PA_SHIFT, 1374 },
+    // State 1
+    { 1, 650, PA_SHIFT, 1376 },
+    // State 1
+    { 1, 651, PA_SHIFT, 1378 },
+    // State 1
+    { 1, 652, PA_SHIFT, 1380 },
+    // State 1
+    { 1, 653, PA_SHIFT, 1382 },
+    // State 1
+    { 1, 654, PA_SHIFT, 1384 },
+    // State 1
+    { 1, 655, PA_SHIFT, 1386 },
+    // State 1
+    { 1, 656, PA_SHIFT, 1388 },
+    // State 1
+    { 1, 657, PA_SHIFT, 1390 },
+    // State 1
+    { 1, 658, PA_SHIFT, 150 },
+    // State 1
+    { 1, 659, PA_SHIFT, 1392 },
+    // State 1
+    { 1, 660, PA_SHIFT, 1394 },
+    // State 1
+    { 1, 661, PA_SHIFT, 1396 },
+    // State 1
+    { 1, 662, PA_SHIFT, 1398 },
+    // State 1
+    { 1, 663, PA_SHIFT, 1400 },
+    // State 1
+    { 1, 664, PA_SHIFT, 1402 },
+    // State 1
+    { 1, 665, PA_SHIFT, 1404 },
+    // State 1
+    { 1, 666, PA_SHIFT, 1406 },
+    // State 1
+    { 1, 667, PA_SHIFT, 1408 },
+    // State 1
+    { 1, 668, PA_SHIFT, 1410 },
+    // State 1
+    { 1, 669, PA_SHIFT, 26 },
+    // State 1
+    { 1, 670, PA_SHIFT, 152 },
+    // State 1
+    { 1, 671, PA_SHIFT, 1412 },
+    // State 1
+    { 1, 672, PA_SHIFT, 1414 },
+    // State 1
+    { 1, 673, PA_SHIFT, 1416 },
+    // State 1
+    { 1, 674, PA_SHIFT, 1418 },
+    // State 1
+    { 1, 675, PA_SHIFT, 1420 },
+    // State 1
+    { 1, 676, PA_SHIFT, 1422 },
+    // State 1
+    { 1, 677, PA_SHIFT, 1424 },
+    // State 1
+    { 1, 678, PA_SHIFT, 1426 },
+    // State 1
+    { 1, 679, PA_SHIFT, 1428 },
+    // State 1
+    { 1, 680, PA_SHIFT, 1430 },
+    // State 1
+    { 1, 681, PA_SHIFT, 154 },
+    // State 1
+    { 1, 682, PA_SHIFT, 1432 },
+    // State 1
+    { 1, 683, PA_SHIFT, 1434 },
+    // State 1
+    { 1, 684, PA_SHIFT, 1436 },
+    // State 1
+    { 1, 685, PA_SHIFT, 1438 },
+    // State 1
+    { 1, 686, PA_SHIFT, 1440 },
+    // State 1
+    { 1, 687, PA_SHIFT, 1442 },
+    // State 1
+    { 1, 688, PA_SHIFT, 1444 },
+    // State 1
+    { 1, 689, PA_SHIFT, 1446 },
+    // State 1
+    { 1, 690, PA_SHIFT, 1448 },
+    // State 1
+    { 1, 691, PA_SHIFT, 1450 },
+    // State 1
+    { 1, 692, PA_SHIFT, 156 },
+    // State 1
+    { 1, 693, PA_SHIFT, 1452 },
+    // State 1
+    { 1, 694, PA_SHIFT, 1454 },
+    // State 1
+    { 1, 695, PA_SHIFT, 1456 },
+    // State 1
+    { 1, 696, PA_SHIFT, 1458 },
+    // State 1
+    { 1, 697, PA_SHIFT, 1460 },
+    // State 1
+    { 1, 698, PA_SHIFT, 1462 },
+    // State 1
+    { 1, 699, PA_SHIFT, 1464 },
+    // State 1
+    { 1, 700, PA_SHIFT, 1466 },
+    // State 1
+    { 1, 701, PA_SHIFT, 1468 },
+    // State 1
+    { 1, 702, PA_SHIFT, 1470 },
+    // State 1
+    { 1, 703, PA_SHIFT, 158 },
+    // State 1
+    { 1, 704, PA_SHIFT, 1472 },
+    // State 1
+    { 1, 705, PA_SHIFT, 1474 },
+    // State 1
+    { 1, 706, PA_SHIFT, 1476 },
+    // State 1
+    { 1, 707, PA_SHIFT, 1478 },
+    // State 1
+    { 1, 708, PA_SHIFT, 1480 },
+    // State 1
+    { 1, 709, PA_SHIFT, 1482 },
+    // State 1
+    { 1, 710, PA_SHIFT, 1484 },
+    // State 1
+    { 1, 711, PA_SHIFT, 1486 },
+    // State 1
+    { 1, 712, PA_SHIFT, 1488 },
+    // State 1
+    { 1, 713, PA_SHIFT, 1490 },
+    // State 1
+    { 1, 714, PA_SHIFT, 160 },
+    // State 1
+    { 1, 715, PA_SHIFT, 1492 },
+    // State 1
+    { 1, 716, PA_SHIFT, 1494 },
+    // State 1
+    { 1, 717, PA_SHIFT, 1496 },
+    // State 1
+    { 1, 718, PA_SHIFT, 1498 },
+    // State 1
+    { 1, 719, PA_SHIFT, 1500 },
+    // State 1
+    { 1, 720, PA_SHIFT, 1502 },
+    // State 1
+    { 1, 721, PA_SHIFT, 1504 },
+    // State 1
+    { 1, 722, PA_SHIFT, 1506 },
+    // State 1
+    { 1, 723, PA_SHIFT, 1508 },
+    // State 1
+    { 1, 724, PA_SHIFT, 1510 },
+    // State 1
+    { 1, 725, PA_SHIFT, 162 },
+    // State 1
+    { 1, 726, PA_SHIFT, 1512 },
+    // State 1
+    { 1, 727, PA_SHIFT, 1514 },
+    // State 1
+    { 1, 728, PA_SHIFT, 1516 },
+    // State 1
+    { 1, 729, PA_SHIFT, 1518 },
+    // State 1
+    { 1, 730, PA_SHIFT, 1520 },
+    // State 1
+    { 1, 731, PA_SHIFT, 1522 },
+    // State 1
+    { 1, 732, PA_SHIFT, 1524 },
+    // State 1
+    { 1, 733, PA_SHIFT, 1526 },
+    // State 1
+    { 1, 734, PA_SHIFT, 1528 },
+    // State 1
+    { 1, 735, PA_SHIFT, 1530 },
+    // State 1
+    { 1, 736, PA_SHIFT, 164 },
+    // State 1
+    { 1, 737, PA_SHIFT, 1532 },
+    // State 1
+    { 1, 738, PA_SHIFT, 1534 },
+    // State 1
+    { 1, 739, PA_SHIFT, 1536 },
+    // State 1
+    { 1, 740, PA_SHIFT, 1538 },
+    // State 1
+    { 1, 741, PA_SHIFT, 1540 },
+    // State 1
+    { 1, 742, PA_SHIFT, 1542 },
+    // State 1
+    { 1, 743, PA_SHIFT, 1544 },
+    // State 1
+    { 1, 744, PA_SHIFT, 1546 },
+    // State 1
+    { 1, 745, PA_SHIFT, 1548 },
+    // State 1
+    { 1, 746, PA_SHIFT, 1550 },
+    // State 1
+    { 1, 747, PA_SHIFT, 166 },
+    // State 1
+    { 1, 748, PA_SHIFT, 1552 },
+    // State 1
+    { 1, 749, PA_SHIFT, 1554 },
+    // State 1
+    { 1, 750, PA_SHIFT, 1556 },
+    // State 1
+    { 1, 751, PA_SHIFT, 1558 },
+    // State 1
+    { 1, 752, PA_SHIFT, 1560 },
+    // State 1
+    { 1, 753, PA_SHIFT, 1562 },
+    // State 1
+    { 1, 754, PA_SHIFT, 1564 },
+    // State 1
+    { 1, 755, PA_SHIFT, 1566 },
+    // State 1
+    { 1, 756, PA_SHIFT, 1568 },
+    // State 1
+    { 1, 757, PA_SHIFT, 1570 },
+    // State 1
+    { 1, 758, PA_SHIFT, 168 },
+    // State 1
+    { 1, 759, PA_SHIFT, 1572 },
+    // State 1
+    { 1, 760, PA_SHIFT, 1574 },
+    // State 1
+    { 1, 761, PA_SHIFT, 1576 },
+    // State 1
+    { 1, 762, PA_SHIFT, 1578 },
+    // State 1
+    { 1, 763, PA_SHIFT, 1580 },
+    // State 1
+    { 1, 764, PA_SHIFT, 1582 },
+    // State 1
+    { 1, 765, PA_SHIFT, 1584 },
+    // State 1
+    { 1, 766, PA_SHIFT, 1586 },
+    // State 1
+    { 1, 767, PA_SHIFT, 1588 },
+    // State 1
+    { 1, 768, PA_SHIFT, 1590 },
+    // State 1
+    { 1, 769, PA_SHIFT, 170 },
+    // State 1
+    { 1, 770, PA_SHIFT, 1592 },
+    // State 1
+    { 1, 771, PA_SHIFT, 1594 },
+    // State 1
+    { 1, 772, PA_SHIFT, 1596 },
+    // State 1
+    { 1, 773, PA_SHIFT, 1598 },
+    // State 1
+    { 1, 774, PA_SHIFT, 1600 },
+    // State 1
+    { 1, 775, PA_SHIFT, 1602 },
+    // State 1
+    { 1, 776, PA_SHIFT, 1604 },
+    // State 1
+    { 1, 777, PA_SHIFT, 1606 },
+    // State 1
+    { 1, 778, PA_SHIFT, 1608 },
+    // State 1
+    { 1, 779, PA_SHIFT, 1610 },
+    // State 1
+    { 1, 780, PA_SHIFT, 28 },
+    // State 1
+    { 1, 781, PA_SHIFT, 172 },
+    // State 1
+    { 1, 782, PA_SHIFT, 1612 },
+    // State 1
+    { 1, 783, PA_SHIFT, 1614 },
+    // State 1
+    { 1, 784, PA_SHIFT, 1616 },
+    // State 1
+    { 1, 785, PA_SHIFT, 1618 },
+    // State 1
+    { 1, 786, PA_SHIFT, 1620 },
+    // State 1
+    { 1, 787, PA_SHIFT, 1622 },
+    // State 1
+    { 1, 788, PA_SHIFT, 1624 },
+    // State 1
+    { 1, 789, PA_SHIFT, 1626 },
+    // State 1
+    { 1, 790, PA_SHIFT, 1628 },
+    // State 1
+    { 1, 791, PA_SHIFT, 1630 },
+    // State 1
+    { 1, 792, PA_SHIFT, 174 },
+    // State 1
+    { 1, 793, PA_SHIFT, 1632 },
+    // State 1
+    { 1, 794, PA_SHIFT, 1634 },
+    // State 1
+    { 1, 795, PA_SHIFT, 1636 },
+    // State 1
+    { 1, 796, PA_SHIFT, 1638 },
+    // State 1
+    { 1, 797, PA_SHIFT, 1640 },
+    // State 1
+    { 1, 798, PA_SHIFT, 1642 },
+    // State 1
+    { 1, 799, PA_SHIFT, 1644 },
+    // State 1
+    { 1, 800, PA_SHIFT, 1646 },
+    // State 1
+    { 1, 801, PA_SHIFT, 1648 },
+    // State 1
+    { 1, 802, PA_SHIFT, 1650 },
+    // State 1
+    { 1, 803, PA_SHIFT, 176 },
+    // State 1
+    { 1, 804, PA_SHIFT, 1652 },
+    // State 1
+    { 1, 805, PA_SHIFT, 1654 },
+    // State 1
+    { 1, 806, PA_SHIFT, 1656 },
+    // State 1
+    { 1, 807, PA_SHIFT, 1658 },
+    // State 1
+    { 1, 808, PA_SHIFT, 1660 },
+    // State 1
+    { 1, 809, PA_SHIFT, 1662 },
+    // State 1
+    { 1, 810, PA_SHIFT, 1664 },
+    // State 1
+    { 1, 811, PA_SHIFT, 1666 },
+    // State 1
+    { 1, 812, PA_SHIFT, 1668 },
+    // State 1
+    { 1, 813, PA_SHIFT, 1670 },
+    // State 1
+    { 1, 814, PA_SHIFT, 178 },
+    // State 1
+    { 1, 815, PA_SHIFT, 1672 },
+    // State 1
+    { 1, 816, PA_SHIFT, 1674 },
+    // State 1
+    { 1, 817, PA_SHIFT, 1676 },
+    // State 1
+    { 1, 818, PA_SHIFT, 1678 },
+    // State 1
+    { 1, 819, PA_SHIFT, 1680 },
+    // State 1
+    { 1, 820, PA_SHIFT, 1682 },
+    // State 1
+    { 1, 821, PA_SHIFT, 1684 },
+    // State 1
+    { 1, 822, PA_SHIFT, 1686 },
+    // State 1
+    { 1, 823, PA_SHIFT, 1688 },
+    // State 1
+    { 1, 824, PA_SHIFT, 1690 },
+    // State 1
+    { 1, 825, PA_SHIFT, 180 },
+    // State 1
+    { 1, 826, PA_SHIFT, 1692 },
+    // State 1
+    { 1, 827, PA_SHIFT, 1694 },
+    // State 1
+    { 1, 828, PA_SHIFT, 1696 },
+    // State 1
+    { 1, 829, PA_SHIFT, 1698 },
+    // State 1
+    { 1, 830, PA_SHIFT, 1700 },
+    // State 1
+    { 1, 831, PA_SHIFT, 1702 },
+    // State 1
+    { 1, 832, PA_SHIFT, 1704 },
+    // State 1
+    { 1, 833, PA_SHIFT, 1706 },
+    // State 1
+    { 1, 834, PA_SHIFT, 1708 },
+    // State 1
+    { 1, 835, PA_SHIFT, 1710 },
+    // State 1
+    { 1, 836, PA_SHIFT, 182 },
+    // State 1
+    { 1, 837, PA_SHIFT, 1712 },
+    // State 1
+    { 1, 838, PA_SHIFT, 1714 },
+    // State 1
+    { 1, 839, PA_SHIFT, 1716 },
+    // State 1
+    { 1, 840, PA_SHIFT, 1718 },
+    // State 1
+    { 1, 841, PA_SHIFT, 1720 },
+    // State 1
+    { 1, 842, PA_SHIFT, 1722 },
+    // State 1
+    { 1, 843, PA_SHIFT, 1724 },
+    // State 1
+    { 1, 844, PA_SHIFT, 1726 },
+    // State 1
+    { 1, 845, PA_SHIFT, 1728 },
+    // State 1
+    { 1, 846, PA_SHIFT, 1730 },
+    // State 1
+    { 1, 847, PA_SHIFT, 184 },
+    // State 1
+    { 1, 848, PA_SHIFT, 1732 },
+    // State 1
+    { 1, 849, PA_SHIFT, 1734 },
+    // State 1
+    { 1, 850, PA_SHIFT, 1736 },
+    // State 1
+    { 1, 851, PA_SHIFT, 1738 },
+    // State 1
+    { 1, 852, PA_SHIFT, 1740 },
+    // State 1
+    { 1, 853, PA_SHIFT, 1742 },
+    // State 1
+    { 1, 854, PA_SHIFT, 1744 },
+    // State 1
+    { 1, 855, PA_SHIFT, 1746 },
+    // State 1
+    { 1, 856, PA_SHIFT, 1748 },
+    // State 1
+    { 1, 857, PA_SHIFT, 1750 },
+    // State 1
+    { 1, 858, PA_SHIFT, 186 },
+    // State 1
+    { 1, 859, PA_SHIFT, 1752 },
+    // State 1
+    { 1, 860, PA_SHIFT, 1754 },
+    // State 1
+    { 1, 861, PA_SHIFT, 1756 },
+    // State 1
+    { 1, 862, PA_SHIFT, 1758 },
+    // State 1
+    { 1, 863, PA_SHIFT, 1760 },
+    // State 1
+    { 1, 864, PA_SHIFT, 1762 },
+    // State 1
+    { 1, 865, PA_SHIFT, 1764 },
+    // State 1
+    { 1, 866, PA_SHIFT, 1766 },
+    // State 1
+    { 1, 867, PA_SHIFT, 1768 },
+    // State 1
+    { 1, 868, PA_SHIFT, 1770 },
+    // State 1
+    { 1, 869, PA_SHIFT, 188 },
+    // State 1
+    { 1, 870, PA_SHIFT, 1772 },
+    // State 1
+    { 1, 871, PA_SHIFT, 1774 },
+    // State 1
+    { 1, 872, PA_SHIFT, 1776 },
+    // State 1
+    { 1, 873, PA_SHIFT, 1778 },
+    // State 1
+    { 1, 874, PA_SHIFT, 1780 },
+    // State 1
+    { 1, 875, PA_SHIFT, 1782 },
+    // State 1
+    { 1, 876, PA_SHIFT, 1784 },
+    // State 1
+    { 1, 877, PA_SHIFT, 1786 },
+    // State 1
+    { 1, 878, PA_SHIFT, 1788 },
+    // State 1
+    { 1, 879, PA_SHIFT, 1790 },
+    // State 1
+    { 1, 880, PA_SHIFT, 190 },
+    // State 1
+    { 1, 881, PA_SHIFT, 1792 },
+    // State 1
+    { 1, 882, PA_SHIFT, 1794 },
+    // State 1
+    { 1, 883, PA_SHIFT, 1796 },
+    // State 1
+    { 1, 884, PA_SHIFT, 1798 },
+    // State 1
+    { 1, 885, PA_SHIFT, 1800 },
+    // State 1
+    { 1, 886, PA_SHIFT, 1802 },
+    // State 1
+    { 1, 887, PA_SHIFT, 1804 },
+    // State 1
+    { 1, 888, PA_SHIFT, 1806 },
+    // State 1
+    { 1, 889, PA_SHIFT, 1808 },
+    // State 1
+    { 1, 890, PA_SHIFT, 1810 },
+    // State 1
+    { 1, 891, PA_SHIFT, 30 },
+    // State 1
+    { 1, 892, PA_SHIFT, 192 },
+    // State 1
+    { 1, 893, PA_SHIFT, 1812 },
+    // State 1
+    { 1, 894, PA_SHIFT, 1814 },
+    // State 1
+    { 1, 895, PA_SHIFT, 1816 },
+    // State 1
+    { 1, 896, PA_SHIFT, 1818 },
+    // State 1
+    { 1, 897, PA_SHIFT, 1820 },
+    // State 1
+    { 1, 898, PA_SHIFT, 1822 },
+    // State 1
+    { 1, 899, PA_SHIFT, 1824 },
+    // State 1
+    { 1, 900, PA_SHIFT, 1826 },
+    // State 1
+    { 1, 901, PA_SHIFT, 1828 },
+    // State 1
+    { 1, 902, PA_SHIFT, 1830 },
+    // State 1
+    { 1, 903, PA_SHIFT, 194 },
+    // State 1
+    { 1, 904, PA_SHIFT, 1832 },
+    // State 1
+    { 1, 905, PA_SHIFT, 1834 },
+    // State 1
+    { 1, 906, PA_SHIFT, 1836 },
+    // State 1
+    { 1, 907, PA_SHIFT, 1838 },
+    // State 1
+    { 1, 908, PA_SHIFT, 1840 },
+    // State 1
+    { 1, 909, PA_SHIFT, 1842 },
+    // State 1
+    { 1, 910, PA_SHIFT, 1844 },
+    // State 1
+    { 1, 911, PA_SHIFT, 1846 },
+    // State 1
+    { 1, 912, PA_SHIFT, 1848 },
+    // State 1
+    { 1, 913, PA_SHIFT, 1850 },
+    // State 1
+    { 1, 914, PA_SHIFT, 196 },
+    // State 1
+    { 1, 915, PA_SHIFT, 1852 },
+    // State 1
+    { 1, 916, PA_SHIFT, 1854 },
+    // State 1
+    { 1, 917, PA_SHIFT, 1856 },
+    // State 1
+    { 1, 918, PA_SHIFT, 1858 },
+    // State 1
+    { 1, 919, PA_SHIFT, 1860 },
+    // State 1
+    { 1, 920, PA_SHIFT, 1862 },
+    // State 1
+    { 1, 921, PA_SHIFT, 1864 },
+    // State 1
+    { 1, 922, PA_SHIFT, 1866 },
+    // State 1
+    { 1, 923, PA_SHIFT, 1868 },
+    // State 1
+    { 1, 924, PA_SHIFT, 1870 },
+    // State 1
+    { 1, 925, PA_SHIFT, 198 },
+    // State 1
+    { 1, 926, PA_SHIFT, 1872 },
+    // State 1
+    { 1, 927, PA_SHIFT, 1874 },
+    // State 1
+    { 1, 928, PA_SHIFT, 1876 },
+    // State 1
+    { 1, 929, PA_SHIFT, 1878 },
+    // State 1
+    { 1, 930, PA_SHIFT, 1880 },
+    // State 1
+    { 1, 931, PA_SHIFT, 1882 },
+    // State 1
+    { 1, 932, PA_SHIFT, 1884 },
+    // State 1
+    { 1, 933, PA_SHIFT, 1886 },
+    // State 1
+    { 1, 934, PA_SHIFT, 1888 },
+    // State 1
+    { 1, 935, PA_SHIFT, 1890 },
+    // State 1
+    { 1, 936, PA_SHIFT, 200 },
+    // State 1
+    { 1, 937, PA_SHIFT, 1892 },
+    // State 1
+    { 1, 938, PA_SHIFT, 1894 },
+    // State 1
+    { 1, 939, PA_SHIFT, 1896 },
+    // State 1
+    { 1, 940, PA_SHIFT, 1898 },
+    // State 1
+    { 1, 941, PA_SHIFT, 1900 },
+    // State 1
+    { 1, 942, PA_SHIFT, 1902 },
+    // State 1
+    { 1, 943, PA_SHIFT, 1904 },
+    // State 1
+    { 1, 944, PA_SHIFT, 1906 },
+    // State 1
+    { 1, 945, PA_SHIFT, 1908 },
+    // State 1
+    { 1, 946, PA_SHIFT, 1910 },
+    // State 1
+    { 1, 947, PA_SHIFT, 202 },
+    // State 1
+    { 1, 948, PA_SHIFT, 1912 },
+    // State 1
+    { 1, 949, PA_SHIFT, 1914 },
+    // State 1
+    { 1, 950, PA_SHIFT, 1916 },
+    // State 1
+    { 1, 951, PA_SHIFT, 1918 },
+    // State 1
+    { 1, 952, PA_SHIFT, 1920 },
+    // State 1
+    { 1, 953, PA_SHIFT, 1922 },
+    // State 1
+    { 1, 954, PA_SHIFT, 1924 },
+    // State 1
+    { 1, 955, PA_SHIFT, 1926 },
+    // State 1
+    { 1, 956, PA_SHIFT, 1928 },
+    // State 1
+    { 1, 957, PA_SHIFT, 1930 },
+    // State 1
+    { 1, 958, PA_SHIFT, 204 },
+    // State 1
+    { 1, 959, PA_SHIFT, 1932 },
+    // State 1
+    { 1, 960, PA_SHIFT, 1934 },
+    // State 1
+    { 1, 961, PA_SHIFT, 1936 },
+    // State 1
+    { 1, 962, PA_SHIFT, 1938 },
+    // State 1
+    { 1, 963, PA_SHIFT, 1940 },
+    // State 1
+    { 1, 964, PA_SHIFT, 1942 },
+    // State 1
+    { 1, 965, PA_SHIFT, 1944 },
+    // State 1
+    { 1, 966, PA_SHIFT, 1946 },
+    // State 1
+    { 1, 967, PA_SHIFT, 1948 },
+    // State 1
+    { 1, 968, PA_SHIFT, 1950 },
+    // State 1
+    { 1, 969, PA_SHIFT, 206 },
+    // State 1
+    { 1, 970, PA_SHIFT, 1952 },
+    // State 1
+    { 1, 971, PA_SHIFT, 1954 },
+    // State 1
+    { 1, 972, PA_SHIFT, 1956 },
+    // State 1
+    { 1, 973, PA_SHIFT, 1958 },
+    // State 1
+    { 1, 974, PA_SHIFT, 1960 },
+    // State 1
+    { 1, 975, PA_SHIFT, 1962 },
+    // State 1
+    { 1, 976, PA_SHIFT, 1964 },
+    // State 1
+    { 1, 977, PA_SHIFT, 1966 },
+    // State 1
+    { 1, 978, PA_SHIFT, 1968 },
+    // State 1
+    { 1, 979, PA_SHIFT, 1970 },
+    // State 1
+    { 1, 980, PA_SHIFT, 208 },
+    // State 1
+    { 1, 981, PA_SHIFT, 1972 },
+    // State 1
+    { 1, 982, PA_SHIFT, 1974 },
+    // State 1
+    { 1, 983, PA_SHIFT, 1976 },
+    // State 1
+    { 1, 984, PA_SHIFT, 1978 },
+    // State 1
+    { 1, 985, PA_SHIFT, 1980 },
+    // State 1
+    { 1, 986, PA_SHIFT, 1982 },
+    // State 1
+    { 1, 987, PA_SHIFT, 1984 },
+    // State 1
+    { 1, 988, PA_SHIFT, 1986 },
+    // State 1
+    { 1, 989, PA_SHIFT, 1988 },
+    // State 1
+    { 1, 990, PA_SHIFT, 1990 },
+    // State 1
+    { 1, 991, PA_SHIFT, 210 },
+    // State 1
+    { 1, 992, PA_SHIFT, 1992 },
+    // State 1
+    { 1, 993, PA_SHIFT, 1994 },
+    // State 1
+    { 1, 1002, PA_SHIFT, 2 },
+    // State 2
+    { 2, 998, PA_SHIFT, 3 },
+    // State 3
+    { 3, 1005, PA_REDUCE, 2 },
+    // State 3 default action
+    { 3, -1, PA_REDUCE, 2 },
+    // State 4
+    { 4, 1, PA_SHIFT, 8 },
+    // State 4
+    { 4, 994, PA_SHIFT, 10 },
+    // State 4
+    { 4, 995, PA_SHIFT, 9 },
+    // State 4
+    { 4, 1000, PA_SHIFT, 5 },
+    // State 4
+    { 4, 1004, PA_SHIFT, 13 },
+    // State 5
+    { 5, 996, PA_SHIFT, 6 },
+    // State 5
+    { 5, 998, PA_REDUCE, 8 },
+    // State 6
+    { 6, 1, PA_SHIFT, 8 },
+    // State 6
+    { 6, 994, PA_SHIFT, 10 },
+    // State 6
+    { 6, 995, PA_SHIFT, 9 },
+    // State 6
+    { 6, 1004, PA_SHIFT, 7 },
+    // State 7
+    { 7, 1005, PA_REDUCE, 3 },
+    // State 7 default action
+    { 7, -1, PA_REDUCE, 3 },
+    // State 8
+    { 8, 1005, PA_REDUCE, 5 },
+    // State 8 default action
+    { 8, -1, PA_REDUCE, 5 },
+    // State 9
+    { 9, 1005, PA_REDUCE, 6 },
+    // State 9 default action
+    { 9, -1, PA_REDUCE, 6 },
+    // State 10
+    { 10, 1, PA_SHIFT, 8 },
+    // State 10
+    { 10, 994, PA_SHIFT, 10 },
+    // State 10
+    { 10, 995, PA_SHIFT, 9 },
+    // State 10
+    { 10, 1000, PA_SHIFT, 11 },
+    // State 10
+    { 10, 1004, PA_SHIFT, 13 },
+    // State 11
+    { 11, 996, PA_SHIFT, 6 },
+    // State 11
+    { 11, 997, PA_SHIFT, 12 },
+    // State 12
+    { 12, 1005, PA_REDUCE, 7 },
+    // State 12 default action
+    { 12, -1, PA_REDUCE, 7 },
+    // State 13
+    { 13, 1005, PA_REDUCE, 4 },
+    // State 13 default action
+    { 13, -1, PA_REDUCE, 4 },
+    // State 14
+    { 14, 1, PA_SHIFT, 8 },
+    // State 14
+    { 14, 994, PA_SHIFT, 10 },
+    // State 14
+    { 14, 995, PA_SHIFT, 9 },
+    // State 14
+    { 14, 1000, PA_SHIFT, 15 },
+    // State 14
+    { 14, 1004, PA_SHIFT, 13 },
+    // State 15
+    { 15, 996, PA_SHIFT, 6 },
+    // State 15
+    { 15, 998, PA_REDUCE, 9 },
+    // State 16
+    { 16, 1, PA_SHIFT, 8 },
+    // State 16
+    { 16, 994, PA_SHIFT, 10 },
+    // State 16
+    { 16, 995, PA_SHIFT, 9 },
+    // State 16
+    { 16, 1000, PA_SHIFT, 17 },
+    // State 16
+    { 16, 1004, PA_SHIFT, 13 },
+    // State 17
+    { 17, 996, PA_SHIFT, 6 },
+    // State 17
+    { 17, 998, PA_REDUCE, 10 },
+    // State 18
+    { 18, 1, PA_SHIFT, 8 },
+    // State 18
+    { 18, 994, PA_SHIFT, 10 },
+    // State 18
+    { 18, 995, PA_SHIFT, 9 },
+    // State 18
+    { 18, 1000, PA_SHIFT, 19 },
+    // State 18
+    { 18, 1004, PA_SHIFT, 13 },
+    // State 19
+    { 19, 996, PA_SHIFT, 6 },
+    // State 19
+    { 19, 998, PA_REDUCE, 11 },
+    // State 20
+    { 20, 1, PA_SHIFT, 8 },
+    // State 20
+    { 20, 994, PA_SHIFT, 10 },
+    // State 20
+    { 20, 995, PA_SHIFT, 9 },
+    // State 20
+    { 20, 1000, PA_SHIFT, 21 },
+    // State 20
+    { 20, 1004, PA_SHIFT, 13 },
+    // State 21
+    { 21, 996, PA_SHIFT, 6 },
+    // State 21
+    { 21, 998, PA_REDUCE, 12 },
+    // State 22
+    { 22, 1, PA_SHIFT, 8 },
+    // State 22
+    { 22, 994, PA_SHIFT, 10 },
+    // State 22
+    { 22, 995, PA_SHIFT, 9 },
+    // State 22
+    { 22, 1000, PA_SHIFT, 23 },
+    // State 22
+    { 22, 1004, PA_SHIFT, 13 },
+    // State 23
+    { 23, 996, PA_SHIFT, 6 },
+    // State 23
+    { 23, 998, PA_REDUCE, 13 },
+    // State 24
+    { 24, 1, PA_SHIFT, 8 },
+    // State 24
+    { 24, 994, PA_SHIFT, 10 },
+    // State 24
+    { 24, 995, PA_SHIFT, 9 },
+    // State 24
+    { 24, 1000, PA_SHIFT, 25 },
+    // State 24
+    { 24, 1004, PA_SHIFT, 13 },
+    // State 25
+    { 25, 996, PA_SHIFT, 6 },
+    // State 25
+    { 25, 998, PA_REDUCE, 14 },
+    // State 26
+    { 26, 1, PA_SHIFT, 8 },
+    // State 26
+    { 26, 994, PA_SHIFT, 10 },
+    // State 26
+    { 26, 995, PA_SHIFT, 9 },
+    // State 26
+    { 26, 1000, PA_SHIFT, 27 },
+    // State 26
+    { 26, 1004, PA_SHIFT, 13 },
+    // State 27
+    { 27, 996, PA_SHIFT, 6 },
+    // State 27
+    { 27, 998, PA_REDUCE, 15 },
+    // State 28
+    { 28, 1, PA_SHIFT, 8 },
+    // State 28
+    { 28, 994, PA_SHIFT, 10 },
+    // State 28
+    { 28, 995, PA_SHIFT, 9 },
+    // State 28
+    { 28, 1000, PA_SHIFT, 29 },
+    // State 28
+    { 28, 1004, PA_SHIFT, 13 },
+    // State 29
+    { 29, 996, PA_SHIFT, 6 },
+    // State 29
+    { 29, 998, PA_REDUCE, 16 },
+    // State 30
+    { 30, 1, PA_SHIFT, 8 },
+    // State 30
+    { 30, 994, PA_SHIFT, 10 },
+    // State 30
+    { 30, 995, PA_SHIFT, 9 },
+    // State 30
+    { 30, 1000, PA_SHIFT, 31 },
+    // State 30
+    { 30, 1004, PA_SHIFT, 13 },
+    // State 31
+    { 31, 996, PA_SHIFT, 6 },
+    // State 31
+    { 31, 998, PA_REDUCE, 17 },
+    // State 32
+    { 32, 1, PA_SHIFT, 8 },
+    // State 32
+    { 32, 994, PA_SHIFT, 10 },
+    // State 32
+    { 32, 995, PA_SHIFT, 9 },
+    // State 32
+    { 32, 1000, PA_SHIFT, 33 },
+    // State 32
+    { 32, 1004, PA_SHIFT, 13 },
+    // State 33
+    { 33, 996, PA_SHIFT, 6 },
+    // State 33
+    { 33, 998, PA_REDUCE, 18 },
+    // State 34
+    { 34, 1, PA_SHIFT, 8 },
+    // State 34
+    { 34, 994, PA_SHIFT, 10 },
+    // State 34
+    { 34, 995, PA_SHIFT, 9 },
+    // State 34
+    { 34, 1000, PA_SHIFT, 35 },
+    // State 34
+    { 34, 1004, PA_SHIFT, 13 },
+    // State 35
+    { 35, 996, PA_SHIFT, 6 },
+    // State 35
+    { 35, 998, PA_REDUCE, 19 },
+    // State 36
+    { 36, 1, PA_SHIFT, 8 },
+    // State 36
+    { 36, 994, PA_SHIFT, 10 },
+    // State 36
+    { 36, 995, PA_SHIFT, 9 },
+    // State 36
+    { 36, 1000, PA_SHIFT, 37 },
+    // State 36
+    { 36, 1004, PA_SHIFT, 13 },
+    // State 37
+    { 37, 996, PA_SHIFT, 6 },
+    // State 37
+    { 37, 998, PA_REDUCE, 20 },
+    // State 38
+    { 38, 1, PA_SHIFT, 8 },
+    // State 38
+    { 38, 994, PA_SHIFT, 10 },
+    // State 38
+    { 38, 995, PA_SHIFT, 9 },
+    // State 38
+    { 38, 1000, PA_SHIFT, 39 },
+    // State 38
+    { 38, 1004, PA_SHIFT, 13 },
+    // State 39
+    { 39, 996, PA_SHIFT, 6 },
+    // State 39
+    { 39, 998, PA_REDUCE, 21 },
+    // State 40
+    { 40, 1, PA_SHIFT, 8 },
+    // State 40
+    { 40, 994, PA_SHIFT, 10 },
+    // State 40
+    { 40, 995, PA_SHIFT, 9 },
+    // State 40
+    { 40, 1000, PA_SHIFT, 41 },
+    // State 40
+    { 40, 1004, PA_SHIFT, 13 },
+    // State 41
+    { 41, 996, PA_SHIFT, 6 },
+    // State 41
+    { 41, 998, PA_REDUCE, 22 },
+    // State 42
+    { 42, 1, PA_SHIFT, 8 },
+    // State 42
+    { 42, 994, PA_SHIFT, 10 },
+    // State 42
+    { 42, 995, PA_SHIFT, 9 },
+    // State 42
+    { 42, 1000, PA_SHIFT, 43 },
+    // State 42
+    { 42, 1004, PA_SHIFT, 13 },
+    // State 43
+    { 43, 996, PA_SHIFT, 6 },
+    // State 43
+    { 43, 998, PA_REDUCE, 23 },
+    // State 44
+    { 44, 1, PA_SHIFT, 8 },
+    // State 44
+    { 44, 994, PA_SHIFT, 10 },
+    // State 44
+    { 44, 995, PA_SHIFT, 9 },
+    // State 44
+    { 44, 1000, PA_SHIFT, 45 },
+    // State 44
+    { 44, 1004, PA_SHIFT, 13 },
+    // State 45
+    { 45, 996, PA_SHIFT, 6 },
+    // State 45
+    { 45, 998, PA_REDUCE, 24 },
+    // State 46
+    { 46, 1, PA_SHIFT, 8 },
+    // State 46
+    { 46, 994, PA_SHIFT, 10 },
+    // State 46
+    { 46, 995, PA_SHIFT, 9 },
+    // State 46
+    { 46, 1000, PA_SHIFT, 47 },
+    // State 46
+    { 46, 1004, PA_SHIFT, 13 },
+    // State 47
+    { 47, 996, PA_SHIFT, 6 },
+    // State 47
+    { 47, 998, PA_REDUCE, 25 },
+    // State 48
+    { 48, 1, PA_SHIFT, 8 },
+    // State 48
+    { 48, 994, PA_SHIFT, 10 },
+    // State 48
+    { 48, 995, PA_SHIFT, 9 },
+    // State 48
+    { 48, 1000, PA_SHIFT, 49 },
+    // State 48
+    { 48, 1004, PA_SHIFT, 13 },
+    // State 49
+    { 49, 996, PA_SHIFT, 6 },
+    // State 49
+    { 49, 998, PA_REDUCE, 26 },
+    // State 50
+    { 50, 1, PA_SHIFT, 8 },
+    // State 50
+    { 50, 994, PA_SHIFT, 10 },
+    // State 50
+    { 50, 995, PA_SHIFT, 9 },
+    // State 50
+    { 50, 1000, PA_SHIFT, 51 },
+    // State 50
+    { 50, 1004, PA_SHIFT, 13 },
+    // State 51
+    { 51, 996, PA_SHIFT, 6 },
+    // State 51
+    { 51, 998, PA_REDUCE, 27 },
+    // State 52
+    { 52, 1, PA_SHIFT, 8 },
+    // State 52
+    { 52, 994, PA_SHIFT, 10 },
+    // State 52
+    { 52, 995, PA_SHIFT, 9 },
+    // State 52
+    { 52, 1000, PA_SHIFT, 53 },
+    // State 52
+    { 52, 1004, PA_SHIFT, 13 },
+    // State 53
+    { 53, 996, PA_SHIFT, 6 },
+    // State 53
+    { 53, 998, PA_REDUCE, 28 },
+    // State 54
+    { 54, 1, PA_SHIFT, 8 },
+    // State 54
+    { 54, 994, PA_SHIFT, 10 },
+    // State 54
+    { 54, 995, PA_SHIFT, 9 },
+    // State 54
+    { 54, 1000, PA_SHIFT, 55 },
+    // State 54
+    { 54, 1004, PA_SHIFT, 13 },
+    // State 55
+    { 55, 996, PA_SHIFT, 6 },
+    // State 55
+    { 55, 998, PA_REDUCE, 29 },
+    // State 56
+    { 56, 1, PA_SHIFT, 8 },
+    // State 56
+    { 56, 994, PA_SHIFT, 10 },
+    // State 56
+    { 56, 995, PA_SHIFT, 9 },
+    // State 56
+    { 56, 1000, PA_SHIFT, 57 },
+    // State 56
+    { 56, 1004, PA_SHIFT, 13 },
+    // State 57
+    { 57, 996, PA_SHIFT, 6 },
+    // State 57
+    { 57, 998, PA_REDUCE, 30 },
+    // State 58
+    { 58, 1, PA_SHIFT, 8 },
+    // State 58
+    { 58, 994, PA_SHIFT, 10 },
+    // State 58
+    { 58, 995, PA_SHIFT, 9 },
+    // State 58
+    { 58, 1000, PA_SHIFT, 59 },
+    // State 58
+    { 58, 1004, PA_SHIFT, 13 },
+    // State 59
+    { 59, 996, PA_SHIFT, 6 },
+    // State 59
+    { 59, 998, PA_REDUCE, 31 },
+    // State 60
+    { 60, 1, PA_SHIFT, 8 },
+    // State 60
+    { 60, 994, PA_SHIFT, 10 },
+    // State 60
+    { 60, 995, PA_SHIFT, 9 },
+    // State 60
+    { 60, 1000, PA_SHIFT, 61 },
+    // State 60
+    { 60, 1004, PA_SHIFT, 13 },
+    // State 61
+    { 61, 996, PA_SHIFT, 6 },
+    // State 61
+    { 61, 998, PA_REDUCE, 32 },
+    // State 62
+    { 62, 1, PA_SHIFT, 8 },
+    // State 62
+    { 62, 994, PA_SHIFT, 10 },
+    // State 62
+    { 62, 995, PA_SHIFT, 9 },
+    // State 62
+    { 62, 1000, PA_SHIFT, 63 },
+    // State 62
+    { 62, 1004, PA_SHIFT, 13 },
+    // State 63
+    { 63, 996, PA_SHIFT, 6 },
+    // State 63
+    { 63, 998, PA_REDUCE, 33 },
+    // State 64
+    { 64, 1, PA_SHIFT, 8 },
+    // State 64
+    { 64, 994, PA_SHIFT, 10 },
+    // State 64
+    { 64, 995, PA_SHIFT, 9 },
+    // State 64
+    { 64, 1000, PA_SHIFT, 65 },
+    // State 64
+    { 64, 1004, PA_SHIFT, 13 },
+    // State 65
+    { 65, 996, PA_SHIFT, 6 },
+    // State 65
+    { 65, 998, PA_REDUCE, 34 },
+    // State 66
+    { 66, 1, PA_SHIFT, 8 },
+    // State 66
+    { 66, 994, PA_SHIFT, 10 },
+    // State 66
+    { 66, 995, PA_SHIFT, 9 },
+    // State 66
+    { 66, 1000, PA_SHIFT, 67 },
+    // State 66
+    { 66, 1004, PA_SHIFT, 13 },
+    // State 67
+    { 67, 996, PA_SHIFT, 6 },
+    // State 67
+    { 67, 998, PA_REDUCE, 35 },
+    // State 68
+    { 68, 1, PA_SHIFT, 8 },
+    // State 68
+    { 68, 994, PA_SHIFT, 10 },
+    // State 68
+    { 68, 995, PA_SHIFT, 9 },
+    // State 68
+    { 68, 1000, PA_SHIFT, 69 },
+    // State 68
+    { 68, 1004, PA_SHIFT, 13 },
+    // State 69
+    { 69, 996, PA_SHIFT, 6 },
+    // State 69
+    { 69, 998, PA_REDUCE, 36 },
+    // State 70
+    { 70, 1, PA_SHIFT, 8 },
+    // State 70
+    { 70, 994, PA_SHIFT, 10 },
+    // State 70
+    { 70, 995, PA_SHIFT, 9 },
+    // State 70
+    { 70, 1000, PA_SHIFT, 71 },
+    // State 70
+    { 70, 1004, PA_SHIFT, 13 },
+    // State 71
+    { 71, 996, PA_SHIFT, 6 },
+    // State 71
+    { 71, 998, PA_REDUCE, 37 },
+    // State 72
+    { 72, 1, PA_SHIFT, 8 },
+    // State 72
+    { 72, 994, PA_SHIFT, 10 },
+    // State 72
+    { 72, 995, PA_SHIFT, 9 },
+    // State 72
+    { 72, 1000, PA_SHIFT, 73 },
+    // State 72
+    { 72, 1004, PA_SHIFT, 13 },
+    // State 73
+    { 73, 996, PA_SHIFT, 6 },
+    // State 73
+    { 73, 998, PA_REDUCE, 38 },
+    // State 74
+    { 74, 1, PA_SHIFT, 8 },
+    // State 74
+    { 74, 994, PA_SHIFT, 10 },
+    // State 74
+    { 74, 995, PA_SHIFT, 9 },
+    // State 74
+    { 74, 1000, PA_SHIFT, 75 },
+    // State 74
+    { 74, 1004, PA_SHIFT, 13 },
+    // State 75
+    { 75, 996, PA_SHIFT, 6 },
+    // State 75
+    { 75, 998, PA_REDUCE, 39 },
+    // State 76
+    { 76, 1, PA_SHIFT, 8 },
+    // State 76
+    { 76, 994, PA_SHIFT, 10 },
+    // State 76
+    { 76, 995, PA_SHIFT, 9 },
+    // State 76
+    { 76, 1000, PA_SHIFT, 77 },
+    // State 76
+    { 76, 1004, PA_SHIFT, 13 },
+    // State 77
+    { 77, 996, PA_SHIFT, 6 },
+    // State 77
+    { 77, 998, PA_REDUCE, 40 },
+    // State 78
+    { 78, 1, PA_SHIFT, 8 },
+    // State 78
+    { 78, 994, PA_SHIFT, 10 },
+    // State 78
+    { 78, 995, PA_SHIFT, 9 },
+    // State 78
+    { 78, 1000, PA_SHIFT, 79 },
+    // State 78
+    { 78, 1004, PA_SHIFT, 13 },
+    // State 79
+    { 79, 996, PA_SHIFT, 6 },
+    // State 79
+    { 79, 998, PA_REDUCE, 41 },
+    // State 80
+    { 80, 1, PA_SHIFT, 8 },
+    // State 80
+    { 80, 994, PA_SHIFT, 10 },
+    // State 80
+    { 80, 995, PA_SHIFT, 9 },
+    // State 80
+    { 80, 1000, PA_SHIFT, 81 },
+    // State 80
+    { 80, 1004, PA_SHIFT, 13 },
+    // State 81
+    { 81, 996, PA_SHIFT, 6 },
+    // State 81
+    { 81, 998, PA_REDUCE, 42 },
+    // State 82
+    { 82, 1, PA_SHIFT, 8 },
+    // State 82
+    { 82, 994, PA_SHIFT, 10 },
+    // State 82
+    { 82, 995, PA_SHIFT, 9 },
+    // State 82
+    { 82, 1000, PA_SHIFT, 83 },
+    // State 82
+    { 82, 1004, PA_SHIFT, 13 },
+    // State 83
+    { 83, 996, PA_SHIFT, 6 },
+    // State 83
+    { 83, 998, PA_REDUCE, 43 },
+    // State 84
+    { 84, 1, PA_SHIFT, 8 },
+    // State 84
+    { 84, 994, PA_SHIFT, 10 },
+    // State 84
+    { 84, 995, PA_SHIFT, 9 },
+    // State 84
+    { 84, 1000, PA_SHIFT, 85 },
+    // State 84
+    { 84, 1004, PA_SHIFT, 13 },
+    // State 85
+    { 85, 996, PA_SHIFT, 6 },
+    // State 85
+    { 85, 998, PA_REDUCE, 44 },
+    // State 86
+    { 86, 1, PA_SHIFT, 8 },
+    // State 86
+    { 86, 994, PA_SHIFT, 10 },
+    // State 86
+    { 86, 995, PA_SHIFT, 9 },
+    // State 86
+    { 86, 1000, PA_SHIFT, 87 },
+    // State 86
+    { 86, 1004, PA_SHIFT, 13 },
+    // State 87
+    { 87, 996, PA_SHIFT, 6 },
+    // State 87
+    { 87, 998, PA_REDUCE, 45 },
+    // State 88
+    { 88, 1, PA_SHIFT, 8 },
+    // State 88
+    { 88, 994, PA_SHIFT, 10 },
+    // State 88
+    { 88, 995, PA_SHIFT, 9 },
+    // State 88
+    { 88, 1000, PA_SHIFT, 89 },
+    // State 88
+    { 88, 1004, PA_SHIFT, 13 },
+    // State 89
+    { 89, 996, PA_SHIFT, 6 },
+    // State 89
+    { 89, 998, PA_REDUCE, 46 },
+    // State 90
+    { 90, 1, PA_SHIFT, 8 },
+    // State 90
+    { 90, 994, PA_SHIFT, 10 },
+    // State 90
+    { 90, 995, PA_SHIFT, 9 },
+    // State 90
+    { 90, 1000, PA_SHIFT, 91 },
+    // State 90
+    { 90, 1004, PA_SHIFT, 13 },
+    // State 91
+    { 91, 996, PA_SHIFT, 6 },
+    // State 91
+    { 91, 998, PA_REDUCE, 47 },
+    // State 92
+    { 92, 1, PA_SHIFT, 8 },
+    // State 92
+    { 92, 994, PA_SHIFT, 10 },
+    // State 92
+    { 92, 995, PA_SHIFT, 9 },
+    // State 92
+    { 92, 1000, PA_SHIFT, 93 },
+    // State 92
+    { 92, 1004, PA_SHIFT, 13 },
+    // State 93
+    { 93, 996, PA_SHIFT, 6 },
+    // State 93
+    { 93, 998, PA_REDUCE, 48 },
+    // State 94
+    { 94, 1, PA_SHIFT, 8 },
+    // State 94
+    { 94, 994, PA_SHIFT, 10 },
+    // State 94
+    { 94, 995, PA_SHIFT, 9 },
+    // State 94
+    { 94, 1000, PA_SHIFT, 95 },
+    // State 94
+    { 94, 1004, PA_SHIFT, 13 },
+    // State 95
+    { 95, 996, PA_SHIFT, 6 },
+    // State 95
+    { 95, 998, PA_REDUCE, 49 },
+    // State 96
+    { 96, 1, PA_SHIFT, 8 },
+    // State 96
+    { 96, 994, PA_SHIFT, 10 },
+    // State 96
+    { 96, 995, PA_SHIFT, 9 },
+    // State 96
+    { 96, 1000, PA_SHIFT, 97 },
+    // State 96
+    { 96, 1004, PA_SHIFT, 13 },
+    // State 97
+    { 97, 996, PA_SHIFT, 6 },
+    // State 97
+    { 97, 998, PA_REDUCE, 50 },
+    // State 98
+    { 98, 1, PA_SHIFT, 8 },
+    // State 98
+    { 98, 994, PA_SHIFT, 10 },
+    // State 98
+    { 98, 995, PA_SHIFT, 9 },
+    // State 98
+    { 98, 1000, PA_SHIFT, 99 },
+    // State 98
+    { 98, 1004, PA_SHIFT, 13 },
+    // State 99
+    { 99, 996, PA_SHIFT, 6 },
+    // State 99
+    { 99, 998, PA_REDUCE, 51 },
+    // State 100
+    { 100, 1, PA_SHIFT, 8 },
+    // State 100
+    { 100, 994, PA_SHIFT, 10 },
+    // State 100
+    { 100, 995, PA_SHIFT, 9 },
+    // State 100
+    { 100, 1000, PA_SHIFT, 101 },
+    // State 100
+    { 100, 1004, PA_SHIFT, 13 },
+    // State 101
+    { 101, 996, PA_SHIFT, 6 },
+    // State 101
+    { 101, 998, PA_REDUCE, 52 },
+    // State 102
+    { 102, 1, PA_SHIFT, 8 },
+    // State 102
+    { 102, 994, PA_SHIFT, 10 },
+    // State 102
+    { 102, 995, PA_SHIFT, 9 },
+    // State 102
+    { 102, 1000, PA_SHIFT, 103 },
+    // State 102
+    { 102, 1004, PA_SHIFT, 13 },
+    // State 103
+    { 103, 996, PA_SHIFT, 6 },
+    // State 103
+    { 103, 998, PA_REDUCE, 53 },
+    // State 104
+    { 104, 1, PA_SHIFT, 8 },
+    // State 104
+    { 104, 994, PA_SHIFT, 10 },
+    // State 104
+    { 104, 995, PA_SHIFT, 9 },
+    // State 104
+    { 104, 1000, PA_SHIFT, 105 },
+    // State 104
+    { 104, 1004, PA_SHIFT, 13 },
+    // State 105
+    { 105, 996, PA_SHIFT, 6 },
+    // State 105
+    { 105, 998, PA_REDUCE, 54 },
+    // State 106
+    { 106, 1, PA_SHIFT, 8 },
+    // State 106
+    { 106, 994, PA_SHIFT, 10 },
+    // State 106
+    { 106, 995, PA_SHIFT, 9 },
+    // State 106
+    { 106, 1000, PA_SHIFT, 107 },
+    // State 106
+    { 106, 1004, PA_SHIFT, 13 },
+    // State 107
+    { 107, 996, PA_SHIFT, 6 },
+    // State 107
+    { 107, 998, PA_REDUCE, 55 },
+    // State 108
+    { 108, 1, PA_SHIFT, 8 },
+    // State 108
+    { 108, 994, PA_SHIFT, 10 },
+    // State 108
+    { 108, 995, PA_SHIFT, 9 },
+    // State 108
+    { 108, 1000, PA_SHIFT, 109 },
+    // State 108
+    { 108, 1004, PA_SHIFT, 13 },
+    // State 109
+    { 109, 996, PA_SHIFT, 6 },
+    // State 109
+    { 109, 998, PA_REDUCE, 56 },
+    // State 110
+    { 110, 1, PA_SHIFT, 8 },
+    // State 110
+    { 110, 994, PA_SHIFT, 10 },
+    // State 110
+    { 110, 995, PA_SHIFT, 9 },
+    // State 110
+    { 110, 1000, PA_SHIFT, 111 },
+    // State 110
+    { 110, 1004, PA_SHIFT, 13 },
+    // State 111
+    { 111, 996, PA_SHIFT, 6 },
+    // State 111
+    { 111, 998, PA_REDUCE, 57 },
+    // State 112
+    { 112, 1, PA_SHIFT, 8 },
+    // State 112
+    { 112, 994, PA_SHIFT, 10 },
+    // State 112
+    { 112, 995, PA_SHIFT, 9 },
+    // State 112
+    { 112, 1000, PA_SHIFT, 113 },
+    // State 112
+    { 112, 1004, PA_SHIFT, 13 },
+    // State 113
+    { 113, 996, PA_SHIFT, 6 },
+    // State 113
+    { 113, 998, PA_REDUCE, 58 },
+    // State 114
+    { 114, 1, PA_SHIFT, 8 },
+    // State 114
+    { 114, 994, PA_SHIFT, 10 },
+    // State 114
+    { 114, 995, PA_SHIFT, 9 },
+    // State 114
+    { 114, 1000, PA_SHIFT, 115 },
+    // State 114
+    { 114, 1004, PA_SHIFT, 13 },
+    // State 115
+    { 115, 996, PA_SHIFT, 6 },
+    // State 115
+    { 115, 998, PA_REDUCE, 59 },
+    // State 116
+    { 116, 1, PA_SHIFT, 8 },
+    // State 116
+    { 116, 994, PA_SHIFT, 10 },
+    // State 116
+    { 116, 995, PA_SHIFT, 9 },
+    // State 116
+    { 116, 1000, PA_SHIFT, 117 },
+    // State 116
+    { 116, 1004, PA_SHIFT, 13 },
+    // State 117
+    { 117, 996, PA_SHIFT, 6 },
+    // State 117
+    { 117, 998, PA_REDUCE, 60 },
+    // State 118
+    { 118, 1, PA_SHIFT, 8 },
+    // State 118
+    { 118, 994, PA_SHIFT, 10 },
+    // State 118
+    { 118, 995, PA_SHIFT, 9 },
+    // State 118
+    { 118, 1000, PA_SHIFT, 119 },
+    // State 118
+    { 118, 1004, PA_SHIFT, 13 },
+    // State 119
+    { 119, 996, PA_SHIFT, 6 },
+    // State 119
+    { 119, 998, PA_REDUCE, 61 },
+    // State 120
+    { 120, 1, PA_SHIFT, 8 },
+    // State 120
+    { 120, 994, PA_SHIFT, 10 },
+    // State 120
+    { 120, 995, PA_SHIFT, 9 },
+    // State 120
+    { 120, 1000, PA_SHIFT, 121 },
+    // State 120
+    { 120, 1004, PA_SHIFT, 13 },
+    // State 121
+    { 121, 996, PA_SHIFT, 6 },
+    // State 121
+    { 121, 998, PA_REDUCE, 62 },
+    // State 122
+    { 122, 1, PA_SHIFT, 8 },
+    // State 122
+    { 122, 994, PA_SHIFT, 10 },
+    // State 122
+    { 122, 995, PA_SHIFT, 9 },
+    // State 122
+    { 122, 1000, PA_SHIFT, 123 },
+    // State 122
+    { 122, 1004, PA_SHIFT, 13 },
+    // State 123
+    { 123, 996, PA_SHIFT, 6 },
+    // State 123
+    { 123, 998, PA_REDUCE, 63 },
+    // State 124
+    { 124, 1, PA_SHIFT, 8 },
+    // State 124
+    { 124, 994, PA_SHIFT, 10 },
+    // State 124
+    { 124, 995, PA_SHIFT, 9 },
+    // State 124
+    { 124, 1000, PA_SHIFT, 125 },
+    // State 124
+    { 124, 1004, PA_SHIFT, 13 },
+    // State 125
+    { 125, 996, PA_SHIFT, 6 },
+    // State 125
+    { 125, 998, PA_REDUCE, 64 },
+    // State 126
+    { 126, 1, PA_SHIFT, 8 },
+    // State 126
+    { 126, 994, PA_SHIFT, 10 },
+    // State 126
+    { 126, 995, PA_SHIFT, 9 },
+    // State 126
+    { 126, 1000, PA_SHIFT, 127 },
+    // State 126
+    { 126, 1004, PA_SHIFT, 13 },
+    // State 127
+    { 127, 996, PA_SHIFT, 6 },
+    // State 127
+    { 127, 998, PA_REDUCE, 65 },
+    // State 128
+    { 128, 1, PA_SHIFT, 8 },
+    // State 128
+    { 128, 994, PA_SHIFT, 10 },
+    // State 128
+    { 128, 995, PA_SHIFT, 9 },
+    // State 128
+    { 128, 1000, PA_SHIFT, 129 },
+    // State 128
+    { 128, 1004, PA_SHIFT, 13 },
+    // State 129
+    { 129, 996, PA_SHIFT, 6 },
+    // State 129
+    { 129, 998, PA_REDUCE, 66 },
+    // State 130
+    { 130, 1, PA_SHIFT, 8 },
+    // State 130
+    { 130, 994, PA_SHIFT, 10 },
+    // State 130
+    { 130, 995, PA_SHIFT, 9 },
+    // State 130
+    { 130, 1000, PA_SHIFT, 131 },
+    // State 130
+    { 130, 1004, PA_SHIFT, 13 },
+    // State 131
+    { 131, 996, PA_SHIFT, 6 },
+    // State 131
+    { 131, 998, PA_REDUCE, 67 },
+    // State 132
+    { 132, 1, PA_SHIFT, 8 },
+    // State 132
+    { 132, 994, PA_SHIFT, 10 },
+    // State 132
+    { 132, 995, PA_SHIFT, 9 },
+    // State 132
+    { 132, 1000, PA_SHIFT, 133 },
+    // State 132
+    { 132, 1004, PA_SHIFT, 13 },
+    // State 133
+    { 133, 996, PA_SHIFT, 6 },
+    // State 133
+    { 133, 998, PA_REDUCE, 68 },
+    // State 134
+    { 134, 1, PA_SHIFT, 8 },
+    // State 134
+    { 134, 994, PA_SHIFT, 10 },
+    // State 134
+    { 134, 995, PA_SHIFT, 9 },
+    // State 134
+    { 134, 1000, PA_SHIFT, 135 },
+    // State 134
+    { 134, 1004, PA_SHIFT, 13 },
+    // State 135
+    { 135, 996, PA_SHIFT, 6 },
+    // State 135
+    { 135, 998, PA_REDUCE, 69 },
+    // State 136
+    { 136, 1, PA_SHIFT, 8 },
+    // State 136
+    { 136, 994, PA_SHIFT, 10 },
+    // State 136
+    { 136, 995, PA_SHIFT, 9 },
+    // State 136
+    { 136, 1000, PA_SHIFT, 137 },
+    // State 136
+    { 136, 1004, PA_SHIFT, 13 },
+    // State 137
+    { 137, 996, PA_SHIFT, 6 },
+    // State 137
+    { 137, 998, PA_REDUCE, 70 },
+    // State 138
+    { 138, 1, PA_SHIFT, 8 },
+    // State 138
+    { 138, 994, PA_SHIFT, 10 },
+    // State 138
+    { 138, 995, PA_SHIFT, 9 },
+    // State 138
+    { 138, 1000, PA_SHIFT, 139 },
+    // State 138
+    { 138, 1004, PA_SHIFT, 13 },
+    // State 139
+    { 139, 996, PA_SHIFT, 6 },
+    // State 139
+    { 139, 998, PA_REDUCE, 71 },
+    // State 140
+    { 140, 1, PA_SHIFT, 8 },
+    // State 140
+    { 140, 994, PA_SHIFT, 10 },
+    // State 140
+    { 140, 995, PA_SHIFT, 9 },
+    // State 140
+    { 140, 1000, PA_SHIFT, 141 },
+    // State 140
+    { 140, 1004, PA_SHIFT, 13 },
+    // State 141
+    { 141, 996, PA_SHIFT, 6 },
+    // State 141
+    { 141, 998, PA_REDUCE, 72 },
+    // State 142
+    { 142, 1, PA_SHIFT, 8 },
+    // State 142
+    { 142, 994, PA_SHIFT, 10 },
+    // State 142
+    { 142, 995, PA_SHIFT, 9 },
+    // State 142
+    { 142, 1000, PA_SHIFT, 143 },
+    // State 142
+    { 142, 1004, PA_SHIFT, 13 },
+    // State 143
+    { 143, 996, PA_SHIFT, 6 },
+    // State 143
+    { 143, 998, PA_REDUCE, 73 },
+    // State 144
+    { 144, 1, PA_SHIFT, 8 },
+    // State 144
+    { 144, 994, PA_SHIFT, 10 },
+    // State 144
+    { 144, 995, PA_SHIFT, 9 },
+    // State 144
+    { 144, 1000, PA_SHIFT, 145 },
+    // State 144
+    { 144, 1004, PA_SHIFT, 13 },
+    // State 145
+    { 145, 996, PA_SHIFT, 6 },
+    // State 145
+    { 145, 998, PA_REDUCE, 74 },
+    // State 146
+    { 146, 1, PA_SHIFT, 8 },
+    // State 146
+    { 146, 994, PA_SHIFT, 10 },
+    // State 146
+    { 146, 995, PA_SHIFT, 9 },
+    // State 146
+    { 146, 1000, PA_SHIFT, 147 },
+    // State 146
+    { 146, 1004, PA_SHIFT, 13 },
+    // State 147
+    { 147, 996, PA_SHIFT, 6 },
+    // State 147
+    { 147, 998, PA_REDUCE, 75 },
+    // State 148
+    { 148, 1, PA_SHIFT, 8 },
+    // State 148
+    { 148, 994, PA_SHIFT, 10 },
+    // State 148
+    { 148, 995, PA_SHIFT, 9 },
+    // State 148
+    { 148, 1000, PA_SHIFT, 149 },
+    // State 148
+    { 148, 1004, PA_SHIFT, 13 },
+    // State 149
+    { 149, 996, PA_SHIFT, 6 },
+    // State 149
+    { 149, 998, PA_REDUCE, 76 },
+    // State 150
+    { 150, 1, PA_SHIFT, 8 },
+    // State 150
+    { 150, 994, PA_SHIFT, 10 },
+    // State 150
+    { 150, 995, PA_SHIFT, 9 },
+    // State 150
+    { 150, 1000, PA_SHIFT, 151 },
+    // State 150
+    { 150, 1004, PA_SHIFT, 13 },
+    // State 151
+    { 151, 996, PA_SHIFT, 6 },
+    // State 151
+    { 151, 998, PA_REDUCE, 77 },
+    // State 152
+    { 152, 1, PA_SHIFT, 8 },
+    // State 152
+    { 152, 994, PA_SHIFT, 10 },
+    // State 152
+    { 152, 995, PA_SHIFT, 9 },
+    // State 152
+    { 152, 1000, PA_SHIFT, 153 },
+    // State 152
+    { 152, 1004, PA_SHIFT, 13 },
+    // State 153
+    { 153, 996, PA_SHIFT, 6 },
+    // State 153
+    { 153, 998, PA_REDUCE, 78 },
+    // State 154
+    { 154, 1, PA_SHIFT, 8 },
+    // State 154
+    { 154, 994, PA_SHIFT, 10 },
+    // State 154
+    { 154, 995, PA_SHIFT, 9 },
+    // State 154
+    { 154, 1000, PA_SHIFT, 155 },
+    // State 154
+    { 154, 1004, PA_SHIFT, 13 },
+    // State 155
+    { 155, 996, PA_SHIFT, 6 },
+    // State 155
+    { 155, 998, PA_REDUCE, 79 },
+    // State 156
+    { 156, 1, PA_SHIFT, 8 },
+    // State 156
+    { 156, 994, PA_SHIFT, 10 },
+    // State 156
+    { 156, 995, PA_SHIFT, 9 },
+    // State 156
+    { 156, 1000, PA_SHIFT, 157 },
+    // State 156
+    { 156, 1004, PA_SHIFT, 13 },
+    // State 157
+    { 157, 996, PA_SHIFT, 6 },
+    // State 157
+    { 157, 998, PA_REDUCE, 80 },
+    // State 158
+    { 158, 1, PA_SHIFT, 8 },
+    // State 158
+    { 158, 994, PA_SHIFT, 10 },
+    // State 158
+    { 158, 995, PA_SHIFT, 9 },
+    // State 158
+    { 158, 1000, PA_SHIFT, 159 },
+    // State 158
+    { 158, 1004, PA_SHIFT, 13 },
+    // State 159
+    { 159, 996, PA_SHIFT, 6 },
+    // State 159
+    { 159, 998, PA_REDUCE, 81 },
+    // State 160
+    { 160, 1, PA_SHIFT, 8 },
+    // State 160
+    { 160, 994, PA_SHIFT, 10 },
+    // State 160
+    { 160, 995, PA_SHIFT, 9 },
+    // State 160
+    { 160, 1000, PA_SHIFT, 161 },
+    // State 160
+    { 160, 1004, PA_SHIFT, 13 },
+    // State 161
+    { 161, 996, PA_SHIFT, 6 },
+    // State 161
+    { 161, 998, PA_REDUCE, 82 },
+    // State 162
+    { 162, 1, PA_SHIFT, 8 },
+    // State 162
+    { 162, 994, PA_SHIFT, 10 },
+    // State 162
+    { 162, 995, PA_SHIFT, 9 },
+    // State 162
+    { 162, 1000, PA_SHIFT, 163 },
+    // State 162
+    { 162, 1004, PA_SHIFT, 13 },
+    // State 163
+    { 163, 996, PA_SHIFT, 6 },
+    // State 163
+    { 163, 998, PA_REDUCE, 83 },
+    // State 164
+    { 164, 1, PA_SHIFT, 8 },
+    // State 164
+    { 164, 994, PA_SHIFT, 10 },
+    // State 164
+    { 164, 995, PA_SHIFT, 9 },
+    // State 164
+    { 164, 1000, PA_SHIFT, 165 },
+    // State 164
+    { 164, 1004, PA_SHIFT, 13 },
+    // State 165
+    { 165, 996, PA_SHIFT, 6 },
+    // State 165
+    { 165, 998, PA_REDUCE, 84 },
+    // State 166
+    { 166, 1, PA_SHIFT, 8 },
+    // State 166
+    { 166, 994, PA_SHIFT, 10 },
+    // State 166
+    { 166, 995, PA_SHIFT, 9 },
+    // State 166
+    { 166, 1000, PA_SHIFT, 167 },
+    // State 166
+    { 166, 1004, PA_SHIFT, 13 },
+    // State 167
+    { 167, 996, PA_SHIFT, 6 },
+    // State 167
+    { 167, 998, PA_REDUCE, 85 },
+    // State 168
+    { 168, 1, PA_SHIFT, 8 },
+    // State 168
+    { 168, 994, PA_SHIFT, 10 },
+    // State 168
+    { 168, 995, PA_SHIFT, 9 },
+    // State 168
+    { 168, 1000, PA_SHIFT, 169 },
+    // State 168
+    { 168, 1004, PA_SHIFT, 13 },
+    // State 169
+    { 169, 996, PA_SHIFT, 6 },
+    // State 169
+    { 169, 998, PA_REDUCE, 86 },
+    // State 170
+    { 170, 1, PA_SHIFT, 8 },
+    // State 170
+    { 170, 994, PA_SHIFT, 10 },
+    // State 170
+    { 170, 995, PA_SHIFT, 9 },
+    // State 170
+    { 170, 1000, PA_SHIFT, 171 },
+    // State 170
+    { 170, 1004, PA_SHIFT, 13 },
+    // State 171
+    { 171, 996, PA_SHIFT, 6 },
+    // State 171
+    { 171, 998, PA_REDUCE, 87 },
+    // State 172
+    { 172, 1, PA_SHIFT, 8 },
+    // State 172
+    { 172, 994, PA_SHIFT, 10 },
+    // State 172
+    { 172, 995, PA_SHIFT, 9 },
+    // State 172
+    { 172, 1000, PA_SHIFT, 173 },
+    // State 172
+    { 172, 1004, PA_SHIFT, 13 },
+    // State 173
+    { 173, 996, PA_SHIFT, 6 },
+    // State 173
+    { 173, 998, PA_REDUCE, 88 },
+    // State 174
+    { 174, 1, PA_SHIFT, 8 },
+    // State 174
+    { 174, 994, PA_SHIFT, 10 },
+    // State 174
+    { 174, 995, PA_SHIFT, 9 },
+    // State 174
+    { 174, 1000, PA_SHIFT, 175 },
+    // State 174
+    { 174, 1004, PA_SHIFT, 13 },
+    // State 175
+    { 175, 996, PA_SHIFT, 6 },
+    // State 175
+    { 175, 998, PA_REDUCE, 89 },
+    // State 176
+    { 176, 1, PA_SHIFT, 8 },
+    // State 176
+    { 176, 994, PA_SHIFT, 10 },
+    // State 176
+    { 176, 995, PA_SHIFT, 9 },
+    // State 176
+    { 176, 1000, PA_SHIFT, 177 },
+    // State 176
+    { 176, 1004, PA_SHIFT, 13 },
+    // State 177
+    { 177, 996, PA_SHIFT, 6 },
+    // State 177
+    { 177, 998, PA_REDUCE, 90 },
+    // State 178
+    { 178, 1, PA_SHIFT, 8 },
+    // State 178
+    { 178, 994, PA_SHIFT, 10 },
+    // State 178
+    { 178, 995, PA_SHIFT, 9 },
+    // State 178
+    { 178, 1000, PA_SHIFT, 179 },
+    // State 178
+    { 178, 1004, PA_SHIFT, 13 },
+    // State 179
+    { 179, 996, PA_SHIFT, 6 },
+    // State 179
+    { 179, 998, PA_REDUCE, 91 },
+    // State 180
+    { 180, 1, PA_SHIFT, 8 },
+    // State 180
+    { 180, 994, PA_SHIFT, 10 },
+    // State 180
+    { 180, 995, PA_SHIFT, 9 },
+    // State 180
+    { 180, 1000, PA_SHIFT, 181 },
+    // State 180
+    { 180, 1004, PA_SHIFT, 13 },
+    // State 181
+    { 181, 996, PA_SHIFT, 6 },
+    // State 181
+    { 181, 998, PA_REDUCE, 92 },
+    // State 182
+    { 182, 1, PA_SHIFT, 8 },
+    // State 182
+    { 182, 994, PA_SHIFT, 10 },
+    // State 182
+    { 182, 995, PA_SHIFT, 9 },
+    // State 182
+    { 182, 1000, PA_SHIFT, 183 },
+    // State 182
+    { 182, 1004, PA_SHIFT, 13 },
+    // State 183
+    { 183, 996, PA_SHIFT, 6 },
+    // State 183
+    { 183, 998, PA_REDUCE, 93 },
+    // State 184
+    { 184, 1, PA_SHIFT, 8 },
+    // State 184
+    { 184, 994, PA_SHIFT, 10 },
+    // State 184
+    { 184, 995, PA_SHIFT, 9 },
+    // State 184
+    { 184, 1000, PA_SHIFT, 185 },
+    // State 184
+    { 184, 1004, PA_SHIFT, 13 },
+    // State 185
+    { 185, 996, PA_SHIFT, 6 },
+    // State 185
+    { 185, 998, PA_REDUCE, 94 },
+    // State 186
+    { 186, 1, PA_SHIFT, 8 },
+    // State 186
+    { 186, 994, PA_SHIFT, 10 },
+    // State 186
+    { 186, 995, PA_SHIFT, 9 },
+    // State 186
+    { 186, 1000, PA_SHIFT, 187 },
+    // State 186
+    { 186, 1004, PA_SHIFT, 13 },
+    // State 187
+    { 187, 996, PA_SHIFT, 6 },
+    // State 187
+    { 187, 998, PA_REDUCE, 95 },
+    // State 188
+    { 188, 1, PA_SHIFT, 8 },
+    // State 188
+    { 188, 994, PA_SHIFT, 10 },
+    // State 188
+    { 188, 995, PA_SHIFT, 9 },
+    // State 188
+    { 188, 1000, PA_SHIFT, 189 },
+    // State 188
+    { 188, 1004, PA_SHIFT, 13 },
+    // State 189
+    { 189, 996, PA_SHIFT, 6 },
+    // State 189
+    { 189, 998, PA_REDUCE, 96 },
+    // State 190
+    { 190, 1, PA_SHIFT, 8 },
+    // State 190
+    { 190, 994, PA_SHIFT, 10 },
+    // State 190
+    { 190, 995, PA_SHIFT, 9 },
+    // State 190
+    { 190, 1000, PA_SHIFT, 191 },
+    // State 190
+    { 190, 1004, PA_SHIFT, 13 },
+    // State 191
+    { 191, 996, PA_SHIFT, 6 },
+    // State 191
+    { 191, 998, PA_REDUCE, 97 },
+    // State 192
+    { 192, 1, PA_SHIFT, 8 },
+    // State 192
+    { 192, 994, PA_SHIFT, 10 },
+    // State 192
+    { 192, 995, PA_SHIFT, 9 },
+    // State 192
+    { 192, 1000, PA_SHIFT, 193 },
+    // State 192
+    { 192, 1004, PA_SHIFT, 13 },
+    // State 193
+    { 193, 996, PA_SHIFT, 6 },
+    // State 193
+    { 193, 998, PA_REDUCE, 98 },
+    // State 194
+    { 194, 1, PA_SHIFT, 8 },
+    // State 194
+    { 194, 994, PA_SHIFT, 10 },
+    // State 194
+    { 194, 995, PA_SHIFT, 9 },
+    // State 194
+    { 194, 1000, PA_SHIFT, 195 },
+    // State 194
+    { 194, 1004, PA_SHIFT, 13 },
+    // State 195
+    { 195, 996, PA_SHIFT, 6 },
+    // State 195
+    { 195, 998, PA_REDUCE, 99 },
+    // State 196
+    { 196, 1, PA_SHIFT, 8 },
+    // State 196
+    { 196, 994, PA_SHIFT, 10 },
+    // State 196
+    { 196, 995, PA_SHIFT, 9 },
+    // State 196
+    { 196, 1000, PA_SHIFT, 197 },
+    // State 196
+    { 196, 1004, PA_SHIFT, 13 },
+    // State 197
+    { 197, 996, PA_SHIFT, 6 },
+    // State 197
+    { 197, 998, PA_REDUCE, 100 },
+    // State 198
+    { 198, 1, PA_SHIFT, 8 },
+    // State 198
+    { 198, 994, PA_SHIFT, 10 },
+    // State 198
+    { 198, 995, PA_SHIFT, 9 },
+    // State 198
+    { 198, 1000, PA_SHIFT, 199 },
+    // State 198
+    { 198, 1004, PA_SHIFT, 13 },
+    // State 199
+    { 199, 996, PA_SHIFT, 6 },
+    // State 199
+    { 199, 998, PA_REDUCE, 101 },
+    // State 200
+    { 200, 1, PA_SHIFT, 8 },
+    // State 200
+    { 200, 994, PA_SHIFT, 10 },
+    // State 200
+    { 200, 995, PA_SHIFT, 9 },
+    // State 200
+    { 200, 1000, PA_SHIFT, 201 },
+    // State 200
+    { 200, 1004, PA_SHIFT, 13 },
+    // State 201
+    { 201, 996, PA_SHIFT, 6 },
+    // State 201
+    { 201, 998, PA_REDUCE, 102 },
+    // State 202
+    { 202, 1, PA_SHIFT, 8 },
+    // State 202
+    { 202, 994, PA_SHIFT, 10 },
+    // State 202
+    { 202, 995, PA_SHIFT, 9 },
+    // State 202
+    { 202, 1000, PA_SHIFT, 203 },
+    // State 202
+    { 202, 1004, PA_SHIFT, 13 },
+    // State 203
+    { 203, 996, PA_SHIFT, 6 },
+    // State 203
+    { 203, 998, PA_REDUCE, 103 },
+    // State 204
+    { 204, 1, PA_SHIFT, 8 },
+    // State 204
+    { 204, 994, PA_SHIFT, 10 },
+    // State 204
+    { 204, 995, PA_SHIFT, 9 },
+    // State 204
+    { 204, 1000, PA_SHIFT, 205 },
+    // State 204
+    { 204, 1004, PA_SHIFT, 13 },
+    // State 205
+    { 205, 996, PA_SHIFT, 6 },
+    // State 205
+    { 205, 998, PA_REDUCE, 104 },
+    // State 206
+    { 206, 1, PA_SHIFT, 8 },
+    // State 206
+    { 206, 994, PA_SHIFT, 10 },
+    // State 206
+    { 206, 995, PA_SHIFT, 9 },
+    // State 206
+    { 206, 1000, PA_SHIFT, 207 },
+    // State 206
+    { 206, 1004, PA_SHIFT, 13 },
+    // State 207
+    { 207, 996, PA_SHIFT, 6 },
+    // State 207
+    { 207, 998, PA_REDUCE, 105 },
+    // State 208
+    { 208, 1, PA_SHIFT, 8 },
+    // State 208
+    { 208, 994, PA_SHIFT, 10 },
+    // State 208
+    { 208, 995, PA_SHIFT, 9 },
+    // State 208
+    { 208, 1000, PA_SHIFT, 209 },
+    // State 208
+    { 208, 1004, PA_SHIFT, 13 },
+    // State 209
+    { 209, 996, PA_SHIFT, 6 },
+    // State 209
+    { 209, 998, PA_REDUCE, 106 },
+    // State 210
+    { 210, 1, PA_SHIFT, 8 },
+    // State 210
+    { 210, 994, PA_SHIFT, 10 },
+    // State 210
+    { 210, 995, PA_SHIFT, 9 },
+    // State 210
+    { 210, 1000, PA_SHIFT, 211 },
+    // State 210
+    { 210, 1004, PA_SHIFT, 13 },
+    // State 211
+    { 211, 996, PA_SHIFT, 6 },
+    // State 211
+    { 211, 998, PA_REDUCE, 107 },
+    // State 212
+    { 212, 1, PA_SHIFT, 8 },
+    // State 212
+    { 212, 994, PA_SHIFT, 10 },
+    // State 212
+    { 212, 995, PA_SHIFT, 9 },
+    // State 212
+    { 212, 1000, PA_SHIFT, 213 },
+    // State 212
+    { 212, 1004, PA_SHIFT, 13 },
+    // State 213
+    { 213, 996, PA_SHIFT, 6 },
+    // State 213
+    { 213, 998, PA_REDUCE, 108 },
+    // State 214
+    { 214, 1, PA_SHIFT, 8 },
+    // State 214
+    { 214, 994, PA_SHIFT, 10 },
+    // State 214
+    { 214, 995, PA_SHIFT, 9 },
+    // State 214
+    { 214, 1000, PA_SHIFT, 215 },
+    // State 214
+    { 214, 1004, PA_SHIFT, 13 },
+    // State 215
+    { 215, 996, PA_SHIFT, 6 },
+    // State 215
+    { 215, 998, PA_REDUCE, 109 },
+    // State 216
+    { 216, 1, PA_SHIFT, 8 },
+    // State 216
+    { 216, 994, PA_SHIFT, 10 },
+    // State 216
+    { 216, 995, PA_SHIFT, 9 },
+    // State 216
+    { 216, 1000, PA_SHIFT, 217 },
+    // State 216
+    { 216, 1004, PA_SHIFT, 13 },
+    // State 217
+    { 217, 996, PA_SHIFT, 6 },
+    // State 217
+    { 217, 998, PA_REDUCE, 110 },
+    // State 218
+    { 218, 1, PA_SHIFT, 8 },
+    // State 218
+    { 218, 994, PA_SHIFT, 10 },
+    // State 218
+    { 218, 995, PA_SHIFT, 9 },
+    // State 218
+    { 218, 1000, PA_SHIFT, 219 },
+    // State 218
+    { 218, 1004, PA_SHIFT, 13 },
+    // State 219
+    { 219, 996, PA_SHIFT, 6 },
+    // State 219
+    { 219, 998, PA_REDUCE, 111 },
+    // State 220
+    { 220, 1, PA_SHIFT, 8 },
+    // State 220
+    { 220, 994, PA_SHIFT, 10 },
+    // State 220
+    { 220, 995, PA_SHIFT, 9 },
+    // State 220
+    { 220, 1000, PA_SHIFT, 221 },
+    // State 220
+    { 220, 1004, PA_SHIFT, 13 },
+    // State 221
+    { 221, 996, PA_SHIFT, 6 },
+    // State 221
+    { 221, 998, PA_REDUCE, 112 },
+    // State 222
+    { 222, 1, PA_SHIFT, 8 },
+    // State 222
+    { 222, 994, PA_SHIFT, 10 },
+    // State 222
+    { 222, 995, PA_SHIFT, 9 },
+    // State 222
+    { 222, 1000, PA_SHIFT, 223 },
+    // State 222
+    { 222, 1004, PA_SHIFT, 13 },
+    // State 223
+    { 223, 996, PA_SHIFT, 6 },
+    // State 223
+    { 223, 998, PA_REDUCE, 113 },
+    // State 224
+    { 224, 1, PA_SHIFT, 8 },
+    // State 224
+    { 224, 994, PA_SHIFT, 10 },
+    // State 224
+    { 224, 995, PA_SHIFT, 9 },
+    // State 224
+    { 224, 1000, PA_SHIFT, 225 },
+    // State 224
+    { 224, 1004, PA_SHIFT, 13 },
+    // State 225
+    { 225, 996, PA_SHIFT, 6 },
+    // State 225
+    { 225, 998, PA_REDUCE, 114 },
+    // State 226
+    { 226, 1, PA_SHIFT, 8 },
+    // State 226
+    { 226, 994, PA_SHIFT, 10 },
+    // State 226
+    { 226, 995, PA_SHIFT, 9 },
+    // State 226
+    { 226, 1000, PA_SHIFT, 227 },
+    // State 226
+    { 226, 1004, PA_SHIFT, 13 },
+    // State 227
+    { 227, 996, PA_SHIFT, 6 },
+    // State 227
+    { 227, 998, PA_REDUCE, 115 },
+    // State 228
+    { 228, 1, PA_SHIFT, 8 },
+    // State 228
+    { 228, 994, PA_SHIFT, 10 },
+    // State 228
+    { 228, 995, PA_SHIFT, 9 },
+    // State 228
+    { 228, 1000, PA_SHIFT, 229 },
+    // State 228
+    { 228, 1004, PA_SHIFT, 13 },
+    // State 229
+    { 229, 996, PA_SHIFT, 6 },
+    // State 229
+    { 229, 998, PA_REDUCE, 116 },
+    // State 230
+    { 230, 1, PA_SHIFT, 8 },
+    // State 230
+    { 230, 994, PA_SHIFT, 10 },
+    // State 230
+    { 230, 995, PA_SHIFT, 9 },
+    // State 230
+    { 230, 1000, PA_SHIFT, 231 },
+    // State 230
+    { 230, 1004, PA_SHIFT, 13 },
+    // State 231
+    { 231, 996, PA_SHIFT, 6 },
+    // State 231
+    { 231, 998, PA_REDUCE, 117 },
+    // State 232
+    { 232, 1, PA_SHIFT, 8 },
+    // State 232
+    { 232, 994, PA_SHIFT, 10 },
+    // State 232
+    { 232, 995, PA_SHIFT, 9 },
+    // State 232
+    { 232, 1000, PA_SHIFT, 233 },
+    // State 232
+    { 232, 1004, PA_SHIFT, 13 },
+    // State 233
+    { 233, 996, PA_SHIFT, 6 },
+    // State 233
+    { 233, 998, PA_REDUCE, 118 },
+    // State 234
+    { 234, 1, PA_SHIFT, 8 },
+    // State 234
+    { 234, 994, PA_SHIFT, 10 },
+    // State 234
+    { 234, 995, PA_SHIFT, 9 },
+    // State 234
+    { 234, 1000, PA_SHIFT, 235 },
+    // State 234
+    { 234, 1004, PA_SHIFT, 13 },
+    // State 235
+    { 235, 996, PA_SHIFT, 6 },
+    // State 235
+    { 235, 998, PA_REDUCE, 119 },
+    // State 236
+    { 236, 1, PA_SHIFT, 8 },
+    // State 236
+    { 236, 994, PA_SHIFT, 10 },
+    // State 236
+    { 236, 995, PA_SHIFT, 9 },
+    // State 236
+    { 236, 1000, PA_SHIFT, 237 },
+    // State 236
+    { 236, 1004, PA_SHIFT, 13 },
+    // State 237
+    { 237, 996, PA_SHIFT, 6 },
+    // State 237
+    { 237, 998, PA_REDUCE, 120 },
+    // State 238
+    { 238, 1, PA_SHIFT, 8 },
+    // State 238
+    { 238, 994, PA_SHIFT, 10 },
+    // State 238
+    { 238, 995, PA_SHIFT, 9 },
+    // State 238
+    { 238, 1000, PA_SHIFT, 239 },
+    // State 238
+    { 238, 1004, PA_SHIFT, 13 },
+    // State 239
+    { 239, 996, PA_SHIFT, 6 },
+    // State 239
+    { 239, 998, PA_REDUCE, 121 },
+    // State 240
+    { 240, 1, PA_SHIFT, 8 },
+    // State 240
+    { 240, 994, PA_SHIFT, 10 },
+    // State 240
+    { 240, 995, PA_SHIFT, 9 },
+    // State 240
+    { 240, 1000, PA_SHIFT, 241 },
+    // State 240
+    { 240, 1004, PA_SHIFT, 13 },
+    // State 241
+    { 241, 996, PA_SHIFT, 6 },
+    // State 241
+    { 241, 998, PA_REDUCE, 122 },
+    // State 242
+    { 242, 1, PA_SHIFT, 8 },
+    // State 242
+    { 242, 994, PA_SHIFT, 10 },
+    // State 242
+    { 242, 995, PA_SHIFT, 9 },
+    // State 242
+    { 242, 1000, PA_SHIFT, 243 },
+    // State 242
+    { 242, 1004, PA_SHIFT, 13 },
+    // State 243
+    { 243, 996, PA_SHIFT, 6 },
+    // State 243
+    { 243, 998, PA_REDUCE, 123 },
+    // State 244
+    { 244, 1, PA_SHIFT, 8 },
+    // State 244
+    { 244, 994, PA_SHIFT, 10 },
+    // State 244
+    { 244, 995, PA_SHIFT, 9 },
+    // State 244
+    { 244, 1000, PA_SHIFT, 245 },
+    // State 244
+    { 244, 1004, PA_SHIFT, 13 },
+    // State 245
+    { 245, 996, PA_SHIFT, 6 },
+    // State 245
+    { 245, 998, PA_REDUCE, 124 },
+    // State 246
+    { 246, 1, PA_SHIFT, 8 },
+    // State 246
+    { 246, 994, PA_SHIFT, 10 },
+    // State 246
+    { 246, 995, PA_SHIFT, 9 },
+    // State 246
+    { 246, 1000, PA_SHIFT, 247 },
+    // State 246
+    { 246, 1004, PA_SHIFT, 13 },
+    // State 247
+    { 247, 996, PA_SHIFT, 6 },
+    // State 247
+    { 247, 998, PA_REDUCE, 125 },
+    // State 248
+    { 248, 1, PA_SHIFT, 8 },
+    // State 248
+    { 248, 994, PA_SHIFT, 10 },
+    // State 248
+    { 248, 995, PA_SHIFT, 9 },
+    // State 248
+    { 248, 1000, PA_SHIFT, 249 },
+    // State 248
+    { 248, 1004, PA_SHIFT, 13 },
+    // State 249
+    { 249, 996, PA_SHIFT, 6 },
+    // State 249
+    { 249, 998, PA_REDUCE, 126 },
+    // State 250
+    { 250, 1, PA_SHIFT, 8 },
+    // State 250
+    { 250, 994, PA_SHIFT, 10 },
+    // State 250
+    { 250, 995, PA_SHIFT, 9 },
+    // State 250
+    { 250, 1000, PA_SHIFT, 251 },
+    // State 250
+    { 250, 1004, PA_SHIFT, 13 },
+    // State 251
+    { 251, 996, PA_SHIFT, 6 },
+    // State 251
+    { 251, 998, PA_REDUCE, 127 },
+    // State 252
+    { 252, 1, PA_SHIFT, 8 },
+    // State 252
+    { 252, 994, PA_SHIFT, 10 },
+    // State 252
+    { 252, 995, PA_SHIFT, 9 },
+    // State 252
+    { 252, 1000, PA_SHIFT, 253 },
+    // State 252
+    { 252, 1004, PA_SHIFT, 13 },
+    // State 253
+    { 253, 996, PA_SHIFT, 6 },
+    // State 253
+    { 253, 998, PA_REDUCE, 128 },
+    // State 254
+    { 254, 1, PA_SHIFT, 8 },
+    // State 254
+    { 254, 994, PA_SHIFT, 10 },
+    // State 254
+    { 254, 995, PA_SHIFT, 9 },
+    // State 254
+    { 254, 1000, PA_SHIFT, 255 },
+    // State 254
+    { 254, 1004, PA_SHIFT, 13 },
+    // State 255
+    { 255, 996, PA_SHIFT, 6 },
+    // State 255
+    { 255, 998, PA_REDUCE, 129 },
+    // State 256
+    { 256, 1, PA_SHIFT, 8 },
+    // State 256
+    { 256, 994, PA_SHIFT, 10 },
+    // State 256
+    { 256, 995, PA_SHIFT, 9 },
+    // State 256
+    { 256, 1000, PA_SHIFT, 257 },
+    // State 256
+    { 256, 1004, PA_SHIFT, 13 },
+    // State 257
+    { 257, 996, PA_SHIFT, 6 },
+    // State 257
+    { 257, 998, PA_REDUCE, 130 },
+    // State 258
+    { 258, 1, PA_SHIFT, 8 },
+    // State 258
+    { 258, 994, PA_SHIFT, 10 },
+    // State 258
+    { 258, 995, PA_SHIFT, 9 },
+    // State 258
+    { 258, 1000, PA_SHIFT, 259 },
+    // State 258
+    { 258, 1004, PA_SHIFT, 13 },
+    // State 259
+    { 259, 996, PA_SHIFT, 6 },
+    // State 259
+    { 259, 998, PA_REDUCE, 131 },
+    // State 260
+    { 260, 1, PA_SHIFT, 8 },
+    // State 260
+    { 260, 994, PA_SHIFT, 10 },
+    // State 260
+    { 260, 995, PA_SHIFT, 9 },
+    // State 260
+    { 260, 1000, PA_SHIFT, 261 },
+    // State 260
+    { 260, 1004, PA_SHIFT, 13 },
+    // State 261
+    { 261, 996, PA_SHIFT, 6 },
+    // State 261
+    { 261, 998, PA_REDUCE, 132 },
+    // State 262
+    { 262, 1, PA_SHIFT, 8 },
+    // State 262
+    { 262, 994, PA_SHIFT, 10 },
+    // State 262
+    { 262, 995, PA_SHIFT, 9 },
+    // State 262
+    { 262, 1000, PA_SHIFT, 263 },
+    // State 262
+    { 262, 1004, PA_SHIFT, 13 },
+    // State 263
+    { 263, 996, PA_SHIFT, 6 },
+    // State 263
+    { 263, 998, PA_REDUCE, 133 },
+    // State 264
+    { 264, 1, PA_SHIFT, 8 },
+    // State 264
+    { 264, 994, PA_SHIFT, 10 },
+    // State 264
+    { 264, 995, PA_SHIFT, 9 },
+    // State 264
+    { 264, 1000, PA_SHIFT, 265 },
+    // State 264
+    { 264, 1004, PA_SHIFT, 13 },
+    // State 265
+    { 265, 996, PA_SHIFT, 6 },
+    // State 265
+    { 265, 998, PA_REDUCE, 134 },
+    // State 266
+    { 266, 1, PA_SHIFT, 8 },
+    // State 266
+    { 266, 994, PA_SHIFT, 10 },
+    // State 266
+    { 266, 995, PA_SHIFT, 9 },
+    // State 266
+    { 266, 1000, PA_SHIFT, 267 },
+    // State 266
+    { 266, 1004, PA_SHIFT, 13 },
+    // State 267
+    { 267, 996, PA_SHIFT, 6 },
+    // State 267
+    { 267, 998, PA_REDUCE, 135 },
+    // State 268
+    { 268, 1, PA_SHIFT, 8 },
+    // State 268
+    { 268, 994, PA_SHIFT, 10 },
+    // State 268
+    { 268, 995, PA_SHIFT, 9 },
+    // State 268
+    { 268, 1000, PA_SHIFT, 269 },
+    // State 268
+    { 268, 1004, PA_SHIFT, 13 },
+    // State 269
+    { 269, 996, PA_SHIFT, 6 },
+    // State 269
+    { 269, 998, PA_REDUCE, 136 },
+    // State 270
+    { 270, 1, PA_SHIFT, 8 },
+    // State 270
+    { 270, 994, PA_SHIFT, 10 },
+    // State 270
+    { 270, 995, PA_SHIFT, 9 },
+    // State 270
+    { 270, 1000, PA_SHIFT, 271 },
+    // State 270
+    { 270, 1004, PA_SHIFT, 13 },
+    // State 271
+    { 271, 996, PA_SHIFT, 6 },
+    // State 271
+    { 271, 998, PA_REDUCE, 137 },
+    // State 272
+    { 272, 1, PA_SHIFT, 8 },
+    // State 272
+    { 272, 994, PA_SHIFT, 10 },
+    // State 272
+    { 272, 995, PA_SHIFT, 9 },
+    // State 272
+    { 272, 1000, PA_SHIFT, 273 },
+    // State 272
+    { 272, 1004, PA_SHIFT, 13 },
+    // State 273
+    { 273, 996, PA_SHIFT, 6 },
+    // State 273
+    { 273, 998, PA_REDUCE, 138 },
+    // State 274
+    { 274, 1, PA_SHIFT, 8 },
+    // State 274
+    { 274, 994, PA_SHIFT, 10 },
+    // State 274
+    { 274, 995, PA_SHIFT, 9 },
+    // State 274
+    { 274, 1000, PA_SHIFT, 275 },
+    // State 274
+    { 274, 1004, PA_SHIFT, 13 },
+    // State 275
+    { 275, 996, PA_SHIFT, 6 },
+    // State 275
+    { 275, 998, PA_REDUCE, 139 },
+    // State 276
+    { 276, 1, PA_SHIFT, 8 },
+    // State 276
+    { 276, 994, PA_SHIFT, 10 },
+    // State 276
+    { 276, 995, PA_SHIFT, 9 },
+    // State 276
+    { 276, 1000, PA_SHIFT, 277 },
+    // State 276
+    { 276, 1004, PA_SHIFT, 13 },
+    // State 277
+    { 277, 996, PA_SHIFT, 6 },
+    // State 277
+    { 277, 998, PA_REDUCE, 140 },
+    // State 278
+    { 278, 1, PA_SHIFT, 8 },
+    // State 278
+    { 278, 994, PA_SHIFT, 10 },
+    // State 278
+    { 278, 995, PA_SHIFT, 9 },
+    // State 278
+    { 278, 1000, PA_SHIFT, 279 },
+    // State 278
+    { 278, 1004, PA_SHIFT, 13 },
+    // State 279
+    { 279, 996, PA_SHIFT, 6 },
+    // State 279
+    { 279, 998, PA_REDUCE, 141 },
+    // State 280
+    { 280, 1, PA_SHIFT, 8 },
+    // State 280
+    { 280, 994, PA_SHIFT, 10 },
+    // State 280
+    { 280, 995, PA_SHIFT, 9 },
+    // State 280
+    { 280, 1000, PA_SHIFT, 281 },
+    // State 280
+    { 280, 1004, PA_SHIFT, 13 },
+    // State 281
+    { 281, 996, PA_SHIFT, 6 },
+    // State 281
+    { 281, 998, PA_REDUCE, 142 },
+    // State 282
+    { 282, 1, PA_SHIFT, 8 },
+    // State 282
+    { 282, 994, PA_SHIFT, 10 },
+    // State 282
+    { 282, 995, PA_SHIFT, 9 },
+    // State 282
+    { 282, 1000, PA_SHIFT, 283 },
+    // State 282
+    { 282, 1004, PA_SHIFT, 13 },
+    // State 283
+    { 283, 996, PA_SHIFT, 6 },
+    // State 283
+    { 283, 998, PA_REDUCE, 143 },
+    // State 284
+    { 284, 1, PA_SHIFT, 8 },
+    // State 284
+    { 284, 994, PA_SHIFT, 10 },
+    // State 284
+    { 284, 995, PA_SHIFT, 9 },
+    // State 284
+    { 284, 1000, PA_SHIFT, 285 },
+    // State 284
+    { 284, 1004, PA_SHIFT, 13 },
+    // State 285
+    { 285, 996, PA_SHIFT, 6 },
+    // State 285
+    { 285, 998, PA_REDUCE, 144 },
+    // State 286
+    { 286, 1, PA_SHIFT, 8 },
+    // State 286
+    { 286, 994, PA_SHIFT, 10 },
+    // State 286
+    { 286, 995, PA_SHIFT, 9 },
+    // State 286
+    { 286, 1000, PA_SHIFT, 287 },
+    // State 286
+    { 286, 1004, PA_SHIFT, 13 },
+    // State 287
+    { 287, 996, PA_SHIFT, 6 },
+    // State 287
+    { 287, 998, PA_REDUCE, 145 },
+    // State 288
+    { 288, 1, PA_SHIFT, 8 },
+    // State 288
+    { 288, 994, PA_SHIFT, 10 },
+    // State 288
+    { 288, 995, PA_SHIFT, 9 },
+    // State 288
+    { 288, 1000, PA_SHIFT, 289 },
+    // State 288
+    { 288, 1004, PA_SHIFT, 13 },
+    // State 289
+    { 289, 996, PA_SHIFT, 6 },
+    // State 289
+    { 289, 998, PA_REDUCE, 146 },
+    // State 290
+    { 290, 1, PA_SHIFT, 8 },
+    // State 290
+    { 290, 994, PA_SHIFT, 10 },
+    // State 290
+    { 290, 995, PA_SHIFT, 9 },
+    // State 290
+    { 290, 1000, PA_SHIFT, 291 },
+    // State 290
+    { 290, 1004, PA_SHIFT, 13 },
+    // State 291
+    { 291, 996, PA_SHIFT, 6 },
+    // State 291
+    { 291, 998, PA_REDUCE, 147 },
+    // State 292
+    { 292, 1, PA_SHIFT, 8 },
+    // State 292
+    { 292, 994, PA_SHIFT, 10 },
+    // State 292
+    { 292, 995, PA_SHIFT, 9 },
+    // State 292
+    { 292, 1000, PA_SHIFT, 293 },
+    // State 292
+    { 292, 1004, PA_SHIFT, 13 },
+    // State 293
+    { 293, 996, PA_SHIFT, 6 },
+    // State 293
+    { 293, 998, PA_REDUCE, 148 },
+    // State 294
+    { 294, 1, PA_SHIFT, 8 },
+    // State 294
+    { 294, 994, PA_SHIFT, 10 },
+    // State 294
+    { 294, 995, PA_SHIFT, 9 },
+    // State 294
+    { 294, 1000, PA_SHIFT, 295 },
+    // State 294
+    { 294, 1004, PA_SHIFT, 13 },
+    // State 295
+    { 295, 996, PA_SHIFT, 6 },
+    // State 295
+    { 295, 998, PA_REDUCE, 149 },
+    // State 296
+    { 296, 1, PA_SHIFT, 8 },
+    // State 296
+    { 296, 994, PA_SHIFT, 10 },
+    // State 296
+    { 296, 995, PA_SHIFT, 9 },
+    // State 296
+    { 296, 1000, PA_SHIFT, 297 },
+    // State 296
+    { 296, 1004, PA_SHIFT, 13 },
+    // State 297
+    { 297, 996, PA_SHIFT, 6 },
+    // State 297
+    { 297, 998, PA_REDUCE, 150 },
+    // State 298
+    { 298, 1, PA_SHIFT, 8 },
+    // State 298
+    { 298, 994, PA_SHIFT, 10 },
+    // State 298
+    { 298, 995, PA_SHIFT, 9 },
+    // State 298
+    { 298, 1000, PA_SHIFT, 299 },
+    // State 298
+    { 298, 1004, PA_SHIFT, 13 },
+    // State 299
+    { 299, 996, PA_SHIFT, 6 },
+    // State 299
+    { 299, 998, PA_REDUCE, 151 },
+    // State 300
+    { 300, 1, PA_SHIFT, 8 },
+    // State 300
+    { 300, 994, PA_SHIFT, 10 },
+    // State 300
+    { 300, 995, PA_SHIFT, 9 },
+    // State 300
+    { 300, 1000, PA_SHIFT, 301 },
+    // State 300
+    { 300, 1004, PA_SHIFT, 13 },
+    // State 301
+    { 301, 996, PA_SHIFT, 6 },
+    // State 301
+    { 301, 998, PA_REDUCE, 152 },
+    // State 302
+    { 302, 1, PA_SHIFT, 8 },
+    // State 302
+    { 302, 994, PA_SHIFT, 10 },
+    // State 302
+    { 302, 995, PA_SHIFT, 9 },
+    // State 302
+    { 302, 1000, PA_SHIFT, 303 },
+    // State 302
+    { 302, 1004, PA_SHIFT, 13 },
+    // State 303
+    { 303, 996, PA_SHIFT, 6 },
+    // State 303
+    { 303, 998, PA_REDUCE, 153 },
+    // State 304
+    { 304, 1, PA_SHIFT, 8 },
+    // State 304
+    { 304, 994, PA_SHIFT, 10 },
+    // State 304
+    { 304, 995, PA_SHIFT, 9 },
+    // State 304
+    { 304, 1000, PA_SHIFT, 305 },
+    // State 304
+    { 304, 1004, PA_SHIFT, 13 },
+    // State 305
+    { 305, 996, PA_SHIFT, 6 },
+    // State 305
+    { 305, 998, PA_REDUCE, 154 },
+    // State 306
+    { 306, 1, PA_SHIFT, 8 },
+    // State 306
+    { 306, 994, PA_SHIFT, 10 },
+    // State 306
+    { 306, 995, PA_SHIFT, 9 },
+    // State 306
+    { 306, 1000, PA_SHIFT, 307 },
+    // State 306
+    { 306, 1004, PA_SHIFT, 13 },
+    // State 307
+    { 307, 996, PA_SHIFT, 6 },
+    // State 307
+    { 307, 998, PA_REDUCE, 155 },
+    // State 308
+    { 308, 1, PA_SHIFT, 8 },
+    // State 308
+    { 308, 994, PA_SHIFT, 10 },
+    // State 308
+    { 308, 995, PA_SHIFT, 9 },
+    // State 308
+    { 308, 1000, PA_SHIFT, 309 },
+    // State 308
+    { 308, 1004, PA_SHIFT, 13 },
+    // State 309
+    { 309, 996, PA_SHIFT, 6 },
+    // State 309
+    { 309, 998, PA_REDUCE, 156 },
+    // State 310
+    { 310, 1, PA_SHIFT, 8 },
+    // State 310
+    { 310, 994, PA_SHIFT, 10 },
+    // State 310
+    { 310, 995, PA_SHIFT, 9 },
+    // State 310
+    { 310, 1000, PA_SHIFT, 311 },
+    // State 310
+    { 310, 1004, PA_SHIFT, 13 },
+    // State 311
+    { 311, 996, PA_SHIFT, 6 },
+    // State 311
+    { 311, 998, PA_REDUCE, 157 },
+    // State 312
+    { 312, 1, PA_SHIFT, 8 },
+    // State 312
+    { 312, 994, PA_SHIFT, 10 },
+    // State 312
+    { 312, 995, PA_SHIFT, 9 },
+    // State 312
+    { 312, 1000, PA_SHIFT, 313 },
+    // State 312
+    { 312, 1004, PA_SHIFT, 13 },
+    // State 313
+    { 313, 996, PA_SHIFT, 6 },
+    // State 313
+    { 313, 998, PA_REDUCE, 158 },
+    // State 314
+    { 314, 1, PA_SHIFT, 8 },
+    // State 314
+    { 314, 994, PA_SHIFT, 10 },
+    // State 314
+    { 314, 995, PA_SHIFT, 9 },
+    // State 314
+    { 314, 1000, PA_SHIFT, 315 },
+    // State 314
+    { 314, 1004, PA_SHIFT, 13 },
+    // State 315
+    { 315, 996, PA_SHIFT, 6 },
+    // State 315
+    { 315, 998, PA_REDUCE, 159 },
+    // State 316
+    { 316, 1, PA_SHIFT, 8 },
+    // State 316
+    { 316, 994, PA_SHIFT, 10 },
+    // State 316
+    { 316, 995, PA_SHIFT, 9 },
+    // State 316
+    { 316, 1000, PA_SHIFT, 317 },
+    // State 316
+    { 316, 1004, PA_SHIFT, 13 },
+    // State 317
+    { 317, 996, PA_SHIFT, 6 },
+    // State 317
+    { 317, 998, PA_REDUCE, 160 },
+    // State 318
+    { 318, 1, PA_SHIFT, 8 },
+    // State 318
+    { 318, 994, PA_SHIFT, 10 },
+    // State 318
+    { 318, 995, PA_SHIFT, 9 },
+    // State 318
+    { 318, 1000, PA_SHIFT, 319 },
+    // State 318
+    { 318, 1004, PA_SHIFT, 13 },
+    // State 319
+    { 319, 996, PA_SHIFT, 6 },
+    // State 319
+    { 319, 998, PA_REDUCE, 161 },
+    // State 320
+    { 320, 1, PA_SHIFT, 8 },
+    // State 320
+    { 320, 994, PA_SHIFT, 10 },
+    // State 320
+    { 320, 995, PA_SHIFT, 9 },
+    // State 320
+    { 320, 1000, PA_SHIFT, 321 },
+    // State 320
+    { 320, 1004, PA_SHIFT, 13 },
+    // State 321
+    { 321, 996, PA_SHIFT, 6 },
+    // State 321
+    { 321, 998, PA_REDUCE, 162 },
+    // State 322
+    { 322, 1, PA_SHIFT, 8 },
+    // State 322
+    { 322, 994, PA_SHIFT, 10 },
+    // State 322
+    { 322, 995, PA_SHIFT, 9 },
+    // State 322
+    { 322, 1000, PA_SHIFT, 323 },
+    // State 322
+    { 322, 1004, PA_SHIFT, 13 },
+    // State 323
+    { 323, 996, PA_SHIFT, 6 },
+    // State 323
+    { 323, 998, PA_REDUCE, 163 },
+    // State 324
+    { 324, 1, PA_SHIFT, 8 },
+    // State 324
+    { 324, 994, PA_SHIFT, 10 },
+    // State 324
+    { 324, 995, PA_SHIFT, 9 },
+    // State 324
+    { 324, 1000, PA_SHIFT, 325 },
+    // State 324
+    { 324, 1004, PA_SHIFT, 13 },
+    // State 325
+    { 325, 996, PA_SHIFT, 6 },
+    // State 325
+    { 325, 998, PA_REDUCE, 164 },
+    // State 326
+    { 326, 1, PA_SHIFT, 8 },
+    // State 326
+    { 326, 994, PA_SHIFT, 10 },
+    // State 326
+    { 326, 995, PA_SHIFT, 9 },
+    // State 326
+    { 326, 1000, PA_SHIFT, 327 },
+    // State 326
+    { 326, 1004, PA_SHIFT, 13 },
+    // State 327
+    { 327, 996, PA_SHIFT, 6 },
+    // State 327
+    { 327, 998, PA_REDUCE, 165 },
+    // State 328
+    { 328, 1, PA_SHIFT, 8 },
+    // State 328
+    { 328, 994, PA_SHIFT, 10 },
+    // State 328
+    { 328, 995, PA_SHIFT, 9 },
+    // State 328
+    { 328, 1000, PA_SHIFT, 329 },
+    // State 328
+    { 328, 1004, PA_SHIFT, 13 },
+    // State 329
+    { 329, 996, PA_SHIFT, 6 },
+    // State 329
+    { 329, 998, PA_REDUCE, 166 },
+    // State 330
+    { 330, 1, PA_SHIFT, 8 },
+    // State 330
+    { 330, 994, PA_SHIFT, 10 },
+    // State 330
+    { 330, 995, PA_SHIFT, 9 },
+    // State 330
+    { 330, 1000, PA_SHIFT, 331 },
+    // State 330
+    { 330, 1004, PA_SHIFT, 13 },
+    // State 331
+    { 331, 996, PA_SHIFT, 6 },
+    // State 331
+    { 331, 998, PA_REDUCE, 167 },
+    // State 332
+    { 332, 1, PA_SHIFT, 8 },
+    // State 332
+    { 332, 994, PA_SHIFT, 10 },
+    // State 332
+    { 332, 995, PA_SHIFT, 9 },
+    // State 332
+    { 332, 1000, PA_SHIFT, 333 },
+    // State 332
+    { 332, 1004, PA_SHIFT, 13 },
+    // State 333
+    { 333, 996, PA_SHIFT, 6 },
+    // State 333
+    { 333, 998, PA_REDUCE, 168 },
+    // State 334
+    { 334, 1, PA_SHIFT, 8 },
+    // State 334
+    { 334, 994, PA_SHIFT, 10 },
+    // State 334
+    { 334, 995, PA_SHIFT, 9 },
+    // State 334
+    { 334, 1000, PA_SHIFT, 335 },
+    // State 334
+    { 334, 1004, PA_SHIFT, 13 },
+    // State 335
+    { 335, 996, PA_SHIFT, 6 },
+    // State 335
+    { 335, 998, PA_REDUCE, 169 },
+    // State 336
+    { 336, 1, PA_SHIFT, 8 },
+    // State 336
+    { 336, 994, PA_SHIFT, 10 },
+    // State 336
+    { 336, 995, PA_SHIFT, 9 },
+    // State 336
+    { 336, 1000, PA_SHIFT, 337 },
+    // State 336
+    { 336, 1004, PA_SHIFT, 13 },
+    // State 337
+    { 337, 996, PA_SHIFT, 6 },
+    // State 337
+    { 337, 998, PA_REDUCE, 170 },
+    // State 338
+    { 338, 1, PA_SHIFT, 8 },
+    // State 338
+    { 338, 994, PA_SHIFT, 10 },
+    // State 338
+    { 338, 995, PA_SHIFT, 9 },
+    // State 338
+    { 338, 1000, PA_SHIFT, 339 },
+    // State 338
+    { 338, 1004, PA_SHIFT, 13 },
+    // State 339
+    { 339, 996, PA_SHIFT, 6 },
+    // State 339
+    { 339, 998, PA_REDUCE, 171 },
+    // State 340
+    { 340, 1, PA_SHIFT, 8 },
+    // State 340
+    { 340, 994, PA_SHIFT, 10 },
+    // State 340
+    { 340, 995, PA_SHIFT, 9 },
+    // State 340
+    { 340, 1000, PA_SHIFT, 341 },
+    // State 340
+    { 340, 1004, PA_SHIFT, 13 },
+    // State 341
+    { 341, 996, PA_SHIFT, 6 },
+    // State 341
+    { 341, 998, PA_REDUCE, 172 },
+    // State 342
+    { 342, 1, PA_SHIFT, 8 },
+    // State 342
+    { 342, 994, PA_SHIFT, 10 },
+    // State 342
+    { 342, 995, PA_SHIFT, 9 },
+    // State 342
+    { 342, 1000, PA_SHIFT, 343 },
+    // State 342
+    { 342, 1004, PA_SHIFT, 13 },
+    // State 343
+    { 343, 996, PA_SHIFT, 6 },
+    // State 343
+    { 343, 998, PA_REDUCE, 173 },
+    // State 344
+    { 344, 1, PA_SHIFT, 8 },
+    // State 344
+    { 344, 994, PA_SHIFT, 10 },
+    // State 344
+    { 344, 995, PA_SHIFT, 9 },
+    // State 344
+    { 344, 1000, PA_SHIFT, 345 },
+    // State 344
+    { 344, 1004, PA_SHIFT, 13 },
+    // State 345
+    { 345, 996, PA_SHIFT, 6 },
+    // State 345
+    { 345, 998, PA_REDUCE, 174 },
+    // State 346
+    { 346, 1, PA_SHIFT, 8 },
+    // State 346
+    { 346, 994, PA_SHIFT, 10 },
+    // State 346
+    { 346, 995, PA_SHIFT, 9 },
+    // State 346
+    { 346, 1000, PA_SHIFT, 347 },
+    // State 346
+    { 346, 1004, PA_SHIFT, 13 },
+    // State 347
+    { 347, 996, PA_SHIFT, 6 },
+    // State 347
+    { 347, 998, PA_REDUCE, 175 },
+    // State 348
+    { 348, 1, PA_SHIFT, 8 },
+    // State 348
+    { 348, 994, PA_SHIFT, 10 },
+    // State 348
+    { 348, 995, PA_SHIFT, 9 },
+    // State 348
+    { 348, 1000, PA_SHIFT, 349 },
+    // State 348
+    { 348, 1004, PA_SHIFT, 13 },
+    // State 349
+    { 349, 996, PA_SHIFT, 6 },
+    // State 349
+    { 349, 998, PA_REDUCE, 176 },
+    // State 350
+    { 350, 1, PA_SHIFT, 8 },
+    // State 350
+    { 350, 994, PA_SHIFT, 10 },
+    // State 350
+    { 350, 995, PA_SHIFT, 9 },
+    // State 350
+    { 350, 1000, PA_SHIFT, 351 },
+    // State 350
+    { 350, 1004, PA_SHIFT, 13 },
+    // State 351
+    { 351, 996, PA_SHIFT, 6 },
+    // State 351
+    { 351, 998, PA_REDUCE, 177 },
+    // State 352
+    { 352, 1, PA_SHIFT, 8 },
+    // State 352
+    { 352, 994, PA_SHIFT, 10 },
+    // State 352
+    { 352, 995, PA_SHIFT, 9 },
+    // State 352
+    { 352, 1000, PA_SHIFT, 353 },
+    // State 352
+    { 352, 1004, PA_SHIFT, 13 },
+    // State 353
+    { 353, 996, PA_SHIFT, 6 },
+    // State 353
+    { 353, 998, PA_REDUCE, 178 },
+    // State 354
+    { 354, 1, PA_SHIFT, 8 },
+    // State 354
+    { 354, 994, PA_SHIFT, 10 },
+    // State 354
+    { 354, 995, PA_SHIFT, 9 },
+    // State 354
+    { 354, 1000, PA_SHIFT, 355 },
+    // State 354
+    { 354, 1004, PA_SHIFT, 13 },
+    // State 355
+    { 355, 996, PA_SHIFT, 6 },
+    // State 355
+    { 355, 998, PA_REDUCE, 179 },
+    // State 356
+    { 356, 1, PA_SHIFT, 8 },
+    // State 356
+    { 356, 994, PA_SHIFT, 10 },
+    // State 356
+    { 356, 995, PA_SHIFT, 9 },
+    // State 356
+    { 356, 1000, PA_SHIFT, 357 },
+    // State 356
+    { 356, 1004, PA_SHIFT, 13 },
+    // State 357
+    { 357, 996, PA_SHIFT, 6 },
+    // State 357
+    { 357, 998, PA_REDUCE, 180 },
+    // State 358
+    { 358, 1, PA_SHIFT, 8 },
+    // State 358
+    { 358, 994, PA_SHIFT, 10 },
+    // State 358
+    { 358, 995, PA_SHIFT, 9 },
+    // State 358
+    { 358, 1000, PA_SHIFT, 359 },
+    // State 358
+    { 358, 1004, PA_SHIFT, 13 },
+    // State 359
+    { 359, 996, PA_SHIFT, 6 },
+    // State 359
+    { 359, 998, PA_REDUCE, 181 },
+    // State 360
+    { 360, 1, PA_SHIFT, 8 },
+    // State 360
+    { 360, 994, PA_SHIFT, 10 },
+    // State 360
+    { 360, 995, PA_SHIFT, 9 },
+    // State 360
+    { 360, 1000, PA_SHIFT, 361 },
+    // State 360
+    { 360, 1004, PA_SHIFT, 13 },
+    // State 361
+    { 361, 996, PA_SHIFT, 6 },
+    // State 361
+    { 361, 998, PA_REDUCE, 182 },
+    // State 362
+    { 362, 1, PA_SHIFT, 8 },
+    // State 362
+    { 362, 994, PA_SHIFT, 10 },
+    // State 362
+    { 362, 995, PA_SHIFT, 9 },
+    // State 362
+    { 362, 1000, PA_SHIFT, 363 },
+    // State 362
+    { 362, 1004, PA_SHIFT, 13 },
+    // State 363
+    { 363, 996, PA_SHIFT, 6 },
+    // State 363
+    { 363, 998, PA_REDUCE, 183 },
+    // State 364
+    { 364, 1, PA_SHIFT, 8 },
+    // State 364
+    { 364, 994, PA_SHIFT, 10 },
+    // State 364
+    { 364, 995, PA_SHIFT, 9 },
+    // State 364
+    { 364, 1000, PA_SHIFT, 365 },
+    // State 364
+    { 364, 1004, PA_SHIFT, 13 },
+    // State 365
+    { 365, 996, PA_SHIFT, 6 },
+    // State 365
+    { 365, 998, PA_REDUCE, 184 },
+    // State 366
+    { 366, 1, PA_SHIFT, 8 },
+    // State 366
+    { 366, 994, PA_SHIFT, 10 },
+    // State 366
+    { 366, 995, PA_SHIFT, 9 },
+    // State 366
+    { 366, 1000, PA_SHIFT, 367 },
+    // State 366
+    { 366, 1004, PA_SHIFT, 13 },
+    // State 367
+    { 367, 996, PA_SHIFT, 6 },
+    // State 367
+    { 367, 998, PA_REDUCE, 185 },
+    // State 368
+    { 368, 1, PA_SHIFT, 8 },
+    // State 368
+    { 368, 994, PA_SHIFT, 10 },
+    // State 368
+    { 368, 995, PA_SHIFT, 9 },
+    // State 368
+    { 368, 1000, PA_SHIFT, 369 },
+    // State 368
+    { 368, 1004, PA_SHIFT, 13 },
+    // State 369
+    { 369, 996, PA_SHIFT, 6 },
+    // State 369
+    { 369, 998, PA_REDUCE, 186 },
+    // State 370
+    { 370, 1, PA_SHIFT, 8 },
+    // State 370
+    { 370, 994, PA_SHIFT, 10 },
+    // State 370
+    { 370, 995, PA_SHIFT, 9 },
+    // State 370
+    { 370, 1000, PA_SHIFT, 371 },
+    // State 370
+    { 370, 1004, PA_SHIFT, 13 },
+    // State 371
+    { 371, 996, PA_SHIFT, 6 },
+    // State 371
+    { 371, 998, PA_REDUCE, 187 },
+    // State 372
+    { 372, 1, PA_SHIFT, 8 },
+    // State 372
+    { 372, 994, PA_SHIFT, 10 },
+    // State 372
+    { 372, 995, PA_SHIFT, 9 },
+    // State 372
+    { 372, 1000, PA_SHIFT, 373 },
+    // State 372
+    { 372, 1004, PA_SHIFT, 13 },
+    // State 373
+    { 373, 996, PA_SHIFT, 6 },
+    // State 373
+    { 373, 998, PA_REDUCE, 188 },
+    // State 374
+    { 374, 1, PA_SHIFT, 8 },
+    // State 374
+    { 374, 994, PA_SHIFT, 10 },
+    // State 374
+    { 374, 995, PA_SHIFT, 9 },
+    // State 374
+    { 374, 1000, PA_SHIFT, 375 },
+    // State 374
+    { 374, 1004, PA_SHIFT, 13 },
+    // State 375
+    { 375, 996, PA_SHIFT, 6 },
+    // State 375
+    { 375, 998, PA_REDUCE, 189 },
+    // State 376
+    { 376, 1, PA_SHIFT, 8 },
+    // State 376
+    { 376, 994, PA_SHIFT, 10 },
+    // State 376
+    { 376, 995, PA_SHIFT, 9 },
+    // State 376
+    { 376, 1000, PA_SHIFT, 377 },
+    // State 376
+    { 376, 1004, PA_SHIFT, 13 },
+    // State 377
+    { 377, 996, PA_SHIFT, 6 },
+    // State 377
+    { 377, 998, PA_REDUCE, 190 },
+    // State 378
+    { 378, 1, PA_SHIFT, 8 },
+    // State 378
+    { 378, 994, PA_SHIFT, 10 },
+    // State 378
+    { 378, 995, PA_SHIFT, 9 },
+    // State 378
+    { 378, 1000, PA_SHIFT, 379 },
+    // State 378
+    { 378, 1004, PA_SHIFT, 13 },
+    // State 379
+    { 379, 996, PA_SHIFT, 6 },
+    // State 379
+    { 379, 998, PA_REDUCE, 191 },
+    // State 380
+    { 380, 1, PA_SHIFT, 8 },
+    // State 380
+    { 380, 994, PA_SHIFT, 10 },
+    // State 380
+    { 380, 995, PA_SHIFT, 9 },
+    // State 380
+    { 380, 1000, PA_SHIFT, 381 },
+    // State 380
+    { 380, 1004, PA_SHIFT, 13 },
+    // State 381
+    { 381, 996, PA_SHIFT, 6 },
+    // State 381
+    { 381, 998, PA_REDUCE, 192 },
+    // State 382
+    { 382, 1, PA_SHIFT, 8 },
+    // State 382
+    { 382, 994, PA_SHIFT, 10 },
+    // State 382
+    { 382, 995, PA_SHIFT, 9 },
+    // State 382
+    { 382, 1000, PA_SHIFT, 383 },
+    // State 382
+    { 382, 1004, PA_SHIFT, 13 },
+    // State 383
+    { 383, 996, PA_SHIFT, 6 },
+    // State 383
+    { 383, 998, PA_REDUCE, 193 },
+    // State 384
+    { 384, 1, PA_SHIFT, 8 },
+    // State 384
+    { 384, 994, PA_SHIFT, 10 },
+    // State 384
+    { 384, 995, PA_SHIFT, 9 },
+    // State 384
+    { 384, 1000, PA_SHIFT, 385 },
+    // State 384
+    { 384, 1004, PA_SHIFT, 13 },
+    // State 385
+    { 385, 996, PA_SHIFT, 6 },
+    // State 385
+    { 385, 998, PA_REDUCE, 194 },
+    // State 386
+    { 386, 1, PA_SHIFT, 8 },
+    // State 386
+    { 386, 994, PA_SHIFT, 10 },
+    // State 386
+    { 386, 995, PA_SHIFT, 9 },
+    // State 386
+    { 386, 1000, PA_SHIFT, 387 },
+    // State 386
+    { 386, 1004, PA_SHIFT, 13 },
+    // State 387
+    { 387, 996, PA_SHIFT, 6 },
+    // State 387
+    { 387, 998, PA_REDUCE, 195 },
+    // State 388
+    { 388, 1, PA_SHIFT, 8 },
+    // State 388
+    { 388, 994, PA_SHIFT, 10 },
+    // State 388
+    { 388, 995, PA_SHIFT, 9 },
+    // State 388
+    { 388, 1000, PA_SHIFT, 389 },
+    // State 388
+    { 388, 1004, PA_SHIFT, 13 },
+    // State 389
+    { 389, 996, PA_SHIFT, 6 },
+    // State 389
+    { 389, 998, PA_REDUCE, 196 },
+    // State 390
+    { 390, 1, PA_SHIFT, 8 },
+    // State 390
+    { 390, 994, PA_SHIFT, 10 },
+    // State 390
+    { 390, 995, PA_SHIFT, 9 },
+    // State 390
+    { 390, 1000, PA_SHIFT, 391 },
+    // State 390
+    { 390, 1004, PA_SHIFT, 13 },
+    // State 391
+    { 391, 996, PA_SHIFT, 6 },
+    // State 391
+    { 391, 998, PA_REDUCE, 197 },
+    // State 392
+    { 392, 1, PA_SHIFT, 8 },
+    // State 392
+    { 392, 994, PA_SHIFT, 10 },
+    // State 392
+    { 392, 995, PA_SHIFT, 9 },
+    // State 392
+    { 392, 1000, PA_SHIFT, 393 },
+    // State 392
+    { 392, 1004, PA_SHIFT, 13 },
+    // State 393
+    { 393, 996, PA_SHIFT, 6 },
+    // State 393
+    { 393, 998, PA_REDUCE, 198 },
+    // State 394
+    { 394, 1, PA_SHIFT, 8 },
+    // State 394
+    { 394, 994, PA_SHIFT, 10 },
+    // State 394
+    { 394, 995, PA_SHIFT, 9 },
+    // State 394
+    { 394, 1000, PA_SHIFT, 395 },
+    // State 394
+    { 394, 1004, PA_SHIFT, 13 },
+    // State 395
+    { 395, 996, PA_SHIFT, 6 },
+    // State 395
+    { 395, 998, PA_REDUCE, 199 },
+    // State 396
+    { 396, 1, PA_SHIFT, 8 },
+    // State 396
+    { 396, 994, PA_SHIFT, 10 },
+    // State 396
+    { 396, 995, PA_SHIFT, 9 },
+    // State 396
+    { 396, 1000, PA_SHIFT, 397 },
+    // State 396
+    { 396, 1004, PA_SHIFT, 13 },
+    // State 397
+    { 397, 996, PA_SHIFT, 6 },
+    // State 397
+    { 397, 998, PA_REDUCE, 200 },
+    // State 398
+    { 398, 1, PA_SHIFT, 8 },
+    // State 398
+    { 398, 994, PA_SHIFT, 10 },
+    // State 398
+    { 398, 995, PA_SHIFT, 9 },
+    // State 398
+    { 398, 1000, PA_SHIFT, 399 },
+    // State 398
+    { 398, 1004, PA_SHIFT, 13 },
+    // State 399
+    { 399, 996, PA_SHIFT, 6 },
+    // State 399
+    { 399, 998, PA_REDUCE, 201 },
+    // State 400
+    { 400, 1, PA_SHIFT, 8 },
+    // State 400
+    { 400, 994, PA_SHIFT, 10 },
+    // State 400
+    { 400, 995, PA_SHIFT, 9 },
+    // State 400
+    { 400, 1000, PA_SHIFT, 401 },
+    // State 400
+    { 400, 1004, PA_SHIFT, 13 },
+    // State 401
+    { 401, 996, PA_SHIFT, 6 },
+    // State 401
+    { 401, 998, PA_REDUCE, 202 },
+    // State 402
+    { 402, 1, PA_SHIFT, 8 },
+    // State 402
+    { 402, 994, PA_SHIFT, 10 },
+    // State 402
+    { 402, 995, PA_SHIFT, 9 },
+    // State 402
+    { 402, 1000, PA_SHIFT, 403 },
+    // State 402
+    { 402, 1004, PA_SHIFT, 13 },
+    // State 403
+    { 403, 996, PA_SHIFT, 6 },
+    // State 403
+    { 403, 998, PA_REDUCE, 203 },
+    // State 404
+    { 404, 1, PA_SHIFT, 8 },
+    // State 404
+    { 404, 994, PA_SHIFT, 10 },
+    // State 404
+    { 404, 995, PA_SHIFT, 9 },
+    // State 404
+    { 404, 1000, PA_SHIFT, 405 },
+    // State 404
+    { 404, 1004, PA_SHIFT, 13 },
+    // State 405
+    { 405, 996, PA_SHIFT, 6 },
+    // State 405
+    { 405, 998, PA_REDUCE, 204 },
+    // State 406
+    { 406, 1, PA_SHIFT, 8 },
+    // State 406
+    { 406, 994, PA_SHIFT, 10 },
+    // State 406
+    { 406, 995, PA_SHIFT, 9 },
+    // State 406
+    { 406, 1000, PA_SHIFT, 407 },
+    // State 406
+    { 406, 1004, PA_SHIFT, 13 },
+    // State 407
+    { 407, 996, PA_SHIFT, 6 },
+    // State 407
+    { 407, 998, PA_REDUCE, 205 },
+    // State 408
+    { 408, 1, PA_SHIFT, 8 },
+    // State 408
+    { 408, 994, PA_SHIFT, 10 },
+    // State 408
+    { 408, 995, PA_SHIFT, 9 },
+    // State 408
+    { 408, 1000, PA_SHIFT, 409 },
+    // State 408
+    { 408, 1004, PA_SHIFT, 13 },
+    // State 409
+    { 409, 996, PA_SHIFT, 6 },
+    // State 409
+    { 409, 998, PA_REDUCE, 206 },
+    // State 410
+    { 410, 1, PA_SHIFT, 8 },
+    // State 410
+    { 410, 994, PA_SHIFT, 10 },
+    // State 410
+    { 410, 995, PA_SHIFT, 9 },
+    // State 410
+    { 410, 1000, PA_SHIFT, 411 },
+    // State 410
+    { 410, 1004, PA_SHIFT, 13 },
+    // State 411
+    { 411, 996, PA_SHIFT, 6 },
+    // State 411
+    { 411, 998, PA_REDUCE, 207 },
+    // State 412
+    { 412, 1, PA_SHIFT, 8 },
+    // State 412
+    { 412, 994, PA_SHIFT, 10 },
+    // State 412
+    { 412, 995, PA_SHIFT, 9 },
+    // State 412
+    { 412, 1000, PA_SHIFT, 413 },
+    // State 412
+    { 412, 1004, PA_SHIFT, 13 },
+    // State 413
+    { 413, 996, PA_SHIFT, 6 },
+    // State 413
+    { 413, 998, PA_REDUCE, 208 },
+    // State 414
+    { 414, 1, PA_SHIFT, 8 },
+    // State 414
+    { 414, 994, PA_SHIFT, 10 },
+    // State 414
+    { 414, 995, PA_SHIFT, 9 },
+    // State 414
+    { 414, 1000, PA_SHIFT, 415 },
+    // State 414
+    { 414, 1004, PA_SHIFT, 13 },
+    // State 415
+    { 415, 996, PA_SHIFT, 6 },
+    // State 415
+    { 415, 998, PA_REDUCE, 209 },
+    // State 416
+    { 416, 1, PA_SHIFT, 8 },
+    // State 416
+    { 416, 994, PA_SHIFT, 10 },
+    // State 416
+    { 416, 995, PA_SHIFT, 9 },
+    // State 416
+    { 416, 1000, PA_SHIFT, 417 },
+    // State 416
+    { 416, 1004, PA_SHIFT, 13 },
+    // State 417
+    { 417, 996, PA_SHIFT, 6 },
+    // State 417
+    { 417, 998, PA_REDUCE, 210 },
+    // State 418
+    { 418, 1, PA_SHIFT, 8 },
+    // State 418
+    { 418, 994, PA_SHIFT, 10 },
+    // State 418
+    { 418, 995, PA_SHIFT, 9 },
+    // State 418
+    { 418, 1000, PA_SHIFT, 419 },
+    // State 418
+    { 418, 1004, PA_SHIFT, 13 },
+    // State 419
+    { 419, 996, PA_SHIFT, 6 },
+    // State 419
+    { 419, 998, PA_REDUCE, 211 },
+    // State 420
+    { 420, 1, PA_SHIFT, 8 },
+    // State 420
+    { 420, 994, PA_SHIFT, 10 },
+    // State 420
+    { 420, 995, PA_SHIFT, 9 },
+    // State 420
+    { 420, 1000, PA_SHIFT, 421 },
+    // State 420
+    { 420, 1004, PA_SHIFT, 13 },
+    // State 421
+    { 421, 996, PA_SHIFT, 6 },
+    // State 421
+    { 421, 998, PA_REDUCE, 212 },
+    // State 422
+    { 422, 1, PA_SHIFT, 8 },
+    // State 422
+    { 422, 994, PA_SHIFT, 10 },
+    // State 422
+    { 422, 995, PA_SHIFT, 9 },
+    // State 422
+    { 422, 1000, PA_SHIFT, 423 },
+    // State 422
+    { 422, 1004, PA_SHIFT, 13 },
+    // State 423
+    { 423, 996, PA_SHIFT, 6 },
+    // State 423
+    { 423, 998, PA_REDUCE, 213 },
+    // State 424
+    { 424, 1, PA_SHIFT, 8 },
+    // State 424
+    { 424, 994, PA_SHIFT, 10 },
+    // State 424
+    { 424, 995, PA_SHIFT, 9 },
+    // State 424
+    { 424, 1000, PA_SHIFT, 425 },
+    // State 424
+    { 424, 1004, PA_SHIFT, 13 },
+    // State 425
+    { 425, 996, PA_SHIFT, 6 },
+    // State 425
+    { 425, 998, PA_REDUCE, 214 },
+    // State 426
+    { 426, 1, PA_SHIFT, 8 },
+    // State 426
+    { 426, 994, PA_SHIFT, 10 },
+    // State 426
+    { 426, 995, PA_SHIFT, 9 },
+    // State 426
+    { 426, 1000, PA_SHIFT, 427 },
+    // State 426
+    { 426, 1004, PA_SHIFT, 13 },
+    // State 427
+    { 427, 996, PA_SHIFT, 6 },
+    // State 427
+    { 427, 998, PA_REDUCE, 215 },
+    // State 428
+    { 428, 1, PA_SHIFT, 8 },
+    // State 428
+    { 428, 994, PA_SHIFT, 10 },
+    // State 428
+    { 428, 995, PA_SHIFT, 9 },
+    // State 428
+    { 428, 1000, PA_SHIFT, 429 },
+    // State 428
+    { 428, 1004, PA_SHIFT, 13 },
+    // State 429
+    { 429, 996, PA_SHIFT, 6 },
+    // State 429
+    { 429, 998, PA_REDUCE, 216 },
+    // State 430
+    { 430, 1, PA_SHIFT, 8 },
+    // State 430
+    { 430, 994, PA_SHIFT, 10 },
+    // State 430
+    { 430, 995, PA_SHIFT, 9 },
+    // State 430
+    { 430, 1000, PA_SHIFT, 431 },
+    // State 430
+    { 430, 1004, PA_SHIFT, 13 },
+    // State 431
+    { 431, 996, PA_SHIFT, 6 },
+    // State 431
+    { 431, 998, PA_REDUCE, 217 },
+    // State 432
+    { 432, 1, PA_SHIFT, 8 },
+    // State 432
+    { 432, 994, PA_SHIFT, 10 },
+    // State 432
+    { 432, 995, PA_SHIFT, 9 },
+    // State 432
+    { 432, 1000, PA_SHIFT, 433 },
+    // State 432
+    { 432, 1004, PA_SHIFT, 13 },
+    // State 433
+    { 433, 996, PA_SHIFT, 6 },
+    // State 433
+    { 433, 998, PA_REDUCE, 218 },
+    // State 434
+    { 434, 1, PA_SHIFT, 8 },
+    // State 434
+    { 434, 994, PA_SHIFT, 10 },
+    // State 434
+    { 434, 995, PA_SHIFT, 9 },
+    // State 434
+    { 434, 1000, PA_SHIFT, 435 },
+    // State 434
+    { 434, 1004, PA_SHIFT, 13 },
+    // State 435
+    { 435, 996, PA_SHIFT, 6 },
+    // State 435
+    { 435, 998, PA_REDUCE, 219 },
+    // State 436
+    { 436, 1, PA_SHIFT, 8 },
+    // State 436
+    { 436, 994, PA_SHIFT, 10 },
+    // State 436
+    { 436, 995, PA_SHIFT, 9 },
+    // State 436
+    { 436, 1000, PA_SHIFT, 437 },
+    // State 436
+    { 436, 1004, PA_SHIFT, 13 },
+    // State 437
+    { 437, 996, PA_SHIFT, 6 },
+    // State 437
+    { 437, 998, PA_REDUCE, 220 },
+    // State 438
+    { 438, 1, PA_SHIFT, 8 },
+    // State 438
+    { 438, 994, PA_SHIFT, 10 },
+    // State 438
+    { 438, 995, PA_SHIFT, 9 },
+    // State 438
+    { 438, 1000, PA_SHIFT, 439 },
+    // State 438
+    { 438, 1004, PA_SHIFT, 13 },
+    // State 439
+    { 439, 996, PA_SHIFT, 6 },
+    // State 439
+    { 439, 998, PA_REDUCE, 221 },
+    // State 440
+    { 440, 1, PA_SHIFT, 8 },
+    // State 440
+    { 440, 994, PA_SHIFT, 10 },
+    // State 440
+    { 440, 995, PA_SHIFT, 9 },
+    // State 440
+    { 440, 1000, PA_SHIFT, 441 },
+    // State 440
+    { 440, 1004, PA_SHIFT, 13 },
+    // State 441
+    { 441, 996, PA_SHIFT, 6 },
+    // State 441
+    { 441, 998, PA_REDUCE, 222 },
+    // State 442
+    { 442, 1, PA_SHIFT, 8 },
+    // State 442
+    { 442, 994, PA_SHIFT, 10 },
+    // State 442
+    { 442, 995, PA_SHIFT, 9 },
+    // State 442
+    { 442, 1000, PA_SHIFT, 443 },
+    // State 442
+    { 442, 1004, PA_SHIFT, 13 },
+    // State 443
+    { 443, 996, PA_SHIFT, 6 },
+    // State 443
+    { 443, 998, PA_REDUCE, 223 },
+    // State 444
+    { 444, 1, PA_SHIFT, 8 },
+    // State 444
+    { 444, 994, PA_SHIFT, 10 },
+    // State 444
+    { 444, 995, PA_SHIFT, 9 },
+    // State 444
+    { 444, 1000, PA_SHIFT, 445 },
+    // State 444
+    { 444, 1004, PA_SHIFT, 13 },
+    // State 445
+    { 445, 996, PA_SHIFT, 6 },
+    // State 445
+    { 445, 998, PA_REDUCE, 224 },
+    // State 446
+    { 446, 1, PA_SHIFT, 8 },
+    // State 446
+    { 446, 994, PA_SHIFT, 10 },
+    // State 446
+    { 446, 995, PA_SHIFT, 9 },
+    // State 446
+    { 446, 1000, PA_SHIFT, 447 },
+    // State 446
+    { 446, 1004, PA_SHIFT, 13 },
+    // State 447
+    { 447, 996, PA_SHIFT, 6 },
+    // State 447
+    { 447, 998, PA_REDUCE, 225 },
+    // State 448
+    { 448, 1, PA_SHIFT, 8 },
+    // State 448
+    { 448, 994, PA_SHIFT, 10 },
+    // State 448
+    { 448, 995, PA_SHIFT, 9 },
+    // State 448
+    { 448, 1000, PA_SHIFT, 449 },
+    // State 448
+    { 448, 1004, PA_SHIFT, 13 },
+    // State 449
+    { 449, 996, PA_SHIFT, 6 },
+    // State 449
+    { 449, 998, PA_REDUCE, 226 },
+    // State 450
+    { 450, 1, PA_SHIFT, 8 },
+    // State 450
+    { 450, 994, PA_SHIFT, 10 },
+    // State 450
+    { 450, 995, PA_SHIFT, 9 },
+    // State 450
+    { 450, 1000, PA_SHIFT, 451 },
+    // State 450
+    { 450, 1004, PA_SHIFT, 13 },
+    // State 451
+    { 451, 996, PA_SHIFT, 6 },
+    // State 451
+    { 451, 998, PA_REDUCE, 227 },
+    // State 452
+    { 452, 1, PA_SHIFT, 8 },
+    // State 452
+    { 452, 994, PA_SHIFT, 10 },
+    // State 452
+    { 452, 995, PA_SHIFT, 9 },
+    // State 452
+    { 452, 1000, PA_SHIFT, 453 },
+    // State 452
+    { 452, 1004, PA_SHIFT, 13 },
+    // State 453
+    { 453, 996, PA_SHIFT, 6 },
+    // State 453
+    { 453, 998, PA_REDUCE, 228 },
+    // State 454
+    { 454, 1, PA_SHIFT, 8 },
+    // State 454
+    { 454, 994, PA_SHIFT, 10 },
+    // State 454
+    { 454, 995, PA_SHIFT, 9 },
+    // State 454
+    { 454, 1000, PA_SHIFT, 455 },
+    // State 454
+    { 454, 1004, PA_SHIFT, 13 },
+    // State 455
+    { 455, 996, PA_SHIFT, 6 },
+    // State 455
+    { 455, 998, PA_REDUCE, 229 },
+    // State 456
+    { 456, 1, PA_SHIFT, 8 },
+    // State 456
+    { 456, 994, PA_SHIFT, 10 },
+    // State 456
+    { 456, 995, PA_SHIFT, 9 },
+    // State 456
+    { 456, 1000, PA_SHIFT, 457 },
+    // State 456
+    { 456, 1004, PA_SHIFT, 13 },
+    // State 457
+    { 457, 996, PA_SHIFT, 6 },
+    // State 457
+    { 457, 998, PA_REDUCE, 230 },
+    // State 458
+    { 458, 1, PA_SHIFT, 8 },
+    // State 458
+    { 458, 994, PA_SHIFT, 10 },
+    // State 458
+    { 458, 995, PA_SHIFT, 9 },
+    // State 458
+    { 458, 1000, PA_SHIFT, 459 },
+    // State 458
+    { 458, 1004, PA_SHIFT, 13 },
+    // State 459
+    { 459, 996, PA_SHIFT, 6 },
+    // State 459
+    { 459, 998, PA_REDUCE, 231 },
+    // State 460
+    { 460, 1, PA_SHIFT, 8 },
+    // State 460
+    { 460, 994, PA_SHIFT, 10 },
+    // State 460
+    { 460, 995, PA_SHIFT, 9 },
+    // State 460
+    { 460, 1000, PA_SHIFT, 461 },
+    // State 460
+    { 460, 1004, PA_SHIFT, 13 },
+    // State 461
+    { 461, 996, PA_SHIFT, 6 },
+    // State 461
+    { 461, 998, PA_REDUCE, 232 },
+    // State 462
+    { 462, 1, PA_SHIFT, 8 },
+    // State 462
+    { 462, 994, PA_SHIFT, 10 },
+    // State 462
+    { 462, 995, PA_SHIFT, 9 },
+    // State 462
+    { 462, 1000, PA_SHIFT, 463 },
+    // State 462
+    { 462, 1004, PA_SHIFT, 13 },
+    // State 463
+    { 463, 996, PA_SHIFT, 6 },
+    // State 463
+    { 463, 998, PA_REDUCE, 233 },
+    // State 464
+    { 464, 1, PA_SHIFT, 8 },
+    // State 464
+    { 464, 994, PA_SHIFT, 10 },
+    // State 464
+    { 464, 995, PA_SHIFT, 9 },
+    // State 464
+    { 464, 1000, PA_SHIFT, 465 },
+    // State 464
+    { 464, 1004, PA_SHIFT, 13 },
+    // State 465
+    { 465, 996, PA_SHIFT, 6 },
+    // State 465
+    { 465, 998, PA_REDUCE, 234 },
+    // State 466
+    { 466, 1, PA_SHIFT, 8 },
+    // State 466
+    { 466, 994, PA_SHIFT, 10 },
+    // State 466
+    { 466, 995, PA_SHIFT, 9 },
+    // State 466
+    { 466, 1000, PA_SHIFT, 467 },
+    // State 466
+    { 466, 1004, PA_SHIFT, 13 },
+    // State 467
+    { 467, 996, PA_SHIFT, 6 },
+    // State 467
+    { 467, 998, PA_REDUCE, 235 },
+    // State 468
+    { 468, 1, PA_SHIFT, 8 },
+    // State 468
+    { 468, 994, PA_SHIFT, 10 },
+    // State 468
+    { 468, 995, PA_SHIFT, 9 },
+    // State 468
+    { 468, 1000, PA_SHIFT, 469 },
+    // State 468
+    { 468, 1004, PA_SHIFT, 13 },
+    // State 469
+    { 469, 996, PA_SHIFT, 6 },
+    // State 469
+    { 469, 998, PA_REDUCE, 236 },
+    // State 470
+    { 470, 1, PA_SHIFT, 8 },
+    // State 470
+    { 470, 994, PA_SHIFT, 10 },
+    // State 470
+    { 470, 995, PA_SHIFT, 9 },
+    // State 470
+    { 470, 1000, PA_SHIFT, 471 },
+    // State 470
+    { 470, 1004, PA_SHIFT, 13 },
+    // State 471
+    { 471, 996, PA_SHIFT, 6 },
+    // State 471
+    { 471, 998, PA_REDUCE, 237 },
+    // State 472
+    { 472, 1, PA_SHIFT, 8 },
+    // State 472
+    { 472, 994, PA_SHIFT, 10 },
+    // State 472
+    { 472, 995, PA_SHIFT, 9 },
+    // State 472
+    { 472, 1000, PA_SHIFT, 473 },
+    // State 472
+    { 472, 1004, PA_SHIFT, 13 },
+    // State 473
+    { 473, 996, PA_SHIFT, 6 },
+    // State 473
+    { 473, 998, PA_REDUCE, 238 },
+    // State 474
+    { 474, 1, PA_SHIFT, 8 },
+    // State 474
+    { 474, 994, PA_SHIFT, 10 },
+    // State 474
+    { 474, 995, PA_SHIFT, 9 },
+    // State 474
+    { 474, 1000, PA_SHIFT, 475 },
+    // State 474
+    { 474, 1004, PA_SHIFT, 13 },
+    // State 475
+    { 475, 996, PA_SHIFT, 6 },
+    // State 475
+    { 475, 998, PA_REDUCE, 239 },
+    // State 476
+    { 476, 1, PA_SHIFT, 8 },
+    // State 476
+    { 476, 994, PA_SHIFT, 10 },
+    // State 476
+    { 476, 995, PA_SHIFT, 9 },
+    // State 476
+    { 476, 1000, PA_SHIFT, 477 },
+    // State 476
+    { 476, 1004, PA_SHIFT, 13 },
+    // State 477
+    { 477, 996, PA_SHIFT, 6 },
+    // State 477
+    { 477, 998, PA_REDUCE, 240 },
+    // State 478
+    { 478, 1, PA_SHIFT, 8 },
+    // State 478
+    { 478, 994, PA_SHIFT, 10 },
+    // State 478
+    { 478, 995, PA_SHIFT, 9 },
+    // State 478
+    { 478, 1000, PA_SHIFT, 479 },
+    // State 478
+    { 478, 1004, PA_SHIFT, 13 },
+    // State 479
+    { 479, 996, PA_SHIFT, 6 },
+    // State 479
+    { 479, 998, PA_REDUCE, 241 },
+    // State 480
+    { 480, 1, PA_SHIFT, 8 },
+    // State 480
+    { 480, 994, PA_SHIFT, 10 },
+    // State 480
+    { 480, 995, PA_SHIFT, 9 },
+    // State 480
+    { 480, 1000, PA_SHIFT, 481 },
+    // State 480
+    { 480, 1004, PA_SHIFT, 13 },
+    // State 481
+    { 481, 996, PA_SHIFT, 6 },
+    // State 481
+    { 481, 998, PA_REDUCE, 242 },
+    // State 482
+    { 482, 1, PA_SHIFT, 8 },
+    // State 482
+    { 482, 994, PA_SHIFT, 10 },
+    // State 482
+    { 482, 995, PA_SHIFT, 9 },
+    // State 482
+    { 482, 1000, PA_SHIFT, 483 },
+    // State 482
+    { 482, 1004, PA_SHIFT, 13 },
+    // State 483
+    { 483, 996, PA_SHIFT, 6 },
+    // State 483
+    { 483, 998, PA_REDUCE, 243 },
+    // State 484
+    { 484, 1, PA_SHIFT, 8 },
+    // State 484
+    { 484, 994, PA_SHIFT, 10 },
+    // State 484
+    { 484, 995, PA_SHIFT, 9 },
+    // State 484
+    { 484, 1000, PA_SHIFT, 485 },
+    // State 484
+    { 484, 1004, PA_SHIFT, 13 },
+    // State 485
+    { 485, 996, PA_SHIFT, 6 },
+    // State 485
+    { 485, 998, PA_REDUCE, 244 },
+    // State 486
+    { 486, 1, PA_SHIFT, 8 },
+    // State 486
+    { 486, 994, PA_SHIFT, 10 },
+    // State 486
+    { 486, 995, PA_SHIFT, 9 },
+    // State 486
+    { 486, 1000, PA_SHIFT, 487 },
+    // State 486
+    { 486, 1004, PA_SHIFT, 13 },
+    // State 487
+    { 487, 996, PA_SHIFT, 6 },
+    // State 487
+    { 487, 998, PA_REDUCE, 245 },
+    // State 488
+    { 488, 1, PA_SHIFT, 8 },
+    // State 488
+    { 488, 994, PA_SHIFT, 10 },
+    // State 488
+    { 488, 995, PA_SHIFT, 9 },
+    // State 488
+    { 488, 1000, PA_SHIFT, 489 },
+    // State 488
+    { 488, 1004, PA_SHIFT, 13 },
+    // State 489
+    { 489, 996, PA_SHIFT, 6 },
+    // State 489
+    { 489, 998, PA_REDUCE, 246 },
+    // State 490
+    { 490, 1, PA_SHIFT, 8 },
+    // State 490
+    { 490, 994, PA_SHIFT, 10 },
+    // State 490
+    { 490, 995, PA_SHIFT, 9 },
+    // State 490
+    { 490, 1000, PA_SHIFT, 491 },
+    // State 490
+    { 490, 1004, PA_SHIFT, 13 },
+    // State 491
+    { 491, 996, PA_SHIFT, 6 },
+    // State 491
+    { 491, 998, PA_REDUCE, 247 },
+    // State 492
+    { 492, 1, PA_SHIFT, 8 },
+    // State 492
+    { 492, 994, PA_SHIFT, 10 },
+    // State 492
+    { 492, 995, PA_SHIFT, 9 },
+    // State 492
+    { 492, 1000, PA_SHIFT, 493 },
+    // State 492
+    { 492, 1004, PA_SHIFT, 13 },
+    // State 493
+    { 493, 996, PA_SHIFT, 6 },
+    // State 493
+    { 493, 998, PA_REDUCE, 248 },
+    // State 494
+    { 494, 1, PA_SHIFT, 8 },
+    // State 494
+    { 494, 994, PA_SHIFT, 10 },
+    // State 494
+    { 494, 995, PA_SHIFT, 9 },
+    // State 494
+    { 494, 1000, PA_SHIFT, 495 },
+    // State 494
+    { 494, 1004, PA_SHIFT, 13 },
+    // State 495
+    { 495, 996, PA_SHIFT, 6 },
+    // State 495
+    { 495, 998, PA_REDUCE, 249 },
+    // State 496
+    { 496, 1, PA_SHIFT, 8 },
+    // State 496
+    { 496, 994, PA_SHIFT, 10 },
+    // State 496
+    { 496, 995, PA_SHIFT, 9 },
+    // State 496
+    { 496, 1000, PA_SHIFT, 497 },
+    // State 496
+    { 496, 1004, PA_SHIFT, 13 },
+    // State 497
+    { 497, 996, PA_SHIFT, 6 },
+    // State 497
+    { 497, 998, PA_REDUCE, 250 },
+    // State 498
+    { 498, 1, PA_SHIFT, 8 },
+    // State 498
+    { 498, 994, PA_SHIFT, 10 },
+    // State 498
+    { 498, 995, PA_SHIFT, 9 },
+    // State 498
+    { 498, 1000, PA_SHIFT, 499 },
+    // State 498
+    { 498, 1004, PA_SHIFT, 13 },
+    // State 499
+    { 499, 996, PA_SHIFT, 6 },
+    // State 499
+    { 499, 998, PA_REDUCE, 251 },
+    // State 500
+    { 500, 1, PA_SHIFT, 8 },
+    // State 500
+    { 500, 994, PA_SHIFT, 10 },
+    // State 500
+    { 500, 995, PA_SHIFT, 9 },
+    // State 500
+    { 500, 1000, PA_SHIFT, 501 },
+    // State 500
+    { 500, 1004, PA_SHIFT, 13 },
+    // State 501
+    { 501, 996, PA_SHIFT, 6 },
+    // State 501
+    { 501, 998, PA_REDUCE, 252 },
+    // State 502
+    { 502, 1, PA_SHIFT, 8 },
+    // State 502
+    { 502, 994, PA_SHIFT, 10 },
+    // State 502
+    { 502, 995, PA_SHIFT, 9 },
+    // State 502
+    { 502, 1000, PA_SHIFT, 503 },
+    // State 502
+    { 502, 1004, PA_SHIFT, 13 },
+    // State 503
+    { 503, 996, PA_SHIFT, 6 },
+    // State 503
+    { 503, 998, PA_REDUCE, 253 },
+    // State 504
+    { 504, 1, PA_SHIFT, 8 },
+    // State 504
+    { 504, 994, PA_SHIFT, 10 },
+    // State 504
+    { 504, 995, PA_SHIFT, 9 },
+    // State 504
+    { 504, 1000, PA_SHIFT, 505 },
+    // State 504
+    { 504, 1004, PA_SHIFT, 13 },
+    // State 505
+    { 505, 996, PA_SHIFT, 6 },
+    // State 505
+    { 505, 998, PA_REDUCE, 254 },
+    // State 506
+    { 506, 1, PA_SHIFT, 8 },
+    // State 506
+    { 506, 994, PA_SHIFT, 10 },
+    // State 506
+    { 506, 995, PA_SHIFT, 9 },
+    // State 506
+    { 506, 1000, PA_SHIFT, 507 },
+    // State 506
+    { 506, 1004, PA_SHIFT, 13 },
+    // State 507
+    { 507, 996, PA_SHIFT, 6 },
+    // State 507
+    { 507, 998, PA_REDUCE, 255 },
+    // State 508
+    { 508, 1, PA_SHIFT, 8 },
+    // State 508
+    { 508, 994, PA_SHIFT, 10 },
+    // State 508
+    { 508, 995, PA_SHIFT, 9 },
+    // State 508
+    { 508, 1000, PA_SHIFT, 509 },
+    // State 508
+    { 508, 1004, PA_SHIFT, 13 },
+    // State 509
+    { 509, 996, PA_SHIFT, 6 },
+    // State 509
+    { 509, 998, PA_REDUCE, 256 },
+    // State 510
+    { 510, 1, PA_SHIFT, 8 },
+    // State 510
+    { 510, 994, PA_SHIFT, 10 },
+    // State 510
+    { 510, 995, PA_SHIFT, 9 },
+    // State 510
+    { 510, 1000, PA_SHIFT, 511 },
+    // State 510
+    { 510, 1004, PA_SHIFT, 13 },
+    // State 511
+    { 511, 996, PA_SHIFT, 6 },
+    // State 511
+    { 511, 998, PA_REDUCE, 257 },
+    // State 512
+    { 512, 1, PA_SHIFT, 8 },
+    // State 512
+    { 512, 994, PA_SHIFT, 10 },
+    // State 512
+    { 512, 995, PA_SHIFT, 9 },
+    // State 512
+    { 512, 1000, PA_SHIFT, 513 },
+    // State 512
+    { 512, 1004, PA_SHIFT, 13 },
+    // State 513
+    { 513, 996, PA_SHIFT, 6 },
+    // State 513
+    { 513, 998, PA_REDUCE, 258 },
+    // State 514
+    { 514, 1, PA_SHIFT, 8 },
+    // State 514
+    { 514, 994, PA_SHIFT, 10 },
+    // State 514
+    { 514, 995, PA_SHIFT, 9 },
+    // State 514
+    { 514, 1000, PA_SHIFT, 515 },
+    // State 514
+    { 514, 1004, PA_SHIFT, 13 },
+    // State 515
+    { 515, 996, PA_SHIFT, 6 },
+    // State 515
+    { 515, 998, PA_REDUCE, 259 },
+    // State 516
+    { 516, 1, PA_SHIFT, 8 },
+    // State 516
+    { 516, 994, PA_SHIFT, 10 },
+    // State 516
+    { 516, 995, PA_SHIFT, 9 },
+    // State 516
+    { 516, 1000, PA_SHIFT, 517 },
+    // State 516
+    { 516, 1004, PA_SHIFT, 13 },
+    // State 517
+    { 517, 996, PA_SHIFT, 6 },
+    // State 517
+    { 517, 998, PA_REDUCE, 260 },
+    // State 518
+    { 518, 1, PA_SHIFT, 8 },
+    // State 518
+    { 518, 994, PA_SHIFT, 10 },
+    // State 518
+    { 518, 995, PA_SHIFT, 9 },
+    // State 518
+    { 518, 1000, PA_SHIFT, 519 },
+    // State 518
+    { 518, 1004, PA_SHIFT, 13 },
+    // State 519
+    { 519, 996, PA_SHIFT, 6 },
+    // State 519
+    { 519, 998, PA_REDUCE, 261 },
+    // State 520
+    { 520, 1, PA_SHIFT, 8 },
+    // State 520
+    { 520, 994, PA_SHIFT, 10 },
+    // State 520
+    { 520, 995, PA_SHIFT, 9 },
+    // State 520
+    { 520, 1000, PA_SHIFT, 521 },
+    // State 520
+    { 520, 1004, PA_SHIFT, 13 },
+    // State 521
+    { 521, 996, PA_SHIFT, 6 },
+    // State 521
+    { 521, 998, PA_REDUCE, 262 },
+    // State 522
+    { 522, 1, PA_SHIFT, 8 },
+    // State 522
+    { 522, 994, PA_SHIFT, 10 },
+    // State 522
+    { 522, 995, PA_SHIFT, 9 },
+    // State 522
+    { 522, 1000, PA_SHIFT, 523 },
+    // State 522
+    { 522, 1004, PA_SHIFT, 13 },
+    // State 523
+    { 523, 996, PA_SHIFT, 6 },
+    // State 523
+    { 523, 998, PA_REDUCE, 263 },
+    // State 524
+    { 524, 1, PA_SHIFT, 8 },
+    // State 524
+    { 524, 994, PA_SHIFT, 10 },
+    // State 524
+    { 524, 995, PA_SHIFT, 9 },
+    // State 524
+    { 524, 1000, PA_SHIFT, 525 },
+    // State 524
+    { 524, 1004, PA_SHIFT, 13 },
+    // State 525
+    { 525, 996, PA_SHIFT, 6 },
+    // State 525
+    { 525, 998, PA_REDUCE, 264 },
+    // State 526
+    { 526, 1, PA_SHIFT, 8 },
+    // State 526
+    { 526, 994, PA_SHIFT, 10 },
+    // State 526
+    { 526, 995, PA_SHIFT, 9 },
+    // State 526
+    { 526, 1000, PA_SHIFT, 527 },
+    // State 526
+    { 526, 1004, PA_SHIFT, 13 },
+    // State 527
+    { 527, 996, PA_SHIFT, 6 },
+    // State 527
+    { 527, 998, PA_REDUCE, 265 },
+    // State 528
+    { 528, 1, PA_SHIFT, 8 },
+    // State 528
+    { 528, 994, PA_SHIFT, 10 },
+    // State 528
+    { 528, 995, PA_SHIFT, 9 },
+    // State 528
+    { 528, 1000, PA_SHIFT, 529 },
+    // State 528
+    { 528, 1004, PA_SHIFT, 13 },
+    // State 529
+    { 529, 996, PA_SHIFT, 6 },
+    // State 529
+    { 529, 998, PA_REDUCE, 266 },
+    // State 530
+    { 530, 1, PA_SHIFT, 8 },
+    // State 530
+    { 530, 994, PA_SHIFT, 10 },
+    // State 530
+    { 530, 995, PA_SHIFT, 9 },
+    // State 530
+    { 530, 1000, PA_SHIFT, 531 },
+    // State 530
+    { 530, 1004, PA_SHIFT, 13 },
+    // State 531
+    { 531, 996, PA_SHIFT, 6 },
+    // State 531
+    { 531, 998, PA_REDUCE, 267 },
+    // State 532
+    { 532, 1, PA_SHIFT, 8 },
+    // State 532
+    { 532, 994, PA_SHIFT, 10 },
+    // State 532
+    { 532, 995, PA_SHIFT, 9 },
+    // State 532
+    { 532, 1000, PA_SHIFT, 533 },
+    // State 532
+    { 532, 1004, PA_SHIFT, 13 },
+    // State 533
+    { 533, 996, PA_SHIFT, 6 },
+    // State 533
+    { 533, 998, PA_REDUCE, 268 },
+    // State 534
+    { 534, 1, PA_SHIFT, 8 },
+    // State 534
+    { 534, 994, PA_SHIFT, 10 },
+    // State 534
+    { 534, 995, PA_SHIFT, 9 },
+    // State 534
+    { 534, 1000, PA_SHIFT, 535 },
+    // State 534
+    { 534, 1004, PA_SHIFT, 13 },
+    // State 535
+    { 535, 996, PA_SHIFT, 6 },
+    // State 535
+    { 535, 998, PA_REDUCE, 269 },
+    // State 536
+    { 536, 1, PA_SHIFT, 8 },
+    // State 536
+    { 536, 994, PA_SHIFT, 10 },
+    // State 536
+    { 536, 995, PA_SHIFT, 9 },
+    // State 536
+    { 536, 1000, PA_SHIFT, 537 },
+    // State 536
+    { 536, 1004, PA_SHIFT, 13 },
+    // State 537
+    { 537, 996, PA_SHIFT, 6 },
+    // State 537
+    { 537, 998, PA_REDUCE, 270 },
+    // State 538
+    { 538, 1, PA_SHIFT, 8 },
+    // State 538
+    { 538, 994, PA_SHIFT, 10 },
+    // State 538
+    { 538, 995, PA_SHIFT, 9 },
+    // State 538
+    { 538, 1000, PA_SHIFT, 539 },
+    // State 538
+    { 538, 1004, PA_SHIFT, 13 },
+    // State 539
+    { 539, 996, PA_SHIFT, 6 },
+    // State 539
+    { 539, 998, PA_REDUCE, 271 },
+    // State 540
+    { 540, 1, PA_SHIFT, 8 },
+    // State 540
+    { 540, 994, PA_SHIFT, 10 },
+    // State 540
+    { 540, 995, PA_SHIFT, 9 },
+    // State 540
+    { 540, 1000, PA_SHIFT, 541 },
+    // State 540
+    { 540, 1004, PA_SHIFT, 13 },
+    // State 541
+    { 541, 996, PA_SHIFT, 6 },
+    // State 541
+    { 541, 998, PA_REDUCE, 272 },
+    // State 542
+    { 542, 1, PA_SHIFT, 8 },
+    // State 542
+    { 542, 994, PA_SHIFT, 10 },
+    // State 542
+    { 542, 995, PA_SHIFT, 9 },
+    // State 542
+    { 542, 1000, PA_SHIFT, 543 },
+    // State 542
+    { 542, 1004, PA_SHIFT, 13 },
+    // State 543
+    { 543, 996, PA_SHIFT, 6 },
+    // State 543
+    { 543, 998, PA_REDUCE, 273 },
+    // State 544
+    { 544, 1, PA_SHIFT, 8 },
+    // State 544
+    { 544, 994, PA_SHIFT, 10 },
+    // State 544
+    { 544, 995, PA_SHIFT, 9 },
+    // State 544
+    { 544, 1000, PA_SHIFT, 545 },
+    // State 544
+    { 544, 1004, PA_SHIFT, 13 },
+    // State 545
+    { 545, 996, PA_SHIFT, 6 },
+    // State 545
+    { 545, 998, PA_REDUCE, 274 },
+    // State 546
+    { 546, 1, PA_SHIFT, 8 },
+    // State 546
+    { 546, 994, PA_SHIFT, 10 },
+    // State 546
+    { 546, 995, PA_SHIFT, 9 },
+    // State 546
+    { 546, 1000, PA_SHIFT, 547 },
+    // State 546
+    { 546, 1004, PA_SHIFT, 13 },
+    // State 547
+    { 547, 996, PA_SHIFT, 6 },
+    // State 547
+    { 547, 998, PA_REDUCE, 275 },
+    // State 548
+    { 548, 1, PA_SHIFT, 8 },
+    // State 548
+    { 548, 994, PA_SHIFT, 10 },
+    // State 548
+    { 548, 995, PA_SHIFT, 9 },
+    // State 548
+    { 548, 1000, PA_SHIFT, 549 },
+    // State 548
+    { 548, 1004, PA_SHIFT, 13 },
+    // State 549
+    { 549, 996, PA_SHIFT, 6 },
+    // State 549
+    { 549, 998, PA_REDUCE, 276 },
+    // State 550
+    { 550, 1, PA_SHIFT, 8 },
+    // State 550
+    { 550, 994, PA_SHIFT, 10 },
+    // State 550
+    { 550, 995, PA_SHIFT, 9 },
+    // State 550
+    { 550, 1000, PA_SHIFT, 551 },
+    // State 550
+    { 550, 1004, PA_SHIFT, 13 },
+    // State 551
+    { 551, 996, PA_SHIFT, 6 },
+    // State 551
+    { 551, 998, PA_REDUCE, 277 },
+    // State 552
+    { 552, 1, PA_SHIFT, 8 },
+    // State 552
+    { 552, 994, PA_SHIFT, 10 },
+    // State 552
+    { 552, 995, PA_SHIFT, 9 },
+    // State 552
+    { 552, 1000, PA_SHIFT, 553 },
+    // State 552
+    { 552, 1004, PA_SHIFT, 13 },
+    // State 553
+    { 553, 996, PA_SHIFT, 6 },
+    // State 553
+    { 553, 998, PA_REDUCE, 278 },
+    // State 554
+    { 554, 1, PA_SHIFT, 8 },
+    // State 554
+    { 554, 994, PA_SHIFT, 10 },
+    // State 554
+    { 554, 995, PA_SHIFT, 9 },
+    // State 554
+    { 554, 1000, PA_SHIFT, 555 },
+    // State 554
+    { 554, 1004, PA_SHIFT, 13 },
+    // State 555
+    { 555, 996, PA_SHIFT, 6 },
+    // State 555
+    { 555, 998, PA_REDUCE, 279 },
+    // State 556
+    { 556, 1, PA_SHIFT, 8 },
+    // State 556
+    { 556, 994, PA_SHIFT, 10 },
+    // State 556
+    { 556, 995, PA_SHIFT, 9 },
+    // State 556
+    { 556, 1000, PA_SHIFT, 557 },
+    // State 556
+    { 556, 1004, PA_SHIFT, 13 },
+    // State 557
+    { 557, 996, PA_SHIFT, 6 },
+    // State 557
+    { 557, 998, PA_REDUCE, 280 },
+    // State 558
+    { 558, 1, PA_SHIFT, 8 },
+    // State 558
+    { 558, 994, PA_SHIFT, 10 },
+    // State 558
+    { 558, 995, PA_SHIFT, 9 },
+    // State 558
+    { 558, 1000, PA_SHIFT, 559 },
+    // State 558
+    { 558, 1004, PA_SHIFT, 13 },
+    // State 559
+    { 559, 996, PA_SHIFT, 6 },
+    // State 559
+    { 559, 998, PA_REDUCE, 281 },
+    // State 560
+    { 560, 1, PA_SHIFT, 8 },
+    // State 560
+    { 560, 994, PA_SHIFT, 10 },
+    // State 560
+    { 560, 995, PA_SHIFT, 9 },
+    // State 560
+    { 560, 1000, PA_SHIFT, 561 },
+    // State 560
+    { 560, 1004, PA_SHIFT, 13 },
+    // State 561
+    { 561, 996, PA_SHIFT, 6 },
+    // State 561
+    { 561, 998, PA_REDUCE, 282 },
+    // State 562
+    { 562, 1, PA_SHIFT, 8 },
+    // State 562
+    { 562, 994, PA_SHIFT, 10 },
+    // State 562
+    { 562, 995, PA_SHIFT, 9 },
+    // State 562
+    { 562, 1000, PA_SHIFT, 563 },
+    // State 562
+    { 562, 1004, PA_SHIFT, 13 },
+    // State 563
+    { 563, 996, PA_SHIFT, 6 },
+    // State 563
+    { 563, 998, PA_REDUCE, 283 },
+    // State 564
+    { 564, 1, PA_SHIFT, 8 },
+    // State 564
+    { 564, 994, PA_SHIFT, 10 },
+    // State 564
+    { 564, 995, PA_SHIFT, 9 },
+    // State 564
+    { 564, 1000, PA_SHIFT, 565 },
+    // State 564
+    { 564, 1004, PA_SHIFT, 13 },
+    // State 565
+    { 565, 996, PA_SHIFT, 6 },
+    // State 565
+    { 565, 998, PA_REDUCE, 284 },
+    // State 566
+    { 566, 1, PA_SHIFT, 8 },
+    // State 566
+    { 566, 994, PA_SHIFT, 10 },
+    // State 566
+    { 566, 995, PA_SHIFT, 9 },
+    // State 566
+    { 566, 1000, PA_SHIFT, 567 },
+    // State 566
+    { 566, 1004, PA_SHIFT, 13 },
+    // State 567
+    { 567, 996, PA_SHIFT, 6 },
+    // State 567
+    { 567, 998, PA_REDUCE, 285 },
+    // State 568
+    { 568, 1, PA_SHIFT, 8 },
+    // State 568
+    { 568, 994, PA_SHIFT, 10 },
+    // State 568
+    { 568, 995, PA_SHIFT, 9 },
+    // State 568
+    { 568, 1000, PA_SHIFT, 569 },
+    // State 568
+    { 568, 1004, PA_SHIFT, 13 },
+    // State 569
+    { 569, 996, PA_SHIFT, 6 },
+    // State 569
+    { 569, 998, PA_REDUCE, 286 },
+    // State 570
+    { 570, 1, PA_SHIFT, 8 },
+    // State 570
+    { 570, 994, PA_SHIFT, 10 },
+    // State 570
+    { 570, 995, PA_SHIFT, 9 },
+    // State 570
+    { 570, 1000, PA_SHIFT, 571 },
+    // State 570
+    { 570, 1004, PA_SHIFT, 13 },
+    // State 571
+    { 571, 996, PA_SHIFT, 6 },
+    // State 571
+    { 571, 998, PA_REDUCE, 287 },
+    // State 572
+    { 572, 1, PA_SHIFT, 8 },
+    // State 572
+    { 572, 994, PA_SHIFT, 10 },
+    // State 572
+    { 572, 995, PA_SHIFT, 9 },
+    // State 572
+    { 572, 1000, PA_SHIFT, 573 },
+    // State 572
+    { 572, 1004, PA_SHIFT, 13 },
+    // State 573
+    { 573, 996, PA_SHIFT, 6 },
+    // State 573
+    { 573, 998, PA_REDUCE, 288 },
+    // State 574
+    { 574, 1, PA_SHIFT, 8 },
+    // State 574
+    { 574, 994, PA_SHIFT, 10 },
+    // State 574
+    { 574, 995, PA_SHIFT, 9 },
+    // State 574
+    { 574, 1000, PA_SHIFT, 575 },
+    // State 574
+    { 574, 1004, PA_SHIFT, 13 },
+    // State 575
+    { 575, 996, PA_SHIFT, 6 },
+    // State 575
+    { 575, 998, PA_REDUCE, 289 },
+    // State 576
+    { 576, 1, PA_SHIFT, 8 },
+    // State 576
+    { 576, 994, PA_SHIFT, 10 },
+    // State 576
+    { 576, 995, PA_SHIFT, 9 },
+    // State 576
+    { 576, 1000, PA_SHIFT, 577 },
+    // State 576
+    { 576, 1004, PA_SHIFT, 13 },
+    // State 577
+    { 577, 996, PA_SHIFT, 6 },
+    // State 577
+    { 577, 998, PA_REDUCE, 290 },
+    // State 578
+    { 578, 1, PA_SHIFT, 8 },
+    // State 578
+    { 578, 994, PA_SHIFT, 10 },
+    // State 578
+    { 578, 995, PA_SHIFT, 9 },
+    // State 578
+    { 578, 1000, PA_SHIFT, 579 },
+    // State 578
+    { 578, 1004, PA_SHIFT, 13 },
+    // State 579
+    { 579, 996, PA_SHIFT, 6 },
+    // State 579
+    { 579, 998, PA_REDUCE, 291 },
+    // State 580
+    { 580, 1, PA_SHIFT, 8 },
+    // State 580
+    { 580, 994, PA_SHIFT, 10 },
+    // State 580
+    { 580, 995, PA_SHIFT, 9 },
+    // State 580
+    { 580, 1000, PA_SHIFT, 581 },
+    // State 580
+    { 580, 1004, PA_SHIFT, 13 },
+    // State 581
+    { 581, 996, PA_SHIFT, 6 },
+    // State 581
+    { 581, 998, PA_REDUCE, 292 },
+    // State 582
+    { 582, 1, PA_SHIFT, 8 },
+    // State 582
+    { 582, 994, PA_SHIFT, 10 },
+    // State 582
+    { 582, 995, PA_SHIFT, 9 },
+    // State 582
+    { 582, 1000, PA_SHIFT, 583 },
+    // State 582
+    { 582, 1004, PA_SHIFT, 13 },
+    // State 583
+    { 583, 996, PA_SHIFT, 6 },
+    // State 583
+    { 583, 998, PA_REDUCE, 293 },
+    // State 584
+    { 584, 1, PA_SHIFT, 8 },
+    // State 584
+    { 584, 994, PA_SHIFT, 10 },
+    // State 584
+    { 584, 995, PA_SHIFT, 9 },
+    // State 584
+    { 584, 1000, PA_SHIFT, 585 },
+    // State 584
+    { 584, 1004, PA_SHIFT, 13 },
+    // State 585
+    { 585, 996, PA_SHIFT, 6 },
+    // State 585
+    { 585, 998, PA_REDUCE, 294 },
+    // State 586
+    { 586, 1, PA_SHIFT, 8 },
+    // State 586
+    { 586, 994, PA_SHIFT, 10 },
+    // State 586
+    { 586, 995, PA_SHIFT, 9 },
+    // State 586
+    { 586, 1000, PA_SHIFT, 587 },
+    // State 586
+    { 586, 1004, PA_SHIFT, 13 },
+    // State 587
+    { 587, 996, PA_SHIFT, 6 },
+    // State 587
+    { 587, 998, PA_REDUCE, 295 },
+    // State 588
+    { 588, 1, PA_SHIFT, 8 },
+    // State 588
+    { 588, 994, PA_SHIFT, 10 },
+    // State 588
+    { 588, 995, PA_SHIFT, 9 },
+    // State 588
+    { 588, 1000, PA_SHIFT, 589 },
+    // State 588
+    { 588, 1004, PA_SHIFT, 13 },
+    // State 589
+    { 589, 996, PA_SHIFT, 6 },
+    // State 589
+    { 589, 998, PA_REDUCE, 296 },
+    // State 590
+    { 590, 1, PA_SHIFT, 8 },
+    // State 590
+    { 590, 994, PA_SHIFT, 10 },
+    // State 590
+    { 590, 995, PA_SHIFT, 9 },
+    // State 590
+    { 590, 1000, PA_SHIFT, 591 },
+    // State 590
+    { 590, 1004, PA_SHIFT, 13 },
+    // State 591
+    { 591, 996, PA_SHIFT, 6 },
+    // State 591
+    { 591, 998, PA_REDUCE, 297 },
+    // State 592
+    { 592, 1, PA_SHIFT, 8 },
+    // State 592
+    { 592, 994, PA_SHIFT, 10 },
+    // State 592
+    { 592, 995, PA_SHIFT, 9 },
+    // State 592
+    { 592, 1000, PA_SHIFT, 593 },
+    // State 592
+    { 592, 1004, PA_SHIFT, 13 },
+    // State 593
+    { 593, 996, PA_SHIFT, 6 },
+    // State 593
+    { 593, 998, PA_REDUCE, 298 },
+    // State 594
+    { 594, 1, PA_SHIFT, 8 },
+    // State 594
+    { 594, 994, PA_SHIFT, 10 },
+    // State 594
+    { 594, 995, PA_SHIFT, 9 },
+    // State 594
+    { 594, 1000, PA_SHIFT, 595 },
+    // State 594
+    { 594, 1004, PA_SHIFT, 13 },
+    // State 595
+    { 595, 996, PA_SHIFT, 6 },
+    // State 595
+    { 595, 998, PA_REDUCE, 299 },
+    // State 596
+    { 596, 1, PA_SHIFT, 8 },
+    // State 596
+    { 596, 994, PA_SHIFT, 10 },
+    // State 596
+    { 596, 995, PA_SHIFT, 9 },
+    // State 596
+    { 596, 1000, PA_SHIFT, 597 },
+    // State 596
+    { 596, 1004, PA_SHIFT, 13 },
+    // State 597
+    { 597, 996, PA_SHIFT, 6 },
+    // State 597
+    { 597, 998, PA_REDUCE, 300 },
+    // State 598
+    { 598, 1, PA_SHIFT, 8 },
+    // State 598
+    { 598, 994, PA_SHIFT, 10 },
+    // State 598
+    { 598, 995, PA_SHIFT, 9 },
+    // State 598
+    { 598, 1000, PA_SHIFT, 599 },
+    // State 598
+    { 598, 1004, PA_SHIFT, 13 },
+    // State 599
+    { 599, 996, PA_SHIFT, 6 },
+    // State 599
+    { 599, 998, PA_REDUCE, 301 },
+    // State 600
+    { 600, 1, PA_SHIFT, 8 },
+    // State 600
+    { 600, 994, PA_SHIFT, 10 },
+    // State 600
+    { 600, 995, PA_SHIFT, 9 },
+    // State 600
+    { 600, 1000, PA_SHIFT, 601 },
+    // State 600
+    { 600, 1004, PA_SHIFT, 13 },
+    // State 601
+    { 601, 996, PA_SHIFT, 6 },
+    // State 601
+    { 601, 998, PA_REDUCE, 302 },
+    // State 602
+    { 602, 1, PA_SHIFT, 8 },
+    // State 602
+    { 602, 994, PA_SHIFT, 10 },
+    // State 602
+    { 602, 995, PA_SHIFT, 9 },
+    // State 602
+    { 602, 1000, PA_SHIFT, 603 },
+    // State 602
+    { 602, 1004, PA_SHIFT, 13 },
+    // State 603
+    { 603, 996, PA_SHIFT, 6 },
+    // State 603
+    { 603, 998, PA_REDUCE, 303 },
+    // State 604
+    { 604, 1, PA_SHIFT, 8 },
+    // State 604
+    { 604, 994, PA_SHIFT, 10 },
+    // State 604
+    { 604, 995, PA_SHIFT, 9 },
+    // State 604
+    { 604, 1000, PA_SHIFT, 605 },
+    // State 604
+    { 604, 1004, PA_SHIFT, 13 },
+    // State 605
+    { 605, 996, PA_SHIFT, 6 },
+    // State 605
+    { 605, 998, PA_REDUCE, 304 },
+    // State 606
+    { 606, 1, PA_SHIFT, 8 },
+    // State 606
+    { 606, 994, PA_SHIFT, 10 },
+    // State 606
+    { 606, 995, PA_SHIFT, 9 },
+    // State 606
+    { 606, 1000, PA_SHIFT, 607 },
+    // State 606
+    { 606, 1004, PA_SHIFT, 13 },
+    // State 607
+    { 607, 996, PA_SHIFT, 6 },
+    // State 607
+    { 607, 998, PA_REDUCE, 305 },
+    // State 608
+    { 608, 1, PA_SHIFT, 8 },
+    // State 608
+    { 608, 994, PA_SHIFT, 10 },
+    // State 608
+    { 608, 995, PA_SHIFT, 9 },
+    // State 608
+    { 608, 1000, PA_SHIFT, 609 },
+    // State 608
+    { 608, 1004, PA_SHIFT, 13 },
+    // State 609
+    { 609, 996, PA_SHIFT, 6 },
+    // State 609
+    { 609, 998, PA_REDUCE, 306 },
+    // State 610
+    { 610, 1, PA_SHIFT, 8 },
+    // State 610
+    { 610, 994, PA_SHIFT, 10 },
+    // State 610
+    { 610, 995, PA_SHIFT, 9 },
+    // State 610
+    { 610, 1000, PA_SHIFT, 611 },
+    // State 610
+    { 610, 1004, PA_SHIFT, 13 },
+    // State 611
+    { 611, 996, PA_SHIFT, 6 },
+    // State 611
+    { 611, 998, PA_REDUCE, 307 },
+    // State 612
+    { 612, 1, PA_SHIFT, 8 },
+    // State 612
+    { 612, 994, PA_SHIFT, 10 },
+    // State 612
+    { 612, 995, PA_SHIFT, 9 },
+    // State 612
+    { 612, 1000, PA_SHIFT, 613 },
+    // State 612
+    { 612, 1004, PA_SHIFT, 13 },
+    // State 613
+    { 613, 996, PA_SHIFT, 6 },
+    // State 613
+    { 613, 998, PA_REDUCE, 308 },
+    // State 614
+    { 614, 1, PA_SHIFT, 8 },
+    // State 614
+    { 614, 994, PA_SHIFT, 10 },
+    // State 614
+    { 614, 995, PA_SHIFT, 9 },
+    // State 614
+    { 614, 1000, PA_SHIFT, 615 },
+    // State 614
+    { 614, 1004, PA_SHIFT, 13 },
+    // State 615
+    { 615, 996, PA_SHIFT, 6 },
+    // State 615
+    { 615, 998, PA_REDUCE, 309 },
+    // State 616
+    { 616, 1, PA_SHIFT, 8 },
+    // State 616
+    { 616, 994, PA_SHIFT, 10 },
+    // State 616
+    { 616, 995, PA_SHIFT, 9 },
+    // State 616
+    { 616, 1000, PA_SHIFT, 617 },
+    // State 616
+    { 616, 1004, PA_SHIFT, 13 },
+    // State 617
+    { 617, 996, PA_SHIFT, 6 },
+    // State 617
+    { 617, 998, PA_REDUCE, 310 },
+    // State 618
+    { 618, 1, PA_SHIFT, 8 },
+    // State 618
+    { 618, 994, PA_SHIFT, 10 },
+    // State 618
+    { 618, 995, PA_SHIFT, 9 },
+    // State 618
+    { 618, 1000, PA_SHIFT, 619 },
+    // State 618
+    { 618, 1004, PA_SHIFT, 13 },
+    // State 619
+    { 619, 996, PA_SHIFT, 6 },
+    // State 619
+    { 619, 998, PA_REDUCE, 311 },
+    // State 620
+    { 620, 1, PA_SHIFT, 8 },
+    // State 620
+    { 620, 994, PA_SHIFT, 10 },
+    // State 620
+    { 620, 995, PA_SHIFT, 9 },
+    // State 620
+    { 620, 1000, PA_SHIFT, 621 },
+    // State 620
+    { 620, 1004, PA_SHIFT, 13 },
+    // State 621
+    { 621, 996, PA_SHIFT, 6 },
+    // State 621
+    { 621, 998, PA_REDUCE, 312 },
+    // State 622
+    { 622, 1, PA_SHIFT, 8 },
+    // State 622
+    { 622, 994, PA_SHIFT, 10 },
+    // State 622
+    { 622, 995, PA_SHIFT, 9 },
+    // State 622
+    { 622, 1000, PA_SHIFT, 623 },
+    // State 622
+    { 622, 1004, PA_SHIFT, 13 },
+    // State 623
+    { 623, 996, PA_SHIFT, 6 },
+    // State 623
+    { 623, 998, PA_REDUCE, 313 },
+    // State 624
+    { 624, 1, PA_SHIFT, 8 },
+    // State 624
+    { 624, 994, PA_SHIFT, 10 },
+    // State 624
+    { 624, 995, PA_SHIFT, 9 },
+    // State 624
+    { 624, 1000, PA_SHIFT, 625 },
+    // State 624
+    { 624, 1004, PA_SHIFT, 13 },
+    // State 625
+    { 625, 996, PA_SHIFT, 6 },
+    // State 625
+    { 625, 998, PA_REDUCE, 314 },
+    // State 626
+    { 626, 1, PA_SHIFT, 8 },
+    // State 626
+    { 626, 994, PA_SHIFT, 10 },
+    // State 626
+    { 626, 995, PA_SHIFT, 9 },
+    // State 626
+    { 626, 1000, PA_SHIFT, 627 },
+    // State 626
+    { 626, 1004, PA_SHIFT, 13 },
+    // State 627
+    { 627, 996, PA_SHIFT, 6 },
+    // State 627
+    { 627, 998, PA_REDUCE, 315 },
+    // State 628
+    { 628, 1, PA_SHIFT, 8 },
+    // State 628
+    { 628, 994, PA_SHIFT, 10 },
+    // State 628
+    { 628, 995, PA_SHIFT, 9 },
+    // State 628
+    { 628, 1000, PA_SHIFT, 629 },
+    // State 628
+    { 628, 1004, PA_SHIFT, 13 },
+    // State 629
+    { 629, 996, PA_SHIFT, 6 },
+    // State 629
+    { 629, 998, PA_REDUCE, 316 },
+    // State 630
+    { 630, 1, PA_SHIFT, 8 },
+    // State 630
+    { 630, 994, PA_SHIFT, 10 },
+    // State 630
+    { 630, 995, PA_SHIFT, 9 },
+    // State 630
+    { 630, 1000, PA_SHIFT, 631 },
+    // State 630
+    { 630, 1004, PA_SHIFT, 13 },
+    // State 631
+    { 631, 996, PA_SHIFT, 6 },
+    // State 631
+    { 631, 998, PA_REDUCE, 317 },
+    // State 632
+    { 632, 1, PA_SHIFT, 8 },
+    // State 632
+    { 632, 994, PA_SHIFT, 10 },
+    // State 632
+    { 632, 995, PA_SHIFT, 9 },
+    // State 632
+    { 632, 1000, PA_SHIFT, 633 },
+    // State 632
+    { 632, 1004, PA_SHIFT, 13 },
+    // State 633
+    { 633, 996, PA_SHIFT, 6 },
+    // State 633
+    { 633, 998, PA_REDUCE, 318 },
+    // State 634
+    { 634, 1, PA_SHIFT, 8 },
+    // State 634
+    { 634, 994, PA_SHIFT, 10 },
+    // State 634
+    { 634, 995, PA_SHIFT, 9 },
+    // State 634
+    { 634, 1000, PA_SHIFT, 635 },
+    // State 634
+    { 634, 1004, PA_SHIFT, 13 },
+    // State 635
+    { 635, 996, PA_SHIFT, 6 },
+    // State 635
+    { 635, 998, PA_REDUCE, 319 },
+    // State 636
+    { 636, 1, PA_SHIFT, 8 },
+    // State 636
+    { 636, 994, PA_SHIFT, 10 },
+    // State 636
+    { 636, 995, PA_SHIFT, 9 },
+    // State 636
+    { 636, 1000, PA_SHIFT, 637 },
+    // State 636
+    { 636, 1004, PA_SHIFT, 13 },
+    // State 637
+    { 637, 996, PA_SHIFT, 6 },
+    // State 637
+    { 637, 998, PA_REDUCE, 320 },
+    // State 638
+    { 638, 1, PA_SHIFT, 8 },
+    // State 638
+    { 638, 994, PA_SHIFT, 10 },
+    // State 638
+    { 638, 995, PA_SHIFT, 9 },
+    // State 638
+    { 638, 1000, PA_SHIFT, 639 },
+    // State 638
+    { 638, 1004, PA_SHIFT, 13 },
+    // State 639
+    { 639, 996, PA_SHIFT, 6 },
+    // State 639
+    { 639, 998, PA_REDUCE, 321 },
+    // State 640
+    { 640, 1, PA_SHIFT, 8 },
+    // State 640
+    { 640, 994, PA_SHIFT, 10 },
+    // State 640
+    { 640, 995, PA_SHIFT, 9 },
+    // State 640
+    { 640, 1000, PA_SHIFT, 641 },
+    // State 640
+    { 640, 1004, PA_SHIFT, 13 },
+    // State 641
+    { 641, 996, PA_SHIFT, 6 },
+    // State 641
+    { 641, 998, PA_REDUCE, 322 },
+    // State 642
+    { 642, 1, PA_SHIFT, 8 },
+    // State 642
+    { 642, 994, PA_SHIFT, 10 },
+    // State 642
+    { 642, 995, PA_SHIFT, 9 },
+    // State 642
+    { 642, 1000, PA_SHIFT, 643 },
+    // State 642
+    { 642, 1004, PA_SHIFT, 13 },
+    // State 643
+    { 643, 996, PA_SHIFT, 6 },
+    // State 643
+    { 643, 998, PA_REDUCE, 323 },
+    // State 644
+    { 644, 1, PA_SHIFT, 8 },
+    // State 644
+    { 644, 994, PA_SHIFT, 10 },
+    // State 644
+    { 644, 995, PA_SHIFT, 9 },
+    // State 644
+    { 644, 1000, PA_SHIFT, 645 },
+    // State 644
+    { 644, 1004, PA_SHIFT, 13 },
+    // State 645
+    { 645, 996, PA_SHIFT, 6 },
+    // State 645
+    { 645, 998, PA_REDUCE, 324 },
+    // State 646
+    { 646, 1, PA_SHIFT, 8 },
+    // State 646
+    { 646, 994, PA_SHIFT, 10 },
+    // State 646
+    { 646, 995, PA_SHIFT, 9 },
+    // State 646
+    { 646, 1000, PA_SHIFT, 647 },
+    // State 646
+    { 646, 1004, PA_SHIFT, 13 },
+    // State 647
+    { 647, 996, PA_SHIFT, 6 },
+    // State 647
+    { 647, 998, PA_REDUCE, 325 },
+    // State 648
+    { 648, 1, PA_SHIFT, 8 },
+    // State 648
+    { 648, 994, PA_SHIFT, 10 },
+    // State 648
+    { 648, 995, PA_SHIFT, 9 },
+    // State 648
+    { 648, 1000, PA_SHIFT, 649 },
+    // State 648
+    { 648, 1004, PA_SHIFT, 13 },
+    // State 649
+    { 649, 996, PA_SHIFT, 6 },
+    // State 649
+    { 649, 998, PA_REDUCE, 326 },
+    // State 650
+    { 650, 1, PA_SHIFT, 8 },
+    // State 650
+    { 650, 994, PA_SHIFT, 10 },
+    // State 650
+    { 650, 995, PA_SHIFT, 9 },
+    // State 650
+    { 650, 1000, PA_SHIFT, 651 },
+    // State 650
+    { 650, 1004, PA_SHIFT, 13 },
+    // State 651
+    { 651, 996, PA_SHIFT, 6 },
+    // State 651
+    { 651, 998, PA_REDUCE, 327 },
+    // State 652
+    { 652, 1, PA_SHIFT, 8 },
+    // State 652
+    { 652, 994, PA_SHIFT, 10 },
+    // State 652
+    { 652, 995, PA_SHIFT, 9 },
+    // State 652
+    { 652, 1000, PA_SHIFT, 653 },
+    // State 652
+    { 652, 1004, PA_SHIFT, 13 },
+    // State 653
+    { 653, 996, PA_SHIFT, 6 },
+    // State 653
+    { 653, 998, PA_REDUCE, 328 },
+    // State 654
+    { 654, 1, PA_SHIFT, 8 },
+    // State 654
+    { 654, 994, PA_SHIFT, 10 },
+    // State 654
+    { 654, 995, PA_SHIFT, 9 },
+    // State 654
+    { 654, 1000, PA_SHIFT, 655 },
+    // State 654
+    { 654, 1004, PA_SHIFT, 13 },
+    // State 655
+    { 655, 996, PA_SHIFT, 6 },
+    // State 655
+    { 655, 998, PA_REDUCE, 329 },
+    // State 656
+    { 656, 1, PA_SHIFT, 8 },
+    // State 656
+    { 656, 994, PA_SHIFT, 10 },
+    // State 656
+    { 656, 995, PA_SHIFT, 9 },
+    // State 656
+    { 656, 1000, PA_SHIFT, 657 },
+    // State 656
+    { 656, 1004, PA_SHIFT, 13 },
+    // State 657
+    { 657, 996, PA_SHIFT, 6 },
+    // State 657
+    { 657, 998, PA_REDUCE, 330 },
+    // State 658
+    { 658, 1, PA_SHIFT, 8 },
+    // State 658
+    { 658, 994, PA_SHIFT, 10 },
+    // State 658
+    { 658, 995, PA_SHIFT, 9 },
+    // State 658
+    { 658, 1000, PA_SHIFT, 659 },
+    // State 658
+    { 658, 1004, PA_SHIFT, 13 },
+    // State 659
+    { 659, 996, PA_SHIFT, 6 },
+    // State 659
+    { 659, 998, PA_REDUCE, 331 },
+    // State 660
+    { 660, 1, PA_SHIFT, 8 },
+    // State 660
+    { 660, 994, PA_SHIFT, 10 },
+    // State 660
+    { 660, 995, PA_SHIFT, 9 },
+    // State 660
+    { 660, 1000, PA_SHIFT, 661 },
+    // State 660
+    { 660, 1004, PA_SHIFT, 13 },
+    // State 661
+    { 661, 996, PA_SHIFT, 6 },
+    // State 661
+    { 661, 998, PA_REDUCE, 332 },
+    // State 662
+    { 662, 1, PA_SHIFT, 8 },
+    // State 662
+    { 662, 994, PA_SHIFT, 10 },
+    // State 662
+    { 662, 995, PA_SHIFT, 9 },
+    // State 662
+    { 662, 1000, PA_SHIFT, 663 },
+    // State 662
+    { 662, 1004, PA_SHIFT, 13 },
+    // State 663
+    { 663, 996, PA_SHIFT, 6 },
+    // State 663
+    { 663, 998, PA_REDUCE, 333 },
+    // State 664
+    { 664, 1, PA_SHIFT, 8 },
+    // State 664
+    { 664, 994, PA_SHIFT, 10 },
+    // State 664
+    { 664, 995, PA_SHIFT, 9 },
+    // State 664
+    { 664, 1000, PA_SHIFT, 665 },
+    // State 664
+    { 664, 1004, PA_SHIFT, 13 },
+    // State 665
+    { 665, 996, PA_SHIFT, 6 },
+    // State 665
+    { 665, 998, PA_REDUCE, 334 },
+    // State 666
+    { 666, 1, PA_SHIFT, 8 },
+    // State 666
+    { 666, 994, PA_SHIFT, 10 },
+    // State 666
+    { 666, 995, PA_SHIFT, 9 },
+    // State 666
+    { 666, 1000, PA_SHIFT, 667 },
+    // State 666
+    { 666, 1004, PA_SHIFT, 13 },
+    // State 667
+    { 667, 996, PA_SHIFT, 6 },
+    // State 667
+    { 667, 998, PA_REDUCE, 335 },
+    // State 668
+    { 668, 1, PA_SHIFT, 8 },
+    // State 668
+    { 668, 994, PA_SHIFT, 10 },
+    // State 668
+    { 668, 995, PA_SHIFT, 9 },
+    // State 668
+    { 668, 1000, PA_SHIFT, 669 },
+    // State 668
+    { 668, 1004, PA_SHIFT, 13 },
+    // State 669
+    { 669, 996, PA_SHIFT, 6 },
+    // State 669
+    { 669, 998, PA_REDUCE, 336 },
+    // State 670
+    { 670, 1, PA_SHIFT, 8 },
+    // State 670
+    { 670, 994, PA_SHIFT, 10 },
+    // State 670
+    { 670, 995, PA_SHIFT, 9 },
+    // State 670
+    { 670, 1000, PA_SHIFT, 671 },
+    // State 670
+    { 670, 1004, PA_SHIFT, 13 },
+    // State 671
+    { 671, 996, PA_SHIFT, 6 },
+    // State 671
+    { 671, 998, PA_REDUCE, 337 },
+    // State 672
+    { 672, 1, PA_SHIFT, 8 },
+    // State 672
+    { 672, 994, PA_SHIFT, 10 },
+    // State 672
+    { 672, 995, PA_SHIFT, 9 },
+    // State 672
+    { 672, 1000, PA_SHIFT, 673 },
+    // State 672
+    { 672, 1004, PA_SHIFT, 13 },
+    // State 673
+    { 673, 996, PA_SHIFT, 6 },
+    // State 673
+    { 673, 998, PA_REDUCE, 338 },
+    // State 674
+    { 674, 1, PA_SHIFT, 8 },
+    // State 674
+    { 674, 994, PA_SHIFT, 10 },
+    // State 674
+    { 674, 995, PA_SHIFT, 9 },
+    // State 674
+    { 674, 1000, PA_SHIFT, 675 },
+    // State 674
+    { 674, 1004, PA_SHIFT, 13 },
+    // State 675
+    { 675, 996, PA_SHIFT, 6 },
+    // State 675
+    { 675, 998, PA_REDUCE, 339 },
+    // State 676
+    { 676, 1, PA_SHIFT, 8 },
+    // State 676
+    { 676, 994, PA_SHIFT, 10 },
+    // State 676
+    { 676, 995, PA_SHIFT, 9 },
+    // State 676
+    { 676, 1000, PA_SHIFT, 677 },
+    // State 676
+    { 676, 1004, PA_SHIFT, 13 },
+    // State 677
+    { 677, 996, PA_SHIFT, 6 },
+    // State 677
+    { 677, 998, PA_REDUCE, 340 },
+    // State 678
+    { 678, 1, PA_SHIFT, 8 },
+    // State 678
+    { 678, 994, PA_SHIFT, 10 },
+    // State 678
+    { 678, 995, PA_SHIFT, 9 },
+    // State 678
+    { 678, 1000, PA_SHIFT, 679 },
+    // State 678
+    { 678, 1004, PA_SHIFT, 13 },
+    // State 679
+    { 679, 996, PA_SHIFT, 6 },
+    // State 679
+    { 679, 998, PA_REDUCE, 341 },
+    // State 680
+    { 680, 1, PA_SHIFT, 8 },
+    // State 680
+    { 680, 994, PA_SHIFT, 10 },
+    // State 680
+    { 680, 995, PA_SHIFT, 9 },
+    // State 680
+    { 680, 1000, PA_SHIFT, 681 },
+    // State 680
+    { 680, 1004, PA_SHIFT, 13 },
+    // State 681
+    { 681, 996, PA_SHIFT, 6 },
+    // State 681
+    { 681, 998, PA_REDUCE, 342 },
+    // State 682
+    { 682, 1, PA_SHIFT, 8 },
+    // State 682
+    { 682, 994, PA_SHIFT, 10 },
+    // State 682
+    { 682, 995, PA_SHIFT, 9 },
+    // State 682
+    { 682, 1000, PA_SHIFT, 683 },
+    // State 682
+    { 682, 1004, PA_SHIFT, 13 },
+    // State 683
+    { 683, 996, PA_SHIFT, 6 },
+    // State 683
+    { 683, 998, PA_REDUCE, 343 },
+    // State 684
+    { 684, 1, PA_SHIFT, 8 },
+    // State 684
+    { 684, 994, PA_SHIFT, 10 },
+    // State 684
+    { 684, 995, PA_SHIFT, 9 },
+    // State 684
+    { 684, 1000, PA_SHIFT, 685 },
+    // State 684
+    { 684, 1004, PA_SHIFT, 13 },
+    // State 685
+    { 685, 996, PA_SHIFT, 6 },
+    // State 685
+    { 685, 998, PA_REDUCE, 344 },
+    // State 686
+    { 686, 1, PA_SHIFT, 8 },
+    // State 686
+    { 686, 994, PA_SHIFT, 10 },
+    // State 686
+    { 686, 995, PA_SHIFT, 9 },
+    // State 686
+    { 686, 1000, PA_SHIFT, 687 },
+    // State 686
+    { 686, 1004, PA_SHIFT, 13 },
+    // State 687
+    { 687, 996, PA_SHIFT, 6 },
+    // State 687
+    { 687, 998, PA_REDUCE, 345 },
+    // State 688
+    { 688, 1, PA_SHIFT, 8 },
+    // State 688
+    { 688, 994, PA_SHIFT, 10 },
+    // State 688
+    { 688, 995, PA_SHIFT, 9 },
+    // State 688
+    { 688, 1000, PA_SHIFT, 689 },
+    // State 688
+    { 688, 1004, PA_SHIFT, 13 },
+    // State 689
+    { 689, 996, PA_SHIFT, 6 },
+    // State 689
+    { 689, 998, PA_REDUCE, 346 },
+    // State 690
+    { 690, 1, PA_SHIFT, 8 },
+    // State 690
+    { 690, 994, PA_SHIFT, 10 },
+    // State 690
+    { 690, 995, PA_SHIFT, 9 },
+    // State 690
+    { 690, 1000, PA_SHIFT, 691 },
+    // State 690
+    { 690, 1004, PA_SHIFT, 13 },
+    // State 691
+    { 691, 996, PA_SHIFT, 6 },
+    // State 691
+    { 691, 998, PA_REDUCE, 347 },
+    // State 692
+    { 692, 1, PA_SHIFT, 8 },
+    // State 692
+    { 692, 994, PA_SHIFT, 10 },
+    // State 692
+    { 692, 995, PA_SHIFT, 9 },
+    // State 692
+    { 692, 1000, PA_SHIFT, 693 },
+    // State 692
+    { 692, 1004, PA_SHIFT, 13 },
+    // State 693
+    { 693, 996, PA_SHIFT, 6 },
+    // State 693
+    { 693, 998, PA_REDUCE, 348 },
+    // State 694
+    { 694, 1, PA_SHIFT, 8 },
+    // State 694
+    { 694, 994, PA_SHIFT, 10 },
+    // State 694
+    { 694, 995, PA_SHIFT, 9 },
+    // State 694
+    { 694, 1000, PA_SHIFT, 695 },
+    // State 694
+    { 694, 1004, PA_SHIFT, 13 },
+    // State 695
+    { 695, 996, PA_SHIFT, 6 },
+    // State 695
+    { 695, 998, PA_REDUCE, 349 },
+    // State 696
+    { 696, 1, PA_SHIFT, 8 },
+    // State 696
+    { 696, 994, PA_SHIFT, 10 },
+    // State 696
+    { 696, 995, PA_SHIFT, 9 },
+    // State 696
+    { 696, 1000, PA_SHIFT, 697 },
+    // State 696
+    { 696, 1004, PA_SHIFT, 13 },
+    // State 697
+    { 697, 996, PA_SHIFT, 6 },
+    // State 697
+    { 697, 998, PA_REDUCE, 350 },
+    // State 698
+    { 698, 1, PA_SHIFT, 8 },
+    // State 698
+    { 698, 994, PA_SHIFT, 10 },
+    // State 698
+    { 698, 995, PA_SHIFT, 9 },
+    // State 698
+    { 698, 1000, PA_SHIFT, 699 },
+    // State 698
+    { 698, 1004, PA_SHIFT, 13 },
+    // State 699
+    { 699, 996, PA_SHIFT, 6 },
+    // State 699
+    { 699, 998, PA_REDUCE, 351 },
+    // State 700
+    { 700, 1, PA_SHIFT, 8 },
+    // State 700
+    { 700, 994, PA_SHIFT, 10 },
+    // State 700
+    { 700, 995, PA_SHIFT, 9 },
+    // State 700
+    { 700, 1000, PA_SHIFT, 701 },
+    // State 700
+    { 700, 1004, PA_SHIFT, 13 },
+    // State 701
+    { 701, 996, PA_SHIFT, 6 },
+    // State 701
+    { 701, 998, PA_REDUCE, 352 },
+    // State 702
+    { 702, 1, PA_SHIFT, 8 },
+    // State 702
+    { 702, 994, PA_SHIFT, 10 },
+    // State 702
+    { 702, 995, PA_SHIFT, 9 },
+    // State 702
+    { 702, 1000, PA_SHIFT, 703 },
+    // State 702
+    { 702, 1004, PA_SHIFT, 13 },
+    // State 703
+    { 703, 996, PA_SHIFT, 6 },
+    // State 703
+    { 703, 998, PA_REDUCE, 353 },
+    // State 704
+    { 704, 1, PA_SHIFT, 8 },
+    // State 704
+    { 704, 994, PA_SHIFT, 10 },
+    // State 704
+    { 704, 995, PA_SHIFT, 9 },
+    // State 704
+    { 704, 1000, PA_SHIFT, 705 },
+    // State 704
+    { 704, 1004, PA_SHIFT, 13 },
+    // State 705
+    { 705, 996, PA_SHIFT, 6 },
+    // State 705
+    { 705, 998, PA_REDUCE, 354 },
+    // State 706
+    { 706, 1, PA_SHIFT, 8 },
+    // State 706
+    { 706, 994, PA_SHIFT, 10 },
+    // State 706
+    { 706, 995, PA_SHIFT, 9 },
+    // State 706
+    { 706, 1000, PA_SHIFT, 707 },
+    // State 706
+    { 706, 1004, PA_SHIFT, 13 },
+    // State 707
+    { 707, 996, PA_SHIFT, 6 },
+    // State 707
+    { 707, 998, PA_REDUCE, 355 },
+    // State 708
+    { 708, 1, PA_SHIFT, 8 },
+    // State 708
+    { 708, 994, PA_SHIFT, 10 },
+    // State 708
+    { 708, 995, PA_SHIFT, 9 },
+    // State 708
+    { 708, 1000, PA_SHIFT, 709 },
+    // State 708
+    { 708, 1004, PA_SHIFT, 13 },
+    // State 709
+    { 709, 996, PA_SHIFT, 6 },
+    // State 709
+    { 709, 998, PA_REDUCE, 356 },
+    // State 710
+    { 710, 1, PA_SHIFT, 8 },
+    // State 710
+    { 710, 994, PA_SHIFT, 10 },
+    // State 710
+    { 710, 995, PA_SHIFT, 9 },
+    // State 710
+    { 710, 1000, PA_SHIFT, 711 },
+    // State 710
+    { 710, 1004, PA_SHIFT, 13 },
+    // State 711
+    { 711, 996, PA_SHIFT, 6 },
+    // State 711
+    { 711, 998, PA_REDUCE, 357 },
+    // State 712
+    { 712, 1, PA_SHIFT, 8 },
+    // State 712
+    { 712, 994, PA_SHIFT, 10 },
+    // State 712
+    { 712, 995, PA_SHIFT, 9 },
+    // State 712
+    { 712, 1000, PA_SHIFT, 713 },
+    // State 712
+    { 712, 1004, PA_SHIFT, 13 },
+    // State 713
+    { 713, 996, PA_SHIFT, 6 },
+    // State 713
+    { 713, 998, PA_REDUCE, 358 },
+    // State 714
+    { 714, 1, PA_SHIFT, 8 },
+    // State 714
+    { 714, 994, PA_SHIFT, 10 },
+    // State 714
+    { 714, 995, PA_SHIFT, 9 },
+    // State 714
+    { 714, 1000, PA_SHIFT, 715 },
+    // State 714
+    { 714, 1004, PA_SHIFT, 13 },
+    // State 715
+    { 715, 996, PA_SHIFT, 6 },
+    // State 715
+    { 715, 998, PA_REDUCE, 359 },
+    // State 716
+    { 716, 1, PA_SHIFT, 8 },
+    // State 716
+    { 716, 994, PA_SHIFT, 10 },
+    // State 716
+    { 716, 995, PA_SHIFT, 9 },
+    // State 716
+    { 716, 1000, PA_SHIFT, 717 },
+    // State 716
+    { 716, 1004, PA_SHIFT, 13 },
+    // State 717
+    { 717, 996, PA_SHIFT, 6 },
+    // State 717
+    { 717, 998, PA_REDUCE, 360 },
+    // State 718
+    { 718, 1, PA_SHIFT, 8 },
+    // State 718
+    { 718, 994, PA_SHIFT, 10 },
+    // State 718
+    { 718, 995, PA_SHIFT, 9 },
+    // State 718
+    { 718, 1000, PA_SHIFT, 719 },
+    // State 718
+    { 718, 1004, PA_SHIFT, 13 },
+    // State 719
+    { 719, 996, PA_SHIFT, 6 },
+    // State 719
+    { 719, 998, PA_REDUCE, 361 },
+    // State 720
+    { 720, 1, PA_SHIFT, 8 },
+    // State 720
+    { 720, 994, PA_SHIFT, 10 },
+    // State 720
+    { 720, 995, PA_SHIFT, 9 },
+    // State 720
+    { 720, 1000, PA_SHIFT, 721 },
+    // State 720
+    { 720, 1004, PA_SHIFT, 13 },
+    // State 721
+    { 721, 996, PA_SHIFT, 6 },
+    // State 721
+    { 721, 998, PA_REDUCE, 362 },
+    // State 722
+    { 722, 1, PA_SHIFT, 8 },
+    // State 722
+    { 722, 994, PA_SHIFT, 10 },
+    // State 722
+    { 722, 995, PA_SHIFT, 9 },
+    // State 722
+    { 722, 1000, PA_SHIFT, 723 },
+    // State 722
+    { 722, 1004, PA_SHIFT, 13 },
+    // State 723
+    { 723, 996, PA_SHIFT, 6 },
+    // State 723
+    { 723, 998, PA_REDUCE, 363 },
+    // State 724
+    { 724, 1, PA_SHIFT, 8 },
+    // State 724
+    { 724, 994, PA_SHIFT, 10 },
+    // State 724
+    { 724, 995, PA_SHIFT, 9 },
+    // State 724
+    { 724, 1000, PA_SHIFT, 725 },
+    // State 724
+    { 724, 1004, PA_SHIFT, 13 },
+    // State 725
+    { 725, 996, PA_SHIFT, 6 },
+    // State 725
+    { 725, 998, PA_REDUCE, 364 },
+    // State 726
+    { 726, 1, PA_SHIFT, 8 },
+    // State 726
+    { 726, 994, PA_SHIFT, 10 },
+    // State 726
+    { 726, 995, PA_SHIFT, 9 },
+    // State 726
+    { 726, 1000, PA_SHIFT, 727 },
+    // State 726
+    { 726, 1004, PA_SHIFT, 13 },
+    // State 727
+    { 727, 996, PA_SHIFT, 6 },
+    // State 727
+    { 727, 998, PA_REDUCE, 365 },
+    // State 728
+    { 728, 1, PA_SHIFT, 8 },
+    // State 728
+    { 728, 994, PA_SHIFT, 10 },
+    // State 728
+    { 728, 995, PA_SHIFT, 9 },
+    // State 728
+    { 728, 1000, PA_SHIFT, 729 },
+    // State 728
+    { 728, 1004, PA_SHIFT, 13 },
+    // State 729
+    { 729, 996, PA_SHIFT, 6 },
+    // State 729
+    { 729, 998, PA_REDUCE, 366 },
+    // State 730
+    { 730, 1, PA_SHIFT, 8 },
+    // State 730
+    { 730, 994, PA_SHIFT, 10 },
+    // State 730
+    { 730, 995, PA_SHIFT, 9 },
+    // State 730
+    { 730, 1000, PA_SHIFT, 731 },
+    // State 730
+    { 730, 1004, PA_SHIFT, 13 },
+    // State 731
+    { 731, 996, PA_SHIFT, 6 },
+    // State 731
+    { 731, 998, PA_REDUCE, 367 },
+    // State 732
+    { 732, 1, PA_SHIFT, 8 },
+    // State 732
+    { 732, 994, PA_SHIFT, 10 },
+    // State 732
+    { 732, 995, PA_SHIFT, 9 },
+    // State 732
+    { 732, 1000, PA_SHIFT, 733 },
+    // State 732
+    { 732, 1004, PA_SHIFT, 13 },
+    // State 733
+    { 733, 996, PA_SHIFT, 6 },
+    // State 733
+    { 733, 998, PA_REDUCE, 368 },
+    // State 734
+    { 734, 1, PA_SHIFT, 8 },
+    // State 734
+    { 734, 994, PA_SHIFT, 10 },
+    // State 734
+    { 734, 995, PA_SHIFT, 9 },
+    // State 734
+    { 734, 1000, PA_SHIFT, 735 },
+    // State 734
+    { 734, 1004, PA_SHIFT, 13 },
+    // State 735
+    { 735, 996, PA_SHIFT, 6 },
+    // State 735
+    { 735, 998, PA_REDUCE, 369 },
+    // State 736
+    { 736, 1, PA_SHIFT, 8 },
+    // State 736
+    { 736, 994, PA_SHIFT, 10 },
+    // State 736
+    { 736, 995, PA_SHIFT, 9 },
+    // State 736
+    { 736, 1000, PA_SHIFT, 737 },
+    // State 736
+    { 736, 1004, PA_SHIFT, 13 },
+    // State 737
+    { 737, 996, PA_SHIFT, 6 },
+    // State 737
+    { 737, 998, PA_REDUCE, 370 },
+    // State 738
+    { 738, 1, PA_SHIFT, 8 },
+    // State 738
+    { 738, 994, PA_SHIFT, 10 },
+    // State 738
+    { 738, 995, PA_SHIFT, 9 },
+    // State 738
+    { 738, 1000, PA_SHIFT, 739 },
+    // State 738
+    { 738, 1004, PA_SHIFT, 13 },
+    // State 739
+    { 739, 996, PA_SHIFT, 6 },
+    // State 739
+    { 739, 998, PA_REDUCE, 371 },
+    // State 740
+    { 740, 1, PA_SHIFT, 8 },
+    // State 740
+    { 740, 994, PA_SHIFT, 10 },
+    // State 740
+    { 740, 995, PA_SHIFT, 9 },
+    // State 740
+    { 740, 1000, PA_SHIFT, 741 },
+    // State 740
+    { 740, 1004, PA_SHIFT, 13 },
+    // State 741
+    { 741, 996, PA_SHIFT, 6 },
+    // State 741
+    { 741, 998, PA_REDUCE, 372 },
+    // State 742
+    { 742, 1, PA_SHIFT, 8 },
+    // State 742
+    { 742, 994, PA_SHIFT, 10 },
+    // State 742
+    { 742, 995, PA_SHIFT, 9 },
+    // State 742
+    { 742, 1000, PA_SHIFT, 743 },
+    // State 742
+    { 742, 1004, PA_SHIFT, 13 },
+    // State 743
+    { 743, 996, PA_SHIFT, 6 },
+    // State 743
+    { 743, 998, PA_REDUCE, 373 },
+    // State 744
+    { 744, 1, PA_SHIFT, 8 },
+    // State 744
+    { 744, 994, PA_SHIFT, 10 },
+    // State 744
+    { 744, 995, PA_SHIFT, 9 },
+    // State 744
+    { 744, 1000, PA_SHIFT, 745 },
+    // State 744
+    { 744, 1004, PA_SHIFT, 13 },
+    // State 745
+    { 745, 996, PA_SHIFT, 6 },
+    // State 745
+    { 745, 998, PA_REDUCE, 374 },
+    // State 746
+    { 746, 1, PA_SHIFT, 8 },
+    // State 746
+    { 746, 994, PA_SHIFT, 10 },
+    // State 746
+    { 746, 995, PA_SHIFT, 9 },
+    // State 746
+    { 746, 1000, PA_SHIFT, 747 },
+    // State 746
+    { 746, 1004, PA_SHIFT, 13 },
+    // State 747
+    { 747, 996, PA_SHIFT, 6 },
+    // State 747
+    { 747, 998, PA_REDUCE, 375 },
+    // State 748
+    { 748, 1, PA_SHIFT, 8 },
+    // State 748
+    { 748, 994, PA_SHIFT, 10 },
+    // State 748
+    { 748, 995, PA_SHIFT, 9 },
+    // State 748
+    { 748, 1000, PA_SHIFT, 749 },
+    // State 748
+    { 748, 1004, PA_SHIFT, 13 },
+    // State 749
+    { 749, 996, PA_SHIFT, 6 },
+    // State 749
+    { 749, 998, PA_REDUCE, 376 },
+    // State 750
+    { 750, 1, PA_SHIFT, 8 },
+    // State 750
+    { 750, 994, PA_SHIFT, 10 },
+    // State 750
+    { 750, 995, PA_SHIFT, 9 },
+    // State 750
+    { 750, 1000, PA_SHIFT, 751 },
+    // State 750
+    { 750, 1004, PA_SHIFT, 13 },
+    // State 751
+    { 751, 996, PA_SHIFT, 6 },
+    // State 751
+    { 751, 998, PA_REDUCE, 377 },
+    // State 752
+    { 752, 1, PA_SHIFT, 8 },
+    // State 752
+    { 752, 994, PA_SHIFT, 10 },
+    // State 752
+    { 752, 995, PA_SHIFT, 9 },
+    // State 752
+    { 752, 1000, PA_SHIFT, 753 },
+    // State 752
+    { 752, 1004, PA_SHIFT, 13 },
+    // State 753
+    { 753, 996, PA_SHIFT, 6 },
+    // State 753
+    { 753, 998, PA_REDUCE, 378 },
+    // State 754
+    { 754, 1, PA_SHIFT, 8 },
+    // State 754
+    { 754, 994, PA_SHIFT, 10 },
+    // State 754
+    { 754, 995, PA_SHIFT, 9 },
+    // State 754
+    { 754, 1000, PA_SHIFT, 755 },
+    // State 754
+    { 754, 1004, PA_SHIFT, 13 },
+    // State 755
+    { 755, 996, PA_SHIFT, 6 },
+    // State 755
+    { 755, 998, PA_REDUCE, 379 },
+    // State 756
+    { 756, 1, PA_SHIFT, 8 },
+    // State 756
+    { 756, 994, PA_SHIFT, 10 },
+    // State 756
+    { 756, 995, PA_SHIFT, 9 },
+    // State 756
+    { 756, 1000, PA_SHIFT, 757 },
+    // State 756
+    { 756, 1004, PA_SHIFT, 13 },
+    // State 757
+    { 757, 996, PA_SHIFT, 6 },
+    // State 757
+    { 757, 998, PA_REDUCE, 380 },
+    // State 758
+    { 758, 1, PA_SHIFT, 8 },
+    // State 758
+    { 758, 994, PA_SHIFT, 10 },
+    // State 758
+    { 758, 995, PA_SHIFT, 9 },
+    // State 758
+    { 758, 1000, PA_SHIFT, 759 },
+    // State 758
+    { 758, 1004, PA_SHIFT, 13 },
+    // State 759
+    { 759, 996, PA_SHIFT, 6 },
+    // State 759
+    { 759, 998, PA_REDUCE, 381 },
+    // State 760
+    { 760, 1, PA_SHIFT, 8 },
+    // State 760
+    { 760, 994, PA_SHIFT, 10 },
+    // State 760
+    { 760, 995, PA_SHIFT, 9 },
+    // State 760
+    { 760, 1000, PA_SHIFT, 761 },
+    // State 760
+    { 760, 1004, PA_SHIFT, 13 },
+    // State 761
+    { 761, 996, PA_SHIFT, 6 },
+    // State 761
+    { 761, 998, PA_REDUCE, 382 },
+    // State 762
+    { 762, 1, PA_SHIFT, 8 },
+    // State 762
+    { 762, 994, PA_SHIFT, 10 },
+    // State 762
+    { 762, 995, PA_SHIFT, 9 },
+    // State 762
+    { 762, 1000, PA_SHIFT, 763 },
+    // State 762
+    { 762, 1004, PA_SHIFT, 13 },
+    // State 763
+    { 763, 996, PA_SHIFT, 6 },
+    // State 763
+    { 763, 998, PA_REDUCE, 383 },
+    // State 764
+    { 764, 1, PA_SHIFT, 8 },
+    // State 764
+    { 764, 994, PA_SHIFT, 10 },
+    // State 764
+    { 764, 995, PA_SHIFT, 9 },
+    // State 764
+    { 764, 1000, PA_SHIFT, 765 },
+    // State 764
+    { 764, 1004, PA_SHIFT, 13 },
+    // State 765
+    { 765, 996, PA_SHIFT, 6 },
+    // State 765
+    { 765, 998, PA_REDUCE, 384 },
+    // State 766
+    { 766, 1, PA_SHIFT, 8 },
+    // State 766
+    { 766, 994, PA_SHIFT, 10 },
+    // State 766
+    { 766, 995, PA_SHIFT, 9 },
+    // State 766
+    { 766, 1000, PA_SHIFT, 767 },
+    // State 766
+    { 766, 1004, PA_SHIFT, 13 },
+    // State 767
+    { 767, 996, PA_SHIFT, 6 },
+    // State 767
+    { 767, 998, PA_REDUCE, 385 },
+    // State 768
+    { 768, 1, PA_SHIFT, 8 },
+    // State 768
+    { 768, 994, PA_SHIFT, 10 },
+    // State 768
+    { 768, 995, PA_SHIFT, 9 },
+    // State 768
+    { 768, 1000, PA_SHIFT, 769 },
+    // State 768
+    { 768, 1004, PA_SHIFT, 13 },
+    // State 769
+    { 769, 996, PA_SHIFT, 6 },
+    // State 769
+    { 769, 998, PA_REDUCE, 386 },
+    // State 770
+    { 770, 1, PA_SHIFT, 8 },
+    // State 770
+    { 770, 994, PA_SHIFT, 10 },
+    // State 770
+    { 770, 995, PA_SHIFT, 9 },
+    // State 770
+    { 770, 1000, PA_SHIFT, 771 },
+    // State 770
+    { 770, 1004, PA_SHIFT, 13 },
+    // State 771
+    { 771, 996, PA_SHIFT, 6 },
+    // State 771
+    { 771, 998, PA_REDUCE, 387 },
+    // State 772
+    { 772, 1, PA_SHIFT, 8 },
+    // State 772
+    { 772, 994, PA_SHIFT, 10 },
+    // State 772
+    { 772, 995, PA_SHIFT, 9 },
+    // State 772
+    { 772, 1000, PA_SHIFT, 773 },
+    // State 772
+    { 772, 1004, PA_SHIFT, 13 },
+    // State 773
+    { 773, 996, PA_SHIFT, 6 },
+    // State 773
+    { 773, 998, PA_REDUCE, 388 },
+    // State 774
+    { 774, 1, PA_SHIFT, 8 },
+    // State 774
+    { 774, 994, PA_SHIFT, 10 },
+    // State 774
+    { 774, 995, PA_SHIFT, 9 },
+    // State 774
+    { 774, 1000, PA_SHIFT, 775 },
+    // State 774
+    { 774, 1004, PA_SHIFT, 13 },
+    // State 775
+    { 775, 996, PA_SHIFT, 6 },
+    // State 775
+    { 775, 998, PA_REDUCE, 389 },
+    // State 776
+    { 776, 1, PA_SHIFT, 8 },
+    // State 776
+    { 776, 994, PA_SHIFT, 10 },
+    // State 776
+    { 776, 995, PA_SHIFT, 9 },
+    // State 776
+    { 776, 1000, PA_SHIFT, 777 },
+    // State 776
+    { 776, 1004, PA_SHIFT, 13 },
+    // State 777
+    { 777, 996, PA_SHIFT, 6 },
+    // State 777
+    { 777, 998, PA_REDUCE, 390 },
+    // State 778
+    { 778, 1, PA_SHIFT, 8 },
+    // State 778
+    { 778, 994, PA_SHIFT, 10 },
+    // State 778
+    { 778, 995, PA_SHIFT, 9 },
+    // State 778
+    { 778, 1000, PA_SHIFT, 779 },
+    // State 778
+    { 778, 1004, PA_SHIFT, 13 },
+    // State 779
+    { 779, 996, PA_SHIFT, 6 },
+    // State 779
+    { 779, 998, PA_REDUCE, 391 },
+    // State 780
+    { 780, 1, PA_SHIFT, 8 },
+    // State 780
+    { 780, 994, PA_SHIFT, 10 },
+    // State 780
+    { 780, 995, PA_SHIFT, 9 },
+    // State 780
+    { 780, 1000, PA_SHIFT, 781 },
+    // State 780
+    { 780, 1004, PA_SHIFT, 13 },
+    // State 781
+    { 781, 996, PA_SHIFT, 6 },
+    // State 781
+    { 781, 998, PA_REDUCE, 392 },
+    // State 782
+    { 782, 1, PA_SHIFT, 8 },
+    // State 782
+    { 782, 994, PA_SHIFT, 10 },
+    // State 782
+    { 782, 995, PA_SHIFT, 9 },
+    // State 782
+    { 782, 1000, PA_SHIFT, 783 },
+    // State 782
+    { 782, 1004, PA_SHIFT, 13 },
+    // State 783
+    { 783, 996, PA_SHIFT, 6 },
+    // State 783
+    { 783, 998, PA_REDUCE, 393 },
+    // State 784
+    { 784, 1, PA_SHIFT, 8 },
+    // State 784
+    { 784, 994, PA_SHIFT, 10 },
+    // State 784
+    { 784, 995, PA_SHIFT, 9 },
+    // State 784
+    { 784, 1000, PA_SHIFT, 785 },
+    // State 784
+    { 784, 1004, PA_SHIFT, 13 },
+    // State 785
+    { 785, 996, PA_SHIFT, 6 },
+    // State 785
+    { 785, 998, PA_REDUCE, 394 },
+    // State 786
+    { 786, 1, PA_SHIFT, 8 },
+    // State 786
+    { 786, 994, PA_SHIFT, 10 },
+    // State 786
+    { 786, 995, PA_SHIFT, 9 },
+    // State 786
+    { 786, 1000, PA_SHIFT, 787 },
+    // State 786
+    { 786, 1004, PA_SHIFT, 13 },
+    // State 787
+    { 787, 996, PA_SHIFT, 6 },
+    // State 787
+    { 787, 998, PA_REDUCE, 395 },
+    // State 788
+    { 788, 1, PA_SHIFT, 8 },
+    // State 788
+    { 788, 994, PA_SHIFT, 10 },
+    // State 788
+    { 788, 995, PA_SHIFT, 9 },
+    // State 788
+    { 788, 1000, PA_SHIFT, 789 },
+    // State 788
+    { 788, 1004, PA_SHIFT, 13 },
+    // State 789
+    { 789, 996, PA_SHIFT, 6 },
+    // State 789
+    { 789, 998, PA_REDUCE, 396 },
+    // State 790
+    { 790, 1, PA_SHIFT, 8 },
+    // State 790
+    { 790, 994, PA_SHIFT, 10 },
+    // State 790
+    { 790, 995, PA_SHIFT, 9 },
+    // State 790
+    { 790, 1000, PA_SHIFT, 791 },
+    // State 790
+    { 790, 1004, PA_SHIFT, 13 },
+    // State 791
+    { 791, 996, PA_SHIFT, 6 },
+    // State 791
+    { 791, 998, PA_REDUCE, 397 },
+    // State 792
+    { 792, 1, PA_SHIFT, 8 },
+    // State 792
+    { 792, 994, PA_SHIFT, 10 },
+    // State 792
+    { 792, 995, PA_SHIFT, 9 },
+    // State 792
+    { 792, 1000, PA_SHIFT, 793 },
+    // State 792
+    { 792, 1004, PA_SHIFT, 13 },
+    // State 793
+    { 793, 996, PA_SHIFT, 6 },
+    // State 793
+    { 793, 998, PA_REDUCE, 398 },
+    // State 794
+    { 794, 1, PA_SHIFT, 8 },
+    // State 794
+    { 794, 994, PA_SHIFT, 10 },
+    // State 794
+    { 794, 995, PA_SHIFT, 9 },
+    // State 794
+    { 794, 1000, PA_SHIFT, 795 },
+    // State 794
+    { 794, 1004, PA_SHIFT, 13 },
+    // State 795
+    { 795, 996, PA_SHIFT, 6 },
+    // State 795
+    { 795, 998, PA_REDUCE, 399 },
+    // State 796
+    { 796, 1, PA_SHIFT, 8 },
+    // State 796
+    { 796, 994, PA_SHIFT, 10 },
+    // State 796
+    { 796, 995, PA_SHIFT, 9 },
+    // State 796
+    { 796, 1000, PA_SHIFT, 797 },
+    // State 796
+    { 796, 1004, PA_SHIFT, 13 },
+    // State 797
+    { 797, 996, PA_SHIFT, 6 },
+    // State 797
+    { 797, 998, PA_REDUCE, 400 },
+    // State 798
+    { 798, 1, PA_SHIFT, 8 },
+    // State 798
+    { 798, 994, PA_SHIFT, 10 },
+    // State 798
+    { 798, 995, PA_SHIFT, 9 },
+    // State 798
+    { 798, 1000, PA_SHIFT, 799 },
+    // State 798
+    { 798, 1004, PA_SHIFT, 13 },
+    // State 799
+    { 799, 996, PA_SHIFT, 6 },
+    // State 799
+    { 799, 998, PA_REDUCE, 401 },
+    // State 800
+    { 800, 1, PA_SHIFT, 8 },
+    // State 800
+    { 800, 994, PA_SHIFT, 10 },
+    // State 800
+    { 800, 995, PA_SHIFT, 9 },
+    // State 800
+    { 800, 1000, PA_SHIFT, 801 },
+    // State 800
+    { 800, 1004, PA_SHIFT, 13 },
+    // State 801
+    { 801, 996, PA_SHIFT, 6 },
+    // State 801
+    { 801, 998, PA_REDUCE, 402 },
+    // State 802
+    { 802, 1, PA_SHIFT, 8 },
+    // State 802
+    { 802, 994, PA_SHIFT, 10 },
+    // State 802
+    { 802, 995, PA_SHIFT, 9 },
+    // State 802
+    { 802, 1000, PA_SHIFT, 803 },
+    // State 802
+    { 802, 1004, PA_SHIFT, 13 },
+    // State 803
+    { 803, 996, PA_SHIFT, 6 },
+    // State 803
+    { 803, 998, PA_REDUCE, 403 },
+    // State 804
+    { 804, 1, PA_SHIFT, 8 },
+    // State 804
+    { 804, 994, PA_SHIFT, 10 },
+    // State 804
+    { 804, 995, PA_SHIFT, 9 },
+    // State 804
+    { 804, 1000, PA_SHIFT, 805 },
+    // State 804
+    { 804, 1004, PA_SHIFT, 13 },
+    // State 805
+    { 805, 996, PA_SHIFT, 6 },
+    // State 805
+    { 805, 998, PA_REDUCE, 404 },
+    // State 806
+    { 806, 1, PA_SHIFT, 8 },
+    // State 806
+    { 806, 994, PA_SHIFT, 10 },
+    // State 806
+    { 806, 995, PA_SHIFT, 9 },
+    // State 806
+    { 806, 1000, PA_SHIFT, 807 },
+    // State 806
+    { 806, 1004, PA_SHIFT, 13 },
+    // State 807
+    { 807, 996, PA_SHIFT, 6 },
+    // State 807
+    { 807, 998, PA_REDUCE, 405 },
+    // State 808
+    { 808, 1, PA_SHIFT, 8 },
+    // State 808
+    { 808, 994, PA_SHIFT, 10 },
+    // State 808
+    { 808, 995, PA_SHIFT, 9 },
+    // State 808
+    { 808, 1000, PA_SHIFT, 809 },
+    // State 808
+    { 808, 1004, PA_SHIFT, 13 },
+    // State 809
+    { 809, 996, PA_SHIFT, 6 },
+    // State 809
+    { 809, 998, PA_REDUCE, 406 },
+    // State 810
+    { 810, 1, PA_SHIFT, 8 },
+    // State 810
+    { 810, 994, PA_SHIFT, 10 },
+    // State 810
+    { 810, 995, PA_SHIFT, 9 },
+    // State 810
+    { 810, 1000, PA_SHIFT, 811 },
+    // State 810
+    { 810, 1004, PA_SHIFT, 13 },
+    // State 811
+    { 811, 996, PA_SHIFT, 6 },
+    // State 811
+    { 811, 998, PA_REDUCE, 407 },
+    // State 812
+    { 812, 1, PA_SHIFT, 8 },
+    // State 812
+    { 812, 994, PA_SHIFT, 10 },
+    // State 812
+    { 812, 995, PA_SHIFT, 9 },
+    // State 812
+    { 812, 1000, PA_SHIFT, 813 },
+    // State 812
+    { 812, 1004, PA_SHIFT, 13 },
+    // State 813
+    { 813, 996, PA_SHIFT, 6 },
+    // State 813
+    { 813, 998, PA_REDUCE, 408 },
+    // State 814
+    { 814, 1, PA_SHIFT, 8 },
+    // State 814
+    { 814, 994, PA_SHIFT, 10 },
+    // State 814
+    { 814, 995, PA_SHIFT, 9 },
+    // State 814
+    { 814, 1000, PA_SHIFT, 815 },
+    // State 814
+    { 814, 1004, PA_SHIFT, 13 },
+    // State 815
+    { 815, 996, PA_SHIFT, 6 },
+    // State 815
+    { 815, 998, PA_REDUCE, 409 },
+    // State 816
+    { 816, 1, PA_SHIFT, 8 },
+    // State 816
+    { 816, 994, PA_SHIFT, 10 },
+    // State 816
+    { 816, 995, PA_SHIFT, 9 },
+    // State 816
+    { 816, 1000, PA_SHIFT, 817 },
+    // State 816
+    { 816, 1004, PA_SHIFT, 13 },
+    // State 817
+    { 817, 996, PA_SHIFT, 6 },
+    // State 817
+    { 817, 998, PA_REDUCE, 410 },
+    // State 818
+    { 818, 1, PA_SHIFT, 8 },
+    // State 818
+    { 818, 994, PA_SHIFT, 10 },
+    // State 818
+    { 818, 995, PA_SHIFT, 9 },
+    // State 818
+    { 818, 1000, PA_SHIFT, 819 },
+    // State 818
+    { 818, 1004, PA_SHIFT, 13 },
+    // State 819
+    { 819, 996, PA_SHIFT, 6 },
+    // State 819
+    { 819, 998, PA_REDUCE, 411 },
+    // State 820
+    { 820, 1, PA_SHIFT, 8 },
+    // State 820
+    { 820, 994, PA_SHIFT, 10 },
+    // State 820
+    { 820, 995, PA_SHIFT, 9 },
+    // State 820
+    { 820, 1000, PA_SHIFT, 821 },
+    // State 820
+    { 820, 1004, PA_SHIFT, 13 },
+    // State 821
+    { 821, 996, PA_SHIFT, 6 },
+    // State 821
+    { 821, 998, PA_REDUCE, 412 },
+    // State 822
+    { 822, 1, PA_SHIFT, 8 },
+    // State 822
+    { 822, 994, PA_SHIFT, 10 },
+    // State 822
+    { 822, 995, PA_SHIFT, 9 },
+    // State 822
+    { 822, 1000, PA_SHIFT, 823 },
+    // State 822
+    { 822, 1004, PA_SHIFT, 13 },
+    // State 823
+    { 823, 996, PA_SHIFT, 6 },
+    // State 823
+    { 823, 998, PA_REDUCE, 413 },
+    // State 824
+    { 824, 1, PA_SHIFT, 8 },
+    // State 824
+    { 824, 994, PA_SHIFT, 10 },
+    // State 824
+    { 824, 995, PA_SHIFT, 9 },
+    // State 824
+    { 824, 1000, PA_SHIFT, 825 },
+    // State 824
+    { 824, 1004, PA_SHIFT, 13 },
+    // State 825
+    { 825, 996, PA_SHIFT, 6 },
+    // State 825
+    { 825, 998, PA_REDUCE, 414 },
+    // State 826
+    { 826, 1, PA_SHIFT, 8 },
+    // State 826
+    { 826, 994, PA_SHIFT, 10 },
+    // State 826
+    { 826, 995, PA_SHIFT, 9 },
+    // State 826
+    { 826, 1000, PA_SHIFT, 827 },
+    // State 826
+    { 826, 1004, PA_SHIFT, 13 },
+    // State 827
+    { 827, 996, PA_SHIFT, 6 },
+    // State 827
+    { 827, 998, PA_REDUCE, 415 },
+    // State 828
+    { 828, 1, PA_SHIFT, 8 },
+    // State 828
+    { 828, 994, PA_SHIFT, 10 },
+    // State 828
+    { 828, 995, PA_SHIFT, 9 },
+    // State 828
+    { 828, 1000, PA_SHIFT, 829 },
+    // State 828
+    { 828, 1004, PA_SHIFT, 13 },
+    // State 829
+    { 829, 996, PA_SHIFT, 6 },
+    // State 829
+    { 829, 998, PA_REDUCE, 416 },
+    // State 830
+    { 830, 1, PA_SHIFT, 8 },
+    // State 830
+    { 830, 994, PA_SHIFT, 10 },
+    // State 830
+    { 830, 995, PA_SHIFT, 9 },
+    // State 830
+    { 830, 1000, PA_SHIFT, 831 },
+    // State 830
+    { 830, 1004, PA_SHIFT, 13 },
+    // State 831
+    { 831, 996, PA_SHIFT, 6 },
+    // State 831
+    { 831, 998, PA_REDUCE, 417 },
+    // State 832
+    { 832, 1, PA_SHIFT, 8 },
+    // State 832
+    { 832, 994, PA_SHIFT, 10 },
+    // State 832
+    { 832, 995, PA_SHIFT, 9 },
+    // State 832
+    { 832, 1000, PA_SHIFT, 833 },
+    // State 832
+    { 832, 1004, PA_SHIFT, 13 },
+    // State 833
+    { 833, 996, PA_SHIFT, 6 },
+    // State 833
+    { 833, 998, PA_REDUCE, 418 },
+    // State 834
+    { 834, 1, PA_SHIFT, 8 },
+    // State 834
+    { 834, 994, PA_SHIFT, 10 },
+    // State 834
+    { 834, 995, PA_SHIFT, 9 },
+    // State 834
+    { 834, 1000, PA_SHIFT, 835 },
+    // State 834
+    { 834, 1004, PA_SHIFT, 13 },
+    // State 835
+    { 835, 996, PA_SHIFT, 6 },
+    // State 835
+    { 835, 998, PA_REDUCE, 419 },
+    // State 836
+    { 836, 1, PA_SHIFT, 8 },
+    // State 836
+    { 836, 994, PA_SHIFT, 10 },
+    // State 836
+    { 836, 995, PA_SHIFT, 9 },
+    // State 836
+    { 836, 1000, PA_SHIFT, 837 },
+    // State 836
+    { 836, 1004, PA_SHIFT, 13 },
+    // State 837
+    { 837, 996, PA_SHIFT, 6 },
+    // State 837
+    { 837, 998, PA_REDUCE, 420 },
+    // State 838
+    { 838, 1, PA_SHIFT, 8 },
+    // State 838
+    { 838, 994, PA_SHIFT, 10 },
+    // State 838
+    { 838, 995, PA_SHIFT, 9 },
+    // State 838
+    { 838, 1000, PA_SHIFT, 839 },
+    // State 838
+    { 838, 1004, PA_SHIFT, 13 },
+    // State 839
+    { 839, 996, PA_SHIFT, 6 },
+    // State 839
+    { 839, 998, PA_REDUCE, 421 },
+    // State 840
+    { 840, 1, PA_SHIFT, 8 },
+    // State 840
+    { 840, 994, PA_SHIFT, 10 },
+    // State 840
+    { 840, 995, PA_SHIFT, 9 },
+    // State 840
+    { 840, 1000, PA_SHIFT, 841 },
+    // State 840
+    { 840, 1004, PA_SHIFT, 13 },
+    // State 841
+    { 841, 996, PA_SHIFT, 6 },
+    // State 841
+    { 841, 998, PA_REDUCE, 422 },
+    // State 842
+    { 842, 1, PA_SHIFT, 8 },
+    // State 842
+    { 842, 994, PA_SHIFT, 10 },
+    // State 842
+    { 842, 995, PA_SHIFT, 9 },
+    // State 842
+    { 842, 1000, PA_SHIFT, 843 },
+    // State 842
+    { 842, 1004, PA_SHIFT, 13 },
+    // State 843
+    { 843, 996, PA_SHIFT, 6 },
+    // State 843
+    { 843, 998, PA_REDUCE, 423 },
+    // State 844
+    { 844, 1, PA_SHIFT, 8 },
+    // State 844
+    { 844, 994, PA_SHIFT, 10 },
+    // State 844
+    { 844, 995, PA_SHIFT, 9 },
+    // State 844
+    { 844, 1000, PA_SHIFT, 845 },
+    // State 844
+    { 844, 1004, PA_SHIFT, 13 },
+    // State 845
+    { 845, 996, PA_SHIFT, 6 },
+    // State 845
+    { 845, 998, PA_REDUCE, 424 },
+    // State 846
+    { 846, 1, PA_SHIFT, 8 },
+    // State 846
+    { 846, 994, PA_SHIFT, 10 },
+    // State 846
+    { 846, 995, PA_SHIFT, 9 },
+    // State 846
+    { 846, 1000, PA_SHIFT, 847 },
+    // State 846
+    { 846, 1004, PA_SHIFT, 13 },
+    // State 847
+    { 847, 996, PA_SHIFT, 6 },
+    // State 847
+    { 847, 998, PA_REDUCE, 425 },
+    // State 848
+    { 848, 1, PA_SHIFT, 8 },
+    // State 848
+    { 848, 994, PA_SHIFT, 10 },
+    // State 848
+    { 848, 995, PA_SHIFT, 9 },
+    // State 848
+    { 848, 1000, PA_SHIFT, 849 },
+    // State 848
+    { 848, 1004, PA_SHIFT, 13 },
+    // State 849
+    { 849, 996, PA_SHIFT, 6 },
+    // State 849
+    { 849, 998, PA_REDUCE, 426 },
+    // State 850
+    { 850, 1, PA_SHIFT, 8 },
+    // State 850
+    { 850, 994, PA_SHIFT, 10 },
+    // State 850
+    { 850, 995, PA_SHIFT, 9 },
+    // State 850
+    { 850, 1000, PA_SHIFT, 851 },
+    // State 850
+    { 850, 1004, PA_SHIFT, 13 },
+    // State 851
+    { 851, 996, PA_SHIFT, 6 },
+    // State 851
+    { 851, 998, PA_REDUCE, 427 },
+    // State 852
+    { 852, 1, PA_SHIFT, 8 },
+    // State 852
+    { 852, 994, PA_SHIFT, 10 },
+    // State 852
+    { 852, 995, PA_SHIFT, 9 },
+    // State 852
+    { 852, 1000, PA_SHIFT, 853 },
+    // State 852
+    { 852, 1004, PA_SHIFT, 13 },
+    // State 853
+    { 853, 996, PA_SHIFT, 6 },
+    // State 853
+    { 853, 998, PA_REDUCE, 428 },
+    // State 854
+    { 854, 1, PA_SHIFT, 8 },
+    // State 854
+    { 854, 994, PA_SHIFT, 10 },
+    // State 854
+    { 854, 995, PA_SHIFT, 9 },
+    // State 854
+    { 854, 1000, PA_SHIFT, 855 },
+    // State 854
+    { 854, 1004, PA_SHIFT, 13 },
+    // State 855
+    { 855, 996, PA_SHIFT, 6 },
+    // State 855
+    { 855, 998, PA_REDUCE, 429 },
+    // State 856
+    { 856, 1, PA_SHIFT, 8 },
+    // State 856
+    { 856, 994, PA_SHIFT, 10 },
+    // State 856
+    { 856, 995, PA_SHIFT, 9 },
+    // State 856
+    { 856, 1000, PA_SHIFT, 857 },
+    // State 856
+    { 856, 1004, PA_SHIFT, 13 },
+    // State 857
+    { 857, 996, PA_SHIFT, 6 },
+    // State 857
+    { 857, 998, PA_REDUCE, 430 },
+    // State 858
+    { 858, 1, PA_SHIFT, 8 },
+    // State 858
+    { 858, 994, PA_SHIFT, 10 },
+    // State 858
+    { 858, 995, PA_SHIFT, 9 },
+    // State 858
+    { 858, 1000, PA_SHIFT, 859 },
+    // State 858
+    { 858, 1004, PA_SHIFT, 13 },
+    // State 859
+    { 859, 996, PA_SHIFT, 6 },
+    // State 859
+    { 859, 998, PA_REDUCE, 431 },
+    // State 860
+    { 860, 1, PA_SHIFT, 8 },
+    // State 860
+    { 860, 994, PA_SHIFT, 10 },
+    // State 860
+    { 860, 995, PA_SHIFT, 9 },
+    // State 860
+    { 860, 1000, PA_SHIFT, 861 },
+    // State 860
+    { 860, 1004, PA_SHIFT, 13 },
+    // State 861
+    { 861, 996, PA_SHIFT, 6 },
+    // State 861
+    { 861, 998, PA_REDUCE, 432 },
+    // State 862
+    { 862, 1, PA_SHIFT, 8 },
+    // State 862
+    { 862, 994, PA_SHIFT, 10 },
+    // State 862
+    { 862, 995, PA_SHIFT, 9 },
+    // State 862
+    { 862, 1000, PA_SHIFT, 863 },
+    // State 862
+    { 862, 1004, PA_SHIFT, 13 },
+    // State 863
+    { 863, 996, PA_SHIFT, 6 },
+    // State 863
+    { 863, 998, PA_REDUCE, 433 },
+    // State 864
+    { 864, 1, PA_SHIFT, 8 },
+    // State 864
+    { 864, 994, PA_SHIFT, 10 },
+    // State 864
+    { 864, 995, PA_SHIFT, 9 },
+    // State 864
+    { 864, 1000, PA_SHIFT, 865 },
+    // State 864
+    { 864, 1004, PA_SHIFT, 13 },
+    // State 865
+    { 865, 996, PA_SHIFT, 6 },
+    // State 865
+    { 865, 998, PA_REDUCE, 434 },
+    // State 866
+    { 866, 1, PA_SHIFT, 8 },
+    // State 866
+    { 866, 994, PA_SHIFT, 10 },
+    // State 866
+    { 866, 995, PA_SHIFT, 9 },
+    // State 866
+    { 866, 1000, PA_SHIFT, 867 },
+    // State 866
+    { 866, 1004, PA_SHIFT, 13 },
+    // State 867
+    { 867, 996, PA_SHIFT, 6 },
+    // State 867
+    { 867, 998, PA_REDUCE, 435 },
+    // State 868
+    { 868, 1, PA_SHIFT, 8 },
+    // State 868
+    { 868, 994, PA_SHIFT, 10 },
+    // State 868
+    { 868, 995, PA_SHIFT, 9 },
+    // State 868
+    { 868, 1000, PA_SHIFT, 869 },
+    // State 868
+    { 868, 1004, PA_SHIFT, 13 },
+    // State 869
+    { 869, 996, PA_SHIFT, 6 },
+    // State 869
+    { 869, 998, PA_REDUCE, 436 },
+    // State 870
+    { 870, 1, PA_SHIFT, 8 },
+    // State 870
+    { 870, 994, PA_SHIFT, 10 },
+    // State 870
+    { 870, 995, PA_SHIFT, 9 },
+    // State 870
+    { 870, 1000, PA_SHIFT, 871 },
+    // State 870
+    { 870, 1004, PA_SHIFT, 13 },
+    // State 871
+    { 871, 996, PA_SHIFT, 6 },
+    // State 871
+    { 871, 998, PA_REDUCE, 437 },
+    // State 872
+    { 872, 1, PA_SHIFT, 8 },
+    // State 872
+    { 872, 994, PA_SHIFT, 10 },
+    // State 872
+    { 872, 995, PA_SHIFT, 9 },
+    // State 872
+    { 872, 1000, PA_SHIFT, 873 },
+    // State 872
+    { 872, 1004, PA_SHIFT, 13 },
+    // State 873
+    { 873, 996, PA_SHIFT, 6 },
+    // State 873
+    { 873, 998, PA_REDUCE, 438 },
+    // State 874
+    { 874, 1, PA_SHIFT, 8 },
+    // State 874
+    { 874, 994, PA_SHIFT, 10 },
+    // State 874
+    { 874, 995, PA_SHIFT, 9 },
+    // State 874
+    { 874, 1000, PA_SHIFT, 875 },
+    // State 874
+    { 874, 1004, PA_SHIFT, 13 },
+    // State 875
+    { 875, 996, PA_SHIFT, 6 },
+    // State 875
+    { 875, 998, PA_REDUCE, 439 },
+    // State 876
+    { 876, 1, PA_SHIFT, 8 },
+    // State 876
+    { 876, 994, PA_SHIFT, 10 },
+    // State 876
+    { 876, 995, PA_SHIFT, 9 },
+    // State 876
+    { 876, 1000, PA_SHIFT, 877 },
+    // State 876
+    { 876, 1004, PA_SHIFT, 13 },
+    // State 877
+    { 877, 996, PA_SHIFT, 6 },
+    // State 877
+    { 877, 998, PA_REDUCE, 440 },
+    // State 878
+    { 878, 1, PA_SHIFT, 8 },
+    // State 878
+    { 878, 994, PA_SHIFT, 10 },
+    // State 878
+    { 878, 995, PA_SHIFT, 9 },
+    // State 878
+    { 878, 1000, PA_SHIFT, 879 },
+    // State 878
+    { 878, 1004, PA_SHIFT, 13 },
+    // State 879
+    { 879, 996, PA_SHIFT, 6 },
+    // State 879
+    { 879, 998, PA_REDUCE, 441 },
+    // State 880
+    { 880, 1, PA_SHIFT, 8 },
+    // State 880
+    { 880, 994, PA_SHIFT, 10 },
+    // State 880
+    { 880, 995, PA_SHIFT, 9 },
+    // State 880
+    { 880, 1000, PA_SHIFT, 881 },
+    // State 880
+    { 880, 1004, PA_SHIFT, 13 },
+    // State 881
+    { 881, 996, PA_SHIFT, 6 },
+    // State 881
+    { 881, 998, PA_REDUCE, 442 },
+    // State 882
+    { 882, 1, PA_SHIFT, 8 },
+    // State 882
+    { 882, 994, PA_SHIFT, 10 },
+    // State 882
+    { 882, 995, PA_SHIFT, 9 },
+    // State 882
+    { 882, 1000, PA_SHIFT, 883 },
+    // State 882
+    { 882, 1004, PA_SHIFT, 13 },
+    // State 883
+    { 883, 996, PA_SHIFT, 6 },
+    // State 883
+    { 883, 998, PA_REDUCE, 443 },
+    // State 884
+    { 884, 1, PA_SHIFT, 8 },
+    // State 884
+    { 884, 994, PA_SHIFT, 10 },
+    // State 884
+    { 884, 995, PA_SHIFT, 9 },
+    // State 884
+    { 884, 1000, PA_SHIFT, 885 },
+    // State 884
+    { 884, 1004, PA_SHIFT, 13 },
+    // State 885
+    { 885, 996, PA_SHIFT, 6 },
+    // State 885
+    { 885, 998, PA_REDUCE, 444 },
+    // State 886
+    { 886, 1, PA_SHIFT, 8 },
+    // State 886
+    { 886, 994, PA_SHIFT, 10 },
+    // State 886
+    { 886, 995, PA_SHIFT, 9 },
+    // State 886
+    { 886, 1000, PA_SHIFT, 887 },
+    // State 886
+    { 886, 1004, PA_SHIFT, 13 },
+    // State 887
+    { 887, 996, PA_SHIFT, 6 },
+    // State 887
+    { 887, 998, PA_REDUCE, 445 },
+    // State 888
+    { 888, 1, PA_SHIFT, 8 },
+    // State 888
+    { 888, 994, PA_SHIFT, 10 },
+    // State 888
+    { 888, 995, PA_SHIFT, 9 },
+    // State 888
+    { 888, 1000, PA_SHIFT, 889 },
+    // State 888
+    { 888, 1004, PA_SHIFT, 13 },
+    // State 889
+    { 889, 996, PA_SHIFT, 6 },
+    // State 889
+    { 889, 998, PA_REDUCE, 446 },
+    // State 890
+    { 890, 1, PA_SHIFT, 8 },
+    // State 890
+    { 890, 994, PA_SHIFT, 10 },
+    // State 890
+    { 890, 995, PA_SHIFT, 9 },
+    // State 890
+    { 890, 1000, PA_SHIFT, 891 },
+    // State 890
+    { 890, 1004, PA_SHIFT, 13 },
+    // State 891
+    { 891, 996, PA_SHIFT, 6 },
+    // State 891
+    { 891, 998, PA_REDUCE, 447 },
+    // State 892
+    { 892, 1, PA_SHIFT, 8 },
+    // State 892
+    { 892, 994, PA_SHIFT, 10 },
+    // State 892
+    { 892, 995, PA_SHIFT, 9 },
+    // State 892
+    { 892, 1000, PA_SHIFT, 893 },
+    // State 892
+    { 892, 1004, PA_SHIFT, 13 },
+    // State 893
+    { 893, 996, PA_SHIFT, 6 },
+    // State 893
+    { 893, 998, PA_REDUCE, 448 },
+    // State 894
+    { 894, 1, PA_SHIFT, 8 },
+    // State 894
+    { 894, 994, PA_SHIFT, 10 },
+    // State 894
+    { 894, 995, PA_SHIFT, 9 },
+    // State 894
+    { 894, 1000, PA_SHIFT, 895 },
+    // State 894
+    { 894, 1004, PA_SHIFT, 13 },
+    // State 895
+    { 895, 996, PA_SHIFT, 6 },
+    // State 895
+    { 895, 998, PA_REDUCE, 449 },
+    // State 896
+    { 896, 1, PA_SHIFT, 8 },
+    // State 896
+    { 896, 994, PA_SHIFT, 10 },
+    // State 896
+    { 896, 995, PA_SHIFT, 9 },
+    // State 896
+    { 896, 1000, PA_SHIFT, 897 },
+    // State 896
+    { 896, 1004, PA_SHIFT, 13 },
+    // State 897
+    { 897, 996, PA_SHIFT, 6 },
+    // State 897
+    { 897, 998, PA_REDUCE, 450 },
+    // State 898
+    { 898, 1, PA_SHIFT, 8 },
+    // State 898
+    { 898, 994, PA_SHIFT, 10 },
+    // State 898
+    { 898, 995, PA_SHIFT, 9 },
+    // State 898
+    { 898, 1000, PA_SHIFT, 899 },
+    // State 898
+    { 898, 1004, PA_SHIFT, 13 },
+    // State 899
+    { 899, 996, PA_SHIFT, 6 },
+    // State 899
+    { 899, 998, PA_REDUCE, 451 },
+    // State 900
+    { 900, 1, PA_SHIFT, 8 },
+    // State 900
+    { 900, 994, PA_SHIFT, 10 },
+    // State 900
+    { 900, 995, PA_SHIFT, 9 },
+    // State 900
+    { 900, 1000, PA_SHIFT, 901 },
+    // State 900
+    { 900, 1004, PA_SHIFT, 13 },
+    // State 901
+    { 901, 996, PA_SHIFT, 6 },
+    // State 901
+    { 901, 998, PA_REDUCE, 452 },
+    // State 902
+    { 902, 1, PA_SHIFT, 8 },
+    // State 902
+    { 902, 994, PA_SHIFT, 10 },
+    // State 902
+    { 902, 995, PA_SHIFT, 9 },
+    // State 902
+    { 902, 1000, PA_SHIFT, 903 },
+    // State 902
+    { 902, 1004, PA_SHIFT, 13 },
+    // State 903
+    { 903, 996, PA_SHIFT, 6 },
+    // State 903
+    { 903, 998, PA_REDUCE, 453 },
+    // State 904
+    { 904, 1, PA_SHIFT, 8 },
+    // State 904
+    { 904, 994, PA_SHIFT, 10 },
+    // State 904
+    { 904, 995, PA_SHIFT, 9 },
+    // State 904
+    { 904, 1000, PA_SHIFT, 905 },
+    // State 904
+    { 904, 1004, PA_SHIFT, 13 },
+    // State 905
+    { 905, 996, PA_SHIFT, 6 },
+    // State 905
+    { 905, 998, PA_REDUCE, 454 },
+    // State 906
+    { 906, 1, PA_SHIFT, 8 },
+    // State 906
+    { 906, 994, PA_SHIFT, 10 },
+    // State 906
+    { 906, 995, PA_SHIFT, 9 },
+    // State 906
+    { 906, 1000, PA_SHIFT, 907 },
+    // State 906
+    { 906, 1004, PA_SHIFT, 13 },
+    // State 907
+    { 907, 996, PA_SHIFT, 6 },
+    // State 907
+    { 907, 998, PA_REDUCE, 455 },
+    // State 908
+    { 908, 1, PA_SHIFT, 8 },
+    // State 908
+    { 908, 994, PA_SHIFT, 10 },
+    // State 908
+    { 908, 995, PA_SHIFT, 9 },
+    // State 908
+    { 908, 1000, PA_SHIFT, 909 },
+    // State 908
+    { 908, 1004, PA_SHIFT, 13 },
+    // State 909
+    { 909, 996, PA_SHIFT, 6 },
+    // State 909
+    { 909, 998, PA_REDUCE, 456 },
+    // State 910
+    { 910, 1, PA_SHIFT, 8 },
+    // State 910
+    { 910, 994, PA_SHIFT, 10 },
+    // State 910
+    { 910, 995, PA_SHIFT, 9 },
+    // State 910
+    { 910, 1000, PA_SHIFT, 911 },
+    // State 910
+    { 910, 1004, PA_SHIFT, 13 },
+    // State 911
+    { 911, 996, PA_SHIFT, 6 },
+    // State 911
+    { 911, 998, PA_REDUCE, 457 },
+    // State 912
+    { 912, 1, PA_SHIFT, 8 },
+    // State 912
+    { 912, 994, PA_SHIFT, 10 },
+    // State 912
+    { 912, 995, PA_SHIFT, 9 },
+    // State 912
+    { 912, 1000, PA_SHIFT, 913 },
+    // State 912
+    { 912, 1004, PA_SHIFT, 13 },
+    // State 913
+    { 913, 996, PA_SHIFT, 6 },
+    // State 913
+    { 913, 998, PA_REDUCE, 458 },
+    // State 914
+    { 914, 1, PA_SHIFT, 8 },
+    // State 914
+    { 914, 994, PA_SHIFT, 10 },
+    // State 914
+    { 914, 995, PA_SHIFT, 9 },
+    // State 914
+    { 914, 1000, PA_SHIFT, 915 },
+    // State 914
+    { 914, 1004, PA_SHIFT, 13 },
+    // State 915
+    { 915, 996, PA_SHIFT, 6 },
+    // State 915
+    { 915, 998, PA_REDUCE, 459 },
+    // State 916
+    { 916, 1, PA_SHIFT, 8 },
+    // State 916
+    { 916, 994, PA_SHIFT, 10 },
+    // State 916
+    { 916, 995, PA_SHIFT, 9 },
+    // State 916
+    { 916, 1000, PA_SHIFT, 917 },
+    // State 916
+    { 916, 1004, PA_SHIFT, 13 },
+    // State 917
+    { 917, 996, PA_SHIFT, 6 },
+    // State 917
+    { 917, 998, PA_REDUCE, 460 },
+    // State 918
+    { 918, 1, PA_SHIFT, 8 },
+    // State 918
+    { 918, 994, PA_SHIFT, 10 },
+    // State 918
+    { 918, 995, PA_SHIFT, 9 },
+    // State 918
+    { 918, 1000, PA_SHIFT, 919 },
+    // State 918
+    { 918, 1004, PA_SHIFT, 13 },
+    // State 919
+    { 919, 996, PA_SHIFT, 6 },
+    // State 919
+    { 919, 998, PA_REDUCE, 461 },
+    // State 920
+    { 920, 1, PA_SHIFT, 8 },
+    // State 920
+    { 920, 994, PA_SHIFT, 10 },
+    // State 920
+    { 920, 995, PA_SHIFT, 9 },
+    // State 920
+    { 920, 1000, PA_SHIFT, 921 },
+    // State 920
+    { 920, 1004, PA_SHIFT, 13 },
+    // State 921
+    { 921, 996, PA_SHIFT, 6 },
+    // State 921
+    { 921, 998, PA_REDUCE, 462 },
+    // State 922
+    { 922, 1, PA_SHIFT, 8 },
+    // State 922
+    { 922, 994, PA_SHIFT, 10 },
+    // State 922
+    { 922, 995, PA_SHIFT, 9 },
+    // State 922
+    { 922, 1000, PA_SHIFT, 923 },
+    // State 922
+    { 922, 1004, PA_SHIFT, 13 },
+    // State 923
+    { 923, 996, PA_SHIFT, 6 },
+    // State 923
+    { 923, 998, PA_REDUCE, 463 },
+    // State 924
+    { 924, 1, PA_SHIFT, 8 },
+    // State 924
+    { 924, 994, PA_SHIFT, 10 },
+    // State 924
+    { 924, 995, PA_SHIFT, 9 },
+    // State 924
+    { 924, 1000, PA_SHIFT, 925 },
+    // State 924
+    { 924, 1004, PA_SHIFT, 13 },
+    // State 925
+    { 925, 996, PA_SHIFT, 6 },
+    // State 925
+    { 925, 998, PA_REDUCE, 464 },
+    // State 926
+    { 926, 1, PA_SHIFT, 8 },
+    // State 926
+    { 926, 994, PA_SHIFT, 10 },
+    // State 926
+    { 926, 995, PA_SHIFT, 9 },
+    // State 926
+    { 926, 1000, PA_SHIFT, 927 },
+    // State 926
+    { 926, 1004, PA_SHIFT, 13 },
+    // State 927
+    { 927, 996, PA_SHIFT, 6 },
+    // State 927
+    { 927, 998, PA_REDUCE, 465 },
+    // State 928
+    { 928, 1, PA_SHIFT, 8 },
+    // State 928
+    { 928, 994, PA_SHIFT, 10 },
+    // State 928
+    { 928, 995, PA_SHIFT, 9 },
+    // State 928
+    { 928, 1000, PA_SHIFT, 929 },
+    // State 928
+    { 928, 1004, PA_SHIFT, 13 },
+    // State 929
+    { 929, 996, PA_SHIFT, 6 },
+    // State 929
+    { 929, 998, PA_REDUCE, 466 },
+    // State 930
+    { 930, 1, PA_SHIFT, 8 },
+    // State 930
+    { 930, 994, PA_SHIFT, 10 },
+    // State 930
+    { 930, 995, PA_SHIFT, 9 },
+    // State 930
+    { 930, 1000, PA_SHIFT, 931 },
+    // State 930
+    { 930, 1004, PA_SHIFT, 13 },
+    // State 931
+    { 931, 996, PA_SHIFT, 6 },
+    // State 931
+    { 931, 998, PA_REDUCE, 467 },
+    // State 932
+    { 932, 1, PA_SHIFT, 8 },
+    // State 932
+    { 932, 994, PA_SHIFT, 10 },
+    // State 932
+    { 932, 995, PA_SHIFT, 9 },
+    // State 932
+    { 932, 1000, PA_SHIFT, 933 },
+    // State 932
+    { 932, 1004, PA_SHIFT, 13 },
+    // State 933
+    { 933, 996, PA_SHIFT, 6 },
+    // State 933
+    { 933, 998, PA_REDUCE, 468 },
+    // State 934
+    { 934, 1, PA_SHIFT, 8 },
+    // State 934
+    { 934, 994, PA_SHIFT, 10 },
+    // State 934
+    { 934, 995, PA_SHIFT, 9 },
+    // State 934
+    { 934, 1000, PA_SHIFT, 935 },
+    // State 934
+    { 934, 1004, PA_SHIFT, 13 },
+    // State 935
+    { 935, 996, PA_SHIFT, 6 },
+    // State 935
+    { 935, 998, PA_REDUCE, 469 },
+    // State 936
+    { 936, 1, PA_SHIFT, 8 },
+    // State 936
+    { 936, 994, PA_SHIFT, 10 },
+    // State 936
+    { 936, 995, PA_SHIFT, 9 },
+    // State 936
+    { 936, 1000, PA_SHIFT, 937 },
+    // State 936
+    { 936, 1004, PA_SHIFT, 13 },
+    // State 937
+    { 937, 996, PA_SHIFT, 6 },
+    // State 937
+    { 937, 998, PA_REDUCE, 470 },
+    // State 938
+    { 938, 1, PA_SHIFT, 8 },
+    // State 938
+    { 938, 994, PA_SHIFT, 10 },
+    // State 938
+    { 938, 995, PA_SHIFT, 9 },
+    // State 938
+    { 938, 1000, PA_SHIFT, 939 },
+    // State 938
+    { 938, 1004, PA_SHIFT, 13 },
+    // State 939
+    { 939, 996, PA_SHIFT, 6 },
+    // State 939
+    { 939, 998, PA_REDUCE, 471 },
+    // State 940
+    { 940, 1, PA_SHIFT, 8 },
+    // State 940
+    { 940, 994, PA_SHIFT, 10 },
+    // State 940
+    { 940, 995, PA_SHIFT, 9 },
+    // State 940
+    { 940, 1000, PA_SHIFT, 941 },
+    // State 940
+    { 940, 1004, PA_SHIFT, 13 },
+    // State 941
+    { 941, 996, PA_SHIFT, 6 },
+    // State 941
+    { 941, 998, PA_REDUCE, 472 },
+    // State 942
+    { 942, 1, PA_SHIFT, 8 },
+    // State 942
+    { 942, 994, PA_SHIFT, 10 },
+    // State 942
+    { 942, 995, PA_SHIFT, 9 },
+    // State 942
+    { 942, 1000, PA_SHIFT, 943 },
+    // State 942
+    { 942, 1004, PA_SHIFT, 13 },
+    // State 943
+    { 943, 996, PA_SHIFT, 6 },
+    // State 943
+    { 943, 998, PA_REDUCE, 473 },
+    // State 944
+    { 944, 1, PA_SHIFT, 8 },
+    // State 944
+    { 944, 994, PA_SHIFT, 10 },
+    // State 944
+    { 944, 995, PA_SHIFT, 9 },
+    // State 944
+    { 944, 1000, PA_SHIFT, 945 },
+    // State 944
+    { 944, 1004, PA_SHIFT, 13 },
+    // State 945
+    { 945, 996, PA_SHIFT, 6 },
+    // State 945
+    { 945, 998, PA_REDUCE, 474 },
+    // State 946
+    { 946, 1, PA_SHIFT, 8 },
+    // State 946
+    { 946, 994, PA_SHIFT, 10 },
+    // State 946
+    { 946, 995, PA_SHIFT, 9 },
+    // State 946
+    { 946, 1000, PA_SHIFT, 947 },
+    // State 946
+    { 946, 1004, PA_SHIFT, 13 },
+    // State 947
+    { 947, 996, PA_SHIFT, 6 },
+    // State 947
+    { 947, 998, PA_REDUCE, 475 },
+    // State 948
+    { 948, 1, PA_SHIFT, 8 },
+    // State 948
+    { 948, 994, PA_SHIFT, 10 },
+    // State 948
+    { 948, 995, PA_SHIFT, 9 },
+    // State 948
+    { 948, 1000, PA_SHIFT, 949 },
+    // State 948
+    { 948, 1004, PA_SHIFT, 13 },
+    // State 949
+    { 949, 996, PA_SHIFT, 6 },
+    // State 949
+    { 949, 998, PA_REDUCE, 476 },
+    // State 950
+    { 950, 1, PA_SHIFT, 8 },
+    // State 950
+    { 950, 994, PA_SHIFT, 10 },
+    // State 950
+    { 950, 995, PA_SHIFT, 9 },
+    // State 950
+    { 950, 1000, PA_SHIFT, 951 },
+    // State 950
+    { 950, 1004, PA_SHIFT, 13 },
+    // State 951
+    { 951, 996, PA_SHIFT, 6 },
+    // State 951
+    { 951, 998, PA_REDUCE, 477 },
+    // State 952
+    { 952, 1, PA_SHIFT, 8 },
+    // State 952
+    { 952, 994, PA_SHIFT, 10 },
+    // State 952
+    { 952, 995, PA_SHIFT, 9 },
+    // State 952
+    { 952, 1000, PA_SHIFT, 953 },
+    // State 952
+    { 952, 1004, PA_SHIFT, 13 },
+    // State 953
+    { 953, 996, PA_SHIFT, 6 },
+    // State 953
+    { 953, 998, PA_REDUCE, 478 },
+    // State 954
+    { 954, 1, PA_SHIFT, 8 },
+    // State 954
+    { 954, 994, PA_SHIFT, 10 },
+    // State 954
+    { 954, 995, PA_SHIFT, 9 },
+    // State 954
+    { 954, 1000, PA_SHIFT, 955 },
+    // State 954
+    { 954, 1004, PA_SHIFT, 13 },
+    // State 955
+    { 955, 996, PA_SHIFT, 6 },
+    // State 955
+    { 955, 998, PA_REDUCE, 479 },
+    // State 956
+    { 956, 1, PA_SHIFT, 8 },
+    // State 956
+    { 956, 994, PA_SHIFT, 10 },
+    // State 956
+    { 956, 995, PA_SHIFT, 9 },
+    // State 956
+    { 956, 1000, PA_SHIFT, 957 },
+    // State 956
+    { 956, 1004, PA_SHIFT, 13 },
+    // State 957
+    { 957, 996, PA_SHIFT, 6 },
+    // State 957
+    { 957, 998, PA_REDUCE, 480 },
+    // State 958
+    { 958, 1, PA_SHIFT, 8 },
+    // State 958
+    { 958, 994, PA_SHIFT, 10 },
+    // State 958
+    { 958, 995, PA_SHIFT, 9 },
+    // State 958
+    { 958, 1000, PA_SHIFT, 959 },
+    // State 958
+    { 958, 1004, PA_SHIFT, 13 },
+    // State 959
+    { 959, 996, PA_SHIFT, 6 },
+    // State 959
+    { 959, 998, PA_REDUCE, 481 },
+    // State 960
+    { 960, 1, PA_SHIFT, 8 },
+    // State 960
+    { 960, 994, PA_SHIFT, 10 },
+    // State 960
+    { 960, 995, PA_SHIFT, 9 },
+    // State 960
+    { 960, 1000, PA_SHIFT, 961 },
+    // State 960
+    { 960, 1004, PA_SHIFT, 13 },
+    // State 961
+    { 961, 996, PA_SHIFT, 6 },
+    // State 961
+    { 961, 998, PA_REDUCE, 482 },
+    // State 962
+    { 962, 1, PA_SHIFT, 8 },
+    // State 962
+    { 962, 994, PA_SHIFT, 10 },
+    // State 962
+    { 962, 995, PA_SHIFT, 9 },
+    // State 962
+    { 962, 1000, PA_SHIFT, 963 },
+    // State 962
+    { 962, 1004, PA_SHIFT, 13 },
+    // State 963
+    { 963, 996, PA_SHIFT, 6 },
+    // State 963
+    { 963, 998, PA_REDUCE, 483 },
+    // State 964
+    { 964, 1, PA_SHIFT, 8 },
+    // State 964
+    { 964, 994, PA_SHIFT, 10 },
+    // State 964
+    { 964, 995, PA_SHIFT, 9 },
+    // State 964
+    { 964, 1000, PA_SHIFT, 965 },
+    // State 964
+    { 964, 1004, PA_SHIFT, 13 },
+    // State 965
+    { 965, 996, PA_SHIFT, 6 },
+    // State 965
+    { 965, 998, PA_REDUCE, 484 },
+    // State 966
+    { 966, 1, PA_SHIFT, 8 },
+    // State 966
+    { 966, 994, PA_SHIFT, 10 },
+    // State 966
+    { 966, 995, PA_SHIFT, 9 },
+    // State 966
+    { 966, 1000, PA_SHIFT, 967 },
+    // State 966
+    { 966, 1004, PA_SHIFT, 13 },
+    // State 967
+    { 967, 996, PA_SHIFT, 6 },
+    // State 967
+    { 967, 998, PA_REDUCE, 485 },
+    // State 968
+    { 968, 1, PA_SHIFT, 8 },
+    // State 968
+    { 968, 994, PA_SHIFT, 10 },
+    // State 968
+    { 968, 995, PA_SHIFT, 9 },
+    // State 968
+    { 968, 1000, PA_SHIFT, 969 },
+    // State 968
+    { 968, 1004, PA_SHIFT, 13 },
+    // State 969
+    { 969, 996, PA_SHIFT, 6 },
+    // State 969
+    { 969, 998, PA_REDUCE, 486 },
+    // State 970
+    { 970, 1, PA_SHIFT, 8 },
+    // State 970
+    { 970, 994, PA_SHIFT, 10 },
+    // State 970
+    { 970, 995, PA_SHIFT, 9 },
+    // State 970
+    { 970, 1000, PA_SHIFT, 971 },
+    // State 970
+    { 970, 1004, PA_SHIFT, 13 },
+    // State 971
+    { 971, 996, PA_SHIFT, 6 },
+    // State 971
+    { 971, 998, PA_REDUCE, 487 },
+    // State 972
+    { 972, 1, PA_SHIFT, 8 },
+    // State 972
+    { 972, 994, PA_SHIFT, 10 },
+    // State 972
+    { 972, 995, PA_SHIFT, 9 },
+    // State 972
+    { 972, 1000, PA_SHIFT, 973 },
+    // State 972
+    { 972, 1004, PA_SHIFT, 13 },
+    // State 973
+    { 973, 996, PA_SHIFT, 6 },
+    // State 973
+    { 973, 998, PA_REDUCE, 488 },
+    // State 974
+    { 974, 1, PA_SHIFT, 8 },
+    // State 974
+    { 974, 994, PA_SHIFT, 10 },
+    // State 974
+    { 974, 995, PA_SHIFT, 9 },
+    // State 974
+    { 974, 1000, PA_SHIFT, 975 },
+    // State 974
+    { 974, 1004, PA_SHIFT, 13 },
+    // State 975
+    { 975, 996, PA_SHIFT, 6 },
+    // State 975
+    { 975, 998, PA_REDUCE, 489 },
+    // State 976
+    { 976, 1, PA_SHIFT, 8 },
+    // State 976
+    { 976, 994, PA_SHIFT, 10 },
+    // State 976
+    { 976, 995, PA_SHIFT, 9 },
+    // State 976
+    { 976, 1000, PA_SHIFT, 977 },
+    // State 976
+    { 976, 1004, PA_SHIFT, 13 },
+    // State 977
+    { 977, 996, PA_SHIFT, 6 },
+    // State 977
+    { 977, 998, PA_REDUCE, 490 },
+    // State 978
+    { 978, 1, PA_SHIFT, 8 },
+    // State 978
+    { 978, 994, PA_SHIFT, 10 },
+    // State 978
+    { 978, 995, PA_SHIFT, 9 },
+    // State 978
+    { 978, 1000, PA_SHIFT, 979 },
+    // State 978
+    { 978, 1004, PA_SHIFT, 13 },
+    // State 979
+    { 979, 996, PA_SHIFT, 6 },
+    // State 979
+    { 979, 998, PA_REDUCE, 491 },
+    // State 980
+    { 980, 1, PA_SHIFT, 8 },
+    // State 980
+    { 980, 994, PA_SHIFT, 10 },
+    // State 980
+    { 980, 995, PA_SHIFT, 9 },
+    // State 980
+    { 980, 1000, PA_SHIFT, 981 },
+    // State 980
+    { 980, 1004, PA_SHIFT, 13 },
+    // State 981
+    { 981, 996, PA_SHIFT, 6 },
+    // State 981
+    { 981, 998, PA_REDUCE, 492 },
+    // State 982
+    { 982, 1, PA_SHIFT, 8 },
+    // State 982
+    { 982, 994, PA_SHIFT, 10 },
+    // State 982
+    { 982, 995, PA_SHIFT, 9 },
+    // State 982
+    { 982, 1000, PA_SHIFT, 983 },
+    // State 982
+    { 982, 1004, PA_SHIFT, 13 },
+    // State 983
+    { 983, 996, PA_SHIFT, 6 },
+    // State 983
+    { 983, 998, PA_REDUCE, 493 },
+    // State 984
+    { 984, 1, PA_SHIFT, 8 },
+    // State 984
+    { 984, 994, PA_SHIFT, 10 },
+    // State 984
+    { 984, 995, PA_SHIFT, 9 },
+    // State 984
+    { 984, 1000, PA_SHIFT, 985 },
+    // State 984
+    { 984, 1004, PA_SHIFT, 13 },
+    // State 985
+    { 985, 996, PA_SHIFT, 6 },
+    // State 985
+    { 985, 998, PA_REDUCE, 494 },
+    // State 986
+    { 986, 1, PA_SHIFT, 8 },
+    // State 986
+    { 986, 994, PA_SHIFT, 10 },
+    // State 986
+    { 986, 995, PA_SHIFT, 9 },
+    // State 986
+    { 986, 1000, PA_SHIFT, 987 },
+    // State 986
+    { 986, 1004, PA_SHIFT, 13 },
+    // State 987
+    { 987, 996, PA_SHIFT, 6 },
+    // State 987
+    { 987, 998, PA_REDUCE, 495 },
+    // State 988
+    { 988, 1, PA_SHIFT, 8 },
+    // State 988
+    { 988, 994, PA_SHIFT, 10 },
+    // State 988
+    { 988, 995, PA_SHIFT, 9 },
+    // State 988
+    { 988, 1000, PA_SHIFT, 989 },
+    // State 988
+    { 988, 1004, PA_SHIFT, 13 },
+    // State 989
+    { 989, 996, PA_SHIFT, 6 },
+    // State 989
+    { 989, 998, PA_REDUCE, 496 },
+    // State 990
+    { 990, 1, PA_SHIFT, 8 },
+    // State 990
+    { 990, 994, PA_SHIFT, 10 },
+    // State 990
+    { 990, 995, PA_SHIFT, 9 },
+    // State 990
+    { 990, 1000, PA_SHIFT, 991 },
+    // State 990
+    { 990, 1004, PA_SHIFT, 13 },
+    // State 991
+    { 991, 996, PA_SHIFT, 6 },
+    // State 991
+    { 991, 998, PA_REDUCE, 497 },
+    // State 992
+    { 992, 1, PA_SHIFT, 8 },
+    // State 992
+    { 992, 994, PA_SHIFT, 10 },
+    // State 992
+    { 992, 995, PA_SHIFT, 9 },
+    // State 992
+    { 992, 1000, PA_SHIFT, 993 },
+    // State 992
+    { 992, 1004, PA_SHIFT, 13 },
+    // State 993
+    { 993, 996, PA_SHIFT, 6 },
+    // State 993
+    { 993, 998, PA_REDUCE, 498 },
+    // State 994
+    { 994, 1, PA_SHIFT, 8 },
+    // State 994
+    { 994, 994, PA_SHIFT, 10 },
+    // State 994
+    { 994, 995, PA_SHIFT, 9 },
+    // State 994
+    { 994, 1000, PA_SHIFT, 995 },
+    // State 994
+    { 994, 1004, PA_SHIFT, 13 },
+    // State 995
+    { 995, 996, PA_SHIFT, 6 },
+    // State 995
+    { 995, 998, PA_REDUCE, 499 },
+    // State 996
+    { 996, 1, PA_SHIFT, 8 },
+    // State 996
+    { 996, 994, PA_SHIFT, 10 },
+    // State 996
+    { 996, 995, PA_SHIFT, 9 },
+    // State 996
+    { 996, 1000, PA_SHIFT, 997 },
+    // State 996
+    { 996, 1004, PA_SHIFT, 13 },
+    // State 997
+    { 997, 996, PA_SHIFT, 6 },
+    // State 997
+    { 997, 998, PA_REDUCE, 500 },
+    // State 998
+    { 998, 1, PA_SHIFT, 8 },
+    // State 998
+    { 998, 994, PA_SHIFT, 10 },
+    // State 998
+    { 998, 995, PA_SHIFT, 9 },
+    // State 998
+    { 998, 1000, PA_SHIFT, 999 },
+    // State 998
+    { 998, 1004, PA_SHIFT, 13 },
+    // State 999
+    { 999, 996, PA_SHIFT, 6 },
+    // State 999
+    { 999, 998, PA_REDUCE, 501 },
+    // State 1000
+    { 1000, 1, PA_SHIFT, 8 },
+    // State 1000
+    { 1000, 994, PA_SHIFT, 10 },
+    // State 1000
+    { 1000, 995, PA_SHIFT, 9 },
+    // State 1000
+    { 1000, 1000, PA_SHIFT, 1001 },
+    // State 1000
+    { 1000, 1004, PA_SHIFT, 13 },
+    // State 1001
+    { 1001, 996, PA_SHIFT, 6 },
+    // State 1001
+    { 1001, 998, PA_REDUCE, 502 },
+    // State 1002
+    { 1002, 1, PA_SHIFT, 8 },
+    // State 1002
+    { 1002, 994, PA_SHIFT, 10 },
+    // State 1002
+    { 1002, 995, PA_SHIFT, 9 },
+    // State 1002
+    { 1002, 1000, PA_SHIFT, 1003 },
+    // State 1002
+    { 1002, 1004, PA_SHIFT, 13 },
+    // State 1003
+    { 1003, 996, PA_SHIFT, 6 },
+    // State 1003
+    { 1003, 998, PA_REDUCE, 503 },
+    // State 1004
+    { 1004, 1, PA_SHIFT, 8 },
+    // State 1004
+    { 1004, 994, PA_SHIFT, 10 },
+    // State 1004
+    { 1004, 995, PA_SHIFT, 9 },
+    // State 1004
+    { 1004, 1000, PA_SHIFT, 1005 },
+    // State 1004
+    { 1004, 1004, PA_SHIFT, 13 },
+    // State 1005
+    { 1005, 996, PA_SHIFT, 6 },
+    // State 1005
+    { 1005, 998, PA_REDUCE, 504 },
+    // State 1006
+    { 1006, 1, PA_SHIFT, 8 },
+    // State 1006
+    { 1006, 994, PA_SHIFT, 10 },
+    // State 1006
+    { 1006, 995, PA_SHIFT, 9 },
+    // State 1006
+    { 1006, 1000, PA_SHIFT, 1007 },
+    // State 1006
+    { 1006, 1004, PA_SHIFT, 13 },
+    // State 1007
+    { 1007, 996, PA_SHIFT, 6 },
+    // State 1007
+    { 1007, 998, PA_REDUCE, 505 },
+    // State 1008
+    { 1008, 1, PA_SHIFT, 8 },
+    // State 1008
+    { 1008, 994, PA_SHIFT, 10 },
+    // State 1008
+    { 1008, 995, PA_SHIFT, 9 },
+    // State 1008
+    { 1008, 1000, PA_SHIFT, 1009 },
+    // State 1008
+    { 1008, 1004, PA_SHIFT, 13 },
+    // State 1009
+    { 1009, 996, PA_SHIFT, 6 },
+    // State 1009
+    { 1009, 998, PA_REDUCE, 506 },
+    // State 1010
+    { 1010, 1, PA_SHIFT, 8 },
+    // State 1010
+    { 1010, 994, PA_SHIFT, 10 },
+    // State 1010
+    { 1010, 995, PA_SHIFT, 9 },
+    // State 1010
+    { 1010, 1000, PA_SHIFT, 1011 },
+    // State 1010
+    { 1010, 1004, PA_SHIFT, 13 },
+    // State 1011
+    { 1011, 996, PA_SHIFT, 6 },
+    // State 1011
+    { 1011, 998, PA_REDUCE, 507 },
+    // State 1012
+    { 1012, 1, PA_SHIFT, 8 },
+    // State 1012
+    { 1012, 994, PA_SHIFT, 10 },
+    // State 1012
+    { 1012, 995, PA_SHIFT, 9 },
+    // State 1012
+    { 1012, 1000, PA_SHIFT, 1013 },
+    // State 1012
+    { 1012, 1004, PA_SHIFT, 13 },
+    // State 1013
+    { 1013, 996, PA_SHIFT, 6 },
+    // State 1013
+    { 1013, 998, PA_REDUCE, 508 },
+    // State 1014
+    { 1014, 1, PA_SHIFT, 8 },
+    // State 1014
+    { 1014, 994, PA_SHIFT, 10 },
+    // State 1014
+    { 1014, 995, PA_SHIFT, 9 },
+    // State 1014
+    { 1014, 1000, PA_SHIFT, 1015 },
+    // State 1014
+    { 1014, 1004, PA_SHIFT, 13 },
+    // State 1015
+    { 1015, 996, PA_SHIFT, 6 },
+    // State 1015
+    { 1015, 998, PA_REDUCE, 509 },
+    // State 1016
+    { 1016, 1, PA_SHIFT, 8 },
+    // State 1016
+    { 1016, 994, PA_SHIFT, 10 },
+    // State 1016
+    { 1016, 995, PA_SHIFT, 9 },
+    // State 1016
+    { 1016, 1000, PA_SHIFT, 1017 },
+    // State 1016
+    { 1016, 1004, PA_SHIFT, 13 },
+    // State 1017
+    { 1017, 996, PA_SHIFT, 6 },
+    // State 1017
+    { 1017, 998, PA_REDUCE, 510 },
+    // State 1018
+    { 1018, 1, PA_SHIFT, 8 },
+    // State 1018
+    { 1018, 994, PA_SHIFT, 10 },
+    // State 1018
+    { 1018, 995, PA_SHIFT, 9 },
+    // State 1018
+    { 1018, 1000, PA_SHIFT, 1019 },
+    // State 1018
+    { 1018, 1004, PA_SHIFT, 13 },
+    // State 1019
+    { 1019, 996, PA_SHIFT, 6 },
+    // State 1019
+    { 1019, 998, PA_REDUCE, 511 },
+    // State 1020
+    { 1020, 1, PA_SHIFT, 8 },
+    // State 1020
+    { 1020, 994, PA_SHIFT, 10 },
+    // State 1020
+    { 1020, 995, PA_SHIFT, 9 },
+    // State 1020
+    { 1020, 1000, PA_SHIFT, 1021 },
+    // State 1020
+    { 1020, 1004, PA_SHIFT, 13 },
+    // State 1021
+    { 1021, 996, PA_SHIFT, 6 },
+    // State 1021
+    { 1021, 998, PA_REDUCE, 512 },
+    // State 1022
+    { 1022, 1, PA_SHIFT, 8 },
+    // State 1022
+    { 1022, 994, PA_SHIFT, 10 },
+    // State 1022
+    { 1022, 995, PA_SHIFT, 9 },
+    // State 1022
+    { 1022, 1000, PA_SHIFT, 1023 },
+    // State 1022
+    { 1022, 1004, PA_SHIFT, 13 },
+    // State 1023
+    { 1023, 996, PA_SHIFT, 6 },
+    // State 1023
+    { 1023, 998, PA_REDUCE, 513 },
+    // State 1024
+    { 1024, 1, PA_SHIFT, 8 },
+    // State 1024
+    { 1024, 994, PA_SHIFT, 10 },
+    // State 1024
+    { 1024, 995, PA_SHIFT, 9 },
+    // State 1024
+    { 1024, 1000, PA_SHIFT, 1025 },
+    // State 1024
+    { 1024, 1004, PA_SHIFT, 13 },
+    // State 1025
+    { 1025, 996, PA_SHIFT, 6 },
+    // State 1025
+    { 1025, 998, PA_REDUCE, 514 },
+    // State 1026
+    { 1026, 1, PA_SHIFT, 8 },
+    // State 1026
+    { 1026, 994, PA_SHIFT, 10 },
+    // State 1026
+    { 1026, 995, PA_SHIFT, 9 },
+    // State 1026
+    { 1026, 1000, PA_SHIFT, 1027 },
+    // State 1026
+    { 1026, 1004, PA_SHIFT, 13 },
+    // State 1027
+    { 1027, 996, PA_SHIFT, 6 },
+    // State 1027
+    { 1027, 998, PA_REDUCE, 515 },
+    // State 1028
+    { 1028, 1, PA_SHIFT, 8 },
+    // State 1028
+    { 1028, 994, PA_SHIFT, 10 },
+    // State 1028
+    { 1028, 995, PA_SHIFT, 9 },
+    // State 1028
+    { 1028, 1000, PA_SHIFT, 1029 },
+    // State 1028
+    { 1028, 1004, PA_SHIFT, 13 },
+    // State 1029
+    { 1029, 996, PA_SHIFT, 6 },
+    // State 1029
+    { 1029, 998, PA_REDUCE, 516 },
+    // State 1030
+    { 1030, 1, PA_SHIFT, 8 },
+    // State 1030
+    { 1030, 994, PA_SHIFT, 10 },
+    // State 1030
+    { 1030, 995, PA_SHIFT, 9 },
+    // State 1030
+    { 1030, 1000, PA_SHIFT, 1031 },
+    // State 1030
+    { 1030, 1004, PA_SHIFT, 13 },
+    // State 1031
+    { 1031, 996, PA_SHIFT, 6 },
+    // State 1031
+    { 1031, 998, PA_REDUCE, 517 },
+    // State 1032
+    { 1032, 1, PA_SHIFT, 8 },
+    // State 1032
+    { 1032, 994, PA_SHIFT, 10 },
+    // State 1032
+    { 1032, 995, PA_SHIFT, 9 },
+    // State 1032
+    { 1032, 1000, PA_SHIFT, 1033 },
+    // State 1032
+    { 1032, 1004, PA_SHIFT, 13 },
+    // State 1033
+    { 1033, 996, PA_SHIFT, 6 },
+    // State 1033
+    { 1033, 998, PA_REDUCE, 518 },
+    // State 1034
+    { 1034, 1, PA_SHIFT, 8 },
+    // State 1034
+    { 1034, 994, PA_SHIFT, 10 },
+    // State 1034
+    { 1034, 995, PA_SHIFT, 9 },
+    // State 1034
+    { 1034, 1000, PA_SHIFT, 1035 },
+    // State 1034
+    { 1034, 1004, PA_SHIFT, 13 },
+    // State 1035
+    { 1035, 996, PA_SHIFT, 6 },
+    // State 1035
+    { 1035, 998, PA_REDUCE, 519 },
+    // State 1036
+    { 1036, 1, PA_SHIFT, 8 },
+    // State 1036
+    { 1036, 994, PA_SHIFT, 10 },
+    // State 1036
+    { 1036, 995, PA_SHIFT, 9 },
+    // State 1036
+    { 1036, 1000, PA_SHIFT, 1037 },
+    // State 1036
+    { 1036, 1004, PA_SHIFT, 13 },
+    // State 1037
+    { 1037, 996, PA_SHIFT, 6 },
+    // State 1037
+    { 1037, 998, PA_REDUCE, 520 },
+    // State 1038
+    { 1038, 1, PA_SHIFT, 8 },
+    // State 1038
+    { 1038, 994, PA_SHIFT, 10 },
+    // State 1038
+    { 1038, 995, PA_SHIFT, 9 },
+    // State 1038
+    { 1038, 1000, PA_SHIFT, 1039 },
+    // State 1038
+    { 1038, 1004, PA_SHIFT, 13 },
+    // State 1039
+    { 1039, 996, PA_SHIFT, 6 },
+    // State 1039
+    { 1039, 998, PA_REDUCE, 521 },
+    // State 1040
+    { 1040, 1, PA_SHIFT, 8 },
+    // State 1040
+    { 1040, 994, PA_SHIFT, 10 },
+    // State 1040
+    { 1040, 995, PA_SHIFT, 9 },
+    // State 1040
+    { 1040, 1000, PA_SHIFT, 1041 },
+    // State 1040
+    { 1040, 1004, PA_SHIFT, 13 },
+    // State 1041
+    { 1041, 996, PA_SHIFT, 6 },
+    // State 1041
+    { 1041, 998, PA_REDUCE, 522 },
+    // State 1042
+    { 1042, 1, PA_SHIFT, 8 },
+    // State 1042
+    { 1042, 994, PA_SHIFT, 10 },
+    // State 1042
+    { 1042, 995, PA_SHIFT, 9 },
+    // State 1042
+    { 1042, 1000, PA_SHIFT, 1043 },
+    // State 1042
+    { 1042, 1004, PA_SHIFT, 13 },
+    // State 1043
+    { 1043, 996, PA_SHIFT, 6 },
+    // State 1043
+    { 1043, 998, PA_REDUCE, 523 },
+    // State 1044
+    { 1044, 1, PA_SHIFT, 8 },
+    // State 1044
+    { 1044, 994, PA_SHIFT, 10 },
+    // State 1044
+    { 1044, 995, PA_SHIFT, 9 },
+    // State 1044
+    { 1044, 1000, PA_SHIFT, 1045 },
+    // State 1044
+    { 1044, 1004, PA_SHIFT, 13 },
+    // State 1045
+    { 1045, 996, PA_SHIFT, 6 },
+    // State 1045
+    { 1045, 998, PA_REDUCE, 524 },
+    // State 1046
+    { 1046, 1, PA_SHIFT, 8 },
+    // State 1046
+    { 1046, 994, PA_SHIFT, 10 },
+    // State 1046
+    { 1046, 995, PA_SHIFT, 9 },
+    // State 1046
+    { 1046, 1000, PA_SHIFT, 1047 },
+    // State 1046
+    { 1046, 1004, PA_SHIFT, 13 },
+    // State 1047
+    { 1047, 996, PA_SHIFT, 6 },
+    // State 1047
+    { 1047, 998, PA_REDUCE, 525 },
+    // State 1048
+    { 1048, 1, PA_SHIFT, 8 },
+    // State 1048
+    { 1048, 994, PA_SHIFT, 10 },
+    // State 1048
+    { 1048, 995, PA_SHIFT, 9 },
+    // State 1048
+    { 1048, 1000, PA_SHIFT, 1049 },
+    // State 1048
+    { 1048, 1004, PA_SHIFT, 13 },
+    // State 1049
+    { 1049, 996, PA_SHIFT, 6 },
+    // State 1049
+    { 1049, 998, PA_REDUCE, 526 },
+    // State 1050
+    { 1050, 1, PA_SHIFT, 8 },
+    // State 1050
+    { 1050, 994, PA_SHIFT, 10 },
+    // State 1050
+    { 1050, 995, PA_SHIFT, 9 },
+    // State 1050
+    { 1050, 1000, PA_SHIFT, 1051 },
+    // State 1050
+    { 1050, 1004, PA_SHIFT, 13 },
+    // State 1051
+    { 1051, 996, PA_SHIFT, 6 },
+    // State 1051
+    { 1051, 998, PA_REDUCE, 527 },
+    // State 1052
+    { 1052, 1, PA_SHIFT, 8 },
+    // State 1052
+    { 1052, 994, PA_SHIFT, 10 },
+    // State 1052
+    { 1052, 995, PA_SHIFT, 9 },
+    // State 1052
+    { 1052, 1000, PA_SHIFT, 1053 },
+    // State 1052
+    { 1052, 1004, PA_SHIFT, 13 },
+    // State 1053
+    { 1053, 996, PA_SHIFT, 6 },
+    // State 1053
+    { 1053, 998, PA_REDUCE, 528 },
+    // State 1054
+    { 1054, 1, PA_SHIFT, 8 },
+    // State 1054
+    { 1054, 994, PA_SHIFT, 10 },
+    // State 1054
+    { 1054, 995, PA_SHIFT, 9 },
+    // State 1054
+    { 1054, 1000, PA_SHIFT, 1055 },
+    // State 1054
+    { 1054, 1004, PA_SHIFT, 13 },
+    // State 1055
+    { 1055, 996, PA_SHIFT, 6 },
+    // State 1055
+    { 1055, 998, PA_REDUCE, 529 },
+    // State 1056
+    { 1056, 1, PA_SHIFT, 8 },
+    // State 1056
+    { 1056, 994, PA_SHIFT, 10 },
+    // State 1056
+    { 1056, 995, PA_SHIFT, 9 },
+    // State 1056
+    { 1056, 1000, PA_SHIFT, 1057 },
+    // State 1056
+    { 1056, 1004, PA_SHIFT, 13 },
+    // State 1057
+    { 1057, 996, PA_SHIFT, 6 },
+    // State 1057
+    { 1057, 998, PA_REDUCE, 530 },
+    // State 1058
+    { 1058, 1, PA_SHIFT, 8 },
+    // State 1058
+    { 1058, 994, PA_SHIFT, 10 },
+    // State 1058
+    { 1058, 995, PA_SHIFT, 9 },
+    // State 1058
+    { 1058, 1000, PA_SHIFT, 1059 },
+    // State 1058
+    { 1058, 1004, PA_SHIFT, 13 },
+    // State 1059
+    { 1059, 996, PA_SHIFT, 6 },
+    // State 1059
+    { 1059, 998, PA_REDUCE, 531 },
+    // State 1060
+    { 1060, 1, PA_SHIFT, 8 },
+    // State 1060
+    { 1060, 994, PA_SHIFT, 10 },
+    // State 1060
+    { 1060, 995, PA_SHIFT, 9 },
+    // State 1060
+    { 1060, 1000, PA_SHIFT, 1061 },
+    // State 1060
+    { 1060, 1004, PA_SHIFT, 13 },
+    // State 1061
+    { 1061, 996, PA_SHIFT, 6 },
+    // State 1061
+    { 1061, 998, PA_REDUCE, 532 },
+    // State 1062
+    { 1062, 1, PA_SHIFT, 8 },
+    // State 1062
+    { 1062, 994, PA_SHIFT, 10 },
+    // State 1062
+    { 1062, 995, PA_SHIFT, 9 },
+    // State 1062
+    { 1062, 1000, PA_SHIFT, 1063 },
+    // State 1062
+    { 1062, 1004, PA_SHIFT, 13 },
+    // State 1063
+    { 1063, 996, PA_SHIFT, 6 },
+    // State 1063
+    { 1063, 998, PA_REDUCE, 533 },
+    // State 1064
+    { 1064, 1, PA_SHIFT, 8 },
+    // State 1064
+    { 1064, 994, PA_SHIFT, 10 },
+    // State 1064
+    { 1064, 995, PA_SHIFT, 9 },
+    // State 1064
+    { 1064, 1000, PA_SHIFT, 1065 },
+    // State 1064
+    { 1064, 1004, PA_SHIFT, 13 },
+    // State 1065
+    { 1065, 996, PA_SHIFT, 6 },
+    // State 1065
+    { 1065, 998, PA_REDUCE, 534 },
+    // State 1066
+    { 1066, 1, PA_SHIFT, 8 },
+    // State 1066
+    { 1066, 994, PA_SHIFT, 10 },
+    // State 1066
+    { 1066, 995, PA_SHIFT, 9 },
+    // State 1066
+    { 1066, 1000, PA_SHIFT, 1067 },
+    // State 1066
+    { 1066, 1004, PA_SHIFT, 13 },
+    // State 1067
+    { 1067, 996, PA_SHIFT, 6 },
+    // State 1067
+    { 1067, 998, PA_REDUCE, 535 },
+    // State 1068
+    { 1068, 1, PA_SHIFT, 8 },
+    // State 1068
+    { 1068, 994, PA_SHIFT, 10 },
+    // State 1068
+    { 1068, 995, PA_SHIFT, 9 },
+    // State 1068
+    { 1068, 1000, PA_SHIFT, 1069 },
+    // State 1068
+    { 1068, 1004, PA_SHIFT, 13 },
+    // State 1069
+    { 1069, 996, PA_SHIFT, 6 },
+    // State 1069
+    { 1069, 998, PA_REDUCE, 536 },
+    // State 1070
+    { 1070, 1, PA_SHIFT, 8 },
+    // State 1070
+    { 1070, 994, PA_SHIFT, 10 },
+    // State 1070
+    { 1070, 995, PA_SHIFT, 9 },
+    // State 1070
+    { 1070, 1000, PA_SHIFT, 1071 },
+    // State 1070
+    { 1070, 1004, PA_SHIFT, 13 },
+    // State 1071
+    { 1071, 996, PA_SHIFT, 6 },
+    // State 1071
+    { 1071, 998, PA_REDUCE, 537 },
+    // State 1072
+    { 1072, 1, PA_SHIFT, 8 },
+    // State 1072
+    { 1072, 994, PA_SHIFT, 10 },
+    // State 1072
+    { 1072, 995, PA_SHIFT, 9 },
+    // State 1072
+    { 1072, 1000, PA_SHIFT, 1073 },
+    // State 1072
+    { 1072, 1004, PA_SHIFT, 13 },
+    // State 1073
+    { 1073, 996, PA_SHIFT, 6 },
+    // State 1073
+    { 1073, 998, PA_REDUCE, 538 },
+    // State 1074
+    { 1074, 1, PA_SHIFT, 8 },
+    // State 1074
+    { 1074, 994, PA_SHIFT, 10 },
+    // State 1074
+    { 1074, 995, PA_SHIFT, 9 },
+    // State 1074
+    { 1074, 1000, PA_SHIFT, 1075 },
+    // State 1074
+    { 1074, 1004, PA_SHIFT, 13 },
+    // State 1075
+    { 1075, 996, PA_SHIFT, 6 },
+    // State 1075
+    { 1075, 998, PA_REDUCE, 539 },
+    // State 1076
+    { 1076, 1, PA_SHIFT, 8 },
+    // State 1076
+    { 1076, 994, PA_SHIFT, 10 },
+    // State 1076
+    { 1076, 995, PA_SHIFT, 9 },
+    // State 1076
+    { 1076, 1000, PA_SHIFT, 1077 },
+    // State 1076
+    { 1076, 1004, PA_SHIFT, 13 },
+    // State 1077
+    { 1077, 996, PA_SHIFT, 6 },
+    // State 1077
+    { 1077, 998, PA_REDUCE, 540 },
+    // State 1078
+    { 1078, 1, PA_SHIFT, 8 },
+    // State 1078
+    { 1078, 994, PA_SHIFT, 10 },
+    // State 1078
+    { 1078, 995, PA_SHIFT, 9 },
+    // State 1078
+    { 1078, 1000, PA_SHIFT, 1079 },
+    // State 1078
+    { 1078, 1004, PA_SHIFT, 13 },
+    // State 1079
+    { 1079, 996, PA_SHIFT, 6 },
+    // State 1079
+    { 1079, 998, PA_REDUCE, 541 },
+    // State 1080
+    { 1080, 1, PA_SHIFT, 8 },
+    // State 1080
+    { 1080, 994, PA_SHIFT, 10 },
+    // State 1080
+    { 1080, 995, PA_SHIFT, 9 },
+    // State 1080
+    { 1080, 1000, PA_SHIFT, 1081 },
+    // State 1080
+    { 1080, 1004, PA_SHIFT, 13 },
+    // State 1081
+    { 1081, 996, PA_SHIFT, 6 },
+    // State 1081
+    { 1081, 998, PA_REDUCE, 542 },
+    // State 1082
+    { 1082, 1, PA_SHIFT, 8 },
+    // State 1082
+    { 1082, 994, PA_SHIFT, 10 },
+    // State 1082
+    { 1082, 995, PA_SHIFT, 9 },
+    // State 1082
+    { 1082, 1000, PA_SHIFT, 1083 },
+    // State 1082
+    { 1082, 1004, PA_SHIFT, 13 },
+    // State 1083
+    { 1083, 996, PA_SHIFT, 6 },
+    // State 1083
+    { 1083, 998, PA_REDUCE, 543 },
+    // State 1084
+    { 1084, 1, PA_SHIFT, 8 },
+    // State 1084
+    { 1084, 994, PA_SHIFT, 10 },
+    // State 1084
+    { 1084, 995, PA_SHIFT, 9 },
+    // State 1084
+    { 1084, 1000, PA_SHIFT, 1085 },
+    // State 1084
+    { 1084, 1004, PA_SHIFT, 13 },
+    // State 1085
+    { 1085, 996, PA_SHIFT, 6 },
+    // State 1085
+    { 1085, 998, PA_REDUCE, 544 },
+    // State 1086
+    { 1086, 1, PA_SHIFT, 8 },
+    // State 1086
+    { 1086, 994, PA_SHIFT, 10 },
+    // State 1086
+    { 1086, 995, PA_SHIFT, 9 },
+    // State 1086
+    { 1086, 1000, PA_SHIFT, 1087 },
+    // State 1086
+    { 1086, 1004, PA_SHIFT, 13 },
+    // State 1087
+    { 1087, 996, PA_SHIFT, 6 },
+    // State 1087
+    { 1087, 998, PA_REDUCE, 545 },
+    // State 1088
+    { 1088, 1, PA_SHIFT, 8 },
+    // State 1088
+    { 1088, 994, PA_SHIFT, 10 },
+    // State 1088
+    { 1088, 995, PA_SHIFT, 9 },
+    // State 1088
+    { 1088, 1000, PA_SHIFT, 1089 },
+    // State 1088
+    { 1088, 1004, PA_SHIFT, 13 },
+    // State 1089
+    { 1089, 996, PA_SHIFT, 6 },
+    // State 1089
+    { 1089, 998, PA_REDUCE, 546 },
+    // State 1090
+    { 1090, 1, PA_SHIFT, 8 },
+    // State 1090
+    { 1090, 994, PA_SHIFT, 10 },
+    // State 1090
+    { 1090, 995, PA_SHIFT, 9 },
+    // State 1090
+    { 1090, 1000, PA_SHIFT, 1091 },
+    // State 1090
+    { 1090, 1004, PA_SHIFT, 13 },
+    // State 1091
+    { 1091, 996, PA_SHIFT, 6 },
+    // State 1091
+    { 1091, 998, PA_REDUCE, 547 },
+    // State 1092
+    { 1092, 1, PA_SHIFT, 8 },
+    // State 1092
+    { 1092, 994, PA_SHIFT, 10 },
+    // State 1092
+    { 1092, 995, PA_SHIFT, 9 },
+    // State 1092
+    { 1092, 1000, PA_SHIFT, 1093 },
+    // State 1092
+    { 1092, 1004, PA_SHIFT, 13 },
+    // State 1093
+    { 1093, 996, PA_SHIFT, 6 },
+    // State 1093
+    { 1093, 998, PA_REDUCE, 548 },
+    // State 1094
+    { 1094, 1, PA_SHIFT, 8 },
+    // State 1094
+    { 1094, 994, PA_SHIFT, 10 },
+    // State 1094
+    { 1094, 995, PA_SHIFT, 9 },
+    // State 1094
+    { 1094, 1000, PA_SHIFT, 1095 },
+    // State 1094
+    { 1094, 1004, PA_SHIFT, 13 },
+    // State 1095
+    { 1095, 996, PA_SHIFT, 6 },
+    // State 1095
+    { 1095, 998, PA_REDUCE, 549 },
+    // State 1096
+    { 1096, 1, PA_SHIFT, 8 },
+    // State 1096
+    { 1096, 994, PA_SHIFT, 10 },
+    // State 1096
+    { 1096, 995, PA_SHIFT, 9 },
+    // State 1096
+    { 1096, 1000, PA_SHIFT, 1097 },
+    // State 1096
+    { 1096, 1004, PA_SHIFT, 13 },
+    // State 1097
+    { 1097, 996, PA_SHIFT, 6 },
+    // State 1097
+    { 1097, 998, PA_REDUCE, 550 },
+    // State 1098
+    { 1098, 1, PA_SHIFT, 8 },
+    // State 1098
+    { 1098, 994, PA_SHIFT, 10 },
+    // State 1098
+    { 1098, 995, PA_SHIFT, 9 },
+    // State 1098
+    { 1098, 1000, PA_SHIFT, 1099 },
+    // State 1098
+    { 1098, 1004, PA_SHIFT, 13 },
+    // State 1099
+    { 1099, 996, PA_SHIFT, 6 },
+    // State 1099
+    { 1099, 998, PA_REDUCE, 551 },
+    // State 1100
+    { 1100, 1, PA_SHIFT, 8 },
+    // State 1100
+    { 1100, 994, PA_SHIFT, 10 },
+    // State 1100
+    { 1100, 995, PA_SHIFT, 9 },
+    // State 1100
+    { 1100, 1000, PA_SHIFT, 1101 },
+    // State 1100
+    { 1100, 1004, PA_SHIFT, 13 },
+    // State 1101
+    { 1101, 996, PA_SHIFT, 6 },
+    // State 1101
+    { 1101, 998, PA_REDUCE, 552 },
+    // State 1102
+    { 1102, 1, PA_SHIFT, 8 },
+    // State 1102
+    { 1102, 994, PA_SHIFT, 10 },
+    // State 1102
+    { 1102, 995, PA_SHIFT, 9 },
+    // State 1102
+    { 1102, 1000, PA_SHIFT, 1103 },
+    // State 1102
+    { 1102, 1004, PA_SHIFT, 13 },
+    // State 1103
+    { 1103, 996, PA_SHIFT, 6 },
+    // State 1103
+    { 1103, 998, PA_REDUCE, 553 },
+    // State 1104
+    { 1104, 1, PA_SHIFT, 8 },
+    // State 1104
+    { 1104, 994, PA_SHIFT, 10 },
+    // State 1104
+    { 1104, 995, PA_SHIFT, 9 },
+    // State 1104
+    { 1104, 1000, PA_SHIFT, 1105 },
+    // State 1104
+    { 1104, 1004, PA_SHIFT, 13 },
+    // State 1105
+    { 1105, 996, PA_SHIFT, 6 },
+    // State 1105
+    { 1105, 998, PA_REDUCE, 554 },
+    // State 1106
+    { 1106, 1, PA_SHIFT, 8 },
+    // State 1106
+    { 1106, 994, PA_SHIFT, 10 },
+    // State 1106
+    { 1106, 995, PA_SHIFT, 9 },
+    // State 1106
+    { 1106, 1000, PA_SHIFT, 1107 },
+    // State 1106
+    { 1106, 1004, PA_SHIFT, 13 },
+    // State 1107
+    { 1107, 996, PA_SHIFT, 6 },
+    // State 1107
+    { 1107, 998, PA_REDUCE, 555 },
+    // State 1108
+    { 1108, 1, PA_SHIFT, 8 },
+    // State 1108
+    { 1108, 994, PA_SHIFT, 10 },
+    // State 1108
+    { 1108, 995, PA_SHIFT, 9 },
+    // State 1108
+    { 1108, 1000, PA_SHIFT, 1109 },
+    // State 1108
+    { 1108, 1004, PA_SHIFT, 13 },
+    // State 1109
+    { 1109, 996, PA_SHIFT, 6 },
+    // State 1109
+    { 1109, 998, PA_REDUCE, 556 },
+    // State 1110
+    { 1110, 1, PA_SHIFT, 8 },
+    // State 1110
+    { 1110, 994, PA_SHIFT, 10 },
+    // State 1110
+    { 1110, 995, PA_SHIFT, 9 },
+    // State 1110
+    { 1110, 1000, PA_SHIFT, 1111 },
+    // State 1110
+    { 1110, 1004, PA_SHIFT, 13 },
+    // State 1111
+    { 1111, 996, PA_SHIFT, 6 },
+    // State 1111
+    { 1111, 998, PA_REDUCE, 557 },
+    // State 1112
+    { 1112, 1, PA_SHIFT, 8 },
+    // State 1112
+    { 1112, 994, PA_SHIFT, 10 },
+    // State 1112
+    { 1112, 995, PA_SHIFT, 9 },
+    // State 1112
+    { 1112, 1000, PA_SHIFT, 1113 },
+    // State 1112
+    { 1112, 1004, PA_SHIFT, 13 },
+    // State 1113
+    { 1113, 996, PA_SHIFT, 6 },
+    // State 1113
+    { 1113, 998, PA_REDUCE, 558 },
+    // State 1114
+    { 1114, 1, PA_SHIFT, 8 },
+    // State 1114
+    { 1114, 994, PA_SHIFT, 10 },
+    // State 1114
+    { 1114, 995, PA_SHIFT, 9 },
+    // State 1114
+    { 1114, 1000, PA_SHIFT, 1115 },
+    // State 1114
+    { 1114, 1004, PA_SHIFT, 13 },
+    // State 1115
+    { 1115, 996, PA_SHIFT, 6 },
+    // State 1115
+    { 1115, 998, PA_REDUCE, 559 },
+    // State 1116
+    { 1116, 1, PA_SHIFT, 8 },
+    // State 1116
+    { 1116, 994, PA_SHIFT, 10 },
+    // State 1116
+    { 1116, 995, PA_SHIFT, 9 },
+    // State 1116
+    { 1116, 1000, PA_SHIFT, 1117 },
+    // State 1116
+    { 1116, 1004, PA_SHIFT, 13 },
+    // State 1117
+    { 1117, 996, PA_SHIFT, 6 },
+    // State 1117
+    { 1117, 998, PA_REDUCE, 560 },
+    // State 1118
+    { 1118, 1, PA_SHIFT, 8 },
+    // State 1118
+    { 1118, 994, PA_SHIFT, 10 },
+    // State 1118
+    { 1118, 995, PA_SHIFT, 9 },
+    // State 1118
+    { 1118, 1000, PA_SHIFT, 1119 },
+    // State 1118
+    { 1118, 1004, PA_SHIFT, 13 },
+    // State 1119
+    { 1119, 996, PA_SHIFT, 6 },
+    // State 1119
+    { 1119, 998, PA_REDUCE, 561 },
+    // State 1120
+    { 1120, 1, PA_SHIFT, 8 },
+    // State 1120
+    { 1120, 994, PA_SHIFT, 10 },
+    // State 1120
+    { 1120, 995, PA_SHIFT, 9 },
+    // State 1120
+    { 1120, 1000, PA_SHIFT, 1121 },
+    // State 1120
+    { 1120, 1004, PA_SHIFT, 13 },
+    // State 1121
+    { 1121, 996, PA_SHIFT, 6 },
+    // State 1121
+    { 1121, 998, PA_REDUCE, 562 },
+    // State 1122
+    { 1122, 1, PA_SHIFT, 8 },
+    // State 1122
+    { 1122, 994, PA_SHIFT, 10 },
+    // State 1122
+    { 1122, 995, PA_SHIFT, 9 },
+    // State 1122
+    { 1122, 1000, PA_SHIFT, 1123 },
+    // State 1122
+    { 1122, 1004, PA_SHIFT, 13 },
+    // State 1123
+    { 1123, 996, PA_SHIFT, 6 },
+    // State 1123
+    { 1123, 998, PA_REDUCE, 563 },
+    // State 1124
+    { 1124, 1, PA_SHIFT, 8 },
+    // State 1124
+    { 1124, 994, PA_SHIFT, 10 },
+    // State 1124
+    { 1124, 995, PA_SHIFT, 9 },
+    // State 1124
+    { 1124, 1000, PA_SHIFT, 1125 },
+    // State 1124
+    { 1124, 1004, PA_SHIFT, 13 },
+    // State 1125
+    { 1125, 996, PA_SHIFT, 6 },
+    // State 1125
+    { 1125, 998, PA_REDUCE, 564 },
+    // State 1126
+    { 1126, 1, PA_SHIFT, 8 },
+    // State 1126
+    { 1126, 994, PA_SHIFT, 10 },
+    // State 1126
+    { 1126, 995, PA_SHIFT, 9 },
+    // State 1126
+    { 1126, 1000, PA_SHIFT, 1127 },
+    // State 1126
+    { 1126, 1004, PA_SHIFT, 13 },
+    // State 1127
+    { 1127, 996, PA_SHIFT, 6 },
+    // State 1127
+    { 1127, 998, PA_REDUCE, 565 },
+    // State 1128
+    { 1128, 1, PA_SHIFT, 8 },
+    // State 1128
+    { 1128, 994, PA_SHIFT, 10 },
+    // State 1128
+    { 1128, 995, PA_SHIFT, 9 },
+    // State 1128
+    { 1128, 1000, PA_SHIFT, 1129 },
+    // State 1128
+    { 1128, 1004, PA_SHIFT, 13 },
+    // State 1129
+    { 1129, 996, PA_SHIFT, 6 },
+    // State 1129
+    { 1129, 998, PA_REDUCE, 566 },
+    // State 1130
+    { 1130, 1, PA_SHIFT, 8 },
+    // State 1130
+    { 1130, 994, PA_SHIFT, 10 },
+    // State 1130
+    { 1130, 995, PA_SHIFT, 9 },
+    // State 1130
+    { 1130, 1000, PA_SHIFT, 1131 },
+    // State 1130
+    { 1130, 1004, PA_SHIFT, 13 },
+    // State 1131
+    { 1131, 996, PA_SHIFT, 6 },
+    // State 1131
+    { 1131, 998, PA_REDUCE, 567 },
+    // State 1132
+    { 1132, 1, PA_SHIFT, 8 },
+    // State 1132
+    { 1132, 994, PA_SHIFT, 10 },
+    // State 1132
+    { 1132, 995, PA_SHIFT, 9 },
+    // State 1132
+    { 1132, 1000, PA_SHIFT, 1133 },
+    // State 1132
+    { 1132, 1004, PA_SHIFT, 13 },
+    // State 1133
+    { 1133, 996, PA_SHIFT, 6 },
+    // State 1133
+    { 1133, 998, PA_REDUCE, 568 },
+    // State 1134
+    { 1134, 1, PA_SHIFT, 8 },
+    // State 1134
+    { 1134, 994, PA_SHIFT, 10 },
+    // State 1134
+    { 1134, 995, PA_SHIFT, 9 },
+    // State 1134
+    { 1134, 1000, PA_SHIFT, 1135 },
+    // State 1134
+    { 1134, 1004, PA_SHIFT, 13 },
+    // State 1135
+    { 1135, 996, PA_SHIFT, 6 },
+    // State 1135
+    { 1135, 998, PA_REDUCE, 569 },
+    // State 1136
+    { 1136, 1, PA_SHIFT, 8 },
+    // State 1136
+    { 1136, 994, PA_SHIFT, 10 },
+    // State 1136
+    { 1136, 995, PA_SHIFT, 9 },
+    // State 1136
+    { 1136, 1000, PA_SHIFT, 1137 },
+    // State 1136
+    { 1136, 1004, PA_SHIFT, 13 },
+    // State 1137
+    { 1137, 996, PA_SHIFT, 6 },
+    // State 1137
+    { 1137, 998, PA_REDUCE, 570 },
+    // State 1138
+    { 1138, 1, PA_SHIFT, 8 },
+    // State 1138
+    { 1138, 994, PA_SHIFT, 10 },
+    // State 1138
+    { 1138, 995, PA_SHIFT, 9 },
+    // State 1138
+    { 1138, 1000, PA_SHIFT, 1139 },
+    // State 1138
+    { 1138, 1004, PA_SHIFT, 13 },
+    // State 1139
+    { 1139, 996, PA_SHIFT, 6 },
+    // State 1139
+    { 1139, 998, PA_REDUCE, 571 },
+    // State 1140
+    { 1140, 1, PA_SHIFT, 8 },
+    // State 1140
+    { 1140, 994, PA_SHIFT, 10 },
+    // State 1140
+    { 1140, 995, PA_SHIFT, 9 },
+    // State 1140
+    { 1140, 1000, PA_SHIFT, 1141 },
+    // State 1140
+    { 1140, 1004, PA_SHIFT, 13 },
+    // State 1141
+    { 1141, 996, PA_SHIFT, 6 },
+    // State 1141
+    { 1141, 998, PA_REDUCE, 572 },
+    // State 1142
+    { 1142, 1, PA_SHIFT, 8 },
+    // State 1142
+    { 1142, 994, PA_SHIFT, 10 },
+    // State 1142
+    { 1142, 995, PA_SHIFT, 9 },
+    // State 1142
+    { 1142, 1000, PA_SHIFT, 1143 },
+    // State 1142
+    { 1142, 1004, PA_SHIFT, 13 },
+    // State 1143
+    { 1143, 996, PA_SHIFT, 6 },
+    // State 1143
+    { 1143, 998, PA_REDUCE, 573 },
+    // State 1144
+    { 1144, 1, PA_SHIFT, 8 },
+    // State 1144
+    { 1144, 994, PA_SHIFT, 10 },
+    // State 1144
+    { 1144, 995, PA_SHIFT, 9 },
+    // State 1144
+    { 1144, 1000, PA_SHIFT, 1145 },
+    // State 1144
+    { 1144, 1004, PA_SHIFT, 13 },
+    // State 1145
+    { 1145, 996, PA_SHIFT, 6 },
+    // State 1145
+    { 1145, 998, PA_REDUCE, 574 },
+    // State 1146
+    { 1146, 1, PA_SHIFT, 8 },
+    // State 1146
+    { 1146, 994, PA_SHIFT, 10 },
+    // State 1146
+    { 1146, 995, PA_SHIFT, 9 },
+    // State 1146
+    { 1146, 1000, PA_SHIFT, 1147 },
+    // State 1146
+    { 1146, 1004, PA_SHIFT, 13 },
+    // State 1147
+    { 1147, 996, PA_SHIFT, 6 },
+    // State 1147
+    { 1147, 998, PA_REDUCE, 575 },
+    // State 1148
+    { 1148, 1, PA_SHIFT, 8 },
+    // State 1148
+    { 1148, 994, PA_SHIFT, 10 },
+    // State 1148
+    { 1148, 995, PA_SHIFT, 9 },
+    // State 1148
+    { 1148, 1000, PA_SHIFT, 1149 },
+    // State 1148
+    { 1148, 1004, PA_SHIFT, 13 },
+    // State 1149
+    { 1149, 996, PA_SHIFT, 6 },
+    // State 1149
+    { 1149, 998, PA_REDUCE, 576 },
+    // State 1150
+    { 1150, 1, PA_SHIFT, 8 },
+    // State 1150
+    { 1150, 994, PA_SHIFT, 10 },
+    // State 1150
+    { 1150, 995, PA_SHIFT, 9 },
+    // State 1150
+    { 1150, 1000, PA_SHIFT, 1151 },
+    // State 1150
+    { 1150, 1004, PA_SHIFT, 13 },
+    // State 1151
+    { 1151, 996, PA_SHIFT, 6 },
+    // State 1151
+    { 1151, 998, PA_REDUCE, 577 },
+    // State 1152
+    { 1152, 1, PA_SHIFT, 8 },
+    // State 1152
+    { 1152, 994, PA_SHIFT, 10 },
+    // State 1152
+    { 1152, 995, PA_SHIFT, 9 },
+    // State 1152
+    { 1152, 1000, PA_SHIFT, 1153 },
+    // State 1152
+    { 1152, 1004, PA_SHIFT, 13 },
+    // State 1153
+    { 1153, 996, PA_SHIFT, 6 },
+    // State 1153
+    { 1153, 998, PA_REDUCE, 578 },
+    // State 1154
+    { 1154, 1, PA_SHIFT, 8 },
+    // State 1154
+    { 1154, 994, PA_SHIFT, 10 },
+    // State 1154
+    { 1154, 995, PA_SHIFT, 9 },
+    // State 1154
+    { 1154, 1000, PA_SHIFT, 1155 },
+    // State 1154
+    { 1154, 1004, PA_SHIFT, 13 },
+    // State 1155
+    { 1155, 996, PA_SHIFT, 6 },
+    // State 1155
+    { 1155, 998, PA_REDUCE, 579 },
+    // State 1156
+    { 1156, 1, PA_SHIFT, 8 },
+    // State 1156
+    { 1156, 994, PA_SHIFT, 10 },
+    // State 1156
+    { 1156, 995, PA_SHIFT, 9 },
+    // State 1156
+    { 1156, 1000, PA_SHIFT, 1157 },
+    // State 1156
+    { 1156, 1004, PA_SHIFT, 13 },
+    // State 1157
+    { 1157, 996, PA_SHIFT, 6 },
+    // State 1157
+    { 1157, 998, PA_REDUCE, 580 },
+    // State 1158
+    { 1158, 1, PA_SHIFT, 8 },
+    // State 1158
+    { 1158, 994, PA_SHIFT, 10 },
+    // State 1158
+    { 1158, 995, PA_SHIFT, 9 },
+    // State 1158
+    { 1158, 1000, PA_SHIFT, 1159 },
+    // State 1158
+    { 1158, 1004, PA_SHIFT, 13 },
+    // State 1159
+    { 1159, 996, PA_SHIFT, 6 },
+    // State 1159
+    { 1159, 998, PA_REDUCE, 581 },
+    // State 1160
+    { 1160, 1, PA_SHIFT, 8 },
+    // State 1160
+    { 1160, 994, PA_SHIFT, 10 },
+    // State 1160
+    { 1160, 995, PA_SHIFT, 9 },
+    // State 1160
+    { 1160, 1000, PA_SHIFT, 1161 },
+    // State 1160
+    { 1160, 1004, PA_SHIFT, 13 },
+    // State 1161
+    { 1161, 996, PA_SHIFT, 6 },
+    // State 1161
+    { 1161, 998, PA_REDUCE, 582 },
+    // State 1162
+    { 1162, 1, PA_SHIFT, 8 },
+    // State 1162
+    { 1162, 994, PA_SHIFT, 10 },
+    // State 1162
+    { 1162, 995, PA_SHIFT, 9 },
+    // State 1162
+    { 1162, 1000, PA_SHIFT, 1163 },
+    // State 1162
+    { 1162, 1004, PA_SHIFT, 13 },
+    // State 1163
+    { 1163, 996, PA_SHIFT, 6 },
+    // State 1163
+    { 1163, 998, PA_REDUCE, 583 },
+    // State 1164
+    { 1164, 1, PA_SHIFT, 8 },
+    // State 1164
+    { 1164, 994, PA_SHIFT, 10 },
+    // State 1164
+    { 1164, 995, PA_SHIFT, 9 },
+    // State 1164
+    { 1164, 1000, PA_SHIFT, 1165 },
+    // State 1164
+    { 1164, 1004, PA_SHIFT, 13 },
+    // State 1165
+    { 1165, 996, PA_SHIFT, 6 },
+    // State 1165
+    { 1165, 998, PA_REDUCE, 584 },
+    // State 1166
+    { 1166, 1, PA_SHIFT, 8 },
+    // State 1166
+    { 1166, 994, PA_SHIFT, 10 },
+    // State 1166
+    { 1166, 995, PA_SHIFT, 9 },
+    // State 1166
+    { 1166, 1000, PA_SHIFT, 1167 },
+    // State 1166
+    { 1166, 1004, PA_SHIFT, 13 },
+    // State 1167
+    { 1167, 996, PA_SHIFT, 6 },
+    // State 1167
+    { 1167, 998, PA_REDUCE, 585 },
+    // State 1168
+    { 1168, 1, PA_SHIFT, 8 },
+    // State 1168
+    { 1168, 994, PA_SHIFT, 10 },
+    // State 1168
+    { 1168, 995, PA_SHIFT, 9 },
+    // State 1168
+    { 1168, 1000, PA_SHIFT, 1169 },
+    // State 1168
+    { 1168, 1004, PA_SHIFT, 13 },
+    // State 1169
+    { 1169, 996, PA_SHIFT, 6 },
+    // State 1169
+    { 1169, 998, PA_REDUCE, 586 },
+    // State 1170
+    { 1170, 1, PA_SHIFT, 8 },
+    // State 1170
+    { 1170, 994, PA_SHIFT, 10 },
+    // State 1170
+    { 1170, 995, PA_SHIFT, 9 },
+    // State 1170
+    { 1170, 1000, PA_SHIFT, 1171 },
+    // State 1170
+    { 1170, 1004, PA_SHIFT, 13 },
+    // State 1171
+    { 1171, 996, PA_SHIFT, 6 },
+    // State 1171
+    { 1171, 998, PA_REDUCE, 587 },
+    // State 1172
+    { 1172, 1, PA_SHIFT, 8 },
+    // State 1172
+    { 1172, 994, PA_SHIFT, 10 },
+    // State 1172
+    { 1172, 995, PA_SHIFT, 9 },
+    // State 1172
+    { 1172, 1000, PA_SHIFT, 1173 },
+    // State 1172
+    { 1172, 1004, PA_SHIFT, 13 },
+    // State 1173
+    { 1173, 996, PA_SHIFT, 6 },
+    // State 1173
+    { 1173, 998, PA_REDUCE, 588 },
+    // State 1174
+    { 1174, 1, PA_SHIFT, 8 },
+    // State 1174
+    { 1174, 994, PA_SHIFT, 10 },
+    // State 1174
+    { 1174, 995, PA_SHIFT, 9 },
+    // State 1174
+    { 1174, 1000, PA_SHIFT, 1175 },
+    // State 1174
+    { 1174, 1004, PA_SHIFT, 13 },
+    // State 1175
+    { 1175, 996, PA_SHIFT, 6 },
+    // State 1175
+    { 1175, 998, PA_REDUCE, 589 },
+    // State 1176
+    { 1176, 1, PA_SHIFT, 8 },
+    // State 1176
+    { 1176, 994, PA_SHIFT, 10 },
+    // State 1176
+    { 1176, 995, PA_SHIFT, 9 },
+    // State 1176
+    { 1176, 1000, PA_SHIFT, 1177 },
+    // State 1176
+    { 1176, 1004, PA_SHIFT, 13 },
+    // State 1177
+    { 1177, 996, PA_SHIFT, 6 },
+    // State 1177
+    { 1177, 998, PA_REDUCE, 590 },
+    // State 1178
+    { 1178, 1, PA_SHIFT, 8 },
+    // State 1178
+    { 1178, 994, PA_SHIFT, 10 },
+    // State 1178
+    { 1178, 995, PA_SHIFT, 9 },
+    // State 1178
+    { 1178, 1000, PA_SHIFT, 1179 },
+    // State 1178
+    { 1178, 1004, PA_SHIFT, 13 },
+    // State 1179
+    { 1179, 996, PA_SHIFT, 6 },
+    // State 1179
+    { 1179, 998, PA_REDUCE, 591 },
+    // State 1180
+    { 1180, 1, PA_SHIFT, 8 },
+    // State 1180
+    { 1180, 994, PA_SHIFT, 10 },
+    // State 1180
+    { 1180, 995, PA_SHIFT, 9 },
+    // State 1180
+    { 1180, 1000, PA_SHIFT, 1181 },
+    // State 1180
+    { 1180, 1004, PA_SHIFT, 13 },
+    // State 1181
+    { 1181, 996, PA_SHIFT, 6 },
+    // State 1181
+    { 1181, 998, PA_REDUCE, 592 },
+    // State 1182
+    { 1182, 1, PA_SHIFT, 8 },
+    // State 1182
+    { 1182, 994, PA_SHIFT, 10 },
+    // State 1182
+    { 1182, 995, PA_SHIFT, 9 },
+    // State 1182
+    { 1182, 1000, PA_SHIFT, 1183 },
+    // State 1182
+    { 1182, 1004, PA_SHIFT, 13 },
+    // State 1183
+    { 1183, 996, PA_SHIFT, 6 },
+    // State 1183
+    { 1183, 998, PA_REDUCE, 593 },
+    // State 1184
+    { 1184, 1, PA_SHIFT, 8 },
+    // State 1184
+    { 1184, 994, PA_SHIFT, 10 },
+    // State 1184
+    { 1184, 995, PA_SHIFT, 9 },
+    // State 1184
+    { 1184, 1000, PA_SHIFT, 1185 },
+    // State 1184
+    { 1184, 1004, PA_SHIFT, 13 },
+    // State 1185
+    { 1185, 996, PA_SHIFT, 6 },
+    // State 1185
+    { 1185, 998, PA_REDUCE, 594 },
+    // State 1186
+    { 1186, 1, PA_SHIFT, 8 },
+    // State 1186
+    { 1186, 994, PA_SHIFT, 10 },
+    // State 1186
+    { 1186, 995, PA_SHIFT, 9 },
+    // State 1186
+    { 1186, 1000, PA_SHIFT, 1187 },
+    // State 1186
+    { 1186, 1004, PA_SHIFT, 13 },
+    // State 1187
+    { 1187, 996, PA_SHIFT, 6 },
+    // State 1187
+    { 1187, 998, PA_REDUCE, 595 },
+    // State 1188
+    { 1188, 1, PA_SHIFT, 8 },
+    // State 1188
+    { 1188, 994, PA_SHIFT, 10 },
+    // State 1188
+    { 1188, 995, PA_SHIFT, 9 },
+    // State 1188
+    { 1188, 1000, PA_SHIFT, 1189 },
+    // State 1188
+    { 1188, 1004, PA_SHIFT, 13 },
+    // State 1189
+    { 1189, 996, PA_SHIFT, 6 },
+    // State 1189
+    { 1189, 998, PA_REDUCE, 596 },
+    // State 1190
+    { 1190, 1, PA_SHIFT, 8 },
+    // State 1190
+    { 1190, 994, PA_SHIFT, 10 },
+    // State 1190
+    { 1190, 995, PA_SHIFT, 9 },
+    // State 1190
+    { 1190, 1000, PA_SHIFT, 1191 },
+    // State 1190
+    { 1190, 1004, PA_SHIFT, 13 },
+    // State 1191
+    { 1191, 996, PA_SHIFT, 6 },
+    // State 1191
+    { 1191, 998, PA_REDUCE, 597 },
+    // State 1192
+    { 1192, 1, PA_SHIFT, 8 },
+    // State 1192
+    { 1192, 994, PA_SHIFT, 10 },
+    // State 1192
+    { 1192, 995, PA_SHIFT, 9 },
+    // State 1192
+    { 1192, 1000, PA_SHIFT, 1193 },
+    // State 1192
+    { 1192, 1004, PA_SHIFT, 13 },
+    // State 1193
+    { 1193, 996, PA_SHIFT, 6 },
+    // State 1193
+    { 1193, 998, PA_REDUCE, 598 },
+    // State 1194
+    { 1194, 1, PA_SHIFT, 8 },
+    // State 1194
+    { 1194, 994, PA_SHIFT, 10 },
+    // State 1194
+    { 1194, 995, PA_SHIFT, 9 },
+    // State 1194
+    { 1194, 1000, PA_SHIFT, 1195 },
+    // State 1194
+    { 1194, 1004, PA_SHIFT, 13 },
+    // State 1195
+    { 1195, 996, PA_SHIFT, 6 },
+    // State 1195
+    { 1195, 998, PA_REDUCE, 599 },
+    // State 1196
+    { 1196, 1, PA_SHIFT, 8 },
+    // State 1196
+    { 1196, 994, PA_SHIFT, 10 },
+    // State 1196
+    { 1196, 995, PA_SHIFT, 9 },
+    // State 1196
+    { 1196, 1000, PA_SHIFT, 1197 },
+    // State 1196
+    { 1196, 1004, PA_SHIFT, 13 },
+    // State 1197
+    { 1197, 996, PA_SHIFT, 6 },
+    // State 1197
+    { 1197, 998, PA_REDUCE, 600 },
+    // State 1198
+    { 1198, 1, PA_SHIFT, 8 },
+    // State 1198
+    { 1198, 994, PA_SHIFT, 10 },
+    // State 1198
+    { 1198, 995, PA_SHIFT, 9 },
+    // State 1198
+    { 1198, 1000, PA_SHIFT, 1199 },
+    // State 1198
+    { 1198, 1004, PA_SHIFT, 13 },
+    // State 1199
+    { 1199, 996, PA_SHIFT, 6 },
+    // State 1199
+    { 1199, 998, PA_REDUCE, 601 },
+    // State 1200
+    { 1200, 1, PA_SHIFT, 8 },
+    // State 1200
+    { 1200, 994, PA_SHIFT, 10 },
+    // State 1200
+    { 1200, 995, PA_SHIFT, 9 },
+    // State 1200
+    { 1200, 1000, PA_SHIFT, 1201 },
+    // State 1200
+    { 1200, 1004, PA_SHIFT, 13 },
+    // State 1201
+    { 1201, 996, PA_SHIFT, 6 },
+    // State 1201
+    { 1201, 998, PA_REDUCE, 602 },
+    // State 1202
+    { 1202, 1, PA_SHIFT, 8 },
+    // State 1202
+    { 1202, 994, PA_SHIFT, 10 },
+    // State 1202
+    { 1202, 995, PA_SHIFT, 9 },
+    // State 1202
+    { 1202, 1000, PA_SHIFT, 1203 },
+    // State 1202
+    { 1202, 1004, PA_SHIFT, 13 },
+    // State 1203
+    { 1203, 996, PA_SHIFT, 6 },
+    // State 1203
+    { 1203, 998, PA_REDUCE, 603 },
+    // State 1204
+    { 1204, 1, PA_SHIFT, 8 },
+    // State 1204
+    { 1204, 994, PA_SHIFT, 10 },
+    // State 1204
+    { 1204, 995, PA_SHIFT, 9 },
+    // State 1204
+    { 1204, 1000, PA_SHIFT, 1205 },
+    // State 1204
+    { 1204, 1004, PA_SHIFT, 13 },
+    // State 1205
+    { 1205, 996, PA_SHIFT, 6 },
+    // State 1205
+    { 1205, 998, PA_REDUCE, 604 },
+    // State 1206
+    { 1206, 1, PA_SHIFT, 8 },
+    // State 1206
+    { 1206, 994, PA_SHIFT, 10 },
+    // State 1206
+    { 1206, 995, PA_SHIFT, 9 },
+    // State 1206
+    { 1206, 1000, PA_SHIFT, 1207 },
+    // State 1206
+    { 1206, 1004, PA_SHIFT, 13 },
+    // State 1207
+    { 1207, 996, PA_SHIFT, 6 },
+    // State 1207
+    { 1207, 998, PA_REDUCE, 605 },
+    // State 1208
+    { 1208, 1, PA_SHIFT, 8 },
+    // State 1208
+    { 1208, 994, PA_SHIFT, 10 },
+    // State 1208
+    { 1208, 995, PA_SHIFT, 9 },
+    // State 1208
+    { 1208, 1000, PA_SHIFT, 1209 },
+    // State 1208
+    { 1208, 1004, PA_SHIFT, 13 },
+    // State 1209
+    { 1209, 996, PA_SHIFT, 6 },
+    // State 1209
+    { 1209, 998, PA_REDUCE, 606 },
+    // State 1210
+    { 1210, 1, PA_SHIFT, 8 },
+    // State 1210
+    { 1210, 994, PA_SHIFT, 10 },
+    // State 1210
+    { 1210, 995, PA_SHIFT, 9 },
+    // State 1210
+    { 1210, 1000, PA_SHIFT, 1211 },
+    // State 1210
+    { 1210, 1004, PA_SHIFT, 13 },
+    // State 1211
+    { 1211, 996, PA_SHIFT, 6 },
+    // State 1211
+    { 1211, 998, PA_REDUCE, 607 },
+    // State 1212
+    { 1212, 1, PA_SHIFT, 8 },
+    // State 1212
+    { 1212, 994, PA_SHIFT, 10 },
+    // State 1212
+    { 1212, 995, PA_SHIFT, 9 },
+    // State 1212
+    { 1212, 1000, PA_SHIFT, 1213 },
+    // State 1212
+    { 1212, 1004, PA_SHIFT, 13 },
+    // State 1213
+    { 1213, 996, PA_SHIFT, 6 },
+    // State 1213
+    { 1213, 998, PA_REDUCE, 608 },
+    // State 1214
+    { 1214, 1, PA_SHIFT, 8 },
+    // State 1214
+    { 1214, 994, PA_SHIFT, 10 },
+    // State 1214
+    { 1214, 995, PA_SHIFT, 9 },
+    // State 1214
+    { 1214, 1000, PA_SHIFT, 1215 },
+    // State 1214
+    { 1214, 1004, PA_SHIFT, 13 },
+    // State 1215
+    { 1215, 996, PA_SHIFT, 6 },
+    // State 1215
+    { 1215, 998, PA_REDUCE, 609 },
+    // State 1216
+    { 1216, 1, PA_SHIFT, 8 },
+    // State 1216
+    { 1216, 994, PA_SHIFT, 10 },
+    // State 1216
+    { 1216, 995, PA_SHIFT, 9 },
+    // State 1216
+    { 1216, 1000, PA_SHIFT, 1217 },
+    // State 1216
+    { 1216, 1004, PA_SHIFT, 13 },
+    // State 1217
+    { 1217, 996, PA_SHIFT, 6 },
+    // State 1217
+    { 1217, 998, PA_REDUCE, 610 },
+    // State 1218
+    { 1218, 1, PA_SHIFT, 8 },
+    // State 1218
+    { 1218, 994, PA_SHIFT, 10 },
+    // State 1218
+    { 1218, 995, PA_SHIFT, 9 },
+    // State 1218
+    { 1218, 1000, PA_SHIFT, 1219 },
+    // State 1218
+    { 1218, 1004, PA_SHIFT, 13 },
+    // State 1219
+    { 1219, 996, PA_SHIFT, 6 },
+    // State 1219
+    { 1219, 998, PA_REDUCE, 611 },
+    // State 1220
+    { 1220, 1, PA_SHIFT, 8 },
+    // State 1220
+    { 1220, 994, PA_SHIFT, 10 },
+    // State 1220
+    { 1220, 995, PA_SHIFT, 9 },
+    // State 1220
+    { 1220, 1000, PA_SHIFT, 1221 },
+    // State 1220
+    { 1220, 1004, PA_SHIFT, 13 },
+    // State 1221
+    { 1221, 996, PA_SHIFT, 6 },
+    // State 1221
+    { 1221, 998, PA_REDUCE, 612 },
+    // State 1222
+    { 1222, 1, PA_SHIFT, 8 },
+    // State 1222
+    { 1222, 994, PA_SHIFT, 10 },
+    // State 1222
+    { 1222, 995, PA_SHIFT, 9 },
+    // State 1222
+    { 1222, 1000, PA_SHIFT, 1223 },
+    // State 1222
+    { 1222, 1004, PA_SHIFT, 13 },
+    // State 1223
+    { 1223, 996, PA_SHIFT, 6 },
+    // State 1223
+    { 1223, 998, PA_REDUCE, 613 },
+    // State 1224
+    { 1224, 1, PA_SHIFT, 8 },
+    // State 1224
+    { 1224, 994, PA_SHIFT, 10 },
+    // State 1224
+    { 1224, 995, PA_SHIFT, 9 },
+    // State 1224
+    { 1224, 1000, PA_SHIFT, 1225 },
+    // State 1224
+    { 1224, 1004, PA_SHIFT, 13 },
+    // State 1225
+    { 1225, 996, PA_SHIFT, 6 },
+    // State 1225
+    { 1225, 998, PA_REDUCE, 614 },
+    // State 1226
+    { 1226, 1, PA_SHIFT, 8 },
+    // State 1226
+    { 1226, 994, PA_SHIFT, 10 },
+    // State 1226
+    { 1226, 995, PA_SHIFT, 9 },
+    // State 1226
+    { 1226, 1000, PA_SHIFT, 1227 },
+    // State 1226
+    { 1226, 1004, PA_SHIFT, 13 },
+    // State 1227
+    { 1227, 996, PA_SHIFT, 6 },
+    // State 1227
+    { 1227, 998, PA_REDUCE, 615 },
+    // State 1228
+    { 1228, 1, PA_SHIFT, 8 },
+    // State 1228
+    { 1228, 994, PA_SHIFT, 10 },
+    // State 1228
+    { 1228, 995, PA_SHIFT, 9 },
+    // State 1228
+    { 1228, 1000, PA_SHIFT, 1229 },
+    // State 1228
+    { 1228, 1004, PA_SHIFT, 13 },
+    // State 1229
+    { 1229, 996, PA_SHIFT, 6 },
+    // State 1229
+    { 1229, 998, PA_REDUCE, 616 },
+    // State 1230
+    { 1230, 1, PA_SHIFT, 8 },
+    // State 1230
+    { 1230, 994, PA_SHIFT, 10 },
+    // State 1230
+    { 1230, 995, PA_SHIFT, 9 },
+    // State 1230
+    { 1230, 1000, PA_SHIFT, 1231 },
+    // State 1230
+    { 1230, 1004, PA_SHIFT, 13 },
+    // State 1231
+    { 1231, 996, PA_SHIFT, 6 },
+    // State 1231
+    { 1231, 998, PA_REDUCE, 617 },
+    // State 1232
+    { 1232, 1, PA_SHIFT, 8 },
+    // State 1232
+    { 1232, 994, PA_SHIFT, 10 },
+    // State 1232
+    { 1232, 995, PA_SHIFT, 9 },
+    // State 1232
+    { 1232, 1000, PA_SHIFT, 1233 },
+    // State 1232
+    { 1232, 1004, PA_SHIFT, 13 },
+    // State 1233
+    { 1233, 996, PA_SHIFT, 6 },
+    // State 1233
+    { 1233, 998, PA_REDUCE, 618 },
+    // State 1234
+    { 1234, 1, PA_SHIFT, 8 },
+    // State 1234
+    { 1234, 994, PA_SHIFT, 10 },
+    // State 1234
+    { 1234, 995, PA_SHIFT, 9 },
+    // State 1234
+    { 1234, 1000, PA_SHIFT, 1235 },
+    // State 1234
+    { 1234, 1004, PA_SHIFT, 13 },
+    // State 1235
+    { 1235, 996, PA_SHIFT, 6 },
+    // State 1235
+    { 1235, 998, PA_REDUCE, 619 },
+    // State 1236
+    { 1236, 1, PA_SHIFT, 8 },
+    // State 1236
+    { 1236, 994, PA_SHIFT, 10 },
+    // State 1236
+    { 1236, 995, PA_SHIFT, 9 },
+    // State 1236
+    { 1236, 1000, PA_SHIFT, 1237 },
+    // State 1236
+    { 1236, 1004, PA_SHIFT, 13 },
+    // State 1237
+    { 1237, 996, PA_SHIFT, 6 },
+    // State 1237
+    { 1237, 998, PA_REDUCE, 620 },
+    // State 1238
+    { 1238, 1, PA_SHIFT, 8 },
+    // State 1238
+    { 1238, 994, PA_SHIFT, 10 },
+    // State 1238
+    { 1238, 995, PA_SHIFT, 9 },
+    // State 1238
+    { 1238, 1000, PA_SHIFT, 1239 },
+    // State 1238
+    { 1238, 1004, PA_SHIFT, 13 },
+    // State 1239
+    { 1239, 996, PA_SHIFT, 6 },
+    // State 1239
+    { 1239, 998, PA_REDUCE, 621 },
+    // State 1240
+    { 1240, 1, PA_SHIFT, 8 },
+    // State 1240
+    { 1240, 994, PA_SHIFT, 10 },
+    // State 1240
+    { 1240, 995, PA_SHIFT, 9 },
+    // State 1240
+    { 1240, 1000, PA_SHIFT, 1241 },
+    // State 1240
+    { 1240, 1004, PA_SHIFT, 13 },
+    // State 1241
+    { 1241, 996, PA_SHIFT, 6 },
+    // State 1241
+    { 1241, 998, PA_REDUCE, 622 },
+    // State 1242
+    { 1242, 1, PA_SHIFT, 8 },
+    // State 1242
+    { 1242, 994, PA_SHIFT, 10 },
+    // State 1242
+    { 1242, 995, PA_SHIFT, 9 },
+    // State 1242
+    { 1242, 1000, PA_SHIFT, 1243 },
+    // State 1242
+    { 1242, 1004, PA_SHIFT, 13 },
+    // State 1243
+    { 1243, 996, PA_SHIFT, 6 },
+    // State 1243
+    { 1243, 998, PA_REDUCE, 623 },
+    // State 1244
+    { 1244, 1, PA_SHIFT, 8 },
+    // State 1244
+    { 1244, 994, PA_SHIFT, 10 },
+    // State 1244
+    { 1244, 995, PA_SHIFT, 9 },
+    // State 1244
+    { 1244, 1000, PA_SHIFT, 1245 },
+    // State 1244
+    { 1244, 1004, PA_SHIFT, 13 },
+    // State 1245
+    { 1245, 996, PA_SHIFT, 6 },
+    // State 1245
+    { 1245, 998, PA_REDUCE, 624 },
+    // State 1246
+    { 1246, 1, PA_SHIFT, 8 },
+    // State 1246
+    { 1246, 994, PA_SHIFT, 10 },
+    // State 1246
+    { 1246, 995, PA_SHIFT, 9 },
+    // State 1246
+    { 1246, 1000, PA_SHIFT, 1247 },
+    // State 1246
+    { 1246, 1004, PA_SHIFT, 13 },
+    // State 1247
+    { 1247, 996, PA_SHIFT, 6 },
+    // State 1247
+    { 1247, 998, PA_REDUCE, 625 },
+    // State 1248
+    { 1248, 1, PA_SHIFT, 8 },
+    // State 1248
+    { 1248, 994, PA_SHIFT, 10 },
+    // State 1248
+    { 1248, 995, PA_SHIFT, 9 },
+    // State 1248
+    { 1248, 1000, PA_SHIFT, 1249 },
+    // State 1248
+    { 1248, 1004, PA_SHIFT, 13 },
+    // State 1249
+    { 1249, 996, PA_SHIFT, 6 },
+    // State 1249
+    { 1249, 998, PA_REDUCE, 626 },
+    // State 1250
+    { 1250, 1, PA_SHIFT, 8 },
+    // State 1250
+    { 1250, 994, PA_SHIFT, 10 },
+    // State 1250
+    { 1250, 995, PA_SHIFT, 9 },
+    // State 1250
+    { 1250, 1000, PA_SHIFT, 1251 },
+    // State 1250
+    { 1250, 1004, PA_SHIFT, 13 },
+    // State 1251
+    { 1251, 996, PA_SHIFT, 6 },
+    // State 1251
+    { 1251, 998, PA_REDUCE, 627 },
+    // State 1252
+    { 1252, 1, PA_SHIFT, 8 },
+    // State 1252
+    { 1252, 994, PA_SHIFT, 10 },
+    // State 1252
+    { 1252, 995, PA_SHIFT, 9 },
+    // State 1252
+    { 1252, 1000, PA_SHIFT, 1253 },
+    // State 1252
+    { 1252, 1004, PA_SHIFT, 13 },
+    // State 1253
+    { 1253, 996, PA_SHIFT, 6 },
+    // State 1253
+    { 1253, 998, PA_REDUCE, 628 },
+    // State 1254
+    { 1254, 1, PA_SHIFT, 8 },
+    // State 1254
+    { 1254, 994, PA_SHIFT, 10 },
+    // State 1254
+    { 1254, 995, PA_SHIFT, 9 },
+    // State 1254
+    { 1254, 1000, PA_SHIFT, 1255 },
+    // State 1254
+    { 1254, 1004, PA_SHIFT, 13 },
+    // State 1255
+    { 1255, 996, PA_SHIFT, 6 },
+    // State 1255
+    { 1255, 998, PA_REDUCE, 629 },
+    // State 1256
+    { 1256, 1, PA_SHIFT, 8 },
+    // State 1256
+    { 1256, 994, PA_SHIFT, 10 },
+    // State 1256
+    { 1256, 995, PA_SHIFT, 9 },
+    // State 1256
+    { 1256, 1000, PA_SHIFT, 1257 },
+    // State 1256
+    { 1256, 1004, PA_SHIFT, 13 },
+    // State 1257
+    { 1257, 996, PA_SHIFT, 6 },
+    // State 1257
+    { 1257, 998, PA_REDUCE, 630 },
+    // State 1258
+    { 1258, 1, PA_SHIFT, 8 },
+    // State 1258
+    { 1258, 994, PA_SHIFT, 10 },
+    // State 1258
+    { 1258, 995, PA_SHIFT, 9 },
+    // State 1258
+    { 1258, 1000, PA_SHIFT, 1259 },
+    // State 1258
+    { 1258, 1004, PA_SHIFT, 13 },
+    // State 1259
+    { 1259, 996, PA_SHIFT, 6 },
+    // State 1259
+    { 1259, 998, PA_REDUCE, 631 },
+    // State 1260
+    { 1260, 1, PA_SHIFT, 8 },
+    // State 1260
+    { 1260, 994, PA_SHIFT, 10 },
+    // State 1260
+    { 1260, 995, PA_SHIFT, 9 },
+    // State 1260
+    { 1260, 1000, PA_SHIFT, 1261 },
+    // State 1260
+    { 1260, 1004, PA_SHIFT, 13 },
+    // State 1261
+    { 1261, 996, PA_SHIFT, 6 },
+    // State 1261
+    { 1261, 998, PA_REDUCE, 632 },
+    // State 1262
+    { 1262, 1, PA_SHIFT, 8 },
+    // State 1262
+    { 1262, 994, PA_SHIFT, 10 },
+    // State 1262
+    { 1262, 995, PA_SHIFT, 9 },
+    // State 1262
+    { 1262, 1000, PA_SHIFT, 1263 },
+    // State 1262
+    { 1262, 1004, PA_SHIFT, 13 },
+    // State 1263
+    { 1263, 996, PA_SHIFT, 6 },
+    // State 1263
+    { 1263, 998, PA_REDUCE, 633 },
+    // State 1264
+    { 1264, 1, PA_SHIFT, 8 },
+    // State 1264
+    { 1264, 994, PA_SHIFT, 10 },
+    // State 1264
+    { 1264, 995, PA_SHIFT, 9 },
+    // State 1264
+    { 1264, 1000, PA_SHIFT, 1265 },
+    // State 1264
+    { 1264, 1004, PA_SHIFT, 13 },
+    // State 1265
+    { 1265, 996, PA_SHIFT, 6 },
+    // State 1265
+    { 1265, 998, PA_REDUCE, 634 },
+    // State 1266
+    { 1266, 1, PA_SHIFT, 8 },
+    // State 1266
+    { 1266, 994, PA_SHIFT, 10 },
+    // State 1266
+    { 1266, 995, PA_SHIFT, 9 },
+    // State 1266
+    { 1266, 1000, PA_SHIFT, 1267 },
+    // State 1266
+    { 1266, 1004, PA_SHIFT, 13 },
+    // State 1267
+    { 1267, 996, PA_SHIFT, 6 },
+    // State 1267
+    { 1267, 998, PA_REDUCE, 635 },
+    // State 1268
+    { 1268, 1, PA_SHIFT, 8 },
+    // State 1268
+    { 1268, 994, PA_SHIFT, 10 },
+    // State 1268
+    { 1268, 995, PA_SHIFT, 9 },
+    // State 1268
+    { 1268, 1000, PA_SHIFT, 1269 },
+    // State 1268
+    { 1268, 1004, PA_SHIFT, 13 },
+    // State 1269
+    { 1269, 996, PA_SHIFT, 6 },
+    // State 1269
+    { 1269, 998, PA_REDUCE, 636 },
+    // State 1270
+    { 1270, 1, PA_SHIFT, 8 },
+    // State 1270
+    { 1270, 994, PA_SHIFT, 10 },
+    // State 1270
+    { 1270, 995, PA_SHIFT, 9 },
+    // State 1270
+    { 1270, 1000, PA_SHIFT, 1271 },
+    // State 1270
+    { 1270, 1004, PA_SHIFT, 13 },
+    // State 1271
+    { 1271, 996, PA_SHIFT, 6 },
+    // State 1271
+    { 1271, 998, PA_REDUCE, 637 },
+    // State 1272
+    { 1272, 1, PA_SHIFT, 8 },
+    // State 1272
+    { 1272, 994, PA_SHIFT, 10 },
+    // State 1272
+    { 1272, 995, PA_SHIFT, 9 },
+    // State 1272
+    { 1272, 1000, PA_SHIFT, 1273 },
+    // State 1272
+    { 1272, 1004, PA_SHIFT, 13 },
+    // State 1273
+    { 1273, 996, PA_SHIFT, 6 },
+    // State 1273
+    { 1273, 998, PA_REDUCE, 638 },
+    // State 1274
+    { 1274, 1, PA_SHIFT, 8 },
+    // State 1274
+    { 1274, 994, PA_SHIFT, 10 },
+    // State 1274
+    { 1274, 995, PA_SHIFT, 9 },
+    // State 1274
+    { 1274, 1000, PA_SHIFT, 1275 },
+    // State 1274
+    { 1274, 1004, PA_SHIFT, 13 },
+    // State 1275
+    { 1275, 996, PA_SHIFT, 6 },
+    // State 1275
+    { 1275, 998, PA_REDUCE, 639 },
+    // State 1276
+    { 1276, 1, PA_SHIFT, 8 },
+    // State 1276
+    { 1276, 994, PA_SHIFT, 10 },
+    // State 1276
+    { 1276, 995, PA_SHIFT, 9 },
+    // State 1276
+    { 1276, 1000, PA_SHIFT, 1277 },
+    // State 1276
+    { 1276, 1004, PA_SHIFT, 13 },
+    // State 1277
+    { 1277, 996, PA_SHIFT, 6 },
+    // State 1277
+    { 1277, 998, PA_REDUCE, 640 },
+    // State 1278
+    { 1278, 1, PA_SHIFT, 8 },
+    // State 1278
+    { 1278, 994, PA_SHIFT, 10 },
+    // State 1278
+    { 1278, 995, PA_SHIFT, 9 },
+    // State 1278
+    { 1278, 1000, PA_SHIFT, 1279 },
+    // State 1278
+    { 1278, 1004, PA_SHIFT, 13 },
+    // State 1279
+    { 1279, 996, PA_SHIFT, 6 },
+    // State 1279
+    { 1279, 998, PA_REDUCE, 641 },
+    // State 1280
+    { 1280, 1, PA_SHIFT, 8 },
+    // State 1280
+    { 1280, 994, PA_SHIFT, 10 },
+    // State 1280
+    { 1280, 995, PA_SHIFT, 9 },
+    // State 1280
+    { 1280, 1000, PA_SHIFT, 1281 },
+    // State 1280
+    { 1280, 1004, PA_SHIFT, 13 },
+    // State 1281
+    { 1281, 996, PA_SHIFT, 6 },
+    // State 1281
+    { 1281, 998, PA_REDUCE, 642 },
+    // State 1282
+    { 1282, 1, PA_SHIFT, 8 },
+    // State 1282
+    { 1282, 994, PA_SHIFT, 10 },
+    // State 1282
+    { 1282, 995, PA_SHIFT, 9 },
+    // State 1282
+    { 1282, 1000, PA_SHIFT, 1283 },
+    // State 1282
+    { 1282, 1004, PA_SHIFT, 13 },
+    // State 1283
+    { 1283, 996, PA_SHIFT, 6 },
+    // State 1283
+    { 1283, 998, PA_REDUCE, 643 },
+    // State 1284
+    { 1284, 1, PA_SHIFT, 8 },
+    // State 1284
+    { 1284, 994, PA_SHIFT, 10 },
+    // State 1284
+    { 1284, 995, PA_SHIFT, 9 },
+    // State 1284
+    { 1284, 1000, PA_SHIFT, 1285 },
+    // State 1284
+    { 1284, 1004, PA_SHIFT, 13 },
+    // State 1285
+    { 1285, 996, PA_SHIFT, 6 },
+    // State 1285
+    { 1285, 998, PA_REDUCE, 644 },
+    // State 1286
+    { 1286, 1, PA_SHIFT, 8 },
+    // State 1286
+    { 1286, 994, PA_SHIFT, 10 },
+    // State 1286
+    { 1286, 995, PA_SHIFT, 9 },
+    // State 1286
+    { 1286, 1000, PA_SHIFT, 1287 },
+    // State 1286
+    { 1286, 1004, PA_SHIFT, 13 },
+    // State 1287
+    { 1287, 996, PA_SHIFT, 6 },
+    // State 1287
+    { 1287, 998, PA_REDUCE, 645 },
+    // State 1288
+    { 1288, 1, PA_SHIFT, 8 },
+    // State 1288
+    { 1288, 994, PA_SHIFT, 10 },
+    // State 1288
+    { 1288, 995, PA_SHIFT, 9 },
+    // State 1288
+    { 1288, 1000, PA_SHIFT, 1289 },
+    // State 1288
+    { 1288, 1004, PA_SHIFT, 13 },
+    // State 1289
+    { 1289, 996, PA_SHIFT, 6 },
+    // State 1289
+    { 1289, 998, PA_REDUCE, 646 },
+    // State 1290
+    { 1290, 1, PA_SHIFT, 8 },
+    // State 1290
+    { 1290, 994, PA_SHIFT, 10 },
+    // State 1290
+    { 1290, 995, PA_SHIFT, 9 },
+    // State 1290
+    { 1290, 1000, PA_SHIFT, 1291 },
+    // State 1290
+    { 1290, 1004, PA_SHIFT, 13 },
+    // State 1291
+    { 1291, 996, PA_SHIFT, 6 },
+    // State 1291
+    { 1291, 998, PA_REDUCE, 647 },
+    // State 1292
+    { 1292, 1, PA_SHIFT, 8 },
+    // State 1292
+    { 1292, 994, PA_SHIFT, 10 },
+    // State 1292
+    { 1292, 995, PA_SHIFT, 9 },
+    // State 1292
+    { 1292, 1000, PA_SHIFT, 1293 },
+    // State 1292
+    { 1292, 1004, PA_SHIFT, 13 },
+    // State 1293
+    { 1293, 996, PA_SHIFT, 6 },
+    // State 1293
+    { 1293, 998, PA_REDUCE, 648 },
+    // State 1294
+    { 1294, 1, PA_SHIFT, 8 },
+    // State 1294
+    { 1294, 994, PA_SHIFT, 10 },
+    // State 1294
+    { 1294, 995, PA_SHIFT, 9 },
+    // State 1294
+    { 1294, 1000, PA_SHIFT, 1295 },
+    // State 1294
+    { 1294, 1004, PA_SHIFT, 13 },
+    // State 1295
+    { 1295, 996, PA_SHIFT, 6 },
+    // State 1295
+    { 1295, 998, PA_REDUCE, 649 },
+    // State 1296
+    { 1296, 1, PA_SHIFT, 8 },
+    // State 1296
+    { 1296, 994, PA_SHIFT, 10 },
+    // State 1296
+    { 1296, 995, PA_SHIFT, 9 },
+    // State 1296
+    { 1296, 1000, PA_SHIFT, 1297 },
+    // State 1296
+    { 1296, 1004, PA_SHIFT, 13 },
+    // State 1297
+    { 1297, 996, PA_SHIFT, 6 },
+    // State 1297
+    { 1297, 998, PA_REDUCE, 650 },
+    // State 1298
+    { 1298, 1, PA_SHIFT, 8 },
+    // State 1298
+    { 1298, 994, PA_SHIFT, 10 },
+    // State 1298
+    { 1298, 995, PA_SHIFT, 9 },
+    // State 1298
+    { 1298, 1000, PA_SHIFT, 1299 },
+    // State 1298
+    { 1298, 1004, PA_SHIFT, 13 },
+    // State 1299
+    { 1299, 996, PA_SHIFT, 6 },
+    // State 1299
+    { 1299, 998, PA_REDUCE, 651 },
+    // State 1300
+    { 1300, 1, PA_SHIFT, 8 },
+    // State 1300
+    { 1300, 994, PA_SHIFT, 10 },
+    // State 1300
+    { 1300, 995, PA_SHIFT, 9 },
+    // State 1300
+    { 1300, 1000, PA_SHIFT, 1301 },
+    // State 1300
+    { 1300, 1004, PA_SHIFT, 13 },
+    // State 1301
+    { 1301, 996, PA_SHIFT, 6 },
+    // State 1301
+    { 1301, 998, PA_REDUCE, 652 },
+    // State 1302
+    { 1302, 1, PA_SHIFT, 8 },
+    // State 1302
+    { 1302, 994, PA_SHIFT, 10 },
+    // State 1302
+    { 1302, 995, PA_SHIFT, 9 },
+    // State 1302
+    { 1302, 1000, PA_SHIFT, 1303 },
+    // State 1302
+    { 1302, 1004, PA_SHIFT, 13 },
+    // State 1303
+    { 1303, 996, PA_SHIFT, 6 },
+    // State 1303
+    { 1303, 998, PA_REDUCE, 653 },
+    // State 1304
+    { 1304, 1, PA_SHIFT, 8 },
+    // State 1304
+    { 1304, 994, PA_SHIFT, 10 },
+    // State 1304
+    { 1304, 995, PA_SHIFT, 9 },
+    // State 1304
+    { 1304, 1000, PA_SHIFT, 1305 },
+    // State 1304
+    { 1304, 1004, PA_SHIFT, 13 },
+    // State 1305
+    { 1305, 996, PA_SHIFT, 6 },
+    // State 1305
+    { 1305, 998, PA_REDUCE, 654 },
+    // State 1306
+    { 1306, 1, PA_SHIFT, 8 },
+    // State 1306
+    { 1306, 994, PA_SHIFT, 10 },
+    // State 1306
+    { 1306, 995, PA_SHIFT, 9 },
+    // State 1306
+    { 1306, 1000, PA_SHIFT, 1307 },
+    // State 1306
+    { 1306, 1004, PA_SHIFT, 13 },
+    // State 1307
+    { 1307, 996, PA_SHIFT, 6 },
+    // State 1307
+    { 1307, 998, PA_REDUCE, 655 },
+    // State 1308
+    { 1308, 1, PA_SHIFT, 8 },
+    // State 1308
+    { 1308, 994, PA_SHIFT, 10 },
+    // State 1308
+    { 1308, 995, PA_SHIFT, 9 },
+    // State 1308
+    { 1308, 1000, PA_SHIFT, 1309 },
+    // State 1308
+    { 1308, 1004, PA_SHIFT, 13 },
+    // State 1309
+    { 1309, 996, PA_SHIFT, 6 },
+    // State 1309
+    { 1309, 998, PA_REDUCE, 656 },
+    // State 1310
+    { 1310, 1, PA_SHIFT, 8 },
+    // State 1310
+    { 1310, 994, PA_SHIFT, 10 },
+    // State 1310
+    { 1310, 995, PA_SHIFT, 9 },
+    // State 1310
+    { 1310, 1000, PA_SHIFT, 1311 },
+    // State 1310
+    { 1310, 1004, PA_SHIFT, 13 },
+    // State 1311
+    { 1311, 996, PA_SHIFT, 6 },
+    // State 1311
+    { 1311, 998, PA_REDUCE, 657 },
+    // State 1312
+    { 1312, 1, PA_SHIFT, 8 },
+    // State 1312
+    { 1312, 994, PA_SHIFT, 10 },
+    // State 1312
+    { 1312, 995, PA_SHIFT, 9 },
+    // State 1312
+    { 1312, 1000, PA_SHIFT, 1313 },
+    // State 1312
+    { 1312, 1004, PA_SHIFT, 13 },
+    // State 1313
+    { 1313, 996, PA_SHIFT, 6 },
+    // State 1313
+    { 1313, 998, PA_REDUCE, 658 },
+    // State 1314
+    { 1314, 1, PA_SHIFT, 8 },
+    // State 1314
+    { 1314, 994, PA_SHIFT, 10 },
+    // State 1314
+    { 1314, 995, PA_SHIFT, 9 },
+    // State 1314
+    { 1314, 1000, PA_SHIFT, 1315 },
+    // State 1314
+    { 1314, 1004, PA_SHIFT, 13 },
+    // State 1315
+    { 1315, 996, PA_SHIFT, 6 },
+    // State 1315
+    { 1315, 998, PA_REDUCE, 659 },
+    // State 1316
+    { 1316, 1, PA_SHIFT, 8 },
+    // State 1316
+    { 1316, 994, PA_SHIFT, 10 },
+    // State 1316
+    { 1316, 995, PA_SHIFT, 9 },
+    // State 1316
+    { 1316, 1000, PA_SHIFT, 1317 },
+    // State 1316
+    { 1316, 1004, PA_SHIFT, 13 },
+    // State 1317
+    { 1317, 996, PA_SHIFT, 6 },
+    // State 1317
+    { 1317, 998, PA_REDUCE, 660 },
+    // State 1318
+    { 1318, 1, PA_SHIFT, 8 },
+    // State 1318
+    { 1318, 994, PA_SHIFT, 10 },
+    // State 1318
+    { 1318, 995, PA_SHIFT, 9 },
+    // State 1318
+    { 1318, 1000, PA_SHIFT, 1319 },
+    // State 1318
+    { 1318, 1004, PA_SHIFT, 13 },
+    // State 1319
+    { 1319, 996, PA_SHIFT, 6 },
+    // State 1319
+    { 1319, 998, PA_REDUCE, 661 },
+    // State 1320
+    { 1320, 1, PA_SHIFT, 8 },
+    // State 1320
+    { 1320, 994, PA_SHIFT, 10 },
+    // State 1320
+    { 1320, 995, PA_SHIFT, 9 },
+    // State 1320
+    { 1320, 1000, PA_SHIFT, 1321 },
+    // State 1320
+    { 1320, 1004, PA_SHIFT, 13 },
+    // State 1321
+    { 1321, 996, PA_SHIFT, 6 },
+    // State 1321
+    { 1321, 998, PA_REDUCE, 662 },
+    // State 1322
+    { 1322, 1, PA_SHIFT, 8 },
+    // State 1322
+    { 1322, 994, PA_SHIFT, 10 },
+    // State 1322
+    { 1322, 995, PA_SHIFT, 9 },
+    // State 1322
+    { 1322, 1000, PA_SHIFT, 1323 },
+    // State 1322
+    { 1322, 1004, PA_SHIFT, 13 },
+    // State 1323
+    { 1323, 996, PA_SHIFT, 6 },
+    // State 1323
+    { 1323, 998, PA_REDUCE, 663 },
+    // State 1324
+    { 1324, 1, PA_SHIFT, 8 },
+    // State 1324
+    { 1324, 994, PA_SHIFT, 10 },
+    // State 1324
+    { 1324, 995, PA_SHIFT, 9 },
+    // State 1324
+    { 1324, 1000, PA_SHIFT, 1325 },
+    // State 1324
+    { 1324, 1004, PA_SHIFT, 13 },
+    // State 1325
+    { 1325, 996, PA_SHIFT, 6 },
+    // State 1325
+    { 1325, 998, PA_REDUCE, 664 },
+    // State 1326
+    { 1326, 1, PA_SHIFT, 8 },
+    // State 1326
+    { 1326, 994, PA_SHIFT, 10 },
+    // State 1326
+    { 1326, 995, PA_SHIFT, 9 },
+    // State 1326
+    { 1326, 1000, PA_SHIFT, 1327 },
+    // State 1326
+    { 1326, 1004, PA_SHIFT, 13 },
+    // State 1327
+    { 1327, 996, PA_SHIFT, 6 },
+    // State 1327
+    { 1327, 998, PA_REDUCE, 665 },
+    // State 1328
+    { 1328, 1, PA_SHIFT, 8 },
+    // State 1328
+    { 1328, 994, PA_SHIFT, 10 },
+    // State 1328
+    { 1328, 995, PA_SHIFT, 9 },
+    // State 1328
+    { 1328, 1000, PA_SHIFT, 1329 },
+    // State 1328
+    { 1328, 1004, PA_SHIFT, 13 },
+    // State 1329
+    { 1329, 996, PA_SHIFT, 6 },
+    // State 1329
+    { 1329, 998, PA_REDUCE, 666 },
+    // State 1330
+    { 1330, 1, PA_SHIFT, 8 },
+    // State 1330
+    { 1330, 994, PA_SHIFT, 10 },
+    // State 1330
+    { 1330, 995, PA_SHIFT, 9 },
+    // State 1330
+    { 1330, 1000, PA_SHIFT, 1331 },
+    // State 1330
+    { 1330, 1004, PA_SHIFT, 13 },
+    // State 1331
+    { 1331, 996, PA_SHIFT, 6 },
+    // State 1331
+    { 1331, 998, PA_REDUCE, 667 },
+    // State 1332
+    { 1332, 1, PA_SHIFT, 8 },
+    // State 1332
+    { 1332, 994, PA_SHIFT, 10 },
+    // State 1332
+    { 1332, 995, PA_SHIFT, 9 },
+    // State 1332
+    { 1332, 1000, PA_SHIFT, 1333 },
+    // State 1332
+    { 1332, 1004, PA_SHIFT, 13 },
+    // State 1333
+    { 1333, 996, PA_SHIFT, 6 },
+    // State 1333
+    { 1333, 998, PA_REDUCE, 668 },
+    // State 1334
+    { 1334, 1, PA_SHIFT, 8 },
+    // State 1334
+    { 1334, 994, PA_SHIFT, 10 },
+    // State 1334
+    { 1334, 995, PA_SHIFT, 9 },
+    // State 1334
+    { 1334, 1000, PA_SHIFT, 1335 },
+    // State 1334
+    { 1334, 1004, PA_SHIFT, 13 },
+    // State 1335
+    { 1335, 996, PA_SHIFT, 6 },
+    // State 1335
+    { 1335, 998, PA_REDUCE, 669 },
+    // State 1336
+    { 1336, 1, PA_SHIFT, 8 },
+    // State 1336
+    { 1336, 994, PA_SHIFT, 10 },
+    // State 1336
+    { 1336, 995, PA_SHIFT, 9 },
+    // State 1336
+    { 1336, 1000, PA_SHIFT, 1337 },
+    // State 1336
+    { 1336, 1004, PA_SHIFT, 13 },
+    // State 1337
+    { 1337, 996, PA_SHIFT, 6 },
+    // State 1337
+    { 1337, 998, PA_REDUCE, 670 },
+    // State 1338
+    { 1338, 1, PA_SHIFT, 8 },
+    // State 1338
+    { 1338, 994, PA_SHIFT, 10 },
+    // State 1338
+    { 1338, 995, PA_SHIFT, 9 },
+    // State 1338
+    { 1338, 1000, PA_SHIFT, 1339 },
+    // State 1338
+    { 1338, 1004, PA_SHIFT, 13 },
+    // State 1339
+    { 1339, 996, PA_SHIFT, 6 },
+    // State 1339
+    { 1339, 998, PA_REDUCE, 671 },
+    // State 1340
+    { 1340, 1, PA_SHIFT, 8 },
+    // State 1340
+    { 1340, 994, PA_SHIFT, 10 },
+    // State 1340
+    { 1340, 995, PA_SHIFT, 9 },
+    // State 1340
+    { 1340, 1000, PA_SHIFT, 1341 },
+    // State 1340
+    { 1340, 1004, PA_SHIFT, 13 },
+    // State 1341
+    { 1341, 996, PA_SHIFT, 6 },
+    // State 1341
+    { 1341, 998, PA_REDUCE, 672 },
+    // State 1342
+    { 1342, 1, PA_SHIFT, 8 },
+    // State 1342
+    { 1342, 994, PA_SHIFT, 10 },
+    // State 1342
+    { 1342, 995, PA_SHIFT, 9 },
+    // State 1342
+    { 1342, 1000, PA_SHIFT, 1343 },
+    // State 1342
+    { 1342, 1004, PA_SHIFT, 13 },
+    // State 1343
+    { 1343, 996, PA_SHIFT, 6 },
+    // State 1343
+    { 1343, 998, PA_REDUCE, 673 },
+    // State 1344
+    { 1344, 1, PA_SHIFT, 8 },
+    // State 1344
+    { 1344, 994, PA_SHIFT, 10 },
+    // State 1344
+    { 1344, 995, PA_SHIFT, 9 },
+    // State 1344
+    { 1344, 1000, PA_SHIFT, 1345 },
+    // State 1344
+    { 1344, 1004, PA_SHIFT, 13 },
+    // State 1345
+    { 1345, 996, PA_SHIFT, 6 },
+    // State 1345
+    { 1345, 998, PA_REDUCE, 674 },
+    // State 1346
+    { 1346, 1, PA_SHIFT, 8 },
+    // State 1346
+    { 1346, 994, PA_SHIFT, 10 },
+    // State 1346
+    { 1346, 995, PA_SHIFT, 9 },
+    // State 1346
+    { 1346, 1000, PA_SHIFT, 1347 },
+    // State 1346
+    { 1346, 1004, PA_SHIFT, 13 },
+    // State 1347
+    { 1347, 996, PA_SHIFT, 6 },
+    // State 1347
+    { 1347, 998, PA_REDUCE, 675 },
+    // State 1348
+    { 1348, 1, PA_SHIFT, 8 },
+    // State 1348
+    { 1348, 994, PA_SHIFT, 10 },
+    // State 1348
+    { 1348, 995, PA_SHIFT, 9 },
+    // State 1348
+    { 1348, 1000, PA_SHIFT, 1349 },
+    // State 1348
+    { 1348, 1004, PA_SHIFT, 13 },
+    // State 1349
+    { 1349, 996, PA_SHIFT, 6 },
+    // State 1349
+    { 1349, 998, PA_REDUCE, 676 },
+    // State 1350
+    { 1350, 1, PA_SHIFT, 8 },
+    // State 1350
+    { 1350, 994, PA_SHIFT, 10 },
+    // State 1350
+    { 1350, 995, PA_SHIFT, 9 },
+    // State 1350
+    { 1350, 1000, PA_SHIFT, 1351 },
+    // State 1350
+    { 1350, 1004, PA_SHIFT, 13 },
+    // State 1351
+    { 1351, 996, PA_SHIFT, 6 },
+    // State 1351
+    { 1351, 998, PA_REDUCE, 677 },
+    // State 1352
+    { 1352, 1, PA_SHIFT, 8 },
+    // State 1352
+    { 1352, 994, PA_SHIFT, 10 },
+    // State 1352
+    { 1352, 995, PA_SHIFT, 9 },
+    // State 1352
+    { 1352, 1000, PA_SHIFT, 1353 },
+    // State 1352
+    { 1352, 1004, PA_SHIFT, 13 },
+    // State 1353
+    { 1353, 996, PA_SHIFT, 6 },
+    // State 1353
+    { 1353, 998, PA_REDUCE, 678 },
+    // State 1354
+    { 1354, 1, PA_SHIFT, 8 },
+    // State 1354
+    { 1354, 994, PA_SHIFT, 10 },
+    // State 1354
+    { 1354, 995, PA_SHIFT, 9 },
+    // State 1354
+    { 1354, 1000, PA_SHIFT, 1355 },
+    // State 1354
+    { 1354, 1004, PA_SHIFT, 13 },
+    // State 1355
+    { 1355, 996, PA_SHIFT, 6 },
+    // State 1355
+    { 1355, 998, PA_REDUCE, 679 },
+    // State 1356
+    { 1356, 1, PA_SHIFT, 8 },
+    // State 1356
+    { 1356, 994, PA_SHIFT, 10 },
+    // State 1356
+    { 1356, 995, PA_SHIFT, 9 },
+    // State 1356
+    { 1356, 1000, PA_SHIFT, 1357 },
+    // State 1356
+    { 1356, 1004, PA_SHIFT, 13 },
+    // State 1357
+    { 1357, 996, PA_SHIFT, 6 },
+    // State 1357
+    { 1357, 998, PA_REDUCE, 680 },
+    // State 1358
+    { 1358, 1, PA_SHIFT, 8 },
+    // State 1358
+    { 1358, 994, PA_SHIFT, 10 },
+    // State 1358
+    { 1358, 995, PA_SHIFT, 9 },
+    // State 1358
+    { 1358, 1000, PA_SHIFT, 1359 },
+    // State 1358
+    { 1358, 1004, PA_SHIFT, 13 },
+    // State 1359
+    { 1359, 996, PA_SHIFT, 6 },
+    // State 1359
+    { 1359, 998, PA_REDUCE, 681 },
+    // State 1360
+    { 1360, 1, PA_SHIFT, 8 },
+    // State 1360
+    { 1360, 994, PA_SHIFT, 10 },
+    // State 1360
+    { 1360, 995, PA_SHIFT, 9 },
+    // State 1360
+    { 1360, 1000, PA_SHIFT, 1361 },
+    // State 1360
+    { 1360, 1004, PA_SHIFT, 13 },
+    // State 1361
+    { 1361, 996, PA_SHIFT, 6 },
+    // State 1361
+    { 1361, 998, PA_REDUCE, 682 },
+    // State 1362
+    { 1362, 1, PA_SHIFT, 8 },
+    // State 1362
+    { 1362, 994, PA_SHIFT, 10 },
+    // State 1362
+    { 1362, 995, PA_SHIFT, 9 },
+    // State 1362
+    { 1362, 1000, PA_SHIFT, 1363 },
+    // State 1362
+    { 1362, 1004, PA_SHIFT, 13 },
+    // State 1363
+    { 1363, 996, PA_SHIFT, 6 },
+    // State 1363
+    { 1363, 998, PA_REDUCE, 683 },
+    // State 1364
+    { 1364, 1, PA_SHIFT, 8 },
+    // State 1364
+    { 1364, 994, PA_SHIFT, 10 },
+    // State 1364
+    { 1364, 995, PA_SHIFT, 9 },
+    // State 1364
+    { 1364, 1000, PA_SHIFT, 1365 },
+    // State 1364
+    { 1364, 1004, PA_SHIFT, 13 },
+    // State 1365
+    { 1365, 996, PA_SHIFT, 6 },
+    // State 1365
+    { 1365, 998, PA_REDUCE, 684 },
+    // State 1366
+    { 1366, 1, PA_SHIFT, 8 },
+    // State 1366
+    { 1366, 994, PA_SHIFT, 10 },
+    // State 1366
+    { 1366, 995, PA_SHIFT, 9 },
+    // State 1366
+    { 1366, 1000, PA_SHIFT, 1367 },
+    // State 1366
+    { 1366, 1004, PA_SHIFT, 13 },
+    // State 1367
+    { 1367, 996, PA_SHIFT, 6 },
+    // State 1367
+    { 1367, 998, PA_REDUCE, 685 },
+    // State 1368
+    { 1368, 1, PA_SHIFT, 8 },
+    // State 1368
+    { 1368, 994, PA_SHIFT, 10 },
+    // State 1368
+    { 1368, 995, PA_SHIFT, 9 },
+    // State 1368
+    { 1368, 1000, PA_SHIFT, 1369 },
+    // State 1368
+    { 1368, 1004, PA_SHIFT, 13 },
+    // State 1369
+    { 1369, 996, PA_SHIFT, 6 },
+    // State 1369
+    { 1369, 998, PA_REDUCE, 686 },
+    // State 1370
+    { 1370, 1, PA_SHIFT, 8 },
+    // State 1370
+    { 1370, 994, PA_SHIFT, 10 },
+    // State 1370
+    { 1370, 995, PA_SHIFT, 9 },
+    // State 1370
+    { 1370, 1000, PA_SHIFT, 1371 },
+    // State 1370
+    { 1370, 1004, PA_SHIFT, 13 },
+    // State 1371
+    { 1371, 996, PA_SHIFT, 6 },
+    // State 1371
+    { 1371, 998, PA_REDUCE, 687 },
+    // State 1372
+    { 1372, 1, PA_SHIFT, 8 },
+    // State 1372
+    { 1372, 994, PA_SHIFT, 10 },
+    // State 1372
+    { 1372, 995, PA_SHIFT, 9 },
+    // State 1372
+    { 1372, 1000, PA_SHIFT, 1373 },
+    // State 1372
+    { 1372, 1004, PA_SHIFT, 13 },
+    // State 1373
+    { 1373, 996, PA_SHIFT, 6 },
+    // State 1373
+    { 1373, 998, PA_REDUCE, 688 },
+    // State 1374
+    { 1374, 1, PA_SHIFT, 8 },
+    // State 1374
+    { 1374, 994, PA_SHIFT, 10 },
+    // State 1374
+    { 1374, 995, PA_SHIFT, 9 },
+    // State 1374
+    { 1374, 1000, PA_SHIFT, 1375 },
+    // State 1374
+    { 1374, 1004, PA_SHIFT, 13 },
+    // State 1375
+    { 1375, 996, PA_SHIFT, 6 },
+    // State 1375
+    { 1375, 998, PA_REDUCE, 689 },
+    // State 1376
+    { 1376, 1, PA_SHIFT, 8 },
+    // State 1376
+    { 1376, 994, PA_SHIFT, 10 },
+    // State 1376
+    { 1376, 995, PA_SHIFT, 9 },
+    // State 1376
+    { 1376, 1000, PA_SHIFT, 1377 },
+    // State 1376
+    { 1376, 1004, PA_SHIFT, 13 },
+    // State 1377
+    { 1377, 996, PA_SHIFT, 6 },
+    // State 1377
+    { 1377, 998, PA_REDUCE, 690 },
+    // State 1378
+    { 1378, 1, PA_SHIFT, 8 },
+    // State 1378
+    { 1378, 994, PA_SHIFT, 10 },
+    // State 1378
+    { 1378, 995, PA_SHIFT, 9 },
+    // State 1378
+    { 1378, 1000, PA_SHIFT, 1379 },
+    // State 1378
+    { 1378, 1004, PA_SHIFT, 13 },
+    // State 1379
+    { 1379, 996, PA_SHIFT, 6 },
+    // State 1379
+    { 1379, 998, PA_REDUCE, 691 },
+    // State 1380
+    { 1380, 1, PA_SHIFT, 8 },
+    // State 1380
+    { 1380, 994, PA_SHIFT, 10 },
+    // State 1380
+    { 1380, 995, PA_SHIFT, 9 },
+    // State 1380
+    { 1380, 1000, PA_SHIFT, 1381 },
+    // State 1380
+    { 1380, 1004, PA_SHIFT, 13 },
+    // State 1381
+    { 1381, 996, PA_SHIFT, 6 },
+    // State 1381
+    { 1381, 998, PA_REDUCE, 692 },
+    // State 1382
+    { 1382, 1, PA_SHIFT, 8 },
+    // State 1382
+    { 1382, 994, PA_SHIFT, 10 },
+    // State 1382
+    { 1382, 995, PA_SHIFT, 9 },
+    // State 1382
+    { 1382, 1000, PA_SHIFT, 1383 },
+    // State 1382
+    { 1382, 1004, PA_SHIFT, 13 },
+    // State 1383
+    { 1383, 996, PA_SHIFT, 6 },
+    // State 1383
+    { 1383, 998, PA_REDUCE, 693 },
+    // State 1384
+    { 1384, 1, PA_SHIFT, 8 },
+    // State 1384
+    { 1384, 994, PA_SHIFT, 10 },
+    // State 1384
+    { 1384, 995, PA_SHIFT, 9 },
+    // State 1384
+    { 1384, 1000, PA_SHIFT, 1385 },
+    // State 1384
+    { 1384, 1004, PA_SHIFT, 13 },
+    // State 1385
+    { 1385, 996, PA_SHIFT, 6 },
+    // State 1385
+    { 1385, 998, PA_REDUCE, 694 },
+    // State 1386
+    { 1386, 1, PA_SHIFT, 8 },
+    // State 1386
+    { 1386, 994, PA_SHIFT, 10 },
+    // State 1386
+    { 1386, 995, PA_SHIFT, 9 },
+    // State 1386
+    { 1386, 1000, PA_SHIFT, 1387 },
+    // State 1386
+    { 1386, 1004, PA_SHIFT, 13 },
+    // State 1387
+    { 1387, 996, PA_SHIFT, 6 },
+    // State 1387
+    { 1387, 998, PA_REDUCE, 695 },
+    // State 1388
+    { 1388, 1, PA_SHIFT, 8 },
+    // State 1388
+    { 1388, 994, PA_SHIFT, 10 },
+    // State 1388
+    { 1388, 995, PA_SHIFT, 9 },
+    // State 1388
+    { 1388, 1000, PA_SHIFT, 1389 },
+    // State 1388
+    { 1388, 1004, PA_SHIFT, 13 },
+    // State 1389
+    { 1389, 996, PA_SHIFT, 6 },
+    // State 1389
+    { 1389, 998, PA_REDUCE, 696 },
+    // State 1390
+    { 1390, 1, PA_SHIFT, 8 },
+    // State 1390
+    { 1390, 994, PA_SHIFT, 10 },
+    // State 1390
+    { 1390, 995, PA_SHIFT, 9 },
+    // State 1390
+    { 1390, 1000, PA_SHIFT, 1391 },
+    // State 1390
+    { 1390, 1004, PA_SHIFT, 13 },
+    // State 1391
+    { 1391, 996, PA_SHIFT, 6 },
+    // State 1391
+    { 1391, 998, PA_REDUCE, 697 },
+    // State 1392
+    { 1392, 1, PA_SHIFT, 8 },
+    // State 1392
+    { 1392, 994, PA_SHIFT, 10 },
+    // State 1392
+    { 1392, 995, PA_SHIFT, 9 },
+    // State 1392
+    { 1392, 1000, PA_SHIFT, 1393 },
+    // State 1392
+    { 1392, 1004, PA_SHIFT, 13 },
+    // State 1393
+    { 1393, 996, PA_SHIFT, 6 },
+    // State 1393
+    { 1393, 998, PA_REDUCE, 698 },
+    // State 1394
+    { 1394, 1, PA_SHIFT, 8 },
+    // State 1394
+    { 1394, 994, PA_SHIFT, 10 },
+    // State 1394
+    { 1394, 995, PA_SHIFT, 9 },
+    // State 1394
+    { 1394, 1000, PA_SHIFT, 1395 },
+    // State 1394
+    { 1394, 1004, PA_SHIFT, 13 },
+    // State 1395
+    { 1395, 996, PA_SHIFT, 6 },
+    // State 1395
+    { 1395, 998, PA_REDUCE, 699 },
+    // State 1396
+    { 1396, 1, PA_SHIFT, 8 },
+    // State 1396
+    { 1396, 994, PA_SHIFT, 10 },
+    // State 1396
+    { 1396, 995, PA_SHIFT, 9 },
+    // State 1396
+    { 1396, 1000, PA_SHIFT, 1397 },
+    // State 1396
+    { 1396, 1004, PA_SHIFT, 13 },
+    // State 1397
+    { 1397, 996, PA_SHIFT, 6 },
+    // State 1397
+    { 1397, 998, PA_REDUCE, 700 },
+    // State 1398
+    { 1398, 1, PA_SHIFT, 8 },
+    // State 1398
+    { 1398, 994, PA_SHIFT, 10 },
+    // State 1398
+    { 1398, 995, PA_SHIFT, 9 },
+    // State 1398
+    { 1398, 1000, PA_SHIFT, 1399 },
+    // State 1398
+    { 1398, 1004, PA_SHIFT, 13 },
+    // State 1399
+    { 1399, 996, PA_SHIFT, 6 },
+    // State 1399
+    { 1399, 998, PA_REDUCE, 701 },
+    // State 1400
+    { 1400, 1, PA_SHIFT, 8 },
+    // State 1400
+    { 1400, 994, PA_SHIFT, 10 },
+    // State 1400
+    { 1400, 995, PA_SHIFT, 9 },
+    // State 1400
+    { 1400, 1000, PA_SHIFT, 1401 },
+    // State 1400
+    { 1400, 1004, PA_SHIFT, 13 },
+    // State 1401
+    { 1401, 996, PA_SHIFT, 6 },
+    // State 1401
+    { 1401, 998, PA_REDUCE, 702 },
+    // State 1402
+    { 1402, 1, PA_SHIFT, 8 },
+    // State 1402
+    { 1402, 994, PA_SHIFT, 10 },
+    // State 1402
+    { 1402, 995, PA_SHIFT, 9 },
+    // State 1402
+    { 1402, 1000, PA_SHIFT, 1403 },
+    // State 1402
+    { 1402, 1004, PA_SHIFT, 13 },
+    // State 1403
+    { 1403, 996, PA_SHIFT, 6 },
+    // State 1403
+    { 1403, 998, PA_REDUCE, 703 },
+    // State 1404
+    { 1404, 1, PA_SHIFT, 8 },
+    // State 1404
+    { 1404, 994, PA_SHIFT, 10 },
+    // State 1404
+    { 1404, 995, PA_SHIFT, 9 },
+    // State 1404
+    { 1404, 1000, PA_SHIFT, 1405 },
+    // State 1404
+    { 1404, 1004, PA_SHIFT, 13 },
+    // State 1405
+    { 1405, 996, PA_SHIFT, 6 },
+    // State 1405
+    { 1405, 998, PA_REDUCE, 704 },
+    // State 1406
+    { 1406, 1, PA_SHIFT, 8 },
+    // State 1406
+    { 1406, 994, PA_SHIFT, 10 },
+    // State 1406
+    { 1406, 995, PA_SHIFT, 9 },
+    // State 1406
+    { 1406, 1000, PA_SHIFT, 1407 },
+    // State 1406
+    { 1406, 1004, PA_SHIFT, 13 },
+    // State 1407
+    { 1407, 996, PA_SHIFT, 6 },
+    // State 1407
+    { 1407, 998, PA_REDUCE, 705 },
+    // State 1408
+    { 1408, 1, PA_SHIFT, 8 },
+    // State 1408
+    { 1408, 994, PA_SHIFT, 10 },
+    // State 1408
+    { 1408, 995, PA_SHIFT, 9 },
+    // State 1408
+    { 1408, 1000, PA_SHIFT, 1409 },
+    // State 1408
+    { 1408, 1004, PA_SHIFT, 13 },
+    // State 1409
+    { 1409, 996, PA_SHIFT, 6 },
+    // State 1409
+    { 1409, 998, PA_REDUCE, 706 },
+    // State 1410
+    { 1410, 1, PA_SHIFT, 8 },
+    // State 1410
+    { 1410, 994, PA_SHIFT, 10 },
+    // State 1410
+    { 1410, 995, PA_SHIFT, 9 },
+    // State 1410
+    { 1410, 1000, PA_SHIFT, 1411 },
+    // State 1410
+    { 1410, 1004, PA_SHIFT, 13 },
+    // State 1411
+    { 1411, 996, PA_SHIFT, 6 },
+    // State 1411
+    { 1411, 998, PA_REDUCE, 707 },
+    // State 1412
+    { 1412, 1, PA_SHIFT, 8 },
+    // State 1412
+    { 1412, 994, PA_SHIFT, 10 },
+    // State 1412
+    { 1412, 995, PA_SHIFT, 9 },
+    // State 1412
+    { 1412, 1000, PA_SHIFT, 1413 },
+    // State 1412
+    { 1412, 1004, PA_SHIFT, 13 },
+    // State 1413
+    { 1413, 996, PA_SHIFT, 6 },
+    // State 1413
+    { 1413, 998, PA_REDUCE, 708 },
+    // State 1414
+    { 1414, 1, PA_SHIFT, 8 },
+    // State 1414
+    { 1414, 994, PA_SHIFT, 10 },
+    // State 1414
+    { 1414, 995, PA_SHIFT, 9 },
+    // State 1414
+    { 1414, 1000, PA_SHIFT, 1415 },
+    // State 1414
+    { 1414, 1004, PA_SHIFT, 13 },
+    // State 1415
+    { 1415, 996, PA_SHIFT, 6 },
+    // State 1415
+    { 1415, 998, PA_REDUCE, 709 },
+    // State 1416
+    { 1416, 1, PA_SHIFT, 8 },
+    // State 1416
+    { 1416, 994, PA_SHIFT, 10 },
+    // State 1416
+    { 1416, 995, PA_SHIFT, 9 },
+    // State 1416
+    { 1416, 1000, PA_SHIFT, 1417 },
+    // State 1416
+    { 1416, 1004, PA_SHIFT, 13 },
+    // State 1417
+    { 1417, 996, PA_SHIFT, 6 },
+    // State 1417
+    { 1417, 998, PA_REDUCE, 710 },
+    // State 1418
+    { 1418, 1, PA_SHIFT, 8 },
+    // State 1418
+    { 1418, 994, PA_SHIFT, 10 },
+    // State 1418
+    { 1418, 995, PA_SHIFT, 9 },
+    // State 1418
+    { 1418, 1000, PA_SHIFT, 1419 },
+    // State 1418
+    { 1418, 1004, PA_SHIFT, 13 },
+    // State 1419
+    { 1419, 996, PA_SHIFT, 6 },
+    // State 1419
+    { 1419, 998, PA_REDUCE, 711 },
+    // State 1420
+    { 1420, 1, PA_SHIFT, 8 },
+    // State 1420
+    { 1420, 994, PA_SHIFT, 10 },
+    // State 1420
+    { 1420, 995, PA_SHIFT, 9 },
+    // State 1420
+    { 1420, 1000, PA_SHIFT, 1421 },
+    // State 1420
+    { 1420, 1004, PA_SHIFT, 13 },
+    // State 1421
+    { 1421, 996, PA_SHIFT, 6 },
+    // State 1421
+    { 1421, 998, PA_REDUCE, 712 },
+    // State 1422
+    { 1422, 1, PA_SHIFT, 8 },
+    // State 1422
+    { 1422, 994, PA_SHIFT, 10 },
+    // State 1422
+    { 1422, 995, PA_SHIFT, 9 },
+    // State 1422
+    { 1422, 1000, PA_SHIFT, 1423 },
+    // State 1422
+    { 1422, 1004, PA_SHIFT, 13 },
+    // State 1423
+    { 1423, 996, PA_SHIFT, 6 },
+    // State 1423
+    { 1423, 998, PA_REDUCE, 713 },
+    // State 1424
+    { 1424, 1, PA_SHIFT, 8 },
+    // State 1424
+    { 1424, 994, PA_SHIFT, 10 },
+    // State 1424
+    { 1424, 995, PA_SHIFT, 9 },
+    // State 1424
+    { 1424, 1000, PA_SHIFT, 1425 },
+    // State 1424
+    { 1424, 1004, PA_SHIFT, 13 },
+    // State 1425
+    { 1425, 996, PA_SHIFT, 6 },
+    // State 1425
+    { 1425, 998, PA_REDUCE, 714 },
+    // State 1426
+    { 1426, 1, PA_SHIFT, 8 },
+    // State 1426
+    { 1426, 994, PA_SHIFT, 10 },
+    // State 1426
+    { 1426, 995, PA_SHIFT, 9 },
+    // State 1426
+    { 1426, 1000, PA_SHIFT, 1427 },
+    // State 1426
+    { 1426, 1004, PA_SHIFT, 13 },
+    // State 1427
+    { 1427, 996, PA_SHIFT, 6 },
+    // State 1427
+    { 1427, 998, PA_REDUCE, 715 },
+    // State 1428
+    { 1428, 1, PA_SHIFT, 8 },
+    // State 1428
+    { 1428, 994, PA_SHIFT, 10 },
+    // State 1428
+    { 1428, 995, PA_SHIFT, 9 },
+    // State 1428
+    { 1428, 1000, PA_SHIFT, 1429 },
+    // State 1428
+    { 1428, 1004, PA_SHIFT, 13 },
+    // State 1429
+    { 1429, 996, PA_SHIFT, 6 },
+    // State 1429
+    { 1429, 998, PA_REDUCE, 716 },
+    // State 1430
+    { 1430, 1, PA_SHIFT, 8 },
+    // State 1430
+    { 1430, 994, PA_SHIFT, 10 },
+    // State 1430
+    { 1430, 995, PA_SHIFT, 9 },
+    // State 1430
+    { 1430, 1000, PA_SHIFT, 1431 },
+    // State 1430
+    { 1430, 1004, PA_SHIFT, 13 },
+    // State 1431
+    { 1431, 996, PA_SHIFT, 6 },
+    // State 1431
+    { 1431, 998, PA_REDUCE, 717 },
+    // State 1432
+    { 1432, 1, PA_SHIFT, 8 },
+    // State 1432
+    { 1432, 994, PA_SHIFT, 10 },
+    // State 1432
+    { 1432, 995, PA_SHIFT, 9 },
+    // State 1432
+    { 1432, 1000, PA_SHIFT, 1433 },
+    // State 1432
+    { 1432, 1004, PA_SHIFT, 13 },
+    // State 1433
+    { 1433, 996, PA_SHIFT, 6 },
+    // State 1433
+    { 1433, 998, PA_REDUCE, 718 },
+    // State 1434
+    { 1434, 1, PA_SHIFT, 8 },
+    // State 1434
+    { 1434, 994, PA_SHIFT, 10 },
+    // State 1434
+    { 1434, 995, PA_SHIFT, 9 },
+    // State 1434
+    { 1434, 1000, PA_SHIFT, 1435 },
+    // State 1434
+    { 1434, 1004, PA_SHIFT, 13 },
+    // State 1435
+    { 1435, 996, PA_SHIFT, 6 },
+    // State 1435
+    { 1435, 998, PA_REDUCE, 719 },
+    // State 1436
+    { 1436, 1, PA_SHIFT, 8 },
+    // State 1436
+    { 1436, 994, PA_SHIFT, 10 },
+    // State 1436
+    { 1436, 995, PA_SHIFT, 9 },
+    // State 1436
+    { 1436, 1000, PA_SHIFT, 1437 },
+    // State 1436
+    { 1436, 1004, PA_SHIFT, 13 },
+    // State 1437
+    { 1437, 996, PA_SHIFT, 6 },
+    // State 1437
+    { 1437, 998, PA_REDUCE, 720 },
+    // State 1438
+    { 1438, 1, PA_SHIFT, 8 },
+    // State 1438
+    { 1438, 994, PA_SHIFT, 10 },
+    // State 1438
+    { 1438, 995, PA_SHIFT, 9 },
+    // State 1438
+    { 1438, 1000, PA_SHIFT, 1439 },
+    // State 1438
+    { 1438, 1004, PA_SHIFT, 13 },
+    // State 1439
+    { 1439, 996, PA_SHIFT, 6 },
+    // State 1439
+    { 1439, 998, PA_REDUCE, 721 },
+    // State 1440
+    { 1440, 1, PA_SHIFT, 8 },
+    // State 1440
+    { 1440, 994, PA_SHIFT, 10 },
+    // State 1440
+    { 1440, 995, PA_SHIFT, 9 },
+    // State 1440
+    { 1440, 1000, PA_SHIFT, 1441 },
+    // State 1440
+    { 1440, 1004, PA_SHIFT, 13 },
+    // State 1441
+    { 1441, 996, PA_SHIFT, 6 },
+    // State 1441
+    { 1441, 998, PA_REDUCE, 722 },
+    // State 1442
+    { 1442, 1, PA_SHIFT, 8 },
+    // State 1442
+    { 1442, 994, PA_SHIFT, 10 },
+    // State 1442
+    { 1442, 995, PA_SHIFT, 9 },
+    // State 1442
+    { 1442, 1000, PA_SHIFT, 1443 },
+    // State 1442
+    { 1442, 1004, PA_SHIFT, 13 },
+    // State 1443
+    { 1443, 996, PA_SHIFT, 6 },
+    // State 1443
+    { 1443, 998, PA_REDUCE, 723 },
+    // State 1444
+    { 1444, 1, PA_SHIFT, 8 },
+    // State 1444
+    { 1444, 994, PA_SHIFT, 10 },
+    // State 1444
+    { 1444, 995, PA_SHIFT, 9 },
+    // State 1444
+    { 1444, 1000, PA_SHIFT, 1445 },
+    // State 1444
+    { 1444, 1004, PA_SHIFT, 13 },
+    // State 1445
+    { 1445, 996, PA_SHIFT, 6 },
+    // State 1445
+    { 1445, 998, PA_REDUCE, 724 },
+    // State 1446
+    { 1446, 1, PA_SHIFT, 8 },
+    // State 1446
+    { 1446, 994, PA_SHIFT, 10 },
+    // State 1446
+    { 1446, 995, PA_SHIFT, 9 },
+    // State 1446
+    { 1446, 1000, PA_SHIFT, 1447 },
+    // State 1446
+    { 1446, 1004, PA_SHIFT, 13 },
+    // State 1447
+    { 1447, 996, PA_SHIFT, 6 },
+    // State 1447
+    { 1447, 998, PA_REDUCE, 725 },
+    // State 1448
+    { 1448, 1, PA_SHIFT, 8 },
+    // State 1448
+    { 1448, 994, PA_SHIFT, 10 },
+    // State 1448
+    { 1448, 995, PA_SHIFT, 9 },
+    // State 1448
+    { 1448, 1000, PA_SHIFT, 1449 },
+    // State 1448
+    { 1448, 1004, PA_SHIFT, 13 },
+    // State 1449
+    { 1449, 996, PA_SHIFT, 6 },
+    // State 1449
+    { 1449, 998, PA_REDUCE, 726 },
+    // State 1450
+    { 1450, 1, PA_SHIFT, 8 },
+    // State 1450
+    { 1450, 994, PA_SHIFT, 10 },
+    // State 1450
+    { 1450, 995, PA_SHIFT, 9 },
+    // State 1450
+    { 1450, 1000, PA_SHIFT, 1451 },
+    // State 1450
+    { 1450, 1004, PA_SHIFT, 13 },
+    // State 1451
+    { 1451, 996, PA_SHIFT, 6 },
+    // State 1451
+    { 1451, 998, PA_REDUCE, 727 },
+    // State 1452
+    { 1452, 1, PA_SHIFT, 8 },
+    // State 1452
+    { 1452, 994, PA_SHIFT, 10 },
+    // State 1452
+    { 1452, 995, PA_SHIFT, 9 },
+    // State 1452
+    { 1452, 1000, PA_SHIFT, 1453 },
+    // State 1452
+    { 1452, 1004, PA_SHIFT, 13 },
+    // State 1453
+    { 1453, 996, PA_SHIFT, 6 },
+    // State 1453
+    { 1453, 998, PA_REDUCE, 728 },
+    // State 1454
+    { 1454, 1, PA_SHIFT, 8 },
+    // State 1454
+    { 1454, 994, PA_SHIFT, 10 },
+    // State 1454
+    { 1454, 995, PA_SHIFT, 9 },
+    // State 1454
+    { 1454, 1000, PA_SHIFT, 1455 },
+    // State 1454
+    { 1454, 1004, PA_SHIFT, 13 },
+    // State 1455
+    { 1455, 996, PA_SHIFT, 6 },
+    // State 1455
+    { 1455, 998, PA_REDUCE, 729 },
+    // State 1456
+    { 1456, 1, PA_SHIFT, 8 },
+    // State 1456
+    { 1456, 994, PA_SHIFT, 10 },
+    // State 1456
+    { 1456, 995, PA_SHIFT, 9 },
+    // State 1456
+    { 1456, 1000, PA_SHIFT, 1457 },
+    // State 1456
+    { 1456, 1004, PA_SHIFT, 13 },
+    // State 1457
+    { 1457, 996, PA_SHIFT, 6 },
+    // State 1457
+    { 1457, 998, PA_REDUCE, 730 },
+    // State 1458
+    { 1458, 1, PA_SHIFT, 8 },
+    // State 1458
+    { 1458, 994, PA_SHIFT, 10 },
+    // State 1458
+    { 1458, 995, PA_SHIFT, 9 },
+    // State 1458
+    { 1458, 1000, PA_SHIFT, 1459 },
+    // State 1458
+    { 1458, 1004, PA_SHIFT, 13 },
+    // State 1459
+    { 1459, 996, PA_SHIFT, 6 },
+    // State 1459
+    { 1459, 998, PA_REDUCE, 731 },
+    // State 1460
+    { 1460, 1, PA_SHIFT, 8 },
+    // State 1460
+    { 1460, 994, PA_SHIFT, 10 },
+    // State 1460
+    { 1460, 995, PA_SHIFT, 9 },
+    // State 1460
+    { 1460, 1000, PA_SHIFT, 1461 },
+    // State 1460
+    { 1460, 1004, PA_SHIFT, 13 },
+    // State 1461
+    { 1461, 996, PA_SHIFT, 6 },
+    // State 1461
+    { 1461, 998, PA_REDUCE, 732 },
+    // State 1462
+    { 1462, 1, PA_SHIFT, 8 },
+    // State 1462
+    { 1462, 994, PA_SHIFT, 10 },
+    // State 1462
+    { 1462, 995, PA_SHIFT, 9 },
+    // State 1462
+    { 1462, 1000, PA_SHIFT, 1463 },
+    // State 1462
+    { 1462, 1004, PA_SHIFT, 13 },
+    // State 1463
+    { 1463, 996, PA_SHIFT, 6 },
+    // State 1463
+    { 1463, 998, PA_REDUCE, 733 },
+    // State 1464
+    { 1464, 1, PA_SHIFT, 8 },
+    // State 1464
+    { 1464, 994, PA_SHIFT, 10 },
+    // State 1464
+    { 1464, 995, PA_SHIFT, 9 },
+    // State 1464
+    { 1464, 1000, PA_SHIFT, 1465 },
+    // State 1464
+    { 1464, 1004, PA_SHIFT, 13 },
+    // State 1465
+    { 1465, 996, PA_SHIFT, 6 },
+    // State 1465
+    { 1465, 998, PA_REDUCE, 734 },
+    // State 1466
+    { 1466, 1, PA_SHIFT, 8 },
+    // State 1466
+    { 1466, 994, PA_SHIFT, 10 },
+    // State 1466
+    { 1466, 995, PA_SHIFT, 9 },
+    // State 1466
+    { 1466, 1000, PA_SHIFT, 1467 },
+    // State 1466
+    { 1466, 1004, PA_SHIFT, 13 },
+    // State 1467
+    { 1467, 996, PA_SHIFT, 6 },
+    // State 1467
+    { 1467, 998, PA_REDUCE, 735 },
+    // State 1468
+    { 1468, 1, PA_SHIFT, 8 },
+    // State 1468
+    { 1468, 994, PA_SHIFT, 10 },
+    // State 1468
+    { 1468, 995, PA_SHIFT, 9 },
+    // State 1468
+    { 1468, 1000, PA_SHIFT, 1469 },
+    // State 1468
+    { 1468, 1004, PA_SHIFT, 13 },
+    // State 1469
+    { 1469, 996, PA_SHIFT, 6 },
+    // State 1469
+    { 1469, 998, PA_REDUCE, 736 },
+    // State 1470
+    { 1470, 1, PA_SHIFT, 8 },
+    // State 1470
+    { 1470, 994, PA_SHIFT, 10 },
+    // State 1470
+    { 1470, 995, PA_SHIFT, 9 },
+    // State 1470
+    { 1470, 1000, PA_SHIFT, 1471 },
+    // State 1470
+    { 1470, 1004, PA_SHIFT, 13 },
+    // State 1471
+    { 1471, 996, PA_SHIFT, 6 },
+    // State 1471
+    { 1471, 998, PA_REDUCE, 737 },
+    // State 1472
+    { 1472, 1, PA_SHIFT, 8 },
+    // State 1472
+    { 1472, 994, PA_SHIFT, 10 },
+    // State 1472
+    { 1472, 995, PA_SHIFT, 9 },
+    // State 1472
+    { 1472, 1000, PA_SHIFT, 1473 },
+    // State 1472
+    { 1472, 1004, PA_SHIFT, 13 },
+    // State 1473
+    { 1473, 996, PA_SHIFT, 6 },
+    // State 1473
+    { 1473, 998, PA_REDUCE, 738 },
+    // State 1474
+    { 1474, 1, PA_SHIFT, 8 },
+    // State 1474
+    { 1474, 994, PA_SHIFT, 10 },
+    // State 1474
+    { 1474, 995, PA_SHIFT, 9 },
+    // State 1474
+    { 1474, 1000, PA_SHIFT, 1475 },
+    // State 1474
+    { 1474, 1004, PA_SHIFT, 13 },
+    // State 1475
+    { 1475, 996, PA_SHIFT, 6 },
+    // State 1475
+    { 1475, 998, PA_REDUCE, 739 },
+    // State 1476
+    { 1476, 1, PA_SHIFT, 8 },
+    // State 1476
+    { 1476, 994, PA_SHIFT, 10 },
+    // State 1476
+    { 1476, 995, PA_SHIFT, 9 },
+    // State 1476
+    { 1476, 1000, PA_SHIFT, 1477 },
+    // State 1476
+    { 1476, 1004, PA_SHIFT, 13 },
+    // State 1477
+    { 1477, 996, PA_SHIFT, 6 },
+    // State 1477
+    { 1477, 998, PA_REDUCE, 740 },
+    // State 1478
+    { 1478, 1, PA_SHIFT, 8 },
+    // State 1478
+    { 1478, 994, PA_SHIFT, 10 },
+    // State 1478
+    { 1478, 995, PA_SHIFT, 9 },
+    // State 1478
+    { 1478, 1000, PA_SHIFT, 1479 },
+    // State 1478
+    { 1478, 1004, PA_SHIFT, 13 },
+    // State 1479
+    { 1479, 996, PA_SHIFT, 6 },
+    // State 1479
+    { 1479, 998, PA_REDUCE, 741 },
+    // State 1480
+    { 1480, 1, PA_SHIFT, 8 },
+    // State 1480
+    { 1480, 994, PA_SHIFT, 10 },
+    // State 1480
+    { 1480, 995, PA_SHIFT, 9 },
+    // State 1480
+    { 1480, 1000, PA_SHIFT, 1481 },
+    // State 1480
+    { 1480, 1004, PA_SHIFT, 13 },
+    // State 1481
+    { 1481, 996, PA_SHIFT, 6 },
+    // State 1481
+    { 1481, 998, PA_REDUCE, 742 },
+    // State 1482
+    { 1482, 1, PA_SHIFT, 8 },
+    // State 1482
+    { 1482, 994, PA_SHIFT, 10 },
+    // State 1482
+    { 1482, 995, PA_SHIFT, 9 },
+    // State 1482
+    { 1482, 1000, PA_SHIFT, 1483 },
+    // State 1482
+    { 1482, 1004, PA_SHIFT, 13 },
+    // State 1483
+    { 1483, 996, PA_SHIFT, 6 },
+    // State 1483
+    { 1483, 998, PA_REDUCE, 743 },
+    // State 1484
+    { 1484, 1, PA_SHIFT, 8 },
+    // State 1484
+    { 1484, 994, PA_SHIFT, 10 },
+    // State 1484
+    { 1484, 995, PA_SHIFT, 9 },
+    // State 1484
+    { 1484, 1000, PA_SHIFT, 1485 },
+    // State 1484
+    { 1484, 1004, PA_SHIFT, 13 },
+    // State 1485
+    { 1485, 996, PA_SHIFT, 6 },
+    // State 1485
+    { 1485, 998, PA_REDUCE, 744 },
+    // State 1486
+    { 1486, 1, PA_SHIFT, 8 },
+    // State 1486
+    { 1486, 994, PA_SHIFT, 10 },
+    // State 1486
+    { 1486, 995, PA_SHIFT, 9 },
+    // State 1486
+    { 1486, 1000, PA_SHIFT, 1487 },
+    // State 1486
+    { 1486, 1004, PA_SHIFT, 13 },
+    // State 1487
+    { 1487, 996, PA_SHIFT, 6 },
+    // State 1487
+    { 1487, 998, PA_REDUCE, 745 },
+    // State 1488
+    { 1488, 1, PA_SHIFT, 8 },
+    // State 1488
+    { 1488, 994, PA_SHIFT, 10 },
+    // State 1488
+    { 1488, 995, PA_SHIFT, 9 },
+    // State 1488
+    { 1488, 1000, PA_SHIFT, 1489 },
+    // State 1488
+    { 1488, 1004, PA_SHIFT, 13 },
+    // State 1489
+    { 1489, 996, PA_SHIFT, 6 },
+    // State 1489
+    { 1489, 998, PA_REDUCE, 746 },
+    // State 1490
+    { 1490, 1, PA_SHIFT, 8 },
+    // State 1490
+    { 1490, 994, PA_SHIFT, 10 },
+    // State 1490
+    { 1490, 995, PA_SHIFT, 9 },
+    // State 1490
+    { 1490, 1000, PA_SHIFT, 1491 },
+    // State 1490
+    { 1490, 1004, PA_SHIFT, 13 },
+    // State 1491
+    { 1491, 996, PA_SHIFT, 6 },
+    // State 1491
+    { 1491, 998, PA_REDUCE, 747 },
+    // State 1492
+    { 1492, 1, PA_SHIFT, 8 },
+    // State 1492
+    { 1492, 994, PA_SHIFT, 10 },
+    // State 1492
+    { 1492, 995, PA_SHIFT, 9 },
+    // State 1492
+    { 1492, 1000, PA_SHIFT, 1493 },
+    // State 1492
+    { 1492, 1004, PA_SHIFT, 13 },
+    // State 1493
+    { 1493, 996, PA_SHIFT, 6 },
+    // State 1493
+    { 1493, 998, PA_REDUCE, 748 },
+    // State 1494
+    { 1494, 1, PA_SHIFT, 8 },
+    // State 1494
+    { 1494, 994, PA_SHIFT, 10 },
+    // State 1494
+    { 1494, 995, PA_SHIFT, 9 },
+    // State 1494
+    { 1494, 1000, PA_SHIFT, 1495 },
+    // State 1494
+    { 1494, 1004, PA_SHIFT, 13 },
+    // State 1495
+    { 1495, 996, PA_SHIFT, 6 },
+    // State 1495
+    { 1495, 998, PA_REDUCE, 749 },
+    // State 1496
+    { 1496, 1, PA_SHIFT, 8 },
+    // State 1496
+    { 1496, 994, PA_SHIFT, 10 },
+    // State 1496
+    { 1496, 995, PA_SHIFT, 9 },
+    // State 1496
+    { 1496, 1000, PA_SHIFT, 1497 },
+    // State 1496
+    { 1496, 1004, PA_SHIFT, 13 },
+    // State 1497
+    { 1497, 996, PA_SHIFT, 6 },
+    // State 1497
+    { 1497, 998, PA_REDUCE, 750 },
+    // State 1498
+    { 1498, 1, PA_SHIFT, 8 },
+    // State 1498
+    { 1498, 994, PA_SHIFT, 10 },
+    // State 1498
+    { 1498, 995, PA_SHIFT, 9 },
+    // State 1498
+    { 1498, 1000, PA_SHIFT, 1499 },
+    // State 1498
+    { 1498, 1004, PA_SHIFT, 13 },
+    // State 1499
+    { 1499, 996, PA_SHIFT, 6 },
+    // State 1499
+    { 1499, 998, PA_REDUCE, 751 },
+    // State 1500
+    { 1500, 1, PA_SHIFT, 8 },
+    // State 1500
+    { 1500, 994, PA_SHIFT, 10 },
+    // State 1500
+    { 1500, 995, PA_SHIFT, 9 },
+    // State 1500
+    { 1500, 1000, PA_SHIFT, 1501 },
+    // State 1500
+    { 1500, 1004, PA_SHIFT, 13 },
+    // State 1501
+    { 1501, 996, PA_SHIFT, 6 },
+    // State 1501
+    { 1501, 998, PA_REDUCE, 752 },
+    // State 1502
+    { 1502, 1, PA_SHIFT, 8 },
+    // State 1502
+    { 1502, 994, PA_SHIFT, 10 },
+    // State 1502
+    { 1502, 995, PA_SHIFT, 9 },
+    // State 1502
+    { 1502, 1000, PA_SHIFT, 1503 },
+    // State 1502
+    { 1502, 1004, PA_SHIFT, 13 },
+    // State 1503
+    { 1503, 996, PA_SHIFT, 6 },
+    // State 1503
+    { 1503, 998, PA_REDUCE, 753 },
+    // State 1504
+    { 1504, 1, PA_SHIFT, 8 },
+    // State 1504
+    { 1504, 994, PA_SHIFT, 10 },
+    // State 1504
+    { 1504, 995, PA_SHIFT, 9 },
+    // State 1504
+    { 1504, 1000, PA_SHIFT, 1505 },
+    // State 1504
+    { 1504, 1004, PA_SHIFT, 13 },
+    // State 1505
+    { 1505, 996, PA_SHIFT, 6 },
+    // State 1505
+    { 1505, 998, PA_REDUCE, 754 },
+    // State 1506
+    { 1506, 1, PA_SHIFT, 8 },
+    // State 1506
+    { 1506, 994, PA_SHIFT, 10 },
+    // State 1506
+    { 1506, 995, PA_SHIFT, 9 },
+    // State 1506
+    { 1506, 1000, PA_SHIFT, 1507 },
+    // State 1506
+    { 1506, 1004, PA_SHIFT, 13 },
+    // State 1507
+    { 1507, 996, PA_SHIFT, 6 },
+    // State 1507
+    { 1507, 998, PA_REDUCE, 755 },
+    // State 1508
+    { 1508, 1, PA_SHIFT, 8 },
+    // State 1508
+    { 1508, 994, PA_SHIFT, 10 },
+    // State 1508
+    { 1508, 995, PA_SHIFT, 9 },
+    // State 1508
+    { 1508, 1000, PA_SHIFT, 1509 },
+    // State 1508
+    { 1508, 1004, PA_SHIFT, 13 },
+    // State 1509
+    { 1509, 996, PA_SHIFT, 6 },
+    // State 1509
+    { 1509, 998, PA_REDUCE, 756 },
+    // State 1510
+    { 1510, 1, PA_SHIFT, 8 },
+    // State 1510
+    { 1510, 994, PA_SHIFT, 10 },
+    // State 1510
+    { 1510, 995, PA_SHIFT, 9 },
+    // State 1510
+    { 1510, 1000, PA_SHIFT, 1511 },
+    // State 1510
+    { 1510, 1004, PA_SHIFT, 13 },
+    // State 1511
+    { 1511, 996, PA_SHIFT, 6 },
+    // State 1511
+    { 1511, 998, PA_REDUCE, 757 },
+    // State 1512
+    { 1512, 1, PA_SHIFT, 8 },
+    // State 1512
+    { 1512, 994, PA_SHIFT, 10 },
+    // State 1512
+    { 1512, 995, PA_SHIFT, 9 },
+    // State 1512
+    { 1512, 1000, PA_SHIFT, 1513 },
+    // State 1512
+    { 1512, 1004, PA_SHIFT, 13 },
+    // State 1513
+    { 1513, 996, PA_SHIFT, 6 },
+    // State 1513
+    { 1513, 998, PA_REDUCE, 758 },
+    // State 1514
+    { 1514, 1, PA_SHIFT, 8 },
+    // State 1514
+    { 1514, 994, PA_SHIFT, 10 },
+    // State 1514
+    { 1514, 995, PA_SHIFT, 9 },
+    // State 1514
+    { 1514, 1000, PA_SHIFT, 1515 },
+    // State 1514
+    { 1514, 1004, PA_SHIFT, 13 },
+    // State 1515
+    { 1515, 996, PA_SHIFT, 6 },
+    // State 1515
+    { 1515, 998, PA_REDUCE, 759 },
+    // State 1516
+    { 1516, 1, PA_SHIFT, 8 },
+    // State 1516
+    { 1516, 994, PA_SHIFT, 10 },
+    // State 1516
+    { 1516, 995, PA_SHIFT, 9 },
+    // State 1516
+    { 1516, 1000, PA_SHIFT, 1517 },
+    // State 1516
+    { 1516, 1004, PA_SHIFT, 13 },
+    // State 1517
+    { 1517, 996, PA_SHIFT, 6 },
+    // State 1517
+    { 1517, 998, PA_REDUCE, 760 },
+    // State 1518
+    { 1518, 1, PA_SHIFT, 8 },
+    // State 1518
+    { 1518, 994, PA_SHIFT, 10 },
+    // State 1518
+    { 1518, 995, PA_SHIFT, 9 },
+    // State 1518
+    { 1518, 1000, PA_SHIFT, 1519 },
+    // State 1518
+    { 1518, 1004, PA_SHIFT, 13 },
+    // State 1519
+    { 1519, 996, PA_SHIFT, 6 },
+    // State 1519
+    { 1519, 998, PA_REDUCE, 761 },
+    // State 1520
+    { 1520, 1, PA_SHIFT, 8 },
+    // State 1520
+    { 1520, 994, PA_SHIFT, 10 },
+    // State 1520
+    { 1520, 995, PA_SHIFT, 9 },
+    // State 1520
+    { 1520, 1000, PA_SHIFT, 1521 },
+    // State 1520
+    { 1520, 1004, PA_SHIFT, 13 },
+    // State 1521
+    { 1521, 996, PA_SHIFT, 6 },
+    // State 1521
+    { 1521, 998, PA_REDUCE, 762 },
+    // State 1522
+    { 1522, 1, PA_SHIFT, 8 },
+    // State 1522
+    { 1522, 994, PA_SHIFT, 10 },
+    // State 1522
+    { 1522, 995, PA_SHIFT, 9 },
+    // State 1522
+    { 1522, 1000, PA_SHIFT, 1523 },
+    // State 1522
+    { 1522, 1004, PA_SHIFT, 13 },
+    // State 1523
+    { 1523, 996, PA_SHIFT, 6 },
+    // State 1523
+    { 1523, 998, PA_REDUCE, 763 },
+    // State 1524
+    { 1524, 1, PA_SHIFT, 8 },
+    // State 1524
+    { 1524, 994, PA_SHIFT, 10 },
+    // State 1524
+    { 1524, 995, PA_SHIFT, 9 },
+    // State 1524
+    { 1524, 1000, PA_SHIFT, 1525 },
+    // State 1524
+    { 1524, 1004, PA_SHIFT, 13 },
+    // State 1525
+    { 1525, 996, PA_SHIFT, 6 },
+    // State 1525
+    { 1525, 998, PA_REDUCE, 764 },
+    // State 1526
+    { 1526, 1, PA_SHIFT, 8 },
+    // State 1526
+    { 1526, 994, PA_SHIFT, 10 },
+    // State 1526
+    { 1526, 995, PA_SHIFT, 9 },
+    // State 1526
+    { 1526, 1000, PA_SHIFT, 1527 },
+    // State 1526
+    { 1526, 1004, PA_SHIFT, 13 },
+    // State 1527
+    { 1527, 996, PA_SHIFT, 6 },
+    // State 1527
+    { 1527, 998, PA_REDUCE, 765 },
+    // State 1528
+    { 1528, 1, PA_SHIFT, 8 },
+    // State 1528
+    { 1528, 994, PA_SHIFT, 10 },
+    // State 1528
+    { 1528, 995, PA_SHIFT, 9 },
+    // State 1528
+    { 1528, 1000, PA_SHIFT, 1529 },
+    // State 1528
+    { 1528, 1004, PA_SHIFT, 13 },
+    // State 1529
+    { 1529, 996, PA_SHIFT, 6 },
+    // State 1529
+    { 1529, 998, PA_REDUCE, 766 },
+    // State 1530
+    { 1530, 1, PA_SHIFT, 8 },
+    // State 1530
+    { 1530, 994, PA_SHIFT, 10 },
+    // State 1530
+    { 1530, 995, PA_SHIFT, 9 },
+    // State 1530
+    { 1530, 1000, PA_SHIFT, 1531 },
+    // State 1530
+    { 1530, 1004, PA_SHIFT, 13 },
+    // State 1531
+    { 1531, 996, PA_SHIFT, 6 },
+    // State 1531
+    { 1531, 998, PA_REDUCE, 767 },
+    // State 1532
+    { 1532, 1, PA_SHIFT, 8 },
+    // State 1532
+    { 1532, 994, PA_SHIFT, 10 },
+    // State 1532
+    { 1532, 995, PA_SHIFT, 9 },
+    // State 1532
+    { 1532, 1000, PA_SHIFT, 1533 },
+    // State 1532
+    { 1532, 1004, PA_SHIFT, 13 },
+    // State 1533
+    { 1533, 996, PA_SHIFT, 6 },
+    // State 1533
+    { 1533, 998, PA_REDUCE, 768 },
+    // State 1534
+    { 1534, 1, PA_SHIFT, 8 },
+    // State 1534
+    { 1534, 994, PA_SHIFT, 10 },
+    // State 1534
+    { 1534, 995, PA_SHIFT, 9 },
+    // State 1534
+    { 1534, 1000, PA_SHIFT, 1535 },
+    // State 1534
+    { 1534, 1004, PA_SHIFT, 13 },
+    // State 1535
+    { 1535, 996, PA_SHIFT, 6 },
+    // State 1535
+    { 1535, 998, PA_REDUCE, 769 },
+    // State 1536
+    { 1536, 1, PA_SHIFT, 8 },
+    // State 1536
+    { 1536, 994, PA_SHIFT, 10 },
+    // State 1536
+    { 1536, 995, PA_SHIFT, 9 },
+    // State 1536
+    { 1536, 1000, PA_SHIFT, 1537 },
+    // State 1536
+    { 1536, 1004, PA_SHIFT, 13 },
+    // State 1537
+    { 1537, 996, PA_SHIFT, 6 },
+    // State 1537
+    { 1537, 998, PA_REDUCE, 770 },
+    // State 1538
+    { 1538, 1, PA_SHIFT, 8 },
+    // State 1538
+    { 1538, 994, PA_SHIFT, 10 },
+    // State 1538
+    { 1538, 995, PA_SHIFT, 9 },
+    // State 1538
+    { 1538, 1000, PA_SHIFT, 1539 },
+    // State 1538
+    { 1538, 1004, PA_SHIFT, 13 },
+    // State 1539
+    { 1539, 996, PA_SHIFT, 6 },
+    // State 1539
+    { 1539, 998, PA_REDUCE, 771 },
+    // State 1540
+    { 1540, 1, PA_SHIFT, 8 },
+    // State 1540
+    { 1540, 994, PA_SHIFT, 10 },
+    // State 1540
+    { 1540, 995, PA_SHIFT, 9 },
+    // State 1540
+    { 1540, 1000, PA_SHIFT, 1541 },
+    // State 1540
+    { 1540, 1004, PA_SHIFT, 13 },
+    // State 1541
+    { 1541, 996, PA_SHIFT, 6 },
+    // State 1541
+    { 1541, 998, PA_REDUCE, 772 },
+    // State 1542
+    { 1542, 1, PA_SHIFT, 8 },
+    // State 1542
+    { 1542, 994, PA_SHIFT, 10 },
+    // State 1542
+    { 1542, 995, PA_SHIFT, 9 },
+    // State 1542
+    { 1542, 1000, PA_SHIFT, 1543 },
+    // State 1542
+    { 1542, 1004, PA_SHIFT, 13 },
+    // State 1543
+    { 1543, 996, PA_SHIFT, 6 },
+    // State 1543
+    { 1543, 998, PA_REDUCE, 773 },
+    // State 1544
+    { 1544, 1, PA_SHIFT, 8 },
+    // State 1544
+    { 1544, 994, PA_SHIFT, 10 },
+    // State 1544
+    { 1544, 995, PA_SHIFT, 9 },
+    // State 1544
+    { 1544, 1000, PA_SHIFT, 1545 },
+    // State 1544
+    { 1544, 1004, PA_SHIFT, 13 },
+    // State 1545
+    { 1545, 996, PA_SHIFT, 6 },
+    // State 1545
+    { 1545, 998, PA_REDUCE, 774 },
+    // State 1546
+    { 1546, 1, PA_SHIFT, 8 },
+    // State 1546
+    { 1546, 994, PA_SHIFT, 10 },
+    // State 1546
+    { 1546, 995, PA_SHIFT, 9 },
+    // State 1546
+    { 1546, 1000, PA_SHIFT, 1547 },
+    // State 1546
+    { 1546, 1004, PA_SHIFT, 13 },
+    // State 1547
+    { 1547, 996, PA_SHIFT, 6 },
+    // State 1547
+    { 1547, 998, PA_REDUCE, 775 },
+    // State 1548
+    { 1548, 1, PA_SHIFT, 8 },
+    // State 1548
+    { 1548, 994, PA_SHIFT, 10 },
+    // State 1548
+    { 1548, 995, PA_SHIFT, 9 },
+    // State 1548
+    { 1548, 1000, PA_SHIFT, 1549 },
+    // State 1548
+    { 1548, 1004, PA_SHIFT, 13 },
+    // State 1549
+    { 1549, 996, PA_SHIFT, 6 },
+    // State 1549
+    { 1549, 998, PA_REDUCE, 776 },
+    // State 1550
+    { 1550, 1, PA_SHIFT, 8 },
+    // State 1550
+    { 1550, 994, PA_SHIFT, 10 },
+    // State 1550
+    { 1550, 995, PA_SHIFT, 9 },
+    // State 1550
+    { 1550, 1000, PA_SHIFT, 1551 },
+    // State 1550
+    { 1550, 1004, PA_SHIFT, 13 },
+    // State 1551
+    { 1551, 996, PA_SHIFT, 6 },
+    // State 1551
+    { 1551, 998, PA_REDUCE, 777 },
+    // State 1552
+    { 1552, 1, PA_SHIFT, 8 },
+    // State 1552
+    { 1552, 994, PA_SHIFT, 10 },
+    // State 1552
+    { 1552, 995, PA_SHIFT, 9 },
+    // State 1552
+    { 1552, 1000, PA_SHIFT, 1553 },
+    // State 1552
+    { 1552, 1004, PA_SHIFT, 13 },
+    // State 1553
+    { 1553, 996, PA_SHIFT, 6 },
+    // State 1553
+    { 1553, 998, PA_REDUCE, 778 },
+    // State 1554
+    { 1554, 1, PA_SHIFT, 8 },
+    // State 1554
+    { 1554, 994, PA_SHIFT, 10 },
+    // State 1554
+    { 1554, 995, PA_SHIFT, 9 },
+    // State 1554
+    { 1554, 1000, PA_SHIFT, 1555 },
+    // State 1554
+    { 1554, 1004, PA_SHIFT, 13 },
+    // State 1555
+    { 1555, 996, PA_SHIFT, 6 },
+    // State 1555
+    { 1555, 998, PA_REDUCE, 779 },
+    // State 1556
+    { 1556, 1, PA_SHIFT, 8 },
+    // State 1556
+    { 1556, 994, PA_SHIFT, 10 },
+    // State 1556
+    { 1556, 995, PA_SHIFT, 9 },
+    // State 1556
+    { 1556, 1000, PA_SHIFT, 1557 },
+    // State 1556
+    { 1556, 1004, PA_SHIFT, 13 },
+    // State 1557
+    { 1557, 996, PA_SHIFT, 6 },
+    // State 1557
+    { 1557, 998, PA_REDUCE, 780 },
+    // State 1558
+    { 1558, 1, PA_SHIFT, 8 },
+    // State 1558
+    { 1558, 994, PA_SHIFT, 10 },
+    // State 1558
+    { 1558, 995, PA_SHIFT, 9 },
+    // State 1558
+    { 1558, 1000, PA_SHIFT, 1559 },
+    // State 1558
+    { 1558, 1004, PA_SHIFT, 13 },
+    // State 1559
+    { 1559, 996, PA_SHIFT, 6 },
+    // State 1559
+    { 1559, 998, PA_REDUCE, 781 },
+    // State 1560
+    { 1560, 1, PA_SHIFT, 8 },
+    // State 1560
+    { 1560, 994, PA_SHIFT, 10 },
+    // State 1560
+    { 1560, 995, PA_SHIFT, 9 },
+    // State 1560
+    { 1560, 1000, PA_SHIFT, 1561 },
+    // State 1560
+    { 1560, 1004, PA_SHIFT, 13 },
+    // State 1561
+    { 1561, 996, PA_SHIFT, 6 },
+    // State 1561
+    { 1561, 998, PA_REDUCE, 782 },
+    // State 1562
+    { 1562, 1, PA_SHIFT, 8 },
+    // State 1562
+    { 1562, 994, PA_SHIFT, 10 },
+    // State 1562
+    { 1562, 995, PA_SHIFT, 9 },
+    // State 1562
+    { 1562, 1000, PA_SHIFT, 1563 },
+    // State 1562
+    { 1562, 1004, PA_SHIFT, 13 },
+    // State 1563
+    { 1563, 996, PA_SHIFT, 6 },
+    // State 1563
+    { 1563, 998, PA_REDUCE, 783 },
+    // State 1564
+    { 1564, 1, PA_SHIFT, 8 },
+    // State 1564
+    { 1564, 994, PA_SHIFT, 10 },
+    // State 1564
+    { 1564, 995, PA_SHIFT, 9 },
+    // State 1564
+    { 1564, 1000, PA_SHIFT, 1565 },
+    // State 1564
+    { 1564, 1004, PA_SHIFT, 13 },
+    // State 1565
+    { 1565, 996, PA_SHIFT, 6 },
+    // State 1565
+    { 1565, 998, PA_REDUCE, 784 },
+    // State 1566
+    { 1566, 1, PA_SHIFT, 8 },
+    // State 1566
+    { 1566, 994, PA_SHIFT, 10 },
+    // State 1566
+    { 1566, 995, PA_SHIFT, 9 },
+    // State 1566
+    { 1566, 1000, PA_SHIFT, 1567 },
+    // State 1566
+    { 1566, 1004, PA_SHIFT, 13 },
+    // State 1567
+    { 1567, 996, PA_SHIFT, 6 },
+    // State 1567
+    { 1567, 998, PA_REDUCE, 785 },
+    // State 1568
+    { 1568, 1, PA_SHIFT, 8 },
+    // State 1568
+    { 1568, 994, PA_SHIFT, 10 },
+    // State 1568
+    { 1568, 995, PA_SHIFT, 9 },
+    // State 1568
+    { 1568, 1000, PA_SHIFT, 1569 },
+    // State 1568
+    { 1568, 1004, PA_SHIFT, 13 },
+    // State 1569
+    { 1569, 996, PA_SHIFT, 6 },
+    // State 1569
+    { 1569, 998, PA_REDUCE, 786 },
+    // State 1570
+    { 1570, 1, PA_SHIFT, 8 },
+    // State 1570
+    { 1570, 994, PA_SHIFT, 10 },
+    // State 1570
+    { 1570, 995, PA_SHIFT, 9 },
+    // State 1570
+    { 1570, 1000, PA_SHIFT, 1571 },
+    // State 1570
+    { 1570, 1004, PA_SHIFT, 13 },
+    // State 1571
+    { 1571, 996, PA_SHIFT, 6 },
+    // State 1571
+    { 1571, 998, PA_REDUCE, 787 },
+    // State 1572
+    { 1572, 1, PA_SHIFT, 8 },
+    // State 1572
+    { 1572, 994, PA_SHIFT, 10 },
+    // State 1572
+    { 1572, 995, PA_SHIFT, 9 },
+    // State 1572
+    { 1572, 1000, PA_SHIFT, 1573 },
+    // State 1572
+    { 1572, 1004, PA_SHIFT, 13 },
+    // State 1573
+    { 1573, 996, PA_SHIFT, 6 },
+    // State 1573
+    { 1573, 998, PA_REDUCE, 788 },
+    // State 1574
+    { 1574, 1, PA_SHIFT, 8 },
+    // State 1574
+    { 1574, 994, PA_SHIFT, 10 },
+    // State 1574
+    { 1574, 995, PA_SHIFT, 9 },
+    // State 1574
+    { 1574, 1000, PA_SHIFT, 1575 },
+    // State 1574
+    { 1574, 1004, PA_SHIFT, 13 },
+    // State 1575
+    { 1575, 996, PA_SHIFT, 6 },
+    // State 1575
+    { 1575, 998, PA_REDUCE, 789 },
+    // State 1576
+    { 1576, 1, PA_SHIFT, 8 },
+    // State 1576
+    { 1576, 994, PA_SHIFT, 10 },
+    // State 1576
+    { 1576, 995, PA_SHIFT, 9 },
+    // State 1576
+    { 1576, 1000, PA_SHIFT, 1577 },
+    // State 1576
+    { 1576, 1004, PA_SHIFT, 13 },
+    // State 1577
+    { 1577, 996, PA_SHIFT, 6 },
+    // State 1577
+    { 1577, 998, PA_REDUCE, 790 },
+    // State 1578
+    { 1578, 1, PA_SHIFT, 8 },
+    // State 1578
+    { 1578, 994, PA_SHIFT, 10 },
+    // State 1578
+    { 1578, 995, PA_SHIFT, 9 },
+    // State 1578
+    { 1578, 1000, PA_SHIFT, 1579 },
+    // State 1578
+    { 1578, 1004, PA_SHIFT, 13 },
+    // State 1579
+    { 1579, 996, PA_SHIFT, 6 },
+    // State 1579
+    { 1579, 998, PA_REDUCE, 791 },
+    // State 1580
+    { 1580, 1, PA_SHIFT, 8 },
+    // State 1580
+    { 1580, 994, PA_SHIFT, 10 },
+    // State 1580
+    { 1580, 995, PA_SHIFT, 9 },
+    // State 1580
+    { 1580, 1000, PA_SHIFT, 1581 },
+    // State 1580
+    { 1580, 1004, PA_SHIFT, 13 },
+    // State 1581
+    { 1581, 996, PA_SHIFT, 6 },
+    // State 1581
+    { 1581, 998, PA_REDUCE, 792 },
+    // State 1582
+    { 1582, 1, PA_SHIFT, 8 },
+    // State 1582
+    { 1582, 994, PA_SHIFT, 10 },
+    // State 1582
+    { 1582, 995, PA_SHIFT, 9 },
+    // State 1582
+    { 1582, 1000, PA_SHIFT, 1583 },
+    // State 1582
+    { 1582, 1004, PA_SHIFT, 13 },
+    // State 1583
+    { 1583, 996, PA_SHIFT, 6 },
+    // State 1583
+    { 1583, 998, PA_REDUCE, 793 },
+    // State 1584
+    { 1584, 1, PA_SHIFT, 8 },
+    // State 1584
+    { 1584, 994, PA_SHIFT, 10 },
+    // State 1584
+    { 1584, 995, PA_SHIFT, 9 },
+    // State 1584
+    { 1584, 1000, PA_SHIFT, 1585 },
+    // State 1584
+    { 1584, 1004, PA_SHIFT, 13 },
+    // State 1585
+    { 1585, 996, PA_SHIFT, 6 },
+    // State 1585
+    { 1585, 998, PA_REDUCE, 794 },
+    // State 1586
+    { 1586, 1, PA_SHIFT, 8 },
+    // State 1586
+    { 1586, 994, PA_SHIFT, 10 },
+    // State 1586
+    { 1586, 995, PA_SHIFT, 9 },
+    // State 1586
+    { 1586, 1000, PA_SHIFT, 1587 },
+    // State 1586
+    { 1586, 1004, PA_SHIFT, 13 },
+    // State 1587
+    { 1587, 996, PA_SHIFT, 6 },
+    // State 1587
+    { 1587, 998, PA_REDUCE, 795 },
+    // State 1588
+    { 1588, 1, PA_SHIFT, 8 },
+    // State 1588
+    { 1588, 994, PA_SHIFT, 10 },
+    // State 1588
+    { 1588, 995, PA_SHIFT, 9 },
+    // State 1588
+    { 1588, 1000, PA_SHIFT, 1589 },
+    // State 1588
+    { 1588, 1004, PA_SHIFT, 13 },
+    // State 1589
+    { 1589, 996, PA_SHIFT, 6 },
+    // State 1589
+    { 1589, 998, PA_REDUCE, 796 },
+    // State 1590
+    { 1590, 1, PA_SHIFT, 8 },
+    // State 1590
+    { 1590, 994, PA_SHIFT, 10 },
+    // State 1590
+    { 1590, 995, PA_SHIFT, 9 },
+    // State 1590
+    { 1590, 1000, PA_SHIFT, 1591 },
+    // State 1590
+    { 1590, 1004, PA_SHIFT, 13 },
+    // State 1591
+    { 1591, 996, PA_SHIFT, 6 },
+    // State 1591
+    { 1591, 998, PA_REDUCE, 797 },
+    // State 1592
+    { 1592, 1, PA_SHIFT, 8 },
+    // State 1592
+    { 1592, 994, PA_SHIFT, 10 },
+    // State 1592
+    { 1592, 995, PA_SHIFT, 9 },
+    // State 1592
+    { 1592, 1000, PA_SHIFT, 1593 },
+    // State 1592
+    { 1592, 1004, PA_SHIFT, 13 },
+    // State 1593
+    { 1593, 996, PA_SHIFT, 6 },
+    // State 1593
+    { 1593, 998, PA_REDUCE, 798 },
+    // State 1594
+    { 1594, 1, PA_SHIFT, 8 },
+    // State 1594
+    { 1594, 994, PA_SHIFT, 10 },
+    // State 1594
+    { 1594, 995, PA_SHIFT, 9 },
+    // State 1594
+    { 1594, 1000, PA_SHIFT, 1595 },
+    // State 1594
+    { 1594, 1004, PA_SHIFT, 13 },
+    // State 1595
+    { 1595, 996, PA_SHIFT, 6 },
+    // State 1595
+    { 1595, 998, PA_REDUCE, 799 },
+    // State 1596
+    { 1596, 1, PA_SHIFT, 8 },
+    // State 1596
+    { 1596, 994, PA_SHIFT, 10 },
+    // State 1596
+    { 1596, 995, PA_SHIFT, 9 },
+    // State 1596
+    { 1596, 1000, PA_SHIFT, 1597 },
+    // State 1596
+    { 1596, 1004, PA_SHIFT, 13 },
+    // State 1597
+    { 1597, 996, PA_SHIFT, 6 },
+    // State 1597
+    { 1597, 998, PA_REDUCE, 800 },
+    // State 1598
+    { 1598, 1, PA_SHIFT, 8 },
+    // State 1598
+    { 1598, 994, PA_SHIFT, 10 },
+    // State 1598
+    { 1598, 995, PA_SHIFT, 9 },
+    // State 1598
+    { 1598, 1000, PA_SHIFT, 1599 },
+    // State 1598
+    { 1598, 1004, PA_SHIFT, 13 },
+    // State 1599
+    { 1599, 996, PA_SHIFT, 6 },
+    // State 1599
+    { 1599, 998, PA_REDUCE, 801 },
+    // State 1600
+    { 1600, 1, PA_SHIFT, 8 },
+    // State 1600
+    { 1600, 994, PA_SHIFT, 10 },
+    // State 1600
+    { 1600, 995, PA_SHIFT, 9 },
+    // State 1600
+    { 1600, 1000, PA_SHIFT, 1601 },
+    // State 1600
+    { 1600, 1004, PA_SHIFT, 13 },
+    // State 1601
+    { 1601, 996, PA_SHIFT, 6 },
+    // State 1601
+    { 1601, 998, PA_REDUCE, 802 },
+    // State 1602
+    { 1602, 1, PA_SHIFT, 8 },
+    // State 1602
+    { 1602, 994, PA_SHIFT, 10 },
+    // State 1602
+    { 1602, 995, PA_SHIFT, 9 },
+    // State 1602
+    { 1602, 1000, PA_SHIFT, 1603 },
+    // State 1602
+    { 1602, 1004, PA_SHIFT, 13 },
+    // State 1603
+    { 1603, 996, PA_SHIFT, 6 },
+    // State 1603
+    { 1603, 998, PA_REDUCE, 803 },
+    // State 1604
+    { 1604, 1, PA_SHIFT, 8 },
+    // State 1604
+    { 1604, 994, PA_SHIFT, 10 },
+    // State 1604
+    { 1604, 995, PA_SHIFT, 9 },
+    // State 1604
+    { 1604, 1000, PA_SHIFT, 1605 },
+    // State 1604
+    { 1604, 1004, PA_SHIFT, 13 },
+    // State 1605
+    { 1605, 996, PA_SHIFT, 6 },
+    // State 1605
+    { 1605, 998, PA_REDUCE, 804 },
+    // State 1606
+    { 1606, 1, PA_SHIFT, 8 },
+    // State 1606
+    { 1606, 994, PA_SHIFT, 10 },
+    // State 1606
+    { 1606, 995, PA_SHIFT, 9 },
+    // State 1606
+    { 1606, 1000, PA_SHIFT, 1607 },
+    // State 1606
+    { 1606, 1004, PA_SHIFT, 13 },
+    // State 1607
+    { 1607, 996, PA_SHIFT, 6 },
+    // State 1607
+    { 1607, 998, PA_REDUCE, 805 },
+    // State 1608
+    { 1608, 1, PA_SHIFT, 8 },
+    // State 1608
+    { 1608, 994, PA_SHIFT, 10 },
+    // State 1608
+    { 1608, 995, PA_SHIFT, 9 },
+    // State 1608
+    { 1608, 1000, PA_SHIFT, 1609 },
+    // State 1608
+    { 1608, 1004, PA_SHIFT, 13 },
+    // State 1609
+    { 1609, 996, PA_SHIFT, 6 },
+    // State 1609
+    { 1609, 998, PA_REDUCE, 806 },
+    // State 1610
+    { 1610, 1, PA_SHIFT, 8 },
+    // State 1610
+    { 1610, 994, PA_SHIFT, 10 },
+    // State 1610
+    { 1610, 995, PA_SHIFT, 9 },
+    // State 1610
+    { 1610, 1000, PA_SHIFT, 1611 },
+    // State 1610
+    { 1610, 1004, PA_SHIFT, 13 },
+    // State 1611
+    { 1611, 996, PA_SHIFT, 6 },
+    // State 1611
+    { 1611, 998, PA_REDUCE, 807 },
+    // State 1612
+    { 1612, 1, PA_SHIFT, 8 },
+    // State 1612
+    { 1612, 994, PA_SHIFT, 10 },
+    // State 1612
+    { 1612, 995, PA_SHIFT, 9 },
+    // State 1612
+    { 1612, 1000, PA_SHIFT, 1613 },
+    // State 1612
+    { 1612, 1004, PA_SHIFT, 13 },
+    // State 1613
+    { 1613, 996, PA_SHIFT, 6 },
+    // State 1613
+    { 1613, 998, PA_REDUCE, 808 },
+    // State 1614
+    { 1614, 1, PA_SHIFT, 8 },
+    // State 1614
+    { 1614, 994, PA_SHIFT, 10 },
+    // State 1614
+    { 1614, 995, PA_SHIFT, 9 },
+    // State 1614
+    { 1614, 1000, PA_SHIFT, 1615 },
+    // State 1614
+    { 1614, 1004, PA_SHIFT, 13 },
+    // State 1615
+    { 1615, 996, PA_SHIFT, 6 },
+    // State 1615
+    { 1615, 998, PA_REDUCE, 809 },
+    // State 1616
+    { 1616, 1, PA_SHIFT, 8 },
+    // State 1616
+    { 1616, 994, PA_SHIFT, 10 },
+    // State 1616
+    { 1616, 995, PA_SHIFT, 9 },
+    // State 1616
+    { 1616, 1000, PA_SHIFT, 1617 },
+    // State 1616
+    { 1616, 1004, PA_SHIFT, 13 },
+    // State 1617
+    { 1617, 996, PA_SHIFT, 6 },
+    // State 1617
+    { 1617, 998, PA_REDUCE, 810 },
+    // State 1618
+    { 1618, 1, PA_SHIFT, 8 },
+    // State 1618
+    { 1618, 994, PA_SHIFT, 10 },
+    // State 1618
+    { 1618, 995, PA_SHIFT, 9 },
+    // State 1618
+    { 1618, 1000, PA_SHIFT, 1619 },
+    // State 1618
+    { 1618, 1004, PA_SHIFT, 13 },
+    // State 1619
+    { 1619, 996, PA_SHIFT, 6 },
+    // State 1619
+    { 1619, 998, PA_REDUCE, 811 },
+    // State 1620
+    { 1620, 1, PA_SHIFT, 8 },
+    // State 1620
+    { 1620, 994, PA_SHIFT, 10 },
+    // State 1620
+    { 1620, 995, PA_SHIFT, 9 },
+    // State 1620
+    { 1620, 1000, PA_SHIFT, 1621 },
+    // State 1620
+    { 1620, 1004, PA_SHIFT, 13 },
+    // State 1621
+    { 1621, 996, PA_SHIFT, 6 },
+    // State 1621
+    { 1621, 998, PA_REDUCE, 812 },
+    // State 1622
+    { 1622, 1, PA_SHIFT, 8 },
+    // State 1622
+    { 1622, 994, PA_SHIFT, 10 },
+    // State 1622
+    { 1622, 995, PA_SHIFT, 9 },
+    // State 1622
+    { 1622, 1000, PA_SHIFT, 1623 },
+    // State 1622
+    { 1622, 1004, PA_SHIFT, 13 },
+    // State 1623
+    { 1623, 996, PA_SHIFT, 6 },
+    // State 1623
+    { 1623, 998, PA_REDUCE, 813 },
+    // State 1624
+    { 1624, 1, PA_SHIFT, 8 },
+    // State 1624
+    { 1624, 994, PA_SHIFT, 10 },
+    // State 1624
+    { 1624, 995, PA_SHIFT, 9 },
+    // State 1624
+    { 1624, 1000, PA_SHIFT, 1625 },
+    // State 1624
+    { 1624, 1004, PA_SHIFT, 13 },
+    // State 1625
+    { 1625, 996, PA_SHIFT, 6 },
+    // State 1625
+    { 1625, 998, PA_REDUCE, 814 },
+    // State 1626
+    { 1626, 1, PA_SHIFT, 8 },
+    // State 1626
+    { 1626, 994, PA_SHIFT, 10 },
+    // State 1626
+    { 1626, 995, PA_SHIFT, 9 },
+    // State 1626
+    { 1626, 1000, PA_SHIFT, 1627 },
+    // State 1626
+    { 1626, 1004, PA_SHIFT, 13 },
+    // State 1627
+    { 1627, 996, PA_SHIFT, 6 },
+    // State 1627
+    { 1627, 998, PA_REDUCE, 815 },
+    // State 1628
+    { 1628, 1, PA_SHIFT, 8 },
+    // State 1628
+    { 1628, 994, PA_SHIFT, 10 },
+    // State 1628
+    { 1628, 995, PA_SHIFT, 9 },
+    // State 1628
+    { 1628, 1000, PA_SHIFT, 1629 },
+    // State 1628
+    { 1628, 1004, PA_SHIFT, 13 },
+    // State 1629
+    { 1629, 996, PA_SHIFT, 6 },
+    // State 1629
+    { 1629, 998, PA_REDUCE, 816 },
+    // State 1630
+    { 1630, 1, PA_SHIFT, 8 },
+    // State 1630
+    { 1630, 994, PA_SHIFT, 10 },
+    // State 1630
+    { 1630, 995, PA_SHIFT, 9 },
+    // State 1630
+    { 1630, 1000, PA_SHIFT, 1631 },
+    // State 1630
+    { 1630, 1004, PA_SHIFT, 13 },
+    // State 1631
+    { 1631, 996, PA_SHIFT, 6 },
+    // State 1631
+    { 1631, 998, PA_REDUCE, 817 },
+    // State 1632
+    { 1632, 1, PA_SHIFT, 8 },
+    // State 1632
+    { 1632, 994, PA_SHIFT, 10 },
+    // State 1632
+    { 1632, 995, PA_SHIFT, 9 },
+    // State 1632
+    { 1632, 1000, PA_SHIFT, 1633 },
+    // State 1632
+    { 1632, 1004, PA_SHIFT, 13 },
+    // State 1633
+    { 1633, 996, PA_SHIFT, 6 },
+    // State 1633
+    { 1633, 998, PA_REDUCE, 818 },
+    // State 1634
+    { 1634, 1, PA_SHIFT, 8 },
+    // State 1634
+    { 1634, 994, PA_SHIFT, 10 },
+    // State 1634
+    { 1634, 995, PA_SHIFT, 9 },
+    // State 1634
+    { 1634, 1000, PA_SHIFT, 1635 },
+    // State 1634
+    { 1634, 1004, PA_SHIFT, 13 },
+    // State 1635
+    { 1635, 996, PA_SHIFT, 6 },
+    // State 1635
+    { 1635, 998, PA_REDUCE, 819 },
+    // State 1636
+    { 1636, 1, PA_SHIFT, 8 },
+    // State 1636
+    { 1636, 994, PA_SHIFT, 10 },
+    // State 1636
+    { 1636, 995, PA_SHIFT, 9 },
+    // State 1636
+    { 1636, 1000, PA_SHIFT, 1637 },
+    // State 1636
+    { 1636, 1004, PA_SHIFT, 13 },
+    // State 1637
+    { 1637, 996, PA_SHIFT, 6 },
+    // State 1637
+    { 1637, 998, PA_REDUCE, 820 },
+    // State 1638
+    { 1638, 1, PA_SHIFT, 8 },
+    // State 1638
+    { 1638, 994, PA_SHIFT, 10 },
+    // State 1638
+    { 1638, 995, PA_SHIFT, 9 },
+    // State 1638
+    { 1638, 1000, PA_SHIFT, 1639 },
+    // State 1638
+    { 1638, 1004, PA_SHIFT, 13 },
+    // State 1639
+    { 1639, 996, PA_SHIFT, 6 },
+    // State 1639
+    { 1639, 998, PA_REDUCE, 821 },
+    // State 1640
+    { 1640, 1, PA_SHIFT, 8 },
+    // State 1640
+    { 1640, 994, PA_SHIFT, 10 },
+    // State 1640
+    { 1640, 995, PA_SHIFT, 9 },
+    // State 1640
+    { 1640, 1000, PA_SHIFT, 1641 },
+    // State 1640
+    { 1640, 1004, PA_SHIFT, 13 },
+    // State 1641
+    { 1641, 996, PA_SHIFT, 6 },
+    // State 1641
+    { 1641, 998, PA_REDUCE, 822 },
+    // State 1642
+    { 1642, 1, PA_SHIFT, 8 },
+    // State 1642
+    { 1642, 994, PA_SHIFT, 10 },
+    // State 1642
+    { 1642, 995, PA_SHIFT, 9 },
+    // State 1642
+    { 1642, 1000, PA_SHIFT, 1643 },
+    // State 1642
+    { 1642, 1004, PA_SHIFT, 13 },
+    // State 1643
+    { 1643, 996, PA_SHIFT, 6 },
+    // State 1643
+    { 1643, 998, PA_REDUCE, 823 },
+    // State 1644
+    { 1644, 1, PA_SHIFT, 8 },
+    // State 1644
+    { 1644, 994, PA_SHIFT, 10 },
+    // State 1644
+    { 1644, 995, PA_SHIFT, 9 },
+    // State 1644
+    { 1644, 1000, PA_SHIFT, 1645 },
+    // State 1644
+    { 1644, 1004, PA_SHIFT, 13 },
+    // State 1645
+    { 1645, 996, PA_SHIFT, 6 },
+    // State 1645
+    { 1645, 998, PA_REDUCE, 824 },
+    // State 1646
+    { 1646, 1, PA_SHIFT, 8 },
+    // State 1646
+    { 1646, 994, PA_SHIFT, 10 },
+    // State 1646
+    { 1646, 995, PA_SHIFT, 9 },
+    // State 1646
+    { 1646, 1000, PA_SHIFT, 1647 },
+    // State 1646
+    { 1646, 1004, PA_SHIFT, 13 },
+    // State 1647
+    { 1647, 996, PA_SHIFT, 6 },
+    // State 1647
+    { 1647, 998, PA_REDUCE, 825 },
+    // State 1648
+    { 1648, 1, PA_SHIFT, 8 },
+    // State 1648
+    { 1648, 994, PA_SHIFT, 10 },
+    // State 1648
+    { 1648, 995, PA_SHIFT, 9 },
+    // State 1648
+    { 1648, 1000, PA_SHIFT, 1649 },
+    // State 1648
+    { 1648, 1004, PA_SHIFT, 13 },
+    // State 1649
+    { 1649, 996, PA_SHIFT, 6 },
+    // State 1649
+    { 1649, 998, PA_REDUCE, 826 },
+    // State 1650
+    { 1650, 1, PA_SHIFT, 8 },
+    // State 1650
+    { 1650, 994, PA_SHIFT, 10 },
+    // State 1650
+    { 1650, 995, PA_SHIFT, 9 },
+    // State 1650
+    { 1650, 1000, PA_SHIFT, 1651 },
+    // State 1650
+    { 1650, 1004, PA_SHIFT, 13 },
+    // State 1651
+    { 1651, 996, PA_SHIFT, 6 },
+    // State 1651
+    { 1651, 998, PA_REDUCE, 827 },
+    // State 1652
+    { 1652, 1, PA_SHIFT, 8 },
+    // State 1652
+    { 1652, 994, PA_SHIFT, 10 },
+    // State 1652
+    { 1652, 995, PA_SHIFT, 9 },
+    // State 1652
+    { 1652, 1000, PA_SHIFT, 1653 },
+    // State 1652
+    { 1652, 1004, PA_SHIFT, 13 },
+    // State 1653
+    { 1653, 996, PA_SHIFT, 6 },
+    // State 1653
+    { 1653, 998, PA_REDUCE, 828 },
+    // State 1654
+    { 1654, 1, PA_SHIFT, 8 },
+    // State 1654
+    { 1654, 994, PA_SHIFT, 10 },
+    // State 1654
+    { 1654, 995, PA_SHIFT, 9 },
+    // State 1654
+    { 1654, 1000, PA_SHIFT, 1655 },
+    // State 1654
+    { 1654, 1004, PA_SHIFT, 13 },
+    // State 1655
+    { 1655, 996, PA_SHIFT, 6 },
+    // State 1655
+    { 1655, 998, PA_REDUCE, 829 },
+    // State 1656
+    { 1656, 1, PA_SHIFT, 8 },
+    // State 1656
+    { 1656, 994, PA_SHIFT, 10 },
+    // State 1656
+    { 1656, 995, PA_SHIFT, 9 },
+    // State 1656
+    { 1656, 1000, PA_SHIFT, 1657 },
+    // State 1656
+    { 1656, 1004, PA_SHIFT, 13 },
+    // State 1657
+    { 1657, 996, PA_SHIFT, 6 },
+    // State 1657
+    { 1657, 998, PA_REDUCE, 830 },
+    // State 1658
+    { 1658, 1, PA_SHIFT, 8 },
+    // State 1658
+    { 1658, 994, PA_SHIFT, 10 },
+    // State 1658
+    { 1658, 995, PA_SHIFT, 9 },
+    // State 1658
+    { 1658, 1000, PA_SHIFT, 1659 },
+    // State 1658
+    { 1658, 1004, PA_SHIFT, 13 },
+    // State 1659
+    { 1659, 996, PA_SHIFT, 6 },
+    // State 1659
+    { 1659, 998, PA_REDUCE, 831 },
+    // State 1660
+    { 1660, 1, PA_SHIFT, 8 },
+    // State 1660
+    { 1660, 994, PA_SHIFT, 10 },
+    // State 1660
+    { 1660, 995, PA_SHIFT, 9 },
+    // State 1660
+    { 1660, 1000, PA_SHIFT, 1661 },
+    // State 1660
+    { 1660, 1004, PA_SHIFT, 13 },
+    // State 1661
+    { 1661, 996, PA_SHIFT, 6 },
+    // State 1661
+    { 1661, 998, PA_REDUCE, 832 },
+    // State 1662
+    { 1662, 1, PA_SHIFT, 8 },
+    // State 1662
+    { 1662, 994, PA_SHIFT, 10 },
+    // State 1662
+    { 1662, 995, PA_SHIFT, 9 },
+    // State 1662
+    { 1662, 1000, PA_SHIFT, 1663 },
+    // State 1662
+    { 1662, 1004, PA_SHIFT, 13 },
+    // State 1663
+    { 1663, 996, PA_SHIFT, 6 },
+    // State 1663
+    { 1663, 998, PA_REDUCE, 833 },
+    // State 1664
+    { 1664, 1, PA_SHIFT, 8 },
+    // State 1664
+    { 1664, 994, PA_SHIFT, 10 },
+    // State 1664
+    { 1664, 995, PA_SHIFT, 9 },
+    // State 1664
+    { 1664, 1000, PA_SHIFT, 1665 },
+    // State 1664
+    { 1664, 1004, PA_SHIFT, 13 },
+    // State 1665
+    { 1665, 996, PA_SHIFT, 6 },
+    // State 1665
+    { 1665, 998, PA_REDUCE, 834 },
+    // State 1666
+    { 1666, 1, PA_SHIFT, 8 },
+    // State 1666
+    { 1666, 994, PA_SHIFT, 10 },
+    // State 1666
+    { 1666, 995, PA_SHIFT, 9 },
+    // State 1666
+    { 1666, 1000, PA_SHIFT, 1667 },
+    // State 1666
+    { 1666, 1004, PA_SHIFT, 13 },
+    // State 1667
+    { 1667, 996, PA_SHIFT, 6 },
+    // State 1667
+    { 1667, 998, PA_REDUCE, 835 },
+    // State 1668
+    { 1668, 1, PA_SHIFT, 8 },
+    // State 1668
+    { 1668, 994, PA_SHIFT, 10 },
+    // State 1668
+    { 1668, 995, PA_SHIFT, 9 },
+    // State 1668
+    { 1668, 1000, PA_SHIFT, 1669 },
+    // State 1668
+    { 1668, 1004, PA_SHIFT, 13 },
+    // State 1669
+    { 1669, 996, PA_SHIFT, 6 },
+    // State 1669
+    { 1669, 998, PA_REDUCE, 836 },
+    // State 1670
+    { 1670, 1, PA_SHIFT, 8 },
+    // State 1670
+    { 1670, 994, PA_SHIFT, 10 },
+    // State 1670
+    { 1670, 995, PA_SHIFT, 9 },
+    // State 1670
+    { 1670, 1000, PA_SHIFT, 1671 },
+    // State 1670
+    { 1670, 1004, PA_SHIFT, 13 },
+    // State 1671
+    { 1671, 996, PA_SHIFT, 6 },
+    // State 1671
+    { 1671, 998, PA_REDUCE, 837 },
+    // State 1672
+    { 1672, 1, PA_SHIFT, 8 },
+    // State 1672
+    { 1672, 994, PA_SHIFT, 10 },
+    // State 1672
+    { 1672, 995, PA_SHIFT, 9 },
+    // State 1672
+    { 1672, 1000, PA_SHIFT, 1673 },
+    // State 1672
+    { 1672, 1004, PA_SHIFT, 13 },
+    // State 1673
+    { 1673, 996, PA_SHIFT, 6 },
+    // State 1673
+    { 1673, 998, PA_REDUCE, 838 },
+    // State 1674
+    { 1674, 1, PA_SHIFT, 8 },
+    // State 1674
+    { 1674, 994, PA_SHIFT, 10 },
+    // State 1674
+    { 1674, 995, PA_SHIFT, 9 },
+    // State 1674
+    { 1674, 1000, PA_SHIFT, 1675 },
+    // State 1674
+    { 1674, 1004, PA_SHIFT, 13 },
+    // State 1675
+    { 1675, 996, PA_SHIFT, 6 },
+    // State 1675
+    { 1675, 998, PA_REDUCE, 839 },
+    // State 1676
+    { 1676, 1, PA_SHIFT, 8 },
+    // State 1676
+    { 1676, 994, PA_SHIFT, 10 },
+    // State 1676
+    { 1676, 995, PA_SHIFT, 9 },
+    // State 1676
+    { 1676, 1000, PA_SHIFT, 1677 },
+    // State 1676
+    { 1676, 1004, PA_SHIFT, 13 },
+    // State 1677
+    { 1677, 996, PA_SHIFT, 6 },
+    // State 1677
+    { 1677, 998, PA_REDUCE, 840 },
+    // State 1678
+    { 1678, 1, PA_SHIFT, 8 },
+    // State 1678
+    { 1678, 994, PA_SHIFT, 10 },
+    // State 1678
+    { 1678, 995, PA_SHIFT, 9 },
+    // State 1678
+    { 1678, 1000, PA_SHIFT, 1679 },
+    // State 1678
+    { 1678, 1004, PA_SHIFT, 13 },
+    // State 1679
+    { 1679, 996, PA_SHIFT, 6 },
+    // State 1679
+    { 1679, 998, PA_REDUCE, 841 },
+    // State 1680
+    { 1680, 1, PA_SHIFT, 8 },
+    // State 1680
+    { 1680, 994, PA_SHIFT, 10 },
+    // State 1680
+    { 1680, 995, PA_SHIFT, 9 },
+    // State 1680
+    { 1680, 1000, PA_SHIFT, 1681 },
+    // State 1680
+    { 1680, 1004, PA_SHIFT, 13 },
+    // State 1681
+    { 1681, 996, PA_SHIFT, 6 },
+    // State 1681
+    { 1681, 998, PA_REDUCE, 842 },
+    // State 1682
+    { 1682, 1, PA_SHIFT, 8 },
+    // State 1682
+    { 1682, 994, PA_SHIFT, 10 },
+    // State 1682
+    { 1682, 995, PA_SHIFT, 9 },
+    // State 1682
+    { 1682, 1000, PA_SHIFT, 1683 },
+    // State 1682
+    { 1682, 1004, PA_SHIFT, 13 },
+    // State 1683
+    { 1683, 996, PA_SHIFT, 6 },
+    // State 1683
+    { 1683, 998, PA_REDUCE, 843 },
+    // State 1684
+    { 1684, 1, PA_SHIFT, 8 },
+    // State 1684
+    { 1684, 994, PA_SHIFT, 10 },
+    // State 1684
+    { 1684, 995, PA_SHIFT, 9 },
+    // State 1684
+    { 1684, 1000, PA_SHIFT, 1685 },
+    // State 1684
+    { 1684, 1004, PA_SHIFT, 13 },
+    // State 1685
+    { 1685, 996, PA_SHIFT, 6 },
+    // State 1685
+    { 1685, 998, PA_REDUCE, 844 },
+    // State 1686
+    { 1686, 1, PA_SHIFT, 8 },
+    // State 1686
+    { 1686, 994, PA_SHIFT, 10 },
+    // State 1686
+    { 1686, 995, PA_SHIFT, 9 },
+    // State 1686
+    { 1686, 1000, PA_SHIFT, 1687 },
+    // State 1686
+    { 1686, 1004, PA_SHIFT, 13 },
+    // State 1687
+    { 1687, 996, PA_SHIFT, 6 },
+    // State 1687
+    { 1687, 998, PA_REDUCE, 845 },
+    // State 1688
+    { 1688, 1, PA_SHIFT, 8 },
+    // State 1688
+    { 1688, 994, PA_SHIFT, 10 },
+    // State 1688
+    { 1688, 995, PA_SHIFT, 9 },
+    // State 1688
+    { 1688, 1000, PA_SHIFT, 1689 },
+    // State 1688
+    { 1688, 1004, PA_SHIFT, 13 },
+    // State 1689
+    { 1689, 996, PA_SHIFT, 6 },
+    // State 1689
+    { 1689, 998, PA_REDUCE, 846 },
+    // State 1690
+    { 1690, 1, PA_SHIFT, 8 },
+    // State 1690
+    { 1690, 994, PA_SHIFT, 10 },
+    // State 1690
+    { 1690, 995, PA_SHIFT, 9 },
+    // State 1690
+    { 1690, 1000, PA_SHIFT, 1691 },
+    // State 1690
+    { 1690, 1004, PA_SHIFT, 13 },
+    // State 1691
+    { 1691, 996, PA_SHIFT, 6 },
+    // State 1691
+    { 1691, 998, PA_REDUCE, 847 },
+    // State 1692
+    { 1692, 1, PA_SHIFT, 8 },
+    // State 1692
+    { 1692, 994, PA_SHIFT, 10 },
+    // State 1692
+    { 1692, 995, PA_SHIFT, 9 },
+    // State 1692
+    { 1692, 1000, PA_SHIFT, 1693 },
+    // State 1692
+    { 1692, 1004, PA_SHIFT, 13 },
+    // State 1693
+    { 1693, 996, PA_SHIFT, 6 },
+    // State 1693
+    { 1693, 998, PA_REDUCE, 848 },
+    // State 1694
+    { 1694, 1, PA_SHIFT, 8 },
+    // State 1694
+    { 1694, 994, PA_SHIFT, 10 },
+    // State 1694
+    { 1694, 995, PA_SHIFT, 9 },
+    // State 1694
+    { 1694, 1000, PA_SHIFT, 1695 },
+    // State 1694
+    { 1694, 1004, PA_SHIFT, 13 },
+    // State 1695
+    { 1695, 996, PA_SHIFT, 6 },
+    // State 1695
+    { 1695, 998, PA_REDUCE, 849 },
+    // State 1696
+    { 1696, 1, PA_SHIFT, 8 },
+    // State 1696
+    { 1696, 994, PA_SHIFT, 10 },
+    // State 1696
+    { 1696, 995, PA_SHIFT, 9 },
+    // State 1696
+    { 1696, 1000, PA_SHIFT, 1697 },
+    // State 1696
+    { 1696, 1004, PA_SHIFT, 13 },
+    // State 1697
+    { 1697, 996, PA_SHIFT, 6 },
+    // State 1697
+    { 1697, 998, PA_REDUCE, 850 },
+    // State 1698
+    { 1698, 1, PA_SHIFT, 8 },
+    // State 1698
+    { 1698, 994, PA_SHIFT, 10 },
+    // State 1698
+    { 1698, 995, PA_SHIFT, 9 },
+    // State 1698
+    { 1698, 1000, PA_SHIFT, 1699 },
+    // State 1698
+    { 1698, 1004, PA_SHIFT, 13 },
+    // State 1699
+    { 1699, 996, PA_SHIFT, 6 },
+    // State 1699
+    { 1699, 998, PA_REDUCE, 851 },
+    // State 1700
+    { 1700, 1, PA_SHIFT, 8 },
+    // State 1700
+    { 1700, 994, PA_SHIFT, 10 },
+    // State 1700
+    { 1700, 995, PA_SHIFT, 9 },
+    // State 1700
+    { 1700, 1000, PA_SHIFT, 1701 },
+    // State 1700
+    { 1700, 1004, PA_SHIFT, 13 },
+    // State 1701
+    { 1701, 996, PA_SHIFT, 6 },
+    // State 1701
+    { 1701, 998, PA_REDUCE, 852 },
+    // State 1702
+    { 1702, 1, PA_SHIFT, 8 },
+    // State 1702
+    { 1702, 994, PA_SHIFT, 10 },
+    // State 1702
+    { 1702, 995, PA_SHIFT, 9 },
+    // State 1702
+    { 1702, 1000, PA_SHIFT, 1703 },
+    // State 1702
+    { 1702, 1004, PA_SHIFT, 13 },
+    // State 1703
+    { 1703, 996, PA_SHIFT, 6 },
+    // State 1703
+    { 1703, 998, PA_REDUCE, 853 },
+    // State 1704
+    { 1704, 1, PA_SHIFT, 8 },
+    // State 1704
+    { 1704, 994, PA_SHIFT, 10 },
+    // State 1704
+    { 1704, 995, PA_SHIFT, 9 },
+    // State 1704
+    { 1704, 1000, PA_SHIFT, 1705 },
+    // State 1704
+    { 1704, 1004, PA_SHIFT, 13 },
+    // State 1705
+    { 1705, 996, PA_SHIFT, 6 },
+    // State 1705
+    { 1705, 998, PA_REDUCE, 854 },
+    // State 1706
+    { 1706, 1, PA_SHIFT, 8 },
+    // State 1706
+    { 1706, 994, PA_SHIFT, 10 },
+    // State 1706
+    { 1706, 995, PA_SHIFT, 9 },
+    // State 1706
+    { 1706, 1000, PA_SHIFT, 1707 },
+    // State 1706
+    { 1706, 1004, PA_SHIFT, 13 },
+    // State 1707
+    { 1707, 996, PA_SHIFT, 6 },
+    // State 1707
+    { 1707, 998, PA_REDUCE, 855 },
+    // State 1708
+    { 1708, 1, PA_SHIFT, 8 },
+    // State 1708
+    { 1708, 994, PA_SHIFT, 10 },
+    // State 1708
+    { 1708, 995, PA_SHIFT, 9 },
+    // State 1708
+    { 1708, 1000, PA_SHIFT, 1709 },
+    // State 1708
+    { 1708, 1004, PA_SHIFT, 13 },
+    // State 1709
+    { 1709, 996, PA_SHIFT, 6 },
+    // State 1709
+    { 1709, 998, PA_REDUCE, 856 },
+    // State 1710
+    { 1710, 1, PA_SHIFT, 8 },
+    // State 1710
+    { 1710, 994, PA_SHIFT, 10 },
+    // State 1710
+    { 1710, 995, PA_SHIFT, 9 },
+    // State 1710
+    { 1710, 1000, PA_SHIFT, 1711 },
+    // State 1710
+    { 1710, 1004, PA_SHIFT, 13 },
+    // State 1711
+    { 1711, 996, PA_SHIFT, 6 },
+    // State 1711
+    { 1711, 998, PA_REDUCE, 857 },
+    // State 1712
+    { 1712, 1, PA_SHIFT, 8 },
+    // State 1712
+    { 1712, 994, PA_SHIFT, 10 },
+    // State 1712
+    { 1712, 995, PA_SHIFT, 9 },
+    // State 1712
+    { 1712, 1000, PA_SHIFT, 1713 },
+    // State 1712
+    { 1712, 1004, PA_SHIFT, 13 },
+    // State 1713
+    { 1713, 996, PA_SHIFT, 6 },
+    // State 1713
+    { 1713, 998, PA_REDUCE, 858 },
+    // State 1714
+    { 1714, 1, PA_SHIFT, 8 },
+    // State 1714
+    { 1714, 994, PA_SHIFT, 10 },
+    // State 1714
+    { 1714, 995, PA_SHIFT, 9 },
+    // State 1714
+    { 1714, 1000, PA_SHIFT, 1715 },
+    // State 1714
+    { 1714, 1004, PA_SHIFT, 13 },
+    // State 1715
+    { 1715, 996, PA_SHIFT, 6 },
+    // State 1715
+    { 1715, 998, PA_REDUCE, 859 },
+    // State 1716
+    { 1716, 1, PA_SHIFT, 8 },
+    // State 1716
+    { 1716, 994, PA_SHIFT, 10 },
+    // State 1716
+    { 1716, 995, PA_SHIFT, 9 },
+    // State 1716
+    { 1716, 1000, PA_SHIFT, 1717 },
+    // State 1716
+    { 1716, 1004, PA_SHIFT, 13 },
+    // State 1717
+    { 1717, 996, PA_SHIFT, 6 },
+    // State 1717
+    { 1717, 998, PA_REDUCE, 860 },
+    // State 1718
+    { 1718, 1, PA_SHIFT, 8 },
+    // State 1718
+    { 1718, 994, PA_SHIFT, 10 },
+    // State 1718
+    { 1718, 995, PA_SHIFT, 9 },
+    // State 1718
+    { 1718, 1000, PA_SHIFT, 1719 },
+    // State 1718
+    { 1718, 1004, PA_SHIFT, 13 },
+    // State 1719
+    { 1719, 996, PA_SHIFT, 6 },
+    // State 1719
+    { 1719, 998, PA_REDUCE, 861 },
+    // State 1720
+    { 1720, 1, PA_SHIFT, 8 },
+    // State 1720
+    { 1720, 994, PA_SHIFT, 10 },
+    // State 1720
+    { 1720, 995, PA_SHIFT, 9 },
+    // State 1720
+    { 1720, 1000, PA_SHIFT, 1721 },
+    // State 1720
+    { 1720, 1004, PA_SHIFT, 13 },
+    // State 1721
+    { 1721, 996, PA_SHIFT, 6 },
+    // State 1721
+    { 1721, 998, PA_REDUCE, 862 },
+    // State 1722
+    { 1722, 1, PA_SHIFT, 8 },
+    // State 1722
+    { 1722, 994, PA_SHIFT, 10 },
+    // State 1722
+    { 1722, 995, PA_SHIFT, 9 },
+    // State 1722
+    { 1722, 1000, PA_SHIFT, 1723 },
+    // State 1722
+    { 1722, 1004, PA_SHIFT, 13 },
+    // State 1723
+    { 1723, 996, PA_SHIFT, 6 },
+    // State 1723
+    { 1723, 998, PA_REDUCE, 863 },
+    // State 1724
+    { 1724, 1, PA_SHIFT, 8 },
+    // State 1724
+    { 1724, 994, PA_SHIFT, 10 },
+    // State 1724
+    { 1724, 995, PA_SHIFT, 9 },
+    // State 1724
+    { 1724, 1000, PA_SHIFT, 1725 },
+    // State 1724
+    { 1724, 1004, PA_SHIFT, 13 },
+    // State 1725
+    { 1725, 996, PA_SHIFT, 6 },
+    // State 1725
+    { 1725, 998, PA_REDUCE, 864 },
+    // State 1726
+    { 1726, 1, PA_SHIFT, 8 },
+    // State 1726
+    { 1726, 994, PA_SHIFT, 10 },
+    // State 1726
+    { 1726, 995, PA_SHIFT, 9 },
+    // State 1726
+    { 1726, 1000, PA_SHIFT, 1727 },
+    // State 1726
+    { 1726, 1004, PA_SHIFT, 13 },
+    // State 1727
+    { 1727, 996, PA_SHIFT, 6 },
+    // State 1727
+    { 1727, 998, PA_REDUCE, 865 },
+    // State 1728
+    { 1728, 1, PA_SHIFT, 8 },
+    // State 1728
+    { 1728, 994, PA_SHIFT, 10 },
+    // State 1728
+    { 1728, 995, PA_SHIFT, 9 },
+    // State 1728
+    { 1728, 1000, PA_SHIFT, 1729 },
+    // State 1728
+    { 1728, 1004, PA_SHIFT, 13 },
+    // State 1729
+    { 1729, 996, PA_SHIFT, 6 },
+    // State 1729
+    { 1729, 998, PA_REDUCE, 866 },
+    // State 1730
+    { 1730, 1, PA_SHIFT, 8 },
+    // State 1730
+    { 1730, 994, PA_SHIFT, 10 },
+    // State 1730
+    { 1730, 995, PA_SHIFT, 9 },
+    // State 1730
+    { 1730, 1000, PA_SHIFT, 1731 },
+    // State 1730
+    { 1730, 1004, PA_SHIFT, 13 },
+    // State 1731
+    { 1731, 996, PA_SHIFT, 6 },
+    // State 1731
+    { 1731, 998, PA_REDUCE, 867 },
+    // State 1732
+    { 1732, 1, PA_SHIFT, 8 },
+    // State 1732
+    { 1732, 994, PA_SHIFT, 10 },
+    // State 1732
+    { 1732, 995, PA_SHIFT, 9 },
+    // State 1732
+    { 1732, 1000, PA_SHIFT, 1733 },
+    // State 1732
+    { 1732, 1004, PA_SHIFT, 13 },
+    // State 1733
+    { 1733, 996, PA_SHIFT, 6 },
+    // State 1733
+    { 1733, 998, PA_REDUCE, 868 },
+    // State 1734
+    { 1734, 1, PA_SHIFT, 8 },
+    // State 1734
+    { 1734, 994, PA_SHIFT, 10 },
+    // State 1734
+    { 1734, 995, PA_SHIFT, 9 },
+    // State 1734
+    { 1734, 1000, PA_SHIFT, 1735 },
+    // State 1734
+    { 1734, 1004, PA_SHIFT, 13 },
+    // State 1735
+    { 1735, 996, PA_SHIFT, 6 },
+    // State 1735
+    { 1735, 998, PA_REDUCE, 869 },
+    // State 1736
+    { 1736, 1, PA_SHIFT, 8 },
+    // State 1736
+    { 1736, 994, PA_SHIFT, 10 },
+    // State 1736
+    { 1736, 995, PA_SHIFT, 9 },
+    // State 1736
+    { 1736, 1000, PA_SHIFT, 1737 },
+    // State 1736
+    { 1736, 1004, PA_SHIFT, 13 },
+    // State 1737
+    { 1737, 996, PA_SHIFT, 6 },
+    // State 1737
+    { 1737, 998, PA_REDUCE, 870 },
+    // State 1738
+    { 1738, 1, PA_SHIFT, 8 },
+    // State 1738
+    { 1738, 994, PA_SHIFT, 10 },
+    // State 1738
+    { 1738, 995, PA_SHIFT, 9 },
+    // State 1738
+    { 1738, 1000, PA_SHIFT, 1739 },
+    // State 1738
+    { 1738, 1004, PA_SHIFT, 13 },
+    // State 1739
+    { 1739, 996, PA_SHIFT, 6 },
+    // State 1739
+    { 1739, 998, PA_REDUCE, 871 },
+    // State 1740
+    { 1740, 1, PA_SHIFT, 8 },
+    // State 1740
+    { 1740, 994, PA_SHIFT, 10 },
+    // State 1740
+    { 1740, 995, PA_SHIFT, 9 },
+    // State 1740
+    { 1740, 1000, PA_SHIFT, 1741 },
+    // State 1740
+    { 1740, 1004, PA_SHIFT, 13 },
+    // State 1741
+    { 1741, 996, PA_SHIFT, 6 },
+    // State 1741
+    { 1741, 998, PA_REDUCE, 872 },
+    // State 1742
+    { 1742, 1, PA_SHIFT, 8 },
+    // State 1742
+    { 1742, 994, PA_SHIFT, 10 },
+    // State 1742
+    { 1742, 995, PA_SHIFT, 9 },
+    // State 1742
+    { 1742, 1000, PA_SHIFT, 1743 },
+    // State 1742
+    { 1742, 1004, PA_SHIFT, 13 },
+    // State 1743
+    { 1743, 996, PA_SHIFT, 6 },
+    // State 1743
+    { 1743, 998, PA_REDUCE, 873 },
+    // State 1744
+    { 1744, 1, PA_SHIFT, 8 },
+    // State 1744
+    { 1744, 994, PA_SHIFT, 10 },
+    // State 1744
+    { 1744, 995, PA_SHIFT, 9 },
+    // State 1744
+    { 1744, 1000, PA_SHIFT, 1745 },
+    // State 1744
+    { 1744, 1004, PA_SHIFT, 13 },
+    // State 1745
+    { 1745, 996, PA_SHIFT, 6 },
+    // State 1745
+    { 1745, 998, PA_REDUCE, 874 },
+    // State 1746
+    { 1746, 1, PA_SHIFT, 8 },
+    // State 1746
+    { 1746, 994, PA_SHIFT, 10 },
+    // State 1746
+    { 1746, 995, PA_SHIFT, 9 },
+    // State 1746
+    { 1746, 1000, PA_SHIFT, 1747 },
+    // State 1746
+    { 1746, 1004, PA_SHIFT, 13 },
+    // State 1747
+    { 1747, 996, PA_SHIFT, 6 },
+    // State 1747
+    { 1747, 998, PA_REDUCE, 875 },
+    // State 1748
+    { 1748, 1, PA_SHIFT, 8 },
+    // State 1748
+    { 1748, 994, PA_SHIFT, 10 },
+    // State 1748
+    { 1748, 995, PA_SHIFT, 9 },
+    // State 1748
+    { 1748, 1000, PA_SHIFT, 1749 },
+    // State 1748
+    { 1748, 1004, PA_SHIFT, 13 },
+    // State 1749
+    { 1749, 996, PA_SHIFT, 6 },
+    // State 1749
+    { 1749, 998, PA_REDUCE, 876 },
+    // State 1750
+    { 1750, 1, PA_SHIFT, 8 },
+    // State 1750
+    { 1750, 994, PA_SHIFT, 10 },
+    // State 1750
+    { 1750, 995, PA_SHIFT, 9 },
+    // State 1750
+    { 1750, 1000, PA_SHIFT, 1751 },
+    // State 1750
+    { 1750, 1004, PA_SHIFT, 13 },
+    // State 1751
+    { 1751, 996, PA_SHIFT, 6 },
+    // State 1751
+    { 1751, 998, PA_REDUCE, 877 },
+    // State 1752
+    { 1752, 1, PA_SHIFT, 8 },
+    // State 1752
+    { 1752, 994, PA_SHIFT, 10 },
+    // State 1752
+    { 1752, 995, PA_SHIFT, 9 },
+    // State 1752
+    { 1752, 1000, PA_SHIFT, 1753 },
+    // State 1752
+    { 1752, 1004, PA_SHIFT, 13 },
+    // State 1753
+    { 1753, 996, PA_SHIFT, 6 },
+    // State 1753
+    { 1753, 998, PA_REDUCE, 878 },
+    // State 1754
+    { 1754, 1, PA_SHIFT, 8 },
+    // State 1754
+    { 1754, 994, PA_SHIFT, 10 },
+    // State 1754
+    { 1754, 995, PA_SHIFT, 9 },
+    // State 1754
+    { 1754, 1000, PA_SHIFT, 1755 },
+    // State 1754
+    { 1754, 1004, PA_SHIFT, 13 },
+    // State 1755
+    { 1755, 996, PA_SHIFT, 6 },
+    // State 1755
+    { 1755, 998, PA_REDUCE, 879 },
+    // State 1756
+    { 1756, 1, PA_SHIFT, 8 },
+    // State 1756
+    { 1756, 994, PA_SHIFT, 10 },
+    // State 1756
+    { 1756, 995, PA_SHIFT, 9 },
+    // State 1756
+    { 1756, 1000, PA_SHIFT, 1757 },
+    // State 1756
+    { 1756, 1004, PA_SHIFT, 13 },
+    // State 1757
+    { 1757, 996, PA_SHIFT, 6 },
+    // State 1757
+    { 1757, 998, PA_REDUCE, 880 },
+    // State 1758
+    { 1758, 1, PA_SHIFT, 8 },
+    // State 1758
+    { 1758, 994, PA_SHIFT, 10 },
+    // State 1758
+    { 1758, 995, PA_SHIFT, 9 },
+    // State 1758
+    { 1758, 1000, PA_SHIFT, 1759 },
+    // State 1758
+    { 1758, 1004, PA_SHIFT, 13 },
+    // State 1759
+    { 1759, 996, PA_SHIFT, 6 },
+    // State 1759
+    { 1759, 998, PA_REDUCE, 881 },
+    // State 1760
+    { 1760, 1, PA_SHIFT, 8 },
+    // State 1760
+    { 1760, 994, PA_SHIFT, 10 },
+    // State 1760
+    { 1760, 995, PA_SHIFT, 9 },
+    // State 1760
+    { 1760, 1000, PA_SHIFT, 1761 },
+    // State 1760
+    { 1760, 1004, PA_SHIFT, 13 },
+    // State 1761
+    { 1761, 996, PA_SHIFT, 6 },
+    // State 1761
+    { 1761, 998, PA_REDUCE, 882 },
+    // State 1762
+    { 1762, 1, PA_SHIFT, 8 },
+    // State 1762
+    { 1762, 994, PA_SHIFT, 10 },
+    // State 1762
+    { 1762, 995, PA_SHIFT, 9 },
+    // State 1762
+    { 1762, 1000, PA_SHIFT, 1763 },
+    // State 1762
+    { 1762, 1004, PA_SHIFT, 13 },
+    // State 1763
+    { 1763, 996, PA_SHIFT, 6 },
+    // State 1763
+    { 1763, 998, PA_REDUCE, 883 },
+    // State 1764
+    { 1764, 1, PA_SHIFT, 8 },
+    // State 1764
+    { 1764, 994, PA_SHIFT, 10 },
+    // State 1764
+    { 1764, 995, PA_SHIFT, 9 },
+    // State 1764
+    { 1764, 1000, PA_SHIFT, 1765 },
+    // State 1764
+    { 1764, 1004, PA_SHIFT, 13 },
+    // State 1765
+    { 1765, 996, PA_SHIFT, 6 },
+    // State 1765
+    { 1765, 998, PA_REDUCE, 884 },
+    // State 1766
+    { 1766, 1, PA_SHIFT, 8 },
+    // State 1766
+    { 1766, 994, PA_SHIFT, 10 },
+    // State 1766
+    { 1766, 995, PA_SHIFT, 9 },
+    // State 1766
+    { 1766, 1000, PA_SHIFT, 1767 },
+    // State 1766
+    { 1766, 1004, PA_SHIFT, 13 },
+    // State 1767
+    { 1767, 996, PA_SHIFT, 6 },
+    // State 1767
+    { 1767, 998, PA_REDUCE, 885 },
+    // State 1768
+    { 1768, 1, PA_SHIFT, 8 },
+    // State 1768
+    { 1768, 994, PA_SHIFT, 10 },
+    // State 1768
+    { 1768, 995, PA_SHIFT, 9 },
+    // State 1768
+    { 1768, 1000, PA_SHIFT, 1769 },
+    // State 1768
+    { 1768, 1004, PA_SHIFT, 13 },
+    // State 1769
+    { 1769, 996, PA_SHIFT, 6 },
+    // State 1769
+    { 1769, 998, PA_REDUCE, 886 },
+    // State 1770
+    { 1770, 1, PA_SHIFT, 8 },
+    // State 1770
+    { 1770, 994, PA_SHIFT, 10 },
+    // State 1770
+    { 1770, 995, PA_SHIFT, 9 },
+    // State 1770
+    { 1770, 1000, PA_SHIFT, 1771 },
+    // State 1770
+    { 1770, 1004, PA_SHIFT, 13 },
+    // State 1771
+    { 1771, 996, PA_SHIFT, 6 },
+    // State 1771
+    { 1771, 998, PA_REDUCE, 887 },
+    // State 1772
+    { 1772, 1, PA_SHIFT, 8 },
+    // State 1772
+    { 1772, 994, PA_SHIFT, 10 },
+    // State 1772
+    { 1772, 995, PA_SHIFT, 9 },
+    // State 1772
+    { 1772, 1000, PA_SHIFT, 1773 },
+    // State 1772
+    { 1772, 1004, PA_SHIFT, 13 },
+    // State 1773
+    { 1773, 996, PA_SHIFT, 6 },
+    // State 1773
+    { 1773, 998, PA_REDUCE, 888 },
+    // State 1774
+    { 1774, 1, PA_SHIFT, 8 },
+    // State 1774
+    { 1774, 994, PA_SHIFT, 10 },
+    // State 1774
+    { 1774, 995, PA_SHIFT, 9 },
+    // State 1774
+    { 1774, 1000, PA_SHIFT, 1775 },
+    // State 1774
+    { 1774, 1004, PA_SHIFT, 13 },
+    // State 1775
+    { 1775, 996, PA_SHIFT, 6 },
+    // State 1775
+    { 1775, 998, PA_REDUCE, 889 },
+    // State 1776
+    { 1776, 1, PA_SHIFT, 8 },
+    // State 1776
+    { 1776, 994, PA_SHIFT, 10 },
+    // State 1776
+    { 1776, 995, PA_SHIFT, 9 },
+    // State 1776
+    { 1776, 1000, PA_SHIFT, 1777 },
+    // State 1776
+    { 1776, 1004, PA_SHIFT, 13 },
+    // State 1777
+    { 1777, 996, PA_SHIFT, 6 },
+    // State 1777
+    { 1777, 998, PA_REDUCE, 890 },
+    // State 1778
+    { 1778, 1, PA_SHIFT, 8 },
+    // State 1778
+    { 1778, 994, PA_SHIFT, 10 },
+    // State 1778
+    { 1778, 995, PA_SHIFT, 9 },
+    // State 1778
+    { 1778, 1000, PA_SHIFT, 1779 },
+    // State 1778
+    { 1778, 1004, PA_SHIFT, 13 },
+    // State 1779
+    { 1779, 996, PA_SHIFT, 6 },
+    // State 1779
+    { 1779, 998, PA_REDUCE, 891 },
+    // State 1780
+    { 1780, 1, PA_SHIFT, 8 },
+    // State 1780
+    { 1780, 994, PA_SHIFT, 10 },
+    // State 1780
+    { 1780, 995, PA_SHIFT, 9 },
+    // State 1780
+    { 1780, 1000, PA_SHIFT, 1781 },
+    // State 1780
+    { 1780, 1004, PA_SHIFT, 13 },
+    // State 1781
+    { 1781, 996, PA_SHIFT, 6 },
+    // State 1781
+    { 1781, 998, PA_REDUCE, 892 },
+    // State 1782
+    { 1782, 1, PA_SHIFT, 8 },
+    // State 1782
+    { 1782, 994, PA_SHIFT, 10 },
+    // State 1782
+    { 1782, 995, PA_SHIFT, 9 },
+    // State 1782
+    { 1782, 1000, PA_SHIFT, 1783 },
+    // State 1782
+    { 1782, 1004, PA_SHIFT, 13 },
+    // State 1783
+    { 1783, 996, PA_SHIFT, 6 },
+    // State 1783
+    { 1783, 998, PA_REDUCE, 893 },
+    // State 1784
+    { 1784, 1, PA_SHIFT, 8 },
+    // State 1784
+    { 1784, 994, PA_SHIFT, 10 },
+    // State 1784
+    { 1784, 995, PA_SHIFT, 9 },
+    // State 1784
+    { 1784, 1000, PA_SHIFT, 1785 },
+    // State 1784
+    { 1784, 1004, PA_SHIFT, 13 },
+    // State 1785
+    { 1785, 996, PA_SHIFT, 6 },
+    // State 1785
+    { 1785, 998, PA_REDUCE, 894 },
+    // State 1786
+    { 1786, 1, PA_SHIFT, 8 },
+    // State 1786
+    { 1786, 994, PA_SHIFT, 10 },
+    // State 1786
+    { 1786, 995, PA_SHIFT, 9 },
+    // State 1786
+    { 1786, 1000, PA_SHIFT, 1787 },
+    // State 1786
+    { 1786, 1004, PA_SHIFT, 13 },
+    // State 1787
+    { 1787, 996, PA_SHIFT, 6 },
+    // State 1787
+    { 1787, 998, PA_REDUCE, 895 },
+    // State 1788
+    { 1788, 1, PA_SHIFT, 8 },
+    // State 1788
+    { 1788, 994, PA_SHIFT, 10 },
+    // State 1788
+    { 1788, 995, PA_SHIFT, 9 },
+    // State 1788
+    { 1788, 1000, PA_SHIFT, 1789 },
+    // State 1788
+    { 1788, 1004, PA_SHIFT, 13 },
+    // State 1789
+    { 1789, 996, PA_SHIFT, 6 },
+    // State 1789
+    { 1789, 998, PA_REDUCE, 896 },
+    // State 1790
+    { 1790, 1, PA_SHIFT, 8 },
+    // State 1790
+    { 1790, 994, PA_SHIFT, 10 },
+    // State 1790
+    { 1790, 995, PA_SHIFT, 9 },
+    // State 1790
+    { 1790, 1000, PA_SHIFT, 1791 },
+    // State 1790
+    { 1790, 1004, PA_SHIFT, 13 },
+    // State 1791
+    { 1791, 996, PA_SHIFT, 6 },
+    // State 1791
+    { 1791, 998, PA_REDUCE, 897 },
+    // State 1792
+    { 1792, 1, PA_SHIFT, 8 },
+    // State 1792
+    { 1792, 994, PA_SHIFT, 10 },
+    // State 1792
+    { 1792, 995, PA_SHIFT, 9 },
+    // State 1792
+    { 1792, 1000, PA_SHIFT, 1793 },
+    // State 1792
+    { 1792, 1004, PA_SHIFT, 13 },
+    // State 1793
+    { 1793, 996, PA_SHIFT, 6 },
+    // State 1793
+    { 1793, 998, PA_REDUCE, 898 },
+    // State 1794
+    { 1794, 1, PA_SHIFT, 8 },
+    // State 1794
+    { 1794, 994, PA_SHIFT, 10 },
+    // State 1794
+    { 1794, 995, PA_SHIFT, 9 },
+    // State 1794
+    { 1794, 1000, PA_SHIFT, 1795 },
+    // State 1794
+    { 1794, 1004, PA_SHIFT, 13 },
+    // State 1795
+    { 1795, 996, PA_SHIFT, 6 },
+    // State 1795
+    { 1795, 998, PA_REDUCE, 899 },
+    // State 1796
+    { 1796, 1, PA_SHIFT, 8 },
+    // State 1796
+    { 1796, 994, PA_SHIFT, 10 },
+    // State 1796
+    { 1796, 995, PA_SHIFT, 9 },
+    // State 1796
+    { 1796, 1000, PA_SHIFT, 1797 },
+    // State 1796
+    { 1796, 1004, PA_SHIFT, 13 },
+    // State 1797
+    { 1797, 996, PA_SHIFT, 6 },
+    // State 1797
+    { 1797, 998, PA_REDUCE, 900 },
+    // State 1798
+    { 1798, 1, PA_SHIFT, 8 },
+    // State 1798
+    { 1798, 994, PA_SHIFT, 10 },
+    // State 1798
+    { 1798, 995, PA_SHIFT, 9 },
+    // State 1798
+    { 1798, 1000, PA_SHIFT, 1799 },
+    // State 1798
+    { 1798, 1004, PA_SHIFT, 13 },
+    // State 1799
+    { 1799, 996, PA_SHIFT, 6 },
+    // State 1799
+    { 1799, 998, PA_REDUCE, 901 },
+    // State 1800
+    { 1800, 1, PA_SHIFT, 8 },
+    // State 1800
+    { 1800, 994, PA_SHIFT, 10 },
+    // State 1800
+    { 1800, 995, PA_SHIFT, 9 },
+    // State 1800
+    { 1800, 1000, PA_SHIFT, 1801 },
+    // State 1800
+    { 1800, 1004, PA_SHIFT, 13 },
+    // State 1801
+    { 1801, 996, PA_SHIFT, 6 },
+    // State 1801
+    { 1801, 998, PA_REDUCE, 902 },
+    // State 1802
+    { 1802, 1, PA_SHIFT, 8 },
+    // State 1802
+    { 1802, 994, PA_SHIFT, 10 },
+    // State 1802
+    { 1802, 995, PA_SHIFT, 9 },
+    // State 1802
+    { 1802, 1000, PA_SHIFT, 1803 },
+    // State 1802
+    { 1802, 1004, PA_SHIFT, 13 },
+    // State 1803
+    { 1803, 996, PA_SHIFT, 6 },
+    // State 1803
+    { 1803, 998, PA_REDUCE, 903 },
+    // State 1804
+    { 1804, 1, PA_SHIFT, 8 },
+    // State 1804
+    { 1804, 994, PA_SHIFT, 10 },
+    // State 1804
+    { 1804, 995, PA_SHIFT, 9 },
+    // State 1804
+    { 1804, 1000, PA_SHIFT, 1805 },
+    // State 1804
+    { 1804, 1004, PA_SHIFT, 13 },
+    // State 1805
+    { 1805, 996, PA_SHIFT, 6 },
+    // State 1805
+    { 1805, 998, PA_REDUCE, 904 },
+    // State 1806
+    { 1806, 1, PA_SHIFT, 8 },
+    // State 1806
+    { 1806, 994, PA_SHIFT, 10 },
+    // State 1806
+    { 1806, 995, PA_SHIFT, 9 },
+    // State 1806
+    { 1806, 1000, PA_SHIFT, 1807 },
+    // State 1806
+    { 1806, 1004, PA_SHIFT, 13 },
+    // State 1807
+    { 1807, 996, PA_SHIFT, 6 },
+    // State 1807
+    { 1807, 998, PA_REDUCE, 905 },
+    // State 1808
+    { 1808, 1, PA_SHIFT, 8 },
+    // State 1808
+    { 1808, 994, PA_SHIFT, 10 },
+    // State 1808
+    { 1808, 995, PA_SHIFT, 9 },
+    // State 1808
+    { 1808, 1000, PA_SHIFT, 1809 },
+    // State 1808
+    { 1808, 1004, PA_SHIFT, 13 },
+    // State 1809
+    { 1809, 996, PA_SHIFT, 6 },
+    // State 1809
+    { 1809, 998, PA_REDUCE, 906 },
+    // State 1810
+    { 1810, 1, PA_SHIFT, 8 },
+    // State 1810
+    { 1810, 994, PA_SHIFT, 10 },
+    // State 1810
+    { 1810, 995, PA_SHIFT, 9 },
+    // State 1810
+    { 1810, 1000, PA_SHIFT, 1811 },
+    // State 1810
+    { 1810, 1004, PA_SHIFT, 13 },
+    // State 1811
+    { 1811, 996, PA_SHIFT, 6 },
+    // State 1811
+    { 1811, 998, PA_REDUCE, 907 },
+    // State 1812
+    { 1812, 1, PA_SHIFT, 8 },
+    // State 1812
+    { 1812, 994, PA_SHIFT, 10 },
+    // State 1812
+    { 1812, 995, PA_SHIFT, 9 },
+    // State 1812
+    { 1812, 1000, PA_SHIFT, 1813 },
+    // State 1812
+    { 1812, 1004, PA_SHIFT, 13 },
+    // State 1813
+    { 1813, 996, PA_SHIFT, 6 },
+    // State 1813
+    { 1813, 998, PA_REDUCE, 908 },
+    // State 1814
+    { 1814, 1, PA_SHIFT, 8 },
+    // State 1814
+    { 1814, 994, PA_SHIFT, 10 },
+    // State 1814
+    { 1814, 995, PA_SHIFT, 9 },
+    // State 1814
+    { 1814, 1000, PA_SHIFT, 1815 },
+    // State 1814
+    { 1814, 1004, PA_SHIFT, 13 },
+    // State 1815
+    { 1815, 996, PA_SHIFT, 6 },
+    // State 1815
+    { 1815, 998, PA_REDUCE, 909 },
+    // State 1816
+    { 1816, 1, PA_SHIFT, 8 },
+    // State 1816
+    { 1816, 994, PA_SHIFT, 10 },
+    // State 1816
+    { 1816, 995, PA_SHIFT, 9 },
+    // State 1816
+    { 1816, 1000, PA_SHIFT, 1817 },
+    // State 1816
+    { 1816, 1004, PA_SHIFT, 13 },
+    // State 1817
+    { 1817, 996, PA_SHIFT, 6 },
+    // State 1817
+    { 1817, 998, PA_REDUCE, 910 },
+    // State 1818
+    { 1818, 1, PA_SHIFT, 8 },
+    // State 1818
+    { 1818, 994, PA_SHIFT, 10 },
+    // State 1818
+    { 1818, 995, PA_SHIFT, 9 },
+    // State 1818
+    { 1818, 1000, PA_SHIFT, 1819 },
+    // State 1818
+    { 1818, 1004, PA_SHIFT, 13 },
+    // State 1819
+    { 1819, 996, PA_SHIFT, 6 },
+    // State 1819
+    { 1819, 998, PA_REDUCE, 911 },
+    // State 1820
+    { 1820, 1, PA_SHIFT, 8 },
+    // State 1820
+    { 1820, 994, PA_SHIFT, 10 },
+    // State 1820
+    { 1820, 995, PA_SHIFT, 9 },
+    // State 1820
+    { 1820, 1000, PA_SHIFT, 1821 },
+    // State 1820
+    { 1820, 1004, PA_SHIFT, 13 },
+    // State 1821
+    { 1821, 996, PA_SHIFT, 6 },
+    // State 1821
+    { 1821, 998, PA_REDUCE, 912 },
+    // State 1822
+    { 1822, 1, PA_SHIFT, 8 },
+    // State 1822
+    { 1822, 994, PA_SHIFT, 10 },
+    // State 1822
+    { 1822, 995, PA_SHIFT, 9 },
+    // State 1822
+    { 1822, 1000, PA_SHIFT, 1823 },
+    // State 1822
+    { 1822, 1004, PA_SHIFT, 13 },
+    // State 1823
+    { 1823, 996, PA_SHIFT, 6 },
+    // State 1823
+    { 1823, 998, PA_REDUCE, 913 },
+    // State 1824
+    { 1824, 1, PA_SHIFT, 8 },
+    // State 1824
+    { 1824, 994, PA_SHIFT, 10 },
+    // State 1824
+    { 1824, 995, PA_SHIFT, 9 },
+    // State 1824
+    { 1824, 1000, PA_SHIFT, 1825 },
+    // State 1824
+    { 1824, 1004, PA_SHIFT, 13 },
+    // State 1825
+    { 1825, 996, PA_SHIFT, 6 },
+    // State 1825
+    { 1825, 998, PA_REDUCE, 914 },
+    // State 1826
+    { 1826, 1, PA_SHIFT, 8 },
+    // State 1826
+    { 1826, 994, PA_SHIFT, 10 },
+    // State 1826
+    { 1826, 995, PA_SHIFT, 9 },
+    // State 1826
+    { 1826, 1000, PA_SHIFT, 1827 },
+    // State 1826
+    { 1826, 1004, PA_SHIFT, 13 },
+    // State 1827
+    { 1827, 996, PA_SHIFT, 6 },
+    // State 1827
+    { 1827, 998, PA_REDUCE, 915 },
+    // State 1828
+    { 1828, 1, PA_SHIFT, 8 },
+    // State 1828
+    { 1828, 994, PA_SHIFT, 10 },
+    // State 1828
+    { 1828, 995, PA_SHIFT, 9 },
+    // State 1828
+    { 1828, 1000, PA_SHIFT, 1829 },
+    // State 1828
+    { 1828, 1004, PA_SHIFT, 13 },
+    // State 1829
+    { 1829, 996, PA_SHIFT, 6 },
+    // State 1829
+    { 1829, 998, PA_REDUCE, 916 },
+    // State 1830
+    { 1830, 1, PA_SHIFT, 8 },
+    // State 1830
+    { 1830, 994, PA_SHIFT, 10 },
+    // State 1830
+    { 1830, 995, PA_SHIFT, 9 },
+    // State 1830
+    { 1830, 1000, PA_SHIFT, 1831 },
+    // State 1830
+    { 1830, 1004, PA_SHIFT, 13 },
+    // State 1831
+    { 1831, 996, PA_SHIFT, 6 },
+    // State 1831
+    { 1831, 998, PA_REDUCE, 917 },
+    // State 1832
+    { 1832, 1, PA_SHIFT, 8 },
+    // State 1832
+    { 1832, 994, PA_SHIFT, 10 },
+    // State 1832
+    { 1832, 995, PA_SHIFT, 9 },
+    // State 1832
+    { 1832, 1000, PA_SHIFT, 1833 },
+    // State 1832
+    { 1832, 1004, PA_SHIFT, 13 },
+    // State 1833
+    { 1833, 996, PA_SHIFT, 6 },
+    // State 1833
+    { 1833, 998, PA_REDUCE, 918 },
+    // State 1834
+    { 1834, 1, PA_SHIFT, 8 },
+    // State 1834
+    { 1834, 994, PA_SHIFT, 10 },
+    // State 1834
+    { 1834, 995, PA_SHIFT, 9 },
+    // State 1834
+    { 1834, 1000, PA_SHIFT, 1835 },
+    // State 1834
+    { 1834, 1004, PA_SHIFT, 13 },
+    // State 1835
+    { 1835, 996, PA_SHIFT, 6 },
+    // State 1835
+    { 1835, 998, PA_REDUCE, 919 },
+    // State 1836
+    { 1836, 1, PA_SHIFT, 8 },
+    // State 1836
+    { 1836, 994, PA_SHIFT, 10 },
+    // State 1836
+    { 1836, 995, PA_SHIFT, 9 },
+    // State 1836
+    { 1836, 1000, PA_SHIFT, 1837 },
+    // State 1836
+    { 1836, 1004, PA_SHIFT, 13 },
+    // State 1837
+    { 1837, 996, PA_SHIFT, 6 },
+    // State 1837
+    { 1837, 998, PA_REDUCE, 920 },
+    // State 1838
+    { 1838, 1, PA_SHIFT, 8 },
+    // State 1838
+    { 1838, 994, PA_SHIFT, 10 },
+    // State 1838
+    { 1838, 995, PA_SHIFT, 9 },
+    // State 1838
+    { 1838, 1000, PA_SHIFT, 1839 },
+    // State 1838
+    { 1838, 1004, PA_SHIFT, 13 },
+    // State 1839
+    { 1839, 996, PA_SHIFT, 6 },
+    // State 1839
+    { 1839, 998, PA_REDUCE, 921 },
+    // State 1840
+    { 1840, 1, PA_SHIFT, 8 },
+    // State 1840
+    { 1840, 994, PA_SHIFT, 10 },
+    // State 1840
+    { 1840, 995, PA_SHIFT, 9 },
+    // State 1840
+    { 1840, 1000, PA_SHIFT, 1841 },
+    // State 1840
+    { 1840, 1004, PA_SHIFT, 13 },
+    // State 1841
+    { 1841, 996, PA_SHIFT, 6 },
+    // State 1841
+    { 1841, 998, PA_REDUCE, 922 },
+    // State 1842
+    { 1842, 1, PA_SHIFT, 8 },
+    // State 1842
+    { 1842, 994, PA_SHIFT, 10 },
+    // State 1842
+    { 1842, 995, PA_SHIFT, 9 },
+    // State 1842
+    { 1842, 1000, PA_SHIFT, 1843 },
+    // State 1842
+    { 1842, 1004, PA_SHIFT, 13 },
+    // State 1843
+    { 1843, 996, PA_SHIFT, 6 },
+    // State 1843
+    { 1843, 998, PA_REDUCE, 923 },
+    // State 1844
+    { 1844, 1, PA_SHIFT, 8 },
+    // State 1844
+    { 1844, 994, PA_SHIFT, 10 },
+    // State 1844
+    { 1844, 995, PA_SHIFT, 9 },
+    // State 1844
+    { 1844, 1000, PA_SHIFT, 1845 },
+    // State 1844
+    { 1844, 1004, PA_SHIFT, 13 },
+    // State 1845
+    { 1845, 996, PA_SHIFT, 6 },
+    // State 1845
+    { 1845, 998, PA_REDUCE, 924 },
+    // State 1846
+    { 1846, 1, PA_SHIFT, 8 },
+    // State 1846
+    { 1846, 994, PA_SHIFT, 10 },
+    // State 1846
+    { 1846, 995, PA_SHIFT, 9 },
+    // State 1846
+    { 1846, 1000, PA_SHIFT, 1847 },
+    // State 1846
+    { 1846, 1004, PA_SHIFT, 13 },
+    // State 1847
+    { 1847, 996, PA_SHIFT, 6 },
+    // State 1847
+    { 1847, 998, PA_REDUCE, 925 },
+    // State 1848
+    { 1848, 1, PA_SHIFT, 8 },
+    // State 1848
+    { 1848, 994, PA_SHIFT, 10 },
+    // State 1848
+    { 1848, 995, PA_SHIFT, 9 },
+    // State 1848
+    { 1848, 1000, PA_SHIFT, 1849 },
+    // State 1848
+    { 1848, 1004, PA_SHIFT, 13 },
+    // State 1849
+    { 1849, 996, PA_SHIFT, 6 },
+    // State 1849
+    { 1849, 998, PA_REDUCE, 926 },
+    // State 1850
+    { 1850, 1, PA_SHIFT, 8 },
+    // State 1850
+    { 1850, 994, PA_SHIFT, 10 },
+    // State 1850
+    { 1850, 995, PA_SHIFT, 9 },
+    // State 1850
+    { 1850, 1000, PA_SHIFT, 1851 },
+    // State 1850
+    { 1850, 1004, PA_SHIFT, 13 },
+    // State 1851
+    { 1851, 996, PA_SHIFT, 6 },
+    // State 1851
+    { 1851, 998, PA_REDUCE, 927 },
+    // State 1852
+    { 1852, 1, PA_SHIFT, 8 },
+    // State 1852
+    { 1852, 994, PA_SHIFT, 10 },
+    // State 1852
+    { 1852, 995, PA_SHIFT, 9 },
+    // State 1852
+    { 1852, 1000, PA_SHIFT, 1853 },
+    // State 1852
+    { 1852, 1004, PA_SHIFT, 13 },
+    // State 1853
+    { 1853, 996, PA_SHIFT, 6 },
+    // State 1853
+    { 1853, 998, PA_REDUCE, 928 },
+    // State 1854
+    { 1854, 1, PA_SHIFT, 8 },
+    // State 1854
+    { 1854, 994, PA_SHIFT, 10 },
+    // State 1854
+    { 1854, 995, PA_SHIFT, 9 },
+    // State 1854
+    { 1854, 1000, PA_SHIFT, 1855 },
+    // State 1854
+    { 1854, 1004, PA_SHIFT, 13 },
+    // State 1855
+    { 1855, 996, PA_SHIFT, 6 },
+    // State 1855
+    { 1855, 998, PA_REDUCE, 929 },
+    // State 1856
+    { 1856, 1, PA_SHIFT, 8 },
+    // State 1856
+    { 1856, 994, PA_SHIFT, 10 },
+    // State 1856
+    { 1856, 995, PA_SHIFT, 9 },
+    // State 1856
+    { 1856, 1000, PA_SHIFT, 1857 },
+    // State 1856
+    { 1856, 1004, PA_SHIFT, 13 },
+    // State 1857
+    { 1857, 996, PA_SHIFT, 6 },
+    // State 1857
+    { 1857, 998, PA_REDUCE, 930 },
+    // State 1858
+    { 1858, 1, PA_SHIFT, 8 },
+    // State 1858
+    { 1858, 994, PA_SHIFT, 10 },
+    // State 1858
+    { 1858, 995, PA_SHIFT, 9 },
+    // State 1858
+    { 1858, 1000, PA_SHIFT, 1859 },
+    // State 1858
+    { 1858, 1004, PA_SHIFT, 13 },
+    // State 1859
+    { 1859, 996, PA_SHIFT, 6 },
+    // State 1859
+    { 1859, 998, PA_REDUCE, 931 },
+    // State 1860
+    { 1860, 1, PA_SHIFT, 8 },
+    // State 1860
+    { 1860, 994, PA_SHIFT, 10 },
+    // State 1860
+    { 1860, 995, PA_SHIFT, 9 },
+    // State 1860
+    { 1860, 1000, PA_SHIFT, 1861 },
+    // State 1860
+    { 1860, 1004, PA_SHIFT, 13 },
+    // State 1861
+    { 1861, 996, PA_SHIFT, 6 },
+    // State 1861
+    { 1861, 998, PA_REDUCE, 932 },
+    // State 1862
+    { 1862, 1, PA_SHIFT, 8 },
+    // State 1862
+    { 1862, 994, PA_SHIFT, 10 },
+    // State 1862
+    { 1862, 995, PA_SHIFT, 9 },
+    // State 1862
+    { 1862, 1000, PA_SHIFT, 1863 },
+    // State 1862
+    { 1862, 1004, PA_SHIFT, 13 },
+    // State 1863
+    { 1863, 996, PA_SHIFT, 6 },
+    // State 1863
+    { 1863, 998, PA_REDUCE, 933 },
+    // State 1864
+    { 1864, 1, PA_SHIFT, 8 },
+    // State 1864
+    { 1864, 994, PA_SHIFT, 10 },
+    // State 1864
+    { 1864, 995, PA_SHIFT, 9 },
+    // State 1864
+    { 1864, 1000, PA_SHIFT, 1865 },
+    // State 1864
+    { 1864, 1004, PA_SHIFT, 13 },
+    // State 1865
+    { 1865, 996, PA_SHIFT, 6 },
+    // State 1865
+    { 1865, 998, PA_REDUCE, 934 },
+    // State 1866
+    { 1866, 1, PA_SHIFT, 8 },
+    // State 1866
+    { 1866, 994, PA_SHIFT, 10 },
+    // State 1866
+    { 1866, 995, PA_SHIFT, 9 },
+    // State 1866
+    { 1866, 1000, PA_SHIFT, 1867 },
+    // State 1866
+    { 1866, 1004, PA_SHIFT, 13 },
+    // State 1867
+    { 1867, 996, PA_SHIFT, 6 },
+    // State 1867
+    { 1867, 998, PA_REDUCE, 935 },
+    // State 1868
+    { 1868, 1, PA_SHIFT, 8 },
+    // State 1868
+    { 1868, 994, PA_SHIFT, 10 },
+    // State 1868
+    { 1868, 995, PA_SHIFT, 9 },
+    // State 1868
+    { 1868, 1000, PA_SHIFT, 1869 },
+    // State 1868
+    { 1868, 1004, PA_SHIFT, 13 },
+    // State 1869
+    { 1869, 996, PA_SHIFT, 6 },
+    // State 1869
+    { 1869, 998, PA_REDUCE, 936 },
+    // State 1870
+    { 1870, 1, PA_SHIFT, 8 },
+    // State 1870
+    { 1870, 994, PA_SHIFT, 10 },
+    // State 1870
+    { 1870, 995, PA_SHIFT, 9 },
+    // State 1870
+    { 1870, 1000, PA_SHIFT, 1871 },
+    // State 1870
+    { 1870, 1004, PA_SHIFT, 13 },
+    // State 1871
+    { 1871, 996, PA_SHIFT, 6 },
+    // State 1871
+    { 1871, 998, PA_REDUCE, 937 },
+    // State 1872
+    { 1872, 1, PA_SHIFT, 8 },
+    // State 1872
+    { 1872, 994, PA_SHIFT, 10 },
+    // State 1872
+    { 1872, 995, PA_SHIFT, 9 },
+    // State 1872
+    { 1872, 1000, PA_SHIFT, 1873 },
+    // State 1872
+    { 1872, 1004, PA_SHIFT, 13 },
+    // State 1873
+    { 1873, 996, PA_SHIFT, 6 },
+    // State 1873
+    { 1873, 998, PA_REDUCE, 938 },
+    // State 1874
+    { 1874, 1, PA_SHIFT, 8 },
+    // State 1874
+    { 1874, 994, PA_SHIFT, 10 },
+    // State 1874
+    { 1874, 995, PA_SHIFT, 9 },
+    // State 1874
+    { 1874, 1000, PA_SHIFT, 1875 },
+    // State 1874
+    { 1874, 1004, PA_SHIFT, 13 },
+    // State 1875
+    { 1875, 996, PA_SHIFT, 6 },
+    // State 1875
+    { 1875, 998, PA_REDUCE, 939 },
+    // State 1876
+    { 1876, 1, PA_SHIFT, 8 },
+    // State 1876
+    { 1876, 994, PA_SHIFT, 10 },
+    // State 1876
+    { 1876, 995, PA_SHIFT, 9 },
+    // State 1876
+    { 1876, 1000, PA_SHIFT, 1877 },
+    // State 1876
+    { 1876, 1004, PA_SHIFT, 13 },
+    // State 1877
+    { 1877, 996, PA_SHIFT, 6 },
+    // State 1877
+    { 1877, 998, PA_REDUCE, 940 },
+    // State 1878
+    { 1878, 1, PA_SHIFT, 8 },
+    // State 1878
+    { 1878, 994, PA_SHIFT, 10 },
+    // State 1878
+    { 1878, 995, PA_SHIFT, 9 },
+    // State 1878
+    { 1878, 1000, PA_SHIFT, 1879 },
+    // State 1878
+    { 1878, 1004, PA_SHIFT, 13 },
+    // State 1879
+    { 1879, 996, PA_SHIFT, 6 },
+    // State 1879
+    { 1879, 998, PA_REDUCE, 941 },
+    // State 1880
+    { 1880, 1, PA_SHIFT, 8 },
+    // State 1880
+    { 1880, 994, PA_SHIFT, 10 },
+    // State 1880
+    { 1880, 995, PA_SHIFT, 9 },
+    // State 1880
+    { 1880, 1000, PA_SHIFT, 1881 },
+    // State 1880
+    { 1880, 1004, PA_SHIFT, 13 },
+    // State 1881
+    { 1881, 996, PA_SHIFT, 6 },
+    // State 1881
+    { 1881, 998, PA_REDUCE, 942 },
+    // State 1882
+    { 1882, 1, PA_SHIFT, 8 },
+    // State 1882
+    { 1882, 994, PA_SHIFT, 10 },
+    // State 1882
+    { 1882, 995, PA_SHIFT, 9 },
+    // State 1882
+    { 1882, 1000, PA_SHIFT, 1883 },
+    // State 1882
+    { 1882, 1004, PA_SHIFT, 13 },
+    // State 1883
+    { 1883, 996, PA_SHIFT, 6 },
+    // State 1883
+    { 1883, 998, PA_REDUCE, 943 },
+    // State 1884
+    { 1884, 1, PA_SHIFT, 8 },
+    // State 1884
+    { 1884, 994, PA_SHIFT, 10 },
+    // State 1884
+    { 1884, 995, PA_SHIFT, 9 },
+    // State 1884
+    { 1884, 1000, PA_SHIFT, 1885 },
+    // State 1884
+    { 1884, 1004, PA_SHIFT, 13 },
+    // State 1885
+    { 1885, 996, PA_SHIFT, 6 },
+    // State 1885
+    { 1885, 998, PA_REDUCE, 944 },
+    // State 1886
+    { 1886, 1, PA_SHIFT, 8 },
+    // State 1886
+    { 1886, 994, PA_SHIFT, 10 },
+    // State 1886
+    { 1886, 995, PA_SHIFT, 9 },
+    // State 1886
+    { 1886, 1000, PA_SHIFT, 1887 },
+    // State 1886
+    { 1886, 1004, PA_SHIFT, 13 },
+    // State 1887
+    { 1887, 996, PA_SHIFT, 6 },
+    // State 1887
+    { 1887, 998, PA_REDUCE, 945 },
+    // State 1888
+    { 1888, 1, PA_SHIFT, 8 },
+    // State 1888
+    { 1888, 994, PA_SHIFT, 10 },
+    // State 1888
+    { 1888, 995, PA_SHIFT, 9 },
+    // State 1888
+    { 1888, 1000, PA_SHIFT, 1889 },
+    // State 1888
+    { 1888, 1004, PA_SHIFT, 13 },
+    // State 1889
+    { 1889, 996, PA_SHIFT, 6 },
+    // State 1889
+    { 1889, 998, PA_REDUCE, 946 },
+    // State 1890
+    { 1890, 1, PA_SHIFT, 8 },
+    // State 1890
+    { 1890, 994, PA_SHIFT, 10 },
+    // State 1890
+    { 1890, 995, PA_SHIFT, 9 },
+    // State 1890
+    { 1890, 1000, PA_SHIFT, 1891 },
+    // State 1890
+    { 1890, 1004, PA_SHIFT, 13 },
+    // State 1891
+    { 1891, 996, PA_SHIFT, 6 },
+    // State 1891
+    { 1891, 998, PA_REDUCE, 947 },
+    // State 1892
+    { 1892, 1, PA_SHIFT, 8 },
+    // State 1892
+    { 1892, 994, PA_SHIFT, 10 },
+    // State 1892
+    { 1892, 995, PA_SHIFT, 9 },
+    // State 1892
+    { 1892, 1000, PA_SHIFT, 1893 },
+    // State 1892
+    { 1892, 1004, PA_SHIFT, 13 },
+    // State 1893
+    { 1893, 996, PA_SHIFT, 6 },
+    // State 1893
+    { 1893, 998, PA_REDUCE, 948 },
+    // State 1894
+    { 1894, 1, PA_SHIFT, 8 },
+    // State 1894
+    { 1894, 994, PA_SHIFT, 10 },
+    // State 1894
+    { 1894, 995, PA_SHIFT, 9 },
+    // State 1894
+    { 1894, 1000, PA_SHIFT, 1895 },
+    // State 1894
+    { 1894, 1004, PA_SHIFT, 13 },
+    // State 1895
+    { 1895, 996, PA_SHIFT, 6 },
+    // State 1895
+    { 1895, 998, PA_REDUCE, 949 },
+    // State 1896
+    { 1896, 1, PA_SHIFT, 8 },
+    // State 1896
+    { 1896, 994, PA_SHIFT, 10 },
+    // State 1896
+    { 1896, 995, PA_SHIFT, 9 },
+    // State 1896
+    { 1896, 1000, PA_SHIFT, 1897 },
+    // State 1896
+    { 1896, 1004, PA_SHIFT, 13 },
+    // State 1897
+    { 1897, 996, PA_SHIFT, 6 },
+    // State 1897
+    { 1897, 998, PA_REDUCE, 950 },
+    // State 1898
+    { 1898, 1, PA_SHIFT, 8 },
+    // State 1898
+    { 1898, 994, PA_SHIFT, 10 },
+    // State 1898
+    { 1898, 995, PA_SHIFT, 9 },
+    // State 1898
+    { 1898, 1000, PA_SHIFT, 1899 },
+    // State 1898
+    { 1898, 1004, PA_SHIFT, 13 },
+    // State 1899
+    { 1899, 996, PA_SHIFT, 6 },
+    // State 1899
+    { 1899, 998, PA_REDUCE, 951 },
+    // State 1900
+    { 1900, 1, PA_SHIFT, 8 },
+    // State 1900
+    { 1900, 994, PA_SHIFT, 10 },
+    // State 1900
+    { 1900, 995, PA_SHIFT, 9 },
+    // State 1900
+    { 1900, 1000, PA_SHIFT, 1901 },
+    // State 1900
+    { 1900, 1004, PA_SHIFT, 13 },
+    // State 1901
+    { 1901, 996, PA_SHIFT, 6 },
+    // State 1901
+    { 1901, 998, PA_REDUCE, 952 },
+    // State 1902
+    { 1902, 1, PA_SHIFT, 8 },
+    // State 1902
+    { 1902, 994, PA_SHIFT, 10 },
+    // State 1902
+    { 1902, 995, PA_SHIFT, 9 },
+    // State 1902
+    { 1902, 1000, PA_SHIFT, 1903 },
+    // State 1902
+    { 1902, 1004, PA_SHIFT, 13 },
+    // State 1903
+    { 1903, 996, PA_SHIFT, 6 },
+    // State 1903
+    { 1903, 998, PA_REDUCE, 953 },
+    // State 1904
+    { 1904, 1, PA_SHIFT, 8 },
+    // State 1904
+    { 1904, 994, PA_SHIFT, 10 },
+    // State 1904
+    { 1904, 995, PA_SHIFT, 9 },
+    // State 1904
+    { 1904, 1000, PA_SHIFT, 1905 },
+    // State 1904
+    { 1904, 1004, PA_SHIFT, 13 },
+    // State 1905
+    { 1905, 996, PA_SHIFT, 6 },
+    // State 1905
+    { 1905, 998, PA_REDUCE, 954 },
+    // State 1906
+    { 1906, 1, PA_SHIFT, 8 },
+    // State 1906
+    { 1906, 994, PA_SHIFT, 10 },
+    // State 1906
+    { 1906, 995, PA_SHIFT, 9 },
+    // State 1906
+    { 1906, 1000, PA_SHIFT, 1907 },
+    // State 1906
+    { 1906, 1004, PA_SHIFT, 13 },
+    // State 1907
+    { 1907, 996, PA_SHIFT, 6 },
+    // State 1907
+    { 1907, 998, PA_REDUCE, 955 },
+    // State 1908
+    { 1908, 1, PA_SHIFT, 8 },
+    // State 1908
+    { 1908, 994, PA_SHIFT, 10 },
+    // State 1908
+    { 1908, 995, PA_SHIFT, 9 },
+    // State 1908
+    { 1908, 1000, PA_SHIFT, 1909 },
+    // State 1908
+    { 1908, 1004, PA_SHIFT, 13 },
+    // State 1909
+    { 1909, 996, PA_SHIFT, 6 },
+    // State 1909
+    { 1909, 998, PA_REDUCE, 956 },
+    // State 1910
+    { 1910, 1, PA_SHIFT, 8 },
+    // State 1910
+    { 1910, 994, PA_SHIFT, 10 },
+    // State 1910
+    { 1910, 995, PA_SHIFT, 9 },
+    // State 1910
+    { 1910, 1000, PA_SHIFT, 1911 },
+    // State 1910
+    { 1910, 1004, PA_SHIFT, 13 },
+    // State 1911
+    { 1911, 996, PA_SHIFT, 6 },
+    // State 1911
+    { 1911, 998, PA_REDUCE, 957 },
+    // State 1912
+    { 1912, 1, PA_SHIFT, 8 },
+    // State 1912
+    { 1912, 994, PA_SHIFT, 10 },
+    // State 1912
+    { 1912, 995, PA_SHIFT, 9 },
+    // State 1912
+    { 1912, 1000, PA_SHIFT, 1913 },
+    // State 1912
+    { 1912, 1004, PA_SHIFT, 13 },
+    // State 1913
+    { 1913, 996, PA_SHIFT, 6 },
+    // State 1913
+    { 1913, 998, PA_REDUCE, 958 },
+    // State 1914
+    { 1914, 1, PA_SHIFT, 8 },
+    // State 1914
+    { 1914, 994, PA_SHIFT, 10 },
+    // State 1914
+    { 1914, 995, PA_SHIFT, 9 },
+    // State 1914
+    { 1914, 1000, PA_SHIFT, 1915 },
+    // State 1914
+    { 1914, 1004, PA_SHIFT, 13 },
+    // State 1915
+    { 1915, 996, PA_SHIFT, 6 },
+    // State 1915
+    { 1915, 998, PA_REDUCE, 959 },
+    // State 1916
+    { 1916, 1, PA_SHIFT, 8 },
+    // State 1916
+    { 1916, 994, PA_SHIFT, 10 },
+    // State 1916
+    { 1916, 995, PA_SHIFT, 9 },
+    // State 1916
+    { 1916, 1000, PA_SHIFT, 1917 },
+    // State 1916
+    { 1916, 1004, PA_SHIFT, 13 },
+    // State 1917
+    { 1917, 996, PA_SHIFT, 6 },
+    // State 1917
+    { 1917, 998, PA_REDUCE, 960 },
+    // State 1918
+    { 1918, 1, PA_SHIFT, 8 },
+    // State 1918
+    { 1918, 994, PA_SHIFT, 10 },
+    // State 1918
+    { 1918, 995, PA_SHIFT, 9 },
+    // State 1918
+    { 1918, 1000, PA_SHIFT, 1919 },
+    // State 1918
+    { 1918, 1004, PA_SHIFT, 13 },
+    // State 1919
+    { 1919, 996, PA_SHIFT, 6 },
+    // State 1919
+    { 1919, 998, PA_REDUCE, 961 },
+    // State 1920
+    { 1920, 1, PA_SHIFT, 8 },
+    // State 1920
+    { 1920, 994, PA_SHIFT, 10 },
+    // State 1920
+    { 1920, 995, PA_SHIFT, 9 },
+    // State 1920
+    { 1920, 1000, PA_SHIFT, 1921 },
+    // State 1920
+    { 1920, 1004, PA_SHIFT, 13 },
+    // State 1921
+    { 1921, 996, PA_SHIFT, 6 },
+    // State 1921
+    { 1921, 998, PA_REDUCE, 962 },
+    // State 1922
+    { 1922, 1, PA_SHIFT, 8 },
+    // State 1922
+    { 1922, 994, PA_SHIFT, 10 },
+    // State 1922
+    { 1922, 995, PA_SHIFT, 9 },
+    // State 1922
+    { 1922, 1000, PA_SHIFT, 1923 },
+    // State 1922
+    { 1922, 1004, PA_SHIFT, 13 },
+    // State 1923
+    { 1923, 996, PA_SHIFT, 6 },
+    // State 1923
+    { 1923, 998, PA_REDUCE, 963 },
+    // State 1924
+    { 1924, 1, PA_SHIFT, 8 },
+    // State 1924
+    { 1924, 994, PA_SHIFT, 10 },
+    // State 1924
+    { 1924, 995, PA_SHIFT, 9 },
+    // State 1924
+    { 1924, 1000, PA_SHIFT, 1925 },
+    // State 1924
+    { 1924, 1004, PA_SHIFT, 13 },
+    // State 1925
+    { 1925, 996, PA_SHIFT, 6 },
+    // State 1925
+    { 1925, 998, PA_REDUCE, 964 },
+    // State 1926
+    { 1926, 1, PA_SHIFT, 8 },
+    // State 1926
+    { 1926, 994, PA_SHIFT, 10 },
+    // State 1926
+    { 1926, 995, PA_SHIFT, 9 },
+    // State 1926
+    { 1926, 1000, PA_SHIFT, 1927 },
+    // State 1926
+    { 1926, 1004, PA_SHIFT, 13 },
+    // State 1927
+    { 1927, 996, PA_SHIFT, 6 },
+    // State 1927
+    { 1927, 998, PA_REDUCE, 965 },
+    // State 1928
+    { 1928, 1, PA_SHIFT, 8 },
+    // State 1928
+    { 1928, 994, PA_SHIFT, 10 },
+    // State 1928
+    { 1928, 995, PA_SHIFT, 9 },
+    // State 1928
+    { 1928, 1000, PA_SHIFT, 1929 },
+    // State 1928
+    { 1928, 1004, PA_SHIFT, 13 },
+    // State 1929
+    { 1929, 996, PA_SHIFT, 6 },
+    // State 1929
+    { 1929, 998, PA_REDUCE, 966 },
+    // State 1930
+    { 1930, 1, PA_SHIFT, 8 },
+    // State 1930
+    { 1930, 994, PA_SHIFT, 10 },
+    // State 1930
+    { 1930, 995, PA_SHIFT, 9 },
+    // State 1930
+    { 1930, 1000, PA_SHIFT, 1931 },
+    // State 1930
+    { 1930, 1004, PA_SHIFT, 13 },
+    // State 1931
+    { 1931, 996, PA_SHIFT, 6 },
+    // State 1931
+    { 1931, 998, PA_REDUCE, 967 },
+    // State 1932
+    { 1932, 1, PA_SHIFT, 8 },
+    // State 1932
+    { 1932, 994, PA_SHIFT, 10 },
+    // State 1932
+    { 1932, 995, PA_SHIFT, 9 },
+    // State 1932
+    { 1932, 1000, PA_SHIFT, 1933 },
+    // State 1932
+    { 1932, 1004, PA_SHIFT, 13 },
+    // State 1933
+    { 1933, 996, PA_SHIFT, 6 },
+    // State 1933
+    { 1933, 998, PA_REDUCE, 968 },
+    // State 1934
+    { 1934, 1, PA_SHIFT, 8 },
+    // State 1934
+    { 1934, 994, PA_SHIFT, 10 },
+    // State 1934
+    { 1934, 995, PA_SHIFT, 9 },
+    // State 1934
+    { 1934, 1000, PA_SHIFT, 1935 },
+    // State 1934
+    { 1934, 1004, PA_SHIFT, 13 },
+    // State 1935
+    { 1935, 996, PA_SHIFT, 6 },
+    // State 1935
+    { 1935, 998, PA_REDUCE, 969 },
+    // State 1936
+    { 1936, 1, PA_SHIFT, 8 },
+    // State 1936
+    { 1936, 994, PA_SHIFT, 10 },
+    // State 1936
+    { 1936, 995, PA_SHIFT, 9 },
+    // State 1936
+    { 1936, 1000, PA_SHIFT, 1937 },
+    // State 1936
+    { 1936, 1004, PA_SHIFT, 13 },
+    // State 1937
+    { 1937, 996, PA_SHIFT, 6 },
+    // State 1937
+    { 1937, 998, PA_REDUCE, 970 },
+    // State 1938
+    { 1938, 1, PA_SHIFT, 8 },
+    // State 1938
+    { 1938, 994, PA_SHIFT, 10 },
+    // State 1938
+    { 1938, 995, PA_SHIFT, 9 },
+    // State 1938
+    { 1938, 1000, PA_SHIFT, 1939 },
+    // State 1938
+    { 1938, 1004, PA_SHIFT, 13 },
+    // State 1939
+    { 1939, 996, PA_SHIFT, 6 },
+    // State 1939
+    { 1939, 998, PA_REDUCE, 971 },
+    // State 1940
+    { 1940, 1, PA_SHIFT, 8 },
+    // State 1940
+    { 1940, 994, PA_SHIFT, 10 },
+    // State 1940
+    { 1940, 995, PA_SHIFT, 9 },
+    // State 1940
+    { 1940, 1000, PA_SHIFT, 1941 },
+    // State 1940
+    { 1940, 1004, PA_SHIFT, 13 },
+    // State 1941
+    { 1941, 996, PA_SHIFT, 6 },
+    // State 1941
+    { 1941, 998, PA_REDUCE, 972 },
+    // State 1942
+    { 1942, 1, PA_SHIFT, 8 },
+    // State 1942
+    { 1942, 994, PA_SHIFT, 10 },
+    // State 1942
+    { 1942, 995, PA_SHIFT, 9 },
+    // State 1942
+    { 1942, 1000, PA_SHIFT, 1943 },
+    // State 1942
+    { 1942, 1004, PA_SHIFT, 13 },
+    // State 1943
+    { 1943, 996, PA_SHIFT, 6 },
+    // State 1943
+    { 1943, 998, PA_REDUCE, 973 },
+    // State 1944
+    { 1944, 1, PA_SHIFT, 8 },
+    // State 1944
+    { 1944, 994, PA_SHIFT, 10 },
+    // State 1944
+    { 1944, 995, PA_SHIFT, 9 },
+    // State 1944
+    { 1944, 1000, PA_SHIFT, 1945 },
+    // State 1944
+    { 1944, 1004, PA_SHIFT, 13 },
+    // State 1945
+    { 1945, 996, PA_SHIFT, 6 },
+    // State 1945
+    { 1945, 998, PA_REDUCE, 974 },
+    // State 1946
+    { 1946, 1, PA_SHIFT, 8 },
+    // State 1946
+    { 1946, 994, PA_SHIFT, 10 },
+    // State 1946
+    { 1946, 995, PA_SHIFT, 9 },
+    // State 1946
+    { 1946, 1000, PA_SHIFT, 1947 },
+    // State 1946
+    { 1946, 1004, PA_SHIFT, 13 },
+    // State 1947
+    { 1947, 996, PA_SHIFT, 6 },
+    // State 1947
+    { 1947, 998, PA_REDUCE, 975 },
+    // State 1948
+    { 1948, 1, PA_SHIFT, 8 },
+    // State 1948
+    { 1948, 994, PA_SHIFT, 10 },
+    // State 1948
+    { 1948, 995, PA_SHIFT, 9 },
+    // State 1948
+    { 1948, 1000, PA_SHIFT, 1949 },
+    // State 1948
+    { 1948, 1004, PA_SHIFT, 13 },
+    // State 1949
+    { 1949, 996, PA_SHIFT, 6 },
+    // State 1949
+    { 1949, 998, PA_REDUCE, 976 },
+    // State 1950
+    { 1950, 1, PA_SHIFT, 8 },
+    // State 1950
+    { 1950, 994, PA_SHIFT, 10 },
+    // State 1950
+    { 1950, 995, PA_SHIFT, 9 },
+    // State 1950
+    { 1950, 1000, PA_SHIFT, 1951 },
+    // State 1950
+    { 1950, 1004, PA_SHIFT, 13 },
+    // State 1951
+    { 1951, 996, PA_SHIFT, 6 },
+    // State 1951
+    { 1951, 998, PA_REDUCE, 977 },
+    // State 1952
+    { 1952, 1, PA_SHIFT, 8 },
+    // State 1952
+    { 1952, 994, PA_SHIFT, 10 },
+    // State 1952
+    { 1952, 995, PA_SHIFT, 9 },
+    // State 1952
+    { 1952, 1000, PA_SHIFT, 1953 },
+    // State 1952
+    { 1952, 1004, PA_SHIFT, 13 },
+    // State 1953
+    { 1953, 996, PA_SHIFT, 6 },
+    // State 1953
+    { 1953, 998, PA_REDUCE, 978 },
+    // State 1954
+    { 1954, 1, PA_SHIFT, 8 },
+    // State 1954
+    { 1954, 994, PA_SHIFT, 10 },
+    // State 1954
+    { 1954, 995, PA_SHIFT, 9 },
+    // State 1954
+    { 1954, 1000, PA_SHIFT, 1955 },
+    // State 1954
+    { 1954, 1004, PA_SHIFT, 13 },
+    // State 1955
+    { 1955, 996, PA_SHIFT, 6 },
+    // State 1955
+    { 1955, 998, PA_REDUCE, 979 },
+    // State 1956
+    { 1956, 1, PA_SHIFT, 8 },
+    // State 1956
+    { 1956, 994, PA_SHIFT, 10 },
+    // State 1956
+    { 1956, 995, PA_SHIFT, 9 },
+    // State 1956
+    { 1956, 1000, PA_SHIFT, 1957 },
+    // State 1956
+    { 1956, 1004, PA_SHIFT, 13 },
+    // State 1957
+    { 1957, 996, PA_SHIFT, 6 },
+    // State 1957
+    { 1957, 998, PA_REDUCE, 980 },
+    // State 1958
+    { 1958, 1, PA_SHIFT, 8 },
+    // State 1958
+    { 1958, 994, PA_SHIFT, 10 },
+    // State 1958
+    { 1958, 995, PA_SHIFT, 9 },
+    // State 1958
+    { 1958, 1000, PA_SHIFT, 1959 },
+    // State 1958
+    { 1958, 1004, PA_SHIFT, 13 },
+    // State 1959
+    { 1959, 996, PA_SHIFT, 6 },
+    // State 1959
+    { 1959, 998, PA_REDUCE, 981 },
+    // State 1960
+    { 1960, 1, PA_SHIFT, 8 },
+    // State 1960
+    { 1960, 994, PA_SHIFT, 10 },
+    // State 1960
+    { 1960, 995, PA_SHIFT, 9 },
+    // State 1960
+    { 1960, 1000, PA_SHIFT, 1961 },
+    // State 1960
+    { 1960, 1004, PA_SHIFT, 13 },
+    // State 1961
+    { 1961, 996, PA_SHIFT, 6 },
+    // State 1961
+    { 1961, 998, PA_REDUCE, 982 },
+    // State 1962
+    { 1962, 1, PA_SHIFT, 8 },
+    // State 1962
+    { 1962, 994, PA_SHIFT, 10 },
+    // State 1962
+    { 1962, 995, PA_SHIFT, 9 },
+    // State 1962
+    { 1962, 1000, PA_SHIFT, 1963 },
+    // State 1962
+    { 1962, 1004, PA_SHIFT, 13 },
+    // State 1963
+    { 1963, 996, PA_SHIFT, 6 },
+    // State 1963
+    { 1963, 998, PA_REDUCE, 983 },
+    // State 1964
+    { 1964, 1, PA_SHIFT, 8 },
+    // State 1964
+    { 1964, 994, PA_SHIFT, 10 },
+    // State 1964
+    { 1964, 995, PA_SHIFT, 9 },
+    // State 1964
+    { 1964, 1000, PA_SHIFT, 1965 },
+    // State 1964
+    { 1964, 1004, PA_SHIFT, 13 },
+    // State 1965
+    { 1965, 996, PA_SHIFT, 6 },
+    // State 1965
+    { 1965, 998, PA_REDUCE, 984 },
+    // State 1966
+    { 1966, 1, PA_SHIFT, 8 },
+    // State 1966
+    { 1966, 994, PA_SHIFT, 10 },
+    // State 1966
+    { 1966, 995, PA_SHIFT, 9 },
+    // State 1966
+    { 1966, 1000, PA_SHIFT, 1967 },
+    // State 1966
+    { 1966, 1004, PA_SHIFT, 13 },
+    // State 1967
+    { 1967, 996, PA_SHIFT, 6 },
+    // State 1967
+    { 1967, 998, PA_REDUCE, 985 },
+    // State 1968
+    { 1968, 1, PA_SHIFT, 8 },
+    // State 1968
+    { 1968, 994, PA_SHIFT, 10 },
+    // State 1968
+    { 1968, 995, PA_SHIFT, 9 },
+    // State 1968
+    { 1968, 1000, PA_SHIFT, 1969 },
+    // State 1968
+    { 1968, 1004, PA_SHIFT, 13 },
+    // State 1969
+    { 1969, 996, PA_SHIFT, 6 },
+    // State 1969
+    { 1969, 998, PA_REDUCE, 986 },
+    // State 1970
+    { 1970, 1, PA_SHIFT, 8 },
+    // State 1970
+    { 1970, 994, PA_SHIFT, 10 },
+    // State 1970
+    { 1970, 995, PA_SHIFT, 9 },
+    // State 1970
+    { 1970, 1000, PA_SHIFT, 1971 },
+    // State 1970
+    { 1970, 1004, PA_SHIFT, 13 },
+    // State 1971
+    { 1971, 996, PA_SHIFT, 6 },
+    // State 1971
+    { 1971, 998, PA_REDUCE, 987 },
+    // State 1972
+    { 1972, 1, PA_SHIFT, 8 },
+    // State 1972
+    { 1972, 994, PA_SHIFT, 10 },
+    // State 1972
+    { 1972, 995, PA_SHIFT, 9 },
+    // State 1972
+    { 1972, 1000, PA_SHIFT, 1973 },
+    // State 1972
+    { 1972, 1004, PA_SHIFT, 13 },
+    // State 1973
+    { 1973, 996, PA_SHIFT, 6 },
+    // State 1973
+    { 1973, 998, PA_REDUCE, 988 },
+    // State 1974
+    { 1974, 1, PA_SHIFT, 8 },
+    // State 1974
+    { 1974, 994, PA_SHIFT, 10 },
+    // State 1974
+    { 1974, 995, PA_SHIFT, 9 },
+    // State 1974
+    { 1974, 1000, PA_SHIFT, 1975 },
+    // State 1974
+    { 1974, 1004, PA_SHIFT, 13 },
+    // State 1975
+    { 1975, 996, PA_SHIFT, 6 },
+    // State 1975
+    { 1975, 998, PA_REDUCE, 989 },
+    // State 1976
+    { 1976, 1, PA_SHIFT, 8 },
+    // State 1976
+    { 1976, 994, PA_SHIFT, 10 },
+    // State 1976
+    { 1976, 995, PA_SHIFT, 9 },
+    // State 1976
+    { 1976, 1000, PA_SHIFT, 1977 },
+    // State 1976
+    { 1976, 1004, PA_SHIFT, 13 },
+    // State 1977
+    { 1977, 996, PA_SHIFT, 6 },
+    // State 1977
+    { 1977, 998, PA_REDUCE, 990 },
+    // State 1978
+    { 1978, 1, PA_SHIFT, 8 },
+    // State 1978
+    { 1978, 994, PA_SHIFT, 10 },
+    // State 1978
+    { 1978, 995, PA_SHIFT, 9 },
+    // State 1978
+    { 1978, 1000, PA_SHIFT, 1979 },
+    // State 1978
+    { 1978, 1004, PA_SHIFT, 13 },
+    // State 1979
+    { 1979, 996, PA_SHIFT, 6 },
+    // State 1979
+    { 1979, 998, PA_REDUCE, 991 },
+    // State 1980
+    { 1980, 1, PA_SHIFT, 8 },
+    // State 1980
+    { 1980, 994, PA_SHIFT, 10 },
+    // State 1980
+    { 1980, 995, PA_SHIFT, 9 },
+    // State 1980
+    { 1980, 1000, PA_SHIFT, 1981 },
+    // State 1980
+    { 1980, 1004, PA_SHIFT, 13 },
+    // State 1981
+    { 1981, 996, PA_SHIFT, 6 },
+    // State 1981
+    { 1981, 998, PA_REDUCE, 992 },
+    // State 1982
+    { 1982, 1, PA_SHIFT, 8 },
+    // State 1982
+    { 1982, 994, PA_SHIFT, 10 },
+    // State 1982
+    { 1982, 995, PA_SHIFT, 9 },
+    // State 1982
+    { 1982, 1000, PA_SHIFT, 1983 },
+    // State 1982
+    { 1982, 1004, PA_SHIFT, 13 },
+    // State 1983
+    { 1983, 996, PA_SHIFT, 6 },
+    // State 1983
+    { 1983, 998, PA_REDUCE, 993 },
+    // State 1984
+    { 1984, 1, PA_SHIFT, 8 },
+    // State 1984
+    { 1984, 994, PA_SHIFT, 10 },
+    // State 1984
+    { 1984, 995, PA_SHIFT, 9 },
+    // State 1984
+    { 1984, 1000, PA_SHIFT, 1985 },
+    // State 1984
+    { 1984, 1004, PA_SHIFT, 13 },
+    // State 1985
+    { 1985, 996, PA_SHIFT, 6 },
+    // State 1985
+    { 1985, 998, PA_REDUCE, 994 },
+    // State 1986
+    { 1986, 1, PA_SHIFT, 8 },
+    // State 1986
+    { 1986, 994, PA_SHIFT, 10 },
+    // State 1986
+    { 1986, 995, PA_SHIFT, 9 },
+    // State 1986
+    { 1986, 1000, PA_SHIFT, 1987 },
+    // State 1986
+    { 1986, 1004, PA_SHIFT, 13 },
+    // State 1987
+    { 1987, 996, PA_SHIFT, 6 },
+    // State 1987
+    { 1987, 998, PA_REDUCE, 995 },
+    // State 1988
+    { 1988, 1, PA_SHIFT, 8 },
+    // State 1988
+    { 1988, 994, PA_SHIFT, 10 },
+    // State 1988
+    { 1988, 995, PA_SHIFT, 9 },
+    // State 1988
+    { 1988, 1000, PA_SHIFT, 1989 },
+    // State 1988
+    { 1988, 1004, PA_SHIFT, 13 },
+    // State 1989
+    { 1989, 996, PA_SHIFT, 6 },
+    // State 1989
+    { 1989, 998, PA_REDUCE, 996 },
+    // State 1990
+    { 1990, 1, PA_SHIFT, 8 },
+    // State 1990
+    { 1990, 994, PA_SHIFT, 10 },
+    // State 1990
+    { 1990, 995, PA_SHIFT, 9 },
+    // State 1990
+    { 1990, 1000, PA_SHIFT, 1991 },
+    // State 1990
+    { 1990, 1004, PA_SHIFT, 13 },
+    // State 1991
+    { 1991, 996, PA_SHIFT, 6 },
+    // State 1991
+    { 1991, 998, PA_REDUCE, 997 },
+    // State 1992
+    { 1992, 1, PA_SHIFT, 8 },
+    // State 1992
+    { 1992, 994, PA_SHIFT, 10 },
+    // State 1992
+    { 1992, 995, PA_SHIFT, 9 },
+    // State 1992
+    { 1992, 1000, PA_SHIFT, 1993 },
+    // State 1992
+    { 1992, 1004, PA_SHIFT, 13 },
+    // State 1993
+    { 1993, 996, PA_SHIFT, 6 },
+    // State 1993
+    { 1993, 998, PA_REDUCE, 998 },
+    // State 1994
+    { 1994, 1, PA_SHIFT, 8 },
+    // State 1994
+    { 1994, 994, PA_SHIFT, 10 },
+    // State 1994
+    { 1994, 995, PA_SHIFT, 9 },
+    // State 1994
+    { 1994, 1000, PA_SHIFT, 1995 },
+    // State 1994
+    { 1994, 1004, PA_SHIFT, 13 },
+    // State 1995
+    { 1995, 996, PA_SHIFT, 6 },
+    // State 1995
+    { 1995, 998, PA_REDUCE, 999 },
+};
+
+
+static int theRuleTable[1000][2] =
+{
+    // prog ::= stmts
+    { 1001, 1 }, 
+    // stmts ::=
+    { 1003, 0 }, 
+    // stmts ::= stmts stmt SEMI
+    { 1003, 3 }, 
+    // expr ::= expr PLUS term
+    { 1000, 3 }, 
+    // expr ::= term
+    { 1000, 1 }, 
+    // term ::= ID
+    { 1004, 1 }, 
+    // term ::= NUM
+    { 1004, 1 }, 
+    // term ::= LP expr RP
+    { 1004, 3 }, 
+    // stmt ::= KW0 expr
+    { 1002, 2 }, 
+    // stmt ::= KW1 expr
+    { 1002, 2 }, 
+    // stmt ::= KW2 expr
+    { 1002, 2 }, 
+    // stmt ::= KW3 expr
+    { 1002, 2 }, 
+    // stmt ::= KW4 expr
+    { 1002, 2 }, 
+    // stmt ::= KW5 expr
+    { 1002, 2 }, 
+    // stmt ::= KW6 expr
+    { 1002, 2 }, 
+    // stmt ::= KW7 expr
+    { 1002, 2 }, 
+    // stmt ::= KW8 expr
+    { 1002, 2 }, 
+    // stmt ::= KW9 expr
+    { 1002, 2 }, 
+    // stmt ::= KW10 expr
+    { 1002, 2 }, 
+    // stmt ::= KW11 expr
+    { 1002, 2 }, 
+    // stmt ::= KW12 expr
+    { 1002, 2 }, 
+    // stmt ::= KW13 expr
+    { 1002, 2 }, 
+    // stmt ::= KW14 expr
+    { 1002, 2 }, 
+    // stmt ::= KW15 expr
+    { 1002, 2 }, 
+    // stmt ::= KW16 expr
+    { 1002, 2 }, 
+    // stmt ::= KW17 expr
+    { 1002, 2 }, 
+    // stmt ::= KW18 expr
+    { 1002, 2 }, 
+    // stmt ::= KW19 expr
+    { 1002, 2 }, 
+    // stmt ::= KW20 expr
+    { 1002, 2 }, 
+    // stmt ::= KW21 expr
+    { 1002, 2 }, 
+    // stmt ::= KW22 expr
+    { 1002, 2 }, 
+    // stmt ::= KW23 expr
+    { 1002, 2 }, 
+    // stmt ::= KW24 expr
+    { 1002, 2 }, 
+    // stmt ::= KW25 expr
+    { 1002, 2 }, 
+    // stmt ::= KW26 expr
+    { 1002, 2 }, 
+    // stmt ::= KW27 expr
+    { 1002, 2 }, 
+    // stmt ::= KW28 expr
+    { 1002, 2 }, 
+    // stmt ::= KW29 expr
+    { 1002, 2 }, 
+    // stmt ::= KW30 expr
+    { 1002, 2 }, 
+    // stmt ::= KW31 expr
+    { 1002, 2 }, 
+    // stmt ::= KW32 expr
+    { 1002, 2 }, 
+    // stmt ::= KW33 expr
+    { 1002, 2 }, 
+    // stmt ::= KW34 expr
+    { 1002, 2 }, 
+    // stmt ::= KW35 expr
+    { 1002, 2 }, 
+    // stmt ::= KW36 expr
+    { 1002, 2 }, 
+    // stmt ::= KW37 expr
+    { 1002, 2 }, 
+    // stmt ::= KW38 expr
+    { 1002, 2 }, 
+    // stmt ::= KW39 expr
+    { 1002, 2 }, 
+    // stmt ::= KW40 expr
+    { 1002, 2 }, 
+    // stmt ::= KW41 expr
+    { 1002, 2 }, 
+    // stmt ::= KW42 expr
+    { 1002, 2 }, 
+    // stmt ::= KW43 expr
+    { 1002, 2 }, 
+    // stmt ::= KW44 expr
+    { 1002, 2 }, 
+    // stmt ::= KW45 expr
+    { 1002, 2 }, 
+    // stmt ::= KW46 expr
+    { 1002, 2 }, 
+    // stmt ::= KW47 expr
+    { 1002, 2 }, 
+    // stmt ::= KW48 expr
+    { 1002, 2 }, 
+    // stmt ::= KW49 expr
+    { 1002, 2 }, 
+    // stmt ::= KW50 expr
+    { 1002, 2 }, 
+    // stmt ::= KW51 expr
+    { 1002, 2 }, 
+    // stmt ::= KW52 expr
+    { 1002, 2 }, 
+    // stmt ::= KW53 expr
+    { 1002, 2 }, 
+    // stmt ::= KW54 expr
+    { 1002, 2 }, 
+    // stmt ::= KW55 expr
+    { 1002, 2 }, 
+    // stmt ::= KW56 expr
+    { 1002, 2 }, 
+    // stmt ::= KW57 expr
+    { 1002, 2 }, 
+    // stmt ::= KW58 expr
+    { 1002, 2 }, 
+    // stmt ::= KW59 expr
+    { 1002, 2 }, 
+    // stmt ::= KW60 expr
+    { 1002, 2 }, 
+    // stmt ::= KW61 expr
+    { 1002, 2 }, 
+    // stmt ::= KW62 expr
+    { 1002, 2 }, 
+    // stmt ::= KW63 expr
+    { 1002, 2 }, 
+    // stmt ::= KW64 expr
+    { 1002, 2 }, 
+    // stmt ::= KW65 expr
+    { 1002, 2 }, 
+    // stmt ::= KW66 expr
+    { 1002, 2 }, 
+    // stmt ::= KW67 expr
+    { 1002, 2 }, 
+    // stmt ::= KW68 expr
+    { 1002, 2 }, 
+    // stmt ::= KW69 expr
+    { 1002, 2 }, 
+    // stmt ::= KW70 expr
+    { 1002, 2 }, 
+    // stmt ::= KW71 expr
+    { 1002, 2 }, 
+    // stmt ::= KW72 expr
+    { 1002, 2 }, 
+    // stmt ::= KW73 expr
+    { 1002, 2 }, 
+    // stmt ::= KW74 expr
+    { 1002, 2 }, 
+    // stmt ::= KW75 expr
+    { 1002, 2 }, 
+    // stmt ::= KW76 expr
+    { 1002, 2 }, 
+    // stmt ::= KW77 expr
+    { 1002, 2 }, 
+    // stmt ::= KW78 expr
+    { 1002, 2 }, 
+    // stmt ::= KW79 expr
+    { 1002, 2 }, 
+    // stmt ::= KW80 expr
+    { 1002, 2 }, 
+    // stmt ::= KW81 expr
+    { 1002, 2 }, 
+    // stmt ::= KW82 expr
+    { 1002, 2 }, 
+    // stmt ::= KW83 expr
+    { 1002, 2 }, 
+    // stmt ::= KW84 expr
+    { 1002, 2 }, 
+    // stmt ::= KW85 expr
+    { 1002, 2 }, 
+    // stmt ::= KW86 expr
+    { 1002, 2 }, 
+    // stmt ::= KW87 expr
+    { 1002, 2 }, 
+    // stmt ::= KW88 expr
+    { 1002, 2 }, 
+    // stmt ::= KW89 expr
+    { 1002, 2 }, 
+    // stmt ::= KW90 expr
+    { 1002, 2 }, 
+    // stmt ::= KW91 expr
+    { 1002, 2 }, 
+    // stmt ::= KW92 expr
+    { 1002, 2 }, 
+    // stmt ::= KW93 expr
+    { 1002, 2 }, 
+    // stmt ::= KW94 expr
+    { 1002, 2 }, 
+    // stmt ::= KW95 expr
+    { 1002, 2 }, 
+    // stmt ::= KW96 expr
+    { 1002, 2 }, 
+    // stmt ::= KW97 expr
+    { 1002, 2 }, 
+    // stmt ::= KW98 expr
+    { 1002, 2 }, 
+    // stmt ::= KW99 expr
+    { 1002, 2 }, 
+    // stmt ::= KW100 expr
+    { 1002, 2 }, 
+    // stmt ::= KW101 expr
+    { 1002, 2 }, 
+    // stmt ::= KW102 expr
+    { 1002, 2 }, 
+    // stmt ::= KW103 expr
+    { 1002, 2 }, 
+    // stmt ::= KW104 expr
+    { 1002, 2 }, 
+    // stmt ::= KW105 expr
+    { 1002, 2 }, 
+    // stmt ::= KW106 expr
+    { 1002, 2 }, 
+    // stmt ::= KW107 expr
+    { 1002, 2 }, 
+    // stmt ::= KW108 expr
+    { 1002, 2 }, 
+    // stmt ::= KW109 expr
+    { 1002, 2 }, 
+    // stmt ::= KW110 expr
+    { 1002, 2 }, 
+    // stmt ::= KW111 expr
+    { 1002, 2 }, 
+    // stmt ::= KW112 expr
+    { 1002, 2 }, 
+    // stmt ::= KW113 expr
+    { 1002, 2 }, 
+    // stmt ::= KW114 expr
+    { 1002, 2 }, 
+    // stmt ::= KW115 expr
+    { 1002, 2 }, 
+    // stmt ::= KW116 expr
+    { 1002, 2 }, 
+    // stmt ::= KW117 expr
+    { 1002, 2 }, 
+    // stmt ::= KW118 expr
+    { 1002, 2 }, 
+    // stmt ::= KW119 expr
+    { 1002, 2 }, 
+    // stmt ::= KW120 expr
+    { 1002, 2 }, 
+    // stmt ::= KW121 expr
+    { 1002, 2 }, 
+    // stmt ::= KW122 expr
+    { 1002, 2 }, 
+    // stmt ::= KW123 expr
+    { 1002, 2 }, 
+    // stmt ::= KW124 expr
+    { 1002, 2 }, 
+    // stmt ::= KW125 expr
+    { 1002, 2 }, 
+    // stmt ::= KW126 expr
+    { 1002, 2 }, 
+    // stmt ::= KW127 expr
+    { 1002, 2 }, 
+    // stmt ::= KW128 expr
+    { 1002, 2 }, 
+    // stmt ::= KW129 expr
+    { 1002, 2 }, 
+    // stmt ::= KW130 expr
+    { 1002, 2 }, 
+    // stmt ::= KW131 expr
+    { 1002, 2 }, 
+    // stmt ::= KW132 expr
+    { 1002, 2 }, 
+    // stmt ::= KW133 expr
+    { 1002, 2 }, 
+    // stmt ::= KW134 expr
+    { 1002, 2 }, 
+    // stmt ::= KW135 expr
+    { 1002, 2 }, 
+    // stmt ::= KW136 expr
+    { 1002, 2 }, 
+    // stmt ::= KW137 expr
+    { 1002, 2 }, 
+    // stmt ::= KW138 expr
+    { 1002, 2 }, 
+    // stmt ::= KW139 expr
+    { 1002, 2 }, 
+    // stmt ::= KW140 expr
+    { 1002, 2 }, 
+    // stmt ::= KW141 expr
+    { 1002, 2 }, 
+    // stmt ::= KW142 expr
+    { 1002, 2 }, 
+    // stmt ::= KW143 expr
+    { 1002, 2 }, 
+    // stmt ::= KW144 expr
+    { 1002, 2 }, 
+    // stmt ::= KW145 expr
+    { 1002, 2 }, 
+    // stmt ::= KW146 expr
+    { 1002, 2 }, 
+    // stmt ::= KW147 expr
+    { 1002, 2 }, 
+    // stmt ::= KW148 expr
+    { 1002, 2 }, 
+    // stmt ::= KW149 expr
+    { 1002, 2 }, 
+    // stmt ::= KW150 expr
+    { 1002, 2 }, 
+    // stmt ::= KW151 expr
+    { 1002, 2 }, 
+    // stmt ::= KW152 expr
+    { 1002, 2 }, 
+    // stmt ::= KW153 expr
+    { 1002, 2 }, 
+    // stmt ::= KW154 expr
+    { 1002, 2 }, 
+    // stmt ::= KW155 expr
+    { 1002, 2 }, 
+    // stmt ::= KW156 expr
+    { 1002, 2 }, 
+    // stmt ::= KW157 expr
+    { 1002, 2 }, 
+    // stmt ::= KW158 expr
+    { 1002, 2 }, 
+    // stmt ::= KW159 expr
+    { 1002, 2 }, 
+    // stmt ::= KW160 expr
+    { 1002, 2 }, 
+    // stmt ::= KW161 expr
+    { 1002, 2 }, 
+    // stmt ::= KW162 expr
+    { 1002, 2 }, 
+    // stmt ::= KW163 expr
+    { 1002, 2 }, 
+    // stmt ::= KW164 expr
+    { 1002, 2 }, 
+    // stmt ::= KW165 expr
+    { 1002, 2 }, 
+    // stmt ::= KW166 expr
+    { 1002, 2 }, 
+    // stmt ::= KW167 expr
+    { 1002, 2 }, 
+    // stmt ::= KW168 expr
+    { 1002, 2 }, 
+    // stmt ::= KW169 expr
+    { 1002, 2 }, 
+    // stmt ::= KW170 expr
+    { 1002, 2 }, 
+    // stmt ::= KW171 expr
+    { 1002, 2 }, 
+    // stmt ::= KW172 expr
+    { 1002, 2 }, 
+    // stmt ::= KW173 expr
+    { 1002, 2 }, 
+    // stmt ::= KW174 expr
+    { 1002, 2 }, 
+    // stmt ::= KW175 expr
+    { 1002, 2 }, 
+    // stmt ::= KW176 expr
+    { 1002, 2 }, 
+    // stmt ::= KW177 expr
+    { 1002, 2 }, 
+    // stmt ::= KW178 expr
+    { 1002, 2 }, 
+    // stmt ::= KW179 expr
+    { 1002, 2 }, 
+    // stmt ::= KW180 expr
+    { 1002, 2 }, 
+    // stmt ::= KW181 expr
+    { 1002, 2 }, 
+    // stmt ::= KW182 expr
+    { 1002, 2 }, 
+    // stmt ::= KW183 expr
+    { 1002, 2 }, 
+    // stmt ::= KW184 expr
+    { 1002, 2 }, 
+    // stmt ::= KW185 expr
+    { 1002, 2 }, 
+    // stmt ::= KW186 expr
+    { 1002, 2 }, 
+    // stmt ::= KW187 expr
+    { 1002, 2 }, 
+    // stmt ::= KW188 expr
+    { 1002, 2 }, 
+    // stmt ::= KW189 expr
+    { 1002, 2 }, 
+    // stmt ::= KW190 expr
+    { 1002, 2 }, 
+    // stmt ::= KW191 expr
+    { 1002, 2 }, 
+    // stmt ::= KW192 expr
+    { 1002, 2 }, 
+    // stmt ::= KW193 expr
+    { 1002, 2 }, 
+    // stmt ::= KW194 expr
+    { 1002, 2 }, 
+    // stmt ::= KW195 expr
+    { 1002, 2 }, 
+    // stmt ::= KW196 expr
+    { 1002, 2 }, 
+    // stmt ::= KW197 expr
+    { 1002, 2 }, 
+    // stmt ::= KW198 expr
+    { 1002, 2 }, 
+    // stmt ::= KW199 expr
+    { 1002, 2 }, 
+    // stmt ::= KW200 expr
+    { 1002, 2 }, 
+    // stmt ::= KW201 expr
+    { 1002, 2 }, 
+    // stmt ::= KW202 expr
+    { 1002, 2 }, 
+    // stmt ::= KW203 expr
+    { 1002, 2 }, 
+    // stmt ::= KW204 expr
+    { 1002, 2 }, 
+    // stmt ::= KW205 expr
+    { 1002, 2 }, 
+    // stmt ::= KW206 expr
+    { 1002, 2 }, 
+    // stmt ::= KW207 expr
+    { 1002, 2 }, 
+    // stmt ::= KW208 expr
+    { 1002, 2 }, 
+    // stmt ::= KW209 expr
+    { 1002, 2 }, 
+    // stmt ::= KW210 expr
+    { 1002, 2 }, 
+    // stmt ::= KW211 expr
+    { 1002, 2 }, 
+    // stmt ::= KW212 expr
+    { 1002, 2 }, 
+    // stmt ::= KW213 expr
+    { 1002, 2 }, 
+    // stmt ::= KW214 expr
+    { 1002, 2 }, 
+    // stmt ::= KW215 expr
+    { 1002, 2 }, 
+    // stmt ::= KW216 expr
+    { 1002, 2 }, 
+    // stmt ::= KW217 expr
+    { 1002, 2 }, 
+    // stmt ::= KW218 expr
+    { 1002, 2 }, 
+    // stmt ::= KW219 expr
+    { 1002, 2 }, 
+    // stmt ::= KW220 expr
+    { 1002, 2 }, 
+    // stmt ::= KW221 expr
+    { 1002, 2 }, 
+    // stmt ::= KW222 expr
+    { 1002, 2 }, 
+    // stmt ::= KW223 expr
+    { 1002, 2 }, 
+    // stmt ::= KW224 expr
+    { 1002, 2 }, 
+    // stmt ::= KW225 expr
+    { 1002, 2 }, 
+    // stmt ::= KW226 expr
+    { 1002, 2 }, 
+    // stmt ::= KW227 expr
+    { 1002, 2 }, 
+    // stmt ::= KW228 expr
+    { 1002, 2 }, 
+    // stmt ::= KW229 expr
+    { 1002, 2 }, 
+    // stmt ::= KW230 expr
+    { 1002, 2 }, 
+    // stmt ::= KW231 expr
+    { 1002, 2 }, 
+    // stmt ::= KW232 expr
+    { 1002, 2 }, 
+    // stmt ::= KW233 expr
+    { 1002, 2 }, 
+    // stmt ::= KW234 expr
+    { 1002, 2 }, 
+    // stmt ::= KW235 expr
+    { 1002, 2 }, 
+    // stmt ::= KW236 expr
+    { 1002, 2 }, 
+    // stmt ::= KW237 expr
+    { 1002, 2 }, 
+    // stmt ::= KW238 expr
+    { 1002, 2 }, 
+    // stmt ::= KW239 expr
+    { 1002, 2 }, 
+    // stmt ::= KW240 expr
+    { 1002, 2 }, 
+    // stmt ::= KW241 expr
+    { 1002, 2 }, 
+    // stmt ::= KW242 expr
+    { 1002, 2 }, 
+    // stmt ::= KW243 expr
+    { 1002, 2 }, 
+    // stmt ::= KW244 expr
+    { 1002, 2 }, 
+    // stmt ::= KW245 expr
+    { 1002, 2 }, 
+    // stmt ::= KW246 expr
+    { 1002, 2 }, 
+    // stmt ::= KW247 expr
+    { 1002, 2 }, 
+    // stmt ::= KW248 expr
+    { 1002, 2 }, 
+    // stmt ::= KW249 expr
+    { 1002, 2 }, 
+    // stmt ::= KW250 expr
+    { 1002, 2 }, 
+    // stmt ::= KW251 expr
+    { 1002, 2 }, 
+    // stmt ::= KW252 expr
+    { 1002, 2 }, 
+    // stmt ::= KW253 expr
+    { 1002, 2 }, 
+    // stmt ::= KW254 expr
+    { 1002, 2 }, 
+    // stmt ::= KW255 expr
+    { 1002, 2 }, 
+    // stmt ::= KW256 expr
+    { 1002, 2 }, 
+    // stmt ::= KW257 expr
+    { 1002, 2 }, 
+    // stmt ::= KW258 expr
+    { 1002, 2 }, 
+    // stmt ::= KW259 expr
+    { 1002, 2 }, 
+    // stmt ::= KW260 expr
+    { 1002, 2 }, 
+    // stmt ::= KW261 expr
+    { 1002, 2 }, 
+    // stmt ::= KW262 expr
+    { 1002, 2 }, 
+    // stmt ::= KW263 expr
+    { 1002, 2 }, 
+    // stmt ::= KW264 expr
+    { 1002, 2 }, 
+    // stmt ::= KW265 expr
+    { 1002, 2 }, 
+    // stmt ::= KW266 expr
+    { 1002, 2 }, 
+    // stmt ::= KW267 expr
+    { 1002, 2 }, 
+    // stmt ::= KW268 expr
+    { 1002, 2 }, 
+    // stmt ::= KW269 expr
+    { 1002, 2 }, 
+    // stmt ::= KW270 expr
+    { 1002, 2 }, 
+    // stmt ::= KW271 expr
+    { 1002, 2 }, 
+    // stmt ::= KW272 expr
+    { 1002, 2 }, 
+    // stmt ::= KW273 expr
+    { 1002, 2 }, 
+    // stmt ::= KW274 expr
+    { 1002, 2 }, 
+    // stmt ::= KW275 expr
+    { 1002, 2 }, 
+    // stmt ::= KW276 expr
+    { 1002, 2 }, 
+    // stmt ::= KW277 expr
+    { 1002, 2 }, 
+    // stmt ::= KW278 expr
+    { 1002, 2 }, 
+    // stmt ::= KW279 expr
+    { 1002, 2 }, 
+    // stmt ::= KW280 expr
+    { 1002, 2 }, 
+    // stmt ::= KW281 expr
+    { 1002, 2 }, 
+    // stmt ::= KW282 expr
+    { 1002, 2 }, 
+    // stmt ::= KW283 expr
+    { 1002, 2 }, 
+    // stmt ::= KW284 expr
+    { 1002, 2 }, 
+    // stmt ::= KW285 expr
+    { 1002, 2 }, 
+    // stmt ::= KW286 expr
+    { 1002, 2 }, 
+    // stmt ::= KW287 expr
+    { 1002, 2 }, 
+    // stmt ::= KW288 expr
+    { 1002, 2 }, 
+    // stmt ::= KW289 expr
+    { 1002, 2 }, 
+    // stmt ::= KW290 expr
+    { 1002, 2 }, 
+    // stmt ::= KW291 expr
+    { 1002, 2 }, 
+    // stmt ::= KW292 expr
+    { 1002, 2 }, 
+    // stmt ::= KW293 expr
+    { 1002, 2 }, 
+    // stmt ::= KW294 expr
+    { 1002, 2 }, 
+    // stmt ::= KW295 expr
+    { 1002, 2 }, 
+    // stmt ::= KW296 expr
+    { 1002, 2 }, 
+    // stmt ::= KW297 expr
+    { 1002, 2 }, 
+    // stmt ::= KW298 expr
+    { 1002, 2 }, 
+    // stmt ::= KW299 expr
+    { 1002, 2 }, 
+    // stmt ::= KW300 expr
+    { 1002, 2 }, 
+    // stmt ::= KW301 expr
+    { 1002, 2 }, 
+    // stmt ::= KW302 expr
+    { 1002, 2 }, 
+    // stmt ::= KW303 expr
+    { 1002, 2 }, 
+    // stmt ::= KW304 expr
+    { 1002, 2 }, 
+    // stmt ::= KW305 expr
+    { 1002, 2 }, 
+    // stmt ::= KW306 expr
+    { 1002, 2 }, 
+    // stmt ::= KW307 expr
+    { 1002, 2 }, 
+    // stmt ::= KW308 expr
+    { 1002, 2 }, 
+    // stmt ::= KW309 expr
+    { 1002, 2 }, 
+    // stmt ::= KW310 expr
+    { 1002, 2 }, 
+    // stmt ::= KW311 expr
+    { 1002, 2 }, 
+    // stmt ::= KW312 expr
+    { 1002, 2 }, 
+    // stmt ::= KW313 expr
+    { 1002, 2 }, 
+    // stmt ::= KW314 expr
+    { 1002, 2 }, 
+    // stmt ::= KW315 expr
+    { 1002, 2 }, 
+    // stmt ::= KW316 expr
+    { 1002, 2 }, 
+    // stmt ::= KW317 expr
+    { 1002, 2 }, 
+    // stmt ::= KW318 expr
+    { 1002, 2 }, 
+    // stmt ::= KW319 expr
+    { 1002, 2 }, 
+    // stmt ::= KW320 expr
+    { 1002, 2 }, 
+    // stmt ::= KW321 expr
+    { 1002, 2 }, 
+    // stmt ::= KW322 expr
+    { 1002, 2 }, 
+    // stmt ::= KW323 expr
+    { 1002, 2 }, 
+    // stmt ::= KW324 expr
+    { 1002, 2 }, 
+    // stmt ::= KW325 expr
+    { 1002, 2 }, 
+    // stmt ::= KW326 expr
+    { 1002, 2 }, 
+    // stmt ::= KW327 expr
+    { 1002, 2 }, 
+    // stmt ::= KW328 expr
+    { 1002, 2 }, 
+    // stmt ::= KW329 expr
+    { 1002, 2 }, 
+    // stmt ::= KW330 expr
+    { 1002, 2 }, 
+    // stmt ::= KW331 expr
+    { 1002, 2 }, 
+    // stmt ::= KW332 expr
+    { 1002, 2 }, 
+    // stmt ::= KW333 expr
+    { 1002, 2 }, 
+    // stmt ::= KW334 expr
+    { 1002, 2 }, 
+    // stmt ::= KW335 expr
+    { 1002, 2 }, 
+    // stmt ::= KW336 expr
+    { 1002, 2 }, 
+    // stmt ::= KW337 expr
+    { 1002, 2 }, 
+    // stmt ::= KW338 expr
+    { 1002, 2 }, 
+    // stmt ::= KW339 expr
+    { 1002, 2 }, 
+    // stmt ::= KW340 expr
+    { 1002, 2 }, 
+    // stmt ::= KW341 expr
+    { 1002, 2 }, 
+    // stmt ::= KW342 expr
+    { 1002, 2 }, 
+    // stmt ::= KW343 expr
+    { 1002, 2 }, 
+    // stmt ::= KW344 expr
+    { 1002, 2 }, 
+    // stmt ::= KW345 expr
+    { 1002, 2 }, 
+    // stmt ::= KW346 expr
+    { 1002, 2 }, 
+    // stmt ::= KW347 expr
+    { 1002, 2 }, 
+    // stmt ::= KW348 expr
+    { 1002, 2 }, 
+    // stmt ::= KW349 expr
+    { 1002, 2 }, 
+    // stmt ::= KW350 expr
+    { 1002, 2 }, 
+    // stmt ::= KW351 expr
+    { 1002, 2 }, 
+    // stmt ::= KW352 expr
+    { 1002, 2 }, 
+    // stmt ::= KW353 expr
+    { 1002, 2 }, 
+    // stmt ::= KW354 expr
+    { 1002, 2 }, 
+    // stmt ::= KW355 expr
+    { 1002, 2 }, 
+    // stmt ::= KW356 expr
+    { 1002, 2 }, 
+    // stmt ::= KW357 expr
+    { 1002, 2 }, 
+    // stmt ::= KW358 expr
+    { 1002, 2 }, 
+    // stmt ::= KW359 expr
+    { 1002, 2 }, 
+    // stmt ::= KW360 expr
+    { 1002, 2 }, 
+    // stmt ::= KW361 expr
+    { 1002, 2 }, 
+    // stmt ::= KW362 expr
+    { 1002, 2 }, 
+    // stmt ::= KW363 expr
+    { 1002, 2 }, 
+    // stmt ::= KW364 expr
+    { 1002, 2 }, 
+    // stmt ::= KW365 expr
+    { 1002, 2 }, 
+    // stmt ::= KW366 expr
+    { 1002, 2 }, 
+    // stmt ::= KW367 expr
+    { 1002, 2 }, 
+    // stmt ::= KW368 expr
+    { 1002, 2 }, 
+    // stmt ::= KW369 expr
+    { 1002, 2 }, 
+    // stmt ::= KW370 expr
+    { 1002, 2 }, 
+    // stmt ::= KW371 expr
+    { 1002, 2 }, 
+    // stmt ::= KW372 expr
+    { 1002, 2 }, 
+    // stmt ::= KW373 expr
+    { 1002, 2 }, 
+    // stmt ::= KW374 expr
+    { 1002, 2 }, 
+    // stmt ::= KW375 expr
+    { 1002, 2 }, 
+    // stmt ::= KW376 expr
+    { 1002, 2 }, 
+    // stmt ::= KW377 expr
+    { 1002, 2 }, 
+    // stmt ::= KW378 expr
+    { 1002, 2 }, 
+    // stmt ::= KW379 expr
+    { 1002, 2 }, 
+    // stmt ::= KW380 expr
+    { 1002, 2 }, 
+    // stmt ::= KW381 expr
+    { 1002, 2 }, 
+    // stmt ::= KW382 expr
+    { 1002, 2 }, 
+    // stmt ::= KW383 expr
+    { 1002, 2 }, 
+    // stmt ::= KW384 expr
+    { 1002, 2 }, 
+    // stmt ::= KW385 expr
+    { 1002, 2 }, 
+    // stmt ::= KW386 expr
+    { 1002, 2 }, 
+    // stmt ::= KW387 expr
+    { 1002, 2 }, 
+    // stmt ::= KW388 expr
+    { 1002, 2 }, 
+    // stmt ::= KW389 expr
+    { 1002, 2 }, 
+    // stmt ::= KW390 expr
+    { 1002, 2 }, 
+    // stmt ::= KW391 expr
+    { 1002, 2 }, 
+    // stmt ::= KW392 expr
+    { 1002, 2 }, 
+    // stmt ::= KW393 expr
+    { 1002, 2 }, 
+    // stmt ::= KW394 expr
+    { 1002, 2 }, 
+    // stmt ::= KW395 expr
+    { 1002, 2 }, 
+    // stmt ::= KW396 expr
+    { 1002, 2 }, 
+    // stmt ::= KW397 expr
+    { 1002, 2 }, 
+    // stmt ::= KW398 expr
+    { 1002, 2 }, 
+    // stmt ::= KW399 expr
+    { 1002, 2 }, 
+    // stmt ::= KW400 expr
+    { 1002, 2 }, 
+    // stmt ::= KW401 expr
+    { 1002, 2 }, 
+    // stmt ::= KW402 expr
+    { 1002, 2 }, 
+    // stmt ::= KW403 expr
+    { 1002, 2 }, 
+    // stmt ::= KW404 expr
+    { 1002, 2 }, 
+    // stmt ::= KW405 expr
+    { 1002, 2 }, 
+    // stmt ::= KW406 expr
+    { 1002, 2 }, 
+    // stmt ::= KW407 expr
+    { 1002, 2 }, 
+    // stmt ::= KW408 expr
+    { 1002, 2 }, 
+    // stmt ::= KW409 expr
+    { 1002, 2 }, 
+    // stmt ::= KW410 expr
+    { 1002, 2 }, 
+    // stmt ::= KW411 expr
+    { 1002, 2 }, 
+    // stmt ::= KW412 expr
+    { 1002, 2 }, 
+    // stmt ::= KW413 expr
+    { 1002, 2 }, 
+    // stmt ::= KW414 expr
+    { 1002, 2 }, 
+    // stmt ::= KW415 expr
+    { 1002, 2 }, 
+    // stmt ::= KW416 expr
+    { 1002, 2 }, 
+    // stmt ::= KW417 expr
+    { 1002, 2 }, 
+    // stmt ::= KW418 expr
+    { 1002, 2 }, 
+    // stmt ::= KW419 expr
+    { 1002, 2 }, 
+    // stmt ::= KW420 expr
+    { 1002, 2 }, 
+    // stmt ::= KW421 expr
+    { 1002, 2 }, 
+    // stmt ::= KW422 expr
+    { 1002, 2 }, 
+    // stmt ::= KW423 expr
+    { 1002, 2 }, 
+    // stmt ::= KW424 expr
+    { 1002, 2 }, 
+    // stmt ::= KW425 expr
+    { 1002, 2 }, 
+    // stmt ::= KW426 expr
+    { 1002, 2 }, 
+    // stmt ::= KW427 expr
+    { 1002, 2 }, 
+    // stmt ::= KW428 expr
+    { 1002, 2 }, 
+    // stmt ::= KW429 expr
+    { 1002, 2 }, 
+    // stmt ::= KW430 expr
+    { 1002, 2 }, 
+    // stmt ::= KW431 expr
+    { 1002, 2 }, 
+    // stmt ::= KW432 expr
+    { 1002, 2 }, 
+    // stmt ::= KW433 expr
+    { 1002, 2 }, 
+    // stmt ::= KW434 expr
+    { 1002, 2 }, 
+    // stmt ::= KW435 expr
+    { 1002, 2 }, 
+    // stmt ::= KW436 expr
+    { 1002, 2 }, 
+    // stmt ::= KW437 expr
+    { 1002, 2 }, 
+    // stmt ::= KW438 expr
+    { 1002, 2 }, 
+    // stmt ::= KW439 expr
+    { 1002, 2 }, 
+    // stmt ::= KW440 expr
+    { 1002, 2 }, 
+    // stmt ::= KW441 expr
+    { 1002, 2 }, 
+    // stmt ::= KW442 expr
+    { 1002, 2 }, 
+    // stmt ::= KW443 expr
+    { 1002, 2 }, 
+    // stmt ::= KW444 expr
+    { 1002, 2 }, 
+    // stmt ::= KW445 expr
+    { 1002, 2 }, 
+    // stmt ::= KW446 expr
+    { 1002, 2 }, 
+    // stmt ::= KW447 expr
+    { 1002, 2 }, 
+    // stmt ::= KW448 expr
+    { 1002, 2 }, 
+    // stmt ::= KW449 expr
+    { 1002, 2 }, 
+    // stmt ::= KW450 expr
+    { 1002, 2 }, 
+    // stmt ::= KW451 expr
+    { 1002, 2 }, 
+    // stmt ::= KW452 expr
+    { 1002, 2 }, 
+    // stmt ::= KW453 expr
+    { 1002, 2 }, 
+    // stmt ::= KW454 expr
+    { 1002, 2 }, 
+    // stmt ::= KW455 expr
+    { 1002, 2 }, 
+    // stmt ::= KW456 expr
+    { 1002, 2 }, 
+    // stmt ::= KW457 expr
+    { 1002, 2 }, 
+    // stmt ::= KW458 expr
+    { 1002, 2 }, 
+    // stmt ::= KW459 expr
+    { 1002, 2 }, 
+    // stmt ::= KW460 expr
+    { 1002, 2 }, 
+    // stmt ::= KW461 expr
+    { 1002, 2 }, 
+    // stmt ::= KW462 expr
+    { 1002, 2 }, 
+    // stmt ::= KW463 expr
+    { 1002, 2 }, 
+    // stmt ::= KW464 expr
+    { 1002, 2 }, 
+    // stmt ::= KW465 expr
+    { 1002, 2 }, 
+    // stmt ::= KW466 expr
+    { 1002, 2 }, 
+    // stmt ::= KW467 expr
+    { 1002, 2 }, 
+    // stmt ::= KW468 expr
+    { 1002, 2 }, 
+    // stmt ::= KW469 expr
+    { 1002, 2 }, 
+    // stmt ::= KW470 expr
+    { 1002, 2 }, 
+    // stmt ::= KW471 expr
+    { 1002, 2 }, 
+    // stmt ::= KW472 expr
+    { 1002, 2 }, 
+    // stmt ::= KW473 expr
+    { 1002, 2 }, 
+    // stmt ::= KW474 expr
+    { 1002, 2 }, 
+    // stmt ::= KW475 expr
+    { 1002, 2 }, 
+    // stmt ::= KW476 expr
+    { 1002, 2 }, 
+    // stmt ::= KW477 expr
+    { 1002, 2 }, 
+    // stmt ::= KW478 expr
+    { 1002, 2 }, 
+    // stmt ::= KW479 expr
+    { 1002, 2 }, 
+    // stmt ::= KW480 expr
+    { 1002, 2 }, 
+    // stmt ::= KW481 expr
+    { 1002, 2 }, 
+    // stmt ::= KW482 expr
+    { 1002, 2 }, 
+    // stmt ::= KW483 expr
+    { 1002, 2 }, 
+    // stmt ::= KW484 expr
+    { 1002, 2 }, 
+    // stmt ::= KW485 expr
+    { 1002, 2 }, 
+    // stmt ::= KW486 expr
+    { 1002, 2 }, 
+    // stmt ::= KW487 expr
+    { 1002, 2 }, 
+    // stmt ::= KW488 expr
+    { 1002, 2 }, 
+    // stmt ::= KW489 expr
+    { 1002, 2 }, 
+    // stmt ::= KW490 expr
+    { 1002, 2 }, 
+    // stmt ::= KW491 expr
+    { 1002, 2 }, 
+    // stmt ::= KW492 expr
+    { 1002, 2 }, 
+    // stmt ::= KW493 expr
+    { 1002, 2 }, 
+    // stmt ::= KW494 expr
+    { 1002, 2 }, 
+    // stmt ::= KW495 expr
+    { 1002, 2 }, 
+    // stmt ::= KW496 expr
+    { 1002, 2 }, 
+    // stmt ::= KW497 expr
+    { 1002, 2 }, 
+    // stmt ::= KW498 expr
+    { 1002, 2 }, 
+    // stmt ::= KW499 expr
+    { 1002, 2 }, 
+    // stmt ::= KW500 expr
+    { 1002, 2 }, 
+    // stmt ::= KW501 expr
+    { 1002, 2 }, 
+    // stmt ::= KW502 expr
+    { 1002, 2 }, 
+    // stmt ::= KW503 expr
+    { 1002, 2 }, 
+    // stmt ::= KW504 expr
+    { 1002, 2 }, 
+    // stmt ::= KW505 expr
+    { 1002, 2 }, 
+    // stmt ::= KW506 expr
+    { 1002, 2 }, 
+    // stmt ::= KW507 expr
+    { 1002, 2 }, 
+    // stmt ::= KW508 expr
+    { 1002, 2 }, 
+    // stmt ::= KW509 expr
+    { 1002, 2 }, 
+    // stmt ::= KW510 expr
+    { 1002, 2 }, 
+    // stmt ::= KW511 expr
+    { 1002, 2 }, 
+    // stmt ::= KW512 expr
+    { 1002, 2 }, 
+    // stmt ::= KW513 expr
+    { 1002, 2 }, 
+    // stmt ::= KW514 expr
+    { 1002, 2 }, 
+    // stmt ::= KW515 expr
+    { 1002, 2 }, 
+    // stmt ::= KW516 expr
+    { 1002, 2 }, 
+    // stmt ::= KW517 expr
+    { 1002, 2 }, 
+    // stmt ::= KW518 expr
+    { 1002, 2 }, 
+    // stmt ::= KW519 expr
+    { 1002, 2 }, 
+    // stmt ::= KW520 expr
+    { 1002, 2 }, 
+    // stmt ::= KW521 expr
+    { 1002, 2 }, 
+    // stmt ::= KW522 expr
+    { 1002, 2 }, 
+    // stmt ::= KW523 expr
+    { 1002, 2 }, 
+    // stmt ::= KW524 expr
+    { 1002, 2 }, 
+    // stmt ::= KW525 expr
+    { 1002, 2 }, 
+    // stmt ::= KW526 expr
+    { 1002, 2 }, 
+    // stmt ::= KW527 expr
+    { 1002, 2 }, 
+    // stmt ::= KW528 expr
+    { 1002, 2 }, 
+    // stmt ::= KW529 expr
+    { 1002, 2 }, 
+    // stmt ::= KW530 expr
+    { 1002, 2 }, 
+    // stmt ::= KW531 expr
+    { 1002, 2 }, 
+    // stmt ::= KW532 expr
+    { 1002, 2 }, 
+    // stmt ::= KW533 expr
+    { 1002, 2 }, 
+    // stmt ::= KW534 expr
+    { 1002, 2 }, 
+    // stmt ::= KW535 expr
+    { 1002, 2 }, 
+    // stmt ::= KW536 expr
+    { 1002, 2 }, 
+    // stmt ::= KW537 expr
+    { 1002, 2 }, 
+    // stmt ::= KW538 expr
+    { 1002, 2 }, 
+    // stmt ::= KW539 expr
+    { 1002, 2 }, 
+    // stmt ::= KW540 expr
+    { 1002, 2 }, 
+    // stmt ::= KW541 expr
+    { 1002, 2 }, 
+    // stmt ::= KW542 expr
+    { 1002, 2 }, 
+    // stmt ::= KW543 expr
+    { 1002, 2 }, 
+    // stmt ::= KW544 expr
+    { 1002, 2 }, 
+    // stmt ::= KW545 expr
+    { 1002, 2 }, 
+    // stmt ::= KW546 expr
+    { 1002, 2 }, 
+    // stmt ::= KW547 expr
+    { 1002, 2 }, 
+    // stmt ::= KW548 expr
+    { 1002, 2 }, 
+    // stmt ::= KW549 expr
+    { 1002, 2 }, 
+    // stmt ::= KW550 expr
+    { 1002, 2 }, 
+    // stmt ::= KW551 expr
+    { 1002, 2 }, 
+    // stmt ::= KW552 expr
+    { 1002, 2 }, 
+    // stmt ::= KW553 expr
+    { 1002, 2 }, 
+    // stmt ::= KW554 expr
+    { 1002, 2 }, 
+    // stmt ::= KW555 expr
+    { 1002, 2 }, 
+    // stmt ::= KW556 expr
+    { 1002, 2 }, 
+    // stmt ::= KW557 expr
+    { 1002, 2 }, 
+    // stmt ::= KW558 expr
+    { 1002, 2 }, 
+    // stmt ::= KW559 expr
+    { 1002, 2 }, 
+    // stmt ::= KW560 expr
+    { 1002, 2 }, 
+    // stmt ::= KW561 expr
+    { 1002, 2 }, 
+    // stmt ::= KW562 expr
+    { 1002, 2 }, 
+    // stmt ::= KW563 expr
+    { 1002, 2 }, 
+    // stmt ::= KW564 expr
+    { 1002, 2 }, 
+    // stmt ::= KW565 expr
+    { 1002, 2 }, 
+    // stmt ::= KW566 expr
+    { 1002, 2 }, 
+    // stmt ::= KW567 expr
+    { 1002, 2 }, 
+    // stmt ::= KW568 expr
+    { 1002, 2 }, 
+    // stmt ::= KW569 expr
+    { 1002, 2 }, 
+    // stmt ::= KW570 expr
+    { 1002, 2 }, 
+    // stmt ::= KW571 expr
+    { 1002, 2 }, 
+    // stmt ::= KW572 expr
+    { 1002, 2 }, 
+    // stmt ::= KW573 expr
+    { 1002, 2 }, 
+    // stmt ::= KW574 expr
+    { 1002, 2 }, 
+    // stmt ::= KW575 expr
+    { 1002, 2 }, 
+    // stmt ::= KW576 expr
+    { 1002, 2 }, 
+    // stmt ::= KW577 expr
+    { 1002, 2 }, 
+    // stmt ::= KW578 expr
+    { 1002, 2 }, 
+    // stmt ::= KW579 expr
+    { 1002, 2 }, 
+    // stmt ::= KW580 expr
+    { 1002, 2 }, 
+    // stmt ::= KW581 expr
+    { 1002, 2 }, 
+    // stmt ::= KW582 expr
+    { 1002, 2 }, 
+    // stmt ::= KW583 expr
+    { 1002, 2 }, 
+    // stmt ::= KW584 expr
+    { 1002, 2 }, 
+    // stmt ::= KW585 expr
+    { 1002, 2 }, 
+    // stmt ::= KW586 expr
+    { 1002, 2 }, 
+    // stmt ::= KW587 expr
+    { 1002, 2 }, 
+    // stmt ::= KW588 expr
+    { 1002, 2 }, 
+    // stmt ::= KW589 expr
+    { 1002, 2 }, 
+    // stmt ::= KW590 expr
+    { 1002, 2 }, 
+    // stmt ::= KW591 expr
+    { 1002, 2 }, 
+    // stmt ::= KW592 expr
+    { 1002, 2 }, 
+    // stmt ::= KW593 expr
+    { 1002, 2 }, 
+    // stmt ::= KW594 expr
+    { 1002, 2 }, 
+    // stmt ::= KW595 expr
+    { 1002, 2 }, 
+    // stmt ::= KW596 expr
+    { 1002, 2 }, 
+    // stmt ::= KW597 expr
+    { 1002, 2 }, 
+    // stmt ::= KW598 expr
+    { 1002, 2 }, 
+    // stmt ::= KW599 expr
+    { 1002, 2 }, 
+    // stmt ::= KW600 expr
+    { 1002, 2 }, 
+    // stmt ::= KW601 expr
+    { 1002, 2 }, 
+    // stmt ::= KW602 expr
+    { 1002, 2 }, 
+    // stmt ::= KW603 expr
+    { 1002, 2 }, 
+    // stmt ::= KW604 expr
+    { 1002, 2 }, 
+    // stmt ::= KW605 expr
+    { 1002, 2 }, 
+    // stmt ::= KW606 expr
+    { 1002, 2 }, 
+    // stmt ::= KW607 expr
+    { 1002, 2 }, 
+    // stmt ::= KW608 expr
+    { 1002, 2 }, 
+    // stmt ::= KW609 expr
+    { 1002, 2 }, 
+    // stmt ::= KW610 expr
+    { 1002, 2 }, 
+    // stmt ::= KW611 expr
+    { 1002, 2 }, 
+    // stmt ::= KW612 expr
+    { 1002, 2 }, 
+    // stmt ::= KW613 expr
+    { 1002, 2 }, 
+    // stmt ::= KW614 expr
+    { 1002, 2 }, 
+    // stmt ::= KW615 expr
+    { 1002, 2 }, 
+    // stmt ::= KW616 expr
+    { 1002, 2 }, 
+    // stmt ::= KW617 expr
+    { 1002, 2 }, 
+    // stmt ::= KW618 expr
+    { 1002, 2 }, 
+    // stmt ::= KW619 expr
+    { 1002, 2 }, 
+    // stmt ::= KW620 expr
+    { 1002, 2 }, 
+    // stmt ::= KW621 expr
+    { 1002, 2 }, 
+    // stmt ::= KW622 expr
+    { 1002, 2 }, 
+    // stmt ::= KW623 expr
+    { 1002, 2 }, 
+    // stmt ::= KW624 expr
+    { 1002, 2 }, 
+    // stmt ::= KW625 expr
+    { 1002, 2 }, 
+    // stmt ::= KW626 expr
+    { 1002, 2 }, 
+    // stmt ::= KW627 expr
+    { 1002, 2 }, 
+    // stmt ::= KW628 expr
+    { 1002, 2 }, 
+    // stmt ::= KW629 expr
+    { 1002, 2 }, 
+    // stmt ::= KW630 expr
+    { 1002, 2 }, 
+    // stmt ::= KW631 expr
+    { 1002, 2 }, 
+    // stmt ::= KW632 expr
+    { 1002, 2 }, 
+    // stmt ::= KW633 expr
+    { 1002, 2 }, 
+    // stmt ::= KW634 expr
+    { 1002, 2 }, 
+    // stmt ::= KW635 expr
+    { 1002, 2 }, 
+    // stmt ::= KW636 expr
+    { 1002, 2 }, 
+    // stmt ::= KW637 expr
+    { 1002, 2 }, 
+    // stmt ::= KW638 expr
+    { 1002, 2 }, 
+    // stmt ::= KW639 expr
+    { 1002, 2 }, 
+    // stmt ::= KW640 expr
+    { 1002, 2 }, 
+    // stmt ::= KW641 expr
+    { 1002, 2 }, 
+    // stmt ::= KW642 expr
+    { 1002, 2 }, 
+    // stmt ::= KW643 expr
+    { 1002, 2 }, 
+    // stmt ::= KW644 expr
+    { 1002, 2 }, 
+    // stmt ::= KW645 expr
+    { 1002, 2 }, 
+    // stmt ::= KW646 expr
+    { 1002, 2 }, 
+    // stmt ::= KW647 expr
+    { 1002, 2 }, 
+    // stmt ::= KW648 expr
+    { 1002, 2 }, 
+    // stmt ::= KW649 expr
+    { 1002, 2 }, 
+    // stmt ::= KW650 expr
+    { 1002, 2 }, 
+    // stmt ::= KW651 expr
+    { 1002, 2 }, 
+    // stmt ::= KW652 expr
+    { 1002, 2 }, 
+    // stmt ::= KW653 expr
+    { 1002, 2 }, 
+    // stmt ::= KW654 expr
+    { 1002, 2 }, 
+    // stmt ::= KW655 expr
+    { 1002, 2 }, 
+    // stmt ::= KW656 expr
+    { 1002, 2 }, 
+    // stmt ::= KW657 expr
+    { 1002, 2 }, 
+    // stmt ::= KW658 expr
+    { 1002, 2 }, 
+    // stmt ::= KW659 expr
+    { 1002, 2 }, 
+    // stmt ::= KW660 expr
+    { 1002, 2 }, 
+    // stmt ::= KW661 expr
+    { 1002, 2 }, 
+    // stmt ::= KW662 expr
+    { 1002, 2 }, 
+    // stmt ::= KW663 expr
+    { 1002, 2 }, 
+    // stmt ::= KW664 expr
+    { 1002, 2 }, 
+    // stmt ::= KW665 expr
+    { 1002, 2 }, 
+    // stmt ::= KW666 expr
+    { 1002, 2 }, 
+    // stmt ::= KW667 expr
+    { 1002, 2 }, 
+    // stmt ::= KW668 expr
+    { 1002, 2 }, 
+    // stmt ::= KW669 expr
+    { 1002, 2 }, 
+    // stmt ::= KW670 expr
+    { 1002, 2 }, 
+    // stmt ::= KW671 expr
+    { 1002, 2 }, 
+    // stmt ::= KW672 expr
+    { 1002, 2 }, 
+    // stmt ::= KW673 expr
+    { 1002, 2 }, 
+    // stmt ::= KW674 expr
+    { 1002, 2 }, 
+    // stmt ::= KW675 expr
+    { 1002, 2 }, 
+    // stmt ::= KW676 expr
+    { 1002, 2 }, 
+    // stmt ::= KW677 expr
+    { 1002, 2 }, 
+    // stmt ::= KW678 expr
+    { 1002, 2 }, 
+    // stmt ::= KW679 expr
+    { 1002, 2 }, 
+    // stmt ::= KW680 expr
+    { 1002, 2 }, 
+    // stmt ::= KW681 expr
+    { 1002, 2 }, 
+    // stmt ::= KW682 expr
+    { 1002, 2 }, 
+    // stmt ::= KW683 expr
+    { 1002, 2 }, 
+    // stmt ::= KW684 expr
+    { 1002, 2 }, 
+    // stmt ::= KW685 expr
+    { 1002, 2 }, 
+    // stmt ::= KW686 expr
+    { 1002, 2 }, 
+    // stmt ::= KW687 expr
+    { 1002, 2 }, 
+    // stmt ::= KW688 expr
+    { 1002, 2 }, 
+    // stmt ::= KW689 expr
+    { 1002, 2 }, 
+    // stmt ::= KW690 expr
+    { 1002, 2 }, 
+    // stmt ::= KW691 expr
+    { 1002, 2 }, 
+    // stmt ::= KW692 expr
+    { 1002, 2 }, 
+    // stmt ::= KW693 expr
+    { 1002, 2 }, 
+    // stmt ::= KW694 expr
+    { 1002, 2 }, 
+    // stmt ::= KW695 expr
+    { 1002, 2 }, 
+    // stmt ::= KW696 expr
+    { 1002, 2 }, 
+    // stmt ::= KW697 expr
+    { 1002, 2 }, 
+    // stmt ::= KW698 expr
+    { 1002, 2 }, 
+    // stmt ::= KW699 expr
+    { 1002, 2 }, 
+    // stmt ::= KW700 expr
+    { 1002, 2 }, 
+    // stmt ::= KW701 expr
+    { 1002, 2 }, 
+    // stmt ::= KW702 expr
+    { 1002, 2 }, 
+    // stmt ::= KW703 expr
+    { 1002, 2 }, 
+    // stmt ::= KW704 expr
+    { 1002, 2 }, 
+    // stmt ::= KW705 expr
+    { 1002, 2 }, 
+    // stmt ::= KW706 expr
+    { 1002, 2 }, 
+    // stmt ::= KW707 expr
+    { 1002, 2 }, 
+    // stmt ::= KW708 expr
+    { 1002, 2 }, 
+    // stmt ::= KW709 expr
+    { 1002, 2 }, 
+    // stmt ::= KW710 expr
+    { 1002, 2 }, 
+    // stmt ::= KW711 expr
+    { 1002, 2 }, 
+    // stmt ::= KW712 expr
+    { 1002, 2 }, 
+    // stmt ::= KW713 expr
+    { 1002, 2 }, 
+    // stmt ::= KW714 expr
+    { 1002, 2 }, 
+    // stmt ::= KW715 expr
+    { 1002, 2 }, 
+    // stmt ::= KW716 expr
+    { 1002, 2 }, 
+    // stmt ::= KW717 expr
+    { 1002, 2 }, 
+    // stmt ::= KW718 expr
+    { 1002, 2 }, 
+    // stmt ::= KW719 expr
+    { 1002, 2 }, 
+    // stmt ::= KW720 expr
+    { 1002, 2 }, 
+    // stmt ::= KW721 expr
+    { 1002, 2 }, 
+    // stmt ::= KW722 expr
+    { 1002, 2 }, 
+    // stmt ::= KW723 expr
+    { 1002, 2 }, 
+    // stmt ::= KW724 expr
+    { 1002, 2 }, 
+    // stmt ::= KW725 expr
+    { 1002, 2 }, 
+    // stmt ::= KW726 expr
+    { 1002, 2 }, 
+    // stmt ::= KW727 expr
+    { 1002, 2 }, 
+    // stmt ::= KW728 expr
+    { 1002, 2 }, 
+    // stmt ::= KW729 expr
+    { 1002, 2 }, 
+    // stmt ::= KW730 expr
+    { 1002, 2 }, 
+    // stmt ::= KW731 expr
+    { 1002, 2 }, 
+    // stmt ::= KW732 expr
+    { 1002, 2 }, 
+    // stmt ::= KW733 expr
+    { 1002, 2 }, 
+    // stmt ::= KW734 expr
+    { 1002, 2 }, 
+    // stmt ::= KW735 expr
+    { 1002, 2 }, 
+    // stmt ::= KW736 expr
+    { 1002, 2 }, 
+    // stmt ::= KW737 expr
+    { 1002, 2 }, 
+    // stmt ::= KW738 expr
+    { 1002, 2 }, 
+    // stmt ::= KW739 expr
+    { 1002, 2 }, 
+    // stmt ::= KW740 expr
+    { 1002, 2 }, 
+    // stmt ::= KW741 expr
+    { 1002, 2 }, 
+    // stmt ::= KW742 expr
+    { 1002, 2 }, 
+    // stmt ::= KW743 expr
+    { 1002, 2 }, 
+    // stmt ::= KW744 expr
+    { 1002, 2 }, 
+    // stmt ::= KW745 expr
+    { 1002, 2 }, 
+    // stmt ::= KW746 expr
+    { 1002, 2 }, 
+    // stmt ::= KW747 expr
+    { 1002, 2 }, 
+    // stmt ::= KW748 expr
+    { 1002, 2 }, 
+    // stmt ::= KW749 expr
+    { 1002, 2 }, 
+    // stmt ::= KW750 expr
+    { 1002, 2 }, 
+    // stmt ::= KW751 expr
+    { 1002, 2 }, 
+    // stmt ::= KW752 expr
+    { 1002, 2 }, 
+    // stmt ::= KW753 expr
+    { 1002, 2 }, 
+    // stmt ::= KW754 expr
+    { 1002, 2 }, 
+    // stmt ::= KW755 expr
+    { 1002, 2 }, 
+    // stmt ::= KW756 expr
+    { 1002, 2 }, 
+    // stmt ::= KW757 expr
+    { 1002, 2 }, 
+    // stmt ::= KW758 expr
+    { 1002, 2 }, 
+    // stmt ::= KW759 expr
+    { 1002, 2 }, 
+    // stmt ::= KW760 expr
+    { 1002, 2 }, 
+    // stmt ::= KW761 expr
+    { 1002, 2 }, 
+    // stmt ::= KW762 expr
+    { 1002, 2 }, 
+    // stmt ::= KW763 expr
+    { 1002, 2 }, 
+    // stmt ::= KW764 expr
+    { 1002, 2 }, 
+    // stmt ::= KW765 expr
+    { 1002, 2 }, 
+    // stmt ::= KW766 expr
+    { 1002, 2 }, 
+    // stmt ::= KW767 expr
+    { 1002, 2 }, 
+    // stmt ::= KW768 expr
+    { 1002, 2 }, 
+    // stmt ::= KW769 expr
+    { 1002, 2 }, 
+    // stmt ::= KW770 expr
+    { 1002, 2 }, 
+    // stmt ::= KW771 expr
+    { 1002, 2 }, 
+    // stmt ::= KW772 expr
+    { 1002, 2 }, 
+    // stmt ::= KW773 expr
+    { 1002, 2 }, 
+    // stmt ::= KW774 expr
+    { 1002, 2 }, 
+    // stmt ::= KW775 expr
+    { 1002, 2 }, 
+    // stmt ::= KW776 expr
+    { 1002, 2 }, 
+    // stmt ::= KW777 expr
+    { 1002, 2 }, 
+    // stmt ::= KW778 expr
+    { 1002, 2 }, 
+    // stmt ::= KW779 expr
+    { 1002, 2 }, 
+    // stmt ::= KW780 expr
+    { 1002, 2 }, 
+    // stmt ::= KW781 expr
+    { 1002, 2 }, 
+    // stmt ::= KW782 expr
+    { 1002, 2 }, 
+    // stmt ::= KW783 expr
+    { 1002, 2 }, 
+    // stmt ::= KW784 expr
+    { 1002, 2 }, 
+    // stmt ::= KW785 expr
+    { 1002, 2 }, 
+    // stmt ::= KW786 expr
+    { 1002, 2 }, 
+    // stmt ::= KW787 expr
+    { 1002, 2 }, 
+    // stmt ::= KW788 expr
+    { 1002, 2 }, 
+    // stmt ::= KW789 expr
+    { 1002, 2 }, 
+    // stmt ::= KW790 expr
+    { 1002, 2 }, 
+    // stmt ::= KW791 expr
+    { 1002, 2 }, 
+    // stmt ::= KW792 expr
+    { 1002, 2 }, 
+    // stmt ::= KW793 expr
+    { 1002, 2 }, 
+    // stmt ::= KW794 expr
+    { 1002, 2 }, 
+    // stmt ::= KW795 expr
+    { 1002, 2 }, 
+    // stmt ::= KW796 expr
+    { 1002, 2 }, 
+    // stmt ::= KW797 expr
+    { 1002, 2 }, 
+    // stmt ::= KW798 expr
+    { 1002, 2 }, 
+    // stmt ::= KW799 expr
+    { 1002, 2 }, 
+    // stmt ::= KW800 expr
+    { 1002, 2 }, 
+    // stmt ::= KW801 expr
+    { 1002, 2 }, 
+    // stmt ::= KW802 expr
+    { 1002, 2 }, 
+    // stmt ::= KW803 expr
+    { 1002, 2 }, 
+    // stmt ::= KW804 expr
+    { 1002, 2 }, 
+    // stmt ::= KW805 expr
+    { 1002, 2 }, 
+    // stmt ::= KW806 expr
+    { 1002, 2 }, 
+    // stmt ::= KW807 expr
+    { 1002, 2 }, 
+    // stmt ::= KW808 expr
+    { 1002, 2 }, 
+    // stmt ::= KW809 expr
+    { 1002, 2 }, 
+    // stmt ::= KW810 expr
+    { 1002, 2 }, 
+    // stmt ::= KW811 expr
+    { 1002, 2 }, 
+    // stmt ::= KW812 expr
+    { 1002, 2 }, 
+    // stmt ::= KW813 expr
+    { 1002, 2 }, 
+    // stmt ::= KW814 expr
+    { 1002, 2 }, 
+    // stmt ::= KW815 expr
+    { 1002, 2 }, 
+    // stmt ::= KW816 expr
+    { 1002, 2 }, 
+    // stmt ::= KW817 expr
+    { 1002, 2 }, 
+    // stmt ::= KW818 expr
+    { 1002, 2 }, 
+    // stmt ::= KW819 expr
+    { 1002, 2 }, 
+    // stmt ::= KW820 expr
+    { 1002, 2 }, 
+    // stmt ::= KW821 expr
+    { 1002, 2 }, 
+    // stmt ::= KW822 expr
+    { 1002, 2 }, 
+    // stmt ::= KW823 expr
+    { 1002, 2 }, 
+    // stmt ::= KW824 expr
+    { 1002, 2 }, 
+    // stmt ::= KW825 expr
+    { 1002, 2 }, 
+    // stmt ::= KW826 expr
+    { 1002, 2 }, 
+    // stmt ::= KW827 expr
+    { 1002, 2 }, 
+    // stmt ::= KW828 expr
+    { 1002, 2 }, 
+    // stmt ::= KW829 expr
+    { 1002, 2 }, 
+    // stmt ::= KW830 expr
+    { 1002, 2 }, 
+    // stmt ::= KW831 expr
+    { 1002, 2 }, 
+    // stmt ::= KW832 expr
+    { 1002, 2 }, 
+    // stmt ::= KW833 expr
+    { 1002, 2 }, 
+    // stmt ::= KW834 expr
+    { 1002, 2 }, 
+    // stmt ::= KW835 expr
+    { 1002, 2 }, 
+    // stmt ::= KW836 expr
+    { 1002, 2 }, 
+    // stmt ::= KW837 expr
+    { 1002, 2 }, 
+    // stmt ::= KW838 expr
+    { 1002, 2 }, 
+    // stmt ::= KW839 expr
+    { 1002, 2 }, 
+    // stmt ::= KW840 expr
+    { 1002, 2 }, 
+    // stmt ::= KW841 expr
+    { 1002, 2 }, 
+    // stmt ::= KW842 expr
+    { 1002, 2 }, 
+    // stmt ::= KW843 expr
+    { 1002, 2 }, 
+    // stmt ::= KW844 expr
+    { 1002, 2 }, 
+    // stmt ::= KW845 expr
+    { 1002, 2 }, 
+    // stmt ::= KW846 expr
+    { 1002, 2 }, 
+    // stmt ::= KW847 expr
+    { 1002, 2 }, 
+    // stmt ::= KW848 expr
+    { 1002, 2 }, 
+    // stmt ::= KW849 expr
+    { 1002, 2 }, 
+    // stmt ::= KW850 expr
+    { 1002, 2 }, 
+    // stmt ::= KW851 expr
+    { 1002, 2 }, 
+    // stmt ::= KW852 expr
+    { 1002, 2 }, 
+    // stmt ::= KW853 expr
+    { 1002, 2 }, 
+    // stmt ::= KW854 expr
+    { 1002, 2 }, 
+    // stmt ::= KW855 expr
+    { 1002, 2 }, 
+    // stmt ::= KW856 expr
+    { 1002, 2 }, 
+    // stmt ::= KW857 expr
+    { 1002, 2 }, 
+    // stmt ::= KW858 expr
+    { 1002, 2 }, 
+    // stmt ::= KW859 expr
+    { 1002, 2 }, 
+    // stmt ::= KW860 expr
+    { 1002, 2 }, 
+    // stmt ::= KW861 expr
+    { 1002, 2 }, 
+    // stmt ::= KW862 expr
+    { 1002, 2 }, 
+    // stmt ::= KW863 expr
+    { 1002, 2 }, 
+    // stmt ::= KW864 expr
+    { 1002, 2 }, 
+    // stmt ::= KW865 expr
+    { 1002, 2 }, 
+    // stmt ::= KW866 expr
+    { 1002, 2 }, 
+    // stmt ::= KW867 expr
+    { 1002, 2 }, 
+    // stmt ::= KW868 expr
+    { 1002, 2 }, 
+    // stmt ::= KW869 expr
+    { 1002, 2 }, 
+    // stmt ::= KW870 expr
+    { 1002, 2 }, 
+    // stmt ::= KW871 expr
+    { 1002, 2 }, 
+    // stmt ::= KW872 expr
+    { 1002, 2 }, 
+    // stmt ::= KW873 expr
+    { 1002, 2 }, 
+    // stmt ::= KW874 expr
+    { 1002, 2 }, 
+    // stmt ::= KW875 expr
+    { 1002, 2 }, 
+    // stmt ::= KW876 expr
+    { 1002, 2 }, 
+    // stmt ::= KW877 expr
+    { 1002, 2 }, 
+    // stmt ::= KW878 expr
+    { 1002, 2 }, 
+    // stmt ::= KW879 expr
+    { 1002, 2 }, 
+    // stmt ::= KW880 expr
+    { 1002, 2 }, 
+    // stmt ::= KW881 expr
+    { 1002, 2 }, 
+    // stmt ::= KW882 expr
+    { 1002, 2 }, 
+    // stmt ::= KW883 expr
+    { 1002, 2 }, 
+    // stmt ::= KW884 expr
+    { 1002, 2 }, 
+    // stmt ::= KW885 expr
+    { 1002, 2 }, 
+    // stmt ::= KW886 expr
+    { 1002, 2 }, 
+    // stmt ::= KW887 expr
+    { 1002, 2 }, 
+    // stmt ::= KW888 expr
+    { 1002, 2 }, 
+    // stmt ::= KW889 expr
+    { 1002, 2 }, 
+    // stmt ::= KW890 expr
+    { 1002, 2 }, 
+    // stmt ::= KW891 expr
+    { 1002, 2 }, 
+    // stmt ::= KW892 expr
+    { 1002, 2 }, 
+    // stmt ::= KW893 expr
+    { 1002, 2 }, 
+    // stmt ::= KW894 expr
+    { 1002, 2 }, 
+    // stmt ::= KW895 expr
+    { 1002, 2 }, 
+    // stmt ::= KW896 expr
+    { 1002, 2 }, 
+    // stmt ::= KW897 expr
+    { 1002, 2 }, 
+    // stmt ::= KW898 expr
+    { 1002, 2 }, 
+    // stmt ::= KW899 expr
+    { 1002, 2 }, 
+    // stmt ::= KW900 expr
+    { 1002, 2 }, 
+    // stmt ::= KW901 expr
+    { 1002, 2 }, 
+    // stmt ::= KW902 expr
+    { 1002, 2 }, 
+    // stmt ::= KW903 expr
+    { 1002, 2 }, 
+    // stmt ::= KW904 expr
+    { 1002, 2 }, 
+    // stmt ::= KW905 expr
+    { 1002, 2 }, 
+    // stmt ::= KW906 expr
+    { 1002, 2 }, 
+    // stmt ::= KW907 expr
+    { 1002, 2 }, 
+    // stmt ::= KW908 expr
+    { 1002, 2 }, 
+    // stmt ::= KW909 expr
+    { 1002, 2 }, 
+    // stmt ::= KW910 expr
+    { 1002, 2 }, 
+    // stmt ::= KW911 expr
+    { 1002, 2 }, 
+    // stmt ::= KW912 expr
+    { 1002, 2 }, 
+    // stmt ::= KW913 expr
+    { 1002, 2 }, 
+    // stmt ::= KW914 expr
+    { 1002, 2 }, 
+    // stmt ::= KW915 expr
+    { 1002, 2 }, 
+    // stmt ::= KW916 expr
+    { 1002, 2 }, 
+    // stmt ::= KW917 expr
+    { 1002, 2 }, 
+    // stmt ::= KW918 expr
+    { 1002, 2 }, 
+    // stmt ::= KW919 expr
+    { 1002, 2 }, 
+    // stmt ::= KW920 expr
+    { 1002, 2 }, 
+    // stmt ::= KW921 expr
+    { 1002, 2 }, 
+    // stmt ::= KW922 expr
+    { 1002, 2 }, 
+    // stmt ::= KW923 expr
+    { 1002, 2 }, 
+    // stmt ::= KW924 expr
+    { 1002, 2 }, 
+    // stmt ::= KW925 expr
+    { 1002, 2 }, 
+    // stmt ::= KW926 expr
+    { 1002, 2 }, 
+    // stmt ::= KW927 expr
+    { 1002, 2 }, 
+    // stmt ::= KW928 expr
+    { 1002, 2 }, 
+    // stmt ::= KW929 expr
+    { 1002, 2 }, 
+    // stmt ::= KW930 expr
+    { 1002, 2 }, 
+    // stmt ::= KW931 expr
+    { 1002, 2 }, 
+    // stmt ::= KW932 expr
+    { 1002, 2 }, 
+    // stmt ::= KW933 expr
+    { 1002, 2 }, 
+    // stmt ::= KW934 expr
+    { 1002, 2 }, 
+    // stmt ::= KW935 expr
+    { 1002, 2 }, 
+    // stmt ::= KW936 expr
+    { 1002, 2 }, 
+    // stmt ::= KW937 expr
+    { 1002, 2 }, 
+    // stmt ::= KW938 expr
+    { 1002, 2 }, 
+    // stmt ::= KW939 expr
+    { 1002, 2 }, 
+    // stmt ::= KW940 expr
+    { 1002, 2 }, 
+    // stmt ::= KW941 expr
+    { 1002, 2 }, 
+    // stmt ::= KW942 expr
+    { 1002, 2 }, 
+    // stmt ::= KW943 expr
+    { 1002, 2 }, 
+    // stmt ::= KW944 expr
+    { 1002, 2 }, 
+    // stmt ::= KW945 expr
+    { 1002, 2 }, 
+    // stmt ::= KW946 expr
+    { 1002, 2 }, 
+    // stmt ::= KW947 expr
+    { 1002, 2 }, 
+    // stmt ::= KW948 expr
+    { 1002, 2 }, 
+    // stmt ::= KW949 expr
+    { 1002, 2 }, 
+    // stmt ::= KW950 expr
+    { 1002, 2 }, 
+    // stmt ::= KW951 expr
+    { 1002, 2 }, 
+    // stmt ::= KW952 expr
+    { 1002, 2 }, 
+    // stmt ::= KW953 expr
+    { 1002, 2 }, 
+    // stmt ::= KW954 expr
+    { 1002, 2 }, 
+    // stmt ::= KW955 expr
+    { 1002, 2 }, 
+    // stmt ::= KW956 expr
+    { 1002, 2 }, 
+    // stmt ::= KW957 expr
+    { 1002, 2 }, 
+    // stmt ::= KW958 expr
+    { 1002, 2 }, 
+    // stmt ::= KW959 expr
+    { 1002, 2 }, 
+    // stmt ::= KW960 expr
+    { 1002, 2 }, 
+    // stmt ::= KW961 expr
+    { 1002, 2 }, 
+    // stmt ::= KW962 expr
+    { 1002, 2 }, 
+    // stmt ::= KW963 expr
+    { 1002, 2 }, 
+    // stmt ::= KW964 expr
+    { 1002, 2 }, 
+    // stmt ::= KW965 expr
+    { 1002, 2 }, 
+    // stmt ::= KW966 expr
+    { 1002, 2 }, 
+    // stmt ::= KW967 expr
+    { 1002, 2 }, 
+    // stmt ::= KW968 expr
+    { 1002, 2 }, 
+    // stmt ::= KW969 expr
+    { 1002, 2 }, 
+    // stmt ::= KW970 expr
+    { 1002, 2 }, 
+    // stmt ::= KW971 expr
+    { 1002, 2 }, 
+    // stmt ::= KW972 expr
+    { 1002, 2 }, 
+    // stmt ::= KW973 expr
+    { 1002, 2 }, 
+    // stmt ::= KW974 expr
+    { 1002, 2 }, 
+    // stmt ::= KW975 expr
+    { 1002, 2 }, 
+    // stmt ::= KW976 expr
+    { 1002, 2 }, 
+    // stmt ::= KW977 expr
+    { 1002, 2 }, 
+    // stmt ::= KW978 expr
+    { 1002, 2 }, 
+    // stmt ::= KW979 expr
+    { 1002, 2 }, 
+    // stmt ::= KW980 expr
+    { 1002, 2 }, 
+    // stmt ::= KW981 expr
+    { 1002, 2 }, 
+    // stmt ::= KW982 expr
+    { 1002, 2 }, 
+    // stmt ::= KW983 expr
+    { 1002, 2 }, 
+    // stmt ::= KW984 expr
+    { 1002, 2 }, 
+    // stmt ::= KW985 expr
+    { 1002, 2 }, 
+    // stmt ::= KW986 expr
+    { 1002, 2 }, 
+    // stmt ::= KW987 expr
+    { 1002, 2 }, 
+    // stmt ::= KW988 expr
+    { 1002, 2 }, 
+    // stmt ::= KW989 expr
+    { 1002, 2 }, 
+    // stmt ::= KW990 expr
+    { 1002, 2 }, 
+    // stmt ::= KW991 expr
+    { 1002, 2 }, 
+};
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::initTables( void )
+{
+    myStates.assign( 1996, ActionMap() );
+    myStateDefaultActions.assign( 1996, ActionEntry(PA_ERROR,-2) );
+    for ( int i = 0; i < 7966; ++i )
+    {
+        if ( theStateTable[i][1] == -1 )
+            myStateDefaultActions[theStateTable[i][0]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+        else
+            myStates[theStateTable[i][0]][theStateTable[i][1]] = ActionEntry((ParserAct)theStateTable[i][2], theStateTable[i][3]);
+    }
+
+
+    // Rule Table
+
+    myRules.reserve( 1000 );
+    for ( int i = 0; i < 1000; ++i )
+        myRules.push_back( RuleInfo( theRuleTable[i][0], theRuleTable[i][1] ) );
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::syntaxError( Bench::Terminal tok, privBenchImpl::Value &data )
+{
+}
+
+
+////////////////////////////////////////
+
+
+void privBenchImpl::parseFailed( void )
+{
+}
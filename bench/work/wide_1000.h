@@ -0,0 +1,1032 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        ID = 1,
+        KW0 = 2,
+        KW1 = 3,
+        KW10 = 4,
+        KW100 = 5,
+        KW101 = 6,
+        KW102 = 7,
+        KW103 = 8,
+        KW104 = 9,
+        KW105 = 10,
+        KW106 = 11,
+        KW107 = 12,
+        KW108 = 13,
+        KW109 = 14,
+        KW11 = 15,
+        KW110 = 16,
+        KW111 = 17,
+        KW112 = 18,
+        KW113 = 19,
+        KW114 = 20,
+        KW115 = 21,
+        KW116 = 22,
+        KW117 = 23,
+        KW118 = 24,
+        KW119 = 25,
+        KW12 = 26,
+        KW120 = 27,
+        KW121 = 28,
+        KW122 = 29,
+        KW123 = 30,
+        KW124 = 31,
+        KW125 = 32,
+        KW126 = 33,
+        KW127 = 34,
+        KW128 = 35,
+        KW129 = 36,
+        KW13 = 37,
+        KW130 = 38,
+        KW131 = 39,
+        KW132 = 40,
+        KW133 = 41,
+        KW134 = 42,
+        KW135 = 43,
+        KW136 = 44,
+        KW137 = 45,
+        KW138 = 46,
+        KW139 = 47,
+        KW14 = 48,
+        KW140 = 49,
+        KW141 = 50,
+        KW142 = 51,
+        KW143 = 52,
+        KW144 = 53,
+        KW145 = 54,
+        KW146 = 55,
+        KW147 = 56,
+        KW148 = 57,
+        KW149 = 58,
+        KW15 = 59,
+        KW150 = 60,
+        KW151 = 61,
+        KW152 = 62,
+        KW153 = 63,
+        KW154 = 64,
+        KW155 = 65,
+        KW156 = 66,
+        KW157 = 67,
+        KW158 = 68,
+        KW159 = 69,
+        KW16 = 70,
+        KW160 = 71,
+        KW161 = 72,
+        KW162 = 73,
+        KW163 = 74,
+        KW164 = 75,
+        KW165 = 76,
+        KW166 = 77,
+        KW167 = 78,
+        KW168 = 79,
+        KW169 = 80,
+        KW17 = 81,
+        KW170 = 82,
+        KW171 = 83,
+        KW172 = 84,
+        KW173 = 85,
+        KW174 = 86,
+        KW175 = 87,
+        KW176 = 88,
+        KW177 = 89,
+        KW178 = 90,
+        KW179 = 91,
+        KW18 = 92,
+        KW180 = 93,
+        KW181 = 94,
+        KW182 = 95,
+        KW183 = 96,
+        KW184 = 97,
+        KW185 = 98,
+        KW186 = 99,
+        KW187 = 100,
+        KW188 = 101,
+        KW189 = 102,
+        KW19 = 103,
+        KW190 = 104,
+        KW191 = 105,
+        KW192 = 106,
+        KW193 = 107,
+        KW194 = 108,
+        KW195 = 109,
+        KW196 = 110,
+        KW197 = 111,
+        KW198 = 112,
+        KW199 = 113,
+        KW2 = 114,
+        KW20 = 115,
+        KW200 = 116,
+        KW201 = 117,
+        KW202 = 118,
+        KW203 = 119,
+        KW204 = 120,
+        KW205 = 121,
+        KW206 = 122,
+        KW207 = 123,
+        KW208 = 124,
+        KW209 = 125,
+        KW21 = 126,
+        KW210 = 127,
+        KW211 = 128,
+        KW212 = 129,
+        KW213 = 130,
+        KW214 = 131,
+        KW215 = 132,
+        KW216 = 133,
+        KW217 = 134,
+        KW218 = 135,
+        KW219 = 136,
+        KW22 = 137,
+        KW220 = 138,
+        KW221 = 139,
+        KW222 = 140,
+        KW223 = 141,
+        KW224 = 142,
+        KW225 = 143,
+        KW226 = 144,
+        KW227 = 145,
+        KW228 = 146,
+        KW229 = 147,
+        KW23 = 148,
+        KW230 = 149,
+        KW231 = 150,
+        KW232 = 151,
+        KW233 = 152,
+        KW234 = 153,
+        KW235 = 154,
+        KW236 = 155,
+        KW237 = 156,
+        KW238 = 157,
+        KW239 = 158,
+        KW24 = 159,
+        KW240 = 160,
+        KW241 = 161,
+        KW242 = 162,
+        KW243 = 163,
+        KW244 = 164,
+        KW245 = 165,
+        KW246 = 166,
+        KW247 = 167,
+        KW248 = 168,
+        KW249 = 169,
+        KW25 = 170,
+        KW250 = 171,
+        KW251 = 172,
+        KW252 = 173,
+        KW253 = 174,
+        KW254 = 175,
+        KW255 = 176,
+        KW256 = 177,
+        KW257 = 178,
+        KW258 = 179,
+        KW259 = 180,
+        KW26 = 181,
+        KW260 = 182,
+        KW261 = 183,
+        KW262 = 184,
+        KW263 = 185,
+        KW264 = 186,
+        KW265 = 187,
+        KW266 = 188,
+        KW267 = 189,
+        KW268 = 190,
+        KW269 = 191,
+        KW27 = 192,
+        KW270 = 193,
+        KW271 = 194,
+        KW272 = 195,
+        KW273 = 196,
+        KW274 = 197,
+        KW275 = 198,
+        KW276 = 199,
+        KW277 = 200,
+        KW278 = 201,
+        KW279 = 202,
+        KW28 = 203,
+        KW280 = 204,
+        KW281 = 205,
+        KW282 = 206,
+        KW283 = 207,
+        KW284 = 208,
+        KW285 = 209,
+        KW286 = 210,
+        KW287 = 211,
+        KW288 = 212,
+        KW289 = 213,
+        KW29 = 214,
+        KW290 = 215,
+        KW291 = 216,
+        KW292 = 217,
+        KW293 = 218,
+        KW294 = 219,
+        KW295 = 220,
+        KW296 = 221,
+        KW297 = 222,
+        KW298 = 223,
+        KW299 = 224,
+        KW3 = 225,
+        KW30 = 226,
+        KW300 = 227,
+        KW301 = 228,
+        KW302 = 229,
+        KW303 = 230,
+        KW304 = 231,
+        KW305 = 232,
+        KW306 = 233,
+        KW307 = 234,
+        KW308 = 235,
+        KW309 = 236,
+        KW31 = 237,
+        KW310 = 238,
+        KW311 = 239,
+        KW312 = 240,
+        KW313 = 241,
+        KW314 = 242,
+        KW315 = 243,
+        KW316 = 244,
+        KW317 = 245,
+        KW318 = 246,
+        KW319 = 247,
+        KW32 = 248,
+        KW320 = 249,
+        KW321 = 250,
+        KW322 = 251,
+        KW323 = 252,
+        KW324 = 253,
+        KW325 = 254,
+        KW326 = 255,
+        KW327 = 256,
+        KW328 = 257,
+        KW329 = 258,
+        KW33 = 259,
+        KW330 = 260,
+        KW331 = 261,
+        KW332 = 262,
+        KW333 = 263,
+        KW334 = 264,
+        KW335 = 265,
+        KW336 = 266,
+        KW337 = 267,
+        KW338 = 268,
+        KW339 = 269,
+        KW34 = 270,
+        KW340 = 271,
+        KW341 = 272,
+        KW342 = 273,
+        KW343 = 274,
+        KW344 = 275,
+        KW345 = 276,
+        KW346 = 277,
+        KW347 = 278,
+        KW348 = 279,
+        KW349 = 280,
+        KW35 = 281,
+        KW350 = 282,
+        KW351 = 283,
+        KW352 = 284,
+        KW353 = 285,
+        KW354 = 286,
+        KW355 = 287,
+        KW356 = 288,
+        KW357 = 289,
+        KW358 = 290,
+        KW359 = 291,
+        KW36 = 292,
+        KW360 = 293,
+        KW361 = 294,
+        KW362 = 295,
+        KW363 = 296,
+        KW364 = 297,
+        KW365 = 298,
+        KW366 = 299,
+        KW367 = 300,
+        KW368 = 301,
+        KW369 = 302,
+        KW37 = 303,
+        KW370 = 304,
+        KW371 = 305,
+        KW372 = 306,
+        KW373 = 307,
+        KW374 = 308,
+        KW375 = 309,
+        KW376 = 310,
+        KW377 = 311,
+        KW378 = 312,
+        KW379 = 313,
+        KW38 = 314,
+        KW380 = 315,
+        KW381 = 316,
+        KW382 = 317,
+        KW383 = 318,
+        KW384 = 319,
+        KW385 = 320,
+        KW386 = 321,
+        KW387 = 322,
+        KW388 = 323,
+        KW389 = 324,
+        KW39 = 325,
+        KW390 = 326,
+        KW391 = 327,
+        KW392 = 328,
+        KW393 = 329,
+        KW394 = 330,
+        KW395 = 331,
+        KW396 = 332,
+        KW397 = 333,
+        KW398 = 334,
+        KW399 = 335,
+        KW4 = 336,
+        KW40 = 337,
+        KW400 = 338,
+        KW401 = 339,
+        KW402 = 340,
+        KW403 = 341,
+        KW404 = 342,
+        KW405 = 343,
+        KW406 = 344,
+        KW407 = 345,
+        KW408 = 346,
+        KW409 = 347,
+        KW41 = 348,
+        KW410 = 349,
+        KW411 = 350,
+        KW412 = 351,
+        KW413 = 352,
+        KW414 = 353,
+        KW415 = 354,
+        KW416 = 355,
+        KW417 = 356,
+        KW418 = 357,
+        KW419 = 358,
+        KW42 = 359,
+        KW420 = 360,
+        KW421 = 361,
+        KW422 = 362,
+        KW423 = 363,
+        KW424 = 364,
+        KW425 = 365,
+        KW426 = 366,
+        KW427 = 367,
+        KW428 = 368,
+        KW429 = 369,
+        KW43 = 370,
+        KW430 = 371,
+        KW431 = 372,
+        KW432 = 373,
+        KW433 = 374,
+        KW434 = 375,
+        KW435 = 376,
+        KW436 = 377,
+        KW437 = 378,
+        KW438 = 379,
+        KW439 = 380,
+        KW44 = 381,
+        KW440 = 382,
+        KW441 = 383,
+        KW442 = 384,
+        KW443 = 385,
+        KW444 = 386,
+        KW445 = 387,
+        KW446 = 388,
+        KW447 = 389,
+        KW448 = 390,
+        KW449 = 391,
+        KW45 = 392,
+        KW450 = 393,
+        KW451 = 394,
+        KW452 = 395,
+        KW453 = 396,
+        KW454 = 397,
+        KW455 = 398,
+        KW456 = 399,
+        KW457 = 400,
+        KW458 = 401,
+        KW459 = 402,
+        KW46 = 403,
+        KW460 = 404,
+        KW461 = 405,
+        KW462 = 406,
+        KW463 = 407,
+        KW464 = 408,
+        KW465 = 409,
+        KW466 = 410,
+        KW467 = 411,
+        KW468 = 412,
+        KW469 = 413,
+        KW47 = 414,
+        KW470 = 415,
+        KW471 = 416,
+        KW472 = 417,
+        KW473 = 418,
+        KW474 = 419,
+        KW475 = 420,
+        KW476 = 421,
+        KW477 = 422,
+        KW478 = 423,
+        KW479 = 424,
+        KW48 = 425,
+        KW480 = 426,
+        KW481 = 427,
+        KW482 = 428,
+        KW483 = 429,
+        KW484 = 430,
+        KW485 = 431,
+        KW486 = 432,
+        KW487 = 433,
+        KW488 = 434,
+        KW489 = 435,
+        KW49 = 436,
+        KW490 = 437,
+        KW491 = 438,
+        KW492 = 439,
+        KW493 = 440,
+        KW494 = 441,
+        KW495 = 442,
+        KW496 = 443,
+        KW497 = 444,
+        KW498 = 445,
+        KW499 = 446,
+        KW5 = 447,
+        KW50 = 448,
+        KW500 = 449,
+        KW501 = 450,
+        KW502 = 451,
+        KW503 = 452,
+        KW504 = 453,
+        KW505 = 454,
+        KW506 = 455,
+        KW507 = 456,
+        KW508 = 457,
+        KW509 = 458,
+        KW51 = 459,
+        KW510 = 460,
+        KW511 = 461,
+        KW512 = 462,
+        KW513 = 463,
+        KW514 = 464,
+        KW515 = 465,
+        KW516 = 466,
+        KW517 = 467,
+        KW518 = 468,
+        KW519 = 469,
+        KW52 = 470,
+        KW520 = 471,
+        KW521 = 472,
+        KW522 = 473,
+        KW523 = 474,
+        KW524 = 475,
+        KW525 = 476,
+        KW526 = 477,
+        KW527 = 478,
+        KW528 = 479,
+        KW529 = 480,
+        KW53 = 481,
+        KW530 = 482,
+        KW531 = 483,
+        KW532 = 484,
+        KW533 = 485,
+        KW534 = 486,
+        KW535 = 487,
+        KW536 = 488,
+        KW537 = 489,
+        KW538 = 490,
+        KW539 = 491,
+        KW54 = 492,
+        KW540 = 493,
+        KW541 = 494,
+        KW542 = 495,
+        KW543 = 496,
+        KW544 = 497,
+        KW545 = 498,
+        KW546 = 499,
+        KW547 = 500,
+        KW548 = 501,
+        KW549 = 502,
+        KW55 = 503,
+        KW550 = 504,
+        KW551 = 505,
+        KW552 = 506,
+        KW553 = 507,
+        KW554 = 508,
+        KW555 = 509,
+        KW556 = 510,
+        KW557 = 511,
+        KW558 = 512,
+        KW559 = 513,
+        KW56 = 514,
+        KW560 = 515,
+        KW561 = 516,
+        KW562 = 517,
+        KW563 = 518,
+        KW564 = 519,
+        KW565 = 520,
+        KW566 = 521,
+        KW567 = 522,
+        KW568 = 523,
+        KW569 = 524,
+        KW57 = 525,
+        KW570 = 526,
+        KW571 = 527,
+        KW572 = 528,
+        KW573 = 529,
+        KW574 = 530,
+        KW575 = 531,
+        KW576 = 532,
+        KW577 = 533,
+        KW578 = 534,
+        KW579 = 535,
+        KW58 = 536,
+        KW580 = 537,
+        KW581 = 538,
+        KW582 = 539,
+        KW583 = 540,
+        KW584 = 541,
+        KW585 = 542,
+        KW586 = 543,
+        KW587 = 544,
+        KW588 = 545,
+        KW589 = 546,
+        KW59 = 547,
+        KW590 = 548,
+        KW591 = 549,
+        KW592 = 550,
+        KW593 = 551,
+        KW594 = 552,
+        KW595 = 553,
+        KW596 = 554,
+        KW597 = 555,
+        KW598 = 556,
+        KW599 = 557,
+        KW6 = 558,
+        KW60 = 559,
+        KW600 = 560,
+        KW601 = 561,
+        KW602 = 562,
+        KW603 = 563,
+        KW604 = 564,
+        KW605 = 565,
+        KW606 = 566,
+        KW607 = 567,
+        KW608 = 568,
+        KW609 = 569,
+        KW61 = 570,
+        KW610 = 571,
+        KW611 = 572,
+        KW612 = 573,
+        KW613 = 574,
+        KW614 = 575,
+        KW615 = 576,
+        KW616 = 577,
+        KW617 = 578,
+        KW618 = 579,
+        KW619 = 580,
+        KW62 = 581,
+        KW620 = 582,
+        KW621 = 583,
+        KW622 = 584,
+        KW623 = 585,
+        KW624 = 586,
+        KW625 = 587,
+        KW626 = 588,
+        KW627 = 589,
+        KW628 = 590,
+        KW629 = 591,
+        KW63 = 592,
+        KW630 = 593,
+        KW631 = 594,
+        KW632 = 595,
+        KW633 = 596,
+        KW634 = 597,
+        KW635 = 598,
+        KW636 = 599,
+        KW637 = 600,
+        KW638 = 601,
+        KW639 = 602,
+        KW64 = 603,
+        KW640 = 604,
+        KW641 = 605,
+        KW642 = 606,
+        KW643 = 607,
+        KW644 = 608,
+        KW645 = 609,
+        KW646 = 610,
+        KW647 = 611,
+        KW648 = 612,
+        KW649 = 613,
+        KW65 = 614,
+        KW650 = 615,
+        KW651 = 616,
+        KW652 = 617,
+        KW653 = 618,
+        KW654 = 619,
+        KW655 = 620,
+        KW656 = 621,
+        KW657 = 622,
+        KW658 = 623,
+        KW659 = 624,
+        KW66 = 625,
+        KW660 = 626,
+        KW661 = 627,
+        KW662 = 628,
+        KW663 = 629,
+        KW664 = 630,
+        KW665 = 631,
+        KW666 = 632,
+        KW667 = 633,
+        KW668 = 634,
+        KW669 = 635,
+        KW67 = 636,
+        KW670 = 637,
+        KW671 = 638,
+        KW672 = 639,
+        KW673 = 640,
+        KW674 = 641,
+        KW675 = 642,
+        KW676 = 643,
+        KW677 = 644,
+        KW678 = 645,
+        KW679 = 646,
+        KW68 = 647,
+        KW680 = 648,
+        KW681 = 649,
+        KW682 = 650,
+        KW683 = 651,
+        KW684 = 652,
+        KW685 = 653,
+        KW686 = 654,
+        KW687 = 655,
+        KW688 = 656,
+        KW689 = 657,
+        KW69 = 658,
+        KW690 = 659,
+        KW691 = 660,
+        KW692 = 661,
+        KW693 = 662,
+        KW694 = 663,
+        KW695 = 664,
+        KW696 = 665,
+        KW697 = 666,
+        KW698 = 667,
+        KW699 = 668,
+        KW7 = 669,
+        KW70 = 670,
+        KW700 = 671,
+        KW701 = 672,
+        KW702 = 673,
+        KW703 = 674,
+        KW704 = 675,
+        KW705 = 676,
+        KW706 = 677,
+        KW707 = 678,
+        KW708 = 679,
+        KW709 = 680,
+        KW71 = 681,
+        KW710 = 682,
+        KW711 = 683,
+        KW712 = 684,
+        KW713 = 685,
+        KW714 = 686,
+        KW715 = 687,
+        KW716 = 688,
+        KW717 = 689,
+        KW718 = 690,
+        KW719 = 691,
+        KW72 = 692,
+        KW720 = 693,
+        KW721 = 694,
+        KW722 = 695,
+        KW723 = 696,
+        KW724 = 697,
+        KW725 = 698,
+        KW726 = 699,
+        KW727 = 700,
+        KW728 = 701,
+        KW729 = 702,
+        KW73 = 703,
+        KW730 = 704,
+        KW731 = 705,
+        KW732 = 706,
+        KW733 = 707,
+        KW734 = 708,
+        KW735 = 709,
+        KW736 = 710,
+        KW737 = 711,
+        KW738 = 712,
+        KW739 = 713,
+        KW74 = 714,
+        KW740 = 715,
+        KW741 = 716,
+        KW742 = 717,
+        KW743 = 718,
+        KW744 = 719,
+        KW745 = 720,
+        KW746 = 721,
+        KW747 = 722,
+        KW748 = 723,
+        KW749 = 724,
+        KW75 = 725,
+        KW750 = 726,
+        KW751 = 727,
+        KW752 = 728,
+        KW753 = 729,
+        KW754 = 730,
+        KW755 = 731,
+        KW756 = 732,
+        KW757 = 733,
+        KW758 = 734,
+        KW759 = 735,
+        KW76 = 736,
+        KW760 = 737,
+        KW761 = 738,
+        KW762 = 739,
+        KW763 = 740,
+        KW764 = 741,
+        KW765 = 742,
+        KW766 = 743,
+        KW767 = 744,
+        KW768 = 745,
+        KW769 = 746,
+        KW77 = 747,
+        KW770 = 748,
+        KW771 = 749,
+        KW772 = 750,
+        KW773 = 751,
+        KW774 = 752,
+        KW775 = 753,
+        KW776 = 754,
+        KW777 = 755,
+        KW778 = 756,
+        KW779 = 757,
+        KW78 = 758,
+        KW780 = 759,
+        KW781 = 760,
+        KW782 = 761,
+        KW783 = 762,
+        KW784 = 763,
+        KW785 = 764,
+        KW786 = 765,
+        KW787 = 766,
+        KW788 = 767,
+        KW789 = 768,
+        KW79 = 769,
+        KW790 = 770,
+        KW791 = 771,
+        KW792 = 772,
+        KW793 = 773,
+        KW794 = 774,
+        KW795 = 775,
+        KW796 = 776,
+        KW797 = 777,
+        KW798 = 778,
+        KW799 = 779,
+        KW8 = 780,
+        KW80 = 781,
+        KW800 = 782,
+        KW801 = 783,
+        KW802 = 784,
+        KW803 = 785,
+        KW804 = 786,
+        KW805 = 787,
+        KW806 = 788,
+        KW807 = 789,
+        KW808 = 790,
+        KW809 = 791,
+        KW81 = 792,
+        KW810 = 793,
+        KW811 = 794,
+        KW812 = 795,
+        KW813 = 796,
+        KW814 = 797,
+        KW815 = 798,
+        KW816 = 799,
+        KW817 = 800,
+        KW818 = 801,
+        KW819 = 802,
+        KW82 = 803,
+        KW820 = 804,
+        KW821 = 805,
+        KW822 = 806,
+        KW823 = 807,
+        KW824 = 808,
+        KW825 = 809,
+        KW826 = 810,
+        KW827 = 811,
+        KW828 = 812,
+        KW829 = 813,
+        KW83 = 814,
+        KW830 = 815,
+        KW831 = 816,
+        KW832 = 817,
+        KW833 = 818,
+        KW834 = 819,
+        KW835 = 820,
+        KW836 = 821,
+        KW837 = 822,
+        KW838 = 823,
+        KW839 = 824,
+        KW84 = 825,
+        KW840 = 826,
+        KW841 = 827,
+        KW842 = 828,
+        KW843 = 829,
+        KW844 = 830,
+        KW845 = 831,
+        KW846 = 832,
+        KW847 = 833,
+        KW848 = 834,
+        KW849 = 835,
+        KW85 = 836,
+        KW850 = 837,
+        KW851 = 838,
+        KW852 = 839,
+        KW853 = 840,
+        KW854 = 841,
+        KW855 = 842,
+        KW856 = 843,
+        KW857 = 844,
+        KW858 = 845,
+        KW859 = 846,
+        KW86 = 847,
+        KW860 = 848,
+        KW861 = 849,
+        KW862 = 850,
+        KW863 = 851,
+        KW864 = 852,
+        KW865 = 853,
+        KW866 = 854,
+        KW867 = 855,
+        KW868 = 856,
+        KW869 = 857,
+        KW87 = 858,
+        KW870 = 859,
+        KW871 = 860,
+        KW872 = 861,
+        KW873 = 862,
+        KW874 = 863,
+        KW875 = 864,
+        KW876 = 865,
+        KW877 = 866,
+        KW878 = 867,
+        KW879 = 868,
+        KW88 = 869,
+        KW880 = 870,
+        KW881 = 871,
+        KW882 = 872,
+        KW883 = 873,
+        KW884 = 874,
+        KW885 = 875,
+        KW886 = 876,
+        KW887 = 877,
+        KW888 = 878,
+        KW889 = 879,
+        KW89 = 880,
+        KW890 = 881,
+        KW891 = 882,
+        KW892 = 883,
+        KW893 = 884,
+        KW894 = 885,
+        KW895 = 886,
+        KW896 = 887,
+        KW897 = 888,
+        KW898 = 889,
+        KW899 = 890,
+        KW9 = 891,
+        KW90 = 892,
+        KW900 = 893,
+        KW901 = 894,
+        KW902 = 895,
+        KW903 = 896,
+        KW904 = 897,
+        KW905 = 898,
+        KW906 = 899,
+        KW907 = 900,
+        KW908 = 901,
+        KW909 = 902,
+        KW91 = 903,
+        KW910 = 904,
+        KW911 = 905,
+        KW912 = 906,
+        KW913 = 907,
+        KW914 = 908,
+        KW915 = 909,
+        KW916 = 910,
+        KW917 = 911,
+        KW918 = 912,
+        KW919 = 913,
+        KW92 = 914,
+        KW920 = 915,
+        KW921 = 916,
+        KW922 = 917,
+        KW923 = 918,
+        KW924 = 919,
+        KW925 = 920,
+        KW926 = 921,
+        KW927 = 922,
+        KW928 = 923,
+        KW929 = 924,
+        KW93 = 925,
+        KW930 = 926,
+        KW931 = 927,
+        KW932 = 928,
+        KW933 = 929,
+        KW934 = 930,
+        KW935 = 931,
+        KW936 = 932,
+        KW937 = 933,
+        KW938 = 934,
+        KW939 = 935,
+        KW94 = 936,
+        KW940 = 937,
+        KW941 = 938,
+        KW942 = 939,
+        KW943 = 940,
+        KW944 = 941,
+        KW945 = 942,
+        KW946 = 943,
+        KW947 = 944,
+        KW948 = 945,
+        KW949 = 946,
+        KW95 = 947,
+        KW950 = 948,
+        KW951 = 949,
+        KW952 = 950,
+        KW953 = 951,
+        KW954 = 952,
+        KW955 = 953,
+        KW956 = 954,
+        KW957 = 955,
+        KW958 = 956,
+        KW959 = 957,
+        KW96 = 958,
+        KW960 = 959,
+        KW961 = 960,
+        KW962 = 961,
+        KW963 = 962,
+        KW964 = 963,
+        KW965 = 964,
+        KW966 = 965,
+        KW967 = 966,
+        KW968 = 967,
+        KW969 = 968,
+        KW97 = 969,
+        KW970 = 970,
+        KW971 = 971,
+        KW972 = 972,
+        KW973 = 973,
+        KW974 = 974,
+        KW975 = 975,
+        KW976 = 976,
+        KW977 = 977,
+        KW978 = 978,
+        KW979 = 979,
+        KW98 = 980,
+        KW980 = 981,
+        KW981 = 982,
+        KW982 = 983,
+        KW983 = 984,
+        KW984 = 985,
+        KW985 = 986,
+        KW986 = 987,
+        KW987 = 988,
+        KW988 = 989,
+        KW989 = 990,
+        KW99 = 991,
+        KW990 = 992,
+        KW991 = 993,
+        LP = 994,
+        NUM = 995,
+        PLUS = 996,
+        RP = 997,
+        SEMI = 998
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
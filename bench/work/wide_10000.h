@@ -0,0 +1,10032 @@
+// This file auto-generated from Bench.lem by Lime version 0.9
+// Editing of this file strongly discouraged.
+
+#ifndef _Bench_h_
+#define _Bench_h_
+
+class privBenchImpl;
+
+
+
+class Bench
+{
+public:
+
+    enum Terminal
+    {
+        EOF = 0,
+        ID = 1,
+        KW0 = 2,
+        KW1 = 3,
+        KW10 = 4,
+        KW100 = 5,
+        KW1000 = 6,
+        KW1001 = 7,
+        KW1002 = 8,
+        KW1003 = 9,
+        KW1004 = 10,
+        KW1005 = 11,
+        KW1006 = 12,
+        KW1007 = 13,
+        KW1008 = 14,
+        KW1009 = 15,
+        KW101 = 16,
+        KW1010 = 17,
+        KW1011 = 18,
+        KW1012 = 19,
+        KW1013 = 20,
+        KW1014 = 21,
+        KW1015 = 22,
+        KW1016 = 23,
+        KW1017 = 24,
+        KW1018 = 25,
+        KW1019 = 26,
+        KW102 = 27,
+        KW1020 = 28,
+        KW1021 = 29,
+        KW1022 = 30,
+        KW1023 = 31,
+        KW1024 = 32,
+        KW1025 = 33,
+        KW1026 = 34,
+        KW1027 = 35,
+        KW1028 = 36,
+        KW1029 = 37,
+        KW103 = 38,
+        KW1030 = 39,
+        KW1031 = 40,
+        KW1032 = 41,
+        KW1033 = 42,
+        KW1034 = 43,
+        KW1035 = 44,
+        KW1036 = 45,
+        KW1037 = 46,
+        KW1038 = 47,
+        KW1039 = 48,
+        KW104 = 49,
+        KW1040 = 50,
+        KW1041 = 51,
+        KW1042 = 52,
+        KW1043 = 53,
+        KW1044 = 54,
+        KW1045 = 55,
+        KW1046 = 56,
+        KW1047 = 57,
+        KW1048 = 58,
+        KW1049 = 59,
+        KW105 = 60,
+        KW1050 = 61,
+        KW1051 = 62,
+        KW1052 = 63,
+        KW1053 = 64,
+        KW1054 = 65,
+        KW1055 = 66,
+        KW1056 = 67,
+        KW1057 = 68,
+        KW1058 = 69,
+        KW1059 = 70,
+        KW106 = 71,
+        KW1060 = 72,
+        KW1061 = 73,
+        KW1062 = 74,
+        KW1063 = 75,
+        KW1064 = 76,
+        KW1065 = 77,
+        KW1066 = 78,
+        KW1067 = 79,
+        KW1068 = 80,
+        KW1069 = 81,
+        KW107 = 82,
+        KW1070 = 83,
+        KW1071 = 84,
+        KW1072 = 85,
+        KW1073 = 86,
+        KW1074 = 87,
+        KW1075 = 88,
+        KW1076 = 89,
+        KW1077 = 90,
+        KW1078 = 91,
+        KW1079 = 92,
+        KW108 = 93,
+        KW1080 = 94,
+        KW1081 = 95,
+        KW1082 = 96,
+        KW1083 = 97,
+        KW1084 = 98,
+        KW1085 = 99,
+        KW1086 = 100,
+        KW1087 = 101,
+        KW1088 = 102,
+        KW1089 = 103,
+        KW109 = 104,
+        KW1090 = 105,
+        KW1091 = 106,
+        KW1092 = 107,
+        KW1093 = 108,
+        KW1094 = 109,
+        KW1095 = 110,
+        KW1096 = 111,
+        KW1097 = 112,
+        KW1098 = 113,
+        KW1099 = 114,
+        KW11 = 115,
+        KW110 = 116,
+        KW1100 = 117,
+        KW1101 = 118,
+        KW1102 = 119,
+        KW1103 = 120,
+        KW1104 = 121,
+        KW1105 = 122,
+        KW1106 = 123,
+        KW1107 = 124,
+        KW1108 = 125,
+        KW1109 = 126,
+        KW111 = 127,
+        KW1110 = 128,
+        KW1111 = 129,
+        KW1112 = 130,
+        KW1113 = 131,
+        KW1114 = 132,
+        KW1115 = 133,
+        KW1116 = 134,
+        KW1117 = 135,
+        KW1118 = 136,
+        KW1119 = 137,
+        KW112 = 138,
+        KW1120 = 139,
+        KW1121 = 140,
+        KW1122 = 141,
+        KW1123 = 142,
+        KW1124 = 143,
+        KW1125 = 144,
+        KW1126 = 145,
+        KW1127 = 146,
+        KW1128 = 147,
+        KW1129 = 148,
+        KW113 = 149,
+        KW1130 = 150,
+        KW1131 = 151,
+        KW1132 = 152,
+        KW1133 = 153,
+        KW1134 = 154,
+        KW1135 = 155,
+        KW1136 = 156,
+        KW1137 = 157,
+        KW1138 = 158,
+        KW1139 = 159,
+        KW114 = 160,
+        KW1140 = 161,
+        KW1141 = 162,
+        KW1142 = 163,
+        KW1143 = 164,
+        KW1144 = 165,
+        KW1145 = 166,
+        KW1146 = 167,
+        KW1147 = 168,
+        KW1148 = 169,
+        KW1149 = 170,
+        KW115 = 171,
+        KW1150 = 172,
+        KW1151 = 173,
+        KW1152 = 174,
+        KW1153 = 175,
+        KW1154 = 176,
+        KW1155 = 177,
+        KW1156 = 178,
+        KW1157 = 179,
+        KW1158 = 180,
+        KW1159 = 181,
+        KW116 = 182,
+        KW1160 = 183,
+        KW1161 = 184,
+        KW1162 = 185,
+        KW1163 = 186,
+        KW1164 = 187,
+        KW1165 = 188,
+        KW1166 = 189,
+        KW1167 = 190,
+        KW1168 = 191,
+        KW1169 = 192,
+        KW117 = 193,
+        KW1170 = 194,
+        KW1171 = 195,
+        KW1172 = 196,
+        KW1173 = 197,
+        KW1174 = 198,
+        KW1175 = 199,
+        KW1176 = 200,
+        KW1177 = 201,
+        KW1178 = 202,
+        KW1179 = 203,
+        KW118 = 204,
+        KW1180 = 205,
+        KW1181 = 206,
+        KW1182 = 207,
+        KW1183 = 208,
+        KW1184 = 209,
+        KW1185 = 210,
+        KW1186 = 211,
+        KW1187 = 212,
+        KW1188 = 213,
+        KW1189 = 214,
+        KW119 = 215,
+        KW1190 = 216,
+        KW1191 = 217,
+        KW1192 = 218,
+        KW1193 = 219,
+        KW1194 = 220,
+        KW1195 = 221,
+        KW1196 = 222,
+        KW1197 = 223,
+        KW1198 = 224,
+        KW1199 = 225,
+        KW12 = 226,
+        KW120 = 227,
+        KW1200 = 228,
+        KW1201 = 229,
+        KW1202 = 230,
+        KW1203 = 231,
+        KW1204 = 232,
+        KW1205 = 233,
+        KW1206 = 234,
+        KW1207 = 235,
+        KW1208 = 236,
+        KW1209 = 237,
+        KW121 = 238,
+        KW1210 = 239,
+        KW1211 = 240,
+        KW1212 = 241,
+        KW1213 = 242,
+        KW1214 = 243,
+        KW1215 = 244,
+        KW1216 = 245,
+        KW1217 = 246,
+        KW1218 = 247,
+        KW1219 = 248,
+        KW122 = 249,
+        KW1220 = 250,
+        KW1221 = 251,
+        KW1222 = 252,
+        KW1223 = 253,
+        KW1224 = 254,
+        KW1225 = 255,
+        KW1226 = 256,
+        KW1227 = 257,
+        KW1228 = 258,
+        KW1229 = 259,
+        KW123 = 260,
+        KW1230 = 261,
+        KW1231 = 262,
+        KW1232 = 263,
+        KW1233 = 264,
+        KW1234 = 265,
+        KW1235 = 266,
+        KW1236 = 267,
+        KW1237 = 268,
+        KW1238 = 269,
+        KW1239 = 270,
+        KW124 = 271,
+        KW1240 = 272,
+        KW1241 = 273,
+        KW1242 = 274,
+        KW1243 = 275,
+        KW1244 = 276,
+        KW1245 = 277,
+        KW1246 = 278,
+        KW1247 = 279,
+        KW1248 = 280,
+        KW1249 = 281,
+        KW125 = 282,
+        KW1250 = 283,
+        KW1251 = 284,
+        KW1252 = 285,
+        KW1253 = 286,
+        KW1254 = 287,
+        KW1255 = 288,
+        KW1256 = 289,
+        KW1257 = 290,
+        KW1258 = 291,
+        KW1259 = 292,
+        KW126 = 293,
+        KW1260 = 294,
+        KW1261 = 295,
+        KW1262 = 296,
+        KW1263 = 297,
+        KW1264 = 298,
+        KW1265 = 299,
+        KW1266 = 300,
+        KW1267 = 301,
+        KW1268 = 302,
+        KW1269 = 303,
+        KW127 = 304,
+        KW1270 = 305,
+        KW1271 = 306,
+        KW1272 = 307,
+        KW1273 = 308,
+        KW1274 = 309,
+        KW1275 = 310,
+        KW1276 = 311,
+        KW1277 = 312,
+        KW1278 = 313,
+        KW1279 = 314,
+        KW128 = 315,
+        KW1280 = 316,
+        KW1281 = 317,
+        KW1282 = 318,
+        KW1283 = 319,
+        KW1284 = 320,
+        KW1285 = 321,
+        KW1286 = 322,
+        KW1287 = 323,
+        KW1288 = 324,
+        KW1289 = 325,
+        KW129 = 326,
+        KW1290 = 327,
+        KW1291 = 328,
+        KW1292 = 329,
+        KW1293 = 330,
+        KW1294 = 331,
+        KW1295 = 332,
+        KW1296 = 333,
+        KW1297 = 334,
+        KW1298 = 335,
+        KW1299 = 336,
+        KW13 = 337,
+        KW130 = 338,
+        KW1300 = 339,
+        KW1301 = 340,
+        KW1302 = 341,
+        KW1303 = 342,
+        KW1304 = 343,
+        KW1305 = 344,
+        KW1306 = 345,
+        KW1307 = 346,
+        KW1308 = 347,
+        KW1309 = 348,
+        KW131 = 349,
+        KW1310 = 350,
+        KW1311 = 351,
+        KW1312 = 352,
+        KW1313 = 353,
+        KW1314 = 354,
+        KW1315 = 355,
+        KW1316 = 356,
+        KW1317 = 357,
+        KW1318 = 358,
+        KW1319 = 359,
+        KW132 = 360,
+        KW1320 = 361,
+        KW1321 = 362,
+        KW1322 = 363,
+        KW1323 = 364,
+        KW1324 = 365,
+        KW1325 = 366,
+        KW1326 = 367,
+        KW1327 = 368,
+        KW1328 = 369,
+        KW1329 = 370,
+        KW133 = 371,
+        KW1330 = 372,
+        KW1331 = 373,
+        KW1332 = 374,
+        KW1333 = 375,
+        KW1334 = 376,
+        KW1335 = 377,
+        KW1336 = 378,
+        KW1337 = 379,
+        KW1338 = 380,
+        KW1339 = 381,
+        KW134 = 382,
+        KW1340 = 383,
+        KW1341 = 384,
+        KW1342 = 385,
+        KW1343 = 386,
+        KW1344 = 387,
+        KW1345 = 388,
+        KW1346 = 389,
+        KW1347 = 390,
+        KW1348 = 391,
+        KW1349 = 392,
+        KW135 = 393,
+        KW1350 = 394,
+        KW1351 = 395,
+        KW1352 = 396,
+        KW1353 = 397,
+        KW1354 = 398,
+        KW1355 = 399,
+        KW1356 = 400,
+        KW1357 = 401,
+        KW1358 = 402,
+        KW1359 = 403,
+        KW136 = 404,
+        KW1360 = 405,
+        KW1361 = 406,
+        KW1362 = 407,
+        KW1363 = 408,
+        KW1364 = 409,
+        KW1365 = 410,
+        KW1366 = 411,
+        KW1367 = 412,
+        KW1368 = 413,
+        KW1369 = 414,
+        KW137 = 415,
+        KW1370 = 416,
+        KW1371 = 417,
+        KW1372 = 418,
+        KW1373 = 419,
+        KW1374 = 420,
+        KW1375 = 421,
+        KW1376 = 422,
+        KW1377 = 423,
+        KW1378 = 424,
+        KW1379 = 425,
+        KW138 = 426,
+        KW1380 = 427,
+        KW1381 = 428,
+        KW1382 = 429,
+        KW1383 = 430,
+        KW1384 = 431,
+        KW1385 = 432,
+        KW1386 = 433,
+        KW1387 = 434,
+        KW1388 = 435,
+        KW1389 = 436,
+        KW139 = 437,
+        KW1390 = 438,
+        KW1391 = 439,
+        KW1392 = 440,
+        KW1393 = 441,
+        KW1394 = 442,
+        KW1395 = 443,
+        KW1396 = 444,
+        KW1397 = 445,
+        KW1398 = 446,
+        KW1399 = 447,
+        KW14 = 448,
+        KW140 = 449,
+        KW1400 = 450,
+        KW1401 = 451,
+        KW1402 = 452,
+        KW1403 = 453,
+        KW1404 = 454,
+        KW1405 = 455,
+        KW1406 = 456,
+        KW1407 = 457,
+        KW1408 = 458,
+        KW1409 = 459,
+        KW141 = 460,
+        KW1410 = 461,
+        KW1411 = 462,
+        KW1412 = 463,
+        KW1413 = 464,
+        KW1414 = 465,
+        KW1415 = 466,
+        KW1416 = 467,
+        KW1417 = 468,
+        KW1418 = 469,
+        KW1419 = 470,
+        KW142 = 471,
+        KW1420 = 472,
+        KW1421 = 473,
+        KW1422 = 474,
+        KW1423 = 475,
+        KW1424 = 476,
+        KW1425 = 477,
+        KW1426 = 478,
+        KW1427 = 479,
+        KW1428 = 480,
+        KW1429 = 481,
+        KW143 = 482,
+        KW1430 = 483,
+        KW1431 = 484,
+        KW1432 = 485,
+        KW1433 = 486,
+        KW1434 = 487,
+        KW1435 = 488,
+        KW1436 = 489,
+        KW1437 = 490,
+        KW1438 = 491,
+        KW1439 = 492,
+        KW144 = 493,
+        KW1440 = 494,
+        KW1441 = 495,
+        KW1442 = 496,
+        KW1443 = 497,
+        KW1444 = 498,
+        KW1445 = 499,
+        KW1446 = 500,
+        KW1447 = 501,
+        KW1448 = 502,
+        KW1449 = 503,
+        KW145 = 504,
+        KW1450 = 505,
+        KW1451 = 506,
+        KW1452 = 507,
+        KW1453 = 508,
+        KW1454 = 509,
+        KW1455 = 510,
+        KW1456 = 511,
+        KW1457 = 512,
+        KW1458 = 513,
+        KW1459 = 514,
+        KW146 = 515,
+        KW1460 = 516,
+        KW1461 = 517,
+        KW1462 = 518,
+        KW1463 = 519,
+        KW1464 = 520,
+        KW1465 = 521,
+        KW1466 = 522,
+        KW1467 = 523,
+        KW1468 = 524,
+        KW1469 = 525,
+        KW147 = 526,
+        KW1470 = 527,
+        KW1471 = 528,
+        KW1472 = 529,
+        KW1473 = 530,
+        KW1474 = 531,
+        KW1475 = 532,
+        KW1476 = 533,
+        KW1477 = 534,
+        KW1478 = 535,
+        KW1479 = 536,
+        KW148 = 537,
+        KW1480 = 538,
+        KW1481 = 539,
+        KW1482 = 540,
+        KW1483 = 541,
+        KW1484 = 542,
+        KW1485 = 543,
+        KW1486 = 544,
+        KW1487 = 545,
+        KW1488 = 546,
+        KW1489 = 547,
+        KW149 = 548,
+        KW1490 = 549,
+        KW1491 = 550,
+        KW1492 = 551,
+        KW1493 = 552,
+        KW1494 = 553,
+        KW1495 = 554,
+        KW1496 = 555,
+        KW1497 = 556,
+        KW1498 = 557,
+        KW1499 = 558,
+        KW15 = 559,
+        KW150 = 560,
+        KW1500 = 561,
+        KW1501 = 562,
+        KW1502 = 563,
+        KW1503 = 564,
+        KW1504 = 565,
+        KW1505 = 566,
+        KW1506 = 567,
+        KW1507 = 568,
+        KW1508 = 569,
+        KW1509 = 570,
+        KW151 = 571,
+        KW1510 = 572,
+        KW1511 = 573,
+        KW1512 = 574,
+        KW1513 = 575,
+        KW1514 = 576,
+        KW1515 = 577,
+        KW1516 = 578,
+        KW1517 = 579,
+        KW1518 = 580,
+        KW1519 = 581,
+        KW152 = 582,
+        KW1520 = 583,
+        KW1521 = 584,
+        KW1522 = 585,
+        KW1523 = 586,
+        KW1524 = 587,
+        KW1525 = 588,
+        KW1526 = 589,
+        KW1527 = 590,
+        KW1528 = 591,
+        KW1529 = 592,
+        KW153 = 593,
+        KW1530 = 594,
+        KW1531 = 595,
+        KW1532 = 596,
+        KW1533 = 597,
+        KW1534 = 598,
+        KW1535 = 599,
+        KW1536 = 600,
+        KW1537 = 601,
+        KW1538 = 602,
+        KW1539 = 603,
+        KW154 = 604,
+        KW1540 = 605,
+        KW1541 = 606,
+        KW1542 = 607,
+        KW1543 = 608,
+        KW1544 = 609,
+        KW1545 = 610,
+        KW1546 = 611,
+        KW1547 = 612,
+        KW1548 = 613,
+        KW1549 = 614,
+        KW155 = 615,
+        KW1550 = 616,
+        KW1551 = 617,
+        KW1552 = 618,
+        KW1553 = 619,
+        KW1554 = 620,
+        KW1555 = 621,
+        KW1556 = 622,
+        KW1557 = 623,
+        KW1558 = 624,
+        KW1559 = 625,
+        KW156 = 626,
+        KW1560 = 627,
+        KW1561 = 628,
+        KW1562 = 629,
+        KW1563 = 630,
+        KW1564 = 631,
+        KW1565 = 632,
+        KW1566 = 633,
+        KW1567 = 634,
+        KW1568 = 635,
+        KW1569 = 636,
+        KW157 = 637,
+        KW1570 = 638,
+        KW1571 = 639,
+        KW1572 = 640,
+        KW1573 = 641,
+        KW1574 = 642,
+        KW1575 = 643,
+        KW1576 = 644,
+        KW1577 = 645,
+        KW1578 = 646,
+        KW1579 = 647,
+        KW158 = 648,
+        KW1580 = 649,
+        KW1581 = 650,
+        KW1582 = 651,
+        KW1583 = 652,
+        KW1584 = 653,
+        KW1585 = 654,
+        KW1586 = 655,
+        KW1587 = 656,
+        KW1588 = 657,
+        KW1589 = 658,
+        KW159 = 659,
+        KW1590 = 660,
+        KW1591 = 661,
+        KW1592 = 662,
+        KW1593 = 663,
+        KW1594 = 664,
+        KW1595 = 665,
+        KW1596 = 666,
+        KW1597 = 667,
+        KW1598 = 668,
+        KW1599 = 669,
+        KW16 = 670,
+        KW160 = 671,
+        KW1600 = 672,
+        KW1601 = 673,
+        KW1602 = 674,
+        KW1603 = 675,
+        KW1604 = 676,
+        KW1605 = 677,
+        KW1606 = 678,
+        KW1607 = 679,
+        KW1608 = 680,
+        KW1609 = 681,
+        KW161 = 682,
+        KW1610 = 683,
+        KW1611 = 684,
+        KW1612 = 685,
+        KW1613 = 686,
+        KW1614 = 687,
+        KW1615 = 688,
+        KW1616 = 689,
+        KW1617 = 690,
+        KW1618 = 691,
+        KW1619 = 692,
+        KW162 = 693,
+        KW1620 = 694,
+        KW1621 = 695,
+        KW1622 = 696,
+        KW1623 = 697,
+        KW1624 = 698,
+        KW1625 = 699,
+        KW1626 = 700,
+        KW1627 = 701,
+        KW1628 = 702,
+        KW1629 = 703,
+        KW163 = 704,
+        KW1630 = 705,
+        KW1631 = 706,
+        KW1632 = 707,
+        KW1633 = 708,
+        KW1634 = 709,
+        KW1635 = 710,
+        KW1636 = 711,
+        KW1637 = 712,
+        KW1638 = 713,
+        KW1639 = 714,
+        KW164 = 715,
+        KW1640 = 716,
+        KW1641 = 717,
+        KW1642 = 718,
+        KW1643 = 719,
+        KW1644 = 720,
+        KW1645 = 721,
+        KW1646 = 722,
+        KW1647 = 723,
+        KW1648 = 724,
+        KW1649 = 725,
+        KW165 = 726,
+        KW1650 = 727,
+        KW1651 = 728,
+        KW1652 = 729,
+        KW1653 = 730,
+        KW1654 = 731,
+        KW1655 = 732,
+        KW1656 = 733,
+        KW1657 = 734,
+        KW1658 = 735,
+        KW1659 = 736,
+        KW166 = 737,
+        KW1660 = 738,
+        KW1661 = 739,
+        KW1662 = 740,
+        KW1663 = 741,
+        KW1664 = 742,
+        KW1665 = 743,
+        KW1666 = 744,
+        KW1667 = 745,
+        KW1668 = 746,
+        KW1669 = 747,
+        KW167 = 748,
+        KW1670 = 749,
+        KW1671 = 750,
+        KW1672 = 751,
+        KW1673 = 752,
+        KW1674 = 753,
+        KW1675 = 754,
+        KW1676 = 755,
+        KW1677 = 756,
+        KW1678 = 757,
+        KW1679 = 758,
+        KW168 = 759,
+        KW1680 = 760,
+        KW1681 = 761,
+        KW1682 = 762,
+        KW1683 = 763,
+        KW1684 = 764,
+        KW1685 = 765,
+        KW1686 = 766,
+        KW1687 = 767,
+        KW1688 = 768,
+        KW1689 = 769,
+        KW169 = 770,
+        KW1690 = 771,
+        KW1691 = 772,
+        KW1692 = 773,
+        KW1693 = 774,
+        KW1694 = 775,
+        KW1695 = 776,
+        KW1696 = 777,
+        KW1697 = 778,
+        KW1698 = 779,
+        KW1699 = 780,
+        KW17 = 781,
+        KW170 = 782,
+        KW1700 = 783,
+        KW1701 = 784,
+        KW1702 = 785,
+        KW1703 = 786,
+        KW1704 = 787,
+        KW1705 = 788,
+        KW1706 = 789,
+        KW1707 = 790,
+        KW1708 = 791,
+        KW1709 = 792,
+        KW171 = 793,
+        KW1710 = 794,
+        KW1711 = 795,
+        KW1712 = 796,
+        KW1713 = 797,
+        KW1714 = 798,
+        KW1715 = 799,
+        KW1716 = 800,
+        KW1717 = 801,
+        KW1718 = 802,
+        KW1719 = 803,
+        KW172 = 804,
+        KW1720 = 805,
+        KW1721 = 806,
+        KW1722 = 807,
+        KW1723 = 808,
+        KW1724 = 809,
+        KW1725 = 810,
+        KW1726 = 811,
+        KW1727 = 812,
+        KW1728 = 813,
+        KW1729 = 814,
+        KW173 = 815,
+        KW1730 = 816,
+        KW1731 = 817,
+        KW1732 = 818,
+        KW1733 = 819,
+        KW1734 = 820,
+        KW1735 = 821,
+        KW1736 = 822,
+        KW1737 = 823,
+        KW1738 = 824,
+        KW1739 = 825,
+        KW174 = 826,
+        KW1740 = 827,
+        KW1741 = 828,
+        KW1742 = 829,
+        KW1743 = 830,
+        KW1744 = 831,
+        KW1745 = 832,
+        KW1746 = 833,
+        KW1747 = 834,
+        KW1748 = 835,
+        KW1749 = 836,
+        KW175 = 837,
+        KW1750 = 838,
+        KW1751 = 839,
+        KW1752 = 840,
+        KW1753 = 841,
+        KW1754 = 842,
+        KW1755 = 843,
+        KW1756 = 844,
+        KW1757 = 845,
+        KW1758 = 846,
+        KW1759 = 847,
+        KW176 = 848,
+        KW1760 = 849,
+        KW1761 = 850,
+        KW1762 = 851,
+        KW1763 = 852,
+        KW1764 = 853,
+        KW1765 = 854,
+        KW1766 = 855,
+        KW1767 = 856,
+        KW1768 = 857,
+        KW1769 = 858,
+        KW177 = 859,
+        KW1770 = 860,
+        KW1771 = 861,
+        KW1772 = 862,
+        KW1773 = 863,
+        KW1774 = 864,
+        KW1775 = 865,
+        KW1776 = 866,
+        KW1777 = 867,
+        KW1778 = 868,
+        KW1779 = 869,
+        KW178 = 870,
+        KW1780 = 871,
+        KW1781 = 872,
+        KW1782 = 873,
+        KW1783 = 874,
+        KW1784 = 875,
+        KW1785 = 876,
+        KW1786 = 877,
+        KW1787 = 878,
+        KW1788 = 879,
+        KW1789 = 880,
+        KW179 = 881,
+        KW1790 = 882,
+        KW1791 = 883,
+        KW1792 = 884,
+        KW1793 = 885,
+        KW1794 = 886,
+        KW1795 = 887,
+        KW1796 = 888,
+        KW1797 = 889,
+        KW1798 = 890,
+        KW1799 = 891,
+        KW18 = 892,
+        KW180 = 893,
+        KW1800 = 894,
+        KW1801 = 895,
+        KW1802 = 896,
+        KW1803 = 897,
+        KW1804 = 898,
+        KW1805 = 899,
+        KW1806 = 900,
+        KW1807 = 901,
+        KW1808 = 902,
+        KW1809 = 903,
+        KW181 = 904,
+        KW1810 = 905,
+        KW1811 = 906,
+        KW1812 = 907,
+        KW1813 = 908,
+        KW1814 = 909,
+        KW1815 = 910,
+        KW1816 = 911,
+        KW1817 = 912,
+        KW1818 = 913,
+        KW1819 = 914,
+        KW182 = 915,
+        KW1820 = 916,
+        KW1821 = 917,
+        KW1822 = 918,
+        KW1823 = 919,
+        KW1824 = 920,
+        KW1825 = 921,
+        KW1826 = 922,
+        KW1827 = 923,
+        KW1828 = 924,
+        KW1829 = 925,
+        KW183 = 926,
+        KW1830 = 927,
+        KW1831 = 928,
+        KW1832 = 929,
+        KW1833 = 930,
+        KW1834 = 931,
+        KW1835 = 932,
+        KW1836 = 933,
+        KW1837 = 934,
+        KW1838 = 935,
+        KW1839 = 936,
+        KW184 = 937,
+        KW1840 = 938,
+        KW1841 = 939,
+        KW1842 = 940,
+        KW1843 = 941,
+        KW1844 = 942,
+        KW1845 = 943,
+        KW1846 = 944,
+        KW1847 = 945,
+        KW1848 = 946,
+        KW1849 = 947,
+        KW185 = 948,
+        KW1850 = 949,
+        KW1851 = 950,
+        KW1852 = 951,
+        KW1853 = 952,
+        KW1854 = 953,
+        KW1855 = 954,
+        KW1856 = 955,
+        KW1857 = 956,
+        KW1858 = 957,
+        KW1859 = 958,
+        KW186 = 959,
+        KW1860 = 960,
+        KW1861 = 961,
+        KW1862 = 962,
+        KW1863 = 963,
+        KW1864 = 964,
+        KW1865 = 965,
+        KW1866 = 966,
+        KW1867 = 967,
+        KW1868 = 968,
+        KW1869 = 969,
+        KW187 = 970,
+        KW1870 = 971,
+        KW1871 = 972,
+        KW1872 = 973,
+        KW1873 = 974,
+        KW1874 = 975,
+        KW1875 = 976,
+        KW1876 = 977,
+        KW1877 = 978,
+        KW1878 = 979,
+        KW1879 = 980,
+        KW188 = 981,
+        KW1880 = 982,
+        KW1881 = 983,
+        KW1882 = 984,
+        KW1883 = 985,
+        KW1884 = 986,
+        KW1885 = 987,
+        KW1886 = 988,
+        KW1887 = 989,
+        KW1888 = 990,
+        KW1889 = 991,
+        KW189 = 992,
+        KW1890 = 993,
+        KW1891 = 994,
+        KW1892 = 995,
+        KW1893 = 996,
+        KW1894 = 997,
+        KW1895 = 998,
+        KW1896 = 999,
+        KW1897 = 1000,
+        KW1898 = 1001,
+        KW1899 = 1002,
+        KW19 = 1003,
+        KW190 = 1004,
+        KW1900 = 1005,
+        KW1901 = 1006,
+        KW1902 = 1007,
+        KW1903 = 1008,
+        KW1904 = 1009,
+        KW1905 = 1010,
+        KW1906 = 1011,
+        KW1907 = 1012,
+        KW1908 = 1013,
+        KW1909 = 1014,
+        KW191 = 1015,
+        KW1910 = 1016,
+        KW1911 = 1017,
+        KW1912 = 1018,
+        KW1913 = 1019,
+        KW1914 = 1020,
+        KW1915 = 1021,
+        KW1916 = 1022,
+        KW1917 = 1023,
+        KW1918 = 1024,
+        KW1919 = 1025,
+        KW192 = 1026,
+        KW1920 = 1027,
+        KW1921 = 1028,
+        KW1922 = 1029,
+        KW1923 = 1030,
+        KW1924 = 1031,
+        KW1925 = 1032,
+        KW1926 = 1033,
+        KW1927 = 1034,
+        KW1928 = 1035,
+        KW1929 = 1036,
+        KW193 = 1037,
+        KW1930 = 1038,
+        KW1931 = 1039,
+        KW1932 = 1040,
+        KW1933 = 1041,
+        KW1934 = 1042,
+        KW1935 = 1043,
+        KW1936 = 1044,
+        KW1937 = 1045,
+        KW1938 = 1046,
+        KW1939 = 1047,
+        KW194 = 1048,
+        KW1940 = 1049,
+        KW1941 = 1050,
+        KW1942 = 1051,
+        KW1943 = 1052,
+        KW1944 = 1053,
+        KW1945 = 1054,
+        KW1946 = 1055,
+        KW1947 = 1056,
+        KW1948 = 1057,
+        KW1949 = 1058,
+        KW195 = 1059,
+        KW1950 = 1060,
+        KW1951 = 1061,
+        KW1952 = 1062,
+        KW1953 = 1063,
+        KW1954 = 1064,
+        KW1955 = 1065,
+        KW1956 = 1066,
+        KW1957 = 1067,
+        KW1958 = 1068,
+        KW1959 = 1069,
+        KW196 = 1070,
+        KW1960 = 1071,
+        KW1961 = 1072,
+        KW1962 = 1073,
+        KW1963 = 1074,
+        KW1964 = 1075,
+        KW1965 = 1076,
+        KW1966 = 1077,
+        KW1967 = 1078,
+        KW1968 = 1079,
+        KW1969 = 1080,
+        KW197 = 1081,
+        KW1970 = 1082,
+        KW1971 = 1083,
+        KW1972 = 1084,
+        KW1973 = 1085,
+        KW1974 = 1086,
+        KW1975 = 1087,
+        KW1976 = 1088,
+        KW1977 = 1089,
+        KW1978 = 1090,
+        KW1979 = 1091,
+        KW198 = 1092,
+        KW1980 = 1093,
+        KW1981 = 1094,
+        KW1982 = 1095,
+        KW1983 = 1096,
+        KW1984 = 1097,
+        KW1985 = 1098,
+        KW1986 = 1099,
+        KW1987 = 1100,
+        KW1988 = 1101,
+        KW1989 = 1102,
+        KW199 = 1103,
+        KW1990 = 1104,
+        KW1991 = 1105,
+        KW1992 = 1106,
+        KW1993 = 1107,
+        KW1994 = 1108,
+        KW1995 = 1109,
+        KW1996 = 1110,
+        KW1997 = 1111,
+        KW1998 = 1112,
+        KW1999 = 1113,
+        KW2 = 1114,
+        KW20 = 1115,
+        KW200 = 1116,
+        KW2000 = 1117,
+        KW2001 = 1118,
+        KW2002 = 1119,
+        KW2003 = 1120,
+        KW2004 = 1121,
+        KW2005 = 1122,
+        KW2006 = 1123,
+        KW2007 = 1124,
+        KW2008 = 1125,
+        KW2009 = 1126,
+        KW201 = 1127,
+        KW2010 = 1128,
+        KW2011 = 1129,
+        KW2012 = 1130,
+        KW2013 = 1131,
+        KW2014 = 1132,
+        KW2015 = 1133,
+        KW2016 = 1134,
+        KW2017 = 1135,
+        KW2018 = 1136,
+        KW2019 = 1137,
+        KW202 = 1138,
+        KW2020 = 1139,
+        KW2021 = 1140,
+        KW2022 = 1141,
+        KW2023 = 1142,
+        KW2024 = 1143,
+        KW2025 = 1144,
+        KW2026 = 1145,
+        KW2027 = 1146,
+        KW2028 = 1147,
+        KW2029 = 1148,
+        KW203 = 1149,
+        KW2030 = 1150,
+        KW2031 = 1151,
+        KW2032 = 1152,
+        KW2033 = 1153,
+        KW2034 = 1154,
+        KW2035 = 1155,
+        KW2036 = 1156,
+        KW2037 = 1157,
+        KW2038 = 1158,
+        KW2039 = 1159,
+        KW204 = 1160,
+        KW2040 = 1161,
+        KW2041 = 1162,
+        KW2042 = 1163,
+        KW2043 = 1164,
+        KW2044 = 1165,
+        KW2045 = 1166,
+        KW2046 = 1167,
+        KW2047 = 1168,
+        KW2048 = 1169,
+        KW2049 = 1170,
+        KW205 = 1171,
+        KW2050 = 1172,
+        KW2051 = 1173,
+        KW2052 = 1174,
+        KW2053 = 1175,
+        KW2054 = 1176,
+        KW2055 = 1177,
+        KW2056 = 1178,
+        KW2057 = 1179,
+        KW2058 = 1180,
+        KW2059 = 1181,
+        KW206 = 1182,
+        KW2060 = 1183,
+        KW2061 = 1184,
+        KW2062 = 1185,
+        KW2063 = 1186,
+        KW2064 = 1187,
+        KW2065 = 1188,
+        KW2066 = 1189,
+        KW2067 = 1190,
+        KW2068 = 1191,
+        KW2069 = 1192,
+        KW207 = 1193,
+        KW2070 = 1194,
+        KW2071 = 1195,
+        KW2072 = 1196,
+        KW2073 = 1197,
+        KW2074 = 1198,
+        KW2075 = 1199,
+        KW2076 = 1200,
+        KW2077 = 1201,
+        KW2078 = 1202,
+        KW2079 = 1203,
+        KW208 = 1204,
+        KW2080 = 1205,
+        KW2081 = 1206,
+        KW2082 = 1207,
+        KW2083 = 1208,
+        KW2084 = 1209,
+        KW2085 = 1210,
+        KW2086 = 1211,
+        KW2087 = 1212,
+        KW2088 = 1213,
+        KW2089 = 1214,
+        KW209 = 1215,
+        KW2090 = 1216,
+        KW2091 = 1217,
+        KW2092 = 1218,
+        KW2093 = 1219,
+        KW2094 = 1220,
+        KW2095 = 1221,
+        KW2096 = 1222,
+        KW2097 = 1223,
+        KW2098 = 1224,
+        KW2099 = 1225,
+        KW21 = 1226,
+        KW210 = 1227,
+        KW2100 = 1228,
+        KW2101 = 1229,
+        KW2102 = 1230,
+        KW2103 = 1231,
+        KW2104 = 1232,
+        KW2105 = 1233,
+        KW2106 = 1234,
+        KW2107 = 1235,
+        KW2108 = 1236,
+        KW2109 = 1237,
+        KW211 = 1238,
+        KW2110 = 1239,
+        KW2111 = 1240,
+        KW2112 = 1241,
+        KW2113 = 1242,
+        KW2114 = 1243,
+        KW2115 = 1244,
+        KW2116 = 1245,
+        KW2117 = 1246,
+        KW2118 = 1247,
+        KW2119 = 1248,
+        KW212 = 1249,
+        KW2120 = 1250,
+        KW2121 = 1251,
+        KW2122 = 1252,
+        KW2123 = 1253,
+        KW2124 = 1254,
+        KW2125 = 1255,
+        KW2126 = 1256,
+        KW2127 = 1257,
+        KW2128 = 1258,
+        KW2129 = 1259,
+        KW213 = 1260,
+        KW2130 = 1261,
+        KW2131 = 1262,
+        KW2132 = 1263,
+        KW2133 = 1264,
+        KW2134 = 1265,
+        KW2135 = 1266,
+        KW2136 = 1267,
+        KW2137 = 1268,
+        KW2138 = 1269,
+        KW2139 = 1270,
+        KW214 = 1271,
+        KW2140 = 1272,
+        KW2141 = 1273,
+        KW2142 = 1274,
+        KW2143 = 1275,
+        KW2144 = 1276,
+        KW2145 = 1277,
+        KW2146 = 1278,
+        KW2147 = 1279,
+        KW2148 = 1280,
+        KW2149 = 1281,
+        KW215 = 1282,
+        KW2150 = 1283,
+        KW2151 = 1284,
+        KW2152 = 1285,
+        KW2153 = 1286,
+        KW2154 = 1287,
+        KW2155 = 1288,
+        KW2156 = 1289,
+        KW2157 = 1290,
+        KW2158 = 1291,
+        KW2159 = 1292,
+        KW216 = 1293,
+        KW2160 = 1294,
+        KW2161 = 1295,
+        KW2162 = 1296,
+        KW2163 = 1297,
+        KW2164 = 1298,
+        KW2165 = 1299,
+        KW2166 = 1300,
+        KW2167 = 1301,
+        KW2168 = 1302,
+        KW2169 = 1303,
+        KW217 = 1304,
+        KW2170 = 1305,
+        KW2171 = 1306,
+        KW2172 = 1307,
+        KW2173 = 1308,
+        KW2174 = 1309,
+        KW2175 = 1310,
+        KW2176 = 1311,
+        KW2177 = 1312,
+        KW2178 = 1313,
+        KW2179 = 1314,
+        KW218 = 1315,
+        KW2180 = 1316,
+        KW2181 = 1317,
+        KW2182 = 1318,
+        KW2183 = 1319,
+        KW2184 = 1320,
+        KW2185 = 1321,
+        KW2186 = 1322,
+        KW2187 = 1323,
+        KW2188 = 1324,
+        KW2189 = 1325,
+        KW219 = 1326,
+        KW2190 = 1327,
+        KW2191 = 1328,
+        KW2192 = 1329,
+        KW2193 = 1330,
+        KW2194 = 1331,
+        KW2195 = 1332,
+        KW2196 = 1333,
+        KW2197 = 1334,
+        KW2198 = 1335,
+        KW2199 = 1336,
+        KW22 = 1337,
+        KW220 = 1338,
+        KW2200 = 1339,
+        KW2201 = 1340,
+        KW2202 = 1341,
+        KW2203 = 1342,
+        KW2204 = 1343,
+        KW2205 = 1344,
+        KW2206 = 1345,
+        KW2207 = 1346,
+        KW2208 = 1347,
+        KW2209 = 1348,
+        KW221 = 1349,
+        KW2210 = 1350,
+        KW2211 = 1351,
+        KW2212 = 1352,
+        KW2213 = 1353,
+        KW2214 = 1354,
+        KW2215 = 1355,
+        KW2216 = 1356,
+        KW2217 = 1357,
+        KW2218 = 1358,
+        KW2219 = 1359,
+        KW222 = 1360,
+        KW2220 = 1361,
+        KW2221 = 1362,
+        KW2222 = 1363,
+        KW2223 = 1364,
+        KW2224 = 1365,
+        KW2225 = 1366,
+        KW2226 = 1367,
+        KW2227 = 1368,
+        KW2228 = 1369,
+        KW2229 = 1370,
+        KW223 = 1371,
+        KW2230 = 1372,
+        KW2231 = 1373,
+        KW2232 = 1374,
+        KW2233 = 1375,
+        KW2234 = 1376,
+        KW2235 = 1377,
+        KW2236 = 1378,
+        KW2237 = 1379,
+        KW2238 = 1380,
+        KW2239 = 1381,
+        KW224 = 1382,
+        KW2240 = 1383,
+        KW2241 = 1384,
+        KW2242 = 1385,
+        KW2243 = 1386,
+        KW2244 = 1387,
+        KW2245 = 1388,
+        KW2246 = 1389,
+        KW2247 = 1390,
+        KW2248 = 1391,
+        KW2249 = 1392,
+        KW225 = 1393,
+        KW2250 = 1394,
+        KW2251 = 1395,
+        KW2252 = 1396,
+        KW2253 = 1397,
+        KW2254 = 1398,
+        KW2255 = 1399,
+        KW2256 = 1400,
+        KW2257 = 1401,
+        KW2258 = 1402,
+        KW2259 = 1403,
+        KW226 = 1404,
+        KW2260 = 1405,
+        KW2261 = 1406,
+        KW2262 = 1407,
+        KW2263 = 1408,
+        KW2264 = 1409,
+        KW2265 = 1410,
+        KW2266 = 1411,
+        KW2267 = 1412,
+        KW2268 = 1413,
+        KW2269 = 1414,
+        KW227 = 1415,
+        KW2270 = 1416,
+        KW2271 = 1417,
+        KW2272 = 1418,
+        KW2273 = 1419,
+        KW2274 = 1420,
+        KW2275 = 1421,
+        KW2276 = 1422,
+        KW2277 = 1423,
+        KW2278 = 1424,
+        KW2279 = 1425,
+        KW228 = 1426,
+        KW2280 = 1427,
+        KW2281 = 1428,
+        KW2282 = 1429,
+        KW2283 = 1430,
+        KW2284 = 1431,
+        KW2285 = 1432,
+        KW2286 = 1433,
+        KW2287 = 1434,
+        KW2288 = 1435,
+        KW2289 = 1436,
+        KW229 = 1437,
+        KW2290 = 1438,
+        KW2291 = 1439,
+        KW2292 = 1440,
+        KW2293 = 1441,
+        KW2294 = 1442,
+        KW2295 = 1443,
+        KW2296 = 1444,
+        KW2297 = 1445,
+        KW2298 = 1446,
+        KW2299 = 1447,
+        KW23 = 1448,
+        KW230 = 1449,
+        KW2300 = 1450,
+        KW2301 = 1451,
+        KW2302 = 1452,
+        KW2303 = 1453,
+        KW2304 = 1454,
+        KW2305 = 1455,
+        KW2306 = 1456,
+        KW2307 = 1457,
+        KW2308 = 1458,
+        KW2309 = 1459,
+        KW231 = 1460,
+        KW2310 = 1461,
+        KW2311 = 1462,
+        KW2312 = 1463,
+        KW2313 = 1464,
+        KW2314 = 1465,
+        KW2315 = 1466,
+        KW2316 = 1467,
+        KW2317 = 1468,
+        KW2318 = 1469,
+        KW2319 = 1470,
+        KW232 = 1471,
+        KW2320 = 1472,
+        KW2321 = 1473,
+        KW2322 = 1474,
+        KW2323 = 1475,
+        KW2324 = 1476,
+        KW2325 = 1477,
+        KW2326 = 1478,
+        KW2327 = 1479,
+        KW2328 = 1480,
+        KW2329 = 1481,
+        KW233 = 1482,
+        KW2330 = 1483,
+        KW2331 = 1484,
+        KW2332 = 1485,
+        KW2333 = 1486,
+        KW2334 = 1487,
+        KW2335 = 1488,
+        KW2336 = 1489,
+        KW2337 = 1490,
+        KW2338 = 1491,
+        KW2339 = 1492,
+        KW234 = 1493,
+        KW2340 = 1494,
+        KW2341 = 1495,
+        KW2342 = 1496,
+        KW2343 = 1497,
+        KW2344 = 1498,
+        KW2345 = 1499,
+        KW2346 = 1500,
+        KW2347 = 1501,
+        KW2348 = 1502,
+        KW2349 = 1503,
+        KW235 = 1504,
+        KW2350 = 1505,
+        KW2351 = 1506,
+        KW2352 = 1507,
+        KW2353 = 1508,
+        KW2354 = 1509,
+        KW2355 = 1510,
+        KW2356 = 1511,
+        KW2357 = 1512,
+        KW2358 = 1513,
+        KW2359 = 1514,
+        KW236 = 1515,
+        KW2360 = 1516,
+        KW2361 = 1517,
+        KW2362 = 1518,
+        KW2363 = 1519,
+        KW2364 = 1520,
+        KW2365 = 1521,
+        KW2366 = 1522,
+        KW2367 = 1523,
+        KW2368 = 1524,
+        KW2369 = 1525,
+        KW237 = 1526,
+        KW2370 = 1527,
+        KW2371 = 1528,
+        KW2372 = 1529,
+        KW2373 = 1530,
+        KW2374 = 1531,
+        KW2375 = 1532,
+        KW2376 = 1533,
+        KW2377 = 1534,
+        KW2378 = 1535,
+        KW2379 = 1536,
+        KW238 = 1537,
+        KW2380 = 1538,
+        KW2381 = 1539,
+        KW2382 = 1540,
+        KW2383 = 1541,
+        KW2384 = 1542,
+        KW2385 = 1543,
+        KW2386 = 1544,
+        KW2387 = 1545,
+        KW2388 = 1546,
+        KW2389 = 1547,
+        KW239 = 1548,
+        KW2390 = 1549,
+        KW2391 = 1550,
+        KW2392 = 1551,
+        KW2393 = 1552,
+        KW2394 = 1553,
+        KW2395 = 1554,
+        KW2396 = 1555,
+        KW2397 = 1556,
+        KW2398 = 1557,
+        KW2399 = 1558,
+        KW24 = 1559,
+        KW240 = 1560,
+        KW2400 = 1561,
+        KW2401 = 1562,
+        KW2402 = 1563,
+        KW2403 = 1564,
+        KW2404 = 1565,
+        KW2405 = 1566,
+        KW2406 = 1567,
+        KW2407 = 1568,
+        KW2408 = 1569,
+        KW2409 = 1570,
+        KW241 = 1571,
+        KW2410 = 1572,
+        KW2411 = 1573,
+        KW2412 = 1574,
+        KW2413 = 1575,
+        KW2414 = 1576,
+        KW2415 = 1577,
+        KW2416 = 1578,
+        KW2417 = 1579,
+        KW2418 = 1580,
+        KW2419 = 1581,
+        KW242 = 1582,
+        KW2420 = 1583,
+        KW2421 = 1584,
+        KW2422 = 1585,
+        KW2423 = 1586,
+        KW2424 = 1587,
+        KW2425 = 1588,
+        KW2426 = 1589,
+        KW2427 = 1590,
+        KW2428 = 1591,
+        KW2429 = 1592,
+        KW243 = 1593,
+        KW2430 = 1594,
+        KW2431 = 1595,
+        KW2432 = 1596,
+        KW2433 = 1597,
+        KW2434 = 1598,
+        KW2435 = 1599,
+        KW2436 = 1600,
+        KW2437 = 1601,
+        KW2438 = 1602,
+        KW2439 = 1603,
+        KW244 = 1604,
+        KW2440 = 1605,
+        KW2441 = 1606,
+        KW2442 = 1607,
+        KW2443 = 1608,
+        KW2444 = 1609,
+        KW2445 = 1610,
+        KW2446 = 1611,
+        KW2447 = 1612,
+        KW2448 = 1613,
+        KW2449 = 1614,
+        KW245 = 1615,
+        KW2450 = 1616,
+        KW2451 = 1617,
+        KW2452 = 1618,
+        KW2453 = 1619,
+        KW2454 = 1620,
+        KW2455 = 1621,
+        KW2456 = 1622,
+        KW2457 = 1623,
+        KW2458 = 1624,
+        KW2459 = 1625,
+        KW246 = 1626,
+        KW2460 = 1627,
+        KW2461 = 1628,
+        KW2462 = 1629,
+        KW2463 = 1630,
+        KW2464 = 1631,
+        KW2465 = 1632,
+        KW2466 = 1633,
+        KW2467 = 1634,
+        KW2468 = 1635,
+        KW2469 = 1636,
+        KW247 = 1637,
+        KW2470 = 1638,
+        KW2471 = 1639,
+        KW2472 = 1640,
+        KW2473 = 1641,
+        KW2474 = 1642,
+        KW2475 = 1643,
+        KW2476 = 1644,
+        KW2477 = 1645,
+        KW2478 = 1646,
+        KW2479 = 1647,
+        KW248 = 1648,
+        KW2480 = 1649,
+        KW2481 = 1650,
+        KW2482 = 1651,
+        KW2483 = 1652,
+        KW2484 = 1653,
+        KW2485 = 1654,
+        KW2486 = 1655,
+        KW2487 = 1656,
+        KW2488 = 1657,
+        KW2489 = 1658,
+        KW249 = 1659,
+        KW2490 = 1660,
+        KW2491 = 1661,
+        KW2492 = 1662,
+        KW2493 = 1663,
+        KW2494 = 1664,
+        KW2495 = 1665,
+        KW2496 = 1666,
+        KW2497 = 1667,
+        KW2498 = 1668,
+        KW2499 = 1669,
+        KW25 = 1670,
+        KW250 = 1671,
+        KW2500 = 1672,
+        KW2501 = 1673,
+        KW2502 = 1674,
+        KW2503 = 1675,
+        KW2504 = 1676,
+        KW2505 = 1677,
+        KW2506 = 1678,
+        KW2507 = 1679,
+        KW2508 = 1680,
+        KW2509 = 1681,
+        KW251 = 1682,
+        KW2510 = 1683,
+        KW2511 = 1684,
+        KW2512 = 1685,
+        KW2513 = 1686,
+        KW2514 = 1687,
+        KW2515 = 1688,
+        KW2516 = 1689,
+        KW2517 = 1690,
+        KW2518 = 1691,
+        KW2519 = 1692,
+        KW252 = 1693,
+        KW2520 = 1694,
+        KW2521 = 1695,
+        KW2522 = 1696,
+        KW2523 = 1697,
+        KW2524 = 1698,
+        KW2525 = 1699,
+        KW2526 = 1700,
+        KW2527 = 1701,
+        KW2528 = 1702,
+        KW2529 = 1703,
+        KW253 = 1704,
+        KW2530 = 1705,
+        KW2531 = 1706,
+        KW2532 = 1707,
+        KW2533 = 1708,
+        KW2534 = 1709,
+        KW2535 = 1710,
+        KW2536 = 1711,
+        KW2537 = 1712,
+        KW2538 = 1713,
+        KW2539 = 1714,
+        KW254 = 1715,
+        KW2540 = 1716,
+        KW2541 = 1717,
+        KW2542 = 1718,
+        KW2543 = 1719,
+        KW2544 = 1720,
+        KW2545 = 1721,
+        KW2546 = 1722,
+        KW2547 = 1723,
+        KW2548 = 1724,
+        KW2549 = 1725,
+        KW255 = 1726,
+        KW2550 = 1727,
+        KW2551 = 1728,
+        KW2552 = 1729,
+        KW2553 = 1730,
+        KW2554 = 1731,
+        KW2555 = 1732,
+        KW2556 = 1733,
+        KW2557 = 1734,
+        KW2558 = 1735,
+        KW2559 = 1736,
+        KW256 = 1737,
+        KW2560 = 1738,
+        KW2561 = 1739,
+        KW2562 = 1740,
+        KW2563 = 1741,
+        KW2564 = 1742,
+        KW2565 = 1743,
+        KW2566 = 1744,
+        KW2567 = 1745,
+        KW2568 = 1746,
+        KW2569 = 1747,
+        KW257 = 1748,
+        KW2570 = 1749,
+        KW2571 = 1750,
+        KW2572 = 1751,
+        KW2573 = 1752,
+        KW2574 = 1753,
+        KW2575 = 1754,
+        KW2576 = 1755,
+        KW2577 = 1756,
+        KW2578 = 1757,
+        KW2579 = 1758,
+        KW258 = 1759,
+        KW2580 = 1760,
+        KW2581 = 1761,
+        KW2582 = 1762,
+        KW2583 = 1763,
+        KW2584 = 1764,
+        KW2585 = 1765,
+        KW2586 = 1766,
+        KW2587 = 1767,
+        KW2588 = 1768,
+        KW2589 = 1769,
+        KW259 = 1770,
+        KW2590 = 1771,
+        KW2591 = 1772,
+        KW2592 = 1773,
+        KW2593 = 1774,
+        KW2594 = 1775,
+        KW2595 = 1776,
+        KW2596 = 1777,
+        KW2597 = 1778,
+        KW2598 = 1779,
+        KW2599 = 1780,
+        KW26 = 1781,
+        KW260 = 1782,
+        KW2600 = 1783,
+        KW2601 = 1784,
+        KW2602 = 1785,
+        KW2603 = 1786,
+        KW2604 = 1787,
+        KW2605 = 1788,
+        KW2606 = 1789,
+        KW2607 = 1790,
+        KW2608 = 1791,
+        KW2609 = 1792,
+        KW261 = 1793,
+        KW2610 = 1794,
+        KW2611 = 1795,
+        KW2612 = 1796,
+        KW2613 = 1797,
+        KW2614 = 1798,
+        KW2615 = 1799,
+        KW2616 = 1800,
+        KW2617 = 1801,
+        KW2618 = 1802,
+        KW2619 = 1803,
+        KW262 = 1804,
+        KW2620 = 1805,
+        KW2621 = 1806,
+        KW2622 = 1807,
+        KW2623 = 1808,
+        KW2624 = 1809,
+        KW2625 = 1810,
+        KW2626 = 1811,
+        KW2627 = 1812,
+        KW2628 = 1813,
+        KW2629 = 1814,
+        KW263 = 1815,
+        KW2630 = 1816,
+        KW2631 = 1817,
+        KW2632 = 1818,
+        KW2633 = 1819,
+        KW2634 = 1820,
+        KW2635 = 1821,
+        KW2636 = 1822,
+        KW2637 = 1823,
+        KW2638 = 1824,
+        KW2639 = 1825,
+        KW264 = 1826,
+        KW2640 = 1827,
+        KW2641 = 1828,
+        KW2642 = 1829,
+        KW2643 = 1830,
+        KW2644 = 1831,
+        KW2645 = 1832,
+        KW2646 = 1833,
+        KW2647 = 1834,
+        KW2648 = 1835,
+        KW2649 = 1836,
+        KW265 = 1837,
+        KW2650 = 1838,
+        KW2651 = 1839,
+        KW2652 = 1840,
+        KW2653 = 1841,
+        KW2654 = 1842,
+        KW2655 = 1843,
+        KW2656 = 1844,
+        KW2657 = 1845,
+        KW2658 = 1846,
+        KW2659 = 1847,
+        KW266 = 1848,
+        KW2660 = 1849,
+        KW2661 = 1850,
+        KW2662 = 1851,
+        KW2663 = 1852,
+        KW2664 = 1853,
+        KW2665 = 1854,
+        KW2666 = 1855,
+        KW2667 = 1856,
+        KW2668 = 1857,
+        KW2669 = 1858,
+        KW267 = 1859,
+        KW2670 = 1860,
+        KW2671 = 1861,
+        KW2672 = 1862,
+        KW2673 = 1863,
+        KW2674 = 1864,
+        KW2675 = 1865,
+        KW2676 = 1866,
+        KW2677 = 1867,
+        KW2678 = 1868,
+        KW2679 = 1869,
+        KW268 = 1870,
+        KW2680 = 1871,
+        KW2681 = 1872,
+        KW2682 = 1873,
+        KW2683 = 1874,
+        KW2684 = 1875,
+        KW2685 = 1876,
+        KW2686 = 1877,
+        KW2687 = 1878,
+        KW2688 = 1879,
+        KW2689 = 1880,
+        KW269 = 1881,
+        KW2690 = 1882,
+        KW2691 = 1883,
+        KW2692 = 1884,
+        KW2693 = 1885,
+        KW2694 = 1886,
+        KW2695 = 1887,
+        KW2696 = 1888,
+        KW2697 = 1889,
+        KW2698 = 1890,
+        KW2699 = 1891,
+        KW27 = 1892,
+        KW270 = 1893,
+        KW2700 = 1894,
+        KW2701 = 1895,
+        KW2702 = 1896,
+        KW2703 = 1897,
+        KW2704 = 1898,
+        KW2705 = 1899,
+        KW2706 = 1900,
+        KW2707 = 1901,
+        KW2708 = 1902,
+        KW2709 = 1903,
+        KW271 = 1904,
+        KW2710 = 1905,
+        KW2711 = 1906,
+        KW2712 = 1907,
+        KW2713 = 1908,
+        KW2714 = 1909,
+        KW2715 = 1910,
+        KW2716 = 1911,
+        KW2717 = 1912,
+        KW2718 = 1913,
+        KW2719 = 1914,
+        KW272 = 1915,
+        KW2720 = 1916,
+        KW2721 = 1917,
+        KW2722 = 1918,
+        KW2723 = 1919,
+        KW2724 = 1920,
+        KW2725 = 1921,
+        KW2726 = 1922,
+        KW2727 = 1923,
+        KW2728 = 1924,
+        KW2729 = 1925,
+        KW273 = 1926,
+        KW2730 = 1927,
+        KW2731 = 1928,
+        KW2732 = 1929,
+        KW2733 = 1930,
+        KW2734 = 1931,
+        KW2735 = 1932,
+        KW2736 = 1933,
+        KW2737 = 1934,
+        KW2738 = 1935,
+        KW2739 = 1936,
+        KW274 = 1937,
+        KW2740 = 1938,
+        KW2741 = 1939,
+        KW2742 = 1940,
+        KW2743 = 1941,
+        KW2744 = 1942,
+        KW2745 = 1943,
+        KW2746 = 1944,
+        KW2747 = 1945,
+        KW2748 = 1946,
+        KW2749 = 1947,
+        KW275 = 1948,
+        KW2750 = 1949,
+        KW2751 = 1950,
+        KW2752 = 1951,
+        KW2753 = 1952,
+        KW2754 = 1953,
+        KW2755 = 1954,
+        KW2756 = 1955,
+        KW2757 = 1956,
+        KW2758 = 1957,
+        KW2759 = 1958,
+        KW276 = 1959,
+        KW2760 = 1960,
+        KW2761 = 1961,
+        KW2762 = 1962,
+        KW2763 = 1963,
+        KW2764 = 1964,
+        KW2765 = 1965,
+        KW2766 = 1966,
+        KW2767 = 1967,
+        KW2768 = 1968,
+        KW2769 = 1969,
+        KW277 = 1970,
+        KW2770 = 1971,
+        KW2771 = 1972,
+        KW2772 = 1973,
+        KW2773 = 1974,
+        KW2774 = 1975,
+        KW2775 = 1976,
+        KW2776 = 1977,
+        KW2777 = 1978,
+        KW2778 = 1979,
+        KW2779 = 1980,
+        KW278 = 1981,
+        KW2780 = 1982,
+        KW2781 = 1983,
+        KW2782 = 1984,
+        KW2783 = 1985,
+        KW2784 = 1986,
+        KW2785 = 1987,
+        KW2786 = 1988,
+        KW2787 = 1989,
+        KW2788 = 1990,
+        KW2789 = 1991,
+        KW279 = 1992,
+        KW2790 = 1993,
+        KW2791 = 1994,
+        KW2792 = 1995,
+        KW2793 = 1996,
+        KW2794 = 1997,
+        KW2795 = 1998,
+        KW2796 = 1999,
+        KW2797 = 2000,
+        KW2798 = 2001,
+        KW2799 = 2002,
+        KW28 = 2003,
+        KW280 = 2004,
+        KW2800 = 2005,
+        KW2801 = 2006,
+        KW2802 = 2007,
+        KW2803 = 2008,
+        KW2804 = 2009,
+        KW2805 = 2010,
+        KW2806 = 2011,
+        KW2807 = 2012,
+        KW2808 = 2013,
+        KW2809 = 2014,
+        KW281 = 2015,
+        KW2810 = 2016,
+        KW2811 = 2017,
+        KW2812 = 2018,
+        KW2813 = 2019,
+        KW2814 = 2020,
+        KW2815 = 2021,
+        KW2816 = 2022,
+        KW2817 = 2023,
+        KW2818 = 2024,
+        KW2819 = 2025,
+        KW282 = 2026,
+        KW2820 = 2027,
+        KW2821 = 2028,
+        KW2822 = 2029,
+        KW2823 = 2030,
+        KW2824 = 2031,
+        KW2825 = 2032,
+        KW2826 = 2033,
+        KW2827 = 2034,
+        KW2828 = 2035,
+        KW2829 = 2036,
+        KW283 = 2037,
+        KW2830 = 2038,
+        KW2831 = 2039,
+        KW2832 = 2040,
+        KW2833 = 2041,
+        KW2834 = 2042,
+        KW2835 = 2043,
+        KW2836 = 2044,
+        KW2837 = 2045,
+        KW2838 = 2046,
+        KW2839 = 2047,
+        KW284 = 2048,
+        KW2840 = 2049,
+        KW2841 = 2050,
+        KW2842 = 2051,
+        KW2843 = 2052,
+        KW2844 = 2053,
+        KW2845 = 2054,
+        KW2846 = 2055,
+        KW2847 = 2056,
+        KW2848 = 2057,
+        KW2849 = 2058,
+        KW285 = 2059,
+        KW2850 = 2060,
+        KW2851 = 2061,
+        KW2852 = 2062,
+        KW2853 = 2063,
+        KW2854 = 2064,
+        KW2855 = 2065,
+        KW2856 = 2066,
+        KW2857 = 2067,
+        KW2858 = 2068,
+        KW2859 = 2069,
+        KW286 = 2070,
+        KW2860 = 2071,
+        KW2861 = 2072,
+        KW2862 = 2073,
+        KW2863 = 2074,
+        KW2864 = 2075,
+        KW2865 = 2076,
+        KW2866 = 2077,
+        KW2867 = 2078,
+        KW2868 = 2079,
+        KW2869 = 2080,
+        KW287 = 2081,
+        KW2870 = 2082,
+        KW2871 = 2083,
+        KW2872 = 2084,
+        KW2873 = 2085,
+        KW2874 = 2086,
+        KW2875 = 2087,
+        KW2876 = 2088,
+        KW2877 = 2089,
+        KW2878 = 2090,
+        KW2879 = 2091,
+        KW288 = 2092,
+        KW2880 = 2093,
+        KW2881 = 2094,
+        KW2882 = 2095,
+        KW2883 = 2096,
+        KW2884 = 2097,
+        KW2885 = 2098,
+        KW2886 = 2099,
+        KW2887 = 2100,
+        KW2888 = 2101,
+        KW2889 = 2102,
+        KW289 = 2103,
+        KW2890 = 2104,
+        KW2891 = 2105,
+        KW2892 = 2106,
+        KW2893 = 2107,
+        KW2894 = 2108,
+        KW2895 = 2109,
+        KW2896 = 2110,
+        KW2897 = 2111,
+        KW2898 = 2112,
+        KW2899 = 2113,
+        KW29 = 2114,
+        KW290 = 2115,
+        KW2900 = 2116,
+        KW2901 = 2117,
+        KW2902 = 2118,
+        KW2903 = 2119,
+        KW2904 = 2120,
+        KW2905 = 2121,
+        KW2906 = 2122,
+        KW2907 = 2123,
+        KW2908 = 2124,
+        KW2909 = 2125,
+        KW291 = 2126,
+        KW2910 = 2127,
+        KW2911 = 2128,
+        KW2912 = 2129,
+        KW2913 = 2130,
+        KW2914 = 2131,
+        KW2915 = 2132,
+        KW2916 = 2133,
+        KW2917 = 2134,
+        KW2918 = 2135,
+        KW2919 = 2136,
+        KW292 = 2137,
+        KW2920 = 2138,
+        KW2921 = 2139,
+        KW2922 = 2140,
+        KW2923 = 2141,
+        KW2924 = 2142,
+        KW2925 = 2143,
+        KW2926 = 2144,
+        KW2927 = 2145,
+        KW2928 = 2146,
+        KW2929 = 2147,
+        KW293 = 2148,
+        KW2930 = 2149,
+        KW2931 = 2150,
+        KW2932 = 2151,
+        KW2933 = 2152,
+        KW2934 = 2153,
+        KW2935 = 2154,
+        KW2936 = 2155,
+        KW2937 = 2156,
+        KW2938 = 2157,
+        KW2939 = 2158,
+        KW294 = 2159,
+        KW2940 = 2160,
+        KW2941 = 2161,
+        KW2942 = 2162,
+        KW2943 = 2163,
+        KW2944 = 2164,
+        KW2945 = 2165,
+        KW2946 = 2166,
+        KW2947 = 2167,
+        KW2948 = 2168,
+        KW2949 = 2169,
+        KW295 = 2170,
+        KW2950 = 2171,
+        KW2951 = 2172,
+        KW2952 = 2173,
+        KW2953 = 2174,
+        KW2954 = 2175,
+        KW2955 = 2176,
+        KW2956 = 2177,
+        KW2957 = 2178,
+        KW2958 = 2179,
+        KW2959 = 2180,
+        KW296 = 2181,
+        KW2960 = 2182,
+        KW2961 = 2183,
+        KW2962 = 2184,
+        KW2963 = 2185,
+        KW2964 = 2186,
+        KW2965 = 2187,
+        KW2966 = 2188,
+        KW2967 = 2189,
+        KW2968 = 2190,
+        KW2969 = 2191,
+        KW297 = 2192,
+        KW2970 = 2193,
+        KW2971 = 2194,
+        KW2972 = 2195,
+        KW2973 = 2196,
+        KW2974 = 2197,
+        KW2975 = 2198,
+        KW2976 = 2199,
+        KW2977 = 2200,
+        KW2978 = 2201,
+        KW2979 = 2202,
+        KW298 = 2203,
+        KW2980 = 2204,
+        KW2981 = 2205,
+        KW2982 = 2206,
+        KW2983 = 2207,
+        KW2984 = 2208,
+        KW2985 = 2209,
+        KW2986 = 2210,
+        KW2987 = 2211,
+        KW2988 = 2212,
+        KW2989 = 2213,
+        KW299 = 2214,
+        KW2990 = 2215,
+        KW2991 = 2216,
+        KW2992 = 2217,
+        KW2993 = 2218,
+        KW2994 = 2219,
+        KW2995 = 2220,
+        KW2996 = 2221,
+        KW2997 = 2222,
+        KW2998 = 2223,
+        KW2999 = 2224,
+        KW3 = 2225,
+        KW30 = 2226,
+        KW300 = 2227,
+        KW3000 = 2228,
+        KW3001 = 2229,
+        KW3002 = 2230,
+        KW3003 = 2231,
+        KW3004 = 2232,
+        KW3005 = 2233,
+        KW3006 = 2234,
+        KW3007 = 2235,
+        KW3008 = 2236,
+        KW3009 = 2237,
+        KW301 = 2238,
+        KW3010 = 2239,
+        KW3011 = 2240,
+        KW3012 = 2241,
+        KW3013 = 2242,
+        KW3014 = 2243,
+        KW3015 = 2244,
+        KW3016 = 2245,
+        KW3017 = 2246,
+        KW3018 = 2247,
+        KW3019 = 2248,
+        KW302 = 2249,
+        KW3020 = 2250,
+        KW3021 = 2251,
+        KW3022 = 2252,
+        KW3023 = 2253,
+        KW3024 = 2254,
+        KW3025 = 2255,
+        KW3026 = 2256,
+        KW3027 = 2257,
+        KW3028 = 2258,
+        KW3029 = 2259,
+        KW303 = 2260,
+        KW3030 = 2261,
+        KW3031 = 2262,
+        KW3032 = 2263,
+        KW3033 = 2264,
+        KW3034 = 2265,
+        KW3035 = 2266,
+        KW3036 = 2267,
+        KW3037 = 2268,
+        KW3038 = 2269,
+        KW3039 = 2270,
+        KW304 = 2271,
+        KW3040 = 2272,
+        KW3041 = 2273,
+        KW3042 = 2274,
+        KW3043 = 2275,
+        KW3044 = 2276,
+        KW3045 = 2277,
+        KW3046 = 2278,
+        KW3047 = 2279,
+        KW3048 = 2280,
+        KW3049 = 2281,
+        KW305 = 2282,
+        KW3050 = 2283,
+        KW3051 = 2284,
+        KW3052 = 2285,
+        KW3053 = 2286,
+        KW3054 = 2287,
+        KW3055 = 2288,
+        KW3056 = 2289,
+        KW3057 = 2290,
+        KW3058 = 2291,
+        KW3059 = 2292,
+        KW306 = 2293,
+        KW3060 = 2294,
+        KW3061 = 2295,
+        KW3062 = 2296,
+        KW3063 = 2297,
+        KW3064 = 2298,
+        KW3065 = 2299,
+        KW3066 = 2300,
+        KW3067 = 2301,
+        KW3068 = 2302,
+        KW3069 = 2303,
+        KW307 = 2304,
+        KW3070 = 2305,
+        KW3071 = 2306,
+        KW3072 = 2307,
+        KW3073 = 2308,
+        KW3074 = 2309,
+        KW3075 = 2310,
+        KW3076 = 2311,
+        KW3077 = 2312,
+        KW3078 = 2313,
+        KW3079 = 2314,
+        KW308 = 2315,
+        KW3080 = 2316,
+        KW3081 = 2317,
+        KW3082 = 2318,
+        KW3083 = 2319,
+        KW3084 = 2320,
+        KW3085 = 2321,
+        KW3086 = 2322,
+        KW3087 = 2323,
+        KW3088 = 2324,
+        KW3089 = 2325,
+        KW309 = 2326,
+        KW3090 = 2327,
+        KW3091 = 2328,
+        KW3092 = 2329,
+        KW3093 = 2330,
+        KW3094 = 2331,
+        KW3095 = 2332,
+        KW3096 = 2333,
+        KW3097 = 2334,
+        KW3098 = 2335,
+        KW3099 = 2336,
+        KW31 = 2337,
+        KW310 = 2338,
+        KW3100 = 2339,
+        KW3101 = 2340,
+        KW3102 = 2341,
+        KW3103 = 2342,
+        KW3104 = 2343,
+        KW3105 = 2344,
+        KW3106 = 2345,
+        KW3107 = 2346,
+        KW3108 = 2347,
+        KW3109 = 2348,
+        KW311 = 2349,
+        KW3110 = 2350,
+        KW3111 = 2351,
+        KW3112 = 2352,
+        KW3113 = 2353,
+        KW3114 = 2354,
+        KW3115 = 2355,
+        KW3116 = 2356,
+        KW3117 = 2357,
+        KW3118 = 2358,
+        KW3119 = 2359,
+        KW312 = 2360,
+        KW3120 = 2361,
+        KW3121 = 2362,
+        KW3122 = 2363,
+        KW3123 = 2364,
+        KW3124 = 2365,
+        KW3125 = 2366,
+        KW3126 = 2367,
+        KW3127 = 2368,
+        KW3128 = 2369,
+        KW3129 = 2370,
+        KW313 = 2371,
+        KW3130 = 2372,
+        KW3131 = 2373,
+        KW3132 = 2374,
+        KW3133 = 2375,
+        KW3134 = 2376,
+        KW3135 = 2377,
+        KW3136 = 2378,
+        KW3137 = 2379,
+        KW3138 = 2380,
+        KW3139 = 2381,
+        KW314 = 2382,
+        KW3140 = 2383,
+        KW3141 = 2384,
+        KW3142 = 2385,
+        KW3143 = 2386,
+        KW3144 = 2387,
+        KW3145 = 2388,
+        KW3146 = 2389,
+        KW3147 = 2390,
+        KW3148 = 2391,
+        KW3149 = 2392,
+        KW315 = 2393,
+        KW3150 = 2394,
+        KW3151 = 2395,
+        KW3152 = 2396,
+        KW3153 = 2397,
+        KW3154 = 2398,
+        KW3155 = 2399,
+        KW3156 = 2400,
+        KW3157 = 2401,
+        KW3158 = 2402,
+        KW3159 = 2403,
+        KW316 = 2404,
+        KW3160 = 2405,
+        KW3161 = 2406,
+        KW3162 = 2407,
+        KW3163 = 2408,
+        KW3164 = 2409,
+        KW3165 = 2410,
+        KW3166 = 2411,
+        KW3167 = 2412,
+        KW3168 = 2413,
+        KW3169 = 2414,
+        KW317 = 2415,
+        KW3170 = 2416,
+        KW3171 = 2417,
+        KW3172 = 2418,
+        KW3173 = 2419,
+        KW3174 = 2420,
+        KW3175 = 2421,
+        KW3176 = 2422,
+        KW3177 = 2423,
+        KW3178 = 2424,
+        KW3179 = 2425,
+        KW318 = 2426,
+        KW3180 = 2427,
+        KW3181 = 2428,
+        KW3182 = 2429,
+        KW3183 = 2430,
+        KW3184 = 2431,
+        KW3185 = 2432,
+        KW3186 = 2433,
+        KW3187 = 2434,
+        KW3188 = 2435,
+        KW3189 = 2436,
+        KW319 = 2437,
+        KW3190 = 2438,
+        KW3191 = 2439,
+        KW3192 = 2440,
+        KW3193 = 2441,
+        KW3194 = 2442,
+        KW3195 = 2443,
+        KW3196 = 2444,
+        KW3197 = 2445,
+        KW3198 = 2446,
+        KW3199 = 2447,
+        KW32 = 2448,
+        KW320 = 2449,
+        KW3200 = 2450,
+        KW3201 = 2451,
+        KW3202 = 2452,
+        KW3203 = 2453,
+        KW3204 = 2454,
+        KW3205 = 2455,
+        KW3206 = 2456,
+        KW3207 = 2457,
+        KW3208 = 2458,
+        KW3209 = 2459,
+        KW321 = 2460,
+        KW3210 = 2461,
+        KW3211 = 2462,
+        KW3212 = 2463,
+        KW3213 = 2464,
+        KW3214 = 2465,
+        KW3215 = 2466,
+        KW3216 = 2467,
+        KW3217 = 2468,
+        KW3218 = 2469,
+        KW3219 = 2470,
+        KW322 = 2471,
+        KW3220 = 2472,
+        KW3221 = 2473,
+        KW3222 = 2474,
+        KW3223 = 2475,
+        KW3224 = 2476,
+        KW3225 = 2477,
+        KW3226 = 2478,
+        KW3227 = 2479,
+        KW3228 = 2480,
+        KW3229 = 2481,
+        KW323 = 2482,
+        KW3230 = 2483,
+        KW3231 = 2484,
+        KW3232 = 2485,
+        KW3233 = 2486,
+        KW3234 = 2487,
+        KW3235 = 2488,
+        KW3236 = 2489,
+        KW3237 = 2490,
+        KW3238 = 2491,
+        KW3239 = 2492,
+        KW324 = 2493,
+        KW3240 = 2494,
+        KW3241 = 2495,
+        KW3242 = 2496,
+        KW3243 = 2497,
+        KW3244 = 2498,
+        KW3245 = 2499,
+        KW3246 = 2500,
+        KW3247 = 2501,
+        KW3248 = 2502,
+        KW3249 = 2503,
+        KW325 = 2504,
+        KW3250 = 2505,
+        KW3251 = 2506,
+        KW3252 = 2507,
+        KW3253 = 2508,
+        KW3254 = 2509,
+        KW3255 = 2510,
+        KW3256 = 2511,
+        KW3257 = 2512,
+        KW3258 = 2513,
+        KW3259 = 2514,
+        KW326 = 2515,
+        KW3260 = 2516,
+        KW3261 = 2517,
+        KW3262 = 2518,
+        KW3263 = 2519,
+        KW3264 = 2520,
+        KW3265 = 2521,
+        KW3266 = 2522,
+        KW3267 = 2523,
+        KW3268 = 2524,
+        KW3269 = 2525,
+        KW327 = 2526,
+        KW3270 = 2527,
+        KW3271 = 2528,
+        KW3272 = 2529,
+        KW3273 = 2530,
+        KW3274 = 2531,
+        KW3275 = 2532,
+        KW3276 = 2533,
+        KW3277 = 2534,
+        KW3278 = 2535,
+        KW3279 = 2536,
+        KW328 = 2537,
+        KW3280 = 2538,
+        KW3281 = 2539,
+        KW3282 = 2540,
+        KW3283 = 2541,
+        KW3284 = 2542,
+        KW3285 = 2543,
+        KW3286 = 2544,
+        KW3287 = 2545,
+        KW3288 = 2546,
+        KW3289 = 2547,
+        KW329 = 2548,
+        KW3290 = 2549,
+        KW3291 = 2550,
+        KW3292 = 2551,
+        KW3293 = 2552,
+        KW3294 = 2553,
+        KW3295 = 2554,
+        KW3296 = 2555,
+        KW3297 = 2556,
+        KW3298 = 2557,
+        KW3299 = 2558,
+        KW33 = 2559,
+        KW330 = 2560,
+        KW3300 = 2561,
+        KW3301 = 2562,
+        KW3302 = 2563,
+        KW3303 = 2564,
+        KW3304 = 2565,
+        KW3305 = 2566,
+        KW3306 = 2567,
+        KW3307 = 2568,
+        KW3308 = 2569,
+        KW3309 = 2570,
+        KW331 = 2571,
+        KW3310 = 2572,
+        KW3311 = 2573,
+        KW3312 = 2574,
+        KW3313 = 2575,
+        KW3314 = 2576,
+        KW3315 = 2577,
+        KW3316 = 2578,
+        KW3317 = 2579,
+        KW3318 = 2580,
+        KW3319 = 2581,
+        KW332 = 2582,
+        KW3320 = 2583,
+        KW3321 = 2584,
+        KW3322 = 2585,
+        KW3323 = 2586,
+        KW3324 = 2587,
+        KW3325 = 2588,
+        KW3326 = 2589,
+        KW3327 = 2590,
+        KW3328 = 2591,
+        KW3329 = 2592,
+        KW333 = 2593,
+        KW3330 = 2594,
+        KW3331 = 2595,
+        KW3332 = 2596,
+        KW3333 = 2597,
+        KW3334 = 2598,
+        KW3335 = 2599,
+        KW3336 = 2600,
+        KW3337 = 2601,
+        KW3338 = 2602,
+        KW3339 = 2603,
+        KW334 = 2604,
+        KW3340 = 2605,
+        KW3341 = 2606,
+        KW3342 = 2607,
+        KW3343 = 2608,
+        KW3344 = 2609,
+        KW3345 = 2610,
+        KW3346 = 2611,
+        KW3347 = 2612,
+        KW3348 = 2613,
+        KW3349 = 2614,
+        KW335 = 2615,
+        KW3350 = 2616,
+        KW3351 = 2617,
+        KW3352 = 2618,
+        KW3353 = 2619,
+        KW3354 = 2620,
+        KW3355 = 2621,
+        KW3356 = 2622,
+        KW3357 = 2623,
+        KW3358 = 2624,
+        KW3359 = 2625,
+        KW336 = 2626,
+        KW3360 = 2627,
+        KW3361 = 2628,
+        KW3362 = 2629,
+        KW3363 = 2630,
+        KW3364 = 2631,
+        KW3365 = 2632,
+        KW3366 = 2633,
+        KW3367 = 2634,
+        KW3368 = 2635,
+        KW3369 = 2636,
+        KW337 = 2637,
+        KW3370 = 2638,
+        KW3371 = 2639,
+        KW3372 = 2640,
+        KW3373 = 2641,
+        KW3374 = 2642,
+        KW3375 = 2643,
+        KW3376 = 2644,
+        KW3377 = 2645,
+        KW3378 = 2646,
+        KW3379 = 2647,
+        KW338 = 2648,
+        KW3380 = 2649,
+        KW3381 = 2650,
+        KW3382 = 2651,
+        KW3383 = 2652,
+        KW3384 = 2653,
+        KW3385 = 2654,
+        KW3386 = 2655,
+        KW3387 = 2656,
+        KW3388 = 2657,
+        KW3389 = 2658,
+        KW339 = 2659,
+        KW3390 = 2660,
+        KW3391 = 2661,
+        KW3392 = 2662,
+        KW3393 = 2663,
+        KW3394 = 2664,
+        KW3395 = 2665,
+        KW3396 = 2666,
+        KW3397 = 2667,
+        KW3398 = 2668,
+        KW3399 = 2669,
+        KW34 = 2670,
+        KW340 = 2671,
+        KW3400 = 2672,
+        KW3401 = 2673,
+        KW3402 = 2674,
+        KW3403 = 2675,
+        KW3404 = 2676,
+        KW3405 = 2677,
+        KW3406 = 2678,
+        KW3407 = 2679,
+        KW3408 = 2680,
+        KW3409 = 2681,
+        KW341 = 2682,
+        KW3410 = 2683,
+        KW3411 = 2684,
+        KW3412 = 2685,
+        KW3413 = 2686,
+        KW3414 = 2687,
+        KW3415 = 2688,
+        KW3416 = 2689,
+        KW3417 = 2690,
+        KW3418 = 2691,
+        KW3419 = 2692,
+        KW342 = 2693,
+        KW3420 = 2694,
+        KW3421 = 2695,
+        KW3422 = 2696,
+        KW3423 = 2697,
+        KW3424 = 2698,
+        KW3425 = 2699,
+        KW3426 = 2700,
+        KW3427 = 2701,
+        KW3428 = 2702,
+        KW3429 = 2703,
+        KW343 = 2704,
+        KW3430 = 2705,
+        KW3431 = 2706,
+        KW3432 = 2707,
+        KW3433 = 2708,
+        KW3434 = 2709,
+        KW3435 = 2710,
+        KW3436 = 2711,
+        KW3437 = 2712,
+        KW3438 = 2713,
+        KW3439 = 2714,
+        KW344 = 2715,
+        KW3440 = 2716,
+        KW3441 = 2717,
+        KW3442 = 2718,
+        KW3443 = 2719,
+        KW3444 = 2720,
+        KW3445 = 2721,
+        KW3446 = 2722,
+        KW3447 = 2723,
+        KW3448 = 2724,
+        KW3449 = 2725,
+        KW345 = 2726,
+        KW3450 = 2727,
+        KW3451 = 2728,
+        KW3452 = 2729,
+        KW3453 = 2730,
+        KW3454 = 2731,
+        KW3455 = 2732,
+        KW3456 = 2733,
+        KW3457 = 2734,
+        KW3458 = 2735,
+        KW3459 = 2736,
+        KW346 = 2737,
+        KW3460 = 2738,
+        KW3461 = 2739,
+        KW3462 = 2740,
+        KW3463 = 2741,
+        KW3464 = 2742,
+        KW3465 = 2743,
+        KW3466 = 2744,
+        KW3467 = 2745,
+        KW3468 = 2746,
+        KW3469 = 2747,
+        KW347 = 2748,
+        KW3470 = 2749,
+        KW3471 = 2750,
+        KW3472 = 2751,
+        KW3473 = 2752,
+        KW3474 = 2753,
+        KW3475 = 2754,
+        KW3476 = 2755,
+        KW3477 = 2756,
+        KW3478 = 2757,
+        KW3479 = 2758,
+        KW348 = 2759,
+        KW3480 = 2760,
+        KW3481 = 2761,
+        KW3482 = 2762,
+        KW3483 = 2763,
+        KW3484 = 2764,
+        KW3485 = 2765,
+        KW3486 = 2766,
+        KW3487 = 2767,
+        KW3488 = 2768,
+        KW3489 = 2769,
+        KW349 = 2770,
+        KW3490 = 2771,
+        KW3491 = 2772,
+        KW3492 = 2773,
+        KW3493 = 2774,
+        KW3494 = 2775,
+        KW3495 = 2776,
+        KW3496 = 2777,
+        KW3497 = 2778,
+        KW3498 = 2779,
+        KW3499 = 2780,
+        KW35 = 2781,
+        KW350 = 2782,
+        KW3500 = 2783,
+        KW3501 = 2784,
+        KW3502 = 2785,
+        KW3503 = 2786,
+        KW3504 = 2787,
+        KW3505 = 2788,
+        KW3506 = 2789,
+        KW3507 = 2790,
+        KW3508 = 2791,
+        KW3509 = 2792,
+        KW351 = 2793,
+        KW3510 = 2794,
+        KW3511 = 2795,
+        KW3512 = 2796,
+        KW3513 = 2797,
+        KW3514 = 2798,
+        KW3515 = 2799,
+        KW3516 = 2800,
+        KW3517 = 2801,
+        KW3518 = 2802,
+        KW3519 = 2803,
+        KW352 = 2804,
+        KW3520 = 2805,
+        KW3521 = 2806,
+        KW3522 = 2807,
+        KW3523 = 2808,
+        KW3524 = 2809,
+        KW3525 = 2810,
+        KW3526 = 2811,
+        KW3527 = 2812,
+        KW3528 = 2813,
+        KW3529 = 2814,
+        KW353 = 2815,
+        KW3530 = 2816,
+        KW3531 = 2817,
+        KW3532 = 2818,
+        KW3533 = 2819,
+        KW3534 = 2820,
+        KW3535 = 2821,
+        KW3536 = 2822,
+        KW3537 = 2823,
+        KW3538 = 2824,
+        KW3539 = 2825,
+        KW354 = 2826,
+        KW3540 = 2827,
+        KW3541 = 2828,
+        KW3542 = 2829,
+        KW3543 = 2830,
+        KW3544 = 2831,
+        KW3545 = 2832,
+        KW3546 = 2833,
+        KW3547 = 2834,
+        KW3548 = 2835,
+        KW3549 = 2836,
+        KW355 = 2837,
+        KW3550 = 2838,
+        KW3551 = 2839,
+        KW3552 = 2840,
+        KW3553 = 2841,
+        KW3554 = 2842,
+        KW3555 = 2843,
+        KW3556 = 2844,
+        KW3557 = 2845,
+        KW3558 = 2846,
+        KW3559 = 2847,
+        KW356 = 2848,
+        KW3560 = 2849,
+        KW3561 = 2850,
+        KW3562 = 2851,
+        KW3563 = 2852,
+        KW3564 = 2853,
+        KW3565 = 2854,
+        KW3566 = 2855,
+        KW3567 = 2856,
+        KW3568 = 2857,
+        KW3569 = 2858,
+        KW357 = 2859,
+        KW3570 = 2860,
+        KW3571 = 2861,
+        KW3572 = 2862,
+        KW3573 = 2863,
+        KW3574 = 2864,
+        KW3575 = 2865,
+        KW3576 = 2866,
+        KW3577 = 2867,
+        KW3578 = 2868,
+        KW3579 = 2869,
+        KW358 = 2870,
+        KW3580 = 2871,
+        KW3581 = 2872,
+        KW3582 = 2873,
+        KW3583 = 2874,
+        KW3584 = 2875,
+        KW3585 = 2876,
+        KW3586 = 2877,
+        KW3587 = 2878,
+        KW3588 = 2879,
+        KW3589 = 2880,
+        KW359 = 2881,
+        KW3590 = 2882,
+        KW3591 = 2883,
+        KW3592 = 2884,
+        KW3593 = 2885,
+        KW3594 = 2886,
+        KW3595 = 2887,
+        KW3596 = 2888,
+        KW3597 = 2889,
+        KW3598 = 2890,
+        KW3599 = 2891,
+        KW36 = 2892,
+        KW360 = 2893,
+        KW3600 = 2894,
+        KW3601 = 2895,
+        KW3602 = 2896,
+        KW3603 = 2897,
+        KW3604 = 2898,
+        KW3605 = 2899,
+        KW3606 = 2900,
+        KW3607 = 2901,
+        KW3608 = 2902,
+        KW3609 = 2903,
+        KW361 = 2904,
+        KW3610 = 2905,
+        KW3611 = 2906,
+        KW3612 = 2907,
+        KW3613 = 2908,
+        KW3614 = 2909,
+        KW3615 = 2910,
+        KW3616 = 2911,
+        KW3617 = 2912,
+        KW3618 = 2913,
+        KW3619 = 2914,
+        KW362 = 2915,
+        KW3620 = 2916,
+        KW3621 = 2917,
+        KW3622 = 2918,
+        KW3623 = 2919,
+        KW3624 = 2920,
+        KW3625 = 2921,
+        KW3626 = 2922,
+        KW3627 = 2923,
+        KW3628 = 2924,
+        KW3629 = 2925,
+        KW363 = 2926,
+        KW3630 = 2927,
+        KW3631 = 2928,
+        KW3632 = 2929,
+        KW3633 = 2930,
+        KW3634 = 2931,
+        KW3635 = 2932,
+        KW3636 = 2933,
+        KW3637 = 2934,
+        KW3638 = 2935,
+        KW3639 = 2936,
+        KW364 = 2937,
+        KW3640 = 2938,
+        KW3641 = 2939,
+        KW3642 = 2940,
+        KW3643 = 2941,
+        KW3644 = 2942,
+        KW3645 = 2943,
+        KW3646 = 2944,
+        KW3647 = 2945,
+        KW3648 = 2946,
+        KW3649 = 2947,
+        KW365 = 2948,
+        KW3650 = 2949,
+        KW3651 = 2950,
+        KW3652 = 2951,
+        KW3653 = 2952,
+        KW3654 = 2953,
+        KW3655 = 2954,
+        KW3656 = 2955,
+        KW3657 = 2956,
+        KW3658 = 2957,
+        KW3659 = 2958,
+        KW366 = 2959,
+        KW3660 = 2960,
+        KW3661 = 2961,
+        KW3662 = 2962,
+        KW3663 = 2963,
+        KW3664 = 2964,
+        KW3665 = 2965,
+        KW3666 = 2966,
+        KW3667 = 2967,
+        KW3668 = 2968,
+        KW3669 = 2969,
+        KW367 = 2970,
+        KW3670 = 2971,
+        KW3671 = 2972,
+        KW3672 = 2973,
+        KW3673 = 2974,
+        KW3674 = 2975,
+        KW3675 = 2976,
+        KW3676 = 2977,
+        KW3677 = 2978,
+        KW3678 = 2979,
+        KW3679 = 2980,
+        KW368 = 2981,
+        KW3680 = 2982,
+        KW3681 = 2983,
+        KW3682 = 2984,
+        KW3683 = 2985,
+        KW3684 = 2986,
+        KW3685 = 2987,
+        KW3686 = 2988,
+        KW3687 = 2989,
+        KW3688 = 2990,
+        KW3689 = 2991,
+        KW369 = 2992,
+        KW3690 = 2993,
+        KW3691 = 2994,
+        KW3692 = 2995,
+        KW3693 = 2996,
+        KW3694 = 2997,
+        KW3695 = 2998,
+        KW3696 = 2999,
+        KW3697 = 3000,
+        KW3698 = 3001,
+        KW3699 = 3002,
+        KW37 = 3003,
+        KW370 = 3004,
+        KW3700 = 3005,
+        KW3701 = 3006,
+        KW3702 = 3007,
+        KW3703 = 3008,
+        KW3704 = 3009,
+        KW3705 = 3010,
+        KW3706 = 3011,
+        KW3707 = 3012,
+        KW3708 = 3013,
+        KW3709 = 3014,
+        KW371 = 3015,
+        KW3710 = 3016,
+        KW3711 = 3017,
+        KW3712 = 3018,
+        KW3713 = 3019,
+        KW3714 = 3020,
+        KW3715 = 3021,
+        KW3716 = 3022,
+        KW3717 = 3023,
+        KW3718 = 3024,
+        KW3719 = 3025,
+        KW372 = 3026,
+        KW3720 = 3027,
+        KW3721 = 3028,
+        KW3722 = 3029,
+        KW3723 = 3030,
+        KW3724 = 3031,
+        KW3725 = 3032,
+        KW3726 = 3033,
+        KW3727 = 3034,
+        KW3728 = 3035,
+        KW3729 = 3036,
+        KW373 = 3037,
+        KW3730 = 3038,
+        KW3731 = 3039,
+        KW3732 = 3040,
+        KW3733 = 3041,
+        KW3734 = 3042,
+        KW3735 = 3043,
+        KW3736 = 3044,
+        KW3737 = 3045,
+        KW3738 = 3046,
+        KW3739 = 3047,
+        KW374 = 3048,
+        KW3740 = 3049,
+        KW3741 = 3050,
+        KW3742 = 3051,
+        KW3743 = 3052,
+        KW3744 = 3053,
+        KW3745 = 3054,
+        KW3746 = 3055,
+        KW3747 = 3056,
+        KW3748 = 3057,
+        KW3749 = 3058,
+        KW375 = 3059,
+        KW3750 = 3060,
+        KW3751 = 3061,
+        KW3752 = 3062,
+        KW3753 = 3063,
+        KW3754 = 3064,
+        KW3755 = 3065,
+        KW3756 = 3066,
+        KW3757 = 3067,
+        KW3758 = 3068,
+        KW3759 = 3069,
+        KW376 = 3070,
+        KW3760 = 3071,
+        KW3761 = 3072,
+        KW3762 = 3073,
+        KW3763 = 3074,
+        KW3764 = 3075,
+        KW3765 = 3076,
+        KW3766 = 3077,
+        KW3767 = 3078,
+        KW3768 = 3079,
+        KW3769 = 3080,
+        KW377 = 3081,
+        KW3770 = 3082,
+        KW3771 = 3083,
+        KW3772 = 3084,
+        KW3773 = 3085,
+        KW3774 = 3086,
+        KW3775 = 3087,
+        KW3776 = 3088,
+        KW3777 = 3089,
+        KW3778 = 3090,
+        KW3779 = 3091,
+        KW378 = 3092,
+        KW3780 = 3093,
+        KW3781 = 3094,
+        KW3782 = 3095,
+        KW3783 = 3096,
+        KW3784 = 3097,
+        KW3785 = 3098,
+        KW3786 = 3099,
+        KW3787 = 3100,
+        KW3788 = 3101,
+        KW3789 = 3102,
+        KW379 = 3103,
+        KW3790 = 3104,
+        KW3791 = 3105,
+        KW3792 = 3106,
+        KW3793 = 3107,
+        KW3794 = 3108,
+        KW3795 = 3109,
+        KW3796 = 3110,
+        KW3797 = 3111,
+        KW3798 = 3112,
+        KW3799 = 3113,
+        KW38 = 3114,
+        KW380 = 3115,
+        KW3800 = 3116,
+        KW3801 = 3117,
+        KW3802 = 3118,
+        KW3803 = 3119,
+        KW3804 = 3120,
+        KW3805 = 3121,
+        KW3806 = 3122,
+        KW3807 = 3123,
+        KW3808 = 3124,
+        KW3809 = 3125,
+        KW381 = 3126,
+        KW3810 = 3127,
+        KW3811 = 3128,
+        KW3812 = 3129,
+        KW3813 = 3130,
+        KW3814 = 3131,
+        KW3815 = 3132,
+        KW3816 = 3133,
+        KW3817 = 3134,
+        KW3818 = 3135,
+        KW3819 = 3136,
+        KW382 = 3137,
+        KW3820 = 3138,
+        KW3821 = 3139,
+        KW3822 = 3140,
+        KW3823 = 3141,
+        KW3824 = 3142,
+        KW3825 = 3143,
+        KW3826 = 3144,
+        KW3827 = 3145,
+        KW3828 = 3146,
+        KW3829 = 3147,
+        KW383 = 3148,
+        KW3830 = 3149,
+        KW3831 = 3150,
+        KW3832 = 3151,
+        KW3833 = 3152,
+        KW3834 = 3153,
+        KW3835 = 3154,
+        KW3836 = 3155,
+        KW3837 = 3156,
+        KW3838 = 3157,
+        KW3839 = 3158,
+        KW384 = 3159,
+        KW3840 = 3160,
+        KW3841 = 3161,
+        KW3842 = 3162,
+        KW3843 = 3163,
+        KW3844 = 3164,
+        KW3845 = 3165,
+        KW3846 = 3166,
+        KW3847 = 3167,
+        KW3848 = 3168,
+        KW3849 = 3169,
+        KW385 = 3170,
+        KW3850 = 3171,
+        KW3851 = 3172,
+        KW3852 = 3173,
+        KW3853 = 3174,
+        KW3854 = 3175,
+        KW3855 = 3176,
+        KW3856 = 3177,
+        KW3857 = 3178,
+        KW3858 = 3179,
+        KW3859 = 3180,
+        KW386 = 3181,
+        KW3860 = 3182,
+        KW3861 = 3183,
+        KW3862 = 3184,
+        KW3863 = 3185,
+        KW3864 = 3186,
+        KW3865 = 3187,
+        KW3866 = 3188,
+        KW3867 = 3189,
+        KW3868 = 3190,
+        KW3869 = 3191,
+        KW387 = 3192,
+        KW3870 = 3193,
+        KW3871 = 3194,
+        KW3872 = 3195,
+        KW3873 = 3196,
+        KW3874 = 3197,
+        KW3875 = 3198,
+        KW3876 = 3199,
+        KW3877 = 3200,
+        KW3878 = 3201,
+        KW3879 = 3202,
+        KW388 = 3203,
+        KW3880 = 3204,
+        KW3881 = 3205,
+        KW3882 = 3206,
+        KW3883 = 3207,
+        KW3884 = 3208,
+        KW3885 = 3209,
+        KW3886 = 3210,
+        KW3887 = 3211,
+        KW3888 = 3212,
+        KW3889 = 3213,
+        KW389 = 3214,
+        KW3890 = 3215,
+        KW3891 = 3216,
+        KW3892 = 3217,
+        KW3893 = 3218,
+        KW3894 = 3219,
+        KW3895 = 3220,
+        KW3896 = 3221,
+        KW3897 = 3222,
+        KW3898 = 3223,
+        KW3899 = 3224,
+        KW39 = 3225,
+        KW390 = 3226,
+        KW3900 = 3227,
+        KW3901 = 3228,
+        KW3902 = 3229,
+        KW3903 = 3230,
+        KW3904 = 3231,
+        KW3905 = 3232,
+        KW3906 = 3233,
+        KW3907 = 3234,
+        KW3908 = 3235,
+        KW3909 = 3236,
+        KW391 = 3237,
+        KW3910 = 3238,
+        KW3911 = 3239,
+        KW3912 = 3240,
+        KW3913 = 3241,
+        KW3914 = 3242,
+        KW3915 = 3243,
+        KW3916 = 3244,
+        KW3917 = 3245,
+        KW3918 = 3246,
+        KW3919 = 3247,
+        KW392 = 3248,
+        KW3920 = 3249,
+        KW3921 = 3250,
+        KW3922 = 3251,
+        KW3923 = 3252,
+        KW3924 = 3253,
+        KW3925 = 3254,
+        KW3926 = 3255,
+        KW3927 = 3256,
+        KW3928 = 3257,
+        KW3929 = 3258,
+        KW393 = 3259,
+        KW3930 = 3260,
+        KW3931 = 3261,
+        KW3932 = 3262,
+        KW3933 = 3263,
+        KW3934 = 3264,
+        KW3935 = 3265,
+        KW3936 = 3266,
+        KW3937 = 3267,
+        KW3938 = 3268,
+        KW3939 = 3269,
+        KW394 = 3270,
+        KW3940 = 3271,
+        KW3941 = 3272,
+        KW3942 = 3273,
+        KW3943 = 3274,
+        KW3944 = 3275,
+        KW3945 = 3276,
+        KW3946 = 3277,
+        KW3947 = 3278,
+        KW3948 = 3279,
+        KW3949 = 3280,
+        KW395 = 3281,
+        KW3950 = 3282,
+        KW3951 = 3283,
+        KW3952 = 3284,
+        KW3953 = 3285,
+        KW3954 = 3286,
+        KW3955 = 3287,
+        KW3956 = 3288,
+        KW3957 = 3289,
+        KW3958 = 3290,
+        KW3959 = 3291,
+        KW396 = 3292,
+        KW3960 = 3293,
+        KW3961 = 3294,
+        KW3962 = 3295,
+        KW3963 = 3296,
+        KW3964 = 3297,
+        KW3965 = 3298,
+        KW3966 = 3299,
+        KW3967 = 3300,
+        KW3968 = 3301,
+        KW3969 = 3302,
+        KW397 = 3303,
+        KW3970 = 3304,
+        KW3971 = 3305,
+        KW3972 = 3306,
+        KW3973 = 3307,
+        KW3974 = 3308,
+        KW3975 = 3309,
+        KW3976 = 3310,
+        KW3977 = 3311,
+        KW3978 = 3312,
+        KW3979 = 3313,
+        KW398 = 3314,
+        KW3980 = 3315,
+        KW3981 = 3316,
+        KW3982 = 3317,
+        KW3983 = 3318,
+        KW3984 = 3319,
+        KW3985 = 3320,
+        KW3986 = 3321,
+        KW3987 = 3322,
+        KW3988 = 3323,
+        KW3989 = 3324,
+        KW399 = 3325,
+        KW3990 = 3326,
+        KW3991 = 3327,
+        KW3992 = 3328,
+        KW3993 = 3329,
+        KW3994 = 3330,
+        KW3995 = 3331,
+        KW3996 = 3332,
+        KW3997 = 3333,
+        KW3998 = 3334,
+        KW3999 = 3335,
+        KW4 = 3336,
+        KW40 = 3337,
+        KW400 = 3338,
+        KW4000 = 3339,
+        KW4001 = 3340,
+        KW4002 = 3341,
+        KW4003 = 3342,
+        KW4004 = 3343,
+        KW4005 = 3344,
+        KW4006 = 3345,
+        KW4007 = 3346,
+        KW4008 = 3347,
+        KW4009 = 3348,
+        KW401 = 3349,
+        KW4010 = 3350,
+        KW4011 = 3351,
+        KW4012 = 3352,
+        KW4013 = 3353,
+        KW4014 = 3354,
+        KW4015 = 3355,
+        KW4016 = 3356,
+        KW4017 = 3357,
+        KW4018 = 3358,
+        KW4019 = 3359,
+        KW402 = 3360,
+        KW4020 = 3361,
+        KW4021 = 3362,
+        KW4022 = 3363,
+        KW4023 = 3364,
+        KW4024 = 3365,
+        KW4025 = 3366,
+        KW4026 = 3367,
+        KW4027 = 3368,
+        KW4028 = 3369,
+        KW4029 = 3370,
+        KW403 = 3371,
+        KW4030 = 3372,
+        KW4031 = 3373,
+        KW4032 = 3374,
+        KW4033 = 3375,
+        KW4034 = 3376,
+        KW4035 = 3377,
+        KW4036 = 3378,
+        KW4037 = 3379,
+        KW4038 = 3380,
+        KW4039 = 3381,
+        KW404 = 3382,
+        KW4040 = 3383,
+        KW4041 = 3384,
+        KW4042 = 3385,
+        KW4043 = 3386,
+        KW4044 = 3387,
+        KW4045 = 3388,
+        KW4046 = 3389,
+        KW4047 = 3390,
+        KW4048 = 3391,
+        KW4049 = 3392,
+        KW405 = 3393,
+        KW4050 = 3394,
+        KW4051 = 3395,
+        KW4052 = 3396,
+        KW4053 = 3397,
+        KW4054 = 3398,
+        KW4055 = 3399,
+        KW4056 = 3400,
+        KW4057 = 3401,
+        KW4058 = 3402,
+        KW4059 = 3403,
+        KW406 = 3404,
+        KW4060 = 3405,
+        KW4061 = 3406,
+        KW4062 = 3407,
+        KW4063 = 3408,
+        KW4064 = 3409,
+        KW4065 = 3410,
+        KW4066 = 3411,
+        KW4067 = 3412,
+        KW4068 = 3413,
+        KW4069 = 3414,
+        KW407 = 3415,
+        KW4070 = 3416,
+        KW4071 = 3417,
+        KW4072 = 3418,
+        KW4073 = 3419,
+        KW4074 = 3420,
+        KW4075 = 3421,
+        KW4076 = 3422,
+        KW4077 = 3423,
+        KW4078 = 3424,
+        KW4079 = 3425,
+        KW408 = 3426,
+        KW4080 = 3427,
+        KW4081 = 3428,
+        KW4082 = 3429,
+        KW4083 = 3430,
+        KW4084 = 3431,
+        KW4085 = 3432,
+        KW4086 = 3433,
+        KW4087 = 3434,
+        KW4088 = 3435,
+        KW4089 = 3436,
+        KW409 = 3437,
+        KW4090 = 3438,
+        KW4091 = 3439,
+        KW4092 = 3440,
+        KW4093 = 3441,
+        KW4094 = 3442,
+        KW4095 = 3443,
+        KW4096 = 3444,
+        KW4097 = 3445,
+        KW4098 = 3446,
+        KW4099 = 3447,
+        KW41 = 3448,
+        KW410 = 3449,
+        KW4100 = 3450,
+        KW4101 = 3451,
+        KW4102 = 3452,
+        KW4103 = 3453,
+        KW4104 = 3454,
+        KW4105 = 3455,
+        KW4106 = 3456,
+        KW4107 = 3457,
+        KW4108 = 3458,
+        KW4109 = 3459,
+        KW411 = 3460,
+        KW4110 = 3461,
+        KW4111 = 3462,
+        KW4112 = 3463,
+        KW4113 = 3464,
+        KW4114 = 3465,
+        KW4115 = 3466,
+        KW4116 = 3467,
+        KW4117 = 3468,
+        KW4118 = 3469,
+        KW4119 = 3470,
+        KW412 = 3471,
+        KW4120 = 3472,
+        KW4121 = 3473,
+        KW4122 = 3474,
+        KW4123 = 3475,
+        KW4124 = 3476,
+        KW4125 = 3477,
+        KW4126 = 3478,
+        KW4127 = 3479,
+        KW4128 = 3480,
+        KW4129 = 3481,
+        KW413 = 3482,
+        KW4130 = 3483,
+        KW4131 = 3484,
+        KW4132 = 3485,
+        KW4133 = 3486,
+        KW4134 = 3487,
+        KW4135 = 3488,
+        KW4136 = 3489,
+        KW4137 = 3490,
+        KW4138 = 3491,
+        KW4139 = 3492,
+        KW414 = 3493,
+        KW4140 = 3494,
+        KW4141 = 3495,
+        KW4142 = 3496,
+        KW4143 = 3497,
+        KW4144 = 3498,
+        KW4145 = 3499,
+        KW4146 = 3500,
+        KW4147 = 3501,
+        KW4148 = 3502,
+        KW4149 = 3503,
+        KW415 = 3504,
+        KW4150 = 3505,
+        KW4151 = 3506,
+        KW4152 = 3507,
+        KW4153 = 3508,
+        KW4154 = 3509,
+        KW4155 = 3510,
+        KW4156 = 3511,
+        KW4157 = 3512,
+        KW4158 = 3513,
+        KW4159 = 3514,
+        KW416 = 3515,
+        KW4160 = 3516,
+        KW4161 = 3517,
+        KW4162 = 3518,
+        KW4163 = 3519,
+        KW4164 = 3520,
+        KW4165 = 3521,
+        KW4166 = 3522,
+        KW4167 = 3523,
+        KW4168 = 3524,
+        KW4169 = 3525,
+        KW417 = 3526,
+        KW4170 = 3527,
+        KW4171 = 3528,
+        KW4172 = 3529,
+        KW4173 = 3530,
+        KW4174 = 3531,
+        KW4175 = 3532,
+        KW4176 = 3533,
+        KW4177 = 3534,
+        KW4178 = 3535,
+        KW4179 = 3536,
+        KW418 = 3537,
+        KW4180 = 3538,
+        KW4181 = 3539,
+        KW4182 = 3540,
+        KW4183 = 3541,
+        KW4184 = 3542,
+        KW4185 = 3543,
+        KW4186 = 3544,
+        KW4187 = 3545,
+        KW4188 = 3546,
+        KW4189 = 3547,
+        KW419 = 3548,
+        KW4190 = 3549,
+        KW4191 = 3550,
+        KW4192 = 3551,
+        KW4193 = 3552,
+        KW4194 = 3553,
+        KW4195 = 3554,
+        KW4196 = 3555,
+        KW4197 = 3556,
+        KW4198 = 3557,
+        KW4199 = 3558,
+        KW42 = 3559,
+        KW420 = 3560,
+        KW4200 = 3561,
+        KW4201 = 3562,
+        KW4202 = 3563,
+        KW4203 = 3564,
+        KW4204 = 3565,
+        KW4205 = 3566,
+        KW4206 = 3567,
+        KW4207 = 3568,
+        KW4208 = 3569,
+        KW4209 = 3570,
+        KW421 = 3571,
+        KW4210 = 3572,
+        KW4211 = 3573,
+        KW4212 = 3574,
+        KW4213 = 3575,
+        KW4214 = 3576,
+        KW4215 = 3577,
+        KW4216 = 3578,
+        KW4217 = 3579,
+        KW4218 = 3580,
+        KW4219 = 3581,
+        KW422 = 3582,
+        KW4220 = 3583,
+        KW4221 = 3584,
+        KW4222 = 3585,
+        KW4223 = 3586,
+        KW4224 = 3587,
+        KW4225 = 3588,
+        KW4226 = 3589,
+        KW4227 = 3590,
+        KW4228 = 3591,
+        KW4229 = 3592,
+        KW423 = 3593,
+        KW4230 = 3594,
+        KW4231 = 3595,
+        KW4232 = 3596,
+        KW4233 = 3597,
+        KW4234 = 3598,
+        KW4235 = 3599,
+        KW4236 = 3600,
+        KW4237 = 3601,
+        KW4238 = 3602,
+        KW4239 = 3603,
+        KW424 = 3604,
+        KW4240 = 3605,
+        KW4241 = 3606,
+        KW4242 = 3607,
+        KW4243 = 3608,
+        KW4244 = 3609,
+        KW4245 = 3610,
+        KW4246 = 3611,
+        KW4247 = 3612,
+        KW4248 = 3613,
+        KW4249 = 3614,
+        KW425 = 3615,
+        KW4250 = 3616,
+        KW4251 = 3617,
+        KW4252 = 3618,
+        KW4253 = 3619,
+        KW4254 = 3620,
+        KW4255 = 3621,
+        KW4256 = 3622,
+        KW4257 = 3623,
+        KW4258 = 3624,
+        KW4259 = 3625,
+        KW426 = 3626,
+        KW4260 = 3627,
+        KW4261 = 3628,
+        KW4262 = 3629,
+        KW4263 = 3630,
+        KW4264 = 3631,
+        KW4265 = 3632,
+        KW4266 = 3633,
+        KW4267 = 3634,
+        KW4268 = 3635,
+        KW4269 = 3636,
+        KW427 = 3637,
+        KW4270 = 3638,
+        KW4271 = 3639,
+        KW4272 = 3640,
+        KW4273 = 3641,
+        KW4274 = 3642,
+        KW4275 = 3643,
+        KW4276 = 3644,
+        KW4277 = 3645,
+        KW4278 = 3646,
+        KW4279 = 3647,
+        KW428 = 3648,
+        KW4280 = 3649,
+        KW4281 = 3650,
+        KW4282 = 3651,
+        KW4283 = 3652,
+        KW4284 = 3653,
+        KW4285 = 3654,
+        KW4286 = 3655,
+        KW4287 = 3656,
+        KW4288 = 3657,
+        KW4289 = 3658,
+        KW429 = 3659,
+        KW4290 = 3660,
+        KW4291 = 3661,
+        KW4292 = 3662,
+        KW4293 = 3663,
+        KW4294 = 3664,
+        KW4295 = 3665,
+        KW4296 = 3666,
+        KW4297 = 3667,
+        KW4298 = 3668,
+        KW4299 = 3669,
+        KW43 = 3670,
+        KW430 = 3671,
+        KW4300 = 3672,
+        KW4301 = 3673,
+        KW4302 = 3674,
+        KW4303 = 3675,
+        KW4304 = 3676,
+        KW4305 = 3677,
+        KW4306 = 3678,
+        KW4307 = 3679,
+        KW4308 = 3680,
+        KW4309 = 3681,
+        KW431 = 3682,
+        KW4310 = 3683,
+        KW4311 = 3684,
+        KW4312 = 3685,
+        KW4313 = 3686,
+        KW4314 = 3687,
+        KW4315 = 3688,
+        KW4316 = 3689,
+        KW4317 = 3690,
+        KW4318 = 3691,
+        KW4319 = 3692,
+        KW432 = 3693,
+        KW4320 = 3694,
+        KW4321 = 3695,
+        KW4322 = 3696,
+        KW4323 = 3697,
+        KW4324 = 3698,
+        KW4325 = 3699,
+        KW4326 = 3700,
+        KW4327 = 3701,
+        KW4328 = 3702,
+        KW4329 = 3703,
+        KW433 = 3704,
+        KW4330 = 3705,
+        KW4331 = 3706,
+        KW4332 = 3707,
+        KW4333 = 3708,
+        KW4334 = 3709,
+        KW4335 = 3710,
+        KW4336 = 3711,
+        KW4337 = 3712,
+        KW4338 = 3713,
+        KW4339 = 3714,
+        KW434 = 3715,
+        KW4340 = 3716,
+        KW4341 = 3717,
+        KW4342 = 3718,
+        KW4343 = 3719,
+        KW4344 = 3720,
+        KW4345 = 3721,
+        KW4346 = 3722,
+        KW4347 = 3723,
+        KW4348 = 3724,
+        KW4349 = 3725,
+        KW435 = 3726,
+        KW4350 = 3727,
+        KW4351 = 3728,
+        KW4352 = 3729,
+        KW4353 = 3730,
+        KW4354 = 3731,
+        KW4355 = 3732,
+        KW4356 = 3733,
+        KW4357 = 3734,
+        KW4358 = 3735,
+        KW4359 = 3736,
+        KW436 = 3737,
+        KW4360 = 3738,
+        KW4361 = 3739,
+        KW4362 = 3740,
+        KW4363 = 3741,
+        KW4364 = 3742,
+        KW4365 = 3743,
+        KW4366 = 3744,
+        KW4367 = 3745,
+        KW4368 = 3746,
+        KW4369 = 3747,
+        KW437 = 3748,
+        KW4370 = 3749,
+        KW4371 = 3750,
+        KW4372 = 3751,
+        KW4373 = 3752,
+        KW4374 = 3753,
+        KW4375 = 3754,
+        KW4376 = 3755,
+        KW4377 = 3756,
+        KW4378 = 3757,
+        KW4379 = 3758,
+        KW438 = 3759,
+        KW4380 = 3760,
+        KW4381 = 3761,
+        KW4382 = 3762,
+        KW4383 = 3763,
+        KW4384 = 3764,
+        KW4385 = 3765,
+        KW4386 = 3766,
+        KW4387 = 3767,
+        KW4388 = 3768,
+        KW4389 = 3769,
+        KW439 = 3770,
+        KW4390 = 3771,
+        KW4391 = 3772,
+        KW4392 = 3773,
+        KW4393 = 3774,
+        KW4394 = 3775,
+        KW4395 = 3776,
+        KW4396 = 3777,
+        KW4397 = 3778,
+        KW4398 = 3779,
+        KW4399 = 3780,
+        KW44 = 3781,
+        KW440 = 3782,
+        KW4400 = 3783,
+        KW4401 = 3784,
+        KW4402 = 3785,
+        KW4403 = 3786,
+        KW4404 = 3787,
+        KW4405 = 3788,
+        KW4406 = 3789,
+        KW4407 = 3790,
+        KW4408 = 3791,
+        KW4409 = 3792,
+        KW441 = 3793,
+        KW4410 = 3794,
+        KW4411 = 3795,
+        KW4412 = 3796,
+        KW4413 = 3797,
+        KW4414 = 3798,
+        KW4415 = 3799,
+        KW4416 = 3800,
+        KW4417 = 3801,
+        KW4418 = 3802,
+        KW4419 = 3803,
+        KW442 = 3804,
+        KW4420 = 3805,
+        KW4421 = 3806,
+        KW4422 = 3807,
+        KW4423 = 3808,
+        KW4424 = 3809,
+        KW4425 = 3810,
+        KW4426 = 3811,
+        KW4427 = 3812,
+        KW4428 = 3813,
+        KW4429 = 3814,
+        KW443 = 3815,
+        KW4430 = 3816,
+        KW4431 = 3817,
+        KW4432 = 3818,
+        KW4433 = 3819,
+        KW4434 = 3820,
+        KW4435 = 3821,
+        KW4436 = 3822,
+        KW4437 = 3823,
+        KW4438 = 3824,
+        KW4439 = 3825,
+        KW444 = 3826,
+        KW4440 = 3827,
+        KW4441 = 3828,
+        KW4442 = 3829,
+        KW4443 = 3830,
+        KW4444 = 3831,
+        KW4445 = 3832,
+        KW4446 = 3833,
+        KW4447 = 3834,
+        KW4448 = 3835,
+        KW4449 = 3836,
+        KW445 = 3837,
+        KW4450 = 3838,
+        KW4451 = 3839,
+        KW4452 = 3840,
+        KW4453 = 3841,
+        KW4454 = 3842,
+        KW4455 = 3843,
+        KW4456 = 3844,
+        KW4457 = 3845,
+        KW4458 = 3846,
+        KW4459 = 3847,
+        KW446 = 3848,
+        KW4460 = 3849,
+        KW4461 = 3850,
+        KW4462 = 3851,
+        KW4463 = 3852,
+        KW4464 = 3853,
+        KW4465 = 3854,
+        KW4466 = 3855,
+        KW4467 = 3856,
+        KW4468 = 3857,
+        KW4469 = 3858,
+        KW447 = 3859,
+        KW4470 = 3860,
+        KW4471 = 3861,
+        KW4472 = 3862,
+        KW4473 = 3863,
+        KW4474 = 3864,
+        KW4475 = 3865,
+        KW4476 = 3866,
+        KW4477 = 3867,
+        KW4478 = 3868,
+        KW4479 = 3869,
+        KW448 = 3870,
+        KW4480 = 3871,
+        KW4481 = 3872,
+        KW4482 = 3873,
+        KW4483 = 3874,
+        KW4484 = 3875,
+        KW4485 = 3876,
+        KW4486 = 3877,
+        KW4487 = 3878,
+        KW4488 = 3879,
+        KW4489 = 3880,
+        KW449 = 3881,
+        KW4490 = 3882,
+        KW4491 = 3883,
+        KW4492 = 3884,
+        KW4493 = 3885,
+        KW4494 = 3886,
+        KW4495 = 3887,
+        KW4496 = 3888,
+        KW4497 = 3889,
+        KW4498 = 3890,
+        KW4499 = 3891,
+        KW45 = 3892,
+        KW450 = 3893,
+        KW4500 = 3894,
+        KW4501 = 3895,
+        KW4502 = 3896,
+        KW4503 = 3897,
+        KW4504 = 3898,
+        KW4505 = 3899,
+        KW4506 = 3900,
+        KW4507 = 3901,
+        KW4508 = 3902,
+        KW4509 = 3903,
+        KW451 = 3904,
+        KW4510 = 3905,
+        KW4511 = 3906,
+        KW4512 = 3907,
+        KW4513 = 3908,
+        KW4514 = 3909,
+        KW4515 = 3910,
+        KW4516 = 3911,
+        KW4517 = 3912,
+        KW4518 = 3913,
+        KW4519 = 3914,
+        KW452 = 3915,
+        KW4520 = 3916,
+        KW4521 = 3917,
+        KW4522 = 3918,
+        KW4523 = 3919,
+        KW4524 = 3920,
+        KW4525 = 3921,
+        KW4526 = 3922,
+        KW4527 = 3923,
+        KW4528 = 3924,
+        KW4529 = 3925,
+        KW453 = 3926,
+        KW4530 = 3927,
+        KW4531 = 3928,
+        KW4532 = 3929,
+        KW4533 = 3930,
+        KW4534 = 3931,
+        KW4535 = 3932,
+        KW4536 = 3933,
+        KW4537 = 3934,
+        KW4538 = 3935,
+        KW4539 = 3936,
+        KW454 = 3937,
+        KW4540 = 3938,
+        KW4541 = 3939,
+        KW4542 = 3940,
+        KW4543 = 3941,
+        KW4544 = 3942,
+        KW4545 = 3943,
+        KW4546 = 3944,
+        KW4547 = 3945,
+        KW4548 = 3946,
+        KW4549 = 3947,
+        KW455 = 3948,
+        KW4550 = 3949,
+        KW4551 = 3950,
+        KW4552 = 3951,
+        KW4553 = 3952,
+        KW4554 = 3953,
+        KW4555 = 3954,
+        KW4556 = 3955,
+        KW4557 = 3956,
+        KW4558 = 3957,
+        KW4559 = 3958,
+        KW456 = 3959,
+        KW4560 = 3960,
+        KW4561 = 3961,
+        KW4562 = 3962,
+        KW4563 = 3963,
+        KW4564 = 3964,
+        KW4565 = 3965,
+        KW4566 = 3966,
+        KW4567 = 3967,
+        KW4568 = 3968,
+        KW4569 = 3969,
+        KW457 = 3970,
+        KW4570 = 3971,
+        KW4571 = 3972,
+        KW4572 = 3973,
+        KW4573 = 3974,
+        KW4574 = 3975,
+        KW4575 = 3976,
+        KW4576 = 3977,
+        KW4577 = 3978,
+        KW4578 = 3979,
+        KW4579 = 3980,
+        KW458 = 3981,
+        KW4580 = 3982,
+        KW4581 = 3983,
+        KW4582 = 3984,
+        KW4583 = 3985,
+        KW4584 = 3986,
+        KW4585 = 3987,
+        KW4586 = 3988,
+        KW4587 = 3989,
+        KW4588 = 3990,
+        KW4589 = 3991,
+        KW459 = 3992,
+        KW4590 = 3993,
+        KW4591 = 3994,
+        KW4592 = 3995,
+        KW4593 = 3996,
+        KW4594 = 3997,
+        KW4595 = 3998,
+        KW4596 = 3999,
+        KW4597 = 4000,
+        KW4598 = 4001,
+        KW4599 = 4002,
+        KW46 = 4003,
+        KW460 = 4004,
+        KW4600 = 4005,
+        KW4601 = 4006,
+        KW4602 = 4007,
+        KW4603 = 4008,
+        KW4604 = 4009,
+        KW4605 = 4010,
+        KW4606 = 4011,
+        KW4607 = 4012,
+        KW4608 = 4013,
+        KW4609 = 4014,
+        KW461 = 4015,
+        KW4610 = 4016,
+        KW4611 = 4017,
+        KW4612 = 4018,
+        KW4613 = 4019,
+        KW4614 = 4020,
+        KW4615 = 4021,
+        KW4616 = 4022,
+        KW4617 = 4023,
+        KW4618 = 4024,
+        KW4619 = 4025,
+        KW462 = 4026,
+        KW4620 = 4027,
+        KW4621 = 4028,
+        KW4622 = 4029,
+        KW4623 = 4030,
+        KW4624 = 4031,
+        KW4625 = 4032,
+        KW4626 = 4033,
+        KW4627 = 4034,
+        KW4628 = 4035,
+        KW4629 = 4036,
+        KW463 = 4037,
+        KW4630 = 4038,
+        KW4631 = 4039,
+        KW4632 = 4040,
+        KW4633 = 4041,
+        KW4634 = 4042,
+        KW4635 = 4043,
+        KW4636 = 4044,
+        KW4637 = 4045,
+        KW4638 = 4046,
+        KW4639 = 4047,
+        KW464 = 4048,
+        KW4640 = 4049,
+        KW4641 = 4050,
+        KW4642 = 4051,
+        KW4643 = 4052,
+        KW4644 = 4053,
+        KW4645 = 4054,
+        KW4646 = 4055,
+        KW4647 = 4056,
+        KW4648 = 4057,
+        KW4649 = 4058,
+        KW465 = 4059,
+        KW4650 = 4060,
+        KW4651 = 4061,
+        KW4652 = 4062,
+        KW4653 = 4063,
+        KW4654 = 4064,
+        KW4655 = 4065,
+        KW4656 = 4066,
+        KW4657 = 4067,
+        KW4658 = 4068,
+        KW4659 = 4069,
+        KW466 = 4070,
+        KW4660 = 4071,
+        KW4661 = 4072,
+        KW4662 = 4073,
+        KW4663 = 4074,
+        KW4664 = 4075,
+        KW4665 = 4076,
+        KW4666 = 4077,
+        KW4667 = 4078,
+        KW4668 = 4079,
+        KW4669 = 4080,
+        KW467 = 4081,
+        KW4670 = 4082,
+        KW4671 = 4083,
+        KW4672 = 4084,
+        KW4673 = 4085,
+        KW4674 = 4086,
+        KW4675 = 4087,
+        KW4676 = 4088,
+        KW4677 = 4089,
+        KW4678 = 4090,
+        KW4679 = 4091,
+        KW468 = 4092,
+        KW4680 = 4093,
+        KW4681 = 4094,
+        KW4682 = 4095,
+        KW4683 = 4096,
+        KW4684 = 4097,
+        KW4685 = 4098,
+        KW4686 = 4099,
+        KW4687 = 4100,
+        KW4688 = 4101,
+        KW4689 = 4102,
+        KW469 = 4103,
+        KW4690 = 4104,
+        KW4691 = 4105,
+        KW4692 = 4106,
+        KW4693 = 4107,
+        KW4694 = 4108,
+        KW4695 = 4109,
+        KW4696 = 4110,
+        KW4697 = 4111,
+        KW4698 = 4112,
+        KW4699 = 4113,
+        KW47 = 4114,
+        KW470 = 4115,
+        KW4700 = 4116,
+        KW4701 = 4117,
+        KW4702 = 4118,
+        KW4703 = 4119,
+        KW4704 = 4120,
+        KW4705 = 4121,
+        KW4706 = 4122,
+        KW4707 = 4123,
+        KW4708 = 4124,
+        KW4709 = 4125,
+        KW471 = 4126,
+        KW4710 = 4127,
+        KW4711 = 4128,
+        KW4712 = 4129,
+        KW4713 = 4130,
+        KW4714 = 4131,
+        KW4715 = 4132,
+        KW4716 = 4133,
+        KW4717 = 4134,
+        KW4718 = 4135,
+        KW4719 = 4136,
+        KW472 = 4137,
+        KW4720 = 4138,
+        KW4721 = 4139,
+        KW4722 = 4140,
+        KW4723 = 4141,
+        KW4724 = 4142,
+        KW4725 = 4143,
+        KW4726 = 4144,
+        KW4727 = 4145,
+        KW4728 = 4146,
+        KW4729 = 4147,
+        KW473 = 4148,
+        KW4730 = 4149,
+        KW4731 = 4150,
+        KW4732 = 4151,
+        KW4733 = 4152,
+        KW4734 = 4153,
+        KW4735 = 4154,
+        KW4736 = 4155,
+        KW4737 = 4156,
+        KW4738 = 4157,
+        KW4739 = 4158,
+        KW474 = 4159,
+        KW4740 = 4160,
+        KW4741 = 4161,
+        KW4742 = 4162,
+        KW4743 = 4163,
+        KW4744 = 4164,
+        KW4745 = 4165,
+        KW4746 = 4166,
+        KW4747 = 4167,
+        KW4748 = 4168,
+        KW4749 = 4169,
+        KW475 = 4170,
+        KW4750 = 4171,
+        KW4751 = 4172,
+        KW4752 = 4173,
+        KW4753 = 4174,
+        KW4754 = 4175,
+        KW4755 = 4176,
+        KW4756 = 4177,
+        KW4757 = 4178,
+        KW4758 = 4179,
+        KW4759 = 4180,
+        KW476 = 4181,
+        KW4760 = 4182,
+        KW4761 = 4183,
+        KW4762 = 4184,
+        KW4763 = 4185,
+        KW4764 = 4186,
+        KW4765 = 4187,
+        KW4766 = 4188,
+        KW4767 = 4189,
+        KW4768 = 4190,
+        KW4769 = 4191,
+        KW477 = 4192,
+        KW4770 = 4193,
+        KW4771 = 4194,
+        KW4772 = 4195,
+        KW4773 = 4196,
+        KW4774 = 4197,
+        KW4775 = 4198,
+        KW4776 = 4199,
+        KW4777 = 4200,
+        KW4778 = 4201,
+        KW4779 = 4202,
+        KW478 = 4203,
+        KW4780 = 4204,
+        KW4781 = 4205,
+        KW4782 = 4206,
+        KW4783 = 4207,
+        KW4784 = 4208,
+        KW4785 = 4209,
+        KW4786 = 4210,
+        KW4787 = 4211,
+        KW4788 = 4212,
+        KW4789 = 4213,
+        KW479 = 4214,
+        KW4790 = 4215,
+        KW4791 = 4216,
+        KW4792 = 4217,
+        KW4793 = 4218,
+        KW4794 = 4219,
+        KW4795 = 4220,
+        KW4796 = 4221,
+        KW4797 = 4222,
+        KW4798 = 4223,
+        KW4799 = 4224,
+        KW48 = 4225,
+        KW480 = 4226,
+        KW4800 = 4227,
+        KW4801 = 4228,
+        KW4802 = 4229,
+        KW4803 = 4230,
+        KW4804 = 4231,
+        KW4805 = 4232,
+        KW4806 = 4233,
+        KW4807 = 4234,
+        KW4808 = 4235,
+        KW4809 = 4236,
+        KW481 = 4237,
+        KW4810 = 4238,
+        KW4811 = 4239,
+        KW4812 = 4240,
+        KW4813 = 4241,
+        KW4814 = 4242,
+        KW4815 = 4243,
+        KW4816 = 4244,
+        KW4817 = 4245,
+        KW4818 = 4246,
+        KW4819 = 4247,
+        KW482 = 4248,
+        KW4820 = 4249,
+        KW4821 = 4250,
+        KW4822 = 4251,
+        KW4823 = 4252,
+        KW4824 = 4253,
+        KW4825 = 4254,
+        KW4826 = 4255,
+        KW4827 = 4256,
+        KW4828 = 4257,
+        KW4829 = 4258,
+        KW483 = 4259,
+        KW4830 = 4260,
+        KW4831 = 4261,
+        KW4832 = 4262,
+        KW4833 = 4263,
+        KW4834 = 4264,
+        KW4835 = 4265,
+        KW4836 = 4266,
+        KW4837 = 4267,
+        KW4838 = 4268,
+        KW4839 = 4269,
+        KW484 = 4270,
+        KW4840 = 4271,
+        KW4841 = 4272,
+        KW4842 = 4273,
+        KW4843 = 4274,
+        KW4844 = 4275,
+        KW4845 = 4276,
+        KW4846 = 4277,
+        KW4847 = 4278,
+        KW4848 = 4279,
+        KW4849 = 4280,
+        KW485 = 4281,
+        KW4850 = 4282,
+        KW4851 = 4283,
+        KW4852 = 4284,
+        KW4853 = 4285,
+        KW4854 = 4286,
+        KW4855 = 4287,
+        KW4856 = 4288,
+        KW4857 = 4289,
+        KW4858 = 4290,
+        KW4859 = 4291,
+        KW486 = 4292,
+        KW4860 = 4293,
+        KW4861 = 4294,
+        KW4862 = 4295,
+        KW4863 = 4296,
+        KW4864 = 4297,
+        KW4865 = 4298,
+        KW4866 = 4299,
+        KW4867 = 4300,
+        KW4868 = 4301,
+        KW4869 = 4302,
+        KW487 = 4303,
+        KW4870 = 4304,
+        KW4871 = 4305,
+        KW4872 = 4306,
+        KW4873 = 4307,
+        KW4874 = 4308,
+        KW4875 = 4309,
+        KW4876 = 4310,
+        KW4877 = 4311,
+        KW4878 = 4312,
+        KW4879 = 4313,
+        KW488 = 4314,
+        KW4880 = 4315,
+        KW4881 = 4316,
+        KW4882 = 4317,
+        KW4883 = 4318,
+        KW4884 = 4319,
+        KW4885 = 4320,
+        KW4886 = 4321,
+        KW4887 = 4322,
+        KW4888 = 4323,
+        KW4889 = 4324,
+        KW489 = 4325,
+        KW4890 = 4326,
+        KW4891 = 4327,
+        KW4892 = 4328,
+        KW4893 = 4329,
+        KW4894 = 4330,
+        KW4895 = 4331,
+        KW4896 = 4332,
+        KW4897 = 4333,
+        KW4898 = 4334,
+        KW4899 = 4335,
+        KW49 = 4336,
+        KW490 = 4337,
+        KW4900 = 4338,
+        KW4901 = 4339,
+        KW4902 = 4340,
+        KW4903 = 4341,
+        KW4904 = 4342,
+        KW4905 = 4343,
+        KW4906 = 4344,
+        KW4907 = 4345,
+        KW4908 = 4346,
+        KW4909 = 4347,
+        KW491 = 4348,
+        KW4910 = 4349,
+        KW4911 = 4350,
+        KW4912 = 4351,
+        KW4913 = 4352,
+        KW4914 = 4353,
+        KW4915 = 4354,
+        KW4916 = 4355,
+        KW4917 = 4356,
+        KW4918 = 4357,
+        KW4919 = 4358,
+        KW492 = 4359,
+        KW4920 = 4360,
+        KW4921 = 4361,
+        KW4922 = 4362,
+        KW4923 = 4363,
+        KW4924 = 4364,
+        KW4925 = 4365,
+        KW4926 = 4366,
+        KW4927 = 4367,
+        KW4928 = 4368,
+        KW4929 = 4369,
+        KW493 = 4370,
+        KW4930 = 4371,
+        KW4931 = 4372,
+        KW4932 = 4373,
+        KW4933 = 4374,
+        KW4934 = 4375,
+        KW4935 = 4376,
+        KW4936 = 4377,
+        KW4937 = 4378,
+        KW4938 = 4379,
+        KW4939 = 4380,
+        KW494 = 4381,
+        KW4940 = 4382,
+        KW4941 = 4383,
+        KW4942 = 4384,
+        KW4943 = 4385,
+        KW4944 = 4386,
+        KW4945 = 4387,
+        KW4946 = 4388,
+        KW4947 = 4389,
+        KW4948 = 4390,
+        KW4949 = 4391,
+        KW495 = 4392,
+        KW4950 = 4393,
+        KW4951 = 4394,
+        KW4952 = 4395,
+        KW4953 = 4396,
+        KW4954 = 4397,
+        KW4955 = 4398,
+        KW4956 = 4399,
+        KW4957 = 4400,
+        KW4958 = 4401,
+        KW4959 = 4402,
+        KW496 = 4403,
+        KW4960 = 4404,
+        KW4961 = 4405,
+        KW4962 = 4406,
+        KW4963 = 4407,
+        KW4964 = 4408,
+        KW4965 = 4409,
+        KW4966 = 4410,
+        KW4967 = 4411,
+        KW4968 = 4412,
+        KW4969 = 4413,
+        KW497 = 4414,
+        KW4970 = 4415,
+        KW4971 = 4416,
+        KW4972 = 4417,
+        KW4973 = 4418,
+        KW4974 = 4419,
+        KW4975 = 4420,
+        KW4976 = 4421,
+        KW4977 = 4422,
+        KW4978 = 4423,
+        KW4979 = 4424,
+        KW498 = 4425,
+        KW4980 = 4426,
+        KW4981 = 4427,
+        KW4982 = 4428,
+        KW4983 = 4429,
+        KW4984 = 4430,
+        KW4985 = 4431,
+        KW4986 = 4432,
+        KW4987 = 4433,
+        KW4988 = 4434,
+        KW4989 = 4435,
+        KW499 = 4436,
+        KW4990 = 4437,
+        KW4991 = 4438,
+        KW4992 = 4439,
+        KW4993 = 4440,
+        KW4994 = 4441,
+        KW4995 = 4442,
+        KW4996 = 4443,
+        KW4997 = 4444,
+        KW4998 = 4445,
+        KW4999 = 4446,
+        KW5 = 4447,
+        KW50 = 4448,
+        KW500 = 4449,
+        KW5000 = 4450,
+        KW5001 = 4451,
+        KW5002 = 4452,
+        KW5003 = 4453,
+        KW5004 = 4454,
+        KW5005 = 4455,
+        KW5006 = 4456,
+        KW5007 = 4457,
+        KW5008 = 4458,
+        KW5009 = 4459,
+        KW501 = 4460,
+        KW5010 = 4461,
+        KW5011 = 4462,
+        KW5012 = 4463,
+        KW5013 = 4464,
+        KW5014 = 4465,
+        KW5015 = 4466,
+        KW5016 = 4467,
+        KW5017 = 4468,
+        KW5018 = 4469,
+        KW5019 = 4470,
+        KW502 = 4471,
+        KW5020 = 4472,
+        KW5021 = 4473,
+        KW5022 = 4474,
+        KW5023 = 4475,
+        KW5024 = 4476,
+        KW5025 = 4477,
+        KW5026 = 4478,
+        KW5027 = 4479,
+        KW5028 = 4480,
+        KW5029 = 4481,
+        KW503 = 4482,
+        KW5030 = 4483,
+        KW5031 = 4484,
+        KW5032 = 4485,
+        KW5033 = 4486,
+        KW5034 = 4487,
+        KW5035 = 4488,
+        KW5036 = 4489,
+        KW5037 = 4490,
+        KW5038 = 4491,
+        KW5039 = 4492,
+        KW504 = 4493,
+        KW5040 = 4494,
+        KW5041 = 4495,
+        KW5042 = 4496,
+        KW5043 = 4497,
+        KW5044 = 4498,
+        KW5045 = 4499,
+        KW5046 = 4500,
+        KW5047 = 4501,
+        KW5048 = 4502,
+        KW5049 = 4503,
+        KW505 = 4504,
+        KW5050 = 4505,
+        KW5051 = 4506,
+        KW5052 = 4507,
+        KW5053 = 4508,
+        KW5054 = 4509,
+        KW5055 = 4510,
+        KW5056 = 4511,
+        KW5057 = 4512,
+        KW5058 = 4513,
+        KW5059 = 4514,
+        KW506 = 4515,
+        KW5060 = 4516,
+        KW5061 = 4517,
+        KW5062 = 4518,
+        KW5063 = 4519,
+        KW5064 = 4520,
+        KW5065 = 4521,
+        KW5066 = 4522,
+        KW5067 = 4523,
+        KW5068 = 4524,
+        KW5069 = 4525,
+        KW507 = 4526,
+        KW5070 = 4527,
+        KW5071 = 4528,
+        KW5072 = 4529,
+        KW5073 = 4530,
+        KW5074 = 4531,
+        KW5075 = 4532,
+        KW5076 = 4533,
+        KW5077 = 4534,
+        KW5078 = 4535,
+        KW5079 = 4536,
+        KW508 = 4537,
+        KW5080 = 4538,
+        KW5081 = 4539,
+        KW5082 = 4540,
+        KW5083 = 4541,
+        KW5084 = 4542,
+        KW5085 = 4543,
+        KW5086 = 4544,
+        KW5087 = 4545,
+        KW5088 = 4546,
+        KW5089 = 4547,
+        KW509 = 4548,
+        KW5090 = 4549,
+        KW5091 = 4550,
+        KW5092 = 4551,
+        KW5093 = 4552,
+        KW5094 = 4553,
+        KW5095 = 4554,
+        KW5096 = 4555,
+        KW5097 = 4556,
+        KW5098 = 4557,
+        KW5099 = 4558,
+        KW51 = 4559,
+        KW510 = 4560,
+        KW5100 = 4561,
+        KW5101 = 4562,
+        KW5102 = 4563,
+        KW5103 = 4564,
+        KW5104 = 4565,
+        KW5105 = 4566,
+        KW5106 = 4567,
+        KW5107 = 4568,
+        KW5108 = 4569,
+        KW5109 = 4570,
+        KW511 = 4571,
+        KW5110 = 4572,
+        KW5111 = 4573,
+        KW5112 = 4574,
+        KW5113 = 4575,
+        KW5114 = 4576,
+        KW5115 = 4577,
+        KW5116 = 4578,
+        KW5117 = 4579,
+        KW5118 = 4580,
+        KW5119 = 4581,
+        KW512 = 4582,
+        KW5120 = 4583,
+        KW5121 = 4584,
+        KW5122 = 4585,
+        KW5123 = 4586,
+        KW5124 = 4587,
+        KW5125 = 4588,
+        KW5126 = 4589,
+        KW5127 = 4590,
+        KW5128 = 4591,
+        KW5129 = 4592,
+        KW513 = 4593,
+        KW5130 = 4594,
+        KW5131 = 4595,
+        KW5132 = 4596,
+        KW5133 = 4597,
+        KW5134 = 4598,
+        KW5135 = 4599,
+        KW5136 = 4600,
+        KW5137 = 4601,
+        KW5138 = 4602,
+        KW5139 = 4603,
+        KW514 = 4604,
+        KW5140 = 4605,
+        KW5141 = 4606,
+        KW5142 = 4607,
+        KW5143 = 4608,
+        KW5144 = 4609,
+        KW5145 = 4610,
+        KW5146 = 4611,
+        KW5147 = 4612,
+        KW5148 = 4613,
+        KW5149 = 4614,
+        KW515 = 4615,
+        KW5150 = 4616,
+        KW5151 = 4617,
+        KW5152 = 4618,
+        KW5153 = 4619,
+        KW5154 = 4620,
+        KW5155 = 4621,
+        KW5156 = 4622,
+        KW5157 = 4623,
+        KW5158 = 4624,
+        KW5159 = 4625,
+        KW516 = 4626,
+        KW5160 = 4627,
+        KW5161 = 4628,
+        KW5162 = 4629,
+        KW5163 = 4630,
+        KW5164 = 4631,
+        KW5165 = 4632,
+        KW5166 = 4633,
+        KW5167 = 4634,
+        KW5168 = 4635,
+        KW5169 = 4636,
+        KW517 = 4637,
+        KW5170 = 4638,
+        KW5171 = 4639,
+        KW5172 = 4640,
+        KW5173 = 4641,
+        KW5174 = 4642,
+        KW5175 = 4643,
+        KW5176 = 4644,
+        KW5177 = 4645,
+        KW5178 = 4646,
+        KW5179 = 4647,
+        KW518 = 4648,
+        KW5180 = 4649,
+        KW5181 = 4650,
+        KW5182 = 4651,
+        KW5183 = 4652,
+        KW5184 = 4653,
+        KW5185 = 4654,
+        KW5186 = 4655,
+        KW5187 = 4656,
+        KW5188 = 4657,
+        KW5189 = 4658,
+        KW519 = 4659,
+        KW5190 = 4660,
+        KW5191 = 4661,
+        KW5192 = 4662,
+        KW5193 = 4663,
+        KW5194 = 4664,
+        KW5195 = 4665,
+        KW5196 = 4666,
+        KW5197 = 4667,
+        KW5198 = 4668,
+        KW5199 = 4669,
+        KW52 = 4670,
+        KW520 = 4671,
+        KW5200 = 4672,
+        KW5201 = 4673,
+        KW5202 = 4674,
+        KW5203 = 4675,
+        KW5204 = 4676,
+        KW5205 = 4677,
+        KW5206 = 4678,
+        KW5207 = 4679,
+        KW5208 = 4680,
+        KW5209 = 4681,
+        KW521 = 4682,
+        KW5210 = 4683,
+        KW5211 = 4684,
+        KW5212 = 4685,
+        KW5213 = 4686,
+        KW5214 = 4687,
+        KW5215 = 4688,
+        KW5216 = 4689,
+        KW5217 = 4690,
+        KW5218 = 4691,
+        KW5219 = 4692,
+        KW522 = 4693,
+        KW5220 = 4694,
+        KW5221 = 4695,
+        KW5222 = 4696,
+        KW5223 = 4697,
+        KW5224 = 4698,
+        KW5225 = 4699,
+        KW5226 = 4700,
+        KW5227 = 4701,
+        KW5228 = 4702,
+        KW5229 = 4703,
+        KW523 = 4704,
+        KW5230 = 4705,
+        KW5231 = 4706,
+        KW5232 = 4707,
+        KW5233 = 4708,
+        KW5234 = 4709,
+        KW5235 = 4710,
+        KW5236 = 4711,
+        KW5237 = 4712,
+        KW5238 = 4713,
+        KW5239 = 4714,
+        KW524 = 4715,
+        KW5240 = 4716,
+        KW5241 = 4717,
+        KW5242 = 4718,
+        KW5243 = 4719,
+        KW5244 = 4720,
+        KW5245 = 4721,
+        KW5246 = 4722,
+        KW5247 = 4723,
+        KW5248 = 4724,
+        KW5249 = 4725,
+        KW525 = 4726,
+        KW5250 = 4727,
+        KW5251 = 4728,
+        KW5252 = 4729,
+        KW5253 = 4730,
+        KW5254 = 4731,
+        KW5255 = 4732,
+        KW5256 = 4733,
+        KW5257 = 4734,
+        KW5258 = 4735,
+        KW5259 = 4736,
+        KW526 = 4737,
+        KW5260 = 4738,
+        KW5261 = 4739,
+        KW5262 = 4740,
+        KW5263 = 4741,
+        KW5264 = 4742,
+        KW5265 = 4743,
+        KW5266 = 4744,
+        KW5267 = 4745,
+        KW5268 = 4746,
+        KW5269 = 4747,
+        KW527 = 4748,
+        KW5270 = 4749,
+        KW5271 = 4750,
+        KW5272 = 4751,
+        KW5273 = 4752,
+        KW5274 = 4753,
+        KW5275 = 4754,
+        KW5276 = 4755,
+        KW5277 = 4756,
+        KW5278 = 4757,
+        KW5279 = 4758,
+        KW528 = 4759,
+        KW5280 = 4760,
+        KW5281 = 4761,
+        KW5282 = 4762,
+        KW5283 = 4763,
+        KW5284 = 4764,
+        KW5285 = 4765,
+        KW5286 = 4766,
+        KW5287 = 4767,
+        KW5288 = 4768,
+        KW5289 = 4769,
+        KW529 = 4770,
+        KW5290 = 4771,
+        KW5291 = 4772,
+        KW5292 = 4773,
+        KW5293 = 4774,
+        KW5294 = 4775,
+        KW5295 = 4776,
+        KW5296 = 4777,
+        KW5297 = 4778,
+        KW5298 = 4779,
+        KW5299 = 4780,
+        KW53 = 4781,
+        KW530 = 4782,
+        KW5300 = 4783,
+        KW5301 = 4784,
+        KW5302 = 4785,
+        KW5303 = 4786,
+        KW5304 = 4787,
+        KW5305 = 4788,
+        KW5306 = 4789,
+        KW5307 = 4790,
+        KW5308 = 4791,
+        KW5309 = 4792,
+        KW531 = 4793,
+        KW5310 = 4794,
+        KW5311 = 4795,
+        KW5312 = 4796,
+        KW5313 = 4797,
+        KW5314 = 4798,
+        KW5315 = 4799,
+        KW5316 = 4800,
+        KW5317 = 4801,
+        KW5318 = 4802,
+        KW5319 = 4803,
+        KW532 = 4804,
+        KW5320 = 4805,
+        KW5321 = 4806,
+        KW5322 = 4807,
+        KW5323 = 4808,
+        KW5324 = 4809,
+        KW5325 = 4810,
+        KW5326 = 4811,
+        KW5327 = 4812,
+        KW5328 = 4813,
+        KW5329 = 4814,
+        KW533 = 4815,
+        KW5330 = 4816,
+        KW5331 = 4817,
+        KW5332 = 4818,
+        KW5333 = 4819,
+        KW5334 = 4820,
+        KW5335 = 4821,
+        KW5336 = 4822,
+        KW5337 = 4823,
+        KW5338 = 4824,
+        KW5339 = 4825,
+        KW534 = 4826,
+        KW5340 = 4827,
+        KW5341 = 4828,
+        KW5342 = 4829,
+        KW5343 = 4830,
+        KW5344 = 4831,
+        KW5345 = 4832,
+        KW5346 = 4833,
+        KW5347 = 4834,
+        KW5348 = 4835,
+        KW5349 = 4836,
+        KW535 = 4837,
+        KW5350 = 4838,
+        KW5351 = 4839,
+        KW5352 = 4840,
+        KW5353 = 4841,
+        KW5354 = 4842,
+        KW5355 = 4843,
+        KW5356 = 4844,
+        KW5357 = 4845,
+        KW5358 = 4846,
+        KW5359 = 4847,
+        KW536 = 4848,
+        KW5360 = 4849,
+        KW5361 = 4850,
+        KW5362 = 4851,
+        KW5363 = 4852,
+        KW5364 = 4853,
+        KW5365 = 4854,
+        KW5366 = 4855,
+        KW5367 = 4856,
+        KW5368 = 4857,
+        KW5369 = 4858,
+        KW537 = 4859,
+        KW5370 = 4860,
+        KW5371 = 4861,
+        KW5372 = 4862,
+        KW5373 = 4863,
+        KW5374 = 4864,
+        KW5375 = 4865,
+        KW5376 = 4866,
+        KW5377 = 4867,
+        KW5378 = 4868,
+        KW5379 = 4869,
+        KW538 = 4870,
+        KW5380 = 4871,
+        KW5381 = 4872,
+        KW5382 = 4873,
+        KW5383 = 4874,
+        KW5384 = 4875,
+        KW5385 = 4876,
+        KW5386 = 4877,
+        KW5387 = 4878,
+        KW5388 = 4879,
+        KW5389 = 4880,
+        KW539 = 4881,
+        KW5390 = 4882,
+        KW5391 = 4883,
+        KW5392 = 4884,
+        KW5393 = 4885,
+        KW5394 = 4886,
+        KW5395 = 4887,
+        KW5396 = 4888,
+        KW5397 = 4889,
+        KW5398 = 4890,
+        KW5399 = 4891,
+        KW54 = 4892,
+        KW540 = 4893,
+        KW5400 = 4894,
+        KW5401 = 4895,
+        KW5402 = 4896,
+        KW5403 = 4897,
+        KW5404 = 4898,
+        KW5405 = 4899,
+        KW5406 = 4900,
+        KW5407 = 4901,
+        KW5408 = 4902,
+        KW5409 = 4903,
+        KW541 = 4904,
+        KW5410 = 4905,
+        KW5411 = 4906,
+        KW5412 = 4907,
+        KW5413 = 4908,
+        KW5414 = 4909,
+        KW5415 = 4910,
+        KW5416 = 4911,
+        KW5417 = 4912,
+        KW5418 = 4913,
+        KW5419 = 4914,
+        KW542 = 4915,
+        KW5420 = 4916,
+        KW5421 = 4917,
+        KW5422 = 4918,
+        KW5423 = 4919,
+        KW5424 = 4920,
+        KW5425 = 4921,
+        KW5426 = 4922,
+        KW5427 = 4923,
+        KW5428 = 4924,
+        KW5429 = 4925,
+        KW543 = 4926,
+        KW5430 = 4927,
+        KW5431 = 4928,
+        KW5432 = 4929,
+        KW5433 = 4930,
+        KW5434 = 4931,
+        KW5435 = 4932,
+        KW5436 = 4933,
+        KW5437 = 4934,
+        KW5438 = 4935,
+        KW5439 = 4936,
+        KW544 = 4937,
+        KW5440 = 4938,
+        KW5441 = 4939,
+        KW5442 = 4940,
+        KW5443 = 4941,
+        KW5444 = 4942,
+        KW5445 = 4943,
+        KW5446 = 4944,
+        KW5447 = 4945,
+        KW5448 = 4946,
+        KW5449 = 4947,
+        KW545 = 4948,
+        KW5450 = 4949,
+        KW5451 = 4950,
+        KW5452 = 4951,
+        KW5453 = 4952,
+        KW5454 = 4953,
+        KW5455 = 4954,
+        KW5456 = 4955,
+        KW5457 = 4956,
+        KW5458 = 4957,
+        KW5459 = 4958,
+        KW546 = 4959,
+        KW5460 = 4960,
+        KW5461 = 4961,
+        KW5462 = 4962,
+        KW5463 = 4963,
+        KW5464 = 4964,
+        KW5465 = 4965,
+        KW5466 = 4966,
+        KW5467 = 4967,
+        KW5468 = 4968,
+        KW5469 = 4969,
+        KW547 = 4970,
+        KW5470 = 4971,
+        KW5471 = 4972,
+        KW5472 = 4973,
+        KW5473 = 4974,
+        KW5474 = 4975,
+        KW5475 = 4976,
+        KW5476 = 4977,
+        KW5477 = 4978,
+        KW5478 = 4979,
+        KW5479 = 4980,
+        KW548 = 4981,
+        KW5480 = 4982,
+        KW5481 = 4983,
+        KW5482 = 4984,
+        KW5483 = 4985,
+        KW5484 = 4986,
+        KW5485 = 4987,
+        KW5486 = 4988,
+        KW5487 = 4989,
+        KW5488 = 4990,
+        KW5489 = 4991,
+        KW549 = 4992,
+        KW5490 = 4993,
+        KW5491 = 4994,
+        KW5492 = 4995,
+        KW5493 = 4996,
+        KW5494 = 4997,
+        KW5495 = 4998,
+        KW5496 = 4999,
+        KW5497 = 5000,
+        KW5498 = 5001,
+        KW5499 = 5002,
+        KW55 = 5003,
+        KW550 = 5004,
+        KW5500 = 5005,
+        KW5501 = 5006,
+        KW5502 = 5007,
+        KW5503 = 5008,
+        KW5504 = 5009,
+        KW5505 = 5010,
+        KW5506 = 5011,
+        KW5507 = 5012,
+        KW5508 = 5013,
+        KW5509 = 5014,
+        KW551 = 5015,
+        KW5510 = 5016,
+        KW5511 = 5017,
+        KW5512 = 5018,
+        KW5513 = 5019,
+        KW5514 = 5020,
+        KW5515 = 5021,
+        KW5516 = 5022,
+        KW5517 = 5023,
+        KW5518 = 5024,
+        KW5519 = 5025,
+        KW552 = 5026,
+        KW5520 = 5027,
+        KW5521 = 5028,
+        KW5522 = 5029,
+        KW5523 = 5030,
+        KW5524 = 5031,
+        KW5525 = 5032,
+        KW5526 = 5033,
+        KW5527 = 5034,
+        KW5528 = 5035,
+        KW5529 = 5036,
+        KW553 = 5037,
+        KW5530 = 5038,
+        KW5531 = 5039,
+        KW5532 = 5040,
+        KW5533 = 5041,
+        KW5534 = 5042,
+        KW5535 = 5043,
+        KW5536 = 5044,
+        KW5537 = 5045,
+        KW5538 = 5046,
+        KW5539 = 5047,
+        KW554 = 5048,
+        KW5540 = 5049,
+        KW5541 = 5050,
+        KW5542 = 5051,
+        KW5543 = 5052,
+        KW5544 = 5053,
+        KW5545 = 5054,
+        KW5546 = 5055,
+        KW5547 = 5056,
+        KW5548 = 5057,
+        KW5549 = 5058,
+        KW555 = 5059,
+        KW5550 = 5060,
+        KW5551 = 5061,
+        KW5552 = 5062,
+        KW5553 = 5063,
+        KW5554 = 5064,
+        KW5555 = 5065,
+        KW5556 = 5066,
+        KW5557 = 5067,
+        KW5558 = 5068,
+        KW5559 = 5069,
+        KW556 = 5070,
+        KW5560 = 5071,
+        KW5561 = 5072,
+        KW5562 = 5073,
+        KW5563 = 5074,
+        KW5564 = 5075,
+        KW5565 = 5076,
+        KW5566 = 5077,
+        KW5567 = 5078,
+        KW5568 = 5079,
+        KW5569 = 5080,
+        KW557 = 5081,
+        KW5570 = 5082,
+        KW5571 = 5083,
+        KW5572 = 5084,
+        KW5573 = 5085,
+        KW5574 = 5086,
+        KW5575 = 5087,
+        KW5576 = 5088,
+        KW5577 = 5089,
+        KW5578 = 5090,
+        KW5579 = 5091,
+        KW558 = 5092,
+        KW5580 = 5093,
+        KW5581 = 5094,
+        KW5582 = 5095,
+        KW5583 = 5096,
+        KW5584 = 5097,
+        KW5585 = 5098,
+        KW5586 = 5099,
+        KW5587 = 5100,
+        KW5588 = 5101,
+        KW5589 = 5102,
+        KW559 = 5103,
+        KW5590 = 5104,
+        KW5591 = 5105,
+        KW5592 = 5106,
+        KW5593 = 5107,
+        KW5594 = 5108,
+        KW5595 = 5109,
+        KW5596 = 5110,
+        KW5597 = 5111,
+        KW5598 = 5112,
+        KW5599 = 5113,
+        KW56 = 5114,
+        KW560 = 5115,
+        KW5600 = 5116,
+        KW5601 = 5117,
+        KW5602 = 5118,
+        KW5603 = 5119,
+        KW5604 = 5120,
+        KW5605 = 5121,
+        KW5606 = 5122,
+        KW5607 = 5123,
+        KW5608 = 5124,
+        KW5609 = 5125,
+        KW561 = 5126,
+        KW5610 = 5127,
+        KW5611 = 5128,
+        KW5612 = 5129,
+        KW5613 = 5130,
+        KW5614 = 5131,
+        KW5615 = 5132,
+        KW5616 = 5133,
+        KW5617 = 5134,
+        KW5618 = 5135,
+        KW5619 = 5136,
+        KW562 = 5137,
+        KW5620 = 5138,
+        KW5621 = 5139,
+        KW5622 = 5140,
+        KW5623 = 5141,
+        KW5624 = 5142,
+        KW5625 = 5143,
+        KW5626 = 5144,
+        KW5627 = 5145,
+        KW5628 = 5146,
+        KW5629 = 5147,
+        KW563 = 5148,
+        KW5630 = 5149,
+        KW5631 = 5150,
+        KW5632 = 5151,
+        KW5633 = 5152,
+        KW5634 = 5153,
+        KW5635 = 5154,
+        KW5636 = 5155,
+        KW5637 = 5156,
+        KW5638 = 5157,
+        KW5639 = 5158,
+        KW564 = 5159,
+        KW5640 = 5160,
+        KW5641 = 5161,
+        KW5642 = 5162,
+        KW5643 = 5163,
+        KW5644 = 5164,
+        KW5645 = 5165,
+        KW5646 = 5166,
+        KW5647 = 5167,
+        KW5648 = 5168,
+        KW5649 = 5169,
+        KW565 = 5170,
+        KW5650 = 5171,
+        KW5651 = 5172,
+        KW5652 = 5173,
+        KW5653 = 5174,
+        KW5654 = 5175,
+        KW5655 = 5176,
+        KW5656 = 5177,
+        KW5657 = 5178,
+        KW5658 = 5179,
+        KW5659 = 5180,
+        KW566 = 5181,
+        KW5660 = 5182,
+        KW5661 = 5183,
+        KW5662 = 5184,
+        KW5663 = 5185,
+        KW5664 = 5186,
+        KW5665 = 5187,
+        KW5666 = 5188,
+        KW5667 = 5189,
+        KW5668 = 5190,
+        KW5669 = 5191,
+        KW567 = 5192,
+        KW5670 = 5193,
+        KW5671 = 5194,
+        KW5672 = 5195,
+        KW5673 = 5196,
+        KW5674 = 5197,
+        KW5675 = 5198,
+        KW5676 = 5199,
+        KW5677 = 5200,
+        KW5678 = 5201,
+        KW5679 = 5202,
+        KW568 = 5203,
+        KW5680 = 5204,
+        KW5681 = 5205,
+        KW5682 = 5206,
+        KW5683 = 5207,
+        KW5684 = 5208,
+        KW5685 = 5209,
+        KW5686 = 5210,
+        KW5687 = 5211,
+        KW5688 = 5212,
+        KW5689 = 5213,
+        KW569 = 5214,
+        KW5690 = 5215,
+        KW5691 = 5216,
+        KW5692 = 5217,
+        KW5693 = 5218,
+        KW5694 = 5219,
+        KW5695 = 5220,
+        KW5696 = 5221,
+        KW5697 = 5222,
+        KW5698 = 5223,
+        KW5699 = 5224,
+        KW57 = 5225,
+        KW570 = 5226,
+        KW5700 = 5227,
+        KW5701 = 5228,
+        KW5702 = 5229,
+        KW5703 = 5230,
+        KW5704 = 5231,
+        KW5705 = 5232,
+        KW5706 = 5233,
+        KW5707 = 5234,
+        KW5708 = 5235,
+        KW5709 = 5236,
+        KW571 = 5237,
+        KW5710 = 5238,
+        KW5711 = 5239,
+        KW5712 = 5240,
+        KW5713 = 5241,
+        KW5714 = 5242,
+        KW5715 = 5243,
+        KW5716 = 5244,
+        KW5717 = 5245,
+        KW5718 = 5246,
+        KW5719 = 5247,
+        KW572 = 5248,
+        KW5720 = 5249,
+        KW5721 = 5250,
+        KW5722 = 5251,
+        KW5723 = 5252,
+        KW5724 = 5253,
+        KW5725 = 5254,
+        KW5726 = 5255,
+        KW5727 = 5256,
+        KW5728 = 5257,
+        KW5729 = 5258,
+        KW573 = 5259,
+        KW5730 = 5260,
+        KW5731 = 5261,
+        KW5732 = 5262,
+        KW5733 = 5263,
+        KW5734 = 5264,
+        KW5735 = 5265,
+        KW5736 = 5266,
+        KW5737 = 5267,
+        KW5738 = 5268,
+        KW5739 = 5269,
+        KW574 = 5270,
+        KW5740 = 5271,
+        KW5741 = 5272,
+        KW5742 = 5273,
+        KW5743 = 5274,
+        KW5744 = 5275,
+        KW5745 = 5276,
+        KW5746 = 5277,
+        KW5747 = 5278,
+        KW5748 = 5279,
+        KW5749 = 5280,
+        KW575 = 5281,
+        KW5750 = 5282,
+        KW5751 = 5283,
+        KW5752 = 5284,
+        KW5753 = 5285,
+        KW5754 = 5286,
+        KW5755 = 5287,
+        KW5756 = 5288,
+        KW5757 = 5289,
+        KW5758 = 5290,
+        KW5759 = 5291,
+        KW576 = 5292,
+        KW5760 = 5293,
+        KW5761 = 5294,
+        KW5762 = 5295,
+        KW5763 = 5296,
+        KW5764 = 5297,
+        KW5765 = 5298,
+        KW5766 = 5299,
+        KW5767 = 5300,
+        KW5768 = 5301,
+        KW5769 = 5302,
+        KW577 = 5303,
+        KW5770 = 5304,
+        KW5771 = 5305,
+        KW5772 = 5306,
+        KW5773 = 5307,
+        KW5774 = 5308,
+        KW5775 = 5309,
+        KW5776 = 5310,
+        KW5777 = 5311,
+        KW5778 = 5312,
+        KW5779 = 5313,
+        KW578 = 5314,
+        KW5780 = 5315,
+        KW5781 = 5316,
+        KW5782 = 5317,
+        KW5783 = 5318,
+        KW5784 = 5319,
+        KW5785 = 5320,
+        KW5786 = 5321,
+        KW5787 = 5322,
+        KW5788 = 5323,
+        KW5789 = 5324,
+        KW579 = 5325,
+        KW5790 = 5326,
+        KW5791 = 5327,
+        KW5792 = 5328,
+        KW5793 = 5329,
+        KW5794 = 5330,
+        KW5795 = 5331,
+        KW5796 = 5332,
+        KW5797 = 5333,
+        KW5798 = 5334,
+        KW5799 = 5335,
+        KW58 = 5336,
+        KW580 = 5337,
+        KW5800 = 5338,
+        KW5801 = 5339,
+        KW5802 = 5340,
+        KW5803 = 5341,
+        KW5804 = 5342,
+        KW5805 = 5343,
+        KW5806 = 5344,
+        KW5807 = 5345,
+        KW5808 = 5346,
+        KW5809 = 5347,
+        KW581 = 5348,
+        KW5810 = 5349,
+        KW5811 = 5350,
+        KW5812 = 5351,
+        KW5813 = 5352,
+        KW5814 = 5353,
+        KW5815 = 5354,
+        KW5816 = 5355,
+        KW5817 = 5356,
+        KW5818 = 5357,
+        KW5819 = 5358,
+        KW582 = 5359,
+        KW5820 = 5360,
+        KW5821 = 5361,
+        KW5822 = 5362,
+        KW5823 = 5363,
+        KW5824 = 5364,
+        KW5825 = 5365,
+        KW5826 = 5366,
+        KW5827 = 5367,
+        KW5828 = 5368,
+        KW5829 = 5369,
+        KW583 = 5370,
+        KW5830 = 5371,
+        KW5831 = 5372,
+        KW5832 = 5373,
+        KW5833 = 5374,
+        KW5834 = 5375,
+        KW5835 = 5376,
+        KW5836 = 5377,
+        KW5837 = 5378,
+        KW5838 = 5379,
+        KW5839 = 5380,
+        KW584 = 5381,
+        KW5840 = 5382,
+        KW5841 = 5383,
+        KW5842 = 5384,
+        KW5843 = 5385,
+        KW5844 = 5386,
+        KW5845 = 5387,
+        KW5846 = 5388,
+        KW5847 = 5389,
+        KW5848 = 5390,
+        KW5849 = 5391,
+        KW585 = 5392,
+        KW5850 = 5393,
+        KW5851 = 5394,
+        KW5852 = 5395,
+        KW5853 = 5396,
+        KW5854 = 5397,
+        KW5855 = 5398,
+        KW5856 = 5399,
+        KW5857 = 5400,
+        KW5858 = 5401,
+        KW5859 = 5402,
+        KW586 = 5403,
+        KW5860 = 5404,
+        KW5861 = 5405,
+        KW5862 = 5406,
+        KW5863 = 5407,
+        KW5864 = 5408,
+        KW5865 = 5409,
+        KW5866 = 5410,
+        KW5867 = 5411,
+        KW5868 = 5412,
+        KW5869 = 5413,
+        KW587 = 5414,
+        KW5870 = 5415,
+        KW5871 = 5416,
+        KW5872 = 5417,
+        KW5873 = 5418,
+        KW5874 = 5419,
+        KW5875 = 5420,
+        KW5876 = 5421,
+        KW5877 = 5422,
+        KW5878 = 5423,
+        KW5879 = 5424,
+        KW588 = 5425,
+        KW5880 = 5426,
+        KW5881 = 5427,
+        KW5882 = 5428,
+        KW5883 = 5429,
+        KW5884 = 5430,
+        KW5885 = 5431,
+        KW5886 = 5432,
+        KW5887 = 5433,
+        KW5888 = 5434,
+        KW5889 = 5435,
+        KW589 = 5436,
+        KW5890 = 5437,
+        KW5891 = 5438,
+        KW5892 = 5439,
+        KW5893 = 5440,
+        KW5894 = 5441,
+        KW5895 = 5442,
+        KW5896 = 5443,
+        KW5897 = 5444,
+        KW5898 = 5445,
+        KW5899 = 5446,
+        KW59 = 5447,
+        KW590 = 5448,
+        KW5900 = 5449,
+        KW5901 = 5450,
+        KW5902 = 5451,
+        KW5903 = 5452,
+        KW5904 = 5453,
+        KW5905 = 5454,
+        KW5906 = 5455,
+        KW5907 = 5456,
+        KW5908 = 5457,
+        KW5909 = 5458,
+        KW591 = 5459,
+        KW5910 = 5460,
+        KW5911 = 5461,
+        KW5912 = 5462,
+        KW5913 = 5463,
+        KW5914 = 5464,
+        KW5915 = 5465,
+        KW5916 = 5466,
+        KW5917 = 5467,
+        KW5918 = 5468,
+        KW5919 = 5469,
+        KW592 = 5470,
+        KW5920 = 5471,
+        KW5921 = 5472,
+        KW5922 = 5473,
+        KW5923 = 5474,
+        KW5924 = 5475,
+        KW5925 = 5476,
+        KW5926 = 5477,
+        KW5927 = 5478,
+        KW5928 = 5479,
+        KW5929 = 5480,
+        KW593 = 5481,
+        KW5930 = 5482,
+        KW5931 = 5483,
+        KW5932 = 5484,
+        KW5933 = 5485,
+        KW5934 = 5486,
+        KW5935 = 5487,
+        KW5936 = 5488,
+        KW5937 = 5489,
+        KW5938 = 5490,
+        KW5939 = 5491,
+        KW594 = 5492,
+        KW5940 = 5493,
+        KW5941 = 5494,
+        KW5942 = 5495,
+        KW5943 = 5496,
+        KW5944 = 5497,
+        KW5945 = 5498,
+        KW5946 = 5499,
+        KW5947 = 5500,
+        KW5948 = 5501,
+        KW5949 = 5502,
+        KW595 = 5503,
+        KW5950 = 5504,
+        KW5951 = 5505,
+        KW5952 = 5506,
+        KW5953 = 5507,
+        KW5954 = 5508,
+        KW5955 = 5509,
+        KW5956 = 5510,
+        KW5957 = 5511,
+        KW5958 = 5512,
+        KW5959 = 5513,
+        KW596 = 5514,
+        KW5960 = 5515,
+        KW5961 = 5516,
+        KW5962 = 5517,
+        KW5963 = 5518,
+        KW5964 = 5519,
+        KW5965 = 5520,
+        KW5966 = 5521,
+        KW5967 = 5522,
+        KW5968 = 5523,
+        KW5969 = 5524,
+        KW597 = 5525,
+        KW5970 = 5526,
+        KW5971 = 5527,
+        KW5972 = 5528,
+        KW5973 = 5529,
+        KW5974 = 5530,
+        KW5975 = 5531,
+        KW5976 = 5532,
+        KW5977 = 5533,
+        KW5978 = 5534,
+        KW5979 = 5535,
+        KW598 = 5536,
+        KW5980 = 5537,
+        KW5981 = 5538,
+        KW5982 = 5539,
+        KW5983 = 5540,
+        KW5984 = 5541,
+        KW5985 = 5542,
+        KW5986 = 5543,
+        KW5987 = 5544,
+        KW5988 = 5545,
+        KW5989 = 5546,
+        KW599 = 5547,
+        KW5990 = 5548,
+        KW5991 = 5549,
+        KW5992 = 5550,
+        KW5993 = 5551,
+        KW5994 = 5552,
+        KW5995 = 5553,
+        KW5996 = 5554,
+        KW5997 = 5555,
+        KW5998 = 5556,
+        KW5999 = 5557,
+        KW6 = 5558,
+        KW60 = 5559,
+        KW600 = 5560,
+        KW6000 = 5561,
+        KW6001 = 5562,
+        KW6002 = 5563,
+        KW6003 = 5564,
+        KW6004 = 5565,
+        KW6005 = 5566,
+        KW6006 = 5567,
+        KW6007 = 5568,
+        KW6008 = 5569,
+        KW6009 = 5570,
+        KW601 = 5571,
+        KW6010 = 5572,
+        KW6011 = 5573,
+        KW6012 = 5574,
+        KW6013 = 5575,
+        KW6014 = 5576,
+        KW6015 = 5577,
+        KW6016 = 5578,
+        KW6017 = 5579,
+        KW6018 = 5580,
+        KW6019 = 5581,
+        KW602 = 5582,
+        KW6020 = 5583,
+        KW6021 = 5584,
+        KW6022 = 5585,
+        KW6023 = 5586,
+        KW6024 = 5587,
+        KW6025 = 5588,
+        KW6026 = 5589,
+        KW6027 = 5590,
+        KW6028 = 5591,
+        KW6029 = 5592,
+        KW603 = 5593,
+        KW6030 = 5594,
+        KW6031 = 5595,
+        KW6032 = 5596,
+        KW6033 = 5597,
+        KW6034 = 5598,
+        KW6035 = 5599,
+        KW6036 = 5600,
+        KW6037 = 5601,
+        KW6038 = 5602,
+        KW6039 = 5603,
+        KW604 = 5604,
+        KW6040 = 5605,
+        KW6041 = 5606,
+        KW6042 = 5607,
+        KW6043 = 5608,
+        KW6044 = 5609,
+        KW6045 = 5610,
+        KW6046 = 5611,
+        KW6047 = 5612,
+        KW6048 = 5613,
+        KW6049 = 5614,
+        KW605 = 5615,
+        KW6050 = 5616,
+        KW6051 = 5617,
+        KW6052 = 5618,
+        KW6053 = 5619,
+        KW6054 = 5620,
+        KW6055 = 5621,
+        KW6056 = 5622,
+        KW6057 = 5623,
+        KW6058 = 5624,
+        KW6059 = 5625,
+        KW606 = 5626,
+        KW6060 = 5627,
+        KW6061 = 5628,
+        KW6062 = 5629,
+        KW6063 = 5630,
+        KW6064 = 5631,
+        KW6065 = 5632,
+        KW6066 = 5633,
+        KW6067 = 5634,
+        KW6068 = 5635,
+        KW6069 = 5636,
+        KW607 = 5637,
+        KW6070 = 5638,
+        KW6071 = 5639,
+        KW6072 = 5640,
+        KW6073 = 5641,
+        KW6074 = 5642,
+        KW6075 = 5643,
+        KW6076 = 5644,
+        KW6077 = 5645,
+        KW6078 = 5646,
+        KW6079 = 5647,
+        KW608 = 5648,
+        KW6080 = 5649,
+        KW6081 = 5650,
+        KW6082 = 5651,
+        KW6083 = 5652,
+        KW6084 = 5653,
+        KW6085 = 5654,
+        KW6086 = 5655,
+        KW6087 = 5656,
+        KW6088 = 5657,
+        KW6089 = 5658,
+        KW609 = 5659,
+        KW6090 = 5660,
+        KW6091 = 5661,
+        KW6092 = 5662,
+        KW6093 = 5663,
+        KW6094 = 5664,
+        KW6095 = 5665,
+        KW6096 = 5666,
+        KW6097 = 5667,
+        KW6098 = 5668,
+        KW6099 = 5669,
+        KW61 = 5670,
+        KW610 = 5671,
+        KW6100 = 5672,
+        KW6101 = 5673,
+        KW6102 = 5674,
+        KW6103 = 5675,
+        KW6104 = 5676,
+        KW6105 = 5677,
+        KW6106 = 5678,
+        KW6107 = 5679,
+        KW6108 = 5680,
+        KW6109 = 5681,
+        KW611 = 5682,
+        KW6110 = 5683,
+        KW6111 = 5684,
+        KW6112 = 5685,
+        KW6113 = 5686,
+        KW6114 = 5687,
+        KW6115 = 5688,
+        KW6116 = 5689,
+        KW6117 = 5690,
+        KW6118 = 5691,
+        KW6119 = 5692,
+        KW612 = 5693,
+        KW6120 = 5694,
+        KW6121 = 5695,
+        KW6122 = 5696,
+        KW6123 = 5697,
+        KW6124 = 5698,
+        KW6125 = 5699,
+        KW6126 = 5700,
+        KW6127 = 5701,
+        KW6128 = 5702,
+        KW6129 = 5703,
+        KW613 = 5704,
+        KW6130 = 5705,
+        KW6131 = 5706,
+        KW6132 = 5707,
+        KW6133 = 5708,
+        KW6134 = 5709,
+        KW6135 = 5710,
+        KW6136 = 5711,
+        KW6137 = 5712,
+        KW6138 = 5713,
+        KW6139 = 5714,
+        KW614 = 5715,
+        KW6140 = 5716,
+        KW6141 = 5717,
+        KW6142 = 5718,
+        KW6143 = 5719,
+        KW6144 = 5720,
+        KW6145 = 5721,
+        KW6146 = 5722,
+        KW6147 = 5723,
+        KW6148 = 5724,
+        KW6149 = 5725,
+        KW615 = 5726,
+        KW6150 = 5727,
+        KW6151 = 5728,
+        KW6152 = 5729,
+        KW6153 = 5730,
+        KW6154 = 5731,
+        KW6155 = 5732,
+        KW6156 = 5733,
+        KW6157 = 5734,
+        KW6158 = 5735,
+        KW6159 = 5736,
+        KW616 = 5737,
+        KW6160 = 5738,
+        KW6161 = 5739,
+        KW6162 = 5740,
+        KW6163 = 5741,
+        KW6164 = 5742,
+        KW6165 = 5743,
+        KW6166 = 5744,
+        KW6167 = 5745,
+        KW6168 = 5746,
+        KW6169 = 5747,
+        KW617 = 5748,
+        KW6170 = 5749,
+        KW6171 = 5750,
+        KW6172 = 5751,
+        KW6173 = 5752,
+        KW6174 = 5753,
+        KW6175 = 5754,
+        KW6176 = 5755,
+        KW6177 = 5756,
+        KW6178 = 5757,
+        KW6179 = 5758,
+        KW618 = 5759,
+        KW6180 = 5760,
+        KW6181 = 5761,
+        KW6182 = 5762,
+        KW6183 = 5763,
+        KW6184 = 5764,
+        KW6185 = 5765,
+        KW6186 = 5766,
+        KW6187 = 5767,
+        KW6188 = 5768,
+        KW6189 = 5769,
+        KW619 = 5770,
+        KW6190 = 5771,
+        KW6191 = 5772,
+        KW6192 = 5773,
+        KW6193 = 5774,
+        KW6194 = 5775,
+        KW6195 = 5776,
+        KW6196 = 5777,
+        KW6197 = 5778,
+        KW6198 = 5779,
+        KW6199 = 5780,
+        KW62 = 5781,
+        KW620 = 5782,
+        KW6200 = 5783,
+        KW6201 = 5784,
+        KW6202 = 5785,
+        KW6203 = 5786,
+        KW6204 = 5787,
+        KW6205 = 5788,
+        KW6206 = 5789,
+        KW6207 = 5790,
+        KW6208 = 5791,
+        KW6209 = 5792,
+        KW621 = 5793,
+        KW6210 = 5794,
+        KW6211 = 5795,
+        KW6212 = 5796,
+        KW6213 = 5797,
+        KW6214 = 5798,
+        KW6215 = 5799,
+        KW6216 = 5800,
+        KW6217 = 5801,
+        KW6218 = 5802,
+        KW6219 = 5803,
+        KW622 = 5804,
+        KW6220 = 5805,
+        KW6221 = 5806,
+        KW6222 = 5807,
+        KW6223 = 5808,
+        KW6224 = 5809,
+        KW6225 = 5810,
+        KW6226 = 5811,
+        KW6227 = 5812,
+        KW6228 = 5813,
+        KW6229 = 5814,
+        KW623 = 5815,
+        KW6230 = 5816,
+        KW6231 = 5817,
+        KW6232 = 5818,
+        KW6233 = 5819,
+        KW6234 = 5820,
+        KW6235 = 5821,
+        KW6236 = 5822,
+        KW6237 = 5823,
+        KW6238 = 5824,
+        KW6239 = 5825,
+        KW624 = 5826,
+        KW6240 = 5827,
+        KW6241 = 5828,
+        KW6242 = 5829,
+        KW6243 = 5830,
+        KW6244 = 5831,
+        KW6245 = 5832,
+        KW6246 = 5833,
+        KW6247 = 5834,
+        KW6248 = 5835,
+        KW6249 = 5836,
+        KW625 = 5837,
+        KW6250 = 5838,
+        KW6251 = 5839,
+        KW6252 = 5840,
+        KW6253 = 5841,
+        KW6254 = 5842,
+        KW6255 = 5843,
+        KW6256 = 5844,
+        KW6257 = 5845,
+        KW6258 = 5846,
+        KW6259 = 5847,
+        KW626 = 5848,
+        KW6260 = 5849,
+        KW6261 = 5850,
+        KW6262 = 5851,
+        KW6263 = 5852,
+        KW6264 = 5853,
+        KW6265 = 5854,
+        KW6266 = 5855,
+        KW6267 = 5856,
+        KW6268 = 5857,
+        KW6269 = 5858,
+        KW627 = 5859,
+        KW6270 = 5860,
+        KW6271 = 5861,
+        KW6272 = 5862,
+        KW6273 = 5863,
+        KW6274 = 5864,
+        KW6275 = 5865,
+        KW6276 = 5866,
+        KW6277 = 5867,
+        KW6278 = 5868,
+        KW6279 = 5869,
+        KW628 = 5870,
+        KW6280 = 5871,
+        KW6281 = 5872,
+        KW6282 = 5873,
+        KW6283 = 5874,
+        KW6284 = 5875,
+        KW6285 = 5876,
+        KW6286 = 5877,
+        KW6287 = 5878,
+        KW6288 = 5879,
+        KW6289 = 5880,
+        KW629 = 5881,
+        KW6290 = 5882,
+        KW6291 = 5883,
+        KW6292 = 5884,
+        KW6293 = 5885,
+        KW6294 = 5886,
+        KW6295 = 5887,
+        KW6296 = 5888,
+        KW6297 = 5889,
+        KW6298 = 5890,
+        KW6299 = 5891,
+        KW63 = 5892,
+        KW630 = 5893,
+        KW6300 = 5894,
+        KW6301 = 5895,
+        KW6302 = 5896,
+        KW6303 = 5897,
+        KW6304 = 5898,
+        KW6305 = 5899,
+        KW6306 = 5900,
+        KW6307 = 5901,
+        KW6308 = 5902,
+        KW6309 = 5903,
+        KW631 = 5904,
+        KW6310 = 5905,
+        KW6311 = 5906,
+        KW6312 = 5907,
+        KW6313 = 5908,
+        KW6314 = 5909,
+        KW6315 = 5910,
+        KW6316 = 5911,
+        KW6317 = 5912,
+        KW6318 = 5913,
+        KW6319 = 5914,
+        KW632 = 5915,
+        KW6320 = 5916,
+        KW6321 = 5917,
+        KW6322 = 5918,
+        KW6323 = 5919,
+        KW6324 = 5920,
+        KW6325 = 5921,
+        KW6326 = 5922,
+        KW6327 = 5923,
+        KW6328 = 5924,
+        KW6329 = 5925,
+        KW633 = 5926,
+        KW6330 = 5927,
+        KW6331 = 5928,
+        KW6332 = 5929,
+        KW6333 = 5930,
+        KW6334 = 5931,
+        KW6335 = 5932,
+        KW6336 = 5933,
+        KW6337 = 5934,
+        KW6338 = 5935,
+        KW6339 = 5936,
+        KW634 = 5937,
+        KW6340 = 5938,
+        KW6341 = 5939,
+        KW6342 = 5940,
+        KW6343 = 5941,
+        KW6344 = 5942,
+        KW6345 = 5943,
+        KW6346 = 5944,
+        KW6347 = 5945,
+        KW6348 = 5946,
+        KW6349 = 5947,
+        KW635 = 5948,
+        KW6350 = 5949,
+        KW6351 = 5950,
+        KW6352 = 5951,
+        KW6353 = 5952,
+        KW6354 = 5953,
+        KW6355 = 5954,
+        KW6356 = 5955,
+        KW6357 = 5956,
+        KW6358 = 5957,
+        KW6359 = 5958,
+        KW636 = 5959,
+        KW6360 = 5960,
+        KW6361 = 5961,
+        KW6362 = 5962,
+        KW6363 = 5963,
+        KW6364 = 5964,
+        KW6365 = 5965,
+        KW6366 = 5966,
+        KW6367 = 5967,
+        KW6368 = 5968,
+        KW6369 = 5969,
+        KW637 = 5970,
+        KW6370 = 5971,
+        KW6371 = 5972,
+        KW6372 = 5973,
+        KW6373 = 5974,
+        KW6374 = 5975,
+        KW6375 = 5976,
+        KW6376 = 5977,
+        KW6377 = 5978,
+        KW6378 = 5979,
+        KW6379 = 5980,
+        KW638 = 5981,
+        KW6380 = 5982,
+        KW6381 = 5983,
+        KW6382 = 5984,
+        KW6383 = 5985,
+        KW6384 = 5986,
+        KW6385 = 5987,
+        KW6386 = 5988,
+        KW6387 = 5989,
+        KW6388 = 5990,
+        KW6389 = 5991,
+        KW639 = 5992,
+        KW6390 = 5993,
+        KW6391 = 5994,
+        KW6392 = 5995,
+        KW6393 = 5996,
+        KW6394 = 5997,
+        KW6395 = 5998,
+        KW6396 = 5999,
+        KW6397 = 6000,
+        KW6398 = 6001,
+        KW6399 = 6002,
+        KW64 = 6003,
+        KW640 = 6004,
+        KW6400 = 6005,
+        KW6401 = 6006,
+        KW6402 = 6007,
+        KW6403 = 6008,
+        KW6404 = 6009,
+        KW6405 = 6010,
+        KW6406 = 6011,
+        KW6407 = 6012,
+        KW6408 = 6013,
+        KW6409 = 6014,
+        KW641 = 6015,
+        KW6410 = 6016,
+        KW6411 = 6017,
+        KW6412 = 6018,
+        KW6413 = 6019,
+        KW6414 = 6020,
+        KW6415 = 6021,
+        KW6416 = 6022,
+        KW6417 = 6023,
+        KW6418 = 6024,
+        KW6419 = 6025,
+        KW642 = 6026,
+        KW6420 = 6027,
+        KW6421 = 6028,
+        KW6422 = 6029,
+        KW6423 = 6030,
+        KW6424 = 6031,
+        KW6425 = 6032,
+        KW6426 = 6033,
+        KW6427 = 6034,
+        KW6428 = 6035,
+        KW6429 = 6036,
+        KW643 = 6037,
+        KW6430 = 6038,
+        KW6431 = 6039,
+        KW6432 = 6040,
+        KW6433 = 6041,
+        KW6434 = 6042,
+        KW6435 = 6043,
+        KW6436 = 6044,
+        KW6437 = 6045,
+        KW6438 = 6046,
+        KW6439 = 6047,
+        KW644 = 6048,
+        KW6440 = 6049,
+        KW6441 = 6050,
+        KW6442 = 6051,
+        KW6443 = 6052,
+        KW6444 = 6053,
+        KW6445 = 6054,
+        KW6446 = 6055,
+        KW6447 = 6056,
+        KW6448 = 6057,
+        KW6449 = 6058,
+        KW645 = 6059,
+        KW6450 = 6060,
+        KW6451 = 6061,
+        KW6452 = 6062,
+        KW6453 = 6063,
+        KW6454 = 6064,
+        KW6455 = 6065,
+        KW6456 = 6066,
+        KW6457 = 6067,
+        KW6458 = 6068,
+        KW6459 = 6069,
+        KW646 = 6070,
+        KW6460 = 6071,
+        KW6461 = 6072,
+        KW6462 = 6073,
+        KW6463 = 6074,
+        KW6464 = 6075,
+        KW6465 = 6076,
+        KW6466 = 6077,
+        KW6467 = 6078,
+        KW6468 = 6079,
+        KW6469 = 6080,
+        KW647 = 6081,
+        KW6470 = 6082,
+        KW6471 = 6083,
+        KW6472 = 6084,
+        KW6473 = 6085,
+        KW6474 = 6086,
+        KW6475 = 6087,
+        KW6476 = 6088,
+        KW6477 = 6089,
+        KW6478 = 6090,
+        KW6479 = 6091,
+        KW648 = 6092,
+        KW6480 = 6093,
+        KW6481 = 6094,
+        KW6482 = 6095,
+        KW6483 = 6096,
+        KW6484 = 6097,
+        KW6485 = 6098,
+        KW6486 = 6099,
+        KW6487 = 6100,
+        KW6488 = 6101,
+        KW6489 = 6102,
+        KW649 = 6103,
+        KW6490 = 6104,
+        KW6491 = 6105,
+        KW6492 = 6106,
+        KW6493 = 6107,
+        KW6494 = 6108,
+        KW6495 = 6109,
+        KW6496 = 6110,
+        KW6497 = 6111,
+        KW6498 = 6112,
+        KW6499 = 6113,
+        KW65 = 6114,
+        KW650 = 6115,
+        KW6500 = 6116,
+        KW6501 = 6117,
+        KW6502 = 6118,
+        KW6503 = 6119,
+        KW6504 = 6120,
+        KW6505 = 6121,
+        KW6506 = 6122,
+        KW6507 = 6123,
+        KW6508 = 6124,
+        KW6509 = 6125,
+        KW651 = 6126,
+        KW6510 = 6127,
+        KW6511 = 6128,
+        KW6512 = 6129,
+        KW6513 = 6130,
+        KW6514 = 6131,
+        KW6515 = 6132,
+        KW6516 = 6133,
+        KW6517 = 6134,
+        KW6518 = 6135,
+        KW6519 = 6136,
+        KW652 = 6137,
+        KW6520 = 6138,
+        KW6521 = 6139,
+        KW6522 = 6140,
+        KW6523 = 6141,
+        KW6524 = 6142,
+        KW6525 = 6143,
+        KW6526 = 6144,
+        KW6527 = 6145,
+        KW6528 = 6146,
+        KW6529 = 6147,
+        KW653 = 6148,
+        KW6530 = 6149,
+        KW6531 = 6150,
+        KW6532 = 6151,
+        KW6533 = 6152,
+        KW6534 = 6153,
+        KW6535 = 6154,
+        KW6536 = 6155,
+        KW6537 = 6156,
+        KW6538 = 6157,
+        KW6539 = 6158,
+        KW654 = 6159,
+        KW6540 = 6160,
+        KW6541 = 6161,
+        KW6542 = 6162,
+        KW6543 = 6163,
+        KW6544 = 6164,
+        KW6545 = 6165,
+        KW6546 = 6166,
+        KW6547 = 6167,
+        KW6548 = 6168,
+        KW6549 = 6169,
+        KW655 = 6170,
+        KW6550 = 6171,
+        KW6551 = 6172,
+        KW6552 = 6173,
+        KW6553 = 6174,
+        KW6554 = 6175,
+        KW6555 = 6176,
+        KW6556 = 6177,
+        KW6557 = 6178,
+        KW6558 = 6179,
+        KW6559 = 6180,
+        KW656 = 6181,
+        KW6560 = 6182,
+        KW6561 = 6183,
+        KW6562 = 6184,
+        KW6563 = 6185,
+        KW6564 = 6186,
+        KW6565 = 6187,
+        KW6566 = 6188,
+        KW6567 = 6189,
+        KW6568 = 6190,
+        KW6569 = 6191,
+        KW657 = 6192,
+        KW6570 = 6193,
+        KW6571 = 6194,
+        KW6572 = 6195,
+        KW6573 = 6196,
+        KW6574 = 6197,
+        KW6575 = 6198,
+        KW6576 = 6199,
+        KW6577 = 6200,
+        KW6578 = 6201,
+        KW6579 = 6202,
+        KW658 = 6203,
+        KW6580 = 6204,
+        KW6581 = 6205,
+        KW6582 = 6206,
+        KW6583 = 6207,
+        KW6584 = 6208,
+        KW6585 = 6209,
+        KW6586 = 6210,
+        KW6587 = 6211,
+        KW6588 = 6212,
+        KW6589 = 6213,
+        KW659 = 6214,
+        KW6590 = 6215,
+        KW6591 = 6216,
+        KW6592 = 6217,
+        KW6593 = 6218,
+        KW6594 = 6219,
+        KW6595 = 6220,
+        KW6596 = 6221,
+        KW6597 = 6222,
+        KW6598 = 6223,
+        KW6599 = 6224,
+        KW66 = 6225,
+        KW660 = 6226,
+        KW6600 = 6227,
+        KW6601 = 6228,
+        KW6602 = 6229,
+        KW6603 = 6230,
+        KW6604 = 6231,
+        KW6605 = 6232,
+        KW6606 = 6233,
+        KW6607 = 6234,
+        KW6608 = 6235,
+        KW6609 = 6236,
+        KW661 = 6237,
+        KW6610 = 6238,
+        KW6611 = 6239,
+        KW6612 = 6240,
+        KW6613 = 6241,
+        KW6614 = 6242,
+        KW6615 = 6243,
+        KW6616 = 6244,
+        KW6617 = 6245,
+        KW6618 = 6246,
+        KW6619 = 6247,
+        KW662 = 6248,
+        KW6620 = 6249,
+        KW6621 = 6250,
+        KW6622 = 6251,
+        KW6623 = 6252,
+        KW6624 = 6253,
+        KW6625 = 6254,
+        KW6626 = 6255,
+        KW6627 = 6256,
+        KW6628 = 6257,
+        KW6629 = 6258,
+        KW663 = 6259,
+        KW6630 = 6260,
+        KW6631 = 6261,
+        KW6632 = 6262,
+        KW6633 = 6263,
+        KW6634 = 6264,
+        KW6635 = 6265,
+        KW6636 = 6266,
+        KW6637 = 6267,
+        KW6638 = 6268,
+        KW6639 = 6269,
+        KW664 = 6270,
+        KW6640 = 6271,
+        KW6641 = 6272,
+        KW6642 = 6273,
+        KW6643 = 6274,
+        KW6644 = 6275,
+        KW6645 = 6276,
+        KW6646 = 6277,
+        KW6647 = 6278,
+        KW6648 = 6279,
+        KW6649 = 6280,
+        KW665 = 6281,
+        KW6650 = 6282,
+        KW6651 = 6283,
+        KW6652 = 6284,
+        KW6653 = 6285,
+        KW6654 = 6286,
+        KW6655 = 6287,
+        KW6656 = 6288,
+        KW6657 = 6289,
+        KW6658 = 6290,
+        KW6659 = 6291,
+        KW666 = 6292,
+        KW6660 = 6293,
+        KW6661 = 6294,
+        KW6662 = 6295,
+        KW6663 = 6296,
+        KW6664 = 6297,
+        KW6665 = 6298,
+        KW6666 = 6299,
+        KW6667 = 6300,
+        KW6668 = 6301,
+        KW6669 = 6302,
+        KW667 = 6303,
+        KW6670 = 6304,
+        KW6671 = 6305,
+        KW6672 = 6306,
+        KW6673 = 6307,
+        KW6674 = 6308,
+        KW6675 = 6309,
+        KW6676 = 6310,
+        KW6677 = 6311,
+        KW6678 = 6312,
+        KW6679 = 6313,
+        KW668 = 6314,
+        KW6680 = 6315,
+        KW6681 = 6316,
+        KW6682 = 6317,
+        KW6683 = 6318,
+        KW6684 = 6319,
+        KW6685 = 6320,
+        KW6686 = 6321,
+        KW6687 = 6322,
+        KW6688 = 6323,
+        KW6689 = 6324,
+        KW669 = 6325,
+        KW6690 = 6326,
+        KW6691 = 6327,
+        KW6692 = 6328,
+        KW6693 = 6329,
+        KW6694 = 6330,
+        KW6695 = 6331,
+        KW6696 = 6332,
+        KW6697 = 6333,
+        KW6698 = 6334,
+        KW6699 = 6335,
+        KW67 = 6336,
+        KW670 = 6337,
+        KW6700 = 6338,
+        KW6701 = 6339,
+        KW6702 = 6340,
+        KW6703 = 6341,
+        KW6704 = 6342,
+        KW6705 = 6343,
+        KW6706 = 6344,
+        KW6707 = 6345,
+        KW6708 = 6346,
+        KW6709 = 6347,
+        KW671 = 6348,
+        KW6710 = 6349,
+        KW6711 = 6350,
+        KW6712 = 6351,
+        KW6713 = 6352,
+        KW6714 = 6353,
+        KW6715 = 6354,
+        KW6716 = 6355,
+        KW6717 = 6356,
+        KW6718 = 6357,
+        KW6719 = 6358,
+        KW672 = 6359,
+        KW6720 = 6360,
+        KW6721 = 6361,
+        KW6722 = 6362,
+        KW6723 = 6363,
+        KW6724 = 6364,
+        KW6725 = 6365,
+        KW6726 = 6366,
+        KW6727 = 6367,
+        KW6728 = 6368,
+        KW6729 = 6369,
+        KW673 = 6370,
+        KW6730 = 6371,
+        KW6731 = 6372,
+        KW6732 = 6373,
+        KW6733 = 6374,
+        KW6734 = 6375,
+        KW6735 = 6376,
+        KW6736 = 6377,
+        KW6737 = 6378,
+        KW6738 = 6379,
+        KW6739 = 6380,
+        KW674 = 6381,
+        KW6740 = 6382,
+        KW6741 = 6383,
+        KW6742 = 6384,
+        KW6743 = 6385,
+        KW6744 = 6386,
+        KW6745 = 6387,
+        KW6746 = 6388,
+        KW6747 = 6389,
+        KW6748 = 6390,
+        KW6749 = 6391,
+        KW675 = 6392,
+        KW6750 = 6393,
+        KW6751 = 6394,
+        KW6752 = 6395,
+        KW6753 = 6396,
+        KW6754 = 6397,
+        KW6755 = 6398,
+        KW6756 = 6399,
+        KW6757 = 6400,
+        KW6758 = 6401,
+        KW6759 = 6402,
+        KW676 = 6403,
+        KW6760 = 6404,
+        KW6761 = 6405,
+        KW6762 = 6406,
+        KW6763 = 6407,
+        KW6764 = 6408,
+        KW6765 = 6409,
+        KW6766 = 6410,
+        KW6767 = 6411,
+        KW6768 = 6412,
+        KW6769 = 6413,
+        KW677 = 6414,
+        KW6770 = 6415,
+        KW6771 = 6416,
+        KW6772 = 6417,
+        KW6773 = 6418,
+        KW6774 = 6419,
+        KW6775 = 6420,
+        KW6776 = 6421,
+        KW6777 = 6422,
+        KW6778 = 6423,
+        KW6779 = 6424,
+        KW678 = 6425,
+        KW6780 = 6426,
+        KW6781 = 6427,
+        KW6782 = 6428,
+        KW6783 = 6429,
+        KW6784 = 6430,
+        KW6785 = 6431,
+        KW6786 = 6432,
+        KW6787 = 6433,
+        KW6788 = 6434,
+        KW6789 = 6435,
+        KW679 = 6436,
+        KW6790 = 6437,
+        KW6791 = 6438,
+        KW6792 = 6439,
+        KW6793 = 6440,
+        KW6794 = 6441,
+        KW6795 = 6442,
+        KW6796 = 6443,
+        KW6797 = 6444,
+        KW6798 = 6445,
+        KW6799 = 6446,
+        KW68 = 6447,
+        KW680 = 6448,
+        KW6800 = 6449,
+        KW6801 = 6450,
+        KW6802 = 6451,
+        KW6803 = 6452,
+        KW6804 = 6453,
+        KW6805 = 6454,
+        KW6806 = 6455,
+        KW6807 = 6456,
+        KW6808 = 6457,
+        KW6809 = 6458,
+        KW681 = 6459,
+        KW6810 = 6460,
+        KW6811 = 6461,
+        KW6812 = 6462,
+        KW6813 = 6463,
+        KW6814 = 6464,
+        KW6815 = 6465,
+        KW6816 = 6466,
+        KW6817 = 6467,
+        KW6818 = 6468,
+        KW6819 = 6469,
+        KW682 = 6470,
+        KW6820 = 6471,
+        KW6821 = 6472,
+        KW6822 = 6473,
+        KW6823 = 6474,
+        KW6824 = 6475,
+        KW6825 = 6476,
+        KW6826 = 6477,
+        KW6827 = 6478,
+        KW6828 = 6479,
+        KW6829 = 6480,
+        KW683 = 6481,
+        KW6830 = 6482,
+        KW6831 = 6483,
+        KW6832 = 6484,
+        KW6833 = 6485,
+        KW6834 = 6486,
+        KW6835 = 6487,
+        KW6836 = 6488,
+        KW6837 = 6489,
+        KW6838 = 6490,
+        KW6839 = 6491,
+        KW684 = 6492,
+        KW6840 = 6493,
+        KW6841 = 6494,
+        KW6842 = 6495,
+        KW6843 = 6496,
+        KW6844 = 6497,
+        KW6845 = 6498,
+        KW6846 = 6499,
+        KW6847 = 6500,
+        KW6848 = 6501,
+        KW6849 = 6502,
+        KW685 = 6503,
+        KW6850 = 6504,
+        KW6851 = 6505,
+        KW6852 = 6506,
+        KW6853 = 6507,
+        KW6854 = 6508,
+        KW6855 = 6509,
+        KW6856 = 6510,
+        KW6857 = 6511,
+        KW6858 = 6512,
+        KW6859 = 6513,
+        KW686 = 6514,
+        KW6860 = 6515,
+        KW6861 = 6516,
+        KW6862 = 6517,
+        KW6863 = 6518,
+        KW6864 = 6519,
+        KW6865 = 6520,
+        KW6866 = 6521,
+        KW6867 = 6522,
+        KW6868 = 6523,
+        KW6869 = 6524,
+        KW687 = 6525,
+        KW6870 = 6526,
+        KW6871 = 6527,
+        KW6872 = 6528,
+        KW6873 = 6529,
+        KW6874 = 6530,
+        KW6875 = 6531,
+        KW6876 = 6532,
+        KW6877 = 6533,
+        KW6878 = 6534,
+        KW6879 = 6535,
+        KW688 = 6536,
+        KW6880 = 6537,
+        KW6881 = 6538,
+        KW6882 = 6539,
+        KW6883 = 6540,
+        KW6884 = 6541,
+        KW6885 = 6542,
+        KW6886 = 6543,
+        KW6887 = 6544,
+        KW6888 = 6545,
+        KW6889 = 6546,
+        KW689 = 6547,
+        KW6890 = 6548,
+        KW6891 = 6549,
+        KW6892 = 6550,
+        KW6893 = 6551,
+        KW6894 = 6552,
+        KW6895 = 6553,
+        KW6896 = 6554,
+        KW6897 = 6555,
+        KW6898 = 6556,
+        KW6899 = 6557,
+        KW69 = 6558,
+        KW690 = 6559,
+        KW6900 = 6560,
+        KW6901 = 6561,
+        KW6902 = 6562,
+        KW6903 = 6563,
+        KW6904 = 6564,
+        KW6905 = 6565,
+        KW6906 = 6566,
+        KW6907 = 6567,
+        KW6908 = 6568,
+        KW6909 = 6569,
+        KW691 = 6570,
+        KW6910 = 6571,
+        KW6911 = 6572,
+        KW6912 = 6573,
+        KW6913 = 6574,
+        KW6914 = 6575,
+        KW6915 = 6576,
+        KW6916 = 6577,
+        KW6917 = 6578,
+        KW6918 = 6579,
+        KW6919 = 6580,
+        KW692 = 6581,
+        KW6920 = 6582,
+        KW6921 = 6583,
+        KW6922 = 6584,
+        KW6923 = 6585,
+        KW6924 = 6586,
+        KW6925 = 6587,
+        KW6926 = 6588,
+        KW6927 = 6589,
+        KW6928 = 6590,
+        KW6929 = 6591,
+        KW693 = 6592,
+        KW6930 = 6593,
+        KW6931 = 6594,
+        KW6932 = 6595,
+        KW6933 = 6596,
+        KW6934 = 6597,
+        KW6935 = 6598,
+        KW6936 = 6599,
+        KW6937 = 6600,
+        KW6938 = 6601,
+        KW6939 = 6602,
+        KW694 = 6603,
+        KW6940 = 6604,
+        KW6941 = 6605,
+        KW6942 = 6606,
+        KW6943 = 6607,
+        KW6944 = 6608,
+        KW6945 = 6609,
+        KW6946 = 6610,
+        KW6947 = 6611,
+        KW6948 = 6612,
+        KW6949 = 6613,
+        KW695 = 6614,
+        KW6950 = 6615,
+        KW6951 = 6616,
+        KW6952 = 6617,
+        KW6953 = 6618,
+        KW6954 = 6619,
+        KW6955 = 6620,
+        KW6956 = 6621,
+        KW6957 = 6622,
+        KW6958 = 6623,
+        KW6959 = 6624,
+        KW696 = 6625,
+        KW6960 = 6626,
+        KW6961 = 6627,
+        KW6962 = 6628,
+        KW6963 = 6629,
+        KW6964 = 6630,
+        KW6965 = 6631,
+        KW6966 = 6632,
+        KW6967 = 6633,
+        KW6968 = 6634,
+        KW6969 = 6635,
+        KW697 = 6636,
+        KW6970 = 6637,
+        KW6971 = 6638,
+        KW6972 = 6639,
+        KW6973 = 6640,
+        KW6974 = 6641,
+        KW6975 = 6642,
+        KW6976 = 6643,
+        KW6977 = 6644,
+        KW6978 = 6645,
+        KW6979 = 6646,
+        KW698 = 6647,
+        KW6980 = 6648,
+        KW6981 = 6649,
+        KW6982 = 6650,
+        KW6983 = 6651,
+        KW6984 = 6652,
+        KW6985 = 6653,
+        KW6986 = 6654,
+        KW6987 = 6655,
+        KW6988 = 6656,
+        KW6989 = 6657,
+        KW699 = 6658,
+        KW6990 = 6659,
+        KW6991 = 6660,
+        KW6992 = 6661,
+        KW6993 = 6662,
+        KW6994 = 6663,
+        KW6995 = 6664,
+        KW6996 = 6665,
+        KW6997 = 6666,
+        KW6998 = 6667,
+        KW6999 = 6668,
+        KW7 = 6669,
+        KW70 = 6670,
+        KW700 = 6671,
+        KW7000 = 6672,
+        KW7001 = 6673,
+        KW7002 = 6674,
+        KW7003 = 6675,
+        KW7004 = 6676,
+        KW7005 = 6677,
+        KW7006 = 6678,
+        KW7007 = 6679,
+        KW7008 = 6680,
+        KW7009 = 6681,
+        KW701 = 6682,
+        KW7010 = 6683,
+        KW7011 = 6684,
+        KW7012 = 6685,
+        KW7013 = 6686,
+        KW7014 = 6687,
+        KW7015 = 6688,
+        KW7016 = 6689,
+        KW7017 = 6690,
+        KW7018 = 6691,
+        KW7019 = 6692,
+        KW702 = 6693,
+        KW7020 = 6694,
+        KW7021 = 6695,
+        KW7022 = 6696,
+        KW7023 = 6697,
+        KW7024 = 6698,
+        KW7025 = 6699,
+        KW7026 = 6700,
+        KW7027 = 6701,
+        KW7028 = 6702,
+        KW7029 = 6703,
+        KW703 = 6704,
+        KW7030 = 6705,
+        KW7031 = 6706,
+        KW7032 = 6707,
+        KW7033 = 6708,
+        KW7034 = 6709,
+        KW7035 = 6710,
+        KW7036 = 6711,
+        KW7037 = 6712,
+        KW7038 = 6713,
+        KW7039 = 6714,
+        KW704 = 6715,
+        KW7040 = 6716,
+        KW7041 = 6717,
+        KW7042 = 6718,
+        KW7043 = 6719,
+        KW7044 = 6720,
+        KW7045 = 6721,
+        KW7046 = 6722,
+        KW7047 = 6723,
+        KW7048 = 6724,
+        KW7049 = 6725,
+        KW705 = 6726,
+        KW7050 = 6727,
+        KW7051 = 6728,
+        KW7052 = 6729,
+        KW7053 = 6730,
+        KW7054 = 6731,
+        KW7055 = 6732,
+        KW7056 = 6733,
+        KW7057 = 6734,
+        KW7058 = 6735,
+        KW7059 = 6736,
+        KW706 = 6737,
+        KW7060 = 6738,
+        KW7061 = 6739,
+        KW7062 = 6740,
+        KW7063 = 6741,
+        KW7064 = 6742,
+        KW7065 = 6743,
+        KW7066 = 6744,
+        KW7067 = 6745,
+        KW7068 = 6746,
+        KW7069 = 6747,
+        KW707 = 6748,
+        KW7070 = 6749,
+        KW7071 = 6750,
+        KW7072 = 6751,
+        KW7073 = 6752,
+        KW7074 = 6753,
+        KW7075 = 6754,
+        KW7076 = 6755,
+        KW7077 = 6756,
+        KW7078 = 6757,
+        KW7079 = 6758,
+        KW708 = 6759,
+        KW7080 = 6760,
+        KW7081 = 6761,
+        KW7082 = 6762,
+        KW7083 = 6763,
+        KW7084 = 6764,
+        KW7085 = 6765,
+        KW7086 = 6766,
+        KW7087 = 6767,
+        KW7088 = 6768,
+        KW7089 = 6769,
+        KW709 = 6770,
+        KW7090 = 6771,
+        KW7091 = 6772,
+        KW7092 = 6773,
+        KW7093 = 6774,
+        KW7094 = 6775,
+        KW7095 = 6776,
+        KW7096 = 6777,
+        KW7097 = 6778,
+        KW7098 = 6779,
+        KW7099 = 6780,
+        KW71 = 6781,
+        KW710 = 6782,
+        KW7100 = 6783,
+        KW7101 = 6784,
+        KW7102 = 6785,
+        KW7103 = 6786,
+        KW7104 = 6787,
+        KW7105 = 6788,
+        KW7106 = 6789,
+        KW7107 = 6790,
+        KW7108 = 6791,
+        KW7109 = 6792,
+        KW711 = 6793,
+        KW7110 = 6794,
+        KW7111 = 6795,
+        KW7112 = 6796,
+        KW7113 = 6797,
+        KW7114 = 6798,
+        KW7115 = 6799,
+        KW7116 = 6800,
+        KW7117 = 6801,
+        KW7118 = 6802,
+        KW7119 = 6803,
+        KW712 = 6804,
+        KW7120 = 6805,
+        KW7121 = 6806,
+        KW7122 = 6807,
+        KW7123 = 6808,
+        KW7124 = 6809,
+        KW7125 = 6810,
+        KW7126 = 6811,
+        KW7127 = 6812,
+        KW7128 = 6813,
+        KW7129 = 6814,
+        KW713 = 6815,
+        KW7130 = 6816,
+        KW7131 = 6817,
+        KW7132 = 6818,
+        KW7133 = 6819,
+        KW7134 = 6820,
+        KW7135 = 6821,
+        KW7136 = 6822,
+        KW7137 = 6823,
+        KW7138 = 6824,
+        KW7139 = 6825,
+        KW714 = 6826,
+        KW7140 = 6827,
+        KW7141 = 6828,
+        KW7142 = 6829,
+        KW7143 = 6830,
+        KW7144 = 6831,
+        KW7145 = 6832,
+        KW7146 = 6833,
+        KW7147 = 6834,
+        KW7148 = 6835,
+        KW7149 = 6836,
+        KW715 = 6837,
+        KW7150 = 6838,
+        KW7151 = 6839,
+        KW7152 = 6840,
+        KW7153 = 6841,
+        KW7154 = 6842,
+        KW7155 = 6843,
+        KW7156 = 6844,
+        KW7157 = 6845,
+        KW7158 = 6846,
+        KW7159 = 6847,
+        KW716 = 6848,
+        KW7160 = 6849,
+        KW7161 = 6850,
+        KW7162 = 6851,
+        KW7163 = 6852,
+        KW7164 = 6853,
+        KW7165 = 6854,
+        KW7166 = 6855,
+        KW7167 = 6856,
+        KW7168 = 6857,
+        KW7169 = 6858,
+        KW717 = 6859,
+        KW7170 = 6860,
+        KW7171 = 6861,
+        KW7172 = 6862,
+        KW7173 = 6863,
+        KW7174 = 6864,
+        KW7175 = 6865,
+        KW7176 = 6866,
+        KW7177 = 6867,
+        KW7178 = 6868,
+        KW7179 = 6869,
+        KW718 = 6870,
+        KW7180 = 6871,
+        KW7181 = 6872,
+        KW7182 = 6873,
+        KW7183 = 6874,
+        KW7184 = 6875,
+        KW7185 = 6876,
+        KW7186 = 6877,
+        KW7187 = 6878,
+        KW7188 = 6879,
+        KW7189 = 6880,
+        KW719 = 6881,
+        KW7190 = 6882,
+        KW7191 = 6883,
+        KW7192 = 6884,
+        KW7193 = 6885,
+        KW7194 = 6886,
+        KW7195 = 6887,
+        KW7196 = 6888,
+        KW7197 = 6889,
+        KW7198 = 6890,
+        KW7199 = 6891,
+        KW72 = 6892,
+        KW720 = 6893,
+        KW7200 = 6894,
+        KW7201 = 6895,
+        KW7202 = 6896,
+        KW7203 = 6897,
+        KW7204 = 6898,
+        KW7205 = 6899,
+        KW7206 = 6900,
+        KW7207 = 6901,
+        KW7208 = 6902,
+        KW7209 = 6903,
+        KW721 = 6904,
+        KW7210 = 6905,
+        KW7211 = 6906,
+        KW7212 = 6907,
+        KW7213 = 6908,
+        KW7214 = 6909,
+        KW7215 = 6910,
+        KW7216 = 6911,
+        KW7217 = 6912,
+        KW7218 = 6913,
+        KW7219 = 6914,
+        KW722 = 6915,
+        KW7220 = 6916,
+        KW7221 = 6917,
+        KW7222 = 6918,
+        KW7223 = 6919,
+        KW7224 = 6920,
+        KW7225 = 6921,
+        KW7226 = 6922,
+        KW7227 = 6923,
+        KW7228 = 6924,
+        KW7229 = 6925,
+        KW723 = 6926,
+        KW7230 = 6927,
+        KW7231 = 6928,
+        KW7232 = 6929,
+        KW7233 = 6930,
+        KW7234 = 6931,
+        KW7235 = 6932,
+        KW7236 = 6933,
+        KW7237 = 6934,
+        KW7238 = 6935,
+        KW7239 = 6936,
+        KW724 = 6937,
+        KW7240 = 6938,
+        KW7241 = 6939,
+        KW7242 = 6940,
+        KW7243 = 6941,
+        KW7244 = 6942,
+        KW7245 = 6943,
+        KW7246 = 6944,
+        KW7247 = 6945,
+        KW7248 = 6946,
+        KW7249 = 6947,
+        KW725 = 6948,
+        KW7250 = 6949,
+        KW7251 = 6950,
+        KW7252 = 6951,
+        KW7253 = 6952,
+        KW7254 = 6953,
+        KW7255 = 6954,
+        KW7256 = 6955,
+        KW7257 = 6956,
+        KW7258 = 6957,
+        KW7259 = 6958,
+        KW726 = 6959,
+        KW7260 = 6960,
+        KW7261 = 6961,
+        KW7262 = 6962,
+        KW7263 = 6963,
+        KW7264 = 6964,
+        KW7265 = 6965,
+        KW7266 = 6966,
+        KW7267 = 6967,
+        KW7268 = 6968,
+        KW7269 = 6969,
+        KW727 = 6970,
+        KW7270 = 6971,
+        KW7271 = 6972,
+        KW7272 = 6973,
+        KW7273 = 6974,
+        KW7274 = 6975,
+        KW7275 = 6976,
+        KW7276 = 6977,
+        KW7277 = 6978,
+        KW7278 = 6979,
+        KW7279 = 6980,
+        KW728 = 6981,
+        KW7280 = 6982,
+        KW7281 = 6983,
+        KW7282 = 6984,
+        KW7283 = 6985,
+        KW7284 = 6986,
+        KW7285 = 6987,
+        KW7286 = 6988,
+        KW7287 = 6989,
+        KW7288 = 6990,
+        KW7289 = 6991,
+        KW729 = 6992,
+        KW7290 = 6993,
+        KW7291 = 6994,
+        KW7292 = 6995,
+        KW7293 = 6996,
+        KW7294 = 6997,
+        KW7295 = 6998,
+        KW7296 = 6999,
+        KW7297 = 7000,
+        KW7298 = 7001,
+        KW7299 = 7002,
+        KW73 = 7003,
+        KW730 = 7004,
+        KW7300 = 7005,
+        KW7301 = 7006,
+        KW7302 = 7007,
+        KW7303 = 7008,
+        KW7304 = 7009,
+        KW7305 = 7010,
+        KW7306 = 7011,
+        KW7307 = 7012,
+        KW7308 = 7013,
+        KW7309 = 7014,
+        KW731 = 7015,
+        KW7310 = 7016,
+        KW7311 = 7017,
+        KW7312 = 7018,
+        KW7313 = 7019,
+        KW7314 = 7020,
+        KW7315 = 7021,
+        KW7316 = 7022,
+        KW7317 = 7023,
+        KW7318 = 7024,
+        KW7319 = 7025,
+        KW732 = 7026,
+        KW7320 = 7027,
+        KW7321 = 7028,
+        KW7322 = 7029,
+        KW7323 = 7030,
+        KW7324 = 7031,
+        KW7325 = 7032,
+        KW7326 = 7033,
+        KW7327 = 7034,
+        KW7328 = 7035,
+        KW7329 = 7036,
+        KW733 = 7037,
+        KW7330 = 7038,
+        KW7331 = 7039,
+        KW7332 = 7040,
+        KW7333 = 7041,
+        KW7334 = 7042,
+        KW7335 = 7043,
+        KW7336 = 7044,
+        KW7337 = 7045,
+        KW7338 = 7046,
+        KW7339 = 7047,
+        KW734 = 7048,
+        KW7340 = 7049,
+        KW7341 = 7050,
+        KW7342 = 7051,
+        KW7343 = 7052,
+        KW7344 = 7053,
+        KW7345 = 7054,
+        KW7346 = 7055,
+        KW7347 = 7056,
+        KW7348 = 7057,
+        KW7349 = 7058,
+        KW735 = 7059,
+        KW7350 = 7060,
+        KW7351 = 7061,
+        KW7352 = 7062,
+        KW7353 = 7063,
+        KW7354 = 7064,
+        KW7355 = 7065,
+        KW7356 = 7066,
+        KW7357 = 7067,
+        KW7358 = 7068,
+        KW7359 = 7069,
+        KW736 = 7070,
+        KW7360 = 7071,
+        KW7361 = 7072,
+        KW7362 = 7073,
+        KW7363 = 7074,
+        KW7364 = 7075,
+        KW7365 = 7076,
+        KW7366 = 7077,
+        KW7367 = 7078,
+        KW7368 = 7079,
+        KW7369 = 7080,
+        KW737 = 7081,
+        KW7370 = 7082,
+        KW7371 = 7083,
+        KW7372 = 7084,
+        KW7373 = 7085,
+        KW7374 = 7086,
+        KW7375 = 7087,
+        KW7376 = 7088,
+        KW7377 = 7089,
+        KW7378 = 7090,
+        KW7379 = 7091,
+        KW738 = 7092,
+        KW7380 = 7093,
+        KW7381 = 7094,
+        KW7382 = 7095,
+        KW7383 = 7096,
+        KW7384 = 7097,
+        KW7385 = 7098,
+        KW7386 = 7099,
+        KW7387 = 7100,
+        KW7388 = 7101,
+        KW7389 = 7102,
+        KW739 = 7103,
+        KW7390 = 7104,
+        KW7391 = 7105,
+        KW7392 = 7106,
+        KW7393 = 7107,
+        KW7394 = 7108,
+        KW7395 = 7109,
+        KW7396 = 7110,
+        KW7397 = 7111,
+        KW7398 = 7112,
+        KW7399 = 7113,
+        KW74 = 7114,
+        KW740 = 7115,
+        KW7400 = 7116,
+        KW7401 = 7117,
+        KW7402 = 7118,
+        KW7403 = 7119,
+        KW7404 = 7120,
+        KW7405 = 7121,
+        KW7406 = 7122,
+        KW7407 = 7123,
+        KW7408 = 7124,
+        KW7409 = 7125,
+        KW741 = 7126,
+        KW7410 = 7127,
+        KW7411 = 7128,
+        KW7412 = 7129,
+        KW7413 = 7130,
+        KW7414 = 7131,
+        KW7415 = 7132,
+        KW7416 = 7133,
+        KW7417 = 7134,
+        KW7418 = 7135,
+        KW7419 = 7136,
+        KW742 = 7137,
+        KW7420 = 7138,
+        KW7421 = 7139,
+        KW7422 = 7140,
+        KW7423 = 7141,
+        KW7424 = 7142,
+        KW7425 = 7143,
+        KW7426 = 7144,
+        KW7427 = 7145,
+        KW7428 = 7146,
+        KW7429 = 7147,
+        KW743 = 7148,
+        KW7430 = 7149,
+        KW7431 = 7150,
+        KW7432 = 7151,
+        KW7433 = 7152,
+        KW7434 = 7153,
+        KW7435 = 7154,
+        KW7436 = 7155,
+        KW7437 = 7156,
+        KW7438 = 7157,
+        KW7439 = 7158,
+        KW744 = 7159,
+        KW7440 = 7160,
+        KW7441 = 7161,
+        KW7442 = 7162,
+        KW7443 = 7163,
+        KW7444 = 7164,
+        KW7445 = 7165,
+        KW7446 = 7166,
+        KW7447 = 7167,
+        KW7448 = 7168,
+        KW7449 = 7169,
+        KW745 = 7170,
+        KW7450 = 7171,
+        KW7451 = 7172,
+        KW7452 = 7173,
+        KW7453 = 7174,
+        KW7454 = 7175,
+        KW7455 = 7176,
+        KW7456 = 7177,
+        KW7457 = 7178,
+        KW7458 = 7179,
+        KW7459 = 7180,
+        KW746 = 7181,
+        KW7460 = 7182,
+        KW7461 = 7183,
+        KW7462 = 7184,
+        KW7463 = 7185,
+        KW7464 = 7186,
+        KW7465 = 7187,
+        KW7466 = 7188,
+        KW7467 = 7189,
+        KW7468 = 7190,
+        KW7469 = 7191,
+        KW747 = 7192,
+        KW7470 = 7193,
+        KW7471 = 7194,
+        KW7472 = 7195,
+        KW7473 = 7196,
+        KW7474 = 7197,
+        KW7475 = 7198,
+        KW7476 = 7199,
+        KW7477 = 7200,
+        KW7478 = 7201,
+        KW7479 = 7202,
+        KW748 = 7203,
+        KW7480 = 7204,
+        KW7481 = 7205,
+        KW7482 = 7206,
+        KW7483 = 7207,
+        KW7484 = 7208,
+        KW7485 = 7209,
+        KW7486 = 7210,
+        KW7487 = 7211,
+        KW7488 = 7212,
+        KW7489 = 7213,
+        KW749 = 7214,
+        KW7490 = 7215,
+        KW7491 = 7216,
+        KW7492 = 7217,
+        KW7493 = 7218,
+        KW7494 = 7219,
+        KW7495 = 7220,
+        KW7496 = 7221,
+        KW7497 = 7222,
+        KW7498 = 7223,
+        KW7499 = 7224,
+        KW75 = 7225,
+        KW750 = 7226,
+        KW7500 = 7227,
+        KW7501 = 7228,
+        KW7502 = 7229,
+        KW7503 = 7230,
+        KW7504 = 7231,
+        KW7505 = 7232,
+        KW7506 = 7233,
+        KW7507 = 7234,
+        KW7508 = 7235,
+        KW7509 = 7236,
+        KW751 = 7237,
+        KW7510 = 7238,
+        KW7511 = 7239,
+        KW7512 = 7240,
+        KW7513 = 7241,
+        KW7514 = 7242,
+        KW7515 = 7243,
+        KW7516 = 7244,
+        KW7517 = 7245,
+        KW7518 = 7246,
+        KW7519 = 7247,
+        KW752 = 7248,
+        KW7520 = 7249,
+        KW7521 = 7250,
+        KW7522 = 7251,
+        KW7523 = 7252,
+        KW7524 = 7253,
+        KW7525 = 7254,
+        KW7526 = 7255,
+        KW7527 = 7256,
+        KW7528 = 7257,
+        KW7529 = 7258,
+        KW753 = 7259,
+        KW7530 = 7260,
+        KW7531 = 7261,
+        KW7532 = 7262,
+        KW7533 = 7263,
+        KW7534 = 7264,
+        KW7535 = 7265,
+        KW7536 = 7266,
+        KW7537 = 7267,
+        KW7538 = 7268,
+        KW7539 = 7269,
+        KW754 = 7270,
+        KW7540 = 7271,
+        KW7541 = 7272,
+        KW7542 = 7273,
+        KW7543 = 7274,
+        KW7544 = 7275,
+        KW7545 = 7276,
+        KW7546 = 7277,
+        KW7547 = 7278,
+        KW7548 = 7279,
+        KW7549 = 7280,
+        KW755 = 7281,
+        KW7550 = 7282,
+        KW7551 = 7283,
+        KW7552 = 7284,
+        KW7553 = 7285,
+        KW7554 = 7286,
+        KW7555 = 7287,
+        KW7556 = 7288,
+        KW7557 = 7289,
+        KW7558 = 7290,
+        KW7559 = 7291,
+        KW756 = 7292,
+        KW7560 = 7293,
+        KW7561 = 7294,
+        KW7562 = 7295,
+        KW7563 = 7296,
+        KW7564 = 7297,
+        KW7565 = 7298,
+        KW7566 = 7299,
+        KW7567 = 7300,
+        KW7568 = 7301,
+        KW7569 = 7302,
+        KW757 = 7303,
+        KW7570 = 7304,
+        KW7571 = 7305,
+        KW7572 = 7306,
+        KW7573 = 7307,
+        KW7574 = 7308,
+        KW7575 = 7309,
+        KW7576 = 7310,
+        KW7577 = 7311,
+        KW7578 = 7312,
+        KW7579 = 7313,
+        KW758 = 7314,
+        KW7580 = 7315,
+        KW7581 = 7316,
+        KW7582 = 7317,
+        KW7583 = 7318,
+        KW7584 = 7319,
+        KW7585 = 7320,
+        KW7586 = 7321,
+        KW7587 = 7322,
+        KW7588 = 7323,
+        KW7589 = 7324,
+        KW759 = 7325,
+        KW7590 = 7326,
+        KW7591 = 7327,
+        KW7592 = 7328,
+        KW7593 = 7329,
+        KW7594 = 7330,
+        KW7595 = 7331,
+        KW7596 = 7332,
+        KW7597 = 7333,
+        KW7598 = 7334,
+        KW7599 = 7335,
+        KW76 = 7336,
+        KW760 = 7337,
+        KW7600 = 7338,
+        KW7601 = 7339,
+        KW7602 = 7340,
+        KW7603 = 7341,
+        KW7604 = 7342,
+        KW7605 = 7343,
+        KW7606 = 7344,
+        KW7607 = 7345,
+        KW7608 = 7346,
+        KW7609 = 7347,
+        KW761 = 7348,
+        KW7610 = 7349,
+        KW7611 = 7350,
+        KW7612 = 7351,
+        KW7613 = 7352,
+        KW7614 = 7353,
+        KW7615 = 7354,
+        KW7616 = 7355,
+        KW7617 = 7356,
+        KW7618 = 7357,
+        KW7619 = 7358,
+        KW762 = 7359,
+        KW7620 = 7360,
+        KW7621 = 7361,
+        KW7622 = 7362,
+        KW7623 = 7363,
+        KW7624 = 7364,
+        KW7625 = 7365,
+        KW7626 = 7366,
+        KW7627 = 7367,
+        KW7628 = 7368,
+        KW7629 = 7369,
+        KW763 = 7370,
+        KW7630 = 7371,
+        KW7631 = 7372,
+        KW7632 = 7373,
+        KW7633 = 7374,
+        KW7634 = 7375,
+        KW7635 = 7376,
+        KW7636 = 7377,
+        KW7637 = 7378,
+        KW7638 = 7379,
+        KW7639 = 7380,
+        KW764 = 7381,
+        KW7640 = 7382,
+        KW7641 = 7383,
+        KW7642 = 7384,
+        KW7643 = 7385,
+        KW7644 = 7386,
+        KW7645 = 7387,
+        KW7646 = 7388,
+        KW7647 = 7389,
+        KW7648 = 7390,
+        KW7649 = 7391,
+        KW765 = 7392,
+        KW7650 = 7393,
+        KW7651 = 7394,
+        KW7652 = 7395,
+        KW7653 = 7396,
+        KW7654 = 7397,
+        KW7655 = 7398,
+        KW7656 = 7399,
+        KW7657 = 7400,
+        KW7658 = 7401,
+        KW7659 = 7402,
+        KW766 = 7403,
+        KW7660 = 7404,
+        KW7661 = 7405,
+        KW7662 = 7406,
+        KW7663 = 7407,
+        KW7664 = 7408,
+        KW7665 = 7409,
+        KW7666 = 7410,
+        KW7667 = 7411,
+        KW7668 = 7412,
+        KW7669 = 7413,
+        KW767 = 7414,
+        KW7670 = 7415,
+        KW7671 = 7416,
+        KW7672 = 7417,
+        KW7673 = 7418,
+        KW7674 = 7419,
+        KW7675 = 7420,
+        KW7676 = 7421,
+        KW7677 = 7422,
+        KW7678 = 7423,
+        KW7679 = 7424,
+        KW768 = 7425,
+        KW7680 = 7426,
+        KW7681 = 7427,
+        KW7682 = 7428,
+        KW7683 = 7429,
+        KW7684 = 7430,
+        KW7685 = 7431,
+        KW7686 = 7432,
+        KW7687 = 7433,
+        KW7688 = 7434,
+        KW7689 = 7435,
+        KW769 = 7436,
+        KW7690 = 7437,
+        KW7691 = 7438,
+        KW7692 = 7439,
+        KW7693 = 7440,
+        KW7694 = 7441,
+        KW7695 = 7442,
+        KW7696 = 7443,
+        KW7697 = 7444,
+        KW7698 = 7445,
+        KW7699 = 7446,
+        KW77 = 7447,
+        KW770 = 7448,
+        KW7700 = 7449,
+        KW7701 = 7450,
+        KW7702 = 7451,
+        KW7703 = 7452,
+        KW7704 = 7453,
+        KW7705 = 7454,
+        KW7706 = 7455,
+        KW7707 = 7456,
+        KW7708 = 7457,
+        KW7709 = 7458,
+        KW771 = 7459,
+        KW7710 = 7460,
+        KW7711 = 7461,
+        KW7712 = 7462,
+        KW7713 = 7463,
+        KW7714 = 7464,
+        KW7715 = 7465,
+        KW7716 = 7466,
+        KW7717 = 7467,
+        KW7718 = 7468,
+        KW7719 = 7469,
+        KW772 = 7470,
+        KW7720 = 7471,
+        KW7721 = 7472,
+        KW7722 = 7473,
+        KW7723 = 7474,
+        KW7724 = 7475,
+        KW7725 = 7476,
+        KW7726 = 7477,
+        KW7727 = 7478,
+        KW7728 = 7479,
+        KW7729 = 7480,
+        KW773 = 7481,
+        KW7730 = 7482,
+        KW7731 = 7483,
+        KW7732 = 7484,
+        KW7733 = 7485,
+        KW7734 = 7486,
+        KW7735 = 7487,
+        KW7736 = 7488,
+        KW7737 = 7489,
+        KW7738 = 7490,
+        KW7739 = 7491,
+        KW774 = 7492,
+        KW7740 = 7493,
+        KW7741 = 7494,
+        KW7742 = 7495,
+        KW7743 = 7496,
+        KW7744 = 7497,
+        KW7745 = 7498,
+        KW7746 = 7499,
+        KW7747 = 7500,
+        KW7748 = 7501,
+        KW7749 = 7502,
+        KW775 = 7503,
+        KW7750 = 7504,
+        KW7751 = 7505,
+        KW7752 = 7506,
+        KW7753 = 7507,
+        KW7754 = 7508,
+        KW7755 = 7509,
+        KW7756 = 7510,
+        KW7757 = 7511,
+        KW7758 = 7512,
+        KW7759 = 7513,
+        KW776 = 7514,
+        KW7760 = 7515,
+        KW7761 = 7516,
+        KW7762 = 7517,
+        KW7763 = 7518,
+        KW7764 = 7519,
+        KW7765 = 7520,
+        KW7766 = 7521,
+        KW7767 = 7522,
+        KW7768 = 7523,
+        KW7769 = 7524,
+        KW777 = 7525,
+        KW7770 = 7526,
+        KW7771 = 7527,
+        KW7772 = 7528,
+        KW7773 = 7529,
+        KW7774 = 7530,
+        KW7775 = 7531,
+        KW7776 = 7532,
+        KW7777 = 7533,
+        KW7778 = 7534,
+        KW7779 = 7535,
+        KW778 = 7536,
+        KW7780 = 7537,
+        KW7781 = 7538,
+        KW7782 = 7539,
+        KW7783 = 7540,
+        KW7784 = 7541,
+        KW7785 = 7542,
+        KW7786 = 7543,
+        KW7787 = 7544,
+        KW7788 = 7545,
+        KW7789 = 7546,
+        KW779 = 7547,
+        KW7790 = 7548,
+        KW7791 = 7549,
+        KW7792 = 7550,
+        KW7793 = 7551,
+        KW7794 = 7552,
+        KW7795 = 7553,
+        KW7796 = 7554,
+        KW7797 = 7555,
+        KW7798 = 7556,
+        KW7799 = 7557,
+        KW78 = 7558,
+        KW780 = 7559,
+        KW7800 = 7560,
+        KW7801 = 7561,
+        KW7802 = 7562,
+        KW7803 = 7563,
+        KW7804 = 7564,
+        KW7805 = 7565,
+        KW7806 = 7566,
+        KW7807 = 7567,
+        KW7808 = 7568,
+        KW7809 = 7569,
+        KW781 = 7570,
+        KW7810 = 7571,
+        KW7811 = 7572,
+        KW7812 = 7573,
+        KW7813 = 7574,
+        KW7814 = 7575,
+        KW7815 = 7576,
+        KW7816 = 7577,
+        KW7817 = 7578,
+        KW7818 = 7579,
+        KW7819 = 7580,
+        KW782 = 7581,
+        KW7820 = 7582,
+        KW7821 = 7583,
+        KW7822 = 7584,
+        KW7823 = 7585,
+        KW7824 = 7586,
+        KW7825 = 7587,
+        KW7826 = 7588,
+        KW7827 = 7589,
+        KW7828 = 7590,
+        KW7829 = 7591,
+        KW783 = 7592,
+        KW7830 = 7593,
+        KW7831 = 7594,
+        KW7832 = 7595,
+        KW7833 = 7596,
+        KW7834 = 7597,
+        KW7835 = 7598,
+        KW7836 = 7599,
+        KW7837 = 7600,
+        KW7838 = 7601,
+        KW7839 = 7602,
+        KW784 = 7603,
+        KW7840 = 7604,
+        KW7841 = 7605,
+        KW7842 = 7606,
+        KW7843 = 7607,
+        KW7844 = 7608,
+        KW7845 = 7609,
+        KW7846 = 7610,
+        KW7847 = 7611,
+        KW7848 = 7612,
+        KW7849 = 7613,
+        KW785 = 7614,
+        KW7850 = 7615,
+        KW7851 = 7616,
+        KW7852 = 7617,
+        KW7853 = 7618,
+        KW7854 = 7619,
+        KW7855 = 7620,
+        KW7856 = 7621,
+        KW7857 = 7622,
+        KW7858 = 7623,
+        KW7859 = 7624,
+        KW786 = 7625,
+        KW7860 = 7626,
+        KW7861 = 7627,
+        KW7862 = 7628,
+        KW7863 = 7629,
+        KW7864 = 7630,
+        KW7865 = 7631,
+        KW7866 = 7632,
+        KW7867 = 7633,
+        KW7868 = 7634,
+        KW7869 = 7635,
+        KW787 = 7636,
+        KW7870 = 7637,
+        KW7871 = 7638,
+        KW7872 = 7639,
+        KW7873 = 7640,
+        KW7874 = 7641,
+        KW7875 = 7642,
+        KW7876 = 7643,
+        KW7877 = 7644,
+        KW7878 = 7645,
+        KW7879 = 7646,
+        KW788 = 7647,
+        KW7880 = 7648,
+        KW7881 = 7649,
+        KW7882 = 7650,
+        KW7883 = 7651,
+        KW7884 = 7652,
+        KW7885 = 7653,
+        KW7886 = 7654,
+        KW7887 = 7655,
+        KW7888 = 7656,
+        KW7889 = 7657,
+        KW789 = 7658,
+        KW7890 = 7659,
+        KW7891 = 7660,
+        KW7892 = 7661,
+        KW7893 = 7662,
+        KW7894 = 7663,
+        KW7895 = 7664,
+        KW7896 = 7665,
+        KW7897 = 7666,
+        KW7898 = 7667,
+        KW7899 = 7668,
+        KW79 = 7669,
+        KW790 = 7670,
+        KW7900 = 7671,
+        KW7901 = 7672,
+        KW7902 = 7673,
+        KW7903 = 7674,
+        KW7904 = 7675,
+        KW7905 = 7676,
+        KW7906 = 7677,
+        KW7907 = 7678,
+        KW7908 = 7679,
+        KW7909 = 7680,
+        KW791 = 7681,
+        KW7910 = 7682,
+        KW7911 = 7683,
+        KW7912 = 7684,
+        KW7913 = 7685,
+        KW7914 = 7686,
+        KW7915 = 7687,
+        KW7916 = 7688,
+        KW7917 = 7689,
+        KW7918 = 7690,
+        KW7919 = 7691,
+        KW792 = 7692,
+        KW7920 = 7693,
+        KW7921 = 7694,
+        KW7922 = 7695,
+        KW7923 = 7696,
+        KW7924 = 7697,
+        KW7925 = 7698,
+        KW7926 = 7699,
+        KW7927 = 7700,
+        KW7928 = 7701,
+        KW7929 = 7702,
+        KW793 = 7703,
+        KW7930 = 7704,
+        KW7931 = 7705,
+        KW7932 = 7706,
+        KW7933 = 7707,
+        KW7934 = 7708,
+        KW7935 = 7709,
+        KW7936 = 7710,
+        KW7937 = 7711,
+        KW7938 = 7712,
+        KW7939 = 7713,
+        KW794 = 7714,
+        KW7940 = 7715,
+        KW7941 = 7716,
+        KW7942 = 7717,
+        KW7943 = 7718,
+        KW7944 = 7719,
+        KW7945 = 7720,
+        KW7946 = 7721,
+        KW7947 = 7722,
+        KW7948 = 7723,
+        KW7949 = 7724,
+        KW795 = 7725,
+        KW7950 = 7726,
+        KW7951 = 7727,
+        KW7952 = 7728,
+        KW7953 = 7729,
+        KW7954 = 7730,
+        KW7955 = 7731,
+        KW7956 = 7732,
+        KW7957 = 7733,
+        KW7958 = 7734,
+        KW7959 = 7735,
+        KW796 = 7736,
+        KW7960 = 7737,
+        KW7961 = 7738,
+        KW7962 = 7739,
+        KW7963 = 7740,
+        KW7964 = 7741,
+        KW7965 = 7742,
+        KW7966 = 7743,
+        KW7967 = 7744,
+        KW7968 = 7745,
+        KW7969 = 7746,
+        KW797 = 7747,
+        KW7970 = 7748,
+        KW7971 = 7749,
+        KW7972 = 7750,
+        KW7973 = 7751,
+        KW7974 = 7752,
+        KW7975 = 7753,
+        KW7976 = 7754,
+        KW7977 = 7755,
+        KW7978 = 7756,
+        KW7979 = 7757,
+        KW798 = 7758,
+        KW7980 = 7759,
+        KW7981 = 7760,
+        KW7982 = 7761,
+        KW7983 = 7762,
+        KW7984 = 7763,
+        KW7985 = 7764,
+        KW7986 = 7765,
+        KW7987 = 7766,
+        KW7988 = 7767,
+        KW7989 = 7768,
+        KW799 = 7769,
+        KW7990 = 7770,
+        KW7991 = 7771,
+        KW7992 = 7772,
+        KW7993 = 7773,
+        KW7994 = 7774,
+        KW7995 = 7775,
+        KW7996 = 7776,
+        KW7997 = 7777,
+        KW7998 = 7778,
+        KW7999 = 7779,
+        KW8 = 7780,
+        KW80 = 7781,
+        KW800 = 7782,
+        KW8000 = 7783,
+        KW8001 = 7784,
+        KW8002 = 7785,
+        KW8003 = 7786,
+        KW8004 = 7787,
+        KW8005 = 7788,
+        KW8006 = 7789,
+        KW8007 = 7790,
+        KW8008 = 7791,
+        KW8009 = 7792,
+        KW801 = 7793,
+        KW8010 = 7794,
+        KW8011 = 7795,
+        KW8012 = 7796,
+        KW8013 = 7797,
+        KW8014 = 7798,
+        KW8015 = 7799,
+        KW8016 = 7800,
+        KW8017 = 7801,
+        KW8018 = 7802,
+        KW8019 = 7803,
+        KW802 = 7804,
+        KW8020 = 7805,
+        KW8021 = 7806,
+        KW8022 = 7807,
+        KW8023 = 7808,
+        KW8024 = 7809,
+        KW8025 = 7810,
+        KW8026 = 7811,
+        KW8027 = 7812,
+        KW8028 = 7813,
+        KW8029 = 7814,
+        KW803 = 7815,
+        KW8030 = 7816,
+        KW8031 = 7817,
+        KW8032 = 7818,
+        KW8033 = 7819,
+        KW8034 = 7820,
+        KW8035 = 7821,
+        KW8036 = 7822,
+        KW8037 = 7823,
+        KW8038 = 7824,
+        KW8039 = 7825,
+        KW804 = 7826,
+        KW8040 = 7827,
+        KW8041 = 7828,
+        KW8042 = 7829,
+        KW8043 = 7830,
+        KW8044 = 7831,
+        KW8045 = 7832,
+        KW8046 = 7833,
+        KW8047 = 7834,
+        KW8048 = 7835,
+        KW8049 = 7836,
+        KW805 = 7837,
+        KW8050 = 7838,
+        KW8051 = 7839,
+        KW8052 = 7840,
+        KW8053 = 7841,
+        KW8054 = 7842,
+        KW8055 = 7843,
+        KW8056 = 7844,
+        KW8057 = 7845,
+        KW8058 = 7846,
+        KW8059 = 7847,
+        KW806 = 7848,
+        KW8060 = 7849,
+        KW8061 = 7850,
+        KW8062 = 7851,
+        KW8063 = 7852,
+        KW8064 = 7853,
+        KW8065 = 7854,
+        KW8066 = 7855,
+        KW8067 = 7856,
+        KW8068 = 7857,
+        KW8069 = 7858,
+        KW807 = 7859,
+        KW8070 = 7860,
+        KW8071 = 7861,
+        KW8072 = 7862,
+        KW8073 = 7863,
+        KW8074 = 7864,
+        KW8075 = 7865,
+        KW8076 = 7866,
+        KW8077 = 7867,
+        KW8078 = 7868,
+        KW8079 = 7869,
+        KW808 = 7870,
+        KW8080 = 7871,
+        KW8081 = 7872,
+        KW8082 = 7873,
+        KW8083 = 7874,
+        KW8084 = 7875,
+        KW8085 = 7876,
+        KW8086 = 7877,
+        KW8087 = 7878,
+        KW8088 = 7879,
+        KW8089 = 7880,
+        KW809 = 7881,
+        KW8090 = 7882,
+        KW8091 = 7883,
+        KW8092 = 7884,
+        KW8093 = 7885,
+        KW8094 = 7886,
+        KW8095 = 7887,
+        KW8096 = 7888,
+        KW8097 = 7889,
+        KW8098 = 7890,
+        KW8099 = 7891,
+        KW81 = 7892,
+        KW810 = 7893,
+        KW8100 = 7894,
+        KW8101 = 7895,
+        KW8102 = 7896,
+        KW8103 = 7897,
+        KW8104 = 7898,
+        KW8105 = 7899,
+        KW8106 = 7900,
+        KW8107 = 7901,
+        KW8108 = 7902,
+        KW8109 = 7903,
+        KW811 = 7904,
+        KW8110 = 7905,
+        KW8111 = 7906,
+        KW8112 = 7907,
+        KW8113 = 7908,
+        KW8114 = 7909,
+        KW8115 = 7910,
+        KW8116 = 7911,
+        KW8117 = 7912,
+        KW8118 = 7913,
+        KW8119 = 7914,
+        KW812 = 7915,
+        KW8120 = 7916,
+        KW8121 = 7917,
+        KW8122 = 7918,
+        KW8123 = 7919,
+        KW8124 = 7920,
+        KW8125 = 7921,
+        KW8126 = 7922,
+        KW8127 = 7923,
+        KW8128 = 7924,
+        KW8129 = 7925,
+        KW813 = 7926,
+        KW8130 = 7927,
+        KW8131 = 7928,
+        KW8132 = 7929,
+        KW8133 = 7930,
+        KW8134 = 7931,
+        KW8135 = 7932,
+        KW8136 = 7933,
+        KW8137 = 7934,
+        KW8138 = 7935,
+        KW8139 = 7936,
+        KW814 = 7937,
+        KW8140 = 7938,
+        KW8141 = 7939,
+        KW8142 = 7940,
+        KW8143 = 7941,
+        KW8144 = 7942,
+        KW8145 = 7943,
+        KW8146 = 7944,
+        KW8147 = 7945,
+        KW8148 = 7946,
+        KW8149 = 7947,
+        KW815 = 7948,
+        KW8150 = 7949,
+        KW8151 = 7950,
+        KW8152 = 7951,
+        KW8153 = 7952,
+        KW8154 = 7953,
+        KW8155 = 7954,
+        KW8156 = 7955,
+        KW8157 = 7956,
+        KW8158 = 7957,
+        KW8159 = 7958,
+        KW816 = 7959,
+        KW8160 = 7960,
+        KW8161 = 7961,
+        KW8162 = 7962,
+        KW8163 = 7963,
+        KW8164 = 7964,
+        KW8165 = 7965,
+        KW8166 = 7966,
+        KW8167 = 7967,
+        KW8168 = 7968,
+        KW8169 = 7969,
+        KW817 = 7970,
+        KW8170 = 7971,
+        KW8171 = 7972,
+        KW8172 = 7973,
+        KW8173 = 7974,
+        KW8174 = 7975,
+        KW8175 = 7976,
+        KW8176 = 7977,
+        KW8177 = 7978,
+        KW8178 = 7979,
+        KW8179 = 7980,
+        KW818 = 7981,
+        KW8180 = 7982,
+        KW8181 = 7983,
+        KW8182 = 7984,
+        KW8183 = 7985,
+        KW8184 = 7986,
+        KW8185 = 7987,
+        KW8186 = 7988,
+        KW8187 = 7989,
+        KW8188 = 7990,
+        KW8189 = 7991,
+        KW819 = 7992,
+        KW8190 = 7993,
+        KW8191 = 7994,
+        KW8192 = 7995,
+        KW8193 = 7996,
+        KW8194 = 7997,
+        KW8195 = 7998,
+        KW8196 = 7999,
+        KW8197 = 8000,
+        KW8198 = 8001,
+        KW8199 = 8002,
+        KW82 = 8003,
+        KW820 = 8004,
+        KW8200 = 8005,
+        KW8201 = 8006,
+        KW8202 = 8007,
+        KW8203 = 8008,
+        KW8204 = 8009,
+        KW8205 = 8010,
+        KW8206 = 8011,
+        KW8207 = 8012,
+        KW8208 = 8013,
+        KW8209 = 8014,
+        KW821 = 8015,
+        KW8210 = 8016,
+        KW8211 = 8017,
+        KW8212 = 8018,
+        KW8213 = 8019,
+        KW8214 = 8020,
+        KW8215 = 8021,
+        KW8216 = 8022,
+        KW8217 = 8023,
+        KW8218 = 8024,
+        KW8219 = 8025,
+        KW822 = 8026,
+        KW8220 = 8027,
+        KW8221 = 8028,
+        KW8222 = 8029,
+        KW8223 = 8030,
+        KW8224 = 8031,
+        KW8225 = 8032,
+        KW8226 = 8033,
+        KW8227 = 8034,
+        KW8228 = 8035,
+        KW8229 = 8036,
+        KW823 = 8037,
+        KW8230 = 8038,
+        KW8231 = 8039,
+        KW8232 = 8040,
+        KW8233 = 8041,
+        KW8234 = 8042,
+        KW8235 = 8043,
+        KW8236 = 8044,
+        KW8237 = 8045,
+        KW8238 = 8046,
+        KW8239 = 8047,
+        KW824 = 8048,
+        KW8240 = 8049,
+        KW8241 = 8050,
+        KW8242 = 8051,
+        KW8243 = 8052,
+        KW8244 = 8053,
+        KW8245 = 8054,
+        KW8246 = 8055,
+        KW8247 = 8056,
+        KW8248 = 8057,
+        KW8249 = 8058,
+        KW825 = 8059,
+        KW8250 = 8060,
+        KW8251 = 8061,
+        KW8252 = 8062,
+        KW8253 = 8063,
+        KW8254 = 8064,
+        KW8255 = 8065,
+        KW8256 = 8066,
+        KW8257 = 8067,
+        KW8258 = 8068,
+        KW8259 = 8069,
+        KW826 = 8070,
+        KW8260 = 8071,
+        KW8261 = 8072,
+        KW8262 = 8073,
+        KW8263 = 8074,
+        KW8264 = 8075,
+        KW8265 = 8076,
+        KW8266 = 8077,
+        KW8267 = 8078,
+        KW8268 = 8079,
+        KW8269 = 8080,
+        KW827 = 8081,
+        KW8270 = 8082,
+        KW8271 = 8083,
+        KW8272 = 8084,
+        KW8273 = 8085,
+        KW8274 = 8086,
+        KW8275 = 8087,
+        KW8276 = 8088,
+        KW8277 = 8089,
+        KW8278 = 8090,
+        KW8279 = 8091,
+        KW828 = 8092,
+        KW8280 = 8093,
+        KW8281 = 8094,
+        KW8282 = 8095,
+        KW8283 = 8096,
+        KW8284 = 8097,
+        KW8285 = 8098,
+        KW8286 = 8099,
+        KW8287 = 8100,
+        KW8288 = 8101,
+        KW8289 = 8102,
+        KW829 = 8103,
+        KW8290 = 8104,
+        KW8291 = 8105,
+        KW8292 = 8106,
+        KW8293 = 8107,
+        KW8294 = 8108,
+        KW8295 = 8109,
+        KW8296 = 8110,
+        KW8297 = 8111,
+        KW8298 = 8112,
+        KW8299 = 8113,
+        KW83 = 8114,
+        KW830 = 8115,
+        KW8300 = 8116,
+        KW8301 = 8117,
+        KW8302 = 8118,
+        KW8303 = 8119,
+        KW8304 = 8120,
+        KW8305 = 8121,
+        KW8306 = 8122,
+        KW8307 = 8123,
+        KW8308 = 8124,
+        KW8309 = 8125,
+        KW831 = 8126,
+        KW8310 = 8127,
+        KW8311 = 8128,
+        KW8312 = 8129,
+        KW8313 = 8130,
+        KW8314 = 8131,
+        KW8315 = 8132,
+        KW8316 = 8133,
+        KW8317 = 8134,
+        KW8318 = 8135,
+        KW8319 = 8136,
+        KW832 = 8137,
+        KW8320 = 8138,
+        KW8321 = 8139,
+        KW8322 = 8140,
+        KW8323 = 8141,
+        KW8324 = 8142,
+        KW8325 = 8143,
+        KW8326 = 8144,
+        KW8327 = 8145,
+        KW8328 = 8146,
+        KW8329 = 8147,
+        KW833 = 8148,
+        KW8330 = 8149,
+        KW8331 = 8150,
+        KW8332 = 8151,
+        KW8333 = 8152,
+        KW8334 = 8153,
+        KW8335 = 8154,
+        KW8336 = 8155,
+        KW8337 = 8156,
+        KW8338 = 8157,
+        KW8339 = 8158,
+        KW834 = 8159,
+        KW8340 = 8160,
+        KW8341 = 8161,
+        KW8342 = 8162,
+        KW8343 = 8163,
+        KW8344 = 8164,
+        KW8345 = 8165,
+        KW8346 = 8166,
+        KW8347 = 8167,
+        KW8348 = 8168,
+        KW8349 = 8169,
+        KW835 = 8170,
+        KW8350 = 8171,
+        KW8351 = 8172,
+        KW8352 = 8173,
+        KW8353 = 8174,
+        KW8354 = 8175,
+        KW8355 = 8176,
+        KW8356 = 8177,
+        KW8357 = 8178,
+        KW8358 = 8179,
+        KW8359 = 8180,
+        KW836 = 8181,
+        KW8360 = 8182,
+        KW8361 = 8183,
+        KW8362 = 8184,
+        KW8363 = 8185,
+        KW8364 = 8186,
+        KW8365 = 8187,
+        KW8366 = 8188,
+        KW8367 = 8189,
+        KW8368 = 8190,
+        KW8369 = 8191,
+        KW837 = 8192,
+        KW8370 = 8193,
+        KW8371 = 8194,
+        KW8372 = 8195,
+        KW8373 = 8196,
+        KW8374 = 8197,
+        KW8375 = 8198,
+        KW8376 = 8199,
+        KW8377 = 8200,
+        KW8378 = 8201,
+        KW8379 = 8202,
+        KW838 = 8203,
+        KW8380 = 8204,
+        KW8381 = 8205,
+        KW8382 = 8206,
+        KW8383 = 8207,
+        KW8384 = 8208,
+        KW8385 = 8209,
+        KW8386 = 8210,
+        KW8387 = 8211,
+        KW8388 = 8212,
+        KW8389 = 8213,
+        KW839 = 8214,
+        KW8390 = 8215,
+        KW8391 = 8216,
+        KW8392 = 8217,
+        KW8393 = 8218,
+        KW8394 = 8219,
+        KW8395 = 8220,
+        KW8396 = 8221,
+        KW8397 = 8222,
+        KW8398 = 8223,
+        KW8399 = 8224,
+        KW84 = 8225,
+        KW840 = 8226,
+        KW8400 = 8227,
+        KW8401 = 8228,
+        KW8402 = 8229,
+        KW8403 = 8230,
+        KW8404 = 8231,
+        KW8405 = 8232,
+        KW8406 = 8233,
+        KW8407 = 8234,
+        KW8408 = 8235,
+        KW8409 = 8236,
+        KW841 = 8237,
+        KW8410 = 8238,
+        KW8411 = 8239,
+        KW8412 = 8240,
+        KW8413 = 8241,
+        KW8414 = 8242,
+        KW8415 = 8243,
+        KW8416 = 8244,
+        KW8417 = 8245,
+        KW8418 = 8246,
+        KW8419 = 8247,
+        KW842 = 8248,
+        KW8420 = 8249,
+        KW8421 = 8250,
+        KW8422 = 8251,
+        KW8423 = 8252,
+        KW8424 = 8253,
+        KW8425 = 8254,
+        KW8426 = 8255,
+        KW8427 = 8256,
+        KW8428 = 8257,
+        KW8429 = 8258,
+        KW843 = 8259,
+        KW8430 = 8260,
+        KW8431 = 8261,
+        KW8432 = 8262,
+        KW8433 = 8263,
+        KW8434 = 8264,
+        KW8435 = 8265,
+        KW8436 = 8266,
+        KW8437 = 8267,
+        KW8438 = 8268,
+        KW8439 = 8269,
+        KW844 = 8270,
+        KW8440 = 8271,
+        KW8441 = 8272,
+        KW8442 = 8273,
+        KW8443 = 8274,
+        KW8444 = 8275,
+        KW8445 = 8276,
+        KW8446 = 8277,
+        KW8447 = 8278,
+        KW8448 = 8279,
+        KW8449 = 8280,
+        KW845 = 8281,
+        KW8450 = 8282,
+        KW8451 = 8283,
+        KW8452 = 8284,
+        KW8453 = 8285,
+        KW8454 = 8286,
+        KW8455 = 8287,
+        KW8456 = 8288,
+        KW8457 = 8289,
+        KW8458 = 8290,
+        KW8459 = 8291,
+        KW846 = 8292,
+        KW8460 = 8293,
+        KW8461 = 8294,
+        KW8462 = 8295,
+        KW8463 = 8296,
+        KW8464 = 8297,
+        KW8465 = 8298,
+        KW8466 = 8299,
+        KW8467 = 8300,
+        KW8468 = 8301,
+        KW8469 = 8302,
+        KW847 = 8303,
+        KW8470 = 8304,
+        KW8471 = 8305,
+        KW8472 = 8306,
+        KW8473 = 8307,
+        KW8474 = 8308,
+        KW8475 = 8309,
+        KW8476 = 8310,
+        KW8477 = 8311,
+        KW8478 = 8312,
+        KW8479 = 8313,
+        KW848 = 8314,
+        KW8480 = 8315,
+        KW8481 = 8316,
+        KW8482 = 8317,
+        KW8483 = 8318,
+        KW8484 = 8319,
+        KW8485 = 8320,
+        KW8486 = 8321,
+        KW8487 = 8322,
+        KW8488 = 8323,
+        KW8489 = 8324,
+        KW849 = 8325,
+        KW8490 = 8326,
+        KW8491 = 8327,
+        KW8492 = 8328,
+        KW8493 = 8329,
+        KW8494 = 8330,
+        KW8495 = 8331,
+        KW8496 = 8332,
+        KW8497 = 8333,
+        KW8498 = 8334,
+        KW8499 = 8335,
+        KW85 = 8336,
+        KW850 = 8337,
+        KW8500 = 8338,
+        KW8501 = 8339,
+        KW8502 = 8340,
+        KW8503 = 8341,
+        KW8504 = 8342,
+        KW8505 = 8343,
+        KW8506 = 8344,
+        KW8507 = 8345,
+        KW8508 = 8346,
+        KW8509 = 8347,
+        KW851 = 8348,
+        KW8510 = 8349,
+        KW8511 = 8350,
+        KW8512 = 8351,
+        KW8513 = 8352,
+        KW8514 = 8353,
+        KW8515 = 8354,
+        KW8516 = 8355,
+        KW8517 = 8356,
+        KW8518 = 8357,
+        KW8519 = 8358,
+        KW852 = 8359,
+        KW8520 = 8360,
+        KW8521 = 8361,
+        KW8522 = 8362,
+        KW8523 = 8363,
+        KW8524 = 8364,
+        KW8525 = 8365,
+        KW8526 = 8366,
+        KW8527 = 8367,
+        KW8528 = 8368,
+        KW8529 = 8369,
+        KW853 = 8370,
+        KW8530 = 8371,
+        KW8531 = 8372,
+        KW8532 = 8373,
+        KW8533 = 8374,
+        KW8534 = 8375,
+        KW8535 = 8376,
+        KW8536 = 8377,
+        KW8537 = 8378,
+        KW8538 = 8379,
+        KW8539 = 8380,
+        KW854 = 8381,
+        KW8540 = 8382,
+        KW8541 = 8383,
+        KW8542 = 8384,
+        KW8543 = 8385,
+        KW8544 = 8386,
+        KW8545 = 8387,
+        KW8546 = 8388,
+        KW8547 = 8389,
+        KW8548 = 8390,
+        KW8549 = 8391,
+        KW855 = 8392,
+        KW8550 = 8393,
+        KW8551 = 8394,
+        KW8552 = 8395,
+        KW8553 = 8396,
+        KW8554 = 8397,
+        KW8555 = 8398,
+        KW8556 = 8399,
+        KW8557 = 8400,
+        KW8558 = 8401,
+        KW8559 = 8402,
+        KW856 = 8403,
+        KW8560 = 8404,
+        KW8561 = 8405,
+        KW8562 = 8406,
+        KW8563 = 8407,
+        KW8564 = 8408,
+        KW8565 = 8409,
+        KW8566 = 8410,
+        KW8567 = 8411,
+        KW8568 = 8412,
+        KW8569 = 8413,
+        KW857 = 8414,
+        KW8570 = 8415,
+        KW8571 = 8416,
+        KW8572 = 8417,
+        KW8573 = 8418,
+        KW8574 = 8419,
+        KW8575 = 8420,
+        KW8576 = 8421,
+        KW8577 = 8422,
+        KW8578 = 8423,
+        KW8579 = 8424,
+        KW858 = 8425,
+        KW8580 = 8426,
+        KW8581 = 8427,
+        KW8582 = 8428,
+        KW8583 = 8429,
+        KW8584 = 8430,
+        KW8585 = 8431,
+        KW8586 = 8432,
+        KW8587 = 8433,
+        KW8588 = 8434,
+        KW8589 = 8435,
+        KW859 = 8436,
+        KW8590 = 8437,
+        KW8591 = 8438,
+        KW8592 = 8439,
+        KW8593 = 8440,
+        KW8594 = 8441,
+        KW8595 = 8442,
+        KW8596 = 8443,
+        KW8597 = 8444,
+        KW8598 = 8445,
+        KW8599 = 8446,
+        KW86 = 8447,
+        KW860 = 8448,
+        KW8600 = 8449,
+        KW8601 = 8450,
+        KW8602 = 8451,
+        KW8603 = 8452,
+        KW8604 = 8453,
+        KW8605 = 8454,
+        KW8606 = 8455,
+        KW8607 = 8456,
+        KW8608 = 8457,
+        KW8609 = 8458,
+        KW861 = 8459,
+        KW8610 = 8460,
+        KW8611 = 8461,
+        KW8612 = 8462,
+        KW8613 = 8463,
+        KW8614 = 8464,
+        KW8615 = 8465,
+        KW8616 = 8466,
+        KW8617 = 8467,
+        KW8618 = 8468,
+        KW8619 = 8469,
+        KW862 = 8470,
+        KW8620 = 8471,
+        KW8621 = 8472,
+        KW8622 = 8473,
+        KW8623 = 8474,
+        KW8624 = 8475,
+        KW8625 = 8476,
+        KW8626 = 8477,
+        KW8627 = 8478,
+        KW8628 = 8479,
+        KW8629 = 8480,
+        KW863 = 8481,
+        KW8630 = 8482,
+        KW8631 = 8483,
+        KW8632 = 8484,
+        KW8633 = 8485,
+        KW8634 = 8486,
+        KW8635 = 8487,
+        KW8636 = 8488,
+        KW8637 = 8489,
+        KW8638 = 8490,
+        KW8639 = 8491,
+        KW864 = 8492,
+        KW8640 = 8493,
+        KW8641 = 8494,
+        KW8642 = 8495,
+        KW8643 = 8496,
+        KW8644 = 8497,
+        KW8645 = 8498,
+        KW8646 = 8499,
+        KW8647 = 8500,
+        KW8648 = 8501,
+        KW8649 = 8502,
+        KW865 = 8503,
+        KW8650 = 8504,
+        KW8651 = 8505,
+        KW8652 = 8506,
+        KW8653 = 8507,
+        KW8654 = 8508,
+        KW8655 = 8509,
+        KW8656 = 8510,
+        KW8657 = 8511,
+        KW8658 = 8512,
+        KW8659 = 8513,
+        KW866 = 8514,
+        KW8660 = 8515,
+        KW8661 = 8516,
+        KW8662 = 8517,
+        KW8663 = 8518,
+        KW8664 = 8519,
+        KW8665 = 8520,
+        KW8666 = 8521,
+        KW8667 = 8522,
+        KW8668 = 8523,
+        KW8669 = 8524,
+        KW867 = 8525,
+        KW8670 = 8526,
+        KW8671 = 8527,
+        KW8672 = 8528,
+        KW8673 = 8529,
+        KW8674 = 8530,
+        KW8675 = 8531,
+        KW8676 = 8532,
+        KW8677 = 8533,
+        KW8678 = 8534,
+        KW8679 = 8535,
+        KW868 = 8536,
+        KW8680 = 8537,
+        KW8681 = 8538,
+        KW8682 = 8539,
+        KW8683 = 8540,
+        KW8684 = 8541,
+        KW8685 = 8542,
+        KW8686 = 8543,
+        KW8687 = 8544,
+        KW8688 = 8545,
+        KW8689 = 8546,
+        KW869 = 8547,
+        KW8690 = 8548,
+        KW8691 = 8549,
+        KW8692 = 8550,
+        KW8693 = 8551,
+        KW8694 = 8552,
+        KW8695 = 8553,
+        KW8696 = 8554,
+        KW8697 = 8555,
+        KW8698 = 8556,
+        KW8699 = 8557,
+        KW87 = 8558,
+        KW870 = 8559,
+        KW8700 = 8560,
+        KW8701 = 8561,
+        KW8702 = 8562,
+        KW8703 = 8563,
+        KW8704 = 8564,
+        KW8705 = 8565,
+        KW8706 = 8566,
+        KW8707 = 8567,
+        KW8708 = 8568,
+        KW8709 = 8569,
+        KW871 = 8570,
+        KW8710 = 8571,
+        KW8711 = 8572,
+        KW8712 = 8573,
+        KW8713 = 8574,
+        KW8714 = 8575,
+        KW8715 = 8576,
+        KW8716 = 8577,
+        KW8717 = 8578,
+        KW8718 = 8579,
+        KW8719 = 8580,
+        KW872 = 8581,
+        KW8720 = 8582,
+        KW8721 = 8583,
+        KW8722 = 8584,
+        KW8723 = 8585,
+        KW8724 = 8586,
+        KW8725 = 8587,
+        KW8726 = 8588,
+        KW8727 = 8589,
+        KW8728 = 8590,
+        KW8729 = 8591,
+        KW873 = 8592,
+        KW8730 = 8593,
+        KW8731 = 8594,
+        KW8732 = 8595,
+        KW8733 = 8596,
+        KW8734 = 8597,
+        KW8735 = 8598,
+        KW8736 = 8599,
+        KW8737 = 8600,
+        KW8738 = 8601,
+        KW8739 = 8602,
+        KW874 = 8603,
+        KW8740 = 8604,
+        KW8741 = 8605,
+        KW8742 = 8606,
+        KW8743 = 8607,
+        KW8744 = 8608,
+        KW8745 = 8609,
+        KW8746 = 8610,
+        KW8747 = 8611,
+        KW8748 = 8612,
+        KW8749 = 8613,
+        KW875 = 8614,
+        KW8750 = 8615,
+        KW8751 = 8616,
+        KW8752 = 8617,
+        KW8753 = 8618,
+        KW8754 = 8619,
+        KW8755 = 8620,
+        KW8756 = 8621,
+        KW8757 = 8622,
+        KW8758 = 8623,
+        KW8759 = 8624,
+        KW876 = 8625,
+        KW8760 = 8626,
+        KW8761 = 8627,
+        KW8762 = 8628,
+        KW8763 = 8629,
+        KW8764 = 8630,
+        KW8765 = 8631,
+        KW8766 = 8632,
+        KW8767 = 8633,
+        KW8768 = 8634,
+        KW8769 = 8635,
+        KW877 = 8636,
+        KW8770 = 8637,
+        KW8771 = 8638,
+        KW8772 = 8639,
+        KW8773 = 8640,
+        KW8774 = 8641,
+        KW8775 = 8642,
+        KW8776 = 8643,
+        KW8777 = 8644,
+        KW8778 = 8645,
+        KW8779 = 8646,
+        KW878 = 8647,
+        KW8780 = 8648,
+        KW8781 = 8649,
+        KW8782 = 8650,
+        KW8783 = 8651,
+        KW8784 = 8652,
+        KW8785 = 8653,
+        KW8786 = 8654,
+        KW8787 = 8655,
+        KW8788 = 8656,
+        KW8789 = 8657,
+        KW879 = 8658,
+        KW8790 = 8659,
+        KW8791 = 8660,
+        KW8792 = 8661,
+        KW8793 = 8662,
+        KW8794 = 8663,
+        KW8795 = 8664,
+        KW8796 = 8665,
+        KW8797 = 8666,
+        KW8798 = 8667,
+        KW8799 = 8668,
+        KW88 = 8669,
+        KW880 = 8670,
+        KW8800 = 8671,
+        KW8801 = 8672,
+        KW8802 = 8673,
+        KW8803 = 8674,
+        KW8804 = 8675,
+        KW8805 = 8676,
+        KW8806 = 8677,
+        KW8807 = 8678,
+        KW8808 = 8679,
+        KW8809 = 8680,
+        KW881 = 8681,
+        KW8810 = 8682,
+        KW8811 = 8683,
+        KW8812 = 8684,
+        KW8813 = 8685,
+        KW8814 = 8686,
+        KW8815 = 8687,
+        KW8816 = 8688,
+        KW8817 = 8689,
+        KW8818 = 8690,
+        KW8819 = 8691,
+        KW882 = 8692,
+        KW8820 = 8693,
+        KW8821 = 8694,
+        KW8822 = 8695,
+        KW8823 = 8696,
+        KW8824 = 8697,
+        KW8825 = 8698,
+        KW8826 = 8699,
+        KW8827 = 8700,
+        KW8828 = 8701,
+        KW8829 = 8702,
+        KW883 = 8703,
+        KW8830 = 8704,
+        KW8831 = 8705,
+        KW8832 = 8706,
+        KW8833 = 8707,
+        KW8834 = 8708,
+        KW8835 = 8709,
+        KW8836 = 8710,
+        KW8837 = 8711,
+        KW8838 = 8712,
+        KW8839 = 8713,
+        KW884 = 8714,
+        KW8840 = 8715,
+        KW8841 = 8716,
+        KW8842 = 8717,
+        KW8843 = 8718,
+        KW8844 = 8719,
+        KW8845 = 8720,
+        KW8846 = 8721,
+        KW8847 = 8722,
+        KW8848 = 8723,
+        KW8849 = 8724,
+        KW885 = 8725,
+        KW8850 = 8726,
+        KW8851 = 8727,
+        KW8852 = 8728,
+        KW8853 = 8729,
+        KW8854 = 8730,
+        KW8855 = 8731,
+        KW8856 = 8732,
+        KW8857 = 8733,
+        KW8858 = 8734,
+        KW8859 = 8735,
+        KW886 = 8736,
+        KW8860 = 8737,
+        KW8861 = 8738,
+        KW8862 = 8739,
+        KW8863 = 8740,
+        KW8864 = 8741,
+        KW8865 = 8742,
+        KW8866 = 8743,
+        KW8867 = 8744,
+        KW8868 = 8745,
+        KW8869 = 8746,
+        KW887 = 8747,
+        KW8870 = 8748,
+        KW8871 = 8749,
+        KW8872 = 8750,
+        KW8873 = 8751,
+        KW8874 = 8752,
+        KW8875 = 8753,
+        KW8876 = 8754,
+        KW8877 = 8755,
+        KW8878 = 8756,
+        KW8879 = 8757,
+        KW888 = 8758,
+        KW8880 = 8759,
+        KW8881 = 8760,
+        KW8882 = 8761,
+        KW8883 = 8762,
+        KW8884 = 8763,
+        KW8885 = 8764,
+        KW8886 = 8765,
+        KW8887 = 8766,
+        KW8888 = 8767,
+        KW8889 = 8768,
+        KW889 = 8769,
+        KW8890 = 8770,
+        KW8891 = 8771,
+        KW8892 = 8772,
+        KW8893 = 8773,
+        KW8894 = 8774,
+        KW8895 = 8775,
+        KW8896 = 8776,
+        KW8897 = 8777,
+        KW8898 = 8778,
+        KW8899 = 8779,
+        KW89 = 8780,
+        KW890 = 8781,
+        KW8900 = 8782,
+        KW8901 = 8783,
+        KW8902 = 8784,
+        KW8903 = 8785,
+        KW8904 = 8786,
+        KW8905 = 8787,
+        KW8906 = 8788,
+        KW8907 = 8789,
+        KW8908 = 8790,
+        KW8909 = 8791,
+        KW891 = 8792,
+        KW8910 = 8793,
+        KW8911 = 8794,
+        KW8912 = 8795,
+        KW8913 = 8796,
+        KW8914 = 8797,
+        KW8915 = 8798,
+        KW8916 = 8799,
+        KW8917 = 8800,
+        KW8918 = 8801,
+        KW8919 = 8802,
+        KW892 = 8803,
+        KW8920 = 8804,
+        KW8921 = 8805,
+        KW8922 = 8806,
+        KW8923 = 8807,
+        KW8924 = 8808,
+        KW8925 = 8809,
+        KW8926 = 8810,
+        KW8927 = 8811,
+        KW8928 = 8812,
+        KW8929 = 8813,
+        KW893 = 8814,
+        KW8930 = 8815,
+        KW8931 = 8816,
+        KW8932 = 8817,
+        KW8933 = 8818,
+        KW8934 = 8819,
+        KW8935 = 8820,
+        KW8936 = 8821,
+        KW8937 = 8822,
+        KW8938 = 8823,
+        KW8939 = 8824,
+        KW894 = 8825,
+        KW8940 = 8826,
+        KW8941 = 8827,
+        KW8942 = 8828,
+        KW8943 = 8829,
+        KW8944 = 8830,
+        KW8945 = 8831,
+        KW8946 = 8832,
+        KW8947 = 8833,
+        KW8948 = 8834,
+        KW8949 = 8835,
+        KW895 = 8836,
+        KW8950 = 8837,
+        KW8951 = 8838,
+        KW8952 = 8839,
+        KW8953 = 8840,
+        KW8954 = 8841,
+        KW8955 = 8842,
+        KW8956 = 8843,
+        KW8957 = 8844,
+        KW8958 = 8845,
+        KW8959 = 8846,
+        KW896 = 8847,
+        KW8960 = 8848,
+        KW8961 = 8849,
+        KW8962 = 8850,
+        KW8963 = 8851,
+        KW8964 = 8852,
+        KW8965 = 8853,
+        KW8966 = 8854,
+        KW8967 = 8855,
+        KW8968 = 8856,
+        KW8969 = 8857,
+        KW897 = 8858,
+        KW8970 = 8859,
+        KW8971 = 8860,
+        KW8972 = 8861,
+        KW8973 = 8862,
+        KW8974 = 8863,
+        KW8975 = 8864,
+        KW8976 = 8865,
+        KW8977 = 8866,
+        KW8978 = 8867,
+        KW8979 = 8868,
+        KW898 = 8869,
+        KW8980 = 8870,
+        KW8981 = 8871,
+        KW8982 = 8872,
+        KW8983 = 8873,
+        KW8984 = 8874,
+        KW8985 = 8875,
+        KW8986 = 8876,
+        KW8987 = 8877,
+        KW8988 = 8878,
+        KW8989 = 8879,
+        KW899 = 8880,
+        KW8990 = 8881,
+        KW8991 = 8882,
+        KW8992 = 8883,
+        KW8993 = 8884,
+        KW8994 = 8885,
+        KW8995 = 8886,
+        KW8996 = 8887,
+        KW8997 = 8888,
+        KW8998 = 8889,
+        KW8999 = 8890,
+        KW9 = 8891,
+        KW90 = 8892,
+        KW900 = 8893,
+        KW9000 = 8894,
+        KW9001 = 8895,
+        KW9002 = 8896,
+        KW9003 = 8897,
+        KW9004 = 8898,
+        KW9005 = 8899,
+        KW9006 = 8900,
+        KW9007 = 8901,
+        KW9008 = 8902,
+        KW9009 = 8903,
+        KW901 = 8904,
+        KW9010 = 8905,
+        KW9011 = 8906,
+        KW9012 = 8907,
+        KW9013 = 8908,
+        KW9014 = 8909,
+        KW9015 = 8910,
+        KW9016 = 8911,
+        KW9017 = 8912,
+        KW9018 = 8913,
+        KW9019 = 8914,
+        KW902 = 8915,
+        KW9020 = 8916,
+        KW9021 = 8917,
+        KW9022 = 8918,
+        KW9023 = 8919,
+        KW9024 = 8920,
+        KW9025 = 8921,
+        KW9026 = 8922,
+        KW9027 = 8923,
+        KW9028 = 8924,
+        KW9029 = 8925,
+        KW903 = 8926,
+        KW9030 = 8927,
+        KW9031 = 8928,
+        KW9032 = 8929,
+        KW9033 = 8930,
+        KW9034 = 8931,
+        KW9035 = 8932,
+        KW9036 = 8933,
+        KW9037 = 8934,
+        KW9038 = 8935,
+        KW9039 = 8936,
+        KW904 = 8937,
+        KW9040 = 8938,
+        KW9041 = 8939,
+        KW9042 = 8940,
+        KW9043 = 8941,
+        KW9044 = 8942,
+        KW9045 = 8943,
+        KW9046 = 8944,
+        KW9047 = 8945,
+        KW9048 = 8946,
+        KW9049 = 8947,
+        KW905 = 8948,
+        KW9050 = 8949,
+        KW9051 = 8950,
+        KW9052 = 8951,
+        KW9053 = 8952,
+        KW9054 = 8953,
+        KW9055 = 8954,
+        KW9056 = 8955,
+        KW9057 = 8956,
+        KW9058 = 8957,
+        KW9059 = 8958,
+        KW906 = 8959,
+        KW9060 = 8960,
+        KW9061 = 8961,
+        KW9062 = 8962,
+        KW9063 = 8963,
+        KW9064 = 8964,
+        KW9065 = 8965,
+        KW9066 = 8966,
+        KW9067 = 8967,
+        KW9068 = 8968,
+        KW9069 = 8969,
+        KW907 = 8970,
+        KW9070 = 8971,
+        KW9071 = 8972,
+        KW9072 = 8973,
+        KW9073 = 8974,
+        KW9074 = 8975,
+        KW9075 = 8976,
+        KW9076 = 8977,
+        KW9077 = 8978,
+        KW9078 = 8979,
+        KW9079 = 8980,
+        KW908 = 8981,
+        KW9080 = 8982,
+        KW9081 = 8983,
+        KW9082 = 8984,
+        KW9083 = 8985,
+        KW9084 = 8986,
+        KW9085 = 8987,
+        KW9086 = 8988,
+        KW9087 = 8989,
+        KW9088 = 8990,
+        KW9089 = 8991,
+        KW909 = 8992,
+        KW9090 = 8993,
+        KW9091 = 8994,
+        KW9092 = 8995,
+        KW9093 = 8996,
+        KW9094 = 8997,
+        KW9095 = 8998,
+        KW9096 = 8999,
+        KW9097 = 9000,
+        KW9098 = 9001,
+        KW9099 = 9002,
+        KW91 = 9003,
+        KW910 = 9004,
+        KW9100 = 9005,
+        KW9101 = 9006,
+        KW9102 = 9007,
+        KW9103 = 9008,
+        KW9104 = 9009,
+        KW9105 = 9010,
+        KW9106 = 9011,
+        KW9107 = 9012,
+        KW9108 = 9013,
+        KW9109 = 9014,
+        KW911 = 9015,
+        KW9110 = 9016,
+        KW9111 = 9017,
+        KW9112 = 9018,
+        KW9113 = 9019,
+        KW9114 = 9020,
+        KW9115 = 9021,
+        KW9116 = 9022,
+        KW9117 = 9023,
+        KW9118 = 9024,
+        KW9119 = 9025,
+        KW912 = 9026,
+        KW9120 = 9027,
+        KW9121 = 9028,
+        KW9122 = 9029,
+        KW9123 = 9030,
+        KW9124 = 9031,
+        KW9125 = 9032,
+        KW9126 = 9033,
+        KW9127 = 9034,
+        KW9128 = 9035,
+        KW9129 = 9036,
+        KW913 = 9037,
+        KW9130 = 9038,
+        KW9131 = 9039,
+        KW9132 = 9040,
+        KW9133 = 9041,
+        KW9134 = 9042,
+        KW9135 = 9043,
+        KW9136 = 9044,
+        KW9137 = 9045,
+        KW9138 = 9046,
+        KW9139 = 9047,
+        KW914 = 9048,
+        KW9140 = 9049,
+        KW9141 = 9050,
+        KW9142 = 9051,
+        KW9143 = 9052,
+        KW9144 = 9053,
+        KW9145 = 9054,
+        KW9146 = 9055,
+        KW9147 = 9056,
+        KW9148 = 9057,
+        KW9149 = 9058,
+        KW915 = 9059,
+        KW9150 = 9060,
+        KW9151 = 9061,
+        KW9152 = 9062,
+        KW9153 = 9063,
+        KW9154 = 9064,
+        KW9155 = 9065,
+        KW9156 = 9066,
+        KW9157 = 9067,
+        KW9158 = 9068,
+        KW9159 = 9069,
+        KW916 = 9070,
+        KW9160 = 9071,
+        KW9161 = 9072,
+        KW9162 = 9073,
+        KW9163 = 9074,
+        KW9164 = 9075,
+        KW9165 = 9076,
+        KW9166 = 9077,
+        KW9167 = 9078,
+        KW9168 = 9079,
+        KW9169 = 9080,
+        KW917 = 9081,
+        KW9170 = 9082,
+        KW9171 = 9083,
+        KW9172 = 9084,
+        KW9173 = 9085,
+        KW9174 = 9086,
+        KW9175 = 9087,
+        KW9176 = 9088,
+        KW9177 = 9089,
+        KW9178 = 9090,
+        KW9179 = 9091,
+        KW918 = 9092,
+        KW9180 = 9093,
+        KW9181 = 9094,
+        KW9182 = 9095,
+        KW9183 = 9096,
+        KW9184 = 9097,
+        KW9185 = 9098,
+        KW9186 = 9099,
+        KW9187 = 9100,
+        KW9188 = 9101,
+        KW9189 = 9102,
+        KW919 = 9103,
+        KW9190 = 9104,
+        KW9191 = 9105,
+        KW9192 = 9106,
+        KW9193 = 9107,
+        KW9194 = 9108,
+        KW9195 = 9109,
+        KW9196 = 9110,
+        KW9197 = 9111,
+        KW9198 = 9112,
+        KW9199 = 9113,
+        KW92 = 9114,
+        KW920 = 9115,
+        KW9200 = 9116,
+        KW9201 = 9117,
+        KW9202 = 9118,
+        KW9203 = 9119,
+        KW9204 = 9120,
+        KW9205 = 9121,
+        KW9206 = 9122,
+        KW9207 = 9123,
+        KW9208 = 9124,
+        KW9209 = 9125,
+        KW921 = 9126,
+        KW9210 = 9127,
+        KW9211 = 9128,
+        KW9212 = 9129,
+        KW9213 = 9130,
+        KW9214 = 9131,
+        KW9215 = 9132,
+        KW9216 = 9133,
+        KW9217 = 9134,
+        KW9218 = 9135,
+        KW9219 = 9136,
+        KW922 = 9137,
+        KW9220 = 9138,
+        KW9221 = 9139,
+        KW9222 = 9140,
+        KW9223 = 9141,
+        KW9224 = 9142,
+        KW9225 = 9143,
+        KW9226 = 9144,
+        KW9227 = 9145,
+        KW9228 = 9146,
+        KW9229 = 9147,
+        KW923 = 9148,
+        KW9230 = 9149,
+        KW9231 = 9150,
+        KW9232 = 9151,
+        KW9233 = 9152,
+        KW9234 = 9153,
+        KW9235 = 9154,
+        KW9236 = 9155,
+        KW9237 = 9156,
+        KW9238 = 9157,
+        KW9239 = 9158,
+        KW924 = 9159,
+        KW9240 = 9160,
+        KW9241 = 9161,
+        KW9242 = 9162,
+        KW9243 = 9163,
+        KW9244 = 9164,
+        KW9245 = 9165,
+        KW9246 = 9166,
+        KW9247 = 9167,
+        KW9248 = 9168,
+        KW9249 = 9169,
+        KW925 = 9170,
+        KW9250 = 9171,
+        KW9251 = 9172,
+        KW9252 = 9173,
+        KW9253 = 9174,
+        KW9254 = 9175,
+        KW9255 = 9176,
+        KW9256 = 9177,
+        KW9257 = 9178,
+        KW9258 = 9179,
+        KW9259 = 9180,
+        KW926 = 9181,
+        KW9260 = 9182,
+        KW9261 = 9183,
+        KW9262 = 9184,
+        KW9263 = 9185,
+        KW9264 = 9186,
+        KW9265 = 9187,
+        KW9266 = 9188,
+        KW9267 = 9189,
+        KW9268 = 9190,
+        KW9269 = 9191,
+        KW927 = 9192,
+        KW9270 = 9193,
+        KW9271 = 9194,
+        KW9272 = 9195,
+        KW9273 = 9196,
+        KW9274 = 9197,
+        KW9275 = 9198,
+        KW9276 = 9199,
+        KW9277 = 9200,
+        KW9278 = 9201,
+        KW9279 = 9202,
+        KW928 = 9203,
+        KW9280 = 9204,
+        KW9281 = 9205,
+        KW9282 = 9206,
+        KW9283 = 9207,
+        KW9284 = 9208,
+        KW9285 = 9209,
+        KW9286 = 9210,
+        KW9287 = 9211,
+        KW9288 = 9212,
+        KW9289 = 9213,
+        KW929 = 9214,
+        KW9290 = 9215,
+        KW9291 = 9216,
+        KW9292 = 9217,
+        KW9293 = 9218,
+        KW9294 = 9219,
+        KW9295 = 9220,
+        KW9296 = 9221,
+        KW9297 = 9222,
+        KW9298 = 9223,
+        KW9299 = 9224,
+        KW93 = 9225,
+        KW930 = 9226,
+        KW9300 = 9227,
+        KW9301 = 9228,
+        KW9302 = 9229,
+        KW9303 = 9230,
+        KW9304 = 9231,
+        KW9305 = 9232,
+        KW9306 = 9233,
+        KW9307 = 9234,
+        KW9308 = 9235,
+        KW9309 = 9236,
+        KW931 = 9237,
+        KW9310 = 9238,
+        KW9311 = 9239,
+        KW9312 = 9240,
+        KW9313 = 9241,
+        KW9314 = 9242,
+        KW9315 = 9243,
+        KW9316 = 9244,
+        KW9317 = 9245,
+        KW9318 = 9246,
+        KW9319 = 9247,
+        KW932 = 9248,
+        KW9320 = 9249,
+        KW9321 = 9250,
+        KW9322 = 9251,
+        KW9323 = 9252,
+        KW9324 = 9253,
+        KW9325 = 9254,
+        KW9326 = 9255,
+        KW9327 = 9256,
+        KW9328 = 9257,
+        KW9329 = 9258,
+        KW933 = 9259,
+        KW9330 = 9260,
+        KW9331 = 9261,
+        KW9332 = 9262,
+        KW9333 = 9263,
+        KW9334 = 9264,
+        KW9335 = 9265,
+        KW9336 = 9266,
+        KW9337 = 9267,
+        KW9338 = 9268,
+        KW9339 = 9269,
+        KW934 = 9270,
+        KW9340 = 9271,
+        KW9341 = 9272,
+        KW9342 = 9273,
+        KW9343 = 9274,
+        KW9344 = 9275,
+        KW9345 = 9276,
+        KW9346 = 9277,
+        KW9347 = 9278,
+        KW9348 = 9279,
+        KW9349 = 9280,
+        KW935 = 9281,
+        KW9350 = 9282,
+        KW9351 = 9283,
+        KW9352 = 9284,
+        KW9353 = 9285,
+        KW9354 = 9286,
+        KW9355 = 9287,
+        KW9356 = 9288,
+        KW9357 = 9289,
+        KW9358 = 9290,
+        KW9359 = 9291,
+        KW936 = 9292,
+        KW9360 = 9293,
+        KW9361 = 9294,
+        KW9362 = 9295,
+        KW9363 = 9296,
+        KW9364 = 9297,
+        KW9365 = 9298,
+        KW9366 = 9299,
+        KW9367 = 9300,
+        KW9368 = 9301,
+        KW9369 = 9302,
+        KW937 = 9303,
+        KW9370 = 9304,
+        KW9371 = 9305,
+        KW9372 = 9306,
+        KW9373 = 9307,
+        KW9374 = 9308,
+        KW9375 = 9309,
+        KW9376 = 9310,
+        KW9377 = 9311,
+        KW9378 = 9312,
+        KW9379 = 9313,
+        KW938 = 9314,
+        KW9380 = 9315,
+        KW9381 = 9316,
+        KW9382 = 9317,
+        KW9383 = 9318,
+        KW9384 = 9319,
+        KW9385 = 9320,
+        KW9386 = 9321,
+        KW9387 = 9322,
+        KW9388 = 9323,
+        KW9389 = 9324,
+        KW939 = 9325,
+        KW9390 = 9326,
+        KW9391 = 9327,
+        KW9392 = 9328,
+        KW9393 = 9329,
+        KW9394 = 9330,
+        KW9395 = 9331,
+        KW9396 = 9332,
+        KW9397 = 9333,
+        KW9398 = 9334,
+        KW9399 = 9335,
+        KW94 = 9336,
+        KW940 = 9337,
+        KW9400 = 9338,
+        KW9401 = 9339,
+        KW9402 = 9340,
+        KW9403 = 9341,
+        KW9404 = 9342,
+        KW9405 = 9343,
+        KW9406 = 9344,
+        KW9407 = 9345,
+        KW9408 = 9346,
+        KW9409 = 9347,
+        KW941 = 9348,
+        KW9410 = 9349,
+        KW9411 = 9350,
+        KW9412 = 9351,
+        KW9413 = 9352,
+        KW9414 = 9353,
+        KW9415 = 9354,
+        KW9416 = 9355,
+        KW9417 = 9356,
+        KW9418 = 9357,
+        KW9419 = 9358,
+        KW942 = 9359,
+        KW9420 = 9360,
+        KW9421 = 9361,
+        KW9422 = 9362,
+        KW9423 = 9363,
+        KW9424 = 9364,
+        KW9425 = 9365,
+        KW9426 = 9366,
+        KW9427 = 9367,
+        KW9428 = 9368,
+        KW9429 = 9369,
+        KW943 = 9370,
+        KW9430 = 9371,
+        KW9431 = 9372,
+        KW9432 = 9373,
+        KW9433 = 9374,
+        KW9434 = 9375,
+        KW9435 = 9376,
+        KW9436 = 9377,
+        KW9437 = 9378,
+        KW9438 = 9379,
+        KW9439 = 9380,
+        KW944 = 9381,
+        KW9440 = 9382,
+        KW9441 = 9383,
+        KW9442 = 9384,
+        KW9443 = 9385,
+        KW9444 = 9386,
+        KW9445 = 9387,
+        KW9446 = 9388,
+        KW9447 = 9389,
+        KW9448 = 9390,
+        KW9449 = 9391,
+        KW945 = 9392,
+        KW9450 = 9393,
+        KW9451 = 9394,
+        KW9452 = 9395,
+        KW9453 = 9396,
+        KW9454 = 9397,
+        KW9455 = 9398,
+        KW9456 = 9399,
+        KW9457 = 9400,
+        KW9458 = 9401,
+        KW9459 = 9402,
+        KW946 = 9403,
+        KW9460 = 9404,
+        KW9461 = 9405,
+        KW9462 = 9406,
+        KW9463 = 9407,
+        KW9464 = 9408,
+        KW9465 = 9409,
+        KW9466 = 9410,
+        KW9467 = 9411,
+        KW9468 = 9412,
+        KW9469 = 9413,
+        KW947 = 9414,
+        KW9470 = 9415,
+        KW9471 = 9416,
+        KW9472 = 9417,
+        KW9473 = 9418,
+        KW9474 = 9419,
+        KW9475 = 9420,
+        KW9476 = 9421,
+        KW9477 = 9422,
+        KW9478 = 9423,
+        KW9479 = 9424,
+        KW948 = 9425,
+        KW9480 = 9426,
+        KW9481 = 9427,
+        KW9482 = 9428,
+        KW9483 = 9429,
+        KW9484 = 9430,
+        KW9485 = 9431,
+        KW9486 = 9432,
+        KW9487 = 9433,
+        KW9488 = 9434,
+        KW9489 = 9435,
+        KW949 = 9436,
+        KW9490 = 9437,
+        KW9491 = 9438,
+        KW9492 = 9439,
+        KW9493 = 9440,
+        KW9494 = 9441,
+        KW9495 = 9442,
+        KW9496 = 9443,
+        KW9497 = 9444,
+        KW9498 = 9445,
+        KW9499 = 9446,
+        KW95 = 9447,
+        KW950 = 9448,
+        KW9500 = 9449,
+        KW9501 = 9450,
+        KW9502 = 9451,
+        KW9503 = 9452,
+        KW9504 = 9453,
+        KW9505 = 9454,
+        KW9506 = 9455,
+        KW9507 = 9456,
+        KW9508 = 9457,
+        KW9509 = 9458,
+        KW951 = 9459,
+        KW9510 = 9460,
+        KW9511 = 9461,
+        KW9512 = 9462,
+        KW9513 = 9463,
+        KW9514 = 9464,
+        KW9515 = 9465,
+        KW9516 = 9466,
+        KW9517 = 9467,
+        KW9518 = 9468,
+        KW9519 = 9469,
+        KW952 = 9470,
+        KW9520 = 9471,
+        KW9521 = 9472,
+        KW9522 = 9473,
+        KW9523 = 9474,
+        KW9524 = 9475,
+        KW9525 = 9476,
+        KW9526 = 9477,
+        KW9527 = 9478,
+        KW9528 = 9479,
+        KW9529 = 9480,
+        KW953 = 9481,
+        KW9530 = 9482,
+        KW9531 = 9483,
+        KW9532 = 9484,
+        KW9533 = 9485,
+        KW9534 = 9486,
+        KW9535 = 9487,
+        KW9536 = 9488,
+        KW9537 = 9489,
+        KW9538 = 9490,
+        KW9539 = 9491,
+        KW954 = 9492,
+        KW9540 = 9493,
+        KW9541 = 9494,
+        KW9542 = 9495,
+        KW9543 = 9496,
+        KW9544 = 9497,
+        KW9545 = 9498,
+        KW9546 = 9499,
+        KW9547 = 9500,
+        KW9548 = 9501,
+        KW9549 = 9502,
+        KW955 = 9503,
+        KW9550 = 9504,
+        KW9551 = 9505,
+        KW9552 = 9506,
+        KW9553 = 9507,
+        KW9554 = 9508,
+        KW9555 = 9509,
+        KW9556 = 9510,
+        KW9557 = 9511,
+        KW9558 = 9512,
+        KW9559 = 9513,
+        KW956 = 9514,
+        KW9560 = 9515,
+        KW9561 = 9516,
+        KW9562 = 9517,
+        KW9563 = 9518,
+        KW9564 = 9519,
+        KW9565 = 9520,
+        KW9566 = 9521,
+        KW9567 = 9522,
+        KW9568 = 9523,
+        KW9569 = 9524,
+        KW957 = 9525,
+        KW9570 = 9526,
+        KW9571 = 9527,
+        KW9572 = 9528,
+        KW9573 = 9529,
+        KW9574 = 9530,
+        KW9575 = 9531,
+        KW9576 = 9532,
+        KW9577 = 9533,
+        KW9578 = 9534,
+        KW9579 = 9535,
+        KW958 = 9536,
+        KW9580 = 9537,
+        KW9581 = 9538,
+        KW9582 = 9539,
+        KW9583 = 9540,
+        KW9584 = 9541,
+        KW9585 = 9542,
+        KW9586 = 9543,
+        KW9587 = 9544,
+        KW9588 = 9545,
+        KW9589 = 9546,
+        KW959 = 9547,
+        KW9590 = 9548,
+        KW9591 = 9549,
+        KW9592 = 9550,
+        KW9593 = 9551,
+        KW9594 = 9552,
+        KW9595 = 9553,
+        KW9596 = 9554,
+        KW9597 = 9555,
+        KW9598 = 9556,
+        KW9599 = 9557,
+        KW96 = 9558,
+        KW960 = 9559,
+        KW9600 = 9560,
+        KW9601 = 9561,
+        KW9602 = 9562,
+        KW9603 = 9563,
+        KW9604 = 9564,
+        KW9605 = 9565,
+        KW9606 = 9566,
+        KW9607 = 9567,
+        KW9608 = 9568,
+        KW9609 = 9569,
+        KW961 = 9570,
+        KW9610 = 9571,
+        KW9611 = 9572,
+        KW9612 = 9573,
+        KW9613 = 9574,
+        KW9614 = 9575,
+        KW9615 = 9576,
+        KW9616 = 9577,
+        KW9617 = 9578,
+        KW9618 = 9579,
+        KW9619 = 9580,
+        KW962 = 9581,
+        KW9620 = 9582,
+        KW9621 = 9583,
+        KW9622 = 9584,
+        KW9623 = 9585,
+        KW9624 = 9586,
+        KW9625 = 9587,
+        KW9626 = 9588,
+        KW9627 = 9589,
+        KW9628 = 9590,
+        KW9629 = 9591,
+        KW963 = 9592,
+        KW9630 = 9593,
+        KW9631 = 9594,
+        KW9632 = 9595,
+        KW9633 = 9596,
+        KW9634 = 9597,
+        KW9635 = 9598,
+        KW9636 = 9599,
+        KW9637 = 9600,
+        KW9638 = 9601,
+        KW9639 = 9602,
+        KW964 = 9603,
+        KW9640 = 9604,
+        KW9641 = 9605,
+        KW9642 = 9606,
+        KW9643 = 9607,
+        KW9644 = 9608,
+        KW9645 = 9609,
+        KW9646 = 9610,
+        KW9647 = 9611,
+        KW9648 = 9612,
+        KW9649 = 9613,
+        KW965 = 9614,
+        KW9650 = 9615,
+        KW9651 = 9616,
+        KW9652 = 9617,
+        KW9653 = 9618,
+        KW9654 = 9619,
+        KW9655 = 9620,
+        KW9656 = 9621,
+        KW9657 = 9622,
+        KW9658 = 9623,
+        KW9659 = 9624,
+        KW966 = 9625,
+        KW9660 = 9626,
+        KW9661 = 9627,
+        KW9662 = 9628,
+        KW9663 = 9629,
+        KW9664 = 9630,
+        KW9665 = 9631,
+        KW9666 = 9632,
+        KW9667 = 9633,
+        KW9668 = 9634,
+        KW9669 = 9635,
+        KW967 = 9636,
+        KW9670 = 9637,
+        KW9671 = 9638,
+        KW9672 = 9639,
+        KW9673 = 9640,
+        KW9674 = 9641,
+        KW9675 = 9642,
+        KW9676 = 9643,
+        KW9677 = 9644,
+        KW9678 = 9645,
+        KW9679 = 9646,
+        KW968 = 9647,
+        KW9680 = 9648,
+        KW9681 = 9649,
+        KW9682 = 9650,
+        KW9683 = 9651,
+        KW9684 = 9652,
+        KW9685 = 9653,
+        KW9686 = 9654,
+        KW9687 = 9655,
+        KW9688 = 9656,
+        KW9689 = 9657,
+        KW969 = 9658,
+        KW9690 = 9659,
+        KW9691 = 9660,
+        KW9692 = 9661,
+        KW9693 = 9662,
+        KW9694 = 9663,
+        KW9695 = 9664,
+        KW9696 = 9665,
+        KW9697 = 9666,
+        KW9698 = 9667,
+        KW9699 = 9668,
+        KW97 = 9669,
+        KW970 = 9670,
+        KW9700 = 9671,
+        KW9701 = 9672,
+        KW9702 = 9673,
+        KW9703 = 9674,
+        KW9704 = 9675,
+        KW9705 = 9676,
+        KW9706 = 9677,
+        KW9707 = 9678,
+        KW9708 = 9679,
+        KW9709 = 9680,
+        KW971 = 9681,
+        KW9710 = 9682,
+        KW9711 = 9683,
+        KW9712 = 9684,
+        KW9713 = 9685,
+        KW9714 = 9686,
+        KW9715 = 9687,
+        KW9716 = 9688,
+        KW9717 = 9689,
+        KW9718 = 9690,
+        KW9719 = 9691,
+        KW972 = 9692,
+        KW9720 = 9693,
+        KW9721 = 9694,
+        KW9722 = 9695,
+        KW9723 = 9696,
+        KW9724 = 9697,
+        KW9725 = 9698,
+        KW9726 = 9699,
+        KW9727 = 9700,
+        KW9728 = 9701,
+        KW9729 = 9702,
+        KW973 = 9703,
+        KW9730 = 9704,
+        KW9731 = 9705,
+        KW9732 = 9706,
+        KW9733 = 9707,
+        KW9734 = 9708,
+        KW9735 = 9709,
+        KW9736 = 9710,
+        KW9737 = 9711,
+        KW9738 = 9712,
+        KW9739 = 9713,
+        KW974 = 9714,
+        KW9740 = 9715,
+        KW9741 = 9716,
+        KW9742 = 9717,
+        KW9743 = 9718,
+        KW9744 = 9719,
+        KW9745 = 9720,
+        KW9746 = 9721,
+        KW9747 = 9722,
+        KW9748 = 9723,
+        KW9749 = 9724,
+        KW975 = 9725,
+        KW9750 = 9726,
+        KW9751 = 9727,
+        KW9752 = 9728,
+        KW9753 = 9729,
+        KW9754 = 9730,
+        KW9755 = 9731,
+        KW9756 = 9732,
+        KW9757 = 9733,
+        KW9758 = 9734,
+        KW9759 = 9735,
+        KW976 = 9736,
+        KW9760 = 9737,
+        KW9761 = 9738,
+        KW9762 = 9739,
+        KW9763 = 9740,
+        KW9764 = 9741,
+        KW9765 = 9742,
+        KW9766 = 9743,
+        KW9767 = 9744,
+        KW9768 = 9745,
+        KW9769 = 9746,
+        KW977 = 9747,
+        KW9770 = 9748,
+        KW9771 = 9749,
+        KW9772 = 9750,
+        KW9773 = 9751,
+        KW9774 = 9752,
+        KW9775 = 9753,
+        KW9776 = 9754,
+        KW9777 = 9755,
+        KW9778 = 9756,
+        KW9779 = 9757,
+        KW978 = 9758,
+        KW9780 = 9759,
+        KW9781 = 9760,
+        KW9782 = 9761,
+        KW9783 = 9762,
+        KW9784 = 9763,
+        KW9785 = 9764,
+        KW9786 = 9765,
+        KW9787 = 9766,
+        KW9788 = 9767,
+        KW9789 = 9768,
+        KW979 = 9769,
+        KW9790 = 9770,
+        KW9791 = 9771,
+        KW9792 = 9772,
+        KW9793 = 9773,
+        KW9794 = 9774,
+        KW9795 = 9775,
+        KW9796 = 9776,
+        KW9797 = 9777,
+        KW9798 = 9778,
+        KW9799 = 9779,
+        KW98 = 9780,
+        KW980 = 9781,
+        KW9800 = 9782,
+        KW9801 = 9783,
+        KW9802 = 9784,
+        KW9803 = 9785,
+        KW9804 = 9786,
+        KW9805 = 9787,
+        KW9806 = 9788,
+        KW9807 = 9789,
+        KW9808 = 9790,
+        KW9809 = 9791,
+        KW981 = 9792,
+        KW9810 = 9793,
+        KW9811 = 9794,
+        KW9812 = 9795,
+        KW9813 = 9796,
+        KW9814 = 9797,
+        KW9815 = 9798,
+        KW9816 = 9799,
+        KW9817 = 9800,
+        KW9818 = 9801,
+        KW9819 = 9802,
+        KW982 = 9803,
+        KW9820 = 9804,
+        KW9821 = 9805,
+        KW9822 = 9806,
+        KW9823 = 9807,
+        KW9824 = 9808,
+        KW9825 = 9809,
+        KW9826 = 9810,
+        KW9827 = 9811,
+        KW9828 = 9812,
+        KW9829 = 9813,
+        KW983 = 9814,
+        KW9830 = 9815,
+        KW9831 = 9816,
+        KW9832 = 9817,
+        KW9833 = 9818,
+        KW9834 = 9819,
+        KW9835 = 9820,
+        KW9836 = 9821,
+        KW9837 = 9822,
+        KW9838 = 9823,
+        KW9839 = 9824,
+        KW984 = 9825,
+        KW9840 = 9826,
+        KW9841 = 9827,
+        KW9842 = 9828,
+        KW9843 = 9829,
+        KW9844 = 9830,
+        KW9845 = 9831,
+        KW9846 = 9832,
+        KW9847 = 9833,
+        KW9848 = 9834,
+        KW9849 = 9835,
+        KW985 = 9836,
+        KW9850 = 9837,
+        KW9851 = 9838,
+        KW9852 = 9839,
+        KW9853 = 9840,
+        KW9854 = 9841,
+        KW9855 = 9842,
+        KW9856 = 9843,
+        KW9857 = 9844,
+        KW9858 = 9845,
+        KW9859 = 9846,
+        KW986 = 9847,
+        KW9860 = 9848,
+        KW9861 = 9849,
+        KW9862 = 9850,
+        KW9863 = 9851,
+        KW9864 = 9852,
+        KW9865 = 9853,
+        KW9866 = 9854,
+        KW9867 = 9855,
+        KW9868 = 9856,
+        KW9869 = 9857,
+        KW987 = 9858,
+        KW9870 = 9859,
+        KW9871 = 9860,
+        KW9872 = 9861,
+        KW9873 = 9862,
+        KW9874 = 9863,
+        KW9875 = 9864,
+        KW9876 = 9865,
+        KW9877 = 9866,
+        KW9878 = 9867,
+        KW9879 = 9868,
+        KW988 = 9869,
+        KW9880 = 9870,
+        KW9881 = 9871,
+        KW9882 = 9872,
+        KW9883 = 9873,
+        KW9884 = 9874,
+        KW9885 = 9875,
+        KW9886 = 9876,
+        KW9887 = 9877,
+        KW9888 = 9878,
+        KW9889 = 9879,
+        KW989 = 9880,
+        KW9890 = 9881,
+        KW9891 = 9882,
+        KW9892 = 9883,
+        KW9893 = 9884,
+        KW9894 = 9885,
+        KW9895 = 9886,
+        KW9896 = 9887,
+        KW9897 = 9888,
+        KW9898 = 9889,
+        KW9899 = 9890,
+        KW99 = 9891,
+        KW990 = 9892,
+        KW9900 = 9893,
+        KW9901 = 9894,
+        KW9902 = 9895,
+        KW9903 = 9896,
+        KW9904 = 9897,
+        KW9905 = 9898,
+        KW9906 = 9899,
+        KW9907 = 9900,
+        KW9908 = 9901,
+        KW9909 = 9902,
+        KW991 = 9903,
+        KW9910 = 9904,
+        KW9911 = 9905,
+        KW9912 = 9906,
+        KW9913 = 9907,
+        KW9914 = 9908,
+        KW9915 = 9909,
+        KW9916 = 9910,
+        KW9917 = 9911,
+        KW9918 = 9912,
+        KW9919 = 9913,
+        KW992 = 9914,
+        KW9920 = 9915,
+        KW9921 = 9916,
+        KW9922 = 9917,
+        KW9923 = 9918,
+        KW9924 = 9919,
+        KW9925 = 9920,
+        KW9926 = 9921,
+        KW9927 = 9922,
+        KW9928 = 9923,
+        KW9929 = 9924,
+        KW993 = 9925,
+        KW9930 = 9926,
+        KW9931 = 9927,
+        KW9932 = 9928,
+        KW9933 = 9929,
+        KW9934 = 9930,
+        KW9935 = 9931,
+        KW9936 = 9932,
+        KW9937 = 9933,
+        KW9938 = 9934,
+        KW9939 = 9935,
+        KW994 = 9936,
+        KW9940 = 9937,
+        KW9941 = 9938,
+        KW9942 = 9939,
+        KW9943 = 9940,
+        KW9944 = 9941,
+        KW9945 = 9942,
+        KW9946 = 9943,
+        KW9947 = 9944,
+        KW9948 = 9945,
+        KW9949 = 9946,
+        KW995 = 9947,
+        KW9950 = 9948,
+        KW9951 = 9949,
+        KW9952 = 9950,
+        KW9953 = 9951,
+        KW9954 = 9952,
+        KW9955 = 9953,
+        KW9956 = 9954,
+        KW9957 = 9955,
+        KW9958 = 9956,
+        KW9959 = 9957,
+        KW996 = 9958,
+        KW9960 = 9959,
+        KW9961 = 9960,
+        KW9962 = 9961,
+        KW9963 = 9962,
+        KW9964 = 9963,
+        KW9965 = 9964,
+        KW9966 = 9965,
+        KW9967 = 9966,
+        KW9968 = 9967,
+        KW9969 = 9968,
+        KW997 = 9969,
+        KW9970 = 9970,
+        KW9971 = 9971,
+        KW9972 = 9972,
+        KW9973 = 9973,
+        KW9974 = 9974,
+        KW9975 = 9975,
+        KW9976 = 9976,
+        KW9977 = 9977,
+        KW9978 = 9978,
+        KW9979 = 9979,
+        KW998 = 9980,
+        KW9980 = 9981,
+        KW9981 = 9982,
+        KW9982 = 9983,
+        KW9983 = 9984,
+        KW9984 = 9985,
+        KW9985 = 9986,
+        KW9986 = 9987,
+        KW9987 = 9988,
+        KW9988 = 9989,
+        KW9989 = 9990,
+        KW999 = 9991,
+        KW9990 = 9992,
+        KW9991 = 9993,
+        LP = 9994,
+        NUM = 9995,
+        PLUS = 9996,
+        RP = 9997,
+        SEMI = 9998
+    };
+
+    Bench( void );
+    ~Bench( void );
+
+
+    void parse( Bench::Terminal tok, int value );
+
+private:
+    privBenchImpl *myImplementation;
+
+
+};
+
+
+
+#endif /* _Bench_h_ */ 
@@ -31,7 +31,9 @@
 #include "Error.h"
 #include "Parser.h"
 #include "Grammar.h"
+#include "Profile.h"
 #include "RuleTable.h"
+#include "SymbolTable.h"
 #include "Version.h"
 
 
@@ -60,7 +62,9 @@ usageAndExit( const char *appName, int exitVal )
 {
 	std::cout << "Usage:\n" << appName <<
 		" [-b|--basis] [-n|--no-compress] [-g|--grammar-no-actions]\n"
-		"  [-l|--lang (c|c++|z)] [-d|--debug] [-v|--verbose] [-s|--stats]\n"
+		"  [-l|--lang (c|c++|z)] [-a|--lookahead (links|relations)]\n"
+		"  [-j|--jobs N] [-S|--shards N] [-C|--no-cache] [-d|--debug]\n"
+		"  [-v|--verbose] [-s|--stats] [-p|--profile file] [-t|--trace file]\n"
 		"  [-V|--version] [-h|--help] <grammarfile> <outputdir>\n\n"
 		" --basis                   Print only the basis in the output report.\n"
 		" --no-compress             Do not compress the action table.\n"
@@ -71,10 +75,36 @@ usageAndExit( const char *appName, int exitVal )
 		"                           c++ - C++, not exception friendly\n"
 		"                           z   - C++, uses the Zion Core library\n"
 		"                                 and should be exception safe.\n"
+		" --lookahead=<val>         How the LALR(1) lookaheads are computed.\n"
+		"                           links     - propagation links between\n"
+		"                                       configurations (default)\n"
+		"                           relations - DeRemer-Pennello relations,\n"
+		"                                       uses less memory\n"
+		" --jobs=<n>                Number of threads used to build the parser\n"
+		"                           states (default 1). With more than one job\n"
+		"                           the header and source are written at the\n"
+		"                           same time.\n"
+		" --shards=<n>              Spread the rule actions of a c++ parser over\n"
+		"                           n source files (file_rules0.cpp, ...), with\n"
+		"                           the parse tables in file_tables.cpp and the\n"
+		"                           parser class in file_impl.h, so they can be\n"
+		"                           compiled in parallel (default 1, a single\n"
+		"                           file.cpp). %include goes into every file, so\n"
+		"                           it should only hold declarations.\n"
+		" --no-cache                Always rebuild the parser tables instead of\n"
+		"                           reusing them from file.tables in the output\n"
+		"                           directory when only code in the grammar\n"
+		"                           changed (the cache is not used with\n"
+		"                           --verbose).\n"
 		" --debug                   Adds some basic debugging output to the\n"
 		"                           parser which will print as it parses.\n"
 		" --verbose                 Produce an extra report file (file.out).\n"
-		" --stats                   Print parser statistics to standard out.\n"
+		" --stats                   Print parser statistics, and the time and\n"
+		"                           peak heap use of every phase, to standard out.\n"
+		" --profile=<file>          Write the phase timings and the statistics\n"
+		"                           to file as JSON.\n"
+		" --trace=<file>            Write the phase timings and the statistics\n"
+		"                           to file as Chrome trace events.\n"
 		" --version                 Print the version number and exit.\n"
 		" --help                    Print this message and exit.\n\n"
 		" file.lem                  Grammar file to parse\n"
@@ -154,9 +184,15 @@ parseOptions( Grammar &g, int argc, char *argv[] )
 			{ "no-compress", 0, 0, 'n' },
 			{ "grammar-no-actions", 0, 0, 'g' },
 			{ "lang", 1, 0, 'l' },
+			{ "lookahead", 1, 0, 'a' },
+			{ "jobs", 1, 0, 'j' },
+			{ "shards", 1, 0, 'S' },
+			{ "no-cache", 0, 0, 'C' },
 			{ "debug", 0, 0, 'd' },
 			{ "verbose", 0, 0, 'v' },
 			{ "stats", 0, 0, 's' },
+			{ "profile", 1, 0, 'p' },
+			{ "trace", 1, 0, 't' },
 			{ "version", 0, 0, 'V' },
 			{ "help", 0, 0, 'h' },
 			{ 0, 0, 0, 0 }
@@ -168,7 +204,7 @@ parseOptions( Grammar &g, int argc, char *argv[] )
 	{
 		int c;
 		
-		c = getopt_long( argc, argv, "bngl:dvsVh", long_options, 0 );
+		c = getopt_long( argc, argv, "bngl:a:j:S:Cdvsp:t:Vh", long_options, 0 );
 		
 		// Next arg isn't an option.
 		// TERMINATE LOOP
@@ -216,6 +252,57 @@ parseOptions( Grammar &g, int argc, char *argv[] )
 				break;
 			}
 			
+			case 'a':
+			{
+				std::string method = optarg ? optarg : "";
+
+				if ( method == "links" )
+					g.setLookAheadMethod( Grammar::PROPAGATION_LINKS );
+				else if ( method == "relations" )
+					g.setLookAheadMethod( Grammar::DEREMER_PENNELLO );
+				else
+				{
+					std::cerr << "Unknown lookahead method '"
+							  << method << "'\n" << std::endl;
+					usageAndExit( argv[0], 1 );
+				}
+				break;
+			}
+			
+			case 'j':
+			{
+				char *end = 0;
+				long numJobs = optarg ? std::strtol( optarg, &end, 10 ) : 0;
+
+				if ( numJobs < 1 || ! end || *end != '\0' )
+				{
+					std::cerr << "Number of jobs must be a positive integer\n"
+							  << std::endl;
+					usageAndExit( argv[0], 1 );
+				}
+				g.setNumJobs( size_t( numJobs ) );
+				break;
+			}
+			
+			case 'S':
+			{
+				char *end = 0;
+				long numShards = optarg ? std::strtol( optarg, &end, 10 ) : 0;
+
+				if ( numShards < 1 || ! end || *end != '\0' )
+				{
+					std::cerr << "Number of shards must be a positive integer\n"
+							  << std::endl;
+					usageAndExit( argv[0], 1 );
+				}
+				g.setNumShards( size_t( numShards ) );
+				break;
+			}
+			
+			case 'C':
+				g.setUseCache( false );
+				break;
+				
 			case 'd':
 				g.setDebugOutput( true );
 				break;
@@ -226,6 +313,19 @@ parseOptions( Grammar &g, int argc, char *argv[] )
 				
 			case 's':
 				g.setStats( true );
+				Profile::get()->setEnabled( true );
+				break;
+				
+			case 'p':
+			case 't':
+				if ( ! optarg || optarg[0] == '\0' )
+				{
+					std::cerr << "Profile file name required\n" << std::endl;
+					usageAndExit( argv[0], 1 );
+				}
+				Profile::get()->addFile( c == 'p' ? Profile::JSON : Profile::TRACE,
+										 optarg );
+				Profile::get()->setEnabled( true );
 				break;
 				
 			case 'V':
@@ -276,7 +376,12 @@ main( int argc, char *argv[] )
 		
 			fileParse.setSourceFile( theGrammar.getSourceFile() );
 		
+			Profile::get()->beginPhase( "parse" );
 			fileParse.parse( &theGrammar );
+			
+			// The grammar is fully read, assign the final symbol indices
+			SymbolTable::get()->freeze();
+			Profile::get()->endPhase();
 		}
 		else
 		{
@@ -310,6 +415,9 @@ main( int argc, char *argv[] )
 				Error::get()->add( "%d parsing conflicts.",
 								   theGrammar.getNumConflicts() );
 			}
+			
+			if ( ! Profile::get()->writeFiles() )
+				Error::get()->add( "Unable to write the profile file." );
 		}
 	}
 	catch ( std::exception &e )